@@ -0,0 +1,251 @@
+#
+# Performance regression harness of S2E
+#
+# usage: python run_performance_regression.py <path to S2E executable> [--output report.json] [--baseline baseline.json]
+#        The reference scenarios are made from the sample initialize files (data/sample/initialize_files) in a work directory.
+#        All scenarios are executed with the fixed random seed, without the log output, and as fast as possible.
+#        The initialization time, the simulation steps per second, and the peak RSS of each scenario are written in a JSON report.
+#        When a baseline report of another build is given, the throughput is compared and the exit code is 1 for the regressions.
+#
+# note: The scenarios need the external libraries as the sample simulation (e.g., EGM96 coefficients, GNSS final products).
+#       The script uses only the standard library and works on Linux and macOS.
+#
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_INI_DIR = os.path.join(SCRIPT_DIR, '..', '..', 'data', 'sample', 'initialize_files')
+BASE_INI_FILE = 'sample_simulation_base.ini'
+SATELLITE_INI_FILE = 'sample_satellite.ini'
+NUMBER_OF_FORMATION_SPACECRAFT = 10
+
+# Settings applied to all scenarios: {file: {section: {key: value}}}
+COMMON_SETTINGS = {
+  BASE_INI_FILE: {
+    'TIME': {'simulation_speed_setting': '0'},
+    'MONTE_CARLO_EXECUTION': {'monte_carlo_enable': 'DISABLE'},
+    'RANDOMIZE': {'rand_seed': '0x11223344'},
+    'SIMULATION_SETTINGS': {'log_output': 'DISABLE', 'save_initialize_files': 'DISABLE', 'step_profiler': 'DISABLE',
+                            'save_snapshot_file': '', 'load_snapshot_file': ''},
+  },
+}
+
+# Reference scenarios
+SCENARIOS = {
+  # Sample single LEO satellite
+  'single_leo': {},
+  # Spherical harmonics gravity with degree 100 and the full degree IGRF
+  'high_fidelity_gravity': {
+    'sample_disturbance.ini': {'GEOPOTENTIAL': {'calculation': 'ENABLE', 'degree': '100', 'coefficients_cache': 'ENABLE'}},
+    'sample_local_environment.ini': {'MAGNETIC_FIELD_ENVIRONMENT': {'evaluation_degree': '0'}},
+  },
+  # Ten satellites in the same orbit separated along the z axis (the satellite files are generated in make_formation_files)
+  'formation_10_satellites': {
+    BASE_INI_FILE: {'SIMULATION_SETTINGS': {'number_of_simulated_spacecraft': str(NUMBER_OF_FORMATION_SPACECRAFT)}},
+  },
+  # GNSS satellites calculation with the final products
+  'gnss_heavy': {
+    'sample_gnss.ini': {'GNSS_SATELLITES': {'calculation': 'ENABLE'}},
+  },
+  # Thermal calculation updated with the attitude update period
+  'thermal_heavy': {
+    BASE_INI_FILE: {'TIME': {'thermal_update_period_s': '0.1', 'thermal_integral_step_s': '0.01'}},
+    SATELLITE_INI_FILE: {'THERMAL': {'calculation': 'ENABLE', 'solar_calc_setting': 'ENABLE'}},
+  },
+}
+
+def set_ini_value(file_name, section, key, value):
+  with open(file_name, encoding='utf-8') as file:
+    lines = file.read().splitlines()
+
+  section_start = None
+  section_end = len(lines)
+  for i, line in enumerate(lines):
+    if re.match(r'^\s*\[.*\]', line):
+      if section_start is not None:
+        section_end = i
+        break
+      if line.strip() == '[' + section + ']':
+        section_start = i
+  if section_start is None:
+    lines += ['', '[' + section + ']']
+    section_start = len(lines) - 1
+    section_end = len(lines)
+
+  new_line = key + ' = ' + value
+  key_pattern = re.compile(r'^\s*' + re.escape(key) + r'\s*=')
+  for i in range(section_start + 1, section_end):
+    if key_pattern.match(lines[i]):
+      lines[i] = new_line
+      break
+  else:
+    # Add the key after the last line of the section
+    insert_index = section_end
+    while insert_index > section_start + 1 and lines[insert_index - 1].strip() == '':
+      insert_index -= 1
+    lines.insert(insert_index, new_line)
+
+  with open(file_name, 'w', encoding='utf-8') as file:
+    file.write('\n'.join(lines) + '\n')
+
+def get_ini_value(file_name, section, key):
+  current_section = None
+  with open(file_name, encoding='utf-8') as file:
+    for line in file:
+      match = re.match(r'^\s*\[(.*)\]', line)
+      if match:
+        current_section = match.group(1)
+        continue
+      match = re.match(r'^\s*' + re.escape(key) + r'\s*=\s*([^/\s]*)', line)
+      if current_section == section and match:
+        return match.group(1)
+  return None
+
+def apply_settings(ini_dir, settings):
+  for file_name, sections in settings.items():
+    for section, values in sections.items():
+      for key, value in values.items():
+        set_ini_value(os.path.join(ini_dir, file_name), section, key, value)
+
+def make_formation_files(ini_dir):
+  base_file = os.path.join(ini_dir, BASE_INI_FILE)
+  satellite_file = os.path.join(ini_dir, SATELLITE_INI_FILE)
+  initial_position_z_m = float(get_ini_value(satellite_file, 'ORBIT', 'initial_position_i_m(2)'))
+  for i in range(1, NUMBER_OF_FORMATION_SPACECRAFT):
+    file_name = 'sample_satellite_' + str(i) + '.ini'
+    shutil.copyfile(satellite_file, os.path.join(ini_dir, file_name))
+    set_ini_value(os.path.join(ini_dir, file_name), 'ORBIT', 'initial_position_i_m(2)', repr(initial_position_z_m + 100.0 * i))
+    set_ini_value(base_file, 'SIMULATION_SETTINGS', 'spacecraft_file(' + str(i) + ')', 'INI_FILE_DIR_FROM_EXE/' + file_name)
+
+def prepare_scenario(source_ini_dir, work_dir, name):
+  ini_dir = os.path.join(work_dir, name, 'initialize_files')
+  shutil.copytree(source_ini_dir, ini_dir)
+  if name.startswith('formation'):
+    make_formation_files(ini_dir)
+  apply_settings(ini_dir, COMMON_SETTINGS)
+  apply_settings(ini_dir, SCENARIOS[name])
+
+  # The file paths in the copied files point to the copied files
+  for root, _, files in os.walk(ini_dir):
+    for file_name in files:
+      if not file_name.endswith('.ini'):
+        continue
+      path = os.path.join(root, file_name)
+      with open(path, encoding='utf-8') as file:
+        text = file.read()
+      with open(path, 'w', encoding='utf-8') as file:
+        file.write(text.replace('INI_FILE_DIR_FROM_EXE', ini_dir))
+  return ini_dir
+
+def run_scenario(executable, ini_dir, log_dir):
+  base_file = os.path.join(ini_dir, BASE_INI_FILE)
+  output_file_name = os.path.join(os.path.dirname(ini_dir), 'output.txt')
+  # The executable is started in its directory since EXT_LIB_DIR_FROM_EXE is the relative path from the executable
+  with open(output_file_name, 'w') as output_file:
+    process = subprocess.Popen([executable, log_dir, base_file], cwd=os.path.dirname(executable), stdout=output_file,
+                               stderr=subprocess.STDOUT)
+    # wait4 returns the resource usage of the process itself
+    _, status, resource_usage = os.wait4(process.pid, 0)
+  with open(output_file_name, errors='replace') as output_file:
+    output = output_file.read()
+  if not os.WIFEXITED(status) or os.WEXITSTATUS(status) != 0:
+    raise RuntimeError('S2E exited abnormally (status ' + str(status) + '). See ' + output_file_name)
+
+  initialization_time_s = float(re.search(r'Initialization time: ([0-9.eE+-]+)', output).group(1))
+  execution_time_s = float(re.search(r'Simulation execution time: ([0-9.eE+-]+)', output).group(1))
+  number_of_steps = float(get_ini_value(base_file, 'TIME', 'simulation_duration_s')) / \
+                    float(get_ini_value(base_file, 'TIME', 'simulation_step_s'))
+  main_loop_time_s = max(execution_time_s - initialization_time_s, 1e-9)
+  # ru_maxrss is in kilobytes on Linux and in bytes on macOS
+  peak_rss_MiB = resource_usage.ru_maxrss / (1024.0 * 1024.0 if sys.platform == 'darwin' else 1024.0)
+  return {
+    'initialization_time_s': initialization_time_s,
+    'main_loop_time_s': main_loop_time_s,
+    'number_of_steps': number_of_steps,
+    'steps_per_second': number_of_steps / main_loop_time_s,
+    'peak_rss_MiB': peak_rss_MiB,
+  }
+
+def select_best(results):
+  # The fastest run is the least disturbed by the other processes
+  best = max(results, key=lambda result: result['steps_per_second'])
+  best = dict(best)
+  best['initialization_time_s'] = min(result['initialization_time_s'] for result in results)
+  best['peak_rss_MiB'] = max(result['peak_rss_MiB'] for result in results)
+  best['number_of_runs'] = len(results)
+  return best
+
+def compare(report, baseline, tolerance):
+  print('scenario, baseline [steps/s], current [steps/s], ratio, baseline RSS [MiB], current RSS [MiB]')
+  is_regressed = False
+  for name, result in report['scenarios'].items():
+    if name not in baseline['scenarios']:
+      continue
+    base = baseline['scenarios'][name]
+    ratio = result['steps_per_second'] / base['steps_per_second']
+    mark = ''
+    if ratio < 1.0 - tolerance:
+      mark = '  <- regression'
+      is_regressed = True
+    print('{}, {:.1f}, {:.1f}, {:.3f}, {:.1f}, {:.1f}{}'.format(name, base['steps_per_second'], result['steps_per_second'], ratio,
+                                                            base['peak_rss_MiB'], result['peak_rss_MiB'], mark))
+  return is_regressed
+
+def main():
+  parser = argparse.ArgumentParser(description='Run the reference scenarios and report the performance of S2E')
+  parser.add_argument('executable', help='path to the S2E executable')
+  parser.add_argument('--ini-dir', default=DEFAULT_INI_DIR, help='directory of the base initialize files')
+  parser.add_argument('--scenarios', nargs='+', choices=list(SCENARIOS.keys()), default=list(SCENARIOS.keys()), help='scenarios to run')
+  parser.add_argument('--repeat', type=int, default=3, help='number of runs of each scenario')
+  parser.add_argument('--output', default='performance_report.json', help='output report file')
+  parser.add_argument('--baseline', help='report of the baseline build to compare')
+  parser.add_argument('--tolerance', type=float, default=0.05, help='allowed decrease ratio of the throughput from the baseline')
+  parser.add_argument('--keep-work-dir', action='store_true', help='keep the generated initialize files and outputs')
+  args = parser.parse_args()
+
+  executable = os.path.abspath(args.executable)
+  work_dir = tempfile.mkdtemp(prefix='s2e_performance_')
+  report = {
+    'executable': executable,
+    'date': datetime.datetime.now().isoformat(timespec='seconds'),
+    'machine': platform.node(),
+    'processor': platform.processor() or platform.machine(),
+    'scenarios': {},
+  }
+  try:
+    for name in args.scenarios:
+      ini_dir = prepare_scenario(os.path.abspath(args.ini_dir), work_dir, name)
+      log_dir = os.path.join(work_dir, name, 'logs') + os.sep
+      os.makedirs(log_dir)
+      results = [run_scenario(executable, ini_dir, log_dir) for _ in range(max(args.repeat, 1))]
+      report['scenarios'][name] = select_best(results)
+      result = report['scenarios'][name]
+      print('{}: initialization {:.3f} s, {:.1f} steps/s, peak RSS {:.1f} MiB'.format(name, result['initialization_time_s'],
+                                                                                     result['steps_per_second'], result['peak_rss_MiB']))
+  finally:
+    if args.keep_work_dir:
+      print('Work directory: ' + work_dir)
+    else:
+      shutil.rmtree(work_dir, ignore_errors=True)
+
+  with open(args.output, 'w') as output_file:
+    json.dump(report, output_file, indent=2)
+  print('Report: ' + args.output)
+
+  if args.baseline:
+    with open(args.baseline) as baseline_file:
+      baseline = json.load(baseline_file)
+    if compare(report, baseline, args.tolerance):
+      sys.exit(1)
+
+if __name__ == '__main__':
+  main()
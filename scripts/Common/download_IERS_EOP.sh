@@ -0,0 +1,10 @@
+#!/bin/bash
+cd `dirname $0`
+
+#set variables
+DIR_EOP=../../../ExtLibraries/eop
+
+mkdir -p $DIR_EOP
+
+# IERS finals2000A file of the Earth orientation parameters (UT1-UTC and polar motion)
+curl https://datacenter.iers.org/data/9/finals2000A.all > $DIR_EOP/finals2000A.all
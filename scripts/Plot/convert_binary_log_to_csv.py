@@ -0,0 +1,99 @@
+#
+# Convert the binary log file (.s2elog) generated by S2E to the CSV log file
+#
+# usage: python convert_binary_log_to_csv.py <path to .s2elog> [<path to .s2elog> ...]
+#        The CSV file is written next to the binary log file with the .csv extension,
+#        so the other plot scripts can read it as well as the CSV log output.
+#        The compressed binary log file (.s2elog.gz) is decompressed block by block while reading.
+#
+
+import argparse
+import gzip
+import math
+import os
+import struct
+
+MAGIC = b'S2EBLOG\x00'
+SUPPORTED_VERSION = 1
+COLUMN_TYPE_DOUBLE = 0
+COLUMN_TYPE_STRING = 1
+
+def read_exact(file, size):
+  data = file.read(size)
+  if len(data) != size:
+    raise EOFError('unexpected end of file')
+  return data
+
+def read_uint32(file):
+  return struct.unpack('<I', read_exact(file, 4))[0]
+
+def format_double(value):
+  if math.isnan(value):
+    return ''
+  # Shortest representation which reproduces the stored value
+  return repr(value)
+
+def convert_stream(input_file, output_file):
+  """Convert a binary log stream to CSV and return the number of columns and rows"""
+  if read_exact(input_file, len(MAGIC)) != MAGIC:
+    raise ValueError('not a S2E binary log stream')
+  version = read_uint32(input_file)
+  if version != SUPPORTED_VERSION:
+    raise ValueError('version ' + str(version) + ' is not supported')
+
+  # Header
+  number_of_columns = read_uint32(input_file)
+  column_types = []
+  column_names = []
+  for _ in range(number_of_columns):
+    column_types.append(struct.unpack('<B', read_exact(input_file, 1))[0])
+    name_length = read_uint32(input_file)
+    column_names.append(read_exact(input_file, name_length).decode('utf-8'))
+  output_file.write(','.join(column_names) + ',\n')
+
+  # Chunks
+  number_of_rows_total = 0
+  while True:
+    chunk_head = input_file.read(4)
+    if len(chunk_head) == 0:
+      break
+    if len(chunk_head) != 4:
+      raise EOFError('unexpected end of file')
+    number_of_rows = struct.unpack('<I', chunk_head)[0]
+    columns = []
+    for column_type in column_types:
+      if column_type == COLUMN_TYPE_DOUBLE:
+        values = struct.unpack('<' + str(number_of_rows) + 'd', read_exact(input_file, 8 * number_of_rows))
+        columns.append([format_double(value) for value in values])
+      elif column_type == COLUMN_TYPE_STRING:
+        values = []
+        for _ in range(number_of_rows):
+          length = read_uint32(input_file)
+          values.append(read_exact(input_file, length).decode('utf-8'))
+        columns.append(values)
+      else:
+        raise ValueError('unknown column type: ' + str(column_type))
+    for row in range(number_of_rows):
+      output_file.write(','.join(column[row] for column in columns) + ',\n')
+    number_of_rows_total += number_of_rows
+
+  return number_of_columns, number_of_rows_total
+
+def convert(input_file_name, output_file_name):
+  open_function = gzip.open if input_file_name.endswith('.gz') else open
+  with open_function(input_file_name, 'rb') as input_file, open(output_file_name, 'w') as output_file:
+    try:
+      number_of_columns, number_of_rows_total = convert_stream(input_file, output_file)
+    except ValueError as error:
+      raise ValueError(input_file_name + ': ' + str(error))
+
+  print(output_file_name + ': ' + str(number_of_columns) + ' columns, ' + str(number_of_rows_total) + ' rows')
+
+if __name__ == '__main__':
+  aparser = argparse.ArgumentParser()
+  aparser.add_argument('input_files', nargs='+', help='path to the binary log files (.s2elog)')
+  args = aparser.parse_args()
+
+  for input_file_name in args.input_files:
+    output_file_name = input_file_name[:-len('.gz')] if input_file_name.endswith('.gz') else input_file_name
+    convert(input_file_name, os.path.splitext(output_file_name)[0] + '.csv')
@@ -0,0 +1,115 @@
+#
+# Extract the CSV logs from the Monte-Carlo log store (.s2emc) generated by S2E
+#
+# usage: python extract_monte_carlo_log_store.py <path to .s2emc> [--cases 0 5 12] [--output <directory>]
+#        The log of each case is written as case<index>.csv, and the randomized parameters of all cases are written as
+#        monte_carlo_parameters.csv in the output directory (the directory of the store file by default).
+#        The records are located with the index at the end of the file. When the index is missing (e.g., the campaign was
+#        terminated abnormally), the records are scanned from the beginning of the file.
+#
+
+import argparse
+import io
+import os
+import struct
+
+from convert_binary_log_to_csv import convert_stream
+
+STORE_MAGIC = b'S2EMCLOG'
+INDEX_MAGIC = b'S2EMCIDX'
+FOOTER_MAGIC = b'S2EMCEND'
+SUPPORTED_VERSION = 1
+RECORD_TYPE_CASE_LOG = 0
+RECORD_TYPE_PARAMETERS = 1
+
+RECORD_HEAD = struct.Struct('<BQQ')
+INDEX_ENTRY = struct.Struct('<BQQQ')
+FOOTER = struct.Struct('<Q8s')
+
+def read_index(store_file):
+  """Return the list of (type, case index, offset, size) of the records"""
+  if store_file.read(len(STORE_MAGIC)) != STORE_MAGIC:
+    raise ValueError('not a S2E Monte-Carlo log store')
+  version = struct.unpack('<I', store_file.read(4))[0]
+  if version != SUPPORTED_VERSION:
+    raise ValueError('version ' + str(version) + ' is not supported')
+  records_begin = store_file.tell()
+
+  # Index written at the end of the campaign
+  store_file.seek(0, os.SEEK_END)
+  file_size = store_file.tell()
+  if file_size >= records_begin + FOOTER.size:
+    store_file.seek(file_size - FOOTER.size)
+    index_offset, footer_magic = FOOTER.unpack(store_file.read(FOOTER.size))
+    if footer_magic == FOOTER_MAGIC:
+      store_file.seek(index_offset)
+      if store_file.read(len(INDEX_MAGIC)) != INDEX_MAGIC:
+        raise ValueError('broken index')
+      number_of_records = struct.unpack('<Q', store_file.read(8))[0]
+      return [INDEX_ENTRY.unpack(store_file.read(INDEX_ENTRY.size)) for _ in range(number_of_records)]
+
+  # Sequential scan of the records
+  print('[Warning] The index is not found. The records are scanned sequentially.')
+  index = []
+  position = records_begin
+  while position + RECORD_HEAD.size <= file_size:
+    store_file.seek(position)
+    record_type, case_index, size = RECORD_HEAD.unpack(store_file.read(RECORD_HEAD.size))
+    offset = position + RECORD_HEAD.size
+    if offset + size > file_size:
+      break  # Incomplete record at the end of the file
+    index.append((record_type, case_index, offset, size))
+    position = offset + size
+  return index
+
+def read_stream(store_file, index, record_type, case_index):
+  """Concatenate the payloads of the records of the case in the file order"""
+  stream = io.BytesIO()
+  for entry_type, entry_case, offset, size in index:
+    if entry_type == record_type and entry_case == case_index:
+      store_file.seek(offset)
+      stream.write(store_file.read(size))
+  stream.seek(0)
+  return stream
+
+def extract(store_file_name, output_directory, cases):
+  with open(store_file_name, 'rb') as store_file:
+    index = read_index(store_file)
+    case_indexes = sorted(set(entry[1] for entry in index if entry[0] == RECORD_TYPE_CASE_LOG))
+    if cases is not None:
+      case_indexes = [case_index for case_index in case_indexes if case_index in cases]
+
+    for case_index in case_indexes:
+      output_file_name = os.path.join(output_directory, 'case' + str(case_index) + '.csv')
+      with open(output_file_name, 'w') as output_file:
+        number_of_columns, number_of_rows = convert_stream(read_stream(store_file, index, RECORD_TYPE_CASE_LOG, case_index), output_file)
+      print(output_file_name + ': ' + str(number_of_columns) + ' columns, ' + str(number_of_rows) + ' rows')
+
+    # Randomized parameters: one row for each case
+    parameter_cases = sorted(set(entry[1] for entry in index if entry[0] == RECORD_TYPE_PARAMETERS))
+    if cases is not None:
+      parameter_cases = [case_index for case_index in parameter_cases if case_index in cases]
+    if len(parameter_cases) == 0:
+      return
+    output_file_name = os.path.join(output_directory, 'monte_carlo_parameters.csv')
+    with open(output_file_name, 'w') as output_file:
+      for number, case_index in enumerate(parameter_cases):
+        case_csv = io.StringIO()
+        convert_stream(read_stream(store_file, index, RECORD_TYPE_PARAMETERS, case_index), case_csv)
+        lines = case_csv.getvalue().splitlines()
+        if number == 0:
+          output_file.write('case,' + lines[0] + '\n')
+        for line in lines[1:]:
+          output_file.write(str(case_index) + ',' + line + '\n')
+    print(output_file_name + ': ' + str(len(parameter_cases)) + ' cases')
+
+if __name__ == '__main__':
+  aparser = argparse.ArgumentParser()
+  aparser.add_argument('store_file', help='path to the Monte-Carlo log store (.s2emc)')
+  aparser.add_argument('--cases', type=int, nargs='+', help='indexes of the cases to extract (all cases by default)')
+  aparser.add_argument('--output', help='output directory (the directory of the store file by default)')
+  args = aparser.parse_args()
+
+  output_directory = args.output if args.output is not None else os.path.dirname(os.path.abspath(args.store_file))
+  os.makedirs(output_directory, exist_ok=True)
+  extract(args.store_file, output_directory, None if args.cases is None else set(args.cases))
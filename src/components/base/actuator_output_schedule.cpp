@@ -0,0 +1,51 @@
+/**
+ * @file actuator_output_schedule.cpp
+ * @brief Piecewise-constant output schedule of actuators for the exact impulse integration
+ */
+
+#include "actuator_output_schedule.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+void ActuatorOutputSchedule::AddSegment(const double start_time_s, const double end_time_s, const libra::Vector<3>& force_b_N,
+                                        const libra::Vector<3>& torque_b_Nm) {
+  if (end_time_s <= start_time_s) return;
+  segments_.push_back(Segment{start_time_s, end_time_s, force_b_N, torque_b_Nm});
+}
+
+void ActuatorOutputSchedule::AddPwmSegments(const double start_time_s, const double end_time_s, const double pwm_start_time_s,
+                                            const double period_s, const double duty, const libra::Vector<3>& force_b_N,
+                                            const libra::Vector<3>& torque_b_Nm) {
+  const double clipped_duty = std::min(std::max(duty, 0.0), 1.0);
+  if (clipped_duty <= 0.0) return;
+  if (period_s <= 0.0 || clipped_duty >= 1.0) {
+    // Continuous output
+    AddSegment(start_time_s, end_time_s, clipped_duty * force_b_N, clipped_duty * torque_b_Nm);
+    return;
+  }
+
+  const double on_duration_s = clipped_duty * period_s;
+  double period_start_time_s = pwm_start_time_s + std::floor((start_time_s - pwm_start_time_s) / period_s) * period_s;
+  for (; period_start_time_s < end_time_s; period_start_time_s += period_s) {
+    AddSegment(std::max(period_start_time_s, start_time_s), std::min(period_start_time_s + on_duration_s, end_time_s), force_b_N, torque_b_Nm);
+  }
+}
+
+libra::Vector<3> ActuatorOutputSchedule::CalcImpulse_b_Ns(const double start_time_s, const double end_time_s) const {
+  libra::Vector<3> impulse_b_Ns(0.0);
+  for (const auto& segment : segments_) {
+    const double overlap_s = std::min(segment.end_time_s, end_time_s) - std::max(segment.start_time_s, start_time_s);
+    if (overlap_s > 0.0) impulse_b_Ns += overlap_s * segment.force_b_N;
+  }
+  return impulse_b_Ns;
+}
+
+libra::Vector<3> ActuatorOutputSchedule::CalcAngularImpulse_b_Nms(const double start_time_s, const double end_time_s) const {
+  libra::Vector<3> angular_impulse_b_Nms(0.0);
+  for (const auto& segment : segments_) {
+    const double overlap_s = std::min(segment.end_time_s, end_time_s) - std::max(segment.start_time_s, start_time_s);
+    if (overlap_s > 0.0) angular_impulse_b_Nms += overlap_s * segment.torque_b_Nm;
+  }
+  return angular_impulse_b_Nms;
+}
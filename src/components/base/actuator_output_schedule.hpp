@@ -0,0 +1,90 @@
+/**
+ * @file actuator_output_schedule.hpp
+ * @brief Piecewise-constant output schedule of actuators for the exact impulse integration
+ */
+
+#ifndef S2E_COMPONENTS_BASE_ACTUATOR_OUTPUT_SCHEDULE_HPP_
+#define S2E_COMPONENTS_BASE_ACTUATOR_OUTPUT_SCHEDULE_HPP_
+
+#include <math_physics/math/vector.hpp>
+#include <vector>
+
+/**
+ * @class ActuatorOutputSchedule
+ * @brief Piecewise-constant force and torque schedule reported by actuators for the coming interval
+ * @details The times are measured from the start of the interval. The impulse in any time range is calculated analytically from the segments,
+ *          so the PWM driven actuators do not need the fast update to emulate the on and off timings.
+ */
+class ActuatorOutputSchedule {
+ public:
+  /**
+   * @fn ActuatorOutputSchedule
+   * @brief Constructor
+   */
+  ActuatorOutputSchedule() {}
+
+  /**
+   * @fn Clear
+   * @brief Remove all segments
+   */
+  inline void Clear() { segments_.clear(); }
+  /**
+   * @fn IsEmpty
+   * @brief Return true when no segment is reported
+   */
+  inline bool IsEmpty() const { return segments_.empty(); }
+
+  /**
+   * @fn AddSegment
+   * @brief Add a constant output segment
+   * @param [in] start_time_s: Start time of the segment from the start of the interval [sec]
+   * @param [in] end_time_s: End time of the segment from the start of the interval [sec]
+   * @param [in] force_b_N: Force in the body fixed frame during the segment [N]
+   * @param [in] torque_b_Nm: Torque in the body fixed frame during the segment [Nm]
+   */
+  void AddSegment(const double start_time_s, const double end_time_s, const libra::Vector<3>& force_b_N, const libra::Vector<3>& torque_b_Nm);
+  /**
+   * @fn AddPwmSegments
+   * @brief Add the on segments of a PWM output in the range
+   * @note The output is on at the beginning of each period for duty * period
+   * @param [in] start_time_s: Start time of the range from the start of the interval [sec]
+   * @param [in] end_time_s: End time of the range from the start of the interval [sec]
+   * @param [in] pwm_start_time_s: Start time of the PWM periods from the start of the interval [sec]
+   * @param [in] period_s: PWM period [sec]
+   * @param [in] duty: PWM duty [0.0 : 1.0]
+   * @param [in] force_b_N: Force in the body fixed frame at the on state [N]
+   * @param [in] torque_b_Nm: Torque in the body fixed frame at the on state [Nm]
+   */
+  void AddPwmSegments(const double start_time_s, const double end_time_s, const double pwm_start_time_s, const double period_s, const double duty,
+                      const libra::Vector<3>& force_b_N, const libra::Vector<3>& torque_b_Nm);
+
+  /**
+   * @fn CalcImpulse_b_Ns
+   * @brief Calculate the impulse of the force in the time range in the body fixed frame [Ns]
+   * @param [in] start_time_s: Start time of the range from the start of the interval [sec]
+   * @param [in] end_time_s: End time of the range from the start of the interval [sec]
+   */
+  libra::Vector<3> CalcImpulse_b_Ns(const double start_time_s, const double end_time_s) const;
+  /**
+   * @fn CalcAngularImpulse_b_Nms
+   * @brief Calculate the angular impulse of the torque in the time range in the body fixed frame [Nms]
+   * @param [in] start_time_s: Start time of the range from the start of the interval [sec]
+   * @param [in] end_time_s: End time of the range from the start of the interval [sec]
+   */
+  libra::Vector<3> CalcAngularImpulse_b_Nms(const double start_time_s, const double end_time_s) const;
+
+ private:
+  /**
+   * @struct Segment
+   * @brief Constant output segment
+   */
+  struct Segment {
+    double start_time_s;           //!< Start time from the start of the interval [sec]
+    double end_time_s;             //!< End time from the start of the interval [sec]
+    libra::Vector<3> force_b_N;    //!< Force in the body fixed frame [N]
+    libra::Vector<3> torque_b_Nm;  //!< Torque in the body fixed frame [Nm]
+  };
+  std::vector<Segment> segments_;  //!< Reported segments
+};
+
+#endif  // S2E_COMPONENTS_BASE_ACTUATOR_OUTPUT_SCHEDULE_HPP_
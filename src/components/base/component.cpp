@@ -18,6 +18,7 @@ Component::Component(const unsigned int prescaler, ClockGenerator* clock_generat
   clock_generator_->RegisterComponent(this);
   prescaler_ = (prescaler > 0) ? prescaler : 1;
   fast_prescaler_ = (fast_prescaler > 0) ? fast_prescaler : 1;
+  if (clock_generator_->GetSkipsPowerOffComponents()) SetSleepWhilePowerOff(true);
 }
 
 Component::Component(const Component& object) {
@@ -27,13 +28,36 @@ Component::Component(const Component& object) {
   clock_generator_ = object.clock_generator_;
   clock_generator_->RegisterComponent(this);
   power_port_ = object.power_port_;
+  if (object.sleeps_while_power_off_) SetSleepWhilePowerOff(true);
 }
 
-Component::~Component() { clock_generator_->RemoveComponent(this); }
+Component::~Component() {
+  if (sleeps_while_power_off_) power_port_->RemoveObserver(this);
+  clock_generator_->RemoveComponent(this);
+}
+
+void Component::SetSleepWhilePowerOff(const bool sleeps_while_power_off) {
+  sleeps_while_power_off_ = sleeps_while_power_off;
+  if (sleeps_while_power_off_) {
+    power_port_->AddObserver(this);
+    SetIsSleeping(!power_port_->GetIsOn());
+  } else {
+    power_port_->RemoveObserver(this);
+    SetIsSleeping(false);
+  }
+}
+
+void Component::PowerStateChanged(const int port_id, const bool is_on) {
+  UNUSED(port_id);
+  if (!sleeps_while_power_off_) return;
+  if (!is_on) PowerOffRoutine();
+  SetIsSleeping(!is_on);
+}
 
 void Component::Tick(const unsigned int count) {
   if (count % prescaler_ > 0) return;
   if (power_port_->GetIsOn()) {
+    ScopedProfileTimer timer(profile_section_id_, typeid(*this), "MainRoutine");
     MainRoutine(count);
   } else {
     PowerOffRoutine();
@@ -8,8 +8,14 @@
 
 #include <components/ports/power_port.hpp>
 #include <environment/global/clock_generator.hpp>
+#include <typeinfo>
+#include <utilities/case_arena.hpp>
 #include <utilities/macros.hpp>
+#include <utilities/snapshot.hpp>
+#include <utilities/step_profiler.hpp>
 
+#include "actuator_output_schedule.hpp"
+#include "interface_power_port_observer.hpp"
 #include "interface_tickable.hpp"
 
 /**
@@ -17,7 +23,7 @@
  * @brief Base class for component emulation. All components have to inherit this.
  * @details Component ha clock and power on/off features
  */
-class Component : public ITickable {
+class Component : public ITickable, public IPowerPortObserver, public ArenaAllocated {
  public:
   /**
    * @fn Component
@@ -59,6 +65,59 @@ class Component : public ITickable {
    * @brief The methods to input fast clock. This will be called periodically.
    */
   virtual void FastTick(const unsigned int fast_count);
+  /**
+   * @fn GetPrescaler
+   * @brief Return the frequency scale factor for normal update
+   */
+  virtual unsigned int GetPrescaler() const { return prescaler_; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return the frequency scale factor for fast update
+   */
+  virtual unsigned int GetFastPrescaler() const { return fast_prescaler_; }
+
+  /**
+   * @fn SetSleepWhilePowerOff
+   * @brief Enable the sleep of the component while the power switch is off
+   * @details The sleeping component is removed from the schedule of ClockGenerator, so it costs nothing until the power port notifies the
+   *          power on. PowerOffRoutine is called only once when the power switch is turned off.
+   * @note The power port must outlive the component.
+   * @param [in] sleeps_while_power_off: Enable flag
+   */
+  void SetSleepWhilePowerOff(const bool sleeps_while_power_off);
+  /**
+   * @fn PowerStateChanged
+   * @brief Override function of IPowerPortObserver
+   * @note Derived classes overriding this function have to call Component::PowerStateChanged.
+   */
+  void PowerStateChanged(const int port_id, const bool is_on) override;
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the internal state of the component to the snapshot
+   * @note Override this function in the component which has the internal state (e.g. noise, delay buffer)
+   * @param [out] snapshot: Snapshot writer
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const { UNUSED(snapshot); }
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the internal state of the component from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot) { UNUSED(snapshot); }
+
+  /**
+   * @fn ReportOutputSchedule
+   * @brief Report the piecewise-constant force and torque of the actuator for the coming interval
+   * @note Override this function in the actuator switched faster than the component update (e.g. PWM driven thrusters). The reported
+   *       schedule is integrated exactly by the dynamics, so the switching does not need to be sampled with FastUpdate.
+   * @param [out] schedule: Output schedule to add the segments. The times are measured from the start of the interval.
+   * @param [in] interval_s: Length of the coming interval [sec]
+   */
+  virtual void ReportOutputSchedule(ActuatorOutputSchedule& schedule, const double interval_s) const {
+    UNUSED(schedule);
+    UNUSED(interval_s);
+  }
 
  protected:
   unsigned int prescaler_;           //!< Frequency scale factor for normal update
@@ -84,8 +143,40 @@ class Component : public ITickable {
    */
   virtual void PowerOffRoutine(){};
 
-  ClockGenerator* clock_generator_;  //!< Clock generator
-  PowerPort* power_port_;            //!< Power port
+  ClockGenerator* clock_generator_;                                 //!< Clock generator
+  PowerPort* power_port_;                                           //!< Power port
+  bool sleeps_while_power_off_ = false;                             //!< Flag to sleep while the power switch is off
+  size_t profile_section_id_ = StepProfiler::kUnregisteredSection;  //!< Section ID of MainRoutine in StepProfiler
+
+  /**
+   * @fn TickBatch
+   * @brief Execute Tick of the components whose concrete type is T with the non-virtual calls of MainRoutine
+   * @param [in] tickables: Components of type T
+   * @param [in] number_of_tickables: Number of components
+   * @param [in] count: Count of the clock
+   */
+  template <class T>
+  static void TickBatch(ITickable* const* tickables, const size_t number_of_tickables, const unsigned int count) {
+    for (size_t i = 0; i < number_of_tickables; i++) {
+      T* component = static_cast<T*>(tickables[i]);
+      if (count % component->prescaler_ > 0) continue;
+      if (component->power_port_->GetIsOn()) {
+        ScopedProfileTimer timer(component->profile_section_id_, typeid(T), "MainRoutine");
+        component->T::MainRoutine(count);
+      } else {
+        component->T::PowerOffRoutine();
+      }
+    }
+  }
+  /**
+   * @fn GetBatchTickFunctionOf
+   * @brief Return TickBatch<T> when the concrete type of this component is T
+   * @note Derived classes of T may override MainRoutine, so they are ticked one by one.
+   */
+  template <class T>
+  ITickable::BatchTickFunction GetBatchTickFunctionOf() const {
+    return (typeid(*this) == typeid(T)) ? &Component::TickBatch<T> : nullptr;
+  }
 };
 
 #endif  // S2E_COMPONENTS_BASE_COMPONENT_HPP_
@@ -163,3 +163,14 @@ int I2cTargetCommunicationWithObc::StoreTelemetry(const unsigned int stored_fram
   }
   return 0;
 }
+
+int I2cTargetCommunicationWithObc::StartAsyncTargetService(const unsigned int stored_frame_num, const unsigned char tlm_size,
+                                                           const unsigned int service_period_us) {
+  if (simulation_mode_ != SimulationMode::kHils) return -1;
+  return hils_port_manager_->I2cTargetStartAsyncService(hils_port_id_, stored_frame_num, tlm_size, service_period_us);
+}
+
+int I2cTargetCommunicationWithObc::PublishRegisters() {
+  if (simulation_mode_ != SimulationMode::kHils) return -1;
+  return hils_port_manager_->I2cTargetPublishRegisters(hils_port_id_);
+}
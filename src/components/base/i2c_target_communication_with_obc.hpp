@@ -103,6 +103,23 @@ class I2cTargetCommunicationWithObc {
    * @brief Store telemetry in converter up to stored_frame_num (HILS only)
    */
   int StoreTelemetry(const unsigned int stored_frame_num, const unsigned char tlm_size);
+  /**
+   * @fn StartAsyncTargetService
+   * @brief Handle the I2C-USB converter in a service thread (HILS only)
+   * @details The service thread keeps stored_frame_num telemetry frames in the converter from the registers published by PublishRegisters,
+   *          so StoreTelemetry is not needed. ReceiveCommand applies the commands received by the service thread.
+   * @note This wraps I2cTargetStartAsyncService in HilsPortManager
+   * @param [in] stored_frame_num: Number of the telemetry frames kept stored in the converter
+   * @param [in] tlm_size: Size of each telemetry frame [bytes]
+   * @param [in] service_period_us: Polling period of the converter [us]
+   */
+  int StartAsyncTargetService(const unsigned int stored_frame_num, const unsigned char tlm_size, const unsigned int service_period_us = 100);
+  /**
+   * @fn PublishRegisters
+   * @brief Publish the registers to the service thread once in each update of the component (HILS only)
+   * @note This wraps I2cTargetPublishRegisters in HilsPortManager
+   */
+  int PublishRegisters();
   /**
    * @fn GetI2cAddress
    * @brief Return I2C address
@@ -0,0 +1,30 @@
+/**
+ * @file interface_power_port_observer.hpp
+ * @brief Interface class for objects notified of the power switch state changes
+ */
+
+#ifndef S2E_COMPONENTS_BASE_CLASSES_INTERFACE_POWER_PORT_OBSERVER_HPP_
+#define S2E_COMPONENTS_BASE_CLASSES_INTERFACE_POWER_PORT_OBSERVER_HPP_
+
+/**
+ * @class IPowerPortObserver
+ * @brief Interface class for objects notified of the power switch state changes
+ */
+class IPowerPortObserver {
+ public:
+  /**
+   * @fn ~IPowerPortObserver
+   * @brief Destructor
+   */
+  virtual ~IPowerPortObserver(){};
+
+  /**
+   * @fn PowerStateChanged
+   * @brief Pure virtual function called when the power switch state of the observed port is changed
+   * @param[in] port_id: Power port ID
+   * @param[in] is_on: Power switch state after the change
+   */
+  virtual void PowerStateChanged(const int port_id, const bool is_on) = 0;
+};
+
+#endif  // S2E_COMPONENTS_BASE_CLASSES_INTERFACE_POWER_PORT_OBSERVER_HPP_
@@ -6,12 +6,24 @@
 #ifndef S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
 #define S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
 
+#include <atomic>
+#include <cstddef>
+
 /**
  * @class ITickable
  * @brief Interface class for time update of components
  */
 class ITickable {
  public:
+  /**
+   * @typedef BatchTickFunction
+   * @brief Function to execute Tick of the tickables of the same type at once
+   * @param [in] tickables: Tickables whose GetBatchTickFunction returns this function
+   * @param [in] number_of_tickables: Number of tickables
+   * @param [in] count: Count of the clock
+   */
+  typedef void (*BatchTickFunction)(ITickable* const* tickables, const size_t number_of_tickables, const unsigned int count);
+
   /**
    * @fn Tick
    * @brief Pure virtual function to update clock of components
@@ -24,6 +36,24 @@ class ITickable {
    */
   virtual void FastTick(const unsigned int fast_count) = 0;
 
+  // Update periods used by ClockGenerator to call only the due components
+  /**
+   * @fn GetPrescaler
+   * @brief Return the frequency scale factor of Tick. Tick is called only when the count is a multiple of it.
+   */
+  virtual unsigned int GetPrescaler() const { return 1; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return the frequency scale factor of FastTick. FastTick is called only when the count is a multiple of it.
+   */
+  virtual unsigned int GetFastPrescaler() const { return 1; }
+  /**
+   * @fn GetBatchTickFunction
+   * @brief Return the function to tick the tickables of the same type at once, or nullptr to use Tick
+   * @note ClockGenerator calls it once for the consecutive due ticks with the same function instead of calling Tick of each.
+   */
+  virtual BatchTickFunction GetBatchTickFunction() const { return nullptr; }
+
   // Whether or not high-frequency disturbances need to be calculated
   /**
    * @fn GetNeedsFastUpdate
@@ -34,10 +64,38 @@ class ITickable {
    * @fn SetNeedsFastUpdate
    * @brief Set fast update flag
    */
-  inline void SetNeedsFastUpdate(const bool need_fast_update) { needs_fast_update_ = need_fast_update; }
+  inline void SetNeedsFastUpdate(const bool need_fast_update) {
+    if (needs_fast_update_ != need_fast_update) schedule_revision_++;
+    needs_fast_update_ = need_fast_update;
+  }
+
+  // Whether or not the tickable is skipped by ClockGenerator
+  /**
+   * @fn GetIsSleeping
+   * @brief Return sleeping flag
+   */
+  inline bool GetIsSleeping() const { return is_sleeping_; }
+  /**
+   * @fn SetIsSleeping
+   * @brief Set sleeping flag. The sleeping tickable is not called by ClockGenerator until the flag is cleared.
+   */
+  inline void SetIsSleeping(const bool is_sleeping) {
+    if (is_sleeping_ != is_sleeping) schedule_revision_++;
+    is_sleeping_ = is_sleeping;
+  }
+
+  /**
+   * @fn GetScheduleRevision
+   * @brief Return the counter incremented when the fast update flag or the sleeping flag of any tickable is changed
+   */
+  static inline unsigned int GetScheduleRevision() { return schedule_revision_; }
 
  protected:
   bool needs_fast_update_ = false;  //!< Whether or not high-frequency disturbances need to be calculated
+
+ private:
+  bool is_sleeping_ = false;                                      //!< Whether or not the tickable is skipped by ClockGenerator
+  static inline std::atomic<unsigned int> schedule_revision_{0};  //!< Counter incremented when the fast update or sleeping flag is changed
 };
 
 #endif  // S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
@@ -10,13 +10,23 @@
 #include <math_physics/math/vector.hpp>
 #include <math_physics/randomization/normal_randomization.hpp>
 #include <math_physics/randomization/random_walk.hpp>
+#include <utilities/snapshot.hpp>
+
+#ifdef USE_SINGLE_PRECISION_SENSOR
+typedef float SensorScalar;  //!< Default scalar type of the noise and output calculation of the sensors
+#else
+typedef double SensorScalar;  //!< Default scalar type of the noise and output calculation of the sensors
+#endif
 
 /**
  * @class Sensor
  * @brief Base class for sensor emulation to add noises
+ * @details The scale factor, the range limits, the quantization, and the generated normal random noises are stored in T, and the output is
+ *          calculated in T. The input and output of Measure are double since the dynamics and environments are calculated in double.
+ *          The build option USE_SINGLE_PRECISION_SENSOR changes the default T to float for all sensors.
  * @note All sensors should inherit this class
  */
-template <size_t N>
+template <size_t N, typename T = SensorScalar>
 class Sensor {
  public:
   /**
@@ -50,21 +60,48 @@ class Sensor {
    * @return Observed value with noise at the component frame
    */
   libra::Vector<N> Measure(const libra::Vector<N> true_value_c);
+  /**
+   * @fn SetQuantizationResolution_c
+   * @brief Set the quantization resolution of the output applied in Measure after the range limit
+   * @param [in] resolution_c: Resolution of each axis at the component frame. Zero means no quantization.
+   */
+  inline void SetQuantizationResolution_c(const libra::Vector<N>& resolution_c) {
+    for (size_t i = 0; i < N; i++) quantization_resolution_c_[i] = (T)resolution_c[i];
+  }
+  /**
+   * @fn SaveNoiseSnapshot
+   * @brief Write the states of the noises to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveNoiseSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadNoiseSnapshot
+   * @brief Restore the states of the noises from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadNoiseSnapshot(SnapshotReader& snapshot);
 
  private:
-  libra::Matrix<N, N> scale_factor_;            //!< Scale factor matrix
-  libra::Vector<N> range_to_const_c_;           //!< Output range limit to be constant output value at the component frame
-  libra::Vector<N> range_to_zero_c_;            //!< Output range limit to be zero output value at the component frame
-  libra::NormalRand normal_random_noise_c_[N];  //!< Normal random
-  RandomWalk<N> random_walk_noise_c_;           //!< Random Walk
+  libra::Matrix<N, N, T> scale_factor_;                 //!< Scale factor matrix
+  libra::Vector<N, T> range_to_const_c_;                //!< Output range limit to be constant output value at the component frame
+  libra::Vector<N, T> range_to_zero_c_;                 //!< Output range limit to be zero output value at the component frame
+  libra::NormalRand normal_random_noise_c_[N];          //!< Normal random
+  RandomWalk<N> random_walk_noise_c_;                   //!< Random Walk
+  libra::Vector<N, T> quantization_resolution_c_{0.0};  //!< Quantization resolution at the component frame (zero: no quantization)
+
+  static constexpr size_t kNormalRandomBlockSize = 32;         //!< Number of the normal random values generated at once for each axis
+  T normal_random_block_c_[N * kNormalRandomBlockSize];        //!< Generated normal random values of each axis
+  size_t normal_random_block_index_ = kNormalRandomBlockSize;  //!< Index of the next value in the generated normal random values
 
   /**
    * @fn Clip
    * @brief Clipping according to the range information
-   * @param [in] input_c: Input value at the component frame
+   * @param [in] input_c: Input value of an axis at the component frame
+   * @param [in] range_to_const_c: Output range limit to be constant output value of the axis
+   * @param [in] range_to_zero_c: Output range limit to be zero output value of the axis
    * @return Clipped value
    */
-  libra::Vector<N> Clip(const libra::Vector<N> input_c);
+  static T Clip(const T input_c, const T range_to_const_c, const T range_to_zero_c);
   /**
    * @fn RangeCheck
    * @brief Check the range_to_const_c_ and range_to_zero_c_ is correct and fixed the values
@@ -81,9 +118,9 @@ class Sensor {
  * @param [in] component_name: Component name
  * @param [in] unit: Unit of the sensor information
  */
-template <size_t N>
-Sensor<N> ReadSensorInformation(const std::string file_name, const double step_width_s, const std::string component_name,
-                                const std::string unit = "");
+template <size_t N, typename T = SensorScalar>
+Sensor<N, T> ReadSensorInformation(const std::string file_name, const double step_width_s, const std::string component_name,
+                                   const std::string unit = "");
 
 #include "./sensor_template_functions.hpp"
 
@@ -6,77 +6,106 @@
 #ifndef S2E_COMPONENTS_BASE_SENSOR_TEMPLATE_FUNCTIONS_HPP_
 #define S2E_COMPONENTS_BASE_SENSOR_TEMPLATE_FUNCTIONS_HPP_
 
+#include <algorithm>
+#include <cmath>
 #include <math_physics/randomization/global_randomization.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
 
-template <size_t N>
-Sensor<N>::Sensor(const libra::Matrix<N, N>& scale_factor, const libra::Vector<N>& range_to_const_c, const libra::Vector<N>& range_to_zero_c,
-                  const libra::Vector<N>& bias_noise_c, const libra::Vector<N>& normal_random_standard_deviation_c,
-                  const double random_walk_step_width_s, const libra::Vector<N>& random_walk_standard_deviation_c,
-                  const libra::Vector<N>& random_walk_limit_c)
-    : bias_noise_c_(bias_noise_c),
-      scale_factor_(scale_factor),
-      range_to_const_c_(range_to_const_c),
-      range_to_zero_c_(range_to_zero_c),
-      random_walk_noise_c_(random_walk_step_width_s, random_walk_standard_deviation_c, random_walk_limit_c) {
+template <size_t N, typename T>
+Sensor<N, T>::Sensor(const libra::Matrix<N, N>& scale_factor, const libra::Vector<N>& range_to_const_c, const libra::Vector<N>& range_to_zero_c,
+                     const libra::Vector<N>& bias_noise_c, const libra::Vector<N>& normal_random_standard_deviation_c,
+                     const double random_walk_step_width_s, const libra::Vector<N>& random_walk_standard_deviation_c,
+                     const libra::Vector<N>& random_walk_limit_c)
+    : bias_noise_c_(bias_noise_c), random_walk_noise_c_(random_walk_step_width_s, random_walk_standard_deviation_c, random_walk_limit_c) {
   for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) scale_factor_[i][j] = (T)scale_factor[i][j];
+    range_to_const_c_[i] = (T)range_to_const_c[i];
+    range_to_zero_c_[i] = (T)range_to_zero_c[i];
     normal_random_noise_c_[i].SetParameters(0.0, normal_random_standard_deviation_c[i], global_randomization.MakeSeed());
   }
   RangeCheck();
 }
 
-template <size_t N>
-Sensor<N>::~Sensor() {}
+template <size_t N, typename T>
+Sensor<N, T>::~Sensor() {}
 
-template <size_t N>
-libra::Vector<N> Sensor<N>::Measure(const libra::Vector<N> true_value_c) {
-  libra::Vector<N> calc_value_c;
-  calc_value_c = scale_factor_ * true_value_c;
-  calc_value_c += bias_noise_c_;
+template <size_t N, typename T>
+libra::Vector<N> Sensor<N, T>::Measure(const libra::Vector<N> true_value_c) {
+  // The normal random values are generated in blocks. The values are the same as the generation at each measurement.
+  if (normal_random_block_index_ == kNormalRandomBlockSize) {
+    for (size_t i = 0; i < N; i++) {
+      normal_random_noise_c_[i].Fill(&normal_random_block_c_[i * kNormalRandomBlockSize], kNormalRandomBlockSize);
+    }
+    normal_random_block_index_ = 0;
+  }
+
+  // Scale factor, noises, range limit, and quantization are applied in a single pass for each axis
+  libra::Vector<N> observed_value_c;
   for (size_t i = 0; i < N; ++i) {
-    calc_value_c[i] += random_walk_noise_c_[i];
-    calc_value_c[i] += normal_random_noise_c_[i];
+    T value_c = 0;
+    for (size_t j = 0; j < N; ++j) value_c += scale_factor_[i][j] * (T)true_value_c[j];
+    value_c += (T)bias_noise_c_[i];
+    value_c += (T)random_walk_noise_c_[i];
+    value_c += normal_random_block_c_[i * kNormalRandomBlockSize + normal_random_block_index_];
+    value_c = Clip(value_c, range_to_const_c_[i], range_to_zero_c_[i]);
+    const T resolution_c = quantization_resolution_c_[i];
+    observed_value_c[i] = (double)(resolution_c > 0 ? std::trunc(value_c / resolution_c) * resolution_c : value_c);
   }
+  normal_random_block_index_++;
   ++random_walk_noise_c_;  // update Random Walk
-  return Clip(calc_value_c);
+  return observed_value_c;
 }
 
-template <size_t N>
-libra::Vector<N> Sensor<N>::Clip(const libra::Vector<N> input_c) {
-  libra::Vector<N> output_c;
-  for (size_t i = 0; i < N; ++i) {
-    if (input_c[i] >= range_to_const_c_[i] && input_c[i] < range_to_zero_c_[i]) {
-      output_c[i] = range_to_const_c_[i];
-    } else if (input_c[i] <= -range_to_const_c_[i] && input_c[i] > -range_to_zero_c_[i]) {
-      output_c[i] = -range_to_const_c_[i];
-    } else if (fabs(input_c[i]) >= range_to_zero_c_[i]) {
-      output_c[i] = 0.0;
-    } else {
-      output_c[i] = input_c[i];
-    }
+template <size_t N, typename T>
+void Sensor<N, T>::SaveNoiseSnapshot(SnapshotWriter& snapshot) const {
+  // The bias is saved since it can be changed after the initialization (e.g. MtqMagnetometerInterference)
+  snapshot.Write(bias_noise_c_);
+  for (size_t i = 0; i < N; i++) {
+    snapshot.Write(normal_random_noise_c_[i]);
   }
-  return output_c;
+  snapshot.Write(normal_random_block_c_);
+  snapshot.Write(normal_random_block_index_);
+  random_walk_noise_c_.SaveSnapshot(snapshot);
+}
+
+template <size_t N, typename T>
+void Sensor<N, T>::LoadNoiseSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(bias_noise_c_);
+  for (size_t i = 0; i < N; i++) {
+    snapshot.Read(normal_random_noise_c_[i]);
+  }
+  snapshot.Read(normal_random_block_c_);
+  snapshot.Read(normal_random_block_index_);
+  random_walk_noise_c_.LoadSnapshot(snapshot);
+}
+
+template <size_t N, typename T>
+T Sensor<N, T>::Clip(const T input_c, const T range_to_const_c, const T range_to_zero_c) {
+  // The range_to_const_c is not greater than the range_to_zero_c after RangeCheck
+  const T clipped_c = std::min(std::max(input_c, -range_to_const_c), range_to_const_c);
+  return std::abs(input_c) >= range_to_zero_c ? (T)0 : clipped_c;
 }
 
-template <size_t N>
-void Sensor<N>::RangeCheck(void) {
+template <size_t N, typename T>
+void Sensor<N, T>::RangeCheck(void) {
   for (size_t i = 0; i < N; i++) {
     if (range_to_const_c_[i] < 0.0 || range_to_zero_c_[i] < 0.0) {
       std::cout << "Sensor: Range should be positive!!\n";
       std::cout << "The range values are set as positive.\n";
-      range_to_zero_c_[i] = fabs(range_to_zero_c_[i]);
-      range_to_const_c_[i] = fabs(range_to_const_c_[i]);
+      range_to_zero_c_[i] = std::abs(range_to_zero_c_[i]);
+      range_to_const_c_[i] = std::abs(range_to_const_c_[i]);
     }
     if (range_to_const_c_[i] > range_to_zero_c_[i]) {
       std::cout << "Sensor: range_zero should be greater than range_const!!\n";
       std::cout << "The range_zero is set as twice value of the range_const.\n";
-      range_to_zero_c_[i] = 2.0 * range_to_const_c_[i];
+      range_to_zero_c_[i] = 2 * range_to_const_c_[i];
     }
   }
 }
 
-template <size_t N>
-Sensor<N> ReadSensorInformation(const std::string file_name, const double step_width_s, const std::string component_name, const std::string unit) {
+template <size_t N, typename T>
+Sensor<N, T> ReadSensorInformation(const std::string file_name, const double step_width_s, const std::string component_name,
+                                   const std::string unit) {
   IniAccess ini_file(file_name);
   std::string section = "SENSOR_BASE_" + component_name;
 
@@ -115,8 +144,8 @@ Sensor<N> ReadSensorInformation(const std::string file_name, const double step_w
   double range_to_zero = ini_file.ReadDouble(section.c_str(), key_name.c_str());
   libra::Vector<N> range_to_zero_c{range_to_zero};
 
-  Sensor<N> sensor_base(scale_factor_c, range_to_const_c, range_to_zero_c, constant_bias_c, normal_random_standard_deviation_c, step_width_s,
-                        random_walk_standard_deviation_c, random_walk_limit_c);
+  Sensor<N, T> sensor_base(scale_factor_c, range_to_const_c, range_to_zero_c, constant_bias_c, normal_random_standard_deviation_c, step_width_s,
+                           random_walk_standard_deviation_c, random_walk_limit_c);
 
   return sensor_base;
 }
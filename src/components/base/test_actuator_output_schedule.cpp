@@ -0,0 +1,90 @@
+/**
+ * @file test_actuator_output_schedule.cpp
+ * @brief Test codes for ActuatorOutputSchedule class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "actuator_output_schedule.hpp"
+
+namespace {
+/**
+ * @fn CalcFastTickImpulse
+ * @brief Integrate the PWM output sampled with the fast tick at the middle of each tick
+ * @param [in] start_time_s: Start time of the range [sec]
+ * @param [in] end_time_s: End time of the range [sec]
+ * @param [in] pwm_start_time_s: Start time of the PWM periods [sec]
+ * @param [in] period_s: PWM period [sec]
+ * @param [in] duty: PWM duty
+ * @param [in] value: Output at the on state
+ */
+double CalcFastTickImpulse(const double start_time_s, const double end_time_s, const double pwm_start_time_s, const double period_s,
+                           const double duty, const double value) {
+  const double tick_s = 1.0e-6;
+  const size_t number_of_ticks = (size_t)std::round((end_time_s - start_time_s) / tick_s);
+  double impulse = 0.0;
+  for (size_t tick = 0; tick < number_of_ticks; tick++) {
+    const double time_s = start_time_s + (tick + 0.5) * tick_s;
+    const double phase_s = time_s - pwm_start_time_s - std::floor((time_s - pwm_start_time_s) / period_s) * period_s;
+    if (phase_s < duty * period_s) impulse += value * tick_s;
+  }
+  return impulse;
+}
+}  // namespace
+
+/**
+ * @brief Test for the impulse of the PWM segments against the fast tick sampling
+ */
+TEST(ActuatorOutputSchedule, PwmSegments) {
+  libra::Vector<3> force_b_N(0.0), torque_b_Nm(0.0);
+  force_b_N[0] = 2.0;
+  force_b_N[2] = -0.5;
+  torque_b_Nm[1] = 0.1;
+
+  // The PWM periods started before the range
+  const double pwm_start_time_s = -0.013;
+  const double period_s = 0.03;
+  const double duty = 0.4;
+  ActuatorOutputSchedule schedule;
+  EXPECT_TRUE(schedule.IsEmpty());
+  schedule.AddPwmSegments(0.0, 0.1, pwm_start_time_s, period_s, duty, force_b_N, torque_b_Nm);
+  EXPECT_FALSE(schedule.IsEmpty());
+
+  const double ranges_s[4][2] = {{0.0, 0.1}, {0.0, 0.02}, {0.02, 0.05}, {0.047, 0.083}};
+  for (const auto& range_s : ranges_s) {
+    const libra::Vector<3> impulse_b_Ns = schedule.CalcImpulse_b_Ns(range_s[0], range_s[1]);
+    const libra::Vector<3> angular_impulse_b_Nms = schedule.CalcAngularImpulse_b_Nms(range_s[0], range_s[1]);
+    const double reference = CalcFastTickImpulse(range_s[0], range_s[1], pwm_start_time_s, period_s, duty, 1.0);
+    EXPECT_NEAR(2.0 * reference, impulse_b_Ns[0], 1e-9);
+    EXPECT_DOUBLE_EQ(0.0, impulse_b_Ns[1]);
+    EXPECT_NEAR(-0.5 * reference, impulse_b_Ns[2], 1e-9);
+    EXPECT_NEAR(0.1 * reference, angular_impulse_b_Nms[1], 1e-9);
+  }
+  // No output out of the reported range
+  EXPECT_DOUBLE_EQ(0.0, schedule.CalcImpulse_b_Ns(0.1, 0.2)[0]);
+
+  schedule.Clear();
+  EXPECT_TRUE(schedule.IsEmpty());
+  EXPECT_DOUBLE_EQ(0.0, schedule.CalcImpulse_b_Ns(0.0, 0.1)[0]);
+}
+
+/**
+ * @brief Test for the continuous output and the duty saturation
+ */
+TEST(ActuatorOutputSchedule, ContinuousOutput) {
+  libra::Vector<3> force_b_N(0.0);
+  force_b_N[1] = 1.0;
+  const libra::Vector<3> torque_b_Nm(0.0);
+
+  ActuatorOutputSchedule schedule;
+  // Zero period makes the output continuous with the duty ratio
+  schedule.AddPwmSegments(0.0, 0.1, 0.0, 0.0, 0.3, force_b_N, torque_b_Nm);
+  EXPECT_NEAR(0.3 * 0.05, schedule.CalcImpulse_b_Ns(0.02, 0.07)[1], 1e-15);
+  schedule.Clear();
+  schedule.AddPwmSegments(0.0, 0.1, 0.0, 0.03, 1.5, force_b_N, torque_b_Nm);
+  EXPECT_NEAR(0.1, schedule.CalcImpulse_b_Ns(0.0, 0.1)[1], 1e-15);
+  schedule.Clear();
+  schedule.AddPwmSegments(0.0, 0.1, 0.0, 0.03, -0.5, force_b_N, torque_b_Nm);
+  EXPECT_TRUE(schedule.IsEmpty());
+}
@@ -5,6 +5,7 @@
 
 #include "angular_velocity_observer.hpp"
 
+#include <math_physics/randomization/global_randomization.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
 
 AngularVelocityObserver::AngularVelocityObserver(const int prescaler, ClockGenerator* clock_generator, Sensor& sensor_base, const Attitude& attitude)
@@ -35,6 +36,7 @@ std::string AngularVelocityObserver::GetLogValue() const {
 AngularVelocityObserver InitializeAngularVelocityObserver(ClockGenerator* clock_generator, const std::string file_name, double component_step_time_s,
                                                           const Attitude& attitude) {
   IniAccess ini_file(file_name);
+  GlobalRandomization::StreamScope stream_scope("ANGULAR_VELOCITY_OBSERVER");
 
   int prescaler = ini_file.ReadInt("COMPONENT_BASE", "prescaler");
   if (prescaler <= 1) prescaler = 1;
@@ -86,6 +86,7 @@ NoiseFrame SetNoiseFrame(const std::string noise_frame) {
 OrbitObserver InitializeOrbitObserver(ClockGenerator* clock_generator, const std::string file_name, const Orbit& orbit) {
   // General
   IniAccess ini_file(file_name);
+  GlobalRandomization::StreamScope stream_scope("ORBIT_OBSERVER");
 
   // CompoBase
   int prescaler = ini_file.ReadInt("COMPONENT_BASE", "prescaler");
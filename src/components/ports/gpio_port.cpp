@@ -5,6 +5,8 @@
 
 #include "gpio_port.hpp"
 
+#include <algorithm>
+
 GpioPort::GpioPort(const unsigned int port_id, IGPIOCompo* component) : kPortId(port_id) {
   high_low_state_ = GPIO_LOW;
   component_ = component;
@@ -18,9 +20,20 @@ int GpioPort::DigitalWrite(const bool is_high) {
     if (component_ != nullptr) {
       component_->GpioStateChanged(kPortId, is_high);
     }
+    for (size_t i = 0; i < observers_.size(); i++) observers_[i]->GpioStateChanged(kPortId, is_high);
   }
   high_low_state_ = is_high;
   return 0;
 }
 
 bool GpioPort::DigitalRead() { return high_low_state_; }
+
+void GpioPort::AddObserver(IGPIOCompo* observer) {
+  if (observer == nullptr) return;
+  if (std::find(observers_.begin(), observers_.end(), observer) != observers_.end()) return;
+  observers_.push_back(observer);
+}
+
+void GpioPort::RemoveObserver(IGPIOCompo* observer) {
+  observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+}
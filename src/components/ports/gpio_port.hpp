@@ -7,6 +7,7 @@
 #define S2E_COMPONENTS_PORTS_GPIO_PORT_HPP_
 
 #include <components/base/interface_gpio_component.hpp>
+#include <vector>
 
 #define GPIO_HIGH true
 #define GPIO_LOW false
@@ -14,6 +15,7 @@
 /**
  * @class GpioPort
  * @brief Class to emulate GPIO(General Purpose Input and Output) port
+ * @details The component and the observers are notified only at the edges of the GPIO state, so they do not need to poll DigitalRead.
  */
 class GpioPort {
  public:
@@ -45,10 +47,23 @@ class GpioPort {
    */
   bool DigitalRead();
 
+  /**
+   * @fn AddObserver
+   * @brief Add the observer notified at the edges of the GPIO state in addition to the component
+   * @param [in] observer: Observer. It must be removed before it is destructed.
+   */
+  void AddObserver(IGPIOCompo* observer);
+  /**
+   * @fn RemoveObserver
+   * @brief Remove the observer
+   */
+  void RemoveObserver(IGPIOCompo* observer);
+
  private:
-  const unsigned int kPortId;  //!< Port ID
-  IGPIOCompo* component_;      //!< Component which has the GPIO port
-  bool high_low_state_;        //!< GPIO High/Low state
+  const unsigned int kPortId;           //!< Port ID
+  IGPIOCompo* component_;               //!< Component which has the GPIO port
+  bool high_low_state_;                 //!< GPIO High/Low state
+  std::vector<IGPIOCompo*> observers_;  //!< Observers of the GPIO state
 };
 
 #endif  // S2E_COMPONENTS_PORTS_GPIO_PORT_HPP_
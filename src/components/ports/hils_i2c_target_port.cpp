@@ -5,6 +5,8 @@
 
 #include "hils_i2c_target_port.hpp"
 
+#include <chrono>
+
 // #define HILS_I2C_TARGET_PORT_SHOW_DEBUG_DATA //!< Remove comment when you want to show the debug message
 
 // FIXME: The magic number. This is depending on the converter.
@@ -12,9 +14,9 @@ HilsI2cTargetPort::HilsI2cTargetPort(const unsigned int port_id) : HilsUartPort(
 
 // FIXME: The magic number. This is depending on the converter.
 HilsI2cTargetPort::HilsI2cTargetPort(const unsigned int port_id, const unsigned char max_register_number)
-    : max_register_number_(max_register_number), HilsUartPort(port_id, 115200, 512, 512) {}
+    : HilsUartPort(port_id, 115200, 512, 512), max_register_number_(max_register_number) {}
 
-HilsI2cTargetPort::~HilsI2cTargetPort() {}
+HilsI2cTargetPort::~HilsI2cTargetPort() { StopAsyncService(); }
 
 void HilsI2cTargetPort::RegisterDevice() {
   for (unsigned char i = 0; i < max_register_number_; i++) {
@@ -57,39 +59,59 @@ int HilsI2cTargetPort::ReadCommand(unsigned char* rx_data, const unsigned int le
 
 int HilsI2cTargetPort::Receive()  // from I2C-USB Target converter
 {
-  unsigned char rx_buf[kDefaultCommandSize];
+  if (IsAsyncServiceRunning()) {
+    // Apply the commands received by the service thread
+    std::vector<std::vector<unsigned char>> received_commands;
+    {
+      std::lock_guard<std::mutex> lock(received_commands_mutex_);
+      received_commands.swap(received_commands_);
+    }
+    int received_bytes = -1;
+    for (const auto& command : received_commands) {
+      ApplyCommand(command.data(), (int)command.size());
+      received_bytes = (int)command.size();
+    }
+    return received_bytes;
+  }
+
   if (GetBytesToRead() <= 0) return -1;  // No bytes were available to read.
-  int received_bytes = ReadRx(rx_buf, 0, kDefaultCommandSize);
-  if (received_bytes > kDefaultCommandSize) return -1;
+  std::vector<unsigned char> rx_buf(kDefaultCommandSize);
+  int received_bytes = ReadRx(rx_buf.data(), 0, kDefaultCommandSize);
+  if (received_bytes < 0 || (unsigned int)received_bytes > kDefaultCommandSize) return -1;
 #ifdef HILS_I2C_TARGET_PORT_SHOW_DEBUG_DATA
   for (int i = 0; i < received_bytes; i++) {
     printf("%02x ", rx_buf[i]);
   }
   printf("\n");
 #endif
-  for (unsigned char i = 0; i < received_bytes; i++) {
-    command_buffer_[i] = rx_buf[i];
+  ApplyCommand(rx_buf.data(), received_bytes);
+  if (received_bytes == 1 && stored_frame_counter_ > 0) {
+    stored_frame_counter_--;
+  }
+  return received_bytes;
+}
+
+void HilsI2cTargetPort::ApplyCommand(const unsigned char* command, const int length) {
+  for (int i = 0; i < length; i++) {
+    command_buffer_[(unsigned char)i] = command[i];
   }
 
-  if (received_bytes == 1)  // length == 1 means setting of read register address
+  if (length == 1)  // length == 1 means setting of read register address
   {
-    WriteRegister(rx_buf[0]);
-    if (stored_frame_counter_ > 0) {
-      stored_frame_counter_ = stored_frame_counter_ - 1;
-    }
+    WriteRegister(command[0]);
   }
-  if (received_bytes == 2)  // length == 2 means setting specific register.
-                            // FIXME: this rule is not general.
+  if (length == 2)  // length == 2 means setting specific register.
+                    // FIXME: this rule is not general.
   {
-    WriteRegister(rx_buf[0], rx_buf[1]);
+    WriteRegister(command[0], command[1]);
   }
-  return received_bytes;
 }
 
 int HilsI2cTargetPort::Send(const unsigned char data_length)  // to I2C-USB Target Converter
 {
+  if (IsAsyncServiceRunning()) return 0;  // The service thread keeps the frames stored in the converter
   if (saved_register_address_ + data_length > max_register_number_) return -1;
-  unsigned char tx_buf[kDefaultTxSize] = {0};
+  std::vector<unsigned char> tx_buf(kDefaultTxSize, 0);
   for (unsigned char i = 0; i < data_length; i++) {
     tx_buf[i] = device_registers_[saved_register_address_ + i];
   }
@@ -99,9 +121,69 @@ int HilsI2cTargetPort::Send(const unsigned char data_length)  // to I2C-USB Targ
   }
   printf("\n");
 #endif
-  int ret = WriteTx(tx_buf, 0, data_length);
+  int ret = WriteTx(tx_buf.data(), 0, data_length);
   stored_frame_counter_++;
   return ret;
 }
 
 int HilsI2cTargetPort::GetStoredFrameCounter() { return stored_frame_counter_; }
+
+int HilsI2cTargetPort::StartAsyncService(const unsigned int stored_frame_number, const unsigned char telemetry_size,
+                                         const unsigned int service_period_us) {
+  if (IsAsyncServiceRunning()) return -1;
+  service_stored_frame_number_ = stored_frame_number;
+  service_telemetry_size_ = telemetry_size;
+  service_period_us_ = service_period_us;
+  PublishRegisters();
+
+  is_service_running_ = true;
+  service_thread_ = std::thread(&HilsI2cTargetPort::RunAsyncService, this);
+  return 0;
+}
+
+void HilsI2cTargetPort::StopAsyncService() {
+  if (!IsAsyncServiceRunning()) return;
+  is_service_running_ = false;
+  service_thread_.join();
+}
+
+void HilsI2cTargetPort::PublishRegisters() {
+  std::lock_guard<std::mutex> lock(published_registers_mutex_);
+  for (unsigned int i = 0; i < max_register_number_; i++) {
+    published_registers_[i] = device_registers_[(unsigned char)i];
+  }
+}
+
+void HilsI2cTargetPort::RunAsyncService() {
+  std::vector<unsigned char> rx_buf(kDefaultCommandSize);
+  std::array<unsigned char, 256> registers;
+  unsigned char response_address = saved_register_address_;
+
+  while (is_service_running_) {
+    if (GetBytesToRead() > 0) {
+      const int received_bytes = ReadRx(rx_buf.data(), 0, kDefaultCommandSize);
+      if (received_bytes > 0) {
+        if (received_bytes == 1) {
+          // The OBC reads a stored frame from the register address
+          response_address = rx_buf[0];
+          if (stored_frame_counter_ > 0) stored_frame_counter_--;
+        }
+        std::lock_guard<std::mutex> lock(received_commands_mutex_);
+        received_commands_.emplace_back(rx_buf.begin(), rx_buf.begin() + received_bytes);
+      }
+    }
+
+    if (stored_frame_counter_ < service_stored_frame_number_ && response_address + service_telemetry_size_ <= max_register_number_) {
+      {
+        std::lock_guard<std::mutex> lock(published_registers_mutex_);
+        registers = published_registers_;
+      }
+      while (stored_frame_counter_ < service_stored_frame_number_) {
+        WriteTx(registers.data(), response_address, service_telemetry_size_);
+        stored_frame_counter_++;
+      }
+    }
+
+    std::this_thread::sleep_for(std::chrono::microseconds(service_period_us_));
+  }
+}
@@ -6,7 +6,12 @@
 #ifndef S2E_COMPONENTS_PORTS_HILS_I2C_TARGET_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_HILS_I2C_TARGET_PORT_HPP_
 
+#include <array>
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "hils_uart_port.hpp"
 
@@ -15,6 +20,9 @@
  * @brief Class to control I2C-USB converter for the target(device) side from COM port
  * @details This class has a register to store data for S2E. It is different from the register inside the converter.
  * We have Write/Read command for the register for S2E and Send/Receive command for the register in the converter.
+ * In the asynchronous mode, a service thread handles the transactions of the converter instead of the simulation thread. The thread responds
+ * from the register file published by PublishRegisters, so the response latency to the OBC does not depend on the load of the simulation step.
+ * The commands written by the OBC are passed to the simulation thread and applied in Receive.
  */
 class HilsI2cTargetPort : public HilsUartPort {
  public:
@@ -92,18 +100,66 @@ class HilsI2cTargetPort : public HilsUartPort {
    */
   int GetStoredFrameCounter();
 
+  /**
+   * @fn StartAsyncService
+   * @brief Start the service thread of the asynchronous mode
+   * @note After this function, ReadRx and WriteTx of this port are called only from the service thread.
+   * @param [in] stored_frame_number: Number of the telemetry frames kept stored in the converter
+   * @param [in] telemetry_size: Size of each telemetry frame [bytes]
+   * @param [in] service_period_us: Polling period of the converter [us]
+   * @return 0: success, -1: error
+   */
+  int StartAsyncService(const unsigned int stored_frame_number, const unsigned char telemetry_size, const unsigned int service_period_us = 100);
+  /**
+   * @fn StopAsyncService
+   * @brief Stop the service thread and return to the synchronous mode
+   */
+  void StopAsyncService();
+  /**
+   * @fn PublishRegisters
+   * @brief Publish the current registers to the service thread at once. Call this once in each update of the component.
+   */
+  void PublishRegisters();
+  /**
+   * @fn IsAsyncServiceRunning
+   * @brief Return true when the service thread is running
+   */
+  inline bool IsAsyncServiceRunning() const { return is_service_running_.load(); }
+
  private:
-  const unsigned int kDefaultCommandSize = 0xff;  //!< Default command size
-  const unsigned int kDefaultTxSize = 0xff;       //!< Default TX size
-  unsigned char max_register_number_ = 0xff;      //!< Maximum register number
-  unsigned char saved_register_address_ = 0x00;   //!< Saved register address
-  unsigned int stored_frame_counter_ = 0;         //!< Send a few frames of telemetry to the converter in advance.
+  static constexpr unsigned int kDefaultCommandSize = 0xff;  //!< Default command size
+  static constexpr unsigned int kDefaultTxSize = 0xff;       //!< Default TX size
+  unsigned char max_register_number_ = 0xff;                 //!< Maximum register number
+  unsigned char saved_register_address_ = 0x00;              //!< Saved register address
+  std::atomic<unsigned int> stored_frame_counter_{0};        //!< Send a few frames of telemetry to the converter in advance.
 
   /** @brief Device register: < register address, value>  **/
   std::map<unsigned char, unsigned char> device_registers_;
 
   /** @brief Buffer for the command from COM port : <cmd_buffer_length, value>  **/
   std::map<unsigned char, unsigned char> command_buffer_;
+
+  // Asynchronous mode
+  std::atomic<bool> is_service_running_{false};                //!< Flag to keep the service thread running
+  std::thread service_thread_;                                 //!< Service thread of the converter
+  unsigned int service_stored_frame_number_ = 0;               //!< Number of the telemetry frames kept stored in the converter
+  unsigned char service_telemetry_size_ = 0;                   //!< Size of each telemetry frame [bytes]
+  unsigned int service_period_us_ = 100;                       //!< Polling period of the converter [us]
+  std::mutex published_registers_mutex_;                       //!< Mutex of the published registers
+  std::array<unsigned char, 256> published_registers_{};       //!< Registers published to the service thread
+  std::mutex received_commands_mutex_;                         //!< Mutex of the received commands
+  std::vector<std::vector<unsigned char>> received_commands_;  //!< Commands received by the service thread and not applied yet
+
+  /**
+   * @fn RunAsyncService
+   * @brief Main function of the service thread
+   */
+  void RunAsyncService();
+  /**
+   * @fn ApplyCommand
+   * @brief Store the command from the converter and apply it to the registers
+   */
+  void ApplyCommand(const unsigned char* command, const int length);
 };
 
 #endif  // S2E_COMPONENTS_PORTS_HILS_I2C_TARGET_PORT_HPP_
@@ -0,0 +1,420 @@
+/**
+ * @file hils_network_port.cpp
+ * @brief Class to exchange the HILS port data with another process through UDP, TCP, or a POSIX shared memory ring
+ */
+
+#include "hils_network_port.hpp"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+// #define HILS_NETWORK_PORT_SHOW_DEBUG_DATA
+
+namespace {
+const uint32_t kSharedMemoryMagic = 0x53324550;  //!< "S2EP" written by the server after the initialization
+const size_t kMaxDatagramSize = 65507;           //!< Maximum payload of a UDP datagram over IPv4
+const size_t kReceiveChunkSize = 4096;           //!< Size of the chunk to drain the socket while the RX buffer is full
+
+/**
+ * @struct SharedMemoryRing
+ * @brief Single-producer single-consumer ring in the shared memory. The indices are monotonic counters as SpscRingBuffer.
+ */
+struct SharedMemoryRing {
+  alignas(64) std::atomic<uint64_t> read_index;   //!< Total number of bytes read by the consumer process
+  alignas(64) std::atomic<uint64_t> write_index;  //!< Total number of bytes written by the producer process
+  uint64_t capacity;                              //!< Maximum number of bytes stored in the ring
+  uint64_t mask;                                  //!< Mask to convert the index to the position in the power of two storage
+  uint64_t data_offset;                           //!< Offset of the storage from the head of the shared memory [bytes]
+};
+
+/**
+ * @struct SharedMemoryHeader
+ * @brief Header of the shared memory. Ring 0 is the server to client direction, and ring 1 is the client to server direction.
+ */
+struct SharedMemoryHeader {
+  std::atomic<uint32_t> magic;  //!< kSharedMemoryMagic after the initialization
+  SharedMemoryRing rings[2];    //!< Rings of the both directions
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "The shared memory ring requires the lock-free 64bit atomics.");
+
+/**
+ * @fn CalcStorageSize
+ * @brief Return the smallest power of two which is not less than the capacity
+ */
+uint64_t CalcStorageSize(const uint64_t capacity) {
+  uint64_t size = 1;
+  while (size < capacity) size <<= 1;
+  return size;
+}
+
+/**
+ * @fn MakeSocketAddress
+ * @brief Make the IPv4 socket address
+ * @return True when the address is valid
+ */
+bool MakeSocketAddress(const std::string& address, const unsigned short port, sockaddr_in& socket_address) {
+  memset(&socket_address, 0, sizeof(socket_address));
+  socket_address.sin_family = AF_INET;
+  socket_address.sin_port = htons(port);
+  return inet_pton(AF_INET, address.c_str(), &socket_address.sin_addr) == 1;
+}
+}  // namespace
+
+HilsNetworkPort::HilsNetworkPort(const HilsNetworkPortConfig& config, const unsigned int tx_buffer_size, const unsigned int rx_buffer_size)
+    : kConfig(config), tx_buffer_(tx_buffer_size), rx_buffer_(rx_buffer_size) {
+  if (kConfig.transport == HilsNetworkTransport::kUdp) datagram_.resize(kMaxDatagramSize);
+  OpenPort();
+}
+
+HilsNetworkPort::~HilsNetworkPort() { ClosePort(); }
+
+int HilsNetworkPort::OpenPort() {
+  if (is_opened_) return 0;
+
+  switch (kConfig.transport) {
+    case HilsNetworkTransport::kUdp: {
+      sockaddr_in local_address;
+      MakeSocketAddress("0.0.0.0", kConfig.local_port, local_address);
+      socket_descriptor_ = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+      if (socket_descriptor_ < 0) return -5;
+      sockaddr_in remote_address;
+      if (!MakeSocketAddress(kConfig.remote_address, kConfig.remote_port, remote_address) ||
+          bind(socket_descriptor_, (sockaddr*)&local_address, sizeof(local_address)) != 0 ||
+          connect(socket_descriptor_, (sockaddr*)&remote_address, sizeof(remote_address)) != 0) {
+        close(socket_descriptor_);
+        socket_descriptor_ = -1;
+        return -2;
+      }
+      is_connected_ = true;
+      break;
+    }
+    case HilsNetworkTransport::kTcpServer: {
+      sockaddr_in local_address;
+      MakeSocketAddress("0.0.0.0", kConfig.local_port, local_address);
+      listen_descriptor_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+      if (listen_descriptor_ < 0) return -5;
+      const int enable = 1;
+      setsockopt(listen_descriptor_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+      if (bind(listen_descriptor_, (sockaddr*)&local_address, sizeof(local_address)) != 0 || listen(listen_descriptor_, 1) != 0) {
+        close(listen_descriptor_);
+        listen_descriptor_ = -1;
+        return -2;
+      }
+      break;
+    }
+    case HilsNetworkTransport::kTcpClient: {
+      sockaddr_in remote_address;
+      if (!MakeSocketAddress(kConfig.remote_address, kConfig.remote_port, remote_address)) return -4;
+      break;
+    }
+    case HilsNetworkTransport::kSharedMemoryServer: {
+      const int ret = CreateSharedMemory();
+      if (ret != 0) return ret;
+      is_connected_ = true;
+      break;
+    }
+    case HilsNetworkTransport::kSharedMemoryClient:
+      break;
+    default:
+      return -3;
+  }
+
+  is_opened_ = true;
+  UpdateConnection();
+  return 0;  // Success !!
+}
+
+int HilsNetworkPort::ClosePort() {
+  if (!is_opened_) return -1;
+
+  Flush();
+  Disconnect();
+  if (listen_descriptor_ >= 0) close(listen_descriptor_);
+  listen_descriptor_ = -1;
+  if (shared_memory_ != nullptr) {
+    munmap(shared_memory_, shared_memory_size_);
+    if (kConfig.transport == HilsNetworkTransport::kSharedMemoryServer) shm_unlink(kConfig.remote_address.c_str());
+  }
+  shared_memory_ = nullptr;
+  is_connected_ = false;
+  is_opened_ = false;
+
+  if (tx_buffer_.GetOverflowBytes() > 0 || rx_buffer_.GetOverflowBytes() > 0) {
+    std::cout << "[Warning] HilsNetworkPort: " << tx_buffer_.GetOverflowBytes() << " TX bytes and " << rx_buffer_.GetOverflowBytes()
+              << " RX bytes were dropped since the buffers were full." << std::endl;
+  }
+  return 0;
+}
+
+int HilsNetworkPort::WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (!is_opened_) return -1;
+  const size_t written_bytes = tx_buffer_.Write(buffer + offset, data_length);
+  if (tx_buffer_.GetSize() >= std::max(kConfig.batch_size_bytes, (size_t)1)) Flush();
+  if (written_bytes < data_length) {
+#ifdef HILS_NETWORK_PORT_SHOW_DEBUG_DATA
+    printf("HilsNetworkPort: TX buffer overflow\n");
+#endif
+    return -1;
+  }
+  return 0;
+}
+
+int HilsNetworkPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (!is_opened_) return -2;
+  // The stored TX data is sent before the response is read
+  if (tx_buffer_.GetSize() > 0) Flush();
+
+  size_t received_bytes = 0;
+  if (shared_memory_ != nullptr) {
+    SharedMemoryHeader* header = (SharedMemoryHeader*)shared_memory_;
+    SharedMemoryRing& ring = header->rings[1 - shared_tx_ring_];
+    unsigned char* data = (unsigned char*)shared_memory_ + ring.data_offset;
+    const uint64_t read_index = ring.read_index.load(std::memory_order_relaxed);
+    const uint64_t write_index = ring.write_index.load(std::memory_order_acquire);
+    received_bytes = (size_t)std::min(write_index - read_index, (uint64_t)data_length);
+    for (size_t i = 0; i < received_bytes; i++) {
+      buffer[offset + i] = data[(read_index + i) & ring.mask];
+    }
+    ring.read_index.store(read_index + received_bytes, std::memory_order_release);
+  } else {
+    ReceiveFromSocket();
+    received_bytes = rx_buffer_.Read(buffer + offset, data_length);
+  }
+  if (received_bytes == 0) return -1;  // No bytes were available to read.
+  return (int)received_bytes;
+}
+
+int HilsNetworkPort::GetBytesToRead() {
+  if (!is_opened_) return -1;
+  if (shared_memory_ != nullptr) {
+    const SharedMemoryRing& ring = ((SharedMemoryHeader*)shared_memory_)->rings[1 - shared_tx_ring_];
+    const uint64_t read_index = ring.read_index.load(std::memory_order_relaxed);
+    return (int)(ring.write_index.load(std::memory_order_acquire) - read_index);
+  }
+  ReceiveFromSocket();
+  return (int)rx_buffer_.GetSize();
+}
+
+int HilsNetworkPort::Flush() {
+  if (!is_opened_) return -1;
+  if (tx_buffer_.GetSize() == 0 || !UpdateConnection()) return (int)tx_buffer_.GetSize();
+
+  if (shared_memory_ != nullptr) {
+    SharedMemoryRing& ring = ((SharedMemoryHeader*)shared_memory_)->rings[shared_tx_ring_];
+    unsigned char* data = (unsigned char*)shared_memory_ + ring.data_offset;
+    const uint64_t write_index = ring.write_index.load(std::memory_order_relaxed);
+    const uint64_t read_index = ring.read_index.load(std::memory_order_acquire);
+    uint64_t free_bytes = ring.capacity - (write_index - read_index);
+    uint64_t written_bytes = 0;
+    while (free_bytes > written_bytes) {
+      size_t region_length;
+      const unsigned char* region = tx_buffer_.PeekReadableRegion(region_length);
+      region_length = (size_t)std::min((uint64_t)region_length, free_bytes - written_bytes);
+      if (region_length == 0) break;
+      for (size_t i = 0; i < region_length; i++) {
+        data[(write_index + written_bytes + i) & ring.mask] = region[i];
+      }
+      tx_buffer_.CommitRead(region_length);
+      written_bytes += region_length;
+    }
+    ring.write_index.store(write_index + written_bytes, std::memory_order_release);
+  } else if (kConfig.transport == HilsNetworkTransport::kUdp) {
+    // A batch is sent as a datagram
+    while (tx_buffer_.GetSize() > 0) {
+      const size_t datagram_size = tx_buffer_.Read(datagram_.data(), datagram_.size());
+      if (send(socket_descriptor_, datagram_.data(), datagram_size, MSG_NOSIGNAL) < 0) {
+#ifdef HILS_NETWORK_PORT_SHOW_DEBUG_DATA
+        printf("HilsNetworkPort: %s\n", strerror(errno));
+#endif
+        // The datagram is dropped when the peer does not exist (ECONNREFUSED) or the socket buffer is full
+        break;
+      }
+    }
+  } else {
+    while (tx_buffer_.GetSize() > 0) {
+      size_t region_length;
+      const unsigned char* region = tx_buffer_.PeekReadableRegion(region_length);
+      const ssize_t sent_bytes = send(socket_descriptor_, region, region_length, MSG_NOSIGNAL);
+      if (sent_bytes > 0) {
+        tx_buffer_.CommitRead((size_t)sent_bytes);
+        continue;
+      }
+      if (sent_bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) Disconnect();
+      break;
+    }
+  }
+  return (int)tx_buffer_.GetSize();
+}
+
+bool HilsNetworkPort::UpdateConnection() {
+  if (is_connected_) return true;
+
+  switch (kConfig.transport) {
+    case HilsNetworkTransport::kTcpServer: {
+      socket_descriptor_ = accept4(listen_descriptor_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (socket_descriptor_ < 0) return false;
+      break;
+    }
+    case HilsNetworkTransport::kTcpClient: {
+      if (!is_connecting_) {
+        sockaddr_in remote_address;
+        MakeSocketAddress(kConfig.remote_address, kConfig.remote_port, remote_address);
+        socket_descriptor_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (socket_descriptor_ < 0) return false;
+        if (connect(socket_descriptor_, (sockaddr*)&remote_address, sizeof(remote_address)) != 0 && errno != EINPROGRESS) {
+          close(socket_descriptor_);
+          socket_descriptor_ = -1;
+          return false;
+        }
+        is_connecting_ = true;
+      }
+      // Check the result of the non-blocking connect
+      pollfd poll_descriptor = {socket_descriptor_, POLLOUT, 0};
+      if (poll(&poll_descriptor, 1, 0) <= 0) return false;
+      int error = 0;
+      socklen_t error_length = sizeof(error);
+      getsockopt(socket_descriptor_, SOL_SOCKET, SO_ERROR, &error, &error_length);
+      is_connecting_ = false;
+      if (error != 0) {
+        close(socket_descriptor_);
+        socket_descriptor_ = -1;
+        return false;
+      }
+      break;
+    }
+    case HilsNetworkTransport::kSharedMemoryClient:
+      if (!AttachSharedMemory()) return false;
+      break;
+    default:
+      return false;
+  }
+
+  if (socket_descriptor_ >= 0) {
+    // Small frames are sent without the Nagle delay
+    const int enable = 1;
+    setsockopt(socket_descriptor_, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+  }
+  is_connected_ = true;
+  return true;
+}
+
+void HilsNetworkPort::Disconnect() {
+  if (socket_descriptor_ >= 0) close(socket_descriptor_);
+  socket_descriptor_ = -1;
+  is_connecting_ = false;
+  // The UDP socket and the shared memory are kept until ClosePort
+  if (kConfig.transport == HilsNetworkTransport::kTcpServer || kConfig.transport == HilsNetworkTransport::kTcpClient) is_connected_ = false;
+}
+
+void HilsNetworkPort::ReceiveFromSocket() {
+  if (!UpdateConnection() || socket_descriptor_ < 0) return;
+
+  const bool is_udp = kConfig.transport == HilsNetworkTransport::kUdp;
+  unsigned char overflow_chunk[kReceiveChunkSize];
+  while (true) {
+    // TCP data is received directly into the free region of the RX buffer. Each datagram must be received at once, so UDP uses the datagram
+    // buffer.
+    size_t region_length;
+    unsigned char* region = rx_buffer_.PeekWritableRegion(region_length);
+    unsigned char* destination = region;
+    if (is_udp) {
+      destination = datagram_.data();
+      region_length = datagram_.size();
+    } else if (region_length == 0) {
+      destination = overflow_chunk;
+      region_length = kReceiveChunkSize;
+    }
+
+    const ssize_t received_bytes = recv(socket_descriptor_, destination, region_length, 0);
+    if (received_bytes == 0 && !is_udp) {
+      // The peer closed the connection
+      Disconnect();
+      return;
+    }
+    if (received_bytes < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNREFUSED) Disconnect();
+      return;
+    }
+    if (destination == region) {
+      rx_buffer_.CommitWrite((size_t)received_bytes);
+    } else {
+      // The overflowing data is written to be counted and dropped
+      rx_buffer_.Write(destination, (size_t)received_bytes);
+    }
+  }
+}
+
+int HilsNetworkPort::CreateSharedMemory() {
+  const uint64_t capacities[2] = {tx_buffer_.GetCapacity(), rx_buffer_.GetCapacity()};
+  const uint64_t header_size = (sizeof(SharedMemoryHeader) + 63) / 64 * 64;
+  const uint64_t storage_size_0 = CalcStorageSize(capacities[0]);
+  const uint64_t storage_size_1 = CalcStorageSize(capacities[1]);
+  shared_memory_size_ = (size_t)(header_size + storage_size_0 + storage_size_1);
+
+  // The object left by the aborted server is removed
+  shm_unlink(kConfig.remote_address.c_str());
+  const int descriptor = shm_open(kConfig.remote_address.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (descriptor < 0) return (errno == EACCES) ? -2 : -4;
+  if (ftruncate(descriptor, (off_t)shared_memory_size_) != 0) {
+    close(descriptor);
+    shm_unlink(kConfig.remote_address.c_str());
+    return -5;
+  }
+  void* memory = mmap(nullptr, shared_memory_size_, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+  if (memory == MAP_FAILED) {
+    shm_unlink(kConfig.remote_address.c_str());
+    return -5;
+  }
+
+  // ftruncate fills the object with zero, so only the ring settings are written
+  SharedMemoryHeader* header = (SharedMemoryHeader*)memory;
+  header->rings[0].capacity = capacities[0];
+  header->rings[0].mask = storage_size_0 - 1;
+  header->rings[0].data_offset = header_size;
+  header->rings[1].capacity = capacities[1];
+  header->rings[1].mask = storage_size_1 - 1;
+  header->rings[1].data_offset = header_size + storage_size_0;
+  header->magic.store(kSharedMemoryMagic, std::memory_order_release);
+
+  shared_memory_ = memory;
+  shared_tx_ring_ = 0;
+  return 0;
+}
+
+bool HilsNetworkPort::AttachSharedMemory() {
+  const int descriptor = shm_open(kConfig.remote_address.c_str(), O_RDWR, 0);
+  if (descriptor < 0) return false;  // The server has not created the object yet
+  struct stat status;
+  if (fstat(descriptor, &status) != 0 || (size_t)status.st_size < sizeof(SharedMemoryHeader)) {
+    close(descriptor);
+    return false;
+  }
+  void* memory = mmap(nullptr, (size_t)status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+  if (memory == MAP_FAILED) return false;
+  if (((SharedMemoryHeader*)memory)->magic.load(std::memory_order_acquire) != kSharedMemoryMagic) {
+    munmap(memory, (size_t)status.st_size);
+    return false;
+  }
+
+  shared_memory_ = memory;
+  shared_memory_size_ = (size_t)status.st_size;
+  shared_tx_ring_ = 1;
+  return true;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file hils_network_port.hpp
+ * @brief Class to exchange the HILS port data with another process through UDP, TCP, or a POSIX shared memory ring
+ * @details The port has the same byte stream interface as HilsUartPort, so the UART and I2C controller traffic of the components is
+ *          connected to the flight software on another host, visualization tools, or another S2E instance without the serial hardware.
+ *          All system calls are non-blocking and made in the simulation thread, so no I/O thread is needed.
+ */
+
+#ifndef S2E_COMPONENTS_PORTS_HILS_NETWORK_PORT_HPP_
+#define S2E_COMPONENTS_PORTS_HILS_NETWORK_PORT_HPP_
+
+#include <cstddef>
+#include <string>
+#include <utilities/spsc_ring_buffer.hpp>
+#include <vector>
+
+/**
+ * @enum HilsNetworkTransport
+ * @brief Transport of the HILS network port
+ */
+enum class HilsNetworkTransport {
+  kUdp,                 //!< UDP datagrams. The batched TX data is sent as a datagram.
+  kTcpServer,           //!< TCP stream. The port listens and accepts a peer.
+  kTcpClient,           //!< TCP stream. The port connects to the server and reconnects when the connection is lost.
+  kSharedMemoryServer,  //!< Ring buffers in POSIX shared memory. The port creates and removes the shared memory object.
+  kSharedMemoryClient,  //!< Ring buffers in POSIX shared memory. The port attaches the object created by the server.
+};
+
+/**
+ * @struct HilsNetworkPortConfig
+ * @brief Settings of the HILS network port
+ */
+struct HilsNetworkPortConfig {
+  HilsNetworkTransport transport = HilsNetworkTransport::kUdp;  //!< Transport
+  std::string remote_address = "127.0.0.1";                     //!< Peer IPv4 address (UDP, TCP client) or shm name like "/s2e_port3"
+  unsigned short local_port = 0;                                //!< Local port number to bind (UDP, TCP server)
+  unsigned short remote_port = 0;                               //!< Port number of the peer (UDP, TCP client)
+  size_t batch_size_bytes = 0;                                  //!< TX size to send the batch. Zero sends at every WriteTx.
+};
+
+/**
+ * @class HilsNetworkPort
+ * @brief Class to exchange the HILS port data with another process through UDP, TCP, or a POSIX shared memory ring
+ * @note TX means S2E -> peer process, and RX means peer process -> S2E.
+ *       The stored TX data is sent when it reaches the batch size, before ReadRx, and in Flush. Call Flush (e.g., through
+ *       HilsPortManager::FlushNetworkPorts) at the end of each step when the batching is used.
+ */
+class HilsNetworkPort {
+ public:
+  /**
+   * @fn HilsNetworkPort
+   * @brief Constructor. The port is opened in the constructor.
+   * @param [in] config: Settings of the port
+   * @param [in] tx_buffer_size: TX buffer size
+   * @param [in] rx_buffer_size: RX buffer size
+   */
+  HilsNetworkPort(const HilsNetworkPortConfig& config, const unsigned int tx_buffer_size, const unsigned int rx_buffer_size);
+  /**
+   * @fn ~HilsNetworkPort
+   * @brief Destructor.
+   */
+  ~HilsNetworkPort();
+
+  /**
+   * @fn OpenPort
+   * @brief Open the port. The connection of TCP and the attachment of the shared memory client are completed later without blocking.
+   * @return 0: success, negative value: error
+   */
+  int OpenPort();
+  /**
+   * @fn ClosePort
+   * @brief Close the port
+   * @return 0: success, -1: the port is not opened
+   */
+  int ClosePort();
+
+  /**
+   * @fn WriteTx
+   * @brief Send data to the peer. The data is stored until the batch size is reached.
+   * @param [in] buffer: Data buffer to send
+   * @param [in] offset: Start offset for the data buffer to send
+   * @param [in] data_length: Length of data to send
+   * @return 0: success, -1: error or TX buffer overflow
+   */
+  int WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
+  /**
+   * @fn ReadRx
+   * @brief Read data from the peer
+   * @param [out] buffer: Data buffer to store read data
+   * @param [in] offset: Start offset for the data buffer to read
+   * @param [in] data_length: Length of data to read
+   * @return received data length: success, -1: no data, -2: the port is not opened
+   */
+  int ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
+  /**
+   * @fn GetBytesToRead
+   * @brief Get length of byte to read
+   * @return Length of byte to read or -1 when the port is not opened
+   */
+  int GetBytesToRead();
+  /**
+   * @fn Flush
+   * @brief Send the stored TX data as far as the transport accepts it
+   * @return Number of bytes remaining in the TX buffer or -1 when the port is not opened
+   */
+  int Flush();
+
+  // Getters
+  /**
+   * @fn IsConnected
+   * @brief Return true when the data can be exchanged with the peer
+   */
+  inline bool IsConnected() const { return is_connected_; }
+  /**
+   * @fn GetTxOverflowBytes
+   * @brief Return total number of TX bytes dropped since the TX buffer was full
+   */
+  inline size_t GetTxOverflowBytes() const { return tx_buffer_.GetOverflowBytes(); }
+  /**
+   * @fn GetRxOverflowBytes
+   * @brief Return total number of RX bytes dropped since the RX buffer was full
+   */
+  inline size_t GetRxOverflowBytes() const { return rx_buffer_.GetOverflowBytes(); }
+
+ private:
+  const HilsNetworkPortConfig kConfig;  //!< Settings of the port
+  SpscRingBuffer tx_buffer_;            //!< TX data waiting for the batch or the peer
+  SpscRingBuffer rx_buffer_;            //!< RX data received from the socket
+
+  bool is_opened_ = false;               //!< Flag of the opened port
+  bool is_connected_ = false;            //!< Flag of the established connection
+  bool is_connecting_ = false;           //!< Flag of the TCP connection in progress (TCP client)
+  int socket_descriptor_ = -1;           //!< Socket to exchange the data (UDP, TCP)
+  int listen_descriptor_ = -1;           //!< Listening socket (TCP server)
+  void* shared_memory_ = nullptr;        //!< Mapped shared memory
+  size_t shared_memory_size_ = 0;        //!< Size of the mapped shared memory [bytes]
+  size_t shared_tx_ring_ = 0;            //!< Index of the ring used for TX in the shared memory
+  std::vector<unsigned char> datagram_;  //!< Buffer to assemble the TX datagram and to receive the RX datagram (UDP)
+
+  /**
+   * @fn UpdateConnection
+   * @brief Accept, connect, or attach the peer without blocking
+   * @return True when the peer is connected
+   */
+  bool UpdateConnection();
+  /**
+   * @fn Disconnect
+   * @brief Close the connection with the peer. The TCP server keeps listening.
+   */
+  void Disconnect();
+  /**
+   * @fn ReceiveFromSocket
+   * @brief Move the received data from the socket to the RX buffer
+   */
+  void ReceiveFromSocket();
+  /**
+   * @fn CreateSharedMemory
+   * @brief Create and initialize the shared memory object (shared memory server)
+   * @return 0: success, negative value: error
+   */
+  int CreateSharedMemory();
+  /**
+   * @fn AttachSharedMemory
+   * @brief Map the shared memory object initialized by the server (shared memory client)
+   * @return True when the object is attached
+   */
+  bool AttachSharedMemory();
+};
+
+#endif  // S2E_COMPONENTS_PORTS_HILS_NETWORK_PORT_HPP_
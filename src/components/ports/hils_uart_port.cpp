@@ -146,6 +146,31 @@ int HilsUartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const
   }
 }
 
+int HilsUartPort::WriteTxSlipFrame(const unsigned char* buffer, const unsigned int data_length, const bool with_header) {
+  std::vector<uint8_t> frame(CalcSlipEncodedLength(buffer, data_length, with_header));
+  EncodeSlipFrame(buffer, data_length, frame.data(), frame.size(), with_header);
+  return WriteTx(frame.data(), 0, (unsigned int)frame.size());
+}
+
+int HilsUartPort::ReadRxSlipFrames(SlipDecoder& decoder, const SlipDecoder::FrameHandler& handler) {
+  const unsigned int kChunkSize = 256;
+  unsigned char chunk[kChunkSize];
+  int bytes_to_read = GetBytesToRead();
+  if (bytes_to_read < 0) return -2;
+
+  int received_frames = 0;
+  while (bytes_to_read > 0) {
+    unsigned int chunk_length = (unsigned int)bytes_to_read;
+    if (chunk_length > kChunkSize) chunk_length = kChunkSize;
+    if (chunk_length > kRxBufferSize) chunk_length = kRxBufferSize;
+    const int received_bytes = ReadRx(chunk, 0, chunk_length);
+    if (received_bytes <= 0) break;
+    received_frames += (int)decoder.Feed(chunk, (size_t)received_bytes, handler);
+    bytes_to_read -= received_bytes;
+  }
+  return received_frames;
+}
+
 int HilsUartPort::GetBytesToRead() {
   int bytes_to_read;
   try {
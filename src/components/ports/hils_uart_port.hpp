@@ -1,33 +1,45 @@
 /**
  * @file hils_uart_port.hpp
  * @brief Class to manage PC's COM port
- * @details Currently, this feature supports Windows Visual Studio only.(FIXME)
+ * @details On Windows, the port is handled with .NET SerialPort (C++/CLI).
  * Reference: https://docs.microsoft.com/en-us/dotnet/api/system.io.ports.serialport?view=netframework-4.7.2
+ * On Linux, the port is handled natively with termios and an epoll event loop in a dedicated I/O thread (hils_uart_port_posix.cpp).
  * @note TODO :We need to clarify the difference with ComPortInterface
  */
 
 #ifndef S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 
+#ifdef WIN32
 #include <msclr/gcroot.h>
 #include <msclr/marshal_cppstd.h>
+#else
+#include <atomic>
+#include <thread>
+#include <utilities/spsc_ring_buffer.hpp>
+#endif
 
 #include <string>
+#include <utilities/slip.hpp>
 
+#ifdef WIN32
 typedef cli::array<System::Byte> bytearray;  //!< System::Byte: an 8-bit unsigned integer
+#endif
 
 /**
  * @class HilsUartPort
  * @brief Class to manage PC's COM port
  * @note TX means S2E -> COM port -> External device
  * RX means External device -> COM Port -> S2E
+ * In the native implementation, WriteTx, ReadRx, and GetBytesToRead do not block the simulation thread. The data is passed to and from
+ * the I/O thread through lock-free ring buffers with the sizes of the TX and RX buffers.
  */
 class HilsUartPort {
  public:
   /**
    * @fn HilsUartPort
    * @brief Constructor.
-   * @param [in] port_id: COM port ID
+   * @param [in] port_id: COM port ID (COM<port_id> on Windows, /dev/ttyS<port_id> on Linux)
    * @param [in] baud_rate: Baudrate of the COM port
    * @param [in] tx_buffer_size: TX buffer size
    * @param [in] rx_buffer_size: RX buffer size
@@ -65,9 +77,28 @@ class HilsUartPort {
    * @param [out] buffer: Data buffer to store read data
    * @param [in] offset: Start offset for the data buffer to read
    * @param [in] data_length: Length of data to read
-   * @return received data length: success, negative value: error
+   * @return received data length: success, -1: no data, other negative value: error
    */
   int ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
+  /**
+   * @fn WriteTxSlipFrame
+   * @brief Encode the data as a SLIP frame and send it to COM port
+   * @note In the native implementation, the frame is encoded directly into the TX buffer without the intermediate copy.
+   * @param [in] buffer: Data of the frame
+   * @param [in] data_length: Length of the data
+   * @param [in] with_header: Add FEND before the frame
+   * @return 0: success, -1: error. Nothing is sent when the TX buffer does not have space for the whole frame.
+   */
+  int WriteTxSlipFrame(const unsigned char* buffer, const unsigned int data_length, const bool with_header = false);
+  /**
+   * @fn ReadRxSlipFrames
+   * @brief Decode all received data with the SLIP decoder
+   * @note The incomplete frame is kept in the decoder until the rest of the frame is received.
+   * @param [in/out] decoder: SLIP decoder of the RX stream
+   * @param [in] handler: Handler called for each received frame
+   * @return Number of the received frames: success, negative value: error
+   */
+  int ReadRxSlipFrames(SlipDecoder& decoder, const SlipDecoder::FrameHandler& handler);
   /**
    * @fn GetBytesToRead
    * @brief Get length of byte to read
@@ -81,11 +112,32 @@ class HilsUartPort {
   const std::string kPortName;       //!< Port name like "COM4"
   unsigned int baud_rate_;           //!< Baud rate ex. 9600, 115200
 
+#ifdef WIN32
   // gcroot is the type-safe wrapper template to refer to a CLR object from the c++ heap reference:
   // https://docs.microsoft.com/en-us/cpp/dotnet/how-to-declare-handles-in-native-types?view=msvc-160
   msclr::gcroot<System::IO::Ports::SerialPort ^> port_;  //!< Port
   msclr::gcroot<bytearray ^> tx_buffer_;                 //!< TX Buffer
   msclr::gcroot<bytearray ^> rx_buffer_;                 //!< RX Buffer
+#else
+  int port_descriptor_ = -1;         //!< File descriptor of the serial port. Negative when the port is closed.
+  int epoll_descriptor_ = -1;        //!< File descriptor of the epoll instance
+  int wakeup_descriptor_ = -1;       //!< eventfd to notify the TX data and the stop request to the I/O thread
+  std::atomic<bool> is_io_running_;  //!< Flag to keep the I/O thread running
+  std::thread io_thread_;            //!< I/O thread
+  SpscRingBuffer tx_buffer_;         //!< TX data from the simulation thread to the I/O thread
+  SpscRingBuffer rx_buffer_;         //!< RX data from the I/O thread to the simulation thread
+
+  /**
+   * @fn RunIoLoop
+   * @brief Main function of the I/O thread
+   */
+  void RunIoLoop();
+  /**
+   * @fn WakeUpIoThread
+   * @brief Wake up the I/O thread waiting for the events
+   */
+  void WakeUpIoThread();
+#endif
 
   /**
    * @fn GetPortName
@@ -0,0 +1,305 @@
+/**
+ * @file hils_uart_port_posix.cpp
+ * @brief Class to manage PC's COM port with the native Linux API
+ * @details The port is opened in the raw mode with termios. A dedicated I/O thread waits for the RX data and the TX requests with epoll,
+ *          so the simulation thread only accesses the lock-free ring buffers and is never blocked by the serial I/O.
+ */
+
+#include "hils_uart_port.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/serial.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <iostream>
+
+// # define HILS_UART_PORT_SHOW_DEBUG_DATA
+
+namespace {
+/**
+ * @fn ConvertBaudRate
+ * @brief Convert the baud rate to the termios speed
+ * @return termios speed. B0 when the baud rate is not supported.
+ */
+speed_t ConvertBaudRate(const unsigned int baud_rate) {
+  switch (baud_rate) {
+    case 9600:
+      return B9600;
+    case 19200:
+      return B19200;
+    case 38400:
+      return B38400;
+    case 57600:
+      return B57600;
+    case 115200:
+      return B115200;
+    case 230400:
+      return B230400;
+    case 460800:
+      return B460800;
+    case 921600:
+      return B921600;
+    case 1000000:
+      return B1000000;
+    case 2000000:
+      return B2000000;
+    case 3000000:
+      return B3000000;
+    case 4000000:
+      return B4000000;
+    default:
+      return B0;
+  }
+}
+
+const size_t kIoChunkSize = 256;  //!< Size of the chunk to drain the driver buffer while the RX buffer is full
+}  // namespace
+
+HilsUartPort::HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size,
+                           const unsigned int rx_buffer_size)
+    : kTxBufferSize(tx_buffer_size),
+      kRxBufferSize(rx_buffer_size),
+      kPortName(GetPortName(port_id)),
+      baud_rate_(baud_rate),
+      is_io_running_(false),
+      tx_buffer_(tx_buffer_size),
+      rx_buffer_(rx_buffer_size) {
+  Initialize();
+}
+
+HilsUartPort::~HilsUartPort() { ClosePort(); }
+
+// Static method to convert from com port number to device file name.
+std::string HilsUartPort::GetPortName(const unsigned int port_id) { return "/dev/ttyS" + std::to_string(port_id); }
+
+int HilsUartPort::Initialize() {
+  if (ConvertBaudRate(baud_rate_) == B0) {
+    std::cout << "[Warning] HilsUartPort: baud rate " << baud_rate_ << " is not supported." << std::endl;
+    return -1;
+  }
+  return OpenPort();
+}
+
+int HilsUartPort::OpenPort() {
+  if (port_descriptor_ >= 0) return 0;
+
+  const int port_descriptor = open(kPortName.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+  if (port_descriptor < 0) {
+    const int error = errno;
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+    printf("%s: %s\n", kPortName.c_str(), strerror(error));
+#endif
+    if (error == EACCES || error == EBUSY) return -2;  // Access is denied or the port is already used
+    if (error == ENOENT || error == ENXIO) return -4;  // The port does not exist
+    return -5;
+  }
+
+  // Raw mode without the flow control. read returns immediately with the available bytes.
+  struct termios settings;
+  const speed_t speed = ConvertBaudRate(baud_rate_);
+  if (tcgetattr(port_descriptor, &settings) != 0 || speed == B0) {
+    close(port_descriptor);
+    return -3;
+  }
+  cfmakeraw(&settings);
+  settings.c_cflag |= (CLOCAL | CREAD);
+  settings.c_cflag &= ~CRTSCTS;
+  settings.c_cc[VMIN] = 0;
+  settings.c_cc[VTIME] = 0;
+  cfsetispeed(&settings, speed);
+  cfsetospeed(&settings, speed);
+  if (tcsetattr(port_descriptor, TCSANOW, &settings) != 0) {
+    close(port_descriptor);
+    return -3;
+  }
+  tcflush(port_descriptor, TCIOFLUSH);
+
+  // Request the low latency mode of the driver (e.g., 1 ms latency timer of the USB serial converters). It is optional.
+  struct serial_struct serial_settings;
+  if (ioctl(port_descriptor, TIOCGSERIAL, &serial_settings) == 0) {
+    serial_settings.flags |= ASYNC_LOW_LATENCY;
+    ioctl(port_descriptor, TIOCSSERIAL, &serial_settings);
+  }
+
+  // Event loop
+  epoll_descriptor_ = epoll_create1(EPOLL_CLOEXEC);
+  wakeup_descriptor_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (epoll_descriptor_ < 0 || wakeup_descriptor_ < 0) {
+    if (epoll_descriptor_ >= 0) close(epoll_descriptor_);
+    if (wakeup_descriptor_ >= 0) close(wakeup_descriptor_);
+    epoll_descriptor_ = -1;
+    wakeup_descriptor_ = -1;
+    close(port_descriptor);
+    return -5;
+  }
+  struct epoll_event event;
+  memset(&event, 0, sizeof(event));
+  event.events = EPOLLIN;
+  event.data.fd = port_descriptor;
+  epoll_ctl(epoll_descriptor_, EPOLL_CTL_ADD, port_descriptor, &event);
+  event.data.fd = wakeup_descriptor_;
+  epoll_ctl(epoll_descriptor_, EPOLL_CTL_ADD, wakeup_descriptor_, &event);
+
+  port_descriptor_ = port_descriptor;
+  is_io_running_ = true;
+  io_thread_ = std::thread(&HilsUartPort::RunIoLoop, this);
+  return 0;  // Success !!
+}
+
+int HilsUartPort::ClosePort() {
+  if (port_descriptor_ < 0) return -1;
+
+  is_io_running_ = false;
+  WakeUpIoThread();
+  if (io_thread_.joinable()) io_thread_.join();
+
+  close(epoll_descriptor_);
+  close(wakeup_descriptor_);
+  close(port_descriptor_);
+  epoll_descriptor_ = -1;
+  wakeup_descriptor_ = -1;
+  port_descriptor_ = -1;
+
+  if (rx_buffer_.GetOverflowBytes() > 0) {
+    std::cout << "[Warning] HilsUartPort: " << rx_buffer_.GetOverflowBytes() << " bytes received from " << kPortName
+              << " were dropped since the RX buffer was full (" << rx_buffer_.GetCapacity() << " bytes)." << std::endl;
+  }
+  return 0;
+}
+
+int HilsUartPort::WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (port_descriptor_ < 0) return -1;
+  const size_t written_bytes = tx_buffer_.Write(buffer + offset, data_length);
+  WakeUpIoThread();
+  if (written_bytes < data_length) {
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+    printf("%s: TX buffer overflow\n", kPortName.c_str());
+#endif
+    return -1;
+  }
+  return 0;
+}
+
+int HilsUartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (port_descriptor_ < 0) return -2;
+  const size_t received_bytes = rx_buffer_.Read(buffer + offset, data_length);
+  if (received_bytes == 0) return -1;  // No bytes were available to read.
+  return (int)received_bytes;
+}
+
+int HilsUartPort::WriteTxSlipFrame(const unsigned char* buffer, const unsigned int data_length, const bool with_header) {
+  if (port_descriptor_ < 0) return -1;
+  const bool is_written = EncodeSlipFrame(buffer, data_length, tx_buffer_, with_header);
+  if (!is_written) {
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+    printf("%s: TX buffer overflow\n", kPortName.c_str());
+#endif
+    return -1;
+  }
+  WakeUpIoThread();
+  return 0;
+}
+
+int HilsUartPort::ReadRxSlipFrames(SlipDecoder& decoder, const SlipDecoder::FrameHandler& handler) {
+  if (port_descriptor_ < 0) return -2;
+  return (int)decoder.Feed(rx_buffer_, handler);
+}
+
+int HilsUartPort::GetBytesToRead() {
+  if (port_descriptor_ < 0) return -1;
+  return (int)rx_buffer_.GetSize();
+}
+
+int HilsUartPort::DiscardInBuffer() {
+  if (port_descriptor_ < 0) return -1;
+  tcflush(port_descriptor_, TCIFLUSH);
+  rx_buffer_.Clear();
+  return 0;
+}
+
+int HilsUartPort::DiscardOutBuffer() {
+  // The TX buffer is consumed by the I/O thread, so only the data in the driver is discarded.
+  if (port_descriptor_ < 0) return -1;
+  tcflush(port_descriptor_, TCOFLUSH);
+  return 0;
+}
+
+void HilsUartPort::WakeUpIoThread() {
+  const uint64_t count = 1;
+  if (write(wakeup_descriptor_, &count, sizeof(count)) < 0) {
+    // The counter is saturated, so the I/O thread is already notified.
+  }
+}
+
+void HilsUartPort::RunIoLoop() {
+  unsigned char overflow_chunk[kIoChunkSize];  // Used to drain the driver when the RX buffer is full
+  bool is_output_waited = false;
+
+  while (is_io_running_) {
+    struct epoll_event events[2];
+    const int number_of_events = epoll_wait(epoll_descriptor_, events, 2, -1);
+    if (number_of_events < 0 && errno != EINTR) break;
+
+    for (int i = 0; i < number_of_events; i++) {
+      if (events[i].data.fd == wakeup_descriptor_) {
+        uint64_t count;
+        while (read(wakeup_descriptor_, &count, sizeof(count)) > 0) {
+        }
+        continue;
+      }
+      if (events[i].events & EPOLLIN) {
+        // RX: the driver buffer -> RX buffer. The data is read directly into the free region of the RX buffer.
+        while (true) {
+          size_t region_length;
+          unsigned char* region = rx_buffer_.PeekWritableRegion(region_length);
+          if (region_length == 0) {
+            // The overflowing data is written to be counted and dropped
+            const ssize_t read_bytes = read(port_descriptor_, overflow_chunk, kIoChunkSize);
+            if (read_bytes <= 0) break;
+            rx_buffer_.Write(overflow_chunk, (size_t)read_bytes);
+            continue;
+          }
+          const ssize_t read_bytes = read(port_descriptor_, region, region_length);
+          if (read_bytes <= 0) break;
+          rx_buffer_.CommitWrite((size_t)read_bytes);
+        }
+      }
+      if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+        // The device is disconnected
+        std::cout << "[Warning] HilsUartPort: " << kPortName << " is disconnected." << std::endl;
+        return;
+      }
+    }
+
+    // TX: TX buffer -> the driver buffer until the driver buffer is full. The data is written directly from the TX buffer.
+    bool is_driver_full = false;
+    while (!is_driver_full) {
+      size_t region_length;
+      const unsigned char* region = tx_buffer_.PeekReadableRegion(region_length);
+      if (region_length == 0) break;
+      const ssize_t written_bytes = write(port_descriptor_, region, region_length);
+      if (written_bytes > 0) {
+        tx_buffer_.CommitRead((size_t)written_bytes);
+      } else {
+        is_driver_full = true;
+      }
+    }
+
+    // Wait until the driver can accept the data when the TX data remains
+    if (is_driver_full != is_output_waited) {
+      struct epoll_event event;
+      memset(&event, 0, sizeof(event));
+      event.events = is_driver_full ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+      event.data.fd = port_descriptor_;
+      epoll_ctl(epoll_descriptor_, EPOLL_CTL_MOD, port_descriptor_, &event);
+      is_output_waited = is_driver_full;
+    }
+  }
+}
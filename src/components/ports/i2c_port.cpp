@@ -5,19 +5,18 @@
 
 #include "i2c_port.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <utilities/macros.hpp>
 
-I2cPort::I2cPort(void) {}
+I2cPort::I2cPort(void) { device_index_.fill(-1); }
 
-I2cPort::I2cPort(const unsigned char max_register_number) : max_register_number_(max_register_number) {}
+I2cPort::I2cPort(const unsigned char max_register_number) : max_register_number_(max_register_number) { device_index_.fill(-1); }
 
 void I2cPort::RegisterDevice(const unsigned char i2c_address) {
-  for (unsigned char i = 0; i < max_register_number_; i++) {
-    device_registers_[std::make_pair(i2c_address, i)] = 0x00;
-  }
-  for (unsigned char i = 0; i < kDefaultCmdBufferSize; i++) {
-    command_buffer_[std::make_pair(i2c_address, i)] = 0x00;
-  }
+  Device& device = GetDevice(i2c_address);
+  std::fill(device.registers.begin(), device.registers.end(), (unsigned char)0x00);
+  std::fill(device.command_buffer.begin(), device.command_buffer.end(), (unsigned char)0x00);
 }
 
 int I2cPort::WriteRegister(const unsigned char i2c_address, const unsigned char register_address) {
@@ -31,7 +30,7 @@ int I2cPort::WriteRegister(const unsigned char i2c_address, const unsigned char
 int I2cPort::WriteRegister(const unsigned char i2c_address, const unsigned char register_address, const unsigned char value) {
   if (register_address >= max_register_number_) return 0;
   saved_register_address_ = register_address;
-  device_registers_[std::make_pair(i2c_address, register_address)] = value;
+  GetDevice(i2c_address).registers[register_address] = value;
   return 1;
 }
 
@@ -51,7 +50,7 @@ register_address, float value)
 */
 
 unsigned char I2cPort::ReadRegister(const unsigned char i2c_address) {
-  unsigned char ret = device_registers_[std::make_pair(i2c_address, saved_register_address_)];
+  unsigned char ret = GetDevice(i2c_address).registers[saved_register_address_];
   saved_register_address_++;
   if (saved_register_address_ >= max_register_number_) saved_register_address_ = 0;
   return ret;
@@ -60,17 +59,54 @@ unsigned char I2cPort::ReadRegister(const unsigned char i2c_address) {
 unsigned char I2cPort::ReadRegister(const unsigned char i2c_address, const unsigned char register_address) {
   if (register_address >= max_register_number_) return 0;
   saved_register_address_ = register_address;
-  unsigned char ret = device_registers_[std::make_pair(i2c_address, saved_register_address_)];
+  unsigned char ret = GetDevice(i2c_address).registers[saved_register_address_];
   return ret;
 }
 
+unsigned char I2cPort::WriteRegisters(const unsigned char i2c_address, const unsigned char register_address, const unsigned char* data,
+                                      const unsigned char length) {
+  if (register_address >= max_register_number_ || length == 0) return 0;
+  const unsigned char written_length = (unsigned char)std::min((int)length, max_register_number_ - register_address);
+  memcpy(&GetDevice(i2c_address).registers[register_address], data, written_length);
+  saved_register_address_ = register_address + written_length - 1;
+  return written_length;
+}
+
+unsigned char I2cPort::ReadRegisters(const unsigned char i2c_address, const unsigned char register_address, unsigned char* data,
+                                     const unsigned char length) {
+  if (length == 0) return 0;
+  unsigned char read_length = 0;
+  if (register_address < max_register_number_) {
+    read_length = (unsigned char)std::min((int)length, max_register_number_ - register_address);
+    memcpy(data, &GetDevice(i2c_address).registers[register_address], read_length);
+    saved_register_address_ = register_address + read_length - 1;
+  }
+  memset(data + read_length, 0, length - read_length);
+  return length;
+}
+
+unsigned char I2cPort::ReadRegisters(const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
+  if (max_register_number_ == 0) {
+    memset(data, 0, length);
+    return length;
+  }
+  const Device& device = GetDevice(i2c_address);
+  unsigned char read_length = 0;
+  while (read_length < length) {
+    const unsigned char chunk_length = (unsigned char)std::min(length - read_length, max_register_number_ - saved_register_address_);
+    memcpy(data + read_length, &device.registers[saved_register_address_], chunk_length);
+    read_length += chunk_length;
+    saved_register_address_ += chunk_length;
+    if (saved_register_address_ >= max_register_number_) saved_register_address_ = 0;
+  }
+  return length;
+}
+
 unsigned char I2cPort::WriteCommand(const unsigned char i2c_address, const unsigned char* tx_data, const unsigned char length) {
   if (length > kDefaultCmdBufferSize) {
     return 0;
   }
-  for (unsigned char i = 0; i < length; i++) {
-    command_buffer_[std::make_pair(i2c_address, i)] = tx_data[i];
-  }
+  memcpy(GetDevice(i2c_address).command_buffer.data(), tx_data, length);
 
   if (length == 1)  // length == 1 means setting of read register address
   {
@@ -88,8 +124,18 @@ unsigned char I2cPort::ReadCommand(const unsigned char i2c_address, unsigned cha
   if (length > kDefaultCmdBufferSize) {
     return 0;
   }
-  for (unsigned char i = 0; i < length; i++) {
-    rx_data[i] = command_buffer_[std::make_pair(i2c_address, i)];
-  }
+  memcpy(rx_data, GetDevice(i2c_address).command_buffer.data(), length);
   return length;
 }
+
+I2cPort::Device& I2cPort::GetDevice(const unsigned char i2c_address) {
+  if (device_index_[i2c_address] < 0) {
+    Device device;
+    // One more register is allocated for ReadRegister without the register address when max_register_number is zero
+    device.registers.assign(max_register_number_ + 1, 0x00);
+    device.command_buffer.assign(kDefaultCmdBufferSize, 0x00);
+    device_index_[i2c_address] = (int)devices_.size();
+    devices_.push_back(device);
+  }
+  return devices_[device_index_[i2c_address]];
+}
@@ -6,12 +6,14 @@
 #ifndef S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
 
-#include <map>
+#include <array>
+#include <vector>
 
 /**
  * @class I2cPort
  * @brief Class to emulate I2C(Inter-Integrated Circuit) communication port
  * @details The class has the register to store the parameters
+ *          The registers and the command buffer of each device are flat arrays, so the consecutive registers are accessed as a block.
  */
 class I2cPort {
  public:
@@ -76,6 +78,39 @@ class I2cPort {
    */
   unsigned char ReadRegister(const unsigned char i2c_address, const unsigned char register_address);
 
+  // Block access to the consecutive registers
+  /**
+   * @fn WriteRegisters
+   * @brief Write values in the consecutive registers of the target device
+   * @param [in] i2c_address: I2C address of the target device
+   * @param [in] register_address: First register address of the target device
+   * @param [in] data: Values to write
+   * @param [in] length: Number of the registers
+   * @return Number of the written registers. The registers at or beyond the maximum register number are not written.
+   */
+  unsigned char WriteRegisters(const unsigned char i2c_address, const unsigned char register_address, const unsigned char* data,
+                               const unsigned char length);
+  /**
+   * @fn ReadRegisters
+   * @brief Read values of the consecutive registers of the target device
+   * @param [in] i2c_address: I2C address of the target device
+   * @param [in] register_address: First register address of the target device
+   * @param [out] data: Read values. The registers at or beyond the maximum register number are read as zero.
+   * @param [in] length: Number of the registers
+   * @return Number of the read registers
+   */
+  unsigned char ReadRegisters(const unsigned char i2c_address, const unsigned char register_address, unsigned char* data,
+                              const unsigned char length);
+  /**
+   * @fn ReadRegisters
+   * @brief Read values of the consecutive registers from the previous accessed address. The address wraps at the maximum register number.
+   * @param [in] i2c_address: I2C address of the target device
+   * @param [out] data: Read values
+   * @param [in] length: Number of the registers
+   * @return Number of the read registers
+   */
+  unsigned char ReadRegisters(const unsigned char i2c_address, unsigned char* data, const unsigned char length);
+
   // OBC->Component Command emulation
   /**
    * @fn WriteCommand
@@ -101,11 +136,23 @@ class I2cPort {
   unsigned char max_register_number_ = 0xff;     //!< Maximum register number
   unsigned char saved_register_address_ = 0x00;  //!< Saved register address
 
-  /** @brief Device register: <pair(i2c_address, register_address), value>  **/
-  std::map<std::pair<unsigned char, unsigned char>, unsigned char> device_registers_;
+  /**
+   * @struct Device
+   * @brief Registers and command buffer of a target device
+   */
+  struct Device {
+    std::vector<unsigned char> registers;       //!< Device registers indexed by the register address
+    std::vector<unsigned char> command_buffer;  //!< Buffer for the command from OnBoardComputer
+  };
+  std::vector<Device> devices_;        //!< Target devices
+  std::array<int, 256> device_index_;  //!< Index of devices_ for each I2C address. -1 when the device is not registered.
 
-  /** @brief Buffer for the command from OnBoardComputer : <pair(i2c_address, cmd_buffer_length), value>  **/
-  std::map<std::pair<unsigned char, unsigned char>, unsigned char> command_buffer_;
+  /**
+   * @fn GetDevice
+   * @brief Return the target device. The device is registered when it is accessed for the first time.
+   * @param [in] i2c_address: I2C address of the target device
+   */
+  Device& GetDevice(const unsigned char i2c_address);
 };
 
 #endif  // S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
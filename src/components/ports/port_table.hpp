@@ -0,0 +1,56 @@
+/**
+ * @file port_table.hpp
+ * @brief Table of the communication ports indexed by the port ID
+ */
+
+#ifndef S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
+#define S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class PortTable
+ * @brief Table of the communication ports indexed by the port ID
+ * @details The ports are stored in a flat array, so the lookup in every transfer is an index access instead of a std::map search.
+ *          The port IDs are small non-negative numbers in practice, and the array grows to the largest registered port ID.
+ * @note The table does not own the ports.
+ */
+template <typename T>
+class PortTable {
+ public:
+  /**
+   * @fn Get
+   * @brief Return the port, or nullptr when the port ID is not registered
+   * @param [in] port_id: Port ID
+   */
+  inline T* Get(const int port_id) const {
+    if (port_id < 0 || (size_t)port_id >= ports_.size()) return nullptr;
+    return ports_[port_id];
+  }
+  /**
+   * @fn Set
+   * @brief Register the port
+   * @param [in] port_id: Port ID. Negative value is ignored.
+   * @param [in] port: Port
+   */
+  inline void Set(const int port_id, T* port) {
+    if (port_id < 0) return;
+    if ((size_t)port_id >= ports_.size()) ports_.resize(port_id + 1, nullptr);
+    ports_[port_id] = port;
+  }
+  /**
+   * @fn Erase
+   * @brief Unregister the port
+   * @param [in] port_id: Port ID
+   */
+  inline void Erase(const int port_id) {
+    if (port_id < 0 || (size_t)port_id >= ports_.size()) return;
+    ports_[port_id] = nullptr;
+  }
+
+ private:
+  std::vector<T*> ports_;  //!< Ports indexed by the port ID
+};
+
+#endif  // S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
@@ -5,6 +5,7 @@
 
 #include "power_port.hpp"
 
+#include <algorithm>
 #include <cfloat>
 #include <setting_file_reader/initialize_file_access.hpp>
 #include <utilities/macros.hpp>
@@ -16,6 +17,7 @@ PowerPort::PowerPort() : kPortId(-1), current_limit_A_(10.0), minimum_voltage_V_
 
 PowerPort::PowerPort(const int port_id, const double current_limit_A)
     : kPortId(port_id), current_limit_A_(current_limit_A), minimum_voltage_V_(3.3), assumed_power_consumption_W_(0.0) {
+  is_on_ = false;
   Initialize();
 }
 
@@ -24,6 +26,7 @@ PowerPort::PowerPort(const int port_id, const double current_limit_A, const doub
       current_limit_A_(current_limit_A),
       minimum_voltage_V_(minimum_voltage_V),
       assumed_power_consumption_W_(assumed_power_consumption_W) {
+  is_on_ = false;
   Initialize();
 }
 
@@ -36,6 +39,8 @@ void PowerPort::Initialize(void) {
 }
 
 bool PowerPort::Update(void) {
+  const double previous_current_consumption_A = current_consumption_A_;
+  const bool previous_is_on = is_on_;
   // switching
   if (voltage_V_ >= (minimum_voltage_V_ - DBL_EPSILON)) {
     is_on_ = true;
@@ -50,6 +55,11 @@ bool PowerPort::Update(void) {
     voltage_V_ = 0.0;
     is_on_ = false;
   }
+  if (total_current_consumption_A_ != nullptr) *total_current_consumption_A_ += current_consumption_A_ - previous_current_consumption_A;
+  // Notify only the edges of the power switch
+  if (is_on_ != previous_is_on) {
+    for (size_t i = 0; i < observers_.size(); i++) observers_[i]->PowerStateChanged(kPortId, is_on_);
+  }
   return is_on_;
 }
 
@@ -74,3 +84,13 @@ void PowerPort::InitializeWithInitializeFile(const std::string file_name) {
   double assumed_power_consumption_W = initialize_file.ReadDouble(section_name.c_str(), "assumed_power_consumption_W");
   this->SetAssumedPowerConsumption_W(assumed_power_consumption_W);
 }
+
+void PowerPort::AddObserver(IPowerPortObserver* observer) {
+  if (observer == nullptr) return;
+  if (std::find(observers_.begin(), observers_.end(), observer) != observers_.end()) return;
+  observers_.push_back(observer);
+}
+
+void PowerPort::RemoveObserver(IPowerPortObserver* observer) {
+  observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+}
@@ -6,14 +6,18 @@
 #ifndef S2E_COMPONENTS_PORTS_POWER_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_POWER_PORT_HPP_
 
+#include <components/base/interface_power_port_observer.hpp>
 #include <string>
+#include <utilities/case_arena.hpp>
+#include <vector>
 
 /**
  * @class PowerPort
  * @brief Class to emulate electrical power port
  * @details When the power switch is turned off, the component doesn't work same with the real world.
+ *          The observers are notified only when the power switch state is changed, so they do not need to poll the state.
  */
-class PowerPort {
+class PowerPort : public ArenaAllocated {
  public:
   /**
    * @fn PowerPort
@@ -71,6 +75,11 @@ class PowerPort {
    * @brief Return the power switch state
    */
   inline bool GetIsOn() const { return is_on_; }
+  /**
+   * @fn GetPortId
+   * @brief Return the ID of the power port
+   */
+  inline int GetPortId() const { return kPortId; }
 
   // Setters
   /**
@@ -107,11 +116,29 @@ class PowerPort {
    * @brief Subtract assumed power consumption [W] to emulate power line which has multiple loads
    */
   void SubtractAssumedPowerConsumption_W(const double power_W);
+  /**
+   * @fn SetCurrentConsumptionAccumulator
+   * @brief Set the accumulator of the total current consumption of the power lines (e.g., PowerControlUnit)
+   * @note The change of the current consumption is added to the accumulator at every update, so the total is kept without summing all ports
+   * @param [in] total_current_consumption_A: Pointer to the total current consumption [A]. nullptr disables the accumulation.
+   */
+  inline void SetCurrentConsumptionAccumulator(double* total_current_consumption_A) { total_current_consumption_A_ = total_current_consumption_A; }
   /**
    * @fn InitializeWithInitializeFile
    * @brief Initialize PowerPort class with initialize file
    */
   void InitializeWithInitializeFile(const std::string file_name);
+  /**
+   * @fn AddObserver
+   * @brief Add the observer notified when the power switch state is changed
+   * @param [in] observer: Observer. It must be removed before it is destructed.
+   */
+  void AddObserver(IPowerPortObserver* observer);
+  /**
+   * @fn RemoveObserver
+   * @brief Remove the observer
+   */
+  void RemoveObserver(IPowerPortObserver* observer);
 
  private:
   // PCU setting parameters
@@ -126,6 +153,9 @@ class PowerPort {
   double current_consumption_A_;  //!< Current consumption calculated by I = P/V[A]
   bool is_on_;                    //!< Power switch state
 
+  double* total_current_consumption_A_ = nullptr;  //!< Accumulator of the total current consumption [A]
+  std::vector<IPowerPortObserver*> observers_;     //!< Observers of the power switch state
+
   /**
    * @fn Initialize
    * @brief Initialize function
@@ -0,0 +1,202 @@
+/**
+ * @file test_hils_network_port.cpp
+ * @brief Test codes for HilsNetworkPort class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#if defined(USE_HILS) && !defined(WIN32)
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hils_network_port.hpp"
+
+namespace {
+/**
+ * @fn FindFreePort
+ * @brief Return a port number of the loopback address which is not used now
+ * @param [in] type: Socket type (SOCK_DGRAM or SOCK_STREAM)
+ */
+unsigned short FindFreePort(const int type) {
+  const int descriptor = socket(AF_INET, type, 0);
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  bind(descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+  socklen_t length = sizeof(address);
+  getsockname(descriptor, reinterpret_cast<sockaddr*>(&address), &length);
+  close(descriptor);
+  return ntohs(address.sin_port);
+}
+
+/**
+ * @fn WaitForBytes
+ * @brief Poll the port until the bytes are received or the timeout
+ * @param [in] port: Port to receive the data
+ * @param [in] peer: Port of the peer which is flushed while waiting
+ * @param [in] expected_bytes: Number of bytes to wait for
+ * @return Number of bytes to read
+ */
+int WaitForBytes(HilsNetworkPort& port, HilsNetworkPort& peer, const int expected_bytes) {
+  int bytes_to_read = 0;
+  for (size_t trial = 0; trial < 2000; trial++) {
+    peer.Flush();
+    bytes_to_read = port.GetBytesToRead();
+    if (bytes_to_read >= expected_bytes) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return bytes_to_read;
+}
+
+/**
+ * @fn ExpectTransfer
+ * @brief Send the data from a port and expect the same data at the peer
+ * @param [in] sender: Port to send the data
+ * @param [in] receiver: Port to receive the data
+ * @param [in] data: Data
+ */
+void ExpectTransfer(HilsNetworkPort& sender, HilsNetworkPort& receiver, const std::vector<unsigned char>& data) {
+  ASSERT_EQ(0, sender.WriteTx(data.data(), 0, (unsigned int)data.size()));
+  ASSERT_EQ((int)data.size(), WaitForBytes(receiver, sender, (int)data.size()));
+  std::vector<unsigned char> received_data(data.size() + 1, 0);
+  EXPECT_EQ((int)data.size(), receiver.ReadRx(received_data.data(), 1, (unsigned int)data.size()));
+  EXPECT_EQ(data, std::vector<unsigned char>(received_data.begin() + 1, received_data.end()));
+}
+}  // namespace
+
+/**
+ * @brief Test for the batched datagrams between the UDP ports
+ */
+TEST(HilsNetworkPort, Udp) {
+  const unsigned short port_number_a = FindFreePort(SOCK_DGRAM);
+  unsigned short port_number_b = FindFreePort(SOCK_DGRAM);
+  while (port_number_b == port_number_a) port_number_b = FindFreePort(SOCK_DGRAM);
+  HilsNetworkPortConfig config_a;
+  config_a.local_port = port_number_a;
+  config_a.remote_port = port_number_b;
+  config_a.batch_size_bytes = 8;
+  HilsNetworkPortConfig config_b;
+  config_b.local_port = port_number_b;
+  config_b.remote_port = port_number_a;
+  HilsNetworkPort port_a(config_a, 64, 64);
+  HilsNetworkPort port_b(config_b, 64, 64);
+  EXPECT_TRUE(port_a.IsConnected());
+  EXPECT_TRUE(port_b.IsConnected());
+
+  // The data is stored until the batch size
+  const unsigned char data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  EXPECT_EQ(0, port_a.WriteTx(data, 0, 4));
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(0, port_b.GetBytesToRead());
+  EXPECT_EQ(0, port_a.WriteTx(data, 4, 4));
+  for (size_t trial = 0; trial < 2000 && port_b.GetBytesToRead() < 8; trial++) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  unsigned char received_data[8] = {0};
+  ASSERT_EQ(8, port_b.ReadRx(received_data, 0, 8));
+  for (size_t i = 0; i < 8; i++) EXPECT_EQ(data[i], received_data[i]);
+  EXPECT_EQ(-1, port_b.ReadRx(received_data, 0, 8));
+
+  // The response without the batching, and the stored data sent by Flush
+  ExpectTransfer(port_b, port_a, {0xAA, 0xBB, 0xCC});
+  ExpectTransfer(port_a, port_b, {9, 10, 11});
+}
+
+/**
+ * @brief Test for the TCP stream, the TX overflow before the connection, and the reconnection of the client
+ */
+TEST(HilsNetworkPort, Tcp) {
+  const unsigned short port_number = FindFreePort(SOCK_STREAM);
+  HilsNetworkPortConfig server_config;
+  server_config.transport = HilsNetworkTransport::kTcpServer;
+  server_config.local_port = port_number;
+  HilsNetworkPortConfig client_config;
+  client_config.transport = HilsNetworkTransport::kTcpClient;
+  client_config.remote_port = port_number;
+
+  // The client keeps the TX data until the server accepts it
+  HilsNetworkPort client(client_config, 16, 256);
+  EXPECT_FALSE(client.IsConnected());
+  std::vector<unsigned char> data(20);
+  for (size_t i = 0; i < data.size(); i++) data[i] = (unsigned char)i;
+  EXPECT_EQ(-1, client.WriteTx(data.data(), 0, (unsigned int)data.size()));
+  EXPECT_EQ(4u, client.GetTxOverflowBytes());
+
+  auto server = std::make_unique<HilsNetworkPort>(server_config, 256, 256);
+  ASSERT_EQ(16, WaitForBytes(*server, client, 16));
+  EXPECT_TRUE(client.IsConnected());
+  EXPECT_TRUE(server->IsConnected());
+  std::vector<unsigned char> received_data(16);
+  EXPECT_EQ(16, server->ReadRx(received_data.data(), 0, 16));
+  EXPECT_EQ(std::vector<unsigned char>(data.begin(), data.begin() + 16), received_data);
+
+  std::vector<unsigned char> large_data(200);
+  for (size_t i = 0; i < large_data.size(); i++) large_data[i] = (unsigned char)(255 - i);
+  ExpectTransfer(*server, client, large_data);
+  ExpectTransfer(client, *server, {1, 2, 3});
+
+  // The client detects the closed connection and connects to the restarted server
+  server.reset();
+  for (size_t trial = 0; trial < 2000 && client.IsConnected(); trial++) {
+    client.GetBytesToRead();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_FALSE(client.IsConnected());
+  server = std::make_unique<HilsNetworkPort>(server_config, 256, 256);
+  ExpectTransfer(client, *server, {4, 5, 6});
+  EXPECT_TRUE(client.IsConnected());
+
+  EXPECT_EQ(0, client.ClosePort());
+  EXPECT_EQ(-1, client.ClosePort());
+  EXPECT_EQ(-2, client.ReadRx(received_data.data(), 0, 1));
+  EXPECT_EQ(-1, client.GetBytesToRead());
+}
+
+/**
+ * @brief Test for the rings of the shared memory, the attachment after the server starts, and the removal at the close
+ */
+TEST(HilsNetworkPort, SharedMemory) {
+  const std::string name = "/s2e_test_hils_network_port_" + std::to_string(getpid());
+  HilsNetworkPortConfig server_config;
+  server_config.transport = HilsNetworkTransport::kSharedMemoryServer;
+  server_config.remote_address = name;
+  HilsNetworkPortConfig client_config = server_config;
+  client_config.transport = HilsNetworkTransport::kSharedMemoryClient;
+
+  // The client waits for the server
+  HilsNetworkPort client(client_config, 32, 32);
+  EXPECT_FALSE(client.IsConnected());
+  EXPECT_EQ(0, client.GetBytesToRead());
+
+  auto server = std::make_unique<HilsNetworkPort>(server_config, 16, 8);
+  EXPECT_TRUE(server->IsConnected());
+  ExpectTransfer(client, *server, {1, 2, 3, 4, 5});
+  EXPECT_TRUE(client.IsConnected());
+  ExpectTransfer(*server, client, {6, 7, 8});
+
+  // The data more than the ring is kept in the TX buffer until the peer reads it
+  std::vector<unsigned char> data(12);
+  for (size_t i = 0; i < data.size(); i++) data[i] = (unsigned char)(100 + i);
+  EXPECT_EQ(0, client.WriteTx(data.data(), 0, (unsigned int)data.size()));
+  EXPECT_EQ(4, client.Flush());
+  EXPECT_EQ(8, server->GetBytesToRead());
+  std::vector<unsigned char> received_data(12);
+  EXPECT_EQ(8, server->ReadRx(received_data.data(), 0, 12));
+  EXPECT_EQ(0, client.Flush());
+  EXPECT_EQ(4, server->ReadRx(received_data.data(), 8, 4));
+  EXPECT_EQ(data, received_data);
+
+  // The server removes the shared memory object
+  server.reset();
+  EXPECT_LT(shm_open(name.c_str(), O_RDONLY, 0), 0);
+}
+#endif  // USE_HILS
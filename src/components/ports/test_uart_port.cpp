@@ -0,0 +1,37 @@
+/**
+ * @file test_uart_port.cpp
+ * @brief Test codes for UartPort class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "uart_port.hpp"
+
+/**
+ * @brief Test for the data dropped instead of overwriting the unread data when the buffer is full
+ */
+TEST(UartPort, DropOnOverflow) {
+  UartPort port(8, 4);
+  const unsigned char data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // OBC -> Component
+  EXPECT_EQ(3, port.WriteTx(data, 0, 3));
+  EXPECT_EQ(1, port.WriteTx(data, 3, 3));
+  EXPECT_EQ(2u, port.GetTxOverflowBytes());
+  EXPECT_EQ(4u, port.GetTxHighWaterMarkBytes());
+  unsigned char read_data[10] = {0};
+  EXPECT_EQ(4, port.ReadTx(read_data, 1, 10));
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_EQ(data[i], read_data[i + 1]);
+  }
+  EXPECT_EQ(0, port.ReadTx(read_data, 0, 10));
+
+  // Component -> OBC
+  EXPECT_EQ(8, port.WriteRx(data, 0, 10));
+  EXPECT_EQ(2u, port.GetRxOverflowBytes());
+  EXPECT_EQ(8, port.ReadRx(read_data, 0, 10));
+  for (size_t i = 0; i < 8; i++) {
+    EXPECT_EQ(data[i], read_data[i]);
+  }
+  EXPECT_EQ(0u, port.GetTxBuffer().GetSize());
+  EXPECT_EQ(0u, port.GetRxBuffer().GetSize());
+}
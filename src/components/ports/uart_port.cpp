@@ -12,8 +12,8 @@ UartPort::UartPort(const unsigned int rx_buffer_size, const unsigned int tx_buff
   unsigned int checked_tx_buffer_size = tx_buffer_size;
   if (rx_buffer_size <= 0) checked_rx_buffer_size = kDefaultBufferSize;
   if (tx_buffer_size <= 0) checked_tx_buffer_size = kDefaultBufferSize;
-  rx_buffer_ = new RingBuffer(checked_rx_buffer_size);
-  tx_buffer_ = new RingBuffer(checked_tx_buffer_size);
+  rx_buffer_ = new SpscRingBuffer(checked_rx_buffer_size);
+  tx_buffer_ = new SpscRingBuffer(checked_tx_buffer_size);
 }
 
 UartPort::~UartPort() {
@@ -22,17 +22,17 @@ UartPort::~UartPort() {
 }
 
 int UartPort::WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return tx_buffer_->Write(buffer, offset, data_length);
+  return (int)tx_buffer_->Write(buffer + offset, data_length);
 }
 
 int UartPort::WriteRx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return rx_buffer_->Write(buffer, offset, data_length);
+  return (int)rx_buffer_->Write(buffer + offset, data_length);
 }
 
 int UartPort::ReadTx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return tx_buffer_->Read(buffer, offset, data_length);
+  return (int)tx_buffer_->Read(buffer + offset, data_length);
 }
 
 int UartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return rx_buffer_->Read(buffer, offset, data_length);
+  return (int)rx_buffer_->Read(buffer + offset, data_length);
 }
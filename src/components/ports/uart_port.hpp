@@ -6,12 +6,14 @@
 #ifndef S2E_COMPONENTS_PORTS_UART_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_UART_PORT_HPP_
 
-#include <utilities/ring_buffer.hpp>
+#include <utilities/spsc_ring_buffer.hpp>
 
 /**
  * @class UartPort
  * @brief Class to emulate UART communication port
  * @details The distinction of the area should be done where the upper port ID is assigned.
+ *          Each direction is a lock-free single-producer single-consumer ring buffer, so a real-time I/O thread can feed the component or
+ *          the OBC side directly. The data which does not fit in the buffer is dropped and counted as the overflow.
  */
 class UartPort {
  public:
@@ -71,11 +73,47 @@ class UartPort {
    */
   int ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
 
+  // Zero-copy access
+  /**
+   * @fn GetTxBuffer
+   * @brief Return the TX buffer (OBC -> Component) to write or read the data in place with the region functions of SpscRingBuffer
+   * @note The OBC side is the producer and the component side is the consumer.
+   */
+  inline SpscRingBuffer& GetTxBuffer() { return *tx_buffer_; }
+  /**
+   * @fn GetRxBuffer
+   * @brief Return the RX buffer (Component -> OBC) to write or read the data in place with the region functions of SpscRingBuffer
+   * @note The component side is the producer and the OBC side is the consumer.
+   */
+  inline SpscRingBuffer& GetRxBuffer() { return *rx_buffer_; }
+
+  // Getters
+  /**
+   * @fn GetTxOverflowBytes
+   * @brief Return total number of bytes dropped since the TX buffer was full
+   */
+  inline size_t GetTxOverflowBytes() const { return tx_buffer_->GetOverflowBytes(); }
+  /**
+   * @fn GetRxOverflowBytes
+   * @brief Return total number of bytes dropped since the RX buffer was full
+   */
+  inline size_t GetRxOverflowBytes() const { return rx_buffer_->GetOverflowBytes(); }
+  /**
+   * @fn GetTxHighWaterMarkBytes
+   * @brief Return maximum number of bytes stored in the TX buffer at the same time
+   */
+  inline size_t GetTxHighWaterMarkBytes() const { return tx_buffer_->GetHighWaterMarkBytes(); }
+  /**
+   * @fn GetRxHighWaterMarkBytes
+   * @brief Return maximum number of bytes stored in the RX buffer at the same time
+   */
+  inline size_t GetRxHighWaterMarkBytes() const { return rx_buffer_->GetHighWaterMarkBytes(); }
+
  private:
   const static unsigned int kDefaultBufferSize = 1024;  //!< Default buffer size
 
-  RingBuffer* rx_buffer_;  //!< Receive buffer (Component -> OBC)
-  RingBuffer* tx_buffer_;  //!< Transmit buffer (OBC-> Component)
+  SpscRingBuffer* rx_buffer_;  //!< Receive buffer (Component -> OBC)
+  SpscRingBuffer* tx_buffer_;  //!< Transmit buffer (OBC-> Component)
 };
 
 #endif  // S2E_COMPONENTS_PORTS_UART_PORT_HPP_
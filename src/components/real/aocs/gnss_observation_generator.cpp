@@ -0,0 +1,218 @@
+/**
+ * @file gnss_observation_generator.cpp
+ * @brief Class to generate the GNSS raw observations (pseudorange, carrier phase, and Doppler)
+ */
+
+#include "gnss_observation_generator.hpp"
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <iostream>
+#include <map>
+#include <math_physics/gnss/gnss_satellite_number.hpp>
+#include <math_physics/math/constants.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
+#include <utilities/macros.hpp>
+
+GnssObservationGenerator::GnssObservationGenerator(const GnssSatellites* gnss_satellites, const double code_noise_standard_deviation_m,
+                                                   const double carrier_phase_noise_standard_deviation_m, const double receiver_clock_offset_s,
+                                                   const double receiver_clock_drift_s_s)
+    : gnss_satellites_(gnss_satellites), receiver_clock_offset_s_(receiver_clock_offset_s), receiver_clock_drift_s_s_(receiver_clock_drift_s_s) {
+  code_noise_m_.SetParameters(0.0, code_noise_standard_deviation_m, global_randomization.MakeSeed());
+  carrier_phase_noise_m_.SetParameters(0.0, carrier_phase_noise_standard_deviation_m, global_randomization.MakeSeed());
+  ambiguity_cycle_.SetParameters(0.0, kAmbiguityStandardDeviation_cycle, global_randomization.MakeSeed());
+
+  const size_t number_of_satellites = gnss_satellites_->GetNumberOfCalculatedSatellite();
+  phase_center_offset_m_.assign(number_of_satellites, 0.0);
+  phase_center_variations_.assign(number_of_satellites, AntexPhaseCenterVariationGrid());
+  code_biases_m_.assign(number_of_satellites, 0.0);
+  ambiguities_cycle_.assign(number_of_satellites, 0.0);
+  last_tracked_epochs_.assign(number_of_satellites, 0);
+}
+
+void GnssObservationGenerator::SetSatelliteAntenna(const AntexFileReader& antex_file, const EpochTime time) {
+  size_t number_of_corrected_satellites = 0;
+  for (size_t gnss_satellite_id = 0; gnss_satellite_id < phase_center_offset_m_.size(); gnss_satellite_id++) {
+    const std::string satellite_number = gnss_satellites_->GetSatelliteNumber(gnss_satellite_id);
+    const size_t satellite_index = ConvertGnssSatelliteNumberToIndex(satellite_number);
+    if (!antex_file.IsAntexSatelliteDataAvailable(satellite_index)) continue;
+
+    // The antenna data valid at the time. The latest data does not have the end time.
+    for (const AntexSatelliteData& antex_data : antex_file.GetAntexSatelliteData(satellite_index)) {
+      if (time < EpochTime(antex_data.GetValidStartTime())) continue;
+      if (antex_data.GetValidEndTime().GetYear() > 0 && time >= EpochTime(antex_data.GetValidEndTime())) continue;
+      if (antex_data.GetNumberOfFrequency() == 0) continue;
+
+      // The first frequency of the system (e.g. G01) is used for the 1575.42 MHz carrier
+      size_t frequency_index = 0;
+      for (size_t i = 0; i < antex_data.GetNumberOfFrequency(); i++) {
+        if (antex_data.GetPhaseCenterData(i).GetFrequencyName() == satellite_number.substr(0, 1) + "01") {
+          frequency_index = i;
+          break;
+        }
+      }
+      const AntexPhaseCenterData& phase_center_data = antex_data.GetPhaseCenterData(frequency_index);
+      // The Z axis of the satellite antenna frame is the nadir direction
+      phase_center_offset_m_[gnss_satellite_id] = phase_center_data.GetPhaseCenterOffset_mm()[2] * 1e-3;
+      phase_center_variations_[gnss_satellite_id] = AntexPhaseCenterVariationGrid(phase_center_data);
+      number_of_corrected_satellites++;
+      break;
+    }
+  }
+  if (number_of_corrected_satellites == 0) {
+    std::cerr << "[WARNINGS] GNSS observation generator: no valid satellite antenna data is found in the ANTEX file." << std::endl;
+  }
+}
+
+void GnssObservationGenerator::SetCodeBias(const BiasSinexFileReader& bias_sinex_file) {
+  std::map<std::string, size_t> gnss_satellite_ids;
+  for (size_t gnss_satellite_id = 0; gnss_satellite_id < code_biases_m_.size(); gnss_satellite_id++) {
+    gnss_satellite_ids[gnss_satellites_->GetSatelliteNumber(gnss_satellite_id)] = gnss_satellite_id;
+  }
+
+  std::vector<double> dcb_p1p2_ns(code_biases_m_.size(), 0.0);
+  std::vector<double> dcb_p1c1_ns(code_biases_m_.size(), 0.0);
+  for (size_t i = 0; i < bias_sinex_file.GetNumberOfBiasData(); i++) {
+    BiasSolutionData bias_data = bias_sinex_file.GetBiasData(i);
+    if (bias_data.GetIdentifier() != BiasIdentifier::kDsb || bias_data.GetUnit() != BiasUnit::kNs) continue;
+    if (bias_data.GetStationName().find_first_not_of(' ') != std::string::npos) continue;  // Receiver biases
+    const auto found = gnss_satellite_ids.find(bias_data.GetSatelliteNumber());
+    if (found == gnss_satellite_ids.end()) continue;
+
+    if (bias_data.GetTargetSignal() == BiasTargetSignal::kP1P2) {
+      dcb_p1p2_ns[found->second] = bias_data.GetBias();
+    } else if (bias_data.GetTargetSignal() == BiasTargetSignal::kP1C1) {
+      dcb_p1c1_ns[found->second] = bias_data.GetBias();
+    }
+  }
+
+  const double f1_2 = kCarrierFrequency_Hz * kCarrierFrequency_Hz;
+  const double f2_2 = kSecondFrequency_Hz * kSecondFrequency_Hz;
+  const double ns_to_m = environment::speed_of_light_m_s * 1e-9;
+  for (size_t gnss_satellite_id = 0; gnss_satellite_id < code_biases_m_.size(); gnss_satellite_id++) {
+    const double p1_bias_ns = -f2_2 / (f1_2 - f2_2) * dcb_p1p2_ns[gnss_satellite_id];
+    code_biases_m_[gnss_satellite_id] = (p1_bias_ns - dcb_p1c1_ns[gnss_satellite_id]) * ns_to_m;
+  }
+}
+
+bool GnssObservationGenerator::OpenOutputFile(const std::string file_path, const bool is_compression_enabled) {
+  if (!output_file_.Open(file_path, is_compression_enabled)) {
+    std::cerr << "[WARNINGS] GNSS observation generator: the output file " << file_path << " cannot be opened." << std::endl;
+    return false;
+  }
+  output_file_.AppendHeaders("gps_time_week,gps_time_s,satellite,pseudorange_m,carrier_phase_cycle,doppler_Hz");
+  return true;
+}
+
+size_t GnssObservationGenerator::Generate(const EpochTime reception_time, const libra::Vector<3> receiver_position_ecef_m,
+                                          const libra::Vector<3> receiver_velocity_ecef_m_s, const std::vector<size_t>& gnss_satellite_ids) {
+  epoch_count_++;
+  if (is_first_observation_) {
+    first_reception_time_ = reception_time;
+    is_first_observation_ = false;
+  }
+
+  // Satellites in the state table
+  gnss_satellite_ids_.clear();
+  for (const size_t gnss_satellite_id : gnss_satellite_ids) {
+    if (gnss_satellite_id < last_tracked_epochs_.size() && gnss_satellites_->IsValidInStateTable(gnss_satellite_id)) {
+      gnss_satellite_ids_.push_back(gnss_satellite_id);
+    }
+  }
+  const size_t number_of_observations = gnss_satellite_ids_.size();
+  light_times_s_.assign(number_of_observations, kInitialLightTime_s);
+  transmission_times_s_.resize(number_of_observations);
+  pseudoranges_m_.resize(number_of_observations);
+  carrier_phases_cycle_.resize(number_of_observations);
+  dopplers_Hz_.resize(number_of_observations);
+
+  const double c_m_s = environment::speed_of_light_m_s;
+  const double earth_rotation_rad_s = environment::earth_mean_angular_velocity_rad_s;
+  const double reception_time_s = gnss_satellites_->GetStateTableTime_s(reception_time);
+  const double receiver_x_m = receiver_position_ecef_m[0];
+  const double receiver_y_m = receiver_position_ecef_m[1];
+  const double receiver_z_m = receiver_position_ecef_m[2];
+
+  // Light time iterations of all satellites together
+  double* RESTRICT light_times_s = light_times_s_.data();
+  double* RESTRICT transmission_times_s = transmission_times_s_.data();
+  for (size_t iteration = 0; iteration < kNumberOfLightTimeIterations; iteration++) {
+    for (size_t i = 0; i < number_of_observations; i++) transmission_times_s[i] = reception_time_s - light_times_s[i];
+    if (!gnss_satellites_->CalcStateArrayWithTable_ecef(gnss_satellite_ids_, transmission_times_s_, satellite_positions_m_, satellite_velocities_m_s_,
+                                                        satellite_clock_offsets_s_, satellite_clock_drifts_s_s_)) {
+      gnss_satellite_ids_.clear();
+      return 0;
+    }
+    const double* RESTRICT x_m = satellite_positions_m_[0].data();
+    const double* RESTRICT y_m = satellite_positions_m_[1].data();
+    const double* RESTRICT z_m = satellite_positions_m_[2].data();
+    for (size_t i = 0; i < number_of_observations; i++) {
+      // The ECEF frame rotates during the light time (Sagnac effect). The rotation angle is small enough for the second order expansion.
+      const double angle_rad = earth_rotation_rad_s * light_times_s[i];
+      const double cos_angle = 1.0 - 0.5 * angle_rad * angle_rad;
+      const double dx_m = cos_angle * x_m[i] + angle_rad * y_m[i] - receiver_x_m;
+      const double dy_m = cos_angle * y_m[i] - angle_rad * x_m[i] - receiver_y_m;
+      const double dz_m = z_m[i] - receiver_z_m;
+      light_times_s[i] = sqrt(dx_m * dx_m + dy_m * dy_m + dz_m * dz_m) / c_m_s;
+    }
+  }
+
+  // Observations
+  const double elapsed_time_s = (reception_time - first_reception_time_).GetTimeWithFraction_s();
+  const double receiver_clock_offset_s = receiver_clock_offset_s_ + receiver_clock_drift_s_s_ * elapsed_time_s;
+  const double wavelength_m = c_m_s / kCarrierFrequency_Hz;
+  for (size_t i = 0; i < number_of_observations; i++) {
+    const size_t gnss_satellite_id = gnss_satellite_ids_[i];
+    const double angle_rad = earth_rotation_rad_s * light_times_s[i];
+    const double cos_angle = 1.0 - 0.5 * angle_rad * angle_rad;
+    libra::Vector<3> satellite_position_m, satellite_velocity_m_s;
+    const double x_m = satellite_positions_m_[0][i], y_m = satellite_positions_m_[1][i];
+    const double vx_m_s = satellite_velocities_m_s_[0][i], vy_m_s = satellite_velocities_m_s_[1][i];
+    satellite_position_m[0] = cos_angle * x_m + angle_rad * y_m;
+    satellite_position_m[1] = cos_angle * y_m - angle_rad * x_m;
+    satellite_position_m[2] = satellite_positions_m_[2][i];
+    satellite_velocity_m_s[0] = cos_angle * vx_m_s + angle_rad * vy_m_s;
+    satellite_velocity_m_s[1] = cos_angle * vy_m_s - angle_rad * vx_m_s;
+    satellite_velocity_m_s[2] = satellite_velocities_m_s_[2][i];
+
+    const libra::Vector<3> line_of_sight_m = satellite_position_m - receiver_position_ecef_m;
+    const double range_m = line_of_sight_m.CalcNorm();
+    const double range_rate_m_s = InnerProduct(line_of_sight_m, satellite_velocity_m_s - receiver_velocity_ecef_m_s) / range_m;
+
+    // Periodic relativistic correction of the satellite clock
+    const double relativistic_correction_s = -2.0 * InnerProduct(satellite_position_m, satellite_velocity_m_s) / (c_m_s * c_m_s);
+    const double satellite_clock_offset_s = satellite_clock_offsets_s_[i] + relativistic_correction_s;
+
+    // Satellite antenna phase center at the nadir angle of the receiver
+    const double cos_nadir_angle = InnerProduct(satellite_position_m, line_of_sight_m) / (satellite_position_m.CalcNorm() * range_m);
+    const double nadir_angle_deg = acos(std::min(std::max(cos_nadir_angle, -1.0), 1.0)) * libra::rad_to_deg;
+    // The satellite yaw attitude is not modeled, so the azimuth is fixed to zero
+    const double antenna_correction_m = -phase_center_offset_m_[gnss_satellite_id] * cos_nadir_angle +
+                                        phase_center_variations_[gnss_satellite_id].CalcPhaseCenterVariation_mm(nadir_angle_deg) * 1e-3;
+
+    // A new ambiguity is set when the tracking is started
+    if (last_tracked_epochs_[gnss_satellite_id] == 0 || last_tracked_epochs_[gnss_satellite_id] + 1 != epoch_count_) {
+      ambiguities_cycle_[gnss_satellite_id] = std::round(ambiguity_cycle_);
+    }
+    last_tracked_epochs_[gnss_satellite_id] = epoch_count_;
+
+    const double geometric_range_m = range_m + antenna_correction_m + c_m_s * (receiver_clock_offset_s - satellite_clock_offset_s);
+    pseudoranges_m_[i] = geometric_range_m + code_biases_m_[gnss_satellite_id] + code_noise_m_;
+    carrier_phases_cycle_[i] = (geometric_range_m + carrier_phase_noise_m_) / wavelength_m + ambiguities_cycle_[gnss_satellite_id];
+    dopplers_Hz_[i] = -(range_rate_m_s + c_m_s * (receiver_clock_drift_s_s_ - satellite_clock_drifts_s_s_[i])) / wavelength_m;
+  }
+  return number_of_observations;
+}
+
+void GnssObservationGenerator::WriteObservations(const unsigned int gps_time_week, const double gps_time_s) {
+  if (!output_file_.IsOpened()) return;
+  for (size_t i = 0; i < gnss_satellite_ids_.size(); i++) {
+    output_file_.AppendDouble((double)gps_time_week);
+    output_file_.AppendDouble(gps_time_s);
+    output_file_.AppendString(gnss_satellites_->GetSatelliteNumber(gnss_satellite_ids_[i]));
+    output_file_.AppendDouble(pseudoranges_m_[i]);
+    output_file_.AppendDouble(carrier_phases_cycle_[i]);
+    output_file_.AppendDouble(dopplers_Hz_[i]);
+    output_file_.EndRow();
+  }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file gnss_observation_generator.hpp
+ * @brief Class to generate the GNSS raw observations (pseudorange, carrier phase, and Doppler)
+ */
+
+#ifndef S2E_COMPONENTS_REAL_AOCS_GNSS_OBSERVATION_GENERATOR_HPP_
+#define S2E_COMPONENTS_REAL_AOCS_GNSS_OBSERVATION_GENERATOR_HPP_
+
+#include <environment/global/gnss_satellites.hpp>
+#include <logger/binary_log_writer.hpp>
+#include <math_physics/gnss/antex_file_reader.hpp>
+#include <math_physics/gnss/antex_phase_center_variation_grid.hpp>
+#include <math_physics/gnss/bias_sinex_file_reader.hpp>
+#include <math_physics/math/vector.hpp>
+#include <math_physics/randomization/normal_randomization.hpp>
+#include <math_physics/time_system/epoch_time.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class GnssObservationGenerator
+ * @brief Class to generate the GNSS raw observations (pseudorange, carrier phase, and Doppler) on the 1575.42 MHz carrier
+ * @details The signal transmission times of all tracked satellites are solved together with a fixed number of light time iterations on
+ *          the structure of arrays buffers, and the satellite states are interpolated with the state table of GnssSatellites. The satellite
+ *          antenna corrections (ANTEX) and the code biases (Bias SINEX) are converted to per satellite tables when they are set, so that the
+ *          cost in each step is a few operations for each satellite.
+ * @note Only the satellite antenna is corrected: the phase center offset along the nadir direction and the azimuth independent phase center
+ *       variation at the nadir angle. The ionosphere and the troposphere are not modeled.
+ */
+class GnssObservationGenerator {
+ public:
+  /**
+   * @fn GnssObservationGenerator
+   * @brief Constructor
+   * @param [in] gnss_satellites: GNSS satellites information. The state table should be enabled.
+   * @param [in] code_noise_standard_deviation_m: Standard deviation of the white noise of the pseudorange [m]
+   * @param [in] carrier_phase_noise_standard_deviation_m: Standard deviation of the white noise of the carrier phase [m]
+   * @param [in] receiver_clock_offset_s: Receiver clock offset at the first observation [s]
+   * @param [in] receiver_clock_drift_s_s: Receiver clock drift [s/s]
+   */
+  GnssObservationGenerator(const GnssSatellites* gnss_satellites, const double code_noise_standard_deviation_m,
+                           const double carrier_phase_noise_standard_deviation_m, const double receiver_clock_offset_s,
+                           const double receiver_clock_drift_s_s);
+
+  /**
+   * @fn SetSatelliteAntenna
+   * @brief Set the satellite antenna corrections from the ANTEX file
+   * @note The antenna data valid at the time is used, and the satellites without the data are not corrected.
+   * @param [in] antex_file: ANTEX file
+   * @param [in] time: Time to select the valid antenna data
+   */
+  void SetSatelliteAntenna(const AntexFileReader& antex_file, const EpochTime time);
+  /**
+   * @fn SetCodeBias
+   * @brief Set the satellite code biases of C1 from the differential code biases (P1-P2 and P1-C1 in ns) of the Bias SINEX file
+   * @note The P1 bias is -f2^2 / (f1^2 - f2^2) * DCB(P1-P2) with the ionosphere-free satellite clocks, and the C1 bias is P1 bias - DCB(P1-C1).
+   * @param [in] bias_sinex_file: Bias SINEX file
+   */
+  void SetCodeBias(const BiasSinexFileReader& bias_sinex_file);
+  /**
+   * @fn OpenOutputFile
+   * @brief Open the binary log file to write the observations
+   * @param [in] file_path: Path to the binary log file
+   * @param [in] is_compression_enabled: Compress the file with gzip in chunks
+   * @return True when the file is opened successfully
+   */
+  bool OpenOutputFile(const std::string file_path, const bool is_compression_enabled = false);
+
+  /**
+   * @fn Generate
+   * @brief Generate the observations of the tracked satellites
+   * @param [in] reception_time: Signal reception time
+   * @param [in] receiver_position_ecef_m: Antenna position in the ECEF frame [m]
+   * @param [in] receiver_velocity_ecef_m_s: Antenna velocity in the ECEF frame [m/s]
+   * @param [in] gnss_satellite_ids: IDs of the tracked GNSS satellites
+   * @return Number of the generated observations. Zero when the state table does not cover the transmission times.
+   */
+  size_t Generate(const EpochTime reception_time, const libra::Vector<3> receiver_position_ecef_m, const libra::Vector<3> receiver_velocity_ecef_m_s,
+                  const std::vector<size_t>& gnss_satellite_ids);
+  /**
+   * @fn WriteObservations
+   * @brief Write the generated observations to the output file with one row for each satellite
+   * @param [in] gps_time_week: GPS time week part of the reception time
+   * @param [in] gps_time_s: GPS time second part of the reception time [s]
+   */
+  void WriteObservations(const unsigned int gps_time_week, const double gps_time_s);
+
+  // Getters
+  /**
+   * @fn GetNumberOfObservations
+   * @brief Return number of the generated observations
+   */
+  inline size_t GetNumberOfObservations() const { return gnss_satellite_ids_.size(); }
+  /**
+   * @fn GetGnssSatelliteId
+   * @brief Return ID of GNSS satellite of the observation
+   * @param [in] index: Index of the observation
+   */
+  inline size_t GetGnssSatelliteId(const size_t index) const { return gnss_satellite_ids_[index]; }
+  /**
+   * @fn GetPseudorange_m
+   * @brief Return pseudorange [m]
+   * @param [in] index: Index of the observation
+   */
+  inline double GetPseudorange_m(const size_t index) const { return pseudoranges_m_[index]; }
+  /**
+   * @fn GetCarrierPhase_cycle
+   * @brief Return carrier phase [cycle]
+   * @param [in] index: Index of the observation
+   */
+  inline double GetCarrierPhase_cycle(const size_t index) const { return carrier_phases_cycle_[index]; }
+  /**
+   * @fn GetDoppler_Hz
+   * @brief Return Doppler frequency [Hz]
+   * @param [in] index: Index of the observation
+   */
+  inline double GetDoppler_Hz(const size_t index) const { return dopplers_Hz_[index]; }
+
+ private:
+  static constexpr double kCarrierFrequency_Hz = 1575.42e6;         //!< Carrier frequency of GPS L1, Galileo E1, QZSS L1, and BeiDou B1C [Hz]
+  static constexpr double kSecondFrequency_Hz = 1227.60e6;          //!< Frequency of GPS L2 for the ionosphere-free combination [Hz]
+  static constexpr double kInitialLightTime_s = 0.075;              //!< Initial value of the light time iteration [s]
+  static constexpr double kAmbiguityStandardDeviation_cycle = 1e4;  //!< Standard deviation of the initial integer ambiguity [cycle]
+  static const size_t kNumberOfLightTimeIterations = 3;             //!< Number of the light time iterations (the error shrinks by v/c in each)
+
+  const GnssSatellites* gnss_satellites_;  //!< GNSS satellites information
+
+  // Noise and clock
+  libra::NormalRand code_noise_m_;           //!< White noise of the pseudorange [m]
+  libra::NormalRand carrier_phase_noise_m_;  //!< White noise of the carrier phase [m]
+  libra::NormalRand ambiguity_cycle_;        //!< Random value for the integer ambiguity [cycle]
+  double receiver_clock_offset_s_;           //!< Receiver clock offset at the first observation [s]
+  double receiver_clock_drift_s_s_;          //!< Receiver clock drift [s/s]
+  bool is_first_observation_ = true;         //!< Flag of the first observation
+  EpochTime first_reception_time_;           //!< Reception time of the first observation
+
+  // Per satellite tables indexed by ID of GNSS satellite
+  std::vector<double> phase_center_offset_m_;                           //!< Satellite antenna phase center offset along the nadir direction [m]
+  std::vector<AntexPhaseCenterVariationGrid> phase_center_variations_;  //!< Satellite antenna phase center variation map
+  std::vector<double> code_biases_m_;                                   //!< Satellite code bias of C1 [m]
+  std::vector<double> ambiguities_cycle_;                               //!< Integer ambiguity of the carrier phase [cycle]
+  std::vector<size_t> last_tracked_epochs_;                             //!< Epoch count when the satellite is tracked last time
+  size_t epoch_count_ = 0;                                              //!< Number of the generations
+
+  // Buffers of the tracked satellites in the structure of arrays layout
+  std::vector<size_t> gnss_satellite_ids_;           //!< IDs of the tracked GNSS satellites
+  std::vector<double> light_times_s_;                //!< Light time [s]
+  std::vector<double> transmission_times_s_;         //!< Signal transmission time in the state table time [s]
+  std::vector<double> satellite_positions_m_[3];     //!< Satellite positions at the ECEF frame at the transmission time [m]
+  std::vector<double> satellite_velocities_m_s_[3];  //!< Satellite velocities at the ECEF frame at the transmission time [m/s]
+  std::vector<double> satellite_clock_offsets_s_;    //!< Satellite clock offsets [s]
+  std::vector<double> satellite_clock_drifts_s_s_;   //!< Satellite clock drifts [s/s]
+  std::vector<double> pseudoranges_m_;               //!< Pseudorange [m]
+  std::vector<double> carrier_phases_cycle_;         //!< Carrier phase [cycle]
+  std::vector<double> dopplers_Hz_;                  //!< Doppler frequency [Hz]
+
+  BinaryLogWriter output_file_;  //!< Output file of the observations
+};
+
+#endif  // S2E_COMPONENTS_REAL_AOCS_GNSS_OBSERVATION_GENERATOR_HPP_
@@ -25,6 +25,7 @@ GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator,
       dynamics_(dynamics),
       gnss_satellites_(gnss_satellites),
       simulation_time_(simulation_time) {
+  if (dynamics_ != nullptr) frame_id_ = dynamics_->SetFrameChainCache().RegisterComponentFrame(quaternion_b2c_);
   for (size_t i = 0; i < 3; i++) {
     position_random_noise_ecef_m_[i].SetParameters(0.0, position_noise_standard_deviation_ecef_m[i], global_randomization.MakeSeed());
     velocity_random_noise_ecef_m_s_[i].SetParameters(0.0, velocity_noise_standard_deviation_ecef_m_s[i], global_randomization.MakeSeed());
@@ -45,6 +46,7 @@ GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator,
       dynamics_(dynamics),
       gnss_satellites_(gnss_satellites),
       simulation_time_(simulation_time) {
+  if (dynamics_ != nullptr) frame_id_ = dynamics_->SetFrameChainCache().RegisterComponentFrame(quaternion_b2c_);
   for (size_t i = 0; i < 3; i++) {
     position_random_noise_ecef_m_[i].SetParameters(0.0, position_noise_standard_deviation_ecef_m[i], global_randomization.MakeSeed());
     velocity_random_noise_ecef_m_s_[i].SetParameters(0.0, velocity_noise_standard_deviation_ecef_m_s[i], global_randomization.MakeSeed());
@@ -72,6 +74,26 @@ void GnssReceiver::MainRoutine(const int time_count) {
   // Time is updated with internal clock
   utc_ = simulation_time_->GetCurrentUtc();
   ConvertJulianDayToGpsTime(simulation_time_->GetCurrentTime_jd());
+
+  if (observation_generator_ != nullptr && antenna_model_ == AntennaModel::kCone) GenerateObservations(quaternion_i2b);
+}
+
+void GnssReceiver::SetObservationGenerator(std::unique_ptr<GnssObservationGenerator> observation_generator) {
+  observation_generator_ = std::move(observation_generator);
+}
+
+void GnssReceiver::GenerateObservations(const libra::Quaternion quaternion_i2b) {
+  tracked_gnss_satellite_ids_.clear();
+  for (const GnssInfo& gnss_info : gnss_information_list_) tracked_gnss_satellite_ids_.push_back(gnss_info.gnss_id);
+
+  // Antenna position in the ECEF frame
+  const libra::Matrix<3, 3>& dcm_eci_to_ecef = gnss_satellites_->GetEarthRotation().GetDcmJ2000ToEcef();
+  const libra::Vector<3> antenna_position_ecef_m =
+      dynamics_->GetOrbit().GetPosition_ecef_m() + dcm_eci_to_ecef * quaternion_i2b.InverseFrameConversion(antenna_position_b_m_);
+
+  observation_generator_->Generate(simulation_time_->GetCurrentEpochTime(), antenna_position_ecef_m, dynamics_->GetOrbit().GetVelocity_ecef_m_s(),
+                                   tracked_gnss_satellite_ids_);
+  observation_generator_->WriteObservations(gps_time_week_, gps_time_s_);
 }
 
 void GnssReceiver::CheckAntenna(const libra::Vector<3> position_true_eci_m, const libra::Quaternion quaternion_i2b) {
@@ -89,10 +111,11 @@ void GnssReceiver::CheckAntennaSimple(const libra::Vector<3> position_true_eci_m
   // GNSS satellites are visible when antenna directs anti-earth direction
 
   // Antenna normal vector at inertial frame
+  // The frame chain cache is composed with the attitude of the dynamics, which is the same as quaternion_i2b
+  UNUSED(quaternion_i2b);
   libra::Vector<3> antenna_direction_c(0.0);
   antenna_direction_c[2] = 1.0;
-  libra::Vector<3> antenna_direction_b = quaternion_b2c_.InverseFrameConversion(antenna_direction_c);
-  libra::Vector<3> antenna_direction_i = quaternion_i2b.InverseFrameConversion(antenna_direction_b);
+  libra::Vector<3> antenna_direction_i = dynamics_->GetFrameChainCache().ConvertComponentToInertial(frame_id_, antenna_direction_c);
 
   double inner = InnerProduct(position_true_eci_m, antenna_direction_i);
   if (inner <= 0.0) {
@@ -107,10 +130,10 @@ void GnssReceiver::CheckAntennaCone(const libra::Vector<3> position_true_eci_m,
   gnss_information_list_.clear();
 
   // Antenna pointing direction vector at inertial frame
+  const libra::Matrix<3, 3>& dcm_i2c = dynamics_->GetFrameChainCache().GetDcm_i2c(frame_id_);
   libra::Vector<3> antenna_pointing_direction_c(0.0);
   antenna_pointing_direction_c[2] = 1.0;
-  libra::Vector<3> antenna_pointing_direction_b = quaternion_b2c_.InverseFrameConversion(antenna_pointing_direction_c);
-  libra::Vector<3> antenna_pointing_direction_i = quaternion_i2b.InverseFrameConversion(antenna_pointing_direction_b);
+  libra::Vector<3> antenna_pointing_direction_i = dcm_i2c.Transpose() * antenna_pointing_direction_c;
 
   // Antenna position vector at inertial frame
   libra::Vector<3> antenna_position_i_m = position_true_eci_m + quaternion_i2b.InverseFrameConversion(antenna_position_b_m_);
@@ -118,40 +141,55 @@ void GnssReceiver::CheckAntennaCone(const libra::Vector<3> position_true_eci_m,
   // initialize
   visible_satellite_number_ = 0;
 
-  size_t number_of_calculated_gnss_satellites = gnss_satellites_->GetNumberOfCalculatedSatellite();
-
+  // GNSS satellite positions at inertial frame in the structure of arrays layout. The buffers are reused between the updates.
+  gnss_satellites_->CalcPositionArray_eci_m(gnss_satellite_positions_i_m_);
+  const size_t number_of_calculated_gnss_satellites = gnss_satellite_positions_i_m_[0].size();
+  if (visibility_flags_.size() != number_of_calculated_gnss_satellites) visibility_flags_.resize(number_of_calculated_gnss_satellites);
+  if (gnss_information_list_.capacity() < number_of_calculated_gnss_satellites) gnss_information_list_.reserve(number_of_calculated_gnss_satellites);
+
+  // The angle conditions are compared with the cosine values to avoid asin and acos for each satellite
+  const double antenna_radius_m = antenna_position_i_m.CalcNorm();
+  const double earth_radius_ratio = environment::earth_equatorial_radius_m / antenna_radius_m;
+  // Cosine of the angle between the Earth center and the Earth edge. NaN when the antenna is inside the Earth, and then the Earth blocks all.
+  const double cos_earth_edge_angle = sqrt(1.0 - earth_radius_ratio * earth_radius_ratio);
+  const double cos_half_width = cos(half_width_deg_ * libra::deg_to_rad);
+
+  const double* x_m = gnss_satellite_positions_i_m_[0].data();
+  const double* y_m = gnss_satellite_positions_i_m_[1].data();
+  const double* z_m = gnss_satellite_positions_i_m_[2].data();
+  const double antenna_x_m = antenna_position_i_m[0];
+  const double antenna_y_m = antenna_position_i_m[1];
+  const double antenna_z_m = antenna_position_i_m[2];
+  const double pointing_x = antenna_pointing_direction_i[0];
+  const double pointing_y = antenna_pointing_direction_i[1];
+  const double pointing_z = antenna_pointing_direction_i[2];
+  unsigned char* visibility_flags = visibility_flags_.data();
   for (size_t i = 0; i < number_of_calculated_gnss_satellites; i++) {
-    // compute direction from sat to gnss in body-fixed frame
-    libra::Vector<3> gnss_satellite_position_i_m = gnss_satellites_->GetPosition_eci_m(i);
-    libra::Vector<3> antenna_to_gnss_satellite_i_m = gnss_satellite_position_i_m - antenna_position_i_m;
-    libra::Vector<3> antenna_to_gnss_satellite_direction_i = antenna_to_gnss_satellite_i_m.CalcNormalizedVector();
+    const double dx_m = x_m[i] - antenna_x_m;
+    const double dy_m = y_m[i] - antenna_y_m;
+    const double dz_m = z_m[i] - antenna_z_m;
+    const double distance_m = sqrt(dx_m * dx_m + dy_m * dy_m + dz_m * dz_m);
 
     // Check GNSS satellites are visible from the receiver(not care antenna direction)
-    bool is_gnss_satellite_visible_from_receiver = false;
-    double inner1 = InnerProduct(antenna_position_i_m, gnss_satellite_position_i_m);
-    if (inner1 > 0.0) {  // GNSS satellite and receiver are in the same hemisphere
-      is_gnss_satellite_visible_from_receiver = true;
-    } else {  // GNSS satellite is in the another hemisphere
-      double angle_bw_earth_center_and_edge_rad = asin(environment::earth_equatorial_radius_m / antenna_position_i_m.CalcNorm());
-      double angle_bw_earth_center_and_gnss_rad =
-          acos(InnerProduct(-antenna_position_i_m.CalcNormalizedVector(), antenna_to_gnss_satellite_direction_i));
-
-      if (angle_bw_earth_center_and_edge_rad < angle_bw_earth_center_and_gnss_rad) {
-        // There is no Earth between receiver and GNSS satellite
-        is_gnss_satellite_visible_from_receiver = true;
-      } else {
-        // There is Earth between receiver and GNSS satellite
-        is_gnss_satellite_visible_from_receiver = false;
-      }
-    }
+    // Visible when the GNSS satellite and the receiver are in the same hemisphere, or there is no Earth between them
+    const bool is_same_hemisphere = antenna_x_m * x_m[i] + antenna_y_m * y_m[i] + antenna_z_m * z_m[i] > 0.0;
+    const double cos_earth_center_angle = -(antenna_x_m * dx_m + antenna_y_m * dy_m + antenna_z_m * dz_m) / (antenna_radius_m * distance_m);
+    const bool is_visible_from_receiver = is_same_hemisphere || cos_earth_center_angle < cos_earth_edge_angle;
 
     // Check GNSS satellites are in the antenna half width angle
-    double inner2 = InnerProduct(antenna_pointing_direction_i, antenna_to_gnss_satellite_direction_i);
-    if (inner2 > cos(half_width_deg_ * libra::deg_to_rad) && is_gnss_satellite_visible_from_receiver) {
-      // is visible
-      visible_satellite_number_++;
-      SetGnssInfo(antenna_to_gnss_satellite_i_m, quaternion_i2b, i);
-    }
+    const double cos_pointing_angle = (pointing_x * dx_m + pointing_y * dy_m + pointing_z * dz_m) / distance_m;
+    visibility_flags[i] = (cos_pointing_angle > cos_half_width && is_visible_from_receiver) ? 1 : 0;
+  }
+
+  for (size_t i = 0; i < number_of_calculated_gnss_satellites; i++) {
+    if (!visibility_flags[i]) continue;
+    // is visible
+    visible_satellite_number_++;
+    libra::Vector<3> antenna_to_gnss_satellite_i_m;
+    antenna_to_gnss_satellite_i_m[0] = x_m[i] - antenna_x_m;
+    antenna_to_gnss_satellite_i_m[1] = y_m[i] - antenna_y_m;
+    antenna_to_gnss_satellite_i_m[2] = z_m[i] - antenna_z_m;
+    SetGnssInfo(antenna_to_gnss_satellite_i_m, dcm_i2c, i);
   }
 
   if (visible_satellite_number_ >= 4) {
@@ -161,10 +199,9 @@ void GnssReceiver::CheckAntennaCone(const libra::Vector<3> position_true_eci_m,
   }
 }
 
-void GnssReceiver::SetGnssInfo(const libra::Vector<3> antenna_to_satellite_i_m, const libra::Quaternion quaternion_i2b,
+void GnssReceiver::SetGnssInfo(const libra::Vector<3> antenna_to_satellite_i_m, const libra::Matrix<3, 3>& dcm_i2c,
                                const std::size_t gnss_system_id) {
-  libra::Vector<3> antenna_to_satellite_direction_b = quaternion_i2b.FrameConversion(antenna_to_satellite_i_m);
-  libra::Vector<3> antenna_to_satellite_direction_c = quaternion_b2c_.FrameConversion(antenna_to_satellite_direction_b);
+  libra::Vector<3> antenna_to_satellite_direction_c = dcm_i2c * antenna_to_satellite_i_m;
 
   double distance_m = antenna_to_satellite_i_m.CalcNorm();
   double longitude_rad = AcTan(antenna_to_satellite_direction_c[1], antenna_to_satellite_direction_c[0]);
@@ -257,6 +294,14 @@ typedef struct _gnss_receiver_param {
   double half_width_deg;
   libra::Vector<3> position_noise_standard_deviation_ecef_m;
   libra::Vector<3> velocity_noise_standard_deviation_ecef_m_s;
+  bool is_observation_generation_enabled;
+  std::string observation_file_path;
+  std::string antex_file_path;
+  std::string bias_sinex_file_path;
+  double code_noise_standard_deviation_m;
+  double carrier_phase_noise_standard_deviation_m;
+  double receiver_clock_offset_s;
+  double receiver_clock_drift_s_s;
 } GnssReceiverParam;
 
 GnssReceiverParam ReadGnssReceiverIni(const std::string file_name, const GnssSatellites* gnss_satellites, const size_t component_id) {
@@ -286,21 +331,61 @@ GnssReceiverParam ReadGnssReceiverIni(const std::string file_name, const GnssSat
   gnssr_conf.ReadVector(GSection, "white_noise_standard_deviation_position_ecef_m", gnss_receiver_param.position_noise_standard_deviation_ecef_m);
   gnssr_conf.ReadVector(GSection, "white_noise_standard_deviation_velocity_ecef_m_s", gnss_receiver_param.velocity_noise_standard_deviation_ecef_m_s);
 
+  // Raw observation generation
+  gnss_receiver_param.is_observation_generation_enabled = gnssr_conf.ReadEnable(GSection, "observation_generation");
+  gnss_receiver_param.observation_file_path = gnssr_conf.ReadString(GSection, "observation_file");
+  gnss_receiver_param.antex_file_path = gnssr_conf.ReadString(GSection, "antex_file");
+  gnss_receiver_param.bias_sinex_file_path = gnssr_conf.ReadString(GSection, "bias_sinex_file");
+  gnss_receiver_param.code_noise_standard_deviation_m = gnssr_conf.ReadDouble(GSection, "code_noise_standard_deviation_m");
+  gnss_receiver_param.carrier_phase_noise_standard_deviation_m = gnssr_conf.ReadDouble(GSection, "carrier_phase_noise_standard_deviation_m");
+  gnss_receiver_param.receiver_clock_offset_s = gnssr_conf.ReadDouble(GSection, "receiver_clock_offset_s");
+  gnss_receiver_param.receiver_clock_drift_s_s = gnssr_conf.ReadDouble(GSection, "receiver_clock_drift_s_s");
+  if (gnss_receiver_param.is_observation_generation_enabled) {
+    if (gnss_receiver_param.antenna_model != AntennaModel::kCone || !gnss_satellites->IsStateTableEnabled()) {
+      std::cout << "[WARNINGS] The raw observation generation of GnssReceiver needs the CONE antenna model and the state table of GNSS SATELLITES, "
+                   "so the generation is automatically disabled."
+                << std::endl;
+      gnss_receiver_param.is_observation_generation_enabled = false;
+    }
+  }
+
   return gnss_receiver_param;
 }
 
+std::unique_ptr<GnssObservationGenerator> InitGnssObservationGenerator(const GnssReceiverParam& gnss_receiver_param,
+                                                                       const GnssSatellites* gnss_satellites, const SimulationTime* simulation_time) {
+  if (!gnss_receiver_param.is_observation_generation_enabled) return nullptr;
+
+  std::unique_ptr<GnssObservationGenerator> observation_generator(new GnssObservationGenerator(
+      gnss_satellites, gnss_receiver_param.code_noise_standard_deviation_m, gnss_receiver_param.carrier_phase_noise_standard_deviation_m,
+      gnss_receiver_param.receiver_clock_offset_s, gnss_receiver_param.receiver_clock_drift_s_s));
+  if (gnss_receiver_param.antex_file_path != "NULL") {
+    AntexFileReader antex_file(gnss_receiver_param.antex_file_path);
+    if (antex_file.GetFileReadSuccessFlag()) observation_generator->SetSatelliteAntenna(antex_file, simulation_time->GetCurrentEpochTime());
+  }
+  if (gnss_receiver_param.bias_sinex_file_path != "NULL") {
+    BiasSinexFileReader bias_sinex_file(gnss_receiver_param.bias_sinex_file_path);
+    if (bias_sinex_file.GetFileReadSuccessFlag()) observation_generator->SetCodeBias(bias_sinex_file);
+  }
+  observation_generator->OpenOutputFile(gnss_receiver_param.observation_file_path + ".s2elog");
+  return observation_generator;
+}
+
 GnssReceiver InitGnssReceiver(ClockGenerator* clock_generator, const size_t component_id, const std::string file_name, const Dynamics* dynamics,
                               const GnssSatellites* gnss_satellites, const SimulationTime* simulation_time) {
+  GlobalRandomization::StreamScope stream_scope("GNSS_RECEIVER_" + std::to_string(static_cast<long long>(component_id)));
   GnssReceiverParam gr_param = ReadGnssReceiverIni(file_name, gnss_satellites, component_id);
 
   GnssReceiver gnss_r(gr_param.prescaler, clock_generator, component_id, gr_param.antenna_model, gr_param.antenna_pos_b, gr_param.quaternion_b2c,
                       gr_param.half_width_deg, gr_param.position_noise_standard_deviation_ecef_m, gr_param.velocity_noise_standard_deviation_ecef_m_s,
                       dynamics, gnss_satellites, simulation_time);
+  gnss_r.SetObservationGenerator(InitGnssObservationGenerator(gr_param, gnss_satellites, simulation_time));
   return gnss_r;
 }
 
 GnssReceiver InitGnssReceiver(ClockGenerator* clock_generator, PowerPort* power_port, const size_t component_id, const std::string file_name,
                               const Dynamics* dynamics, const GnssSatellites* gnss_satellites, const SimulationTime* simulation_time) {
+  GlobalRandomization::StreamScope stream_scope("GNSS_RECEIVER_" + std::to_string(static_cast<long long>(component_id)));
   GnssReceiverParam gr_param = ReadGnssReceiverIni(file_name, gnss_satellites, component_id);
 
   // PowerPort
@@ -309,5 +394,6 @@ GnssReceiver InitGnssReceiver(ClockGenerator* clock_generator, PowerPort* power_
   GnssReceiver gnss_r(gr_param.prescaler, clock_generator, power_port, component_id, gr_param.antenna_model, gr_param.antenna_pos_b,
                       gr_param.quaternion_b2c, gr_param.half_width_deg, gr_param.position_noise_standard_deviation_ecef_m,
                       gr_param.velocity_noise_standard_deviation_ecef_m_s, dynamics, gnss_satellites, simulation_time);
+  gnss_r.SetObservationGenerator(InitGnssObservationGenerator(gr_param, gnss_satellites, simulation_time));
   return gnss_r;
 }
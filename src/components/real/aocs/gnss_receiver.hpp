@@ -13,8 +13,10 @@
 #include <math_physics/geodesy/geodetic_position.hpp>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/randomization/normal_randomization.hpp>
+#include <memory>
 
 #include "../../base/component.hpp"
+#include "gnss_observation_generator.hpp"
 
 /**
  * @enum AntennaModel
@@ -113,6 +115,20 @@ class GnssReceiver : public Component, public ILoggable {
    * @brief Return Observed velocity in the ECEF frame [m/s]
    */
   inline const libra::Vector<3> GetMeasuredVelocity_ecef_m_s(void) const { return velocity_ecef_m_s_; }
+  /**
+   * @fn GetObservationGenerator
+   * @brief Return the generator of the raw observations. nullptr when the observation generation is disabled.
+   */
+  inline const GnssObservationGenerator* GetObservationGenerator(void) const { return observation_generator_.get(); }
+
+  // Setter
+  /**
+   * @fn SetObservationGenerator
+   * @brief Enable the generation of the raw observations of the visible satellites
+   * @note The observations are generated only with the cone antenna model.
+   * @param [in] observation_generator: Generator of the raw observations
+   */
+  void SetObservationGenerator(std::unique_ptr<GnssObservationGenerator> observation_generator);
 
   // Override ILoggable
   /**
@@ -149,12 +165,19 @@ class GnssReceiver : public Component, public ILoggable {
   double gps_time_s_ = 0.0;            //!< Observed GPS time second part
 
   // Satellite visibility
-  bool is_gnss_visible_ = false;                 //!< Flag for GNSS satellite is visible or not
-  size_t visible_satellite_number_ = 0;          //!< Number of visible GNSS satellites
-  std::vector<GnssInfo> gnss_information_list_;  //!< Information List of visible GNSS satellites
+  bool is_gnss_visible_ = false;                         //!< Flag for GNSS satellite is visible or not
+  size_t visible_satellite_number_ = 0;                  //!< Number of visible GNSS satellites
+  std::vector<GnssInfo> gnss_information_list_;          //!< Information List of visible GNSS satellites
+  std::vector<double> gnss_satellite_positions_i_m_[3];  //!< Buffer of the GNSS satellite positions at the inertial frame for each axis [m]
+  std::vector<unsigned char> visibility_flags_;          //!< Buffer of the visibility flag of each GNSS satellite
+
+  // Raw observation
+  std::unique_ptr<GnssObservationGenerator> observation_generator_;  //!< Generator of the raw observations (nullptr when disabled)
+  std::vector<size_t> tracked_gnss_satellite_ids_;                   //!< Buffer of IDs of the visible GNSS satellites
 
   // References
   const Dynamics* dynamics_;               //!< Dynamics of spacecraft
+  size_t frame_id_ = 0;                    //!< ID of the component frame in the frame chain cache of the dynamics
   const GnssSatellites* gnss_satellites_;  //!< Information of GNSS satellites
   const SimulationTime* simulation_time_;  //!< Simulation time
 
@@ -187,10 +210,10 @@ class GnssReceiver : public Component, public ILoggable {
    * @fn SetGnssInfo
    * @brief Calculate and set the GnssInfo values of target GNSS satellite
    * @param [in] antenna_to_satellite_i_m: Position vector from the antenna to the GNSS satellites in the ECI frame
-   * @param [in] quaternion_i2b: True attitude of the spacecraft expressed by quaternion from the inertial frame to the body-fixed frame
+   * @param [in] dcm_i2c: DCM from the inertial frame to the component frame at the true attitude
    * @param [in] gnss_system_id: ID of target GNSS satellite
    */
-  void SetGnssInfo(const libra::Vector<3> antenna_to_satellite_i_m, const libra::Quaternion quaternion_i2b, const size_t gnss_system_id);
+  void SetGnssInfo(const libra::Vector<3> antenna_to_satellite_i_m, const libra::Matrix<3, 3>& dcm_i2c, const size_t gnss_system_id);
   /**
    * @fn AddNoise
    * @brief Substitutional method for "Measure" in other sensor models inherited Sensor class
@@ -198,6 +221,12 @@ class GnssReceiver : public Component, public ILoggable {
    * @param [in] velocity_true_ecef_m_s: True velocity of the spacecraft in the ECEF frame [m/s]
    */
   void AddNoise(const libra::Vector<3> position_true_ecef_m, const libra::Vector<3> velocity_true_ecef_m_s);
+  /**
+   * @fn GenerateObservations
+   * @brief Generate and write the raw observations of the visible satellites
+   * @param [in] quaternion_i2b: True attitude of the spacecraft expressed by quaternion from the inertial frame to the body-fixed frame
+   */
+  void GenerateObservations(const libra::Quaternion quaternion_i2b);
   /**
    * @fn ConvertJulianDayToGpsTime
    * @brief Convert Julian day to GPS time
@@ -5,11 +5,14 @@
 
 #include "gyro_sensor.hpp"
 
+#include <math_physics/randomization/global_randomization.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
 
 GyroSensor::GyroSensor(const int prescaler, ClockGenerator* clock_generator, Sensor& sensor_base, const unsigned int sensor_id,
                        const libra::Quaternion& quaternion_b2c, const Dynamics* dynamics)
-    : Component(prescaler, clock_generator), Sensor(sensor_base), sensor_id_(sensor_id), quaternion_b2c_(quaternion_b2c), dynamics_(dynamics) {}
+    : Component(prescaler, clock_generator), Sensor(sensor_base), sensor_id_(sensor_id), quaternion_b2c_(quaternion_b2c), dynamics_(dynamics) {
+  if (dynamics_ != nullptr) frame_id_ = dynamics_->SetFrameChainCache().RegisterComponentFrame(quaternion_b2c_);
+}
 
 GyroSensor::GyroSensor(const int prescaler, ClockGenerator* clock_generator, PowerPort* power_port, Sensor& sensor_base, const unsigned int sensor_id,
                        const libra::Quaternion& quaternion_b2c, const Dynamics* dynamics)
@@ -17,15 +20,18 @@ GyroSensor::GyroSensor(const int prescaler, ClockGenerator* clock_generator, Pow
       Sensor(sensor_base),
       sensor_id_(sensor_id),
       quaternion_b2c_(quaternion_b2c),
-      dynamics_(dynamics) {}
+      dynamics_(dynamics) {
+  if (dynamics_ != nullptr) frame_id_ = dynamics_->SetFrameChainCache().RegisterComponentFrame(quaternion_b2c_);
+}
 
 GyroSensor::~GyroSensor() {}
 
 void GyroSensor::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
-  angular_velocity_c_rad_s_ = quaternion_b2c_.FrameConversion(dynamics_->GetAttitude().GetAngularVelocity_b_rad_s());  // Convert frame
-  angular_velocity_c_rad_s_ = Measure(angular_velocity_c_rad_s_);                                                      // Add noises
+  const libra::Vector<3> angular_velocity_b_rad_s = dynamics_->GetAttitude().GetAngularVelocity_b_rad_s();
+  angular_velocity_c_rad_s_ = dynamics_->GetFrameChainCache().ConvertBodyToComponent(frame_id_, angular_velocity_b_rad_s);  // Convert frame
+  angular_velocity_c_rad_s_ = Measure(angular_velocity_c_rad_s_);  // Add noises
 }
 
 std::string GyroSensor::GetLogHeader() const {
@@ -50,6 +56,7 @@ GyroSensor InitGyroSensor(ClockGenerator* clock_generator, int sensor_id, const
   IniAccess gyro_conf(file_name);
   const char* sensor_name = "GYRO_SENSOR_";
   const std::string section_name = sensor_name + std::to_string(static_cast<long long>(sensor_id));
+  GlobalRandomization::StreamScope stream_scope(section_name);
   const char* GSection = section_name.c_str();
 
   libra::Quaternion quaternion_b2c;
@@ -71,6 +78,7 @@ GyroSensor InitGyroSensor(ClockGenerator* clock_generator, PowerPort* power_port
   IniAccess gyro_conf(file_name);
   const char* sensor_name = "GYRO_SENSOR_";
   const std::string section_name = sensor_name + std::to_string(static_cast<long long>(sensor_id));
+  GlobalRandomization::StreamScope stream_scope(section_name);
   const char* GSection = section_name.c_str();
 
   libra::Quaternion quaternion_b2c;
@@ -88,3 +96,13 @@ GyroSensor InitGyroSensor(ClockGenerator* clock_generator, PowerPort* power_port
   GyroSensor gyro(prescaler, clock_generator, power_port, sensor_base, sensor_id, quaternion_b2c, dynamics);
   return gyro;
 }
+
+void GyroSensor::SaveSnapshot(SnapshotWriter& snapshot) const {
+  SaveNoiseSnapshot(snapshot);
+  snapshot.Write(angular_velocity_c_rad_s_);
+}
+
+void GyroSensor::LoadSnapshot(SnapshotReader& snapshot) {
+  LoadNoiseSnapshot(snapshot);
+  snapshot.Read(angular_velocity_c_rad_s_);
+}
@@ -58,6 +58,22 @@ class GyroSensor : public Component, public Sensor<kGyroDimension>, public ILogg
    * @brief Main routine for sensor observation
    */
   void MainRoutine(const int time_count) override;
+  /**
+   * @fn GetBatchTickFunction
+   * @brief Override GetBatchTickFunction function of ITickable to update the gyro sensors together
+   */
+  ITickable::BatchTickFunction GetBatchTickFunction() const override { return GetBatchTickFunctionOf<GyroSensor>(); }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Component
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const override;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Component
+   */
+  void LoadSnapshot(SnapshotReader& snapshot) override;
 
   // Override ILoggable
   /**
@@ -82,6 +98,7 @@ class GyroSensor : public Component, public Sensor<kGyroDimension>, public ILogg
       0.0};                     //!< Observed angular velocity of the component frame with respect to the inertial frame [rad/s]
   unsigned int sensor_id_ = 0;  //!< Sensor ID
   libra::Quaternion quaternion_b2c_{0.0, 0.0, 0.0, 1.0};  //!< Quaternion from body frame to component frame
+  size_t frame_id_ = 0;                                   //!< ID of the component frame in the frame chain cache of the dynamics
 
   const Dynamics* dynamics_;  //!< Dynamics information
 };
@@ -5,6 +5,7 @@
 #include "magnetometer.hpp"
 
 #include <math_physics/math/quaternion.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
 
 Magnetometer::Magnetometer(int prescaler, ClockGenerator* clock_generator, Sensor& sensor_base, const unsigned int sensor_id,
@@ -52,6 +53,7 @@ Magnetometer InitMagnetometer(ClockGenerator* clock_generator, int sensor_id, co
   IniAccess magsensor_conf(file_name);
   const char* sensor_name = "MAGNETOMETER_";
   const std::string section_name = sensor_name + std::to_string(static_cast<long long>(sensor_id));
+  GlobalRandomization::StreamScope stream_scope(section_name);
   const char* MSSection = section_name.c_str();
 
   int prescaler = magsensor_conf.ReadInt(MSSection, "prescaler");
@@ -73,6 +75,7 @@ Magnetometer InitMagnetometer(ClockGenerator* clock_generator, PowerPort* power_
   IniAccess magsensor_conf(file_name);
   const char* sensor_name = "MAGNETOMETER_";
   const std::string section_name = sensor_name + std::to_string(static_cast<long long>(sensor_id));
+  GlobalRandomization::StreamScope stream_scope(section_name);
   const char* MSSection = section_name.c_str();
 
   int prescaler = magsensor_conf.ReadInt(MSSection, "prescaler");
@@ -91,3 +94,13 @@ Magnetometer InitMagnetometer(ClockGenerator* clock_generator, PowerPort* power_
   Magnetometer magsensor(prescaler, clock_generator, power_port, sensor_base, sensor_id, quaternion_b2c, geomagnetic_field);
   return magsensor;
 }
+
+void Magnetometer::SaveSnapshot(SnapshotWriter& snapshot) const {
+  SaveNoiseSnapshot(snapshot);
+  snapshot.Write(magnetic_field_c_nT_);
+}
+
+void Magnetometer::LoadSnapshot(SnapshotReader& snapshot) {
+  LoadNoiseSnapshot(snapshot);
+  snapshot.Read(magnetic_field_c_nT_);
+}
@@ -58,6 +58,22 @@ class Magnetometer : public Component, public Sensor<kMagnetometerDimension>, pu
    * @brief Main routine for sensor observation
    */
   void MainRoutine(const int time_count) override;
+  /**
+   * @fn GetBatchTickFunction
+   * @brief Override GetBatchTickFunction function of ITickable to update the magnetometers together
+   */
+  ITickable::BatchTickFunction GetBatchTickFunction() const override { return GetBatchTickFunctionOf<Magnetometer>(); }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Component
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const override;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Component
+   */
+  void LoadSnapshot(SnapshotReader& snapshot) override;
 
   // Override ILoggable
   /**
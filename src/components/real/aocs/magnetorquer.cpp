@@ -203,3 +203,23 @@ Magnetorquer InitMagnetorquer(ClockGenerator* clock_generator, PowerPort* power_
                           random_walk_limit_c_Am2, normal_random_standard_deviation_c_Am2, geomagnetic_field);
   return magtorquer;
 }
+
+void Magnetorquer::SaveSnapshot(SnapshotWriter& snapshot) const {
+  random_walk_c_Am2_.SaveSnapshot(snapshot);
+  for (size_t i = 0; i < kMtqDimension; i++) {
+    snapshot.Write(random_noise_c_Am2_[i]);
+  }
+  snapshot.Write(output_magnetic_moment_c_Am2_);
+  snapshot.Write(output_magnetic_moment_b_Am2_);
+  snapshot.Write(torque_b_Nm_);
+}
+
+void Magnetorquer::LoadSnapshot(SnapshotReader& snapshot) {
+  random_walk_c_Am2_.LoadSnapshot(snapshot);
+  for (size_t i = 0; i < kMtqDimension; i++) {
+    snapshot.Read(random_noise_c_Am2_[i]);
+  }
+  snapshot.Read(output_magnetic_moment_c_Am2_);
+  snapshot.Read(output_magnetic_moment_b_Am2_);
+  snapshot.Read(torque_b_Nm_);
+}
@@ -84,6 +84,17 @@ class Magnetorquer : public Component, public ILoggable {
    */
   void PowerOffRoutine() override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Component
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const override;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Component
+   */
+  void LoadSnapshot(SnapshotReader& snapshot) override;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
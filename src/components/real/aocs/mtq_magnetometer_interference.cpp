@@ -28,24 +28,63 @@ MtqMagnetometerInterference::MtqMagnetometerInterference(const std::string file_
     }
     additional_bias_by_mtq_coefficients_.push_back(additional_bias_by_mtq_coefficients);
   }
+
+  // Pack the coefficients to the coupling matrix
+  const size_t number_of_columns = 3 * polynomial_degree_;
+  coupling_matrix_.assign(3 * number_of_columns, 0.0);
+  for (size_t degree = 1; degree <= polynomial_degree_; degree++) {
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        coupling_matrix_[i * number_of_columns + (degree - 1) * 3 + j] = additional_bias_by_mtq_coefficients_[degree - 1][i][j];
+      }
+    }
+  }
 }
 
 void MtqMagnetometerInterference::UpdateInterference(void) {
+  // The bias does not change while the MTQ output is the same (e.g., the MTQ is updated slower than the interference)
+  const libra::Vector<3> mtq_output_c_Am2 = magnetorquer_.GetOutputMagneticMoment_c_Am2();
+  if (is_previous_mtq_output_valid_ && mtq_output_c_Am2[0] == previous_mtq_output_c_Am2_[0] &&
+      mtq_output_c_Am2[1] == previous_mtq_output_c_Am2_[1] && mtq_output_c_Am2[2] == previous_mtq_output_c_Am2_[2]) {
+    return;
+  }
+
   // Subtract previous added bias to avoid double addition
   magnetometer_.AddConstantBiasNoise_c_nT(-1.0 * previous_added_bias_c_nT_);
 
   // Calculate bias
-  libra::Vector<3> additional_bias_c_nT{0.0};
-  libra::Vector<3> mtq_output_c_Am2 = magnetorquer_.GetOutputMagneticMoment_c_Am2();
-  for (size_t degree = 1; degree <= polynomial_degree_; degree++) {
-    libra::Vector<3> hadamard_mtq;
-    for (size_t axis = 0; axis < 3; axis++) {
-      hadamard_mtq[axis] = pow(mtq_output_c_Am2[axis], degree);
-    }
-    additional_bias_c_nT = additional_bias_c_nT + additional_bias_by_mtq_coefficients_[degree - 1] * hadamard_mtq;
-  }
+  libra::Vector<3> additional_bias_c_nT = CalcAdditionalBias_c_nT(mtq_output_c_Am2);
 
   // Add bias
   magnetometer_.AddConstantBiasNoise_c_nT(additional_bias_c_nT);
   previous_added_bias_c_nT_ = additional_bias_c_nT;
+  previous_mtq_output_c_Am2_ = mtq_output_c_Am2;
+  is_previous_mtq_output_valid_ = true;
+}
+
+libra::Vector<3> MtqMagnetometerInterference::CalcAdditionalBias_c_nT(const libra::Vector<3>& mtq_output_c_Am2) const {
+  libra::Vector<3> additional_bias_c_nT;
+  CalcAdditionalBias_c_nT(1, mtq_output_c_Am2, additional_bias_c_nT);
+  return additional_bias_c_nT;
+}
+
+void MtqMagnetometerInterference::CalcAdditionalBias_c_nT(const size_t number_of_moments, const double* mtq_outputs_c_Am2,
+                                                          double* additional_biases_c_nT) const {
+  const size_t number_of_columns = 3 * polynomial_degree_;
+  for (size_t n = 0; n < number_of_moments; n++) {
+    const double* mtq_output_c_Am2 = &mtq_outputs_c_Am2[3 * n];
+    double* additional_bias_c_nT = &additional_biases_c_nT[3 * n];
+    double powers[3] = {1.0, 1.0, 1.0};
+    for (size_t i = 0; i < 3; i++) additional_bias_c_nT[i] = 0.0;
+    for (size_t degree = 1; degree <= polynomial_degree_; degree++) {
+      // Hadamard power of the moment with the repeated multiplication
+      for (size_t axis = 0; axis < 3; axis++) powers[axis] *= mtq_output_c_Am2[axis];
+      // Product of the coupling matrix block and the power
+      const size_t column = (degree - 1) * 3;
+      for (size_t i = 0; i < 3; i++) {
+        const double* row = &coupling_matrix_[i * number_of_columns + column];
+        additional_bias_c_nT[i] += row[0] * powers[0] + row[1] * powers[1] + row[2] * powers[2];
+      }
+    }
+  }
 }
@@ -28,11 +28,45 @@ class MtqMagnetometerInterference {
    * @brief Update MTQ-Magnetometer interference
    */
   void UpdateInterference(void);
+  /**
+   * @fn CalcAdditionalBias_c_nT
+   * @brief Calculate the additional bias of the magnetometer with the coupling matrix
+   * @param [in] mtq_output_c_Am2: Output magnetic moment of the magnetorquer in the magnetorquer component frame [Am2]
+   * @return Additional bias in the magnetometer component frame [nT]
+   */
+  libra::Vector<3> CalcAdditionalBias_c_nT(const libra::Vector<3>& mtq_output_c_Am2) const;
+  /**
+   * @fn CalcAdditionalBias_c_nT
+   * @brief Calculate the additional biases for many magnetic moments at once (e.g., spacecraft sharing the same component layout)
+   * @param [in] number_of_moments: Number of magnetic moments
+   * @param [in] mtq_outputs_c_Am2: Magnetic moments stored as x, y, z of each moment [Am2]
+   * @param [out] additional_biases_c_nT: Additional biases stored as x, y, z of each moment [nT]
+   */
+  void CalcAdditionalBias_c_nT(const size_t number_of_moments, const double* mtq_outputs_c_Am2, double* additional_biases_c_nT) const;
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the previous added bias to the snapshot
+   * @note The bias of the magnetometer including the added bias is saved by the magnetometer
+   * @param [out] snapshot: Snapshot writer
+   */
+  inline void SaveSnapshot(SnapshotWriter& snapshot) const { snapshot.Write(previous_added_bias_c_nT_); }
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the previous added bias from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  inline void LoadSnapshot(SnapshotReader& snapshot) {
+    snapshot.Read(previous_added_bias_c_nT_);
+    is_previous_mtq_output_valid_ = false;
+  }
 
  protected:
   size_t polynomial_degree_;                                              //!< Polynomial degree
   std::vector<libra::Matrix<3, 3>> additional_bias_by_mtq_coefficients_;  //!< Polynomial coefficients of additional bias noise
-  libra::Vector<3> previous_added_bias_c_nT_{0.0};
+  std::vector<double> coupling_matrix_;                                   //!< Coupling matrix of all degrees (3 x 3 * degree, row-major)
+  libra::Vector<3> previous_added_bias_c_nT_{0.0};                        //!< Previous added bias [nT]
+  libra::Vector<3> previous_mtq_output_c_Am2_{0.0};                       //!< MTQ output used for the previous added bias [Am2]
+  bool is_previous_mtq_output_valid_ = false;                             //!< Flag to show the previous MTQ output is valid
 
   Magnetometer& magnetometer_;        //!< Magnetometer
   const Magnetorquer& magnetorquer_;  //!< Magnetorquer
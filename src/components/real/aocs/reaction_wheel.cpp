@@ -10,6 +10,7 @@
 #include <math_physics/math/vector.hpp>
 #include <random>
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
 
 ReactionWheel::ReactionWheel(const int prescaler, ClockGenerator* clock_generator, const int component_id, const double step_width_s,
                              const double rotor_inertia_kgm2, const double max_torque_Nm, const double max_velocity_rpm,
@@ -353,3 +354,40 @@ ReactionWheel InitReactionWheel(ClockGenerator* clock_generator, PowerPort* powe
 
   return rw;
 }
+
+void ReactionWheel::SaveSnapshot(SnapshotWriter& snapshot) const {
+  ode_angular_velocity_.SaveSnapshot(snapshot);
+  snapshot.Write(acceleration_delay_buffer_);
+  snapshot.Write(delayed_acceleration_rad_s2_.GetOutput());
+  snapshot.Write(drive_flag_);
+  snapshot.Write(target_acceleration_rad_s2_);
+  snapshot.Write(velocity_limit_rpm_);
+  snapshot.Write(generated_angular_acceleration_rad_s2_);
+  snapshot.Write(angular_velocity_rpm_);
+  snapshot.Write(angular_velocity_rad_s_);
+  snapshot.Write(output_torque_b_Nm_);
+  snapshot.Write(angular_momentum_b_Nms_);
+  rw_jitter_.SaveSnapshot(snapshot);
+}
+
+void ReactionWheel::LoadSnapshot(SnapshotReader& snapshot) {
+  ode_angular_velocity_.LoadSnapshot(snapshot);
+  const size_t buffer_size = acceleration_delay_buffer_.size();
+  snapshot.Read(acceleration_delay_buffer_);
+  if (acceleration_delay_buffer_.size() != buffer_size) {
+    throw std::invalid_argument("Snapshot is made with the different dead time of the reaction wheel.");
+  }
+  double delayed_acceleration_rad_s2;
+  snapshot.Read(delayed_acceleration_rad_s2);
+  delayed_acceleration_rad_s2_.SetOutput(delayed_acceleration_rad_s2);
+  snapshot.Read(drive_flag_);
+  snapshot.Read(target_acceleration_rad_s2_);
+  snapshot.Read(velocity_limit_rpm_);
+  ode_angular_velocity_.SetAngularVelocityLimit_rad_s(velocity_limit_rpm_ * libra::rpm_to_rad_s);
+  snapshot.Read(generated_angular_acceleration_rad_s2_);
+  snapshot.Read(angular_velocity_rpm_);
+  snapshot.Read(angular_velocity_rad_s_);
+  snapshot.Read(output_torque_b_Nm_);
+  snapshot.Read(angular_momentum_b_Nms_);
+  rw_jitter_.LoadSnapshot(snapshot);
+}
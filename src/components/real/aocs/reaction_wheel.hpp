@@ -91,6 +91,11 @@ class ReactionWheel : public Component, public ILoggable {
    * @brief Main routine to output torque of normal RW
    */
   void MainRoutine(const int time_count) override;
+  /**
+   * @fn GetBatchTickFunction
+   * @brief Override GetBatchTickFunction function of ITickable to update the reaction wheels together
+   */
+  ITickable::BatchTickFunction GetBatchTickFunction() const override { return GetBatchTickFunctionOf<ReactionWheel>(); }
   /**
    * @fn PowerOffRoutine
    * @brief Power off routine to stop actuation
@@ -102,6 +107,17 @@ class ReactionWheel : public Component, public ILoggable {
    */
   void FastUpdate() override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Component
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const override;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Component
+   */
+  void LoadSnapshot(SnapshotReader& snapshot) override;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -0,0 +1,137 @@
+/*
+ * @file reaction_wheel_cluster_ode.cpp
+ * @brief Fused propagation of the angular velocities of multiple reaction wheels with first-order lag and tabulated friction
+ */
+#include "reaction_wheel_cluster_ode.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utilities/macros.hpp>
+
+ReactionWheelClusterOde::ReactionWheelClusterOde(const double step_width_s, const size_t number_of_friction_samples)
+    : step_width_s_(step_width_s), number_of_friction_samples_(std::max(number_of_friction_samples, (size_t)2)) {}
+
+size_t ReactionWheelClusterOde::AddWheel(const double velocity_limit_rad_s, const double max_velocity_rad_s, const double time_constant_s,
+                                         const double dead_time_s, const std::vector<double>& friction_coefficients,
+                                         const double stop_limit_angular_velocity_rad_s, const double initial_angular_velocity_rad_s,
+                                         const bool drive_flag) {
+  angular_velocity_rad_s_.push_back(initial_angular_velocity_rad_s);
+  generated_angular_acceleration_rad_s2_.push_back(0.0);
+  lag_acceleration_rad_s2_.push_back(0.0);
+  delayed_acceleration_rad_s2_.push_back(0.0);
+  target_acceleration_rad_s2_.push_back(0.0);
+  drive_flag_.push_back(drive_flag ? 1.0 : 0.0);
+  velocity_limit_rad_s_.push_back(velocity_limit_rad_s);
+  stop_limit_angular_velocity_rad_s_.push_back(stop_limit_angular_velocity_rad_s);
+
+  // Same coefficients with FirstOrderLag
+  if (step_width_s_ + time_constant_s <= 0.0) {
+    lag_output_coefficient_.push_back(0.0);
+    lag_input_coefficient_.push_back(0.0);
+  } else {
+    lag_output_coefficient_.push_back(time_constant_s / (step_width_s_ + time_constant_s));
+    lag_input_coefficient_.push_back(step_width_s_ / (step_width_s_ + time_constant_s));
+  }
+
+  // Friction table. The last point is a guard for the interpolation, and the velocity over the maximum uses the value at the maximum.
+  const double table_range_rad_s = std::max(std::abs(max_velocity_rad_s), std::abs(initial_angular_velocity_rad_s));
+  const double friction_step_rad_s = table_range_rad_s / (double)(number_of_friction_samples_ - 1);
+  friction_table_offset_.push_back(friction_table_rad_s2_.size());
+  reciprocal_friction_step_s_rad_.push_back(friction_step_rad_s > 0.0 ? 1.0 / friction_step_rad_s : 0.0);
+  for (size_t i = 0; i < number_of_friction_samples_; i++) {
+    const double abs_angular_velocity_rad_s = friction_step_rad_s * (double)i;
+    double friction_rad_s2 = 0.0;
+    for (size_t order = friction_coefficients.size(); order > 0; order--) {
+      friction_rad_s2 = friction_rad_s2 * abs_angular_velocity_rad_s + friction_coefficients[order - 1];
+    }
+    friction_table_rad_s2_.push_back(friction_rad_s2);
+  }
+  friction_table_rad_s2_.push_back(friction_table_rad_s2_.back());
+
+  // Same length with ReactionWheel
+  const size_t delay_buffer_length = (size_t)std::floor(dead_time_s / step_width_s_) + 1;
+  delay_buffer_offset_.push_back(delay_buffer_rad_s2_.size());
+  delay_buffer_length_.push_back(delay_buffer_length);
+  delay_buffer_index_.push_back(0);
+  delay_buffer_rad_s2_.resize(delay_buffer_rad_s2_.size() + delay_buffer_length, 0.0);
+
+  return angular_velocity_rad_s_.size() - 1;
+}
+
+void ReactionWheelClusterOde::SetDriveFlag(const size_t index, const bool drive_flag) {
+  drive_flag_[index] = drive_flag ? 1.0 : 0.0;
+  if (drive_flag) return;
+  auto buffer_begin = delay_buffer_rad_s2_.begin() + delay_buffer_offset_[index];
+  std::fill(buffer_begin, buffer_begin + delay_buffer_length_[index], 0.0);
+}
+
+void ReactionWheelClusterOde::Update() {
+  const size_t number_of_wheels = GetNumberOfWheels();
+
+  // Dead time: the ring buffers have different lengths, so they are handled before the fused loop
+  for (size_t i = 0; i < number_of_wheels; i++) {
+    if (drive_flag_[i] == 0.0) {
+      delayed_acceleration_rad_s2_[i] = 0.0;
+      continue;
+    }
+    double& oldest_rad_s2 = delay_buffer_rad_s2_[delay_buffer_offset_[i] + delay_buffer_index_[i]];
+    delayed_acceleration_rad_s2_[i] = oldest_rad_s2;
+    oldest_rad_s2 = target_acceleration_rad_s2_[i];
+    delay_buffer_index_[i]++;
+    if (delay_buffer_index_[i] == delay_buffer_length_[i]) delay_buffer_index_[i] = 0;
+  }
+
+  double* RESTRICT omega_rad_s = angular_velocity_rad_s_.data();
+  double* RESTRICT generated_rad_s2 = generated_angular_acceleration_rad_s2_.data();
+  double* RESTRICT lag_rad_s2 = lag_acceleration_rad_s2_.data();
+  const double* RESTRICT delayed_rad_s2 = delayed_acceleration_rad_s2_.data();
+  const double* RESTRICT drive = drive_flag_.data();
+  const double* RESTRICT limit_rad_s = velocity_limit_rad_s_.data();
+  const double* RESTRICT stop_limit_rad_s = stop_limit_angular_velocity_rad_s_.data();
+  const double* RESTRICT c_out = lag_output_coefficient_.data();
+  const double* RESTRICT c_in = lag_input_coefficient_.data();
+  const double* RESTRICT friction_table_rad_s2 = friction_table_rad_s2_.data();
+  const double* RESTRICT reciprocal_friction_step_s_rad = reciprocal_friction_step_s_rad_.data();
+  const size_t* RESTRICT friction_table_offset = friction_table_offset_.data();
+  const double max_table_position = (double)(number_of_friction_samples_ - 1);
+  const double step_width_s = step_width_s_;
+  const double half_step_width_s = 0.5 * step_width_s_;
+  const double sixth_step_width_s = step_width_s_ / 6.0;
+  const double reciprocal_step_width_1_s = 1.0 / step_width_s_;
+
+  for (size_t i = 0; i < number_of_wheels; i++) {
+    const double omega_previous_rad_s = omega_rad_s[i];
+    const double abs_omega_rad_s = std::abs(omega_previous_rad_s);
+
+    // Motor: first-order lag only in the drive mode
+    lag_rad_s2[i] += drive[i] * ((c_out[i] - 1.0) * lag_rad_s2[i] + c_in[i] * delayed_rad_s2[i]);
+
+    // Coasting: tabulated friction against the rotation, and stop under the limit
+    const double position = std::min(abs_omega_rad_s * reciprocal_friction_step_s_rad[i], max_table_position);
+    const size_t table_index = friction_table_offset[i] + (size_t)position;
+    const double ratio = position - std::floor(position);
+    const double friction_rad_s2 =
+        friction_table_rad_s2[table_index] + ratio * (friction_table_rad_s2[table_index + 1] - friction_table_rad_s2[table_index]);
+    const double is_stopped = (1.0 - drive[i]) * (abs_omega_rad_s < stop_limit_rad_s[i] ? 1.0 : 0.0);
+    const double rotation_direction = omega_previous_rad_s > 0.0 ? -1.0 : 1.0;
+    const double coasting_rad_s2 = (1.0 - is_stopped) * rotation_direction * friction_rad_s2;
+    const double omega_rad_s_start = (1.0 - is_stopped) * omega_previous_rad_s;
+
+    // Angular velocity limit: ReactionWheelOde clears the acceleration when a Runge-Kutta stage state is over the limit, and the cleared
+    // acceleration is kept in the rest of the step. The stages are evaluated in the same order to keep the same result.
+    const double limit = limit_rad_s[i];
+    const double acceleration_rad_s2 = drive[i] * lag_rad_s2[i] + (1.0 - drive[i]) * coasting_rad_s2;
+    auto limited_acceleration_rad_s2 = [limit](const double stage_omega_rad_s, const double stage_acceleration_rad_s2) {
+      const bool is_over_limit = (stage_omega_rad_s > limit && stage_acceleration_rad_s2 > 0.0) ||
+                                 (stage_omega_rad_s < -1.0 * limit && stage_acceleration_rad_s2 < 0.0);
+      return is_over_limit ? 0.0 : stage_acceleration_rad_s2;
+    };
+    const double k1 = limited_acceleration_rad_s2(omega_rad_s_start, acceleration_rad_s2);
+    const double k2 = limited_acceleration_rad_s2(omega_rad_s_start + half_step_width_s * k1, k1);
+    const double k3 = limited_acceleration_rad_s2(omega_rad_s_start + half_step_width_s * k2, k2);
+    const double k4 = limited_acceleration_rad_s2(omega_rad_s_start + step_width_s * k3, k3);
+
+    omega_rad_s[i] = omega_rad_s_start + sixth_step_width_s * (k1 + 2.0 * (k2 + k3) + k4);
+    generated_rad_s2[i] = (omega_rad_s[i] - omega_previous_rad_s) * reciprocal_step_width_1_s;
+  }
+}
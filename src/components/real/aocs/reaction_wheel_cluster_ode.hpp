@@ -0,0 +1,139 @@
+/*
+ * @file reaction_wheel_cluster_ode.hpp
+ * @brief Fused propagation of the angular velocities of multiple reaction wheels with first-order lag and tabulated friction
+ */
+
+#ifndef S2E_COMPONENTS_REAL_AOCS_REACTION_WHEEL_CLUSTER_ODE_HPP_
+#define S2E_COMPONENTS_REAL_AOCS_REACTION_WHEEL_CLUSTER_ODE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * @class ReactionWheelClusterOde
+ * @brief Fused propagation of the angular velocities of multiple reaction wheels
+ * @details The wheel states are stored in the structure of arrays layout, and the first-order lag of the motor, the coasting friction, the
+ *          stop and velocity limits, and the integration of all wheels are calculated in a single branch-free loop. The acceleration is
+ *          constant in a step as ReactionWheelOde, so the Runge-Kutta stages reduce to the velocity limit checks. The coasting friction
+ *          polynomial is tabulated on a uniform grid of the absolute angular velocity at AddWheel.
+ * @note The InitReactionWheel configuration still makes independent ReactionWheel components, because each wheel has its own prescaler,
+ *       power port, and log. This class is the propagation kernel for user components which drive several wheels with a common step.
+ */
+class ReactionWheelClusterOde {
+ public:
+  /**
+   * @fn ReactionWheelClusterOde
+   * @brief Constructor
+   * @param [in] step_width_s: Step width of the propagation [sec]
+   * @param [in] number_of_friction_samples: Number of the grid points of the friction table
+   */
+  ReactionWheelClusterOde(const double step_width_s, const size_t number_of_friction_samples = 128);
+
+  /**
+   * @fn AddWheel
+   * @brief Add a wheel
+   * @param [in] velocity_limit_rad_s: Angular velocity limit [rad/s]
+   * @param [in] max_velocity_rad_s: Maximum angular velocity of the rotor used for the range of the friction table [rad/s]
+   * @param [in] time_constant_s: Time constant of the first-order lag of the motor [sec]
+   * @param [in] dead_time_s: Dead time of the motor [sec]
+   * @param [in] friction_coefficients: Polynomial coefficients of the coasting deceleration with the absolute angular velocity
+   * @param [in] stop_limit_angular_velocity_rad_s: Angular velocity to stop the rotation in the coasting [rad/s]
+   * @param [in] initial_angular_velocity_rad_s: Initial angular velocity [rad/s]
+   * @param [in] drive_flag: Initial drive flag (True: Drive, False: Coasting)
+   * @return Index of the added wheel
+   */
+  size_t AddWheel(const double velocity_limit_rad_s, const double max_velocity_rad_s, const double time_constant_s, const double dead_time_s,
+                  const std::vector<double>& friction_coefficients, const double stop_limit_angular_velocity_rad_s,
+                  const double initial_angular_velocity_rad_s = 0.0, const bool drive_flag = false);
+
+  /**
+   * @fn Update
+   * @brief Propagate the angular velocities of all wheels for one step
+   */
+  void Update();
+
+  // Setters
+  /**
+   * @fn SetTargetAcceleration_rad_s2
+   * @brief Set the target angular acceleration of the wheel before the dead time and the lag [rad/s2]
+   * @param [in] index: Index of the wheel
+   * @param [in] acceleration_rad_s2: Target angular acceleration [rad/s2]
+   */
+  inline void SetTargetAcceleration_rad_s2(const size_t index, const double acceleration_rad_s2) {
+    target_acceleration_rad_s2_[index] = acceleration_rad_s2;
+  }
+  /**
+   * @fn SetDriveFlag
+   * @brief Set the drive flag of the wheel. The dead time buffer is cleared in the coasting.
+   * @param [in] index: Index of the wheel
+   * @param [in] drive_flag: Drive flag (True: Drive, False: Coasting)
+   */
+  void SetDriveFlag(const size_t index, const bool drive_flag);
+  /**
+   * @fn SetAngularVelocityLimit_rad_s
+   * @brief Set the angular velocity limit of the wheel [rad/s]
+   * @param [in] index: Index of the wheel
+   * @param [in] velocity_limit_rad_s: Angular velocity limit [rad/s]
+   */
+  inline void SetAngularVelocityLimit_rad_s(const size_t index, const double velocity_limit_rad_s) {
+    velocity_limit_rad_s_[index] = velocity_limit_rad_s;
+  }
+
+  // Getters
+  /**
+   * @fn GetNumberOfWheels
+   * @brief Return number of wheels
+   */
+  inline size_t GetNumberOfWheels() const { return angular_velocity_rad_s_.size(); }
+  /**
+   * @fn GetAngularVelocity_rad_s
+   * @brief Return angular velocity of the wheel [rad/s]
+   * @param [in] index: Index of the wheel
+   */
+  inline double GetAngularVelocity_rad_s(const size_t index) const { return angular_velocity_rad_s_[index]; }
+  /**
+   * @fn GetGeneratedAngularAcceleration_rad_s2
+   * @brief Return angular acceleration of the wheel in the latest step [rad/s2]
+   * @param [in] index: Index of the wheel
+   */
+  inline double GetGeneratedAngularAcceleration_rad_s2(const size_t index) const { return generated_angular_acceleration_rad_s2_[index]; }
+  /**
+   * @fn GetAngularVelocities_rad_s
+   * @brief Return angular velocities of all wheels [rad/s]
+   */
+  inline const std::vector<double>& GetAngularVelocities_rad_s() const { return angular_velocity_rad_s_; }
+  /**
+   * @fn GetGeneratedAngularAccelerations_rad_s2
+   * @brief Return angular accelerations of all wheels in the latest step [rad/s2]
+   */
+  inline const std::vector<double>& GetGeneratedAngularAccelerations_rad_s2() const { return generated_angular_acceleration_rad_s2_; }
+
+ private:
+  const double step_width_s_;                //!< Step width of the propagation [sec]
+  const size_t number_of_friction_samples_;  //!< Number of the grid points of the friction table
+
+  // States and parameters of each wheel
+  std::vector<double> angular_velocity_rad_s_;                 //!< Angular velocity [rad/s]
+  std::vector<double> generated_angular_acceleration_rad_s2_;  //!< Angular acceleration in the latest step [rad/s2]
+  std::vector<double> lag_acceleration_rad_s2_;                //!< Output of the first-order lag [rad/s2]
+  std::vector<double> delayed_acceleration_rad_s2_;            //!< Target acceleration after the dead time [rad/s2]
+  std::vector<double> target_acceleration_rad_s2_;             //!< Target acceleration [rad/s2]
+  std::vector<double> drive_flag_;                             //!< Drive flag as the mask (1: Drive, 0: Coasting)
+  std::vector<double> velocity_limit_rad_s_;                   //!< Angular velocity limit [rad/s]
+  std::vector<double> stop_limit_angular_velocity_rad_s_;      //!< Angular velocity to stop the rotation [rad/s]
+  std::vector<double> lag_output_coefficient_;                 //!< Coefficient of the previous output in the first-order lag
+  std::vector<double> lag_input_coefficient_;                  //!< Coefficient of the input in the first-order lag
+
+  // Friction table
+  std::vector<double> friction_table_rad_s2_;           //!< Coasting deceleration on the grid of all wheels [rad/s2]
+  std::vector<double> reciprocal_friction_step_s_rad_;  //!< Reciprocal of the grid step of each wheel [s/rad]
+  std::vector<size_t> friction_table_offset_;           //!< Offset of the table of each wheel
+
+  // Dead time buffers
+  std::vector<double> delay_buffer_rad_s2_;  //!< Ring buffers of the target acceleration of all wheels [rad/s2]
+  std::vector<size_t> delay_buffer_offset_;  //!< Offset of the ring buffer of each wheel
+  std::vector<size_t> delay_buffer_length_;  //!< Length of the ring buffer of each wheel
+  std::vector<size_t> delay_buffer_index_;   //!< Index of the oldest element in the ring buffer of each wheel
+};
+
+#endif  // S2E_COMPONENTS_REAL_AOCS_REACTION_WHEEL_CLUSTER_ODE_HPP_
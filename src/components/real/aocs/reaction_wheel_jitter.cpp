@@ -5,8 +5,10 @@
 
 #include "reaction_wheel_jitter.hpp"
 
+#include <cmath>
 #include <math_physics/math/constants.hpp>
 #include <random>
+#include <stdexcept>
 #include <utilities/macros.hpp>
 
 ReactionWheelJitter::ReactionWheelJitter(std::vector<std::vector<double>> radial_force_harmonics_coefficients,
@@ -34,6 +36,7 @@ ReactionWheelJitter::ReactionWheelJitter(std::vector<std::vector<double>> radial
   for (size_t i = 0; i < radial_torque_harmonics_coefficients_.size(); i++) {
     jitter_torque_rotation_phase_.push_back(dist(engine));
   }
+  InitializeOscillators(0.0);
   // Calculate the coefficients of the difference equation when structural resonance is considered
   if (considers_structural_resonance_) {
     CalcCoefficients();
@@ -43,31 +46,37 @@ ReactionWheelJitter::ReactionWheelJitter(std::vector<std::vector<double>> radial
 ReactionWheelJitter::~ReactionWheelJitter() {}
 
 void ReactionWheelJitter::CalcJitter(double angular_velocity_rad) {
+  // The angular velocity is updated in the component update, so the rotations are reused in the fast updates between them
+  if (angular_velocity_rad != oscillator_angular_velocity_rad_s_) {
+    UpdateOscillatorRotations(angular_velocity_rad);
+  }
+  const double angular_velocity_squared_rad2_s2 = angular_velocity_rad * angular_velocity_rad;
+
   // Clear jitter in component frame
   unfiltered_jitter_force_n_c_ *= 0.0;
   unfiltered_jitter_torque_n_c_ *= 0.0;
 
   // Calculate harmonics force
+  AdvanceHarmonics(force_phase_cos_.size(), force_rotation_cos_.data(), force_rotation_sin_.data(), force_phase_cos_.data(),
+                   force_phase_sin_.data());
   for (size_t i = 0; i < jitter_force_rotation_phase_.size(); i++) {
     // Advance the phase of RW rotation
     jitter_force_rotation_phase_[i] += radial_force_harmonics_coefficients_[i][0] * angular_velocity_rad * update_interval_s_;
     // Add jitter force
-    unfiltered_jitter_force_n_c_[0] +=
-        radial_force_harmonics_coefficients_[i][1] * angular_velocity_rad * angular_velocity_rad * sin(jitter_force_rotation_phase_[i]);
-    unfiltered_jitter_force_n_c_[1] +=
-        radial_force_harmonics_coefficients_[i][1] * angular_velocity_rad * angular_velocity_rad * cos(jitter_force_rotation_phase_[i]);
+    unfiltered_jitter_force_n_c_[0] += radial_force_harmonics_coefficients_[i][1] * angular_velocity_squared_rad2_s2 * force_phase_sin_[i];
+    unfiltered_jitter_force_n_c_[1] += radial_force_harmonics_coefficients_[i][1] * angular_velocity_squared_rad2_s2 * force_phase_cos_[i];
     // jitter_force_c_[2] += 0.0;
   }
 
   // Calculate harmonics torque
+  AdvanceHarmonics(torque_phase_cos_.size(), torque_rotation_cos_.data(), torque_rotation_sin_.data(), torque_phase_cos_.data(),
+                   torque_phase_sin_.data());
   for (size_t i = 0; i < jitter_torque_rotation_phase_.size(); i++) {
     // Advance the phase of RW rotation
     jitter_torque_rotation_phase_[i] += radial_torque_harmonics_coefficients_[i][0] * angular_velocity_rad * update_interval_s_;
     // Add jitter torque
-    unfiltered_jitter_torque_n_c_[0] +=
-        radial_torque_harmonics_coefficients_[i][1] * angular_velocity_rad * angular_velocity_rad * sin(jitter_torque_rotation_phase_[i]);
-    unfiltered_jitter_torque_n_c_[1] +=
-        radial_torque_harmonics_coefficients_[i][1] * angular_velocity_rad * angular_velocity_rad * cos(jitter_torque_rotation_phase_[i]);
+    unfiltered_jitter_torque_n_c_[0] += radial_torque_harmonics_coefficients_[i][1] * angular_velocity_squared_rad2_s2 * torque_phase_sin_[i];
+    unfiltered_jitter_torque_n_c_[1] += radial_torque_harmonics_coefficients_[i][1] * angular_velocity_squared_rad2_s2 * torque_phase_cos_[i];
     // jitter_torque_c_[2] += 0.0;
   }
 
@@ -82,6 +91,52 @@ void ReactionWheelJitter::CalcJitter(double angular_velocity_rad) {
   }
 }
 
+void ReactionWheelJitter::AdvanceHarmonics(const size_t number_of_harmonics, const double* RESTRICT rotation_cos,
+                                           const double* RESTRICT rotation_sin, double* RESTRICT phase_cos, double* RESTRICT phase_sin) {
+  for (size_t i = 0; i < number_of_harmonics; i++) {
+    const double cos_next = phase_cos[i] * rotation_cos[i] - phase_sin[i] * rotation_sin[i];
+    const double sin_next = phase_sin[i] * rotation_cos[i] + phase_cos[i] * rotation_sin[i];
+    // First order approximation of 1 / sqrt(cos^2 + sin^2) around 1
+    const double normalization = 1.5 - 0.5 * (cos_next * cos_next + sin_next * sin_next);
+    phase_cos[i] = cos_next * normalization;
+    phase_sin[i] = sin_next * normalization;
+  }
+}
+
+void ReactionWheelJitter::InitializeOscillators(const double angular_velocity_rad) {
+  force_phase_cos_.resize(jitter_force_rotation_phase_.size());
+  force_phase_sin_.resize(jitter_force_rotation_phase_.size());
+  for (size_t i = 0; i < jitter_force_rotation_phase_.size(); i++) {
+    force_phase_cos_[i] = cos(jitter_force_rotation_phase_[i]);
+    force_phase_sin_[i] = sin(jitter_force_rotation_phase_[i]);
+  }
+  torque_phase_cos_.resize(jitter_torque_rotation_phase_.size());
+  torque_phase_sin_.resize(jitter_torque_rotation_phase_.size());
+  for (size_t i = 0; i < jitter_torque_rotation_phase_.size(); i++) {
+    torque_phase_cos_[i] = cos(jitter_torque_rotation_phase_[i]);
+    torque_phase_sin_[i] = sin(jitter_torque_rotation_phase_[i]);
+  }
+  UpdateOscillatorRotations(angular_velocity_rad);
+}
+
+void ReactionWheelJitter::UpdateOscillatorRotations(const double angular_velocity_rad) {
+  oscillator_angular_velocity_rad_s_ = angular_velocity_rad;
+  force_rotation_cos_.resize(radial_force_harmonics_coefficients_.size());
+  force_rotation_sin_.resize(radial_force_harmonics_coefficients_.size());
+  for (size_t i = 0; i < radial_force_harmonics_coefficients_.size(); i++) {
+    const double rotation_rad = radial_force_harmonics_coefficients_[i][0] * angular_velocity_rad * update_interval_s_;
+    force_rotation_cos_[i] = cos(rotation_rad);
+    force_rotation_sin_[i] = sin(rotation_rad);
+  }
+  torque_rotation_cos_.resize(radial_torque_harmonics_coefficients_.size());
+  torque_rotation_sin_.resize(radial_torque_harmonics_coefficients_.size());
+  for (size_t i = 0; i < radial_torque_harmonics_coefficients_.size(); i++) {
+    const double rotation_rad = radial_torque_harmonics_coefficients_[i][0] * angular_velocity_rad * update_interval_s_;
+    torque_rotation_cos_[i] = cos(rotation_rad);
+    torque_rotation_sin_[i] = sin(rotation_rad);
+  }
+}
+
 void ReactionWheelJitter::AddStructuralResonance() {
   // Solve difference equations
   for (int i = 0; i < 3; i++) {
@@ -126,3 +181,47 @@ void ReactionWheelJitter::CalcCoefficients() {
   coefficients_[5] = 4.0 - 4.0 * damping_factor_ * update_interval_s_ * structural_resonance_angular_frequency_Hz_ +
                      pow(update_interval_s_, 2.0) * pow(structural_resonance_angular_frequency_Hz_, 2.0);
 }
+
+void ReactionWheelJitter::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(jitter_force_rotation_phase_);
+  snapshot.Write(jitter_torque_rotation_phase_);
+  snapshot.Write(unfiltered_jitter_force_n_c_);
+  snapshot.Write(unfiltered_jitter_force_n_1_c_);
+  snapshot.Write(unfiltered_jitter_force_n_2_c_);
+  snapshot.Write(unfiltered_jitter_torque_n_c_);
+  snapshot.Write(unfiltered_jitter_torque_n_1_c_);
+  snapshot.Write(unfiltered_jitter_torque_n_2_c_);
+  snapshot.Write(filtered_jitter_force_n_c_);
+  snapshot.Write(filtered_jitter_force_n_1_c_);
+  snapshot.Write(filtered_jitter_force_n_2_c_);
+  snapshot.Write(filtered_jitter_torque_n_c_);
+  snapshot.Write(filtered_jitter_torque_n_1_c_);
+  snapshot.Write(filtered_jitter_torque_n_2_c_);
+  snapshot.Write(jitter_force_b_N_);
+  snapshot.Write(jitter_torque_b_Nm_);
+}
+
+void ReactionWheelJitter::LoadSnapshot(SnapshotReader& snapshot) {
+  const size_t force_harmonics_size = jitter_force_rotation_phase_.size();
+  const size_t torque_harmonics_size = jitter_torque_rotation_phase_.size();
+  snapshot.Read(jitter_force_rotation_phase_);
+  snapshot.Read(jitter_torque_rotation_phase_);
+  if (jitter_force_rotation_phase_.size() != force_harmonics_size || jitter_torque_rotation_phase_.size() != torque_harmonics_size) {
+    throw std::invalid_argument("Snapshot is made with the different harmonics of the reaction wheel jitter.");
+  }
+  InitializeOscillators(oscillator_angular_velocity_rad_s_);
+  snapshot.Read(unfiltered_jitter_force_n_c_);
+  snapshot.Read(unfiltered_jitter_force_n_1_c_);
+  snapshot.Read(unfiltered_jitter_force_n_2_c_);
+  snapshot.Read(unfiltered_jitter_torque_n_c_);
+  snapshot.Read(unfiltered_jitter_torque_n_1_c_);
+  snapshot.Read(unfiltered_jitter_torque_n_2_c_);
+  snapshot.Read(filtered_jitter_force_n_c_);
+  snapshot.Read(filtered_jitter_force_n_1_c_);
+  snapshot.Read(filtered_jitter_force_n_2_c_);
+  snapshot.Read(filtered_jitter_torque_n_c_);
+  snapshot.Read(filtered_jitter_torque_n_1_c_);
+  snapshot.Read(filtered_jitter_torque_n_2_c_);
+  snapshot.Read(jitter_force_b_N_);
+  snapshot.Read(jitter_torque_b_Nm_);
+}
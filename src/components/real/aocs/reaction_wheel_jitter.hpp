@@ -9,6 +9,7 @@
 #pragma once
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <utilities/snapshot.hpp>
 #include <vector>
 
 /*
@@ -50,6 +51,32 @@ class ReactionWheelJitter {
    * @param [in] angular_velocity_rad: Current angular velocity of RW [rad/s]
    */
   void CalcJitter(double angular_velocity_rad);
+  /**
+   * @fn AdvanceHarmonics
+   * @brief Advance the phases of harmonic oscillators by the complex rotation without trigonometric functions
+   * @details The phase of each harmonic is expressed by the unit complex number (cos, sin) and multiplied by the rotation per sample. The
+   *          amplitude is normalized by the first order correction at every sample to avoid the drift of the rounding error. The loop has no
+   *          branch, so the harmonics of several wheels can be concatenated in the arrays and advanced at once by the vectorized loop.
+   * @param [in] number_of_harmonics: Number of harmonics
+   * @param [in] rotation_cos: Cosine of the rotation angle per sample of each harmonic
+   * @param [in] rotation_sin: Sine of the rotation angle per sample of each harmonic
+   * @param [in/out] phase_cos: Cosine of the phase of each harmonic
+   * @param [in/out] phase_sin: Sine of the phase of each harmonic
+   */
+  static void AdvanceHarmonics(const size_t number_of_harmonics, const double* rotation_cos, const double* rotation_sin, double* phase_cos,
+                               double* phase_sin);
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the rotation phases and the states of the difference equations to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the rotation phases and the states of the difference equations from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
 
   /**
    * @fn GetJitterForce_b_N
@@ -93,6 +120,17 @@ class ReactionWheelJitter {
   std::vector<double> jitter_force_rotation_phase_;   //!< 2 * pi * h_i * Omega * t [rad]
   std::vector<double> jitter_torque_rotation_phase_;  //!< 2 * pi * h_i * Omega * t [rad]
 
+  // Harmonic oscillators for the recurrence calculation
+  double oscillator_angular_velocity_rad_s_ = 0.0;  //!< RW angular velocity used for the rotations per sample [rad/s]
+  std::vector<double> force_phase_cos_;             //!< Cosine of the rotation phase of each force harmonic
+  std::vector<double> force_phase_sin_;             //!< Sine of the rotation phase of each force harmonic
+  std::vector<double> force_rotation_cos_;          //!< Cosine of the rotation per sample of each force harmonic
+  std::vector<double> force_rotation_sin_;          //!< Sine of the rotation per sample of each force harmonic
+  std::vector<double> torque_phase_cos_;            //!< Cosine of the rotation phase of each torque harmonic
+  std::vector<double> torque_phase_sin_;            //!< Sine of the rotation phase of each torque harmonic
+  std::vector<double> torque_rotation_cos_;         //!< Cosine of the rotation per sample of each torque harmonic
+  std::vector<double> torque_rotation_sin_;         //!< Sine of the rotation per sample of each torque harmonic
+
   // Variables for solving difference equations in component frame
   libra::Vector<3> unfiltered_jitter_force_n_c_{0.0};
   libra::Vector<3> unfiltered_jitter_force_n_1_c_{0.0};
@@ -111,6 +149,18 @@ class ReactionWheelJitter {
   libra::Vector<3> jitter_force_b_N_{0.0};    //!< Generated jitter force in the body frame [N]
   libra::Vector<3> jitter_torque_b_Nm_{0.0};  //!< Generated jitter torque in the body frame [Nm]
 
+  /**
+   * @fn InitializeOscillators
+   * @brief Initialize the phases of the harmonic oscillators with the rotation phases and the rotations with the angular velocity
+   * @param [in] angular_velocity_rad: Angular velocity of RW [rad/s]
+   */
+  void InitializeOscillators(const double angular_velocity_rad);
+  /**
+   * @fn UpdateOscillatorRotations
+   * @brief Update the rotations per sample of the harmonic oscillators. The trigonometric functions are evaluated only here.
+   * @param [in] angular_velocity_rad: Angular velocity of RW [rad/s]
+   */
+  void UpdateOscillatorRotations(const double angular_velocity_rad);
   /**
    * @fn AddStructuralResonance
    * @brief Add structural resonance effect
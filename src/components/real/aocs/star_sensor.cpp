@@ -11,6 +11,7 @@
 #include <math_physics/math/matrix.hpp>
 #include <math_physics/randomization/global_randomization.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
 #include <string>
 
 using namespace std;
@@ -72,12 +73,8 @@ void StarSensor::Initialize() {
   // Decide delay buffer size
   max_delay_ = int(output_delay_ * 2 / step_time_s_);
   if (max_delay_ <= 0) max_delay_ = 1;
-  vector<libra::Quaternion> temp(max_delay_);
-  delay_buffer_ = temp;
   // Initialize delay buffer
-  for (int i = 0; i < max_delay_; ++i) {
-    delay_buffer_[i] = measured_quaternion_i2c_;
-  }
+  delay_buffer_.assign(max_delay_, measured_quaternion_i2c_);
 
   sight_direction_c_ = libra::Vector<3>(0.0);
   first_orthogonal_direction_c = libra::Vector<3>(0.0);
@@ -86,6 +83,18 @@ void StarSensor::Initialize() {
   first_orthogonal_direction_c[1] = 1.0;   //(0,1,0)@Component coordinates, line-of-sight orthogonal direction
   second_orthogonal_direction_c[2] = 1.0;  //(0,0,1)@Component coordinates, line-of-sight orthogonal direction
 
+  // Constants for the error judgements
+  sight_direction_b_ = quaternion_b2c_.InverseFrameConversion(sight_direction_c_).CalcNormalizedVector();
+  if (dynamics_ != nullptr) frame_id_ = dynamics_->SetFrameChainCache().RegisterComponentFrame(quaternion_b2c_);
+  cos_sun_forbidden_angle_ = cos(sun_forbidden_angle_rad_);
+  cos_moon_forbidden_angle_ = cos(moon_forbidden_angle_rad_);
+  if (local_environment_ != nullptr) {
+    const CelestialInformation& celestial_information = local_environment_->GetCelestialInformation().GetGlobalInformation();
+    sun_ = celestial_information.GetBodyHandle("SUN");
+    earth_ = celestial_information.GetBodyHandle("EARTH");
+    moon_ = celestial_information.GetBodyHandle("MOON");
+  }
+
   error_flag_ = true;
 }
 Quaternion StarSensor::Measure(const LocalCelestialInformation* local_celestial_information, const Attitude* attitude) {
@@ -105,8 +114,10 @@ Quaternion StarSensor::Measure(const LocalCelestialInformation* local_celestial_
 }
 
 void StarSensor::update(const LocalCelestialInformation* local_celestial_information, const Attitude* attitude) {
-  Quaternion quaternion_i2b = attitude->GetQuaternion_i2b();  // Read true value
-  Quaternion q_stt_temp = quaternion_i2b * quaternion_b2c_;   // Convert to component frame
+  // Convert true value to component frame. The composed attitude is reused from the frame chain cache for the attitude of the dynamics.
+  const Quaternion q_stt_temp = (dynamics_ != nullptr && attitude == &(dynamics_->GetAttitude()))
+                                    ? dynamics_->GetFrameChainCache().GetQuaternion_i2c(frame_id_)
+                                    : attitude->GetQuaternion_i2b() * quaternion_b2c_;
   // Add noise on sight direction
   Quaternion q_sight(sight_direction_c_, sight_direction_noise_);
   // Random noise on orthogonal direction of sight. Range [0:2pi]
@@ -121,15 +132,14 @@ void StarSensor::update(const LocalCelestialInformation* local_celestial_informa
   // sight →Rotation around orthogonal direction
   delay_buffer_[buffer_position_] = q_stt_temp * q_sight * q_ortho;
   // Update delay buffer position
-  ++buffer_position_;
-  buffer_position_ %= max_delay_;
+  if (++buffer_position_ == max_delay_) buffer_position_ = 0;
 }
 
 void StarSensor::AllJudgement(const LocalCelestialInformation* local_celestial_information, const Attitude* attitude) {
   int judgement = 0;
-  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("SUN"));
-  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH"));
-  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("MOON"));
+  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(sun_));
+  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(earth_));
+  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(moon_));
   judgement += CaptureRateJudgement(attitude->GetAngularVelocity_b_rad_s());
   if (judgement > 0)
     error_flag_ = true;
@@ -138,21 +148,18 @@ void StarSensor::AllJudgement(const LocalCelestialInformation* local_celestial_i
 }
 
 int StarSensor::SunJudgement(const libra::Vector<3>& sun_b) {
-  libra::Quaternion q_c2b = quaternion_b2c_.Conjugate();
-  libra::Vector<3> sight_b = q_c2b.FrameConversion(sight_direction_c_);
-  double sun_angle_rad = CalAngleVector_rad(sun_b, sight_b);
-  if (sun_angle_rad < sun_forbidden_angle_rad_)
+  // The angle is smaller than the forbidden angle when the cosine is larger
+  double cos_sun_angle = InnerProduct(sun_b, sight_direction_b_) / sun_b.CalcNorm();
+  if (cos_sun_angle > cos_sun_forbidden_angle_)
     return 1;
   else
     return 0;
 }
 
 int StarSensor::EarthJudgement(const libra::Vector<3>& earth_b) {
-  libra::Quaternion q_c2b = quaternion_b2c_.Conjugate();
-  libra::Vector<3> sight_b = q_c2b.FrameConversion(sight_direction_c_);
   double earth_size_rad = atan2(environment::earth_equatorial_radius_m,
                                 earth_b.CalcNorm());                      // angles between sat<->earth_center & sat<->earth_edge
-  double earth_center_angle_rad = CalAngleVector_rad(earth_b, sight_b);   // angles between sat<->earth_center & sat_sight
+  double earth_center_angle_rad = CalAngleVector_rad(earth_b, sight_direction_b_);   // angles between sat<->earth_center & sat_sight
   double earth_edge_angle_rad = earth_center_angle_rad - earth_size_rad;  // angles between sat<->earth_edge & sat_sight
   if (earth_edge_angle_rad < earth_forbidden_angle_rad_)
     return 1;
@@ -161,10 +168,8 @@ int StarSensor::EarthJudgement(const libra::Vector<3>& earth_b) {
 }
 
 int StarSensor::MoonJudgement(const libra::Vector<3>& moon_b) {
-  libra::Quaternion q_c2b = quaternion_b2c_.Conjugate();
-  libra::Vector<3> sight_b = q_c2b.FrameConversion(sight_direction_c_);
-  double moon_angle_rad = CalAngleVector_rad(moon_b, sight_b);
-  if (moon_angle_rad < moon_forbidden_angle_rad_)
+  double cos_moon_angle = InnerProduct(moon_b, sight_direction_b_) / moon_b.CalcNorm();
+  if (cos_moon_angle > cos_moon_forbidden_angle_)
     return 1;
   else
     return 0;
@@ -218,6 +223,7 @@ StarSensor InitStarSensor(ClockGenerator* clock_generator, int sensor_id, const
   IniAccess STT_conf(file_name);
   const char* sensor_name = "STAR_SENSOR_";
   const std::string section_name = sensor_name + std::to_string(static_cast<long long>(sensor_id));
+  GlobalRandomization::StreamScope stream_scope(section_name);
   const char* STTSection = section_name.c_str();
 
   int prescaler = STT_conf.ReadInt(STTSection, "prescaler");
@@ -251,6 +257,7 @@ StarSensor InitStarSensor(ClockGenerator* clock_generator, PowerPort* power_port
   IniAccess STT_conf(file_name);
   const char* sensor_name = "STAR_SENSOR_";
   const std::string section_name = sensor_name + std::to_string(static_cast<long long>(sensor_id));
+  GlobalRandomization::StreamScope stream_scope(section_name);
   const char* STTSection = section_name.c_str();
 
   int prescaler = STT_conf.ReadInt(STTSection, "prescaler");
@@ -281,3 +288,29 @@ StarSensor InitStarSensor(ClockGenerator* clock_generator, PowerPort* power_port
                  moon_forbidden_angle_rad, capture_rate_rad_s, dynamics, local_environment);
   return stt;
 }
+
+void StarSensor::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(rotation_noise_);
+  snapshot.Write(orthogonal_direction_noise_);
+  snapshot.Write(sight_direction_noise_);
+  snapshot.Write(delay_buffer_);
+  snapshot.Write(buffer_position_);
+  snapshot.Write(update_count_);
+  snapshot.Write(measured_quaternion_i2c_);
+  snapshot.Write(error_flag_);
+}
+
+void StarSensor::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(rotation_noise_);
+  snapshot.Read(orthogonal_direction_noise_);
+  snapshot.Read(sight_direction_noise_);
+  const size_t buffer_size = delay_buffer_.size();
+  snapshot.Read(delay_buffer_);
+  if (delay_buffer_.size() != buffer_size) {
+    throw std::invalid_argument("Snapshot is made with the different delay setting of the star sensor.");
+  }
+  snapshot.Read(buffer_position_);
+  snapshot.Read(update_count_);
+  snapshot.Read(measured_quaternion_i2c_);
+  snapshot.Read(error_flag_);
+}
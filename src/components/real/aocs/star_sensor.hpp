@@ -82,6 +82,17 @@ class StarSensor : public Component, public ILoggable {
    */
   void MainRoutine(const int time_count) override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Component
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const override;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Component
+   */
+  void LoadSnapshot(SnapshotReader& snapshot) override;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -113,6 +124,7 @@ class StarSensor : public Component, public ILoggable {
   libra::Vector<3> sight_direction_c_;                                //!< Sight direction vector at component frame
   libra::Vector<3> first_orthogonal_direction_c;                      //!< The first orthogonal direction of sight at component frame
   libra::Vector<3> second_orthogonal_direction_c;                     //!< The second orthogonal direction of sight at component frame
+  libra::Vector<3> sight_direction_b_;                                //!< Sight direction vector at body frame
 
   // Noise parameters
   libra::MinimalStandardLcgWithShuffle rotation_noise_;  //!< Randomize object for orthogonal direction
@@ -134,9 +146,15 @@ class StarSensor : public Component, public ILoggable {
   double earth_forbidden_angle_rad_;  //!< Earth forbidden angle [rad]
   double moon_forbidden_angle_rad_;   //!< Moon forbidden angle [rad]
   double capture_rate_limit_rad_s_;   //!< Angular rate limit to get correct attitude [rad/s]
+  double cos_sun_forbidden_angle_;    //!< Cosine of the sun forbidden angle
+  double cos_moon_forbidden_angle_;   //!< Cosine of the moon forbidden angle
+  CelestialBodyHandle sun_;           //!< Handle of the sun
+  CelestialBodyHandle earth_;         //!< Handle of the earth
+  CelestialBodyHandle moon_;          //!< Handle of the moon
 
   // Observed variables
   const Dynamics* dynamics_;                   //!< Dynamics information
+  size_t frame_id_ = 0;                        //!< ID of the component frame in the frame chain cache of the dynamics
   const LocalEnvironment* local_environment_;  //!< Local environment information
 
   // Internal functions
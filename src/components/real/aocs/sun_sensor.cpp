@@ -5,6 +5,7 @@
 
 #include "sun_sensor.hpp"
 
+#include <environment/local/earth_albedo.hpp>
 #include <math_physics/math/constants.hpp>
 #include <math_physics/randomization/normal_randomization.hpp>
 using libra::NormalRand;
@@ -117,12 +118,19 @@ void SunSensor::CalcSolarIlluminance() {
 
   if (sun_angle_ > libra::pi_2) {
     solar_illuminance_W_m2_ = 0.0;
-    return;
+  } else {
+    double power_density = srp_environment_->GetPowerDensity_W_m2();
+    solar_illuminance_W_m2_ = power_density * cos(sun_angle_);
   }
 
-  double power_density = srp_environment_->GetPowerDensity_W_m2();
-  solar_illuminance_W_m2_ = power_density * cos(sun_angle_);
-  // TODO: Take into account the effects of albedo.
+  // Sunlight reflected by the earth on the sensor surface
+  const EarthAlbedo* earth_albedo = srp_environment_->GetEarthAlbedo();
+  if (earth_albedo != nullptr) {
+    libra::Vector<3> boresight_c(0.0);
+    boresight_c[2] = 1.0;
+    const libra::Vector<3> boresight_b = quaternion_b2c_.InverseFrameConversion(boresight_c);
+    solar_illuminance_W_m2_ += earth_albedo->CalcAlbedoIrradiance_W_m2(boresight_b);
+  }
 }
 
 double SunSensor::TanRange(double x) {
@@ -156,6 +164,7 @@ SunSensor InitSunSensor(ClockGenerator* clock_generator, int ss_id, std::string
   IniAccess ss_conf(file_name);
   const char* sensor_name = "SUN_SENSOR_";
   const std::string section_tmp = sensor_name + std::to_string(static_cast<long long>(ss_id));
+  GlobalRandomization::StreamScope stream_scope(section_tmp);
   const char* Section = section_tmp.c_str();
 
   int prescaler = ss_conf.ReadInt(Section, "prescaler");
@@ -189,6 +198,7 @@ SunSensor InitSunSensor(ClockGenerator* clock_generator, PowerPort* power_port,
   IniAccess ss_conf(file_name);
   const char* sensor_name = "SUN_SENSOR_";
   const std::string section_tmp = sensor_name + std::to_string(static_cast<long long>(ss_id));
+  GlobalRandomization::StreamScope stream_scope(section_tmp);
   const char* Section = section_tmp.c_str();
 
   int prescaler = ss_conf.ReadInt(Section, "prescaler");
@@ -218,3 +228,25 @@ SunSensor InitSunSensor(ClockGenerator* clock_generator, PowerPort* power_port,
                intensity_lower_threshold_percent, srp_environment, local_celestial_information);
   return ss;
 }
+
+void SunSensor::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(random_noise_alpha_);
+  snapshot.Write(random_noise_beta_);
+  snapshot.Write(sun_direction_true_c_);
+  snapshot.Write(measured_sun_direction_c_);
+  snapshot.Write(alpha_rad_);
+  snapshot.Write(beta_rad_);
+  snapshot.Write(solar_illuminance_W_m2_);
+  snapshot.Write(sun_detected_flag_);
+}
+
+void SunSensor::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(random_noise_alpha_);
+  snapshot.Read(random_noise_beta_);
+  snapshot.Read(sun_direction_true_c_);
+  snapshot.Read(measured_sun_direction_c_);
+  snapshot.Read(alpha_rad_);
+  snapshot.Read(beta_rad_);
+  snapshot.Read(solar_illuminance_W_m2_);
+  snapshot.Read(sun_detected_flag_);
+}
@@ -65,6 +65,22 @@ class SunSensor : public Component, public ILoggable {
    * @brief Main routine for sensor observation
    */
   void MainRoutine(const int time_count) override;
+  /**
+   * @fn GetBatchTickFunction
+   * @brief Override GetBatchTickFunction function of ITickable to update the sun sensors together
+   */
+  ITickable::BatchTickFunction GetBatchTickFunction() const override { return GetBatchTickFunctionOf<SunSensor>(); }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Component
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const override;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Component
+   */
+  void LoadSnapshot(SnapshotReader& snapshot) override;
 
   // Override ILoggable
   /**
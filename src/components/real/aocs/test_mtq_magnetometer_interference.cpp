@@ -0,0 +1,163 @@
+/**
+ * @file test_mtq_magnetometer_interference.cpp
+ * @brief Test codes for MtqMagnetometerInterference class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <string>
+#include <vector>
+
+#include "mtq_magnetometer_interference.hpp"
+
+namespace {
+const std::string kInterferenceFile = "test_mtq_magnetometer_interference.ini";
+const size_t kPolynomialDegree = 3;
+
+/**
+ * @fn MakeCoefficients
+ * @brief Make the random polynomial coefficients of all degrees
+ */
+std::vector<libra::Matrix<3, 3>> MakeCoefficients() {
+  std::mt19937 generator(94);
+  std::uniform_real_distribution<double> distribution(-1.0e4, 1.0e4);
+  std::vector<libra::Matrix<3, 3>> coefficients(kPolynomialDegree);
+  for (auto& coefficient : coefficients) {
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) coefficient[i][j] = distribution(generator);
+    }
+  }
+  return coefficients;
+}
+
+/**
+ * @fn WriteInterferenceFile
+ * @brief Write the initialize file of the interference with the coefficients
+ */
+void WriteInterferenceFile(const std::vector<libra::Matrix<3, 3>>& coefficients) {
+  std::ofstream file(kInterferenceFile);
+  file << std::setprecision(17) << "[MTQ_MAGNETOMETER_INTERFERENCE_0]\npolynomial_degree = " << coefficients.size() << "\n";
+  for (size_t degree = 1; degree <= coefficients.size(); degree++) {
+    for (size_t k = 0; k < 9; k++) {
+      file << "additional_bias_by_mtq_coefficients_" << degree << "(" << k << ") = " << coefficients[degree - 1][k / 3][k % 3] << "\n";
+    }
+  }
+}
+
+/**
+ * @fn CalcAdditionalBiasWithPow_c_nT
+ * @brief Calculate the additional bias with the matrix product of each degree and pow as the former implementation
+ */
+libra::Vector<3> CalcAdditionalBiasWithPow_c_nT(const std::vector<libra::Matrix<3, 3>>& coefficients, const libra::Vector<3>& mtq_output_c_Am2) {
+  libra::Vector<3> additional_bias_c_nT{0.0};
+  for (size_t degree = 1; degree <= coefficients.size(); degree++) {
+    libra::Vector<3> hadamard_mtq;
+    for (size_t axis = 0; axis < 3; axis++) {
+      hadamard_mtq[axis] = pow(mtq_output_c_Am2[axis], degree);
+    }
+    additional_bias_c_nT = additional_bias_c_nT + coefficients[degree - 1] * hadamard_mtq;
+  }
+  return additional_bias_c_nT;
+}
+
+/**
+ * @class InterferenceTestComponents
+ * @brief Magnetometer and magnetorquer without noise connected with the interference
+ */
+class InterferenceTestComponents {
+ public:
+  InterferenceTestComponents()
+      : sensor_base_(libra::MakeIdentityMatrix<3>(), libra::Vector<3>(1.0e9), libra::Vector<3>(1.0e10), libra::Vector<3>(0.0),
+                     libra::Vector<3>(0.0), 0.1, libra::Vector<3>(0.0), libra::Vector<3>(0.0)),
+        magnetometer_(1, &clock_generator_, sensor_base_, 0, libra::Quaternion(0.0, 0.0, 0.0, 1.0), nullptr),
+        magnetorquer_(1, &clock_generator_, 0, libra::Quaternion(0.0, 0.0, 0.0, 1.0), libra::MakeIdentityMatrix<3>(), libra::Vector<3>(10.0),
+                      libra::Vector<3>(-10.0), libra::Vector<3>(0.0), 0.1, libra::Vector<3>(0.0), libra::Vector<3>(0.0), libra::Vector<3>(0.0),
+                      nullptr) {}
+
+  ClockGenerator clock_generator_;
+  Sensor<kMagnetometerDimension> sensor_base_;
+  Magnetometer magnetometer_;
+  Magnetorquer magnetorquer_;
+};
+}  // namespace
+
+/**
+ * @brief Test for the product of the packed coupling matrix against the matrix product with pow of each degree
+ */
+TEST(MtqMagnetometerInterference, CalcAdditionalBias) {
+  const std::vector<libra::Matrix<3, 3>> coefficients = MakeCoefficients();
+  WriteInterferenceFile(coefficients);
+  InterferenceTestComponents components;
+  const MtqMagnetometerInterference interference(kInterferenceFile, components.magnetometer_, components.magnetorquer_);
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(-2.0, 2.0);
+  std::vector<libra::Vector<3>> moments_c_Am2 = {libra::Vector<3>(0.0), libra::Vector<3>(1.0), libra::Vector<3>(-1.0)};
+  for (size_t n = 0; n < 100; n++) {
+    libra::Vector<3> moment_c_Am2;
+    for (size_t axis = 0; axis < 3; axis++) moment_c_Am2[axis] = distribution(generator);
+    moments_c_Am2.push_back(moment_c_Am2);
+  }
+
+  std::vector<double> packed_moments_c_Am2, batched_biases_c_nT(3 * moments_c_Am2.size());
+  for (const auto& moment_c_Am2 : moments_c_Am2) {
+    const libra::Vector<3> expected_bias_c_nT = CalcAdditionalBiasWithPow_c_nT(coefficients, moment_c_Am2);
+    const libra::Vector<3> bias_c_nT = interference.CalcAdditionalBias_c_nT(moment_c_Am2);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(expected_bias_c_nT[i], bias_c_nT[i], 1e-12 * (1.0 + fabs(expected_bias_c_nT[i])));
+      packed_moments_c_Am2.push_back(moment_c_Am2[i]);
+    }
+  }
+
+  // The batched calculation gives the same biases as the calculation of each moment
+  interference.CalcAdditionalBias_c_nT(moments_c_Am2.size(), packed_moments_c_Am2.data(), batched_biases_c_nT.data());
+  for (size_t n = 0; n < moments_c_Am2.size(); n++) {
+    const libra::Vector<3> bias_c_nT = interference.CalcAdditionalBias_c_nT(moments_c_Am2[n]);
+    for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(bias_c_nT[i], batched_biases_c_nT[3 * n + i]);
+  }
+
+  std::remove(kInterferenceFile.c_str());
+  IniAccess::ClearCache();
+}
+
+/**
+ * @brief Test for the bias added to the magnetometer with the change of the magnetorquer output
+ */
+TEST(MtqMagnetometerInterference, UpdateInterference) {
+  const std::vector<libra::Matrix<3, 3>> coefficients = MakeCoefficients();
+  WriteInterferenceFile(coefficients);
+  InterferenceTestComponents components;
+  MtqMagnetometerInterference interference(kInterferenceFile, components.magnetometer_, components.magnetorquer_);
+  libra::Vector<3> original_bias_c_nT(0.0);
+  original_bias_c_nT[0] = 100.0;
+  components.magnetometer_.SetConstantBiasNoise_c_nT(original_bias_c_nT);
+
+  libra::Vector<3> moment_c_Am2;
+  moment_c_Am2[0] = 0.5;
+  moment_c_Am2[1] = -1.2;
+  moment_c_Am2[2] = 0.8;
+  for (size_t update = 0; update < 3; update++) {
+    // The bias of the previous output is replaced, and the same output does not accumulate the bias
+    components.magnetorquer_.SetOutputMagneticMoment_c_Am2(moment_c_Am2);
+    interference.UpdateInterference();
+    interference.UpdateInterference();
+    const libra::Vector<3> expected_bias_c_nT = original_bias_c_nT + CalcAdditionalBiasWithPow_c_nT(coefficients, moment_c_Am2);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(expected_bias_c_nT[i], components.magnetometer_.GetConstantBiasNoise_c_nT()[i], 1e-9 * (1.0 + fabs(expected_bias_c_nT[i])));
+    }
+    moment_c_Am2 = -0.5 * moment_c_Am2;
+  }
+
+  // The zero output removes the additional bias
+  components.magnetorquer_.SetOutputMagneticMoment_c_Am2(libra::Vector<3>(0.0));
+  interference.UpdateInterference();
+  for (size_t i = 0; i < 3; i++) EXPECT_NEAR(original_bias_c_nT[i], components.magnetometer_.GetConstantBiasNoise_c_nT()[i], 1e-9);
+
+  std::remove(kInterferenceFile.c_str());
+  IniAccess::ClearCache();
+}
@@ -0,0 +1,71 @@
+/**
+ * @file test_reaction_wheel_cluster_ode.cpp
+ * @brief Test codes for ReactionWheelClusterOde class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <math_physics/math/constants.hpp>
+#include <memory>
+#include <vector>
+
+#include "reaction_wheel.hpp"
+#include "reaction_wheel_cluster_ode.hpp"
+
+/**
+ * @brief Test for the agreement with the ReactionWheel components
+ */
+TEST(ReactionWheelClusterOde, AgreementWithReactionWheel) {
+  const double step_width_s = 0.1;
+  const size_t number_of_wheels = 4;
+  const double rotor_inertia_kgm2 = 1.0e-3;
+  const double max_torque_Nm = 5.0e-3;
+  const double max_velocity_rpm[number_of_wheels] = {6000.0, 5000.0, 4000.0, 3000.0};
+  const double dead_time_s[number_of_wheels] = {0.0, 0.1, 0.25, 0.5};
+  const double time_constant_s[number_of_wheels] = {0.0, 0.1, 0.5, 1.0};
+  const double initial_angular_velocity_rad_s[number_of_wheels] = {0.0, 100.0, -50.0, 2.0};
+  const std::vector<double> friction_coefficients{1.0e-2, 1.0e-4, 1.0e-8};
+  const double stop_limit_angular_velocity_rad_s = 1.0;
+
+  ClockGenerator clock_generator;
+  ReactionWheelJitter jitter;
+  std::vector<std::unique_ptr<ReactionWheel>> wheels;
+  ReactionWheelClusterOde cluster(step_width_s);
+  for (size_t i = 0; i < number_of_wheels; i++) {
+    wheels.emplace_back(new ReactionWheel(1, &clock_generator, (int)i, step_width_s, rotor_inertia_kgm2, max_torque_Nm, max_velocity_rpm[i],
+                                          libra::Quaternion(0.0, 0.0, 0.0, 1.0), libra::Vector<3>(0.0), dead_time_s[i], time_constant_s[i],
+                                          friction_coefficients, stop_limit_angular_velocity_rad_s, false, false, 1, jitter, true,
+                                          initial_angular_velocity_rad_s[i]));
+    const double max_velocity_rad_s = max_velocity_rpm[i] * libra::rpm_to_rad_s;
+    cluster.AddWheel(max_velocity_rad_s, max_velocity_rad_s, time_constant_s[i], dead_time_s[i], friction_coefficients,
+                     stop_limit_angular_velocity_rad_s, initial_angular_velocity_rad_s[i], true);
+  }
+
+  // Drive and coasting are switched every 1000 steps, and the wheels reach the velocity limits in the drive
+  const size_t number_of_steps = 5000;
+  double max_error_rad_s = 0.0;
+  bool is_limit_reached = false;
+  for (size_t step = 0; step < number_of_steps; step++) {
+    const bool drive_flag = (step / 1000) % 2 == 0;
+    for (size_t i = 0; i < number_of_wheels; i++) {
+      const double direction = (i % 2 == 0) ? 1.0 : -1.0;
+      const double torque_Nm = direction * max_torque_Nm * (0.6 + 0.8 * sin(0.01 * (double)(step + 100 * i)));
+      wheels[i]->SetDriveFlag(drive_flag);
+      wheels[i]->SetTargetTorque_rw_Nm(torque_Nm);
+      wheels[i]->MainRoutine(0);
+
+      cluster.SetDriveFlag(i, drive_flag);
+      const double acceleration_rad_s2 = std::copysign(std::min(std::abs(torque_Nm), max_torque_Nm), torque_Nm) / rotor_inertia_kgm2;
+      cluster.SetTargetAcceleration_rad_s2(i, acceleration_rad_s2);
+    }
+    cluster.Update();
+
+    for (size_t i = 0; i < number_of_wheels; i++) {
+      max_error_rad_s = std::max(max_error_rad_s, std::abs(wheels[i]->GetAngularVelocity_rad_s() - cluster.GetAngularVelocity_rad_s(i)));
+      if (std::abs(cluster.GetAngularVelocity_rad_s(i)) > 0.99 * max_velocity_rpm[i] * libra::rpm_to_rad_s) is_limit_reached = true;
+    }
+  }
+  EXPECT_LT(max_error_rad_s, 1e-5);
+  EXPECT_TRUE(is_limit_reached);
+}
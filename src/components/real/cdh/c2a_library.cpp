@@ -0,0 +1,82 @@
+/*
+ * @file c2a_library.cpp
+ * @brief Class to load an independent instance of C2A flight software from a shared library
+ */
+
+#include "c2a_library.hpp"
+
+#ifdef USE_C2A_LIBRARY
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#endif
+
+#include <stdexcept>
+
+C2aLibrary::C2aLibrary(const std::string& library_path) : library_path_(library_path) {
+#ifdef USE_C2A_LIBRARY
+  // dlopen returns the same handle for the same file, so a private copy is made for each instance
+  std::ifstream source(library_path_, std::ios::binary);
+  if (!source) throw std::runtime_error("C2A library " + library_path_ + " cannot be opened.");
+  const char* temporary_directory = getenv("TMPDIR");
+  std::string copy_path = std::string(temporary_directory != nullptr ? temporary_directory : "/tmp") + "/s2e_c2a_XXXXXX";
+  const int copy_descriptor = mkstemp(&copy_path[0]);
+  if (copy_descriptor < 0) throw std::runtime_error("A copy of C2A library " + library_path_ + " cannot be created.");
+  close(copy_descriptor);
+  {
+    std::ofstream copy(copy_path, std::ios::binary | std::ios::trunc);
+    copy << source.rdbuf();
+  }
+
+  handle_ = dlopen(copy_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  // The loaded copy stays mapped after the file is removed
+  unlink(copy_path.c_str());
+  if (handle_ == nullptr) throw std::runtime_error("C2A library " + library_path_ + " cannot be loaded: " + dlerror());
+
+  time_manager_init_ = FindFunction("TMGR_init");
+  core_init_ = FindFunction("C2A_core_init");
+  watchdog_timer_init_ = FindFunction("WDT_init");
+  time_manager_clear_ = FindFunction("TMGR_clear");
+  count_up_master_clock_ = FindFunction("TMGR_count_up_master_clock");
+  execute_task_list_ = FindFunction("TDSP_execute_pl_as_task_list");
+#else
+  throw std::runtime_error("C2A library " + library_path_ + " cannot be loaded without the USE_C2A_LIBRARY option.");
+#endif
+}
+
+C2aLibrary::~C2aLibrary() {
+#ifdef USE_C2A_LIBRARY
+  if (handle_ != nullptr) dlclose(handle_);
+#endif
+}
+
+void C2aLibrary::Initialize() {
+  time_manager_init_();  // Initialize at the beginning in order to measure the execution time of C2A core initialization.
+  core_init_();
+  watchdog_timer_init_();  // In SILS, it does not have meaning.
+  time_manager_clear_();   // This called in C2A_core_init, but should be called again just before executing the C2A main loop.
+}
+
+void C2aLibrary::Execute(const int count) {
+  for (int i = 0; i < count; i++) {
+    count_up_master_clock_();  // The update time oc C2A clock should be 1msec
+    execute_task_list_();
+  }
+}
+
+C2aLibrary::C2aFunction C2aLibrary::FindFunction(const std::string& name) const {
+#ifdef USE_C2A_LIBRARY
+  void* function = dlsym(handle_, name.c_str());
+  if (function == nullptr) {
+    // Itanium C++ ABI name of a function without arguments
+    const std::string mangled_name = "_Z" + std::to_string(name.size()) + name + "v";
+    function = dlsym(handle_, mangled_name.c_str());
+  }
+  if (function == nullptr) throw std::runtime_error("C2A library " + library_path_ + " does not have " + name + ".");
+  return reinterpret_cast<C2aFunction>(function);
+#else
+  throw std::runtime_error("C2A library " + library_path_ + " does not have " + name + ".");
+#endif
+}
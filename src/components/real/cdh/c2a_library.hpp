@@ -0,0 +1,77 @@
+/*
+ * @file c2a_library.hpp
+ * @brief Class to load an independent instance of C2A flight software from a shared library
+ */
+
+#ifndef S2E_COMPONENTS_REAL_CDH_C2A_LIBRARY_HPP_
+#define S2E_COMPONENTS_REAL_CDH_C2A_LIBRARY_HPP_
+
+#include <string>
+
+/*
+ * @class C2aLibrary
+ * @brief Class to load an independent instance of C2A flight software from a shared library
+ * @details The global variables of C2A exist only once in a loaded library, so each instance loads its own private copy of the library file.
+ *          The copy is opened with RTLD_LOCAL, so the symbols of the instances do not conflict with each other. The OBC_C2A_* functions
+ *          called by C2A are resolved from the executable, which must be linked with ENABLE_EXPORTS (USE_C2A_LIBRARY option).
+ *          The C2A functions are looked up with the C name and the C++ mangled name, so C2A can be compiled as C or C++.
+ * @note Available only on Linux and macOS with the USE_C2A_LIBRARY option. The constructor throws std::runtime_error otherwise.
+ *       An instance is not thread-safe, but different instances can be executed in different threads.
+ */
+class C2aLibrary {
+ public:
+  /**
+   * @fn C2aLibrary
+   * @brief Constructor. A private copy of the library is loaded.
+   * @param [in] library_path: Path of the C2A shared library
+   */
+  C2aLibrary(const std::string& library_path);
+  /**
+   * @fn ~C2aLibrary
+   * @brief Destructor. The library is unloaded.
+   */
+  ~C2aLibrary();
+  // The handle of the library cannot be shared
+  C2aLibrary(const C2aLibrary&) = delete;
+  C2aLibrary& operator=(const C2aLibrary&) = delete;
+
+  /**
+   * @fn Initialize
+   * @brief Initialize the C2A instance (TMGR_init, C2A_core_init, WDT_init, TMGR_clear)
+   */
+  void Initialize();
+  /**
+   * @fn Execute
+   * @brief Execute the main loop of the C2A instance (TMGR_count_up_master_clock, TDSP_execute_pl_as_task_list)
+   * @param [in] count: Number of the main loop iterations. The C2A clock is counted up by 1 msec in each iteration.
+   */
+  void Execute(const int count);
+
+  /**
+   * @fn GetLibraryPath
+   * @brief Return path of the original library
+   */
+  inline const std::string& GetLibraryPath() const { return library_path_; }
+
+ private:
+  typedef void (*C2aFunction)(void);  //!< Type of the C2A functions without arguments
+
+  const std::string library_path_;  //!< Path of the original library
+  void* handle_ = nullptr;          //!< Handle of the loaded copy
+
+  C2aFunction time_manager_init_ = nullptr;      //!< TMGR_init
+  C2aFunction core_init_ = nullptr;              //!< C2A_core_init
+  C2aFunction watchdog_timer_init_ = nullptr;    //!< WDT_init
+  C2aFunction time_manager_clear_ = nullptr;     //!< TMGR_clear
+  C2aFunction count_up_master_clock_ = nullptr;  //!< TMGR_count_up_master_clock
+  C2aFunction execute_task_list_ = nullptr;      //!< TDSP_execute_pl_as_task_list
+
+  /**
+   * @fn FindFunction
+   * @brief Find the function without arguments by the C name or the C++ mangled name
+   * @param [in] name: Name of the function
+   */
+  C2aFunction FindFunction(const std::string& name) const;
+};
+
+#endif  // S2E_COMPONENTS_REAL_CDH_C2A_LIBRARY_HPP_
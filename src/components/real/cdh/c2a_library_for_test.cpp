@@ -0,0 +1,45 @@
+/**
+ * @file c2a_library_for_test.cpp
+ * @brief Minimal C2A shared library for the tests of C2aLibrary and ObcWithC2a
+ * @note The functions are compiled as C++ like C2A in S2E, so C2aLibrary finds them with the C++ mangled names.
+ *       The OBC_C2A_* functions are resolved from the test executable when the library is loaded.
+ */
+
+#include <cstdint>
+
+// Functions exported from the executable (on_board_computer_with_c2a.hpp)
+int OBC_C2A_SendFromObc(int port_id, unsigned char* buffer, int offset, int length);
+int OBC_C2A_ReceivedByObc(int port_id, unsigned char* buffer, int offset, int length);
+int OBC_C2A_GpioWrite(int port_id, const bool is_high);
+bool OBC_C2A_GpioRead(int port_id);
+
+namespace {
+const int kUartPortId = 0;        //!< UART port to receive the commands and send the replies
+const int kGpioInputPortId = 0;   //!< GPIO port read by the task
+const int kGpioOutputPortId = 1;  //!< GPIO port written with the state of the input port
+
+// Global variables exist once in each loaded copy like the ones of C2A
+uint32_t master_clock = 0;           //!< Master clock counted up by TMGR_count_up_master_clock
+unsigned char initialize_count = 0;  //!< Number of calls of C2A_core_init
+}  // namespace
+
+void TMGR_init() { master_clock = 0; }
+
+void C2A_core_init() { initialize_count++; }
+
+void WDT_init() {}
+
+void TMGR_clear() { master_clock = 0; }
+
+void TMGR_count_up_master_clock() { master_clock++; }
+
+void TDSP_execute_pl_as_task_list() {
+  // Reply the command byte with the master clock and the number of the initializations
+  unsigned char command;
+  if (OBC_C2A_ReceivedByObc(kUartPortId, &command, 0, 1) == 1) {
+    unsigned char reply[6] = {command, 0, 0, 0, 0, initialize_count};
+    for (int i = 0; i < 4; i++) reply[i + 1] = (unsigned char)(master_clock >> (8 * i));
+    OBC_C2A_SendFromObc(kUartPortId, reply, 0, 6);
+  }
+  OBC_C2A_GpioWrite(kGpioOutputPortId, OBC_C2A_GpioRead(kGpioInputPortId));
+}
@@ -26,109 +26,106 @@ void OnBoardComputer::Initialize() {}
 void OnBoardComputer::MainRoutine(const int time_count) { UNUSED(time_count); }
 
 int OnBoardComputer::ConnectComPort(int port_id, int tx_buffer_size, int rx_buffer_size) {
-  if (uart_ports_[port_id] != nullptr) {
+  if (port_id < 0 || uart_ports_.Get(port_id) != nullptr) {
     // Port already used
     return -1;
   }
-  uart_ports_[port_id] = new UartPort(tx_buffer_size, rx_buffer_size);
+  uart_ports_.Set(port_id, new UartPort(tx_buffer_size, rx_buffer_size));
   return 0;
 }
 
 // Close port and free resources
 int OnBoardComputer::CloseComPort(int port_id) {
   // Port not used
-  if (uart_ports_[port_id] == nullptr) return -1;
+  if (uart_ports_.Get(port_id) == nullptr) return -1;
 
-  UartPort* port = uart_ports_.at(port_id);
+  UartPort* port = uart_ports_.Get(port_id);
   delete port;
-  uart_ports_.erase(port_id);
+  uart_ports_.Erase(port_id);
   return 0;
 }
 
 int OnBoardComputer::SendFromObc(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteTx(buffer, offset, length);
 }
 
 int OnBoardComputer::ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadTx(buffer, offset, length);
 }
 
 int OnBoardComputer::SendFromCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteRx(buffer, offset, length);
 }
 
 int OnBoardComputer::ReceivedByObc(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadRx(buffer, offset, length);
 }
 
 int OnBoardComputer::I2cConnectPort(int port_id, const unsigned char i2c_address) {
-  if (i2c_ports_[port_id] != nullptr) {
+  if (port_id < 0) return -1;
+  if (i2c_ports_.Get(port_id) != nullptr) {
     // Port already used
   } else {
-    i2c_ports_[port_id] = new I2cPort();
+    i2c_ports_.Set(port_id, new I2cPort());
   }
-  i2c_ports_[port_id]->RegisterDevice(i2c_address);
+  i2c_ports_.Get(port_id)->RegisterDevice(i2c_address);
 
   return 0;
 }
 
 int OnBoardComputer::I2cCloseComPort(int port_id) {
   // Port not used
-  if (i2c_ports_[port_id] == nullptr) return -1;
+  if (i2c_ports_.Get(port_id) == nullptr) return -1;
 
-  I2cPort* port = i2c_ports_.at(port_id);
+  I2cPort* port = i2c_ports_.Get(port_id);
   delete port;
-  i2c_ports_.erase(port_id);
+  i2c_ports_.Erase(port_id);
   return 0;
 }
 
 int OnBoardComputer::I2cComponentWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address,
                                                const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_ports_[port_id];
-  for (int i = 0; i < length; i++) {
-    i2c_port->WriteRegister(i2c_address, register_address, data[i]);
-  }
+  I2cPort* i2c_port = i2c_ports_.Get(port_id);
+  i2c_port->WriteRegisters(i2c_address, register_address, data, length);
   return 0;
 }
 int OnBoardComputer::I2cComponentReadRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address, unsigned char* data,
                                               const unsigned char length) {
-  I2cPort* i2c_port = i2c_ports_[port_id];
-  for (int i = 0; i < length; i++) {
-    data[i] = i2c_port->ReadRegister(register_address, i2c_address);
-  }
+  I2cPort* i2c_port = i2c_ports_.Get(port_id);
+  i2c_port->ReadRegisters(i2c_address, register_address, data, length);
   return 0;
 }
 int OnBoardComputer::I2cComponentReadCommand(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_ports_[port_id];
+  I2cPort* i2c_port = i2c_ports_.Get(port_id);
   i2c_port->ReadCommand(i2c_address, data, length);
   return 0;
 }
 
 int OnBoardComputer::GpioConnectPort(int port_id) {
-  if (gpio_ports_[port_id] != nullptr) {
+  if (port_id < 0 || gpio_ports_.Get(port_id) != nullptr) {
     // Port already used
     return -1;
   }
-  gpio_ports_[port_id] = new GpioPort(port_id);
+  gpio_ports_.Set(port_id, new GpioPort(port_id));
   return 0;
 }
 
 int OnBoardComputer::GpioComponentWrite(int port_id, const bool is_high) {
-  GpioPort* port = gpio_ports_[port_id];
+  GpioPort* port = gpio_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->DigitalWrite(is_high);
 }
 
 bool OnBoardComputer::GpioComponentRead(int port_id) {
-  GpioPort* port = gpio_ports_[port_id];
+  GpioPort* port = gpio_ports_.Get(port_id);
   if (port == nullptr) return false;
   return port->DigitalRead();
 }
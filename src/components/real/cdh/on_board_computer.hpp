@@ -8,8 +8,8 @@
 
 #include <components/ports/gpio_port.hpp>
 #include <components/ports/i2c_port.hpp>
+#include <components/ports/port_table.hpp>
 #include <components/ports/uart_port.hpp>
-#include <map>
 
 #include "../../base/component.hpp"
 
@@ -109,6 +109,13 @@ class OnBoardComputer : public Component {
    * @return Number of read byte
    */
   virtual int ReceivedByObc(int port_id, unsigned char* buffer, int offset, int length);
+  /**
+   * @fn GetComPort
+   * @brief Return UART communication port to access the buffers without the copy
+   * @param [in] port_id: Port ID
+   * @return UART port or nullptr when the port_id is not used
+   */
+  virtual UartPort* GetComPort(int port_id) { return uart_ports_.Get(port_id); }
 
   // I2C Communication port functions
   /**
@@ -202,9 +209,9 @@ class OnBoardComputer : public Component {
   virtual void MainRoutine(const int time_count);
 
  private:
-  std::map<int, UartPort*> uart_ports_;  //!< UART ports
-  std::map<int, I2cPort*> i2c_ports_;    //!< I2C ports
-  std::map<int, GpioPort*> gpio_ports_;  //!< GPIO ports
+  PortTable<UartPort> uart_ports_;  //!< UART ports
+  PortTable<I2cPort> i2c_ports_;    //!< I2C ports
+  PortTable<GpioPort> gpio_ports_;  //!< GPIO ports
 };
 
 #endif  // S2E_COMPONENTS_REAL_CDH_OBC_HPP_
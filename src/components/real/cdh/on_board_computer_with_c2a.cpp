@@ -2,6 +2,7 @@
  * @file on_board_computer_with_c2a.cpp
  * @brief Class to emulate on board computer with C2A flight software
  * @note Used C2A functions: TMGR_init, C2A_core_init, WDT_init, TMGR_clear, TMGR_count_up_master_clock, TDSP_execute_pl_as_task_list
+ *       The same functions are called through C2aLibrary for the C2A shared library.
  */
 
 #include "on_board_computer_with_c2a.hpp"
@@ -26,27 +27,86 @@
 #endif  // c2a-core version header
 #endif  // USE_C2A
 
-std::map<int, UartPort*> ObcWithC2a::com_ports_c2a_;
-std::map<int, I2cPort*> ObcWithC2a::i2c_com_ports_c2a_;
-std::map<int, GpioPort*> ObcWithC2a::gpio_ports_c2a_;
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <stdexcept>
+
+thread_local ObcWithC2a* ObcWithC2a::executing_obc_ = nullptr;
+ObcWithC2a* ObcWithC2a::default_obc_ = nullptr;
+ObcWithC2a* ObcWithC2a::static_c2a_obc_ = nullptr;
 
 ObcWithC2a::ObcWithC2a(ClockGenerator* clock_generator) : OnBoardComputer(clock_generator), timing_regulator_(1) {
   // Initialize();
+  RegisterInstance();
 }
 
 ObcWithC2a::ObcWithC2a(ClockGenerator* clock_generator, int timing_regulator)
     : OnBoardComputer(clock_generator), timing_regulator_(timing_regulator) {
   // Initialize();
+  RegisterInstance();
 }
 
 ObcWithC2a::ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timing_regulator, PowerPort* power_port)
     : OnBoardComputer(prescaler, clock_generator, power_port), timing_regulator_(timing_regulator) {
   // Initialize();
+  RegisterInstance();
+}
+
+ObcWithC2a::ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timing_regulator, PowerPort* power_port,
+                       const std::string& c2a_library_path, const bool is_dedicated_thread, const int cpu_core)
+    : OnBoardComputer(prescaler, clock_generator, power_port),
+      timing_regulator_(timing_regulator),
+      is_dedicated_thread_(is_dedicated_thread),
+      cpu_core_(cpu_core) {
+  if (!c2a_library_path.empty()) c2a_library_ = std::make_unique<C2aLibrary>(c2a_library_path);
+  RegisterInstance();
 }
 
-ObcWithC2a::~ObcWithC2a() {}
+ObcWithC2a::~ObcWithC2a() {
+  if (execution_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(execution_mutex_);
+      is_execution_stopped_ = true;
+    }
+    execution_condition_.notify_all();
+    execution_thread_.join();
+  }
+  if (default_obc_ == this) default_obc_ = nullptr;
+  if (static_c2a_obc_ == this) static_c2a_obc_ = nullptr;
+}
+
+void ObcWithC2a::RegisterInstance() {
+#ifdef USE_C2A
+  if (c2a_library_ == nullptr) {
+    if (static_c2a_obc_ != nullptr) {
+      throw std::invalid_argument("The statically linked C2A is already used by another ObcWithC2a. Use the C2A shared library.");
+    }
+    static_c2a_obc_ = this;
+  }
+#endif
+  if (default_obc_ == nullptr) default_obc_ = this;
+
+  if (is_dedicated_thread_) {
+    execution_thread_ = std::thread(&ObcWithC2a::RunExecutionThread, this);
+#ifdef __linux__
+    if (cpu_core_ >= 0) {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      CPU_SET(cpu_core_, &cpu_set);
+      pthread_setaffinity_np(execution_thread_.native_handle(), sizeof(cpu_set), &cpu_set);
+    }
+#endif
+  }
+}
 
 void ObcWithC2a::Initialize() {
+  if (c2a_library_ != nullptr) {
+    c2a_library_->Initialize();
+    return;
+  }
 #ifdef USE_C2A
   TMGR_init();  // Time Manager
                 // Initialize at the beginning in order to measure the execution
@@ -62,40 +122,90 @@ void ObcWithC2a::Initialize() {
 void ObcWithC2a::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
-#ifdef USE_C2A
-  if (is_initialized == false) {
-    is_initialized = true;
-    Initialize();
+  if (!is_dedicated_thread_) {
+    ExecuteC2a();
+    return;
   }
-  for (int i = 0; i < timing_regulator_; i++) {
-    TMGR_count_up_master_clock();  // The update time oc C2A clock should be
-                                   // 1msec
-    TDSP_execute_pl_as_task_list();
+  // Synchronize with the dedicated thread at each component tick
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(execution_mutex_);
+    is_execution_requested_ = true;
+    execution_condition_.notify_all();
+    execution_condition_.wait(lock, [this] { return !is_execution_requested_; });
+    exception = execution_exception_;
+    execution_exception_ = nullptr;
   }
-#else
-  UNUSED(is_initialized);
-  UNUSED(timing_regulator_);
+  if (exception != nullptr) std::rethrow_exception(exception);
+}
+
+void ObcWithC2a::ExecuteC2a() {
+  // Route the functions called by C2A in this thread to this instance
+  ObcWithC2a* previous_obc = executing_obc_;
+  executing_obc_ = this;
+
+  if (c2a_library_ != nullptr) {
+    if (is_initialized == false) {
+      is_initialized = true;
+      Initialize();
+    }
+    c2a_library_->Execute(timing_regulator_);
+  } else {
+#ifdef USE_C2A
+    if (is_initialized == false) {
+      is_initialized = true;
+      Initialize();
+    }
+    for (int i = 0; i < timing_regulator_; i++) {
+      TMGR_count_up_master_clock();  // The update time oc C2A clock should be
+                                     // 1msec
+      TDSP_execute_pl_as_task_list();
+    }
 #endif
+  }
+
+  executing_obc_ = previous_obc;
 }
 
+void ObcWithC2a::RunExecutionThread() {
+  std::unique_lock<std::mutex> lock(execution_mutex_);
+  while (true) {
+    execution_condition_.wait(lock, [this] { return is_execution_requested_ || is_execution_stopped_; });
+    if (is_execution_stopped_) return;
+    lock.unlock();
+    std::exception_ptr exception;
+    try {
+      ExecuteC2a();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    lock.lock();
+    execution_exception_ = exception;
+    is_execution_requested_ = false;
+    execution_condition_.notify_all();
+  }
+}
+
+ObcWithC2a* ObcWithC2a::GetExecutingObc() { return executing_obc_ != nullptr ? executing_obc_ : default_obc_; }
+
 // Override functions
 int ObcWithC2a::ConnectComPort(int port_id, int tx_buffer_size, int rx_buffer_size) {
-  if (com_ports_c2a_[port_id] != nullptr) {
+  if (port_id < 0 || com_ports_c2a_.Get(port_id) != nullptr) {
     // Port already used
     return -1;
   }
-  com_ports_c2a_[port_id] = new UartPort(tx_buffer_size, rx_buffer_size);
+  com_ports_c2a_.Set(port_id, new UartPort(tx_buffer_size, rx_buffer_size));
   return 0;
 }
 
 // Close port and free resources
 int ObcWithC2a::CloseComPort(int port_id) {
   // Port not used
-  if (com_ports_c2a_[port_id] == nullptr) return -1;
+  if (com_ports_c2a_.Get(port_id) == nullptr) return -1;
 
-  UartPort* port = com_ports_c2a_.at(port_id);
+  UartPort* port = com_ports_c2a_.Get(port_id);
   delete port;
-  com_ports_c2a_.erase(port_id);
+  com_ports_c2a_.Erase(port_id);
   return 0;
 }
 
@@ -104,13 +214,13 @@ int ObcWithC2a::SendFromObc(int port_id, unsigned char* buffer, int offset, int
 }
 
 int ObcWithC2a::ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadTx(buffer, offset, length);
 }
 
 int ObcWithC2a::SendFromCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteRx(buffer, offset, length);
 }
@@ -121,12 +231,16 @@ int ObcWithC2a::ReceivedByObc(int port_id, unsigned char* buffer, int offset, in
 
 // Static functions
 int ObcWithC2a::SendFromObc_C2A(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  ObcWithC2a* obc = GetExecutingObc();
+  if (obc == nullptr) return -1;
+  UartPort* port = obc->com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteTx(buffer, offset, length);
 }
 int ObcWithC2a::ReceivedByObc_C2A(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  ObcWithC2a* obc = GetExecutingObc();
+  if (obc == nullptr) return -1;
+  UartPort* port = obc->com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadRx(buffer, offset, length);
 }
@@ -141,71 +255,65 @@ int OBC_C2A_ReceivedByObc(int port_id, unsigned char* buffer, int offset, int le
 }
 
 int ObcWithC2a::I2cConnectPort(int port_id, const unsigned char i2c_address) {
-  if (i2c_com_ports_c2a_[port_id] != nullptr) {
+  if (port_id < 0) return -1;
+  if (i2c_com_ports_c2a_.Get(port_id) != nullptr) {
     // Port already used
   } else {
-    i2c_com_ports_c2a_[port_id] = new I2cPort();
+    i2c_com_ports_c2a_.Set(port_id, new I2cPort());
   }
-  i2c_com_ports_c2a_[port_id]->RegisterDevice(i2c_address);
+  i2c_com_ports_c2a_.Get(port_id)->RegisterDevice(i2c_address);
 
   return 0;
 }
 
 int ObcWithC2a::I2cCloseComPort(int port_id) {
   // Port not used
-  if (i2c_com_ports_c2a_[port_id] == nullptr) return -1;
+  if (i2c_com_ports_c2a_.Get(port_id) == nullptr) return -1;
 
-  I2cPort* port = i2c_com_ports_c2a_.at(port_id);
+  I2cPort* port = i2c_com_ports_c2a_.Get(port_id);
   delete port;
-  i2c_com_ports_c2a_.erase(port_id);
+  i2c_com_ports_c2a_.Erase(port_id);
   return 0;
 }
 
 int ObcWithC2a::I2cWriteCommand(int port_id, const unsigned char i2c_address, const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  I2cPort* i2c_port = GetExecutingObc()->i2c_com_ports_c2a_.Get(port_id);
   i2c_port->WriteCommand(i2c_address, data, length);
   return 0;
 }
 
 int ObcWithC2a::I2cWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  I2cPort* i2c_port = GetExecutingObc()->i2c_com_ports_c2a_.Get(port_id);
 
   if (length == 1) {
     i2c_port->WriteRegister(i2c_address, data[0]);
-  } else {
-    for (unsigned char i = 0; i < length - 1; i++) {
-      i2c_port->WriteRegister(i2c_address, data[0] + i, data[i + 1]);
-    }
+  } else if (length > 1) {
+    // The first byte is the register address
+    i2c_port->WriteRegisters(i2c_address, data[0], data + 1, length - 1);
   }
   return 0;
 }
 
 int ObcWithC2a::I2cReadRegister(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
-  for (int i = 0; i < length; i++) {
-    data[i] = i2c_port->ReadRegister(i2c_address);
-  }
+  I2cPort* i2c_port = GetExecutingObc()->i2c_com_ports_c2a_.Get(port_id);
+  i2c_port->ReadRegisters(i2c_address, data, length);
   return 0;
 }
 
 int ObcWithC2a::I2cComponentWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address,
                                           const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
-  for (unsigned char i = 0; i < length; i++) {
-    i2c_port->WriteRegister(i2c_address, register_address + i, data[i]);
-  }
+  I2cPort* i2c_port = i2c_com_ports_c2a_.Get(port_id);
+  i2c_port->WriteRegisters(i2c_address, register_address, data, length);
   return 0;
 }
 int ObcWithC2a::I2cComponentReadRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address, unsigned char* data,
                                          const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
-  for (unsigned char i = 0; i < length; i++) {
-    data[i] = i2c_port->ReadRegister(i2c_address, register_address + i);
-  }
+  I2cPort* i2c_port = i2c_com_ports_c2a_.Get(port_id);
+  i2c_port->ReadRegisters(i2c_address, register_address, data, length);
   return 0;
 }
 int ObcWithC2a::I2cComponentReadCommand(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  I2cPort* i2c_port = i2c_com_ports_c2a_.Get(port_id);
   i2c_port->ReadCommand(i2c_address, data, length);
   return 0;
 }
@@ -221,34 +329,38 @@ int OBC_C2A_I2cReadRegister(int port_id, const unsigned char i2c_address, unsign
 }
 
 int ObcWithC2a::GpioConnectPort(int port_id) {
-  if (gpio_ports_c2a_[port_id] != nullptr) {
+  if (port_id < 0 || gpio_ports_c2a_.Get(port_id) != nullptr) {
     // Port already used
     return -1;
   }
-  gpio_ports_c2a_[port_id] = new GpioPort(port_id);
+  gpio_ports_c2a_.Set(port_id, new GpioPort(port_id));
   return 0;
 }
 
 int ObcWithC2a::GpioComponentWrite(int port_id, const bool is_high) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
+  GpioPort* port = gpio_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->DigitalWrite(is_high);
 }
 
 bool ObcWithC2a::GpioComponentRead(int port_id) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
+  GpioPort* port = gpio_ports_c2a_.Get(port_id);
   if (port == nullptr) return false;
   return port->DigitalRead();
 }
 
 int ObcWithC2a::GpioWrite_C2A(int port_id, const bool is_high) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
+  ObcWithC2a* obc = GetExecutingObc();
+  if (obc == nullptr) return -1;
+  GpioPort* port = obc->gpio_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->DigitalWrite(is_high);
 }
 
 bool ObcWithC2a::GpioRead_C2A(int port_id) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
+  ObcWithC2a* obc = GetExecutingObc();
+  if (obc == nullptr) return false;
+  GpioPort* port = obc->gpio_ports_c2a_.Get(port_id);
   if (port == nullptr) return false;
   return port->DigitalRead();
 }
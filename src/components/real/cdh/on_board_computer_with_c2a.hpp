@@ -7,12 +7,25 @@
 #define S2E_COMPONENTS_REAL_CDH_OBC_C2A_HPP_
 
 #include <components/ports/gpio_port.hpp>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
+#include "c2a_library.hpp"
 #include "on_board_computer.hpp"
 
 /*
  * @class ObcWithC2a
  * @brief Class to emulate on board computer with C2A flight software
+ * @details The ports are owned by each instance. The static functions called by C2A are routed to the instance which is executing C2A in
+ *          the calling thread, so multiple instances can run concurrently (e.g., with number_of_spacecraft_update_threads).
+ *          The statically linked C2A (USE_C2A) has only one set of global variables, so only one instance can use it. The other instances load
+ *          their own copies of the C2A shared library with C2aLibrary.
+ *          With the dedicated thread, C2A is always executed in the thread of the instance, which can be pinned to a CPU core. MainRoutine
+ *          waits for the completion, so C2A is synchronized with the component ticks.
  */
 class ObcWithC2a : public OnBoardComputer {
  public:
@@ -38,6 +51,19 @@ class ObcWithC2a : public OnBoardComputer {
    * @param [in] power_port: Power port
    */
   ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timing_regulator, PowerPort* power_port);
+  /**
+   * @fn ObcWithC2a
+   * @brief Constructor for multiple C2A instances
+   * @param [in] prescaler: Frequency scale factor for update
+   * @param [in] clock_generator: Clock generator
+   * @param [in] timing_regulator: Timing regulator to update flight software faster than the component update
+   * @param [in] power_port: Power port
+   * @param [in] c2a_library_path: Path of the C2A shared library. Empty string uses the statically linked C2A.
+   * @param [in] is_dedicated_thread: Execute C2A in the dedicated thread of this instance
+   * @param [in] cpu_core: CPU core to pin the dedicated thread. Negative value does not pin the thread. Only Linux is supported.
+   */
+  ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timing_regulator, PowerPort* power_port, const std::string& c2a_library_path,
+             const bool is_dedicated_thread = false, const int cpu_core = -1);
   /**
    * @fn ~ObcWithC2a
    * @brief Destructor
@@ -102,6 +128,13 @@ class ObcWithC2a : public OnBoardComputer {
    * @return Number of read byte
    */
   int ReceivedByObc(int port_id, unsigned char* buffer, int offset, int length) override;
+  /**
+   * @fn GetComPort
+   * @brief Return UART communication port to access the buffers without the copy
+   * @param [in] port_id: Port ID
+   * @return UART port or nullptr when the port_id is not used
+   */
+  UartPort* GetComPort(int port_id) override { return com_ports_c2a_.Get(port_id); }
 
   // Static function for C2A
   /**
@@ -253,6 +286,39 @@ class ObcWithC2a : public OnBoardComputer {
   bool is_initialized = false;  //!< Is initialized flag
   const int timing_regulator_;  //!< Timing regulator to update flight software faster than the component update
 
+  std::unique_ptr<C2aLibrary> c2a_library_;  //!< C2A loaded from the shared library. nullptr for the statically linked C2A.
+
+  // Dedicated thread
+  const bool is_dedicated_thread_ = false;       //!< Execute C2A in the dedicated thread
+  const int cpu_core_ = -1;                      //!< CPU core to pin the dedicated thread
+  std::thread execution_thread_;                 //!< Dedicated thread
+  std::mutex execution_mutex_;                   //!< Mutex for the following states
+  std::condition_variable execution_condition_;  //!< Condition to notify the request and the completion of the execution
+  bool is_execution_requested_ = false;          //!< Flag of the requested execution
+  bool is_execution_stopped_ = false;            //!< Flag to stop the dedicated thread
+  std::exception_ptr execution_exception_;       //!< Exception thrown in the dedicated thread
+
+  /**
+   * @fn RegisterInstance
+   * @brief Register this instance to route the functions called by C2A, and start the dedicated thread
+   */
+  void RegisterInstance();
+  /**
+   * @fn ExecuteC2a
+   * @brief Initialize C2A at the first call and execute the C2A main loop timing_regulator_ times in the calling thread
+   */
+  void ExecuteC2a();
+  /**
+   * @fn RunExecutionThread
+   * @brief Main loop of the dedicated thread
+   */
+  void RunExecutionThread();
+  /**
+   * @fn GetExecutingObc
+   * @brief Return the instance executing C2A in the calling thread, or the first instance outside the execution
+   */
+  static ObcWithC2a* GetExecutingObc();
+
   // Override functions for Component
   /**
    * @fn MainRoutine
@@ -265,9 +331,13 @@ class ObcWithC2a : public OnBoardComputer {
    */
   void Initialize() override;
 
-  static std::map<int, UartPort*> com_ports_c2a_;     //!< UART ports
-  static std::map<int, I2cPort*> i2c_com_ports_c2a_;  //!< I2C ports
-  static std::map<int, GpioPort*> gpio_ports_c2a_;    //!< GPIO ports
+  PortTable<UartPort> com_ports_c2a_;     //!< UART ports
+  PortTable<I2cPort> i2c_com_ports_c2a_;  //!< I2C ports
+  PortTable<GpioPort> gpio_ports_c2a_;    //!< GPIO ports
+
+  static thread_local ObcWithC2a* executing_obc_;  //!< Instance executing C2A in the thread
+  static ObcWithC2a* default_obc_;                 //!< First instance used outside the execution
+  static ObcWithC2a* static_c2a_obc_;              //!< Instance using the statically linked C2A
 };
 
 // If the character encoding of C2A is UTF-8, the following functions are not necessary,
@@ -0,0 +1,46 @@
+/**
+ * @file test_on_board_computer.cpp
+ * @brief Test codes for OnBoardComputer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "on_board_computer.hpp"
+
+/**
+ * @brief Test for the register access of the I2C target devices by the components
+ */
+TEST(OnBoardComputer, I2cComponentRegister) {
+  ClockGenerator clock_generator;
+  OnBoardComputer obc(&clock_generator);
+  const int port_id = 3;
+  const unsigned char i2c_address = 0x44;
+  const unsigned char other_i2c_address = 0x20;
+  ASSERT_EQ(0, obc.I2cConnectPort(port_id, i2c_address));
+  ASSERT_EQ(0, obc.I2cConnectPort(port_id, other_i2c_address));
+
+  // The data are written in the consecutive registers
+  const unsigned char data[4] = {0x01, 0x02, 0x03, 0x04};
+  const unsigned char register_address = 0x10;
+  EXPECT_EQ(0, obc.I2cComponentWriteRegister(port_id, i2c_address, register_address, data, 4));
+  for (unsigned char i = 0; i < 4; i++) {
+    unsigned char value = 0xff;
+    EXPECT_EQ(0, obc.I2cComponentReadRegister(port_id, i2c_address, register_address + i, &value, 1));
+    EXPECT_EQ(data[i], value);
+  }
+  unsigned char read_data[6] = {0};
+  EXPECT_EQ(0, obc.I2cComponentReadRegister(port_id, i2c_address, register_address - 1, read_data, 6));
+  EXPECT_EQ(0x00, read_data[0]);
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_EQ(data[i], read_data[i + 1]);
+  }
+  EXPECT_EQ(0x00, read_data[5]);
+
+  // The register of the other device at the register address equal to the I2C address is not accessed
+  const unsigned char other_data = 0x55;
+  EXPECT_EQ(0, obc.I2cComponentWriteRegister(port_id, other_i2c_address, i2c_address, &other_data, 1));
+  unsigned char value = 0xff;
+  EXPECT_EQ(0, obc.I2cComponentReadRegister(port_id, i2c_address, other_i2c_address, &value, 1));
+  EXPECT_EQ(0x00, value);
+  EXPECT_EQ(0, obc.I2cComponentReadRegister(port_id, other_i2c_address, i2c_address, &value, 1));
+  EXPECT_EQ(other_data, value);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file test_on_board_computer_with_c2a.cpp
+ * @brief Test codes for ObcWithC2a class with the C2A shared library with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "on_board_computer_with_c2a.hpp"
+
+#ifdef USE_C2A_LIBRARY
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+const std::string kC2aLibraryPath = C2A_LIBRARY_FOR_TEST;  //!< Library built from c2a_library_for_test.cpp
+
+/**
+ * @struct Reply
+ * @brief Reply of the C2A library for test to a command byte
+ */
+struct Reply {
+  unsigned char command = 0;           //!< Received command byte
+  uint32_t master_clock = 0;           //!< Master clock of the instance when the command is received
+  unsigned char initialize_count = 0;  //!< Number of the initializations of the instance
+};
+
+/**
+ * @fn ConnectPorts
+ * @brief Connect the UART and GPIO ports used by the C2A library for test
+ * @param [in] obc: On board computer
+ */
+void ConnectPorts(ObcWithC2a& obc) {
+  ASSERT_EQ(0, obc.ConnectComPort(0, 64, 64));
+  ASSERT_EQ(0, obc.GpioConnectPort(0));
+  ASSERT_EQ(0, obc.GpioConnectPort(1));
+}
+
+/**
+ * @fn SendCommand
+ * @brief Send a command byte from the component and execute C2A once
+ * @param [in] obc: On board computer
+ * @param [in] command: Command byte
+ * @param [in] count: Count of the component tick
+ * @return Reply read by the component
+ */
+Reply SendCommand(ObcWithC2a& obc, unsigned char command, const unsigned int count) {
+  obc.SendFromCompo(0, &command, 0, 1);
+  obc.Tick(count);
+  unsigned char data[6] = {0};
+  Reply reply;
+  if (obc.ReceivedByCompo(0, data, 0, 6) != 6) return reply;
+  reply.command = data[0];
+  for (int i = 0; i < 4; i++) reply.master_clock |= (uint32_t)data[i + 1] << (8 * i);
+  reply.initialize_count = data[5];
+  return reply;
+}
+}  // namespace
+
+/**
+ * @brief Test for the private globals and the ports of the instances which load the same C2A library
+ */
+TEST(ObcWithC2a, MultipleInstances) {
+  ClockGenerator clock_generator;
+  PowerPort power_port;
+  ObcWithC2a obc_a(1, &clock_generator, 3, &power_port, kC2aLibraryPath);
+  ObcWithC2a obc_b(1, &clock_generator, 5, &power_port, kC2aLibraryPath);
+  ConnectPorts(obc_a);
+  ConnectPorts(obc_b);
+
+  // The clocks count up independently, and each instance is initialized once
+  for (unsigned int count = 0; count < 4; count++) {
+    const Reply reply_a = SendCommand(obc_a, (unsigned char)(0x10 + count), count);
+    EXPECT_EQ(0x10 + count, reply_a.command);
+    EXPECT_EQ(3 * count + 1, reply_a.master_clock);
+    EXPECT_EQ(1, reply_a.initialize_count);
+    const Reply reply_b = SendCommand(obc_b, (unsigned char)(0x20 + count), count);
+    EXPECT_EQ(0x20 + count, reply_b.command);
+    EXPECT_EQ(5 * count + 1, reply_b.master_clock);
+    EXPECT_EQ(1, reply_b.initialize_count);
+  }
+
+  // The GPIO accessed by C2A is the one of the executing instance
+  EXPECT_EQ(0, obc_a.GpioComponentWrite(0, true));
+  obc_a.Tick(4);
+  obc_b.Tick(4);
+  EXPECT_TRUE(obc_a.GpioComponentRead(1));
+  EXPECT_FALSE(obc_b.GpioComponentRead(1));
+}
+
+/**
+ * @brief Test for the instances executing C2A in the dedicated threads while the components tick concurrently
+ */
+TEST(ObcWithC2a, DedicatedThreads) {
+  const size_t number_of_instances = 3;
+  const unsigned int number_of_ticks = 50;
+  ClockGenerator clock_generator;
+  PowerPort power_port;
+  std::vector<std::unique_ptr<ObcWithC2a>> obcs;
+  for (size_t i = 0; i < number_of_instances; i++) {
+    // The first thread is pinned to the CPU core 0
+    obcs.push_back(std::make_unique<ObcWithC2a>(1, &clock_generator, (int)(i + 1), &power_port, kC2aLibraryPath, true, i == 0 ? 0 : -1));
+    ConnectPorts(*obcs.back());
+  }
+
+  std::vector<std::vector<Reply>> replies(number_of_instances);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < number_of_instances; i++) {
+    threads.emplace_back([&, i]() {
+      for (unsigned int count = 0; count < number_of_ticks; count++) {
+        replies[i].push_back(SendCommand(*obcs[i], (unsigned char)(i * 100 + count), count));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (size_t i = 0; i < number_of_instances; i++) {
+    ASSERT_EQ(number_of_ticks, replies[i].size());
+    for (unsigned int count = 0; count < number_of_ticks; count++) {
+      EXPECT_EQ((unsigned char)(i * 100 + count), replies[i][count].command);
+      EXPECT_EQ((i + 1) * count + 1, replies[i][count].master_clock);
+      EXPECT_EQ(1, replies[i][count].initialize_count);
+    }
+  }
+}
+
+/**
+ * @brief Test for the C2A library which cannot be loaded
+ */
+TEST(ObcWithC2a, InvalidLibrary) {
+  ClockGenerator clock_generator;
+  PowerPort power_port;
+  EXPECT_THROW(ObcWithC2a(1, &clock_generator, 1, &power_port, "missing_c2a_library.so"), std::runtime_error);
+  // The file which is not a shared library
+  EXPECT_THROW(C2aLibrary(CORE_DIR_FROM_EXE + std::string("/CMakeLists.txt")), std::runtime_error);
+}
+#else
+/**
+ * @brief Test for the C2A library without the USE_C2A_LIBRARY option
+ */
+TEST(ObcWithC2a, LibraryNotSupported) {
+  ClockGenerator clock_generator;
+  PowerPort power_port;
+  EXPECT_THROW(ObcWithC2a(1, &clock_generator, 1, &power_port, "c2a_library.so"), std::runtime_error);
+}
+#endif  // USE_C2A_LIBRARY
@@ -5,17 +5,19 @@
 
 #include "antenna_radiation_pattern.hpp"
 
-#include <algorithm>
 #include <math_physics/math/s2e_math.hpp>
-#include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
+#include <utilities/shared_data_registry.hpp>
 
-AntennaRadiationPattern::AntennaRadiationPattern() { gain_dBi_.assign(length_theta_, std::vector<double>(length_phi_, 0.0)); }
+AntennaRadiationPattern::AntennaRadiationPattern() : gain_dBi_(std::make_shared<const NumericCsvTable>(length_theta_, length_phi_, 0.0)) {}
 
 AntennaRadiationPattern::AntennaRadiationPattern(const std::string file_path, const size_t length_theta, const size_t length_phi,
                                                  const double theta_max_rad, const double phi_max_rad)
     : length_theta_(length_theta), length_phi_(length_phi), theta_max_rad_(theta_max_rad), phi_max_rad_(phi_max_rad) {
-  IniAccess gain_file(file_path);
-  gain_file.ReadCsvDouble(gain_dBi_, (std::max)(length_theta_, length_phi_));
+  gain_dBi_ = SharedDataRegistry<NumericCsvTable>::Get(file_path, [&file_path]() { return std::make_shared<const NumericCsvTable>(file_path, 0); });
+  if (gain_dBi_->GetNumberOfRows() < length_theta_ || gain_dBi_->GetNumberOfColumns() < length_phi_) {
+    throw std::invalid_argument(file_path + " is smaller than length_theta x length_phi.");
+  }
 }
 
 AntennaRadiationPattern::~AntennaRadiationPattern() {}
@@ -35,5 +37,5 @@ double AntennaRadiationPattern::GetGain_dBi(const double theta_rad, const double
   size_t phi_idx = (size_t)(length_phi_ * phi_rad_clipped / phi_max_rad_ + 0.5);
   if (phi_idx >= length_phi_) phi_idx = length_phi_ - 1;
 
-  return gain_dBi_[theta_idx][phi_idx];
+  return gain_dBi_->GetValue(theta_idx, phi_idx);
 }
@@ -7,6 +7,8 @@
 #define S2E_COMPONENTS_REAL_COMMUNICATION_ANTENNA_RADIATION_PATTERN_HPP_
 
 #include <math_physics/math/constants.hpp>
+#include <memory>
+#include <setting_file_reader/numeric_csv_table.hpp>
 #include <string>
 #include <vector>
 
@@ -59,7 +61,7 @@ class AntennaRadiationPattern {
   double theta_max_rad_ = libra::tau;  //!< Maximum value of theta
   double phi_max_rad_ = libra::pi;     //!< Maximum value of phi
 
-  std::vector<std::vector<double>> gain_dBi_;  //!< Antenna gain table [dBi]
+  std::shared_ptr<const NumericCsvTable> gain_dBi_;  //!< Antenna gain table [dBi] (theta, phi) shared between the antennas with the same file
 };
 
 #endif  // S2E_COMPONENTS_REAL_COMMUNICATION_ANTENNA_RADIATION_PATTERN_HPP_
@@ -31,8 +31,10 @@ void GroundStationCalculator::Update(const Spacecraft& spacecraft, const Antenna
                                      const Antenna& ground_station_rx_antenna) {
   bool is_visible = ground_station.IsVisible(spacecraft.GetSpacecraftId());
   if (is_visible) {
-    max_bitrate_Mbps_ = CalcMaxBitrate(spacecraft.GetDynamics(), spacecraft_tx_antenna, ground_station, ground_station_rx_antenna);
-    receive_margin_dB_ = CalcReceiveMarginOnGs(spacecraft.GetDynamics(), spacecraft_tx_antenna, ground_station, ground_station_rx_antenna);
+    // CN0 is shared by the max bitrate and the receive margin
+    double cn0_dBHz = CalcCn0OnGs(spacecraft.GetDynamics(), spacecraft_tx_antenna, ground_station, ground_station_rx_antenna);
+    max_bitrate_Mbps_ = CalcMaxBitrate_Mbps(cn0_dBHz);
+    receive_margin_dB_ = CalcReceiveMargin_dB(cn0_dBHz, spacecraft_tx_antenna);
   } else {
     max_bitrate_Mbps_ = 0.0;
     receive_margin_dB_ = -10000.0;  // FIXME: which value is suitable?
@@ -43,21 +45,13 @@ void GroundStationCalculator::Update(const Spacecraft& spacecraft, const Antenna
 double GroundStationCalculator::CalcMaxBitrate(const Dynamics& dynamics, const Antenna& spacecraft_tx_antenna, const GroundStation& ground_station,
                                                const Antenna& ground_station_rx_antenna) {
   double cn0_dBHz = CalcCn0OnGs(dynamics, spacecraft_tx_antenna, ground_station, ground_station_rx_antenna);
-
-  double margin_for_bitrate_dB = cn0_dBHz - (ebn0_dB_ + hardware_deterioration_dB_ + coding_gain_dB_) - margin_requirement_dB_;
-
-  if (margin_for_bitrate_dB > 0) {
-    return pow(10.0, margin_for_bitrate_dB / 10.0) / 1000000.0;
-  } else {
-    return 0.0;
-  }
+  return CalcMaxBitrate_Mbps(cn0_dBHz);
 }
 
 double GroundStationCalculator::CalcReceiveMarginOnGs(const Dynamics& dynamics, const Antenna& spacecraft_tx_antenna,
                                                       const GroundStation& ground_station, const Antenna& ground_station_rx_antenna) {
   double cn0_dB = CalcCn0OnGs(dynamics, spacecraft_tx_antenna, ground_station, ground_station_rx_antenna);
-  double cn0_requirement_dB = ebn0_dB_ + hardware_deterioration_dB_ + coding_gain_dB_ + 10.0 * log10(spacecraft_tx_antenna.GetBitrate_bps());
-  return cn0_dB - cn0_requirement_dB;
+  return CalcReceiveMargin_dB(cn0_dB, spacecraft_tx_antenna);
 }
 
 double GroundStationCalculator::CalcCn0OnGs(const Dynamics& dynamics, const Antenna& spacecraft_tx_antenna, const GroundStation& ground_station,
@@ -66,13 +60,11 @@ double GroundStationCalculator::CalcCn0OnGs(const Dynamics& dynamics, const Ante
     // Check compatibility of transmitter and receiver
     return 0.0f;
   }
-  // Free space path loss
+  // Distance
   Vector<3> sc_pos_i = dynamics.GetOrbit().GetPosition_i_m();
   Vector<3> gs_pos_i = ground_station.GetPosition_i_m();
   Vector<3> pos_gs2sc_i = sc_pos_i - gs_pos_i;
-
-  double dist_sc_gs_km = pos_gs2sc_i.CalcNorm() / 1000.0;
-  double loss_space_dB = -20.0 * log10(4.0 * libra::pi * dist_sc_gs_km / (300.0 / spacecraft_tx_antenna.GetFrequency_MHz() / 1000.0));
+  double distance_m = pos_gs2sc_i.CalcNorm();
 
   // GS direction on SC TX antenna frame
   Vector<3> sc_to_gs_i = gs_pos_i - sc_pos_i;
@@ -90,6 +82,22 @@ double GroundStationCalculator::CalcCn0OnGs(const Dynamics& dynamics, const Ante
   double theta_on_gs_antenna_rad = acos(sc_direction_on_gs_frame[2]);
   double phi_on_gs_antenna_rad = atan2(sc_direction_on_gs_frame[1], sc_direction_on_gs_frame[0]);
 
+  return CalcCn0OnGs_dBHz(spacecraft_tx_antenna, theta_on_sc_antenna_rad, phi_on_sc_antenna_rad, ground_station_rx_antenna, theta_on_gs_antenna_rad,
+                          phi_on_gs_antenna_rad, distance_m);
+}
+
+double GroundStationCalculator::CalcCn0OnGs_dBHz(const Antenna& spacecraft_tx_antenna, const double theta_on_sc_antenna_rad,
+                                                 const double phi_on_sc_antenna_rad, const Antenna& ground_station_rx_antenna,
+                                                 const double theta_on_gs_antenna_rad, const double phi_on_gs_antenna_rad,
+                                                 const double distance_m) const {
+  if (!spacecraft_tx_antenna.IsTransmitter() || !ground_station_rx_antenna.IsReceiver()) {
+    // Check compatibility of transmitter and receiver
+    return 0.0f;
+  }
+  // Free space path loss
+  double dist_sc_gs_km = distance_m / 1000.0;
+  double loss_space_dB = -20.0 * log10(4.0 * libra::pi * dist_sc_gs_km / (300.0 / spacecraft_tx_antenna.GetFrequency_MHz() / 1000.0));
+
   // Calc CN0
   double cn0_dBHz = spacecraft_tx_antenna.CalcTxEirp_dBW(theta_on_sc_antenna_rad, phi_on_sc_antenna_rad) + loss_space_dB + loss_polarization_dB_ +
                     loss_atmosphere_dB_ + loss_rainfall_dB_ + loss_others_dB_ +
@@ -98,6 +106,21 @@ double GroundStationCalculator::CalcCn0OnGs(const Dynamics& dynamics, const Ante
   return cn0_dBHz;
 }
 
+double GroundStationCalculator::CalcMaxBitrate_Mbps(const double cn0_dBHz) const {
+  double margin_for_bitrate_dB = cn0_dBHz - (ebn0_dB_ + hardware_deterioration_dB_ + coding_gain_dB_) - margin_requirement_dB_;
+
+  if (margin_for_bitrate_dB > 0) {
+    return pow(10.0, margin_for_bitrate_dB / 10.0) / 1000000.0;
+  } else {
+    return 0.0;
+  }
+}
+
+double GroundStationCalculator::CalcReceiveMargin_dB(const double cn0_dBHz, const Antenna& spacecraft_tx_antenna) const {
+  double cn0_requirement_dB = ebn0_dB_ + hardware_deterioration_dB_ + coding_gain_dB_ + 10.0 * log10(spacecraft_tx_antenna.GetBitrate_bps());
+  return cn0_dBHz - cn0_requirement_dB;
+}
+
 std::string GroundStationCalculator::GetLogHeader() const {
   std::string str_tmp = "";
   std::string component_name = "gs_calculator_";
@@ -52,6 +52,38 @@ class GroundStationCalculator : public ILoggable {
   void Update(const Spacecraft& spacecraft, const Antenna& spacecraft_tx_antenna, const GroundStation& ground_station,
               const Antenna& ground_station_rx_antenna);
 
+  // Link budget from the geometry (e.g., for GroundStationLinkEvaluator)
+  /**
+   * @fn CalcCn0OnGs_dBHz
+   * @brief Calculate CN0 (Carrier to Noise density ratio) of received signal at the ground station from the geometry
+   * @param [in] spacecraft_tx_antenna: Tx Antenna mounted on spacecraft
+   * @param [in] theta_on_sc_antenna_rad: Theta of the ground station direction in the spacecraft antenna frame [rad]
+   * @param [in] phi_on_sc_antenna_rad: Phi of the ground station direction in the spacecraft antenna frame [rad]
+   * @param [in] ground_station_rx_antenna: Rx Antenna mounted on ground station
+   * @param [in] theta_on_gs_antenna_rad: Theta of the spacecraft direction in the ground station antenna frame [rad]
+   * @param [in] phi_on_gs_antenna_rad: Phi of the spacecraft direction in the ground station antenna frame [rad]
+   * @param [in] distance_m: Distance between the spacecraft and the ground station [m]
+   * @return CN0 [dBHz]
+   */
+  double CalcCn0OnGs_dBHz(const Antenna& spacecraft_tx_antenna, const double theta_on_sc_antenna_rad, const double phi_on_sc_antenna_rad,
+                          const Antenna& ground_station_rx_antenna, const double theta_on_gs_antenna_rad, const double phi_on_gs_antenna_rad,
+                          const double distance_m) const;
+  /**
+   * @fn CalcMaxBitrate_Mbps
+   * @brief Calculate the maximum bitrate from CN0
+   * @param [in] cn0_dBHz: CN0 [dBHz]
+   * @return Max bitrate [Mbps]
+   */
+  double CalcMaxBitrate_Mbps(const double cn0_dBHz) const;
+  /**
+   * @fn CalcReceiveMargin_dB
+   * @brief Calculate receive margin at the ground station from CN0
+   * @param [in] cn0_dBHz: CN0 [dBHz]
+   * @param [in] spacecraft_tx_antenna: Tx Antenna mounted on spacecraft
+   * @return Receive margin [dB]
+   */
+  double CalcReceiveMargin_dB(const double cn0_dBHz, const Antenna& spacecraft_tx_antenna) const;
+
   // Override ILoggable TODO: Maybe we don't need logabble, and this class should be used as library.
   /**
    * @fn GetLogHeader
@@ -0,0 +1,155 @@
+/*
+ * @file ground_station_link_evaluator.cpp
+ * @brief Batched evaluation of the visibility and the link budget between many spacecraft and ground stations
+ */
+
+#include "ground_station_link_evaluator.hpp"
+
+#include <cmath>
+#include <math_physics/math/constants.hpp>
+
+GroundStationLinkEvaluator::GroundStationLinkEvaluator(const GroundStationCalculator& link_budget_calculator)
+    : link_budget_calculator_(link_budget_calculator) {}
+
+size_t GroundStationLinkEvaluator::AddSpacecraft(const Spacecraft& spacecraft, const Antenna& spacecraft_tx_antenna) {
+  spacecraft_list_.push_back(&spacecraft);
+  spacecraft_tx_antennas_.push_back(&spacecraft_tx_antenna);
+  ResizeMatrices();
+  return spacecraft_list_.size() - 1;
+}
+
+size_t GroundStationLinkEvaluator::AddGroundStation(const GroundStation& ground_station, const Antenna& ground_station_rx_antenna) {
+  ground_station_list_.push_back(&ground_station);
+  ground_station_rx_antennas_.push_back(&ground_station_rx_antenna);
+
+  // The ground stations are fixed on the ECEF frame, so the geometry is calculated once here
+  libra::Vector<3> position_ecef_m = ground_station.GetPosition_ecef_m();
+  ground_station_x_ecef_m_.push_back(position_ecef_m[0]);
+  ground_station_y_ecef_m_.push_back(position_ecef_m[1]);
+  ground_station_z_ecef_m_.push_back(position_ecef_m[2]);
+
+  libra::Quaternion q_ecef_to_ltc = ground_station.GetGeodeticPosition().GetQuaternionXcxfToLtc();
+  libra::Vector<3> zenith_ltc(0.0);
+  zenith_ltc[2] = 1.0;
+  libra::Vector<3> zenith_ecef = q_ecef_to_ltc.InverseFrameConversion(zenith_ltc);
+  ground_station_zenith_x_ecef_.push_back(zenith_ecef[0]);
+  ground_station_zenith_y_ecef_.push_back(zenith_ecef[1]);
+  ground_station_zenith_z_ecef_.push_back(zenith_ecef[2]);
+
+  sin_elevation_limit_.push_back(sin(ground_station.GetElevationLimitAngle_deg() * libra::deg_to_rad));
+  quaternion_ecef2antenna_.push_back(ground_station_rx_antenna.GetQuaternion_b2c() * q_ecef_to_ltc);
+
+  ResizeMatrices();
+  return ground_station_list_.size() - 1;
+}
+
+void GroundStationLinkEvaluator::Update() {
+  const size_t number_of_ground_stations = ground_station_list_.size();
+  const double* gs_x = ground_station_x_ecef_m_.data();
+  const double* gs_y = ground_station_y_ecef_m_.data();
+  const double* gs_z = ground_station_z_ecef_m_.data();
+  const double* zenith_x = ground_station_zenith_x_ecef_.data();
+  const double* zenith_y = ground_station_zenith_y_ecef_.data();
+  const double* zenith_z = ground_station_zenith_z_ecef_.data();
+  const double* sin_limit = sin_elevation_limit_.data();
+  double* distance_m = distance_m_.data();
+  unsigned char* is_visible = visibility_buffer_.data();
+
+  number_of_visible_pairs_ = 0;
+  for (size_t sc_id = 0; sc_id < spacecraft_list_.size(); sc_id++) {
+    const Dynamics& dynamics = spacecraft_list_[sc_id]->GetDynamics();
+    const libra::Vector<3> sc_position_ecef_m = dynamics.GetOrbit().GetPosition_ecef_m();
+    const double sc_x = sc_position_ecef_m[0];
+    const double sc_y = sc_position_ecef_m[1];
+    const double sc_z = sc_position_ecef_m[2];
+
+    // Range and visibility for all ground stations without branches
+    // The elevation test (d / |d|) . zenith > sin(limit) is evaluated as d . zenith > sin(limit) * |d| to avoid the division
+    for (size_t gs_id = 0; gs_id < number_of_ground_stations; gs_id++) {
+      const double dx = sc_x - gs_x[gs_id];
+      const double dy = sc_y - gs_y[gs_id];
+      const double dz = sc_z - gs_z[gs_id];
+      const double distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+      const double up = dx * zenith_x[gs_id] + dy * zenith_y[gs_id] + dz * zenith_z[gs_id];
+      distance_m[gs_id] = distance;
+      is_visible[gs_id] = (unsigned char)(up > sin_limit[gs_id] * distance);
+    }
+
+    // Link budget only for the visible pairs
+    const Antenna& tx_antenna = *spacecraft_tx_antennas_[sc_id];
+    const libra::Vector<3> sc_position_i_m = dynamics.GetOrbit().GetPosition_i_m();
+    const libra::Quaternion q_i_to_sc_ant = tx_antenna.GetQuaternion_b2c() * dynamics.GetAttitude().GetQuaternion_i2b();
+    for (size_t gs_id = 0; gs_id < number_of_ground_stations; gs_id++) {
+      const size_t index = GetMatrixIndex(sc_id, gs_id);
+      visibility_[index] = is_visible[gs_id];
+      if (!is_visible[gs_id]) {
+        max_bitrate_Mbps_[index] = 0.0;
+        receive_margin_dB_[index] = kInvisibleMargin_dB;
+        continue;
+      }
+      number_of_visible_pairs_++;
+
+      // GS direction on SC TX antenna frame
+      libra::Vector<3> sc_to_gs_i = ground_station_list_[gs_id]->GetPosition_i_m() - sc_position_i_m;
+      sc_to_gs_i = sc_to_gs_i.CalcNormalizedVector();
+      libra::Vector<3> gs_direction_on_sc_frame = q_i_to_sc_ant.FrameConversion(sc_to_gs_i);
+      double theta_on_sc_antenna_rad = acos(gs_direction_on_sc_frame[2]);
+      double phi_on_sc_antenna_rad = atan2(gs_direction_on_sc_frame[1], gs_direction_on_sc_frame[0]);
+
+      // SC direction on GS RX antenna frame
+      libra::Vector<3> gs_to_sc_ecef;
+      gs_to_sc_ecef[0] = (sc_x - gs_x[gs_id]) / distance_m[gs_id];
+      gs_to_sc_ecef[1] = (sc_y - gs_y[gs_id]) / distance_m[gs_id];
+      gs_to_sc_ecef[2] = (sc_z - gs_z[gs_id]) / distance_m[gs_id];
+      libra::Vector<3> sc_direction_on_gs_frame = quaternion_ecef2antenna_[gs_id].FrameConversion(gs_to_sc_ecef);
+      double theta_on_gs_antenna_rad = acos(sc_direction_on_gs_frame[2]);
+      double phi_on_gs_antenna_rad = atan2(sc_direction_on_gs_frame[1], sc_direction_on_gs_frame[0]);
+
+      // The range in the inertial frame is the same as in the ECEF frame
+      double cn0_dBHz =
+          link_budget_calculator_.CalcCn0OnGs_dBHz(tx_antenna, theta_on_sc_antenna_rad, phi_on_sc_antenna_rad, *ground_station_rx_antennas_[gs_id],
+                                                   theta_on_gs_antenna_rad, phi_on_gs_antenna_rad, distance_m[gs_id]);
+      max_bitrate_Mbps_[index] = link_budget_calculator_.CalcMaxBitrate_Mbps(cn0_dBHz);
+      receive_margin_dB_[index] = link_budget_calculator_.CalcReceiveMargin_dB(cn0_dBHz, tx_antenna);
+    }
+  }
+}
+
+std::string GroundStationLinkEvaluator::GetLogHeader() const {
+  std::string str_tmp = "";
+  std::string component_name = "gs_link_";
+
+  str_tmp += WriteScalar(component_name + "number_of_visible_pairs", "-");
+  for (size_t sc_id = 0; sc_id < spacecraft_list_.size(); sc_id++) {
+    for (size_t gs_id = 0; gs_id < ground_station_list_.size(); gs_id++) {
+      std::string pair_name = component_name + "sc" + std::to_string(spacecraft_list_[sc_id]->GetSpacecraftId()) + "_gs" +
+                              std::to_string(ground_station_list_[gs_id]->GetGroundStationId()) + "_";
+      str_tmp += WriteScalar(pair_name + "max_bitrate", "Mbps");
+      str_tmp += WriteScalar(pair_name + "receive_margin", "dB");
+    }
+  }
+
+  return str_tmp;
+}
+
+std::string GroundStationLinkEvaluator::GetLogValue() const {
+  std::string str_tmp = "";
+
+  str_tmp += WriteScalar(number_of_visible_pairs_);
+  for (size_t index = 0; index < receive_margin_dB_.size(); index++) {
+    str_tmp += WriteScalar(max_bitrate_Mbps_[index]);
+    str_tmp += WriteScalar(receive_margin_dB_[index]);
+  }
+
+  return str_tmp;
+}
+
+void GroundStationLinkEvaluator::ResizeMatrices() {
+  const size_t number_of_pairs = spacecraft_list_.size() * ground_station_list_.size();
+  visibility_.assign(number_of_pairs, 0);
+  max_bitrate_Mbps_.assign(number_of_pairs, 0.0);
+  receive_margin_dB_.assign(number_of_pairs, kInvisibleMargin_dB);
+  distance_m_.assign(ground_station_list_.size(), 0.0);
+  visibility_buffer_.assign(ground_station_list_.size(), 0);
+  number_of_visible_pairs_ = 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * @file ground_station_link_evaluator.hpp
+ * @brief Batched evaluation of the visibility and the link budget between many spacecraft and ground stations
+ */
+
+#ifndef S2E_COMPONENTS_REAL_COMMUNICATION_GROUND_STATION_LINK_EVALUATOR_HPP_
+#define S2E_COMPONENTS_REAL_COMMUNICATION_GROUND_STATION_LINK_EVALUATOR_HPP_
+
+#include <components/real/communication/antenna.hpp>
+#include <logger/loggable.hpp>
+#include <simulation/ground_station/ground_station.hpp>
+#include <simulation/spacecraft/spacecraft.hpp>
+#include <vector>
+
+#include "ground_station_calculator.hpp"
+
+/*
+ * @class GroundStationLinkEvaluator
+ * @brief Batched evaluation of the visibility and the link budget between many spacecraft and ground stations
+ * @details The ground station positions, zenith directions, and elevation limits are stored as structure of arrays in the ECEF frame, so the
+ *          visibility of a spacecraft from all ground stations is judged in a single loop which the compiler can vectorize.
+ *          The antenna angles and the link budget are calculated only for the visible pairs with the same equations as
+ *          GroundStationCalculator. The results are stored in spacecraft x ground station matrices in the row-major order.
+ * @note The ground stations must be updated (GroundStation::Update) before Update since their inertial positions are used.
+ */
+class GroundStationLinkEvaluator : public ILoggable {
+ public:
+  /**
+   * @fn GroundStationLinkEvaluator
+   * @brief Constructor
+   * @param [in] link_budget_calculator: Calculator which has the loss and requirement parameters of the link budget
+   */
+  GroundStationLinkEvaluator(const GroundStationCalculator& link_budget_calculator);
+
+  /**
+   * @fn AddSpacecraft
+   * @brief Add a spacecraft and its TX antenna. The matrices are resized.
+   * @param [in] spacecraft: Spacecraft
+   * @param [in] spacecraft_tx_antenna: TX antenna mounted on the spacecraft
+   * @return Index of the spacecraft in the matrices
+   */
+  size_t AddSpacecraft(const Spacecraft& spacecraft, const Antenna& spacecraft_tx_antenna);
+  /**
+   * @fn AddGroundStation
+   * @brief Add a ground station and its RX antenna. The matrices are resized.
+   * @param [in] ground_station: Ground station
+   * @param [in] ground_station_rx_antenna: RX antenna mounted on the ground station
+   * @return Index of the ground station in the matrices
+   */
+  size_t AddGroundStation(const GroundStation& ground_station, const Antenna& ground_station_rx_antenna);
+
+  /**
+   * @fn Update
+   * @brief Update the visibility, the max bitrate, and the receive margin of all pairs
+   */
+  void Update();
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfSpacecraft
+   * @brief Return number of the spacecraft
+   */
+  inline size_t GetNumberOfSpacecraft() const { return spacecraft_list_.size(); }
+  /**
+   * @fn GetNumberOfGroundStations
+   * @brief Return number of the ground stations
+   */
+  inline size_t GetNumberOfGroundStations() const { return ground_station_list_.size(); }
+  /**
+   * @fn GetNumberOfVisiblePairs
+   * @brief Return number of the visible pairs in the latest update
+   */
+  inline size_t GetNumberOfVisiblePairs() const { return number_of_visible_pairs_; }
+  /**
+   * @fn IsVisible
+   * @brief Return true when the spacecraft is visible from the ground station
+   * @param [in] spacecraft_index: Index of the spacecraft
+   * @param [in] ground_station_index: Index of the ground station
+   */
+  inline bool IsVisible(const size_t spacecraft_index, const size_t ground_station_index) const {
+    return visibility_[GetMatrixIndex(spacecraft_index, ground_station_index)] != 0;
+  }
+  /**
+   * @fn GetMaxBitrate_Mbps
+   * @brief Return max bitrate [Mbps]. Zero for the invisible pairs.
+   * @param [in] spacecraft_index: Index of the spacecraft
+   * @param [in] ground_station_index: Index of the ground station
+   */
+  inline double GetMaxBitrate_Mbps(const size_t spacecraft_index, const size_t ground_station_index) const {
+    return max_bitrate_Mbps_[GetMatrixIndex(spacecraft_index, ground_station_index)];
+  }
+  /**
+   * @fn GetReceiveMargin_dB
+   * @brief Return receive margin [dB]. kInvisibleMargin_dB for the invisible pairs.
+   * @param [in] spacecraft_index: Index of the spacecraft
+   * @param [in] ground_station_index: Index of the ground station
+   */
+  inline double GetReceiveMargin_dB(const size_t spacecraft_index, const size_t ground_station_index) const {
+    return receive_margin_dB_[GetMatrixIndex(spacecraft_index, ground_station_index)];
+  }
+  /**
+   * @fn GetVisibilityMatrix
+   * @brief Return visibility matrix (spacecraft x ground station, row-major). 1: visible, 0: invisible
+   */
+  inline const std::vector<unsigned char>& GetVisibilityMatrix() const { return visibility_; }
+  /**
+   * @fn GetReceiveMarginMatrix_dB
+   * @brief Return receive margin matrix (spacecraft x ground station, row-major) [dB]
+   */
+  inline const std::vector<double>& GetReceiveMarginMatrix_dB() const { return receive_margin_dB_; }
+
+  static constexpr double kInvisibleMargin_dB = -10000.0;  //!< Receive margin of the invisible pairs (same as GroundStationCalculator) [dB]
+
+ private:
+  const GroundStationCalculator link_budget_calculator_;  //!< Calculator of the link budget
+
+  std::vector<const Spacecraft*> spacecraft_list_;          //!< Spacecraft
+  std::vector<const Antenna*> spacecraft_tx_antennas_;      //!< TX antennas of the spacecraft
+  std::vector<const GroundStation*> ground_station_list_;   //!< Ground stations
+  std::vector<const Antenna*> ground_station_rx_antennas_;  //!< RX antennas of the ground stations
+
+  // Ground stations in structure of arrays
+  std::vector<double> ground_station_x_ecef_m_;             //!< X position in the ECEF frame [m]
+  std::vector<double> ground_station_y_ecef_m_;             //!< Y position in the ECEF frame [m]
+  std::vector<double> ground_station_z_ecef_m_;             //!< Z position in the ECEF frame [m]
+  std::vector<double> ground_station_zenith_x_ecef_;        //!< X of the zenith direction in the ECEF frame
+  std::vector<double> ground_station_zenith_y_ecef_;        //!< Y of the zenith direction in the ECEF frame
+  std::vector<double> ground_station_zenith_z_ecef_;        //!< Z of the zenith direction in the ECEF frame
+  std::vector<double> sin_elevation_limit_;                 //!< Sine of the elevation limit angle
+  std::vector<libra::Quaternion> quaternion_ecef2antenna_;  //!< Quaternion from the ECEF frame to the RX antenna frame
+
+  // Work space for a spacecraft
+  std::vector<double> distance_m_;                //!< Distance to each ground station [m]
+  std::vector<unsigned char> visibility_buffer_;  //!< Visibility from each ground station
+
+  // Results
+  std::vector<unsigned char> visibility_;  //!< Visibility matrix
+  std::vector<double> max_bitrate_Mbps_;   //!< Max bitrate matrix [Mbps]
+  std::vector<double> receive_margin_dB_;  //!< Receive margin matrix [dB]
+  size_t number_of_visible_pairs_ = 0;     //!< Number of the visible pairs
+
+  /**
+   * @fn GetMatrixIndex
+   * @brief Return index of the pair in the matrices
+   */
+  inline size_t GetMatrixIndex(const size_t spacecraft_index, const size_t ground_station_index) const {
+    return spacecraft_index * ground_station_list_.size() + ground_station_index;
+  }
+  /**
+   * @fn ResizeMatrices
+   * @brief Resize the matrices and the work space with the numbers of the spacecraft and the ground stations
+   */
+  void ResizeMatrices();
+};
+
+#endif  // S2E_COMPONENTS_REAL_COMMUNICATION_GROUND_STATION_LINK_EVALUATOR_HPP_
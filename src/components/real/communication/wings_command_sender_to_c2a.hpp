@@ -28,7 +28,10 @@ class WingsCommandSenderToC2a : public Component {
         c2a_command_database_(command_database_file),
         wings_operation_file_(operation_file),
         is_enabled_(is_enabled),
-        step_width_s_(step_width_s) {}
+        step_width_s_(step_width_s) {
+    // The command names are resolved and the parameters are encoded only once here
+    wings_operation_file_.Precompile(c2a_command_database_);
+  }
 
   /**
    * @fn ~WingsCommandSenderToC2a
@@ -52,18 +55,11 @@ class WingsCommandSenderToC2a : public Component {
   void MainRoutine(const int time_count) override;
 
   /**
-   * @fn ExecuteCommandLine
-   * @brief Execute command line
-   * @param[in] line: Executed line
+   * @fn ExecuteOperation
+   * @brief Execute the precompiled operation
+   * @param[in] operation: Executed operation
    */
-  void ExecuteCommandLine(const std::string line);
-
-  /**
-   * @fn AnalyzeC2aCommand
-   * @brief Analyze C2A command Line
-   * @param[in] tokens: Command line after space separation
-   */
-  void AnalyzeC2aCommand(const std::vector<std::string> tokens);
+  void ExecuteOperation(const WingsOperation& operation);
 };
 
 /**
@@ -5,10 +5,12 @@
 
 #include "telescope.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <environment/global/physical_constants.hpp>
 #include <math_physics/math/constants.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <utilities/macros.hpp>
 
 using namespace std;
 using namespace libra;
@@ -43,6 +45,7 @@ Telescope::Telescope(ClockGenerator* clock_generator, const libra::Quaternion& q
 
   sight_direction_c_ = Vector<3>(0);
   sight_direction_c_[0] = 1;  // (1,0,0) at component frame, Sight direction vector
+  sight_direction_b_ = quaternion_b2c_.InverseFrameConversion(sight_direction_c_);
 
   // Set 0 when t=0
   for (size_t i = 0; i < number_of_logged_stars_; i++) {
@@ -78,7 +81,12 @@ void Telescope::MainRoutine(const int time_count) {
   Observe(moon_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"));
   // Position calculation of stars from Hipparcos Catalogue
   // No update when Hipparcos Catalogue was not read
-  if (hipparcos_->IsCalcEnabled) ObserveStars();
+  if (hipparcos_->IsCalcEnabled) {
+    // The stars are not observed when they are neither logged nor rendered
+    const bool is_any_star_log_selected = UpdateStarLogSelection();
+    if (is_any_star_log_selected || star_image_renderer_ != nullptr) ObserveStars();
+    if (star_image_renderer_ != nullptr) RenderStarImage();
+  }
   // Debug ******************************************************************
   //  sun_pos_c = quaternion_b2c_.FrameConversion(dynamics_->celestial_->GetPositionFromSpacecraft_b_m("SUN"));
   //  earth_pos_c = quaternion_b2c_.FrameConversion(dynamics_->celestial_->GetPositionFromSpacecraft_b_m("EARTH"));
@@ -89,12 +97,43 @@ void Telescope::MainRoutine(const int time_count) {
   //******************************************************************************
   // Direction calculation of ground point
   ObserveGroundPositionDeviation();
+  ObserveGroundTargets();
+}
+
+void Telescope::EnableStarImage(const double psf_sigma_pix, const double reference_count) {
+  if (x_number_of_pix_ <= 0 || y_number_of_pix_ <= 0) return;
+  star_image_renderer_ = std::make_shared<libra::StarImageRenderer>((size_t)x_number_of_pix_, (size_t)y_number_of_pix_, psf_sigma_pix);
+  star_image_reference_count_ = reference_count;
+}
+
+size_t Telescope::AddGroundTarget(const GeodeticPosition& position) {
+  const libra::Vector<3> position_ecef_m = position.CalcEcefPosition();
+  ground_target_position_x_ecef_m_.push_back(position_ecef_m[0]);
+  ground_target_position_y_ecef_m_.push_back(position_ecef_m[1]);
+  ground_target_position_z_ecef_m_.push_back(position_ecef_m[2]);
+  const double cos_latitude = cos(position.GetLatitude_rad());
+  ground_target_up_x_ecef_.push_back(cos_latitude * cos(position.GetLongitude_rad()));
+  ground_target_up_y_ecef_.push_back(cos_latitude * sin(position.GetLongitude_rad()));
+  ground_target_up_z_ecef_.push_back(sin(position.GetLatitude_rad()));
+  ground_target_position_x_image_sensor_.push_back(-1.0);
+  ground_target_position_y_image_sensor_.push_back(-1.0);
+  return ground_target_position_x_ecef_m_.size() - 1;
+}
+
+void Telescope::ClearGroundTargets() {
+  ground_target_position_x_ecef_m_.clear();
+  ground_target_position_y_ecef_m_.clear();
+  ground_target_position_z_ecef_m_.clear();
+  ground_target_up_x_ecef_.clear();
+  ground_target_up_y_ecef_.clear();
+  ground_target_up_z_ecef_.clear();
+  ground_target_position_x_image_sensor_.clear();
+  ground_target_position_y_image_sensor_.clear();
+  ground_target_candidates_.clear();
 }
 
 bool Telescope::JudgeForbiddenAngle(const libra::Vector<3>& target_b, const double forbidden_angle) {
-  libra::Quaternion q_c2b = quaternion_b2c_.Conjugate();
-  libra::Vector<3> sight_b = q_c2b.FrameConversion(sight_direction_c_);
-  double angle_rad = libra::CalcAngleTwoVectors_rad(target_b, sight_b);
+  double angle_rad = libra::CalcAngleTwoVectors_rad(target_b, sight_direction_b_);
   if (angle_rad < forbidden_angle) {
     return true;
   } else
@@ -119,10 +158,17 @@ void Telescope::ObserveStars() {
   Quaternion quaternion_i2b = attitude_->GetQuaternion_i2b();
 
   star_list_in_sight.clear();  // Clear first
-  size_t count = 0;            // Counter for while loop
 
-  while (star_list_in_sight.size() < number_of_logged_stars_) {
-    libra::Vector<3> target_b = hipparcos_->GetStarDirection_b(count, quaternion_i2b);
+  // The field of view is included in the cone around the X-axis of the component frame
+  const double tan_x = tan(x_field_of_view_rad);
+  const double tan_y = tan(y_field_of_view_rad);
+  double half_angle_rad = libra::pi;
+  if (x_field_of_view_rad < libra::pi_2 && y_field_of_view_rad < libra::pi_2) {
+    half_angle_rad = atan(sqrt(tan_x * tan_x + tan_y * tan_y)) + 1.0e-9;  // Margin for the rounding error
+  }
+
+  auto observe_star = [&](const size_t rank) {
+    libra::Vector<3> target_b = hipparcos_->GetStarDirection_b(rank, quaternion_i2b);
     libra::Vector<3> target_c = quaternion_b2c_.FrameConversion(target_b);
 
     double arg_x = atan2(target_c[2], target_c[0]);  // Angle from X-axis on XZ plane in the component frame
@@ -130,34 +176,57 @@ void Telescope::ObserveStars() {
 
     if (abs(arg_x) <= x_field_of_view_rad && abs(arg_y) <= y_field_of_view_rad) {
       Star star;
-      star.hipparcos_data.hipparcos_id = hipparcos_->GetHipparcosId(count);
-      star.hipparcos_data.visible_magnitude = hipparcos_->GetVisibleMagnitude(count);
-      star.hipparcos_data.right_ascension_deg = hipparcos_->GetRightAscension_deg(count);
-      star.hipparcos_data.declination_deg = hipparcos_->GetDeclination_deg(count);
+      star.hipparcos_data.hipparcos_id = hipparcos_->GetHipparcosId(rank);
+      star.hipparcos_data.visible_magnitude = hipparcos_->GetVisibleMagnitude(rank);
+      star.hipparcos_data.right_ascension_deg = hipparcos_->GetRightAscension_deg(rank);
+      star.hipparcos_data.declination_deg = hipparcos_->GetDeclination_deg(rank);
       star.position_image_sensor[0] = x_number_of_pix_ / 2.0 * tan(arg_x) / tan(x_field_of_view_rad) + x_number_of_pix_ / 2.0;
       star.position_image_sensor[1] = y_number_of_pix_ / 2.0 * tan(arg_y) / tan(y_field_of_view_rad) + y_number_of_pix_ / 2.0;
 
       star_list_in_sight.push_back(star);
     }
+  };
+
+  // The stars are checked in the order of the rank (brighter first) in both methods.
+  // The linear search stops after the logged stars are found, so it is faster for the wide field of view.
+  const size_t catalogue_size = hipparcos_->GetCatalogueSize();
+  const double sky_fraction = (1.0 - cos(half_angle_rad)) / 2.0;
+  if (sky_fraction * sky_fraction * (double)catalogue_size < (double)number_of_logged_stars_) {
+    libra::Vector<3> x_axis_c(0.0);
+    x_axis_c[0] = 1.0;
+    const libra::Vector<3> x_axis_b = quaternion_b2c_.InverseFrameConversion(x_axis_c);
+    const libra::Vector<3> x_axis_i = quaternion_i2b.InverseFrameConversion(x_axis_b);
+    hipparcos_->FindStarsInCone(x_axis_i, half_angle_rad, candidate_star_ranks_);
+    for (size_t rank : candidate_star_ranks_) {
+      if (star_list_in_sight.size() >= number_of_logged_stars_) break;
+      observe_star(rank);
+    }
+  } else {
+    for (size_t rank = 0; rank < catalogue_size && star_list_in_sight.size() < number_of_logged_stars_; rank++) {
+      observe_star(rank);
+    }
+  }
 
-    count++;
-
-    // If read all catalogue, fill -1 and break the loop
-    if (count >= hipparcos_->GetCatalogueSize()) {
-      while (star_list_in_sight.size() < number_of_logged_stars_) {
-        Star star;
-        star.hipparcos_data.hipparcos_id = -1;
-        star.hipparcos_data.visible_magnitude = -1;
-        star.hipparcos_data.right_ascension_deg = -1;
-        star.hipparcos_data.declination_deg = -1;
-        star.position_image_sensor[0] = -1;
-        star.position_image_sensor[1] = -1;
+  // If there are not enough stars in the field of view, fill -1
+  while (star_list_in_sight.size() < number_of_logged_stars_) {
+    Star star;
+    star.hipparcos_data.hipparcos_id = -1;
+    star.hipparcos_data.visible_magnitude = -1;
+    star.hipparcos_data.right_ascension_deg = -1;
+    star.hipparcos_data.declination_deg = -1;
+    star.position_image_sensor[0] = -1;
+    star.position_image_sensor[1] = -1;
 
-        star_list_in_sight.push_back(star);
-      }
+    star_list_in_sight.push_back(star);
+  }
+}
 
-      break;
-    }
+void Telescope::RenderStarImage() {
+  star_image_renderer_->ClearImage();
+  for (const Star& star : star_list_in_sight) {
+    if (star.hipparcos_data.hipparcos_id < 0) continue;  // Filled data when there are not enough stars
+    const double count = star_image_reference_count_ * pow(10.0, -0.4 * star.hipparcos_data.visible_magnitude);
+    star_image_renderer_->AddStar(star.position_image_sensor[0], star.position_image_sensor[1], count);
   }
 }
 
@@ -176,7 +245,7 @@ void Telescope::ObserveGroundPositionDeviation() {
   Quaternion quaternion_i2b = attitude_->GetQuaternion_i2b();
   libra::Vector<3> spacecraft_position_ecef_m = orbit_->GetPosition_ecef_m();
   libra::Vector<3> direction_ecef = (initial_ground_position_ecef_m_ - spacecraft_position_ecef_m).CalcNormalizedVector();
-  libra::Matrix<3, 3> dcm_ecef_to_i = local_celestial_information_->GetGlobalInformation().GetEarthRotation().GetDcmJ2000ToEcef().Transpose();
+  libra::Matrix<3, 3> dcm_ecef_to_i = local_celestial_information_->GetGlobalInformation().GetEarthRotation().GetDcmEcefToJ2000();
   libra::Vector<3> direction_i = (dcm_ecef_to_i * direction_ecef).CalcNormalizedVector();
   libra::Vector<3> direction_b = quaternion_i2b.FrameConversion(direction_i);
   libra::Vector<3> target_c = quaternion_b2c_.FrameConversion(direction_b);
@@ -188,6 +257,95 @@ void Telescope::ObserveGroundPositionDeviation() {
   ground_position_y_image_sensor_ = ground_angle_y_rad / y_fov_per_pix_;
 }
 
+void Telescope::ObserveGroundTargets() {
+  const size_t number_of_targets = GetNumberOfGroundTargets();
+  if (orbit_ == nullptr || number_of_targets == 0) return;
+
+  // ECEF to component frame DCM prepared once for all targets
+  const libra::Matrix<3, 3> dcm_ecef_to_i = local_celestial_information_->GetGlobalInformation().GetEarthRotation().GetDcmEcefToJ2000();
+  const libra::Matrix<3, 3> dcm_i_to_c = quaternion_b2c_.ConvertToDcm() * attitude_->GetQuaternion_i2b().ConvertToDcm();
+  const libra::Matrix<3, 3> dcm_ecef_to_c = dcm_i_to_c * dcm_ecef_to_i;
+  const libra::Vector<3> spacecraft_position_ecef_m = orbit_->GetPosition_ecef_m();
+
+  // The field of view is included in the cone around the X-axis of the component frame
+  const double tan_x = tan(x_field_of_view_rad);
+  const double tan_y = tan(y_field_of_view_rad);
+  const double cos_half_angle = 1.0 / sqrt(1.0 + tan_x * tan_x + tan_y * tan_y) - 1.0e-9;  // Margin for the rounding error
+
+  // Horizon and cone culling with the dot products in the ECEF frame
+  const double* RESTRICT target_x_m = ground_target_position_x_ecef_m_.data();
+  const double* RESTRICT target_y_m = ground_target_position_y_ecef_m_.data();
+  const double* RESTRICT target_z_m = ground_target_position_z_ecef_m_.data();
+  const double* RESTRICT up_x = ground_target_up_x_ecef_.data();
+  const double* RESTRICT up_y = ground_target_up_y_ecef_.data();
+  const double* RESTRICT up_z = ground_target_up_z_ecef_.data();
+  double* RESTRICT image_x_pix = ground_target_position_x_image_sensor_.data();
+  double* RESTRICT image_y_pix = ground_target_position_y_image_sensor_.data();
+  const double spacecraft_x_m = spacecraft_position_ecef_m[0];
+  const double spacecraft_y_m = spacecraft_position_ecef_m[1];
+  const double spacecraft_z_m = spacecraft_position_ecef_m[2];
+  const double sight_x = dcm_ecef_to_c[0][0];
+  const double sight_y = dcm_ecef_to_c[0][1];
+  const double sight_z = dcm_ecef_to_c[0][2];
+  ground_target_candidates_.clear();
+  for (size_t i = 0; i < number_of_targets; i++) {
+    image_x_pix[i] = -1.0;
+    image_y_pix[i] = -1.0;
+    const double direction_x_m = target_x_m[i] - spacecraft_x_m;
+    const double direction_y_m = target_y_m[i] - spacecraft_y_m;
+    const double direction_z_m = target_z_m[i] - spacecraft_z_m;
+    const double up_dot = direction_x_m * up_x[i] + direction_y_m * up_y[i] + direction_z_m * up_z[i];
+    const double sight_dot = direction_x_m * sight_x + direction_y_m * sight_y + direction_z_m * sight_z;
+    const double distance_m = sqrt(direction_x_m * direction_x_m + direction_y_m * direction_y_m + direction_z_m * direction_z_m);
+    if (up_dot < 0.0 && sight_dot > cos_half_angle * distance_m) ground_target_candidates_.push_back(i);
+  }
+
+  // Detailed projection of the remaining targets with the same mapping as the stars
+  const double half_x_number_of_pix = x_number_of_pix_ / 2.0;
+  const double half_y_number_of_pix = y_number_of_pix_ / 2.0;
+  for (size_t i : ground_target_candidates_) {
+    libra::Vector<3> direction_ecef_m;
+    direction_ecef_m[0] = target_x_m[i] - spacecraft_x_m;
+    direction_ecef_m[1] = target_y_m[i] - spacecraft_y_m;
+    direction_ecef_m[2] = target_z_m[i] - spacecraft_z_m;
+    const libra::Vector<3> target_c = dcm_ecef_to_c * direction_ecef_m;
+    // Same condition with the angles on the XZ and XY planes within the field of view
+    if (target_c[0] <= 0.0 || abs(target_c[2]) > target_c[0] * tan_x || abs(target_c[1]) > target_c[0] * tan_y) continue;
+    image_x_pix[i] = half_x_number_of_pix * target_c[2] / (target_c[0] * tan_x) + half_x_number_of_pix;
+    image_y_pix[i] = half_y_number_of_pix * target_c[1] / (target_c[0] * tan_y) + half_y_number_of_pix;
+  }
+}
+
+bool Telescope::UpdateStarLogSelection() {
+  if (star_log_channel_filter_ != log_channel_filter_ || is_star_log_selected_.size() != number_of_logged_stars_) {
+    star_log_channel_filter_ = log_channel_filter_;
+    is_star_log_selected_.resize(number_of_logged_stars_);
+    for (size_t i = 0; i < number_of_logged_stars_; i++) {
+      is_star_log_selected_[i] = IsLogChannelSelected(GetStarLogHeader(i));
+    }
+  }
+  // The logged stars are not used when the log is disabled
+  if (!is_log_enabled_) return false;
+  return std::find(is_star_log_selected_.begin(), is_star_log_selected_.end(), true) != is_star_log_selected_.end();
+}
+
+bool Telescope::IsStarLogSelected(const size_t star_index) const {
+  // The selection is checked directly before the first update
+  if (star_log_channel_filter_ != log_channel_filter_ || star_index >= is_star_log_selected_.size()) {
+    return IsLogChannelSelected(GetStarLogHeader(star_index));
+  }
+  return is_star_log_selected_[star_index];
+}
+
+std::string Telescope::GetStarLogHeader(const size_t star_index) const {
+  const std::string component_name = "telescope_";
+  std::string str_tmp = "";
+  str_tmp += WriteScalar(component_name + "hipparcos_id (" + to_string(star_index) + ")", " ");
+  str_tmp += WriteScalar(component_name + "visible_magnitude (" + to_string(star_index) + ")", " ");
+  str_tmp += WriteVector(component_name + "star_position (" + to_string(star_index) + ")", "img", "pix", 2);
+  return str_tmp;
+}
+
 string Telescope::GetLogHeader() const {
   string str_tmp = "";
 
@@ -204,9 +362,8 @@ string Telescope::GetLogHeader() const {
   // When Hipparcos Catalogue was not read, no output of ObserveStars
   if (hipparcos_->IsCalcEnabled) {
     for (size_t i = 0; i < number_of_logged_stars_; i++) {
-      str_tmp += WriteScalar(component_name + "hipparcos_id (" + to_string(i) + ")", " ");
-      str_tmp += WriteScalar(component_name + "visible_magnitude (" + to_string(i) + ")", " ");
-      str_tmp += WriteVector(component_name + "star_position (" + to_string(i) + ")", "img", "pix", 2);
+      const std::string star_header = GetStarLogHeader(i);
+      if (IsLogChannelSelected(star_header)) str_tmp += star_header;
     }
   }
 
@@ -231,6 +388,7 @@ string Telescope::GetLogValue() const {
   // When Hipparcos Catalogue was not read, no output of ObserveStars
   if (hipparcos_->IsCalcEnabled) {
     for (size_t i = 0; i < number_of_logged_stars_; i++) {
+      if (!IsStarLogSelected(i)) continue;
       str_tmp += WriteScalar(star_list_in_sight[i].hipparcos_data.hipparcos_id);
       str_tmp += WriteScalar(star_list_in_sight[i].hipparcos_data.visible_magnitude);
       str_tmp += WriteVector(star_list_in_sight[i].position_image_sensor);
@@ -283,5 +441,11 @@ Telescope InitTelescope(ClockGenerator* clock_generator, int sensor_id, const st
   Telescope telescope(clock_generator, quaternion_b2c, sun_forbidden_angle_rad, earth_forbidden_angle_rad, moon_forbidden_angle_rad, x_number_of_pix,
                       y_number_of_pix, x_fov_per_pix_rad, y_fov_per_pix_rad, number_of_logged_stars, attitude, hipparcos, local_celestial_information,
                       orbit);
+
+  if (Telescope_conf.ReadEnable(TelescopeSection, "star_image_rendering")) {
+    double psf_sigma_pix = Telescope_conf.ReadDouble(TelescopeSection, "star_image_psf_sigma_pixel");
+    double reference_count = Telescope_conf.ReadDouble(TelescopeSection, "star_image_reference_count");
+    telescope.EnableStarImage(psf_sigma_pix, reference_count);
+  }
   return telescope;
 }
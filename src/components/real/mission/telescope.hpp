@@ -8,11 +8,14 @@
 
 #include <dynamics/attitude/attitude.hpp>
 #include <dynamics/orbit/orbit.hpp>
+#include <math_physics/geodesy/geodetic_position.hpp>
 #include <environment/global/hipparcos_catalogue.hpp>
 #include <environment/local/local_celestial_information.hpp>
 #include <logger/loggable.hpp>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <math_physics/optics/star_image_renderer.hpp>
+#include <memory>
 #include <vector>
 
 #include "../../base/component.hpp"
@@ -60,7 +63,48 @@ class Telescope : public Component, public ILoggable {
    */
   ~Telescope();
 
+  /**
+   * @fn EnableStarImage
+   * @brief Enable the rendering of the stars in the field of view to the image
+   * @param [in] psf_sigma_pix: Standard deviation of the Gaussian point spread function [pixel]
+   * @param [in] reference_count: Total count of a star with the visible magnitude 0
+   */
+  void EnableStarImage(const double psf_sigma_pix, const double reference_count);
+  /**
+   * @fn AddGroundTarget
+   * @brief Add a ground target projected to the image sensor in every update
+   * @param [in] position: Geodetic position of the target
+   * @return Index of the added target
+   */
+  size_t AddGroundTarget(const GeodeticPosition& position);
+  /**
+   * @fn ClearGroundTargets
+   * @brief Remove all ground targets
+   */
+  void ClearGroundTargets();
+
   // Getter
+  /**
+   * @fn GetStarImage
+   * @return Rendered star image. nullptr when the rendering is disabled.
+   */
+  inline const libra::StarImageRenderer* GetStarImage() const { return star_image_renderer_.get(); }
+  /**
+   * @fn GetNumberOfGroundTargets
+   * @brief Return number of ground targets
+   */
+  inline size_t GetNumberOfGroundTargets() const { return ground_target_position_x_ecef_m_.size(); }
+  /**
+   * @fn GetGroundTargetPosition_image_sensor
+   * @brief Return position of the ground target on the image sensor. (-1, -1) when the target is not visible.
+   * @param [in] index: Index of the target
+   */
+  inline libra::Vector<2> GetGroundTargetPosition_image_sensor(const size_t index) const {
+    libra::Vector<2> position_image_sensor;
+    position_image_sensor[0] = ground_target_position_x_image_sensor_[index];
+    position_image_sensor[1] = ground_target_position_y_image_sensor_[index];
+    return position_image_sensor;
+  }
   inline bool GetIsSunInForbiddenAngle() const { return is_sun_in_forbidden_angle; }
   inline bool GetIsEarthInForbiddenAngle() const { return is_earth_in_forbidden_angle; }
   inline bool GetIsMoonInForbiddenAngle() const { return is_moon_in_forbidden_angle; }
@@ -69,6 +113,7 @@ class Telescope : public Component, public ILoggable {
  private:
   libra::Quaternion quaternion_b2c_;    //!< Quaternion from the body frame to component frame
   libra::Vector<3> sight_direction_c_;  //!< Sight direction vector in the component frame
+  libra::Vector<3> sight_direction_b_;  //!< Sight direction vector in the body fixed frame
 
   double sun_forbidden_angle_rad_;    //!< Sun forbidden angle [rad]
   double earth_forbidden_angle_rad_;  //!< Earth forbidden angle [rad]
@@ -87,14 +132,31 @@ class Telescope : public Component, public ILoggable {
   bool is_earth_in_forbidden_angle = false;  //!< Is the earth in the forbidden angle
   bool is_moon_in_forbidden_angle = false;   //!< Is the moon in the forbidden angle
 
-  size_t number_of_logged_stars_;  //!< Number of logged stars
+  size_t number_of_logged_stars_;                              //!< Number of logged stars
+  std::vector<bool> is_star_log_selected_;                     //!< Whether the columns of each logged star are selected by the log channel filter
+  const LogChannelFilter* star_log_channel_filter_ = nullptr;  //!< Log channel filter used for is_star_log_selected_
 
   libra::Vector<2> sun_position_image_sensor{-1};    //!< Position of the sun on the image plane
   libra::Vector<2> earth_position_image_sensor{-1};  //!< Position of the earth on the image plane
   libra::Vector<2> moon_position_image_sensor{-1};   //!< Position of the moon on the image plane
   libra::Vector<3> initial_ground_position_ecef_m_;  //!< Initial spacecraft position
 
-  std::vector<Star> star_list_in_sight;  //!< Star information in the field of view
+  std::vector<Star> star_list_in_sight;       //!< Star information in the field of view
+  std::vector<size_t> candidate_star_ranks_;  //!< Ranks of the stars in the cone including the field of view
+
+  std::shared_ptr<libra::StarImageRenderer> star_image_renderer_;  //!< Star image renderer (nullptr when disabled)
+  double star_image_reference_count_ = 0.0;                        //!< Total count of a star with the visible magnitude 0
+
+  // Ground targets in the structure of arrays layout
+  std::vector<double> ground_target_position_x_ecef_m_;        //!< X position of the targets in the ECEF frame [m]
+  std::vector<double> ground_target_position_y_ecef_m_;        //!< Y position of the targets in the ECEF frame [m]
+  std::vector<double> ground_target_position_z_ecef_m_;        //!< Z position of the targets in the ECEF frame [m]
+  std::vector<double> ground_target_up_x_ecef_;                //!< X element of the geodetic up direction of the targets in the ECEF frame
+  std::vector<double> ground_target_up_y_ecef_;                //!< Y element of the geodetic up direction of the targets in the ECEF frame
+  std::vector<double> ground_target_up_z_ecef_;                //!< Z element of the geodetic up direction of the targets in the ECEF frame
+  std::vector<double> ground_target_position_x_image_sensor_;  //!< X position of the targets on the image sensor [pix]
+  std::vector<double> ground_target_position_y_image_sensor_;  //!< Y position of the targets on the image sensor [pix]
+  std::vector<size_t> ground_target_candidates_;               //!< Indices of the targets passing the horizon and cone tests
 
   /**
    * @fn JudgeForbiddenAngle
@@ -123,6 +185,29 @@ class Telescope : public Component, public ILoggable {
    * @brief Observe stars from Hipparcos catalogue
    */
   void ObserveStars();
+  /**
+   * @fn UpdateStarLogSelection
+   * @brief Update the selection of the logged stars when the log channel filter is changed
+   * @return True when any star is selected
+   */
+  bool UpdateStarLogSelection();
+  /**
+   * @fn IsStarLogSelected
+   * @brief Return true when the columns of the logged star are selected by the log channel filter
+   * @param [in] star_index: Index of the logged star
+   */
+  bool IsStarLogSelected(const size_t star_index) const;
+  /**
+   * @fn GetStarLogHeader
+   * @brief Return the header of the logged star
+   * @param [in] star_index: Index of the logged star
+   */
+  std::string GetStarLogHeader(const size_t star_index) const;
+  /**
+   * @fn RenderStarImage
+   * @brief Render the observed stars to the star image
+   */
+  void RenderStarImage();
 
   const Attitude* attitude_;                                      //!< Attitude information
   const HipparcosCatalogue* hipparcos_;                           //!< Star information
@@ -132,6 +217,13 @@ class Telescope : public Component, public ILoggable {
    * @brief Calculate the deviation of the ground position from its initial value in the image sensor
    */
   void ObserveGroundPositionDeviation();
+  /**
+   * @fn ObserveGroundTargets
+   * @brief Project the ground targets to the image sensor
+   * @note The ECEF to component frame DCM is prepared once. The targets under the horizon or out of the cone including the field of view
+   *       are culled with the dot products before the projection.
+   */
+  void ObserveGroundTargets();
 
   const Orbit* orbit_;  //!< Orbit information
   // Override ILoggable
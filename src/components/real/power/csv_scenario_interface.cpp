@@ -5,11 +5,14 @@
 
 #include "csv_scenario_interface.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <setting_file_reader/initialize_file_access.hpp>
 
 bool CsvScenarioInterface::is_csv_scenario_enabled_;
-std::map<std::string, unsigned int> CsvScenarioInterface::buffer_line_id_;
-std::map<std::string, DoubleBuffer> CsvScenarioInterface::buffers_;
+std::vector<double> CsvScenarioInterface::times_;
+std::vector<CsvScenarioInterface::ScenarioRow> CsvScenarioInterface::rows_;
+thread_local size_t CsvScenarioInterface::cursor_ = 0;
 
 void CsvScenarioInterface::Initialize(const std::string file_name) {
   IniAccess scenario_conf(file_name);
@@ -20,33 +23,32 @@ void CsvScenarioInterface::Initialize(const std::string file_name) {
   std::string csv_path;
   csv_path = scenario_conf.ReadString(Section, "csv_path");
 
-  buffer_line_id_["sun_dir_b_x"] = 1;
-  buffer_line_id_["sun_dir_b_y"] = 2;
-  buffer_line_id_["sun_dir_b_z"] = 3;
-  buffer_line_id_["sun_flag"] = 4;
-  buffer_line_id_["power_consumption"] = 5;
-
   std::vector<std::vector<double>> data;
   data = ReadCsvData(csv_path, 1);
-
-  for (auto itr = buffer_line_id_.begin(); itr != buffer_line_id_.end(); itr++) {
-    StoreBuffer(itr->first, data);
-  }
+  StoreRows(data);
 }
 
 bool CsvScenarioInterface::IsCsvScenarioEnabled() { return CsvScenarioInterface::is_csv_scenario_enabled_; }
 
 libra::Vector<3> CsvScenarioInterface::GetSunDirectionBody(const double time_query) {
-  libra::Vector<3> sun_dir_b;
-  sun_dir_b[0] = GetValueFromBuffer("sun_dir_b_x", time_query);
-  sun_dir_b[1] = GetValueFromBuffer("sun_dir_b_y", time_query);
-  sun_dir_b[2] = GetValueFromBuffer("sun_dir_b_z", time_query);
+  libra::Vector<3> sun_dir_b(0.0);
+  const ScenarioRow* row = FindRow(time_query);
+  if (row == nullptr) return sun_dir_b;
+  sun_dir_b[0] = (*row)[(size_t)CsvScenarioColumn::kSunDirectionBodyX];
+  sun_dir_b[1] = (*row)[(size_t)CsvScenarioColumn::kSunDirectionBodyY];
+  sun_dir_b[2] = (*row)[(size_t)CsvScenarioColumn::kSunDirectionBodyZ];
   return sun_dir_b;
 }
 
-bool CsvScenarioInterface::GetSunFlag(const double time_query) { return (bool)GetValueFromBuffer("sun_flag", time_query); }
+bool CsvScenarioInterface::GetSunFlag(const double time_query) { return (bool)GetValue(CsvScenarioColumn::kSunFlag, time_query); }
 
-double CsvScenarioInterface::GetPowerConsumption(const double time_query) { return GetValueFromBuffer("power_consumption", time_query); }
+double CsvScenarioInterface::GetPowerConsumption(const double time_query) { return GetValue(CsvScenarioColumn::kPowerConsumption, time_query); }
+
+double CsvScenarioInterface::GetValue(const CsvScenarioColumn column, const double time_query) {
+  const ScenarioRow* row = FindRow(time_query);
+  if (row == nullptr) return 0.0;
+  return (*row)[(size_t)column];
+}
 
 std::vector<std::vector<double>> CsvScenarioInterface::ReadCsvData(const std::string filename, const std::size_t ignore_line_num) {
   std::ifstream file;
@@ -77,18 +79,47 @@ std::vector<std::vector<double>> CsvScenarioInterface::ReadCsvData(const std::st
   return data;
 }
 
-void CsvScenarioInterface::StoreBuffer(const std::string buffer_name, const std::vector<std::vector<double>>& data) {
-  auto line_num = buffer_line_id_.at(buffer_name);
-  for (const auto& line : data) {
-    buffers_[buffer_name][line[0]] = line[line_num];
+void CsvScenarioInterface::StoreRows(const std::vector<std::vector<double>>& data) {
+  // Column 0 is the time
+  std::vector<size_t> order(data.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](const size_t a, const size_t b) { return data[a][0] < data[b][0]; });
+
+  times_.clear();
+  rows_.clear();
+  for (const size_t line_id : order) {
+    const std::vector<double>& line = data[line_id];
+    ScenarioRow row;
+    for (size_t column = 0; column < kNumberOfColumns; column++) row[column] = line.at(column + 1);
+    if (!times_.empty() && times_.back() == line[0]) {
+      rows_.back() = row;
+    } else {
+      times_.push_back(line[0]);
+      rows_.push_back(row);
+    }
   }
+  cursor_ = 0;
 }
 
-double CsvScenarioInterface::GetValueFromBuffer(const std::string buffer_name, const double time_query) {
-  double output;
-  auto itr = buffers_.at(buffer_name).upper_bound(time_query);
-  itr--;
-  if (itr == buffers_.at(buffer_name).end()) return 0;
-  output = itr->second;
-  return output;
+const CsvScenarioInterface::ScenarioRow* CsvScenarioInterface::FindRow(const double time_query) {
+  if (times_.empty() || time_query < times_.front()) return nullptr;
+  if (cursor_ >= times_.size()) cursor_ = 0;
+
+  // Step forward from the previous query, and search the whole table for the backward or the large jump
+  const size_t kMaxForwardSteps = 8;
+  size_t row = cursor_;
+  if (times_[row] <= time_query) {
+    size_t steps = 0;
+    while (row + 1 < times_.size() && times_[row + 1] <= time_query && steps < kMaxForwardSteps) {
+      row++;
+      steps++;
+    }
+    if (row + 1 < times_.size() && times_[row + 1] <= time_query) {
+      row = (size_t)(std::upper_bound(times_.begin() + row, times_.end(), time_query) - times_.begin()) - 1;
+    }
+  } else {
+    row = (size_t)(std::upper_bound(times_.begin(), times_.begin() + row, time_query) - times_.begin()) - 1;
+  }
+  cursor_ = row;
+  return &rows_[row];
 }
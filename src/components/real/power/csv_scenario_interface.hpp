@@ -6,16 +6,31 @@
 #ifndef S2E_COMPONENTS_REAL_POWER_CSV_SCENARIO_INTERFACE_HPP_
 #define S2E_COMPONENTS_REAL_POWER_CSV_SCENARIO_INTERFACE_HPP_
 
-#include <map>
+#include <array>
+#include <cstddef>
 #include <math_physics/math/vector.hpp>
 #include <string>
 #include <vector>
 
-typedef std::map<double, double> DoubleBuffer;
+/**
+ * @enum CsvScenarioColumn
+ * @brief Handle of the column in the scenario CSV file
+ */
+enum class CsvScenarioColumn {
+  kSunDirectionBodyX,  //!< X component of the sun direction in the body fixed frame
+  kSunDirectionBodyY,  //!< Y component of the sun direction in the body fixed frame
+  kSunDirectionBodyZ,  //!< Z component of the sun direction in the body fixed frame
+  kSunFlag,            //!< Sun flag
+  kPowerConsumption,   //!< Power consumption [W]
+  kNumberOfColumns,    //!< Number of the columns. Do not remove. Place on the bottom.
+};
 
 /*
  * @class CsvScenarioInterface
  * @brief Interface to read power related scenario in CSV file
+ * @details The rows are sorted by the time, and the values of a row are stored together, so all columns of a query are read with a
+ *          search of the time. The search starts from the row of the previous query in the thread, so the queries with the monotonic time
+ *          are O(1) amortized. The value at the latest time which is not larger than the query is returned (zero-order hold).
  */
 class CsvScenarioInterface {
  public:
@@ -49,8 +64,19 @@ class CsvScenarioInterface {
    * @param [in] time_query: Time query
    */
   static double GetPowerConsumption(const double time_query);
+  /**
+   * @fn GetValue
+   * @brief Return value of the column
+   * @param [in] column: Column handle
+   * @param [in] time_query: Time query
+   * @return Value at the latest time which is not larger than the query. Zero before the first time of the scenario.
+   */
+  static double GetValue(const CsvScenarioColumn column, const double time_query);
 
  private:
+  static const size_t kNumberOfColumns = (size_t)CsvScenarioColumn::kNumberOfColumns;  //!< Number of the columns
+  using ScenarioRow = std::array<double, kNumberOfColumns>;                            //!< Values of a row indexed by CsvScenarioColumn
+
   /**
    * @fn ReadCsvData
    * @brief Read CSV data
@@ -59,23 +85,22 @@ class CsvScenarioInterface {
    */
   static std::vector<std::vector<double>> ReadCsvData(const std::string filename, const std::size_t ignore_line_num = 0);
   /**
-   * @fn StoreBuffer
-   * @brief Store buffer
-   * @param [in] buffer_name: Buffer name
-   * @param [in] data: Data
+   * @fn StoreRows
+   * @brief Store the rows sorted by the time. The last row is used for the same time.
+   * @param [in] data: Data whose first column is the time
    */
-  static void StoreBuffer(const std::string buffer_name, const std::vector<std::vector<double>>& data);
+  static void StoreRows(const std::vector<std::vector<double>>& data);
   /**
-   * @fn GetValueFromBuffer
-   * @brief Return value from buffer
-   * @param [in] buffer_name: Buffer name
+   * @fn FindRow
+   * @brief Return pointer to the row at the latest time which is not larger than the query. nullptr before the first time.
    * @param [in] time_query: Time query
    */
-  static double GetValueFromBuffer(const std::string buffer_name, const double time_query);
+  static const ScenarioRow* FindRow(const double time_query);
 
-  static bool is_csv_scenario_enabled_;                        //!< Enable flag to use CSV scenario
-  static std::map<std::string, unsigned int> buffer_line_id_;  //!< Buffer line ID
-  static std::map<std::string, DoubleBuffer> buffers_;         //!< Buffer
+  static bool is_csv_scenario_enabled_;   //!< Enable flag to use CSV scenario
+  static std::vector<double> times_;      //!< Times of the rows in the ascending order
+  static std::vector<ScenarioRow> rows_;  //!< Values of the rows
+  static thread_local size_t cursor_;     //!< Row index of the previous query in the thread
 };
 
 #endif  // S2E_COMPONENTS_REAL_POWER_CSV_SCENARIO_INTERFACE_HPP_
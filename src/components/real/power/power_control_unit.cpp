@@ -4,6 +4,8 @@
  */
 #include "power_control_unit.hpp"
 
+#include <algorithm>
+
 PowerControlUnit::PowerControlUnit(ClockGenerator* clock_generator) : Component(1, clock_generator) {}
 
 PowerControlUnit::PowerControlUnit(int prescaler, ClockGenerator* clock_generator) : Component(prescaler, clock_generator) {}
@@ -18,31 +20,53 @@ void PowerControlUnit::MainRoutine(const int time_count) {
 
 int PowerControlUnit::ConnectPort(const int port_id, const double current_limit_A) {
   // The port is already used
-  if (power_ports_[port_id] != nullptr) return -1;
+  if (port_id < 0 || GetPowerPort(port_id) != nullptr) return -1;
 
-  power_ports_[port_id] = new PowerPort(port_id, current_limit_A);
+  if (port_id >= (int)power_ports_.size()) power_ports_.resize(port_id + 1);
+  power_ports_[port_id] = std::make_unique<PowerPort>(port_id, current_limit_A);
+  power_ports_[port_id]->SetCurrentConsumptionAccumulator(&total_current_consumption_A_);
+  for (auto observer : observers_) power_ports_[port_id]->AddObserver(observer);
   return 0;
 }
 
 int PowerControlUnit::ConnectPort(const int port_id, const double current_limit_A, const double minimum_voltage_V,
                                   const double assumed_power_consumption_W) {
   // The port is already used
-  if (power_ports_[port_id] != nullptr) return -1;
+  if (port_id < 0 || GetPowerPort(port_id) != nullptr) return -1;
 
-  power_ports_[port_id] = new PowerPort(port_id, current_limit_A, minimum_voltage_V, assumed_power_consumption_W);
+  if (port_id >= (int)power_ports_.size()) power_ports_.resize(port_id + 1);
+  power_ports_[port_id] = std::make_unique<PowerPort>(port_id, current_limit_A, minimum_voltage_V, assumed_power_consumption_W);
+  power_ports_[port_id]->SetCurrentConsumptionAccumulator(&total_current_consumption_A_);
+  for (auto observer : observers_) power_ports_[port_id]->AddObserver(observer);
   return 0;
 }
 
 int PowerControlUnit::ClosePort(const int port_id) {
   // The port not used
-  if (power_ports_[port_id] == nullptr) return -1;
+  PowerPort* port = GetPowerPort(port_id);
+  if (port == nullptr) return -1;
 
-  PowerPort* port = power_ports_.at(port_id);
-  delete port;
-  power_ports_.erase(port_id);
+  total_current_consumption_A_ -= port->GetCurrentConsumption_A();
+  power_ports_[port_id].reset();
   return 0;
 }
 
+void PowerControlUnit::AddObserver(IPowerPortObserver* observer) {
+  if (observer == nullptr) return;
+  if (std::find(observers_.begin(), observers_.end(), observer) != observers_.end()) return;
+  observers_.push_back(observer);
+  for (auto& port : power_ports_) {
+    if (port != nullptr) port->AddObserver(observer);
+  }
+}
+
+void PowerControlUnit::RemoveObserver(IPowerPortObserver* observer) {
+  observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+  for (auto& port : power_ports_) {
+    if (port != nullptr) port->RemoveObserver(observer);
+  }
+}
+
 std::string PowerControlUnit::GetLogHeader() const {
   std::string str_tmp = "";
   return str_tmp;
@@ -8,7 +8,8 @@
 
 #include <components/ports/power_port.hpp>
 #include <logger/loggable.hpp>
-#include <map>
+#include <memory>
+#include <vector>
 
 #include "../../base/component.hpp"
 
@@ -61,7 +62,16 @@ class PowerControlUnit : public Component, public ILoggable {
    * @brief Return power port information
    * @param port_id: Power port ID
    */
-  inline PowerPort* GetPowerPort(const int port_id) { return power_ports_[port_id]; };
+  inline PowerPort* GetPowerPort(const int port_id) {
+    if (port_id < 0 || port_id >= (int)power_ports_.size()) return nullptr;
+    return power_ports_[port_id].get();
+  };
+  /**
+   * @fn GetTotalCurrentConsumption_A
+   * @brief Return total current consumption of all connected power ports [A]
+   * @note The total is updated incrementally with the change of each port, so the cost does not depend on the number of ports
+   */
+  inline double GetTotalCurrentConsumption_A() const { return total_current_consumption_A_; }
 
   // Port control functions
   /**
@@ -89,9 +99,23 @@ class PowerControlUnit : public Component, public ILoggable {
    * @return 0: Success, -1: Error
    */
   int ClosePort(const int port_id);
+  /**
+   * @fn AddObserver
+   * @brief Add the observer notified when the power switch state of any port is changed
+   * @note The observer is also added to the ports connected after this function.
+   * @param [in] observer: Observer. It must be removed before it is destructed.
+   */
+  void AddObserver(IPowerPortObserver* observer);
+  /**
+   * @fn RemoveObserver
+   * @brief Remove the observer from all ports
+   */
+  void RemoveObserver(IPowerPortObserver* observer);
 
  private:
-  std::map<int, PowerPort*> power_ports_;  //!< Power port list
+  std::vector<std::unique_ptr<PowerPort>> power_ports_;  //!< Power port list indexed by the port ID (nullptr for the unused ID)
+  double total_current_consumption_A_ = 0.0;             //!< Total current consumption of all connected power ports [A]
+  std::vector<IPowerPortObserver*> observers_;           //!< Observers of the power switch state of all ports
 };
 
 #endif  // S2E_COMPONENTS_REAL_POWER_POWER_CONTROL_UNIT_HPP_
@@ -7,6 +7,7 @@
 
 #include <components/real/power/csv_scenario_interface.hpp>
 #include <environment/global/clock_generator.hpp>
+#include <environment/local/earth_albedo.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
 
 SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_generator, int component_id, int number_of_series, int number_of_parallel,
@@ -26,6 +27,8 @@ SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_gene
       compo_step_time_s_(component_step_time_s) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
+  if (local_celestial_information_ != nullptr) sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
+  InitializeCellArray();
 }
 
 SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_generator, int component_id, int number_of_series, int number_of_parallel,
@@ -40,9 +43,12 @@ SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_gene
       cell_efficiency_(cell_efficiency),
       transmission_efficiency_(transmission_efficiency),
       srp_environment_(srp_environment),
+      local_celestial_information_(nullptr),
       compo_step_time_s_(component_step_time_s) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
+  if (local_celestial_information_ != nullptr) sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
+  InitializeCellArray();
 }
 
 SolarArrayPanel::SolarArrayPanel(ClockGenerator* clock_generator, int component_id, int number_of_series, int number_of_parallel, double cell_area_m2,
@@ -62,6 +68,8 @@ SolarArrayPanel::SolarArrayPanel(ClockGenerator* clock_generator, int component_
       compo_step_time_s_(0.1) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
+  if (local_celestial_information_ != nullptr) sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
+  InitializeCellArray();
 }
 
 SolarArrayPanel::SolarArrayPanel(const SolarArrayPanel& obj)
@@ -75,13 +83,21 @@ SolarArrayPanel::SolarArrayPanel(const SolarArrayPanel& obj)
       transmission_efficiency_(obj.transmission_efficiency_),
       srp_environment_(obj.srp_environment_),
       local_celestial_information_(obj.local_celestial_information_),
+      cell_array_(obj.cell_array_),
       compo_step_time_s_(obj.compo_step_time_s_) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
+  sun_ = obj.sun_;
 }
 
 SolarArrayPanel::~SolarArrayPanel() {}
 
+void SolarArrayPanel::InitializeCellArray() {
+  for (int i = 0; i < number_of_parallel_ * number_of_series_; i++) {
+    cell_array_.AddCell(normal_vector_, cell_area_m2_, cell_efficiency_ * transmission_efficiency_);
+  }
+}
+
 std::string SolarArrayPanel::GetLogHeader() const {
   std::string str_tmp = "";
   std::string component_name = "sap" + std::to_string(component_id_) + "_";
@@ -105,10 +121,16 @@ void SolarArrayPanel::MainRoutine(const int time_count) {
                           cell_area_m2_ * number_of_parallel_ * number_of_series_ * InnerProduct(normal_vector_, normalized_sun_direction_body);
   } else {
     const auto power_density = srp_environment_->GetPowerDensity_W_m2();
-    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN");
+    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_);
     libra::Vector<3> sun_dir_b = sun_pos_b.CalcNormalizedVector();
-    power_generation_W_ = cell_efficiency_ * transmission_efficiency_ * power_density * cell_area_m2_ * number_of_parallel_ * number_of_series_ *
-                          InnerProduct(normal_vector_, sun_dir_b);
+    // Direct sunlight on each cell including the partial shadow factors
+    cell_array_.CalcPowerGeneration(sun_dir_b, power_density);
+    // Sunlight reflected by the earth
+    const EarthAlbedo* earth_albedo = srp_environment_->GetEarthAlbedo();
+    const double albedo_irradiance_W_m2 = (earth_albedo != nullptr) ? earth_albedo->CalcAlbedoIrradiance_W_m2(normal_vector_) : 0.0;
+    const double albedo_power_generation_W =
+        cell_efficiency_ * transmission_efficiency_ * albedo_irradiance_W_m2 * cell_area_m2_ * number_of_parallel_ * number_of_series_;
+    power_generation_W_ = cell_array_.GetTotalPowerGeneration_W() + albedo_power_generation_W;
     // TODO: Improve implementation. For example, update IV curve with sun direction and calculate generated power
   }
   if (power_generation_W_ < 0) power_generation_W_ = 0.0;
@@ -12,6 +12,7 @@
 #include <math_physics/math/vector.hpp>
 
 #include "../../base/component.hpp"
+#include "solar_cell_array.hpp"
 
 class SolarArrayPanel : public Component, public ILoggable {
  public:
@@ -88,6 +89,13 @@ class SolarArrayPanel : public Component, public ILoggable {
    */
   double GetPowerGeneration_W() const { return power_generation_W_; }
 
+  /**
+   * @fn GetCellArray
+   * @brief Return the cells of the panel to set the partial shadow factors
+   * @note The cells are stored string by string: index = parallel_index * number_of_series + series_index
+   */
+  inline SolarCellArray& GetCellArray() { return cell_array_; }
+
   /**
    * @fn SetVoltage_V
    * @brief Set voltage
@@ -117,7 +125,9 @@ class SolarArrayPanel : public Component, public ILoggable {
 
   const SolarRadiationPressureEnvironment* const srp_environment_;  //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celestial_information_;    //!< Local celestial information
+  CelestialBodyHandle sun_;                                         //!< Handle of the sun
 
+  SolarCellArray cell_array_;  //!< Cells of the panel for the sun illumination
   double voltage_V_;           //!< Voltage [V]
   double power_generation_W_;  //!< Generated power [W]
 
@@ -129,6 +139,11 @@ class SolarArrayPanel : public Component, public ILoggable {
    * @brief Main routine to calculate force generation
    */
   void MainRoutine(const int time_count) override;
+  /**
+   * @fn InitializeCellArray
+   * @brief Add the series and parallel connected cells to the cell array
+   */
+  void InitializeCellArray();
 };
 
 /*
@@ -0,0 +1,84 @@
+/**
+ * @file solar_cell_array.cpp
+ * @brief Cell level model of solar arrays for the multi-panel and the partial shadow power prediction
+ */
+
+#include "solar_cell_array.hpp"
+
+#include <algorithm>
+#include <utilities/macros.hpp>
+
+SolarCellIvCurve::SolarCellIvCurve(const std::vector<double>& voltage_V, const std::vector<double>& current_A,
+                                   const double reference_irradiance_W_m2, const size_t number_of_samples) {
+  open_circuit_voltage_V_ = voltage_V.empty() ? 0.0 : voltage_V.back();
+  reciprocal_reference_irradiance_m2_W_ = 1.0 / reference_irradiance_W_m2;
+  const size_t number_of_grid_points = std::max(number_of_samples, (size_t)2);
+  const double voltage_step_V = open_circuit_voltage_V_ / (double)(number_of_grid_points - 1);
+  reciprocal_voltage_step_1_V_ = voltage_step_V > 0.0 ? 1.0 / voltage_step_V : 0.0;
+
+  // Resample the curve on the uniform grid with the linear interpolation
+  current_at_reference_A_.resize(number_of_grid_points + 1, 0.0);  // The last point is a guard for the interpolation
+  size_t segment = 0;
+  for (size_t i = 0; i < number_of_grid_points && !voltage_V.empty(); i++) {
+    const double grid_voltage_V = voltage_step_V * (double)i;
+    while (segment + 2 < voltage_V.size() && voltage_V[segment + 1] < grid_voltage_V) segment++;
+    if (voltage_V.size() == 1 || grid_voltage_V <= voltage_V[0]) {
+      current_at_reference_A_[i] = current_A[0];
+      continue;
+    }
+    const double ratio = (grid_voltage_V - voltage_V[segment]) / (voltage_V[segment + 1] - voltage_V[segment]);
+    current_at_reference_A_[i] = current_A[segment] + std::min(ratio, 1.0) * (current_A[segment + 1] - current_A[segment]);
+  }
+}
+
+double SolarCellIvCurve::CalcCurrent_A(const double voltage_V, const double irradiance_W_m2) const {
+  if (voltage_V >= open_circuit_voltage_V_) return 0.0;
+  const double position = std::max(voltage_V, 0.0) * reciprocal_voltage_step_1_V_;
+  const size_t index = (size_t)position;
+  const double ratio = position - (double)index;
+  const double current_A = current_at_reference_A_[index] + ratio * (current_at_reference_A_[index + 1] - current_at_reference_A_[index]);
+  return current_A * irradiance_W_m2 * reciprocal_reference_irradiance_m2_W_;
+}
+
+size_t SolarCellArray::AddCell(const libra::Vector<3>& normal_vector_b, const double area_m2, const double efficiency) {
+  const libra::Vector<3> normalized_normal_vector_b = normal_vector_b.CalcNormalizedVector();
+  for (size_t axis = 0; axis < 3; axis++) normal_vector_b_[axis].push_back(normalized_normal_vector_b[axis]);
+  effective_area_m2_.push_back(area_m2 * efficiency);
+  shadow_factor_.push_back(1.0);
+  irradiance_W_m2_.push_back(0.0);
+  power_generation_W_.push_back(0.0);
+  return effective_area_m2_.size() - 1;
+}
+
+void SolarCellArray::CalcPowerGeneration(const libra::Vector<3>& sun_direction_b, const double power_density_W_m2) {
+  const size_t number_of_cells = GetNumberOfCells();
+  const double* RESTRICT nx = normal_vector_b_[0].data();
+  const double* RESTRICT ny = normal_vector_b_[1].data();
+  const double* RESTRICT nz = normal_vector_b_[2].data();
+  const double* RESTRICT effective_area_m2 = effective_area_m2_.data();
+  const double* RESTRICT shadow_factor = shadow_factor_.data();
+  double* RESTRICT irradiance_W_m2 = irradiance_W_m2_.data();
+  double* RESTRICT power_generation_W = power_generation_W_.data();
+  const double sx = sun_direction_b[0] * power_density_W_m2;
+  const double sy = sun_direction_b[1] * power_density_W_m2;
+  const double sz = sun_direction_b[2] * power_density_W_m2;
+
+  double total_power_generation_W = 0.0;
+  for (size_t i = 0; i < number_of_cells; i++) {
+    // Cells facing away from the sun do not generate power
+    irradiance_W_m2[i] = std::max(nx[i] * sx + ny[i] * sy + nz[i] * sz, 0.0) * shadow_factor[i];
+    power_generation_W[i] = irradiance_W_m2[i] * effective_area_m2[i];
+    total_power_generation_W += power_generation_W[i];
+  }
+  total_power_generation_W_ = total_power_generation_W;
+}
+
+double SolarCellArray::CalcStringCurrent_A(const size_t first_index, const size_t number_of_cells, const double string_voltage_V,
+                                           const SolarCellIvCurve& iv_curve) const {
+  if (number_of_cells == 0) return 0.0;
+  const size_t end_index = std::min(first_index + number_of_cells, GetNumberOfCells());
+  if (first_index >= end_index) return 0.0;
+  const double minimum_irradiance_W_m2 =
+      *std::min_element(irradiance_W_m2_.begin() + first_index, irradiance_W_m2_.begin() + end_index);
+  return iv_curve.CalcCurrent_A(string_voltage_V / (double)number_of_cells, minimum_irradiance_W_m2);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file solar_cell_array.hpp
+ * @brief Cell level model of solar arrays for the multi-panel and the partial shadow power prediction
+ */
+
+#ifndef S2E_COMPONENTS_REAL_POWER_SOLAR_CELL_ARRAY_HPP_
+#define S2E_COMPONENTS_REAL_POWER_SOLAR_CELL_ARRAY_HPP_
+
+#include <math_physics/math/vector.hpp>
+#include <vector>
+
+/**
+ * @class SolarCellIvCurve
+ * @brief Tabulated current-voltage curve of a solar cell
+ * @details The input curve is resampled on the uniform voltage grid at the construction, so the current at a voltage is calculated with the
+ *          index calculation and a linear interpolation without search. The current is proportional to the irradiance.
+ */
+class SolarCellIvCurve {
+ public:
+  /**
+   * @fn SolarCellIvCurve
+   * @brief Constructor
+   * @param [in] voltage_V: Voltage of the curve points in ascending order [V]
+   * @param [in] current_A: Current of the curve points at the reference irradiance [A]
+   * @param [in] reference_irradiance_W_m2: Irradiance of the curve measurement [W/m2]
+   * @param [in] number_of_samples: Number of the uniform voltage grid points
+   */
+  SolarCellIvCurve(const std::vector<double>& voltage_V, const std::vector<double>& current_A, const double reference_irradiance_W_m2,
+                   const size_t number_of_samples = 256);
+
+  /**
+   * @fn CalcCurrent_A
+   * @brief Return the current at the voltage and the irradiance [A]. The current is zero over the open circuit voltage.
+   * @param [in] voltage_V: Cell voltage [V]
+   * @param [in] irradiance_W_m2: Irradiance on the cell [W/m2]
+   */
+  double CalcCurrent_A(const double voltage_V, const double irradiance_W_m2) const;
+  /**
+   * @fn GetOpenCircuitVoltage_V
+   * @brief Return the open circuit voltage [V]
+   */
+  inline double GetOpenCircuitVoltage_V() const { return open_circuit_voltage_V_; }
+
+ private:
+  double open_circuit_voltage_V_;                //!< Maximum voltage of the curve [V]
+  double reciprocal_reference_irradiance_m2_W_;  //!< Reciprocal of the reference irradiance [m2/W]
+  double reciprocal_voltage_step_1_V_;           //!< Reciprocal of the voltage step of the grid [1/V]
+  std::vector<double> current_at_reference_A_;   //!< Current at the grid points for the reference irradiance [A]
+};
+
+/**
+ * @class SolarCellArray
+ * @brief Cell level model of solar arrays
+ * @details The normal vectors, the effective areas, and the shadow factors of the cells are stored in the structure of arrays layout. The power
+ *          generation of all cells is calculated in a single branch-free loop with the sun direction and the power density shared in the
+ *          step, so thousands of cells can be calculated at the component update.
+ */
+class SolarCellArray {
+ public:
+  /**
+   * @fn SolarCellArray
+   * @brief Constructor
+   */
+  SolarCellArray() {}
+
+  /**
+   * @fn AddCell
+   * @brief Add a cell
+   * @param [in] normal_vector_b: Normal vector of the cell in the body fixed frame
+   * @param [in] area_m2: Area of the cell [m2]
+   * @param [in] efficiency: Power generation efficiency of the cell including the transmission efficiency
+   * @return Index of the added cell
+   */
+  size_t AddCell(const libra::Vector<3>& normal_vector_b, const double area_m2, const double efficiency);
+  /**
+   * @fn SetShadowFactor
+   * @brief Set the shadow factor of the cell for the partial shadow by the spacecraft structure
+   * @param [in] index: Index of the cell
+   * @param [in] shadow_factor: Ratio of the lit area (0: fully shadowed, 1: fully lit)
+   */
+  inline void SetShadowFactor(const size_t index, const double shadow_factor) { shadow_factor_[index] = shadow_factor; }
+
+  /**
+   * @fn CalcPowerGeneration
+   * @brief Calculate the power generation and the irradiance of all cells
+   * @param [in] sun_direction_b: Unit vector to the sun in the body fixed frame
+   * @param [in] power_density_W_m2: Solar power density including the eclipse by the celestial bodies [W/m2]
+   */
+  void CalcPowerGeneration(const libra::Vector<3>& sun_direction_b, const double power_density_W_m2);
+  /**
+   * @fn CalcStringCurrent_A
+   * @brief Calculate the current of the series connected cells with the I-V curve
+   * @note The cells share the string voltage equally and the string current is limited by the least illuminated cell (no bypass diode)
+   * @param [in] first_index: Index of the first cell in the string
+   * @param [in] number_of_cells: Number of the series connected cells
+   * @param [in] string_voltage_V: Voltage of the string [V]
+   * @param [in] iv_curve: I-V curve of the cells
+   */
+  double CalcStringCurrent_A(const size_t first_index, const size_t number_of_cells, const double string_voltage_V,
+                             const SolarCellIvCurve& iv_curve) const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfCells
+   * @brief Return number of cells
+   */
+  inline size_t GetNumberOfCells() const { return effective_area_m2_.size(); }
+  /**
+   * @fn GetTotalPowerGeneration_W
+   * @brief Return total power generation of all cells at the latest calculation [W]
+   */
+  inline double GetTotalPowerGeneration_W() const { return total_power_generation_W_; }
+  /**
+   * @fn GetPowerGenerations_W
+   * @brief Return power generation of each cell at the latest calculation [W]
+   */
+  inline const std::vector<double>& GetPowerGenerations_W() const { return power_generation_W_; }
+  /**
+   * @fn GetIrradiances_W_m2
+   * @brief Return irradiance on each cell at the latest calculation [W/m2]
+   */
+  inline const std::vector<double>& GetIrradiances_W_m2() const { return irradiance_W_m2_; }
+
+ private:
+  std::vector<double> normal_vector_b_[3];  //!< Normal vector of each cell in the body fixed frame for each axis
+  std::vector<double> effective_area_m2_;   //!< Area multiplied by the efficiency of each cell [m2]
+  std::vector<double> shadow_factor_;       //!< Ratio of the lit area of each cell
+  std::vector<double> irradiance_W_m2_;     //!< Irradiance on each cell [W/m2]
+  std::vector<double> power_generation_W_;  //!< Power generation of each cell [W]
+  double total_power_generation_W_ = 0.0;   //!< Total power generation [W]
+};
+
+#endif  // S2E_COMPONENTS_REAL_POWER_SOLAR_CELL_ARRAY_HPP_
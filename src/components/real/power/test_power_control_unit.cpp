@@ -0,0 +1,105 @@
+/**
+ * @file test_power_control_unit.cpp
+ * @brief Test codes for PowerControlUnit class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "power_control_unit.hpp"
+
+namespace {
+const int kMaxPortId = 20;
+
+/**
+ * @fn SumCurrentConsumption_A
+ * @brief Return the sum of the current consumption of all connected ports [A]
+ */
+double SumCurrentConsumption_A(PowerControlUnit& power_control_unit) {
+  double total_current_consumption_A = 0.0;
+  for (int port_id = 0; port_id <= kMaxPortId; port_id++) {
+    const PowerPort* power_port = power_control_unit.GetPowerPort(port_id);
+    if (power_port != nullptr) total_current_consumption_A += power_port->GetCurrentConsumption_A();
+  }
+  return total_current_consumption_A;
+}
+}  // namespace
+
+/**
+ * @brief Test for the port table
+ */
+TEST(PowerControlUnit, PortTable) {
+  ClockGenerator clock_generator;
+  PowerControlUnit power_control_unit(&clock_generator);
+  EXPECT_EQ(nullptr, power_control_unit.GetPowerPort(0));
+  EXPECT_EQ(nullptr, power_control_unit.GetPowerPort(-1));
+
+  EXPECT_EQ(0, power_control_unit.ConnectPort(3, 1.0));
+  EXPECT_EQ(-1, power_control_unit.ConnectPort(3, 1.0));
+  EXPECT_EQ(-1, power_control_unit.ConnectPort(-1, 1.0));
+  ASSERT_NE(nullptr, power_control_unit.GetPowerPort(3));
+  EXPECT_EQ(3, power_control_unit.GetPowerPort(3)->GetPortId());
+  // The unknown IDs are not added by the access
+  EXPECT_EQ(nullptr, power_control_unit.GetPowerPort(1));
+  EXPECT_EQ(nullptr, power_control_unit.GetPowerPort(100));
+  EXPECT_EQ(-1, power_control_unit.ClosePort(1));
+
+  EXPECT_EQ(0, power_control_unit.ConnectPort(1, 1.0, 3.0, 2.0));
+  EXPECT_DOUBLE_EQ(2.0, power_control_unit.GetPowerPort(1)->GetAssumedPowerConsumption_W());
+  EXPECT_EQ(0, power_control_unit.ClosePort(3));
+  EXPECT_EQ(nullptr, power_control_unit.GetPowerPort(3));
+  EXPECT_EQ(-1, power_control_unit.ClosePort(3));
+  EXPECT_EQ(0, power_control_unit.ConnectPort(3, 1.0));
+}
+
+/**
+ * @brief Test for the incremental total current consumption against the sum of all ports
+ */
+TEST(PowerControlUnit, TotalCurrentConsumption) {
+  ClockGenerator clock_generator;
+  PowerControlUnit power_control_unit(&clock_generator);
+  EXPECT_DOUBLE_EQ(0.0, power_control_unit.GetTotalCurrentConsumption_A());
+
+  EXPECT_EQ(0, power_control_unit.ConnectPort(0, 1.0, 3.0, 4.0));
+  power_control_unit.GetPowerPort(0)->SetVoltage_V(5.0);
+  EXPECT_DOUBLE_EQ(0.8, power_control_unit.GetTotalCurrentConsumption_A());
+  // The over current shuts the port down
+  power_control_unit.GetPowerPort(0)->SetVoltage_V(3.0);
+  EXPECT_DOUBLE_EQ(0.0, power_control_unit.GetTotalCurrentConsumption_A());
+  EXPECT_FALSE(power_control_unit.GetPowerPort(0)->GetIsOn());
+  power_control_unit.GetPowerPort(0)->SetVoltage_V(8.0);
+  EXPECT_DOUBLE_EQ(0.5, power_control_unit.GetTotalCurrentConsumption_A());
+  // The closed port removes its share
+  EXPECT_EQ(0, power_control_unit.ClosePort(0));
+  EXPECT_DOUBLE_EQ(0.0, power_control_unit.GetTotalCurrentConsumption_A());
+
+  // Random operations on the ports
+  std::mt19937 generator(92);
+  std::uniform_int_distribution<int> port_distribution(0, kMaxPortId);
+  std::uniform_int_distribution<int> operation_distribution(0, 4);
+  std::uniform_real_distribution<double> voltage_distribution(0.0, 12.0);
+  std::uniform_real_distribution<double> power_distribution(0.0, 5.0);
+  for (size_t i = 0; i < 10000; i++) {
+    const int port_id = port_distribution(generator);
+    PowerPort* power_port = power_control_unit.GetPowerPort(port_id);
+    switch (operation_distribution(generator)) {
+      case 0:
+        power_control_unit.ConnectPort(port_id, 1.5, 3.3, power_distribution(generator));
+        break;
+      case 1:
+        power_control_unit.ClosePort(port_id);
+        break;
+      case 2:
+        if (power_port != nullptr) power_port->SetAssumedPowerConsumption_W(power_distribution(generator));
+        break;
+      default:
+        if (power_port != nullptr) power_port->SetVoltage_V(voltage_distribution(generator));
+        break;
+    }
+    ASSERT_NEAR(SumCurrentConsumption_A(power_control_unit), power_control_unit.GetTotalCurrentConsumption_A(), 1e-9) << "operation " << i;
+  }
+
+  for (int port_id = 0; port_id <= kMaxPortId; port_id++) power_control_unit.ClosePort(port_id);
+  EXPECT_NEAR(0.0, power_control_unit.GetTotalCurrentConsumption_A(), 1e-9);
+}
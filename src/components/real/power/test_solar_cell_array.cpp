@@ -0,0 +1,82 @@
+/**
+ * @file test_solar_cell_array.cpp
+ * @brief Test codes for SolarCellArray and SolarCellIvCurve classes with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "solar_cell_array.hpp"
+
+/**
+ * @brief Test for the power generation of the cells
+ */
+TEST(SolarCellArray, PowerGeneration) {
+  SolarCellArray cell_array;
+  const double area_m2 = 0.0026;
+  const double efficiency = 0.24;
+  libra::Vector<3> normal_vector_b(0.0);
+  normal_vector_b[0] = 2.0;  // Normalized in AddCell
+  cell_array.AddCell(normal_vector_b, area_m2, efficiency);
+  normal_vector_b[0] = -1.0;
+  cell_array.AddCell(normal_vector_b, area_m2, efficiency);
+  normal_vector_b[0] = 1.0;
+  normal_vector_b[1] = 1.0;
+  cell_array.AddCell(normal_vector_b, area_m2, efficiency);
+  ASSERT_EQ(3, cell_array.GetNumberOfCells());
+
+  const double power_density_W_m2 = 1366.0;
+  const double angle_rad = 0.3;
+  libra::Vector<3> sun_direction_b(0.0);
+  sun_direction_b[0] = cos(angle_rad);
+  sun_direction_b[1] = sin(angle_rad);
+  cell_array.CalcPowerGeneration(sun_direction_b, power_density_W_m2);
+
+  const double expected_irradiance_W_m2[3] = {power_density_W_m2 * cos(angle_rad), 0.0, power_density_W_m2 * cos(angle_rad - M_PI_4)};
+  double expected_total_power_W = 0.0;
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected_irradiance_W_m2[i], cell_array.GetIrradiances_W_m2()[i], 1e-10);
+    EXPECT_NEAR(expected_irradiance_W_m2[i] * area_m2 * efficiency, cell_array.GetPowerGenerations_W()[i], 1e-12);
+    expected_total_power_W += expected_irradiance_W_m2[i] * area_m2 * efficiency;
+  }
+  EXPECT_NEAR(expected_total_power_W, cell_array.GetTotalPowerGeneration_W(), 1e-12);
+
+  // Partial shadow
+  cell_array.SetShadowFactor(2, 0.25);
+  cell_array.CalcPowerGeneration(sun_direction_b, power_density_W_m2);
+  EXPECT_NEAR(0.25 * expected_irradiance_W_m2[2], cell_array.GetIrradiances_W_m2()[2], 1e-10);
+
+  // Eclipse
+  cell_array.CalcPowerGeneration(sun_direction_b, 0.0);
+  EXPECT_DOUBLE_EQ(0.0, cell_array.GetTotalPowerGeneration_W());
+}
+
+/**
+ * @brief Test for the I-V curve and the current of the series connected cells
+ */
+TEST(SolarCellArray, IvCurveAndStringCurrent) {
+  // Piecewise linear curve whose break points are on the uniform grid
+  const std::vector<double> voltage_V{0.0, 2.0, 2.5};
+  const std::vector<double> current_A{0.5, 0.48, 0.0};
+  const double reference_irradiance_W_m2 = 1000.0;
+  const SolarCellIvCurve iv_curve(voltage_V, current_A, reference_irradiance_W_m2, 11);
+  EXPECT_DOUBLE_EQ(2.5, iv_curve.GetOpenCircuitVoltage_V());
+  EXPECT_NEAR(0.5, iv_curve.CalcCurrent_A(0.0, reference_irradiance_W_m2), 1e-12);
+  EXPECT_NEAR(0.49, iv_curve.CalcCurrent_A(1.0, reference_irradiance_W_m2), 1e-12);
+  EXPECT_NEAR(0.24, iv_curve.CalcCurrent_A(2.25, reference_irradiance_W_m2), 1e-12);
+  EXPECT_NEAR(0.12, iv_curve.CalcCurrent_A(2.25, 0.5 * reference_irradiance_W_m2), 1e-12);
+  EXPECT_DOUBLE_EQ(0.0, iv_curve.CalcCurrent_A(2.6, reference_irradiance_W_m2));
+
+  // String of 4 cells with a shadowed cell
+  SolarCellArray cell_array;
+  libra::Vector<3> normal_vector_b(0.0);
+  normal_vector_b[2] = 1.0;
+  for (size_t i = 0; i < 4; i++) cell_array.AddCell(normal_vector_b, 0.0026, 0.3);
+  cell_array.SetShadowFactor(1, 0.5);
+  cell_array.CalcPowerGeneration(normal_vector_b, reference_irradiance_W_m2);
+
+  // The current is limited by the shadowed cell
+  EXPECT_NEAR(0.49 * 0.5, cell_array.CalcStringCurrent_A(0, 4, 4.0, iv_curve), 1e-12);
+  EXPECT_NEAR(0.49, cell_array.CalcStringCurrent_A(2, 2, 2.0, iv_curve), 1e-12);
+  EXPECT_DOUBLE_EQ(0.0, cell_array.CalcStringCurrent_A(0, 0, 2.0, iv_curve));
+}
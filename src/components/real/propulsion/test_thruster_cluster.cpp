@@ -0,0 +1,166 @@
+/**
+ * @file test_thruster_cluster.cpp
+ * @brief Test codes for ThrusterCluster class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "thruster_cluster.hpp"
+
+/**
+ * @class ThrusterClusterForTest
+ * @brief ThrusterCluster updated without the spacecraft structure
+ */
+class ThrusterClusterForTest : public ThrusterCluster {
+ public:
+  ThrusterClusterForTest(ClockGenerator* clock_generator, const double update_interval_s)
+      : ThrusterCluster(1, clock_generator, update_interval_s, nullptr, nullptr) {}
+
+  void Update(const libra::Vector<3>& center_of_mass_b_m) {
+    CalcThrustMagnitudes();
+    CalcThrustAndTorque(center_of_mass_b_m);
+    elapsed_time_s_ += update_interval_s_;
+  }
+};
+
+/**
+ * @brief Test for the on-time of the PWM output
+ */
+TEST(ThrusterCluster, PwmOnTime) {
+  // On for 0.03 s at the beginning of each 0.1 s period
+  EXPECT_NEAR(0.03, ThrusterCluster::CalcPwmOnTime_s(0.0, 0.1, 0.3, 0.1), 1e-15);
+  EXPECT_NEAR(0.01, ThrusterCluster::CalcPwmOnTime_s(0.02, 0.05, 0.3, 0.1), 1e-15);
+  EXPECT_NEAR(0.0, ThrusterCluster::CalcPwmOnTime_s(0.04, 0.09, 0.3, 0.1), 1e-15);
+  EXPECT_NEAR(0.02 + 0.03 + 0.01, ThrusterCluster::CalcPwmOnTime_s(0.01, 0.21, 0.3, 0.1), 1e-15);
+
+  // Continuous thrust and the duty saturation
+  EXPECT_NEAR(0.15, ThrusterCluster::CalcPwmOnTime_s(1.0, 1.5, 0.3, 0.0), 1e-15);
+  EXPECT_NEAR(0.5, ThrusterCluster::CalcPwmOnTime_s(1.0, 1.5, 1.2, 0.1), 1e-15);
+  EXPECT_NEAR(0.0, ThrusterCluster::CalcPwmOnTime_s(1.0, 1.5, -0.2, 0.1), 1e-15);
+}
+
+/**
+ * @brief Test for the total thrust and torque of the thrusters
+ */
+TEST(ThrusterCluster, ThrustAndTorque) {
+  ClockGenerator clock_generator;
+  const double update_interval_s = 0.1;
+  ThrusterClusterForTest thruster_cluster(&clock_generator, update_interval_s);
+
+  // Pair of thrusters for a pure torque around the Z axis and a thruster for a force along the X axis
+  libra::Vector<3> position_b_m(0.0);
+  libra::Vector<3> direction_b(0.0);
+  position_b_m[0] = 0.5;
+  direction_b[1] = 2.0;  // Normalized in AddThruster
+  thruster_cluster.AddThruster(position_b_m, direction_b, 1.0, 0.0, 0.0);
+  position_b_m[0] = -0.5;
+  direction_b[1] = -1.0;
+  thruster_cluster.AddThruster(position_b_m, direction_b, 1.0, 0.0, 0.0);
+  position_b_m[0] = -1.0;
+  direction_b[0] = 1.0;
+  direction_b[1] = 0.0;
+  thruster_cluster.AddThruster(position_b_m, direction_b, 0.2, 0.0, 0.0);
+  ASSERT_EQ(3, thruster_cluster.GetNumberOfThrusters());
+
+  // No thrust without duty
+  const libra::Vector<3> center_of_mass_b_m(0.0);
+  thruster_cluster.Update(center_of_mass_b_m);
+  EXPECT_DOUBLE_EQ(0.0, thruster_cluster.GetOutputThrust_b_N().CalcNorm());
+  EXPECT_DOUBLE_EQ(0.0, thruster_cluster.GetOutputTorque_b_Nm().CalcNorm());
+
+  // Continuous thrust
+  thruster_cluster.SetDuty(0, 0.5);
+  thruster_cluster.SetDuty(1, 0.5);
+  thruster_cluster.SetDuty(2, 1.0);
+  thruster_cluster.Update(center_of_mass_b_m);
+  EXPECT_NEAR(0.2, thruster_cluster.GetOutputThrust_b_N()[0], 1e-15);
+  EXPECT_NEAR(0.0, thruster_cluster.GetOutputThrust_b_N()[1], 1e-15);
+  EXPECT_NEAR(0.0, thruster_cluster.GetOutputThrust_b_N()[2], 1e-15);
+  EXPECT_NEAR(0.0, thruster_cluster.GetOutputTorque_b_Nm()[0], 1e-15);
+  EXPECT_NEAR(0.0, thruster_cluster.GetOutputTorque_b_Nm()[1], 1e-15);
+  EXPECT_NEAR(0.5, thruster_cluster.GetOutputTorque_b_Nm()[2], 1e-15);
+
+  // The torque is calculated around the center of mass
+  libra::Vector<3> shifted_center_of_mass_b_m(0.0);
+  shifted_center_of_mass_b_m[1] = 0.1;
+  thruster_cluster.Update(shifted_center_of_mass_b_m);
+  EXPECT_NEAR(0.5 + 0.1 * 0.2, thruster_cluster.GetOutputTorque_b_Nm()[2], 1e-15);
+
+  // PWM: the average over the update interval is the on-time ratio
+  thruster_cluster.SetDuty(0, 0.0);
+  thruster_cluster.SetDuty(1, 0.0);
+  thruster_cluster.SetDuty(2, 0.3);
+  thruster_cluster.SetPwmPeriod_s(2, 0.25);
+  thruster_cluster.ResetPwmPhase();
+  const double expected_on_ratio[5] = {0.75, 0.0, 0.5, 0.25, 0.0};
+  for (size_t i = 0; i < 5; i++) {
+    thruster_cluster.Update(center_of_mass_b_m);
+    EXPECT_NEAR(0.2 * expected_on_ratio[i], thruster_cluster.GetOutputThrust_b_N()[0], 1e-12);
+  }
+}
+
+/**
+ * @brief Test for the output schedule of the PWM thrusters against the fast tick sampling
+ */
+TEST(ThrusterCluster, OutputSchedule) {
+  ClockGenerator clock_generator;
+  const double update_interval_s = 0.1;
+  ThrusterClusterForTest thruster_cluster(&clock_generator, update_interval_s);
+
+  // PWM thruster along the X axis and continuous thruster along the Y axis
+  libra::Vector<3> position_b_m(0.0);
+  libra::Vector<3> direction_b(0.0);
+  position_b_m[1] = 0.5;
+  direction_b[0] = 1.0;
+  thruster_cluster.AddThruster(position_b_m, direction_b, 0.4, 0.0, 0.0);
+  position_b_m[1] = 0.0;
+  position_b_m[2] = 1.0;
+  direction_b[0] = 0.0;
+  direction_b[1] = 1.0;
+  thruster_cluster.AddThruster(position_b_m, direction_b, 0.2, 0.0, 0.0);
+  const double pwm_period_s = 0.03;
+  const double duty = 0.4;
+  thruster_cluster.SetDuty(0, duty);
+  thruster_cluster.SetPwmPeriod_s(0, pwm_period_s);
+  thruster_cluster.SetDuty(1, 0.5);
+  thruster_cluster.ResetPwmPhase();
+
+  // The schedule is reported in the sub-intervals shorter than the update interval of the component
+  const libra::Vector<3> center_of_mass_b_m(0.0);
+  const size_t number_of_reports = 5;
+  const double report_interval_s = update_interval_s / number_of_reports;
+  const double tick_s = 1.0e-6;
+  const size_t ticks_per_report = (size_t)std::round(report_interval_s / tick_s);
+  double time_s = 0.0;
+  for (size_t update = 0; update < 3; update++) {
+    thruster_cluster.Update(center_of_mass_b_m);
+    libra::Vector<3> total_impulse_b_Ns(0.0);
+    for (size_t report = 0; report < number_of_reports; report++) {
+      ActuatorOutputSchedule schedule;
+      thruster_cluster.ReportOutputSchedule(schedule, report_interval_s);
+      const libra::Vector<3> impulse_b_Ns = schedule.CalcImpulse_b_Ns(0.0, report_interval_s);
+      const libra::Vector<3> angular_impulse_b_Nms = schedule.CalcAngularImpulse_b_Nms(0.0, report_interval_s);
+      total_impulse_b_Ns += impulse_b_Ns;
+
+      // Reference: the on state force sampled at the middle of each fast tick
+      double pwm_on_time_s = 0.0;
+      for (size_t tick = 0; tick < ticks_per_report; tick++) {
+        const double tick_time_s = time_s + (tick + 0.5) * tick_s;
+        if (tick_time_s - std::floor(tick_time_s / pwm_period_s) * pwm_period_s < duty * pwm_period_s) pwm_on_time_s += tick_s;
+      }
+      EXPECT_NEAR(0.4 * pwm_on_time_s, impulse_b_Ns[0], 1e-9);
+      EXPECT_NEAR(0.2 * 0.5 * report_interval_s, impulse_b_Ns[1], 1e-15);
+      EXPECT_NEAR(0.0, impulse_b_Ns[2], 1e-15);
+      // Torque = r x F: (0, 0.5, 0) x (F, 0, 0) and (0, 0, 1) x (0, F, 0)
+      EXPECT_NEAR(-0.2 * 0.5 * report_interval_s, angular_impulse_b_Nms[0], 1e-15);
+      EXPECT_NEAR(0.0, angular_impulse_b_Nms[1], 1e-15);
+      EXPECT_NEAR(-0.5 * 0.4 * pwm_on_time_s, angular_impulse_b_Nms[2], 1e-9);
+      time_s += report_interval_s;
+    }
+    // The schedule over the update interval matches the averaged output
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(thruster_cluster.GetOutputThrust_b_N()[axis] * update_interval_s, total_impulse_b_Ns[axis], 1e-15);
+    }
+  }
+}
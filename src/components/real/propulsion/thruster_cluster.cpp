@@ -0,0 +1,233 @@
+/*
+ * @file thruster_cluster.cpp
+ * @brief Component emulation of a cluster of thrusters (e.g., RCS thrusters driven by PWM)
+ */
+#include "thruster_cluster.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <math_physics/math/constants.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <utilities/macros.hpp>
+
+ThrusterCluster::ThrusterCluster(const int prescaler, ClockGenerator* clock_generator, const double update_interval_s, const Structure* structure,
+                                 const Dynamics* dynamics)
+    : Component(prescaler, clock_generator),
+      update_interval_s_(update_interval_s),
+      magnitude_random_noise_(0.0, 1.0, global_randomization.MakeSeed()),
+      direction_random_noise_(0.0, 1.0, global_randomization.MakeSeed()),
+      rotation_random_noise_(global_randomization.MakeSeed()),
+      structure_(structure),
+      dynamics_(dynamics) {}
+
+size_t ThrusterCluster::AddThruster(const libra::Vector<3>& thruster_position_b_m, const libra::Vector<3>& thrust_direction_b,
+                                    const double max_magnitude_N, const double magnitude_standard_deviation_N,
+                                    const double direction_standard_deviation_rad) {
+  const libra::Vector<3> direction_b = thrust_direction_b.CalcNormalizedVector();
+  // Orthogonal basis around the thrust direction to rotate the direction with the error
+  libra::Vector<3> reference_b(0.0);
+  reference_b[0] = 1.0;
+  if (std::abs(direction_b[0]) > 0.9) {
+    reference_b[0] = 0.0;
+    reference_b[1] = 1.0;
+  }
+  const libra::Vector<3> first_orthogonal_direction_b = libra::OuterProduct(direction_b, reference_b).CalcNormalizedVector();
+  const libra::Vector<3> second_orthogonal_direction_b = libra::OuterProduct(direction_b, first_orthogonal_direction_b);
+
+  for (size_t axis = 0; axis < 3; axis++) {
+    position_b_m_[axis].push_back(thruster_position_b_m[axis]);
+    direction_b_[axis].push_back(direction_b[axis]);
+    first_orthogonal_direction_b_[axis].push_back(first_orthogonal_direction_b[axis]);
+    second_orthogonal_direction_b_[axis].push_back(second_orthogonal_direction_b[axis]);
+  }
+  max_magnitude_N_.push_back(max_magnitude_N);
+  magnitude_standard_deviation_N_.push_back(magnitude_standard_deviation_N);
+  direction_standard_deviation_rad_.push_back(direction_standard_deviation_rad);
+  duty_.push_back(0.0);
+  pwm_period_s_.push_back(0.0);
+  thrust_magnitude_N_.push_back(0.0);
+  on_thrust_magnitude_N_.push_back(0.0);
+  direction_error_cos_.push_back(1.0);
+  direction_error_first_.push_back(0.0);
+  direction_error_second_.push_back(0.0);
+  return max_magnitude_N_.size() - 1;
+}
+
+void ThrusterCluster::MainRoutine(const int time_count) {
+  UNUSED(time_count);
+
+  CalcThrustMagnitudes();
+  CalcThrustAndTorque(structure_->GetKinematicsParameters().GetCenterOfGravity_b_m());
+  elapsed_time_s_ += update_interval_s_;
+}
+
+void ThrusterCluster::PowerOffRoutine() {
+  output_thrust_b_N_ *= 0.0;
+  output_torque_b_Nm_ *= 0.0;
+  std::fill(thrust_magnitude_N_.begin(), thrust_magnitude_N_.end(), 0.0);
+  std::fill(on_thrust_magnitude_N_.begin(), on_thrust_magnitude_N_.end(), 0.0);
+  elapsed_time_s_ += update_interval_s_;
+}
+
+double ThrusterCluster::CalcPwmOnTime_s(const double start_time_s, const double end_time_s, const double duty, const double period_s) {
+  const double clipped_duty = std::min(std::max(duty, 0.0), 1.0);
+  if (period_s <= 0.0) return clipped_duty * (end_time_s - start_time_s);
+
+  // Accumulated on-time from the start of the PWM
+  const double on_duration_s = clipped_duty * period_s;
+  auto accumulated_on_time_s = [&](const double time_s) {
+    const double number_of_periods = std::floor(time_s / period_s);
+    return number_of_periods * on_duration_s + std::min(time_s - number_of_periods * period_s, on_duration_s);
+  };
+  return accumulated_on_time_s(end_time_s) - accumulated_on_time_s(start_time_s);
+}
+
+void ThrusterCluster::CalcThrustMagnitudes() {
+  const double start_time_s = elapsed_time_s_ - pwm_start_time_s_;
+  const double end_time_s = start_time_s + update_interval_s_;
+  const double reciprocal_interval = update_interval_s_ > 0.0 ? 1.0 / update_interval_s_ : 0.0;
+  schedule_time_s_ = start_time_s;
+
+  const size_t number_of_thrusters = GetNumberOfThrusters();
+  for (size_t i = 0; i < number_of_thrusters; i++) {
+    double on_ratio = CalcPwmOnTime_s(start_time_s, end_time_s, duty_[i], pwm_period_s_[i]) * reciprocal_interval;
+    if (update_interval_s_ <= 0.0) on_ratio = std::min(std::max(duty_[i], 0.0), 1.0);
+
+    double magnitude_N = on_ratio * max_magnitude_N_[i];
+    if (on_ratio > 0.0 + DBL_EPSILON && magnitude_standard_deviation_N_[i] > 0.0) {
+      magnitude_N += magnitude_standard_deviation_N_[i] * magnitude_random_noise_;
+    }
+    thrust_magnitude_N_[i] = magnitude_N;
+    // The averaged magnitude over the interval is the on state magnitude multiplied by the on-time ratio
+    on_thrust_magnitude_N_[i] = on_ratio > 0.0 ? magnitude_N / on_ratio : 0.0;
+
+    // Direction error: rotation by a normal random angle around a uniform random axis orthogonal to the thrust direction
+    if (direction_standard_deviation_rad_[i] > 0.0 + DBL_EPSILON) {
+      const double error_angle_rad = direction_standard_deviation_rad_[i] * direction_random_noise_;
+      const double axis_angle_rad = libra::tau * double(rotation_random_noise_);
+      const double sin_error = std::sin(error_angle_rad);
+      direction_error_cos_[i] = std::cos(error_angle_rad);
+      direction_error_first_[i] = sin_error * std::cos(axis_angle_rad);
+      direction_error_second_[i] = sin_error * std::sin(axis_angle_rad);
+    }
+  }
+}
+
+void ThrusterCluster::CalcThrustAndTorque(const libra::Vector<3>& center_of_mass_b_m) {
+  const size_t number_of_thrusters = GetNumberOfThrusters();
+  const double* RESTRICT rx = position_b_m_[0].data();
+  const double* RESTRICT ry = position_b_m_[1].data();
+  const double* RESTRICT rz = position_b_m_[2].data();
+  const double* RESTRICT dx = direction_b_[0].data();
+  const double* RESTRICT dy = direction_b_[1].data();
+  const double* RESTRICT dz = direction_b_[2].data();
+  const double* RESTRICT e1x = first_orthogonal_direction_b_[0].data();
+  const double* RESTRICT e1y = first_orthogonal_direction_b_[1].data();
+  const double* RESTRICT e1z = first_orthogonal_direction_b_[2].data();
+  const double* RESTRICT e2x = second_orthogonal_direction_b_[0].data();
+  const double* RESTRICT e2y = second_orthogonal_direction_b_[1].data();
+  const double* RESTRICT e2z = second_orthogonal_direction_b_[2].data();
+  const double* RESTRICT magnitude_N = thrust_magnitude_N_.data();
+  const double* RESTRICT error_cos = direction_error_cos_.data();
+  const double* RESTRICT error_first = direction_error_first_.data();
+  const double* RESTRICT error_second = direction_error_second_.data();
+  center_of_mass_b_m_ = center_of_mass_b_m;
+  const double cx = center_of_mass_b_m[0];
+  const double cy = center_of_mass_b_m[1];
+  const double cz = center_of_mass_b_m[2];
+
+  double fx_sum = 0.0, fy_sum = 0.0, fz_sum = 0.0;
+  double tx_sum = 0.0, ty_sum = 0.0, tz_sum = 0.0;
+  for (size_t i = 0; i < number_of_thrusters; i++) {
+    const double a = magnitude_N[i] * error_cos[i];
+    const double b = magnitude_N[i] * error_first[i];
+    const double c = magnitude_N[i] * error_second[i];
+    const double fx = a * dx[i] + b * e1x[i] + c * e2x[i];
+    const double fy = a * dy[i] + b * e1y[i] + c * e2y[i];
+    const double fz = a * dz[i] + b * e1z[i] + c * e2z[i];
+    const double lx = rx[i] - cx;
+    const double ly = ry[i] - cy;
+    const double lz = rz[i] - cz;
+    fx_sum += fx;
+    fy_sum += fy;
+    fz_sum += fz;
+    tx_sum += ly * fz - lz * fy;
+    ty_sum += lz * fx - lx * fz;
+    tz_sum += lx * fy - ly * fx;
+  }
+  output_thrust_b_N_[0] = fx_sum;
+  output_thrust_b_N_[1] = fy_sum;
+  output_thrust_b_N_[2] = fz_sum;
+  output_torque_b_Nm_[0] = tx_sum;
+  output_torque_b_Nm_[1] = ty_sum;
+  output_torque_b_Nm_[2] = tz_sum;
+}
+
+void ThrusterCluster::ReportOutputSchedule(ActuatorOutputSchedule& schedule, const double interval_s) const {
+  const size_t number_of_thrusters = GetNumberOfThrusters();
+  for (size_t i = 0; i < number_of_thrusters; i++) {
+    if (on_thrust_magnitude_N_[i] == 0.0) continue;
+    const double a = on_thrust_magnitude_N_[i] * direction_error_cos_[i];
+    const double b = on_thrust_magnitude_N_[i] * direction_error_first_[i];
+    const double c = on_thrust_magnitude_N_[i] * direction_error_second_[i];
+    libra::Vector<3> force_b_N, lever_arm_b_m;
+    for (size_t axis = 0; axis < 3; axis++) {
+      force_b_N[axis] = a * direction_b_[axis][i] + b * first_orthogonal_direction_b_[axis][i] + c * second_orthogonal_direction_b_[axis][i];
+      lever_arm_b_m[axis] = position_b_m_[axis][i] - center_of_mass_b_m_[axis];
+    }
+    // The PWM periods started schedule_time_s_ before the beginning of the interval
+    schedule.AddPwmSegments(0.0, interval_s, -schedule_time_s_, pwm_period_s_[i], duty_[i], force_b_N, libra::OuterProduct(lever_arm_b_m, force_b_N));
+  }
+  schedule_time_s_ += interval_s;
+}
+
+std::string ThrusterCluster::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  std::string head = "thruster_cluster_";
+  str_tmp += WriteVector(head + "output_thrust", "b", "N", 3);
+  str_tmp += WriteVector(head + "output_torque", "b", "Nm", 3);
+  str_tmp += WriteScalar(head + "output_thrust_norm", "N");
+  return str_tmp;
+}
+
+std::string ThrusterCluster::GetLogValue() const {
+  std::string str_tmp = "";
+
+  str_tmp += WriteVector(output_thrust_b_N_);
+  str_tmp += WriteVector(output_torque_b_Nm_);
+  str_tmp += WriteScalar(output_thrust_b_N_.CalcNorm());
+
+  return str_tmp;
+}
+
+ThrusterCluster InitThrusterCluster(ClockGenerator* clock_generator, const std::string file_name, const double component_step_time_s,
+                                    const Structure* structure, const Dynamics* dynamics) {
+  IniAccess thruster_conf(file_name);
+  const char* section = "THRUSTER_CLUSTER";
+
+  int prescaler = thruster_conf.ReadInt(section, "prescaler");
+  if (prescaler <= 1) prescaler = 1;
+  const int number_of_thrusters = thruster_conf.ReadInt(section, "number_of_thrusters");
+  const double pwm_period_s = thruster_conf.ReadDouble(section, "pwm_period_s");
+
+  ThrusterCluster thruster_cluster(prescaler, clock_generator, component_step_time_s * prescaler, structure, dynamics);
+  for (int thruster_id = 1; thruster_id <= number_of_thrusters; thruster_id++) {
+    std::string section_str = "THRUSTER_" + std::to_string(thruster_id);
+    auto* Section = section_str.c_str();
+
+    libra::Vector<3> thruster_pos;
+    thruster_conf.ReadVector(Section, "thruster_position_b_m", thruster_pos);
+    libra::Vector<3> thruster_dir;
+    thruster_conf.ReadVector(Section, "thruster_direction_b", thruster_dir);
+    double max_magnitude_N = thruster_conf.ReadDouble(Section, "thrust_magnitude_N");
+    double magnitude_standard_deviation_N = thruster_conf.ReadDouble(Section, "thrust_error_standard_deviation_N");
+    double deg_err = thruster_conf.ReadDouble(Section, "direction_error_standard_deviation_deg") * libra::pi / 180.0;
+
+    size_t index = thruster_cluster.AddThruster(thruster_pos, thruster_dir, max_magnitude_N, magnitude_standard_deviation_N, deg_err);
+    thruster_cluster.SetPwmPeriod_s(index, pwm_period_s);
+  }
+  return thruster_cluster;
+}
@@ -0,0 +1,199 @@
+/*
+ * @file thruster_cluster.hpp
+ * @brief Component emulation of a cluster of thrusters (e.g., RCS thrusters driven by PWM)
+ */
+
+#ifndef S2E_COMPONENTS_REAL_PROPULSION_THRUSTER_CLUSTER_HPP_
+#define S2E_COMPONENTS_REAL_PROPULSION_THRUSTER_CLUSTER_HPP_
+
+#include <dynamics/dynamics.hpp>
+#include <logger/logger.hpp>
+#include <math_physics/math/vector.hpp>
+#include <math_physics/randomization/minimal_standard_linear_congruential_generator_with_shuffle.hpp>
+#include <math_physics/randomization/normal_randomization.hpp>
+#include <simulation/spacecraft/structure/structure.hpp>
+#include <vector>
+
+#include "../../base/component.hpp"
+
+/*
+ * @class ThrusterCluster
+ * @brief Component emulation of a cluster of thrusters
+ * @details The parameters and the commands of all thrusters are stored in the structure of arrays layout, and the total thrust and torque
+ *          are calculated in a single loop. The PWM output of each thruster is integrated analytically over the update interval, so the
+ *          averaged thrust is exact without the sampling at the fast update. The on and off timings can be passed to the dynamics with
+ *          ReportOutputSchedule instead of the averaged thrust.
+ */
+class ThrusterCluster : public Component, public ILoggable {
+ public:
+  /**
+   * @fn ThrusterCluster
+   * @brief Constructor
+   * @param [in] prescaler: Frequency scale factor for update
+   * @param [in] clock_generator: Clock generator
+   * @param [in] update_interval_s: Update interval of the component [sec]
+   * @param [in] structure: Spacecraft structure information
+   * @param [in] dynamics: Spacecraft dynamics information
+   */
+  ThrusterCluster(const int prescaler, ClockGenerator* clock_generator, const double update_interval_s, const Structure* structure,
+                  const Dynamics* dynamics);
+
+  /**
+   * @fn AddThruster
+   * @brief Add a thruster
+   * @param [in] thruster_position_b_m: Position of thruster on the body fixed frame [m]
+   * @param [in] thrust_direction_b: Direction of thrust on the body fixed frame
+   * @param [in] max_magnitude_N: Maximum thrust magnitude [N]
+   * @param [in] magnitude_standard_deviation_N: Standard deviation of thrust magnitude error [N]
+   * @param [in] direction_standard_deviation_rad: Standard deviation of thrust direction error [rad]
+   * @return Index of the added thruster
+   */
+  size_t AddThruster(const libra::Vector<3>& thruster_position_b_m, const libra::Vector<3>& thrust_direction_b, const double max_magnitude_N,
+                     const double magnitude_standard_deviation_N, const double direction_standard_deviation_rad);
+
+  // Override functions for Component
+  /**
+   * @fn MainRoutine
+   * @brief Main routine to calculate force generation
+   */
+  void MainRoutine(const int time_count) override;
+  /**
+   * @fn PowerOffRoutine
+   * @brief Power off routine to stop force generation
+   */
+  void PowerOffRoutine() override;
+  /**
+   * @fn ReportOutputSchedule
+   * @brief Report the PWM on segments of all thrusters for the coming interval
+   * @note Call this function once in each simulation step after the component update, and do not add GetOutputThrust_b_N and
+   *       GetOutputTorque_b_Nm to the force and torque of the spacecraft in that case. The reported interval advances by interval_s in each
+   *       call, and restarts from the beginning of the update interval at MainRoutine.
+   * @param [out] schedule: Output schedule to add the segments
+   * @param [in] interval_s: Length of the coming interval [sec]
+   */
+  void ReportOutputSchedule(ActuatorOutputSchedule& schedule, const double interval_s) const override;
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const override;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const override;
+
+  /**
+   * @fn CalcPwmOnTime_s
+   * @brief Calculate the on-time of the PWM output in the time range
+   * @note The output is on at the beginning of each period for duty * period
+   * @param [in] start_time_s: Start time of the range from the start of the PWM [sec]
+   * @param [in] end_time_s: End time of the range from the start of the PWM [sec]
+   * @param [in] duty: PWM duty [0.0 : 1.0]
+   * @param [in] period_s: PWM period [sec]
+   * @return On-time in the range [sec]
+   */
+  static double CalcPwmOnTime_s(const double start_time_s, const double end_time_s, const double duty, const double period_s);
+
+  // Getter
+  /**
+   * @fn GetNumberOfThrusters
+   * @brief Return number of thrusters
+   */
+  inline size_t GetNumberOfThrusters() const { return max_magnitude_N_.size(); }
+  /**
+   * @fn GetOutputThrust_b_N
+   * @brief Return total thrust of all thrusters on the body fixed frame [N]
+   */
+  inline const libra::Vector<3> GetOutputThrust_b_N() const { return output_thrust_b_N_; };
+  /**
+   * @fn GetOutputTorque_b_Nm
+   * @brief Return total torque of all thrusters on the body fixed frame [Nm]
+   */
+  inline const libra::Vector<3> GetOutputTorque_b_Nm() const { return output_torque_b_Nm_; };
+
+  // Setter
+  /**
+   * @fn SetDuty
+   * @brief Set duty of the thruster
+   * @param [in] index: Index of the thruster
+   * @param [in] duty: Duty [0.0 : 1.0]
+   */
+  inline void SetDuty(const size_t index, const double duty) { duty_[index] = duty; }
+  /**
+   * @fn SetPwmPeriod_s
+   * @brief Set PWM period of the thruster
+   * @param [in] index: Index of the thruster
+   * @param [in] period_s: PWM period [sec]. Zero or negative value makes the thrust continuous with the duty ratio.
+   */
+  inline void SetPwmPeriod_s(const size_t index, const double period_s) { pwm_period_s_[index] = period_s; }
+  /**
+   * @fn ResetPwmPhase
+   * @brief Restart the PWM periods of all thrusters from the current time (e.g., at the new command)
+   */
+  inline void ResetPwmPhase() { pwm_start_time_s_ = elapsed_time_s_; }
+
+ protected:
+  double update_interval_s_;              //!< Update interval of the component [sec]
+  double elapsed_time_s_ = 0.0;           //!< Elapsed time from the start of the simulation [sec]
+  double pwm_start_time_s_ = 0.0;         //!< Start time of the PWM periods [sec]
+  mutable double schedule_time_s_ = 0.0;  //!< Time from the start of the PWM at the beginning of the next reported schedule [sec]
+
+  // Parameters and commands of each thruster
+  std::vector<double> position_b_m_[3];                   //!< Thruster position on the body fixed frame for each axis [m]
+  std::vector<double> direction_b_[3];                    //!< Thrust direction on the body fixed frame for each axis
+  std::vector<double> first_orthogonal_direction_b_[3];   //!< First unit vector orthogonal to the thrust direction for each axis
+  std::vector<double> second_orthogonal_direction_b_[3];  //!< Second unit vector orthogonal to the thrust direction for each axis
+  std::vector<double> max_magnitude_N_;                   //!< Maximum thrust magnitude [N]
+  std::vector<double> magnitude_standard_deviation_N_;    //!< Standard deviation of thrust magnitude error [N]
+  std::vector<double> direction_standard_deviation_rad_;  //!< Standard deviation of thrust direction error [rad]
+  std::vector<double> duty_;                              //!< PWM duty [0.0 : 1.0]
+  std::vector<double> pwm_period_s_;                      //!< PWM period [sec]
+  std::vector<double> thrust_magnitude_N_;                //!< Averaged thrust magnitude in the latest update [N]
+  std::vector<double> on_thrust_magnitude_N_;             //!< Thrust magnitude at the on state in the latest update [N]
+  std::vector<double> direction_error_cos_;               //!< Cosine of the thrust direction error angle in the latest update
+  std::vector<double> direction_error_first_;             //!< Thrust direction error component along the first orthogonal vector
+  std::vector<double> direction_error_second_;            //!< Thrust direction error component along the second orthogonal vector
+
+  // Noise
+  libra::NormalRand magnitude_random_noise_;                    //!< Normal random for thrust magnitude error (standard deviation 1)
+  libra::NormalRand direction_random_noise_;                    //!< Normal random for thrust direction error (standard deviation 1)
+  libra::MinimalStandardLcgWithShuffle rotation_random_noise_;  //!< Uniform random for the axis of the thrust direction error
+
+  // outputs
+  libra::Vector<3> output_thrust_b_N_{0.0};   //!< Total thrust on the body fixed frame [N]
+  libra::Vector<3> output_torque_b_Nm_{0.0};  //!< Total torque on the body fixed frame [Nm]
+  libra::Vector<3> center_of_mass_b_m_{0.0};  //!< Center of mass position used in the latest update at body frame [m]
+
+  const Structure* structure_;  //!< Spacecraft structure information
+  const Dynamics* dynamics_;    //!< Spacecraft dynamics information
+
+  /**
+   * @fn CalcThrustMagnitudes
+   * @brief Calculate the averaged thrust magnitude and the direction error of each thruster in the update interval
+   */
+  void CalcThrustMagnitudes();
+  /**
+   * @fn CalcThrustAndTorque
+   * @brief Calculate the total thrust and torque with the thrust magnitudes
+   * @param [in] center_of_mass_b_m: Center of mass position at body frame [m]
+   */
+  void CalcThrustAndTorque(const libra::Vector<3>& center_of_mass_b_m);
+};
+
+/**
+ * @fn InitThrusterCluster
+ * @brief Initialize function of ThrusterCluster
+ * @note The thrusters are read from the THRUSTER_1 to THRUSTER_N sections with the same format as SimpleThruster
+ * @param [in] clock_generator: Clock generator
+ * @param [in] file_name: Path to initialize file
+ * @param [in] component_step_time_s: Component step time [sec]
+ * @param [in] structure: Spacecraft structure information
+ * @param [in] dynamics: Spacecraft dynamics information
+ */
+ThrusterCluster InitThrusterCluster(ClockGenerator* clock_generator, const std::string file_name, const double component_step_time_s,
+                                    const Structure* structure, const Dynamics* dynamics);
+
+#endif  // S2E_COMPONENTS_REAL_PROPULSION_THRUSTER_CLUSTER_HPP_
@@ -26,8 +26,7 @@ AirDrag::AirDrag(const std::vector<Surface>& surfaces, const libra::Vector<3>& c
 void AirDrag::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
   double air_density_kg_m3 = local_environment.GetAtmosphere().GetAirDensity_kg_m3();
 
-  libra::Matrix<3, 3> dcm_ecef2eci =
-      local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation().GetDcmJ2000ToEcef().Transpose();
+  const libra::Matrix<3, 3>& dcm_ecef2eci = local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation().GetDcmEcefToJ2000();
   libra::Vector<3> relative_velocity_wrt_atmosphere_i_m_s = dcm_ecef2eci * dynamics.GetOrbit().GetVelocity_ecef_m_s();
   libra::Quaternion quaternion_i2b = dynamics.GetAttitude().GetQuaternion_i2b();
   libra::Vector<3> velocity_b_m_s = quaternion_i2b.FrameConversion(relative_velocity_wrt_atmosphere_i_m_s);
@@ -38,7 +37,7 @@ void AirDrag::CalcCoefficients(const libra::Vector<3>& velocity_b_m_s, const dou
   double velocity_norm_m_s = velocity_b_m_s.CalcNorm();
   CalcCnCt(velocity_b_m_s);
   for (size_t i = 0; i < surfaces_.size(); i++) {
-    double k = 0.5 * air_density_kg_m3 * velocity_norm_m_s * velocity_norm_m_s * surfaces_[i].GetArea_m2();
+    double k = 0.5 * air_density_kg_m3 * velocity_norm_m_s * velocity_norm_m_s * surface_arrays_.area_m2_[i];
     normal_coefficients_[i] = k * cn_[i];
     tangential_coefficients_[i] = k * ct_[i];
   }
@@ -68,7 +67,7 @@ void AirDrag::CalcCnCt(const Vector<3>& velocity_b_m_s) {
   for (size_t i = 0; i < surfaces_.size(); i++) {
     double speed_n = speed * cos_theta_[i];
     double speed_t = speed * sin_theta_[i];
-    double diffuse = 1.0 - surfaces_[i].GetAirSpecularity();
+    double diffuse = 1.0 - surface_arrays_.air_specularity_[i];
     cn_[i] = (2.0 - diffuse) / sqrt(libra::pi) * CalcFunctionPi(speed_n) / (speed * speed) +
              diffuse / 2.0 * CalcFunctionChi(speed_n) / (speed * speed) * sqrt(wall_temperature_K_ / molecular_temperature_K_);
     ct_[i] = diffuse * speed_t * CalcFunctionChi(speed_n) / (sqrt(libra::pi) * speed * speed);
@@ -106,6 +105,8 @@ AirDrag InitAirDrag(const std::string initialize_file_path, const std::vector<Su
 
   AirDrag air_drag(surfaces, center_of_gravity_b_m, wall_temperature_K, molecular_temperature_K, molecular_weight_g_mol, is_calc_enable);
   air_drag.is_log_enabled_ = is_log_enable;
+  air_drag.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
+  InitSelfShadowing(initialize_file_path, section, air_drag);
 
   return air_drag;
 }
@@ -0,0 +1,80 @@
+/**
+ * @file benchmark_surface_force.cpp
+ * @brief Benchmark codes for the surface force calculation with the number of surfaces
+ */
+#include <iostream>
+#include <utilities/benchmark_measurement.hpp>
+#include <vector>
+
+#include "solar_radiation_pressure_disturbance.hpp"
+
+/**
+ * @class BenchmarkSolarRadiationPressure
+ * @brief Solar radiation pressure disturbance which exposes the calculation without the environment
+ */
+class BenchmarkSolarRadiationPressure : public SolarRadiationPressureDisturbance {
+ public:
+  using SolarRadiationPressureDisturbance::SolarRadiationPressureDisturbance;
+  using SurfaceForce::CalcTorqueForce;
+};
+
+/**
+ * @fn MakeSurfaces
+ * @brief Make the surfaces of the box shaped spacecraft. The panels are distributed to the six faces.
+ * @param [in] number_of_surfaces: Number of surfaces
+ */
+std::vector<Surface> MakeSurfaces(const size_t number_of_surfaces) {
+  std::vector<Surface> surfaces;
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    const size_t face = i % 6;
+    const double sign = (face % 2 == 0) ? 1.0 : -1.0;
+    libra::Vector<3> normal_b(0.0);
+    normal_b[face / 2] = sign;
+    libra::Vector<3> position_b_m(0.0);
+    position_b_m[face / 2] = 0.5 * sign;
+    position_b_m[(face / 2 + 1) % 3] = 0.001 * (double)(i / 6);
+    surfaces.emplace_back(position_b_m, normal_b, 1.0 / (double)(number_of_surfaces / 6 + 1), 0.3, 0.4, 0.5);
+  }
+  return surfaces;
+}
+
+int main() {
+  const std::vector<size_t> numbers_of_surfaces = {6, 60, 600, 6000};
+  const double solar_pressure_N_m2 = 4.56e-6;
+  libra::Vector<3> center_of_gravity_b_m(0.0);
+
+  std::cout << "surfaces, force and torque [ns/call], force and torque [ns/surface], with self shadowing [ns/call]" << std::endl;
+  for (size_t number_of_surfaces : numbers_of_surfaces) {
+    const std::vector<Surface> surfaces = MakeSurfaces(number_of_surfaces);
+    BenchmarkSolarRadiationPressure srp(surfaces, center_of_gravity_b_m);
+
+    libra::Vector<3> sun_direction_b;
+    sun_direction_b[0] = 0.6;
+    sun_direction_b[1] = 0.7;
+    sun_direction_b[2] = 0.2;
+    libra::Vector<3> force_b_N(0.0);
+    // Keep the number of evaluated surfaces roughly constant
+    const size_t number_of_calls = 20000000 / number_of_surfaces + 10;
+    auto calculation = [&]() {
+      // Rotate the direction slightly to avoid the same calculation
+      sun_direction_b[2] += 1.0e-9;
+      force_b_N += srp.CalcTorqueForce(sun_direction_b, solar_pressure_N_m2);
+    };
+    const double calculation_ns = MeasureNanosecondsPerCall(calculation, number_of_calls);
+
+    std::cout << number_of_surfaces << ", " << calculation_ns << ", " << calculation_ns / (double)number_of_surfaces << ", ";
+    // The ray casting to make the visibility table is proportional to the square of the number of surfaces
+    if (number_of_surfaces <= 600) {
+      srp.EnableSelfShadowing(10.0, 4);
+      std::cout << MeasureNanosecondsPerCall(calculation, number_of_calls) << std::endl;
+    } else {
+      std::cout << "-" << std::endl;
+    }
+    // Use the results to avoid optimization
+    if (force_b_N[0] != force_b_N[0]) {
+      std::cout << "NaN detected" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file composed_force_model.cpp
+ * @brief Orbit force model composed of the acceleration terms at compile time
+ */
+
+#include "composed_force_model.hpp"
+
+#include <iostream>
+#include <setting_file_reader/initialize_file_access.hpp>
+
+#include "geopotential.hpp"
+
+namespace force_model_term {
+
+static const char* kSection = "COMPOSED_FORCE_MODEL";  //!< Section name of the parameters
+
+void J2::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+  (void)dynamics;
+  const libra::Matrix<3, 3>& dcm_eci_to_ecef =
+      local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation().GetDcmJ2000ToEcef();
+  // The Z axis of the ECEF frame in the inertial frame
+  libra::Vector<3> pole_i;
+  for (size_t i = 0; i < 3; i++) pole_i[i] = dcm_eci_to_ecef[2][i];
+  SetPole_i(pole_i);
+}
+
+Geopotential::Geopotential(const std::string initialize_file_path) {
+  gravity_potential_ = InitGeopotential(initialize_file_path).GetGravityPotential();
+}
+
+void Geopotential::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+  (void)dynamics;
+  const EarthRotation& earth_rotation = local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation();
+  dcm_eci_to_ecef_ = earth_rotation.GetDcmJ2000ToEcef();
+  dcm_ecef_to_eci_ = earth_rotation.GetDcmEcefToJ2000();
+}
+
+Drag::Drag(const std::string initialize_file_path) {
+  IniAccess conf(initialize_file_path);
+  ballistic_coefficient_m2_kg_ = conf.ReadDouble(kSection, "ballistic_coefficient_m2_kg");
+}
+
+void Drag::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+  (void)dynamics;
+  const libra::Matrix<3, 3>& dcm_eci_to_ecef =
+      local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation().GetDcmJ2000ToEcef();
+  libra::Vector<3> earth_angular_velocity_i_rad_s;
+  for (size_t i = 0; i < 3; i++) earth_angular_velocity_i_rad_s[i] = environment::earth_mean_angular_velocity_rad_s * dcm_eci_to_ecef[2][i];
+  SetEnvironment(local_environment.GetAtmosphere().GetAirDensity_kg_m3(), earth_angular_velocity_i_rad_s);
+}
+
+SolarRadiationPressure::SolarRadiationPressure(const std::string initialize_file_path) {
+  IniAccess conf(initialize_file_path);
+  radiation_coefficient_m2_kg_ = conf.ReadDouble(kSection, "radiation_coefficient_m2_kg");
+}
+
+void SolarRadiationPressure::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+  const LocalCelestialInformation& celestial_information = local_environment.GetCelestialInformation();
+  if (!sun_.is_valid_) sun_ = celestial_information.GetGlobalInformation().GetBodyHandle("SUN");
+  SetEnvironment(local_environment.GetSolarRadiationPressure().GetPressure_N_m2(),
+                 dynamics.GetOrbit().GetPosition_i_m() + celestial_information.GetPositionFromSpacecraft_i_m(sun_));
+}
+
+ThirdBody::ThirdBody(const std::string initialize_file_path) {
+  IniAccess conf(initialize_file_path);
+  const int number_of_third_body = conf.ReadInt(kSection, "number_of_third_body");
+  if (number_of_third_body > 0) body_name_list_ = conf.ReadVectorString(kSection, "third_body_name", (size_t)number_of_third_body);
+}
+
+void ThirdBody::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+  const LocalCelestialInformation& celestial_information = local_environment.GetCelestialInformation();
+  const CelestialInformation& global_celestial_information = celestial_information.GetGlobalInformation();
+  // The body names are resolved only at the first update since the celestial information is not given in the constructor
+  if (body_handle_list_.size() != body_name_list_.size()) {
+    for (const auto& body_name : body_name_list_) {
+      body_handle_list_.push_back(global_celestial_information.GetBodyHandle(body_name.c_str()));
+      gravity_constant_list_m3_s2_.push_back(global_celestial_information.GetGravityConstant_m3_s2(body_handle_list_.back()));
+    }
+    body_position_list_i_m_.resize(body_handle_list_.size());
+  }
+  const libra::Vector<3> spacecraft_position_i_m = dynamics.GetOrbit().GetPosition_i_m();
+  for (size_t i = 0; i < body_handle_list_.size(); i++) {
+    body_position_list_i_m_[i] = spacecraft_position_i_m + celestial_information.GetPositionFromSpacecraft_i_m(body_handle_list_[i]);
+  }
+}
+
+void Relativity::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+  (void)dynamics;
+  SetGravityConstant_m3_s2(local_environment.GetCelestialInformation().GetGlobalInformation().GetCenterBodyGravityConstant_m3_s2());
+}
+
+Empirical::Empirical(const std::string initialize_file_path) {
+  IniAccess conf(initialize_file_path);
+  conf.ReadVector(kSection, "empirical_acceleration_rtn_m_s2", acceleration_rtn_m_s2_);
+}
+
+}  // namespace force_model_term
+
+ComposedForceModelBase* InitComposedForceModel(const std::string initialize_file_path) {
+  namespace term = force_model_term;
+  IniAccess conf(initialize_file_path);
+  const std::string composition = conf.ReadString("COMPOSED_FORCE_MODEL", "composition");
+
+  // Precompiled compositions
+  if (composition == "J2_DRAG") {
+    return new ComposedForceModel<term::J2, term::Drag>(initialize_file_path);
+  } else if (composition == "J2_DRAG_SRP_THIRD_BODY") {
+    return new ComposedForceModel<term::J2, term::Drag, term::SolarRadiationPressure, term::ThirdBody>(initialize_file_path);
+  } else if (composition == "GEOPOTENTIAL_DRAG_SRP_THIRD_BODY") {
+    return new ComposedForceModel<term::Geopotential, term::Drag, term::SolarRadiationPressure, term::ThirdBody>(initialize_file_path);
+  } else if (composition == "GEOPOTENTIAL_DRAG_SRP_THIRD_BODY_RELATIVITY_EMPIRICAL") {
+    return new ComposedForceModel<term::Geopotential, term::Drag, term::SolarRadiationPressure, term::ThirdBody, term::Relativity,
+                                  term::Empirical>(initialize_file_path);
+  } else if (composition != "NONE" && composition != "NULL") {
+    std::cerr << "[WARNINGS] Composed force model " << composition << " is not defined. The composed force model is disabled." << std::endl;
+  }
+  return nullptr;
+}
@@ -0,0 +1,402 @@
+/**
+ * @file composed_force_model.hpp
+ * @brief Orbit force model composed of the acceleration terms at compile time
+ */
+
+#ifndef S2E_DISTURBANCES_COMPOSED_FORCE_MODEL_HPP_
+#define S2E_DISTURBANCES_COMPOSED_FORCE_MODEL_HPP_
+
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../dynamics/orbit/orbit_force_model.hpp"
+#include "../environment/global/celestial_body_handle.hpp"
+#include "../environment/local/local_environment.hpp"
+#include "../math_physics/gravity/gravity_potential.hpp"
+#include "../math_physics/math/matrix_vector.hpp"
+#include "../math_physics/math/vector.hpp"
+#include "third_body_gravity.hpp"
+
+/**
+ * @class ComposedForceModelBase
+ * @brief Base class of the composed force models to select the composition in the initialization file
+ * @details The acceleration is calculated at the step start in Update and added to the held acceleration of the orbit. The difference from
+ *          it is returned at each stage of the orbit integrator.
+ */
+class ComposedForceModelBase : public OrbitForceModel {
+ public:
+  /**
+   * @fn ~ComposedForceModelBase
+   * @brief Destructor
+   */
+  virtual ~ComposedForceModelBase() {}
+
+  /**
+   * @fn Update
+   * @brief Update the environment of the terms and calculate the acceleration at the step start
+   * @param [in] local_environment: Local environment information
+   * @param [in] dynamics: Dynamics information
+   */
+  virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) = 0;
+
+  /**
+   * @fn GetAcceleration_i_m_s2
+   * @brief Return the acceleration at the step start in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> GetAcceleration_i_m_s2() const { return acceleration_i_m_s2_; }
+
+ protected:
+  libra::Vector<3> acceleration_i_m_s2_{0.0};  //!< Acceleration at the step start in the inertial frame [m/s2]
+};
+
+/**
+ * @class ComposedForceModel
+ * @brief Orbit force model composed of the acceleration terms
+ * @details Each term is a class with the following functions, and the terms are called without the virtual dispatch, so the compiler can
+ *          inline and fuse the acceleration calculation of all terms.
+ *          - Constructor(const std::string initialize_file_path): Read the parameters
+ *          - void Update(const LocalEnvironment&, const Dynamics&): Hold the environment of the step (e.g. body positions, density)
+ *          - libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s)
+ */
+template <typename... Terms>
+class ComposedForceModel : public ComposedForceModelBase {
+ public:
+  /**
+   * @fn ComposedForceModel
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file of the terms
+   */
+  explicit ComposedForceModel(const std::string initialize_file_path) : terms_(Terms(initialize_file_path)...) {}
+
+  /**
+   * @fn Update
+   * @brief Override Update function of ComposedForceModelBase
+   */
+  virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+    std::apply([&](auto&... term) { (term.Update(local_environment, dynamics), ...); }, terms_);
+    acceleration_i_m_s2_ = CalcAcceleration_i_m_s2(dynamics.GetOrbit().GetPosition_i_m(), dynamics.GetOrbit().GetVelocity_i_m_s());
+  }
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Override CalcStageAcceleration_i_m_s2 function of OrbitForceModel
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_step_start_s, const libra::Vector<3>& position_i_m,
+                                                        const libra::Vector<3>& velocity_i_m_s) {
+    (void)time_from_step_start_s;
+    return CalcAcceleration_i_m_s2(position_i_m, velocity_i_m_s) - acceleration_i_m_s2_;
+  }
+
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the sum of the accelerations of all terms with the environment of the latest update
+   * @param [in] position_i_m: Position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+   * @return Acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) {
+    libra::Vector<3> acceleration_i_m_s2(0.0);
+    std::apply([&](auto&... term) { ((acceleration_i_m_s2 += term.CalcAcceleration_i_m_s2(position_i_m, velocity_i_m_s)), ...); }, terms_);
+    return acceleration_i_m_s2;
+  }
+
+ private:
+  std::tuple<Terms...> terms_;  //!< Acceleration terms
+};
+
+namespace force_model_term {
+
+/**
+ * @class J2
+ * @brief Zonal J2 term of the Earth gravity around the rotation axis of the latest update
+ */
+class J2 {
+ public:
+  /**
+   * @fn J2
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file (not used)
+   */
+  explicit J2(const std::string initialize_file_path) { (void)initialize_file_path; }
+  /**
+   * @fn Update
+   * @brief Hold the rotation axis of the Earth
+   */
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn SetPole_i
+   * @brief Set the rotation axis of the Earth held in the step
+   * @param [in] pole_i: Unit vector of the rotation axis in the inertial frame
+   */
+  inline void SetPole_i(const libra::Vector<3>& pole_i) { pole_i_ = pole_i; }
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const {
+    (void)velocity_i_m_s;
+    const double r2_m2 = InnerProduct(position_i_m, position_i_m);
+    const double r_m = std::sqrt(r2_m2);
+    const double z_m = InnerProduct(position_i_m, pole_i_);
+    const double factor = -1.5 * coefficient_m5_s2_ / (r2_m2 * r2_m2 * r_m);
+    return factor * ((1.0 - 5.0 * z_m * z_m / r2_m2) * position_i_m + (2.0 * z_m) * pole_i_);
+  }
+
+ private:
+  double coefficient_m5_s2_ = environment::earth_j2 * environment::earth_gravitational_constant_m3_s2 * environment::earth_equatorial_radius_m *
+                              environment::earth_equatorial_radius_m;  //!< J2 * GM * Re^2 [m5/s2]
+  libra::Vector<3> pole_i_{0.0};                                       //!< Rotation axis of the Earth in the inertial frame
+};
+
+/**
+ * @class Geopotential
+ * @brief High order Earth gravity with the degree and coefficients of the [GEOPOTENTIAL] section and the Earth rotation of the latest update
+ */
+class Geopotential {
+ public:
+  /**
+   * @fn Geopotential
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file
+   */
+  explicit Geopotential(const std::string initialize_file_path);
+  /**
+   * @fn Update
+   * @brief Hold the Earth rotation
+   */
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) {
+    (void)velocity_i_m_s;
+    return dcm_ecef_to_eci_ * gravity_potential_.CalcAcceleration_xcxf_m_s2(dcm_eci_to_ecef_ * position_i_m);
+  }
+
+ private:
+  GravityPotential gravity_potential_;        //!< Gravity potential in the ECEF frame
+  libra::Matrix<3, 3> dcm_eci_to_ecef_{0.0};  //!< Direction cosine matrix from the ECI to the ECEF frame
+  libra::Matrix<3, 3> dcm_ecef_to_eci_{0.0};  //!< Direction cosine matrix from the ECEF to the ECI frame
+};
+
+/**
+ * @class Drag
+ * @brief Air drag of the cannonball model with the air density of the latest update and the atmosphere rotating with the Earth
+ */
+class Drag {
+ public:
+  /**
+   * @fn Drag
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file
+   */
+  explicit Drag(const std::string initialize_file_path);
+  /**
+   * @fn Update
+   * @brief Hold the air density and the Earth rotation
+   */
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn SetEnvironment
+   * @brief Set the environment held in the step
+   * @param [in] air_density_kg_m3: Air density [kg/m3]
+   * @param [in] earth_angular_velocity_i_rad_s: Angular velocity of the Earth in the inertial frame [rad/s]
+   */
+  inline void SetEnvironment(const double air_density_kg_m3, const libra::Vector<3>& earth_angular_velocity_i_rad_s) {
+    drag_factor_1_m_ = air_density_kg_m3 * ballistic_coefficient_m2_kg_;
+    earth_angular_velocity_i_rad_s_ = earth_angular_velocity_i_rad_s;
+  }
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const {
+    const libra::Vector<3> relative_velocity_i_m_s = velocity_i_m_s - OuterProduct(earth_angular_velocity_i_rad_s_, position_i_m);
+    return (-0.5 * drag_factor_1_m_ * relative_velocity_i_m_s.CalcNorm()) * relative_velocity_i_m_s;
+  }
+
+ private:
+  double ballistic_coefficient_m2_kg_;                    //!< Drag coefficient times the area per mass [m2/kg]
+  double drag_factor_1_m_ = 0.0;                          //!< Air density times the ballistic coefficient [1/m]
+  libra::Vector<3> earth_angular_velocity_i_rad_s_{0.0};  //!< Angular velocity of the Earth in the inertial frame [rad/s]
+};
+
+/**
+ * @class SolarRadiationPressure
+ * @brief Solar radiation pressure of the cannonball model with the pressure (including the shadow) and the sun position of the latest update
+ */
+class SolarRadiationPressure {
+ public:
+  /**
+   * @fn SolarRadiationPressure
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file
+   */
+  explicit SolarRadiationPressure(const std::string initialize_file_path);
+  /**
+   * @fn Update
+   * @brief Hold the pressure and the sun position
+   */
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn SetEnvironment
+   * @brief Set the environment held in the step
+   * @param [in] pressure_N_m2: Solar radiation pressure at the spacecraft including the shadow [N/m2]
+   * @param [in] sun_position_i_m: Sun position from the center body in the inertial frame [m]
+   */
+  inline void SetEnvironment(const double pressure_N_m2, const libra::Vector<3>& sun_position_i_m) {
+    pressure_factor_m_s2_ = pressure_N_m2 * radiation_coefficient_m2_kg_;
+    sun_position_i_m_ = sun_position_i_m;
+  }
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const {
+    (void)velocity_i_m_s;
+    const libra::Vector<3> sun_to_spacecraft_i_m = position_i_m - sun_position_i_m_;
+    return (pressure_factor_m_s2_ / sun_to_spacecraft_i_m.CalcNorm()) * sun_to_spacecraft_i_m;
+  }
+
+ private:
+  double radiation_coefficient_m2_kg_;      //!< Reflectivity coefficient times the area per mass [m2/kg]
+  double pressure_factor_m_s2_ = 0.0;       //!< Pressure times the radiation coefficient [m/s2]
+  libra::Vector<3> sun_position_i_m_{0.0};  //!< Sun position from the center body in the inertial frame [m]
+  CelestialBodyHandle sun_;                 //!< Handle of the sun
+};
+
+/**
+ * @class ThirdBody
+ * @brief Third body gravity with the body positions of the latest update
+ */
+class ThirdBody {
+ public:
+  /**
+   * @fn ThirdBody
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file
+   */
+  explicit ThirdBody(const std::string initialize_file_path);
+  /**
+   * @fn Update
+   * @brief Hold the body positions
+   */
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn SetBodies
+   * @brief Set the third bodies held in the step
+   * @param [in] body_position_list_i_m: Positions of the third bodies from the center body in the inertial frame [m]
+   * @param [in] gravity_constant_list_m3_s2: Gravity constants of the third bodies [m3/s2]
+   */
+  inline void SetBodies(const std::vector<libra::Vector<3>>& body_position_list_i_m, const std::vector<double>& gravity_constant_list_m3_s2) {
+    body_position_list_i_m_ = body_position_list_i_m;
+    gravity_constant_list_m3_s2_ = gravity_constant_list_m3_s2;
+  }
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const {
+    (void)velocity_i_m_s;
+    libra::Vector<3> acceleration_i_m_s2(0.0);
+    for (size_t i = 0; i < body_position_list_i_m_.size(); i++) {
+      acceleration_i_m_s2 +=
+          ThirdBodyGravity::CalcPointMassAcceleration_i_m_s2(position_i_m, body_position_list_i_m_[i], gravity_constant_list_m3_s2_[i]);
+    }
+    return acceleration_i_m_s2;
+  }
+
+ private:
+  std::vector<std::string> body_name_list_;               //!< Names of the third bodies
+  std::vector<CelestialBodyHandle> body_handle_list_;     //!< Handles of the third bodies
+  std::vector<libra::Vector<3>> body_position_list_i_m_;  //!< Positions of the third bodies from the center body [m]
+  std::vector<double> gravity_constant_list_m3_s2_;       //!< Gravity constants of the third bodies [m3/s2]
+};
+
+/**
+ * @class Relativity
+ * @brief Post-Newtonian correction of the center body gravity (Schwarzschild term)
+ */
+class Relativity {
+ public:
+  /**
+   * @fn Relativity
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file (not used)
+   */
+  explicit Relativity(const std::string initialize_file_path) { (void)initialize_file_path; }
+  /**
+   * @fn Update
+   * @brief Hold the gravity constant of the center body
+   */
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn SetGravityConstant_m3_s2
+   * @brief Set the gravity constant of the center body [m3/s2]
+   */
+  inline void SetGravityConstant_m3_s2(const double gravity_constant_m3_s2) { gravity_constant_m3_s2_ = gravity_constant_m3_s2; }
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const {
+    const double r_m = position_i_m.CalcNorm();
+    const double c2_m2_s2 = environment::speed_of_light_m_s * environment::speed_of_light_m_s;
+    const double factor = gravity_constant_m3_s2_ / (c2_m2_s2 * r_m * r_m * r_m);
+    return factor * ((4.0 * gravity_constant_m3_s2_ / r_m - InnerProduct(velocity_i_m_s, velocity_i_m_s)) * position_i_m +
+                     (4.0 * InnerProduct(position_i_m, velocity_i_m_s)) * velocity_i_m_s);
+  }
+
+ private:
+  double gravity_constant_m3_s2_ = 0.0;  //!< Gravity constant of the center body [m3/s2]
+};
+
+/**
+ * @class Empirical
+ * @brief Constant empirical acceleration in the RTN (radial, along-track, cross-track) frame
+ */
+class Empirical {
+ public:
+  /**
+   * @fn Empirical
+   * @brief Constructor
+   * @param [in] initialize_file_path: Path to the initialization file
+   */
+  explicit Empirical(const std::string initialize_file_path);
+  /**
+   * @fn Update
+   * @brief Nothing is held
+   */
+  inline void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
+    (void)local_environment;
+    (void)dynamics;
+  }
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate the acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const {
+    const libra::Vector<3> radial_i = (1.0 / position_i_m.CalcNorm()) * position_i_m;
+    libra::Vector<3> normal_i = OuterProduct(position_i_m, velocity_i_m_s);
+    normal_i = (1.0 / normal_i.CalcNorm()) * normal_i;
+    const libra::Vector<3> transverse_i = OuterProduct(normal_i, radial_i);
+    return acceleration_rtn_m_s2_[0] * radial_i + acceleration_rtn_m_s2_[1] * transverse_i + acceleration_rtn_m_s2_[2] * normal_i;
+  }
+
+ private:
+  libra::Vector<3> acceleration_rtn_m_s2_{0.0};  //!< Acceleration in the RTN frame [m/s2]
+};
+
+}  // namespace force_model_term
+
+/**
+ * @fn InitComposedForceModel
+ * @brief Initialize the composed force model selected in the [COMPOSED_FORCE_MODEL] section
+ * @param [in] initialize_file_path: Path to the initialization file
+ * @return Composed force model. nullptr when the composition is NONE.
+ */
+ComposedForceModelBase* InitComposedForceModel(const std::string initialize_file_path);
+
+#endif  // S2E_DISTURBANCES_COMPOSED_FORCE_MODEL_HPP_
@@ -0,0 +1,126 @@
+/**
+ * @file disturbance.cpp
+ * @brief Base class for a disturbance
+ */
+
+#include "disturbance.hpp"
+
+namespace {
+/**
+ * @fn MakeDisturbanceInputs
+ * @brief Return the inputs of the disturbance calculation taken from the dynamics
+ * @param [in] dynamics: Dynamics information
+ * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+ */
+DisturbanceInputs MakeDisturbanceInputs(const Dynamics& dynamics, const double elapsed_time_s) {
+  DisturbanceInputs inputs;
+  const Orbit& orbit = dynamics.GetOrbit();
+  inputs.position_i_m = orbit.GetPosition_i_m();
+  inputs.position_ecef_m = orbit.GetPosition_ecef_m();
+  inputs.velocity_i_m_s = orbit.GetVelocity_i_m_s();
+  inputs.quaternion_i2b = dynamics.GetAttitude().GetQuaternion_i2b();
+  inputs.inertia_tensor_b_kgm2 = dynamics.GetAttitude().GetInertiaTensor_b_kgm2();
+  inputs.elapsed_time_s = elapsed_time_s;
+  return inputs;
+}
+}  // namespace
+
+void Disturbance::UpdateWithSchedule(const LocalEnvironment& local_environment, const Dynamics& dynamics, const double elapsed_time_s) {
+  UpdateWithSchedule(MakeDisturbanceInputs(dynamics, elapsed_time_s), [&]() { UpdateIfEnabled(local_environment, dynamics); });
+}
+
+bool Disturbance::HoldScheduledOutputs(const double elapsed_time_s) {
+  // Hold or extrapolate the output until the update interval passes
+  const double kTimeTolerance_s = 1.0e-9;
+  if (number_of_calculations_ == 0 || elapsed_time_s - calculation_time_s_[0] >= update_interval_s_ - kTimeTolerance_s) return false;
+
+  const double calculation_interval_s = calculation_time_s_[0] - calculation_time_s_[1];
+  if (hold_mode_ == DisturbanceHoldMode::kLinearExtrapolation && number_of_calculations_ > 1 && calculation_interval_s > 0.0) {
+    const double ratio = (elapsed_time_s - calculation_time_s_[0]) / calculation_interval_s;
+    UnpackOutputs(calculated_outputs_[0] + ratio * (calculated_outputs_[0] - calculated_outputs_[1]));
+  } else {
+    UnpackOutputs(calculated_outputs_[0]);
+  }
+  return true;
+}
+
+bool Disturbance::IsInputChanged(const libra::Vector<kInputSignatureSize>& input_signature) const {
+  if (number_of_calculations_ == 0) return true;
+  for (size_t i = 0; i < kInputSignatureSize; i++) {
+    if (input_signature[i] != input_signature_[i]) return true;
+  }
+  return false;
+}
+
+void Disturbance::RecordCalculation(const libra::Vector<kInputSignatureSize>& input_signature, const double elapsed_time_s) {
+  calculated_outputs_[1] = calculated_outputs_[0];
+  calculation_time_s_[1] = calculation_time_s_[0];
+  calculated_outputs_[0] = PackOutputs();
+  calculation_time_s_[0] = elapsed_time_s;
+  input_signature_ = input_signature;
+  if (number_of_calculations_ < 2) number_of_calculations_++;
+}
+
+libra::Vector<3> Disturbance::CalcStageAcceleration_i_m_s2(const double time_from_step_start_s, const libra::Vector<3>& position_i_m,
+                                                           const libra::Vector<3>& velocity_i_m_s) {
+  libra::Vector<3> stage_acceleration_i_m_s2(0.0);
+  if (!is_calculation_enabled_ || stage_mode_ == DisturbanceStageMode::kHold) return stage_acceleration_i_m_s2;
+
+  if (stage_mode_ == DisturbanceStageMode::kEvaluate &&
+      CalcAccelerationAtPosition_i_m_s2(time_from_step_start_s, position_i_m, velocity_i_m_s, stage_acceleration_i_m_s2)) {
+    return stage_acceleration_i_m_s2 - acceleration_i_m_s2_;
+  }
+
+  // Extrapolate the acceleration in time
+  stage_acceleration_i_m_s2 = libra::Vector<3>(0.0);
+  if (number_of_calculations_ > 1) {
+    const double calculation_interval_s = calculation_time_s_[0] - calculation_time_s_[1];
+    if (calculation_interval_s > 0.0) {
+      for (size_t axis = 0; axis < 3; axis++) {
+        const double rate_m_s3 = (calculated_outputs_[0][9 + axis] - calculated_outputs_[1][9 + axis]) / calculation_interval_s;
+        stage_acceleration_i_m_s2[axis] = rate_m_s3 * time_from_step_start_s;
+      }
+    }
+  }
+  return stage_acceleration_i_m_s2;
+}
+
+libra::Vector<Disturbance::kInputSignatureSize> Disturbance::MakeInputSignature(const DisturbanceInputs& inputs) const {
+  libra::Vector<kInputSignatureSize> input_signature(0.0);
+  const unsigned int input_dependency = GetInputDependency();
+  for (size_t axis = 0; axis < 3; axis++) {
+    if (input_dependency & kDisturbanceInputPosition_i) input_signature[axis] = inputs.position_i_m[axis];
+    if (input_dependency & kDisturbanceInputPosition_ecef) input_signature[3 + axis] = inputs.position_ecef_m[axis];
+    if (input_dependency & kDisturbanceInputVelocity_i) input_signature[6 + axis] = inputs.velocity_i_m_s[axis];
+  }
+  if (input_dependency & kDisturbanceInputAttitude) {
+    for (size_t i = 0; i < 4; i++) input_signature[9 + i] = inputs.quaternion_i2b[i];
+  }
+  if (input_dependency & kDisturbanceInputTime) input_signature[13] = inputs.elapsed_time_s;
+  if (input_dependency & kDisturbanceInputInertia) {
+    for (size_t row = 0; row < 3; row++) {
+      for (size_t column = 0; column < 3; column++) input_signature[14 + 3 * row + column] = inputs.inertia_tensor_b_kgm2[row][column];
+    }
+  }
+  return input_signature;
+}
+
+libra::Vector<12> Disturbance::PackOutputs() const {
+  libra::Vector<12> outputs;
+  for (size_t axis = 0; axis < 3; axis++) {
+    outputs[axis] = force_b_N_[axis];
+    outputs[3 + axis] = torque_b_Nm_[axis];
+    outputs[6 + axis] = acceleration_b_m_s2_[axis];
+    outputs[9 + axis] = acceleration_i_m_s2_[axis];
+  }
+  return outputs;
+}
+
+void Disturbance::UnpackOutputs(const libra::Vector<12>& outputs) {
+  for (size_t axis = 0; axis < 3; axis++) {
+    force_b_N_[axis] = outputs[axis];
+    torque_b_Nm_[axis] = outputs[3 + axis];
+    acceleration_b_m_s2_[axis] = outputs[6 + axis];
+    acceleration_i_m_s2_[axis] = outputs[9 + axis];
+  }
+}
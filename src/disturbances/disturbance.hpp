@@ -7,13 +7,67 @@
 #define S2E_DISTURBANCES_DISTURBANCE_HPP_
 
 #include "../environment/local/local_environment.hpp"
+#include "../math_physics/math/matrix.hpp"
+#include "../math_physics/math/quaternion.hpp"
 #include "../math_physics/math/vector.hpp"
+#include "../utilities/case_arena.hpp"
+#include "../utilities/macros.hpp"
+#include "../utilities/memory_usage.hpp"
+#include "../utilities/snapshot.hpp"
+#include "../utilities/step_profiler.hpp"
+#include "../utilities/type_name.hpp"
+
+/**
+ * @enum DisturbanceInput
+ * @brief Inputs of the disturbance calculation used to detect the change of the inputs
+ */
+enum DisturbanceInput : unsigned int {
+  kDisturbanceInputPosition_i = 0x01,     //!< Position of the spacecraft in the inertial frame
+  kDisturbanceInputPosition_ecef = 0x02,  //!< Position of the spacecraft in the ECEF frame
+  kDisturbanceInputVelocity_i = 0x04,     //!< Velocity of the spacecraft in the inertial frame
+  kDisturbanceInputAttitude = 0x08,       //!< Attitude of the spacecraft
+  kDisturbanceInputTime = 0x10,           //!< Simulation time (e.g. positions of the celestial bodies, space weather)
+  kDisturbanceInputInertia = 0x20,        //!< Inertia tensor of the spacecraft
+  kDisturbanceInputAll = 0x3F,            //!< All inputs
+};
+
+/**
+ * @struct DisturbanceInputs
+ * @brief Values of the inputs compared to detect the change of the declared inputs
+ */
+struct DisturbanceInputs {
+  libra::Vector<3> position_i_m;              //!< Position of the spacecraft in the inertial frame [m]
+  libra::Vector<3> position_ecef_m;           //!< Position of the spacecraft in the ECEF frame [m]
+  libra::Vector<3> velocity_i_m_s;            //!< Velocity of the spacecraft in the inertial frame [m/s]
+  libra::Quaternion quaternion_i2b;           //!< Attitude quaternion from the inertial frame to the body frame
+  libra::Matrix<3, 3> inertia_tensor_b_kgm2;  //!< Inertia tensor of the spacecraft in the body frame [kg m^2]
+  double elapsed_time_s = 0.0;                //!< Elapsed time of the simulation [s]
+};
+
+/**
+ * @enum DisturbanceHoldMode
+ * @brief Output of the disturbance between the updates
+ */
+enum class DisturbanceHoldMode {
+  kZeroOrderHold,        //!< Hold the latest calculated value
+  kLinearExtrapolation,  //!< Extrapolate linearly with the latest two calculated values
+};
+
+/**
+ * @enum DisturbanceStageMode
+ * @brief Acceleration of the disturbance at the stages of the orbit integrator
+ */
+enum class DisturbanceStageMode {
+  kHold,         //!< Hold the acceleration of the step start
+  kEvaluate,     //!< Evaluate the acceleration at the stage position (kInterpolate without CalcAccelerationAtPosition_i_m_s2 support)
+  kInterpolate,  //!< Extrapolate the acceleration in time with the latest two calculations
+};
 
 /**
  * @class Disturbance
  * @brief Base class for a disturbance
  */
-class Disturbance : public ILoggable {
+class Disturbance : public ILoggable, public ArenaAllocated {
  public:
   /**
    * @fn Disturbance
@@ -41,6 +95,7 @@ class Disturbance : public ILoggable {
    */
   virtual inline void UpdateIfEnabled(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
     if (is_calculation_enabled_) {
+      ScopedProfileTimer timer(profile_section_id_, typeid(*this), "Update");
       Update(local_environment, dynamics);
     } else {
       force_b_N_ *= 0.0;
@@ -50,12 +105,134 @@ class Disturbance : public ILoggable {
     }
   }
 
+  /**
+   * @fn UpdateWithSchedule
+   * @brief Update calculated disturbance with the update interval and the input dependency
+   * @details The disturbance is calculated when the update interval has passed since the latest calculation and the declared inputs
+   *          (GetInputDependency) have changed. Between the calculations, the output is held or extrapolated with the hold mode.
+   *          The calculation is done at every call with the default setting (zero update interval) unless the inputs are unchanged.
+   * @param [in] local_environment: Local environment information
+   * @param [in] dynamics: Dynamics information
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   */
+  void UpdateWithSchedule(const LocalEnvironment& local_environment, const Dynamics& dynamics, const double elapsed_time_s);
+  /**
+   * @fn UpdateWithSchedule
+   * @brief Update calculated disturbance with the update interval and the input dependency for the given inputs
+   * @param [in] inputs: Values of the inputs at the update
+   * @param [in] calculate: Function object to calculate the disturbance (e.g., UpdateIfEnabled with the environment and the dynamics)
+   */
+  template <typename Calculate>
+  void UpdateWithSchedule(const DisturbanceInputs& inputs, Calculate calculate);
+
+  /**
+   * @fn HoldOutputs
+   * @brief Skip the calculation and output the latest calculated value of UpdateWithSchedule (e.g., to keep the real time deadline)
+   * @note The output is not changed before the first calculation
+   */
+  inline void HoldOutputs() {
+    if (number_of_calculations_ > 0) UnpackOutputs(calculated_outputs_[0]);
+  }
+
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Calculate the difference of the acceleration at the orbit integrator stage from the acceleration of the step start
+   * @param [in] time_from_step_start_s: Time of the stage from the step start [s]
+   * @param [in] position_i_m: Position of the stage in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity of the stage in the inertial frame [m/s]
+   * @return Difference of the acceleration in the inertial frame [m/s2]
+   */
+  libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_step_start_s, const libra::Vector<3>& position_i_m,
+                                                const libra::Vector<3>& velocity_i_m_s);
+  /**
+   * @fn CalcAccelerationAtPosition_i_m_s2
+   * @brief Calculate the acceleration at the position with the environment of the latest update
+   * @note Override this function in the derived class whose acceleration is cheap to evaluate at the stages of the orbit integrator
+   * @param [in] time_from_update_s: Time from the latest update [s]
+   * @param [in] position_i_m: Position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+   * @param [out] acceleration_i_m_s2: Acceleration in the inertial frame [m/s2]
+   * @return False when the evaluation at the position is not supported
+   */
+  virtual bool CalcAccelerationAtPosition_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m,
+                                                 const libra::Vector<3>& velocity_i_m_s, libra::Vector<3>& acceleration_i_m_s2) {
+    UNUSED(time_from_update_s);
+    UNUSED(position_i_m);
+    UNUSED(velocity_i_m_s);
+    UNUSED(acceleration_i_m_s2);
+    return false;
+  }
+
   /**
    * @fn Update
    * @brief Pure virtual function to define the disturbance calculation
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) = 0;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the calculated disturbance to the snapshot
+   * @note Override this function and call it in the derived class to add the internal state (e.g. noise)
+   * @param [out] snapshot: Snapshot writer
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const {
+    snapshot.Write(force_b_N_);
+    snapshot.Write(torque_b_Nm_);
+    snapshot.Write(acceleration_b_m_s2_);
+    snapshot.Write(acceleration_i_m_s2_);
+    snapshot.Write(number_of_calculations_);
+    for (size_t i = 0; i < 2; i++) {
+      snapshot.Write(calculated_outputs_[i]);
+      snapshot.Write(calculation_time_s_[i]);
+    }
+    snapshot.Write(input_signature_);
+  }
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the calculated disturbance from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot) {
+    snapshot.Read(force_b_N_);
+    snapshot.Read(torque_b_Nm_);
+    snapshot.Read(acceleration_b_m_s2_);
+    snapshot.Read(acceleration_i_m_s2_);
+    snapshot.Read(number_of_calculations_);
+    for (size_t i = 0; i < 2; i++) {
+      snapshot.Read(calculated_outputs_[i]);
+      snapshot.Read(calculation_time_s_[i]);
+    }
+    snapshot.Read(input_signature_);
+  }
+
+  /**
+   * @fn SetUpdateSchedule
+   * @brief Set the update interval and the output between the updates
+   * @param [in] update_interval_s: Minimum interval of the calculation. Zero means the calculation at every update. [s]
+   * @param [in] hold_mode: Output between the calculations
+   */
+  inline void SetUpdateSchedule(const double update_interval_s, const DisturbanceHoldMode hold_mode) {
+    update_interval_s_ = update_interval_s;
+    hold_mode_ = hold_mode;
+  }
+  /**
+   * @fn SetStageMode
+   * @brief Set the acceleration at the stages of the orbit integrator
+   */
+  inline void SetStageMode(const DisturbanceStageMode stage_mode) { stage_mode_ = stage_mode; }
+  /**
+   * @fn GetStageMode
+   * @brief Return the acceleration mode at the stages of the orbit integrator
+   */
+  inline DisturbanceStageMode GetStageMode() const { return stage_mode_; }
+  /**
+   * @fn GetInputDependency
+   * @brief Return the inputs of the calculation as a combination of DisturbanceInput
+   * @note Override this function in the derived class to skip the calculation when the inputs are unchanged. The calculation is skipped
+   *       only when all declared inputs are identical to the latest calculation, so declare all inputs which affect the output.
+   */
+  virtual unsigned int GetInputDependency() const { return kDisturbanceInputAll; }
+
   /**
    * @fn GetTorque_b_Nm
    * @brief Return the disturbance torque in the body frame [Nm]
@@ -81,14 +258,86 @@ class Disturbance : public ILoggable {
    * @brief Return the attitude dependent flag
    */
   virtual inline bool IsAttitudeDependent() { return is_attitude_dependent_; }
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the disturbance
+   * @note Override this function in the derived class which owns heap memory (e.g. coefficient tables)
+   */
+  virtual MemoryUsage GetMemoryUsage() const { return MemoryUsage(GetTypeName(typeid(*this)), sizeof(*this)); }
 
  protected:
-  bool is_calculation_enabled_;           //!< Flag to calculate the disturbance
-  bool is_attitude_dependent_;            //!< Flag to show the disturbance depends on attitude information
-  libra::Vector<3> force_b_N_;            //!< Disturbance force in the body frame [N]
-  libra::Vector<3> torque_b_Nm_;          //!< Disturbance torque in the body frame [Nm]
-  libra::Vector<3> acceleration_b_m_s2_;  //!< Disturbance acceleration in the body frame [m/s2]
-  libra::Vector<3> acceleration_i_m_s2_;  //!< Disturbance acceleration in the inertial frame [m/s2]
+  bool is_calculation_enabled_;                                     //!< Flag to calculate the disturbance
+  bool is_attitude_dependent_;                                      //!< Flag to show the disturbance depends on attitude information
+  libra::Vector<3> force_b_N_;                                      //!< Disturbance force in the body frame [N]
+  libra::Vector<3> torque_b_Nm_;                                    //!< Disturbance torque in the body frame [Nm]
+  libra::Vector<3> acceleration_b_m_s2_;                            //!< Disturbance acceleration in the body frame [m/s2]
+  libra::Vector<3> acceleration_i_m_s2_;                            //!< Disturbance acceleration in the inertial frame [m/s2]
+  size_t profile_section_id_ = StepProfiler::kUnregisteredSection;  //!< Section ID of Update in StepProfiler
+
+  // Update schedule
+  static const size_t kInputSignatureSize = 23;                          //!< Number of the elements of the packed inputs
+  double update_interval_s_ = 0.0;                                       //!< Minimum interval of the calculation [s]
+  DisturbanceHoldMode hold_mode_ = DisturbanceHoldMode::kZeroOrderHold;  //!< Output between the calculations
+  uint64_t number_of_calculations_ = 0;                                  //!< Number of the calculations (saturated at 2)
+  libra::Vector<12> calculated_outputs_[2];                              //!< Packed outputs of the latest two calculations
+  double calculation_time_s_[2] = {0.0, 0.0};                            //!< Elapsed time of the latest two calculations [s]
+  libra::Vector<kInputSignatureSize> input_signature_;                   //!< Inputs of the latest calculation
+  DisturbanceStageMode stage_mode_ = DisturbanceStageMode::kHold;        //!< Acceleration at the stages of the orbit integrator
+
+  /**
+   * @fn MakeInputSignature
+   * @brief Return the declared inputs packed in a vector (The undeclared inputs are zero)
+   * @param [in] inputs: Values of the inputs
+   */
+  libra::Vector<kInputSignatureSize> MakeInputSignature(const DisturbanceInputs& inputs) const;
+  /**
+   * @fn HoldScheduledOutputs
+   * @brief Hold or extrapolate the output when the update interval has not passed since the latest calculation
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   * @return True when the output is held or extrapolated
+   */
+  bool HoldScheduledOutputs(const double elapsed_time_s);
+  /**
+   * @fn IsInputChanged
+   * @brief Return true when the declared inputs differ from the latest calculation or no calculation is done yet
+   * @param [in] input_signature: Declared inputs packed by MakeInputSignature
+   */
+  bool IsInputChanged(const libra::Vector<kInputSignatureSize>& input_signature) const;
+  /**
+   * @fn RecordCalculation
+   * @brief Record the current output and the inputs as the latest calculation
+   * @param [in] input_signature: Declared inputs packed by MakeInputSignature
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   */
+  void RecordCalculation(const libra::Vector<kInputSignatureSize>& input_signature, const double elapsed_time_s);
+  /**
+   * @fn PackOutputs
+   * @brief Return the force, torque, and accelerations packed in a vector
+   */
+  libra::Vector<12> PackOutputs() const;
+  /**
+   * @fn UnpackOutputs
+   * @brief Set the force, torque, and accelerations from the packed vector
+   */
+  void UnpackOutputs(const libra::Vector<12>& outputs);
 };
 
+template <typename Calculate>
+void Disturbance::UpdateWithSchedule(const DisturbanceInputs& inputs, Calculate calculate) {
+  if (!is_calculation_enabled_) {
+    calculate();
+    return;
+  }
+  if (HoldScheduledOutputs(inputs.elapsed_time_s)) return;
+
+  // Skip the calculation when the declared inputs are unchanged
+  const libra::Vector<kInputSignatureSize> input_signature = MakeInputSignature(inputs);
+  if (IsInputChanged(input_signature)) {
+    calculate();
+  } else {
+    UnpackOutputs(calculated_outputs_[0]);
+  }
+  RecordCalculation(input_signature, inputs.elapsed_time_s);
+}
+
 #endif  // S2E_DISTURBANCES_DISTURBANCE_HPP_
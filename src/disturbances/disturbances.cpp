@@ -5,9 +5,13 @@
 
 #include "disturbances.hpp"
 
+#include <chrono>
+#include <iostream>
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
 
 #include "air_drag.hpp"
+#include "composed_force_model.hpp"
 #include "geopotential.hpp"
 #include "gravity_gradient.hpp"
 #include "lunar_gravity_field.hpp"
@@ -18,6 +22,7 @@
 Disturbances::Disturbances(const SimulationConfiguration* simulation_configuration, const int spacecraft_id, const Structure* structure,
                            const GlobalEnvironment* global_environment) {
   InitializeInstances(simulation_configuration, spacecraft_id, structure, global_environment);
+  InitializeTorqueProfile();
   InitializeForceAndTorque();
   InitializeAcceleration();
 }
@@ -26,26 +31,134 @@ Disturbances::~Disturbances() {
   for (auto disturbance : disturbances_list_) {
     delete disturbance;
   }
+  delete composed_force_model_;
+  delete torque_profile_;
 }
 
 void Disturbances::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics, const SimulationTime* simulation_time) {
   InitializeForceAndTorque();
   InitializeAcceleration();
 
-  for (auto disturbance : disturbances_list_) {
+  // Lower the geopotential degree while the real time simulation is degraded
+  const RealTimeDeadlineMonitor& deadline_monitor = simulation_time->GetRealTimeDeadlineMonitor();
+  if (geopotential_ != nullptr && deadline_monitor.IsEnabled()) {
+    if (deadline_monitor.IsActive(kRealTimeDegradationReduceGeopotential)) {
+      geopotential_->SetCalculationDegree(deadline_monitor.GetReducedGeopotentialDegree());
+    } else {
+      geopotential_->RestoreCalculationDegree();
+    }
+  }
+
+  const double elapsed_time_s = simulation_time->GetElapsedTime_s();
+
+  // The attitude dependent disturbances are replaced with the torque profile except while it is recorded
+  bool is_torque_profile_used = false;
+  double argument_of_latitude_rad = 0.0;
+  if (torque_profile_ != nullptr) {
+    const Orbit& orbit = dynamics.GetOrbit();
+    argument_of_latitude_rad = libra::CalcArgumentOfLatitude_rad(orbit.GetPosition_i_m(), orbit.GetVelocity_i_m_s());
+    if (!torque_profile_->IsRecording() &&
+        (!torque_profile_->IsValid() || elapsed_time_s - torque_profile_recorded_time_s_ >= torque_profile_refresh_interval_s_)) {
+      torque_profile_->StartRecording();
+    }
+    is_torque_profile_used = !torque_profile_->IsRecording();
+  }
+
+  libra::Vector<6> torque_profile_sample(0.0);
+  for (size_t i = 0; i < disturbances_list_.size(); i++) {
+    Disturbance* disturbance = disturbances_list_[i];
+    const bool is_torque_profile_target = torque_profile_ != nullptr && disturbance->IsAttitudeDependent();
+    if (is_torque_profile_used && is_torque_profile_target) continue;
+
     if (simulation_time->GetOrbitPropagateFlag()) {
       // Update disturbances that depend only on the position
-      disturbance->UpdateIfEnabled(local_environment, dynamics);
+      UpdateDisturbance(i, local_environment, dynamics, elapsed_time_s, deadline_monitor);
     } else if (simulation_time->GetAttitudePropagateFlag()) {
       // Update disturbances that depend on the attitude (and the position)
       if (disturbance->IsAttitudeDependent() == true) {
-        disturbance->UpdateIfEnabled(local_environment, dynamics);
+        UpdateDisturbance(i, local_environment, dynamics, elapsed_time_s, deadline_monitor);
+      }
+    }
+    if (is_torque_profile_target) {
+      const libra::Vector<3> torque_b_Nm = disturbance->GetTorque_b_Nm();
+      const libra::Vector<3> force_b_N = disturbance->GetForce_b_N();
+      for (size_t axis = 0; axis < 3; axis++) {
+        torque_profile_sample[axis] += torque_b_Nm[axis];
+        torque_profile_sample[3 + axis] += force_b_N[axis];
       }
+    } else {
+      total_torque_b_Nm_ += disturbance->GetTorque_b_Nm();
+      total_force_b_N_ += disturbance->GetForce_b_N();
     }
-    total_torque_b_Nm_ += disturbance->GetTorque_b_Nm();
-    total_force_b_N_ += disturbance->GetForce_b_N();
     total_acceleration_i_m_s2_ += disturbance->GetAcceleration_i_m_s2();
   }
+
+  if (torque_profile_ != nullptr) {
+    if (is_torque_profile_used) {
+      torque_profile_sample = torque_profile_->Interpolate(argument_of_latitude_rad);
+    } else {
+      if (torque_profile_->Record(argument_of_latitude_rad, torque_profile_sample)) torque_profile_recorded_time_s_ = elapsed_time_s;
+    }
+    for (size_t axis = 0; axis < 3; axis++) {
+      total_torque_b_Nm_[axis] += torque_profile_sample[axis];
+      total_force_b_N_[axis] += torque_profile_sample[3 + axis];
+    }
+  }
+
+  if (composed_force_model_ != nullptr) {
+    if (simulation_time->GetOrbitPropagateFlag()) composed_force_model_->Update(local_environment, dynamics);
+    total_acceleration_i_m_s2_ += composed_force_model_->GetAcceleration_i_m_s2();
+  }
+}
+
+libra::Vector<3> Disturbances::CalcStageAcceleration_i_m_s2(const double time_from_step_start_s, const libra::Vector<3>& position_i_m,
+                                                            const libra::Vector<3>& velocity_i_m_s) {
+  libra::Vector<3> stage_acceleration_i_m_s2(0.0);
+  for (auto disturbance : stage_disturbances_) {
+    stage_acceleration_i_m_s2 += disturbance->CalcStageAcceleration_i_m_s2(time_from_step_start_s, position_i_m, velocity_i_m_s);
+  }
+  if (composed_force_model_ != nullptr) {
+    stage_acceleration_i_m_s2 += composed_force_model_->CalcStageAcceleration_i_m_s2(time_from_step_start_s, position_i_m, velocity_i_m_s);
+  }
+  return stage_acceleration_i_m_s2;
+}
+
+void Disturbances::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("DISTURBANCES");
+  snapshot.Write((uint64_t)disturbances_list_.size());
+  for (auto disturbance : disturbances_list_) {
+    disturbance->SaveSnapshot(snapshot);
+  }
+  snapshot.Write(total_torque_b_Nm_);
+  snapshot.Write(total_force_b_N_);
+  snapshot.Write(total_acceleration_i_m_s2_);
+  snapshot.Write(torque_profile_ != nullptr);
+  if (torque_profile_ != nullptr) {
+    torque_profile_->SaveSnapshot(snapshot);
+    snapshot.Write(torque_profile_recorded_time_s_);
+  }
+}
+
+void Disturbances::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("DISTURBANCES");
+  if (snapshot.ReadSize() != disturbances_list_.size()) {
+    throw std::invalid_argument("Snapshot is made with the different disturbance setting.");
+  }
+  for (auto disturbance : disturbances_list_) {
+    disturbance->LoadSnapshot(snapshot);
+  }
+  snapshot.Read(total_torque_b_Nm_);
+  snapshot.Read(total_force_b_N_);
+  snapshot.Read(total_acceleration_i_m_s2_);
+  bool is_torque_profile_enabled = false;
+  snapshot.Read(is_torque_profile_enabled);
+  if (is_torque_profile_enabled != (torque_profile_ != nullptr)) {
+    throw std::invalid_argument("Snapshot is made with the different orbit periodic torque profile setting.");
+  }
+  if (torque_profile_ != nullptr) {
+    torque_profile_->LoadSnapshot(snapshot);
+    snapshot.Read(torque_profile_recorded_time_s_);
+  }
 }
 
 void Disturbances::LogSetup(Logger& logger) {
@@ -55,39 +168,126 @@ void Disturbances::LogSetup(Logger& logger) {
   logger.CopyFileToLogDirectory(initialize_file_name_);
 }
 
+MemoryUsage Disturbances::GetMemoryUsage() const {
+  MemoryUsage memory_usage("Disturbances", sizeof(*this) + CalcHeapMemory_bytes(disturbances_list_) + CalcHeapMemory_bytes(initialize_file_name_));
+  for (const auto disturbance : disturbances_list_) {
+    memory_usage.AddChild(disturbance->GetMemoryUsage());
+  }
+  if (torque_profile_ != nullptr) memory_usage.AddChild(MemoryUsage("OrbitPeriodicTorqueProfile", torque_profile_->GetMemoryUsage_bytes()));
+  return memory_usage;
+}
+
 void Disturbances::InitializeInstances(const SimulationConfiguration* simulation_configuration, const int spacecraft_id, const Structure* structure,
                                        const GlobalEnvironment* global_environment) {
   IniAccess ini_access = IniAccess(simulation_configuration->spacecraft_file_list_[spacecraft_id]);
   initialize_file_name_ = ini_access.ReadString("SETTING_FILES", "disturbance_file");
+  composed_force_model_ = InitComposedForceModel(initialize_file_name_);
 
   GravityGradient* gg_dist = new GravityGradient(
       InitGravityGradient(initialize_file_name_, global_environment->GetCelestialInformation().GetCenterBodyGravityConstant_m3_s2()));
-  disturbances_list_.push_back(gg_dist);
+  // The gravity gradient with the geopotential tensor is added after the geopotential to use the tensor of the same step
+  if (!gg_dist->IsGeopotentialGradientEnabled()) AddDisturbance(gg_dist, "GRAVITY_GRADIENT");
 
   SolarRadiationPressureDisturbance* srp_dist = new SolarRadiationPressureDisturbance(InitSolarRadiationPressureDisturbance(
       initialize_file_name_, structure->GetSurfaces(), structure->GetKinematicsParameters().GetCenterOfGravity_b_m()));
-  disturbances_list_.push_back(srp_dist);
+  AddDisturbance(srp_dist, "SOLAR_RADIATION_PRESSURE_DISTURBANCE");
 
   ThirdBodyGravity* third_body_gravity =
       new ThirdBodyGravity(InitThirdBodyGravity(initialize_file_name_, simulation_configuration->initialize_base_file_name_));
-  disturbances_list_.push_back(third_body_gravity);
+  AddDisturbance(third_body_gravity, "THIRD_BODY_GRAVITY");
 
   if (global_environment->GetCelestialInformation().GetCenterBodyName() == "MOON") {
     LunarGravityField* lunar_gravity_field = new LunarGravityField(InitLunarGravityField(initialize_file_name_));
-    disturbances_list_.push_back(lunar_gravity_field);
+    AddDisturbance(lunar_gravity_field, "LUNAR_GRAVITY_FIELD");
+  }
+
+  if (global_environment->GetCelestialInformation().GetCenterBodyName() == "EARTH") {
+    // Earth only disturbances (TODO: implement disturbances for other center bodies)
+    AirDrag* air_dist =
+        new AirDrag(InitAirDrag(initialize_file_name_, structure->GetSurfaces(), structure->GetKinematicsParameters().GetCenterOfGravity_b_m()));
+    AddDisturbance(air_dist, "AIR_DRAG");
+
+    MagneticDisturbance* mag_dist =
+        new MagneticDisturbance(InitMagneticDisturbance(initialize_file_name_, structure->GetResidualMagneticMoment()));
+    AddDisturbance(mag_dist, "MAGNETIC_DISTURBANCE");
+
+    geopotential_ = new Geopotential(InitGeopotential(initialize_file_name_));
+    AddDisturbance(geopotential_, "GEOPOTENTIAL");
+  }
+
+  if (gg_dist->IsGeopotentialGradientEnabled()) {
+    if (geopotential_ != nullptr) {
+      gg_dist->SetGeopotential(geopotential_);
+    } else {
+      std::cout << "[Warning] GRAVITY_GRADIENT: geopotential_gradient is enabled without the geopotential. Only the point mass term is used."
+                << std::endl;
+    }
+    AddDisturbance(gg_dist, "GRAVITY_GRADIENT");
   }
+}
+
+void Disturbances::AddDisturbance(Disturbance* disturbance, const char* section) {
+  IniAccess conf = IniAccess(initialize_file_name_);
+  const double update_interval_s = conf.ReadDouble(section, "update_interval_s");
+  const std::string hold_mode = conf.ReadString(section, "hold_mode");
+  if (hold_mode == "LINEAR_EXTRAPOLATION") {
+    disturbance->SetUpdateSchedule(update_interval_s, DisturbanceHoldMode::kLinearExtrapolation);
+  } else {
+    if (hold_mode != "NULL" && hold_mode != "ZERO_ORDER_HOLD") {
+      std::cerr << "[WARNINGS] Unknown hold_mode " << hold_mode << " in " << section << ". ZERO_ORDER_HOLD is used." << std::endl;
+    }
+    disturbance->SetUpdateSchedule(update_interval_s, DisturbanceHoldMode::kZeroOrderHold);
+  }
+
+  const std::string stage_mode = conf.ReadString(section, "orbit_stage_mode");
+  if (stage_mode == "EVALUATE") {
+    disturbance->SetStageMode(DisturbanceStageMode::kEvaluate);
+  } else if (stage_mode == "INTERPOLATE") {
+    disturbance->SetStageMode(DisturbanceStageMode::kInterpolate);
+  } else if (stage_mode != "NULL" && stage_mode != "HOLD") {
+    std::cerr << "[WARNINGS] Unknown orbit_stage_mode " << stage_mode << " in " << section << ". HOLD is used." << std::endl;
+  }
+  if (disturbance->GetStageMode() != DisturbanceStageMode::kHold) stage_disturbances_.push_back(disturbance);
+
+  disturbances_list_.push_back(disturbance);
+  average_calculation_times_s_.push_back(0.0);
+}
+
+void Disturbances::InitializeTorqueProfile() {
+  IniAccess conf = IniAccess(initialize_file_name_);
+  const char* section = "ORBIT_PERIODIC_TORQUE_PROFILE";
+  if (!conf.ReadEnable(section, "torque_profile")) return;
 
-  if (global_environment->GetCelestialInformation().GetCenterBodyName() != "EARTH") return;
-  // Earth only disturbances (TODO: implement disturbances for other center bodies)
-  AirDrag* air_dist =
-      new AirDrag(InitAirDrag(initialize_file_name_, structure->GetSurfaces(), structure->GetKinematicsParameters().GetCenterOfGravity_b_m()));
-  disturbances_list_.push_back(air_dist);
+  const int number_of_bins = conf.ReadInt(section, "number_of_bins");
+  torque_profile_refresh_interval_s_ = conf.ReadDouble(section, "refresh_interval_s");
+  if (number_of_bins < 2) {
+    throw std::invalid_argument("ORBIT_PERIODIC_TORQUE_PROFILE: number_of_bins must be larger than one.");
+  }
+  torque_profile_ = new libra::OrbitPeriodicProfile<6>((size_t)number_of_bins);
+}
 
-  MagneticDisturbance* mag_dist = new MagneticDisturbance(InitMagneticDisturbance(initialize_file_name_, structure->GetResidualMagneticMoment()));
-  disturbances_list_.push_back(mag_dist);
+void Disturbances::UpdateDisturbance(const size_t disturbance_id, const LocalEnvironment& local_environment, const Dynamics& dynamics,
+                                     const double elapsed_time_s, const RealTimeDeadlineMonitor& deadline_monitor) {
+  Disturbance* disturbance = disturbances_list_[disturbance_id];
+  if (!deadline_monitor.IsEnabled()) {
+    disturbance->UpdateWithSchedule(local_environment, dynamics, elapsed_time_s);
+    return;
+  }
+
+  // Hold the expensive disturbances in the degraded step
+  double& average_calculation_time_s = average_calculation_times_s_[disturbance_id];
+  if (deadline_monitor.IsActive(kRealTimeDegradationHoldDisturbances) &&
+      average_calculation_time_s >= deadline_monitor.GetExpensiveDisturbanceTime_s()) {
+    disturbance->HoldOutputs();
+    return;
+  }
 
-  Geopotential* geopotential = new Geopotential(InitGeopotential(initialize_file_name_));
-  disturbances_list_.push_back(geopotential);
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  disturbance->UpdateWithSchedule(local_environment, dynamics, elapsed_time_s);
+  const double calculation_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  // The moving average is not affected much by the isolated delays (e.g., page faults)
+  const double kSmoothingFactor = 0.1;
+  average_calculation_time_s += kSmoothingFactor * (calculation_time_s - average_calculation_time_s);
 }
 
 void Disturbances::InitializeForceAndTorque() {
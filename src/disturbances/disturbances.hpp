@@ -8,17 +8,27 @@
 
 #include <vector>
 
+#include "../dynamics/orbit/orbit_force_model.hpp"
 #include "../environment/global/simulation_time.hpp"
+#include "../math_physics/orbit/orbit_periodic_profile.hpp"
 #include "../simulation/spacecraft/structure/structure.hpp"
+#include "../utilities/case_arena.hpp"
 #include "disturbance.hpp"
 
 class Logger;
+class Geopotential;
+class ComposedForceModelBase;
 
 /**
  * @class Disturbances
  * @brief Class to manage all disturbances
+ * @details The disturbances whose stage mode is not kHold are re-evaluated or extrapolated at the stages of the orbit integrator as the
+ *          orbit force model. The composed force model selected in the [COMPOSED_FORCE_MODEL] section is added to the disturbances.
+ *          When the orbit periodic torque profile is enabled, the attitude dependent disturbances are calculated only while the profile
+ *          of their torque and force in the body frame is recorded over one orbit, and the profile is interpolated with the argument of
+ *          latitude until the refresh interval passes.
  */
-class Disturbances {
+class Disturbances : public OrbitForceModel, public ArenaAllocated {
  public:
   /**
    * @fn Disturbances
@@ -44,12 +54,35 @@ class Disturbances {
    * @param [in] simulation_time: Simulation time
    */
   void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics, const SimulationTime* simulation_time);
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Override CalcStageAcceleration_i_m_s2 function of OrbitForceModel
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_step_start_s, const libra::Vector<3>& position_i_m,
+                                                        const libra::Vector<3>& velocity_i_m_s);
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of all disturbances to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the states of all disturbances from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
   /**
    * @fn LogSetup
    * @brief log setup for all disturbances
    * @param [in] logger: Logger
    */
   void LogSetup(Logger& logger);
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of all disturbances
+   */
+  MemoryUsage GetMemoryUsage() const;
 
   /**
    * @fn GetTorque
@@ -69,13 +102,28 @@ class Disturbances {
    */
   inline libra::Vector<3> GetAcceleration_i_m_s2() { return total_acceleration_i_m_s2_; }
 
+  /**
+   * @fn GetGeopotential
+   * @brief Return the geopotential disturbance (nullptr when the center body is not the Earth)
+   */
+  inline const Geopotential* GetGeopotential() const { return geopotential_; }
+
  private:
   std::string initialize_file_name_;  //!< Initialization file name
 
-  std::vector<Disturbance*> disturbances_list_;  //!< List of disturbances
-  Vector<3> total_torque_b_Nm_;                  //!< Total disturbance torque in the body frame [Nm]
-  Vector<3> total_force_b_N_;                    //!< Total disturbance force in the body frame [N]
-  Vector<3> total_acceleration_i_m_s2_;          //!< Total disturbance acceleration in the inertial frame [m/s2]
+  std::vector<Disturbance*> disturbances_list_;             //!< List of disturbances
+  std::vector<Disturbance*> stage_disturbances_;            //!< Disturbances evaluated at the stages of the orbit integrator
+  Vector<3> total_torque_b_Nm_;                             //!< Total disturbance torque in the body frame [Nm]
+  Vector<3> total_force_b_N_;                               //!< Total disturbance force in the body frame [N]
+  Vector<3> total_acceleration_i_m_s2_;                     //!< Total disturbance acceleration in the inertial frame [m/s2]
+  std::vector<double> average_calculation_times_s_;         //!< Moving average of the calculation time of each disturbance [s]
+  Geopotential* geopotential_ = nullptr;                    //!< Geopotential disturbance in the list
+  ComposedForceModelBase* composed_force_model_ = nullptr;  //!< Composed force model selected in the initialization file
+
+  // Orbit periodic torque profile
+  libra::OrbitPeriodicProfile<6>* torque_profile_ = nullptr;  //!< Torque and force in the body frame of the attitude dependent disturbances
+  double torque_profile_refresh_interval_s_ = 0.0;            //!< Interval from the end of a profile recording to the next recording [s]
+  double torque_profile_recorded_time_s_ = 0.0;               //!< Elapsed time at the end of the latest profile recording [s]
 
   /**
    * @fn InitializeInstances
@@ -87,6 +135,30 @@ class Disturbances {
    */
   void InitializeInstances(const SimulationConfiguration* simulation_configuration, const int spacecraft_id, const Structure* structure,
                            const GlobalEnvironment* global_environment);
+  /**
+   * @fn AddDisturbance
+   * @brief Add the disturbance to the list with the update schedule and the stage mode read from the section of the initialization file
+   * @param [in] disturbance: Disturbance
+   * @param [in] section: Section name of the disturbance in the initialization file
+   */
+  void AddDisturbance(Disturbance* disturbance, const char* section);
+  /**
+   * @fn InitializeTorqueProfile
+   * @brief Initialize the orbit periodic torque profile with the [ORBIT_PERIODIC_TORQUE_PROFILE] section of the initialization file
+   */
+  void InitializeTorqueProfile();
+  /**
+   * @fn UpdateDisturbance
+   * @brief Update the disturbance with the schedule, or hold it when the real time simulation is degraded and the disturbance is expensive
+   * @note The calculation time is measured only when the deadline monitor is enabled
+   * @param [in] disturbance_id: Index of the disturbance in the list
+   * @param [in] local_environment: Local environment information
+   * @param [in] dynamics: Dynamics information
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   * @param [in] deadline_monitor: Deadline monitor of the real time simulation
+   */
+  void UpdateDisturbance(const size_t disturbance_id, const LocalEnvironment& local_environment, const Dynamics& dynamics,
+                         const double elapsed_time_s, const RealTimeDeadlineMonitor& deadline_monitor);
   /**
    * @fn InitializeForceAndTorque
    * @brief Initialize disturbance force and torque
@@ -5,19 +5,25 @@
 
 #include "geopotential.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <environment/global/physical_constants.hpp>
 #include <fstream>
 #include <iostream>
+#include <math_physics/gravity/gravity_coefficients_cache.hpp>
+#include <math_physics/math/constants.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
+#include <thread>
+#include <utilities/shared_data_registry.hpp>
 
 #include "../logger/log_utility.hpp"
 #include "../utilities/macros.hpp"
 
 // #define DEBUG_GEOPOTENTIAL
 
-Geopotential::Geopotential(const int degree, const std::string file_path, const bool is_calculation_enabled)
+Geopotential::Geopotential(const int degree, const std::string file_path, const bool is_calculation_enabled, const bool is_coefficients_cache_enabled)
     : Disturbance(is_calculation_enabled, false), degree_(degree) {
   // Initialize
   acceleration_ecef_m_s2_ = libra::Vector<3>(0.0);
@@ -31,22 +37,33 @@ Geopotential::Geopotential(const int degree, const std::string file_path, const
     degree_ = 0;
   }
   // coefficients
-  c_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
-  s_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
   // For actual EGM model, c_[0][0] should be 1.0
   // In S2E, 0 degree term is inside the SimpleCircularOrbit calculation
-  c_[0][0] = 0.0;
+  // The coefficients are shared between the instances with the same file and degree (e.g., branches of the simulation case)
+  std::shared_ptr<const GravityCoefficients> coefficients;
   if (degree_ >= 2) {
-    if (!ReadCoefficientsEgm96(file_path)) {
+    coefficients = GetSharedGravityCoefficients(file_path, degree_, [&](GravityCoefficients& read_coefficients) {
+      return ReadCoefficientsEgm96(file_path, is_coefficients_cache_enabled, read_coefficients);
+    });
+    if (coefficients == nullptr) {
       degree_ = 0;
       std::cout << "degree of Geopotential set as " << degree_ << "\n";
     }
   }
   // Initialize GravityPotential
-  geopotential_ = GravityPotential(degree, c_, s_);
+  geopotential_ = GravityPotential(degree_, coefficients);
 }
 
-bool Geopotential::ReadCoefficientsEgm96(std::string file_name) {
+bool Geopotential::ReadCoefficientsEgm96(std::string file_name, const bool is_coefficients_cache_enabled, GravityCoefficients& coefficients) {
+  if (is_coefficients_cache_enabled) {
+    GravityCoefficients cached_coefficients;
+    if (ReadGravityCoefficientsCache(file_name, degree_, cached_coefficients)) {
+      coefficients.c_ = std::move(cached_coefficients.c_);
+      coefficients.s_ = std::move(cached_coefficients.s_);
+      return true;
+    }
+  }
+
   std::ifstream coeff_file(file_name);
   if (!coeff_file.is_open()) {
     std::cerr << "File open error: Geopotential\n";
@@ -62,12 +79,50 @@ bool Geopotential::ReadCoefficientsEgm96(std::string file_name) {
     std::istringstream streamline(line);
     streamline >> n >> m >> c_nm_norm >> s_nm_norm;
 
-    c_[n][m] = c_nm_norm;
-    s_[n][m] = s_nm_norm;
+    coefficients.c_[n][m] = c_nm_norm;
+    coefficients.s_[n][m] = s_nm_norm;
+  }
+
+  if (is_coefficients_cache_enabled) {
+    WriteGravityCoefficientsCache(file_name, coefficients);
   }
   return true;
 }
 
+bool Geopotential::EnableAccelerationGrid(const std::string &file_path, const GravityAccelerationGrid::Settings &settings,
+                                          const double max_error_m_s2) {
+  acceleration_grid_.reset();
+  if (degree_ < 2) return false;
+  uint64_t source_checksum;
+  if (!CalcGravityAccelerationGridChecksum(file_path, degree_, source_checksum)) return false;
+
+  auto load = [&]() -> std::shared_ptr<const GravityAccelerationGrid> {
+    std::shared_ptr<GravityAccelerationGrid> grid = std::make_shared<GravityAccelerationGrid>();
+    const std::string grid_file_path = file_path + ".s2egrid";
+    if (!grid->Read(grid_file_path, settings, source_checksum)) {
+      std::cout << "Geopotential: Building the acceleration grid. It takes time only at the first execution." << std::endl;
+      grid->Build(geopotential_, settings, source_checksum, std::max(std::thread::hardware_concurrency(), 1u));
+      if (!grid->Write(grid_file_path)) {
+        std::cout << "[Warning] Geopotential: The acceleration grid file cannot be written: " << grid_file_path << std::endl;
+      }
+    }
+    // The error against the direct calculation is checked at the sample points in the shell
+    const double max_error_grid_m_s2 = grid->CalcMaximumError_m_s2(geopotential_, 1000);
+    if (max_error_grid_m_s2 > max_error_m_s2) {
+      std::cout << "[Warning] Geopotential: The error of the acceleration grid " << max_error_grid_m_s2 << " m/s2 exceeds the tolerance "
+                << max_error_m_s2 << " m/s2. The acceleration is calculated directly." << std::endl;
+      return nullptr;
+    }
+    std::cout << "Geopotential: The acceleration grid is used. Maximum error: " << max_error_grid_m_s2 << " m/s2" << std::endl;
+    return grid;
+  };
+  acceleration_grid_ = SharedDataRegistry<GravityAccelerationGrid>::Get(
+      MakeSharedDataKey(file_path, degree_, settings.min_radius_m, settings.max_radius_m, settings.radius_step_m, settings.angle_step_rad,
+                        max_error_m_s2),
+      load);
+  return acceleration_grid_ != nullptr;
+}
+
 void Geopotential::Update(const LocalEnvironment &local_environment, const Dynamics &dynamics) {
 #ifdef DEBUG_GEOPOTENTIAL
   chrono::system_clock::time_point start, end;
@@ -75,7 +130,13 @@ void Geopotential::Update(const LocalEnvironment &local_environment, const Dynam
   debug_pos_ecef_m_ = spacecraft.dynamics_->orbit_->GetPosition_ecef_m();
 #endif
 
-  acceleration_ecef_m_s2_ = geopotential_.CalcAcceleration_xcxf_m_s2(dynamics.GetOrbit().GetPosition_ecef_m());
+  const libra::Vector<3> &position_ecef_m = dynamics.GetOrbit().GetPosition_ecef_m();
+  libra::Matrix<3, 3> gravity_gradient_ecef_s2(0.0);
+  if (is_gravity_gradient_enabled_) {
+    geopotential_.CalcAccelerationAndPartialDerivative_xcxf(position_ecef_m, acceleration_ecef_m_s2_, gravity_gradient_ecef_s2);
+  } else if (acceleration_grid_ == nullptr || !acceleration_grid_->CalcAcceleration_xcxf_m_s2(position_ecef_m, acceleration_ecef_m_s2_)) {
+    acceleration_ecef_m_s2_ = geopotential_.CalcAcceleration_xcxf_m_s2(position_ecef_m);
+  }
 #ifdef DEBUG_GEOPOTENTIAL
   end = chrono::system_clock::now();
   time_ms_ = static_cast<double>(chrono::duration_cast<chrono::microseconds>(end - start).count() / 1000.0);
@@ -83,9 +144,24 @@ void Geopotential::Update(const LocalEnvironment &local_environment, const Dynam
   UNUSED(time_ms_);
 #endif
 
-  libra::Matrix<3, 3> trans_eci2ecef_ = local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation().GetDcmJ2000ToEcef();
-  libra::Matrix<3, 3> trans_ecef2eci = trans_eci2ecef_.Transpose();
-  acceleration_i_m_s2_ = trans_ecef2eci * acceleration_ecef_m_s2_;
+  const EarthRotation& earth_rotation = local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation();
+  dcm_eci_to_ecef_ = earth_rotation.GetDcmJ2000ToEcef();
+  dcm_ecef_to_eci_ = earth_rotation.GetDcmEcefToJ2000();
+  acceleration_i_m_s2_ = dcm_ecef_to_eci_ * acceleration_ecef_m_s2_;
+  if (is_gravity_gradient_enabled_) gravity_gradient_i_s2_ = dcm_ecef_to_eci_ * gravity_gradient_ecef_s2 * dcm_eci_to_ecef_;
+}
+
+bool Geopotential::CalcAccelerationAtPosition_i_m_s2(const double time_from_update_s, const libra::Vector<3> &position_i_m,
+                                                     const libra::Vector<3> &velocity_i_m_s, libra::Vector<3> &acceleration_i_m_s2) {
+  UNUSED(time_from_update_s);
+  UNUSED(velocity_i_m_s);
+  const libra::Vector<3> position_ecef_m = dcm_eci_to_ecef_ * position_i_m;
+  libra::Vector<3> acceleration_ecef_m_s2;
+  if (acceleration_grid_ == nullptr || !acceleration_grid_->CalcAcceleration_xcxf_m_s2(position_ecef_m, acceleration_ecef_m_s2)) {
+    acceleration_ecef_m_s2 = geopotential_.CalcAcceleration_xcxf_m_s2(position_ecef_m);
+  }
+  acceleration_i_m_s2 = dcm_ecef_to_eci_ * acceleration_ecef_m_s2;
+  return true;
 }
 
 std::string Geopotential::GetLogHeader() const {
@@ -113,6 +189,13 @@ std::string Geopotential::GetLogValue() const {
   return str_tmp;
 }
 
+MemoryUsage Geopotential::GetMemoryUsage() const {
+  const size_t owned_bytes = sizeof(*this) - sizeof(geopotential_) + geopotential_.GetMemoryUsage_bytes();
+  size_t shared_bytes = geopotential_.GetCoefficientsMemoryUsage_bytes();
+  if (acceleration_grid_ != nullptr) shared_bytes += acceleration_grid_->GetValuesSize_bytes();
+  return MemoryUsage("Geopotential", owned_bytes, shared_bytes);
+}
+
 Geopotential InitGeopotential(const std::string initialize_file_path) {
   auto conf = IniAccess(initialize_file_path);
   const char *section = "GEOPOTENTIAL";
@@ -121,8 +204,22 @@ Geopotential InitGeopotential(const std::string initialize_file_path) {
   const std::string coefficients_file_path = conf.ReadString(section, "coefficients_file_path");
 
   const bool is_calc_enable = conf.ReadEnable(section, INI_CALC_LABEL);
-  Geopotential geopotential_disturbance(degree, coefficients_file_path, is_calc_enable);
+  const bool is_coefficients_cache_enabled = conf.ReadEnable(section, "coefficients_cache");
+  Geopotential geopotential_disturbance(degree, coefficients_file_path, is_calc_enable, is_coefficients_cache_enabled);
+  if (conf.ReadEnable(section, "acceleration_grid")) {
+    GravityAccelerationGrid::Settings grid_settings;
+    grid_settings.min_radius_m = environment::earth_equatorial_radius_m + conf.ReadDouble(section, "acceleration_grid_min_altitude_m");
+    grid_settings.max_radius_m = environment::earth_equatorial_radius_m + conf.ReadDouble(section, "acceleration_grid_max_altitude_m");
+    grid_settings.radius_step_m = conf.ReadDouble(section, "acceleration_grid_altitude_step_m");
+    grid_settings.angle_step_rad = conf.ReadDouble(section, "acceleration_grid_angle_step_deg") * libra::deg_to_rad;
+    if (grid_settings.radius_step_m <= 0.0 || grid_settings.angle_step_rad <= 0.0) {
+      throw std::invalid_argument("GEOPOTENTIAL: acceleration_grid_altitude_step_m and acceleration_grid_angle_step_deg must be positive.");
+    }
+    geopotential_disturbance.EnableAccelerationGrid(coefficients_file_path, grid_settings,
+                                                    conf.ReadDouble(section, "acceleration_grid_max_error_m_s2"));
+  }
   geopotential_disturbance.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  geopotential_disturbance.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return geopotential_disturbance;
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "../math_physics/gravity/gravity_acceleration_grid.hpp"
 #include "../math_physics/gravity/gravity_potential.hpp"
 #include "../math_physics/math/vector.hpp"
 #include "disturbance.hpp"
@@ -23,8 +24,10 @@ class Geopotential : public Disturbance {
    * @param [in] degree: Maximum degree setting to calculate the geo-potential
    * @param [in] file_path: EGM96 coefficients file path
    * @param [in] is_calculation_enabled: Calculation flag
+   * @param [in] is_coefficients_cache_enabled: Use the binary coefficients cache file to skip the text file parsing
    */
-  Geopotential(const int degree, const std::string file_path, const bool is_calculation_enabled = true);
+  Geopotential(const int degree, const std::string file_path, const bool is_calculation_enabled = true,
+               const bool is_coefficients_cache_enabled = false);
 
   /**
    * @fn Geopotential
@@ -32,9 +35,12 @@ class Geopotential : public Disturbance {
    */
   Geopotential(const Geopotential &obj) : Disturbance(obj) {
     geopotential_ = obj.geopotential_;
+    acceleration_grid_ = obj.acceleration_grid_;
     degree_ = obj.degree_;
-    c_ = obj.c_;
-    s_ = obj.s_;
+    is_gravity_gradient_enabled_ = obj.is_gravity_gradient_enabled_;
+    gravity_gradient_i_s2_ = obj.gravity_gradient_i_s2_;
+    dcm_eci_to_ecef_ = obj.dcm_eci_to_ecef_;
+    dcm_ecef_to_eci_ = obj.dcm_ecef_to_eci_;
   }
 
   ~Geopotential() {}
@@ -46,6 +52,80 @@ class Geopotential : public Disturbance {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment &local_environment, const Dynamics &dynamics);
+  /**
+   * @fn GetInputDependency
+   * @brief Return the input dependency (the ECEF position and the earth rotation to convert the acceleration)
+   */
+  virtual unsigned int GetInputDependency() const { return kDisturbanceInputPosition_ecef | kDisturbanceInputTime; }
+  /**
+   * @fn CalcAccelerationAtPosition_i_m_s2
+   * @brief Override CalcAccelerationAtPosition_i_m_s2 function of Disturbance. The earth rotation of the latest update is used.
+   */
+  virtual bool CalcAccelerationAtPosition_i_m_s2(const double time_from_update_s, const libra::Vector<3> &position_i_m,
+                                                 const libra::Vector<3> &velocity_i_m_s, libra::Vector<3> &acceleration_i_m_s2);
+
+  /**
+   * @fn CalcAcceleration_ecef_m_s2
+   * @brief Calculate the gravity acceleration for many positions at once (e.g., constellation or Monte Carlo runs sharing the coefficients)
+   * @note The result of each position is identical with the acceleration calculated in the Update function
+   * @param [in] position_x_ecef_m: X component of the positions in the ECEF frame [m]
+   * @param [in] position_y_ecef_m: Y component of the positions in the ECEF frame [m]
+   * @param [in] position_z_ecef_m: Z component of the positions in the ECEF frame [m]
+   * @param [out] acceleration_x_ecef_m_s2: X component of the accelerations in the ECEF frame [m/s2]
+   * @param [out] acceleration_y_ecef_m_s2: Y component of the accelerations in the ECEF frame [m/s2]
+   * @param [out] acceleration_z_ecef_m_s2: Z component of the accelerations in the ECEF frame [m/s2]
+   */
+  inline void CalcAcceleration_ecef_m_s2(const std::vector<double> &position_x_ecef_m, const std::vector<double> &position_y_ecef_m,
+                                         const std::vector<double> &position_z_ecef_m, std::vector<double> &acceleration_x_ecef_m_s2,
+                                         std::vector<double> &acceleration_y_ecef_m_s2, std::vector<double> &acceleration_z_ecef_m_s2) {
+    geopotential_.CalcAcceleration_xcxf_m_s2(position_x_ecef_m, position_y_ecef_m, position_z_ecef_m, acceleration_x_ecef_m_s2,
+                                             acceleration_y_ecef_m_s2, acceleration_z_ecef_m_s2);
+  }
+
+  /**
+   * @fn GetGravityPotential
+   * @brief Return the gravity potential in the ECEF frame (e.g., to calculate the partial derivative for the STM propagation)
+   */
+  inline const GravityPotential &GetGravityPotential() const { return geopotential_; }
+  /**
+   * @fn SetCalculationDegree
+   * @brief Change the degree used in the calculation temporarily (e.g., to keep the real time deadline)
+   * @param [in] degree: Degree. It is limited to the degree of the initialization.
+   */
+  inline void SetCalculationDegree(const size_t degree) { geopotential_.SetDegree(degree); }
+  /**
+   * @fn RestoreCalculationDegree
+   * @brief Restore the degree of the initialization
+   */
+  inline void RestoreCalculationDegree() { geopotential_.SetDegree(degree_); }
+  /**
+   * @fn EnableAccelerationGrid
+   * @brief Interpolate the acceleration with the precomputed grid in the radius shell instead of the spherical harmonics calculation
+   * @details The grid is read from <file_path>.s2egrid when it matches with the coefficients, the degree, and the settings. Otherwise,
+   *          it is built with the spherical harmonics and written to the file. The grid is shared between the instances in the process.
+   *          The positions out of the shell are calculated directly. The degree changed by SetCalculationDegree is not applied to the grid.
+   * @param [in] file_path: Coefficients file path used in the constructor
+   * @param [in] settings: Grid settings
+   * @param [in] max_error_m_s2: Tolerance of the maximum error against the direct calculation. The grid is not used when it is exceeded.
+   * @return True when the grid is used
+   */
+  bool EnableAccelerationGrid(const std::string &file_path, const GravityAccelerationGrid::Settings &settings, const double max_error_m_s2);
+  /**
+   * @fn EnableGravityGradient
+   * @brief Calculate the gravity gradient tensor with the acceleration in the Update function (e.g., for the gravity gradient torque)
+   * @note The acceleration and the tensor are calculated with the single spherical harmonics recursion, so the acceleration grid is not used.
+   */
+  inline void EnableGravityGradient() { is_gravity_gradient_enabled_ = true; }
+  /**
+   * @fn GetGravityGradient_i_s2
+   * @brief Return the gravity gradient tensor of the degree 2 and higher terms at the latest update in the ECI frame [1/s2]
+   */
+  inline const libra::Matrix<3, 3> &GetGravityGradient_i_s2() const { return gravity_gradient_i_s2_; }
+  /**
+   * @fn IsCalculationEnabled
+   * @brief Return calculation flag
+   */
+  inline bool IsCalculationEnabled() const { return is_calculation_enabled_; }
 
   // Override ILoggable
   /**
@@ -59,12 +139,21 @@ class Geopotential : public Disturbance {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn GetMemoryUsage
+   * @brief Override GetMemoryUsage function of Disturbance. The coefficients are reported as the shared memory.
+   */
+  MemoryUsage GetMemoryUsage() const override;
+
  private:
   GravityPotential geopotential_;
-  size_t degree_;                       //!< Maximum degree setting to calculate the geo-potential
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  Vector<3> acceleration_ecef_m_s2_;    //!< Calculated acceleration in the ECEF frame [m/s2]
+  std::shared_ptr<const GravityAccelerationGrid> acceleration_grid_;  //!< Precomputed acceleration grid. nullptr when it is not used.
+  size_t degree_;                                                     //!< Maximum degree setting to calculate the geo-potential
+  Vector<3> acceleration_ecef_m_s2_;                                  //!< Calculated acceleration in the ECEF frame [m/s2]
+  libra::Matrix<3, 3> dcm_eci_to_ecef_{0.0};                          //!< Direction cosine matrix from the ECI to the ECEF frame at the latest update
+  libra::Matrix<3, 3> dcm_ecef_to_eci_{0.0};                          //!< Direction cosine matrix from the ECEF to the ECI frame at the latest update
+  bool is_gravity_gradient_enabled_ = false;                          //!< Flag to calculate the gravity gradient tensor
+  libra::Matrix<3, 3> gravity_gradient_i_s2_{0.0};                    //!< Gravity gradient tensor in the ECI frame at the latest update [1/s2]
 
   // debug
   libra::Vector<3> debug_pos_ecef_m_;  //!< Spacecraft position in ECEF frame [m]
@@ -74,8 +163,10 @@ class Geopotential : public Disturbance {
    * @fn ReadCoefficientsEgm96
    * @brief Read the geo-potential coefficients for the EGM96 model
    * @param [in] file_name: Coefficient file name
+   * @param [in] is_coefficients_cache_enabled: Use the binary coefficients cache file
+   * @param [out] coefficients: Read coefficients whose tables are allocated for the degree
    */
-  bool ReadCoefficientsEgm96(std::string file_name);
+  bool ReadCoefficientsEgm96(std::string file_name, const bool is_coefficients_cache_enabled, GravityCoefficients& coefficients);
 };
 
 /**
@@ -10,17 +10,30 @@
 #include <setting_file_reader/initialize_file_access.hpp>
 
 #include "../logger/log_utility.hpp"
+#include "geopotential.hpp"
 
-GravityGradient::GravityGradient(const bool is_calculation_enabled)
-    : GravityGradient(environment::earth_gravitational_constant_m3_s2, is_calculation_enabled) {}
+GravityGradient::GravityGradient(const bool is_calculation_enabled, const bool is_geopotential_gradient_enabled)
+    : GravityGradient(environment::earth_gravitational_constant_m3_s2, is_calculation_enabled, is_geopotential_gradient_enabled) {}
 
-GravityGradient::GravityGradient(const double gravity_constant_m3_s2, const bool is_calculation_enabled)
-    : Disturbance(is_calculation_enabled, true), gravity_constant_m3_s2_(gravity_constant_m3_s2) {}
+GravityGradient::GravityGradient(const double gravity_constant_m3_s2, const bool is_calculation_enabled, const bool is_geopotential_gradient_enabled)
+    : Disturbance(is_calculation_enabled, true),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      is_geopotential_gradient_enabled_(is_geopotential_gradient_enabled) {}
 
 void GravityGradient::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
   // TODO: use structure information to get inertia tensor
-  CalcTorque_b_Nm(local_environment.GetCelestialInformation().GetCenterBodyPositionFromSpacecraft_b_m(),
-                  dynamics.GetAttitude().GetInertiaTensor_b_kgm2());
+  const libra::Matrix<3, 3> inertia_tensor_b_kgm2 = dynamics.GetAttitude().GetInertiaTensor_b_kgm2();
+  CalcTorque_b_Nm(local_environment.GetState().center_body_position_from_spacecraft_b_m, inertia_tensor_b_kgm2);
+  if (geopotential_ != nullptr && geopotential_->IsCalculationEnabled()) {
+    const libra::Matrix<3, 3> dcm_i2b = dynamics.GetAttitude().GetQuaternion_i2b().ConvertToDcm();
+    const libra::Matrix<3, 3> gravity_gradient_b_s2 = dcm_i2b * geopotential_->GetGravityGradient_i_s2() * dcm_i2b.Transpose();
+    torque_b_Nm_ += CalcTorque_b_Nm(gravity_gradient_b_s2, inertia_tensor_b_kgm2);
+  }
+}
+
+void GravityGradient::SetGeopotential(Geopotential* geopotential) {
+  geopotential->EnableGravityGradient();
+  geopotential_ = geopotential;
 }
 
 libra::Vector<3> GravityGradient::CalcTorque_b_Nm(const libra::Vector<3> earth_position_from_sc_b_m,
@@ -34,6 +47,17 @@ libra::Vector<3> GravityGradient::CalcTorque_b_Nm(const libra::Vector<3> earth_p
   return torque_b_Nm_;
 }
 
+libra::Vector<3> GravityGradient::CalcTorque_b_Nm(const libra::Matrix<3, 3>& gravity_gradient_b_s2,
+                                                  const libra::Matrix<3, 3>& inertia_tensor_b_kgm2) const {
+  // torque_i = epsilon_ijk (G * I)_jk for the symmetric gravity gradient G and the inertia tensor I
+  const libra::Matrix<3, 3> product = gravity_gradient_b_s2 * inertia_tensor_b_kgm2;
+  libra::Vector<3> torque_b_Nm;
+  torque_b_Nm[0] = product[1][2] - product[2][1];
+  torque_b_Nm[1] = product[2][0] - product[0][2];
+  torque_b_Nm[2] = product[0][1] - product[1][0];
+  return torque_b_Nm;
+}
+
 std::string GravityGradient::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -55,8 +79,10 @@ GravityGradient InitGravityGradient(const std::string initialize_file_path) {
   const char* section = "GRAVITY_GRADIENT";
 
   const bool is_calc_enable = conf.ReadEnable(section, INI_CALC_LABEL);
-  GravityGradient gg_disturbance(is_calc_enable);
+  const bool is_geopotential_gradient_enabled = conf.ReadEnable(section, "geopotential_gradient");
+  GravityGradient gg_disturbance(is_calc_enable, is_geopotential_gradient_enabled);
   gg_disturbance.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  gg_disturbance.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return gg_disturbance;
 }
@@ -66,8 +92,10 @@ GravityGradient InitGravityGradient(const std::string initialize_file_path, cons
   const char* section = "GRAVITY_GRADIENT";
 
   const bool is_calc_enable = conf.ReadEnable(section, INI_CALC_LABEL);
-  GravityGradient gg_disturbance(gravity_constant_m3_s2, is_calc_enable);
+  const bool is_geopotential_gradient_enabled = conf.ReadEnable(section, "geopotential_gradient");
+  GravityGradient gg_disturbance(gravity_constant_m3_s2, is_calc_enable, is_geopotential_gradient_enabled);
   gg_disturbance.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  gg_disturbance.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return gg_disturbance;
 }
@@ -14,9 +14,14 @@
 #include "../math_physics/math/vector.hpp"
 #include "disturbance.hpp"
 
+class Geopotential;
+
 /**
  * @class GravityGradient
  * @brief Class to calculate the gravity gradient torque
+ * @details The point mass term is calculated with the gravitational constant. When the geopotential is set, the torque of the degree 2 and
+ *          higher terms is added with the gravity gradient tensor calculated in the geopotential update, so the spherical harmonics are not
+ *          evaluated again for the torque.
  */
 class GravityGradient : public Disturbance {
  public:
@@ -24,16 +29,18 @@ class GravityGradient : public Disturbance {
    * @fn GravityGradient
    * @brief Default Constructor
    * @param [in] is_calculation_enabled: Calculation flag
+   * @param [in] is_geopotential_gradient_enabled: Flag to add the torque of the geopotential when it is set
    * @note mu is automatically set as earth's gravitational constant
    */
-  GravityGradient(const bool is_calculation_enabled = true);
+  GravityGradient(const bool is_calculation_enabled = true, const bool is_geopotential_gradient_enabled = false);
   /**
    * @fn GravityGradient
    * @brief Constructor
    * @param [in] gravity_constant_m3_s2: Gravitational constant [m3/s2]
    * @param [in] is_calculation_enabled: Calculation flag
+   * @param [in] is_geopotential_gradient_enabled: Flag to add the torque of the geopotential when it is set
    */
-  GravityGradient(const double gravity_constant_m3_s2, const bool is_calculation_enabled = true);
+  GravityGradient(const double gravity_constant_m3_s2, const bool is_calculation_enabled = true, const bool is_geopotential_gradient_enabled = false);
 
   /**
    * @fn Update
@@ -42,6 +49,24 @@ class GravityGradient : public Disturbance {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn GetInputDependency
+   * @brief Return the input dependency (the position, the attitude, and the inertia tensor)
+   */
+  virtual unsigned int GetInputDependency() const { return kDisturbanceInputPosition_i | kDisturbanceInputAttitude | kDisturbanceInputInertia; }
+
+  /**
+   * @fn SetGeopotential
+   * @brief Add the torque of the geopotential with its gravity gradient tensor. The tensor calculation of the geopotential is enabled.
+   * @note The geopotential should be updated before this disturbance to use the tensor at the same step.
+   * @param [in] geopotential: Geopotential disturbance
+   */
+  void SetGeopotential(Geopotential* geopotential);
+  /**
+   * @fn IsGeopotentialGradientEnabled
+   * @brief Return true when the torque of the geopotential is requested in the setting
+   */
+  inline bool IsGeopotentialGradientEnabled() const { return is_geopotential_gradient_enabled_; }
 
   // Override ILoggable
   /**
@@ -56,7 +81,9 @@ class GravityGradient : public Disturbance {
   virtual std::string GetLogValue() const;
 
  private:
-  double gravity_constant_m3_s2_;  //!< Gravitational constant [m3/s2]
+  double gravity_constant_m3_s2_;                  //!< Gravitational constant [m3/s2]
+  bool is_geopotential_gradient_enabled_;          //!< Flag to add the torque of the geopotential
+  const Geopotential* geopotential_ = nullptr;     //!< Geopotential providing the gravity gradient tensor. nullptr when it is not used.
 
   /**
    * @fn CalcTorque
@@ -66,6 +93,14 @@ class GravityGradient : public Disturbance {
    * @return Calculated torque at body frame [Nm]
    */
   libra::Vector<3> CalcTorque_b_Nm(const libra::Vector<3> earth_position_from_sc_b_m, const libra::Matrix<3, 3> inertia_tensor_b_kgm2);
+  /**
+   * @fn CalcTorque_b_Nm
+   * @brief Calculate gravity gradient torque with the gravity gradient tensor
+   * @param [in] gravity_gradient_b_s2: Gravity gradient tensor at body frame [1/s2]
+   * @param [in] inertia_tensor_b_kgm2: Inertia Tensor at body frame [kg*m^2]
+   * @return Calculated torque at body frame [Nm]
+   */
+  libra::Vector<3> CalcTorque_b_Nm(const libra::Matrix<3, 3>& gravity_gradient_b_s2, const libra::Matrix<3, 3>& inertia_tensor_b_kgm2) const;
 };
 
 /**
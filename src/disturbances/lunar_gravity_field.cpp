@@ -10,6 +10,7 @@
 #include <environment/global/physical_constants.hpp>
 #include <fstream>
 #include <iostream>
+#include <math_physics/gravity/gravity_coefficients_cache.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
 
 #include "../logger/log_utility.hpp"
@@ -17,7 +18,8 @@
 
 // #define DEBUG_LUNAR_GRAVITY_FIELD
 
-LunarGravityField::LunarGravityField(const int degree, const std::string file_path, const bool is_calculation_enabled)
+LunarGravityField::LunarGravityField(const int degree, const std::string file_path, const bool is_calculation_enabled,
+                                     const bool is_coefficients_cache_enabled)
     : Disturbance(is_calculation_enabled, false), degree_(degree) {
   // Initialize
   acceleration_mcmf_m_s2_ = libra::Vector<3>(0.0);
@@ -34,22 +36,39 @@ LunarGravityField::LunarGravityField(const int degree, const std::string file_pa
     degree_ = 0;
   }
   // coefficients
-  c_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
-  s_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
   // For actual GRGM model, c_[0][0] should be 1.0
   // In S2E, 0 degree term is inside the RK4 orbit calculation
-  c_[0][0] = 0.0;
+  // The coefficients are shared between the instances with the same file and degree (e.g., branches of the simulation case)
+  std::shared_ptr<const GravityCoefficients> coefficients;
   if (degree_ >= 2) {
-    if (!ReadCoefficientsGrgm1200a(file_path)) {
+    coefficients = GetSharedGravityCoefficients(file_path, degree_, [&](GravityCoefficients& read_coefficients) {
+      return ReadCoefficientsGrgm1200a(file_path, is_coefficients_cache_enabled, read_coefficients);
+    });
+    if (coefficients == nullptr) {
       degree_ = 0;
       std::cout << "degree of LunarGravityField set as " << degree_ << "\n";
+    } else {
+      reference_radius_km_ = coefficients->reference_radius_;
+      gravity_constants_km3_s2_ = coefficients->gravity_constant_;
     }
   }
   // Initialize GravityPotential
-  lunar_potential_ = GravityPotential(degree, c_, s_, gravity_constants_km3_s2_ * 1e9, reference_radius_km_ * 1e3);
+  lunar_potential_ = GravityPotential(degree_, coefficients, gravity_constants_km3_s2_ * 1e9, reference_radius_km_ * 1e3);
 }
 
-bool LunarGravityField::ReadCoefficientsGrgm1200a(std::string file_name) {
+bool LunarGravityField::ReadCoefficientsGrgm1200a(std::string file_name, const bool is_coefficients_cache_enabled,
+                                                  GravityCoefficients& coefficients) {
+  if (is_coefficients_cache_enabled) {
+    GravityCoefficients cached_coefficients;
+    if (ReadGravityCoefficientsCache(file_name, degree_, cached_coefficients)) {
+      coefficients.reference_radius_ = cached_coefficients.reference_radius_;
+      coefficients.gravity_constant_ = cached_coefficients.gravity_constant_;
+      coefficients.c_ = std::move(cached_coefficients.c_);
+      coefficients.s_ = std::move(cached_coefficients.s_);
+      return true;
+    }
+  }
+
   std::ifstream coeff_file(file_name);
   if (!coeff_file.is_open()) {
     std::cerr << "File open error: LunarGravityField\n";
@@ -59,9 +78,9 @@ bool LunarGravityField::ReadCoefficientsGrgm1200a(std::string file_name) {
   // Read header
   std::string line, cell;
   getline(coeff_file, cell, ',');
-  reference_radius_km_ = std::stod(cell);
+  coefficients.reference_radius_ = std::stod(cell);
   getline(coeff_file, cell, ',');
-  gravity_constants_km3_s2_ = std::stod(cell);
+  coefficients.gravity_constant_ = std::stod(cell);
   // next line
   getline(coeff_file, line);
 
@@ -80,15 +99,19 @@ bool LunarGravityField::ReadCoefficientsGrgm1200a(std::string file_name) {
     // next line
     getline(coeff_file, line);
 
-    c_[n][m] = c_nm_norm;
-    s_[n][m] = s_nm_norm;
+    coefficients.c_[n][m] = c_nm_norm;
+    coefficients.s_[n][m] = s_nm_norm;
+  }
+
+  if (is_coefficients_cache_enabled) {
+    WriteGravityCoefficientsCache(file_name, coefficients);
   }
   return true;
 }
 
 void LunarGravityField::Update(const LocalEnvironment &local_environment, const Dynamics &dynamics) {
-  const CelestialInformation global_celestial_information = local_environment.GetCelestialInformation().GetGlobalInformation();
-  libra::Matrix<3, 3> dcm_mci2mcmf_ = global_celestial_information.GetMoonRotation().GetDcmJ2000ToMcmf();
+  const MoonRotation &moon_rotation = local_environment.GetCelestialInformation().GetGlobalInformation().GetMoonRotation();
+  const libra::Matrix<3, 3> &dcm_mci2mcmf_ = moon_rotation.GetDcmJ2000ToMcmf();
 
   libra::Vector<3> spacecraft_position_mci_m = dynamics.GetOrbit().GetPosition_i_m();
   libra::Vector<3> spacecraft_position_mcmf_m = dcm_mci2mcmf_ * spacecraft_position_mci_m;
@@ -107,8 +130,7 @@ void LunarGravityField::Update(const LocalEnvironment &local_environment, const
   UNUSED(time_ms_);
 #endif
 
-  libra::Matrix<3, 3> dcm_mcmf2i = dcm_mci2mcmf_.Transpose();
-  acceleration_i_m_s2_ = dcm_mcmf2i * acceleration_mcmf_m_s2_;
+  acceleration_i_m_s2_ = moon_rotation.GetDcmMcmfToJ2000() * acceleration_mcmf_m_s2_;
 }
 
 std::string LunarGravityField::GetLogHeader() const {
@@ -144,9 +166,11 @@ LunarGravityField InitLunarGravityField(const std::string initialize_file_path)
   const std::string coefficients_file_path = conf.ReadString(section, "coefficients_file_path");
 
   const bool is_calc_enable = conf.ReadEnable(section, INI_CALC_LABEL);
+  const bool is_coefficients_cache_enabled = conf.ReadEnable(section, "coefficients_cache");
 
-  LunarGravityField lunar_gravity_field(degree, coefficients_file_path, is_calc_enable);
+  LunarGravityField lunar_gravity_field(degree, coefficients_file_path, is_calc_enable, is_coefficients_cache_enabled);
   lunar_gravity_field.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  lunar_gravity_field.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return lunar_gravity_field;
 }
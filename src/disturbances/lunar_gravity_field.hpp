@@ -23,8 +23,10 @@ class LunarGravityField : public Disturbance {
    * @param [in] degree: Maximum degree setting to calculate the geo-potential
    * @param [in] file_path: EGM96 coefficients file path
    * @param [in] is_calculation_enabled: Calculation flag
+   * @param [in] is_coefficients_cache_enabled: Use the binary coefficients cache file to skip the text file parsing
    */
-  LunarGravityField(const int degree, const std::string file_path, const bool is_calculation_enabled = true);
+  LunarGravityField(const int degree, const std::string file_path, const bool is_calculation_enabled = true,
+                    const bool is_coefficients_cache_enabled = false);
 
   /**
    * @fn LunarGravityField
@@ -35,8 +37,6 @@ class LunarGravityField : public Disturbance {
     reference_radius_km_ = obj.reference_radius_km_;
     gravity_constants_km3_s2_ = obj.gravity_constants_km3_s2_;
     degree_ = obj.degree_;
-    c_ = obj.c_;
-    s_ = obj.s_;
   }
 
   ~LunarGravityField() {}
@@ -48,6 +48,29 @@ class LunarGravityField : public Disturbance {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment &local_environment, const Dynamics &dynamics);
+  /**
+   * @fn GetInputDependency
+   * @brief Return the input dependency (the position and the rotation of the moon)
+   */
+  virtual unsigned int GetInputDependency() const { return kDisturbanceInputPosition_i | kDisturbanceInputTime; }
+
+  /**
+   * @fn CalcAcceleration_mcmf_m_s2
+   * @brief Calculate the gravity acceleration for many positions at once (e.g., constellation or Monte Carlo runs sharing the coefficients)
+   * @note The result of each position is identical with the acceleration calculated in the Update function
+   * @param [in] position_x_mcmf_m: X component of the positions in the MCMF frame [m]
+   * @param [in] position_y_mcmf_m: Y component of the positions in the MCMF frame [m]
+   * @param [in] position_z_mcmf_m: Z component of the positions in the MCMF frame [m]
+   * @param [out] acceleration_x_mcmf_m_s2: X component of the accelerations in the MCMF frame [m/s2]
+   * @param [out] acceleration_y_mcmf_m_s2: Y component of the accelerations in the MCMF frame [m/s2]
+   * @param [out] acceleration_z_mcmf_m_s2: Z component of the accelerations in the MCMF frame [m/s2]
+   */
+  inline void CalcAcceleration_mcmf_m_s2(const std::vector<double> &position_x_mcmf_m, const std::vector<double> &position_y_mcmf_m,
+                                         const std::vector<double> &position_z_mcmf_m, std::vector<double> &acceleration_x_mcmf_m_s2,
+                                         std::vector<double> &acceleration_y_mcmf_m_s2, std::vector<double> &acceleration_z_mcmf_m_s2) {
+    lunar_potential_.CalcAcceleration_xcxf_m_s2(position_x_mcmf_m, position_y_mcmf_m, position_z_mcmf_m, acceleration_x_mcmf_m_s2,
+                                                acceleration_y_mcmf_m_s2, acceleration_z_mcmf_m_s2);
+  }
 
   // Override ILoggable
   /**
@@ -65,10 +88,8 @@ class LunarGravityField : public Disturbance {
   GravityPotential lunar_potential_;
   double reference_radius_km_;
   double gravity_constants_km3_s2_;
-  size_t degree_;                       //!< Maximum degree setting to calculate the geo-potential
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  Vector<3> acceleration_mcmf_m_s2_;    //!< Calculated acceleration in the MCMF(Moon Centered Moon Fixed) frame [m/s2]
+  size_t degree_;                     //!< Maximum degree setting to calculate the geo-potential
+  Vector<3> acceleration_mcmf_m_s2_;  //!< Calculated acceleration in the MCMF(Moon Centered Moon Fixed) frame [m/s2]
 
   // debug
   libra::Vector<3> debug_pos_mcmf_m_;  //!< Spacecraft position in MCMF frame [m]
@@ -78,8 +99,10 @@ class LunarGravityField : public Disturbance {
    * @fn ReadCoefficientsGrgm1200a
    * @brief Read the lunar gravity field coefficients for the GRGM1200A model
    * @param [in] file_name: Coefficient file name
+   * @param [in] is_coefficients_cache_enabled: Use the binary coefficients cache file
+   * @param [out] coefficients: Read coefficients whose tables are allocated for the degree
    */
-  bool ReadCoefficientsGrgm1200a(std::string file_name);
+  bool ReadCoefficientsGrgm1200a(std::string file_name, const bool is_coefficients_cache_enabled, GravityCoefficients& coefficients);
 };
 
 /**
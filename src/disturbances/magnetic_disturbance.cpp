@@ -10,11 +10,13 @@
 
 #include "../logger/log_utility.hpp"
 #include "../math_physics/randomization/global_randomization.hpp"
-#include "../math_physics/randomization/normal_randomization.hpp"
-#include "../math_physics/randomization/random_walk.hpp"
 
 MagneticDisturbance::MagneticDisturbance(const ResidualMagneticMoment& rmm_params, const bool is_calculation_enabled)
-    : Disturbance(is_calculation_enabled, true), residual_magnetic_moment_(rmm_params) {
+    : Disturbance(is_calculation_enabled, true),
+      residual_magnetic_moment_(rmm_params),
+      random_walk_(0.1, libra::Vector<3>(rmm_params.GetRandomWalkStandardDeviation_Am2()),
+                   libra::Vector<3>(rmm_params.GetRandomWalkLimit_Am2())),  // [FIXME] step width is constant
+      normal_random_(0.0, rmm_params.GetRandomNoiseStandardDeviation_Am2(), global_randomization.MakeSeed()) {
   rmm_b_Am2_ = residual_magnetic_moment_.GetConstantValue_b_Am2();
 }
 
@@ -31,16 +33,11 @@ void MagneticDisturbance::Update(const LocalEnvironment& local_environment, cons
 }
 
 void MagneticDisturbance::CalcRMM() {
-  static libra::Vector<3> random_walk_std_dev(residual_magnetic_moment_.GetRandomWalkStandardDeviation_Am2());
-  static libra::Vector<3> random_walk_limit(residual_magnetic_moment_.GetRandomWalkLimit_Am2());
-  static RandomWalk<3> random_walk(0.1, random_walk_std_dev, random_walk_limit);  // [FIXME] step width is constant
-  static libra::NormalRand normal_random(0.0, residual_magnetic_moment_.GetRandomNoiseStandardDeviation_Am2(), global_randomization.MakeSeed());
-
   rmm_b_Am2_ = residual_magnetic_moment_.GetConstantValue_b_Am2();
   for (int i = 0; i < 3; ++i) {
-    rmm_b_Am2_[i] += random_walk[i] + normal_random;
+    rmm_b_Am2_[i] += random_walk_[i] + normal_random_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
 }
 
 std::string MagneticDisturbance::GetLogHeader() const {
@@ -64,10 +61,26 @@ std::string MagneticDisturbance::GetLogValue() const {
 MagneticDisturbance InitMagneticDisturbance(const std::string initialize_file_path, const ResidualMagneticMoment& rmm_params) {
   auto conf = IniAccess(initialize_file_path);
   const char* section = "MAGNETIC_DISTURBANCE";
+  GlobalRandomization::StreamScope stream_scope(section);
 
   const bool is_calc_enable = conf.ReadEnable(section, INI_CALC_LABEL);
   MagneticDisturbance mag_disturbance(rmm_params, is_calc_enable);
   mag_disturbance.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  mag_disturbance.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return mag_disturbance;
 }
+
+void MagneticDisturbance::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Disturbance::SaveSnapshot(snapshot);
+  snapshot.Write(rmm_b_Am2_);
+  random_walk_.SaveSnapshot(snapshot);
+  snapshot.Write(normal_random_);
+}
+
+void MagneticDisturbance::LoadSnapshot(SnapshotReader& snapshot) {
+  Disturbance::LoadSnapshot(snapshot);
+  snapshot.Read(rmm_b_Am2_);
+  random_walk_.LoadSnapshot(snapshot);
+  snapshot.Read(normal_random_);
+}
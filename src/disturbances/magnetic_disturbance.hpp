@@ -10,6 +10,8 @@
 
 #include "../logger/loggable.hpp"
 #include "../math_physics/math/vector.hpp"
+#include "../math_physics/randomization/normal_randomization.hpp"
+#include "../math_physics/randomization/random_walk.hpp"
 #include "../simulation/spacecraft/structure/residual_magnetic_moment.hpp"
 #include "disturbance.hpp"
 
@@ -34,6 +36,21 @@ class MagneticDisturbance : public Disturbance {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn GetInputDependency
+   * @brief Return the input dependency (the position, the attitude, and the magnetic field model time)
+   */
+  virtual unsigned int GetInputDependency() const { return kDisturbanceInputPosition_i | kDisturbanceInputAttitude | kDisturbanceInputTime; }
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Disturbance
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Disturbance
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
 
   // Override ILoggable
   /**
@@ -52,6 +69,8 @@ class MagneticDisturbance : public Disturbance {
 
   libra::Vector<3> rmm_b_Am2_;                              //!< True RMM of the spacecraft in the body frame [Am2]
   const ResidualMagneticMoment& residual_magnetic_moment_;  //!< RMM parameters
+  RandomWalk<3> random_walk_;                               //!< Random walk noise of RMM [Am2]
+  libra::NormalRand normal_random_;                         //!< White noise of RMM [Am2]
 
   /**
    * @fn CalcRMM
@@ -17,7 +17,7 @@ SolarRadiationPressureDisturbance::SolarRadiationPressureDisturbance(const std::
 void SolarRadiationPressureDisturbance::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
   UNUSED(dynamics);
 
-  libra::Vector<3> sun_position_from_sc_b_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_b_m("SUN");
+  libra::Vector<3> sun_position_from_sc_b_m = local_environment.GetState().sun_position_from_spacecraft_b_m;
   CalcTorqueForce(sun_position_from_sc_b_m, local_environment.GetSolarRadiationPressure().GetPressure_N_m2());
 }
 
@@ -25,11 +25,12 @@ void SolarRadiationPressureDisturbance::CalcCoefficients(const libra::Vector<3>&
   UNUSED(input_direction_b);
 
   for (size_t i = 0; i < surfaces_.size(); i++) {  // Calculate for each surface
-    double area = surfaces_[i].GetArea_m2();
-    double reflectivity = surfaces_[i].GetReflectivity();
-    double specularity = surfaces_[i].GetSpecularity();
+    double area = surface_arrays_.area_m2_[i];
+    double reflectivity = surface_arrays_.reflectivity_[i];
+    double specularity = surface_arrays_.specularity_[i];
+    double cos_theta = cos_theta_[i];
     normal_coefficients_[i] =
-        area * item * ((1.0 + reflectivity * specularity) * pow(cos_theta_[i], 2.0) + 2.0 / 3.0 * reflectivity * (1.0 - specularity) * cos_theta_[i]);
+        area * item * ((1.0 + reflectivity * specularity) * cos_theta * cos_theta + 2.0 / 3.0 * reflectivity * (1.0 - specularity) * cos_theta);
     tangential_coefficients_[i] = area * item * (1.0 - reflectivity * specularity) * cos_theta_[i] * sin_theta_[i];
   }
 }
@@ -62,6 +63,8 @@ SolarRadiationPressureDisturbance InitSolarRadiationPressureDisturbance(const st
 
   SolarRadiationPressureDisturbance srp_disturbance(surfaces, center_of_gravity_b_m, is_calc_enable);
   srp_disturbance.is_log_enabled_ = is_log_enable;
+  srp_disturbance.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
+  InitSelfShadowing(initialize_file_path, section, srp_disturbance);
 
   return srp_disturbance;
 }
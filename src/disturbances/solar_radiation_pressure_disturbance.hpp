@@ -35,6 +35,11 @@ class SolarRadiationPressureDisturbance : public SurfaceForce {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn GetInputDependency
+   * @brief Return the input dependency (the position, the attitude, and the sun position)
+   */
+  virtual unsigned int GetInputDependency() const { return kDisturbanceInputPosition_i | kDisturbanceInputAttitude | kDisturbanceInputTime; }
 
   // Override ILoggable
   /**
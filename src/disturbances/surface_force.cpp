@@ -5,6 +5,11 @@
 
 #include "surface_force.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <utilities/memory_usage.hpp>
+
 #include "../math_physics/math/vector.hpp"
 
 SurfaceForce::SurfaceForce(const std::vector<Surface>& surfaces, const libra::Vector<3>& center_of_gravity_b_m, const bool is_calculation_enabled)
@@ -17,38 +22,140 @@ SurfaceForce::SurfaceForce(const std::vector<Surface>& surfaces, const libra::Ve
   sin_theta_.assign(num, 0.0);
 }
 
+void SurfaceForce::EnableSelfShadowing(const double angle_step_deg, const size_t sample_num) {
+  visibility_table_ = SurfaceVisibilityTable(surfaces_, angle_step_deg, sample_num);
+  visible_fractions_.assign(surfaces_.size(), 1.0);
+}
+
+MemoryUsage SurfaceForce::GetMemoryUsage() const {
+  size_t bytes = sizeof(*this) - sizeof(visibility_table_) + visibility_table_.GetMemoryUsage_bytes();
+  const std::vector<double>* arrays[] = {&surface_arrays_.normal_x_b_,       &surface_arrays_.normal_y_b_,       &surface_arrays_.normal_z_b_,
+                                         &surface_arrays_.position_x_b_m_,   &surface_arrays_.position_y_b_m_,   &surface_arrays_.position_z_b_m_,
+                                         &surface_arrays_.moment_arm_x_b_m_, &surface_arrays_.moment_arm_y_b_m_, &surface_arrays_.moment_arm_z_b_m_,
+                                         &surface_arrays_.area_m2_,          &surface_arrays_.reflectivity_,     &surface_arrays_.specularity_,
+                                         &surface_arrays_.air_specularity_,  &normal_coefficients_,              &tangential_coefficients_,
+                                         &cos_theta_,                        &sin_theta_,                        &visible_fractions_};
+  for (const auto array : arrays) bytes += CalcHeapMemory_bytes(*array);
+  bytes += CalcHeapMemory_bytes(surface_revisions_);
+  return MemoryUsage(GetTypeName(typeid(*this)), bytes);
+}
+
 libra::Vector<3> SurfaceForce::CalcTorqueForce(libra::Vector<3>& input_direction_b, double item) {
+  UpdateSurfaceArrays();
   CalcTheta(input_direction_b);
   CalcCoefficients(input_direction_b, item);
+  if (visibility_table_.IsEnabled()) {
+    visibility_table_.CalcVisibleFraction(input_direction_b, visible_fractions_);
+    for (size_t i = 0; i < surfaces_.size(); i++) {
+      normal_coefficients_[i] *= visible_fractions_[i];
+      tangential_coefficients_[i] *= visible_fractions_[i];
+    }
+  }
 
-  libra::Vector<3> force_b_N(0.0);
-  libra::Vector<3> torque_b_Nm(0.0);
-  libra::Vector<3> input_b_normal = input_direction_b.CalcNormalizedVector();
+  const libra::Vector<3> input_b_normal = input_direction_b.CalcNormalizedVector();
+  const size_t num = surfaces_.size();
+  const SurfaceArrays& s = surface_arrays_;
 
-  for (size_t i = 0; i < surfaces_.size(); i++) {
-    if (cos_theta_[i] > 0.0) {  // if the surface faces to the disturbance source (sun or air)
-      // calc direction of in-plane force
-      libra::Vector<3> normal = surfaces_[i].GetNormal_b();
-      libra::Vector<3> ncu = OuterProduct(input_b_normal, normal);
-      libra::Vector<3> ncu_normalized = ncu.CalcNormalizedVector();
-      libra::Vector<3> in_plane_force_direction = OuterProduct(ncu_normalized, normal);
-      // calc force
-      libra::Vector<3> force_per_surface_b_N = -1.0 * normal_coefficients_[i] * normal + tangential_coefficients_[i] * in_plane_force_direction;
-      force_b_N += force_per_surface_b_N;
-      // calc torque
-      torque_b_Nm += OuterProduct(surfaces_[i].GetPosition_b_m() - center_of_gravity_b_m_, force_per_surface_b_N);
-    }
+  // Sums over the surfaces which face to the disturbance source (sun or air)
+  // sum(a_i * n_i)
+  double normal_force_x = 0.0, normal_force_y = 0.0, normal_force_z = 0.0;
+  // sum(a_i * (p_i x n_i))
+  double normal_torque_x = 0.0, normal_torque_y = 0.0, normal_torque_z = 0.0;
+  // sum(t_i) and sum(t_i * p_i)
+  double in_plane_sum = 0.0;
+  double in_plane_position_x = 0.0, in_plane_position_y = 0.0, in_plane_position_z = 0.0;
+  for (size_t i = 0; i < num; i++) {
+    const bool is_facing = cos_theta_[i] > 0.0;
+    // t_i: Coefficient of (n cos(theta) - u). The in-plane direction is not defined when the surface faces directly to the source.
+    const double t = (is_facing && sin_theta_[i] > 0.0) ? tangential_coefficients_[i] / sin_theta_[i] : 0.0;
+    // a_i: Coefficient of the normal vector
+    const double a = is_facing ? -normal_coefficients_[i] + t * cos_theta_[i] : 0.0;
+    normal_force_x += a * s.normal_x_b_[i];
+    normal_force_y += a * s.normal_y_b_[i];
+    normal_force_z += a * s.normal_z_b_[i];
+    normal_torque_x += a * s.moment_arm_x_b_m_[i];
+    normal_torque_y += a * s.moment_arm_y_b_m_[i];
+    normal_torque_z += a * s.moment_arm_z_b_m_[i];
+    in_plane_sum += t;
+    in_plane_position_x += t * s.position_x_b_m_[i];
+    in_plane_position_y += t * s.position_y_b_m_[i];
+    in_plane_position_z += t * s.position_z_b_m_[i];
   }
-  force_b_N_ = force_b_N;
-  torque_b_Nm_ = torque_b_Nm;
+
+  libra::Vector<3> normal_force_b_N;
+  normal_force_b_N[0] = normal_force_x;
+  normal_force_b_N[1] = normal_force_y;
+  normal_force_b_N[2] = normal_force_z;
+  libra::Vector<3> normal_torque_b_Nm;
+  normal_torque_b_Nm[0] = normal_torque_x;
+  normal_torque_b_Nm[1] = normal_torque_y;
+  normal_torque_b_Nm[2] = normal_torque_z;
+  libra::Vector<3> in_plane_moment_arm_b_m;
+  in_plane_moment_arm_b_m[0] = in_plane_position_x;
+  in_plane_moment_arm_b_m[1] = in_plane_position_y;
+  in_plane_moment_arm_b_m[2] = in_plane_position_z;
+  in_plane_moment_arm_b_m -= in_plane_sum * center_of_gravity_b_m_;
+
+  force_b_N_ = normal_force_b_N - in_plane_sum * input_b_normal;
+  torque_b_Nm_ =
+      normal_torque_b_Nm - OuterProduct(center_of_gravity_b_m_, normal_force_b_N) - OuterProduct(in_plane_moment_arm_b_m, input_b_normal);
   return torque_b_Nm_;
 }
 
 void SurfaceForce::CalcTheta(libra::Vector<3>& input_direction_b) {
-  libra::Vector<3> input_b_normal = input_direction_b.CalcNormalizedVector();
+  const libra::Vector<3> input_b_normal = input_direction_b.CalcNormalizedVector();
+  const double u_x = input_b_normal[0];
+  const double u_y = input_b_normal[1];
+  const double u_z = input_b_normal[2];
+  const SurfaceArrays& s = surface_arrays_;
 
   for (size_t i = 0; i < surfaces_.size(); i++) {
-    cos_theta_[i] = InnerProduct(surfaces_[i].GetNormal_b(), input_b_normal);
-    sin_theta_[i] = sqrt(1.0 - cos_theta_[i] * cos_theta_[i]);
+    cos_theta_[i] = s.normal_x_b_[i] * u_x + s.normal_y_b_[i] * u_y + s.normal_z_b_[i] * u_z;
+    sin_theta_[i] = sqrt(std::max(0.0, 1.0 - cos_theta_[i] * cos_theta_[i]));
+  }
+}
+
+void SurfaceForce::UpdateSurfaceArrays() {
+  const size_t num = surfaces_.size();
+  SurfaceArrays& s = surface_arrays_;
+  if (s.area_m2_.size() != num) {
+    for (auto list : {&s.normal_x_b_, &s.normal_y_b_, &s.normal_z_b_, &s.position_x_b_m_, &s.position_y_b_m_, &s.position_z_b_m_,
+                      &s.moment_arm_x_b_m_, &s.moment_arm_y_b_m_, &s.moment_arm_z_b_m_, &s.area_m2_, &s.reflectivity_, &s.specularity_,
+                      &s.air_specularity_}) {
+      list->assign(num, 0.0);
+    }
+    // Zero is not used as a revision, so all surfaces are copied
+    surface_revisions_.assign(num, 0);
   }
+
+  for (size_t i = 0; i < num; i++) {
+    if (surface_revisions_[i] == surfaces_[i].GetRevision()) continue;
+    surface_revisions_[i] = surfaces_[i].GetRevision();
+    const libra::Vector<3>& normal_b = surfaces_[i].GetNormal_b();
+    const libra::Vector<3>& position_b_m = surfaces_[i].GetPosition_b_m();
+    s.normal_x_b_[i] = normal_b[0];
+    s.normal_y_b_[i] = normal_b[1];
+    s.normal_z_b_[i] = normal_b[2];
+    s.position_x_b_m_[i] = position_b_m[0];
+    s.position_y_b_m_[i] = position_b_m[1];
+    s.position_z_b_m_[i] = position_b_m[2];
+    s.moment_arm_x_b_m_[i] = position_b_m[1] * normal_b[2] - position_b_m[2] * normal_b[1];
+    s.moment_arm_y_b_m_[i] = position_b_m[2] * normal_b[0] - position_b_m[0] * normal_b[2];
+    s.moment_arm_z_b_m_[i] = position_b_m[0] * normal_b[1] - position_b_m[1] * normal_b[0];
+    s.area_m2_[i] = surfaces_[i].GetArea_m2();
+    s.reflectivity_[i] = surfaces_[i].GetReflectivity();
+    s.specularity_[i] = surfaces_[i].GetSpecularity();
+    s.air_specularity_[i] = surfaces_[i].GetAirSpecularity();
+  }
+}
+
+void InitSelfShadowing(const std::string initialize_file_path, const char* section, SurfaceForce& surface_force) {
+  auto conf = IniAccess(initialize_file_path);
+  if (!conf.ReadEnable(section, "self_shadowing")) return;
+
+  double angle_step_deg = conf.ReadDouble(section, "self_shadowing_angle_step_deg");
+  if (angle_step_deg <= 0.0) angle_step_deg = 10.0;
+  int sample_num = conf.ReadInt(section, "self_shadowing_sample_num");
+  if (sample_num <= 0) sample_num = 16;
+  surface_force.EnableSelfShadowing(angle_step_deg, (size_t)sample_num);
 }
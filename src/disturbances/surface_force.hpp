@@ -8,11 +8,13 @@
 #ifndef S2E_DISTURBANCES_SURFACE_FORCE_HPP_
 #define S2E_DISTURBANCES_SURFACE_FORCE_HPP_
 
+#include <string>
 #include <vector>
 
 #include "../math_physics/math/quaternion.hpp"
 #include "../math_physics/math/vector.hpp"
 #include "../simulation/spacecraft/structure/surface.hpp"
+#include "../simulation/spacecraft/structure/surface_visibility_table.hpp"
 #include "disturbance.hpp"
 
 /**
@@ -35,21 +37,65 @@ class SurfaceForce : public Disturbance {
    */
   virtual ~SurfaceForce() {}
 
+  /**
+   * @fn EnableSelfShadowing
+   * @brief Calculate the visible fraction table of the surfaces and apply it to the force of each surface
+   * @note The table is calculated with the current surfaces. Call it again when the geometry of the surfaces is changed.
+   * @param [in] angle_step_deg: Step of the azimuth and elevation grid of the incident direction [deg]
+   * @param [in] sample_num: Number of sample points on each surface for the ray casting
+   */
+  void EnableSelfShadowing(const double angle_step_deg, const size_t sample_num);
+
+  /**
+   * @fn GetMemoryUsage
+   * @brief Override GetMemoryUsage function of Disturbance with the surface arrays and the visibility table
+   */
+  MemoryUsage GetMemoryUsage() const override;
+
  protected:
   // Spacecraft Structure parameters
   const std::vector<Surface>& surfaces_;           //!< List of surfaces
   const libra::Vector<3>& center_of_gravity_b_m_;  //!< Position vector of the center of mass_kg at body frame [m]
 
+  /**
+   * @struct SurfaceArrays
+   * @brief Surface parameters stored as structure of arrays for the calculation over all surfaces
+   */
+  struct SurfaceArrays {
+    std::vector<double> normal_x_b_;        //!< X component of normal vector in the body frame
+    std::vector<double> normal_y_b_;        //!< Y component of normal vector in the body frame
+    std::vector<double> normal_z_b_;        //!< Z component of normal vector in the body frame
+    std::vector<double> position_x_b_m_;    //!< X component of position in the body frame [m]
+    std::vector<double> position_y_b_m_;    //!< Y component of position in the body frame [m]
+    std::vector<double> position_z_b_m_;    //!< Z component of position in the body frame [m]
+    std::vector<double> moment_arm_x_b_m_;  //!< X component of position x normal vector in the body frame [m]
+    std::vector<double> moment_arm_y_b_m_;  //!< Y component of position x normal vector in the body frame [m]
+    std::vector<double> moment_arm_z_b_m_;  //!< Z component of position x normal vector in the body frame [m]
+    std::vector<double> area_m2_;           //!< Area [m2]
+    std::vector<double> reflectivity_;      //!< Total reflectivity for solar wavelength
+    std::vector<double> specularity_;       //!< Ratio of specular reflection in the total reflected light
+    std::vector<double> air_specularity_;   //!< Specularity for air drag
+  };
+  SurfaceArrays surface_arrays_;                       //!< Surface parameters copied from surfaces_
+  std::vector<unsigned long long> surface_revisions_;  //!< Revisions of the surfaces copied in surface_arrays_
+
   // Internal calculated variables
   std::vector<double> normal_coefficients_;      //!< coefficients for out-plane force for each surface
   std::vector<double> tangential_coefficients_;  //!< coefficients for in-plane force for each surface
-  std::vector<double> cos_theta_;  //!< cos(theta) for each surface (theta is the angle b/w normal vector and the direction of disturbance source)
-  std::vector<double> sin_theta_;  //!< sin(theta) for each surface (theta is the angle b/w normal vector and the direction of disturbance source)
+  std::vector<double> cos_theta_;                //!< cos(theta) for each surface (theta is the angle b/w normal vector and the disturbance source)
+  std::vector<double> sin_theta_;                //!< sin(theta) for each surface (theta is the angle b/w normal vector and the disturbance source)
+
+  // Self shadowing
+  SurfaceVisibilityTable visibility_table_;  //!< Visible fraction table for self shadowing. Disabled when empty.
+  std::vector<double> visible_fractions_;    //!< Visible fraction of each surface
 
   // Functions
   /**
    * @fn CalcTorqueForce
    * @brief Calculate the torque and force
+   * @details The in-plane force direction of each surface is (n cos(theta) - u) / sin(theta), where n is the normal vector and u is the
+   *          direction of the disturbance source (both unit vectors). So the force and torque are accumulated as sums of the surface arrays
+   *          without temporary vectors for each surface, and the center of gravity is applied to the sums.
    * @param [in] input_direction_b: Direction of disturbance source at the body frame
    * @param [in] item: Parameter which decide the magnitude of the disturbances (e.g., Solar flux, air density)
    * @return Calculated disturbance torque in body frame [Nm]
@@ -61,6 +107,12 @@ class SurfaceForce : public Disturbance {
    * @param [in] input_direction_b: Direction of disturbance source at the body frame
    */
   void CalcTheta(libra::Vector<3>& input_direction_b);
+  /**
+   * @fn UpdateSurfaceArrays
+   * @brief Copy the parameters of the surfaces changed since the last call into the surface arrays in place
+   * @note The surfaces can be changed during the simulation, and only the surfaces with the new revision are copied.
+   */
+  void UpdateSurfaceArrays();
 
   /**
    * @fn CalcCoefficients
@@ -71,4 +123,13 @@ class SurfaceForce : public Disturbance {
   virtual void CalcCoefficients(const libra::Vector<3>& input_direction_b, const double item) = 0;
 };
 
+/**
+ * @fn InitSelfShadowing
+ * @brief Read the self shadowing settings and enable it for the surface force
+ * @param [in] initialize_file_path: Initialize file path
+ * @param [in] section: Section name of the disturbance
+ * @param [out] surface_force: Surface force
+ */
+void InitSelfShadowing(const std::string initialize_file_path, const char* section, SurfaceForce& surface_force);
+
 #endif  // S2E_DISTURBANCES_SURFACE_FORCE_HPP_
@@ -0,0 +1,224 @@
+/**
+ * @file test_composed_force_model.cpp
+ * @brief Test codes for ComposedForceModel and its terms with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "composed_force_model.hpp"
+
+namespace {
+const std::string kTestIniFile = "test_composed_force_model.ini";
+const double kRadius_m = 6878.0e3;
+
+/**
+ * @fn WriteTestIniFile
+ * @brief Write the parameters of the terms
+ */
+void WriteTestIniFile() {
+  std::ofstream file(kTestIniFile);
+  file << "[COMPOSED_FORCE_MODEL]\n";
+  file << "ballistic_coefficient_m2_kg = 0.022\n";
+  file << "radiation_coefficient_m2_kg = 0.01\n";
+  file << "number_of_third_body = 0\n";
+  file << "empirical_acceleration_rtn_m_s2(0) = 1.0e-7\n";
+  file << "empirical_acceleration_rtn_m_s2(1) = -2.0e-7\n";
+  file << "empirical_acceleration_rtn_m_s2(2) = 3.0e-7\n";
+}
+
+/**
+ * @fn MakePosition_i_m
+ * @brief Make the position on the inclined circular orbit
+ */
+libra::Vector<3> MakePosition_i_m() {
+  libra::Vector<3> position_i_m;
+  position_i_m[0] = kRadius_m * cos(0.3);
+  position_i_m[1] = kRadius_m * sin(0.3) * cos(0.9);
+  position_i_m[2] = kRadius_m * sin(0.3) * sin(0.9);
+  return position_i_m;
+}
+
+/**
+ * @fn MakeVelocity_i_m_s
+ * @brief Make the velocity on the inclined circular orbit
+ */
+libra::Vector<3> MakeVelocity_i_m_s() {
+  const double speed_m_s = sqrt(environment::earth_gravitational_constant_m3_s2 / kRadius_m);
+  libra::Vector<3> velocity_i_m_s;
+  velocity_i_m_s[0] = -speed_m_s * sin(0.3);
+  velocity_i_m_s[1] = speed_m_s * cos(0.3) * cos(0.9);
+  velocity_i_m_s[2] = speed_m_s * cos(0.3) * sin(0.9);
+  return velocity_i_m_s;
+}
+}  // namespace
+
+/**
+ * @brief Test for the J2 term against GravityPotential used by the Geopotential disturbance
+ */
+TEST(ComposedForceModel, J2) {
+  force_model_term::J2 j2("");
+  // The rotation axis of the Earth is tilted from the z-axis of the inertial frame
+  const double tilt_rad = 0.2;
+  libra::Matrix<3, 3> dcm_i_to_ecef = libra::MakeIdentityMatrix<3>();
+  dcm_i_to_ecef[1][1] = cos(tilt_rad);
+  dcm_i_to_ecef[1][2] = sin(tilt_rad);
+  dcm_i_to_ecef[2][1] = -sin(tilt_rad);
+  dcm_i_to_ecef[2][2] = cos(tilt_rad);
+  libra::Vector<3> pole_i;
+  for (size_t i = 0; i < 3; i++) pole_i[i] = dcm_i_to_ecef[2][i];
+  j2.SetPole_i(pole_i);
+
+  // The normalized C20 of the J2
+  std::vector<std::vector<double>> c(3, std::vector<double>(3, 0.0)), s(3, std::vector<double>(3, 0.0));
+  c[2][0] = -environment::earth_j2 / sqrt(5.0);
+  GravityPotential gravity_potential(2, c, s, environment::earth_gravitational_constant_m3_s2, environment::earth_equatorial_radius_m);
+
+  const libra::Vector<3> position_i_m = MakePosition_i_m();
+  const libra::Vector<3> expected_i_m_s2 = dcm_i_to_ecef.Transpose() * gravity_potential.CalcAcceleration_xcxf_m_s2(dcm_i_to_ecef * position_i_m);
+  const libra::Vector<3> acceleration_i_m_s2 = j2.CalcAcceleration_i_m_s2(position_i_m, MakeVelocity_i_m_s());
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected_i_m_s2[i], acceleration_i_m_s2[i], 1.0e-12);
+  }
+  EXPECT_GT(acceleration_i_m_s2.CalcNorm(), 1.0e-3);
+}
+
+/**
+ * @brief Test for the drag term against the cannonball model with the atmosphere rotating with the Earth
+ */
+TEST(ComposedForceModel, Drag) {
+  WriteTestIniFile();
+  force_model_term::Drag drag(kTestIniFile);
+  std::remove(kTestIniFile.c_str());
+  const double air_density_kg_m3 = 3.0e-12;
+  libra::Vector<3> earth_angular_velocity_i_rad_s(0.0);
+  earth_angular_velocity_i_rad_s[2] = environment::earth_mean_angular_velocity_rad_s;
+  drag.SetEnvironment(air_density_kg_m3, earth_angular_velocity_i_rad_s);
+
+  const libra::Vector<3> position_i_m = MakePosition_i_m();
+  const libra::Vector<3> velocity_i_m_s = MakeVelocity_i_m_s();
+  const libra::Vector<3> relative_velocity_i_m_s = velocity_i_m_s - OuterProduct(earth_angular_velocity_i_rad_s, position_i_m);
+  // a = - 1/2 rho Cd A / m |v_rel| v_rel
+  const double relative_speed_m_s = relative_velocity_i_m_s.CalcNorm();
+  const libra::Vector<3> acceleration_i_m_s2 = drag.CalcAcceleration_i_m_s2(position_i_m, velocity_i_m_s);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(-0.5 * air_density_kg_m3 * 0.022 * relative_speed_m_s * relative_velocity_i_m_s[i], acceleration_i_m_s2[i], 1.0e-20);
+  }
+  // The relative speed is slower than the inertial speed for the prograde orbit
+  EXPECT_LT(relative_speed_m_s, velocity_i_m_s.CalcNorm());
+}
+
+/**
+ * @brief Test for the solar radiation pressure term against the absorbing plate facing the sun
+ */
+TEST(ComposedForceModel, SolarRadiationPressure) {
+  WriteTestIniFile();
+  force_model_term::SolarRadiationPressure solar_radiation_pressure(kTestIniFile);
+  std::remove(kTestIniFile.c_str());
+  libra::Vector<3> sun_position_i_m(0.0);
+  sun_position_i_m[0] = 1.0e11;
+  sun_position_i_m[1] = 1.0e11;
+  const double pressure_N_m2 = 4.56e-6;
+  solar_radiation_pressure.SetEnvironment(pressure_N_m2, sun_position_i_m);
+
+  // The force of the absorbing plate is the pressure times the area in the direction from the sun
+  const libra::Vector<3> position_i_m = MakePosition_i_m();
+  const libra::Vector<3> sun_direction_i = (sun_position_i_m - position_i_m).CalcNormalizedVector();
+  const libra::Vector<3> acceleration_i_m_s2 = solar_radiation_pressure.CalcAcceleration_i_m_s2(position_i_m, MakeVelocity_i_m_s());
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(-pressure_N_m2 * 0.01 * sun_direction_i[i], acceleration_i_m_s2[i], 1.0e-20);
+  }
+
+  // No acceleration in the shadow
+  solar_radiation_pressure.SetEnvironment(0.0, sun_position_i_m);
+  EXPECT_DOUBLE_EQ(0.0, solar_radiation_pressure.CalcAcceleration_i_m_s2(position_i_m, MakeVelocity_i_m_s()).CalcNorm());
+}
+
+/**
+ * @brief Test for the third body term against ThirdBodyGravity
+ */
+TEST(ComposedForceModel, ThirdBody) {
+  WriteTestIniFile();
+  force_model_term::ThirdBody third_body(kTestIniFile);
+  std::remove(kTestIniFile.c_str());
+  std::vector<libra::Vector<3>> body_position_list_i_m(2, libra::Vector<3>(0.0));
+  body_position_list_i_m[0][0] = 3.8e8;  // Moon
+  body_position_list_i_m[1][1] = 1.5e11;  // Sun
+  const std::vector<double> gravity_constant_list_m3_s2 = {4.9028e12, 1.32712440018e20};
+  third_body.SetBodies(body_position_list_i_m, gravity_constant_list_m3_s2);
+
+  const libra::Vector<3> position_i_m = MakePosition_i_m();
+  libra::Vector<3> expected_i_m_s2(0.0);
+  for (size_t i = 0; i < 2; i++) {
+    expected_i_m_s2 +=
+        ThirdBodyGravity::CalcPointMassAcceleration_i_m_s2(position_i_m, body_position_list_i_m[i], gravity_constant_list_m3_s2[i]);
+  }
+  const libra::Vector<3> acceleration_i_m_s2 = third_body.CalcAcceleration_i_m_s2(position_i_m, MakeVelocity_i_m_s());
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(expected_i_m_s2[i], acceleration_i_m_s2[i]);
+  }
+
+  // Tidal acceleration of the moon: GM [(rb - r) / |rb - r|^3 - rb / |rb|^3]
+  third_body.SetBodies({body_position_list_i_m[0]}, {gravity_constant_list_m3_s2[0]});
+  const libra::Vector<3> relative_position_i_m = body_position_list_i_m[0] - position_i_m;
+  const double body_distance_m = body_position_list_i_m[0].CalcNorm();
+  const libra::Vector<3> moon_expected_i_m_s2 =
+      gravity_constant_list_m3_s2[0] * ((1.0 / pow(relative_position_i_m.CalcNorm(), 3.0)) * relative_position_i_m -
+                                        (1.0 / pow(body_distance_m, 3.0)) * body_position_list_i_m[0]);
+  const libra::Vector<3> moon_acceleration_i_m_s2 = third_body.CalcAcceleration_i_m_s2(position_i_m, MakeVelocity_i_m_s());
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(moon_expected_i_m_s2[i], moon_acceleration_i_m_s2[i], 1.0e-15);
+  }
+}
+
+/**
+ * @brief Test for the relativity term on the circular orbit
+ */
+TEST(ComposedForceModel, Relativity) {
+  force_model_term::Relativity relativity("");
+  const double gravity_constant_m3_s2 = environment::earth_gravitational_constant_m3_s2;
+  relativity.SetGravityConstant_m3_s2(gravity_constant_m3_s2);
+
+  // The Schwarzschild term is 3 (GM)^2 / (c^2 r^3) in the radial direction for the circular orbit (r.v = 0, v^2 = GM / r)
+  const libra::Vector<3> position_i_m = MakePosition_i_m();
+  const double c2_m2_s2 = environment::speed_of_light_m_s * environment::speed_of_light_m_s;
+  const double expected_m_s2 = 3.0 * gravity_constant_m3_s2 * gravity_constant_m3_s2 / (c2_m2_s2 * pow(kRadius_m, 3.0));
+  const libra::Vector<3> acceleration_i_m_s2 = relativity.CalcAcceleration_i_m_s2(position_i_m, MakeVelocity_i_m_s());
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected_m_s2 * position_i_m[i] / kRadius_m, acceleration_i_m_s2[i], 1.0e-22);
+  }
+}
+
+/**
+ * @brief Test for the empirical term and the sum of the composed terms
+ */
+TEST(ComposedForceModel, EmpiricalAndComposition) {
+  WriteTestIniFile();
+  force_model_term::Empirical empirical(kTestIniFile);
+  ComposedForceModel<force_model_term::Empirical, force_model_term::Relativity, force_model_term::Empirical> composed_force_model(kTestIniFile);
+  std::remove(kTestIniFile.c_str());
+
+  // The RTN frame of the circular orbit: radial, along the velocity, and along the orbit normal
+  const libra::Vector<3> position_i_m = MakePosition_i_m();
+  const libra::Vector<3> velocity_i_m_s = MakeVelocity_i_m_s();
+  const libra::Vector<3> radial_i = position_i_m.CalcNormalizedVector();
+  const libra::Vector<3> transverse_i = velocity_i_m_s.CalcNormalizedVector();
+  const libra::Vector<3> normal_i = OuterProduct(radial_i, transverse_i);
+  const libra::Vector<3> expected_i_m_s2 = 1.0e-7 * radial_i - 2.0e-7 * transverse_i + 3.0e-7 * normal_i;
+  const libra::Vector<3> acceleration_i_m_s2 = empirical.CalcAcceleration_i_m_s2(position_i_m, velocity_i_m_s);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected_i_m_s2[i], acceleration_i_m_s2[i], 1.0e-20);
+  }
+
+  // The relativity term without the update has no acceleration, and the stage acceleration is the difference from the step start
+  const libra::Vector<3> composed_acceleration_i_m_s2 = composed_force_model.CalcAcceleration_i_m_s2(position_i_m, velocity_i_m_s);
+  const libra::Vector<3> stage_acceleration_i_m_s2 = composed_force_model.CalcStageAcceleration_i_m_s2(0.0, position_i_m, velocity_i_m_s);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(2.0 * acceleration_i_m_s2[i], composed_acceleration_i_m_s2[i]);
+    EXPECT_DOUBLE_EQ(composed_acceleration_i_m_s2[i] - composed_force_model.GetAcceleration_i_m_s2()[i], stage_acceleration_i_m_s2[i]);
+  }
+}
@@ -0,0 +1,145 @@
+/**
+ * @file test_disturbance.cpp
+ * @brief Test codes for the update schedule of Disturbance class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "disturbance.hpp"
+#include "gravity_gradient.hpp"
+
+namespace {
+/**
+ * @class DisturbanceForTest
+ * @brief Disturbance whose torque and acceleration are set by the test
+ */
+class DisturbanceForTest : public Disturbance {
+ public:
+  explicit DisturbanceForTest(const unsigned int input_dependency) : input_dependency_(input_dependency) {}
+
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) override {
+    (void)local_environment;
+    (void)dynamics;
+  }
+  unsigned int GetInputDependency() const override { return input_dependency_; }
+  std::string GetLogHeader() const override { return ""; }
+  std::string GetLogValue() const override { return ""; }
+
+  /**
+   * @fn Calculate
+   * @brief Set the outputs as the calculation and count the calculations
+   * @param [in] value: Value of the outputs
+   */
+  void Calculate(const double value) {
+    torque_b_Nm_ = libra::Vector<3>(value);
+    acceleration_i_m_s2_ = libra::Vector<3>(-value);
+    number_of_calculations++;
+  }
+
+  size_t number_of_calculations = 0;  //!< Number of the calls of Calculate
+
+ private:
+  const unsigned int input_dependency_;  //!< Declared inputs
+};
+}  // namespace
+
+/**
+ * @brief Test for the output held between the calculations with the update interval
+ */
+TEST(Disturbance, ZeroOrderHold) {
+  DisturbanceForTest disturbance(kDisturbanceInputTime);
+  disturbance.SetUpdateSchedule(1.0, DisturbanceHoldMode::kZeroOrderHold);
+  DisturbanceInputs inputs;
+  for (size_t step = 0; step <= 10; step++) {
+    inputs.elapsed_time_s = step * 0.25;
+    disturbance.UpdateWithSchedule(inputs, [&]() { disturbance.Calculate(inputs.elapsed_time_s); });
+    // The calculation at every 1 s is held until the next calculation
+    const double expected_value = (double)(step / 4);
+    EXPECT_DOUBLE_EQ(expected_value, disturbance.GetTorque_b_Nm()[0]) << "step " << step;
+    EXPECT_DOUBLE_EQ(-expected_value, disturbance.GetAcceleration_i_m_s2()[2]) << "step " << step;
+  }
+  EXPECT_EQ(3u, disturbance.number_of_calculations);
+}
+
+/**
+ * @brief Test for the output extrapolated linearly with the latest two calculations
+ */
+TEST(Disturbance, LinearExtrapolation) {
+  DisturbanceForTest disturbance(kDisturbanceInputTime);
+  disturbance.SetUpdateSchedule(1.0, DisturbanceHoldMode::kLinearExtrapolation);
+  DisturbanceInputs inputs;
+  for (size_t step = 0; step <= 10; step++) {
+    inputs.elapsed_time_s = step * 0.25;
+    disturbance.UpdateWithSchedule(inputs, [&]() { disturbance.Calculate(2.0 * inputs.elapsed_time_s + 1.0); });
+    // The output is held until the second calculation, and the linear output is reproduced after it
+    const double expected_value = step < 4 ? 1.0 : 2.0 * inputs.elapsed_time_s + 1.0;
+    EXPECT_NEAR(expected_value, disturbance.GetTorque_b_Nm()[1], 1e-12) << "step " << step;
+  }
+  EXPECT_EQ(3u, disturbance.number_of_calculations);
+
+  // The held output is used to skip the calculation
+  disturbance.HoldOutputs();
+  EXPECT_DOUBLE_EQ(5.0, disturbance.GetTorque_b_Nm()[1]);
+}
+
+/**
+ * @brief Test for the calculation skipped only when all declared inputs are unchanged
+ */
+TEST(Disturbance, InputDependency) {
+  DisturbanceForTest disturbance(kDisturbanceInputPosition_i | kDisturbanceInputAttitude);
+  DisturbanceInputs inputs;
+  inputs.position_i_m[0] = 7.0e6;
+  inputs.quaternion_i2b = libra::Quaternion(0.0, 0.0, 0.0, 1.0);
+  double value = 1.0;
+  auto update = [&]() { disturbance.UpdateWithSchedule(inputs, [&]() { disturbance.Calculate(value); }); };
+  update();
+  EXPECT_EQ(1u, disturbance.number_of_calculations);
+
+  // The undeclared inputs do not invalidate the latest calculation
+  value = 2.0;
+  inputs.elapsed_time_s = 1.0;
+  inputs.velocity_i_m_s[1] = 7.5e3;
+  inputs.position_ecef_m[2] = 1.0;
+  inputs.inertia_tensor_b_kgm2[0][0] = 1.0;
+  update();
+  EXPECT_EQ(1u, disturbance.number_of_calculations);
+  EXPECT_DOUBLE_EQ(1.0, disturbance.GetTorque_b_Nm()[2]);
+
+  // Each declared input invalidates it
+  inputs.position_i_m[2] = 1.0;
+  update();
+  EXPECT_EQ(2u, disturbance.number_of_calculations);
+  EXPECT_DOUBLE_EQ(2.0, disturbance.GetTorque_b_Nm()[2]);
+  inputs.quaternion_i2b = libra::Quaternion(0.0, 0.0, 1.0, 0.0);
+  update();
+  EXPECT_EQ(3u, disturbance.number_of_calculations);
+  update();
+  EXPECT_EQ(3u, disturbance.number_of_calculations);
+}
+
+/**
+ * @brief Test for the inertia tensor declared as the input of the gravity gradient torque
+ */
+TEST(Disturbance, GravityGradientInertia) {
+  GravityGradient gravity_gradient;
+  EXPECT_TRUE(gravity_gradient.GetInputDependency() & kDisturbanceInputInertia);
+  EXPECT_FALSE(gravity_gradient.GetInputDependency() & kDisturbanceInputTime);
+
+  DisturbanceInputs inputs;
+  inputs.position_i_m[0] = 7.0e6;
+  inputs.quaternion_i2b = libra::Quaternion(0.0, 0.0, 0.0, 1.0);
+  inputs.inertia_tensor_b_kgm2 = libra::MakeIdentityMatrix<3>();
+  size_t number_of_calculations = 0;
+  auto update = [&]() { gravity_gradient.UpdateWithSchedule(inputs, [&]() { number_of_calculations++; }); };
+  update();
+  inputs.elapsed_time_s = 1.0;
+  update();
+  EXPECT_EQ(1u, number_of_calculations);
+
+  // The changed inertia tensor (e.g., the deployment of the appendages) invalidates the latest calculation
+  inputs.inertia_tensor_b_kgm2[1][2] = 0.1;
+  inputs.inertia_tensor_b_kgm2[2][1] = 0.1;
+  update();
+  EXPECT_EQ(2u, number_of_calculations);
+}
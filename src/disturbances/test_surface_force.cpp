@@ -0,0 +1,74 @@
+/**
+ * @file test_surface_force.cpp
+ * @brief Test codes for SurfaceForce class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "surface_force.hpp"
+
+namespace {
+/**
+ * @class SurfaceForceForTest
+ * @brief Surface force whose normal coefficient is the area multiplied by the item
+ */
+class SurfaceForceForTest : public SurfaceForce {
+ public:
+  SurfaceForceForTest(const std::vector<Surface>& surfaces, const libra::Vector<3>& center_of_gravity_b_m)
+      : SurfaceForce(surfaces, center_of_gravity_b_m) {}
+
+  libra::Vector<3> CalcForce_b_N(libra::Vector<3> input_direction_b) {
+    CalcTorqueForce(input_direction_b, 1.0);
+    return force_b_N_;
+  }
+
+  void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) override {
+    (void)local_environment;
+    (void)dynamics;
+  }
+  std::string GetLogHeader() const override { return ""; }
+  std::string GetLogValue() const override { return ""; }
+
+ private:
+  void CalcCoefficients(const libra::Vector<3>& input_direction_b, const double item) override {
+    (void)input_direction_b;
+    for (size_t i = 0; i < surfaces_.size(); i++) {
+      normal_coefficients_[i] = surface_arrays_.area_m2_[i] * item;
+      tangential_coefficients_[i] = 0.0;
+    }
+  }
+};
+}  // namespace
+
+/**
+ * @brief Test for the surface arrays following the surfaces changed during the simulation
+ */
+TEST(SurfaceForce, ChangedSurfaces) {
+  libra::Vector<3> position_b_m(0.0), normal_b(0.0);
+  normal_b[0] = 1.0;
+  std::vector<Surface> surfaces;
+  surfaces.push_back(Surface(position_b_m, normal_b, 2.0, 0.5, 0.5, 0.5));
+  normal_b[0] = -1.0;
+  surfaces.push_back(Surface(position_b_m, normal_b, 3.0, 0.5, 0.5, 0.5));
+  const libra::Vector<3> center_of_gravity_b_m(0.0);
+  SurfaceForceForTest surface_force(surfaces, center_of_gravity_b_m);
+
+  libra::Vector<3> input_direction_b(0.0);
+  input_direction_b[0] = 1.0;
+  EXPECT_DOUBLE_EQ(-2.0, surface_force.CalcForce_b_N(input_direction_b)[0]);
+  EXPECT_DOUBLE_EQ(-2.0, surface_force.CalcForce_b_N(input_direction_b)[0]);
+
+  // The changed surface is copied
+  surfaces[0].SetArea_m2(4.0);
+  EXPECT_DOUBLE_EQ(-4.0, surface_force.CalcForce_b_N(input_direction_b)[0]);
+  normal_b[0] = 1.0;
+  surfaces[1].SetNormal_b(normal_b);
+  EXPECT_DOUBLE_EQ(-7.0, surface_force.CalcForce_b_N(input_direction_b)[0]);
+
+  // The surface replaced by a new surface with the same index is copied
+  normal_b[0] = -1.0;
+  surfaces[0] = Surface(position_b_m, normal_b, 1.0, 0.5, 0.5, 0.5);
+  EXPECT_DOUBLE_EQ(-3.0, surface_force.CalcForce_b_N(input_direction_b)[0]);
+}
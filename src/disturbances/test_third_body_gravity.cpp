@@ -0,0 +1,109 @@
+/**
+ * @file test_third_body_gravity.cpp
+ * @brief Test codes for ThirdBodyGravity class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "third_body_gravity.hpp"
+
+namespace {
+const double kMoonGravityConstant_m3_s2 = 4.9028e12;
+const double kSunGravityConstant_m3_s2 = 1.32712440018e20;
+
+/**
+ * @fn CalcDirectAcceleration_i_m_s2
+ * @brief Calculate the third body disturbance acceleration as the difference between the direct term and the indirect term
+ */
+libra::Vector<3> CalcDirectAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& body_position_i_m,
+                                               const double gravity_constant_m3_s2) {
+  const libra::Vector<3> body_position_from_spacecraft_i_m = body_position_i_m - position_i_m;
+  const double distance_m = body_position_from_spacecraft_i_m.CalcNorm();
+  const double body_distance_m = body_position_i_m.CalcNorm();
+  return gravity_constant_m3_s2 *
+         ((1.0 / pow(distance_m, 3.0)) * body_position_from_spacecraft_i_m - (1.0 / pow(body_distance_m, 3.0)) * body_position_i_m);
+}
+
+/**
+ * @fn MakeVector
+ * @brief Make a vector from the components
+ */
+libra::Vector<3> MakeVector(const double x, const double y, const double z) {
+  libra::Vector<3> vector;
+  vector[0] = x;
+  vector[1] = y;
+  vector[2] = z;
+  return vector;
+}
+}  // namespace
+
+/**
+ * @brief Test for Battin's formulation against the difference of the direct term and the indirect term
+ */
+TEST(ThirdBodyGravity, PointMassAcceleration) {
+  const libra::Vector<3> position_i_m = MakeVector(4000.0e3, -5000.0e3, 2000.0e3);
+  const libra::Vector<3> moon_position_i_m = MakeVector(-2.0e8, 3.0e8, 1.0e8);
+  const libra::Vector<3> sun_position_i_m = MakeVector(1.0e11, -1.1e11, -0.4e11);
+
+  // The cancellation is small enough for the direct difference at the spacecraft orbit
+  const std::vector<std::pair<libra::Vector<3>, double>> bodies = {{moon_position_i_m, kMoonGravityConstant_m3_s2},
+                                                                    {sun_position_i_m, kSunGravityConstant_m3_s2}};
+  for (const auto& body : bodies) {
+    const libra::Vector<3> expected_i_m_s2 = CalcDirectAcceleration_i_m_s2(position_i_m, body.first, body.second);
+    const libra::Vector<3> acceleration_i_m_s2 = ThirdBodyGravity::CalcPointMassAcceleration_i_m_s2(position_i_m, body.first, body.second);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(expected_i_m_s2[i], acceleration_i_m_s2[i], 1.0e-8 * expected_i_m_s2.CalcNorm());
+    }
+  }
+
+  // Near the center body, the acceleration approaches the tidal term GM / |s|^3 (3 s_hat (s_hat . r) - r) while the direct difference cancels
+  const libra::Vector<3> near_position_i_m = MakeVector(1.0, -2.0, 0.5);
+  const double sun_distance_m = sun_position_i_m.CalcNorm();
+  const libra::Vector<3> sun_direction_i = (1.0 / sun_distance_m) * sun_position_i_m;
+  const libra::Vector<3> tidal_i_m_s2 = (kSunGravityConstant_m3_s2 / pow(sun_distance_m, 3.0)) *
+                                        (3.0 * InnerProduct(sun_direction_i, near_position_i_m) * sun_direction_i - near_position_i_m);
+  const libra::Vector<3> acceleration_i_m_s2 =
+      ThirdBodyGravity::CalcPointMassAcceleration_i_m_s2(near_position_i_m, sun_position_i_m, kSunGravityConstant_m3_s2);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(tidal_i_m_s2[i], acceleration_i_m_s2[i], 1.0e-8 * tidal_i_m_s2.CalcNorm());
+  }
+
+  // The acceleration is zero at the center body
+  const libra::Vector<3> center_acceleration_i_m_s2 =
+      ThirdBodyGravity::CalcPointMassAcceleration_i_m_s2(libra::Vector<3>(0.0), sun_position_i_m, kSunGravityConstant_m3_s2);
+  EXPECT_DOUBLE_EQ(0.0, center_acceleration_i_m_s2.CalcNorm());
+}
+
+/**
+ * @brief Test for the total acceleration, which is logged, as the sum over all bodies
+ */
+TEST(ThirdBodyGravity, TotalAcceleration) {
+  const libra::Vector<3> position_i_m = MakeVector(4000.0e3, -5000.0e3, 2000.0e3);
+  const std::vector<double> body_positions_i_m = {-2.0e8, 3.0e8, 1.0e8, 1.0e11, -1.1e11, -0.4e11};
+  const std::vector<double> body_velocities_i_m_s = {-800.0, -500.0, 100.0, 2.0e4, 1.8e4, 0.8e4};
+  const std::vector<double> gravity_constants_m3_s2 = {kMoonGravityConstant_m3_s2, kSunGravityConstant_m3_s2};
+  const double time_from_update_s = 30.0;
+
+  libra::Vector<3> expected_i_m_s2(0.0);
+  for (size_t body = 0; body < 2; body++) {
+    libra::Vector<3> body_position_i_m;
+    for (size_t i = 0; i < 3; i++) {
+      body_position_i_m[i] = body_positions_i_m[body * 3 + i] + body_velocities_i_m_s[body * 3 + i] * time_from_update_s;
+    }
+    expected_i_m_s2 += ThirdBodyGravity::CalcPointMassAcceleration_i_m_s2(position_i_m, body_position_i_m, gravity_constants_m3_s2[body]);
+  }
+  const libra::Vector<3> acceleration_i_m_s2 = ThirdBodyGravity::CalcTotalPointMassAcceleration_i_m_s2(
+      body_positions_i_m, body_velocities_i_m_s, gravity_constants_m3_s2, time_from_update_s, position_i_m);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(expected_i_m_s2[i], acceleration_i_m_s2[i]);
+  }
+
+  // The sum is not dominated by the last body only
+  const libra::Vector<3> sun_only_i_m_s2 = ThirdBodyGravity::CalcTotalPointMassAcceleration_i_m_s2(
+      {body_positions_i_m.begin() + 3, body_positions_i_m.end()}, {body_velocities_i_m_s.begin() + 3, body_velocities_i_m_s.end()},
+      {kSunGravityConstant_m3_s2}, time_from_update_s, position_i_m);
+  EXPECT_GT((acceleration_i_m_s2 - sun_only_i_m_s2).CalcNorm(), 0.5 * sun_only_i_m_s2.CalcNorm());
+}
@@ -15,30 +15,47 @@ ThirdBodyGravity::ThirdBodyGravity(std::set<std::string> third_body_list, const
 ThirdBodyGravity::~ThirdBodyGravity() {}
 
 void ThirdBodyGravity::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
-  acceleration_i_m_s2_ = libra::Vector<3>(0.0);  // initialize
-
-  libra::Vector<3> sc_position_i_m = dynamics.GetOrbit().GetPosition_i_m();
-  for (auto third_body : third_body_list_) {
-    libra::Vector<3> third_body_position_from_sc_i_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_i_m(third_body.c_str());
-    libra::Vector<3> third_body_pos_i_m = sc_position_i_m + third_body_position_from_sc_i_m;
-    double gravity_constant = local_environment.GetCelestialInformation().GetGlobalInformation().GetGravityConstant_m3_s2(third_body.c_str());
-
-    third_body_acceleration_i_m_s2_ = CalcAcceleration_i_m_s2(third_body_pos_i_m, third_body_position_from_sc_i_m, gravity_constant);
-    acceleration_i_m_s2_ += third_body_acceleration_i_m_s2_;
+  // The body names are resolved only at the first update since the celestial information is not given in the constructor
+  const CelestialInformation& global_celestial_information = local_environment.GetCelestialInformation().GetGlobalInformation();
+  if (!is_third_body_handle_resolved_) {
+    for (const auto& third_body : third_body_list_) {
+      const CelestialBodyHandle handle = global_celestial_information.GetBodyHandle(third_body.c_str());
+      third_body_handle_list_.push_back(handle);
+      third_body_gravity_constant_list_m3_s2_.push_back(global_celestial_information.GetGravityConstant_m3_s2(handle));
+    }
+    is_third_body_handle_resolved_ = true;
   }
-}
-
-libra::Vector<3> ThirdBodyGravity::CalcAcceleration_i_m_s2(const libra::Vector<3> s, const libra::Vector<3> sr, const double gravity_constant_m_s2) {
-  libra::Vector<3> acceleration_i_m_s2;
 
-  double s_norm = s.CalcNorm();
-  double s_norm3 = s_norm * s_norm * s_norm;
+  // The states of all bodies are taken from the celestial information (the ephemeris cache when it is enabled) at once
+  global_celestial_information.GetStatesFromCenter_i(third_body_handle_list_, third_body_positions_i_m_, third_body_velocities_i_m_s_);
 
-  double sr_norm = sr.CalcNorm();
-  double sr_norm3 = sr_norm * sr_norm * sr_norm;
+  // The logged acceleration is the sum over all bodies
+  third_body_acceleration_i_m_s2_ = CalcTotalPointMassAcceleration_i_m_s2(third_body_positions_i_m_, third_body_velocities_i_m_s_,
+                                                                          third_body_gravity_constant_list_m3_s2_, 0.0,
+                                                                          dynamics.GetOrbit().GetPosition_i_m());
+  acceleration_i_m_s2_ = third_body_acceleration_i_m_s2_;
+}
 
-  acceleration_i_m_s2 = gravity_constant_m_s2 * (1.0 / sr_norm3 * sr - 1.0 / s_norm3 * s);
+bool ThirdBodyGravity::CalcAccelerationAtPosition_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m,
+                                                         const libra::Vector<3>& velocity_i_m_s, libra::Vector<3>& acceleration_i_m_s2) {
+  UNUSED(velocity_i_m_s);
+  acceleration_i_m_s2 = CalcTotalPointMassAcceleration_i_m_s2(third_body_positions_i_m_, third_body_velocities_i_m_s_,
+                                                              third_body_gravity_constant_list_m3_s2_, time_from_update_s, position_i_m);
+  return true;
+}
 
+libra::Vector<3> ThirdBodyGravity::CalcTotalPointMassAcceleration_i_m_s2(const std::vector<double>& body_positions_i_m,
+                                                                         const std::vector<double>& body_velocities_i_m_s,
+                                                                         const std::vector<double>& gravity_constants_m3_s2,
+                                                                         const double time_from_update_s, const libra::Vector<3>& position_i_m) {
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  libra::Vector<3> body_position_i_m;
+  for (size_t body = 0; body < gravity_constants_m3_s2.size(); body++) {
+    for (size_t i = 0; i < 3; i++) {
+      body_position_i_m[i] = body_positions_i_m[body * 3 + i] + body_velocities_i_m_s[body * 3 + i] * time_from_update_s;
+    }
+    acceleration_i_m_s2 += CalcPointMassAcceleration_i_m_s2(position_i_m, body_position_i_m, gravity_constants_m3_s2[body]);
+  }
   return acceleration_i_m_s2;
 }
 
@@ -96,6 +113,7 @@ ThirdBodyGravity InitThirdBodyGravity(const std::string initialize_file_path, co
   const bool is_calc_enable = conf.ReadEnable(section, INI_CALC_LABEL);
   ThirdBodyGravity third_body_disturbance(third_body_list, is_calc_enable);
   third_body_disturbance.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  third_body_disturbance.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return third_body_disturbance;
 }
@@ -7,9 +7,12 @@
 #define S2E_DISTURBANCES_THIRD_BODY_GRAVITY_HPP_
 
 #include <cassert>
+#include <cmath>
 #include <set>
 #include <string>
+#include <vector>
 
+#include "../environment/global/celestial_body_handle.hpp"
 #include "../logger/loggable.hpp"
 #include "../math_physics/math/vector.hpp"
 #include "disturbance.hpp"
@@ -40,11 +43,64 @@ class ThirdBodyGravity : public Disturbance {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn GetInputDependency
+   * @brief Return the input dependency (the position and the third body positions)
+   */
+  virtual unsigned int GetInputDependency() const { return kDisturbanceInputPosition_i | kDisturbanceInputTime; }
+  /**
+   * @fn CalcAccelerationAtPosition_i_m_s2
+   * @brief Override CalcAccelerationAtPosition_i_m_s2 function of Disturbance
+   * @note The third body positions are propagated from the latest update with their velocities
+   */
+  virtual bool CalcAccelerationAtPosition_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m,
+                                                 const libra::Vector<3>& velocity_i_m_s, libra::Vector<3>& acceleration_i_m_s2);
+
+  /**
+   * @fn CalcPointMassAcceleration_i_m_s2
+   * @brief Calculate the third body disturbance acceleration of a point mass body
+   * @note Battin's formulation is used to avoid the cancellation between the direct term and the indirect term when the spacecraft is much
+   *       closer to the center body than the third body
+   * @param [in] position_i_m: Position of the spacecraft from the center body in the inertial frame [m]
+   * @param [in] body_position_i_m: Position of the third body from the center body in the inertial frame [m]
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the third body [m3/s2]
+   * @return Third body disturbance acceleration in the inertial frame [m/s2]
+   */
+  static inline libra::Vector<3> CalcPointMassAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& body_position_i_m,
+                                                                  const double gravity_constant_m3_s2) {
+    const libra::Vector<3> body_position_from_spacecraft_i_m = body_position_i_m - position_i_m;
+    const double distance_m = body_position_from_spacecraft_i_m.CalcNorm();
+    // q = (|d|^2 - |s|^2) / |s|^2 and f(q) = (1 + q)^(3/2) - 1 without the cancellation
+    const double q = InnerProduct(position_i_m, position_i_m - 2.0 * body_position_i_m) / InnerProduct(body_position_i_m, body_position_i_m);
+    const double f = q * (3.0 + 3.0 * q + q * q) / (1.0 + std::pow(1.0 + q, 1.5));
+    return (-gravity_constant_m3_s2 / (distance_m * distance_m * distance_m)) * (position_i_m + f * body_position_i_m);
+  }
+
+  /**
+   * @fn CalcTotalPointMassAcceleration_i_m_s2
+   * @brief Calculate the sum of the third body disturbance accelerations of the point mass bodies
+   * @param [in] body_positions_i_m: Positions of the third bodies at the update (x, y, z of each body) [m]
+   * @param [in] body_velocities_i_m_s: Velocities of the third bodies at the update (x, y, z of each body) [m/s]
+   * @param [in] gravity_constants_m3_s2: Gravity constants of the third bodies [m3/s2]
+   * @param [in] time_from_update_s: Time from the update to propagate the third body positions linearly [s]
+   * @param [in] position_i_m: Position of the spacecraft from the center body in the inertial frame [m]
+   * @return Third body disturbance acceleration in the inertial frame [m/s2]
+   */
+  static libra::Vector<3> CalcTotalPointMassAcceleration_i_m_s2(const std::vector<double>& body_positions_i_m,
+                                                                const std::vector<double>& body_velocities_i_m_s,
+                                                                const std::vector<double>& gravity_constants_m3_s2, const double time_from_update_s,
+                                                                const libra::Vector<3>& position_i_m);
 
  private:
   std::set<std::string> third_body_list_;                 //!< List of celestial bodies to calculate the third body disturbances
   libra::Vector<3> third_body_acceleration_i_m_s2_{0.0};  //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
 
+  std::vector<CelestialBodyHandle> third_body_handle_list_;     //!< Handles of the bodies in third_body_list_
+  bool is_third_body_handle_resolved_ = false;                  //!< Flag to show the handles are resolved
+  std::vector<double> third_body_positions_i_m_;                //!< Positions of the third bodies at the latest update (x, y, z of each body) [m]
+  std::vector<double> third_body_velocities_i_m_s_;             //!< Velocities of the third bodies at the latest update (x, y, z of each body) [m/s]
+  std::vector<double> third_body_gravity_constant_list_m3_s2_;  //!< Gravity constants of the third bodies [m3/s2]
+
   // Override classes for ILoggable
   /**
    * @fn GetLogHeader
@@ -56,16 +112,6 @@ class ThirdBodyGravity : public Disturbance {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
-
-  /**
-   * @fn CalcAcceleration_i_m_s2
-   * @brief Calculate and return the third body disturbance acceleration
-   * @param [in] s: Position vector of the third celestial body from the origin in the inertial frame in unit [m]
-   * @param [in] sr: Position vector of the third celestial body from the spacecraft in the inertial frame in unit [m]
-   * @param [in] GM: The gravitational constants of the third celestial body [m3/s2]
-   * @return Third body disturbance acceleration in the inertial frame in unit [m/s2]
-   */
-  libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3> s, const libra::Vector<3> sr, const double gravity_constant_m_s2);
 };
 
 /**
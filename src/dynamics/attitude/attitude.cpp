@@ -19,6 +19,23 @@ Attitude::Attitude(const libra::Matrix<3, 3>& inertia_tensor_kgm2, const std::st
   kinetic_energy_J_ = 0.0;
 }
 
+void Attitude::UpdateInverseInertiaTensor() {
+  bool is_changed = !is_inverse_inertia_tensor_calculated_;
+  for (size_t i = 0; i < 3 && !is_changed; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      if (inertia_tensor_kgm2_[i][j] != inverse_source_inertia_tensor_kgm2_[i][j]) {
+        is_changed = true;
+        break;
+      }
+    }
+  }
+  if (!is_changed) return;
+
+  inverse_inertia_tensor_ = CalcInverseMatrix(inertia_tensor_kgm2_);
+  inverse_source_inertia_tensor_kgm2_ = inertia_tensor_kgm2_;
+  is_inverse_inertia_tensor_calculated_ = true;
+}
+
 std::string Attitude::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -43,6 +60,42 @@ std::string Attitude::GetLogValue() const {
   return str_tmp;
 }
 
+bool Attitude::AppendLogValue(ILogValueSink& sink) const {
+  sink.AppendVector(angular_velocity_b_rad_s_);
+  sink.AppendQuaternion(quaternion_i2b_);
+  sink.AppendVector(torque_b_Nm_);
+  sink.AppendDouble(angular_momentum_total_Nms_);
+  sink.AppendDouble(kinetic_energy_J_);
+
+  return true;
+}
+
+void Attitude::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("ATTITUDE");
+  snapshot.Write(angular_velocity_b_rad_s_);
+  snapshot.Write(quaternion_i2b_);
+  snapshot.Write(torque_b_Nm_);
+  snapshot.Write(angular_momentum_spacecraft_b_Nms_);
+  snapshot.Write(angular_momentum_reaction_wheel_b_Nms_);
+  snapshot.Write(angular_momentum_total_b_Nms_);
+  snapshot.Write(angular_momentum_total_i_Nms_);
+  snapshot.Write(angular_momentum_total_Nms_);
+  snapshot.Write(kinetic_energy_J_);
+}
+
+void Attitude::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("ATTITUDE");
+  snapshot.Read(angular_velocity_b_rad_s_);
+  snapshot.Read(quaternion_i2b_);
+  snapshot.Read(torque_b_Nm_);
+  snapshot.Read(angular_momentum_spacecraft_b_Nms_);
+  snapshot.Read(angular_momentum_reaction_wheel_b_Nms_);
+  snapshot.Read(angular_momentum_total_b_Nms_);
+  snapshot.Read(angular_momentum_total_i_Nms_);
+  snapshot.Read(angular_momentum_total_Nms_);
+  snapshot.Read(kinetic_energy_J_);
+}
+
 void Attitude::SetParameters(const MonteCarloSimulationExecutor& mc_simulator) {
   GetInitializedMonteCarloParameterQuaternion(mc_simulator, "quaternion_i2b", quaternion_i2b_);
 }
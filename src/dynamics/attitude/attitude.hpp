@@ -11,12 +11,14 @@
 #include <math_physics/math/quaternion.hpp>
 #include <simulation/monte_carlo_simulation/simulation_object.hpp>
 #include <string>
+#include <utilities/case_arena.hpp>
+#include <utilities/snapshot.hpp>
 
 /**
  * @class Attitude
  * @brief Base class for attitude of spacecraft
  */
-class Attitude : public ILoggable, public SimulationObject {
+class Attitude : public ILoggable, public SimulationObject, public ArenaAllocated {
  public:
   /**
    * @fn Attitude
@@ -98,6 +100,20 @@ class Attitude : public ILoggable, public SimulationObject {
    */
   virtual void Propagate(const double end_time_s) = 0;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the attitude state to the snapshot
+   * @note Override this function and call it in the derived class to add the state of the propagator
+   * @param [out] snapshot: Snapshot writer
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the attitude state from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -109,6 +125,11 @@ class Attitude : public ILoggable, public SimulationObject {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual bool AppendLogValue(ILogValueSink& sink) const;
 
   // SimulationObject for McSim
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
@@ -121,6 +142,7 @@ class Attitude : public ILoggable, public SimulationObject {
   libra::Vector<3> torque_b_Nm_;               //!< Torque in the body fixed frame [Nm]
 
   const libra::Matrix<3, 3>& inertia_tensor_kgm2_;  //!< Inertia tensor of the spacecraft [kg m^2]
+  libra::Matrix<3, 3> inverse_inertia_tensor_;      //!< Inverse of the inertia tensor updated by UpdateInverseInertiaTensor [1/(kg m^2)]
 
   libra::Vector<3> angular_momentum_spacecraft_b_Nms_;      //!< Angular momentum of spacecraft in the body fixed frame [Nms]
   libra::Vector<3> angular_momentum_reaction_wheel_b_Nms_;  //!< Angular momentum of reaction wheel in the body fixed frame [Nms]
@@ -129,11 +151,20 @@ class Attitude : public ILoggable, public SimulationObject {
   double angular_momentum_total_Nms_;                       //!< Norm of total angular momentum [Nms]
   double kinetic_energy_J_;                                 //!< Rotational Kinetic Energy of Spacecraft [J]
 
+  /**
+   * @fn UpdateInverseInertiaTensor
+   * @brief Update inverse_inertia_tensor_ only when the inertia tensor is changed after the previous calculation
+   */
+  void UpdateInverseInertiaTensor();
   /**
    * @fn CalcAngularMomentum
    * @brief Calculate angular momentum
    */
   void CalcAngularMomentum(void);
+
+ private:
+  libra::Matrix<3, 3> inverse_source_inertia_tensor_kgm2_;  //!< Inertia tensor used for inverse_inertia_tensor_ [kg m^2]
+  bool is_inverse_inertia_tensor_calculated_ = false;       //!< Flag of the calculation of inverse_inertia_tensor_
 };
 
 #endif  // S2E_DYNAMICS_ATTITUDE_ATTITUDE_HPP_
@@ -0,0 +1,123 @@
+/**
+ * @file attitude_interpolator.cpp
+ * @brief Class to interpolate the attitude between the attitude updates for the components faster than the attitude update
+ */
+
+#include "attitude_interpolator.hpp"
+
+#include <cmath>
+
+void AttitudeInterpolator::Reset(const double time_s, const libra::Quaternion& quaternion_i2b, const libra::Vector<3>& angular_velocity_b_rad_s) {
+  previous_time_s_ = time_s;
+  latest_time_s_ = time_s;
+  previous_quaternion_i2b_ = quaternion_i2b;
+  latest_quaternion_i2b_ = quaternion_i2b;
+  previous_angular_velocity_b_rad_s_ = angular_velocity_b_rad_s;
+  latest_angular_velocity_b_rad_s_ = angular_velocity_b_rad_s;
+  rotation_vector_rad_ = libra::Vector<3>(0.0);
+  end_rotation_vector_rate_rad_s_ = angular_velocity_b_rad_s;
+}
+
+void AttitudeInterpolator::Update(const double time_s, const libra::Quaternion& quaternion_i2b, const libra::Vector<3>& angular_velocity_b_rad_s) {
+  previous_time_s_ = latest_time_s_;
+  previous_quaternion_i2b_ = latest_quaternion_i2b_;
+  previous_angular_velocity_b_rad_s_ = latest_angular_velocity_b_rad_s_;
+  latest_time_s_ = time_s;
+  latest_quaternion_i2b_ = quaternion_i2b;
+  latest_angular_velocity_b_rad_s_ = angular_velocity_b_rad_s;
+
+  // Logarithmic map of the rotation from the previous attitude with the shorter path
+  libra::Quaternion delta_quaternion = previous_quaternion_i2b_.Conjugate() * latest_quaternion_i2b_;
+  if (delta_quaternion[3] < 0.0) delta_quaternion = -1.0 * delta_quaternion;
+  libra::Vector<3> vector_part;
+  for (size_t i = 0; i < 3; i++) vector_part[i] = delta_quaternion[i];
+  const double sin_half_angle = vector_part.CalcNorm();
+  const double angle_rad = 2.0 * atan2(sin_half_angle, delta_quaternion[3]);
+  // The ratio approaches 2 when the angle is small
+  const double ratio = sin_half_angle > 1.0e-12 ? angle_rad / sin_half_angle : 2.0;
+  rotation_vector_rad_ = ratio * vector_part;
+
+  // Derivative of the rotation vector at the latest state (Bortz equation), which is the inverse of the right Jacobian times the angular velocity
+  double coefficient;
+  if (angle_rad < 1.0e-4) {
+    coefficient = 1.0 / 12.0 + angle_rad * angle_rad / 720.0;
+  } else {
+    const double half_angle_rad = 0.5 * angle_rad;
+    coefficient = (1.0 - half_angle_rad * cos(half_angle_rad) / sin(half_angle_rad)) / (angle_rad * angle_rad);
+  }
+  const libra::Vector<3> cross = libra::OuterProduct(rotation_vector_rad_, angular_velocity_b_rad_s);
+  end_rotation_vector_rate_rad_s_ = angular_velocity_b_rad_s + 0.5 * cross + coefficient * libra::OuterProduct(rotation_vector_rad_, cross);
+}
+
+libra::Quaternion AttitudeInterpolator::CalcQuaternion_i2b(const double time_s) const {
+  if (time_s <= previous_time_s_) return previous_quaternion_i2b_;
+  if (time_s >= latest_time_s_) {
+    // Extrapolation with the latest angular velocity
+    return latest_quaternion_i2b_ * CalcRotationQuaternion((time_s - latest_time_s_) * latest_angular_velocity_b_rad_s_);
+  }
+
+  const double interval_s = latest_time_s_ - previous_time_s_;
+  const double tau = (time_s - previous_time_s_) / interval_s;
+  libra::Vector<3> rotation_vector_rad;
+  if (method_ == AttitudeInterpolationMethod::kHermite) {
+    // Cubic Hermite basis functions with the zero rotation vector at the previous state
+    const double tau2 = tau * tau;
+    const double tau3 = tau2 * tau;
+    const double h10 = tau3 - 2.0 * tau2 + tau;
+    const double h01 = -2.0 * tau3 + 3.0 * tau2;
+    const double h11 = tau3 - tau2;
+    rotation_vector_rad = (h10 * interval_s) * previous_angular_velocity_b_rad_s_ + h01 * rotation_vector_rad_ +
+                          (h11 * interval_s) * end_rotation_vector_rate_rad_s_;
+  } else {
+    rotation_vector_rad = tau * rotation_vector_rad_;
+  }
+  return previous_quaternion_i2b_ * CalcRotationQuaternion(rotation_vector_rad);
+}
+
+libra::Vector<3> AttitudeInterpolator::CalcAngularVelocity_b_rad_s(const double time_s) const {
+  if (time_s <= previous_time_s_) return previous_angular_velocity_b_rad_s_;
+  if (time_s >= latest_time_s_) return latest_angular_velocity_b_rad_s_;
+  const double tau = (time_s - previous_time_s_) / (latest_time_s_ - previous_time_s_);
+  return (1.0 - tau) * previous_angular_velocity_b_rad_s_ + tau * latest_angular_velocity_b_rad_s_;
+}
+
+void AttitudeInterpolator::CalcQuaternions_i2b(const double* times_s, const size_t number_of_times, libra::Quaternion* quaternions_i2b) const {
+  for (size_t i = 0; i < number_of_times; i++) {
+    quaternions_i2b[i] = CalcQuaternion_i2b(times_s[i]);
+  }
+}
+
+void AttitudeInterpolator::CalcAngularVelocities_b_rad_s(const double* times_s, const size_t number_of_times,
+                                                         libra::Vector<3>* angular_velocities_b_rad_s) const {
+  for (size_t i = 0; i < number_of_times; i++) {
+    angular_velocities_b_rad_s[i] = CalcAngularVelocity_b_rad_s(times_s[i]);
+  }
+}
+
+void AttitudeInterpolator::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(previous_time_s_);
+  snapshot.Write(latest_time_s_);
+  snapshot.Write(previous_quaternion_i2b_);
+  snapshot.Write(latest_quaternion_i2b_);
+  snapshot.Write(previous_angular_velocity_b_rad_s_);
+  snapshot.Write(latest_angular_velocity_b_rad_s_);
+  snapshot.Write(rotation_vector_rad_);
+  snapshot.Write(end_rotation_vector_rate_rad_s_);
+}
+
+void AttitudeInterpolator::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(previous_time_s_);
+  snapshot.Read(latest_time_s_);
+  snapshot.Read(previous_quaternion_i2b_);
+  snapshot.Read(latest_quaternion_i2b_);
+  snapshot.Read(previous_angular_velocity_b_rad_s_);
+  snapshot.Read(latest_angular_velocity_b_rad_s_);
+  snapshot.Read(rotation_vector_rad_);
+  snapshot.Read(end_rotation_vector_rate_rad_s_);
+}
+
+libra::Quaternion AttitudeInterpolator::CalcRotationQuaternion(const libra::Vector<3>& rotation_vector_rad) {
+  const double angle_rad = rotation_vector_rad.CalcNorm();
+  if (angle_rad <= 0.0) return libra::Quaternion(0.0, 0.0, 0.0, 1.0);
+  return libra::Quaternion((1.0 / angle_rad) * rotation_vector_rad, angle_rad);
+}
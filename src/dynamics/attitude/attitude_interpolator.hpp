@@ -0,0 +1,139 @@
+/**
+ * @file attitude_interpolator.hpp
+ * @brief Class to interpolate the attitude between the attitude updates for the components faster than the attitude update
+ */
+
+#ifndef S2E_DYNAMICS_ATTITUDE_ATTITUDE_INTERPOLATOR_HPP_
+#define S2E_DYNAMICS_ATTITUDE_ATTITUDE_INTERPOLATOR_HPP_
+
+#include <math_physics/math/quaternion.hpp>
+#include <math_physics/math/vector.hpp>
+#include <utilities/snapshot.hpp>
+
+/**
+ * @enum AttitudeInterpolationMethod
+ * @brief Interpolation method of the quaternion
+ */
+enum class AttitudeInterpolationMethod {
+  kSlerp = 0,  //!< Spherical linear interpolation with the constant angular velocity
+  kHermite,    //!< Cubic Hermite interpolation of the rotation vector matching the angular velocities at both ends
+};
+
+/**
+ * @class AttitudeInterpolator
+ * @brief Class to interpolate the attitude between the last two attitude states
+ * @details The rotation from the previous to the latest attitude is expressed as the rotation vector in the body frame of the previous attitude,
+ *          and it is calculated once in each update. So each query only evaluates a polynomial of the rotation vector and an exponential map.
+ *          The time after the latest state is extrapolated with the latest angular velocity, and the time before the previous state returns the
+ *          previous state.
+ */
+class AttitudeInterpolator {
+ public:
+  /**
+   * @fn AttitudeInterpolator
+   * @brief Constructor
+   * @param [in] method: Interpolation method
+   */
+  explicit AttitudeInterpolator(const AttitudeInterpolationMethod method = AttitudeInterpolationMethod::kHermite) : method_(method) {}
+
+  /**
+   * @fn Reset
+   * @brief Set the attitude state as both of the previous and latest states
+   * @param [in] time_s: Time of the state [s]
+   * @param [in] quaternion_i2b: Quaternion from the inertial frame to the body frame
+   * @param [in] angular_velocity_b_rad_s: Angular velocity of the body frame [rad/s]
+   */
+  void Reset(const double time_s, const libra::Quaternion& quaternion_i2b, const libra::Vector<3>& angular_velocity_b_rad_s);
+  /**
+   * @fn Update
+   * @brief Add the latest attitude state. The former latest state becomes the previous state.
+   * @param [in] time_s: Time of the state [s]
+   * @param [in] quaternion_i2b: Quaternion from the inertial frame to the body frame
+   * @param [in] angular_velocity_b_rad_s: Angular velocity of the body frame [rad/s]
+   */
+  void Update(const double time_s, const libra::Quaternion& quaternion_i2b, const libra::Vector<3>& angular_velocity_b_rad_s);
+
+  /**
+   * @fn CalcQuaternion_i2b
+   * @brief Calculate the quaternion from the inertial frame to the body frame at the time
+   * @param [in] time_s: Time [s]
+   * @return Quaternion from the inertial frame to the body frame
+   */
+  libra::Quaternion CalcQuaternion_i2b(const double time_s) const;
+  /**
+   * @fn CalcAngularVelocity_b_rad_s
+   * @brief Calculate the angular velocity of the body frame at the time with the linear interpolation
+   * @param [in] time_s: Time [s]
+   * @return Angular velocity of the body frame [rad/s]
+   */
+  libra::Vector<3> CalcAngularVelocity_b_rad_s(const double time_s) const;
+  /**
+   * @fn CalcQuaternions_i2b
+   * @brief Calculate the quaternions at the times at once
+   * @param [in] times_s: Times [s]
+   * @param [in] number_of_times: Number of the times
+   * @param [out] quaternions_i2b: Quaternions from the inertial frame to the body frame at the times
+   */
+  void CalcQuaternions_i2b(const double* times_s, const size_t number_of_times, libra::Quaternion* quaternions_i2b) const;
+  /**
+   * @fn CalcAngularVelocities_b_rad_s
+   * @brief Calculate the angular velocities at the times at once
+   * @param [in] times_s: Times [s]
+   * @param [in] number_of_times: Number of the times
+   * @param [out] angular_velocities_b_rad_s: Angular velocities of the body frame at the times [rad/s]
+   */
+  void CalcAngularVelocities_b_rad_s(const double* times_s, const size_t number_of_times, libra::Vector<3>* angular_velocities_b_rad_s) const;
+
+  /**
+   * @fn GetMethod
+   * @brief Return interpolation method
+   */
+  inline AttitudeInterpolationMethod GetMethod() const { return method_; }
+  /**
+   * @fn SetMethod
+   * @brief Set interpolation method
+   */
+  inline void SetMethod(const AttitudeInterpolationMethod method) { method_ = method; }
+  /**
+   * @fn GetPreviousTime_s
+   * @brief Return time of the previous state [s]
+   */
+  inline double GetPreviousTime_s() const { return previous_time_s_; }
+  /**
+   * @fn GetLatestTime_s
+   * @brief Return time of the latest state [s]
+   */
+  inline double GetLatestTime_s() const { return latest_time_s_; }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the states from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
+ private:
+  AttitudeInterpolationMethod method_;                             //!< Interpolation method
+  double previous_time_s_ = 0.0;                                   //!< Time of the previous state [s]
+  double latest_time_s_ = 0.0;                                     //!< Time of the latest state [s]
+  libra::Quaternion previous_quaternion_i2b_{0.0, 0.0, 0.0, 1.0};  //!< Previous quaternion from the inertial frame to the body frame
+  libra::Quaternion latest_quaternion_i2b_{0.0, 0.0, 0.0, 1.0};    //!< Latest quaternion from the inertial frame to the body frame
+  libra::Vector<3> previous_angular_velocity_b_rad_s_{0.0};        //!< Previous angular velocity of the body frame [rad/s]
+  libra::Vector<3> latest_angular_velocity_b_rad_s_{0.0};          //!< Latest angular velocity of the body frame [rad/s]
+  libra::Vector<3> rotation_vector_rad_{0.0};                      //!< Rotation vector from previous to latest attitude in the previous body frame
+  libra::Vector<3> end_rotation_vector_rate_rad_s_{0.0};           //!< Derivative of the rotation vector at the latest state [rad/s]
+
+  /**
+   * @fn CalcRotationQuaternion
+   * @brief Exponential map of the rotation vector
+   */
+  static libra::Quaternion CalcRotationQuaternion(const libra::Vector<3>& rotation_vector_rad);
+};
+
+#endif  // S2E_DYNAMICS_ATTITUDE_ATTITUDE_INTERPOLATOR_HPP_
@@ -0,0 +1,248 @@
+/**
+ * @file attitude_multi_body.cpp
+ * @brief Class to calculate spacecraft attitude with the appendages connected by the revolute joints
+ */
+#include "attitude_multi_body.hpp"
+
+#include <logger/log_utility.hpp>
+#include <stdexcept>
+
+namespace {
+const size_t kQuaternionOffset = 6;  //!< Offset of the quaternion in the state vector
+const size_t kJointOffset = 10;      //!< Offset of the joint angles in the state vector
+}  // namespace
+
+AttitudeMultiBody::AttitudeMultiBody(const libra::Vector<3>& angular_velocity_b_rad_s, const libra::Quaternion& quaternion_i2b,
+                                     const KinematicsParameters& kinematics_parameters, const std::vector<ArticulatedBody>& appendages,
+                                     const std::vector<double>& joint_angles_rad, const std::vector<double>& joint_angular_velocities_rad_s,
+                                     const libra::Vector<3>& torque_b_Nm, const double propagation_step_s, const std::string& simulation_object_name)
+    : Attitude(kinematics_parameters.GetInertiaTensor_b_kgm2(), simulation_object_name),
+      kinematics_parameters_(kinematics_parameters),
+      kinematics_parameters_version_(kinematics_parameters.GetVersion()),
+      multi_body_system_(MakeBodies(kinematics_parameters, appendages)),
+      joint_angles_rad_(joint_angles_rad),
+      joint_angular_velocities_rad_s_(joint_angular_velocities_rad_s),
+      joint_torques_Nm_(appendages.size(), 0.0) {
+  angular_velocity_b_rad_s_ = angular_velocity_b_rad_s;
+  quaternion_i2b_ = quaternion_i2b;
+  torque_b_Nm_ = torque_b_Nm;
+  propagation_step_s_ = propagation_step_s;
+  current_propagation_time_s_ = 0.0;
+  angular_momentum_reaction_wheel_b_Nms_ = libra::Vector<3>(0.0);
+  joint_angles_rad_.resize(appendages.size(), 0.0);
+  joint_angular_velocities_rad_s_.resize(appendages.size(), 0.0);
+
+  const size_t state_size = kJointOffset + 2 * appendages.size();
+  state_.resize(state_size);
+  stage_state_.resize(state_size);
+  for (auto& k : k_) k.resize(state_size);
+
+  CalcBaseVelocity();
+  CalcSystemAngularMomentum();
+}
+
+void AttitudeMultiBody::SetParameters(const MonteCarloSimulationExecutor& mc_simulator) {
+  Attitude::SetParameters(mc_simulator);
+  GetInitializedMonteCarloParameterVector(mc_simulator, "angular_velocity_b_rad_s", angular_velocity_b_rad_s_);
+
+  current_propagation_time_s_ = 0.0;
+  angular_momentum_reaction_wheel_b_Nms_ = libra::Vector<3>(0.0);
+  CalcBaseVelocity();
+  CalcSystemAngularMomentum();
+}
+
+void AttitudeMultiBody::Propagate(const double end_time_s) {
+  if (!is_calc_enabled_) return;
+
+  UpdateBaseMassProperties();
+
+  while (end_time_s - current_propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+    RungeKuttaOneStep(propagation_step_s_);
+    current_propagation_time_s_ += propagation_step_s_;
+  }
+  RungeKuttaOneStep(end_time_s - current_propagation_time_s_);
+
+  // Update information
+  current_propagation_time_s_ = end_time_s;
+  CalcSystemAngularMomentum();
+}
+
+std::string AttitudeMultiBody::GetLogHeader() const {
+  std::string str_tmp = Attitude::GetLogHeader();
+
+  for (size_t i = 0; i < GetNumberOfJoints(); i++) {
+    const std::string joint_name = "appendage" + std::to_string(i + 1) + "_joint_";
+    str_tmp += WriteScalar(joint_name + "angle", "rad");
+    str_tmp += WriteScalar(joint_name + "angular_velocity", "rad/s");
+  }
+
+  return str_tmp;
+}
+
+std::string AttitudeMultiBody::GetLogValue() const {
+  std::string str_tmp = Attitude::GetLogValue();
+
+  for (size_t i = 0; i < GetNumberOfJoints(); i++) {
+    str_tmp += WriteScalar(joint_angles_rad_[i]);
+    str_tmp += WriteScalar(joint_angular_velocities_rad_s_[i]);
+  }
+
+  return str_tmp;
+}
+
+bool AttitudeMultiBody::AppendLogValue(ILogValueSink& sink) const {
+  Attitude::AppendLogValue(sink);
+
+  for (size_t i = 0; i < GetNumberOfJoints(); i++) {
+    sink.AppendDouble(joint_angles_rad_[i]);
+    sink.AppendDouble(joint_angular_velocities_rad_s_[i]);
+  }
+
+  return true;
+}
+
+std::vector<ArticulatedBody> AttitudeMultiBody::MakeBodies(const KinematicsParameters& kinematics_parameters,
+                                                           const std::vector<ArticulatedBody>& appendages) {
+  ArticulatedBody bus;
+  bus.parent_id_ = 0;
+  bus.joint_position_parent_m_ = libra::Vector<3>(0.0);
+  bus.joint_axis_ = libra::Vector<3>(0.0);
+  bus.joint_stiffness_Nm_rad_ = 0.0;
+  bus.joint_damping_Nms_rad_ = 0.0;
+  bus.mass_kg_ = kinematics_parameters.GetMass_kg();
+  bus.center_of_mass_m_ = kinematics_parameters.GetCenterOfGravity_b_m();
+  bus.inertia_tensor_kgm2_ = kinematics_parameters.GetInertiaTensor_b_kgm2();
+
+  std::vector<ArticulatedBody> bodies;
+  bodies.reserve(appendages.size() + 1);
+  bodies.push_back(bus);
+  bodies.insert(bodies.end(), appendages.begin(), appendages.end());
+  return bodies;
+}
+
+void AttitudeMultiBody::UpdateBaseMassProperties() {
+  if (kinematics_parameters_.GetVersion() == kinematics_parameters_version_) return;
+
+  multi_body_system_.SetBaseMassProperties(kinematics_parameters_.GetMass_kg(), kinematics_parameters_.GetCenterOfGravity_b_m(),
+                                           kinematics_parameters_.GetInertiaTensor_b_kgm2());
+  kinematics_parameters_version_ = kinematics_parameters_.GetVersion();
+}
+
+void AttitudeMultiBody::CalcStateDerivative(const std::vector<double>& x, std::vector<double>& dxdt) {
+  const size_t number_of_joints = GetNumberOfJoints();
+
+  libra::Vector<6> base_velocity;
+  for (size_t i = 0; i < 6; i++) base_velocity[i] = x[i];
+  stage_joint_angles_rad_.assign(x.begin() + kJointOffset, x.begin() + kJointOffset + number_of_joints);
+  stage_joint_velocities_rad_s_.assign(x.begin() + kJointOffset + number_of_joints, x.end());
+
+  libra::Vector<6> base_force(0.0);
+  for (size_t i = 0; i < 3; i++) base_force[i] = torque_b_Nm_[i];
+
+  libra::Vector<6> base_acceleration;
+  multi_body_system_.CalcAcceleration(base_velocity, stage_joint_angles_rad_, stage_joint_velocities_rad_s_, joint_torques_Nm_, base_force,
+                                      angular_momentum_reaction_wheel_b_Nms_, base_acceleration, joint_accelerations_rad_s2_);
+  for (size_t i = 0; i < 6; i++) dxdt[i] = base_acceleration[i];
+
+  // Quaternion kinematics: dq/dt = 0.5 * Omega(w) q
+  const double* w = &x[0];
+  const double* q = &x[kQuaternionOffset];
+  dxdt[kQuaternionOffset + 0] = 0.5 * (w[2] * q[1] - w[1] * q[2] + w[0] * q[3]);
+  dxdt[kQuaternionOffset + 1] = 0.5 * (-w[2] * q[0] + w[0] * q[2] + w[1] * q[3]);
+  dxdt[kQuaternionOffset + 2] = 0.5 * (w[1] * q[0] - w[0] * q[1] + w[2] * q[3]);
+  dxdt[kQuaternionOffset + 3] = 0.5 * (-w[0] * q[0] - w[1] * q[1] - w[2] * q[2]);
+
+  for (size_t i = 0; i < number_of_joints; i++) {
+    dxdt[kJointOffset + i] = stage_joint_velocities_rad_s_[i];
+    dxdt[kJointOffset + number_of_joints + i] = joint_accelerations_rad_s2_[i];
+  }
+}
+
+void AttitudeMultiBody::RungeKuttaOneStep(const double dt) {
+  const size_t number_of_joints = GetNumberOfJoints();
+  for (size_t i = 0; i < 3; i++) {
+    state_[i] = angular_velocity_b_rad_s_[i];
+    state_[i + 3] = velocity_b_m_s_[i];
+  }
+  for (size_t i = 0; i < 4; i++) {
+    state_[kQuaternionOffset + i] = quaternion_i2b_[i];
+  }
+  for (size_t i = 0; i < number_of_joints; i++) {
+    state_[kJointOffset + i] = joint_angles_rad_[i];
+    state_[kJointOffset + number_of_joints + i] = joint_angular_velocities_rad_s_[i];
+  }
+
+  const double half_dt = dt / 2.0;
+  const size_t state_size = state_.size();
+  CalcStateDerivative(state_, k_[0]);
+  for (size_t i = 0; i < state_size; i++) stage_state_[i] = state_[i] + half_dt * k_[0][i];
+  CalcStateDerivative(stage_state_, k_[1]);
+  for (size_t i = 0; i < state_size; i++) stage_state_[i] = state_[i] + half_dt * k_[1][i];
+  CalcStateDerivative(stage_state_, k_[2]);
+  for (size_t i = 0; i < state_size; i++) stage_state_[i] = state_[i] + dt * k_[2][i];
+  CalcStateDerivative(stage_state_, k_[3]);
+
+  const double sixth_dt = dt / 6.0;
+  for (size_t i = 0; i < state_size; i++) state_[i] += sixth_dt * (k_[0][i] + 2.0 * k_[1][i] + 2.0 * k_[2][i] + k_[3][i]);
+
+  for (size_t i = 0; i < 3; i++) {
+    angular_velocity_b_rad_s_[i] = state_[i];
+    velocity_b_m_s_[i] = state_[i + 3];
+  }
+  for (size_t i = 0; i < 4; i++) {
+    quaternion_i2b_[i] = state_[kQuaternionOffset + i];
+  }
+  quaternion_i2b_.Normalize();
+  for (size_t i = 0; i < number_of_joints; i++) {
+    joint_angles_rad_[i] = state_[kJointOffset + i];
+    joint_angular_velocities_rad_s_[i] = state_[kJointOffset + number_of_joints + i];
+  }
+}
+
+void AttitudeMultiBody::CalcBaseVelocity() {
+  // The body frame origin moves so that the center of mass of the whole system is at rest
+  libra::Vector<6> base_velocity(0.0);
+  for (size_t i = 0; i < 3; i++) base_velocity[i] = angular_velocity_b_rad_s_[i];
+  const ArticulatedBodyMomentum momentum = multi_body_system_.CalcMomentum(base_velocity, joint_angles_rad_, joint_angular_velocities_rad_s_);
+  velocity_b_m_s_ = (-1.0 / multi_body_system_.GetTotalMass_kg()) * momentum.linear_momentum_Ns_;
+}
+
+void AttitudeMultiBody::CalcSystemAngularMomentum() {
+  libra::Vector<6> base_velocity;
+  for (size_t i = 0; i < 3; i++) {
+    base_velocity[i] = angular_velocity_b_rad_s_[i];
+    base_velocity[i + 3] = velocity_b_m_s_[i];
+  }
+  const ArticulatedBodyMomentum momentum = multi_body_system_.CalcMomentum(base_velocity, joint_angles_rad_, joint_angular_velocities_rad_s_);
+
+  angular_momentum_spacecraft_b_Nms_ = momentum.angular_momentum_Nms_;
+  angular_momentum_total_b_Nms_ = angular_momentum_reaction_wheel_b_Nms_ + angular_momentum_spacecraft_b_Nms_;
+  libra::Quaternion q_b2i = quaternion_i2b_.Conjugate();
+  angular_momentum_total_i_Nms_ = q_b2i.FrameConversion(angular_momentum_total_b_Nms_);
+  angular_momentum_total_Nms_ = angular_momentum_total_i_Nms_.CalcNorm();
+
+  kinetic_energy_J_ = momentum.kinetic_energy_J_;
+}
+
+void AttitudeMultiBody::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Attitude::SaveSnapshot(snapshot);
+  snapshot.Write(current_propagation_time_s_);
+  snapshot.Write(velocity_b_m_s_);
+  snapshot.Write(joint_angles_rad_);
+  snapshot.Write(joint_angular_velocities_rad_s_);
+  snapshot.Write(joint_torques_Nm_);
+}
+
+void AttitudeMultiBody::LoadSnapshot(SnapshotReader& snapshot) {
+  Attitude::LoadSnapshot(snapshot);
+  snapshot.Read(current_propagation_time_s_);
+  snapshot.Read(velocity_b_m_s_);
+  const size_t number_of_joints = joint_angles_rad_.size();
+  snapshot.Read(joint_angles_rad_);
+  snapshot.Read(joint_angular_velocities_rad_s_);
+  snapshot.Read(joint_torques_Nm_);
+  if (joint_angles_rad_.size() != number_of_joints || joint_angular_velocities_rad_s_.size() != number_of_joints ||
+      joint_torques_Nm_.size() != number_of_joints) {
+    throw std::invalid_argument("Snapshot is made with the different number of joints.");
+  }
+}
@@ -0,0 +1,174 @@
+/**
+ * @file attitude_multi_body.hpp
+ * @brief Class to calculate spacecraft attitude with the appendages connected by the revolute joints
+ */
+
+#ifndef S2E_DYNAMICS_ATTITUDE_ATTITUDE_MULTI_BODY_HPP_
+#define S2E_DYNAMICS_ATTITUDE_ATTITUDE_MULTI_BODY_HPP_
+
+#include <math_physics/multi_body/articulated_body_system.hpp>
+#include <simulation/spacecraft/structure/kinematics_parameters.hpp>
+#include <vector>
+
+#include "attitude.hpp"
+
+/**
+ * @class AttitudeMultiBody
+ * @brief Class to calculate spacecraft attitude with the appendages (e.g. deployable booms, sloshing pendulums, gimbaled payloads)
+ * @details The spacecraft bus is the free-floating base body of the tree-structured multi-body system, and its mass properties are
+ *          taken from Structure. The forward dynamics is calculated by the articulated-body algorithm and integrated with the Runge-Kutta
+ *          method. The torque and the reaction wheel angular momentum are applied to the spacecraft bus.
+ */
+class AttitudeMultiBody : public Attitude {
+ public:
+  /**
+   * @fn AttitudeMultiBody
+   * @brief Constructor
+   * @param [in] angular_velocity_b_rad_s: Initial value of spacecraft angular velocity of the body fixed frame [rad/s]
+   * @param [in] quaternion_i2b: Initial value of attitude quaternion from the inertial frame to the body fixed frame
+   * @param [in] kinematics_parameters: Kinematics parameters of the spacecraft bus
+   * @param [in] appendages: Appendages in the topological order. The parent ID 0 is the spacecraft bus and k is the k-th appendage.
+   * @param [in] joint_angles_rad: Initial joint angles of the appendages [rad]
+   * @param [in] joint_angular_velocities_rad_s: Initial joint angular velocities of the appendages [rad/s]
+   * @param [in] torque_b_Nm: Initial torque acting on the spacecraft in the body fixed frame [Nm]
+   * @param [in] propagation_step_s: Initial value of propagation step width [sec]
+   * @param [in] simulation_object_name: Simulation object name for Monte-Carlo simulation
+   */
+  AttitudeMultiBody(const libra::Vector<3>& angular_velocity_b_rad_s, const libra::Quaternion& quaternion_i2b,
+                    const KinematicsParameters& kinematics_parameters, const std::vector<ArticulatedBody>& appendages,
+                    const std::vector<double>& joint_angles_rad, const std::vector<double>& joint_angular_velocities_rad_s,
+                    const libra::Vector<3>& torque_b_Nm, const double propagation_step_s, const std::string& simulation_object_name = "attitude");
+  /**
+   * @fn ~AttitudeMultiBody
+   * @brief Destructor
+   */
+  ~AttitudeMultiBody() {}
+
+  // Getters
+  /**
+   * @fn GetNumberOfJoints
+   * @brief Return number of joints (appendages)
+   */
+  inline size_t GetNumberOfJoints() const { return joint_angles_rad_.size(); }
+  /**
+   * @fn GetJointAngle_rad
+   * @brief Return joint angle of the appendage [rad]
+   * @param [in] joint_id: Joint ID (the k-th appendage has the joint ID k - 1)
+   */
+  inline double GetJointAngle_rad(const size_t joint_id) const { return joint_angles_rad_[joint_id]; }
+  /**
+   * @fn GetJointAngularVelocity_rad_s
+   * @brief Return joint angular velocity of the appendage [rad/s]
+   * @param [in] joint_id: Joint ID (the k-th appendage has the joint ID k - 1)
+   */
+  inline double GetJointAngularVelocity_rad_s(const size_t joint_id) const { return joint_angular_velocities_rad_s_[joint_id]; }
+
+  // Setters
+  /**
+   * @fn SetJointTorque_Nm
+   * @brief Set torque of the joint actuator (e.g. gimbal motor) [Nm]
+   * @note The torque is kept until the next setting. The reaction torque is applied to the parent body.
+   * @param [in] joint_id: Joint ID (the k-th appendage has the joint ID k - 1)
+   * @param [in] torque_Nm: Joint torque [Nm]
+   */
+  inline void SetJointTorque_Nm(const size_t joint_id, const double torque_Nm) {
+    if (joint_id >= joint_torques_Nm_.size()) return;
+    joint_torques_Nm_[joint_id] = torque_Nm;
+  }
+
+  /**
+   * @fn Propagate
+   * @brief Attitude propagation
+   * @param [in] end_time_s: Propagation endtime [sec]
+   */
+  virtual void Propagate(const double end_time_s);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Attitude
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Attitude
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual bool AppendLogValue(ILogValueSink& sink) const;
+
+  /**
+   * @fn SetParameters
+   * @brief Set parameters for Monte-Carlo simulation
+   * @param [in] mc_simulator: Monte-Carlo simulation executor
+   */
+  virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
+
+ private:
+  const KinematicsParameters& kinematics_parameters_;  //!< Kinematics parameters of the spacecraft bus
+  size_t kinematics_parameters_version_;               //!< Version of the kinematics parameters used in the multi-body system
+  ArticulatedBodySystem multi_body_system_;            //!< Multi-body system with the spacecraft bus as the base body
+  double current_propagation_time_s_;                  //!< current time [sec]
+
+  libra::Vector<3> velocity_b_m_s_;                     //!< Velocity of the body fixed frame origin with respect to the center of mass [m/s]
+  std::vector<double> joint_angles_rad_;                //!< Joint angles [rad]
+  std::vector<double> joint_angular_velocities_rad_s_;  //!< Joint angular velocities [rad/s]
+  std::vector<double> joint_torques_Nm_;                //!< Joint torques by the actuators [Nm]
+
+  // Buffers for the Runge-Kutta method
+  std::vector<double> state_;                         //!< State vector (angular velocity, velocity, quaternion, joint angles, joint rates)
+  std::vector<double> stage_state_;                   //!< State vector at each stage
+  std::vector<double> k_[4];                          //!< Derivatives at each stage
+  std::vector<double> stage_joint_angles_rad_;        //!< Joint angles at each stage [rad]
+  std::vector<double> stage_joint_velocities_rad_s_;  //!< Joint angular velocities at each stage [rad/s]
+  std::vector<double> joint_accelerations_rad_s2_;    //!< Joint angular accelerations at each stage [rad/s2]
+
+  /**
+   * @fn MakeBodies
+   * @brief Make the body list of the multi-body system from the spacecraft bus and the appendages
+   */
+  static std::vector<ArticulatedBody> MakeBodies(const KinematicsParameters& kinematics_parameters, const std::vector<ArticulatedBody>& appendages);
+  /**
+   * @fn UpdateBaseMassProperties
+   * @brief Update the mass properties of the spacecraft bus only when the kinematics parameters are changed
+   */
+  void UpdateBaseMassProperties();
+  /**
+   * @fn CalcStateDerivative
+   * @brief Dynamics equation with kinematics
+   * @param [in] x: State vector
+   * @param [out] dxdt: Time derivative of the state vector
+   */
+  void CalcStateDerivative(const std::vector<double>& x, std::vector<double>& dxdt);
+  /**
+   * @fn RungeKuttaOneStep
+   * @brief Equation for one step of Runge-Kutta method
+   * @param [in] dt: Step width [sec]
+   */
+  void RungeKuttaOneStep(const double dt);
+  /**
+   * @fn CalcBaseVelocity
+   * @brief Calculate the velocity of the body fixed frame origin so that the center of mass of the whole system is at rest
+   */
+  void CalcBaseVelocity();
+  /**
+   * @fn CalcSystemAngularMomentum
+   * @brief Calculate angular momentum and kinetic energy including the appendages
+   */
+  void CalcSystemAngularMomentum();
+};
+
+#endif  // S2E_DYNAMICS_ATTITUDE_ATTITUDE_MULTI_BODY_HPP_
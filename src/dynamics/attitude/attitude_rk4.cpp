@@ -4,6 +4,7 @@
  */
 #include "attitude_rk4.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <logger/log_utility.hpp>
 #include <sstream>
@@ -20,7 +21,7 @@ AttitudeRk4::AttitudeRk4(const libra::Vector<3>& angular_velocity_b_rad_s, const
   current_propagation_time_s_ = 0.0;
   angular_momentum_reaction_wheel_b_Nms_ = libra::Vector<3>(0.0);
   previous_inertia_tensor_kgm2_ = inertia_tensor_kgm2_;
-  inverse_inertia_tensor_ = CalcInverseMatrix(inertia_tensor_kgm2_);
+  UpdateInverseInertiaTensor();
   CalcAngularMomentum();
 }
 
@@ -42,13 +43,21 @@ void AttitudeRk4::Propagate(const double end_time_s) {
   libra::Matrix<3, 3> dot_inertia_tensor =
       (1.0 / (end_time_s - current_propagation_time_s_)) * (inertia_tensor_kgm2_ - previous_inertia_tensor_kgm2_);
   torque_inertia_tensor_change_b_Nm_ = dot_inertia_tensor * angular_velocity_b_rad_s_;
-  inverse_inertia_tensor_ = CalcInverseMatrix(inertia_tensor_kgm2_);
+  UpdateInverseInertiaTensor();
 
   while (end_time_s - current_propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    RungeKuttaOneStep(current_propagation_time_s_, propagation_step_s_);
+    if (integration_method_ == AttitudeIntegrationMethod::kLieGroupRk4) {
+      LieGroupRungeKuttaOneStep(propagation_step_s_);
+    } else {
+      RungeKuttaOneStep(current_propagation_time_s_, propagation_step_s_);
+    }
     current_propagation_time_s_ += propagation_step_s_;
   }
-  RungeKuttaOneStep(current_propagation_time_s_, end_time_s - current_propagation_time_s_);
+  if (integration_method_ == AttitudeIntegrationMethod::kLieGroupRk4) {
+    LieGroupRungeKuttaOneStep(end_time_s - current_propagation_time_s_);
+  } else {
+    RungeKuttaOneStep(current_propagation_time_s_, end_time_s - current_propagation_time_s_);
+  }
 
   // Update information
   current_propagation_time_s_ = end_time_s;
@@ -88,9 +97,7 @@ libra::Vector<7> AttitudeRk4::AttitudeDynamicsAndKinematics(libra::Vector<7> x,
   for (int i = 0; i < 3; i++) {
     omega_b[i] = x[i];
   }
-  libra::Vector<3> angular_momentum_total_b_Nms = (previous_inertia_tensor_kgm2_ * omega_b) + angular_momentum_reaction_wheel_b_Nms_;
-  libra::Vector<3> rhs =
-      inverse_inertia_tensor_ * (torque_b_Nm_ - libra::OuterProduct(omega_b, angular_momentum_total_b_Nms) - torque_inertia_tensor_change_b_Nm_);
+  libra::Vector<3> rhs = CalcAngularAcceleration_b_rad_s2(omega_b);
 
   for (int i = 0; i < 3; ++i) {
     dxdt[i] = rhs[i];
@@ -101,7 +108,8 @@ libra::Vector<7> AttitudeRk4::AttitudeDynamicsAndKinematics(libra::Vector<7> x,
     quaternion_i2b[i] = x[i + 3];
   }
 
-  libra::Vector<4> d_quaternion = 0.5 * CalcAngularVelocityMatrix(omega_b) * quaternion_i2b;
+  // The factor is applied to the product vector instead of the 4x4 matrix
+  libra::Vector<4> d_quaternion = 0.5 * (CalcAngularVelocityMatrix(omega_b) * quaternion_i2b);
 
   for (int i = 0; i < 4; i++) {
     dxdt[i + 3] = d_quaternion[i];
@@ -110,6 +118,12 @@ libra::Vector<7> AttitudeRk4::AttitudeDynamicsAndKinematics(libra::Vector<7> x,
   return dxdt;
 }
 
+libra::Vector<3> AttitudeRk4::CalcAngularAcceleration_b_rad_s2(const libra::Vector<3>& angular_velocity_b_rad_s) const {
+  libra::Vector<3> angular_momentum_total_b_Nms = (previous_inertia_tensor_kgm2_ * angular_velocity_b_rad_s) + angular_momentum_reaction_wheel_b_Nms_;
+  return inverse_inertia_tensor_ *
+         (torque_b_Nm_ - libra::OuterProduct(angular_velocity_b_rad_s, angular_momentum_total_b_Nms) - torque_inertia_tensor_change_b_Nm_);
+}
+
 void AttitudeRk4::RungeKuttaOneStep(double t, double dt) {
   libra::Vector<7> x;
   for (int i = 0; i < 3; i++) {
@@ -119,21 +133,25 @@ void AttitudeRk4::RungeKuttaOneStep(double t, double dt) {
     x[i + 3] = quaternion_i2b_[i];
   }
 
+  // The stages are written into the buffers in place to avoid the temporary vectors in each step
+  const double half_dt = dt / 2.0;
   libra::Vector<7> k1, k2, k3, k4;
-  libra::Vector<7> xk2, xk3, xk4;
+  libra::Vector<7> stage_x;
 
   k1 = AttitudeDynamicsAndKinematics(x, t);
-  xk2 = x + (dt / 2.0) * k1;
+  for (size_t i = 0; i < 7; i++) stage_x[i] = x[i] + half_dt * k1[i];
 
-  k2 = AttitudeDynamicsAndKinematics(xk2, (t + dt / 2.0));
-  xk3 = x + (dt / 2.0) * k2;
+  k2 = AttitudeDynamicsAndKinematics(stage_x, (t + half_dt));
+  for (size_t i = 0; i < 7; i++) stage_x[i] = x[i] + half_dt * k2[i];
 
-  k3 = AttitudeDynamicsAndKinematics(xk3, (t + dt / 2.0));
-  xk4 = x + dt * k3;
+  k3 = AttitudeDynamicsAndKinematics(stage_x, (t + half_dt));
+  for (size_t i = 0; i < 7; i++) stage_x[i] = x[i] + dt * k3[i];
 
-  k4 = AttitudeDynamicsAndKinematics(xk4, (t + dt));
+  k4 = AttitudeDynamicsAndKinematics(stage_x, (t + dt));
 
-  libra::Vector<7> next_x = x + (dt / 6.0) * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+  const double sixth_dt = dt / 6.0;
+  libra::Vector<7> next_x;
+  for (size_t i = 0; i < 7; i++) next_x[i] = x[i] + sixth_dt * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
 
   for (int i = 0; i < 3; i++) {
     angular_velocity_b_rad_s_[i] = next_x[i];
@@ -143,3 +161,74 @@ void AttitudeRk4::RungeKuttaOneStep(double t, double dt) {
   }
   quaternion_i2b_.Normalize();
 }
+
+void AttitudeRk4::LieGroupRungeKuttaOneStep(const double dt) {
+  // Derivative of the rotation vector u in the body frame (Bortz equation)
+  // du/dt = w + u x w / 2 + c(|u|) u x (u x w), c = (1 - (|u| / 2) cot(|u| / 2)) / |u|^2
+  auto calc_rotation_vector_derivative = [](const libra::Vector<3>& rotation_vector_rad, const libra::Vector<3>& angular_velocity_b_rad_s) {
+    const double angle_rad = rotation_vector_rad.CalcNorm();
+    double coefficient;
+    if (angle_rad < 1.0e-4) {
+      coefficient = 1.0 / 12.0 + angle_rad * angle_rad / 720.0;
+    } else {
+      const double half_angle_rad = 0.5 * angle_rad;
+      coefficient = (1.0 - half_angle_rad * cos(half_angle_rad) / sin(half_angle_rad)) / (angle_rad * angle_rad);
+    }
+    const libra::Vector<3> cross = libra::OuterProduct(rotation_vector_rad, angular_velocity_b_rad_s);
+    return angular_velocity_b_rad_s + 0.5 * cross + coefficient * libra::OuterProduct(rotation_vector_rad, cross);
+  };
+
+  const double half_dt = dt / 2.0;
+  const libra::Vector<3> omega1 = angular_velocity_b_rad_s_;
+
+  // The rotation vector is zero at the first stage
+  const libra::Vector<3> d_omega1 = CalcAngularAcceleration_b_rad_s2(omega1);
+  const libra::Vector<3> d_rotation1 = omega1;
+
+  const libra::Vector<3> omega2 = omega1 + half_dt * d_omega1;
+  const libra::Vector<3> d_omega2 = CalcAngularAcceleration_b_rad_s2(omega2);
+  const libra::Vector<3> d_rotation2 = calc_rotation_vector_derivative(half_dt * d_rotation1, omega2);
+
+  const libra::Vector<3> omega3 = omega1 + half_dt * d_omega2;
+  const libra::Vector<3> d_omega3 = CalcAngularAcceleration_b_rad_s2(omega3);
+  const libra::Vector<3> d_rotation3 = calc_rotation_vector_derivative(half_dt * d_rotation2, omega3);
+
+  const libra::Vector<3> omega4 = omega1 + dt * d_omega3;
+  const libra::Vector<3> d_omega4 = CalcAngularAcceleration_b_rad_s2(omega4);
+  const libra::Vector<3> d_rotation4 = calc_rotation_vector_derivative(dt * d_rotation3, omega4);
+
+  const double sixth_dt = dt / 6.0;
+  angular_velocity_b_rad_s_ = omega1 + sixth_dt * (d_omega1 + 2.0 * d_omega2 + 2.0 * d_omega3 + d_omega4);
+  const libra::Vector<3> rotation_vector_rad = sixth_dt * (d_rotation1 + 2.0 * d_rotation2 + 2.0 * d_rotation3 + d_rotation4);
+
+  // Exponential map of the rotation vector
+  const double angle_rad = rotation_vector_rad.CalcNorm();
+  libra::Quaternion delta_quaternion(0.0, 0.0, 0.0, 1.0);
+  if (angle_rad > 0.0) delta_quaternion = libra::Quaternion((1.0 / angle_rad) * rotation_vector_rad, angle_rad);
+  quaternion_i2b_ = quaternion_i2b_ * delta_quaternion;
+}
+
+void AttitudeRk4::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Attitude::SaveSnapshot(snapshot);
+  snapshot.Write(current_propagation_time_s_);
+  snapshot.Write(previous_inertia_tensor_kgm2_);
+  snapshot.Write(torque_inertia_tensor_change_b_Nm_);
+}
+
+void AttitudeRk4::LoadSnapshot(SnapshotReader& snapshot) {
+  Attitude::LoadSnapshot(snapshot);
+  snapshot.Read(current_propagation_time_s_);
+  snapshot.Read(previous_inertia_tensor_kgm2_);
+  snapshot.Read(torque_inertia_tensor_change_b_Nm_);
+}
+
+AttitudeIntegrationMethod SetAttitudeIntegrationMethod(const std::string integration_method) {
+  if (integration_method == "RK4" || integration_method == "") {
+    return AttitudeIntegrationMethod::kRk4;
+  } else if (integration_method == "LIE_GROUP_RK4") {
+    return AttitudeIntegrationMethod::kLieGroupRk4;
+  } else {
+    std::cout << "[Warning] attitude integration_method: " << integration_method << " is not supported. RK4 is used." << std::endl;
+    return AttitudeIntegrationMethod::kRk4;
+  }
+}
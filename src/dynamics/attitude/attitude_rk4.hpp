@@ -8,6 +8,15 @@
 
 #include "attitude.hpp"
 
+/**
+ * @enum AttitudeIntegrationMethod
+ * @brief Numerical integration method of AttitudeRk4
+ */
+enum class AttitudeIntegrationMethod {
+  kRk4 = 0,      //!< Classical RK4 of the angular velocity and the quaternion components with the normalization
+  kLieGroupRk4,  //!< RK4 of the angular velocity and Runge-Kutta-Munthe-Kaas method of the quaternion on the rotation group
+};
+
 /**
  * @class AttitudeRk4
  * @brief Class to calculate spacecraft attitude with Runge-Kutta method
@@ -39,6 +48,16 @@ class AttitudeRk4 : public Attitude {
    * @param [in] end_time_s: Propagation endtime [sec]
    */
   virtual void Propagate(const double end_time_s);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Attitude
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Attitude
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
 
   /**
    * @fn SetParameters
@@ -47,11 +66,24 @@ class AttitudeRk4 : public Attitude {
    */
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
 
+  /**
+   * @fn SetIntegrationMethod
+   * @brief Set numerical integration method
+   * @note The Lie group method keeps the unit norm of the quaternion without the normalization, and its attitude error does not grow with
+   *       the rotation angle in a step, so larger steps are allowed for the spinning spacecraft.
+   */
+  inline void SetIntegrationMethod(const AttitudeIntegrationMethod integration_method) { integration_method_ = integration_method; }
+  /**
+   * @fn GetIntegrationMethod
+   * @brief Return numerical integration method
+   */
+  inline AttitudeIntegrationMethod GetIntegrationMethod() const { return integration_method_; }
+
  private:
-  double current_propagation_time_s_;                   //!< current time [sec]
-  libra::Matrix<3, 3> inverse_inertia_tensor_;          //!< Inverse of inertia tensor
-  libra::Matrix<3, 3> previous_inertia_tensor_kgm2_;    //!< Previous inertia tensor [kgm2]
-  libra::Vector<3> torque_inertia_tensor_change_b_Nm_;  //!< Torque generated by inertia tensor change [Nm]
+  double current_propagation_time_s_;                                               //!< current time [sec]
+  libra::Matrix<3, 3> previous_inertia_tensor_kgm2_;                                //!< Previous inertia tensor [kgm2]
+  libra::Vector<3> torque_inertia_tensor_change_b_Nm_;                              //!< Torque generated by inertia tensor change [Nm]
+  AttitudeIntegrationMethod integration_method_ = AttitudeIntegrationMethod::kRk4;  //!< Numerical integration method
 
   /**
    * @fn CalcAngularVelocityMatrix
@@ -66,6 +98,13 @@ class AttitudeRk4 : public Attitude {
    * @param [in] t: Unused TODO: remove?
    */
   libra::Vector<7> AttitudeDynamicsAndKinematics(libra::Vector<7> x, double t);
+  /**
+   * @fn CalcAngularAcceleration_b_rad_s2
+   * @brief Dynamics equation of the angular velocity
+   * @param [in] angular_velocity_b_rad_s: Angular velocity [rad/s]
+   * @return Angular acceleration [rad/s2]
+   */
+  libra::Vector<3> CalcAngularAcceleration_b_rad_s2(const libra::Vector<3>& angular_velocity_b_rad_s) const;
   /**
    * @fn RungeKuttaOneStep
    * @brief Equation for one step of Runge-Kutta method
@@ -73,6 +112,20 @@ class AttitudeRk4 : public Attitude {
    * @param [in] dt: Step width [sec]
    */
   void RungeKuttaOneStep(double t, double dt);
+  /**
+   * @fn LieGroupRungeKuttaOneStep
+   * @brief One step of the Runge-Kutta-Munthe-Kaas method
+   * @details The attitude after the step is q = q0 * Exp(u), where u is the rotation vector in the body frame at the beginning of the step.
+   *          The rotation vector is integrated with RK4 of its kinematics (Bortz equation), so the quaternion stays on the unit sphere.
+   * @param [in] dt: Step width [sec]
+   */
+  void LieGroupRungeKuttaOneStep(const double dt);
 };
 
+/**
+ * @fn SetAttitudeIntegrationMethod
+ * @brief Convert the name of the integration method (RK4 or LIE_GROUP_RK4) to AttitudeIntegrationMethod
+ */
+AttitudeIntegrationMethod SetAttitudeIntegrationMethod(const std::string integration_method);
+
 #endif  // S2E_DYNAMICS_ATTITUDE_ATTITUDE_RK4_HPP_
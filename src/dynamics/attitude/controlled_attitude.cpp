@@ -94,7 +94,7 @@ libra::Vector<3> ControlledAttitude::CalcTargetDirection_i(AttitudeControlMode m
   } else if (mode == AttitudeControlMode::kVelocityDirectionPointing) {
     direction = orbit_->GetVelocity_i_m_s();
   } else if (mode == AttitudeControlMode::kGroundSpeedDirectionPointing) {
-    libra::Matrix<3, 3> dcm_ecef2eci = local_celestial_information_->GetGlobalInformation().GetEarthRotation().GetDcmJ2000ToEcef().Transpose();
+    libra::Matrix<3, 3> dcm_ecef2eci = local_celestial_information_->GetGlobalInformation().GetEarthRotation().GetDcmEcefToJ2000();
     direction = dcm_ecef2eci * orbit_->GetVelocity_ecef_m_s();
   } else if (mode == AttitudeControlMode::kOrbitNormalPointing) {
     direction = OuterProduct(orbit_->GetPosition_i_m(), orbit_->GetVelocity_i_m_s());
@@ -166,8 +166,8 @@ void ControlledAttitude::CalcAngularVelocity(const double current_time_s) {
       angular_velocity_b_rad_s_[i] = q_diff[i];
       angular_acc_b_rad_s2_[i] = (previous_omega_b_rad_s_[i] - angular_velocity_b_rad_s_[i]) / time_diff_sec;
     }
-    libra::Matrix<3, 3> inv_inertia_tensor = CalcInverseMatrix(inertia_tensor_kgm2_);
-    controlled_torque_b_Nm = inv_inertia_tensor * angular_acc_b_rad_s2_;
+    UpdateInverseInertiaTensor();
+    controlled_torque_b_Nm = inverse_inertia_tensor_ * angular_acc_b_rad_s2_;
   } else {
     angular_velocity_b_rad_s_ = libra::Vector<3>(0.0);
     controlled_torque_b_Nm = libra::Vector<3>(0.0);
@@ -179,3 +179,23 @@ void ControlledAttitude::CalcAngularVelocity(const double current_time_s) {
   previous_quaternion_i2b_ = quaternion_i2b_;
   previous_omega_b_rad_s_ = angular_velocity_b_rad_s_;
 }
+
+void ControlledAttitude::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Attitude::SaveSnapshot(snapshot);
+  snapshot.Write(main_mode_);
+  snapshot.Write(sub_mode_);
+  snapshot.Write(main_target_direction_b_);
+  snapshot.Write(sub_target_direction_b_);
+  snapshot.Write(previous_quaternion_i2b_);
+  snapshot.Write(previous_omega_b_rad_s_);
+}
+
+void ControlledAttitude::LoadSnapshot(SnapshotReader& snapshot) {
+  Attitude::LoadSnapshot(snapshot);
+  snapshot.Read(main_mode_);
+  snapshot.Read(sub_mode_);
+  snapshot.Read(main_target_direction_b_);
+  snapshot.Read(sub_target_direction_b_);
+  snapshot.Read(previous_quaternion_i2b_);
+  snapshot.Read(previous_omega_b_rad_s_);
+}
@@ -97,6 +97,16 @@ class ControlledAttitude : public Attitude {
    * @param [in] end_time_s: Propagation endtime [sec]
    */
   virtual void Propagate(const double end_time_s);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Attitude
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Attitude
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
 
  private:
   AttitudeControlMode main_mode_;              //!< Main control mode
@@ -0,0 +1,43 @@
+/**
+ * @file frame_chain_cache.cpp
+ * @brief Cache of the frame conversions from the inertial and body frames to the component frames
+ */
+
+#include "frame_chain_cache.hpp"
+
+FrameChainCache::FrameChainCache(const Attitude* attitude) : attitude_(attitude) {
+  quaternion_i2b_ = attitude_->GetQuaternion_i2b();
+  dcm_i2b_ = quaternion_i2b_.ConvertToDcm();
+}
+
+size_t FrameChainCache::RegisterComponentFrame(const libra::Quaternion& quaternion_b2c) {
+  component_frames_.emplace_back();
+  const size_t frame_id = component_frames_.size() - 1;
+  SetQuaternion_b2c(frame_id, quaternion_b2c);
+  return frame_id;
+}
+
+void FrameChainCache::SetQuaternion_b2c(const size_t frame_id, const libra::Quaternion& quaternion_b2c) {
+  ComponentFrame& component_frame = component_frames_[frame_id];
+  component_frame.quaternion_b2c_ = quaternion_b2c;
+  component_frame.dcm_b2c_ = quaternion_b2c.ConvertToDcm();
+  component_frame.attitude_revision_ = 0;
+}
+
+const FrameChainCache::ComponentFrame& FrameChainCache::GetComposedFrame(const size_t frame_id) const {
+  const libra::Quaternion& quaternion_i2b = attitude_->GetQuaternion_i2b();
+  if (quaternion_i2b[0] != quaternion_i2b_[0] || quaternion_i2b[1] != quaternion_i2b_[1] || quaternion_i2b[2] != quaternion_i2b_[2] ||
+      quaternion_i2b[3] != quaternion_i2b_[3]) {
+    quaternion_i2b_ = quaternion_i2b;
+    dcm_i2b_ = quaternion_i2b_.ConvertToDcm();
+    attitude_revision_++;
+  }
+
+  ComponentFrame& component_frame = component_frames_[frame_id];
+  if (component_frame.attitude_revision_ != attitude_revision_) {
+    component_frame.dcm_i2c_ = component_frame.dcm_b2c_ * dcm_i2b_;
+    component_frame.quaternion_i2c_ = quaternion_i2b_ * component_frame.quaternion_b2c_;
+    component_frame.attitude_revision_ = attitude_revision_;
+  }
+  return component_frame;
+}
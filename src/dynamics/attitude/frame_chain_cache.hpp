@@ -0,0 +1,144 @@
+/**
+ * @file frame_chain_cache.hpp
+ * @brief Cache of the frame conversions from the inertial and body frames to the component frames
+ */
+
+#ifndef S2E_DYNAMICS_ATTITUDE_FRAME_CHAIN_CACHE_HPP_
+#define S2E_DYNAMICS_ATTITUDE_FRAME_CHAIN_CACHE_HPP_
+
+#include <math_physics/math/matrix.hpp>
+#include <math_physics/math/matrix_vector.hpp>
+#include <math_physics/math/quaternion.hpp>
+#include <math_physics/math/vector.hpp>
+#include <vector>
+
+#include "attitude.hpp"
+
+/**
+ * @class FrameChainCache
+ * @brief Cache of the composed frame conversions of the component frames fixed on the body
+ * @details The components register their fixed body to component quaternions and convert the vectors with a single 3x3 DCM instead of
+ *          two quaternion frame conversions. The inertial to component DCM of each component is composed at the first query after the
+ *          attitude changes, and it is reused until the attitude or the component frame changes. The attitude change is detected by the
+ *          quaternion itself, so the cache is valid even when the attitude is set outside of the dynamics update.
+ * @note The queries are not thread safe since they update the cache. The components of a spacecraft are updated in a single thread.
+ */
+class FrameChainCache {
+ public:
+  /**
+   * @fn FrameChainCache
+   * @brief Constructor
+   * @param [in] attitude: Attitude of the spacecraft. It should be alive while this object is used.
+   */
+  explicit FrameChainCache(const Attitude* attitude);
+
+  /**
+   * @fn RegisterComponentFrame
+   * @brief Register a component frame fixed on the body
+   * @param [in] quaternion_b2c: Quaternion from the body frame to the component frame
+   * @return ID of the component frame
+   */
+  size_t RegisterComponentFrame(const libra::Quaternion& quaternion_b2c);
+  /**
+   * @fn SetQuaternion_b2c
+   * @brief Change the alignment of the component frame (e.g., structure change)
+   * @param [in] frame_id: ID of the component frame
+   * @param [in] quaternion_b2c: Quaternion from the body frame to the component frame
+   */
+  void SetQuaternion_b2c(const size_t frame_id, const libra::Quaternion& quaternion_b2c);
+
+  /**
+   * @fn GetDcm_b2c
+   * @brief Return the DCM from the body frame to the component frame
+   * @param [in] frame_id: ID of the component frame
+   */
+  inline const libra::Matrix<3, 3>& GetDcm_b2c(const size_t frame_id) const { return component_frames_[frame_id].dcm_b2c_; }
+  /**
+   * @fn GetDcm_i2c
+   * @brief Return the DCM from the inertial frame to the component frame at the current attitude
+   * @param [in] frame_id: ID of the component frame
+   */
+  inline const libra::Matrix<3, 3>& GetDcm_i2c(const size_t frame_id) const { return GetComposedFrame(frame_id).dcm_i2c_; }
+  /**
+   * @fn GetQuaternion_i2c
+   * @brief Return the quaternion from the inertial frame to the component frame at the current attitude
+   * @param [in] frame_id: ID of the component frame
+   */
+  inline const libra::Quaternion& GetQuaternion_i2c(const size_t frame_id) const { return GetComposedFrame(frame_id).quaternion_i2c_; }
+
+  /**
+   * @fn ConvertBodyToComponent
+   * @brief Convert a vector in the body frame to the component frame
+   * @param [in] frame_id: ID of the component frame
+   * @param [in] vector_b: Vector in the body frame
+   */
+  inline libra::Vector<3> ConvertBodyToComponent(const size_t frame_id, const libra::Vector<3>& vector_b) const {
+    return GetDcm_b2c(frame_id) * vector_b;
+  }
+  /**
+   * @fn ConvertComponentToBody
+   * @brief Convert a vector in the component frame to the body frame
+   * @param [in] frame_id: ID of the component frame
+   * @param [in] vector_c: Vector in the component frame
+   */
+  inline libra::Vector<3> ConvertComponentToBody(const size_t frame_id, const libra::Vector<3>& vector_c) const {
+    return GetDcm_b2c(frame_id).Transpose() * vector_c;
+  }
+  /**
+   * @fn ConvertInertialToComponent
+   * @brief Convert a vector in the inertial frame to the component frame at the current attitude
+   * @param [in] frame_id: ID of the component frame
+   * @param [in] vector_i: Vector in the inertial frame
+   */
+  inline libra::Vector<3> ConvertInertialToComponent(const size_t frame_id, const libra::Vector<3>& vector_i) const {
+    return GetDcm_i2c(frame_id) * vector_i;
+  }
+  /**
+   * @fn ConvertComponentToInertial
+   * @brief Convert a vector in the component frame to the inertial frame at the current attitude
+   * @param [in] frame_id: ID of the component frame
+   * @param [in] vector_c: Vector in the component frame
+   */
+  inline libra::Vector<3> ConvertComponentToInertial(const size_t frame_id, const libra::Vector<3>& vector_c) const {
+    return GetDcm_i2c(frame_id).Transpose() * vector_c;
+  }
+
+  /**
+   * @fn GetNumberOfComponentFrames
+   * @brief Return the number of the registered component frames
+   */
+  inline size_t GetNumberOfComponentFrames() const { return component_frames_.size(); }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the cache including the component frames [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const { return sizeof(*this) + component_frames_.capacity() * sizeof(ComponentFrame); }
+
+ private:
+  /**
+   * @struct ComponentFrame
+   * @brief Fixed alignment and the composed conversions of a component frame
+   */
+  struct ComponentFrame {
+    libra::Quaternion quaternion_b2c_;  //!< Quaternion from the body frame to the component frame
+    libra::Matrix<3, 3> dcm_b2c_;       //!< DCM from the body frame to the component frame
+    libra::Quaternion quaternion_i2c_;  //!< Quaternion from the inertial frame to the component frame
+    libra::Matrix<3, 3> dcm_i2c_;       //!< DCM from the inertial frame to the component frame
+    size_t attitude_revision_ = 0;      //!< Attitude revision of the composed conversions. Zero when they are not composed.
+  };
+
+  const Attitude* attitude_;                              //!< Attitude of the spacecraft
+  mutable std::vector<ComponentFrame> component_frames_;  //!< Registered component frames
+  mutable libra::Quaternion quaternion_i2b_;              //!< Attitude quaternion of the cached conversions
+  mutable libra::Matrix<3, 3> dcm_i2b_;                   //!< DCM from the inertial frame to the body frame of the cached conversions
+  mutable size_t attitude_revision_ = 1;                  //!< Revision incremented when the attitude changes
+
+  /**
+   * @fn GetComposedFrame
+   * @brief Return the component frame after composing the conversions for the current attitude
+   * @param [in] frame_id: ID of the component frame
+   */
+  const ComponentFrame& GetComposedFrame(const size_t frame_id) const;
+};
+
+#endif  // S2E_DYNAMICS_ATTITUDE_FRAME_CHAIN_CACHE_HPP_
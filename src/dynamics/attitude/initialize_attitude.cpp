@@ -7,14 +7,16 @@
 #include <setting_file_reader/initialize_file_access.hpp>
 
 Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCelestialInformation* local_celestial_information,
-                       const double step_width_s, const libra::Matrix<3, 3>& inertia_tensor_kgm2, const int spacecraft_id) {
+                       const double step_width_s, const KinematicsParameters& kinematics_parameters, const int spacecraft_id) {
   IniAccess ini_file(file_name);
+  const libra::Matrix<3, 3>& inertia_tensor_kgm2 = kinematics_parameters.GetInertiaTensor_b_kgm2();
   const char* section_ = "ATTITUDE";
   std::string mc_name = "attitude" + std::to_string(spacecraft_id);
   Attitude* attitude;
 
   const std::string propagate_mode = ini_file.ReadString(section_, "propagate_mode");
   const std::string initialize_mode = ini_file.ReadString(section_, "initialize_mode");
+  const AttitudeIntegrationMethod integration_method = SetAttitudeIntegrationMethod(ini_file.ReadString(section_, "integration_method"));
 
   if (propagate_mode == "RK4" && initialize_mode == "MANUAL") {
     // RK4 propagator
@@ -25,7 +27,9 @@ Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCel
     libra::Vector<3> torque_b;
     ini_file.ReadVector(section_, "initial_torque_b_Nm", torque_b);
 
-    attitude = new AttitudeRk4(omega_b, quaternion_i2b, inertia_tensor_kgm2, torque_b, step_width_s, mc_name);
+    AttitudeRk4* attitude_rk4 = new AttitudeRk4(omega_b, quaternion_i2b, inertia_tensor_kgm2, torque_b, step_width_s, mc_name);
+    attitude_rk4->SetIntegrationMethod(integration_method);
+    attitude = attitude_rk4;
   } else if (propagate_mode == "RK4" && initialize_mode == "CONTROLLED") {
     // Initialize with Controlled attitude (attitude_tmp temporary used)
     IniAccess ini_file_ca(file_name);
@@ -48,7 +52,51 @@ Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCel
     libra::Vector<3> omega_b = libra::Vector<3>(0.0);
     libra::Vector<3> torque_b = libra::Vector<3>(0.0);
 
-    attitude = new AttitudeRk4(omega_b, quaternion_i2b, inertia_tensor_kgm2, torque_b, step_width_s, mc_name);
+    AttitudeRk4* attitude_rk4 = new AttitudeRk4(omega_b, quaternion_i2b, inertia_tensor_kgm2, torque_b, step_width_s, mc_name);
+    attitude_rk4->SetIntegrationMethod(integration_method);
+    attitude = attitude_rk4;
+  } else if (propagate_mode == "MULTI_BODY" && initialize_mode == "MANUAL") {
+    // Multi-body propagator with the appendages
+    libra::Vector<3> omega_b;
+    ini_file.ReadVector(section_, "initial_angular_velocity_b_rad_s", omega_b);
+    libra::Quaternion quaternion_i2b;
+    ini_file.ReadQuaternion(section_, "initial_quaternion_i2b", quaternion_i2b);
+    libra::Vector<3> torque_b;
+    ini_file.ReadVector(section_, "initial_torque_b_Nm", torque_b);
+
+    const char* section_mb_ = "MULTI_BODY_ATTITUDE";
+    const int number_of_appendages = ini_file.ReadInt(section_mb_, "number_of_appendages");
+    std::vector<ArticulatedBody> appendages;
+    std::vector<double> joint_angles_rad, joint_angular_velocities_rad_s;
+    for (int i = 1; i <= number_of_appendages; i++) {
+      const std::string prefix = "appendage" + std::to_string(i) + "_";
+      ArticulatedBody appendage;
+      const int parent_id = ini_file.ReadInt(section_mb_, (prefix + "parent_id").c_str());
+      if (parent_id < 0 || parent_id >= i) {
+        std::cerr << "ERROR: " << prefix << "parent_id should be 0 (spacecraft bus) or the ID of the former appendage." << std::endl;
+        std::cerr << "The parent is automatically set as the spacecraft bus" << std::endl;
+      }
+      appendage.parent_id_ = (parent_id < 0 || parent_id >= i) ? 0 : (size_t)parent_id;
+      ini_file.ReadVector(section_mb_, (prefix + "joint_position_parent_m").c_str(), appendage.joint_position_parent_m_);
+      ini_file.ReadVector(section_mb_, (prefix + "joint_axis").c_str(), appendage.joint_axis_);
+      appendage.joint_stiffness_Nm_rad_ = ini_file.ReadDouble(section_mb_, (prefix + "joint_stiffness_Nm_rad").c_str());
+      appendage.joint_damping_Nms_rad_ = ini_file.ReadDouble(section_mb_, (prefix + "joint_damping_Nms_rad").c_str());
+      appendage.mass_kg_ = ini_file.ReadDouble(section_mb_, (prefix + "mass_kg").c_str());
+      ini_file.ReadVector(section_mb_, (prefix + "center_of_mass_m").c_str(), appendage.center_of_mass_m_);
+      libra::Vector<9> inertia_tensor_vector;
+      ini_file.ReadVector(section_mb_, (prefix + "inertia_tensor_kgm2").c_str(), inertia_tensor_vector);
+      for (size_t row = 0; row < 3; row++) {
+        for (size_t column = 0; column < 3; column++) {
+          appendage.inertia_tensor_kgm2_[row][column] = inertia_tensor_vector[row * 3 + column];
+        }
+      }
+      appendages.push_back(appendage);
+      joint_angles_rad.push_back(ini_file.ReadDouble(section_mb_, (prefix + "initial_joint_angle_rad").c_str()));
+      joint_angular_velocities_rad_s.push_back(ini_file.ReadDouble(section_mb_, (prefix + "initial_joint_angular_velocity_rad_s").c_str()));
+    }
+
+    attitude = new AttitudeMultiBody(omega_b, quaternion_i2b, kinematics_parameters, appendages, joint_angles_rad, joint_angular_velocities_rad_s,
+                                     torque_b, step_width_s, mc_name);
   } else if (propagate_mode == "CONTROLLED") {
     // Controlled attitude
     IniAccess ini_file_ca(file_name);
@@ -77,7 +125,9 @@ Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCel
     libra::Vector<3> torque_b;
     ini_file.ReadVector(section_, "initial_torque_b_Nm", torque_b);
 
-    attitude = new AttitudeRk4(omega_b, quaternion_i2b, inertia_tensor_kgm2, torque_b, step_width_s, mc_name);
+    AttitudeRk4* attitude_rk4 = new AttitudeRk4(omega_b, quaternion_i2b, inertia_tensor_kgm2, torque_b, step_width_s, mc_name);
+    attitude_rk4->SetIntegrationMethod(integration_method);
+    attitude = attitude_rk4;
   }
 
   return attitude;
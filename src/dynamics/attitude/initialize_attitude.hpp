@@ -7,6 +7,7 @@
 #define S2E_DYNAMICS_ATTITUDE_INITIALIZE_ATTITUDE_HPP_
 
 #include "attitude.hpp"
+#include "attitude_multi_body.hpp"
 #include "attitude_rk4.hpp"
 #include "controlled_attitude.hpp"
 
@@ -17,10 +18,10 @@
  * @param [in] orbit: Orbit information
  * @param [in] local_celestial_information: Celestial information
  * @param [in] step_width_s: Step width [sec]
- * @param [in] inertia_tensor_kgm2: Inertia tensor [kg m^2]
+ * @param [in] kinematics_parameters: Kinematics parameters of the spacecraft
  * @param [in] spacecraft_id: Satellite ID
  */
 Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCelestialInformation* local_celestial_information,
-                       const double step_width_s, const libra::Matrix<3, 3>& inertia_tensor_kgm2, const int spacecraft_id);
+                       const double step_width_s, const KinematicsParameters& kinematics_parameters, const int spacecraft_id);
 
 #endif  // S2E_DYNAMICS_ATTITUDE_INITIALIZE_ATTITUDE_HPP_
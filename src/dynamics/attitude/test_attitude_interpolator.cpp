@@ -0,0 +1,170 @@
+/**
+ * @file test_attitude_interpolator.cpp
+ * @brief Test codes for AttitudeInterpolator class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "attitude_interpolator.hpp"
+#include "attitude_rk4.hpp"
+
+namespace {
+/**
+ * @fn CalcAngleError_rad
+ * @brief Return the rotation angle between the quaternions without the sign ambiguity [rad]
+ */
+double CalcAngleError_rad(const libra::Quaternion& quaternion, const libra::Quaternion& reference_quaternion) {
+  // The vector part of the difference keeps the precision for the small angle unlike acos of the inner product
+  const libra::Quaternion difference_quaternion = reference_quaternion.Conjugate() * quaternion;
+  const double sin_half_angle = sqrt(difference_quaternion[0] * difference_quaternion[0] + difference_quaternion[1] * difference_quaternion[1] +
+                                     difference_quaternion[2] * difference_quaternion[2]);
+  return 2.0 * atan2(sin_half_angle, fabs(difference_quaternion[3]));
+}
+
+/**
+ * @fn CalcMaxInterpolationError_rad
+ * @brief Interpolate the torque-free tumbling propagated with the small step, and return the maximum angle error between the updates [rad]
+ * @param [in] method: Interpolation method
+ * @param [in] update_interval_s: Interval of the attitude update given to the interpolator [s]
+ */
+double CalcMaxInterpolationError_rad(const AttitudeInterpolationMethod method, const double update_interval_s) {
+  libra::Matrix<3, 3> inertia_tensor_kgm2(0.0);
+  inertia_tensor_kgm2[0][0] = 0.1;
+  inertia_tensor_kgm2[1][1] = 0.2;
+  inertia_tensor_kgm2[2][2] = 0.3;
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[0] = 0.3;
+  angular_velocity_b_rad_s[1] = 0.5;
+  angular_velocity_b_rad_s[2] = -0.2;
+  AttitudeRk4 attitude(angular_velocity_b_rad_s, libra::Quaternion(0.0, 0.0, 0.0, 1.0), inertia_tensor_kgm2, libra::Vector<3>(0.0), 0.001,
+                       "attitude_interpolator_truth");
+
+  // Truth at every 0.01 s
+  const double sample_interval_s = 0.01;
+  const size_t samples_per_update = (size_t)(update_interval_s / sample_interval_s + 0.5);
+  const size_t number_of_updates = 20;
+  std::vector<libra::Quaternion> quaternions_i2b = {attitude.GetQuaternion_i2b()};
+  std::vector<libra::Vector<3>> angular_velocities_b_rad_s = {attitude.GetAngularVelocity_b_rad_s()};
+  for (size_t sample = 1; sample <= samples_per_update * number_of_updates; sample++) {
+    attitude.Propagate(sample * sample_interval_s);
+    quaternions_i2b.push_back(attitude.GetQuaternion_i2b());
+    angular_velocities_b_rad_s.push_back(attitude.GetAngularVelocity_b_rad_s());
+  }
+
+  AttitudeInterpolator interpolator(method);
+  interpolator.Reset(0.0, quaternions_i2b[0], angular_velocities_b_rad_s[0]);
+  double max_error_rad = 0.0;
+  for (size_t update = 1; update <= number_of_updates; update++) {
+    const size_t latest_sample = update * samples_per_update;
+    interpolator.Update(latest_sample * sample_interval_s, quaternions_i2b[latest_sample], angular_velocities_b_rad_s[latest_sample]);
+    for (size_t sample = latest_sample - samples_per_update; sample <= latest_sample; sample++) {
+      const double error_rad = CalcAngleError_rad(interpolator.CalcQuaternion_i2b(sample * sample_interval_s), quaternions_i2b[sample]);
+      max_error_rad = std::max(max_error_rad, error_rad);
+    }
+  }
+  return max_error_rad;
+}
+}  // namespace
+
+/**
+ * @brief Test for the interpolation with the constant angular velocity and the end points
+ */
+TEST(AttitudeInterpolator, ConstantAngularVelocity) {
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[0] = 0.2;
+  angular_velocity_b_rad_s[1] = -0.4;
+  angular_velocity_b_rad_s[2] = 0.1;
+  const libra::Quaternion initial_quaternion_i2b = libra::Quaternion(0.1, 0.2, 0.3, 0.9).Normalize();
+  auto calc_exact_quaternion_i2b = [&](const double time_s) {
+    const libra::Vector<3> rotation_vector_rad = time_s * angular_velocity_b_rad_s;
+    return initial_quaternion_i2b * libra::Quaternion((1.0 / rotation_vector_rad.CalcNorm()) * rotation_vector_rad, rotation_vector_rad.CalcNorm());
+  };
+
+  for (const AttitudeInterpolationMethod method : {AttitudeInterpolationMethod::kHermite, AttitudeInterpolationMethod::kSlerp}) {
+    AttitudeInterpolator interpolator(method);
+    interpolator.Reset(10.0, initial_quaternion_i2b, angular_velocity_b_rad_s);
+    EXPECT_DOUBLE_EQ(10.0, interpolator.GetPreviousTime_s());
+    EXPECT_DOUBLE_EQ(10.0, interpolator.GetLatestTime_s());
+    // The reset state is extrapolated with the angular velocity
+    EXPECT_LT(CalcAngleError_rad(interpolator.CalcQuaternion_i2b(10.5), calc_exact_quaternion_i2b(0.5)), 1e-12);
+
+    interpolator.Update(12.0, calc_exact_quaternion_i2b(2.0), angular_velocity_b_rad_s);
+    EXPECT_DOUBLE_EQ(10.0, interpolator.GetPreviousTime_s());
+    EXPECT_DOUBLE_EQ(12.0, interpolator.GetLatestTime_s());
+    for (double time_s = 9.0; time_s <= 13.0; time_s += 0.125) {
+      // The time before the previous state returns the previous state
+      const double expected_time_s = std::max(time_s, 10.0) - 10.0;
+      const libra::Quaternion expected_quaternion_i2b =
+          expected_time_s > 0.0 ? calc_exact_quaternion_i2b(expected_time_s) : initial_quaternion_i2b;
+      EXPECT_LT(CalcAngleError_rad(interpolator.CalcQuaternion_i2b(time_s), expected_quaternion_i2b), 1e-12) << "time " << time_s;
+    }
+  }
+}
+
+/**
+ * @brief Test for the accuracy of the interpolation of the torque-free tumbling
+ */
+TEST(AttitudeInterpolator, TumblingAccuracy) {
+  const double hermite_error_rad = CalcMaxInterpolationError_rad(AttitudeInterpolationMethod::kHermite, 0.5);
+  const double slerp_error_rad = CalcMaxInterpolationError_rad(AttitudeInterpolationMethod::kSlerp, 0.5);
+  // The angular velocity changes in the tumbling, so the Slerp with the constant angular velocity has the error
+  EXPECT_GT(slerp_error_rad, 0.0);
+  // The Hermite interpolation matches the angular velocities at both ends, and the error is the higher order of the interval
+  EXPECT_LT(hermite_error_rad, 0.05 * slerp_error_rad);
+  EXPECT_LT(hermite_error_rad, 1.0e-5);
+
+  // The error of the Hermite interpolation decreases with the fourth order of the interval
+  const double half_interval_hermite_error_rad = CalcMaxInterpolationError_rad(AttitudeInterpolationMethod::kHermite, 0.25);
+  EXPECT_LT(half_interval_hermite_error_rad, hermite_error_rad / 8.0);
+}
+
+/**
+ * @brief Test for the angular velocity, the batched calculation, and the snapshot round trip
+ */
+TEST(AttitudeInterpolator, AngularVelocityBatchAndSnapshot) {
+  libra::Vector<3> previous_angular_velocity_b_rad_s(0.0), latest_angular_velocity_b_rad_s(0.0);
+  previous_angular_velocity_b_rad_s[0] = 0.1;
+  latest_angular_velocity_b_rad_s[0] = 0.3;
+  latest_angular_velocity_b_rad_s[2] = -0.2;
+  AttitudeInterpolator interpolator;
+  EXPECT_EQ(AttitudeInterpolationMethod::kHermite, interpolator.GetMethod());
+  interpolator.Reset(0.0, libra::Quaternion(0.0, 0.0, 0.0, 1.0), previous_angular_velocity_b_rad_s);
+  interpolator.Update(1.0, libra::Quaternion(0.1, 0.0, -0.05, 1.0).Normalize(), latest_angular_velocity_b_rad_s);
+
+  // Linear interpolation, and the end values outside the interval
+  const libra::Vector<3> middle_angular_velocity_b_rad_s = interpolator.CalcAngularVelocity_b_rad_s(0.25);
+  EXPECT_DOUBLE_EQ(0.15, middle_angular_velocity_b_rad_s[0]);
+  EXPECT_DOUBLE_EQ(0.0, middle_angular_velocity_b_rad_s[1]);
+  EXPECT_DOUBLE_EQ(-0.05, middle_angular_velocity_b_rad_s[2]);
+  EXPECT_DOUBLE_EQ(0.1, interpolator.CalcAngularVelocity_b_rad_s(-1.0)[0]);
+  EXPECT_DOUBLE_EQ(0.3, interpolator.CalcAngularVelocity_b_rad_s(2.0)[0]);
+
+  const std::vector<double> times_s = {-0.5, 0.0, 0.3, 0.7, 1.0, 1.5};
+  std::vector<libra::Quaternion> quaternions_i2b(times_s.size());
+  std::vector<libra::Vector<3>> angular_velocities_b_rad_s(times_s.size());
+  interpolator.CalcQuaternions_i2b(times_s.data(), times_s.size(), quaternions_i2b.data());
+  interpolator.CalcAngularVelocities_b_rad_s(times_s.data(), times_s.size(), angular_velocities_b_rad_s.data());
+  for (size_t n = 0; n < times_s.size(); n++) {
+    const libra::Quaternion quaternion_i2b = interpolator.CalcQuaternion_i2b(times_s[n]);
+    const libra::Vector<3> angular_velocity_b_rad_s = interpolator.CalcAngularVelocity_b_rad_s(times_s[n]);
+    for (size_t i = 0; i < 4; i++) EXPECT_DOUBLE_EQ(quaternion_i2b[i], quaternions_i2b[n][i]);
+    for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(angular_velocity_b_rad_s[i], angular_velocities_b_rad_s[n][i]);
+  }
+
+  std::stringstream stream;
+  SnapshotWriter writer(stream);
+  interpolator.SaveSnapshot(writer);
+  ASSERT_TRUE(writer.IsGood());
+  AttitudeInterpolator restored_interpolator;
+  SnapshotReader reader(stream);
+  restored_interpolator.LoadSnapshot(reader);
+  for (const double time_s : times_s) {
+    const libra::Quaternion quaternion_i2b = interpolator.CalcQuaternion_i2b(time_s);
+    const libra::Quaternion restored_quaternion_i2b = restored_interpolator.CalcQuaternion_i2b(time_s);
+    for (size_t i = 0; i < 4; i++) EXPECT_DOUBLE_EQ(quaternion_i2b[i], restored_quaternion_i2b[i]);
+  }
+}
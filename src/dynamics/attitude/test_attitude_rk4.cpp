@@ -0,0 +1,187 @@
+/**
+ * @file test_attitude_rk4.cpp
+ * @brief Test codes for AttitudeRk4 class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "attitude_rk4.hpp"
+
+namespace {
+/**
+ * @fn CalcAngleError_rad
+ * @brief Return the rotation angle between the quaternions without the sign ambiguity [rad]
+ */
+double CalcAngleError_rad(const libra::Quaternion& quaternion, const libra::Quaternion& reference_quaternion) {
+  const libra::Quaternion difference_quaternion = reference_quaternion.Conjugate() * quaternion;
+  const double sin_half_angle = sqrt(difference_quaternion[0] * difference_quaternion[0] + difference_quaternion[1] * difference_quaternion[1] +
+                                     difference_quaternion[2] * difference_quaternion[2]);
+  return 2.0 * atan2(sin_half_angle, fabs(difference_quaternion[3]));
+}
+
+/**
+ * @fn GetInertiaTensor_kgm2
+ * @brief Return the diagonal inertia tensor with the different principal moments [kg m^2]
+ * @note The attitude refers the inertia tensor, so the tensor lives through the tests
+ */
+const libra::Matrix<3, 3>& GetInertiaTensor_kgm2() {
+  static libra::Matrix<3, 3> inertia_tensor_kgm2(0.0);
+  inertia_tensor_kgm2[0][0] = 0.1;
+  inertia_tensor_kgm2[1][1] = 0.2;
+  inertia_tensor_kgm2[2][2] = 0.3;
+  return inertia_tensor_kgm2;
+}
+
+/**
+ * @fn MakeAttitude
+ * @brief Make the attitude with the integration method
+ * @param [in] angular_velocity_b_rad_s: Initial angular velocity [rad/s]
+ * @param [in] torque_b_Nm: Constant torque [Nm]
+ * @param [in] propagation_step_s: Propagation step [s]
+ * @param [in] integration_method: Numerical integration method
+ * @param [in] name: Unique simulation object name
+ */
+std::unique_ptr<AttitudeRk4> MakeAttitude(const libra::Vector<3>& angular_velocity_b_rad_s, const libra::Vector<3>& torque_b_Nm,
+                                          const double propagation_step_s, const AttitudeIntegrationMethod integration_method,
+                                          const std::string& name) {
+  const libra::Quaternion quaternion_i2b = libra::Quaternion(0.1, -0.2, 0.3, 0.9).Normalize();
+  auto attitude =
+      std::make_unique<AttitudeRk4>(angular_velocity_b_rad_s, quaternion_i2b, GetInertiaTensor_kgm2(), torque_b_Nm, propagation_step_s, name);
+  attitude->SetIntegrationMethod(integration_method);
+  return attitude;
+}
+}  // namespace
+
+/**
+ * @brief Test for the snapshot round trip
+ */
+TEST(AttitudeRk4, Snapshot) {
+  libra::Matrix<3, 3> inertia_tensor_kgm2(0.0);
+  inertia_tensor_kgm2[0][0] = 0.1;
+  inertia_tensor_kgm2[1][1] = 0.2;
+  inertia_tensor_kgm2[2][2] = 0.3;
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[0] = 0.05;
+  angular_velocity_b_rad_s[1] = -0.02;
+  libra::Vector<3> torque_b_Nm(0.0);
+  torque_b_Nm[2] = 1.0e-4;
+
+  AttitudeRk4 original_attitude(angular_velocity_b_rad_s, libra::Quaternion(0.0, 0.0, 0.0, 1.0), inertia_tensor_kgm2, torque_b_Nm, 0.01,
+                                "attitude_rk4_snapshot_original");
+  original_attitude.Propagate(10.0);
+  std::stringstream stream;
+  SnapshotWriter writer(stream);
+  original_attitude.SaveSnapshot(writer);
+  ASSERT_TRUE(writer.IsGood());
+
+  // The restored attitude is constructed with the different initial state
+  AttitudeRk4 restored_attitude(libra::Vector<3>(0.0), libra::Quaternion(1.0, 0.0, 0.0, 0.0), inertia_tensor_kgm2, torque_b_Nm, 0.01,
+                                "attitude_rk4_snapshot_restored");
+  SnapshotReader reader(stream);
+  restored_attitude.LoadSnapshot(reader);
+
+  original_attitude.Propagate(20.0);
+  restored_attitude.Propagate(20.0);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(original_attitude.GetAngularVelocity_b_rad_s()[i], restored_attitude.GetAngularVelocity_b_rad_s()[i]);
+  }
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_DOUBLE_EQ(original_attitude.GetQuaternion_i2b()[i], restored_attitude.GetQuaternion_i2b()[i]);
+  }
+
+  // The broken snapshot is rejected
+  std::string broken_snapshot = stream.str();
+  std::stringstream broken_stream(broken_snapshot.substr(0, 20));
+  SnapshotReader broken_reader(broken_stream);
+  EXPECT_THROW(restored_attitude.LoadSnapshot(broken_reader), std::invalid_argument);
+}
+
+/**
+ * @brief Test for the conversion of the integration method name
+ */
+TEST(AttitudeRk4, SetAttitudeIntegrationMethod) {
+  EXPECT_EQ(AttitudeIntegrationMethod::kRk4, SetAttitudeIntegrationMethod("RK4"));
+  EXPECT_EQ(AttitudeIntegrationMethod::kRk4, SetAttitudeIntegrationMethod(""));
+  EXPECT_EQ(AttitudeIntegrationMethod::kLieGroupRk4, SetAttitudeIntegrationMethod("LIE_GROUP_RK4"));
+  EXPECT_EQ(AttitudeIntegrationMethod::kRk4, SetAttitudeIntegrationMethod("UNKNOWN"));
+}
+
+/**
+ * @brief Test for the norm of the quaternion kept without the normalization in the Lie group method
+ */
+TEST(AttitudeRk4, LieGroupNormConservation) {
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[0] = 3.0;
+  angular_velocity_b_rad_s[1] = 5.0;
+  angular_velocity_b_rad_s[2] = -2.0;
+  libra::Vector<3> torque_b_Nm(0.0);
+  torque_b_Nm[1] = 1.0e-3;
+  // About 0.6 rad of rotation in each step
+  auto attitude = MakeAttitude(angular_velocity_b_rad_s, torque_b_Nm, 0.1, AttitudeIntegrationMethod::kLieGroupRk4, "attitude_rk4_norm");
+  EXPECT_EQ(AttitudeIntegrationMethod::kLieGroupRk4, attitude->GetIntegrationMethod());
+  for (size_t step = 1; step <= 1000; step++) {
+    attitude->Propagate(step * 0.1);
+    const libra::Quaternion quaternion_i2b = attitude->GetQuaternion_i2b();
+    double norm = 0.0;
+    for (size_t i = 0; i < 4; i++) norm += quaternion_i2b[i] * quaternion_i2b[i];
+    ASSERT_NEAR(1.0, sqrt(norm), 1.0e-12) << "step " << step;
+  }
+}
+
+/**
+ * @brief Test for the agreement with the classical RK4 with the small step in the torque-free and the torqued tumbling
+ */
+TEST(AttitudeRk4, LieGroupAgreementWithRungeKutta) {
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[0] = 0.3;
+  angular_velocity_b_rad_s[1] = 0.5;
+  angular_velocity_b_rad_s[2] = -0.2;
+  const libra::Vector<3> zero_torque_b_Nm(0.0);
+  libra::Vector<3> applied_torque_b_Nm(0.0);
+  applied_torque_b_Nm[0] = 2.0e-3;
+  applied_torque_b_Nm[2] = -1.0e-3;
+
+  for (const libra::Vector<3>& torque_b_Nm : {zero_torque_b_Nm, applied_torque_b_Nm}) {
+    auto rk4_attitude = MakeAttitude(angular_velocity_b_rad_s, torque_b_Nm, 0.001, AttitudeIntegrationMethod::kRk4, "attitude_rk4_classic");
+    auto lie_group_attitude =
+        MakeAttitude(angular_velocity_b_rad_s, torque_b_Nm, 0.001, AttitudeIntegrationMethod::kLieGroupRk4, "attitude_rk4_lie_group");
+    for (size_t step = 1; step <= 20; step++) {
+      rk4_attitude->Propagate(step * 0.5);
+      lie_group_attitude->Propagate(step * 0.5);
+      EXPECT_LT(CalcAngleError_rad(lie_group_attitude->GetQuaternion_i2b(), rk4_attitude->GetQuaternion_i2b()), 1.0e-9);
+      for (size_t i = 0; i < 3; i++) {
+        // The angular velocity is integrated with the same RK4
+        EXPECT_NEAR(rk4_attitude->GetAngularVelocity_b_rad_s()[i], lie_group_attitude->GetAngularVelocity_b_rad_s()[i], 1.0e-12);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the accuracy with the large step of the fast spin
+ */
+TEST(AttitudeRk4, LieGroupLargeStepSpin) {
+  // Major axis spin with the small nutation
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[0] = 0.1;
+  angular_velocity_b_rad_s[2] = 10.0;
+  const libra::Vector<3> torque_b_Nm(0.0);
+  auto truth_attitude = MakeAttitude(angular_velocity_b_rad_s, torque_b_Nm, 0.001, AttitudeIntegrationMethod::kRk4, "attitude_rk4_truth");
+  auto rk4_attitude = MakeAttitude(angular_velocity_b_rad_s, torque_b_Nm, 0.2, AttitudeIntegrationMethod::kRk4, "attitude_rk4_classic");
+  auto lie_group_attitude =
+      MakeAttitude(angular_velocity_b_rad_s, torque_b_Nm, 0.2, AttitudeIntegrationMethod::kLieGroupRk4, "attitude_rk4_lie_group");
+  truth_attitude->Propagate(20.0);
+  rk4_attitude->Propagate(20.0);
+  lie_group_attitude->Propagate(20.0);
+
+  // Two radians of rotation in each step break the classical RK4 of the quaternion components
+  const double rk4_error_rad = CalcAngleError_rad(rk4_attitude->GetQuaternion_i2b(), truth_attitude->GetQuaternion_i2b());
+  const double lie_group_error_rad = CalcAngleError_rad(lie_group_attitude->GetQuaternion_i2b(), truth_attitude->GetQuaternion_i2b());
+  EXPECT_GT(rk4_error_rad, 0.1);
+  EXPECT_LT(lie_group_error_rad, 1.0e-2);
+}
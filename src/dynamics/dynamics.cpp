@@ -6,6 +6,8 @@
 #include "dynamics.hpp"
 
 #include "../simulation/multiple_spacecraft/relative_information.hpp"
+#include "../utilities/step_profiler.hpp"
+#include "../utilities/type_name.hpp"
 
 Dynamics::Dynamics(const SimulationConfiguration* simulation_configuration, const SimulationTime* simulation_time,
                    const LocalEnvironment* local_environment, const int spacecraft_id, Structure* structure,
@@ -15,6 +17,7 @@ Dynamics::Dynamics(const SimulationConfiguration* simulation_configuration, cons
 }
 
 Dynamics::~Dynamics() {
+  delete frame_chain_cache_;
   delete attitude_;
   delete orbit_;
   delete temperature_;
@@ -28,18 +31,48 @@ void Dynamics::Initialize(const SimulationConfiguration* simulation_configuratio
                      simulation_time->GetOrbitRkStepTime_s(), simulation_time->GetCurrentTime_jd(),
                      local_celestial_information.GetGlobalInformation().GetCenterBodyGravityConstant_m3_s2(), "ORBIT", relative_information);
   attitude_ = InitAttitude(simulation_configuration->spacecraft_file_list_[spacecraft_id], orbit_, &local_celestial_information,
-                           simulation_time->GetAttitudeRkStepTime_s(), structure->GetKinematicsParameters().GetInertiaTensor_b_kgm2(), spacecraft_id);
+                           simulation_time->GetAttitudeRkStepTime_s(), structure->GetKinematicsParameters(), spacecraft_id);
+  frame_chain_cache_ = new FrameChainCache(attitude_);
   temperature_ = InitTemperature(simulation_configuration->spacecraft_file_list_[spacecraft_id], simulation_time->GetThermalRkStepTime_s(),
                                  &(local_environment_->GetSolarRadiationPressure()));
 
   // To get initial value
   orbit_->UpdateByAttitude(attitude_->GetQuaternion_i2b());
+  attitude_interpolator_.Reset(simulation_time->GetElapsedTime_s(), attitude_->GetQuaternion_i2b(), attitude_->GetAngularVelocity_b_rad_s());
+
+  // The thermal dynamics is independent of the attitude and orbit propagation in the same step
+  if (simulation_configuration->is_thermal_propagated_concurrently_) {
+    thermal_thread_pool_ = simulation_configuration->thermal_thread_pool_;
+  }
+  if (simulation_configuration->thermal_thread_pool_ != nullptr && simulation_configuration->thermal_parallel_node_threshold_ > 0) {
+    temperature_->SetThreadPool(simulation_configuration->thermal_thread_pool_, simulation_configuration->thermal_parallel_node_threshold_);
+  }
 }
 
 void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestialInformation* local_celestial_information) {
+  static const size_t profile_section_id = StepProfiler::RegisterSection("Dynamics::Update");
+  ScopedProfileTimer timer(profile_section_id);
+  // Start the thermal propagation as a task of the thread pool
+  const bool is_thermal_concurrent = thermal_thread_pool_ != nullptr && simulation_time->GetThermalPropagateFlag();
+  if (is_thermal_concurrent) {
+    const libra::Vector<3> sun_position_b_m = local_celestial_information->GetPositionFromSpacecraft_b_m("SUN");
+    const double end_time_s = simulation_time->GetElapsedTime_s();
+    thermal_exception_ = nullptr;
+    is_thermal_finished_ = false;
+    thermal_thread_pool_->Submit([this, sun_position_b_m, end_time_s]() {
+      try {
+        temperature_->Propagate(sun_position_b_m, end_time_s);
+      } catch (...) {
+        thermal_exception_ = std::current_exception();
+      }
+      is_thermal_finished_ = true;
+    });
+  }
+
   // Attitude propagation
   if (simulation_time->GetAttitudePropagateFlag()) {
     attitude_->Propagate(simulation_time->GetElapsedTime_s());
+    attitude_interpolator_.Update(simulation_time->GetElapsedTime_s(), attitude_->GetQuaternion_i2b(), attitude_->GetAngularVelocity_b_rad_s());
   }
   // Orbit Propagation
   if (simulation_time->GetOrbitPropagateFlag()) {
@@ -49,7 +82,11 @@ void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestia
   orbit_->UpdateByAttitude(attitude_->GetQuaternion_i2b());
 
   // Thermal
-  if (simulation_time->GetThermalPropagateFlag()) {
+  if (is_thermal_concurrent) {
+    // Wait for the completion to hand the temperatures to the next step. The calling thread also executes the queued thermal tasks.
+    thermal_thread_pool_->WaitUntil([this] { return is_thermal_finished_.load(); });
+    if (thermal_exception_ != nullptr) std::rethrow_exception(thermal_exception_);
+  } else if (simulation_time->GetThermalPropagateFlag()) {
     std::string sun_str = "SUN";
     char* c_sun = new char[sun_str.size() + 1];
     std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
@@ -69,3 +106,28 @@ void Dynamics::LogSetup(Logger& logger) {
   logger.AddLogList(orbit_);
   logger.AddLogList(temperature_);
 }
+
+MemoryUsage Dynamics::GetMemoryUsage() const {
+  MemoryUsage memory_usage("Dynamics", sizeof(*this));
+  memory_usage.AddChild(MemoryUsage(GetTypeName(typeid(*attitude_)), sizeof(Attitude)));
+  memory_usage.AddChild(MemoryUsage(GetTypeName(typeid(*orbit_)), sizeof(Orbit)));
+  memory_usage.AddChild(MemoryUsage("FrameChainCache", frame_chain_cache_->GetMemoryUsage_bytes()));
+  memory_usage.AddChild(MemoryUsage("Temperature", temperature_->GetMemoryUsage_bytes()));
+  return memory_usage;
+}
+
+void Dynamics::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("DYNAMICS");
+  orbit_->SaveSnapshot(snapshot);
+  attitude_->SaveSnapshot(snapshot);
+  attitude_interpolator_.SaveSnapshot(snapshot);
+  temperature_->SaveSnapshot(snapshot);
+}
+
+void Dynamics::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("DYNAMICS");
+  orbit_->LoadSnapshot(snapshot);
+  attitude_->LoadSnapshot(snapshot);
+  attitude_interpolator_.LoadSnapshot(snapshot);
+  temperature_->LoadSnapshot(snapshot);
+}
@@ -5,6 +5,8 @@
 #ifndef S2E_DYNAMICS_DYNAMICS_HPP_
 #define S2E_DYNAMICS_DYNAMICS_HPP_
 
+#include <atomic>
+#include <exception>
 #include <string>
 
 #include "../environment/global/simulation_time.hpp"
@@ -12,6 +14,9 @@
 #include "../math_physics/math/vector.hpp"
 #include "../simulation/simulation_configuration.hpp"
 #include "../simulation/spacecraft/structure/structure.hpp"
+#include "../utilities/case_arena.hpp"
+#include "dynamics/attitude/attitude_interpolator.hpp"
+#include "dynamics/attitude/frame_chain_cache.hpp"
 #include "dynamics/attitude/initialize_attitude.hpp"
 #include "dynamics/orbit/initialize_orbit.hpp"
 #include "dynamics/thermal/node.hpp"
@@ -24,7 +29,7 @@ class LocalEnvironment;
  * @class Dynamics
  * @brief Class to manage dynamics of spacecraft
  */
-class Dynamics {
+class Dynamics : public ArenaAllocated {
  public:
   /**
    * @fn Dynamics
@@ -58,6 +63,13 @@ class Dynamics {
    */
   void LogSetup(Logger& logger);
 
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the dynamics
+   * @note The attitude and the orbit are reported with the size of the base classes.
+   */
+  MemoryUsage GetMemoryUsage() const;
+
   /**
    * @fn AddTorque_b_Nm
    * @brief Add input torque for the attitude dynamics propagation
@@ -78,6 +90,20 @@ class Dynamics {
    * @param [in] acceleration_i_m_s2: Acceleration in the inertial fixed frame [N]
    */
   inline void AddAcceleration_i_m_s2(libra::Vector<3> acceleration_i_m_s2) { orbit_->AddAcceleration_i_m_s2(acceleration_i_m_s2); }
+  /**
+   * @fn AddImpulse_b
+   * @brief Add input impulse and angular impulse applied in the coming propagation step
+   * @note The force and torque are held during the step, so the impulse is converted to the constant force and torque with the same integral.
+   * @param [in] impulse_b_Ns: Impulse in the body fixed frame [Ns]
+   * @param [in] angular_impulse_b_Nms: Angular impulse in the body fixed frame [Nms]
+   * @param [in] step_s: Length of the propagation step [sec]
+   */
+  inline void AddImpulse_b(const libra::Vector<3>& impulse_b_Ns, const libra::Vector<3>& angular_impulse_b_Nms, const double step_s) {
+    if (step_s <= 0.0) return;
+    const double reciprocal_step_1_s = 1.0 / step_s;
+    AddForce_b_N(reciprocal_step_1_s * impulse_b_Ns);
+    AddTorque_b_Nm(reciprocal_step_1_s * angular_impulse_b_Nms);
+  }
 
   /**
    * @fn ClearForceTorque
@@ -85,6 +111,20 @@ class Dynamics {
    */
   void ClearForceTorque(void);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the orbit, attitude, and thermal dynamics to the snapshot
+   * @note The concurrent thermal propagation is always completed in Update, so this can be called between the updates.
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the states of the orbit, attitude, and thermal dynamics from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
   /**
    * @fn GetAttitude
    * @brief Return Attitude class
@@ -95,6 +135,16 @@ class Dynamics {
    * @brief Return Orbit class
    */
   inline const Orbit& GetOrbit() const { return *orbit_; }
+  /**
+   * @fn GetAttitudeInterpolator
+   * @brief Return the interpolator of the last two attitude states for the components faster than the attitude update
+   */
+  inline const AttitudeInterpolator& GetAttitudeInterpolator() const { return attitude_interpolator_; }
+  /**
+   * @fn GetFrameChainCache
+   * @brief Return the cache of the composed frame conversions of the component frames
+   */
+  inline const FrameChainCache& GetFrameChainCache() const { return *frame_chain_cache_; }
   /**
    * @fn GetTemperature
    * @brief Return Temperature class
@@ -105,13 +155,30 @@ class Dynamics {
    * @brief Return Attitude class to change the Attitude
    */
   inline Attitude& SetAttitude() const { return *attitude_; }
+  /**
+   * @fn SetOrbit
+   * @brief Return Orbit class to change the Orbit
+   */
+  inline Orbit& SetOrbit() const { return *orbit_; }
+  /**
+   * @fn SetFrameChainCache
+   * @brief Return the cache of the frame conversions to register or change the component frames
+   */
+  inline FrameChainCache& SetFrameChainCache() const { return *frame_chain_cache_; }
 
  private:
-  Attitude* attitude_;                         //!< Attitude dynamics
-  Orbit* orbit_;                               //!< Orbit dynamics
-  Temperature* temperature_;                   //!< Thermal dynamics
-  const Structure* structure_;                 //!< Structure information
-  const LocalEnvironment* local_environment_;  //!< Local environment
+  Attitude* attitude_;                          //!< Attitude dynamics
+  AttitudeInterpolator attitude_interpolator_;  //!< Interpolator of the last two attitude states
+  FrameChainCache* frame_chain_cache_;          //!< Cache of the frame conversions of the component frames
+  Orbit* orbit_;                                //!< Orbit dynamics
+  Temperature* temperature_;                    //!< Thermal dynamics
+  const Structure* structure_;                  //!< Structure information
+  const LocalEnvironment* local_environment_;   //!< Local environment
+
+  // Concurrent thermal propagation
+  ThreadPool* thermal_thread_pool_ = nullptr;       //!< Thread pool to propagate the thermal dynamics. nullptr for the serial propagation.
+  std::atomic<bool> is_thermal_finished_{true};     //!< Flag of the completion of the thermal task
+  std::exception_ptr thermal_exception_ = nullptr;  //!< Exception thrown in the thermal task
 
   /**
    * @fn Initialize
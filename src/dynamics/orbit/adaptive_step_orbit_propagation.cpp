@@ -0,0 +1,149 @@
+/**
+ * @file adaptive_step_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit with an embedded Runge-Kutta method and adaptive step width
+ */
+#include "adaptive_step_orbit_propagation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utilities/macros.hpp>
+
+using libra::numerical_integration::NumericalIntegrationMethod;
+
+AdaptiveStepOrbitPropagation::AdaptiveStepOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2,
+                                                           const double initial_step_s, const libra::Vector<3> position_i_m,
+                                                           const libra::Vector<3> velocity_i_m_s, const double error_tolerance,
+                                                           const NumericalIntegrationMethod method)
+    : Orbit(celestial_information),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      error_tolerance_(error_tolerance),
+      integrated_acceleration_i_m_s2_(0.0),
+      numerical_integrator_(initial_step_s, *this, method == NumericalIntegrationMethod::kRk4 ? NumericalIntegrationMethod::kDp5 : method) {
+  propagate_mode_ = OrbitPropagateMode::kAdaptiveStep;
+
+  // The method is replaced with DP5 in the initializer when it is not an embedded method
+  embedded_runge_kutta_ = std::dynamic_pointer_cast<libra::numerical_integration::EmbeddedRungeKutta<6>>(numerical_integrator_.GetIntegrator());
+  next_step_s_ = std::max(initial_step_s, kMinimumStep_s);
+  spacecraft_acceleration_i_m_s2_ *= 0;
+
+  libra::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = position_i_m[i];
+    state[i + 3] = velocity_i_m_s[i];
+  }
+  propagation_time_s_ = 0.0;
+  Restart(propagation_time_s_, state);
+
+  spacecraft_position_i_m_ = position_i_m;
+  spacecraft_velocity_i_m_s_ = velocity_i_m_s;
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+AdaptiveStepOrbitPropagation::~AdaptiveStepOrbitPropagation() {}
+
+libra::Vector<6> AdaptiveStepOrbitPropagation::DerivativeFunction(const double time_s, const libra::Vector<6>& state) const {
+  libra::Vector<6> rhs;
+  CalcDerivative(time_s, state, rhs);
+  return rhs;
+}
+
+void AdaptiveStepOrbitPropagation::CalcDerivative(const double time_s, const libra::Vector<6>& state, libra::Vector<6>& rhs) const {
+  UNUSED(time_s);
+
+  const double r3 = pow(state[0] * state[0] + state[1] * state[1] + state[2] * state[2], 1.5);
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = integrated_acceleration_i_m_s2_[i] - gravity_constant_m3_s2_ / r3 * state[i];
+  }
+}
+
+void AdaptiveStepOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  // The steps after the previous output time were integrated with the previous acceleration. The integration restarts from the sampled
+  // state only for the impulsive change of the acceleration (e.g., thruster firing). The smooth change of the perturbations is applied from
+  // the next step, so it does not limit the step width to the output interval.
+  const double acceleration_change_m_s2 = (spacecraft_acceleration_i_m_s2_ - integrated_acceleration_i_m_s2_).CalcNorm();
+  if (acceleration_change_m_s2 > 0.0) {
+    const double acceleration_norm_m_s2 = std::max(spacecraft_acceleration_i_m_s2_.CalcNorm(), integrated_acceleration_i_m_s2_.CalcNorm());
+    integrated_acceleration_i_m_s2_ = spacecraft_acceleration_i_m_s2_;
+    if (acceleration_change_m_s2 > kImpulsiveChangeRatio * acceleration_norm_m_s2) {
+      libra::Vector<6> state;
+      for (size_t i = 0; i < 3; i++) {
+        state[i] = spacecraft_position_i_m_[i];
+        state[i + 3] = spacecraft_velocity_i_m_s_[i];
+      }
+      Restart(propagation_time_s_, state);
+    }
+  }
+
+  while (integration_time_s_ < end_time_s) {
+    const libra::Vector<6> start_state = embedded_runge_kutta_->GetState();
+    embedded_runge_kutta_->SetStepWidth(next_step_s_);
+    embedded_runge_kutta_->Integrate();
+
+    // Step width control for the 4th order error estimation
+    const double error = embedded_runge_kutta_->GetLocalTruncationError();
+    double ratio = (error > 0.0) ? kSafetyFactor * pow(error_tolerance_ / error, 0.2) : kMaximumStepRatio;
+    ratio = std::min(std::max(ratio, kMinimumStepRatio), kMaximumStepRatio);
+
+    if (error > error_tolerance_ && next_step_s_ > kMinimumStep_s) {
+      // Reject the step
+      number_of_rejected_steps_++;
+      embedded_runge_kutta_->SetState(integration_time_s_, start_state);
+      next_step_s_ = std::max(next_step_s_ * ratio, kMinimumStep_s);
+      continue;
+    }
+    number_of_steps_++;
+    integration_time_s_ += next_step_s_;
+    next_step_s_ = std::max(next_step_s_ * ratio, kMinimumStep_s);
+  }
+
+  // Dense output at the end time
+  libra::Vector<6> state = embedded_runge_kutta_->GetState();
+  if (integration_time_s_ > end_time_s) {
+    state = embedded_runge_kutta_->CalcInterpolationStateAt(end_time_s);
+  }
+  propagation_time_s_ = end_time_s;
+
+  for (size_t i = 0; i < 3; i++) {
+    spacecraft_position_i_m_[i] = state[i];
+    spacecraft_velocity_i_m_s_[i] = state[i + 3];
+  }
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void AdaptiveStepOrbitPropagation::Restart(const double time_s, const libra::Vector<6>& state) {
+  embedded_runge_kutta_->SetState(time_s, state);
+  integration_time_s_ = time_s;
+}
+
+void AdaptiveStepOrbitPropagation::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  snapshot.Write(integrated_acceleration_i_m_s2_);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(next_step_s_);
+  snapshot.Write(number_of_steps_);
+  snapshot.Write(number_of_rejected_steps_);
+}
+
+void AdaptiveStepOrbitPropagation::LoadSnapshot(SnapshotReader& snapshot) {
+  Orbit::LoadSnapshot(snapshot);
+  snapshot.Read(integrated_acceleration_i_m_s2_);
+  snapshot.Read(propagation_time_s_);
+  snapshot.Read(next_step_s_);
+  snapshot.Read(number_of_steps_);
+  snapshot.Read(number_of_rejected_steps_);
+
+  // The stages for the dense output are not saved, so the integration restarts from the latest output
+  libra::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = spacecraft_position_i_m_[i];
+    state[i + 3] = spacecraft_velocity_i_m_s_[i];
+  }
+  Restart(propagation_time_s_, state);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file adaptive_step_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit with an embedded Runge-Kutta method and adaptive step width
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_ADAPTIVE_STEP_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_ADAPTIVE_STEP_ORBIT_PROPAGATION_HPP_
+
+#include <environment/global/celestial_information.hpp>
+#include <math_physics/numerical_integration/numerical_integrator_manager.hpp>
+#include <memory>
+
+#include "orbit.hpp"
+
+/**
+ * @class AdaptiveStepOrbitPropagation
+ * @brief Class to propagate spacecraft orbit with an embedded Runge-Kutta method and adaptive step width
+ * @details The step width is controlled with the estimated local truncation error, and the state at the end time of each propagation is
+ *          interpolated with the dense output of the integrator, so the steps are not truncated at the sampling time. The acceleration
+ *          is constant in each step. When the acceleration is changed by more than kImpulsiveChangeRatio of its norm (e.g., thruster
+ *          firing), the integration restarts from the sampled state. Otherwise, the new acceleration is used from the next step, and the
+ *          steps already integrated beyond the output time keep the previous acceleration.
+ */
+class AdaptiveStepOrbitPropagation : public Orbit, public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn AdaptiveStepOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] initial_step_s: Initial step width [sec]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] error_tolerance: Tolerance of the norm of the local truncation error of the state (position [m] and velocity [m/s])
+   * @param [in] method: Numerical integration method. kRk4 is replaced with kDp5 since the error estimation is needed.
+   */
+  AdaptiveStepOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2, const double initial_step_s,
+                               const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double error_tolerance,
+                               const libra::numerical_integration::NumericalIntegrationMethod method =
+                                   libra::numerical_integration::NumericalIntegrationMethod::kDp5);
+  /**
+   * @fn ~AdaptiveStepOrbitPropagation
+   * @brief Destructor
+   */
+  ~AdaptiveStepOrbitPropagation();
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Right Hand Side of ordinary difference equation
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const;
+  /**
+   * @fn CalcDerivative
+   * @brief Right Hand Side of ordinary difference equation written into the stage buffer of the integrator
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @param [out] rhs: Differentiated value of state vector
+   */
+  virtual void CalcDerivative(const double time_s, const libra::Vector<6>& state, libra::Vector<6>& rhs) const;
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Orbit
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Orbit
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
+
+  // Getters
+  /**
+   * @fn GetNumberOfSteps
+   * @return Number of the accepted steps
+   */
+  inline size_t GetNumberOfSteps() const { return number_of_steps_; }
+  /**
+   * @fn GetNumberOfRejectedSteps
+   * @return Number of the rejected steps
+   */
+  inline size_t GetNumberOfRejectedSteps() const { return number_of_rejected_steps_; }
+
+ private:
+  static constexpr double kSafetyFactor = 0.9;          //!< Safety factor of the step width control
+  static constexpr double kMinimumStepRatio = 0.2;      //!< Minimum ratio of the step width change
+  static constexpr double kMaximumStepRatio = 5.0;      //!< Maximum ratio of the step width change
+  static constexpr double kMinimumStep_s = 1.0e-6;      //!< Minimum step width [sec]
+  static constexpr double kImpulsiveChangeRatio = 0.1;  //!< Ratio of the acceleration change to the norm to restart the integration
+
+  double gravity_constant_m3_s2_;                    //!< Gravity constant [m3/s2]
+  double error_tolerance_;                           //!< Tolerance of the local truncation error
+  libra::Vector<3> integrated_acceleration_i_m_s2_;  //!< Acceleration used in the integration [m/s2]
+
+  double propagation_time_s_;            //!< Time of the latest output [sec]
+  double integration_time_s_;            //!< Time of the integrator state [sec]
+  double next_step_s_;                   //!< Step width for the next step [sec]
+  size_t number_of_steps_ = 0;           //!< Number of the accepted steps
+  size_t number_of_rejected_steps_ = 0;  //!< Number of the rejected steps
+
+  libra::numerical_integration::NumericalIntegratorManager<6> numerical_integrator_;           //!< Numerical integrator
+  std::shared_ptr<libra::numerical_integration::EmbeddedRungeKutta<6>> embedded_runge_kutta_;  //!< Integrator with error estimation
+
+  /**
+   * @fn Restart
+   * @brief Restart the integration from the state
+   * @param [in] time_s: Time of the state [sec]
+   * @param [in] state: Position and velocity
+   */
+  void Restart(const double time_s, const libra::Vector<6>& state);
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_ADAPTIVE_STEP_ORBIT_PROPAGATION_HPP_
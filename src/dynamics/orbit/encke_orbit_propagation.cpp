@@ -5,6 +5,7 @@
 
 #include "encke_orbit_propagation.hpp"
 
+#include <cmath>
 #include <utilities/macros.hpp>
 
 #include "../../math_physics/orbit/orbital_elements.hpp"
@@ -17,7 +18,11 @@ EnckeOrbitPropagation::EnckeOrbitPropagation(const CelestialInformation* celesti
       gravity_constant_m3_s2_(gravity_constant_m3_s2),
       error_tolerance_(error_tolerance),
       propagation_step_s_(propagation_step_s) {
+  propagate_mode_ = OrbitPropagateMode::kEncke;
+
   propagation_time_s_ = 0.0;
+  // The acceleration is not cleared at the rectification since it is set for the coming propagation
+  spacecraft_acceleration_i_m_s2_.FillUp(0.0);
   Initialize(current_time_jd, position_i_m, velocity_i_m_s);
 }
 
@@ -27,18 +32,33 @@ EnckeOrbitPropagation::~EnckeOrbitPropagation() {}
 void EnckeOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
   if (!is_calc_enabled_) return;
 
-  // Rectification
-  double norm_sat_position_m = spacecraft_position_i_m_.CalcNorm();
-  double norm_difference_position_m = difference_position_i_m_.CalcNorm();
-  if (norm_difference_position_m / norm_sat_position_m > error_tolerance_) {
-    Initialize(current_time_jd, spacecraft_position_i_m_, spacecraft_velocity_i_m_s_);
+  if (reference_orbit_method_ == EnckeReferenceOrbitMethod::kLagrange) {
+    // Rectification with the difference predicted at the end of this propagation
+    const double propagation_duration_s = end_time_s - propagation_time_s_;
+    libra::Vector<6> difference_derivative;
+    DerivativeFunction(GetIndependentVariable(), GetState(), difference_derivative);
+    libra::Vector<3> predicted_difference_position_i_m;
+    for (size_t i = 0; i < 3; i++) {
+      predicted_difference_position_i_m[i] = difference_position_i_m_[i] + difference_velocity_i_m_s_[i] * propagation_duration_s +
+                                             0.5 * difference_derivative[i + 3] * propagation_duration_s * propagation_duration_s;
+    }
+    if (predicted_difference_position_i_m.CalcNorm() / spacecraft_position_i_m_.CalcNorm() > error_tolerance_) {
+      Initialize(current_time_jd, spacecraft_position_i_m_, spacecraft_velocity_i_m_s_);
+    }
+  } else {
+    // Rectification
+    double norm_sat_position_m = spacecraft_position_i_m_.CalcNorm();
+    double norm_difference_position_m = difference_position_i_m_.CalcNorm();
+    if (norm_difference_position_m / norm_sat_position_m > error_tolerance_) {
+      Initialize(current_time_jd, spacecraft_position_i_m_, spacecraft_velocity_i_m_s_);
+    }
+
+    // Update reference orbit
+    reference_kepler_orbit.CalcOrbit(current_time_jd);
+    reference_position_i_m_ = reference_kepler_orbit.GetPosition_i_m();
+    reference_velocity_i_m_s_ = reference_kepler_orbit.GetVelocity_i_m_s();
   }
 
-  // Update reference orbit
-  reference_kepler_orbit.CalcOrbit(current_time_jd);
-  reference_position_i_m_ = reference_kepler_orbit.GetPosition_i_m();
-  reference_velocity_i_m_s_ = reference_kepler_orbit.GetVelocity_i_m_s();
-
   // Propagate difference orbit
   SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
   while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
@@ -56,23 +76,32 @@ void EnckeOrbitPropagation::Propagate(const double end_time_s, const double curr
   difference_velocity_i_m_s_[1] = GetState()[4];
   difference_velocity_i_m_s_[2] = GetState()[5];
 
+  if (reference_orbit_method_ == EnckeReferenceOrbitMethod::kLagrange) {
+    CalcReferenceOrbit(GetIndependentVariable());
+  }
   UpdateSatOrbit();
 }
 
 // Functions for OrdinaryDifferentialEquation
 void EnckeOrbitPropagation::DerivativeFunction(double t, const libra::Vector<6>& state, libra::Vector<6>& rhs) {
-  UNUSED(t);
   libra::Vector<3> difference_position_i_m_m, difference_acc_i_m_s2;
   for (int i = 0; i < 3; i++) {
     difference_position_i_m_m[i] = state[i];
   }
 
-  double q_func = CalcQFunction(difference_position_i_m_m);
+  // The Kepler mode uses the reference orbit and the spacecraft position at the start of the propagation
+  libra::Vector<3> position_i_m = spacecraft_position_i_m_;
+  if (reference_orbit_method_ == EnckeReferenceOrbitMethod::kLagrange) {
+    CalcReferenceOrbit(t);
+    position_i_m = reference_position_i_m_ + difference_position_i_m_m;
+  }
+
+  double q_func = CalcQFunction(difference_position_i_m_m, position_i_m);
   double r_m = reference_position_i_m_.CalcNorm();
   double r_m3 = pow(r_m, 3.0);
 
   difference_acc_i_m_s2 =
-      -(gravity_constant_m3_s2_ / r_m3) * (q_func * spacecraft_position_i_m_ + difference_position_i_m_m) + spacecraft_acceleration_i_m_s2_;
+      -(gravity_constant_m3_s2_ / r_m3) * (q_func * position_i_m + difference_position_i_m_m) + spacecraft_acceleration_i_m_s2_;
 
   rhs[0] = state[3];
   rhs[1] = state[4];
@@ -84,15 +113,20 @@ void EnckeOrbitPropagation::DerivativeFunction(double t, const libra::Vector<6>&
 
 // Private Functions
 void EnckeOrbitPropagation::Initialize(double current_time_jd, libra::Vector<3> reference_position_i_m, libra::Vector<3> reference_velocity_i_m_s) {
-  // General
-  spacecraft_acceleration_i_m_s2_.FillUp(0.0);
-
   // reference orbit
   reference_position_i_m_ = reference_position_i_m;
   reference_velocity_i_m_s_ = reference_velocity_i_m_s;
   OrbitalElements oe_ref(gravity_constant_m3_s2_, current_time_jd, reference_position_i_m, reference_velocity_i_m_s);
   reference_kepler_orbit = KeplerOrbit(gravity_constant_m3_s2_, oe_ref);
 
+  // Lagrange coefficients
+  rectification_position_i_m_ = reference_position_i_m;
+  rectification_velocity_i_m_s_ = reference_velocity_i_m_s;
+  reciprocal_semi_major_axis_1_m_ = 2.0 / reference_position_i_m.CalcNorm() -
+                                    InnerProduct(reference_velocity_i_m_s, reference_velocity_i_m_s) / gravity_constant_m3_s2_;
+  reference_time_s_ = 0.0;
+  universal_anomaly_m0_5_ = 0.0;
+
   // difference orbit
   difference_position_i_m_.FillUp(0.0);
   difference_velocity_i_m_s_.FillUp(0.0);
@@ -111,12 +145,62 @@ void EnckeOrbitPropagation::UpdateSatOrbit() {
   TransformEcefToGeodetic();
 }
 
-double EnckeOrbitPropagation::CalcQFunction(libra::Vector<3> difference_position_i_m) {
+void EnckeOrbitPropagation::CalcReferenceOrbit(const double time_from_rectification_s) {
+  if (time_from_rectification_s == reference_time_s_) return;
+
+  const double sqrt_mu = std::sqrt(gravity_constant_m3_s2_);
+  const double alpha_1_m = reciprocal_semi_major_axis_1_m_;
+  const double r0_m = rectification_position_i_m_.CalcNorm();
+  const double sigma0_m0_5 = InnerProduct(rectification_position_i_m_, rectification_velocity_i_m_s_) / sqrt_mu;
+
+  // Initial guess from the universal anomaly of the previous calculation with its rate sqrt(mu) / r
+  double chi = universal_anomaly_m0_5_ + sqrt_mu * (time_from_rectification_s - reference_time_s_) / reference_position_i_m_.CalcNorm();
+  double c_z = 0.5, s_z = 1.0 / 6.0, r_m = r0_m;
+  for (size_t i = 0; i < 20; i++) {
+    // Stumpff functions
+    const double z = alpha_1_m * chi * chi;
+    if (std::abs(z) < 1.0e-3) {
+      c_z = 1.0 / 2.0 - z * (1.0 / 24.0 - z * (1.0 / 720.0 - z / 40320.0));
+      s_z = 1.0 / 6.0 - z * (1.0 / 120.0 - z * (1.0 / 5040.0 - z / 362880.0));
+    } else if (z > 0.0) {
+      const double sqrt_z = std::sqrt(z);
+      c_z = (1.0 - std::cos(sqrt_z)) / z;
+      s_z = (sqrt_z - std::sin(sqrt_z)) / (z * sqrt_z);
+    } else {
+      const double sqrt_z = std::sqrt(-z);
+      c_z = (std::cosh(sqrt_z) - 1.0) / (-z);
+      s_z = (std::sinh(sqrt_z) - sqrt_z) / (-z * sqrt_z);
+    }
+
+    // Newton method for the universal Kepler equation. The derivative is the orbit radius.
+    const double chi2 = chi * chi;
+    const double f_chi = sigma0_m0_5 * chi2 * c_z + (1.0 - alpha_1_m * r0_m) * chi2 * chi * s_z + r0_m * chi - sqrt_mu * time_from_rectification_s;
+    r_m = chi2 * c_z + sigma0_m0_5 * chi * (1.0 - z * s_z) + r0_m * (1.0 - z * c_z);
+    const double delta_chi = f_chi / r_m;
+    chi -= delta_chi;
+    if (std::abs(delta_chi) < 1.0e-12 * (1.0 + std::abs(chi))) break;
+  }
+
+  // Lagrange coefficients
+  const double chi2 = chi * chi;
+  const double z = alpha_1_m * chi2;
+  const double f = 1.0 - chi2 * c_z / r0_m;
+  const double g_s = time_from_rectification_s - chi2 * chi * s_z / sqrt_mu;
+  const double f_dot_1_s = sqrt_mu * chi * (z * s_z - 1.0) / (r_m * r0_m);
+  const double g_dot = 1.0 - chi2 * c_z / r_m;
+
+  reference_position_i_m_ = f * rectification_position_i_m_ + g_s * rectification_velocity_i_m_s_;
+  reference_velocity_i_m_s_ = f_dot_1_s * rectification_position_i_m_ + g_dot * rectification_velocity_i_m_s_;
+  reference_time_s_ = time_from_rectification_s;
+  universal_anomaly_m0_5_ = chi;
+}
+
+double EnckeOrbitPropagation::CalcQFunction(const libra::Vector<3> difference_position_i_m, const libra::Vector<3> position_i_m) {
   double r2;
-  r2 = InnerProduct(spacecraft_position_i_m_, spacecraft_position_i_m_);
+  r2 = InnerProduct(position_i_m, position_i_m);
 
   libra::Vector<3> dr_2r;
-  dr_2r = difference_position_i_m - 2.0 * spacecraft_position_i_m_;
+  dr_2r = difference_position_i_m - 2.0 * position_i_m;
 
   double q = InnerProduct(difference_position_i_m, dr_2r) / r2;
 
@@ -124,3 +208,44 @@ double EnckeOrbitPropagation::CalcQFunction(libra::Vector<3> difference_position
 
   return q_func;
 }
+
+void EnckeOrbitPropagation::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  libra::OrdinaryDifferentialEquation<6>::SaveSnapshot(snapshot);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(reference_position_i_m_);
+  snapshot.Write(reference_velocity_i_m_s_);
+  const OrbitalElements& oe_ref = reference_kepler_orbit.GetOrbitalElements();
+  snapshot.Write(oe_ref.GetEpoch_jday());
+  snapshot.Write(oe_ref.GetSemiMajorAxis_m());
+  snapshot.Write(oe_ref.GetEccentricity());
+  snapshot.Write(oe_ref.GetInclination_rad());
+  snapshot.Write(oe_ref.GetRaan_rad());
+  snapshot.Write(oe_ref.GetArgPerigee_rad());
+  snapshot.Write(difference_position_i_m_);
+  snapshot.Write(difference_velocity_i_m_s_);
+  snapshot.Write(rectification_position_i_m_);
+  snapshot.Write(rectification_velocity_i_m_s_);
+  snapshot.Write(reciprocal_semi_major_axis_1_m_);
+  snapshot.Write(reference_time_s_);
+  snapshot.Write(universal_anomaly_m0_5_);
+}
+
+void EnckeOrbitPropagation::LoadSnapshot(SnapshotReader& snapshot) {
+  Orbit::LoadSnapshot(snapshot);
+  libra::OrdinaryDifferentialEquation<6>::LoadSnapshot(snapshot);
+  snapshot.Read(propagation_time_s_);
+  snapshot.Read(reference_position_i_m_);
+  snapshot.Read(reference_velocity_i_m_s_);
+  double oe_ref_values[6];
+  for (size_t i = 0; i < 6; i++) snapshot.Read(oe_ref_values[i]);
+  OrbitalElements oe_ref(oe_ref_values[0], oe_ref_values[1], oe_ref_values[2], oe_ref_values[3], oe_ref_values[4], oe_ref_values[5]);
+  reference_kepler_orbit = KeplerOrbit(gravity_constant_m3_s2_, oe_ref);
+  snapshot.Read(difference_position_i_m_);
+  snapshot.Read(difference_velocity_i_m_s_);
+  snapshot.Read(rectification_position_i_m_);
+  snapshot.Read(rectification_velocity_i_m_s_);
+  snapshot.Read(reciprocal_semi_major_axis_1_m_);
+  snapshot.Read(reference_time_s_);
+  snapshot.Read(universal_anomaly_m0_5_);
+}
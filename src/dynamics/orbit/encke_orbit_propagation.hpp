@@ -10,6 +10,15 @@
 #include "../../math_physics/orbit/kepler_orbit.hpp"
 #include "orbit.hpp"
 
+/**
+ * @enum EnckeReferenceOrbitMethod
+ * @brief Method to calculate the reference orbit of Encke's method
+ */
+enum class EnckeReferenceOrbitMethod {
+  kKepler,    //!< Kepler orbit at the start of each propagation step. Rectified when the current difference exceeds the tolerance.
+  kLagrange,  //!< Lagrange coefficients at each integration stage. Rectified when the predicted difference exceeds the tolerance.
+};
+
 /**
  * @class EnckeOrbitPropagation
  * @brief Class to propagate spacecraft orbit with Encke's method
@@ -44,6 +53,16 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
    * @param [in] current_time_jd: Current Julian day [day]
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Orbit
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Orbit
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
 
   // Override OrdinaryDifferentialEquation
   /**
@@ -55,6 +74,12 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
    */
   virtual void DerivativeFunction(double t, const libra::Vector<6>& state, libra::Vector<6>& rhs);
 
+  /**
+   * @fn SetReferenceOrbitMethod
+   * @brief Set the method to calculate the reference orbit
+   */
+  inline void SetReferenceOrbitMethod(const EnckeReferenceOrbitMethod method) { reference_orbit_method_ = method; }
+
  private:
   // General
   const double gravity_constant_m3_s2_;  //!< Gravity constant of the center body [m3/s2]
@@ -67,6 +92,14 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
   libra::Vector<3> reference_velocity_i_m_s_;  //!< Reference orbit velocity in the inertial frame [m/s]
   KeplerOrbit reference_kepler_orbit;          //!< Reference Kepler orbital element
 
+  // Lagrange coefficients of the reference orbit
+  EnckeReferenceOrbitMethod reference_orbit_method_ = EnckeReferenceOrbitMethod::kKepler;  //!< Method to calculate the reference orbit
+  libra::Vector<3> rectification_position_i_m_;    //!< Reference orbit position at the rectification in the inertial frame [m]
+  libra::Vector<3> rectification_velocity_i_m_s_;  //!< Reference orbit velocity at the rectification in the inertial frame [m/s]
+  double reciprocal_semi_major_axis_1_m_ = 0.0;    //!< Reciprocal of the semi-major axis (negative for hyperbola) [1/m]
+  double reference_time_s_ = 0.0;                  //!< Time from the rectification at the latest reference orbit calculation [s]
+  double universal_anomaly_m0_5_ = 0.0;            //!< Universal anomaly at the latest reference orbit calculation [m^0.5]
+
   // difference orbit
   libra::Vector<3> difference_position_i_m_;    //!< Difference orbit position in the inertial frame [m]
   libra::Vector<3> difference_velocity_i_m_s_;  //!< Difference orbit velocity in the inertial frame [m/s]
@@ -85,12 +118,20 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
    * @brief Update satellite orbit
    */
   void UpdateSatOrbit();
+  /**
+   * @fn CalcReferenceOrbit
+   * @brief Calculate the reference orbit with the Lagrange coefficients from the state at the rectification
+   * @note The universal Kepler equation is solved with Newton method from the universal anomaly of the previous calculation
+   * @param [in] time_from_rectification_s: Time from the rectification [s]
+   */
+  void CalcReferenceOrbit(const double time_from_rectification_s);
   /**
    * @fn CalcQFunction
    * @brief Calculate Q function
    * @param [in] difference_position_i_m: Difference of position in the inertial frame [m]
+   * @param [in] position_i_m: Spacecraft position in the inertial frame [m]
    */
-  double CalcQFunction(const libra::Vector<3> difference_position_i_m);
+  double CalcQFunction(const libra::Vector<3> difference_position_i_m, const libra::Vector<3> position_i_m);
 };
 
 #endif  // S2E_DYNAMICS_ORBIT_ENCKE_ORBIT_PROPAGATION_HPP_
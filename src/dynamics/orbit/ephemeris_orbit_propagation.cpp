@@ -0,0 +1,108 @@
+/**
+ * @file ephemeris_orbit_propagation.cpp
+ * @brief Class to play back an external ephemeris file as the spacecraft orbit
+ */
+#include "ephemeris_orbit_propagation.hpp"
+
+#include <iostream>
+#include <math_physics/time_system/epoch_time.hpp>
+#include <stdexcept>
+#include <utilities/macros.hpp>
+
+namespace {
+const double kJulianDateUnixEpoch = 2440587.5;  //!< Julian date of the origin of EpochTime (1970/01/01 00:00:00) [day]
+}  // namespace
+
+EphemerisOrbitPropagation::EphemerisOrbitPropagation(const CelestialInformation* celestial_information, const std::string file_name,
+                                                     const std::string satellite_id, const bool is_ecef, const double current_time_jd)
+    : Orbit(celestial_information), sp3_file_(file_name), is_ecef_(is_ecef), interpolation_orbit_(kNumberOfInterpolation) {
+  propagate_mode_ = OrbitPropagateMode::kEphemeris;
+  spacecraft_acceleration_i_m_s2_ *= 0;
+
+  const size_t number_of_epochs = sp3_file_.GetNumberOfEpoch();
+  if (number_of_epochs < kNumberOfInterpolation) {
+    throw std::invalid_argument("Ephemeris file " + file_name + " does not have " + std::to_string(kNumberOfInterpolation) + " epochs.");
+  }
+  if (!satellite_id.empty()) {
+    const std::vector<std::string>& satellite_ids = sp3_file_.GetHeader().satellite_ids_;
+    satellite_index_ = satellite_ids.size();
+    for (size_t i = 0; i < satellite_ids.size(); i++) {
+      if (satellite_ids[i] == satellite_id) satellite_index_ = i;
+    }
+    if (satellite_index_ == satellite_ids.size()) {
+      throw std::invalid_argument("Satellite " + satellite_id + " is not found in the ephemeris file " + file_name + ".");
+    }
+  }
+
+  const double first_epoch_time_s = EpochTime(sp3_file_.GetEpochData(0)).GetTimeWithFraction_s();
+  start_time_s_ = (current_time_jd - kJulianDateUnixEpoch) * (24.0 * 60.0 * 60.0) - first_epoch_time_s;
+  last_epoch_time_s_ = GetEpochTime_s(number_of_epochs - 1);
+  if (start_time_s_ < 0.0 || start_time_s_ > last_epoch_time_s_) {
+    throw std::invalid_argument("Simulation start time is out of the ephemeris file " + file_name + ".");
+  }
+
+  ResetInterpolation(start_time_s_);
+  UpdateState(start_time_s_);
+}
+
+EphemerisOrbitPropagation::~EphemerisOrbitPropagation() {}
+
+void EphemerisOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  UpdateState(start_time_s_ + end_time_s);
+}
+
+void EphemerisOrbitPropagation::UpdateState(const double time_s) {
+  if (time_s > last_epoch_time_s_ && !is_out_of_range_warned_) {
+    std::cout << "[Warning] Ephemeris orbit: The simulation time exceeds the ephemeris file. The orbit is extrapolated." << std::endl;
+    is_out_of_range_warned_ = true;
+  }
+
+  // The interpolation is shifted when the time passes the middle of the epochs
+  if (time_s < interpolation_orbit_.GetTimeList()[0]) ResetInterpolation(time_s);
+  while (time_s > interpolation_orbit_.GetTimeList()[kNumberOfInterpolation / 2] && next_epoch_id_ < sp3_file_.GetNumberOfEpoch()) {
+    interpolation_orbit_.PushAndPopData(GetEpochTime_s(next_epoch_id_), 1000.0 * sp3_file_.GetSatellitePosition_km(next_epoch_id_, satellite_index_));
+    next_epoch_id_++;
+  }
+
+  const libra::Vector<3> position_m = interpolation_orbit_.CalcPositionWithPolynomial(time_s);
+  const libra::Vector<3> velocity_m_s = interpolation_orbit_.CalcVelocityWithPolynomial(time_s);
+  if (is_ecef_) {
+    const libra::Matrix<3, 3>& dcm_ecef_to_i = celestial_information_->GetEarthRotation().GetDcmEcefToJ2000();
+    spacecraft_position_i_m_ = dcm_ecef_to_i * position_m;
+    // Inverse of the conversion in TransformEciToEcef
+    libra::Vector<3> earth_angular_velocity_i_rad_s{0.0};
+    earth_angular_velocity_i_rad_s[2] = environment::earth_mean_angular_velocity_rad_s;
+    spacecraft_velocity_i_m_s_ = dcm_ecef_to_i * velocity_m_s + OuterProduct(earth_angular_velocity_i_rad_s, spacecraft_position_i_m_);
+  } else {
+    spacecraft_position_i_m_ = position_m;
+    spacecraft_velocity_i_m_s_ = velocity_m_s;
+  }
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+
+  // The ephemeris does not depend on the acceleration
+  spacecraft_acceleration_i_m_s2_ *= 0.0;
+}
+
+void EphemerisOrbitPropagation::ResetInterpolation(const double time_s) {
+  // The window of the epochs centered at the nearest epoch
+  const size_t number_of_epochs = sp3_file_.GetNumberOfEpoch();
+  const double interval_s = sp3_file_.GetHeader().epoch_interval_s_;
+  size_t nearest_epoch_id = time_s > 0.0 ? (size_t)(time_s / interval_s + 0.5) : 0;
+  if (nearest_epoch_id >= number_of_epochs) nearest_epoch_id = number_of_epochs - 1;
+  size_t first_epoch_id = nearest_epoch_id > kNumberOfInterpolation / 2 ? nearest_epoch_id - kNumberOfInterpolation / 2 : 0;
+  if (first_epoch_id + kNumberOfInterpolation > number_of_epochs) first_epoch_id = number_of_epochs - kNumberOfInterpolation;
+
+  interpolation_orbit_ = InterpolationOrbit(kNumberOfInterpolation);
+  for (next_epoch_id_ = first_epoch_id; next_epoch_id_ < first_epoch_id + kNumberOfInterpolation; next_epoch_id_++) {
+    interpolation_orbit_.PushAndPopData(GetEpochTime_s(next_epoch_id_), 1000.0 * sp3_file_.GetSatellitePosition_km(next_epoch_id_, satellite_index_));
+  }
+}
+
+double EphemerisOrbitPropagation::GetEpochTime_s(const size_t epoch_id) const {
+  return EpochTime(sp3_file_.GetEpochData(epoch_id)).GetTimeWithFraction_s() - EpochTime(sp3_file_.GetEpochData(0)).GetTimeWithFraction_s();
+}
@@ -0,0 +1,84 @@
+/**
+ * @file ephemeris_orbit_propagation.hpp
+ * @brief Class to play back an external ephemeris file as the spacecraft orbit
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_EPHEMERIS_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_EPHEMERIS_ORBIT_PROPAGATION_HPP_
+
+#include <math_physics/gnss/sp3_file_reader.hpp>
+#include <math_physics/orbit/interpolation_orbit.hpp>
+#include <string>
+
+#include "orbit.hpp"
+
+/**
+ * @class EphemerisOrbitPropagation
+ * @brief Class to play back an external ephemeris file as the spacecraft orbit
+ * @details The position of the spacecraft is read from the SP3 file (e.g., flight data or the output of an external high-fidelity propagator)
+ *          and interpolated at the simulation time with the polynomial of the nearest epochs. The velocity is the time derivative of the
+ *          polynomial. The SP3 file is decoded by the window of the epochs, and the binary file written by Sp3FileReader::WriteBinaryFile is
+ *          also accepted, so the memory use does not depend on the length of the file.
+ * @note The orbit is not changed by the disturbances and the thrusters. The epochs of the SP3 file are compared with the simulation time
+ *       without the conversion of the time system like GnssSatellites.
+ */
+class EphemerisOrbitPropagation : public Orbit {
+ public:
+  /**
+   * @fn EphemerisOrbitPropagation
+   * @brief Constructor. Throws std::invalid_argument when the file or the satellite cannot be used.
+   * @param [in] celestial_information: Celestial information
+   * @param [in] file_name: Path to the SP3 file or its binary file
+   * @param [in] satellite_id: Satellite ID in the SP3 file (e.g., L51). Empty selects the first satellite.
+   * @param [in] is_ecef: True when the positions in the file are in the ECEF frame, false when they are in the inertial frame
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  EphemerisOrbitPropagation(const CelestialInformation* celestial_information, const std::string file_name, const std::string satellite_id,
+                            const bool is_ecef, const double current_time_jd);
+  /**
+   * @fn ~EphemerisOrbitPropagation
+   * @brief Destructor
+   */
+  ~EphemerisOrbitPropagation();
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Update the orbit with the ephemeris at the time
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+
+ private:
+  static const size_t kNumberOfInterpolation = 9;  //!< Number of the epochs for the interpolation
+
+  Sp3FileReader sp3_file_;                  //!< Reader of the ephemeris file
+  size_t satellite_index_ = 0;              //!< Index of the satellite in the ephemeris file
+  bool is_ecef_;                            //!< True when the positions in the file are in the ECEF frame
+  double start_time_s_;                     //!< Simulation start time from the first epoch of the file [s]
+  double last_epoch_time_s_;                //!< Time of the last epoch from the first epoch of the file [s]
+  InterpolationOrbit interpolation_orbit_;  //!< Interpolation of the position with the time from the first epoch of the file
+  size_t next_epoch_id_ = 0;                //!< Epoch ID which is added to the interpolation next
+  bool is_out_of_range_warned_ = false;     //!< Flag of the warning of the time out of the file
+
+  /**
+   * @fn UpdateState
+   * @brief Update the position and velocity with the ephemeris
+   * @param [in] time_s: Time from the first epoch of the file [s]
+   */
+  void UpdateState(const double time_s);
+  /**
+   * @fn ResetInterpolation
+   * @brief Fill the interpolation with the epochs around the time
+   * @param [in] time_s: Time from the first epoch of the file [s]
+   */
+  void ResetInterpolation(const double time_s);
+  /**
+   * @fn GetEpochTime_s
+   * @brief Return the time of the epoch from the first epoch of the file [s]
+   */
+  double GetEpochTime_s(const size_t epoch_id) const;
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_EPHEMERIS_ORBIT_PROPAGATION_HPP_
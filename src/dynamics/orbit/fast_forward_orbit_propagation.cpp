@@ -0,0 +1,188 @@
+/**
+ * @file fast_forward_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit with the semi-analytic mean elements during coasts and Runge-Kutta-4 method during maneuvers
+ */
+#include "fast_forward_orbit_propagation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <math_physics/math/s2e_math.hpp>
+#include <math_physics/orbit/kepler_orbit.hpp>
+#include <utilities/macros.hpp>
+
+FastForwardOrbitPropagation::FastForwardOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2,
+                                                         const double time_step_s, const double current_time_jd,
+                                                         const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                                                         const double acceleration_threshold_m_s2)
+    : Orbit(celestial_information),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      propagation_time_s_(0.0),
+      propagation_step_s_(time_step_s),
+      acceleration_threshold_m_s2_(acceleration_threshold_m_s2),
+      numerical_integrator_(time_step_s, *this) {
+  propagate_mode_ = OrbitPropagateMode::kFastForward;
+  spacecraft_acceleration_i_m_s2_ *= 0;
+
+  SetMeanElements(current_time_jd, position_i_m, velocity_i_m_s);
+  // The initial state is used as it is to avoid the jump caused by the Kepler equation solver
+  spacecraft_position_i_m_ = position_i_m;
+  spacecraft_velocity_i_m_s_ = velocity_i_m_s;
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+FastForwardOrbitPropagation::~FastForwardOrbitPropagation() {}
+
+libra::Vector<6> FastForwardOrbitPropagation::DerivativeFunction(const double time_s, const libra::Vector<6>& state) const {
+  UNUSED(time_s);
+
+  libra::Vector<6> rhs;
+  const double r2 = state[0] * state[0] + state[1] * state[1] + state[2] * state[2];
+  const double mu_r3 = gravity_constant_m3_s2_ / (r2 * sqrt(r2));
+
+  // J2 acceleration with the z-axis of the inertial frame as the rotation axis of the Earth
+  const double j2_coefficient = 1.5 * environment::earth_j2 * environment::earth_equatorial_radius_m * environment::earth_equatorial_radius_m / r2;
+  const double z2_r2 = state[2] * state[2] / r2;
+  const double j2_factors[3] = {1.0 - 5.0 * z2_r2, 1.0 - 5.0 * z2_r2, 3.0 - 5.0 * z2_r2};
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = spacecraft_acceleration_i_m_s2_[i] - mu_r3 * state[i] * (1.0 + j2_coefficient * j2_factors[i]);
+  }
+  return rhs;
+}
+
+void FastForwardOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  if (!is_calc_enabled_) return;
+
+  // Select the propagation phase with the acceleration of this propagation
+  bool is_coast = is_coast_enabled_;
+  if (acceleration_threshold_m_s2_ > 0.0 && spacecraft_acceleration_i_m_s2_.CalcNorm() > acceleration_threshold_m_s2_) is_coast = false;
+
+  // Handover at the start time of this propagation
+  if (is_coast && !is_coasting_) {
+    const double start_time_jd = current_time_jd - (end_time_s - propagation_time_s_) / (24.0 * 60.0 * 60.0);
+    SetMeanElements(start_time_jd, spacecraft_position_i_m_, spacecraft_velocity_i_m_s_);
+  } else if (!is_coast && is_coasting_) {
+    libra::Vector<6> state;
+    for (size_t i = 0; i < 3; i++) {
+      state[i] = spacecraft_position_i_m_[i];
+      state[i + 3] = spacecraft_velocity_i_m_s_[i];
+    }
+    numerical_integrator_.SetState(propagation_time_s_, state);
+  }
+  is_coasting_ = is_coast;
+
+  if (is_coasting_) {
+    PropagateMeanElements(end_time_s - propagation_time_s_);
+    propagation_time_s_ = end_time_s;
+    UpdateStateFromMeanElements(current_time_jd);
+  } else {
+    PropagateNumerically(end_time_s);
+  }
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void FastForwardOrbitPropagation::PropagateMeanElements(const double time_step_s) {
+  const double a_m = semi_major_axis_m_;
+  const double e = eccentricity_;
+  const double n_rad_s = sqrt(gravity_constant_m3_s2_ / (a_m * a_m * a_m));
+  const double semi_latus_rectum_m = a_m * (1.0 - e * e);
+  const double cos_i = cos(inclination_rad_);
+
+  // Secular J2 rates (Ref: Vallado, Fundamentals of Astrodynamics and Applications, Section 9.6)
+  const double radius_ratio = environment::earth_equatorial_radius_m / semi_latus_rectum_m;
+  const double k_rad_s = 1.5 * environment::earth_j2 * radius_ratio * radius_ratio * n_rad_s;
+  raan_rad_ = libra::WrapTo2Pi(raan_rad_ - k_rad_s * cos_i * time_step_s);
+  arg_perigee_rad_ = libra::WrapTo2Pi(arg_perigee_rad_ + 0.5 * k_rad_s * (5.0 * cos_i * cos_i - 1.0) * time_step_s);
+  mean_anomaly_rad_ =
+      libra::WrapTo2Pi(mean_anomaly_rad_ + (n_rad_s + 0.5 * k_rad_s * sqrt(1.0 - e * e) * (3.0 * cos_i * cos_i - 1.0)) * time_step_s);
+
+  // Decay of the semi-major axis and the angular momentum by the disturbance acceleration (e.g., air drag)
+  const libra::Vector<3> angular_momentum_m2_s = OuterProduct(spacecraft_position_i_m_, spacecraft_velocity_i_m_s_);
+  const double angular_momentum_norm_m2_s = angular_momentum_m2_s.CalcNorm();
+  const double semi_major_axis_rate_m_s =
+      2.0 * a_m * a_m / gravity_constant_m3_s2_ * InnerProduct(spacecraft_velocity_i_m_s_, spacecraft_acceleration_i_m_s2_);
+  const double angular_momentum_rate_m2_s2 =
+      InnerProduct(angular_momentum_m2_s, OuterProduct(spacecraft_position_i_m_, spacecraft_acceleration_i_m_s2_)) / angular_momentum_norm_m2_s;
+
+  semi_major_axis_m_ += semi_major_axis_rate_m_s * time_step_s;
+  const double new_angular_momentum_m2_s = angular_momentum_norm_m2_s + angular_momentum_rate_m2_s2 * time_step_s;
+  const double eccentricity_squared =
+      1.0 - new_angular_momentum_m2_s * new_angular_momentum_m2_s / (gravity_constant_m3_s2_ * semi_major_axis_m_);
+  eccentricity_ = sqrt(std::max(0.0, eccentricity_squared));
+}
+
+void FastForwardOrbitPropagation::PropagateNumerically(const double end_time_s) {
+  numerical_integrator_.SetStepWidth(propagation_step_s_);
+  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+    numerical_integrator_.Integrate();
+    propagation_time_s_ += propagation_step_s_;
+  }
+  numerical_integrator_.SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation step width
+  numerical_integrator_.Integrate();
+  propagation_time_s_ = end_time_s;
+
+  const libra::Vector<6>& state = numerical_integrator_.GetState();
+  for (size_t i = 0; i < 3; i++) {
+    spacecraft_position_i_m_[i] = state[i];
+    spacecraft_velocity_i_m_s_[i] = state[i + 3];
+  }
+}
+
+void FastForwardOrbitPropagation::SetMeanElements(const double time_jd, const libra::Vector<3> position_i_m,
+                                                  const libra::Vector<3> velocity_i_m_s) {
+  OrbitalElements oe(gravity_constant_m3_s2_, time_jd, position_i_m, velocity_i_m_s);
+  semi_major_axis_m_ = oe.GetSemiMajorAxis_m();
+  eccentricity_ = oe.GetEccentricity();
+  inclination_rad_ = oe.GetInclination_rad();
+  raan_rad_ = oe.GetRaan_rad();
+  arg_perigee_rad_ = oe.GetArgPerigee_rad();
+
+  const double n_rad_s = sqrt(gravity_constant_m3_s2_ / pow(semi_major_axis_m_, 3.0));
+  mean_anomaly_rad_ = libra::WrapTo2Pi(n_rad_s * (time_jd - oe.GetEpoch_jday()) * (24.0 * 60.0 * 60.0));
+}
+
+void FastForwardOrbitPropagation::UpdateStateFromMeanElements(const double time_jd) {
+  // The epoch is the time at the perigee
+  const double n_rad_s = sqrt(gravity_constant_m3_s2_ / pow(semi_major_axis_m_, 3.0));
+  const double epoch_jd = time_jd - mean_anomaly_rad_ / n_rad_s / (24.0 * 60.0 * 60.0);
+  OrbitalElements oe(epoch_jd, semi_major_axis_m_, eccentricity_, inclination_rad_, raan_rad_, arg_perigee_rad_);
+  KeplerOrbit kepler_orbit(gravity_constant_m3_s2_, oe);
+  kepler_orbit.CalcOrbit(time_jd);
+
+  spacecraft_position_i_m_ = kepler_orbit.GetPosition_i_m();
+  spacecraft_velocity_i_m_s_ = kepler_orbit.GetVelocity_i_m_s();
+}
+
+void FastForwardOrbitPropagation::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(numerical_integrator_.GetCurrentIndependentVariable());
+  snapshot.Write(numerical_integrator_.GetState());
+  snapshot.Write(is_coasting_);
+  snapshot.Write(semi_major_axis_m_);
+  snapshot.Write(eccentricity_);
+  snapshot.Write(inclination_rad_);
+  snapshot.Write(raan_rad_);
+  snapshot.Write(arg_perigee_rad_);
+  snapshot.Write(mean_anomaly_rad_);
+}
+
+void FastForwardOrbitPropagation::LoadSnapshot(SnapshotReader& snapshot) {
+  Orbit::LoadSnapshot(snapshot);
+  snapshot.Read(propagation_time_s_);
+  double integration_time_s;
+  libra::Vector<6> state;
+  snapshot.Read(integration_time_s);
+  snapshot.Read(state);
+  numerical_integrator_.SetState(integration_time_s, state);
+  snapshot.Read(is_coasting_);
+  snapshot.Read(semi_major_axis_m_);
+  snapshot.Read(eccentricity_);
+  snapshot.Read(inclination_rad_);
+  snapshot.Read(raan_rad_);
+  snapshot.Read(arg_perigee_rad_);
+  snapshot.Read(mean_anomaly_rad_);
+}
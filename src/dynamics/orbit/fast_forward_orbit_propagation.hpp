@@ -0,0 +1,138 @@
+/**
+ * @file fast_forward_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit with the semi-analytic mean elements during coasts and Runge-Kutta-4 method during maneuvers
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_FAST_FORWARD_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_FAST_FORWARD_ORBIT_PROPAGATION_HPP_
+
+#include <environment/global/celestial_information.hpp>
+#include <math_physics/numerical_integration/runge_kutta_4.hpp>
+
+#include "orbit.hpp"
+
+/**
+ * @class FastForwardOrbitPropagation
+ * @brief Class to propagate spacecraft orbit with the semi-analytic mean elements during coasts and Runge-Kutta-4 method during maneuvers
+ * @details In the coast phase, the mean elements are propagated with the secular J2 rates of the Earth, and the semi-major axis and the
+ *          eccentricity decay with the along-track and the out-of-plane work of the disturbance acceleration (e.g., air drag). The position
+ *          and velocity are calculated with the Kepler orbit of the mean elements, so the propagation cost does not depend on the orbit
+ *          step width. In the numerical phase, the orbit is integrated with the two-body and J2 gravity and the disturbance and thruster
+ *          acceleration by RK4. The phase is switched to the numerical phase when the acceleration exceeds the threshold (e.g., thruster
+ *          maneuver) and back to the coast phase when the acceleration decreases below the threshold.
+ * @note The conversion between the mean elements and the position/velocity treats the osculating elements as the mean elements, so the J2
+ *       short-period terms (several km in LEO) are not modeled at the handover. The J2 gravity of the Earth is included in both phases, so
+ *       the geopotential disturbance should be disabled to avoid double counting.
+ */
+class FastForwardOrbitPropagation : public Orbit, public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn FastForwardOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] time_step_s: Step width of the numerical phase [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] acceleration_threshold_m_s2: Threshold of the acceleration to switch to the numerical phase [m/s2] (Zero or negative value
+   * disables the automatic switching)
+   */
+  FastForwardOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2, const double time_step_s,
+                              const double current_time_jd, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                              const double acceleration_threshold_m_s2);
+  /**
+   * @fn ~FastForwardOrbitPropagation
+   * @brief Destructor
+   */
+  ~FastForwardOrbitPropagation();
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Right Hand Side of ordinary difference equation
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const;
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Orbit
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Orbit
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
+
+  /**
+   * @fn SetCoastEnabled
+   * @brief Enable or disable the coast phase. The orbit is propagated in the numerical phase when the coast phase is disabled.
+   * @param [in] is_coast_enabled: Flag to enable the coast phase
+   */
+  inline void SetCoastEnabled(const bool is_coast_enabled) { is_coast_enabled_ = is_coast_enabled; }
+  /**
+   * @fn IsCoasting
+   * @brief Return true when the orbit is propagated with the mean elements
+   */
+  inline bool IsCoasting() const { return is_coasting_; }
+
+ private:
+  double gravity_constant_m3_s2_;       //!< Gravity constant [m3/s2]
+  double propagation_time_s_;           //!< Simulation current time for the propagation [sec]
+  double propagation_step_s_;           //!< Step width for RK4 [sec]
+  double acceleration_threshold_m_s2_;  //!< Threshold of the acceleration to switch to the numerical phase [m/s2]
+
+  libra::numerical_integration::RungeKutta4<6> numerical_integrator_;  //!< Numerical integrator for the numerical phase
+
+  bool is_coast_enabled_ = true;  //!< Flag to enable the coast phase
+  bool is_coasting_ = true;       //!< Flag of the current propagation phase
+
+  // Mean elements
+  double semi_major_axis_m_;  //!< Mean semi-major axis [m]
+  double eccentricity_;       //!< Mean eccentricity
+  double inclination_rad_;    //!< Mean inclination [rad]
+  double raan_rad_;           //!< Mean right ascension of the ascending node [rad]
+  double arg_perigee_rad_;    //!< Mean argument of perigee [rad]
+  double mean_anomaly_rad_;   //!< Mean anomaly [rad]
+
+  /**
+   * @fn PropagateMeanElements
+   * @brief Propagate the mean elements with the secular J2 rates and the disturbance acceleration
+   * @param [in] time_step_s: Propagation time step [sec]
+   */
+  void PropagateMeanElements(const double time_step_s);
+  /**
+   * @fn PropagateNumerically
+   * @brief Propagate the position and velocity with RK4
+   * @param [in] end_time_s: End time of simulation [sec]
+   */
+  void PropagateNumerically(const double end_time_s);
+  /**
+   * @fn SetMeanElements
+   * @brief Set the mean elements from the position and velocity
+   * @param [in] time_jd: Julian day of the position and velocity [day]
+   * @param [in] position_i_m: Position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+   */
+  void SetMeanElements(const double time_jd, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s);
+  /**
+   * @fn UpdateStateFromMeanElements
+   * @brief Update the position and velocity of Orbit with the Kepler orbit of the mean elements
+   * @param [in] time_jd: Current Julian day [day]
+   */
+  void UpdateStateFromMeanElements(const double time_jd);
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_FAST_FORWARD_ORBIT_PROPAGATION_HPP_
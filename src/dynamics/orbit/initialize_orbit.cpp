@@ -6,11 +6,15 @@
 
 #include <setting_file_reader/initialize_file_access.hpp>
 
+#include "adaptive_step_orbit_propagation.hpp"
 #include "encke_orbit_propagation.hpp"
+#include "ephemeris_orbit_propagation.hpp"
+#include "fast_forward_orbit_propagation.hpp"
 #include "kepler_orbit_propagation.hpp"
 #include "relative_orbit.hpp"
 #include "rk4_orbit_propagation.hpp"
 #include "sgp4_orbit_propagation.hpp"
+#include "stm_orbit_propagation.hpp"
 
 Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string initialize_file, double step_width_s, double current_time_jd,
                  double gravity_constant_m3_s2, std::string section, RelativeInformation* relative_information) {
@@ -33,7 +37,12 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
       position_i_m[i] = pos_vel[i];
       velocity_i_m_s[i] = pos_vel[i + 3];
     }
-    orbit = new Rk4OrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s);
+    Rk4OrbitPropagation* rk4_orbit =
+        new Rk4OrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s);
+    if (conf.ReadString(section_, "numerical_integration_method") == "ABM") {
+      rk4_orbit->SetIntegrationMethod(libra::numerical_integration::NumericalIntegrationMethod::kAbm);
+    }
+    orbit = rk4_orbit;
   } else if (propagate_mode == "SGP4") {
     // Initialize SGP4 orbit propagator
     int wgs_setting = conf.ReadInt(section_, "wgs_setting");
@@ -94,8 +103,59 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
     }
 
     double error_tolerance = conf.ReadDouble(section_, "error_tolerance");
-    orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd, position_i_m, velocity_i_m_s,
-                                      error_tolerance);
+    EnckeOrbitPropagation* encke_orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd,
+                                                                   position_i_m, velocity_i_m_s, error_tolerance);
+    if (conf.ReadString(section_, "numerical_integration_method") == "ABM") {
+      encke_orbit->SetIntegrationMethod(libra::numerical_integration::NumericalIntegrationMethod::kAbm);
+    }
+    if (conf.ReadString(section_, "encke_reference_orbit_method") == "LAGRANGE") {
+      encke_orbit->SetReferenceOrbitMethod(EnckeReferenceOrbitMethod::kLagrange);
+    }
+    orbit = encke_orbit;
+  } else if (propagate_mode == "ADAPTIVE") {
+    // initialize orbit for adaptive step propagation
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+
+    double error_tolerance = conf.ReadDouble(section_, "adaptive_error_tolerance");
+    std::string method_name = conf.ReadString(section_, "adaptive_integration_method");
+    libra::numerical_integration::NumericalIntegrationMethod method = libra::numerical_integration::NumericalIntegrationMethod::kDp5;
+    if (method_name == "RKF") method = libra::numerical_integration::NumericalIntegrationMethod::kRkf;
+    orbit = new AdaptiveStepOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s,
+                                             error_tolerance, method);
+  } else if (propagate_mode == "STM") {
+    // initialize orbit for propagation with the state transition matrix
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+    orbit = new StmOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s);
+  } else if (propagate_mode == "FAST_FORWARD") {
+    // initialize orbit for semi-analytic propagation during coasts
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+    double acceleration_threshold_m_s2 = conf.ReadDouble(section_, "fast_forward_acceleration_threshold_m_s2");
+    orbit = new FastForwardOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd, position_i_m,
+                                            velocity_i_m_s, acceleration_threshold_m_s2);
+  } else if (propagate_mode == "EPHEMERIS") {
+    // initialize orbit for playback of the external ephemeris
+    const std::string ephemeris_file = conf.ReadString(section_, "ephemeris_file");
+    const std::string ephemeris_satellite_id = conf.ReadString(section_, "ephemeris_satellite_id");
+    const bool is_ecef = conf.ReadString(section_, "ephemeris_frame") != "INERTIAL";
+    orbit = new EphemerisOrbitPropagation(celestial_information, ephemeris_file, ephemeris_satellite_id, is_ecef, current_time_jd);
   } else {
     std::cerr << "ERROR: orbit propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The orbit mode is automatically set as RK4" << std::endl;
@@ -111,6 +171,7 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
   }
 
   orbit->SetIsCalcEnabled(conf.ReadEnable(section_, "calculation"));
+  orbit->SetGeodeticConversionMethod(SetGeodeticConversionMethod(conf.ReadString(section_, "geodetic_conversion_method")));
   orbit->is_log_enabled_ = conf.ReadEnable(section_, "logging");
   return orbit;
 }
@@ -4,6 +4,8 @@
  */
 #include "orbit.hpp"
 
+#include <stdexcept>
+
 libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const {
   libra::Vector<3> lvlh_x = spacecraft_position_i_m_;  // x-axis in LVLH frame is position vector direction from geocenter to satellite
   libra::Vector<3> lvlh_ex = lvlh_x.CalcNormalizedVector();
@@ -28,8 +30,36 @@ libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const {
   return q_i2lvlh.Normalize();
 }
 
+void Orbit::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("ORBIT");
+  snapshot.Write(propagate_mode_);
+  snapshot.Write(spacecraft_position_i_m_);
+  snapshot.Write(spacecraft_position_ecef_m_);
+  snapshot.Write(spacecraft_geodetic_position_);
+  snapshot.Write(spacecraft_velocity_i_m_s_);
+  snapshot.Write(spacecraft_velocity_b_m_s_);
+  snapshot.Write(spacecraft_velocity_ecef_m_s_);
+  snapshot.Write(spacecraft_acceleration_i_m_s2_);
+  snapshot.Write(state_transition_matrix_);
+}
+
+void Orbit::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("ORBIT");
+  OrbitPropagateMode propagate_mode;
+  snapshot.Read(propagate_mode);
+  if (propagate_mode != propagate_mode_) throw std::invalid_argument("Snapshot is made with the different orbit propagation mode.");
+  snapshot.Read(spacecraft_position_i_m_);
+  snapshot.Read(spacecraft_position_ecef_m_);
+  snapshot.Read(spacecraft_geodetic_position_);
+  snapshot.Read(spacecraft_velocity_i_m_s_);
+  snapshot.Read(spacecraft_velocity_b_m_s_);
+  snapshot.Read(spacecraft_velocity_ecef_m_s_);
+  snapshot.Read(spacecraft_acceleration_i_m_s2_);
+  snapshot.Read(state_transition_matrix_);
+}
+
 void Orbit::TransformEciToEcef(void) {
-  libra::Matrix<3, 3> dcm_i_to_xcxf = celestial_information_->GetEarthRotation().GetDcmJ2000ToEcef();
+  const libra::Matrix<3, 3>& dcm_i_to_xcxf = celestial_information_->GetEarthRotation().GetDcmJ2000ToEcef();
   spacecraft_position_ecef_m_ = dcm_i_to_xcxf * spacecraft_position_i_m_;
 
   // convert velocity vector in ECI to the vector in ECEF
@@ -93,3 +123,16 @@ std::string Orbit::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool Orbit::AppendLogValue(ILogValueSink& sink) const {
+  sink.AppendVector(spacecraft_position_i_m_, 16);
+  sink.AppendVector(spacecraft_position_ecef_m_, 16);
+  sink.AppendVector(spacecraft_velocity_i_m_s_, 10);
+  sink.AppendVector(spacecraft_velocity_b_m_s_, 10);
+  sink.AppendVector(spacecraft_acceleration_i_m_s2_, 10);
+  sink.AppendDouble(spacecraft_geodetic_position_.GetLatitude_rad());
+  sink.AppendDouble(spacecraft_geodetic_position_.GetLongitude_rad());
+  sink.AppendDouble(spacecraft_geodetic_position_.GetAltitude_m());
+
+  return true;
+}
@@ -15,6 +15,10 @@
 #include <math_physics/math/matrix_vector.hpp>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <utilities/case_arena.hpp>
+#include <utilities/snapshot.hpp>
+
+#include "orbit_force_model.hpp"
 
 /**
  * @enum OrbitPropagateMode
@@ -25,7 +29,11 @@ enum class OrbitPropagateMode {
   kSgp4,           //!< SGP4 propagation using TLE without thruster maneuver
   kRelativeOrbit,  //!< Relative dynamics (for formation flying simulation)
   kKepler,         //!< Kepler orbit propagation without disturbances and thruster maneuver
-  kEncke           //!< Encke orbit propagation with disturbances and thruster maneuver
+  kEncke,          //!< Encke orbit propagation with disturbances and thruster maneuver
+  kAdaptiveStep,   //!< Adaptive step propagation with an embedded Runge-Kutta method, disturbances, and thruster maneuver
+  kStm,            //!< 4th order Runge-Kutta propagation with the state transition matrix by the variational equations
+  kFastForward,    //!< Semi-analytic mean elements propagation during coasts and 4th order Runge-Kutta propagation during maneuvers
+  kEphemeris       //!< Interpolation of the external ephemeris file without disturbances and thruster maneuver
 };
 
 /**
@@ -42,14 +50,15 @@ enum class OrbitInitializeMode {
  * @class Orbit
  * @brief Base class of orbit propagation
  */
-class Orbit : public ILoggable {
+class Orbit : public ILoggable, public ArenaAllocated {
  public:
   /**
    * @fn Orbit
    * @brief Constructor
    * @param [in] celestial_information: Celestial information
    */
-  Orbit(const CelestialInformation* celestial_information) : celestial_information_(celestial_information) {}
+  Orbit(const CelestialInformation* celestial_information)
+      : celestial_information_(celestial_information), state_transition_matrix_(libra::MakeIdentityMatrix<6>()) {}
   /**
    * @fn ~Orbit
    * @brief Destructor
@@ -73,6 +82,20 @@ class Orbit : public ILoggable {
     spacecraft_velocity_b_m_s_ = quaternion_i2b.FrameConversion(spacecraft_velocity_i_m_s_);
   }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the orbit state to the snapshot
+   * @note Override this function and call it in the derived class to add the state of the propagator
+   * @param [out] snapshot: Snapshot writer
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the orbit state from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
+
   // Getters
   /**
    * @fn GetIsCalcEnabled
@@ -126,6 +149,12 @@ class Orbit : public ILoggable {
     vec(2) = spacecraft_geodetic_position_.GetAltitude_m();
     return vec;
   }
+  /**
+   * @fn GetStateTransitionMatrix
+   * @brief Return the state transition matrix of the position and velocity in the inertial frame from the reference epoch
+   * @note It is the identity matrix when the propagation mode does not propagate the state transition matrix
+   */
+  inline libra::Matrix<6, 6> GetStateTransitionMatrix() const { return state_transition_matrix_; }
 
   // Setters
   /**
@@ -133,6 +162,11 @@ class Orbit : public ILoggable {
    * @brief Set calculate flag
    */
   inline void SetIsCalcEnabled(const bool is_calc_enabled) { is_calc_enabled_ = is_calc_enabled; }
+  /**
+   * @fn SetGeodeticConversionMethod
+   * @brief Set the method to convert the ECEF position to the geodetic position
+   */
+  inline void SetGeodeticConversionMethod(const GeodeticConversionMethod method) { spacecraft_geodetic_position_.SetConversionMethod(method); }
   /**
    * @fn SetAcceleration_i_m_s2
    * @brief Set acceleration in the inertial frame [m/s2]
@@ -165,6 +199,12 @@ class Orbit : public ILoggable {
     auto force_i = quaternion_i2b.InverseFrameConversion(force_b_N);
     AddForce_i_N(force_i, spacecraft_mass_kg);
   }
+  /**
+   * @fn SetForceModel
+   * @brief Set the force model evaluated at each integrator stage (Only the RK4 propagation uses it now)
+   * @param [in] force_model: Force model. nullptr holds the acceleration during the step.
+   */
+  inline void SetForceModel(OrbitForceModel* force_model) { force_model_ = force_model; }
 
   /**
    * @fn CalcQuaternion_i2lvlh
@@ -183,6 +223,11 @@ class Orbit : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual bool AppendLogValue(ILogValueSink& sink) const;
 
  protected:
   const CelestialInformation* celestial_information_;  //!< Celestial information
@@ -202,6 +247,9 @@ class Orbit : public ILoggable {
   libra::Vector<3> spacecraft_acceleration_i_m_s2_;  //!< Spacecraft acceleration in the inertial frame [m/s2]
                                                      //!< NOTE: Clear to zero at the end of the Propagate function
 
+  libra::Matrix<6, 6> state_transition_matrix_;  //!< State transition matrix of the position and velocity in the inertial frame
+  OrbitForceModel* force_model_ = nullptr;       //!< Force model evaluated at each integrator stage
+
   // Frame Conversion TODO: consider other planet
   /**
    * @fn TransformEciToEcef
@@ -0,0 +1,37 @@
+/**
+ * @file orbit_force_model.hpp
+ * @brief Interface of the force model evaluated at each stage of the orbit integrator
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_ORBIT_FORCE_MODEL_HPP_
+#define S2E_DYNAMICS_ORBIT_ORBIT_FORCE_MODEL_HPP_
+
+#include <math_physics/math/vector.hpp>
+
+/**
+ * @class OrbitForceModel
+ * @brief Interface of the force model evaluated at each stage of the orbit integrator
+ * @details The acceleration set to the orbit (e.g. disturbances, thrusters) is calculated once per step at the state of the step start and
+ *          held during the step. The force model returns the difference from the held acceleration at the state of each integrator stage.
+ */
+class OrbitForceModel {
+ public:
+  /**
+   * @fn ~OrbitForceModel
+   * @brief Destructor
+   */
+  virtual ~OrbitForceModel() {}
+
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Calculate the acceleration added to the held acceleration at the integrator stage
+   * @param [in] time_from_step_start_s: Time of the stage from the step start [s]
+   * @param [in] position_i_m: Position of the stage in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity of the stage in the inertial frame [m/s]
+   * @return Additional acceleration in the inertial frame [m/s2]
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_step_start_s, const libra::Vector<3>& position_i_m,
+                                                        const libra::Vector<3>& velocity_i_m_s) = 0;
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_ORBIT_FORCE_MODEL_HPP_
@@ -53,10 +53,13 @@ void RelativeOrbit::InitializeState(libra::Vector<3> relative_position_lvlh_m, l
   initial_state_[4] = relative_velocity_lvlh_m_s[1];
   initial_state_[5] = relative_velocity_lvlh_m_s[2];
 
+  CalculateReferenceOrbitElements(&(relative_information_->GetReferenceSatDynamics(reference_spacecraft_id_)->GetOrbit()), gravity_constant_m3_s2);
   if (update_method_ == kRk4) {
     Setup(initial_time_s, initial_state_);
     CalculateSystemMatrix(relative_dynamics_model_type_, &(relative_information_->GetReferenceSatDynamics(reference_spacecraft_id_)->GetOrbit()),
                           gravity_constant_m3_s2);
+  } else if (update_method_ == kStepStm) {
+    GetStepStm(initial_time_s, propagation_step_s_);  // Precompute the STM of the nominal step
   } else  // update_method_ == STM
   {
     CalculateStm(stm_model_type_, &(relative_information_->GetReferenceSatDynamics(reference_spacecraft_id_)->GetOrbit()), gravity_constant_m3_s2,
@@ -86,6 +89,12 @@ void RelativeOrbit::CalculateStm(StmModel stm_model_type, const Orbit* reference
     case StmModel::kHcw: {
       double reference_sat_orbit_radius = reference_sat_orbit->GetPosition_i_m().CalcNorm();
       stm_ = CalcHcwStm(reference_sat_orbit_radius, gravity_constant_m3_s2, elapsed_sec);
+      break;
+    }
+    case StmModel::kYamanakaAnkersen: {
+      stm_ = CalcYamanakaAnkersenStm(reference_semi_latus_rectum_m_, reference_eccentricity_, gravity_constant_m3_s2,
+                                     reference_initial_true_anomaly_rad_, elapsed_sec);
+      break;
     }
     default: {
       // NOT REACHED
@@ -94,6 +103,45 @@ void RelativeOrbit::CalculateStm(StmModel stm_model_type, const Orbit* reference
   }
 }
 
+void RelativeOrbit::CalculateReferenceOrbitElements(const Orbit* reference_sat_orbit, double gravity_constant_m3_s2) {
+  const libra::Vector<3> position_i_m = reference_sat_orbit->GetPosition_i_m();
+  const libra::Vector<3> velocity_i_m_s = reference_sat_orbit->GetVelocity_i_m_s();
+  const libra::Vector<3> angular_momentum_m2_s = OuterProduct(position_i_m, velocity_i_m_s);
+  const libra::Vector<3> eccentricity_vector =
+      (1.0 / gravity_constant_m3_s2) * OuterProduct(velocity_i_m_s, angular_momentum_m2_s) - position_i_m.CalcNormalizedVector();
+
+  reference_orbit_radius_m_ = position_i_m.CalcNorm();
+  reference_semi_latus_rectum_m_ = InnerProduct(angular_momentum_m2_s, angular_momentum_m2_s) / gravity_constant_m3_s2;
+  reference_eccentricity_ = eccentricity_vector.CalcNorm();
+  // The true anomaly of the circular orbit is measured from the initial position
+  reference_initial_true_anomaly_rad_ = 0.0;
+  if (reference_eccentricity_ > 1.0e-12) {
+    const double sin_theta = InnerProduct(angular_momentum_m2_s.CalcNormalizedVector(), OuterProduct(eccentricity_vector, position_i_m));
+    reference_initial_true_anomaly_rad_ = atan2(sin_theta, InnerProduct(eccentricity_vector, position_i_m));
+  }
+}
+
+const libra::Matrix<6, 6>& RelativeOrbit::GetStepStm(double step_start_sec, double step_width_sec) {
+  if (stm_model_type_ == StmModel::kYamanakaAnkersen) {
+    // The STM depends on the true anomaly at the start of the step
+    const double true_anomaly_rad = PropagateTrueAnomaly_rad(reference_semi_latus_rectum_m_, reference_eccentricity_, gravity_constant_m3_s2_,
+                                                             reference_initial_true_anomaly_rad_, step_start_sec);
+    stm_ = CalcYamanakaAnkersenStm(reference_semi_latus_rectum_m_, reference_eccentricity_, gravity_constant_m3_s2_, true_anomaly_rad,
+                                   step_width_sec);
+    return stm_;
+  }
+
+  // The HCW STM depends only on the step width
+  for (size_t i = 0; i < 2; i++) {
+    if (fabs(step_stm_cache_width_s_[i] - step_width_sec) < 1.0e-9) return step_stm_cache_[i];
+  }
+  // The nominal step is kept in the first cache and the others (e.g., the last step) use the second cache
+  const size_t cache_index = (step_stm_cache_width_s_[0] < 0.0) ? 0 : 1;
+  step_stm_cache_[cache_index] = CalcHcwStm(reference_orbit_radius_m_, gravity_constant_m3_s2_, step_width_sec);
+  step_stm_cache_width_s_[cache_index] = step_width_sec;
+  return step_stm_cache_[cache_index];
+}
+
 void RelativeOrbit::Propagate(const double end_time_s, const double current_time_jd) {
   UNUSED(current_time_jd);
 
@@ -103,6 +151,8 @@ void RelativeOrbit::Propagate(const double end_time_s, const double current_time
 
   if (update_method_ == kRk4) {
     PropagateRk4(end_time_s);
+  } else if (update_method_ == kStepStm) {
+    PropagateStepStm(end_time_s);
   } else  // update_method_ == STM
   {
     PropagateStm(end_time_s);
@@ -152,9 +202,47 @@ void RelativeOrbit::PropagateStm(double elapsed_sec) {
   relative_velocity_lvlh_m_s_[2] = current_state[5];
 }
 
+void RelativeOrbit::PropagateStepStm(double elapsed_sec) {
+  libra::Vector<6> current_state;
+  for (size_t i = 0; i < 3; i++) {
+    current_state[i] = relative_position_lvlh_m_[i];
+    current_state[i + 3] = relative_velocity_lvlh_m_s_[i];
+  }
+
+  while (elapsed_sec - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+    current_state = GetStepStm(propagation_time_s_, propagation_step_s_) * current_state;
+    propagation_time_s_ += propagation_step_s_;
+  }
+  current_state = GetStepStm(propagation_time_s_, elapsed_sec - propagation_time_s_) * current_state;  // Last step
+  propagation_time_s_ = elapsed_sec;
+
+  for (size_t i = 0; i < 3; i++) {
+    relative_position_lvlh_m_[i] = current_state[i];
+    relative_velocity_lvlh_m_s_[i] = current_state[i + 3];
+  }
+}
+
 void RelativeOrbit::DerivativeFunction(double t, const libra::Vector<6>& state,
                                        libra::Vector<6>& rhs)  // only for RK4 relative dynamics propagation
 {
   rhs = system_matrix_ * state;
   (void)t;
 }
+
+void RelativeOrbit::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  libra::OrdinaryDifferentialEquation<6>::SaveSnapshot(snapshot);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(stm_);
+  snapshot.Write(relative_position_lvlh_m_);
+  snapshot.Write(relative_velocity_lvlh_m_s_);
+}
+
+void RelativeOrbit::LoadSnapshot(SnapshotReader& snapshot) {
+  Orbit::LoadSnapshot(snapshot);
+  libra::OrdinaryDifferentialEquation<6>::LoadSnapshot(snapshot);
+  snapshot.Read(propagation_time_s_);
+  snapshot.Read(stm_);
+  snapshot.Read(relative_position_lvlh_m_);
+  snapshot.Read(relative_velocity_lvlh_m_s_);
+}
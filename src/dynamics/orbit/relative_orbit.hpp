@@ -22,8 +22,10 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
   /**
    * @enum RelativeOrbitUpdateMethod
    * @brief Relative orbit update method
+   * @note kStepStm propagates the state with the STM of each step, so the propagation of a step is a 6x6 matrix-vector product. The HCW STM
+   *       is calculated once for each step width with the reference orbit radius at the initialization.
    */
-  typedef enum { kRk4 = 0, kStm = 1 } RelativeOrbitUpdateMethod;
+  typedef enum { kRk4 = 0, kStm = 1, kStepStm = 2 } RelativeOrbitUpdateMethod;
 
   /**
    * @fn RelativeOrbit
@@ -56,6 +58,16 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
    * @param [in] current_time_jd: Current Julian day [day]
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Orbit
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Orbit
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
 
   // Override OrdinaryDifferentialEquation
   /**
@@ -76,6 +88,13 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
   libra::Matrix<6, 6> system_matrix_;  //!< System matrix
   libra::Matrix<6, 6> stm_;            //!< State transition matrix
 
+  double reference_orbit_radius_m_ = 0.0;            //!< Orbit radius of the reference satellite at the initialization [m]
+  double reference_semi_latus_rectum_m_ = 0.0;       //!< Semi-latus rectum of the reference orbit [m]
+  double reference_eccentricity_ = 0.0;              //!< Eccentricity of the reference orbit
+  double reference_initial_true_anomaly_rad_ = 0.0;  //!< True anomaly of the reference orbit at the initialization [rad]
+  libra::Matrix<6, 6> step_stm_cache_[2];            //!< Cached STM of the step for each step width
+  double step_stm_cache_width_s_[2] = {-1.0, -1.0};  //!< Step width of the cached STM [sec] (Negative means no cache)
+
   libra::Vector<6> initial_state_;               //!< Initial state (Position and Velocity)
   libra::Vector<3> relative_position_lvlh_m_;    //!< Relative position in the LVLH frame
   libra::Vector<3> relative_velocity_lvlh_m_s_;  //!< Relative velocity in the LVLH frame
@@ -112,6 +131,20 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
    * @param [in] elapsed_sec: Elapsed time [sec]
    */
   void CalculateStm(StmModel stm_model_type, const Orbit* reference_sat_orbit, double gravity_constant_m3_s2, double elapsed_sec);
+  /**
+   * @fn CalculateReferenceOrbitElements
+   * @brief Calculate the orbit radius, the semi-latus rectum, the eccentricity, and the true anomaly of the reference orbit
+   * @param [in] reference_sat_orbit: Orbit information of reference satellite
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+   */
+  void CalculateReferenceOrbitElements(const Orbit* reference_sat_orbit, double gravity_constant_m3_s2);
+  /**
+   * @fn GetStepStm
+   * @brief Return State Transition Matrix of a step. The HCW STM is reused for the same step width.
+   * @param [in] step_start_sec: Elapsed time at the start of the step [sec]
+   * @param [in] step_width_sec: Step width [sec]
+   */
+  const libra::Matrix<6, 6>& GetStepStm(double step_start_sec, double step_width_sec);
   /**
    * @fn PropagateRk4
    * @brief Propagate relative orbit with RK4
@@ -124,6 +157,12 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
    * @param [in] elapsed_sec: Elapsed time [sec]
    */
   void PropagateStm(double elapsed_sec);
+  /**
+   * @fn PropagateStepStm
+   * @brief Propagate relative orbit with the STM of each step
+   * @param [in] elapsed_sec: Elapsed time [sec]
+   */
+  void PropagateStepStm(double elapsed_sec);
 };
 
 #endif  // S2E_DYNAMICS_ORBIT_RELATIVE_ORBIT_HPP_
@@ -28,14 +28,22 @@ void Rk4OrbitPropagation::DerivativeFunction(double t, const libra::Vector<6>& s
 
   double r3 = pow(x * x + y * y + z * z, 1.5);
 
+  libra::Vector<3> acceleration_i_m_s2 = spacecraft_acceleration_i_m_s2_;
+  if (force_model_ != nullptr) {
+    libra::Vector<3> position_i_m, velocity_i_m_s;
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = state[i];
+      velocity_i_m_s[i] = state[i + 3];
+    }
+    acceleration_i_m_s2 += force_model_->CalcStageAcceleration_i_m_s2(t - step_start_time_s_, position_i_m, velocity_i_m_s);
+  }
+
   rhs[0] = vx;
   rhs[1] = vy;
   rhs[2] = vz;
-  rhs[3] = spacecraft_acceleration_i_m_s2_[0] - gravity_constant_m3_s2_ / r3 * x;
-  rhs[4] = spacecraft_acceleration_i_m_s2_[1] - gravity_constant_m3_s2_ / r3 * y;
-  rhs[5] = spacecraft_acceleration_i_m_s2_[2] - gravity_constant_m3_s2_ / r3 * z;
-
-  (void)t;
+  rhs[3] = acceleration_i_m_s2[0] - gravity_constant_m3_s2_ / r3 * x;
+  rhs[4] = acceleration_i_m_s2[1] - gravity_constant_m3_s2_ / r3 * y;
+  rhs[5] = acceleration_i_m_s2[2] - gravity_constant_m3_s2_ / r3 * z;
 }
 
 void Rk4OrbitPropagation::Initialize(libra::Vector<3> position_i_m, libra::Vector<3> velocity_i_m_s, double initial_time_s) {
@@ -67,6 +75,7 @@ void Rk4OrbitPropagation::Propagate(const double end_time_s, const double curren
 
   if (!is_calc_enabled_) return;
 
+  step_start_time_s_ = GetIndependentVariable();
   SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
   while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
     Update();  // Propagation methods of the OrdinaryDifferentialEquation class
@@ -86,3 +95,15 @@ void Rk4OrbitPropagation::Propagate(const double end_time_s, const double curren
   TransformEciToEcef();
   TransformEcefToGeodetic();
 }
+
+void Rk4OrbitPropagation::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  libra::OrdinaryDifferentialEquation<6>::SaveSnapshot(snapshot);
+  snapshot.Write(propagation_time_s_);
+}
+
+void Rk4OrbitPropagation::LoadSnapshot(SnapshotReader& snapshot) {
+  Orbit::LoadSnapshot(snapshot);
+  libra::OrdinaryDifferentialEquation<6>::LoadSnapshot(snapshot);
+  snapshot.Read(propagation_time_s_);
+}
@@ -53,11 +53,22 @@ class Rk4OrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEqua
    * @param [in] current_time_jd: Current Julian day [day]
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Orbit
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Orbit
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
 
  private:
   double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
   double propagation_time_s_;      //!< Simulation current time for numerical integration by RK4 [sec]
   double propagation_step_s_;      //!< Step width for RK4 [sec]
+  double step_start_time_s_ = 0;   //!< Time at the start of the Propagate call for the force model [sec]
 
   /**
    * @fn Initialize
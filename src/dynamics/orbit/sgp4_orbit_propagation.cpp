@@ -5,9 +5,11 @@
 
 #include "sgp4_orbit_propagation.hpp"
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <utilities/macros.hpp>
+#include <utilities/shared_data_registry.hpp>
 
 Sgp4OrbitPropagation::Sgp4OrbitPropagation(const CelestialInformation* celestial_information, char* tle1, char* tle2, const int wgs_setting,
                                            const double current_time_jd)
@@ -22,10 +24,21 @@ Sgp4OrbitPropagation::Sgp4OrbitPropagation(const CelestialInformation* celestial
     gravity_constant_setting_ = wgs84;
   }
 
-  char type_run = 'c', type_input = 0;
-  double start_mfe, stop_mfe, delta_min;
-
-  twoline2rv(tle1, tle2, type_run, type_input, gravity_constant_setting_, start_mfe, stop_mfe, delta_min, sgp4_data_);
+  // The parsed and initialized record (including the deep space initialization) is shared between the spacecraft and the simulation
+  // cases with the same TLE. Each instance propagates its own copy since sgp4 updates the record.
+  const std::string key = MakeSharedDataKey(std::string(tle1), std::string(tle2), wgs_setting);
+  const std::shared_ptr<const elsetrec> initialized_sgp4_data = SharedDataRegistry<elsetrec>::Get(key, [&]() {
+    // twoline2rv rewrites the input lines
+    char line1[130] = {}, line2[130] = {};
+    strncpy(line1, tle1, sizeof(line1) - 1);
+    strncpy(line2, tle2, sizeof(line2) - 1);
+    char type_run = 'c', type_input = 0;
+    double start_mfe, stop_mfe, delta_min;
+    std::shared_ptr<elsetrec> sgp4_data = std::make_shared<elsetrec>();
+    twoline2rv(line1, line2, type_run, type_input, gravity_constant_setting_, start_mfe, stop_mfe, delta_min, *sgp4_data);
+    return sgp4_data;
+  });
+  sgp4_data_ = *initialized_sgp4_data;
 
   // Epoch check
   double epoch_difference_jday = (current_time_jd - sgp4_data_.jdsatepoch);
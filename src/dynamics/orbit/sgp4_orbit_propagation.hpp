@@ -16,6 +16,7 @@
 /**
  * @class Sgp4OrbitPropagation
  * @brief Class to propagate spacecraft orbit with SGP4 method with TLE
+ * @details The TLE is parsed and initialized only once in the process for the same TLE and WGS setting with SharedDataRegistry
  */
 class Sgp4OrbitPropagation : public Orbit {
  public:
@@ -0,0 +1,141 @@
+/**
+ * @file stm_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit and the state transition matrix with Runge-Kutta-4 method
+ */
+#include "stm_orbit_propagation.hpp"
+
+#include <cmath>
+#include <utilities/macros.hpp>
+
+StmOrbitPropagation::StmOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2,
+                                         const double time_step_s, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s)
+    : Orbit(celestial_information),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      propagation_time_s_(0.0),
+      propagation_step_s_(time_step_s),
+      dcm_i_to_ecef_(libra::MakeIdentityMatrix<3>()),
+      numerical_integrator_(time_step_s, *this) {
+  propagate_mode_ = OrbitPropagateMode::kStm;
+  spacecraft_acceleration_i_m_s2_ *= 0;
+
+  // state vector [x,y,z,vx,vy,vz,Phi(0,0),Phi(0,1),...,Phi(5,5)]
+  libra::Vector<42> state(0.0);
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = position_i_m[i];
+    state[i + 3] = velocity_i_m_s[i];
+  }
+  for (size_t i = 0; i < 6; i++) {
+    state[6 + 6 * i + i] = 1.0;
+  }
+  numerical_integrator_.SetState(propagation_time_s_, state);
+
+  UpdateOrbitState();
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+StmOrbitPropagation::~StmOrbitPropagation() {}
+
+libra::Vector<42> StmOrbitPropagation::DerivativeFunction(const double time_s, const libra::Vector<42>& state) const {
+  libra::Vector<42> rhs;
+  CalcDerivative(time_s, state, rhs);
+  return rhs;
+}
+
+void StmOrbitPropagation::CalcDerivative(const double time_s, const libra::Vector<42>& state, libra::Vector<42>& rhs) const {
+  UNUSED(time_s);
+
+  const double r2 = state[0] * state[0] + state[1] * state[1] + state[2] * state[2];
+  const double mu_r3 = gravity_constant_m3_s2_ / (r2 * sqrt(r2));
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = spacecraft_acceleration_i_m_s2_[i] - mu_r3 * state[i];
+  }
+
+  // Partial derivative of the acceleration with respect to the position
+  libra::Matrix<3, 3> partial_derivative_i_s2;
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      partial_derivative_i_s2[i][j] = 3.0 * mu_r3 * state[i] * state[j] / r2;
+    }
+    partial_derivative_i_s2[i][i] -= mu_r3;
+  }
+  if (is_gravity_potential_enabled_) {
+    libra::Vector<3> position_i_m;
+    for (size_t i = 0; i < 3; i++) position_i_m[i] = state[i];
+    const libra::Matrix<3, 3> partial_derivative_ecef_s2 = gravity_potential_.CalcPartialDerivative_xcxf_s2(dcm_i_to_ecef_ * position_i_m);
+    partial_derivative_i_s2 += dcm_i_to_ecef_.Transpose() * partial_derivative_ecef_s2 * dcm_i_to_ecef_;
+  }
+
+  // Variational equations: dPhi/dt = [0 I; G 0] Phi
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      rhs[6 + 6 * i + j] = state[6 + 6 * (i + 3) + j];
+      double sum = 0.0;
+      for (size_t k = 0; k < 3; k++) {
+        sum += partial_derivative_i_s2[i][k] * state[6 + 6 * k + j];
+      }
+      rhs[6 + 6 * (i + 3) + j] = sum;
+    }
+  }
+}
+
+void StmOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  // The rotation of the ECEF frame in a propagation is neglected as the disturbance acceleration is constant in the propagation
+  dcm_i_to_ecef_ = celestial_information_->GetEarthRotation().GetDcmJ2000ToEcef();
+
+  numerical_integrator_.SetStepWidth(propagation_step_s_);
+  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+    numerical_integrator_.Integrate();
+    propagation_time_s_ += propagation_step_s_;
+  }
+  numerical_integrator_.SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation step width
+  numerical_integrator_.Integrate();
+  propagation_time_s_ = end_time_s;
+
+  UpdateOrbitState();
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void StmOrbitPropagation::ResetStateTransitionMatrix() {
+  libra::Vector<42> state = numerical_integrator_.GetState();
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      state[6 + 6 * i + j] = (i == j) ? 1.0 : 0.0;
+    }
+  }
+  numerical_integrator_.SetState(propagation_time_s_, state);
+  state_transition_matrix_ = libra::MakeIdentityMatrix<6>();
+}
+
+void StmOrbitPropagation::UpdateOrbitState() {
+  const libra::Vector<42>& state = numerical_integrator_.GetState();
+  for (size_t i = 0; i < 3; i++) {
+    spacecraft_position_i_m_[i] = state[i];
+    spacecraft_velocity_i_m_s_[i] = state[i + 3];
+  }
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      state_transition_matrix_[i][j] = state[6 + 6 * i + j];
+    }
+  }
+}
+
+void StmOrbitPropagation::SaveSnapshot(SnapshotWriter& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(numerical_integrator_.GetState());
+}
+
+void StmOrbitPropagation::LoadSnapshot(SnapshotReader& snapshot) {
+  Orbit::LoadSnapshot(snapshot);
+  snapshot.Read(propagation_time_s_);
+  libra::Vector<42> state;
+  snapshot.Read(state);
+  numerical_integrator_.SetState(propagation_time_s_, state);
+}
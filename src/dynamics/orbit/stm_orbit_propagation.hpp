@@ -0,0 +1,114 @@
+/**
+ * @file stm_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit and the state transition matrix with Runge-Kutta-4 method
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_STM_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_STM_ORBIT_PROPAGATION_HPP_
+
+#include <environment/global/celestial_information.hpp>
+#include <math_physics/gravity/gravity_potential.hpp>
+#include <math_physics/numerical_integration/runge_kutta_4.hpp>
+
+#include "orbit.hpp"
+
+/**
+ * @class StmOrbitPropagation
+ * @brief Class to propagate spacecraft orbit and the state transition matrix with Runge-Kutta-4 method
+ * @details The variational equations dPhi/dt = A(t) Phi are integrated together with the position and velocity as a 42 dimensional state.
+ *          The Jacobian A(t) consists of the analytic two-body partial derivative and the partial derivative of the high-order gravity
+ *          calculated by GravityPotential::CalcPartialDerivative_xcxf_s2 when the gravity potential is set. The other disturbances and the
+ *          thruster acceleration are constant in each propagation, so they do not appear in the Jacobian.
+ */
+class StmOrbitPropagation : public Orbit, public libra::numerical_integration::InterfaceOde<42> {
+ public:
+  /**
+   * @fn StmOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] time_step_s: Step width [sec]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   */
+  StmOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2, const double time_step_s,
+                      const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s);
+  /**
+   * @fn ~StmOrbitPropagation
+   * @brief Destructor
+   */
+  ~StmOrbitPropagation();
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Right Hand Side of ordinary difference equation
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position, velocity, and state transition matrix (row major) as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual libra::Vector<42> DerivativeFunction(const double time_s, const libra::Vector<42>& state) const;
+  /**
+   * @fn CalcDerivative
+   * @brief Right Hand Side of ordinary difference equation written into the stage buffer of the integrator
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position, velocity, and state transition matrix (row major) as state vector
+   * @param [out] rhs: Differentiated value of state vector
+   */
+  virtual void CalcDerivative(const double time_s, const libra::Vector<42>& state, libra::Vector<42>& rhs) const;
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit and the state transition matrix
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Orbit
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Override LoadSnapshot function of Orbit
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
+
+  /**
+   * @fn SetGravityPotential
+   * @brief Set the high-order gravity used for the partial derivative in the variational equations
+   * @note The gravity potential should be the same with the one used for the acceleration (e.g., the Geopotential disturbance)
+   * @param [in] gravity_potential: Gravity potential in the ECEF frame
+   */
+  inline void SetGravityPotential(const GravityPotential& gravity_potential) {
+    gravity_potential_ = gravity_potential;
+    is_gravity_potential_enabled_ = true;
+  }
+  /**
+   * @fn ResetStateTransitionMatrix
+   * @brief Reset the state transition matrix to the identity matrix to set the current time as the reference epoch
+   */
+  void ResetStateTransitionMatrix();
+
+ private:
+  double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
+  double propagation_time_s_;      //!< Simulation current time for numerical integration by RK4 [sec]
+  double propagation_step_s_;      //!< Step width for RK4 [sec]
+
+  mutable GravityPotential gravity_potential_;  //!< High-order gravity in the ECEF frame (The workspace is updated in the derivative function)
+  bool is_gravity_potential_enabled_ = false;   //!< Flag to use the high-order gravity in the variational equations
+  libra::Matrix<3, 3> dcm_i_to_ecef_;           //!< DCM from the inertial frame to the ECEF frame fixed in each propagation
+
+  // The integrator is declared after the members above since its constructor evaluates the derivative function
+  libra::numerical_integration::RungeKutta4<42> numerical_integrator_;  //!< Numerical integrator
+
+  /**
+   * @fn UpdateOrbitState
+   * @brief Copy the integrated state to the position, velocity, and state transition matrix of Orbit
+   */
+  void UpdateOrbitState();
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_STM_ORBIT_PROPAGATION_HPP_
@@ -0,0 +1,118 @@
+/**
+ * @file test_adaptive_step_orbit_propagation.cpp
+ * @brief Test codes for AdaptiveStepOrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+
+#include "adaptive_step_orbit_propagation.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004418e14;
+const double kRadius_m = 6878.0e3;
+const double kOutputInterval_s = 1.0;
+const double kEndTime_s = 6000.0;
+
+/**
+ * @fn PropagateReference
+ * @brief Propagate the orbit with the small step RK4 evaluating the acceleration at each stage
+ * @param [in] calc_acceleration_i_m_s2: Function to return the acceleration from the time and the state
+ * @param [in,out] state: Position and velocity
+ */
+void PropagateReference(const std::function<libra::Vector<3>(const double, const libra::Vector<6>&)>& calc_acceleration_i_m_s2,
+                        libra::Vector<6>& state) {
+  auto derivative = [&](const double time_s, const libra::Vector<6>& x) {
+    const libra::Vector<3> acceleration_i_m_s2 = calc_acceleration_i_m_s2(time_s, x);
+    libra::Vector<6> rhs;
+    const double r3 = pow(x[0] * x[0] + x[1] * x[1] + x[2] * x[2], 1.5);
+    for (size_t i = 0; i < 3; i++) {
+      rhs[i] = x[i + 3];
+      rhs[i + 3] = acceleration_i_m_s2[i] - kGravityConstant_m3_s2 / r3 * x[i];
+    }
+    return rhs;
+  };
+  const size_t number_of_steps = (size_t)(kEndTime_s * 10.0);
+  const double step_s = kEndTime_s / (double)number_of_steps;
+  for (size_t step = 0; step < number_of_steps; step++) {
+    const double time_s = step * step_s;
+    const libra::Vector<6> k1 = derivative(time_s, state);
+    const libra::Vector<6> k2 = derivative(time_s + 0.5 * step_s, state + 0.5 * step_s * k1);
+    const libra::Vector<6> k3 = derivative(time_s + 0.5 * step_s, state + 0.5 * step_s * k2);
+    const libra::Vector<6> k4 = derivative(time_s + step_s, state + step_s * k3);
+    state += step_s / 6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+  }
+}
+
+/**
+ * @fn CompareWithReference
+ * @brief Propagate the orbit with the acceleration sampled at each output time and compare it with the reference
+ * @param [in] calc_acceleration_i_m_s2: Function to return the acceleration from the time and the sampled state
+ * @param [in] position_tolerance_m: Tolerance of the position error at the end time [m]
+ * @return Number of the accepted steps
+ */
+size_t CompareWithReference(const std::function<libra::Vector<3>(const double, const libra::Vector<6>&)>& calc_acceleration_i_m_s2,
+                            const double position_tolerance_m) {
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, nullptr, {});
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = kRadius_m;
+  velocity_i_m_s[1] = sqrt(kGravityConstant_m3_s2 / kRadius_m) * cos(0.5);
+  velocity_i_m_s[2] = sqrt(kGravityConstant_m3_s2 / kRadius_m) * sin(0.5);
+  AdaptiveStepOrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, kOutputInterval_s, position_i_m, velocity_i_m_s, 1.0e-6);
+  orbit.SetIsCalcEnabled(true);
+
+  libra::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = position_i_m[i];
+    state[i + 3] = velocity_i_m_s[i];
+  }
+  libra::Vector<6> reference_state = state;
+  PropagateReference(calc_acceleration_i_m_s2, reference_state);
+
+  for (double time_s = 0.0; time_s < kEndTime_s - 1e-9; time_s += kOutputInterval_s) {
+    for (size_t i = 0; i < 3; i++) {
+      state[i] = orbit.GetPosition_i_m()[i];
+      state[i + 3] = orbit.GetVelocity_i_m_s()[i];
+    }
+    orbit.SetAcceleration_i_m_s2(calc_acceleration_i_m_s2(time_s, state));
+    orbit.Propagate(time_s + kOutputInterval_s, 0.0);
+  }
+
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(reference_state[i], orbit.GetPosition_i_m()[i], position_tolerance_m);
+  }
+  return orbit.GetNumberOfSteps();
+}
+}  // namespace
+
+/**
+ * @brief Test for the steps longer than the output interval with the smooth perturbation
+ */
+TEST(AdaptiveStepOrbitPropagation, SmoothPerturbation) {
+  // Along-track acceleration like the air drag
+  auto calc_acceleration_i_m_s2 = [](const double time_s, const libra::Vector<6>& state) {
+    (void)time_s;
+    libra::Vector<3> velocity_i_m_s;
+    for (size_t i = 0; i < 3; i++) velocity_i_m_s[i] = state[i + 3];
+    return -1.0e-6 * velocity_i_m_s.CalcNormalizedVector();
+  };
+  const size_t number_of_steps = CompareWithReference(calc_acceleration_i_m_s2, 0.1);
+
+  // The integration does not restart at each output time
+  EXPECT_LT(number_of_steps * 2, (size_t)(kEndTime_s / kOutputInterval_s));
+}
+
+/**
+ * @brief Test for the restart at the impulsive change of the acceleration
+ */
+TEST(AdaptiveStepOrbitPropagation, ImpulsivePerturbation) {
+  // Thruster firing in the inertially fixed direction between the output times
+  auto calc_acceleration_i_m_s2 = [](const double time_s, const libra::Vector<6>& state) {
+    (void)state;
+    libra::Vector<3> acceleration_i_m_s2(0.0);
+    if (time_s > 1000.0 - 1e-9 && time_s < 1100.0 - 1e-9) acceleration_i_m_s2[0] = 1.0e-2;
+    return acceleration_i_m_s2;
+  };
+  CompareWithReference(calc_acceleration_i_m_s2, 0.2);
+}
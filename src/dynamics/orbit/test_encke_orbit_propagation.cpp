@@ -0,0 +1,133 @@
+/**
+ * @file test_encke_orbit_propagation.cpp
+ * @brief Test codes for EnckeOrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "encke_orbit_propagation.hpp"
+#include "rk4_orbit_propagation.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004418e14;
+
+/**
+ * @fn CalcMaxPositionError_m
+ * @brief Propagate the orbit with Encke's method in the LAGRANGE mode and RK4 with the small step, and return the maximum position difference
+ * @param [in] position_i_m: Initial position in the inertial frame [m]
+ * @param [in] velocity_i_m_s: Initial velocity in the inertial frame [m/s]
+ * @param [in] acceleration_i_m_s2: Constant perturbation acceleration in the inertial frame [m/s2]
+ * @param [in] propagation_step_s: Propagation step of Encke's method [s]
+ * @param [in] error_tolerance: Error tolerance of the rectification
+ * @param [in] duration_s: Duration of the propagation [s]
+ */
+double CalcMaxPositionError_m(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s,
+                              const libra::Vector<3>& acceleration_i_m_s2, const double propagation_step_s, const double error_tolerance,
+                              const double duration_s) {
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, nullptr, {});
+  EnckeOrbitPropagation encke_orbit(&celestial_information, kGravityConstant_m3_s2, propagation_step_s, 0.0, position_i_m, velocity_i_m_s,
+                                    error_tolerance);
+  encke_orbit.SetReferenceOrbitMethod(EnckeReferenceOrbitMethod::kLagrange);
+  encke_orbit.SetIsCalcEnabled(true);
+  Rk4OrbitPropagation reference_orbit(&celestial_information, kGravityConstant_m3_s2, 0.5, position_i_m, velocity_i_m_s);
+  reference_orbit.SetIsCalcEnabled(true);
+
+  double max_error_m = 0.0;
+  for (double time_s = propagation_step_s; time_s < duration_s + 1.0e-6; time_s += propagation_step_s) {
+    // The acceleration is set before each propagation as the simulation does
+    encke_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    reference_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    encke_orbit.Propagate(time_s, 0.0);
+    reference_orbit.Propagate(time_s, 0.0);
+    max_error_m = std::max(max_error_m, (encke_orbit.GetPosition_i_m() - reference_orbit.GetPosition_i_m()).CalcNorm());
+  }
+  return max_error_m;
+}
+}  // namespace
+
+/**
+ * @brief Test for the reference orbit with the Lagrange coefficients in the circular, elliptic and hyperbolic orbits without perturbation
+ */
+TEST(EnckeOrbitPropagation, LagrangeKeplerOrbit) {
+  const libra::Vector<3> zero_acceleration_i_m_s2(0.0);
+  const double radius_m = 6878.0e3;
+  const double circular_velocity_m_s = sqrt(kGravityConstant_m3_s2 / radius_m);
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = radius_m;
+  velocity_i_m_s[1] = circular_velocity_m_s * cos(0.5);
+  velocity_i_m_s[2] = circular_velocity_m_s * sin(0.5);
+  // The reference orbit is exact, so the large step keeps the accuracy
+  EXPECT_LT(CalcMaxPositionError_m(position_i_m, velocity_i_m_s, zero_acceleration_i_m_s2, 60.0, 1.0e-5, 6000.0), 1.0e-3);
+
+  // Elliptic orbit from the perigee (e = 0.3) with the initial radial velocity
+  position_i_m[1] = 1000.0e3;
+  velocity_i_m_s = 1.14 * velocity_i_m_s;
+  velocity_i_m_s[0] = 100.0;
+  EXPECT_LT(CalcMaxPositionError_m(position_i_m, velocity_i_m_s, zero_acceleration_i_m_s2, 60.0, 1.0e-5, 10000.0), 1.0e-3);
+
+  // Hyperbolic orbit
+  velocity_i_m_s = 1.5 * velocity_i_m_s;
+  EXPECT_LT(CalcMaxPositionError_m(position_i_m, velocity_i_m_s, zero_acceleration_i_m_s2, 60.0, 1.0e-5, 6000.0), 1.0e-3);
+}
+
+/**
+ * @brief Test for the perturbed orbit with and without the rectification against RK4 with the small step
+ */
+TEST(EnckeOrbitPropagation, LagrangePerturbedOrbit) {
+  const double radius_m = 6878.0e3;
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = radius_m;
+  velocity_i_m_s[1] = sqrt(kGravityConstant_m3_s2 / radius_m);
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  acceleration_i_m_s2[0] = 1.0e-4;
+  acceleration_i_m_s2[1] = -2.0e-4;
+
+  // The loose tolerance propagates only the difference orbit
+  EXPECT_LT(CalcMaxPositionError_m(position_i_m, velocity_i_m_s, acceleration_i_m_s2, 10.0, 1.0, 6000.0), 1.0e-2);
+  // The tight tolerance rectifies the reference orbit frequently
+  EXPECT_LT(CalcMaxPositionError_m(position_i_m, velocity_i_m_s, acceleration_i_m_s2, 10.0, 1.0e-7, 6000.0), 1.0e-2);
+}
+
+/**
+ * @brief Test for the snapshot round trip in the LAGRANGE mode
+ */
+TEST(EnckeOrbitPropagation, LagrangeSnapshot) {
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, nullptr, {});
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = 6878.0e3;
+  velocity_i_m_s[1] = sqrt(kGravityConstant_m3_s2 / position_i_m[0]);
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  acceleration_i_m_s2[2] = 1.0e-4;
+
+  EnckeOrbitPropagation original_orbit(&celestial_information, kGravityConstant_m3_s2, 10.0, 0.0, position_i_m, velocity_i_m_s, 1.0e-6);
+  original_orbit.SetReferenceOrbitMethod(EnckeReferenceOrbitMethod::kLagrange);
+  original_orbit.SetIsCalcEnabled(true);
+  for (size_t step = 1; step <= 50; step++) {
+    original_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    original_orbit.Propagate(step * 10.0, 0.0);
+  }
+  std::stringstream stream;
+  SnapshotWriter writer(stream);
+  original_orbit.SaveSnapshot(writer);
+  ASSERT_TRUE(writer.IsGood());
+
+  EnckeOrbitPropagation restored_orbit(&celestial_information, kGravityConstant_m3_s2, 10.0, 0.0, 1.1 * position_i_m, velocity_i_m_s, 1.0e-6);
+  restored_orbit.SetReferenceOrbitMethod(EnckeReferenceOrbitMethod::kLagrange);
+  restored_orbit.SetIsCalcEnabled(true);
+  SnapshotReader reader(stream);
+  restored_orbit.LoadSnapshot(reader);
+
+  for (size_t step = 51; step <= 100; step++) {
+    original_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    restored_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    original_orbit.Propagate(step * 10.0, 0.0);
+    restored_orbit.Propagate(step * 10.0, 0.0);
+  }
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(original_orbit.GetPosition_i_m()[i], restored_orbit.GetPosition_i_m()[i]);
+    EXPECT_DOUBLE_EQ(original_orbit.GetVelocity_i_m_s()[i], restored_orbit.GetVelocity_i_m_s()[i]);
+  }
+}
@@ -0,0 +1,56 @@
+/**
+ * @file test_rk4_orbit_propagation.cpp
+ * @brief Test codes for Rk4OrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "rk4_orbit_propagation.hpp"
+#include "stm_orbit_propagation.hpp"
+
+/**
+ * @brief Test for the snapshot round trip
+ */
+TEST(Rk4OrbitPropagation, Snapshot) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, nullptr, {});
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = 6878.0e3;
+  velocity_i_m_s[1] = sqrt(gravity_constant_m3_s2 / position_i_m[0]) * cos(0.5);
+  velocity_i_m_s[2] = sqrt(gravity_constant_m3_s2 / position_i_m[0]) * sin(0.5);
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  acceleration_i_m_s2[0] = 1.0e-5;
+
+  Rk4OrbitPropagation original_orbit(&celestial_information, gravity_constant_m3_s2, 0.1, position_i_m, velocity_i_m_s);
+  original_orbit.SetIsCalcEnabled(true);
+  original_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+  original_orbit.Propagate(100.0, 0.0);
+  std::stringstream stream;
+  SnapshotWriter writer(stream);
+  original_orbit.SaveSnapshot(writer);
+  ASSERT_TRUE(writer.IsGood());
+
+  // The restored orbit is constructed with the different initial state
+  Rk4OrbitPropagation restored_orbit(&celestial_information, gravity_constant_m3_s2, 0.1, 1.1 * position_i_m, velocity_i_m_s);
+  restored_orbit.SetIsCalcEnabled(true);
+  SnapshotReader reader(stream);
+  restored_orbit.LoadSnapshot(reader);
+
+  original_orbit.Propagate(200.0, 0.0);
+  restored_orbit.Propagate(200.0, 0.0);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(original_orbit.GetPosition_i_m()[i], restored_orbit.GetPosition_i_m()[i]);
+    EXPECT_DOUBLE_EQ(original_orbit.GetVelocity_i_m_s()[i], restored_orbit.GetVelocity_i_m_s()[i]);
+  }
+
+  // The snapshot of the other propagation mode is rejected
+  std::stringstream other_stream;
+  SnapshotWriter other_writer(other_stream);
+  original_orbit.SaveSnapshot(other_writer);
+  StmOrbitPropagation other_orbit(&celestial_information, gravity_constant_m3_s2, 0.1, position_i_m, velocity_i_m_s);
+  SnapshotReader other_reader(other_stream);
+  EXPECT_THROW(other_orbit.LoadSnapshot(other_reader), std::invalid_argument);
+}
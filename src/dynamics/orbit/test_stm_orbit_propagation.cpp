@@ -0,0 +1,141 @@
+/**
+ * @file test_stm_orbit_propagation.cpp
+ * @brief Test codes for StmOrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "stm_orbit_propagation.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004418e14;
+const double kStep_s = 0.1;
+const double kEndTime_s = 3000.0;
+
+/**
+ * @fn MakeJ2Potential
+ * @brief Make the gravity potential with only the normalized J2 term
+ */
+GravityPotential MakeJ2Potential() {
+  const size_t degree = 2;
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+  c[2][0] = -4.84165371736e-4;
+  return GravityPotential(degree, c, s, kGravityConstant_m3_s2);
+}
+
+/**
+ * @fn PropagateStm
+ * @brief Propagate the orbit with the J2 acceleration updated at each step as the Geopotential disturbance does
+ * @param [in] initial_state: Initial position and velocity in the inertial frame
+ * @return State transition matrix at the end time
+ */
+libra::Matrix<6, 6> PropagateStm(const libra::Vector<6>& initial_state) {
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, nullptr, {});
+  libra::Vector<3> position_i_m, velocity_i_m_s;
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i] = initial_state[i];
+    velocity_i_m_s[i] = initial_state[i + 3];
+  }
+  StmOrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, kStep_s, position_i_m, velocity_i_m_s);
+  orbit.SetIsCalcEnabled(true);
+  GravityPotential gravity_potential = MakeJ2Potential();
+  orbit.SetGravityPotential(gravity_potential);
+
+  const size_t number_of_steps = (size_t)(kEndTime_s / kStep_s);
+  for (size_t step = 0; step < number_of_steps; step++) {
+    // The ECEF frame is the inertial frame with the IDLE earth rotation
+    orbit.SetAcceleration_i_m_s2(gravity_potential.CalcAcceleration_xcxf_m_s2(orbit.GetPosition_i_m()));
+    orbit.Propagate((step + 1) * kStep_s, 0.0);
+  }
+  return orbit.GetStateTransitionMatrix();
+}
+
+/**
+ * @fn PropagateReference
+ * @brief Propagate the state with RK4 evaluating the J2 acceleration at each stage
+ * @param [in] state: Initial position and velocity in the inertial frame
+ * @return Position and velocity at the end time
+ */
+libra::Vector<6> PropagateReference(libra::Vector<6> state) {
+  GravityPotential gravity_potential = MakeJ2Potential();
+  auto derivative = [&](const libra::Vector<6>& x) {
+    libra::Vector<3> position_i_m;
+    for (size_t i = 0; i < 3; i++) position_i_m[i] = x[i];
+    const libra::Vector<3> acceleration_i_m_s2 = gravity_potential.CalcAcceleration_xcxf_m_s2(position_i_m);
+    const double r3 = pow(position_i_m.CalcNorm(), 3.0);
+    libra::Vector<6> rhs;
+    for (size_t i = 0; i < 3; i++) {
+      rhs[i] = x[i + 3];
+      rhs[i + 3] = acceleration_i_m_s2[i] - kGravityConstant_m3_s2 / r3 * x[i];
+    }
+    return rhs;
+  };
+  const size_t number_of_steps = (size_t)(kEndTime_s / kStep_s);
+  for (size_t step = 0; step < number_of_steps; step++) {
+    const libra::Vector<6> k1 = derivative(state);
+    const libra::Vector<6> k2 = derivative(state + 0.5 * kStep_s * k1);
+    const libra::Vector<6> k3 = derivative(state + 0.5 * kStep_s * k2);
+    const libra::Vector<6> k4 = derivative(state + kStep_s * k3);
+    state += kStep_s / 6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+  }
+  return state;
+}
+}  // namespace
+
+/**
+ * @brief Test for the state transition matrix against the central finite differences of the propagated state
+ */
+TEST(StmOrbitPropagation, FiniteDifference) {
+  const double radius_m = 6878.0e3;
+  const double inclination_rad = 1.0;
+  libra::Vector<6> initial_state(0.0);
+  initial_state[0] = radius_m;
+  initial_state[4] = sqrt(kGravityConstant_m3_s2 / radius_m) * cos(inclination_rad);
+  initial_state[5] = sqrt(kGravityConstant_m3_s2 / radius_m) * sin(inclination_rad);
+
+  const libra::Matrix<6, 6> state_transition_matrix = PropagateStm(initial_state);
+
+  for (size_t j = 0; j < 6; j++) {
+    const double delta = (j < 3) ? 1.0 : 1.0e-3;
+    libra::Vector<6> plus_state = initial_state, minus_state = initial_state;
+    plus_state[j] += delta;
+    minus_state[j] -= delta;
+    const libra::Vector<6> difference = (0.5 / delta) * (PropagateReference(plus_state) - PropagateReference(minus_state));
+
+    double error_norm = 0.0, column_norm = 0.0;
+    for (size_t i = 0; i < 6; i++) {
+      error_norm += pow(state_transition_matrix[i][j] - difference[i], 2.0);
+      column_norm += pow(state_transition_matrix[i][j], 2.0);
+    }
+    // The difference is limited by the acceleration held constant in each step of the orbit
+    EXPECT_LT(sqrt(error_norm / column_norm), 5.0e-7);
+  }
+}
+
+/**
+ * @brief Test for the reset of the reference epoch
+ */
+TEST(StmOrbitPropagation, Reset) {
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, nullptr, {});
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = 6878.0e3;
+  velocity_i_m_s[1] = sqrt(kGravityConstant_m3_s2 / position_i_m[0]);
+  StmOrbitPropagation orbit(&celestial_information, kGravityConstant_m3_s2, kStep_s, position_i_m, velocity_i_m_s);
+  orbit.SetIsCalcEnabled(true);
+  orbit.Propagate(100.0, 0.0);
+  EXPECT_GT(fabs(orbit.GetStateTransitionMatrix()[0][3]), 1.0);
+
+  const libra::Vector<3> position_before_i_m = orbit.GetPosition_i_m();
+  orbit.ResetStateTransitionMatrix();
+  EXPECT_DOUBLE_EQ(position_before_i_m[0], orbit.GetPosition_i_m()[0]);
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      EXPECT_DOUBLE_EQ((i == j) ? 1.0 : 0.0, orbit.GetStateTransitionMatrix()[i][j]);
+    }
+  }
+  // The matrix is propagated from the new epoch: dr/dv is about the elapsed time
+  orbit.Propagate(101.0, 0.0);
+  EXPECT_NEAR(1.0, orbit.GetStateTransitionMatrix()[0][3], 1.0e-3);
+}
@@ -50,6 +50,26 @@ void Heatload::SetElapsedTime_s(double elapsed_time_s) {
   }
 }
 
+void Heatload::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(elapsed_time_s_);
+  snapshot.Write(elapsed_time_idx_);
+  snapshot.Write(residual_elapsed_time_s_);
+  snapshot.Write(solar_heatload_W_);
+  snapshot.Write(internal_heatload_W_);
+  snapshot.Write(heater_heatload_W_);
+  snapshot.Write(total_heatload_W_);
+}
+
+void Heatload::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(elapsed_time_s_);
+  snapshot.Read(elapsed_time_idx_);
+  snapshot.Read(residual_elapsed_time_s_);
+  snapshot.Read(solar_heatload_W_);
+  snapshot.Read(internal_heatload_W_);
+  snapshot.Read(heater_heatload_W_);
+  snapshot.Read(total_heatload_W_);
+}
+
 void Heatload::AssertHeatloadParams() {
   // size of time_table_s_ and internal_heatload_table_W_ must be larger than 1
   assert(time_table_s_.size() >= 1);
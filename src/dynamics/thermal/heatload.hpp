@@ -8,6 +8,7 @@
 
 #include <logger/logger.hpp>
 #include <string>
+#include <utilities/snapshot.hpp>
 #include <vector>
 
 /**
@@ -85,6 +86,19 @@ class Heatload {
    */
   inline void SetHeaterHeatload_W(double heater_heatload_W) { heater_heatload_W_ = heater_heatload_W; }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the elapsed time and the heatloads to the snapshot
+   * @param[out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the elapsed time and the heatloads from the snapshot
+   * @param[in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
  protected:
   double elapsed_time_s_;                          // Elapsed time [s]
   unsigned int node_id_;                           // Node ID to apply heatload
@@ -59,6 +59,19 @@ class Node {
    * @return double: Solar Radiation [W]
    */
   double CalcSolarRadiation_W(libra::Vector<3> sun_direction_b, double solar_flux_W_m2);
+  /**
+   * @fn CalcEarthRadiation_W
+   * @brief Calculate the absorbed earth albedo and earth infrared radiation [W] on the face with possibility of solar incidence
+   *
+   * @param albedo_irradiance_W_m2: Irradiance of the sunlight reflected by the earth on the face [W/m2]
+   * @param infrared_irradiance_W_m2: Irradiance of the earth infrared radiation on the face [W/m2]
+   * @param infrared_absorptivity: Infrared absorptivity of the face
+   * @return double: Absorbed earth radiation [W]
+   */
+  inline double CalcEarthRadiation_W(const double albedo_irradiance_W_m2, const double infrared_irradiance_W_m2,
+                                     const double infrared_absorptivity) const {
+    return area_m2_ * (alpha_ * albedo_irradiance_W_m2 + infrared_absorptivity * infrared_irradiance_W_m2);
+  }
 
   // Getter
   /**
@@ -109,6 +122,12 @@ class Node {
    * @return NodeType
    */
   inline NodeType GetNodeType(void) const { return node_type_; }
+  /**
+   * @fn GetNormalVector_b
+   * @brief Return normal vector of face with possibility of solar incidence (Body frame)
+   * @return libra::Vector<3>: Normal vector
+   */
+  inline libra::Vector<3> GetNormalVector_b(void) const { return normal_vector_b_; }
 
   // Setter
   /**
@@ -118,6 +137,13 @@ class Node {
    * @param temperature_K
    */
   inline void SetTemperature_K(double temperature_K) { temperature_K_ = temperature_K; }
+  /**
+   * @fn SetSolarRadiation_W
+   * @brief Set the solar radiation calculated outside of the node (e.g., from a view factor table)
+   *
+   * @param solar_radiation_W
+   */
+  inline void SetSolarRadiation_W(double solar_radiation_W) { solar_radiation_W_ = solar_radiation_W; }
 
   // for debug
   /**
@@ -0,0 +1,126 @@
+/**
+ * @file solar_view_factor_table.cpp
+ * @brief Table of the solar absorbing area of each node over the sun direction
+ */
+
+#include "solar_view_factor_table.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <math_physics/math/constants.hpp>
+#include <setting_file_reader/initialize_file_access.hpp>
+
+SolarViewFactorTable::SolarViewFactorTable(const std::vector<double>& azimuth_list_deg, const std::vector<double>& elevation_list_deg,
+                                           const std::vector<std::vector<double>>& absorbing_area_list_m2)
+    : azimuth_list_deg_(azimuth_list_deg), elevation_list_deg_(elevation_list_deg), absorbing_area_list_m2_(absorbing_area_list_m2), node_num_(0) {
+  if (!absorbing_area_list_m2_.empty() && absorbing_area_list_m2_.size() == azimuth_list_deg_.size() * elevation_list_deg_.size()) {
+    node_num_ = absorbing_area_list_m2_[0].size();
+  }
+}
+
+void SolarViewFactorTable::CalcAbsorbingArea_m2(const libra::Vector<3>& sun_direction_b, std::vector<double>& absorbing_area_list_m2) const {
+  double azimuth_deg = atan2(sun_direction_b[1], sun_direction_b[0]) * libra::rad_to_deg;
+  if (azimuth_deg < 0.0) azimuth_deg += 360.0;
+  const double elevation_deg = asin(std::max(-1.0, std::min(1.0, sun_direction_b[2]))) * libra::rad_to_deg;
+
+  size_t azimuth_lower, azimuth_upper, elevation_lower, elevation_upper;
+  const double azimuth_ratio = FindAzimuthInterval(azimuth_deg, azimuth_lower, azimuth_upper);
+  const double elevation_ratio = FindElevationInterval(elevation_deg, elevation_lower, elevation_upper);
+
+  // Bilinear interpolation. The weights are shared by all nodes.
+  const size_t azimuth_num = azimuth_list_deg_.size();
+  const std::vector<double>& area_00 = absorbing_area_list_m2_[elevation_lower * azimuth_num + azimuth_lower];
+  const std::vector<double>& area_01 = absorbing_area_list_m2_[elevation_lower * azimuth_num + azimuth_upper];
+  const std::vector<double>& area_10 = absorbing_area_list_m2_[elevation_upper * azimuth_num + azimuth_lower];
+  const std::vector<double>& area_11 = absorbing_area_list_m2_[elevation_upper * azimuth_num + azimuth_upper];
+  const double weight_00 = (1.0 - elevation_ratio) * (1.0 - azimuth_ratio);
+  const double weight_01 = (1.0 - elevation_ratio) * azimuth_ratio;
+  const double weight_10 = elevation_ratio * (1.0 - azimuth_ratio);
+  const double weight_11 = elevation_ratio * azimuth_ratio;
+
+  absorbing_area_list_m2.resize(node_num_);
+  for (size_t i = 0; i < node_num_; i++) {
+    absorbing_area_list_m2[i] = weight_00 * area_00[i] + weight_01 * area_01[i] + weight_10 * area_10[i] + weight_11 * area_11[i];
+  }
+}
+
+double SolarViewFactorTable::FindAzimuthInterval(const double azimuth_deg, size_t& lower_index, size_t& upper_index) const {
+  const size_t azimuth_num = azimuth_list_deg_.size();
+  if (azimuth_num == 1) {
+    lower_index = upper_index = 0;
+    return 0.0;
+  }
+  const size_t upper = std::upper_bound(azimuth_list_deg_.begin(), azimuth_list_deg_.end(), azimuth_deg) - azimuth_list_deg_.begin();
+  if (upper == 0 || upper == azimuth_num) {
+    // Interval between the last and the first grid points around 360 deg
+    lower_index = azimuth_num - 1;
+    upper_index = 0;
+    const double lower_deg = azimuth_list_deg_[lower_index];
+    const double upper_deg = azimuth_list_deg_[upper_index] + 360.0;
+    const double target_deg = (upper == 0) ? azimuth_deg + 360.0 : azimuth_deg;
+    return (target_deg - lower_deg) / (upper_deg - lower_deg);
+  }
+  lower_index = upper - 1;
+  upper_index = upper;
+  return (azimuth_deg - azimuth_list_deg_[lower_index]) / (azimuth_list_deg_[upper_index] - azimuth_list_deg_[lower_index]);
+}
+
+double SolarViewFactorTable::FindElevationInterval(const double elevation_deg, size_t& lower_index, size_t& upper_index) const {
+  const size_t elevation_num = elevation_list_deg_.size();
+  if (elevation_num == 1 || elevation_deg <= elevation_list_deg_.front()) {
+    lower_index = upper_index = 0;
+    return 0.0;
+  }
+  if (elevation_deg >= elevation_list_deg_.back()) {
+    lower_index = upper_index = elevation_num - 1;
+    return 0.0;
+  }
+  const size_t upper = std::upper_bound(elevation_list_deg_.begin(), elevation_list_deg_.end(), elevation_deg) - elevation_list_deg_.begin();
+  lower_index = upper - 1;
+  upper_index = upper;
+  return (elevation_deg - elevation_list_deg_[lower_index]) / (elevation_list_deg_[upper_index] - elevation_list_deg_[lower_index]);
+}
+
+SolarViewFactorTable InitSolarViewFactorTable(const std::string file_path, const size_t node_num) {
+  IniAccess conf_table(file_path);
+  std::vector<std::vector<double>> rows;
+  conf_table.ReadCsvDoubleWithHeader(rows, node_num + 2, 1, 0);
+
+  std::vector<double> azimuth_list_deg;
+  std::vector<double> elevation_list_deg;
+  for (const auto& row : rows) {
+    if (row.size() != node_num + 2) {
+      std::cout << "[Warning] Solar view factor table: the number of columns must be the number of nodes + 2. The table is not used." << std::endl;
+      return SolarViewFactorTable();
+    }
+    azimuth_list_deg.push_back(row[0]);
+    elevation_list_deg.push_back(row[1]);
+  }
+  std::sort(azimuth_list_deg.begin(), azimuth_list_deg.end());
+  azimuth_list_deg.erase(std::unique(azimuth_list_deg.begin(), azimuth_list_deg.end()), azimuth_list_deg.end());
+  std::sort(elevation_list_deg.begin(), elevation_list_deg.end());
+  elevation_list_deg.erase(std::unique(elevation_list_deg.begin(), elevation_list_deg.end()), elevation_list_deg.end());
+
+  const size_t azimuth_num = azimuth_list_deg.size();
+  if (rows.empty() || rows.size() != azimuth_num * elevation_list_deg.size()) {
+    std::cout << "[Warning] Solar view factor table: all combinations of the azimuth and elevation grid are required. The table is not used."
+              << std::endl;
+    return SolarViewFactorTable();
+  }
+
+  std::vector<std::vector<double>> absorbing_area_list_m2(rows.size());
+  for (const auto& row : rows) {
+    const size_t azimuth_index = std::lower_bound(azimuth_list_deg.begin(), azimuth_list_deg.end(), row[0]) - azimuth_list_deg.begin();
+    const size_t elevation_index = std::lower_bound(elevation_list_deg.begin(), elevation_list_deg.end(), row[1]) - elevation_list_deg.begin();
+    absorbing_area_list_m2[elevation_index * azimuth_num + azimuth_index].assign(row.begin() + 2, row.end());
+  }
+  for (const auto& area : absorbing_area_list_m2) {
+    if (area.empty()) {
+      std::cout << "[Warning] Solar view factor table: duplicated grid point is found. The table is not used." << std::endl;
+      return SolarViewFactorTable();
+    }
+  }
+
+  return SolarViewFactorTable(azimuth_list_deg, elevation_list_deg, absorbing_area_list_m2);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file solar_view_factor_table.hpp
+ * @brief Table of the solar absorbing area of each node over the sun direction
+ */
+
+#ifndef S2E_DYNAMICS_THERMAL_SOLAR_VIEW_FACTOR_TABLE_HPP_
+#define S2E_DYNAMICS_THERMAL_SOLAR_VIEW_FACTOR_TABLE_HPP_
+
+#include <math_physics/math/vector.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class SolarViewFactorTable
+ * @brief Table of the solar absorbing area of each node over the sun direction
+ * @details The absorbing area (absorptivity x projected area including the self shadowing) is tabulated on an azimuth/elevation grid of the
+ *          sun direction in the body frame, and bilinearly interpolated. It is used for the nodes whose geometry cannot be represented by a
+ *          single normal vector. The azimuth is measured from the X axis to the Y axis, and the elevation is measured from the XY plane.
+ */
+class SolarViewFactorTable {
+ public:
+  /**
+   * @fn SolarViewFactorTable
+   * @brief Default constructor. The table is empty.
+   */
+  SolarViewFactorTable() : node_num_(0) {}
+  /**
+   * @fn SolarViewFactorTable
+   * @brief Constructor
+   *
+   * @param [in] azimuth_list_deg: Azimuth grid in ascending order in [0, 360) [deg]
+   * @param [in] elevation_list_deg: Elevation grid in ascending order in [-90, 90] [deg]
+   * @param [in] absorbing_area_list_m2: Absorbing area of each node [m2]. The index is (elevation index * azimuth num + azimuth index).
+   */
+  SolarViewFactorTable(const std::vector<double>& azimuth_list_deg, const std::vector<double>& elevation_list_deg,
+                       const std::vector<std::vector<double>>& absorbing_area_list_m2);
+
+  /**
+   * @fn CalcAbsorbingArea_m2
+   * @brief Calculate the absorbing area of all nodes by the interpolation
+   *
+   * @param [in] sun_direction_b: Sun direction in the body frame
+   * @param [out] absorbing_area_list_m2: Absorbing area of each node [m2]
+   */
+  void CalcAbsorbingArea_m2(const libra::Vector<3>& sun_direction_b, std::vector<double>& absorbing_area_list_m2) const;
+
+  // Getters
+  /**
+   * @fn IsEnabled
+   * @return True when the table has values
+   */
+  inline bool IsEnabled() const { return node_num_ > 0; }
+  /**
+   * @fn GetNodeNum
+   * @return Number of nodes
+   */
+  inline size_t GetNodeNum() const { return node_num_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the table [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    size_t bytes = sizeof(*this) + (azimuth_list_deg_.capacity() + elevation_list_deg_.capacity()) * sizeof(double);
+    bytes += absorbing_area_list_m2_.capacity() * sizeof(std::vector<double>);
+    for (const auto& absorbing_areas_m2 : absorbing_area_list_m2_) bytes += absorbing_areas_m2.capacity() * sizeof(double);
+    return bytes;
+  }
+
+ private:
+  std::vector<double> azimuth_list_deg_;                     //!< Azimuth grid [deg]
+  std::vector<double> elevation_list_deg_;                   //!< Elevation grid [deg]
+  std::vector<std::vector<double>> absorbing_area_list_m2_;  //!< Absorbing area of each node at each grid point [m2]
+  size_t node_num_;                                          //!< Number of nodes
+
+  /**
+   * @fn FindAzimuthInterval
+   * @brief Find the grid interval including the azimuth. The interval wraps around 360 deg.
+   *
+   * @param [in] azimuth_deg: Azimuth [deg]
+   * @param [out] lower_index: Index of the lower grid point
+   * @param [out] upper_index: Index of the upper grid point
+   * @return Interpolation ratio between the lower and upper grid points
+   */
+  double FindAzimuthInterval(const double azimuth_deg, size_t& lower_index, size_t& upper_index) const;
+  /**
+   * @fn FindElevationInterval
+   * @brief Find the grid interval including the elevation. The elevation is saturated at the edge of the grid.
+   *
+   * @param [in] elevation_deg: Elevation [deg]
+   * @param [out] lower_index: Index of the lower grid point
+   * @param [out] upper_index: Index of the upper grid point
+   * @return Interpolation ratio between the lower and upper grid points
+   */
+  double FindElevationInterval(const double elevation_deg, size_t& lower_index, size_t& upper_index) const;
+};
+
+/**
+ * @fn InitSolarViewFactorTable
+ * @brief Initialize SolarViewFactorTable from csv file
+ * @note Each row after the header is azimuth[deg], elevation[deg], absorbing area of each node[m2]. All combinations of the azimuth and
+ *       elevation grid are required.
+ *
+ * @param [in] file_path: Path to the csv file
+ * @param [in] node_num: Number of nodes
+ * @return SolarViewFactorTable. The table is empty when the file is invalid.
+ */
+SolarViewFactorTable InitSolarViewFactorTable(const std::string file_path, const size_t node_num);
+
+#endif  // S2E_DYNAMICS_THERMAL_SOLAR_VIEW_FACTOR_TABLE_HPP_
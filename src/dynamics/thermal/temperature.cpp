@@ -5,22 +5,24 @@
 
 #include "temperature.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <environment/global/physical_constants.hpp>
 #include <environment/global/simulation_time.hpp>
+#include <environment/local/earth_albedo.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
-#include <utilities/macros.hpp>
+#include <stdexcept>
+#include <utilities/memory_usage.hpp>
 
 using namespace std;
 
 Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, const vector<vector<double>> radiation_matrix_m2, vector<Node> nodes,
                          vector<Heatload> heatloads, vector<Heater> heaters, vector<HeaterController> heater_controllers, const size_t node_num,
                          const double propagation_step_s, const SolarRadiationPressureEnvironment* srp_environment, const bool is_calc_enabled,
-                         const SolarCalcSetting solar_calc_setting, const bool debug)
-    : conductance_matrix_W_K_(conductance_matrix_W_K),
-      radiation_matrix_m2_(radiation_matrix_m2),
-      nodes_(nodes),
+                         const SolarCalcSetting solar_calc_setting, const bool debug, const ThermalIntegrationMethod integration_method,
+                         const double jacobian_update_threshold_K)
+    : nodes_(nodes),
       heatloads_(heatloads),
       heaters_(heaters),
       heater_controllers_(heater_controllers),
@@ -29,8 +31,12 @@ Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, co
       srp_environment_(srp_environment),
       is_calc_enabled_(is_calc_enabled),
       solar_calc_setting_(solar_calc_setting),
-      debug_(debug) {
+      debug_(debug),
+      integration_method_(integration_method),
+      jacobian_update_threshold_K_(jacobian_update_threshold_K),
+      factorized_step_s_(-1.0) {
   propagation_time_s_ = 0;
+  SetCouplings(conductance_matrix_W_K, radiation_matrix_m2);
   if (debug_) {
     PrintParams();
   }
@@ -43,10 +49,235 @@ Temperature::Temperature() {
   solar_calc_setting_ = SolarCalcSetting::kDisable;
   is_calc_enabled_ = false;
   debug_ = false;
+  integration_method_ = ThermalIntegrationMethod::kRungeKutta4;
+  jacobian_update_threshold_K_ = 1.0;
+  factorized_step_s_ = -1.0;
 }
 
 Temperature::~Temperature() {}
 
+void Temperature::SetCouplings(const vector<vector<double>>& conductance_matrix_W_K, const vector<vector<double>>& radiation_matrix_m2) {
+  conductance_matrix_W_K_.assign(node_num_ * node_num_, 0.0);
+  radiation_matrix_m2_.assign(node_num_ * node_num_, 0.0);
+  for (size_t i = 0; i < node_num_; i++) {
+    for (size_t j = 0; j < node_num_; j++) {
+      conductance_matrix_W_K_[i * node_num_ + j] = conductance_matrix_W_K[i][j];
+      radiation_matrix_m2_[i * node_num_ + j] = radiation_matrix_m2[i][j];
+    }
+  }
+
+  // The diagonal elements do not contribute to the heat input
+  coupling_row_offsets_.assign(node_num_ + 1, 0);
+  coupling_node_indices_.clear();
+  coupling_conductance_W_K_.clear();
+  coupling_radiation_W_K4_.clear();
+  for (size_t i = 0; i < node_num_; i++) {
+    for (size_t j = 0; j < node_num_; j++) {
+      const double conductance_W_K = conductance_matrix_W_K_[i * node_num_ + j];
+      const double radiation_m2 = radiation_matrix_m2_[i * node_num_ + j];
+      if (i == j || (conductance_W_K == 0.0 && radiation_m2 == 0.0)) continue;
+      coupling_node_indices_.push_back(j);
+      coupling_conductance_W_K_.push_back(conductance_W_K);
+      coupling_radiation_W_K4_.push_back(environment::stefan_boltzmann_constant_W_m2K4 * radiation_m2);
+    }
+    coupling_row_offsets_[i + 1] = coupling_node_indices_.size();
+  }
+
+  temperatures_now_K_.assign(node_num_, 0.0);
+  stage_temperatures_K_.assign(node_num_, 0.0);
+  fourth_power_temperatures_.assign(node_num_, 0.0);
+  k1_.assign(node_num_, 0.0);
+  k2_.assign(node_num_, 0.0);
+  k3_.assign(node_num_, 0.0);
+  k4_.assign(node_num_, 0.0);
+  solar_heatloads_W_.assign(node_num_, 0.0);
+
+  implicit_matrix_ = libra::DenseMatrix(node_num_, node_num_, 0.0);
+  implicit_matrix_lu_ = libra::DenseLuDecomposition();
+  linearized_temperatures_K_.assign(node_num_, 0.0);
+  factorized_step_s_ = -1.0;
+
+  capacities_J_K_.resize(node_num_);
+  for (size_t i = 0; i < node_num_; i++) {
+    capacities_J_K_[i] = nodes_[i].GetCapacity_J_K();
+  }
+  is_condensed_node_.assign(node_num_, false);
+  retained_node_indices_.clear();
+  condensed_node_indices_.clear();
+}
+
+bool Temperature::ReduceModel(const vector<size_t>& retained_node_ids) {
+  // Classify the nodes
+  vector<size_t> retained_node_indices, condensed_node_indices;
+  vector<bool> is_condensed(node_num_, false);
+  reduced_positions_.assign(node_num_, 0);
+  for (size_t i = 0; i < node_num_; i++) {
+    const bool is_retained = nodes_[i].GetNodeType() == NodeType::kBoundary || nodes_[i].GetHeaterId() > 0 ||
+                             std::find(retained_node_ids.begin(), retained_node_ids.end(), nodes_[i].GetNodeId()) != retained_node_ids.end();
+    is_condensed[i] = !is_retained;
+    vector<size_t>& indices = is_retained ? retained_node_indices : condensed_node_indices;
+    reduced_positions_[i] = indices.size();
+    indices.push_back(i);
+  }
+  const size_t retained_num = retained_node_indices.size();
+  const size_t condensed_num = condensed_node_indices.size();
+  if (condensed_num == 0) {
+    std::cout << "[Warning] Thermal model reduction: no node is condensed. The full model is used." << std::endl;
+    return false;
+  }
+
+  // Conductance between node i and node j linearized at the current temperatures. The radiation uses the secant of T^4.
+  auto calc_linearized_conductance_W_K = [this](const size_t i, const size_t k) {
+    const double temperature_i_K = nodes_[i].GetTemperature_K();
+    const double temperature_j_K = nodes_[coupling_node_indices_[k]].GetTemperature_K();
+    return coupling_conductance_W_K_[k] + coupling_radiation_W_K4_[k] * (temperature_i_K * temperature_i_K + temperature_j_K * temperature_j_K) *
+                                              (temperature_i_K + temperature_j_K);
+  };
+
+  // Balance of the condensed nodes: L_cc * T_c = G_cr * T_r + Q_c
+  libra::DenseMatrix condensed_matrix(condensed_num, condensed_num, 0.0);
+  libra::DenseMatrix condensed_to_retained_W_K(condensed_num, retained_num, 0.0);
+  double max_diagonal_W_K = 0.0;
+  for (size_t c = 0; c < condensed_num; c++) {
+    const size_t i = condensed_node_indices[c];
+    for (size_t k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+      const size_t j = coupling_node_indices_[k];
+      const double conductance_W_K = calc_linearized_conductance_W_K(i, k);
+      condensed_matrix[c][c] += conductance_W_K;
+      if (is_condensed[j]) {
+        condensed_matrix[c][reduced_positions_[j]] -= conductance_W_K;
+      } else {
+        condensed_to_retained_W_K[c][reduced_positions_[j]] += conductance_W_K;
+      }
+    }
+    max_diagonal_W_K = std::max(max_diagonal_W_K, condensed_matrix[c][c]);
+  }
+  // L_cc is singular when some condensed nodes are isolated from the retained nodes
+  libra::DenseLuDecomposition condensed_matrix_lu;
+  bool is_singular = false;
+  try {
+    condensed_matrix_lu = libra::DenseLuDecomposition(condensed_matrix);
+    for (size_t c = 0; c < condensed_num; c++) {
+      if (fabs(condensed_matrix_lu.GetLuMatrix()[c][c]) <= 1.0e-12 * max_diagonal_W_K) is_singular = true;
+    }
+  } catch (const std::invalid_argument&) {
+    is_singular = true;
+  }
+  if (is_singular) {
+    std::cout << "[Warning] Thermal model reduction: some condensed nodes are not coupled with the retained nodes. The full model is used."
+              << std::endl;
+    return false;
+  }
+
+  // T_c = L_cc^-1 * G_cr * T_r + L_cc^-1 * Q_c
+  condensed_heatload_matrix_.assign(condensed_num * condensed_num, 0.0);
+  condensed_temperature_matrix_.assign(condensed_num * retained_num, 0.0);
+  vector<double> column(condensed_num);
+  for (size_t m = 0; m < condensed_num; m++) {
+    std::fill(column.begin(), column.end(), 0.0);
+    column[m] = 1.0;
+    condensed_matrix_lu.SolveInPlace(column);
+    for (size_t c = 0; c < condensed_num; c++) condensed_heatload_matrix_[c * condensed_num + m] = column[c];
+  }
+  for (size_t r = 0; r < retained_num; r++) {
+    for (size_t c = 0; c < condensed_num; c++) column[c] = condensed_to_retained_W_K[c][r];
+    condensed_matrix_lu.SolveInPlace(column);
+    for (size_t c = 0; c < condensed_num; c++) condensed_temperature_matrix_[c * retained_num + r] = column[c];
+  }
+
+  // Couplings of the retained nodes: the original couplings between the retained nodes and the equivalent conductances through the condensed
+  // nodes G_rc * L_cc^-1 * G_cr. The heatloads of the condensed nodes are delivered with G_rc * L_cc^-1.
+  vector<size_t> row_offsets(node_num_ + 1, 0);
+  vector<size_t> node_indices;
+  vector<double> conductances_W_K, radiations_W_K4;
+  heatload_transfer_matrix_.assign(retained_num * condensed_num, 0.0);
+  for (size_t i = 0; i < node_num_; i++) {
+    if (!is_condensed[i]) {
+      const size_t r = reduced_positions_[i];
+      vector<double> equivalent_conductances_W_K(retained_num, 0.0);
+      vector<double> radiations_to_retained_W_K4(retained_num, 0.0);
+      vector<double> conductances_to_retained_W_K(retained_num, 0.0);
+      for (size_t k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+        const size_t j = coupling_node_indices_[k];
+        if (!is_condensed[j]) {
+          conductances_to_retained_W_K[reduced_positions_[j]] += coupling_conductance_W_K_[k];
+          radiations_to_retained_W_K4[reduced_positions_[j]] += coupling_radiation_W_K4_[k];
+          continue;
+        }
+        const size_t c = reduced_positions_[j];
+        const double conductance_W_K = calc_linearized_conductance_W_K(i, k);
+        for (size_t m = 0; m < condensed_num; m++) {
+          heatload_transfer_matrix_[r * condensed_num + m] += conductance_W_K * condensed_heatload_matrix_[c * condensed_num + m];
+        }
+        for (size_t s = 0; s < retained_num; s++) {
+          equivalent_conductances_W_K[s] += conductance_W_K * condensed_temperature_matrix_[c * retained_num + s];
+        }
+      }
+      for (size_t s = 0; s < retained_num; s++) {
+        const size_t j = retained_node_indices[s];
+        const double conductance_W_K = conductances_to_retained_W_K[s] + equivalent_conductances_W_K[s];
+        if (j == i || (conductance_W_K == 0.0 && radiations_to_retained_W_K4[s] == 0.0)) continue;
+        node_indices.push_back(j);
+        conductances_W_K.push_back(conductance_W_K);
+        radiations_W_K4.push_back(radiations_to_retained_W_K4[s]);
+      }
+    }
+    row_offsets[i + 1] = node_indices.size();
+  }
+  coupling_row_offsets_ = row_offsets;
+  coupling_node_indices_ = node_indices;
+  coupling_conductance_W_K_ = conductances_W_K;
+  coupling_radiation_W_K4_ = radiations_W_K4;
+
+  // Lump the capacities of the condensed nodes with the same distribution as the heatloads
+  for (size_t r = 0; r < retained_num; r++) {
+    const size_t i = retained_node_indices[r];
+    if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+    for (size_t c = 0; c < condensed_num; c++) {
+      capacities_J_K_[i] += heatload_transfer_matrix_[r * condensed_num + c] * nodes_[condensed_node_indices[c]].GetCapacity_J_K();
+    }
+  }
+
+  retained_node_indices_ = retained_node_indices;
+  condensed_node_indices_ = condensed_node_indices;
+  is_condensed_node_ = is_condensed;
+  condensed_heatloads_W_.assign(condensed_num, 0.0);
+  factorized_step_s_ = -1.0;
+  return true;
+}
+
+void Temperature::UpdateCondensedTemperatures(void) {
+  const size_t retained_num = retained_node_indices_.size();
+  const size_t condensed_num = condensed_node_indices_.size();
+  for (size_t c = 0; c < condensed_num; c++) {
+    double temperature_K = 0.0;
+    for (size_t r = 0; r < retained_num; r++) {
+      temperature_K += condensed_temperature_matrix_[c * retained_num + r] * nodes_[retained_node_indices_[r]].GetTemperature_K();
+    }
+    for (size_t m = 0; m < condensed_num; m++) {
+      temperature_K += condensed_heatload_matrix_[c * condensed_num + m] * condensed_heatloads_W_[m];
+    }
+    nodes_[condensed_node_indices_[c]].SetTemperature_K(temperature_K);
+  }
+}
+
+double Temperature::CalcReductionError_K(const Temperature& full_model, const double duration_s, const libra::Vector<3>& sun_position_b_m) const {
+  Temperature full = full_model;
+  Temperature reduced = *this;
+  double max_error_K = 0.0;
+  double elapsed_time_s = 0.0;
+  while (duration_s - elapsed_time_s > 1.0e-6) {
+    elapsed_time_s = std::min(elapsed_time_s + propagation_step_s_, duration_s);
+    full.Propagate(sun_position_b_m, full_model.propagation_time_s_ + elapsed_time_s);
+    reduced.Propagate(sun_position_b_m, propagation_time_s_ + elapsed_time_s);
+    for (const size_t i : retained_node_indices_) {
+      if (nodes_[i].GetNodeType() == NodeType::kBoundary) continue;
+      max_error_K = std::max(max_error_K, fabs(full.nodes_[i].GetTemperature_K() - reduced.nodes_[i].GetTemperature_K()));
+    }
+  }
+  return max_error_K;
+}
+
 void Temperature::Propagate(libra::Vector<3> sun_position_b_m, const double time_end_s) {
   if (!is_calc_enabled_) return;
   double sun_distance_m = sun_position_b_m.CalcNorm();
@@ -54,12 +285,27 @@ void Temperature::Propagate(libra::Vector<3> sun_position_b_m, const double time
   for (size_t i = 0; i < 3; i++) {
     sun_direction_b[i] = sun_position_b_m[i] / sun_distance_m;
   }
-  while (time_end_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    CalcRungeOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
-    propagation_time_s_ += propagation_step_s_;
+  if (solar_calc_setting_ == SolarCalcSetting::kEnable) UpdateSolarHeatloads(sun_direction_b);
+  if (is_heater_event_detection_enabled_) {
+    PropagateWithHeaterEvents(time_end_s);
+  } else if (integration_method_ == ThermalIntegrationMethod::kLinearlyImplicitEuler) {
+    // Divide the interval equally to keep the same step and reuse the factorization
+    const double interval_s = time_end_s - propagation_time_s_;
+    const size_t step_num = (size_t)std::max(1.0, ceil(interval_s / propagation_step_s_ - 1.0e-6));
+    const double time_step_s = interval_s / (double)step_num;
+    for (size_t step = 0; step < step_num; step++) {
+      CalcImplicitOneStep(propagation_time_s_, time_step_s, node_num_);
+      propagation_time_s_ += time_step_s;
+    }
+  } else {
+    while (time_end_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+      CalcRungeOneStep(propagation_time_s_, propagation_step_s_, node_num_);
+      propagation_time_s_ += propagation_step_s_;
+    }
+    CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, node_num_);
   }
-  CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
   propagation_time_s_ = time_end_s;
+  UpdateCondensedTemperatures();
   UpdateHeaterStatus();
 
   if (debug_) {
@@ -84,75 +330,306 @@ void Temperature::Propagate(libra::Vector<3> sun_position_b_m, const double time
   }
 }
 
-void Temperature::CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, size_t node_num) {
-  vector<double> temperatures_now_K(node_num);
+void Temperature::PropagateWithHeaterEvents(const double time_end_s) {
+  double nominal_step_s = propagation_step_s_;
+  if (integration_method_ == ThermalIntegrationMethod::kLinearlyImplicitEuler) {
+    // Divide the interval equally to reuse the factorization between the heater switching
+    const double interval_s = time_end_s - propagation_time_s_;
+    nominal_step_s = interval_s / std::max(1.0, ceil(interval_s / propagation_step_s_ - 1.0e-6));
+  }
+  heater_node_rates_K_s_.resize(node_num_, 0.0);
+
+  while (time_end_s - propagation_time_s_ > 1.0e-6) {
+    const double remaining_time_s = time_end_s - propagation_time_s_;
+    const double time_step_s = CalcHeaterEventStep_s(remaining_time_s < nominal_step_s - 1.0e-6 ? remaining_time_s : nominal_step_s);
+    if (integration_method_ == ThermalIntegrationMethod::kLinearlyImplicitEuler) {
+      CalcImplicitOneStep(propagation_time_s_, time_step_s, node_num_);
+    } else {
+      CalcRungeOneStep(propagation_time_s_, time_step_s, node_num_);
+    }
+    propagation_time_s_ += time_step_s;
+
+    // The temperatures at the beginning of the substep are kept in temperatures_now_K_
+    for (size_t i = 0; i < node_num_; i++) {
+      if (nodes_[i].GetHeaterId() == 0) continue;
+      heater_node_rates_K_s_[i] = (nodes_[i].GetTemperature_K() - temperatures_now_K_[i]) / time_step_s;
+    }
+  }
+}
+
+double Temperature::CalcHeaterEventStep_s(const double time_step_s) {
+  // Lower limit of the substep to avoid the tiny steps when the prediction is slightly short of the crossing
+  const double minimum_step_s = propagation_step_s_ * 1.0e-3;
+  double event_step_s = time_step_s;
+  for (size_t i = 0; i < node_num_; i++) {
+    const size_t heater_id = nodes_[i].GetHeaterId();
+    if (heater_id == 0) continue;
+    Heater& heater = heaters_[heater_id - 1];
+    HeaterController& heater_controller = heater_controllers_[heater_id - 1];
+
+    // The heater is switched off above the upper threshold, and switched on below the lower threshold
+    const double temperature_K = nodes_[i].GetTemperature_K();
+    if ((heater.GetHeaterStatus() == HeaterStatus::kOn && temperature_K > heater_controller.GetUpperThreshold_K()) ||
+        (heater.GetHeaterStatus() != HeaterStatus::kOn && temperature_K < heater_controller.GetLowerThreshold_K())) {
+      const double previous_power_W = heater.GetPowerOutput_W();
+      heater_controller.ControlHeater(&heater, nodes_[i].GetTemperature_degC());
+      // The rate changes by the heater power just after the switching
+      if (capacities_J_K_[i] > 0.0) heater_node_rates_K_s_[i] += (heater.GetPowerOutput_W() - previous_power_W) / capacities_J_K_[i];
+    }
+
+    const bool is_on = heater.GetHeaterStatus() == HeaterStatus::kOn;
+    const double distance_K = (is_on ? heater_controller.GetUpperThreshold_K() : heater_controller.GetLowerThreshold_K()) - temperature_K;
+    const double rate_K_s = heater_node_rates_K_s_[i];
+    if ((is_on && rate_K_s <= 0.0) || (!is_on && rate_K_s >= 0.0)) continue;
+    const double crossing_time_s = distance_K / rate_K_s;
+    if (crossing_time_s >= time_step_s) continue;
+    // Land slightly beyond the threshold since the controller switches the heater only when the temperature exceeds it
+    event_step_s = std::min(event_step_s, std::max(crossing_time_s * (1.0 + 1.0e-3), minimum_step_s));
+  }
+  return event_step_s;
+}
+
+void Temperature::SetSolarViewFactorTable(const SolarViewFactorTable& solar_view_factor_table) {
+  if (solar_view_factor_table.GetNodeNum() != node_num_) {
+    std::cout << "[Warning] Solar view factor table: the number of nodes is different from the thermal network. The table is not used."
+              << std::endl;
+    return;
+  }
+  solar_view_factor_table_ = solar_view_factor_table;
+}
+
+void Temperature::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("TEMPERATURE");
+  snapshot.Write((uint64_t)nodes_.size());
+  snapshot.Write((uint64_t)heaters_.size());
+  snapshot.Write((uint64_t)heater_controllers_.size());
+  snapshot.Write((uint64_t)heatloads_.size());
+  snapshot.Write(propagation_time_s_);
+  for (const auto& node : nodes_) {
+    snapshot.Write(node.GetTemperature_K());
+    snapshot.Write(node.GetSolarRadiation_W());
+  }
+  for (const auto& heater : heaters_) {
+    snapshot.Write(heater.GetHeaterStatus());
+  }
+  for (const auto& heater_controller : heater_controllers_) {
+    snapshot.Write(heater_controller.GetLowerThreshold_degC());
+    snapshot.Write(heater_controller.GetUpperThreshold_degC());
+  }
+  for (const auto& heatload : heatloads_) {
+    heatload.SaveSnapshot(snapshot);
+  }
+  // The linearization point is saved to restore the factorization and reuse it at the same steps as the original simulation
+  snapshot.Write(linearized_temperatures_K_);
+  snapshot.Write(factorized_step_s_);
+}
+
+void Temperature::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("TEMPERATURE");
+  const size_t node_num = snapshot.ReadSize();
+  const size_t heater_num = snapshot.ReadSize();
+  const size_t heater_controller_num = snapshot.ReadSize();
+  const size_t heatload_num = snapshot.ReadSize();
+  if (node_num != nodes_.size() || heater_num != heaters_.size() || heater_controller_num != heater_controllers_.size() ||
+      heatload_num != heatloads_.size()) {
+    throw std::invalid_argument("Snapshot is made with the different thermal network.");
+  }
+  snapshot.Read(propagation_time_s_);
+  for (auto& node : nodes_) {
+    double temperature_K, solar_radiation_W;
+    snapshot.Read(temperature_K);
+    snapshot.Read(solar_radiation_W);
+    node.SetTemperature_K(temperature_K);
+    node.SetSolarRadiation_W(solar_radiation_W);
+  }
+  for (auto& heater : heaters_) {
+    HeaterStatus heater_status;
+    snapshot.Read(heater_status);
+    heater.SetHeaterStatus(heater_status);
+  }
+  for (auto& heater_controller : heater_controllers_) {
+    double lower_threshold_degC, upper_threshold_degC;
+    snapshot.Read(lower_threshold_degC);
+    snapshot.Read(upper_threshold_degC);
+    heater_controller.SetLowerThreshold(lower_threshold_degC);
+    heater_controller.SetUpperThreshold(upper_threshold_degC);
+  }
+  for (auto& heatload : heatloads_) {
+    heatload.LoadSnapshot(snapshot);
+  }
+  snapshot.Read(linearized_temperatures_K_);
+  snapshot.Read(factorized_step_s_);
+  if (factorized_step_s_ > 0.0) FactorizeImplicitMatrix(linearized_temperatures_K_, factorized_step_s_, node_num_);
+  // The heater switching is predicted again from the next substep
+  heater_node_rates_K_s_.assign(heater_node_rates_K_s_.size(), 0.0);
+}
+
+void Temperature::UpdateSolarHeatloads(const libra::Vector<3>& sun_direction_b) {
+  double solar_flux_W_m2 = srp_environment_->GetPowerDensity_W_m2();
+  if (solar_view_factor_table_.IsEnabled()) {
+    solar_view_factor_table_.CalcAbsorbingArea_m2(sun_direction_b, absorbing_area_list_m2_);
+  }
+  for (size_t i = 0; i < node_num_; i++) {
+    if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+    if (solar_view_factor_table_.IsEnabled()) {
+      solar_heatloads_W_[i] = solar_flux_W_m2 * absorbing_area_list_m2_[i];
+      nodes_[i].SetSolarRadiation_W(solar_heatloads_W_[i]);
+    } else {
+      solar_heatloads_W_[i] = nodes_[i].CalcSolarRadiation_W(sun_direction_b, solar_flux_W_m2);
+    }
+  }
+
+  // Earth albedo and infrared radiation on the node faces
+  const EarthAlbedo* earth_albedo = srp_environment_->GetEarthAlbedo();
+  if (earth_albedo == nullptr) return;
+  for (size_t i = 0; i < node_num_; i++) {
+    if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+    const libra::Vector<3> normal_vector_b = nodes_[i].GetNormalVector_b();
+    solar_heatloads_W_[i] += nodes_[i].CalcEarthRadiation_W(earth_albedo->CalcAlbedoIrradiance_W_m2(normal_vector_b),
+                                                            earth_albedo->CalcInfraredIrradiance_W_m2(normal_vector_b), earth_infrared_absorptivity_);
+  }
+}
+
+void Temperature::CalcRungeOneStep(double time_now_s, double time_step_s, size_t node_num) {
   for (size_t i = 0; i < node_num; i++) {
-    temperatures_now_K[i] = nodes_[i].GetTemperature_K();
+    temperatures_now_K_[i] = nodes_[i].GetTemperature_K();
   }
 
-  vector<double> k1(node_num), k2(node_num), k3(node_num), k4(node_num);
-  vector<double> xk2(node_num), xk3(node_num), xk4(node_num);
+  CalcTemperatureDifferentials(temperatures_now_K_, time_now_s, node_num, k1_);
+  for (size_t i = 0; i < node_num; i++) {
+    stage_temperatures_K_[i] = temperatures_now_K_[i] + (time_step_s / 2.0) * k1_[i];
+  }
+
+  CalcTemperatureDifferentials(stage_temperatures_K_, (time_now_s + time_step_s / 2.0), node_num, k2_);
+  for (size_t i = 0; i < node_num; i++) {
+    stage_temperatures_K_[i] = temperatures_now_K_[i] + (time_step_s / 2.0) * k2_[i];
+  }
 
-  k1 = CalcTemperatureDifferentials(temperatures_now_K, time_now_s, sun_direction_b, node_num);
+  CalcTemperatureDifferentials(stage_temperatures_K_, (time_now_s + time_step_s / 2.0), node_num, k3_);
   for (size_t i = 0; i < node_num; i++) {
-    xk2[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k1[i];
+    stage_temperatures_K_[i] = temperatures_now_K_[i] + time_step_s * k3_[i];
   }
 
-  k2 = CalcTemperatureDifferentials(xk2, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
+  CalcTemperatureDifferentials(stage_temperatures_K_, (time_now_s + time_step_s), node_num, k4_);
+
   for (size_t i = 0; i < node_num; i++) {
-    xk3[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k2[i];
+    nodes_[i].SetTemperature_K(temperatures_now_K_[i] + (time_step_s / 6.0) * (k1_[i] + 2.0 * k2_[i] + 2.0 * k3_[i] + k4_[i]));
   }
+}
 
-  k3 = CalcTemperatureDifferentials(xk3, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
+void Temperature::CalcImplicitOneStep(double time_now_s, double time_step_s, size_t node_num) {
   for (size_t i = 0; i < node_num; i++) {
-    xk4[i] = temperatures_now_K[i] + time_step_s * k3[i];
+    temperatures_now_K_[i] = nodes_[i].GetTemperature_K();
   }
 
-  k4 = CalcTemperatureDifferentials(xk4, (time_now_s + time_step_s), sun_direction_b, node_num);
+  bool is_factorization_valid = (factorized_step_s_ == time_step_s);
+  for (size_t i = 0; i < node_num && is_factorization_valid; i++) {
+    if (fabs(temperatures_now_K_[i] - linearized_temperatures_K_[i]) > jacobian_update_threshold_K_) is_factorization_valid = false;
+  }
+  if (!is_factorization_valid) FactorizeImplicitMatrix(temperatures_now_K_, time_step_s, node_num);
 
-  vector<double> temperatures_next_K(node_num);
+  CalcTemperatureDifferentials(temperatures_now_K_, time_now_s, node_num, k1_);
   for (size_t i = 0; i < node_num; i++) {
-    temperatures_next_K[i] = temperatures_now_K[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    k1_[i] *= time_step_s;
   }
+  implicit_matrix_lu_.SolveInPlace(k1_);
 
   for (size_t i = 0; i < node_num; i++) {
-    nodes_[i].SetTemperature_K(temperatures_next_K[i]);
+    nodes_[i].SetTemperature_K(temperatures_now_K_[i] + k1_[i]);
   }
 }
 
-vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperatures_K, double t, libra::Vector<3> sun_direction_b, size_t node_num) {
-  // TODO: consider the following unused arguments are really needed
-  UNUSED(temperatures_K);
+void Temperature::FactorizeImplicitMatrix(const vector<double>& temperatures_K, double time_step_s, size_t node_num) {
+  // Assemble A = I - h * J
+  libra::DenseMatrix& a = implicit_matrix_;
+  a.FillUp(0.0);
+  for (size_t i = 0; i < node_num; i++) {
+    a[i][i] = 1.0;
+    if (nodes_[i].GetNodeType() != NodeType::kDiffusive || is_condensed_node_[i]) continue;
+    const double coefficient = time_step_s / capacities_J_K_[i];
+    const double temperature3_i_K3 = temperatures_K[i] * temperatures_K[i] * temperatures_K[i];
+    for (size_t k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+      const size_t j = coupling_node_indices_[k];
+      const double temperature3_j_K3 = temperatures_K[j] * temperatures_K[j] * temperatures_K[j];
+      a[i][j] -= coefficient * (coupling_conductance_W_K_[k] + 4.0 * coupling_radiation_W_K4_[k] * temperature3_j_K3);
+      a[i][i] += coefficient * (coupling_conductance_W_K_[k] + 4.0 * coupling_radiation_W_K4_[k] * temperature3_i_K3);
+    }
+  }
+  implicit_matrix_lu_ = libra::DenseLuDecomposition(a);
+
+  linearized_temperatures_K_ = temperatures_K;
+  factorized_step_s_ = time_step_s;
+}
 
-  vector<double> differentials_K_s(node_num);
+void Temperature::CalcTemperatureDifferentials(const vector<double>& temperatures_K, double t, size_t node_num, vector<double>& differentials_K_s) {
   for (size_t i = 0; i < node_num; i++) {
-    heatloads_[i].SetElapsedTime_s(t);
-    if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
-      double solar_flux_W_m2 = srp_environment_->GetPowerDensity_W_m2();
-      if (solar_calc_setting_ == SolarCalcSetting::kEnable) {
-        double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction_b, solar_flux_W_m2);
-        heatloads_[i].SetSolarHeatload_W(solar_radiation_W);
+    const double temperature2_K2 = temperatures_K[i] * temperatures_K[i];
+    fourth_power_temperatures_[i] = temperature2_K2 * temperature2_K2;
+  }
+
+  // Each node updates only its own heatload and differential, so the node blocks are independent
+  ForEachNodeBlock(node_num, [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      heatloads_[i].SetElapsedTime_s(t);
+      if (nodes_[i].GetNodeType() == NodeType::kDiffusive || is_condensed_node_[i]) {
+        if (solar_calc_setting_ == SolarCalcSetting::kEnable) {
+          heatloads_[i].SetSolarHeatload_W(solar_heatloads_W_[i]);
+        }
+        double heater_power_W = GetHeaterPower_W(i);
+        heatloads_[i].SetHeaterHeatload_W(heater_power_W);
+        heatloads_[i].CalcInternalHeatload();
+        heatloads_[i].UpdateTotalHeatload();
+        double total_heatload_W = heatloads_[i].GetTotalHeatload_W();  // Total heatload (solar + internal + heater)[W]
+        if (is_condensed_node_[i]) {
+          // The heatload is delivered to the retained nodes, and the temperature is calculated after the propagation
+          condensed_heatloads_W_[reduced_positions_[i]] = total_heatload_W;
+          differentials_K_s[i] = 0;
+          continue;
+        }
+
+        double conductive_heat_input_W = 0;
+        double radiative_heat_input_W = 0;
+        for (size_t k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+          const size_t j = coupling_node_indices_[k];
+          conductive_heat_input_W += coupling_conductance_W_K_[k] * (temperatures_K[j] - temperatures_K[i]);
+          radiative_heat_input_W += coupling_radiation_W_K4_[k] * (fourth_power_temperatures_[j] - fourth_power_temperatures_[i]);
+        }
+        double total_heat_input_W = conductive_heat_input_W + radiative_heat_input_W + total_heatload_W;
+        differentials_K_s[i] = total_heat_input_W / capacities_J_K_[i];
+      } else if (nodes_[i].GetNodeType() == NodeType::kBoundary) {
+        differentials_K_s[i] = 0;
       }
-      double heater_power_W = GetHeaterPower_W(i);
-      heatloads_[i].SetHeaterHeatload_W(heater_power_W);
-      heatloads_[i].CalcInternalHeatload();
-      heatloads_[i].UpdateTotalHeatload();
-      double total_heatload_W = heatloads_[i].GetTotalHeatload_W();  // Total heatload (solar + internal + heater)[W]
-
-      double conductive_heat_input_W = 0;
-      double radiative_heat_input_W = 0;
-      for (size_t j = 0; j < node_num; j++) {
-        conductive_heat_input_W += conductance_matrix_W_K_[i][j] * (nodes_[j].GetTemperature_K() - nodes_[i].GetTemperature_K());
-        radiative_heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2_[i][j] *
-                                  (pow(nodes_[j].GetTemperature_K(), 4) - pow(nodes_[i].GetTemperature_K(), 4));
+    }
+  });
+
+  // Heatloads of the condensed nodes delivered to the retained nodes
+  const size_t condensed_num = condensed_node_indices_.size();
+  if (condensed_num == 0) return;
+  ForEachNodeBlock(retained_node_indices_.size(), [&](const size_t begin, const size_t end) {
+    for (size_t r = begin; r < end; r++) {
+      const size_t i = retained_node_indices_[r];
+      if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+      double delivered_heatload_W = 0.0;
+      for (size_t c = 0; c < condensed_num; c++) {
+        delivered_heatload_W += heatload_transfer_matrix_[r * condensed_num + c] * condensed_heatloads_W_[c];
       }
-      double total_heat_input_W = conductive_heat_input_W + radiative_heat_input_W + total_heatload_W;
-      differentials_K_s[i] = total_heat_input_W / nodes_[i].GetCapacity_J_K();
-    } else if (nodes_[i].GetNodeType() == NodeType::kBoundary) {
-      differentials_K_s[i] = 0;
+      differentials_K_s[i] += delivered_heatload_W / capacities_J_K_[i];
     }
+  });
+}
+
+void Temperature::ForEachNodeBlock(const size_t count, const std::function<void(size_t, size_t)>& function) {
+  if (thread_pool_ == nullptr || parallel_node_threshold_ == 0 || node_num_ < parallel_node_threshold_) {
+    function(0, count);
+    return;
   }
-  return differentials_K_s;
+  const size_t block_num = thread_pool_->GetNumberOfThreads();
+  const size_t block_size = (count + block_num - 1) / block_num;
+  thread_pool_->ParallelFor(block_num, [&](const size_t block) {
+    const size_t begin = std::min(block * block_size, count);
+    const size_t end = std::min(begin + block_size, count);
+    if (begin < end) function(begin, end);
+  });
 }
 
 double Temperature::GetHeaterPower_W(size_t node_id) {
@@ -175,6 +652,26 @@ void Temperature::UpdateHeaterStatus(void) {
   }
 }
 
+size_t Temperature::GetMemoryUsage_bytes() const {
+  size_t bytes = sizeof(*this) - sizeof(solar_view_factor_table_) + solar_view_factor_table_.GetMemoryUsage_bytes();
+  bytes += CalcHeapMemory_bytes(conductance_matrix_W_K_) + CalcHeapMemory_bytes(radiation_matrix_m2_) + CalcHeapMemory_bytes(nodes_) +
+           CalcHeapMemory_bytes(heatloads_) + CalcHeapMemory_bytes(heaters_) + CalcHeapMemory_bytes(heater_controllers_);
+  bytes += CalcHeapMemory_bytes(coupling_row_offsets_) + CalcHeapMemory_bytes(coupling_node_indices_);
+  bytes += CalcHeapMemory_bytes(coupling_conductance_W_K_) + CalcHeapMemory_bytes(coupling_radiation_W_K4_);
+  const vector<double>* buffers[] = {&temperatures_now_K_, &stage_temperatures_K_,   &fourth_power_temperatures_, &k1_, &k2_, &k3_, &k4_,
+                                     &solar_heatloads_W_,  &absorbing_area_list_m2_, &linearized_temperatures_K_};
+  for (const auto buffer : buffers) bytes += CalcHeapMemory_bytes(*buffer);
+  const libra::DenseMatrix* implicit_matrices[] = {&implicit_matrix_, &implicit_matrix_lu_.GetLuMatrix()};
+  for (const auto matrix : implicit_matrices) bytes += matrix->GetRowLength() * matrix->GetColumnLength() * sizeof(double);
+  bytes += CalcHeapMemory_bytes(implicit_matrix_lu_.GetPivotIndices());
+  bytes += CalcHeapMemory_bytes(capacities_J_K_) + CalcHeapMemory_bytes(retained_node_indices_) + CalcHeapMemory_bytes(condensed_node_indices_);
+  bytes += CalcHeapMemory_bytes(reduced_positions_) + is_condensed_node_.capacity() / 8;
+  bytes += CalcHeapMemory_bytes(heatload_transfer_matrix_) + CalcHeapMemory_bytes(condensed_temperature_matrix_);
+  bytes += CalcHeapMemory_bytes(condensed_heatload_matrix_) + CalcHeapMemory_bytes(condensed_heatloads_W_);
+  bytes += CalcHeapMemory_bytes(heater_node_rates_K_s_);
+  return bytes;
+}
+
 string Temperature::GetLogHeader() const {
   string str_tmp = "";
   for (size_t i = 0; i < node_num_; i++) {
@@ -226,14 +723,14 @@ void Temperature::PrintParams(void) {
   cout << "Cij:" << endl;
   for (size_t i = 0; i < (node_num_); i++) {
     for (size_t j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << conductance_matrix_W_K_[i][j] << "  ";
+      cout << std::setprecision(4) << conductance_matrix_W_K_[i * node_num_ + j] << "  ";
     }
     cout << endl;
   }
   cout << "Rij:" << endl;
   for (size_t i = 0; i < (node_num_); i++) {
     for (size_t j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << radiation_matrix_m2_[i][j] << "  ";
+      cout << std::setprecision(4) << radiation_matrix_m2_[i * node_num_ + j] << "  ";
     }
     cout << endl;
   }
@@ -312,6 +809,17 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
   }
 
   bool debug = mainIni.ReadEnable("THERMAL", "debug");
+  bool is_solar_view_factor_table_enabled = mainIni.ReadEnable("THERMAL", "solar_view_factor_table");
+
+  ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRungeKutta4;
+  string integration_method_str = mainIni.ReadString("THERMAL", "integration_method");
+  if (integration_method_str == "IMPLICIT_EULER") {
+    integration_method = ThermalIntegrationMethod::kLinearlyImplicitEuler;
+  } else if (integration_method_str != "RK4" && !integration_method_str.empty()) {
+    std::cout << "[Warning] Thermal integration method: " << integration_method_str << " is not supported. RK4 is used." << std::endl;
+  }
+  double jacobian_update_threshold_K = mainIni.ReadDouble("THERMAL", "jacobian_update_threshold_K");
+  if (jacobian_update_threshold_K <= 0.0) jacobian_update_threshold_K = 1.0;
 
   // Read Heatloads from CSV File
   string filepath_heatload = file_path + "heatload.csv";
@@ -371,6 +879,35 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
 
   Temperature* temperature;
   temperature = new Temperature(conductance_matrix, radiation_matrix, node_list, heatload_list, heater_list, heater_controller_list, node_num,
-                                rk_prop_step_s, srp_environment, is_calc_enabled, solar_calc_setting, debug);
+                                rk_prop_step_s, srp_environment, is_calc_enabled, solar_calc_setting, debug, integration_method,
+                                jacobian_update_threshold_K);
+  if (is_solar_calc_enabled && is_solar_view_factor_table_enabled) {
+    temperature->SetSolarViewFactorTable(InitSolarViewFactorTable(file_path + "solar_view_factor.csv", node_num));
+  }
+  temperature->SetHeaterEventDetection(mainIni.ReadEnable("THERMAL", "heater_event_detection"));
+  temperature->SetEarthInfraredAbsorptivity(mainIni.ReadDouble("THERMAL", "earth_infrared_absorptivity"));
+
+  // Model order reduction
+  if (mainIni.ReadEnable("THERMAL", "model_reduction")) {
+    const int retained_node_num = mainIni.ReadInt("THERMAL", "number_of_retained_nodes");
+    vector<size_t> retained_node_ids;
+    for (const int node_id : mainIni.ReadVectorInt("THERMAL", "retained_node_id", (size_t)std::max(retained_node_num, 0))) {
+      retained_node_ids.push_back((size_t)node_id);
+    }
+    const double check_duration_s = mainIni.ReadDouble("THERMAL", "model_reduction_check_duration_s");
+    const Temperature full_model = check_duration_s > 0.0 ? *temperature : Temperature();
+    if (temperature->ReduceModel(retained_node_ids)) {
+      std::cout << "Thermal model reduction: " << node_num << " nodes are reduced to " << temperature->GetNumberOfPropagatedNodes() << " nodes."
+                << std::endl;
+      if (check_duration_s > 0.0) {
+        // The sun is fixed in the +X direction of the body frame in the comparison
+        libra::Vector<3> sun_position_b_m(0.0);
+        sun_position_b_m[0] = environment::astronomical_unit_m;
+        const double error_K = temperature->CalcReductionError_K(full_model, check_duration_s, sun_position_b_m);
+        std::cout << "Thermal model reduction: maximum temperature error of the retained nodes in " << check_duration_s << " s is " << error_K
+                  << " K." << std::endl;
+      }
+    }
+  }
   return temperature;
 }
@@ -7,14 +7,18 @@
 #define S2E_DYNAMICS_THERMAL_TEMPERATURE_HPP_
 
 #include <environment/local/solar_radiation_pressure_environment.hpp>
+#include <functional>
 #include <logger/loggable.hpp>
+#include <math_physics/math/dense_matrix.hpp>
 #include <string>
+#include <utilities/thread_pool.hpp>
 #include <vector>
 
 #include "heater.hpp"
 #include "heater_controller.hpp"
 #include "heatload.hpp"
 #include "node.hpp"
+#include "solar_view_factor_table.hpp"
 
 /**
  * @enum SolarCalcSetting
@@ -25,48 +29,169 @@ enum class SolarCalcSetting {
   kDisable,
 };
 
+/**
+ * @enum ThermalIntegrationMethod
+ * @brief Numerical integration method of the thermal network
+ */
+enum class ThermalIntegrationMethod {
+  kRungeKutta4,            //!< Explicit 4th order Runge-Kutta
+  kLinearlyImplicitEuler,  //!< Linearly implicit (Rosenbrock) Euler. Stable for the stiff networks with large steps.
+};
+
 /**
  * @class Temperature
  * @brief class to calculate temperature of all nodes
  */
 class Temperature : public ILoggable {
  protected:
-  std::vector<std::vector<double>> conductance_matrix_W_K_;  // Coupling of node i and node j by heat conduction [W/K]
-  std::vector<std::vector<double>> radiation_matrix_m2_;     // Coupling of node i and node j by thermal radiation [m2]
-  std::vector<Node> nodes_;                                  // vector of nodes
-  std::vector<Heatload> heatloads_;                          // vector of heatloads
-  std::vector<Heater> heaters_;                              // vector of heaters
-  std::vector<HeaterController> heater_controllers_;         // vector of heater controllers
-  size_t node_num_;                                          // number of nodes
-  double propagation_step_s_;                                // propagation step [s]
+  std::vector<double> conductance_matrix_W_K_;        // Coupling of node i and node j by heat conduction [W/K] (row-major)
+  std::vector<double> radiation_matrix_m2_;           // Coupling of node i and node j by thermal radiation [m2] (row-major)
+  std::vector<Node> nodes_;                           // vector of nodes
+  std::vector<Heatload> heatloads_;                   // vector of heatloads
+  std::vector<Heater> heaters_;                       // vector of heaters
+  std::vector<HeaterController> heater_controllers_;  // vector of heater controllers
+  size_t node_num_;                                   // number of nodes
+  double propagation_step_s_;                         // propagation step [s]
   double propagation_time_s_;  // Incremented time inside class Temperature [s], finish propagation when reaching end_time
   const SolarRadiationPressureEnvironment* srp_environment_;  // SolarRadiationPressureEnvironment for calculating solar flux
   bool is_calc_enabled_;                                      // Whether temperature calculation is enabled
   SolarCalcSetting solar_calc_setting_;                       // setting for solar calculation
   bool debug_;                                                // Activate debug output or not
 
+  // Non-zero couplings between different nodes in CSR (compressed sparse row) format
+  std::vector<size_t> coupling_row_offsets_;      // Start of the couplings of node i (node_num + 1 elements)
+  std::vector<size_t> coupling_node_indices_;     // Index of the coupled node j
+  std::vector<double> coupling_conductance_W_K_;  // Conductance between node i and node j [W/K]
+  std::vector<double> coupling_radiation_W_K4_;   // Radiation coupling multiplied by Stefan-Boltzmann constant [W/K4]
+
+  // Buffers for RK4 allocated in the constructor
+  std::vector<double> temperatures_now_K_;         // Temperatures at the beginning of the step [K]
+  std::vector<double> stage_temperatures_K_;       // Temperatures at the intermediate stage [K]
+  std::vector<double> fourth_power_temperatures_;  // Fourth power of the temperatures [K4]
+  std::vector<double> k1_, k2_, k3_, k4_;          // Differentials at each stage [K/s]
+
+  // Solar heat input calculated once for each Propagate since the sun direction is constant in it
+  SolarViewFactorTable solar_view_factor_table_;  // Absorbing area table over the sun direction. Node normal vector is used when empty.
+  std::vector<double> solar_heatloads_W_;         // Solar heat input of each node [W]
+  std::vector<double> absorbing_area_list_m2_;    // Absorbing area of each node interpolated from the table [m2]
+  double earth_infrared_absorptivity_ = 0.0;      // Absorptivity of the node faces for the earth infrared radiation
+
+  /**
+   * @fn UpdateSolarHeatloads
+   * @brief Calculate solar heat input of each node for the sun direction
+   * @details The earth albedo and the earth infrared radiation on the node faces are added when the earth albedo is enabled.
+   *
+   * @param[in] sun_direction_b: Sun direction in body frame
+   */
+  void UpdateSolarHeatloads(const libra::Vector<3>& sun_direction_b);
+
+  // Linearly implicit Euler
+  ThermalIntegrationMethod integration_method_;     // Integration method
+  double jacobian_update_threshold_K_;              // Maximum temperature change from the linearization point to reuse the factorization [K]
+  libra::DenseMatrix implicit_matrix_;              // (I - h * J) assembled at the linearization point (node_num x node_num)
+  libra::DenseLuDecomposition implicit_matrix_lu_;  // LU factorization of (I - h * J)
+  std::vector<double> linearized_temperatures_K_;   // Temperatures at the linearization point of the factorization [K]
+  double factorized_step_s_;                        // Time step used for the factorization [s]. Negative when not factorized.
+
+  // Heat capacities used in the propagation. The capacities of the condensed nodes are lumped into the retained nodes in the reduced model.
+  std::vector<double> capacities_J_K_;  // Heat capacity of each node [J/K]
+
+  // Model order reduction by Guyan (static) condensation of the network linearized at the initial temperatures
+  std::vector<size_t> retained_node_indices_;         // Indices of the nodes propagated in the reduced model
+  std::vector<size_t> condensed_node_indices_;        // Indices of the nodes eliminated in the reduced model. Empty for the full model.
+  std::vector<size_t> reduced_positions_;             // Position of each node in the retained or condensed node indices
+  std::vector<bool> is_condensed_node_;               // Whether each node is condensed
+  std::vector<double> heatload_transfer_matrix_;      // Heatload fraction of the condensed node delivered to the retained node (retained x condensed)
+  std::vector<double> condensed_temperature_matrix_;  // Condensed node temperature per retained node temperature (condensed x retained)
+  std::vector<double> condensed_heatload_matrix_;     // Condensed node temperature per condensed node heatload (condensed x condensed) [K/W]
+  std::vector<double> condensed_heatloads_W_;         // Heatload of each condensed node [W]
+
+  // Heater switching event detection
+  bool is_heater_event_detection_enabled_ = false;  // Shorten the substeps to land on the predicted heater switching
+  std::vector<double> heater_node_rates_K_s_;       // Temperature rate of each node with heater in the latest substep [K/s]
+
+  /**
+   * @fn PropagateWithHeaterEvents
+   * @brief Propagate until time_end_s with the substeps shortened at the predicted heater switching
+   * @param[in] time_end_s: Time to finish propagation [s]
+   */
+  void PropagateWithHeaterEvents(const double time_end_s);
+  /**
+   * @fn CalcHeaterEventStep_s
+   * @brief Switch the heaters whose node temperatures are beyond the thresholds, and shorten the substep to the earliest threshold crossing
+   *        predicted from the temperature rate in the latest substep
+   * @note The controllers of the heaters whose node temperatures are within the thresholds are not checked.
+   * @param[in] time_step_s: Nominal substep [s]
+   * @return Substep to land just beyond the earliest predicted crossing [s]
+   */
+  double CalcHeaterEventStep_s(const double time_step_s);
+
+  // Parallel calculation of the node loop
+  ThreadPool* thread_pool_ = nullptr;    // Thread pool to calculate the node blocks. nullptr for the serial calculation.
+  size_t parallel_node_threshold_ = 0;  // Minimum number of nodes to split the node loop into blocks
+
+  /**
+   * @fn ForEachNodeBlock
+   * @brief Call the function for the blocks of [0, count) concurrently when the network is larger than the threshold, or for the whole range
+   * @param[in] count: Number of elements
+   * @param[in] function: Function called with the begin and end of the block
+   */
+  void ForEachNodeBlock(const size_t count, const std::function<void(size_t, size_t)>& function);
+
+  /**
+   * @fn UpdateCondensedTemperatures
+   * @brief Calculate the temperatures of the condensed nodes from the retained nodes and the heatloads at the quasi-static balance
+   */
+  void UpdateCondensedTemperatures(void);
+
+  /**
+   * @fn SetCouplings
+   * @brief Set the conductance and radiation matrices and the sparse couplings, and allocate buffers
+   * @param[in] conductance_matrix_W_K: (node_num x node_num) matrix with heat conductance values [W/K]
+   * @param[in] radiation_matrix_m2: (node_num x node_num) matrix with radiative connection values [m2]
+   */
+  void SetCouplings(const std::vector<std::vector<double>>& conductance_matrix_W_K, const std::vector<std::vector<double>>& radiation_matrix_m2);
+
   /**
    * @fn CalcRungeOneStep
    * @brief Calculate one step of RK4 for thermal equilibrium equation and update temperatures of nodes
    *
    * @param[in] time_now_s: Current elapsed time [s]
    * @param[in] time_step_s: Time step of RK4 [s]
-   * @param[in] sun_direction_b: Sun position in body frame [m]
    * @param[in] node_num: Number of nodes
    */
-  void CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, size_t node_num);
+  void CalcRungeOneStep(double time_now_s, double time_step_s, size_t node_num);
+  /**
+   * @fn CalcImplicitOneStep
+   * @brief Calculate one step of linearly implicit Euler method (I - h * J) * dT = h * f(T) and update temperatures of nodes
+   * @note The factorization of (I - h * J) is reused while the step is the same and the temperatures are close to the linearization point.
+   *
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] time_step_s: Time step [s]
+   * @param[in] node_num: Number of nodes
+   */
+  void CalcImplicitOneStep(double time_now_s, double time_step_s, size_t node_num);
+  /**
+   * @fn FactorizeImplicitMatrix
+   * @brief Assemble (I - h * J) from the sparse couplings at the temperatures and factorize it with libra::DenseLuDecomposition
+   * @note The radiation term is linearized as d(T^4)/dT = 4 * T^3. Heater switching is not considered in the Jacobian.
+   *
+   * @param[in] temperatures_K: Temperatures at the linearization point [K]
+   * @param[in] time_step_s: Time step [s]
+   * @param[in] node_num: Number of nodes
+   */
+  void FactorizeImplicitMatrix(const std::vector<double>& temperatures_K, double time_step_s, size_t node_num);
   /**
    * @fn CalcTemperatureDifferentials
    * @brief Calculate differential of thermal equilibrium equation
    *
-   * @param temperatures_K: [UNUSED] Temperatures of each node [K]
-   * @param time_now_s: Current elapsed time [s]
-   * @param[in] sun_direction_b: Sun direction in body frame
-   * @param node_num: Number of nodes
-   * @return std::vector<double>: Differential of thermal equilibrium equation at time now
+   * @param[in] temperatures_K: Temperatures of each node [K]
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] node_num: Number of nodes
+   * @param[out] differentials_K_s: Differential of thermal equilibrium equation at time now [K/s]
    */
-  std::vector<double> CalcTemperatureDifferentials(std::vector<double> temperatures_K, double time_now_s, const libra::Vector<3> sun_direction_b,
-                                                   size_t node_num);
+  void CalcTemperatureDifferentials(const std::vector<double>& temperatures_K, double time_now_s, size_t node_num,
+                                    std::vector<double>& differentials_K_s);
 
  public:
   /**
@@ -84,11 +209,15 @@ class Temperature : public ILoggable {
    * @param is_calc_enabled: Whether calculation is enabled
    * @param solar_calc_setting: Solar calculation settings
    * @param debug: Whether debug is enabled
+   * @param integration_method: Numerical integration method
+   * @param jacobian_update_threshold_K: Maximum temperature change to reuse the factorization for the implicit method [K]
    */
   Temperature(const std::vector<std::vector<double>> conductance_matrix_W_K, const std::vector<std::vector<double>> radiation_matrix_m2,
               std::vector<Node> nodes, std::vector<Heatload> heatloads, std::vector<Heater> heaters, std::vector<HeaterController> heater_controllers,
               const size_t node_num, const double propagation_step_s, const SolarRadiationPressureEnvironment* srp_environment,
-              const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug);
+              const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug,
+              const ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRungeKutta4,
+              const double jacobian_update_threshold_K = 1.0);
   /**
    * @fn Temperature
    * @brief Construct a new Temperature object, used when thermal calculation is disabled.
@@ -110,7 +239,80 @@ class Temperature : public ILoggable {
    */
   void Propagate(libra::Vector<3> sun_position_b_m, const double time_end_s);
 
+  // Setter
+  /**
+   * @fn SetSolarViewFactorTable
+   * @brief Use the absorbing area table instead of the node normal vector for solar heat input
+   * @param[in] solar_view_factor_table: Table with the same number of nodes
+   */
+  void SetSolarViewFactorTable(const SolarViewFactorTable& solar_view_factor_table);
+  /**
+   * @fn ReduceModel
+   * @brief Eliminate the nodes other than the retained nodes from the propagation by Guyan (static) condensation
+   * @details The network is linearized at the current temperatures, and the capacities of the condensed nodes are neglected in the balance.
+   *          The retained nodes are coupled with the equivalent conductances through the condensed nodes, and the heatloads and the
+   *          capacities of the condensed nodes are distributed to the retained nodes. The couplings between the retained nodes keep the
+   *          original radiation. The temperatures of the condensed nodes are calculated at the end of each propagation.
+   *          The boundary nodes and the nodes with heaters are always retained.
+   * @param[in] retained_node_ids: Node IDs to be retained
+   * @return True when the model is reduced. False when no node is condensed or some condensed nodes are not coupled with the retained nodes.
+   */
+  bool ReduceModel(const std::vector<size_t>& retained_node_ids);
+  /**
+   * @fn SetHeaterEventDetection
+   * @brief Enable the heater switching event detection
+   * @details The substeps are shortened to land just beyond the heater switching predicted from the node temperature rate, and the heaters
+   *          are switched at the substep. The heater power is applied for the correct duration with the large nominal steps.
+   * @param[in] is_enabled: Whether the detection is enabled
+   */
+  inline void SetHeaterEventDetection(const bool is_enabled) { is_heater_event_detection_enabled_ = is_enabled; }
+  /**
+   * @fn SetEarthInfraredAbsorptivity
+   * @brief Set the absorptivity of the node faces for the earth infrared radiation
+   * @param[in] earth_infrared_absorptivity: Infrared absorptivity (equal to the infrared emissivity of the faces)
+   */
+  inline void SetEarthInfraredAbsorptivity(const double earth_infrared_absorptivity) { earth_infrared_absorptivity_ = earth_infrared_absorptivity; }
+  /**
+   * @fn SetThreadPool
+   * @brief Calculate the node loop of the temperature differentials in blocks with the thread pool for the large networks
+   * @note The thread pool must outlive this object. The results are the same as the serial calculation.
+   * @param[in] thread_pool: Thread pool
+   * @param[in] parallel_node_threshold: Minimum number of nodes to split the node loop into blocks
+   */
+  inline void SetThreadPool(ThreadPool* thread_pool, const size_t parallel_node_threshold) {
+    thread_pool_ = thread_pool;
+    parallel_node_threshold_ = parallel_node_threshold;
+  }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the temperatures, the heater status, and the heatloads to the snapshot
+   * @param[out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the temperatures, the heater status, and the heatloads from the snapshot
+   * @note Throws std::invalid_argument when the number of nodes or heaters is different from the snapshot
+   * @param[in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
   // Getter
+  /**
+   * @fn CalcReductionError_K
+   * @brief Propagate copies of the reduced model and the full model with the same conditions and compare the temperatures
+   * @param[in] full_model: Full model before the reduction
+   * @param[in] duration_s: Duration of the comparison [s]
+   * @param[in] sun_position_b_m: Sun position in body frame used in the comparison [m]
+   * @return Maximum temperature difference of the retained nodes other than the boundary nodes [K]
+   */
+  double CalcReductionError_K(const Temperature& full_model, const double duration_s, const libra::Vector<3>& sun_position_b_m) const;
+  /**
+   * @fn GetNumberOfPropagatedNodes
+   * @brief Return number of the nodes propagated in the model (the retained nodes in the reduced model)
+   */
+  inline size_t GetNumberOfPropagatedNodes() const { return node_num_ - condensed_node_indices_.size(); }
   /**
    * @fn GetNodes
    * @brief Return Nodes
@@ -137,6 +339,13 @@ class Temperature : public ILoggable {
    */
   std::string GetLogValue() const;
 
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @brief Return the memory of the thermal network including the coupling matrices, the buffers, and the factorization [bytes]
+   * @return size_t
+   */
+  size_t GetMemoryUsage_bytes() const;
+
   /**
    * @fn UpdateHeaterStatus
    * @brief Update all heater status based on heater controller and temperature
@@ -0,0 +1,176 @@
+/**
+ * @file test_temperature.cpp
+ * @brief Test codes for Temperature class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "temperature.hpp"
+
+namespace {
+const double kBoundaryTemperature_K = 280.0;
+const double kHeatload_W = 5.0;
+const size_t kNodeNum = 5;
+
+/**
+ * @fn MakeThermalModel
+ * @brief Make the conductive network with two large capacity nodes, two small capacity nodes, and a boundary node
+ * @details Node 4 has the internal heatload. The heat flows to the boundary node 3 through nodes 1 and 2.
+ * @param [in] heater_node_id: ID of the node with the heater (kNodeNum for no heater)
+ * @param [in] node4_conductance_W_K: Conductance between node 4 and node 2 [W/K]
+ */
+Temperature MakeThermalModel(const size_t heater_node_id = kNodeNum, const double node4_conductance_W_K = 3.0) {
+  const double capacities_J_K[kNodeNum] = {100.0, 1.0, 200.0, 0.0, 1.0};
+  std::vector<Node> nodes;
+  for (size_t i = 0; i < kNodeNum; i++) {
+    const NodeType node_type = i == 3 ? NodeType::kBoundary : NodeType::kDiffusive;
+    const size_t heater_id = i == heater_node_id ? 1 : 0;
+    nodes.push_back(Node(i, "node" + std::to_string(i), node_type, heater_id, kBoundaryTemperature_K, capacities_J_K[i], 0.0, 0.0,
+                         libra::Vector<3>(0.0)));
+  }
+
+  std::vector<std::vector<double>> conductance_matrix_W_K(kNodeNum, std::vector<double>(kNodeNum, 0.0));
+  auto couple = [&conductance_matrix_W_K](const size_t i, const size_t j, const double conductance_W_K) {
+    conductance_matrix_W_K[i][j] = conductance_W_K;
+    conductance_matrix_W_K[j][i] = conductance_W_K;
+  };
+  couple(0, 1, 1.0);
+  couple(1, 2, 2.0);
+  couple(2, 3, 0.5);
+  couple(4, 2, node4_conductance_W_K);
+  couple(1, 3, 0.3);
+  const std::vector<std::vector<double>> radiation_matrix_m2(kNodeNum, std::vector<double>(kNodeNum, 0.0));
+
+  std::vector<Heatload> heatloads;
+  for (size_t i = 0; i < kNodeNum; i++) {
+    const double internal_heatload_W = i == 4 ? kHeatload_W : 0.0;
+    heatloads.push_back(Heatload((int)i, {0.0, 1.0e6}, {internal_heatload_W, internal_heatload_W}));
+  }
+  // The heater is kept off in the temperature range of the test
+  const std::vector<Heater> heaters = {Heater(1, 10.0)};
+  const std::vector<HeaterController> heater_controllers = {HeaterController(-60.0, -50.0)};
+
+  return Temperature(conductance_matrix_W_K, radiation_matrix_m2, nodes, heatloads, heaters, heater_controllers, kNodeNum, 0.1, nullptr, true,
+                     SolarCalcSetting::kDisable, false);
+}
+
+/**
+ * @fn CalcHeaterLoopMeanTemperature_K
+ * @brief Propagate the heater loop made of a heated node and a boundary node at 0 degC, and return the mean temperature of the heated node
+ * @details The heater of 10 W keeps the node between 10 degC and 12 degC. The temperature is sampled every 100 s for 40000 s.
+ * @param [in] propagation_step_s: Propagation step [s]
+ * @param [in] integration_method: Integration method
+ * @param [in] is_heater_event_detection_enabled: Whether the heater switching event detection is enabled
+ */
+double CalcHeaterLoopMeanTemperature_K(const double propagation_step_s, const ThermalIntegrationMethod integration_method,
+                                       const bool is_heater_event_detection_enabled) {
+  const double boundary_temperature_K = degC2K(0.0);
+  const std::vector<Node> nodes = {Node(0, "heated", NodeType::kDiffusive, 1, degC2K(11.0), 1000.0, 0.0, 0.0, libra::Vector<3>(0.0)),
+                                   Node(1, "boundary", NodeType::kBoundary, 0, boundary_temperature_K, 0.0, 0.0, 0.0, libra::Vector<3>(0.0))};
+  const std::vector<std::vector<double>> conductance_matrix_W_K = {{0.0, 0.1}, {0.1, 0.0}};
+  const std::vector<std::vector<double>> radiation_matrix_m2 = {{0.0, 0.0}, {0.0, 0.0}};
+  const std::vector<Heatload> heatloads = {Heatload(0, {0.0, 1.0e6}, {0.0, 0.0}), Heatload(1, {0.0, 1.0e6}, {0.0, 0.0})};
+  Temperature model(conductance_matrix_W_K, radiation_matrix_m2, nodes, heatloads, {Heater(1, 10.0)}, {HeaterController(10.0, 12.0)}, 2,
+                    propagation_step_s, nullptr, true, SolarCalcSetting::kDisable, false, integration_method);
+  model.SetHeaterEventDetection(is_heater_event_detection_enabled);
+
+  const libra::Vector<3> sun_position_b_m(1.0);
+  const size_t sample_num = 400;
+  double sum_temperature_K = 0.0;
+  // The propagation is called every step since the heater controllers are also evaluated at the end of each call
+  const size_t step_num_per_sample = (size_t)(100.0 / propagation_step_s + 0.5);
+  for (size_t sample = 0; sample < sample_num; sample++) {
+    for (size_t step = 1; step <= step_num_per_sample; step++) {
+      model.Propagate(sun_position_b_m, sample * 100.0 + step * propagation_step_s);
+    }
+    sum_temperature_K += model.GetNodes()[0].GetTemperature_K();
+  }
+  return sum_temperature_K / sample_num;
+}
+}  // namespace
+
+/**
+ * @brief Test for the Guyan condensation against the full model
+ */
+TEST(Temperature, ReduceModel) {
+  Temperature full_model = MakeThermalModel();
+  Temperature reduced_model = full_model;
+  ASSERT_TRUE(reduced_model.ReduceModel({0, 2}));
+  // The boundary node is always retained
+  EXPECT_EQ(3u, reduced_model.GetNumberOfPropagatedNodes());
+  EXPECT_EQ(kNodeNum, full_model.GetNumberOfPropagatedNodes());
+
+  // The capacities of the condensed nodes are small, so the transient of the retained nodes is close to the full model
+  const libra::Vector<3> sun_position_b_m(1.0);
+  const double reduction_error_K = reduced_model.CalcReductionError_K(full_model, 500.0, sun_position_b_m);
+  EXPECT_GT(reduction_error_K, 0.0);
+  EXPECT_LT(reduction_error_K, 0.1);
+
+  // The static condensation is exact at the steady state for the retained nodes and the condensed nodes
+  full_model.Propagate(sun_position_b_m, 20000.0);
+  reduced_model.Propagate(sun_position_b_m, 20000.0);
+  const std::vector<Node> full_nodes = full_model.GetNodes();
+  const std::vector<Node> reduced_nodes = reduced_model.GetNodes();
+  for (size_t i = 0; i < kNodeNum; i++) {
+    EXPECT_NEAR(full_nodes[i].GetTemperature_K(), reduced_nodes[i].GetTemperature_K(), 1e-6) << "node " << i;
+  }
+  EXPECT_DOUBLE_EQ(kBoundaryTemperature_K, reduced_nodes[3].GetTemperature_K());
+  // All the heatload flows to the boundary node
+  const double heat_flow_to_boundary_W = 0.5 * (reduced_nodes[2].GetTemperature_K() - kBoundaryTemperature_K) +
+                                         0.3 * (reduced_nodes[1].GetTemperature_K() - kBoundaryTemperature_K);
+  EXPECT_NEAR(kHeatload_W, heat_flow_to_boundary_W, 1e-6);
+}
+
+/**
+ * @brief Test for the nodes which cannot be condensed
+ */
+TEST(Temperature, ReduceModelRetainedNodes) {
+  // No node is condensed
+  Temperature all_retained_model = MakeThermalModel();
+  EXPECT_FALSE(all_retained_model.ReduceModel({0, 1, 2, 4}));
+  EXPECT_EQ(kNodeNum, all_retained_model.GetNumberOfPropagatedNodes());
+
+  // The node with the heater is always retained
+  Temperature heater_model = MakeThermalModel(4);
+  EXPECT_TRUE(heater_model.ReduceModel({0, 2}));
+  EXPECT_EQ(4u, heater_model.GetNumberOfPropagatedNodes());
+
+  // The isolated node makes the balance of the condensed nodes singular
+  Temperature isolated_model = MakeThermalModel(kNodeNum, 0.0);
+  EXPECT_FALSE(isolated_model.ReduceModel({0, 2}));
+  EXPECT_EQ(kNodeNum, isolated_model.GetNumberOfPropagatedNodes());
+
+  // Nodes 1, 2 and 4 are condensed together
+  Temperature condensed_model = MakeThermalModel();
+  EXPECT_TRUE(condensed_model.ReduceModel({0}));
+  EXPECT_EQ(2u, condensed_model.GetNumberOfPropagatedNodes());
+}
+
+/**
+ * @brief Test for the heater duty cycle with the heater switching event detection against the small step reference
+ */
+TEST(Temperature, HeaterEventDetection) {
+  const double reference_temperature_K = CalcHeaterLoopMeanTemperature_K(0.1, ThermalIntegrationMethod::kRungeKutta4, false);
+  // The heater keeps the mean temperature within the thresholds
+  EXPECT_GT(reference_temperature_K, degC2K(10.0));
+  EXPECT_LT(reference_temperature_K, degC2K(12.0));
+
+  // The heater is switched only at the end of the 100 s step without the detection, and the overshoot shifts the mean temperature
+  const double error_without_detection_K =
+      fabs(CalcHeaterLoopMeanTemperature_K(100.0, ThermalIntegrationMethod::kRungeKutta4, false) - reference_temperature_K);
+  const double error_with_detection_K =
+      fabs(CalcHeaterLoopMeanTemperature_K(100.0, ThermalIntegrationMethod::kRungeKutta4, true) - reference_temperature_K);
+  EXPECT_GT(error_without_detection_K, 0.1);
+  EXPECT_LT(error_with_detection_K, 1.0e-3);
+
+  // The truncation error of the first order method remains with the detection
+  const double implicit_error_without_detection_K =
+      fabs(CalcHeaterLoopMeanTemperature_K(100.0, ThermalIntegrationMethod::kLinearlyImplicitEuler, false) - reference_temperature_K);
+  const double implicit_error_with_detection_K =
+      fabs(CalcHeaterLoopMeanTemperature_K(100.0, ThermalIntegrationMethod::kLinearlyImplicitEuler, true) - reference_temperature_K);
+  EXPECT_GT(implicit_error_without_detection_K, 0.1);
+  EXPECT_LT(implicit_error_with_detection_K, 1.0e-2);
+}
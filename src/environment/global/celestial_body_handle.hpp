@@ -0,0 +1,28 @@
+/**
+ * @file celestial_body_handle.hpp
+ * @brief Handle to access the information of a selected celestial body without the name lookup
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_CELESTIAL_BODY_HANDLE_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_CELESTIAL_BODY_HANDLE_HPP_
+
+/**
+ * @struct CelestialBodyHandle
+ * @brief Handle to access the information of a selected celestial body without the name lookup
+ * @note Get the handle with CelestialInformation::GetBodyHandle once at the initialization, and use it in the simulation loop.
+ */
+struct CelestialBodyHandle {
+  unsigned int index_ = 0;  //!< Index in the selected body list of CelestialInformation
+  bool is_valid_ = false;   //!< False when the body is not included in the selected body list
+
+  /**
+   * @fn operator==
+   * @brief Return true when the handles point the same body. All invalid handles are equal regardless of the index.
+   */
+  inline bool operator==(const CelestialBodyHandle& other) const {
+    if (is_valid_ != other.is_valid_) return false;
+    return !is_valid_ || index_ == other.index_;
+  }
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_CELESTIAL_BODY_HANDLE_HPP_
@@ -6,7 +6,6 @@
 
 #include "celestial_information.hpp"
 
-#include <SpiceUsr.h>
 #include <assert.h>
 #include <string.h>
 
@@ -14,9 +13,12 @@
 #include <iostream>
 #include <locale>
 #include <sstream>
+#include <stdexcept>
+#include <utilities/shared_data_registry.hpp>
 
 #include "logger/log_utility.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
+#include "spice_access.hpp"
 
 CelestialInformation::CelestialInformation(const std::string inertial_frame_name, const std::string aberration_correction_setting,
                                            const std::string center_body_name, const unsigned int number_of_selected_body, int* selected_body_ids,
@@ -37,21 +39,16 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
 
   // Acquisition of gravity constant
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-    SpiceInt dim;
-    SpiceDouble gravity_constant_km3_s2;
-    bodvcd_c(planet_id, "GM", 1, &dim, &gravity_constant_km3_s2);
+    double gravity_constant_km3_s2;
+    SpiceAccess::GetBodyConstants(selected_body_ids_[i], "GM", 1, &gravity_constant_km3_s2);
     // Convert unit [km^3/s^2] to [m^3/s^2]
     celestial_body_gravity_constant_m3_s2_[i] = gravity_constant_km3_s2 * 1E+9;
   }
 
   // Acquisition of radius
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-    SpiceInt dim;
-    SpiceDouble radii_km[3];
-
-    bodvcd_c(planet_id, "RADII", 3, &dim, (SpiceDouble*)radii_km);
+    double radii_km[3];
+    SpiceAccess::GetBodyConstants(selected_body_ids_[i], "RADII", 3, radii_km);
     for (int j = 0; j < 3; j++) {
       celestial_body_planetographic_radii_m_[i * 3 + j] = radii_km[j] * 1000.0;
     }
@@ -63,6 +60,8 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     celestial_body_mean_radius_m_[i] = pow(rx * ry * rz, 1.0 / 3.0);
   }
 
+  center_body_handle_ = GetBodyHandle(center_body_name_.c_str());
+
   // Initialize rotation
   earth_rotation_ = new EarthRotation(ConvertEarthRotationMode(GetRotationMode("EARTH")));
   moon_rotation_ = new MoonRotation(*this, ConvertMoonRotationMode(GetRotationMode("MOON")));
@@ -72,7 +71,10 @@ CelestialInformation::CelestialInformation(const CelestialInformation& obj)
     : number_of_selected_bodies_(obj.number_of_selected_bodies_),
       inertial_frame_name_(obj.inertial_frame_name_),
       center_body_name_(obj.center_body_name_),
-      aberration_correction_setting_(obj.aberration_correction_setting_) {
+      aberration_correction_setting_(obj.aberration_correction_setting_),
+      center_body_handle_(obj.center_body_handle_),
+      ephemeris_cache_(obj.ephemeris_cache_),
+      aberration_correction_update_interval_s_(obj.aberration_correction_update_interval_s_) {
   unsigned int num_of_state = number_of_selected_bodies_ * 3;
 
   selected_body_ids_ = new int[number_of_selected_bodies_];
@@ -104,58 +106,155 @@ CelestialInformation::~CelestialInformation() {
 }
 
 void CelestialInformation::UpdateAllObjectsInformation(const SimulationTime& simulation_time) {
+  UpdateBodyStates(simulation_time);
+  UpdateEarthRotation(simulation_time.GetCurrentTime_jd());
+}
+
+void CelestialInformation::UpdateBodyStates(const SimulationTime& simulation_time) {
+  const double ephemeris_time = simulation_time.GetCurrentEphemerisTime();
+  if (ephemeris_cache_ != nullptr && ephemeris_cache_->IsInRange(ephemeris_time)) {
+    // Update celestial body orbit with the cache
+    for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+      double state[6];
+      ephemeris_cache_->CalcState(i, ephemeris_time, state);
+      for (int j = 0; j < 3; j++) {
+        celestial_body_position_from_center_i_m_[i * 3 + j] = state[j];
+        celestial_body_velocity_from_center_i_m_s_[i * 3 + j] = state[j + 3];
+      }
+    }
+  } else {
+    UpdateAllObjectsOrbitWithSpice(ephemeris_time);
+  }
+
+  // Update moon rotation
+  moon_rotation_->Update(simulation_time);
+}
+
+void CelestialInformation::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("CELESTIAL_INFORMATION");
+  const size_t number_of_states = (size_t)number_of_selected_bodies_ * 3;
+  snapshot.Write(std::vector<double>(celestial_body_position_from_center_i_m_, celestial_body_position_from_center_i_m_ + number_of_states));
+  snapshot.Write(std::vector<double>(celestial_body_velocity_from_center_i_m_s_, celestial_body_velocity_from_center_i_m_s_ + number_of_states));
+  earth_rotation_->SaveSnapshot(snapshot);
+  moon_rotation_->SaveSnapshot(snapshot);
+}
+
+void CelestialInformation::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("CELESTIAL_INFORMATION");
+  const size_t number_of_states = (size_t)number_of_selected_bodies_ * 3;
+  std::vector<double> states;
+  for (double* destination : {celestial_body_position_from_center_i_m_, celestial_body_velocity_from_center_i_m_s_}) {
+    snapshot.Read(states);
+    if (states.size() != number_of_states) throw std::invalid_argument("Snapshot is made with the different selected celestial bodies.");
+    std::copy(states.begin(), states.end(), destination);
+  }
+  earth_rotation_->LoadSnapshot(snapshot);
+  moon_rotation_->LoadSnapshot(snapshot);
+  // The aberration correction is calculated again at the next update
+  aberration_correction_km_.clear();
+}
+
+void CelestialInformation::GetStatesFromCenter_i(const std::vector<CelestialBodyHandle>& bodies, std::vector<double>& positions_i_m,
+                                                 std::vector<double>& velocities_i_m_s) const {
+  positions_i_m.resize(bodies.size() * 3);
+  velocities_i_m_s.resize(bodies.size() * 3);
+  for (size_t body = 0; body < bodies.size(); body++) {
+    const unsigned int index = bodies[body].index_;
+    for (size_t i = 0; i < 3; i++) {
+      positions_i_m[body * 3 + i] = celestial_body_position_from_center_i_m_[index * 3 + i];
+      velocities_i_m_s[body * 3 + i] = celestial_body_velocity_from_center_i_m_s_[index * 3 + i];
+    }
+  }
+}
+
+void CelestialInformation::EnableEphemerisCache(const double start_ephemeris_time_s, const double end_ephemeris_time_s,
+                                                const double segment_length_s, const size_t degree) {
+  // Caches are shared between the instances with the same settings (e.g., Monte-Carlo simulation cases executed in parallel),
+  // and they are released when no instance uses them since they depend on the simulation period.
+  std::ostringstream body_ids;
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) body_ids << selected_body_ids_[i] << " ";
+  const std::string key = MakeSharedDataKey(inertial_frame_name_, aberration_correction_setting_, center_body_name_, body_ids.str(),
+                                            start_ephemeris_time_s, end_ephemeris_time_s, segment_length_s, degree);
+
+  auto load = [&]() -> std::shared_ptr<const EphemerisCache> {
+    // Acquisition of body names from ids
+    std::vector<std::string> body_names;
+    for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+      body_names.push_back(SpiceAccess::ConvertBodyIdToName(selected_body_ids_[i]));
+    }
+
+    auto calc_state = [this, &body_names](const size_t body_index, const double et, double state[6]) {
+      double orbit_buffer_km[6];
+      GetPlanetOrbit(body_names[body_index].c_str(), et, orbit_buffer_km, aberration_correction_setting_);
+      // Convert unit [km], [km/s] to [m], [m/s]
+      for (int j = 0; j < 6; j++) state[j] = orbit_buffer_km[j] * 1000.0;
+    };
+    return std::make_shared<const EphemerisCache>(start_ephemeris_time_s, end_ephemeris_time_s, segment_length_s, degree, number_of_selected_bodies_,
+                                                  calc_state);
+  };
+  ephemeris_cache_ = SharedDataRegistry<EphemerisCache>::Get(key, load, SharedDataRetention::kWhileUsed);
+}
+
+void CelestialInformation::UpdateAllObjectsOrbitWithSpice(const double ephemeris_time) {
+  // The light-time iteration of the aberration correction is skipped until the update interval has passed
+  const bool is_correction_held = aberration_correction_update_interval_s_ > 0.0 && aberration_correction_setting_ != "NONE";
+  const bool is_correction_updated =
+      is_correction_held &&
+      (aberration_correction_km_.empty() || fabs(ephemeris_time - aberration_correction_updated_time_s_) >= aberration_correction_update_interval_s_);
+  if (is_correction_updated) {
+    aberration_correction_km_.assign((size_t)number_of_selected_bodies_ * 6, 0.0);
+    aberration_correction_updated_time_s_ = ephemeris_time;
+  }
+
   // Update celestial body orbit
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-
     // Acquisition of body name from id
-    SpiceBoolean found;
-    const int kMaxNameLength = 100;
-    char name_buffer[kMaxNameLength];
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+    const std::string name = SpiceAccess::ConvertBodyIdToName(selected_body_ids_[i]);
 
     // Acquisition of position and velocity
-    SpiceDouble orbit_buffer_km[6];
-    GetPlanetOrbit(name_buffer, simulation_time.GetCurrentEphemerisTime(), (SpiceDouble*)orbit_buffer_km);
+    double orbit_buffer_km[6];
+    if (!is_correction_held) {
+      GetPlanetOrbit(name.c_str(), ephemeris_time, orbit_buffer_km, aberration_correction_setting_);
+    } else {
+      GetPlanetOrbit(name.c_str(), ephemeris_time, orbit_buffer_km, "NONE");
+      if (is_correction_updated) {
+        double corrected_orbit_km[6];
+        GetPlanetOrbit(name.c_str(), ephemeris_time, corrected_orbit_km, aberration_correction_setting_);
+        for (int j = 0; j < 6; j++) aberration_correction_km_[i * 6 + j] = corrected_orbit_km[j] - orbit_buffer_km[j];
+      }
+      for (int j = 0; j < 6; j++) orbit_buffer_km[j] += aberration_correction_km_[i * 6 + j];
+    }
     // Convert unit [km], [km/s] to [m], [m/s]
     for (int j = 0; j < 3; j++) {
       celestial_body_position_from_center_i_m_[i * 3 + j] = orbit_buffer_km[j] * 1000.0;
       celestial_body_velocity_from_center_i_m_s_[i * 3 + j] = orbit_buffer_km[j + 3] * 1000.0;
     }
   }
-
-  // Update earth rotation
-  earth_rotation_->Update(simulation_time.GetCurrentTime_jd());
-  // Update moon rotation
-  moon_rotation_->Update(simulation_time);
 }
 
-int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
-  int index = 0;
-  SpiceInt planet_id;
-  SpiceBoolean found;
+int CelestialInformation::CalcBodyIdFromName(const char* body_name) const { return GetBodyHandle(body_name).index_; }
+
+CelestialBodyHandle CelestialInformation::GetBodyHandle(const char* body_name) const {
+  CelestialBodyHandle handle;
+  int planet_id;
 
   // Acquisition of ID from body name
-  bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  if (!SpiceAccess::ConvertBodyNameToId(body_name, planet_id)) return handle;
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
     if (selected_body_ids_[i] == planet_id) {
-      index = i;
+      handle.index_ = i;
+      handle.is_valid_ = true;
       break;
     }
   }
-  return index;
+  return handle;
 }
 
 std::string CelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int kMaxNameLength = 100;
-  char name_buffer[kMaxNameLength];
   std::string str_tmp = "";
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
     // Acquisition of body name from id
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-    std::string name = name_buffer;
+    std::string name = SpiceAccess::ConvertBodyIdToName(selected_body_ids_[i]);
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -182,7 +281,7 @@ std::string CelestialInformation::GetLogValue() const {
   return str_tmp;
 }
 
-void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]) {
+void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double et, double orbit[6], const std::string& aberration_correction) {
   // Add `BARYCENTER` if needed
   std::string planet_name_string = planet_name;
   if (strcmp(planet_name, "MARS") == 0 || strcmp(planet_name, "JUPITER") == 0 || strcmp(planet_name, "SATURN") == 0 ||
@@ -191,13 +290,24 @@ void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double
   }
 
   // Get orbit
-  SpiceDouble lt;
-  spkezr_c((ConstSpiceChar*)planet_name_string.c_str(), (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_name_.c_str(),
-           (ConstSpiceChar*)aberration_correction_setting_.c_str(), (ConstSpiceChar*)center_body_name_.c_str(), (SpiceDouble*)orbit,
-           (SpiceDouble*)&lt);
+  SpiceAccess::GetState(planet_name_string, et, inertial_frame_name_, aberration_correction, center_body_name_, orbit);
   return;
 }
 
+std::mutex& CelestialInformation::GetSpiceMutex() { return SpiceAccess::GetMutex(); }
+
+MemoryUsage CelestialInformation::GetMemoryUsage() const {
+  // IDs, position, velocity, gravity constant, mean radius, and radii of each body
+  const size_t bodies_bytes = number_of_selected_bodies_ * (sizeof(int) + 11 * sizeof(double));
+  size_t bytes = sizeof(*this) + bodies_bytes + CalcHeapMemory_bytes(rotation_mode_list_);
+  for (const auto& rotation_mode : rotation_mode_list_) bytes += CalcHeapMemory_bytes(rotation_mode);
+  MemoryUsage memory_usage("CelestialInformation", bytes);
+  memory_usage.AddChild(MemoryUsage("EarthRotation", sizeof(EarthRotation)));
+  memory_usage.AddChild(MemoryUsage("MoonRotation", sizeof(MoonRotation)));
+  if (ephemeris_cache_ != nullptr) memory_usage.AddChild(MemoryUsage("EphemerisCache", 0, ephemeris_cache_->GetMemoryUsage_bytes()));
+  return memory_usage;
+}
+
 CelestialInformation* InitCelestialInformation(std::string file_name) {
   IniAccess ini_file(file_name);
   const char* section = "CELESTIAL_INFORMATION";
@@ -209,10 +319,17 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   std::string center_obj = ini_file.ReadString(section, "center_object");
 
   // SPICE Furnsh
+  // The SPK file is loaded at the first query of the states when it is on demand or replaced with its subset (see InitSpkSubset)
+  std::string spk_subset_file = ini_file.ReadString(furnsh_section, "bsp_subset_file");
+  const bool is_spk_on_demand = ini_file.ReadEnable(furnsh_section, "bsp_on_demand") || (spk_subset_file != "NULL" && !spk_subset_file.empty());
   std::vector<std::string> keywords = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
   for (size_t i = 0; i < keywords.size(); i++) {
     std::string fname = ini_file.ReadString(furnsh_section, keywords[i].c_str());
-    furnsh_c(fname.c_str());
+    if (keywords[i] == "bsp" && is_spk_on_demand) {
+      SpiceAccess::LoadKernelOnDemand(fname);
+    } else {
+      SpiceAccess::LoadKernel(fname);
+    }
   }
 
   // Initialize celestial body list
@@ -223,12 +340,12 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
     std::string selected_body_i = "selected_body_name(" + std::to_string(i) + ")";
     char selected_body_temp[30];
     ini_file.ReadChar(section, selected_body_i.c_str(), 30, selected_body_temp);
-    SpiceInt planet_id;
-    SpiceBoolean found;
-    bodn2c_c(selected_body_temp, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+    int planet_id = 0;
+    const bool found = SpiceAccess::ConvertBodyNameToId(selected_body_temp, planet_id);
 
     // If the object specified in the ini file is not found, exit the program.
-    assert(found == SPICETRUE);
+    assert(found);
+    (void)found;
 
     selected_body[i] = planet_id;
   }
@@ -239,8 +356,66 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   CelestialInformation* celestial_info;
   celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, num_of_selected_body, selected_body, rotation_mode_list);
 
+  // Earth rotation setting
+  celestial_info->GetEarthRotation().SetPrecessionNutationUpdateInterval_s(
+      ini_file.ReadDouble(section, "earth_precession_nutation_update_interval_s"));
+  celestial_info->GetMoonRotation().SetUpdateInterval_s(ini_file.ReadDouble(section, "moon_rotation_update_interval_s"));
+  celestial_info->SetAberrationCorrectionUpdateInterval_s(ini_file.ReadDouble(section, "aberration_correction_update_interval_s"));
+  if (ini_file.ReadEnable(section, "earth_orientation_parameters")) {
+    const std::string eop_file_name = ini_file.ReadString(section, "earth_orientation_parameters_file");
+    celestial_info->GetEarthRotation().SetEarthOrientationParameters(GetSharedEarthOrientationParameters(eop_file_name));
+  }
+
   // log setting
   celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, INI_LOG_LABEL);
 
   return celestial_info;
 }
+
+void InitEphemerisCache(CelestialInformation* celestial_information, const SimulationTime& simulation_time, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "CELESTIAL_INFORMATION";
+
+  if (!ini_file.ReadEnable(section, "ephemeris_cache")) return;
+
+  const double segment_length_s = ini_file.ReadDouble(section, "ephemeris_cache_segment_length_s");
+  const int degree = ini_file.ReadInt(section, "ephemeris_cache_degree");
+  if (segment_length_s <= 0.0 || degree < 1) {
+    std::cout << "[Warning] Ephemeris cache: segment length and degree must be positive. SPICE is used directly." << std::endl;
+    return;
+  }
+
+  const double start_ephemeris_time_s = simulation_time.GetStartEphemerisTime();
+  const double end_ephemeris_time_s = start_ephemeris_time_s + simulation_time.GetEndTime_s();
+  celestial_information->EnableEphemerisCache(start_ephemeris_time_s, end_ephemeris_time_s, segment_length_s, (size_t)degree);
+}
+
+void InitSpkSubset(const CelestialInformation& celestial_information, const SimulationTime& simulation_time, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "CELESTIAL_INFORMATION";
+  const char* furnsh_section = "CSPICE_KERNELS";
+
+  const std::string spk_subset_file = ini_file.ReadString(furnsh_section, "bsp_subset_file");
+  if (spk_subset_file == "NULL" || spk_subset_file.empty()) return;
+  const std::string spk_file = ini_file.ReadString(furnsh_section, "bsp");
+
+  // The selected bodies and the center object
+  std::vector<int> body_ids(celestial_information.GetSelectedBodyIds(),
+                            celestial_information.GetSelectedBodyIds() + celestial_information.GetNumberOfSelectedBodies());
+  int center_body_id;
+  if (SpiceAccess::ConvertBodyNameToId(celestial_information.GetCenterBodyName(), center_body_id)) body_ids.push_back(center_body_id);
+
+  // The margin covers the last segment of the ephemeris cache and the light time correction
+  double margin_s = 24.0 * 60.0 * 60.0;
+  if (ini_file.ReadEnable(section, "ephemeris_cache")) margin_s += std::max(ini_file.ReadDouble(section, "ephemeris_cache_segment_length_s"), 0.0);
+  const double start_ephemeris_time_s = simulation_time.GetStartEphemerisTime() - margin_s;
+  const double end_ephemeris_time_s = simulation_time.GetStartEphemerisTime() + simulation_time.GetEndTime_s() + margin_s;
+
+  if (!SpiceAccess::IsSpkCovering(spk_subset_file, body_ids, start_ephemeris_time_s, end_ephemeris_time_s)) {
+    if (!SpiceAccess::ExtractSpkSubset(spk_file, spk_subset_file, body_ids, start_ephemeris_time_s, end_ephemeris_time_s)) {
+      std::cout << "[Warning] SPK subset file " << spk_subset_file << " cannot be written. " << spk_file << " is used." << std::endl;
+      return;
+    }
+  }
+  SpiceAccess::ReplaceKernelOnDemand(spk_file, spk_subset_file);
+}
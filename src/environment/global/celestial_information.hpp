@@ -7,13 +7,18 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
+#include "celestial_body_handle.hpp"
 #include "earth_rotation.hpp"
+#include "ephemeris_cache.hpp"
 #include "logger/loggable.hpp"
 #include "math_physics/math/vector.hpp"
 #include "moon_rotation.hpp"
 #include "simulation_time.hpp"
+#include "utilities/memory_usage.hpp"
 
 class MoonRotation;
 
@@ -65,6 +70,54 @@ class CelestialInformation : public ILoggable {
    * @param [in] simulation_time: Simulation Time information
    */
   void UpdateAllObjectsInformation(const SimulationTime& simulation_time);
+  /**
+   * @fn UpdateBodyStates
+   * @brief Update the orbits of all selected celestial objects and the moon rotation
+   * @note The function is independent of UpdateEarthRotation, so they can be called concurrently. SPICE is used only in this function.
+   * @param [in] simulation_time: Simulation Time information
+   */
+  void UpdateBodyStates(const SimulationTime& simulation_time);
+  /**
+   * @fn UpdateEarthRotation
+   * @brief Update the earth rotation
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  inline void UpdateEarthRotation(const double current_time_jd) { earth_rotation_->Update(current_time_jd); }
+  /**
+   * @fn EnableEphemerisCache
+   * @brief Fit Chebyshev series to the SPICE ephemeris and use them instead of SPICE in UpdateAllObjectsInformation
+   * @note SPICE is still used when the time is out of the cache range. The cache is shared with other instances which have the same settings.
+   * @param [in] start_ephemeris_time_s: Start of the cache range in Ephemeris Time [sec]
+   * @param [in] end_ephemeris_time_s: End of the cache range in Ephemeris Time [sec]
+   * @param [in] segment_length_s: Length of each Chebyshev segment [sec]
+   * @param [in] degree: Degree of the Chebyshev series
+   */
+  void EnableEphemerisCache(const double start_ephemeris_time_s, const double end_ephemeris_time_s, const double segment_length_s,
+                            const size_t degree);
+  /**
+   * @fn SetAberrationCorrectionUpdateInterval_s
+   * @brief Set the interval of the aberration correction calculation
+   * @details When the aberration correction is not NONE, the corrected states and the geometric states of the bodies are calculated with
+   *          SPICE only when the interval has passed from the latest calculation, and the difference is added to the geometric states in
+   *          between. The geometric states do not need the light-time iteration, so the cost is close to the uncorrected case.
+   *          The ephemeris cache fits the corrected states directly, so this setting is used only out of the cache range.
+   * @param [in] update_interval_s: Update interval [sec]. Zero or negative value calculates the corrected states at every update.
+   */
+  inline void SetAberrationCorrectionUpdateInterval_s(const double update_interval_s) {
+    aberration_correction_update_interval_s_ = update_interval_s;
+  }
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the current states of the bodies and the rotations to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the current states of the bodies and the rotations from the snapshot without SPICE
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
 
   // Getters
   // Orbit information
@@ -88,6 +141,12 @@ class CelestialInformation : public ILoggable {
     int id = CalcBodyIdFromName(body_name);
     return GetPositionFromCenter_i_m(id);
   }
+  /**
+   * @fn GetPositionFromCenter_i_m
+   * @brief Return position from the center body in the inertial frame [m]
+   * @param [in] body: Handle of the body given by GetBodyHandle
+   */
+  inline libra::Vector<3> GetPositionFromCenter_i_m(const CelestialBodyHandle body) const { return GetPositionFromCenter_i_m(body.index_); }
   /**
    * @fn GetPositionFromSelectedBody_i_m
    * @brief Return position from the selected reference body in the inertial frame [m]
@@ -102,6 +161,15 @@ class CelestialInformation : public ILoggable {
 
     return target_body_position_i_m - reference_body_position_i_m;
   }
+  /**
+   * @fn GetPositionFromSelectedBody_i_m
+   * @brief Return position from the selected reference body in the inertial frame [m]
+   * @param [in] target_body: Handle of the target body given by GetBodyHandle
+   * @param [in] reference_body: Handle of the reference body given by GetBodyHandle
+   */
+  inline libra::Vector<3> GetPositionFromSelectedBody_i_m(const CelestialBodyHandle target_body, const CelestialBodyHandle reference_body) const {
+    return GetPositionFromCenter_i_m(target_body) - GetPositionFromCenter_i_m(reference_body);
+  }
 
   /**
    * @fn GetVelocityFromCenter_i_m_s
@@ -123,6 +191,21 @@ class CelestialInformation : public ILoggable {
     int id = CalcBodyIdFromName(body_name);
     return GetVelocityFromCenter_i_m_s(id);
   }
+  /**
+   * @fn GetVelocityFromCenter_i_m_s
+   * @brief Return velocity from the center body in the inertial frame [m/s]
+   * @param [in] body: Handle of the body given by GetBodyHandle
+   */
+  inline libra::Vector<3> GetVelocityFromCenter_i_m_s(const CelestialBodyHandle body) const { return GetVelocityFromCenter_i_m_s(body.index_); }
+  /**
+   * @fn GetStatesFromCenter_i
+   * @brief Copy the positions and velocities of the bodies from the center body in the inertial frame at once
+   * @param [in] bodies: Handles of the bodies given by GetBodyHandle
+   * @param [out] positions_i_m: Positions [m] (x, y, and z of each body in the order of the handles)
+   * @param [out] velocities_i_m_s: Velocities [m/s] (x, y, and z of each body in the order of the handles)
+   */
+  void GetStatesFromCenter_i(const std::vector<CelestialBodyHandle>& bodies, std::vector<double>& positions_i_m,
+                             std::vector<double>& velocities_i_m_s) const;
   /**
    * @fn GetVelocityFromSelectedBody_i_m_s
    * @brief Return position from the selected reference body in the inertial frame [m]
@@ -137,6 +220,15 @@ class CelestialInformation : public ILoggable {
 
     return target_body_velocity_i_m_s - reference_body_velocity_i_m_s;
   }
+  /**
+   * @fn GetVelocityFromSelectedBody_i_m_s
+   * @brief Return velocity from the selected reference body in the inertial frame [m/s]
+   * @param [in] target_body: Handle of the target body given by GetBodyHandle
+   * @param [in] reference_body: Handle of the reference body given by GetBodyHandle
+   */
+  inline libra::Vector<3> GetVelocityFromSelectedBody_i_m_s(const CelestialBodyHandle target_body, const CelestialBodyHandle reference_body) const {
+    return GetVelocityFromCenter_i_m_s(target_body) - GetVelocityFromCenter_i_m_s(reference_body);
+  }
 
   // Gravity constants
   /**
@@ -148,11 +240,17 @@ class CelestialInformation : public ILoggable {
     int index = CalcBodyIdFromName(body_name);
     return celestial_body_gravity_constant_m3_s2_[index];
   }
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] body: Handle of the body given by GetBodyHandle
+   */
+  inline double GetGravityConstant_m3_s2(const CelestialBodyHandle body) const { return celestial_body_gravity_constant_m3_s2_[body.index_]; }
   /**
    * @fn GetCenterBodyGravityConstant_m3_s2
    * @brief Return gravity constant of the center body [m^3/s^2]
    */
-  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_name_.c_str()); }
+  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_handle_); }
 
   // Shape information
   /**
@@ -175,6 +273,12 @@ class CelestialInformation : public ILoggable {
     int id = CalcBodyIdFromName(body_name);
     return GetRadii_m(id);
   }
+  /**
+   * @fn GetRadii_m
+   * @brief Return 3 axis planetographic radii of a celestial body [m]
+   * @param [in] body: Handle of the body given by GetBodyHandle
+   */
+  inline libra::Vector<3> GetRadii_m(const CelestialBodyHandle body) const { return GetRadii_m(body.index_); }
   /**
    * @fn GetMeanRadiusFromName_m
    * @brief Return mean radius of a celestial body [m]
@@ -184,6 +288,12 @@ class CelestialInformation : public ILoggable {
     int index = CalcBodyIdFromName(body_name);
     return celestial_body_mean_radius_m_[index];
   }
+  /**
+   * @fn GetMeanRadius_m
+   * @brief Return mean radius of a celestial body [m]
+   * @param [in] body: Handle of the body given by GetBodyHandle
+   */
+  inline double GetMeanRadius_m(const CelestialBodyHandle body) const { return celestial_body_mean_radius_m_[body.index_]; }
 
   // Parameters
   /**
@@ -201,6 +311,11 @@ class CelestialInformation : public ILoggable {
    * @brief Return name of the center body
    */
   inline std::string GetCenterBodyName(void) const { return center_body_name_; }
+  /**
+   * @fn GetCenterBodyHandle
+   * @brief Return handle of the center body
+   */
+  inline CelestialBodyHandle GetCenterBodyHandle(void) const { return center_body_handle_; }
 
   // Members
   /**
@@ -222,12 +337,34 @@ class CelestialInformation : public ILoggable {
    * @return ID of CelestialInformation list
    */
   int CalcBodyIdFromName(const char* body_name) const;
+  /**
+   * @fn GetBodyHandle
+   * @brief Resolve the body name to the handle used by the handle based getters
+   * @note This function calls SPICE. Call it at the initialization, not in the simulation loop.
+   * @param [in] body_name: Celestial body name
+   * @return Handle of the body. is_valid_ is false when the body is not selected.
+   */
+  CelestialBodyHandle GetBodyHandle(const char* body_name) const;
   /**
    * @fn DebugOutput
    * @brief Debug output
    */
   void DebugOutput(void);
 
+  /**
+   * @fn GetSpiceMutex
+   * @brief Return the mutex to serialize the SPICE function calls
+   * @note CSPICE is not thread-safe. Use SpiceAccess, or lock this mutex (the same mutex as SpiceAccess::GetMutex) when CSPICE functions are
+   *       called directly.
+   */
+  static std::mutex& GetSpiceMutex();
+
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the body information and the ephemeris cache
+   */
+  MemoryUsage GetMemoryUsage() const;
+
  private:
   // Setting parameters
   unsigned int number_of_selected_bodies_;     //!< Number of selected body
@@ -236,6 +373,7 @@ class CelestialInformation : public ILoggable {
   std::string center_body_name_;               //!< Center object name of inertial frame
   std::string aberration_correction_setting_;  //!< Stellar aberration correction
                                                //!< Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt
+  CelestialBodyHandle center_body_handle_;     //!< Handle of the center object
 
   // Calculated values
   double* celestial_body_position_from_center_i_m_;    //!< Position vector list at inertial frame [m]
@@ -252,6 +390,13 @@ class CelestialInformation : public ILoggable {
   MoonRotation* moon_rotation_;                  //!< Instance of Moon rotation
   std::vector<std::string> rotation_mode_list_;  //!< Rotation mode list for planets
 
+  std::shared_ptr<const EphemerisCache> ephemeris_cache_;  //!< Ephemeris cache. nullptr when SPICE is always used.
+
+  // Aberration correction
+  double aberration_correction_update_interval_s_ = 0.0;  //!< Interval of the aberration correction calculation [sec]
+  double aberration_correction_updated_time_s_ = 0.0;     //!< Ephemeris time of the latest aberration correction calculation [sec]
+  std::vector<double> aberration_correction_km_;          //!< Corrected minus geometric states of each body [km, km/s]
+
   /**
    * @fn GetPlanetOrbit
    * @brief Get position/velocity of planet.
@@ -259,8 +404,15 @@ class CelestialInformation : public ILoggable {
    * @param [in] planet_name: Nama of planet defined by SPICE
    * @param [in] et: Ephemeris time
    * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
+   * @param [in] aberration_correction: Aberration correction setting for SPICE
    */
-  void GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]);
+  void GetPlanetOrbit(const char* planet_name, const double et, double orbit[6], const std::string& aberration_correction);
+  /**
+   * @fn UpdateAllObjectsOrbitWithSpice
+   * @brief Update the position and velocity of all selected bodies with SPICE
+   * @param [in] ephemeris_time: Ephemeris time
+   */
+  void UpdateAllObjectsOrbitWithSpice(const double ephemeris_time);
 
   /**
    * @fn GetRotationMode
@@ -280,5 +432,24 @@ class CelestialInformation : public ILoggable {
  *@param [in] file_name: Path to the initialize function
  */
 CelestialInformation* InitCelestialInformation(std::string file_name);
+/**
+ *@fn InitEphemerisCache
+ *@brief Enable the ephemeris cache over the simulation span when it is enabled in the initialize file
+ *@note Call this function after the initialization of SimulationTime since the simulation span is necessary.
+ *@param [in] celestial_information: CelestialInformation
+ *@param [in] simulation_time: Simulation time
+ *@param [in] file_name: Path to the initialize function
+ */
+void InitEphemerisCache(CelestialInformation* celestial_information, const SimulationTime& simulation_time, std::string file_name);
+/**
+ *@fn InitSpkSubset
+ *@brief Replace the SPK file with its subset for the selected bodies and the simulation span when bsp_subset_file is set in the initialize file
+ *@note The subset file is extracted when it does not exist or does not cover the span. Call this function after the initialization of
+ *      SimulationTime and before the first calculation of the states.
+ *@param [in] celestial_information: CelestialInformation
+ *@param [in] simulation_time: Simulation time
+ *@param [in] file_name: Path to the initialize function
+ */
+void InitSpkSubset(const CelestialInformation& celestial_information, const SimulationTime& simulation_time, std::string file_name);
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
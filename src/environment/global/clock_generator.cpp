@@ -5,14 +5,20 @@
 
 #include "clock_generator.hpp"
 
+#include <algorithm>
+
 ClockGenerator::~ClockGenerator() {}
 
-void ClockGenerator::RegisterComponent(ITickable* tickable) { components_.push_back(tickable); }
+void ClockGenerator::RegisterComponent(ITickable* tickable) {
+  components_.push_back(tickable);
+  is_schedule_updated_ = false;
+}
 
 void ClockGenerator::RemoveComponent(ITickable* tickable) {
   for (auto itr = components_.begin(); itr != components_.end();) {
     if (*itr == tickable) {
       components_.erase(itr++);
+      is_schedule_updated_ = false;
       break;
     } else {
       ++itr;
@@ -21,18 +27,65 @@ void ClockGenerator::RemoveComponent(ITickable* tickable) {
 }
 
 void ClockGenerator::TickToComponents() {
+  if (!is_schedule_updated_ || schedule_revision_ != ITickable::GetScheduleRevision()) BuildSchedule();
+
+  // Collect the due ticks and restore the registration order
+  due_entries_.clear();
+  for (const auto& bucket : buckets_) {
+    if (timer_count_ % bucket.prescaler > 0) continue;
+    if (due_entries_.empty()) {
+      due_entries_ = bucket.entries;
+    } else {
+      const size_t middle = due_entries_.size();
+      due_entries_.insert(due_entries_.end(), bucket.entries.begin(), bucket.entries.end());
+      std::inplace_merge(due_entries_.begin(), due_entries_.begin() + middle, due_entries_.end(),
+                         [](const ScheduleEntry& lhs, const ScheduleEntry& rhs) { return lhs.order < rhs.order; });
+    }
+  }
+
   // Update for each component
-  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
-    // Run MainRoutine
-    (*itr)->Tick(timer_count_);
-    // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
-    if ((*itr)->GetNeedsFastUpdate()) {
-      (*itr)->FastTick(timer_count_);
+  for (size_t i = 0; i < due_entries_.size(); i++) {
+    const ScheduleEntry& entry = due_entries_[i];
+    if (entry.batch_tick_function != nullptr) {
+      // Run MainRoutine of the consecutive components of the same type at once
+      batch_tickables_.clear();
+      batch_tickables_.push_back(entry.tickable);
+      while (i + 1 < due_entries_.size() && due_entries_[i + 1].batch_tick_function == entry.batch_tick_function) {
+        batch_tickables_.push_back(due_entries_[++i].tickable);
+      }
+      entry.batch_tick_function(batch_tickables_.data(), batch_tickables_.size(), timer_count_);
+    } else if (entry.order % 2 == 0) {
+      // Run MainRoutine
+      entry.tickable->Tick(timer_count_);
+    } else {
+      // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
+      entry.tickable->FastTick(timer_count_);
     }
   }
   timer_count_++;  // TODO: Consider if "timer_count" is necessary
 }
 
+void ClockGenerator::BuildSchedule() {
+  schedule_revision_ = ITickable::GetScheduleRevision();
+  buckets_.clear();
+  auto add_entry = [&](const unsigned int prescaler, const ScheduleEntry& entry) {
+    const unsigned int valid_prescaler = (prescaler > 0) ? prescaler : 1;
+    auto bucket = std::find_if(buckets_.begin(), buckets_.end(), [&](const ScheduleBucket& b) { return b.prescaler == valid_prescaler; });
+    if (bucket == buckets_.end()) {
+      buckets_.push_back(ScheduleBucket{valid_prescaler, {}});
+      bucket = buckets_.end() - 1;
+    }
+    bucket->entries.push_back(entry);
+  };
+  for (size_t i = 0; i < components_.size(); i++) {
+    ITickable* tickable = components_[i];
+    if (tickable->GetIsSleeping()) continue;
+    add_entry(tickable->GetPrescaler(), ScheduleEntry{2 * i, tickable, tickable->GetBatchTickFunction()});
+    if (tickable->GetNeedsFastUpdate()) add_entry(tickable->GetFastPrescaler(), ScheduleEntry{2 * i + 1, tickable, nullptr});
+  }
+  is_schedule_updated_ = true;
+}
+
 void ClockGenerator::UpdateComponents(const SimulationTime* simulation_time) {
   if (simulation_time->GetCompoUpdateFlag()) {
     TickToComponents();
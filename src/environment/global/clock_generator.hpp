@@ -7,6 +7,8 @@
 #define S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
 
 #include <components/base/interface_tickable.hpp>
+#include <cstddef>
+#include <utilities/snapshot.hpp>
 #include <vector>
 
 #include "simulation_time.hpp"
@@ -14,6 +16,10 @@
 /**
  * @class ClockGenerator
  * @brief Class to generate clock for classes which have ITickable
+ * @details The components are grouped by their prescalers, and only the groups due at the count are visited.
+ *          The due components are called in the registration order as the simple loop over all components.
+ *          Consecutive due components of the same type are updated by one call of their batch tick function.
+ *          The sleeping components (e.g. the components whose power switch is off) are removed from the schedule until they wake up.
  */
 class ClockGenerator {
  public:
@@ -46,15 +52,74 @@ class ClockGenerator {
    * @param [in] simulation_time: Simulation time
    */
   void UpdateComponents(const SimulationTime* simulation_time);
+  /**
+   * @fn RescheduleComponents
+   * @brief Request to rebuild the schedule at the next tick
+   * @note Call this when the prescaler of a registered component is changed.
+   */
+  inline void RescheduleComponents(void) { is_schedule_updated_ = false; }
   /**
    * @fn ClearTimerCount
    * @brief Clear time count
    */
   inline void ClearTimerCount(void) { timer_count_ = 0; }
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the timer count to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  inline void SaveSnapshot(SnapshotWriter& snapshot) const { snapshot.Write(timer_count_); }
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the timer count from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  inline void LoadSnapshot(SnapshotReader& snapshot) { snapshot.Read(timer_count_); }
+  /**
+   * @fn SetSkipsPowerOffComponents
+   * @brief Set whether the components constructed after this call are skipped while their power switch is off
+   * @note See Component::SetSleepWhilePowerOff. The power ports must outlive the components.
+   */
+  inline void SetSkipsPowerOffComponents(const bool skips_power_off_components) { skips_power_off_components_ = skips_power_off_components; }
+  /**
+   * @fn GetSkipsPowerOffComponents
+   * @brief Return whether the components are skipped while their power switch is off
+   */
+  inline bool GetSkipsPowerOffComponents() const { return skips_power_off_components_; }
 
  private:
-  std::vector<ITickable*> components_;  //!< Component list fot tick
-  unsigned int timer_count_;            //!< Timer count TODO: change to long?
+  std::vector<ITickable*> components_;       //!< Component list fot tick
+  unsigned int timer_count_;                 //!< Timer count TODO: change to long?
+  bool skips_power_off_components_ = false;  //!< Whether the components are skipped while their power switch is off
+
+  /**
+   * @struct ScheduleEntry
+   * @brief Tick of a component in the schedule
+   */
+  struct ScheduleEntry {
+    size_t order;                                      //!< Order of the call (registration order * 2 + 1 for FastTick)
+    ITickable* tickable;                               //!< Component
+    ITickable::BatchTickFunction batch_tick_function;  //!< Batch tick function for Tick, nullptr to call Tick of each
+  };
+  /**
+   * @struct ScheduleBucket
+   * @brief Ticks with the same prescaler
+   */
+  struct ScheduleBucket {
+    unsigned int prescaler;              //!< Frequency scale factor
+    std::vector<ScheduleEntry> entries;  //!< Ticks ordered by the order
+  };
+  std::vector<ScheduleBucket> buckets_;      //!< Buckets of the ticks
+  std::vector<ScheduleEntry> due_entries_;   //!< Work area for the ticks due at the count
+  std::vector<ITickable*> batch_tickables_;  //!< Work area for the components updated by a batch tick function
+  bool is_schedule_updated_ = false;         //!< Whether the buckets correspond to the components
+  unsigned int schedule_revision_ = 0;       //!< Schedule revision of ITickable when the buckets are built
+
+  /**
+   * @fn BuildSchedule
+   * @brief Group the ticks of the components by their prescalers
+   */
+  void BuildSchedule();
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
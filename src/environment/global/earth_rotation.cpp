@@ -19,6 +19,8 @@
 EarthRotation::EarthRotation(const EarthRotationMode rotation_mode) : rotation_mode_(rotation_mode) {
   dcm_j2000_to_ecef_ = libra::MakeIdentityMatrix<3>();
   dcm_teme_to_ecef_ = dcm_j2000_to_ecef_;
+  dcm_j2000_to_teme_ = dcm_j2000_to_ecef_;
+  dcm_ecef_to_j2000_ = dcm_j2000_to_ecef_;
   InitializeParameters();
 }
 
@@ -106,44 +108,33 @@ void EarthRotation::InitializeParameters() {
   } else {
     // If the rotation mode is neither Simple nor Full, disable the rotation calculation and make the DCM a unit matrix
     dcm_j2000_to_ecef_ = libra::MakeIdentityMatrix<3>();
+    dcm_ecef_to_j2000_ = dcm_j2000_to_ecef_;
   }
 }
 
 void EarthRotation::Update(const double julian_date) {
-  double gmst_rad = gstime(julian_date);  // It is a bit different with 長沢(Nagasawa)'s algorithm. TODO: Check the correctness
+  EarthOrientationParameterValues eop_values;
+  if (earth_orientation_parameters_ != nullptr) eop_values = earth_orientation_parameters_->CalcValues(julian_date - kModifiedJulianDateOffset_);
+
+  // UT1 is used for the sidereal time
+  double julian_date_ut1 = julian_date + eop_values.ut1_minus_utc_s_ * kSec2Day_;
+  double gmst_rad = gstime(julian_date_ut1);  // It is a bit different with 長沢(Nagasawa)'s algorithm. TODO: Check the correctness
 
   if (rotation_mode_ == EarthRotationMode::kFull) {
-    // Compute Julian date for terrestrial time
-    double terrestrial_time_julian_day =
-        julian_date + kDtUt1Utc_ * kSec2Day_;  // TODO: Check the correctness. Problem is that S2E doesn't have Gregorian calendar.
-
-    // Compute nth power of julian century for terrestrial time.
-    // The actual unit of tTT_century is [century^(i+1)], i is the index of the array
-    double terrestrial_time_julian_century[4];
-    terrestrial_time_julian_century[0] = (terrestrial_time_julian_day - kJulianDateJ2000_) / kDayJulianCentury_;
-    for (int i = 0; i < 3; i++) {
-      terrestrial_time_julian_century[i + 1] = terrestrial_time_julian_century[i] * terrestrial_time_julian_century[0];
-    }
-
-    libra::Matrix<3, 3> dcm_precession;
-    libra::Matrix<3, 3> dcm_nutation;
-    libra::Matrix<3, 3> dcm_rotation;
-    libra::Matrix<3, 3> dcm_polar_motion;
-    // Nutation + Precession
-    dcm_precession = Precession(terrestrial_time_julian_century);
-    dcm_nutation = Nutation(terrestrial_time_julian_century);  // epsilon_rad_, d_epsilon_rad_, d_psi_rad_ are updated in this procedure
+    const bool is_cache_valid = is_precession_nutation_computed_ && precession_nutation_update_interval_s_ > 0.0 &&
+                                fabs(julian_date - precession_nutation_updated_jd_) < precession_nutation_update_interval_s_ * kSec2Day_;
+    if (!is_cache_valid) UpdatePrecessionNutation(julian_date);
 
     // Axial Rotation
-    double equinox_rad = d_psi_rad_ * cos(epsilon_rad_ + d_epsilon_rad_);  // Equation of equinoxes [rad]
-    double gast_rad = gmst_rad + equinox_rad;                              // Greenwich 'Apparent' Sidereal Time [rad]
-    dcm_rotation = AxialRotation(gast_rad);
-    // Polar motion (is not considered so far, even without polar motion, the result agrees well with the matlab reference)
-    double x_p = 0.0;
-    double y_p = 0.0;
-    dcm_polar_motion = PolarMotion(x_p, y_p);
+    double gast_rad = gmst_rad + equation_of_equinoxes_rad_;  // Greenwich 'Apparent' Sidereal Time [rad]
+    libra::Matrix<3, 3> dcm_rotation = AxialRotation(gast_rad);
+    // Polar motion (zero when the Earth orientation parameters are not set)
+    libra::Matrix<3, 3> dcm_polar_motion = PolarMotion(eop_values.polar_motion_x_rad_, eop_values.polar_motion_y_rad_);
 
     // Total orientation
-    dcm_j2000_to_ecef_ = dcm_polar_motion * dcm_rotation * dcm_nutation * dcm_precession;
+    dcm_j2000_to_ecef_ = dcm_polar_motion * dcm_rotation * dcm_precession_nutation_;
+    // TEME is rotated from the true of date frame by the equation of the equinoxes since SGP4 uses GMST
+    dcm_j2000_to_teme_ = AxialRotation(equation_of_equinoxes_rad_) * dcm_precession_nutation_;
   } else if (rotation_mode_ == EarthRotationMode::kSimple) {
     // In this case, only Axial Rotation is executed, with its argument replaced from G'A'ST to G'M'ST
     // FIXME: Not suitable when the center body is not the earth
@@ -152,6 +143,33 @@ void EarthRotation::Update(const double julian_date) {
     // Leave the DCM as unit Matrix(diag{1,1,1})
     return;
   }
+  dcm_ecef_to_j2000_ = dcm_j2000_to_ecef_.Transpose();
+}
+
+void EarthRotation::UpdatePrecessionNutation(const double julian_date) {
+  // Compute Julian date for terrestrial time
+  double terrestrial_time_julian_day =
+      julian_date + kDtUt1Utc_ * kSec2Day_;  // TODO: Check the correctness. Problem is that S2E doesn't have Gregorian calendar.
+
+  // Compute nth power of julian century for terrestrial time.
+  // The actual unit of tTT_century is [century^(i+1)], i is the index of the array
+  double terrestrial_time_julian_century[4];
+  terrestrial_time_julian_century[0] = (terrestrial_time_julian_day - kJulianDateJ2000_) / kDayJulianCentury_;
+  for (int i = 0; i < 3; i++) {
+    terrestrial_time_julian_century[i + 1] = terrestrial_time_julian_century[i] * terrestrial_time_julian_century[0];
+  }
+
+  libra::Matrix<3, 3> dcm_precession;
+  libra::Matrix<3, 3> dcm_nutation;
+  // Nutation + Precession
+  dcm_precession = Precession(terrestrial_time_julian_century);
+  dcm_nutation = Nutation(terrestrial_time_julian_century);  // epsilon_rad_, d_epsilon_rad_, d_psi_rad_ are updated in this procedure
+  dcm_precession_nutation_ = dcm_nutation * dcm_precession;
+
+  equation_of_equinoxes_rad_ = d_psi_rad_ * cos(epsilon_rad_ + d_epsilon_rad_);
+
+  precession_nutation_updated_jd_ = julian_date;
+  is_precession_nutation_computed_ = true;
 }
 
 libra::Matrix<3, 3> EarthRotation::AxialRotation(const double gast_rad) { return libra::MakeRotationMatrixZ(gast_rad); }
@@ -247,13 +265,14 @@ libra::Matrix<3, 3> EarthRotation::Precession(const double (&t_tt_century)[4]) {
 libra::Matrix<3, 3> EarthRotation::PolarMotion(const double x_p, const double y_p) {
   libra::Matrix<3, 3> dcm_polar_motion;
 
+  // Transpose of W = R2(x_p) * R1(y_p) in IERS Conventions with the small angle approximation
   dcm_polar_motion[0][0] = 1.0;
   dcm_polar_motion[0][1] = 0.0;
-  dcm_polar_motion[0][2] = -x_p;
+  dcm_polar_motion[0][2] = x_p;
   dcm_polar_motion[1][0] = 0.0;
   dcm_polar_motion[1][1] = 1.0;
   dcm_polar_motion[1][2] = -y_p;
-  dcm_polar_motion[2][0] = x_p;
+  dcm_polar_motion[2][0] = -x_p;
   dcm_polar_motion[2][1] = y_p;
   dcm_polar_motion[2][2] = 1.0;
 
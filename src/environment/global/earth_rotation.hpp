@@ -9,7 +9,11 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_EARTH_ROTATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_EARTH_ROTATION_HPP_
 
+#include <memory>
+
 #include "math_physics/math/matrix.hpp"
+#include "math_physics/planet_rotation/earth_orientation_parameters.hpp"
+#include "utilities/snapshot.hpp"
 
 /**
  * @enum EarthRotationMode
@@ -41,26 +45,98 @@ class EarthRotation {
    */
   void Update(const double julian_date);
 
+  /**
+   * @fn SetPrecessionNutationUpdateInterval_s
+   * @brief Set the update interval of the precession and nutation matrix in the full mode
+   * @details The precession and nutation matrix and the equation of the equinoxes are recomputed only when the interval has passed from
+   *          the latest computation, and only the axial rotation with GMST is updated at every update. The angular rate of the precession
+   *          and the nutation is less than 3.0e-6 arcsec/s, so the error of the DCM is less than 3.0e-6 arcsec times the interval in
+   *          seconds (e.g., 0.011 arcsec, 0.35 m on the Earth surface, for 3600 sec).
+   * @param [in] update_interval_s: Update interval [sec]. Zero or negative value recomputes the matrix at every update.
+   */
+  inline void SetPrecessionNutationUpdateInterval_s(const double update_interval_s) {
+    precession_nutation_update_interval_s_ = update_interval_s;
+  }
+
+  /**
+   * @fn SetEarthOrientationParameters
+   * @brief Set the Earth orientation parameters table
+   * @details UT1 - UTC is used for the sidereal time in the simple and the full modes, and the polar motion is used in the full mode.
+   *          The parameters are not considered when the table is not set.
+   * @param [in] earth_orientation_parameters: Earth orientation parameters table (e.g., GetSharedEarthOrientationParameters)
+   */
+  inline void SetEarthOrientationParameters(const std::shared_ptr<const EarthOrientationParameters> earth_orientation_parameters) {
+    earth_orientation_parameters_ = earth_orientation_parameters;
+  }
+
   /**
    * @fn GetDcmJ2000ToEcef
    * @brief Return the DCM between J2000 inertial frame and the Earth Centered Earth Fixed frame
+   * @note The matrix is computed once per update and shared with all spacecraft and components
+   */
+  inline const libra::Matrix<3, 3>& GetDcmJ2000ToEcef() const { return dcm_j2000_to_ecef_; };
+  /**
+   * @fn GetDcmEcefToJ2000
+   * @brief Return the DCM between the Earth Centered Earth Fixed frame and J2000 inertial frame
+   * @note The transpose is computed once per update so that users do not need to transpose the matrix by themselves
    */
-  inline const libra::Matrix<3, 3> GetDcmJ2000ToEcef() const { return dcm_j2000_to_ecef_; };
+  inline const libra::Matrix<3, 3>& GetDcmEcefToJ2000() const { return dcm_ecef_to_j2000_; };
 
   /**
    * @fn GetDcmTemeToEcef
    * @brief Return the DCM between TEME (Inertial frame used in SGP4) and the Earth Centered Earth Fixed frame
    */
-  inline const libra::Matrix<3, 3> GetDcmTemeToEcef() const { return dcm_teme_to_ecef_; };
+  inline const libra::Matrix<3, 3>& GetDcmTemeToEcef() const { return dcm_teme_to_ecef_; };
+  /**
+   * @fn GetDcmJ2000ToTeme
+   * @brief Return the DCM between J2000 and TEME (Inertial frame used in SGP4)
+   * @note The precession, the nutation and the equation of the equinoxes are considered only in the full mode. Otherwise, TEME is treated as
+   *       J2000 and the DCM is a unit matrix.
+   */
+  inline const libra::Matrix<3, 3>& GetDcmJ2000ToTeme() const { return dcm_j2000_to_teme_; };
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the current DCMs to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  inline void SaveSnapshot(SnapshotWriter& snapshot) const {
+    snapshot.Write(dcm_j2000_to_ecef_);
+    snapshot.Write(dcm_ecef_to_j2000_);
+    snapshot.Write(dcm_teme_to_ecef_);
+    snapshot.Write(dcm_j2000_to_teme_);
+  }
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the current DCMs from the snapshot without the calculation
+   * @param [in] snapshot: Snapshot reader
+   */
+  inline void LoadSnapshot(SnapshotReader& snapshot) {
+    snapshot.Read(dcm_j2000_to_ecef_);
+    snapshot.Read(dcm_ecef_to_j2000_);
+    snapshot.Read(dcm_teme_to_ecef_);
+    snapshot.Read(dcm_j2000_to_teme_);
+  }
 
  private:
   double d_psi_rad_;                       //!< Nutation in obliquity [rad]
   double d_epsilon_rad_;                   //!< Nutation in longitude [rad]
   double epsilon_rad_;                     //!< Mean obliquity of the ecliptic [rad]
   libra::Matrix<3, 3> dcm_j2000_to_ecef_;  //!< Direction Cosine Matrix J2000 to ECEF
+  libra::Matrix<3, 3> dcm_ecef_to_j2000_;  //!< Direction Cosine Matrix ECEF to J2000
   libra::Matrix<3, 3> dcm_teme_to_ecef_;   //!< Direction Cosine Matrix TEME to ECEF
+  libra::Matrix<3, 3> dcm_j2000_to_teme_;  //!< Direction Cosine Matrix J2000 to TEME
   EarthRotationMode rotation_mode_;        //!< Designation of dynamics model
 
+  // Cache of the slowly varying terms for the full mode
+  double precession_nutation_update_interval_s_ = 0.0;  //!< Update interval of the precession and nutation matrix [sec]
+  double precession_nutation_updated_jd_ = 0.0;         //!< Julian date of the latest precession and nutation computation
+  bool is_precession_nutation_computed_ = false;        //!< Flag of the precession and nutation computation
+  libra::Matrix<3, 3> dcm_precession_nutation_;         //!< Nutation * Precession matrix
+  double equation_of_equinoxes_rad_ = 0.0;              //!< Equation of the equinoxes [rad]
+
+  std::shared_ptr<const EarthOrientationParameters> earth_orientation_parameters_;  //!< Earth orientation parameters table
+
   // Definitions of coefficients
   // They are handling as constant values
   // TODO: Consider to read setting files for these coefficients
@@ -81,6 +157,7 @@ class EarthRotation {
   const double kSec2Day_ = 1.0 / (24.0 * 60.0 * 60.0);  //!< Conversion constant from sec to day
   const double kJulianDateJ2000_ = 2451545.0;           //!< Julian date of J2000 [day]
   const double kDayJulianCentury_ = 36525.0;            //!< Conversion constant from Julian century to day [day/century]
+  const double kModifiedJulianDateOffset_ = 2400000.5;  //!< Offset between Julian date and modified Julian date [day]
 
   /**
    * @fn InitializeParameters
@@ -88,6 +165,13 @@ class EarthRotation {
    */
   void InitializeParameters();
 
+  /**
+   * @fn UpdatePrecessionNutation
+   * @brief Update the precession and nutation matrix and the equation of the equinoxes
+   * @param [in] julian_date: Julian date
+   */
+  void UpdatePrecessionNutation(const double julian_date);
+
   /**
    * @fn AxialRotation
    * @brief Calculate movement of the coordinate axes due to rotation around the rotation axis
@@ -115,7 +199,9 @@ class EarthRotation {
   /**
    * @fn PolarMotion
    * @brief Calculate movement of the coordinate axes due to Polar Motion
-   * @note Currently, this function is not used.
+   * @param [in] x_p: X component of the polar motion [rad]
+   * @param [in] y_p: Y component of the polar motion [rad]
+   * @return Rotation matrix from the pseudo Earth fixed frame to ECEF
    */
   libra::Matrix<3, 3> PolarMotion(const double x_p, const double y_p);
 };
@@ -0,0 +1,53 @@
+/**
+ * @file ephemeris_cache.cpp
+ * @brief Class to approximate the ephemeris of celestial bodies with Chebyshev series
+ */
+
+#include "ephemeris_cache.hpp"
+
+#include <cmath>
+
+EphemerisCache::EphemerisCache(const double start_time_s, const double end_time_s, const double segment_length_s, const size_t degree,
+                               const size_t number_of_bodies, const std::function<void(const size_t, const double, double[6])>& calc_state)
+    : start_time_s_(start_time_s), segment_length_s_(segment_length_s), number_of_bodies_(number_of_bodies) {
+  number_of_segments_ = (size_t)ceil((end_time_s - start_time_s) / segment_length_s);
+  if (number_of_segments_ == 0) number_of_segments_ = 1;
+  end_time_s_ = start_time_s_ + segment_length_s_ * (double)number_of_segments_;
+
+  series_.reserve(number_of_segments_ * number_of_bodies_ * kStateSize);
+  std::vector<std::vector<double>> values(kStateSize, std::vector<double>(degree + 1));
+  for (size_t segment = 0; segment < number_of_segments_; segment++) {
+    const double segment_start_s = start_time_s_ + segment_length_s_ * (double)segment;
+    const double segment_end_s = segment_start_s + segment_length_s_;
+    const std::vector<double> nodes = libra::ChebyshevSeries::CalcNodes(segment_start_s, segment_end_s, degree);
+    for (size_t body = 0; body < number_of_bodies_; body++) {
+      for (size_t k = 0; k < nodes.size(); k++) {
+        double state[kStateSize];
+        calc_state(body, nodes[k], state);
+        for (size_t i = 0; i < kStateSize; i++) values[i][k] = state[i];
+      }
+      for (size_t i = 0; i < kStateSize; i++) {
+        series_.push_back(libra::ChebyshevSeries::Fit(segment_start_s, segment_end_s, values[i]));
+      }
+    }
+  }
+}
+
+bool EphemerisCache::CalcState(const size_t body_index, const double time_s, double state[6]) const {
+  if (!IsInRange(time_s) || body_index >= number_of_bodies_) return false;
+
+  size_t segment = (size_t)((time_s - start_time_s_) / segment_length_s_);
+  if (segment >= number_of_segments_) segment = number_of_segments_ - 1;
+
+  const size_t offset = (segment * number_of_bodies_ + body_index) * kStateSize;
+  for (size_t i = 0; i < kStateSize; i++) {
+    state[i] = series_[offset + i].Calc(time_s);
+  }
+  return true;
+}
+
+size_t EphemerisCache::GetMemoryUsage_bytes() const {
+  size_t bytes = sizeof(*this) + (series_.capacity() - series_.size()) * sizeof(libra::ChebyshevSeries);
+  for (const auto& series : series_) bytes += series.GetMemoryUsage_bytes();
+  return bytes;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file ephemeris_cache.hpp
+ * @brief Class to approximate the ephemeris of celestial bodies with Chebyshev series
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_EPHEMERIS_CACHE_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_EPHEMERIS_CACHE_HPP_
+
+#include <functional>
+#include <math_physics/math/chebyshev_series.hpp>
+#include <vector>
+
+/**
+ * @class EphemerisCache
+ * @brief Class to approximate the position and velocity of celestial bodies with Chebyshev series
+ * @details The time span is divided into segments with the same length, and each component of the state of each body is fitted in each segment.
+ *          The fitting is done in the constructor, and the instance is not modified after that. So it can be shared between threads.
+ */
+class EphemerisCache {
+ public:
+  /**
+   * @fn EphemerisCache
+   * @brief Constructor
+   * @param [in] start_time_s: Start time of the cache [sec]
+   * @param [in] end_time_s: End time of the cache [sec]. The cache covers until the end of the segment which includes this time.
+   * @param [in] segment_length_s: Length of each segment [sec]
+   * @param [in] degree: Degree of the Chebyshev series
+   * @param [in] number_of_bodies: Number of bodies
+   * @param [in] calc_state: Function to calculate the state (position and velocity) of the body at the time: (body_index, time_s, state)
+   */
+  EphemerisCache(const double start_time_s, const double end_time_s, const double segment_length_s, const size_t degree,
+                 const size_t number_of_bodies, const std::function<void(const size_t, const double, double[6])>& calc_state);
+
+  /**
+   * @fn CalcState
+   * @brief Calculate the approximated state of the body
+   * @param [in] body_index: Index of the body
+   * @param [in] time_s: Time [sec]
+   * @param [out] state: Position and velocity
+   * @return False when the time is out of the range. The state is not modified in this case.
+   */
+  bool CalcState(const size_t body_index, const double time_s, double state[6]) const;
+
+  // Getters
+  /**
+   * @fn IsInRange
+   * @return True when the time is covered by the cache
+   */
+  inline bool IsInRange(const double time_s) const { return start_time_s_ <= time_s && time_s <= end_time_s_; }
+  /**
+   * @fn GetNumberOfSegments
+   * @return Number of segments
+   */
+  inline size_t GetNumberOfSegments() const { return number_of_segments_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the cache including the coefficients of all series [bytes]
+   */
+  size_t GetMemoryUsage_bytes() const;
+
+ private:
+  static const size_t kStateSize = 6;  //!< Number of components of the state
+
+  double start_time_s_;                         //!< Start time of the cache [sec]
+  double end_time_s_;                           //!< End time of the cache [sec]
+  double segment_length_s_;                     //!< Length of each segment [sec]
+  size_t number_of_segments_;                   //!< Number of segments
+  size_t number_of_bodies_;                     //!< Number of bodies
+  std::vector<libra::ChebyshevSeries> series_;  //!< Series ordered by segment, body, and component
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_EPHEMERIS_CACHE_HPP_
@@ -5,14 +5,25 @@
 
 #include "global_environment.hpp"
 
+#include <stdexcept>
+#include <string>
+
 #include "setting_file_reader/initialize_file_access.hpp"
+#include "utilities/step_profiler.hpp"
 
 GlobalEnvironment::GlobalEnvironment(const SimulationConfiguration* simulation_configuration) { Initialize(simulation_configuration); }
 
 GlobalEnvironment::~GlobalEnvironment() {
+  if (worker_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(worker_mutex_);
+      is_worker_stopped_ = true;
+    }
+    worker_condition_.notify_all();
+    worker_.join();
+  }
   delete simulation_time_;
   delete celestial_information_;
-  delete hipparcos_catalogue_;
   delete gnss_satellites_;
 }
 
@@ -24,19 +35,81 @@ void GlobalEnvironment::Initialize(const SimulationConfiguration* simulation_con
   // Initialize
   celestial_information_ = InitCelestialInformation(simulation_configuration->initialize_base_file_name_);
   simulation_time_ = InitSimulationTime(simulation_time_ini_path);
-  hipparcos_catalogue_ = InitHipparcosCatalogue(simulation_configuration->initialize_base_file_name_);
+  InitSpkSubset(*celestial_information_, *simulation_time_, simulation_configuration->initialize_base_file_name_);
+  InitEphemerisCache(celestial_information_, *simulation_time_, simulation_configuration->initialize_base_file_name_);
+  hipparcos_catalogue_ = GetSharedHipparcosCatalogue(simulation_configuration->initialize_base_file_name_);
   gnss_satellites_ = InitGnssSatellites(simulation_configuration->gnss_file_, celestial_information_->GetEarthRotation(), *simulation_time_);
 
   // Calc initial value
   celestial_information_->UpdateAllObjectsInformation(*simulation_time_);
+
+  if (simulation_configuration->is_global_environment_updated_concurrently_) {
+    worker_ = std::thread(&GlobalEnvironment::RunWorker, this);
+  }
 }
 
 void GlobalEnvironment::Update() {
+  static const size_t profile_section_id = StepProfiler::RegisterSection("GlobalEnvironment::Update");
+  ScopedProfileTimer timer(profile_section_id);
   simulation_time_->UpdateTime();
-  celestial_information_->UpdateAllObjectsInformation(*simulation_time_);
+  if (!worker_.joinable()) {
+    celestial_information_->UpdateBodyStates(*simulation_time_);
+    UpdateIndependentStates();
+    return;
+  }
+
+  // Start the independent updates in the worker thread
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    worker_exception_ = nullptr;
+    is_worker_requested_ = true;
+  }
+  worker_condition_.notify_all();
+
+  // SPICE is not thread safe, so the body orbits and the moon rotation are always updated in the calling thread
+  std::exception_ptr exception = nullptr;
+  try {
+    celestial_information_->UpdateBodyStates(*simulation_time_);
+  } catch (...) {
+    exception = std::current_exception();
+  }
+
+  // Wait for the completion since all spacecraft read the global environment
+  {
+    std::unique_lock<std::mutex> lock(worker_mutex_);
+    worker_condition_.wait(lock, [this] { return !is_worker_requested_; });
+    if (exception == nullptr) exception = worker_exception_;
+  }
+  if (exception != nullptr) std::rethrow_exception(exception);
+}
+
+void GlobalEnvironment::UpdateIndependentStates() {
+  celestial_information_->UpdateEarthRotation(simulation_time_->GetCurrentTime_jd());
   gnss_satellites_->Update(*simulation_time_);
 }
 
+void GlobalEnvironment::RunWorker() {
+  while (true) {
+    std::unique_lock<std::mutex> lock(worker_mutex_);
+    worker_condition_.wait(lock, [this] { return is_worker_stopped_ || is_worker_requested_; });
+    if (is_worker_stopped_) return;
+    lock.unlock();
+
+    std::exception_ptr exception = nullptr;
+    try {
+      UpdateIndependentStates();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+
+    lock.lock();
+    worker_exception_ = exception;
+    is_worker_requested_ = false;
+    lock.unlock();
+    worker_condition_.notify_all();
+  }
+}
+
 void GlobalEnvironment::LogSetup(Logger& logger) {
   logger.AddLogList(simulation_time_);
   logger.AddLogList(celestial_information_);
@@ -44,3 +117,37 @@ void GlobalEnvironment::LogSetup(Logger& logger) {
 }
 
 void GlobalEnvironment::Reset(void) { simulation_time_->ResetClock(); }
+
+void GlobalEnvironment::SaveSnapshot(SnapshotWriter& snapshot) const { simulation_time_->SaveSnapshot(snapshot); }
+
+void GlobalEnvironment::LoadSnapshot(SnapshotReader& snapshot) {
+  simulation_time_->LoadSnapshot(snapshot);
+  celestial_information_->UpdateAllObjectsInformation(*simulation_time_);
+  gnss_satellites_->Update(*simulation_time_);
+}
+
+void GlobalEnvironment::SaveReplayFrame(SnapshotWriter& frame) const {
+  frame.Write(simulation_time_->GetElapsedTime_s());
+  celestial_information_->SaveSnapshot(frame);
+}
+
+void GlobalEnvironment::UpdateWithReplayFrame(SnapshotReader& frame) {
+  simulation_time_->UpdateTime();
+  double elapsed_time_s;
+  frame.Read(elapsed_time_s);
+  if (elapsed_time_s != simulation_time_->GetElapsedTime_s()) {
+    throw std::invalid_argument("Replay frame is recorded at " + std::to_string(elapsed_time_s) + " s, but the simulation is at " +
+                                std::to_string(simulation_time_->GetElapsedTime_s()) + " s. The time settings must be the same as the record.");
+  }
+  celestial_information_->LoadSnapshot(frame);
+  gnss_satellites_->Update(*simulation_time_);
+}
+
+MemoryUsage GlobalEnvironment::GetMemoryUsage() const {
+  MemoryUsage memory_usage("GlobalEnvironment", sizeof(*this));
+  memory_usage.AddChild(MemoryUsage("SimulationTime", sizeof(SimulationTime)));
+  memory_usage.AddChild(celestial_information_->GetMemoryUsage());
+  memory_usage.AddChild(MemoryUsage("HipparcosCatalogue", 0, hipparcos_catalogue_->GetMemoryUsage_bytes()));
+  memory_usage.AddChild(MemoryUsage("GnssSatellites", gnss_satellites_->GetMemoryUsage_bytes()));
+  return memory_usage;
+}
@@ -6,6 +6,11 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_GLOBAL_ENVIRONMENT_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_GLOBAL_ENVIRONMENT_HPP_
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "celestial_information.hpp"
 #include "gnss_satellites.hpp"
 #include "hipparcos_catalogue.hpp"
@@ -16,6 +21,8 @@
 /**
  * @class GlobalEnvironment
  * @brief Class to manage the global environment
+ * @details After the time update, the orbits of the celestial bodies and the moon rotation are updated in the calling thread, and the
+ *          earth rotation and the GNSS satellites can be updated concurrently in a worker thread since they do not depend on each other.
  */
 class GlobalEnvironment {
  public:
@@ -52,6 +59,38 @@ class GlobalEnvironment {
    * @brief Reset clock of SimulationTime
    */
   void Reset(void);
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the global environment to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the states of the global environment from the snapshot
+   * @note The celestial information and the GNSS satellites are recalculated at the restored time.
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+  /**
+   * @fn SaveReplayFrame
+   * @brief Write the updated states of the current step to the frame of the environment replay
+   * @param [out] frame: Frame writer
+   */
+  void SaveReplayFrame(SnapshotWriter& frame) const;
+  /**
+   * @fn UpdateWithReplayFrame
+   * @brief Update the time and restore the celestial information from the frame recorded by SaveReplayFrame instead of Update
+   * @note SPICE and the earth rotation are not calculated. The GNSS satellites are calculated from the time as Update.
+   * @param [in] frame: Frame reader
+   */
+  void UpdateWithReplayFrame(SnapshotReader& frame);
+
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the global environment. The Hipparcos catalogue is reported as the shared memory.
+   */
+  MemoryUsage GetMemoryUsage() const;
 
   // Getter
   /**
@@ -76,10 +115,29 @@ class GlobalEnvironment {
   inline const GnssSatellites& GetGnssSatellites() const { return *gnss_satellites_; }
 
  private:
-  SimulationTime* simulation_time_;              //!< Simulation time
-  CelestialInformation* celestial_information_;  //!< Celestial bodies information
-  HipparcosCatalogue* hipparcos_catalogue_;      //!< Hipparcos catalogue
-  GnssSatellites* gnss_satellites_;              //!< GNSS satellites
+  SimulationTime* simulation_time_;                                //!< Simulation time
+  CelestialInformation* celestial_information_;                    //!< Celestial bodies information
+  std::shared_ptr<const HipparcosCatalogue> hipparcos_catalogue_;  //!< Hipparcos catalogue shared between the instances with the same setting
+  GnssSatellites* gnss_satellites_;                                //!< GNSS satellites
+
+  // Concurrent update
+  std::thread worker_;                             //!< Worker thread for the earth rotation and the GNSS satellites
+  std::mutex worker_mutex_;                        //!< Mutex for the following states
+  std::condition_variable worker_condition_;       //!< Condition to notify the request and the completion
+  bool is_worker_requested_ = false;               //!< Flag of the requested update
+  bool is_worker_stopped_ = false;                 //!< Flag to stop the worker
+  std::exception_ptr worker_exception_ = nullptr;  //!< Exception thrown in the requested update
+
+  /**
+   * @fn UpdateIndependentStates
+   * @brief Update the earth rotation and the GNSS satellites which are independent of the celestial body orbits
+   */
+  void UpdateIndependentStates();
+  /**
+   * @fn RunWorker
+   * @brief Main loop of the worker thread
+   */
+  void RunWorker();
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_GLOBAL_ENVIRONMENT_HPP_
@@ -5,6 +5,12 @@
 
 #include "gnss_satellites.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <thread>
+
 #include <math_physics/gnss/igs_product_name_handling.hpp>
 #include <math_physics/gnss/sp3_file_reader.hpp>
 
@@ -16,6 +22,7 @@
 #include "utilities/macros.hpp"
 
 const size_t kNumberOfInterpolation = 9;
+const double kOrbitalPeriodCorrection_s = 24 * 60 * 60 * 1.003;  // See http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf
 
 void GnssSatellites::Initialize(const std::vector<Sp3FileReader>& sp3_files, const EpochTime start_time) {
   sp3_files_ = sp3_files;
@@ -30,6 +37,7 @@ void GnssSatellites::Initialize(const std::vector<Sp3FileReader>& sp3_files, con
 
   // Get general info
   number_of_calculated_gnss_satellites_ = initial_sp3_file.GetNumberOfSatellites();
+  satellite_numbers_ = initial_sp3_file.GetHeader().satellite_ids_;
   const size_t nearest_epoch_id = initial_sp3_file.SearchNearestEpochId(start_time);
   const size_t half_interpolation_number = kNumberOfInterpolation / 2;
   if (nearest_epoch_id >= half_interpolation_number) {
@@ -38,7 +46,10 @@ void GnssSatellites::Initialize(const std::vector<Sp3FileReader>& sp3_files, con
   reference_time_ = EpochTime(initial_sp3_file.GetEpochData(reference_interpolation_id_));
 
   // Initialize orbit
-  orbit_.assign(number_of_calculated_gnss_satellites_, InterpolationOrbit(kNumberOfInterpolation));
+  // The weights of the trigonometric interpolation are computed when the data is pushed, so the receivers read the orbits concurrently
+  InterpolationOrbit initial_orbit(kNumberOfInterpolation);
+  initial_orbit.SetTrigonometricPeriod(libra::tau / kOrbitalPeriodCorrection_s);
+  orbit_.assign(number_of_calculated_gnss_satellites_, initial_orbit);
 
   // Initialize clock
   std::vector<double> temp;
@@ -57,10 +68,7 @@ void GnssSatellites::Update(const SimulationTime& simulation_time) {
   if (!IsCalcEnabled()) return;
 
   // Get time
-  UTC current_utc = simulation_time.GetCurrentUtc();
-  DateTime current_date_time((size_t)current_utc.year, (size_t)current_utc.month, (size_t)current_utc.day, (size_t)current_utc.hour,
-                             (size_t)current_utc.minute, current_utc.second);
-  current_epoch_time_ = EpochTime(current_date_time);
+  current_epoch_time_ = simulation_time.GetCurrentEpochTime();
 
   // Check interpolation update
   double diff_s = current_epoch_time_.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
@@ -69,9 +77,77 @@ void GnssSatellites::Update(const SimulationTime& simulation_time) {
     UpdateInterpolationInformation();
   }
 
+  // The window keeps the margin for the signal transmission time
+  if (IsStateTableEnabled() && !state_table_.IsInRange(diff_s + state_table_step_s_)) {
+    UpdateStateTable();
+  }
+
   return;
 }
 
+void GnssSatellites::SetStateTable(const double step_s, const double window_s) {
+  state_table_.Clear();
+  state_table_step_s_ = 0.0;
+  if (step_s <= 0.0 || !IsCalcEnabled() || orbit_.empty()) return;
+
+  // The interpolation is updated when the time passes the middle of the SP3 epochs, so the later half is available for the window
+  const std::vector<double>& time_list_s = orbit_[0].GetTimeList();
+  const double max_window_s = (time_list_s[kNumberOfInterpolation - 1] - time_list_s[kNumberOfInterpolation / 2]) - 4.0 * step_s;
+  state_table_step_s_ = step_s;
+  state_table_window_s_ = window_s;
+  if (state_table_window_s_ > max_window_s) {
+    std::cerr << "[WARNINGS] GNSS satellites: the window of the state table is limited to " << max_window_s << " s." << std::endl;
+    state_table_window_s_ = max_window_s;
+  }
+  if (state_table_window_s_ < 2.0 * step_s) {
+    std::cerr << "[WARNINGS] GNSS satellites: the window of the state table is too short. The state table is disabled." << std::endl;
+    state_table_step_s_ = 0.0;
+    return;
+  }
+  UpdateStateTable();
+}
+
+void GnssSatellites::UpdateStateTable() {
+  const double current_time_s = current_epoch_time_.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
+  const size_t number_of_steps = (size_t)(state_table_window_s_ / state_table_step_s_);
+  auto sampler = [this](const size_t gnss_satellite_id, const double diff_s, libra::Vector<3>& position_ecef_m, double& clock_offset_s) {
+    if (diff_s < 0.0 || diff_s > 1e6) return false;
+    position_ecef_m = CalcPosition_ecef_m(gnss_satellite_id, diff_s);
+    clock_offset_s = CalcClock_s(gnss_satellite_id, diff_s);
+    return true;
+  };
+  // The first sample is one step before the current time for the signal transmission time
+  state_table_.Build(current_time_s - state_table_step_s_, state_table_step_s_, number_of_steps, number_of_calculated_gnss_satellites_, sampler);
+}
+
+bool GnssSatellites::CalcStateWithTable(const size_t gnss_satellite_id, const EpochTime time, libra::Vector<3>& position_ecef_m,
+                                        double& clock_offset_s) const {
+  if (!IsStateTableEnabled()) return false;
+  const double diff_s = time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
+  return state_table_.CalcState(gnss_satellite_id, diff_s, position_ecef_m, clock_offset_s);
+}
+
+bool GnssSatellites::CalcPositionArrayWithTable_ecef_m(const EpochTime time, std::vector<double> (&positions_ecef_m)[3]) const {
+  if (!IsStateTableEnabled()) return false;
+  const double diff_s = time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
+  return state_table_.CalcPositionArray_m(diff_s, positions_ecef_m);
+}
+
+bool GnssSatellites::CalcStateArrayWithTable_ecef(const std::vector<size_t>& gnss_satellite_ids, const std::vector<double>& times_s,
+                                                  std::vector<double> (&positions_ecef_m)[3], std::vector<double> (&velocities_ecef_m_s)[3],
+                                                  std::vector<double>& clock_offsets_s, std::vector<double>& clock_drifts_s_s) const {
+  if (!IsStateTableEnabled()) return false;
+  return state_table_.CalcStateArray(gnss_satellite_ids, times_s, positions_ecef_m, velocities_ecef_m_s, clock_offsets_s, clock_drifts_s_s);
+}
+
+libra::Vector<3> GnssSatellites::CalcPosition_ecef_m(const size_t gnss_satellite_id, const double diff_s) const {
+  return orbit_[gnss_satellite_id].CalcPositionWithTrigonometric(diff_s, libra::tau / kOrbitalPeriodCorrection_s);
+}
+
+double GnssSatellites::CalcClock_s(const size_t gnss_satellite_id, const double diff_s) const {
+  return clock_[gnss_satellite_id].CalcPolynomial(diff_s) * 1e-6;
+}
+
 libra::Vector<3> GnssSatellites::GetPosition_ecef_m(const size_t gnss_satellite_id, const EpochTime time) const {
   if (gnss_satellite_id > number_of_calculated_gnss_satellites_) return libra::Vector<3>(0.0);
 
@@ -86,8 +162,34 @@ libra::Vector<3> GnssSatellites::GetPosition_ecef_m(const size_t gnss_satellite_
   double diff_s = target_time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
   if (diff_s < 0.0 || diff_s > 1e6) return libra::Vector<3>(0.0);
 
-  const double kOrbitalPeriodCorrection_s = 24 * 60 * 60 * 1.003;  // See http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf
-  return orbit_[gnss_satellite_id].CalcPositionWithTrigonometric(diff_s, libra::tau / kOrbitalPeriodCorrection_s);
+  return CalcPosition_ecef_m(gnss_satellite_id, diff_s);
+}
+
+void GnssSatellites::CalcPositionArray_eci_m(std::vector<double> (&positions_eci_m)[3]) const {
+  for (size_t axis = 0; axis < 3; axis++) {
+    if (positions_eci_m[axis].size() != number_of_calculated_gnss_satellites_) positions_eci_m[axis].resize(number_of_calculated_gnss_satellites_);
+  }
+
+  const libra::Matrix<3, 3> dcm_ecef_to_eci = earth_rotation_.GetDcmEcefToJ2000();
+  if (CalcPositionArrayWithTable_ecef_m(current_epoch_time_, positions_eci_m)) {
+    // Rotate the table positions in place
+    for (size_t gnss_satellite_id = 0; gnss_satellite_id < number_of_calculated_gnss_satellites_; gnss_satellite_id++) {
+      const double x_m = positions_eci_m[0][gnss_satellite_id];
+      const double y_m = positions_eci_m[1][gnss_satellite_id];
+      const double z_m = positions_eci_m[2][gnss_satellite_id];
+      for (size_t axis = 0; axis < 3; axis++) {
+        positions_eci_m[axis][gnss_satellite_id] = dcm_ecef_to_eci[axis][0] * x_m + dcm_ecef_to_eci[axis][1] * y_m + dcm_ecef_to_eci[axis][2] * z_m;
+      }
+    }
+    return;
+  }
+  for (size_t gnss_satellite_id = 0; gnss_satellite_id < number_of_calculated_gnss_satellites_; gnss_satellite_id++) {
+    const libra::Vector<3> position_ecef_m = GetPosition_ecef_m(gnss_satellite_id);
+    for (size_t axis = 0; axis < 3; axis++) {
+      positions_eci_m[axis][gnss_satellite_id] = dcm_ecef_to_eci[axis][0] * position_ecef_m[0] + dcm_ecef_to_eci[axis][1] * position_ecef_m[1] +
+                                                 dcm_ecef_to_eci[axis][2] * position_ecef_m[2];
+    }
+  }
 }
 
 double GnssSatellites::GetClock_s(const size_t gnss_satellite_id, const EpochTime time) const {
@@ -104,7 +206,7 @@ double GnssSatellites::GetClock_s(const size_t gnss_satellite_id, const EpochTim
   double diff_s = target_time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
   if (diff_s < 0.0 || diff_s > 1e6) return 0.0;
 
-  return clock_[gnss_satellite_id].CalcPolynomial(diff_s) * 1e-6;
+  return CalcClock_s(gnss_satellite_id, diff_s);
 }
 
 bool GnssSatellites::GetCurrentSp3File(Sp3FileReader& current_sp3_file, const EpochTime current_time) {
@@ -124,7 +226,8 @@ bool GnssSatellites::GetCurrentSp3File(Sp3FileReader& current_sp3_file, const Ep
 }
 
 bool GnssSatellites::UpdateInterpolationInformation() {
-  Sp3FileReader sp3_file = sp3_files_[sp3_file_id_];
+  // The reference keeps the decoded window of the file between the updates
+  Sp3FileReader& sp3_file = sp3_files_[sp3_file_id_];
 
   for (size_t gnss_id = 0; gnss_id < number_of_calculated_gnss_satellites_; gnss_id++) {
     EpochTime sp3_time = EpochTime(sp3_file.GetEpochData(reference_interpolation_id_));
@@ -149,6 +252,17 @@ bool GnssSatellites::UpdateInterpolationInformation() {
   return true;
 }
 
+size_t GnssSatellites::GetMemoryUsage_bytes() const {
+  size_t bytes = sizeof(*this) + (sp3_files_.capacity() - sp3_files_.size()) * sizeof(Sp3FileReader);
+  for (const auto& sp3_file : sp3_files_) bytes += sp3_file.GetMemoryUsage_bytes();
+  bytes += (orbit_.capacity() - orbit_.size()) * sizeof(InterpolationOrbit);
+  for (const auto& orbit : orbit_) bytes += orbit.GetMemoryUsage_bytes();
+  bytes += (clock_.capacity() - clock_.size()) * sizeof(libra::Interpolation);
+  for (const auto& clock : clock_) bytes += clock.GetMemoryUsage_bytes();
+  bytes += state_table_.GetMemoryUsage_bytes() - sizeof(GnssSatelliteStateTable);
+  return bytes;
+}
+
 std::string GnssSatellites::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -188,6 +302,7 @@ GnssSatellites* InitGnssSatellites(const std::string file_name, const EarthRotat
   const std::string file_name_header = ini_file.ReadString(section, "file_name_header");
   const std::string orbit_data_period = ini_file.ReadString(section, "orbit_data_period");
   const std::string clock_file_name_footer = ini_file.ReadString(section, "clock_file_name_footer");
+  const bool use_binary_cache = ini_file.ReadEnable(section, "binary_cache");
   bool use_sp3_for_clock = false;
   if (clock_file_name_footer == (orbit_data_period + "_ORB.SP3")) {
     use_sp3_for_clock = true;
@@ -200,16 +315,12 @@ GnssSatellites* InitGnssSatellites(const std::string file_name, const EarthRotat
     std::cout << "[ERROR] GNSS satellite initialize: start_date is larger than the end date." << std::endl;
   }
 
-  // Read all product files
-  std::vector<Sp3FileReader> sp3_file_readers;
-
+  // List all product files in the date order
+  std::vector<std::string> sp3_full_file_paths;
   size_t read_file_date = start_date;
   while (read_file_date <= end_date) {
     std::string sp3_file_name = GetOrbitClockFinalFileName(file_name_header, read_file_date, orbit_data_period);
-    std::string sp3_full_file_path = directory_path + sp3_file_name;
-
-    // Read SP3
-    sp3_file_readers.push_back(Sp3FileReader(sp3_full_file_path));
+    sp3_full_file_paths.push_back(directory_path + sp3_file_name);
 
     // Clock file
     if (!use_sp3_for_clock) {
@@ -223,11 +334,57 @@ GnssSatellites* InitGnssSatellites(const std::string file_name, const EarthRotat
     read_file_date = IncrementYearDoy(read_file_date);
   }
 
+  // Read all product files
+  // Each thread takes the next file and writes only the slot of the file, so the readers are kept in the date order without a lock
+  const size_t number_of_files = sp3_full_file_paths.size();
+  std::vector<std::unique_ptr<Sp3FileReader>> sp3_file_slots(number_of_files);
+  std::atomic<size_t> next_file_id(0);
+  auto read_sp3_files = [&]() {
+    for (size_t file_id = next_file_id++; file_id < number_of_files; file_id = next_file_id++) {
+      const std::string& sp3_full_file_path = sp3_full_file_paths[file_id];
+      if (use_binary_cache) {
+        // The binary file is generated at the first run and reused without the text decoding until the SP3 file is changed
+        const std::string binary_file_path = sp3_full_file_path + ".bin";
+        if (!Sp3FileReader::IsBinaryFileUpToDate(binary_file_path, sp3_full_file_path)) {
+          Sp3FileReader sp3_text_file(sp3_full_file_path);
+          sp3_text_file.WriteBinaryFile(binary_file_path);
+        }
+        sp3_file_slots[file_id].reset(new Sp3FileReader(binary_file_path));
+      } else {
+        sp3_file_slots[file_id].reset(new Sp3FileReader(sp3_full_file_path));
+      }
+    }
+  };
+
+  int number_of_threads = ini_file.ReadInt(section, "number_of_loading_threads");
+  if (number_of_threads < 0) {
+    number_of_threads = (int)std::thread::hardware_concurrency();
+  }
+  const size_t number_of_workers = std::min((size_t)std::max(number_of_threads, 1), std::max(number_of_files, (size_t)1));
+  if (number_of_workers <= 1) {
+    read_sp3_files();
+  } else {
+    std::vector<std::thread> threads;
+    for (size_t worker_id = 0; worker_id < number_of_workers; worker_id++) {
+      threads.emplace_back(read_sp3_files);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::vector<Sp3FileReader> sp3_file_readers;
+  sp3_file_readers.reserve(number_of_files);
+  for (auto& sp3_file : sp3_file_slots) {
+    sp3_file_readers.push_back(std::move(*sp3_file));
+  }
+
   //
   DateTime start_date_time((size_t)simulation_time.GetStartYear(), (size_t)simulation_time.GetStartMonth(), (size_t)simulation_time.GetStartDay(),
                            (size_t)simulation_time.GetStartHour(), (size_t)simulation_time.GetStartMinute(), simulation_time.GetStartSecond());
   EpochTime start_epoch_time(start_date_time);
   gnss_satellites->Initialize(sp3_file_readers, start_epoch_time);
+  gnss_satellites->SetStateTable(ini_file.ReadDouble(section, "state_table_step_s"), ini_file.ReadDouble(section, "state_table_window_s"));
 
   return gnss_satellites;
 }
@@ -7,6 +7,7 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_GNSS_SATELLITES_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_GNSS_SATELLITES_HPP_
 
+#include <math_physics/gnss/gnss_satellite_state_table.hpp>
 #include <math_physics/gnss/sp3_file_reader.hpp>
 #include <math_physics/math/constants.hpp>
 #include <math_physics/math/matrix_vector.hpp>
@@ -77,9 +78,76 @@ class GnssSatellites : public ILoggable {
 
   inline libra::Vector<3> GetPosition_eci_m(const size_t gnss_satellite_id) const {
     // TODO: Add target time for earth rotation calculation
-    return earth_rotation_.GetDcmJ2000ToEcef().Transpose() * GetPosition_ecef_m(gnss_satellite_id);
+    return earth_rotation_.GetDcmEcefToJ2000() * GetPosition_ecef_m(gnss_satellite_id);
   }
 
+  /**
+   * @fn CalcPositionArray_eci_m
+   * @brief Calculate the positions of all calculated GNSS satellites at the ECI frame at the last updated time
+   * @note The DCM from ECEF to ECI is computed once for all satellites
+   * @param [out] positions_eci_m: Positions for each axis [m]. The arrays are resized only when the number of satellites is changed.
+   */
+  void CalcPositionArray_eci_m(std::vector<double> (&positions_eci_m)[3]) const;
+
+  /**
+   * @fn SetStateTable
+   * @brief Enable the state table of all satellites sampled at a fixed cadence in a moving window
+   * @note The table is rebuilt in Update when the window is passed. The window is limited in the range of the SP3 interpolation.
+   * @param [in] step_s: Interval of the samples [s]. Zero disables the table.
+   * @param [in] window_s: Length of the window [s]
+   */
+  void SetStateTable(const double step_s, const double window_s);
+  /**
+   * @fn IsStateTableEnabled
+   * @brief Return true when the state table is enabled
+   */
+  inline bool IsStateTableEnabled() const { return state_table_step_s_ > 0.0; }
+  /**
+   * @fn IsValidInStateTable
+   * @brief Return true when the state table is enabled and the states of the GNSS satellite are available in the window
+   * @param [in] gnss_satellite_id: ID of GNSS satellite
+   */
+  inline bool IsValidInStateTable(const size_t gnss_satellite_id) const { return IsStateTableEnabled() && state_table_.IsValid(gnss_satellite_id); }
+  /**
+   * @fn CalcStateWithTable
+   * @brief Calculate the position and the clock offset of a GNSS satellite at any time in the window with the state table
+   * @note The cubic Hermite interpolation of the table is cheap enough for the iterations of the signal transmission time.
+   * @param [in] gnss_satellite_id: ID of GNSS satellite
+   * @param [in] time: Target time
+   * @param [out] position_ecef_m: GNSS satellite position at ECEF frame [m]
+   * @param [out] clock_offset_s: GNSS satellite clock offset [s]
+   * @return False when the table is disabled, or the arguments are out of range. The outputs are not modified in this case.
+   */
+  bool CalcStateWithTable(const size_t gnss_satellite_id, const EpochTime time, libra::Vector<3>& position_ecef_m, double& clock_offset_s) const;
+  /**
+   * @fn CalcPositionArrayWithTable_ecef_m
+   * @brief Calculate the positions of all calculated GNSS satellites at the ECEF frame at any time in the window with the state table
+   * @param [in] time: Target time
+   * @param [out] positions_ecef_m: Positions for each axis [m]. The arrays are resized only when the number of satellites is changed.
+   * @return False when the table is disabled, or the time is out of range. The outputs are not modified in this case.
+   */
+  bool CalcPositionArrayWithTable_ecef_m(const EpochTime time, std::vector<double> (&positions_ecef_m)[3]) const;
+  /**
+   * @fn GetStateTableTime_s
+   * @brief Return the time of the state table, which is measured from the reference time [s]
+   * @param [in] time: Target time
+   */
+  inline double GetStateTableTime_s(const EpochTime time) const { return time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s(); }
+  /**
+   * @fn CalcStateArrayWithTable_ecef
+   * @brief Calculate the states of the listed GNSS satellites at their own times at the ECEF frame with the state table
+   * @param [in] gnss_satellite_ids: IDs of GNSS satellites
+   * @param [in] times_s: Time of the state table for each listed satellite [s] (See GetStateTableTime_s)
+   * @param [out] positions_ecef_m: Positions for each axis [m]
+   * @param [out] velocities_ecef_m_s: Velocities for each axis [m/s]
+   * @param [out] clock_offsets_s: Clock offsets [s]
+   * @param [out] clock_drifts_s_s: Clock drifts [s/s]
+   * @return False when the table is disabled, or the arguments are out of range. The outputs are not modified in this case.
+   */
+  bool CalcStateArrayWithTable_ecef(const std::vector<size_t>& gnss_satellite_ids, const std::vector<double>& times_s,
+                                    std::vector<double> (&positions_ecef_m)[3], std::vector<double> (&velocities_ecef_m_s)[3],
+                                    std::vector<double>& clock_offsets_s, std::vector<double>& clock_drifts_s_s) const;
+
   /**
    * @fn GetPosition_ecef_m
    * @brief Return GNSS satellite position at ECEF frame
@@ -98,6 +166,27 @@ class GnssSatellites : public ILoggable {
    */
   double GetClock_s(const size_t gnss_satellite_id, const EpochTime time = EpochTime(0, 0.0)) const;
 
+  /**
+   * @fn GetSatelliteNumber
+   * @brief Return the GNSS satellite number in the SP3 file (e.g. G01)
+   * @param [in] gnss_satellite_id: ID of GNSS satellite
+   */
+  inline std::string GetSatelliteNumber(const size_t gnss_satellite_id) const {
+    if (gnss_satellite_id >= satellite_numbers_.size()) return "";
+    return satellite_numbers_[gnss_satellite_id];
+  }
+  /**
+   * @fn GetEarthRotation
+   * @brief Return the Earth rotation used for the frame conversion of the GNSS satellites
+   */
+  inline const EarthRotation& GetEarthRotation() const { return earth_rotation_; }
+
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @brief Return the memory of the SP3 files and the interpolations [bytes]
+   */
+  size_t GetMemoryUsage_bytes() const;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -113,16 +202,21 @@ class GnssSatellites : public ILoggable {
  private:
   bool is_calc_enabled_ = false;  //!< Flag to manage the GNSS satellite position calculation
 
-  std::vector<Sp3FileReader> sp3_files_;         //!< List of SP3 files
-  size_t number_of_calculated_gnss_satellites_;  //!< Number of calculated GNSS satellites
-  size_t sp3_file_id_;                           //!< Current SP3 file ID
-  EpochTime reference_time_;                     //!< Reference start time of the SP3 handling
-  size_t reference_interpolation_id_ = 0;        //!< Reference epoch ID of the interpolation
-  EpochTime current_epoch_time_;                 //!< The last updated time
+  std::vector<Sp3FileReader> sp3_files_;             //!< List of SP3 files (Only the window of the epochs is decoded in each file)
+  size_t number_of_calculated_gnss_satellites_ = 0;  //!< Number of calculated GNSS satellites
+  std::vector<std::string> satellite_numbers_;       //!< GNSS satellite numbers in the SP3 file
+  size_t sp3_file_id_;                               //!< Current SP3 file ID
+  EpochTime reference_time_;                         //!< Reference start time of the SP3 handling
+  size_t reference_interpolation_id_ = 0;            //!< Reference epoch ID of the interpolation
+  EpochTime current_epoch_time_;                     //!< The last updated time
 
   std::vector<InterpolationOrbit> orbit_;    //!< GNSS satellite orbit with interpolation
   std::vector<libra::Interpolation> clock_;  //!< GNSS satellite clock offset with interpolation
 
+  GnssSatelliteStateTable state_table_;  //!< State table in the moving window. The time is measured from the reference time.
+  double state_table_step_s_ = 0.0;      //!< Interval of the samples of the state table [s]
+  double state_table_window_s_ = 0.0;    //!< Length of the window of the state table [s]
+
   // References
   const EarthRotation& earth_rotation_;  //!< Earth rotation
 
@@ -141,6 +235,27 @@ class GnssSatellites : public ILoggable {
    * @return true: No error, false: SP3 file out of range error
    */
   bool UpdateInterpolationInformation();
+  /**
+   * @fn UpdateStateTable
+   * @brief Rebuild the state table from the current time
+   */
+  void UpdateStateTable();
+  /**
+   * @fn CalcPosition_ecef_m
+   * @brief Calculate GNSS satellite position at ECEF frame with the SP3 interpolation
+   * @param [in] gnss_satellite_id: ID of GNSS satellite
+   * @param [in] diff_s: Time from the reference time [s]
+   * @return GNSS satellite position at ECEF frame. Or return zero vector when the time is out of range.
+   */
+  libra::Vector<3> CalcPosition_ecef_m(const size_t gnss_satellite_id, const double diff_s) const;
+  /**
+   * @fn CalcClock_s
+   * @brief Calculate GNSS satellite clock offset with the SP3 interpolation
+   * @param [in] gnss_satellite_id: ID of GNSS satellite
+   * @param [in] diff_s: Time from the reference time [s]
+   * @return GNSS satellite clock offset. Or return zero when the time is out of range.
+   */
+  double CalcClock_s(const size_t gnss_satellite_id, const double diff_s) const;
 };
 
 /**
@@ -5,23 +5,52 @@
 #include "hipparcos_catalogue.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "math_physics/gravity/gravity_coefficients_cache.hpp"
 #include "math_physics/math/constants.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
+#include "utilities/memory_usage.hpp"
+#include "utilities/shared_data_registry.hpp"
+
+namespace {
+const char kCacheMagic[8] = {'S', '2', 'E', 'H', 'I', 'P', '\0', '\0'};  //!< Identifier of the cache file
+const uint32_t kCacheVersion = 1;                                         //!< Version of the cache file format
+
+/**
+ * @struct CacheHeader
+ * @brief Header of the cache file
+ */
+struct CacheHeader {
+  char magic_[8];             //!< Identifier of the cache file
+  uint32_t version_;          //!< Version of the cache file format
+  uint32_t number_of_stars_;  //!< Number of stars
+  uint64_t source_checksum_;  //!< Checksum of the source catalogue file
+  double max_magnitude_;      //!< Maximum magnitude used to read the source catalogue file
+};
+}  // namespace
+
+std::string GetHipparcosCatalogueCachePath(const std::string& catalogue_file_path) { return catalogue_file_path + ".s2ecache"; }
 
 HipparcosCatalogue::HipparcosCatalogue(double max_magnitude, std::string catalogue_path)
     : max_magnitude_(max_magnitude), catalogue_path_(catalogue_path) {}
 
 HipparcosCatalogue::~HipparcosCatalogue() {}
 
-bool HipparcosCatalogue::ReadContents(const std::string& file_name, const char delimiter = ',') {
+bool HipparcosCatalogue::ReadContents(const std::string& file_name, const char delimiter = ',', const bool is_cache_enabled) {
   if (!IsCalcEnabled) return false;
 
+  if (is_cache_enabled && ReadCache(file_name)) {
+    BuildSkyCellIndex();
+    return true;
+  }
+
   std::ifstream ifs(file_name);
   if (!ifs.is_open()) {
     std::cerr << "file open error(hip_main.csv)";
@@ -30,35 +59,33 @@ bool HipparcosCatalogue::ReadContents(const std::string& file_name, const char d
 
   std::string title;
   ifs >> title;  // Skip title
-  while (!ifs.eof()) {
+  std::string line;
+  while (ifs >> line) {
     HipparcosData hipparcos_data;
 
-    std::string line;
-    ifs >> line;
     std::replace(line.begin(), line.end(), delimiter, ' ');  // Convert delimiter as space for stringstream
     std::istringstream streamline(line);
 
     streamline >> hipparcos_data.hipparcos_id >> hipparcos_data.visible_magnitude >> hipparcos_data.right_ascension_deg >>
         hipparcos_data.declination_deg;
+    if (!streamline) continue;
 
     if (hipparcos_data.visible_magnitude > max_magnitude_) {
-      return true;
+      break;
     }  // Don't read stars darker than max_magnitude
-    hipparcos_catalogue_.push_back(hipparcos_data);
+    AddStar(hipparcos_data);
   }
 
+  if (is_cache_enabled) WriteCache(file_name);
+  BuildSkyCellIndex();
   return true;
 }
 
 libra::Vector<3> HipparcosCatalogue::GetStarDirection_i(size_t rank) const {
   libra::Vector<3> direction_i;
-  double ra_rad = GetRightAscension_deg(rank) * libra::deg_to_rad;
-  double de_rad = GetDeclination_deg(rank) * libra::deg_to_rad;
-
-  direction_i[0] = cos(ra_rad) * cos(de_rad);
-  direction_i[1] = sin(ra_rad) * cos(de_rad);
-  direction_i[2] = sin(de_rad);
-
+  direction_i[0] = direction_x_i_list_[rank];
+  direction_i[1] = direction_y_i_list_[rank];
+  direction_i[2] = direction_z_i_list_[rank];
   return direction_i;
 }
 
@@ -72,6 +99,177 @@ libra::Vector<3> HipparcosCatalogue::GetStarDirection_b(size_t rank, libra::Quat
   return direction_b;
 }
 
+void HipparcosCatalogue::FindStarsInCone(const libra::Vector<3>& center_direction_i, const double half_angle_rad, std::vector<size_t>& ranks) const {
+  ranks.clear();
+  if (hipparcos_id_list_.empty()) return;
+
+  const double cos_half_angle = cos(half_angle_rad);
+  const double center_declination_rad = asin(std::clamp(center_direction_i[2], -1.0, 1.0));
+  const double center_right_ascension_rad = atan2(center_direction_i[1], center_direction_i[0]);
+  const double min_declination_rad = center_declination_rad - half_angle_rad;
+  const double max_declination_rad = center_declination_rad + half_angle_rad;
+  // Half width of the right ascension covered by the cone. All cells are searched when the cone includes a pole.
+  bool is_all_right_ascension = half_angle_rad >= libra::pi_2 || min_declination_rad <= -libra::pi_2 || max_declination_rad >= libra::pi_2;
+  double right_ascension_half_width_rad = libra::pi;
+  if (!is_all_right_ascension) {
+    right_ascension_half_width_rad = asin(std::min(sin(half_angle_rad) / cos(center_declination_rad), 1.0));
+  }
+  if (right_ascension_half_width_rad >= libra::pi) is_all_right_ascension = true;
+
+  const size_t number_of_bands = GetNumberOfBands();
+  const double band_width_rad = libra::pi / (double)number_of_bands;
+  const size_t first_band = (size_t)std::clamp((min_declination_rad + libra::pi_2) / band_width_rad, 0.0, (double)(number_of_bands - 1));
+  const size_t last_band = (size_t)std::clamp((max_declination_rad + libra::pi_2) / band_width_rad, 0.0, (double)(number_of_bands - 1));
+  for (size_t band = first_band; band <= last_band; band++) {
+    const size_t number_of_cells = band_cell_offsets_[band + 1] - band_cell_offsets_[band];
+    size_t first_cell = 0;
+    size_t cell_count = number_of_cells;
+    if (!is_all_right_ascension) {
+      first_cell = CalcCellIndex(band, center_right_ascension_rad - right_ascension_half_width_rad) - band_cell_offsets_[band];
+      const double cell_width_rad = libra::tau / (double)number_of_cells;
+      cell_count = std::min((size_t)ceil(2.0 * right_ascension_half_width_rad / cell_width_rad) + 1, number_of_cells);
+    }
+    for (size_t i = 0; i < cell_count; i++) {
+      const size_t cell = band_cell_offsets_[band] + (first_cell + i) % number_of_cells;
+      for (size_t j = cell_star_offsets_[cell]; j < cell_star_offsets_[cell + 1]; j++) {
+        const size_t rank = cell_star_ranks_[j];
+        const double inner_product = direction_x_i_list_[rank] * center_direction_i[0] + direction_y_i_list_[rank] * center_direction_i[1] +
+                                     direction_z_i_list_[rank] * center_direction_i[2];
+        if (inner_product >= cos_half_angle) ranks.push_back(rank);
+      }
+    }
+  }
+  std::sort(ranks.begin(), ranks.end());
+}
+
+void HipparcosCatalogue::AddStar(const HipparcosData& hipparcos_data) {
+  hipparcos_id_list_.push_back(hipparcos_data.hipparcos_id);
+  visible_magnitude_list_.push_back(hipparcos_data.visible_magnitude);
+  right_ascension_deg_list_.push_back(hipparcos_data.right_ascension_deg);
+  declination_deg_list_.push_back(hipparcos_data.declination_deg);
+
+  double ra_rad = hipparcos_data.right_ascension_deg * libra::deg_to_rad;
+  double de_rad = hipparcos_data.declination_deg * libra::deg_to_rad;
+  direction_x_i_list_.push_back(cos(ra_rad) * cos(de_rad));
+  direction_y_i_list_.push_back(sin(ra_rad) * cos(de_rad));
+  direction_z_i_list_.push_back(sin(de_rad));
+}
+
+size_t HipparcosCatalogue::GetMemoryUsage_bytes() const {
+  size_t bytes = sizeof(*this) + CalcHeapMemory_bytes(hipparcos_id_list_) + CalcHeapMemory_bytes(catalogue_path_);
+  bytes += CalcHeapMemory_bytes(visible_magnitude_list_) + CalcHeapMemory_bytes(right_ascension_deg_list_);
+  bytes += CalcHeapMemory_bytes(declination_deg_list_);
+  bytes += CalcHeapMemory_bytes(direction_x_i_list_) + CalcHeapMemory_bytes(direction_y_i_list_) + CalcHeapMemory_bytes(direction_z_i_list_);
+  bytes += CalcHeapMemory_bytes(band_cell_offsets_) + CalcHeapMemory_bytes(cell_star_offsets_) + CalcHeapMemory_bytes(cell_star_ranks_);
+  return bytes;
+}
+
+bool HipparcosCatalogue::ReadCache(const std::string& file_name) {
+  std::ifstream cache_file(GetHipparcosCatalogueCachePath(file_name), std::ios::binary);
+  if (!cache_file.is_open()) return false;
+
+  CacheHeader header;
+  cache_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!cache_file) return false;
+  if (std::memcmp(header.magic_, kCacheMagic, sizeof(kCacheMagic)) != 0) return false;
+  if (header.version_ != kCacheVersion) return false;
+  if (header.max_magnitude_ != max_magnitude_) return false;
+
+  uint64_t source_checksum;
+  if (!CalcFileChecksum(file_name, source_checksum)) return false;
+  if (header.source_checksum_ != source_checksum) return false;
+
+  // Each array is stored contiguously, so it is read at once
+  const size_t size = (size_t)header.number_of_stars_;
+  hipparcos_id_list_.resize(size);
+  visible_magnitude_list_.resize(size);
+  right_ascension_deg_list_.resize(size);
+  declination_deg_list_.resize(size);
+  direction_x_i_list_.resize(size);
+  direction_y_i_list_.resize(size);
+  direction_z_i_list_.resize(size);
+  std::vector<int32_t> hipparcos_id_list(size);
+  cache_file.read(reinterpret_cast<char*>(hipparcos_id_list.data()), size * sizeof(int32_t));
+  for (std::vector<double>* list : {&visible_magnitude_list_, &right_ascension_deg_list_, &declination_deg_list_, &direction_x_i_list_,
+                                    &direction_y_i_list_, &direction_z_i_list_}) {
+    cache_file.read(reinterpret_cast<char*>(list->data()), size * sizeof(double));
+  }
+  std::copy(hipparcos_id_list.begin(), hipparcos_id_list.end(), hipparcos_id_list_.begin());
+  if (!cache_file) {
+    for (std::vector<double>* list : {&visible_magnitude_list_, &right_ascension_deg_list_, &declination_deg_list_, &direction_x_i_list_,
+                                      &direction_y_i_list_, &direction_z_i_list_}) {
+      list->clear();
+    }
+    hipparcos_id_list_.clear();
+    return false;
+  }
+  return true;
+}
+
+bool HipparcosCatalogue::WriteCache(const std::string& file_name) const {
+  CacheHeader header;
+  std::memcpy(header.magic_, kCacheMagic, sizeof(kCacheMagic));
+  header.version_ = kCacheVersion;
+  header.number_of_stars_ = (uint32_t)hipparcos_id_list_.size();
+  if (!CalcFileChecksum(file_name, header.source_checksum_)) return false;
+  header.max_magnitude_ = max_magnitude_;
+
+  const std::string cache_file_path = GetHipparcosCatalogueCachePath(file_name);
+  std::ofstream cache_file(cache_file_path, std::ios::binary | std::ios::trunc);
+  if (!cache_file.is_open()) {
+    std::cout << "[Warning] Hipparcos catalogue cache file cannot be created: " << cache_file_path << std::endl;
+    return false;
+  }
+  const size_t size = hipparcos_id_list_.size();
+  std::vector<int32_t> hipparcos_id_list(hipparcos_id_list_.begin(), hipparcos_id_list_.end());
+  cache_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  cache_file.write(reinterpret_cast<const char*>(hipparcos_id_list.data()), size * sizeof(int32_t));
+  for (const std::vector<double>* list : {&visible_magnitude_list_, &right_ascension_deg_list_, &declination_deg_list_, &direction_x_i_list_,
+                                          &direction_y_i_list_, &direction_z_i_list_}) {
+    cache_file.write(reinterpret_cast<const char*>(list->data()), size * sizeof(double));
+  }
+  return (bool)cache_file;
+}
+
+void HipparcosCatalogue::BuildSkyCellIndex() {
+  // Cells
+  const size_t number_of_bands = std::max((size_t)ceil(libra::pi / kCellSize_rad), (size_t)1);
+  const double band_width_rad = libra::pi / (double)number_of_bands;
+  band_cell_offsets_.assign(1, 0);
+  for (size_t band = 0; band < number_of_bands; band++) {
+    const double band_center_declination_rad = -libra::pi_2 + band_width_rad * ((double)band + 0.5);
+    const size_t number_of_cells = std::max((size_t)ceil(libra::tau * cos(band_center_declination_rad) / kCellSize_rad), (size_t)1);
+    band_cell_offsets_.push_back(band_cell_offsets_.back() + number_of_cells);
+  }
+
+  // Sort the ranks into the cells with counting sort to keep the rank order in each cell
+  const size_t catalogue_size = GetCatalogueSize();
+  std::vector<size_t> cell_of_star(catalogue_size);
+  cell_star_offsets_.assign(band_cell_offsets_.back() + 1, 0);
+  for (size_t rank = 0; rank < catalogue_size; rank++) {
+    const double declination_rad = asin(std::clamp(direction_z_i_list_[rank], -1.0, 1.0));
+    const size_t band = std::min((size_t)((declination_rad + libra::pi_2) / band_width_rad), number_of_bands - 1);
+    cell_of_star[rank] = CalcCellIndex(band, atan2(direction_y_i_list_[rank], direction_x_i_list_[rank]));
+    cell_star_offsets_[cell_of_star[rank] + 1]++;
+  }
+  for (size_t cell = 0; cell + 1 < cell_star_offsets_.size(); cell++) {
+    cell_star_offsets_[cell + 1] += cell_star_offsets_[cell];
+  }
+  std::vector<size_t> position(cell_star_offsets_.begin(), cell_star_offsets_.end() - 1);
+  cell_star_ranks_.resize(catalogue_size);
+  for (size_t rank = 0; rank < catalogue_size; rank++) {
+    cell_star_ranks_[position[cell_of_star[rank]]++] = rank;
+  }
+}
+
+size_t HipparcosCatalogue::CalcCellIndex(const size_t band, const double right_ascension_rad) const {
+  const size_t number_of_cells = band_cell_offsets_[band + 1] - band_cell_offsets_[band];
+  double normalized_right_ascension = fmod(right_ascension_rad, libra::tau) / libra::tau;
+  if (normalized_right_ascension < 0.0) normalized_right_ascension += 1.0;
+  const size_t cell = std::min((size_t)(normalized_right_ascension * (double)number_of_cells), number_of_cells - 1);
+  return band_cell_offsets_[band] + cell;
+}
+
 std::string HipparcosCatalogue::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -95,7 +293,18 @@ HipparcosCatalogue* InitHipparcosCatalogue(std::string file_name) {
   hipparcos_catalogue_ = new HipparcosCatalogue(max_magnitude, catalogue_path);
   hipparcos_catalogue_->IsCalcEnabled = ini_file.ReadEnable(section, INI_CALC_LABEL);
   hipparcos_catalogue_->is_log_enabled_ = ini_file.ReadEnable(section, INI_LOG_LABEL);
-  hipparcos_catalogue_->ReadContents(catalogue_path, ',');
+  const bool is_cache_enabled = ini_file.ReadEnable(section, "catalogue_cache");
+  hipparcos_catalogue_->ReadContents(catalogue_path, ',', is_cache_enabled);
 
   return hipparcos_catalogue_;
 }
+
+std::shared_ptr<const HipparcosCatalogue> GetSharedHipparcosCatalogue(std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "HIPPARCOS_CATALOGUE";
+  const std::string key = MakeSharedDataKey(ini_file.ReadString(section, "catalogue_file_path"), ini_file.ReadDouble(section, "max_magnitude"),
+                                            ini_file.ReadEnable(section, INI_CALC_LABEL), ini_file.ReadEnable(section, INI_LOG_LABEL));
+
+  auto load = [&file_name]() { return std::shared_ptr<const HipparcosCatalogue>(InitHipparcosCatalogue(file_name)); };
+  return SharedDataRegistry<HipparcosCatalogue>::Get(key, load);
+}
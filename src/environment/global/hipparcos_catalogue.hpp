@@ -6,6 +6,8 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_HIPPARCOS_CATALOGUE_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_HIPPARCOS_CATALOGUE_HPP_
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "logger/loggable.hpp"
@@ -45,38 +47,39 @@ class HipparcosCatalogue : public ILoggable {
    *@brief Read Hipparcos catalogue file
    *@param [in] file_name: Path to Hipparcos catalogue file
    *@param [in] delimiter: Delimiter for the catalogue file
+   *@param [in] is_cache_enabled: Use the binary cache file (file_name + .s2ecache). The cache is written when it is not valid.
    */
-  bool ReadContents(const std::string& file_name, const char delimiter);
+  bool ReadContents(const std::string& file_name, const char delimiter, const bool is_cache_enabled = false);
 
   /**
    *@fn GetCatalogueSize
    *@brief Return read catalogue size
    */
-  size_t GetCatalogueSize() const { return hipparcos_catalogue_.size(); }
+  size_t GetCatalogueSize() const { return hipparcos_id_list_.size(); }
   /**
    *@fn GetHipparcosId
    *@brief Return Hipparcos ID of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  int GetHipparcosId(size_t rank) const { return hipparcos_catalogue_[rank].hipparcos_id; }
+  int GetHipparcosId(size_t rank) const { return hipparcos_id_list_[rank]; }
   /**
    *@fn GetVisibleMagnitude
    *@brief Return magnitude in visible wave length of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetVisibleMagnitude(size_t rank) const { return hipparcos_catalogue_[rank].visible_magnitude; }
+  double GetVisibleMagnitude(size_t rank) const { return visible_magnitude_list_[rank]; }
   /**
    *@fn GetRightAscension_deg
    *@brief Return right ascension of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetRightAscension_deg(size_t rank) const { return hipparcos_catalogue_[rank].right_ascension_deg; }
+  double GetRightAscension_deg(size_t rank) const { return right_ascension_deg_list_[rank]; }
   /**
    *@fn GetDeclination_deg
    *@brief Return declination of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetDeclination_deg(size_t rank) const { return hipparcos_catalogue_[rank].declination_deg; }
+  double GetDeclination_deg(size_t rank) const { return declination_deg_list_[rank]; }
   /**
    *@fn GetStarDir_i
    *@brief Return direction vector of a star in the inertial frame
@@ -90,6 +93,19 @@ class HipparcosCatalogue : public ILoggable {
    *@param [in] quaternion_i2b: Quaternion from the inertial frame to the body-fixed frame
    */
   libra::Vector<3> GetStarDirection_b(size_t rank, libra::Quaternion quaternion_i2b) const;
+  /**
+   *@fn FindStarsInCone
+   *@brief Find stars in a cone with the sky cell index
+   *@param [in] center_direction_i: Unit vector of the center of the cone in the inertial frame
+   *@param [in] half_angle_rad: Half angle of the cone [rad]
+   *@param [out] ranks: Ranks of the stars in the cone in ascending order (brighter first)
+   */
+  void FindStarsInCone(const libra::Vector<3>& center_direction_i, const double half_angle_rad, std::vector<size_t>& ranks) const;
+  /**
+   *@fn GetMemoryUsage_bytes
+   *@brief Return the memory of the data base and the sky cell index [bytes]
+   */
+  size_t GetMemoryUsage_bytes() const;
 
   // Override ILoggable
   /**
@@ -106,11 +122,70 @@ class HipparcosCatalogue : public ILoggable {
   bool IsCalcEnabled = true;  //!< Calculation enable flag
 
  private:
-  std::vector<HipparcosData> hipparcos_catalogue_;  //!< Data base of the read Hipparcos catalogue
-  double max_magnitude_;                            //!< Maximum magnitude in the data base
-  std::string catalogue_path_;                      //!< Path to Hipparcos catalog file
+  // Data base of the read Hipparcos catalogue with the structure of arrays sorted by magnitude
+  std::vector<int> hipparcos_id_list_;            //!< Hipparcos numbers
+  std::vector<double> visible_magnitude_list_;    //!< Visible magnitudes
+  std::vector<double> right_ascension_deg_list_;  //!< Right ascensions [deg]
+  std::vector<double> declination_deg_list_;      //!< Declinations [deg]
+  std::vector<double> direction_x_i_list_;        //!< X components of the unit vectors of the stars in the inertial frame
+  std::vector<double> direction_y_i_list_;        //!< Y components of the unit vectors of the stars in the inertial frame
+  std::vector<double> direction_z_i_list_;        //!< Z components of the unit vectors of the stars in the inertial frame
+  double max_magnitude_;                          //!< Maximum magnitude in the data base
+  std::string catalogue_path_;                    //!< Path to Hipparcos catalog file
+
+  // Sky cell index
+  static constexpr double kCellSize_rad = 0.0174533;  //!< Approximate size of the sky cells (1 deg) [rad]
+  std::vector<size_t> band_cell_offsets_;             //!< Index of the first cell of each declination band (size: number of bands + 1)
+  std::vector<size_t> cell_star_offsets_;             //!< Index of the first star of each cell in cell_star_ranks_ (size: number of cells + 1)
+  std::vector<size_t> cell_star_ranks_;               //!< Ranks of the stars ordered by cell and rank
+
+  /**
+   *@fn AddStar
+   *@brief Add a star to the data base and calculate the unit vector
+   *@param [in] hipparcos_data: Hipparcos data of the star
+   */
+  void AddStar(const HipparcosData& hipparcos_data);
+  /**
+   *@fn ReadCache
+   *@brief Read the data base from the binary cache file
+   *@param [in] file_name: Path to Hipparcos catalogue file
+   *@return True when a valid cache exists for the catalogue file and the maximum magnitude
+   */
+  bool ReadCache(const std::string& file_name);
+  /**
+   *@fn WriteCache
+   *@brief Write the data base to the binary cache file
+   *@param [in] file_name: Path to Hipparcos catalogue file
+   *@return True when the cache file is written successfully
+   */
+  bool WriteCache(const std::string& file_name) const;
+  /**
+   *@fn BuildSkyCellIndex
+   *@brief Sort the stars into the sky cells
+   *@note The sky is divided into declination bands, and each band is divided into right ascension cells with nearly equal area.
+   */
+  void BuildSkyCellIndex();
+  /**
+   *@fn GetNumberOfBands
+   *@brief Return number of declination bands
+   */
+  inline size_t GetNumberOfBands() const { return band_cell_offsets_.size() - 1; }
+  /**
+   *@fn CalcCellIndex
+   *@brief Return the index of the cell including the direction
+   *@param [in] band: Index of the declination band
+   *@param [in] right_ascension_rad: Right ascension [rad]
+   */
+  size_t CalcCellIndex(const size_t band, const double right_ascension_rad) const;
 };
 
+/**
+ *@fn GetHipparcosCatalogueCachePath
+ *@brief Return the binary cache file path for the catalogue file
+ *@param [in] catalogue_file_path: Path to Hipparcos catalogue file
+ */
+std::string GetHipparcosCatalogueCachePath(const std::string& catalogue_file_path);
+
 /**
  *@fn InitHipparcosCatalogue
  *@brief Initialize function for HipparcosCatalogue class
@@ -118,4 +193,12 @@ class HipparcosCatalogue : public ILoggable {
  */
 HipparcosCatalogue* InitHipparcosCatalogue(std::string file_name);
 
+/**
+ *@fn GetSharedHipparcosCatalogue
+ *@brief Return the HipparcosCatalogue shared between the instances initialized with the same setting
+ *@note The catalogue is read only once in the process (e.g., branches of the simulation case and sequential Monte-Carlo simulation cases).
+ *@param [in] file_name: Path to the initialize function
+ */
+std::shared_ptr<const HipparcosCatalogue> GetSharedHipparcosCatalogue(std::string file_name);
+
 #endif  // S2E_ENVIRONMENT_GLOBAL_HIPPARCOS_CATALOGUE_HPP_
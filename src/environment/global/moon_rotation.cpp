@@ -5,35 +5,85 @@
 
 #include "moon_rotation.hpp"
 
-#include <SpiceUsr.h>
-
+#include <cmath>
 #include <math_physics/math/constants.hpp>
+#include <math_physics/math/matrix_vector.hpp>
+#include <math_physics/math/quaternion.hpp>
 #include <math_physics/planet_rotation/moon_rotation_utilities.hpp>
 
+#include "spice_access.hpp"
+
 MoonRotation::MoonRotation(const CelestialInformation& celestial_information, MoonRotationMode mode)
     : mode_(mode), celestial_information_(celestial_information) {
   dcm_j2000_to_mcmf_ = libra::MakeIdentityMatrix<3>();
+  dcm_mcmf_to_j2000_ = libra::MakeIdentityMatrix<3>();
+  dcm_j2000_to_mcmf_derivative_ = libra::Matrix<3, 3>(0.0);
+  updated_dcm_j2000_to_mcmf_ = libra::MakeIdentityMatrix<3>();
+  moon_ = celestial_information_.GetBodyHandle("MOON");
+  earth_ = celestial_information_.GetBodyHandle("EARTH");
 }
 
 void MoonRotation::Update(const SimulationTime& simulation_time) {
+  if (mode_ != MoonRotationMode::kSimple && mode_ != MoonRotationMode::kIauMoon) {
+    dcm_j2000_to_mcmf_ = libra::MakeIdentityMatrix<3>();
+    dcm_mcmf_to_j2000_ = libra::MakeIdentityMatrix<3>();
+    dcm_j2000_to_mcmf_derivative_ = libra::Matrix<3, 3>(0.0);
+    angular_velocity_mcmf_rad_s_ = libra::Vector<3>(0.0);
+    return;
+  }
+
+  const double ephemeris_time_s = simulation_time.GetCurrentEphemerisTime();
+  const bool is_cache_valid = is_updated_ && update_interval_s_ > 0.0 && fabs(ephemeris_time_s - updated_ephemeris_time_s_) < update_interval_s_;
+  if (!is_cache_valid) {
+    CalcDcmAndAngularVelocity(ephemeris_time_s);
+    dcm_j2000_to_mcmf_ = updated_dcm_j2000_to_mcmf_;
+  } else {
+    // Rotation of the frame with the constant angular velocity from the latest full calculation
+    const double angular_rate_rad_s = angular_velocity_mcmf_rad_s_.CalcNorm();
+    if (angular_rate_rad_s > 0.0) {
+      const double rotation_angle_rad = angular_rate_rad_s * (ephemeris_time_s - updated_ephemeris_time_s_);
+      const libra::Quaternion rotation((1.0 / angular_rate_rad_s) * angular_velocity_mcmf_rad_s_, rotation_angle_rad);
+      dcm_j2000_to_mcmf_ = rotation.ConvertToDcm() * updated_dcm_j2000_to_mcmf_;
+    }
+  }
+  dcm_mcmf_to_j2000_ = dcm_j2000_to_mcmf_.Transpose();
+
+  // dC/dt = -[w x] C
+  for (size_t j = 0; j < 3; j++) {
+    libra::Vector<3> column;
+    for (size_t i = 0; i < 3; i++) column[i] = dcm_j2000_to_mcmf_[i][j];
+    const libra::Vector<3> derivative_column = -1.0 * libra::OuterProduct(angular_velocity_mcmf_rad_s_, column);
+    for (size_t i = 0; i < 3; i++) dcm_j2000_to_mcmf_derivative_[i][j] = derivative_column[i];
+  }
+}
+
+void MoonRotation::CalcDcmAndAngularVelocity(const double ephemeris_time_s) {
   if (mode_ == MoonRotationMode::kSimple) {
-    libra::Vector<3> moon_position_eci_m = celestial_information_.GetPositionFromSelectedBody_i_m("MOON", "EARTH");
-    libra::Vector<3> moon_velocity_eci_m_s = celestial_information_.GetVelocityFromSelectedBody_i_m_s("MOON", "EARTH");
-    dcm_j2000_to_mcmf_ = CalcDcmEciToPrincipalAxis(moon_position_eci_m, moon_velocity_eci_m_s);
-  } else if (mode_ == MoonRotationMode::kIauMoon) {
-    ConstSpiceChar from[] = "J2000";
-    ConstSpiceChar to[] = "IAU_MOON";
-    SpiceDouble et = simulation_time.GetCurrentEphemerisTime();
-    SpiceDouble state_transition_matrix[6][6];
-    sxform_c(from, to, et, state_transition_matrix);
+    libra::Vector<3> moon_position_eci_m = celestial_information_.GetPositionFromSelectedBody_i_m(moon_, earth_);
+    libra::Vector<3> moon_velocity_eci_m_s = celestial_information_.GetVelocityFromSelectedBody_i_m_s(moon_, earth_);
+    updated_dcm_j2000_to_mcmf_ = CalcDcmEciToPrincipalAxis(moon_position_eci_m, moon_velocity_eci_m_s);
+    // The frame rotates with the direction of the Moon from the Earth
+    const double moon_distance2_m2 = libra::InnerProduct(moon_position_eci_m, moon_position_eci_m);
+    const libra::Vector<3> angular_velocity_eci_rad_s = (1.0 / moon_distance2_m2) * libra::OuterProduct(moon_position_eci_m, moon_velocity_eci_m_s);
+    angular_velocity_mcmf_rad_s_ = updated_dcm_j2000_to_mcmf_ * angular_velocity_eci_rad_s;
+  } else {
+    double state_transition_matrix[6][6];
+    SpiceAccess::GetStateTransformation("J2000", "IAU_MOON", ephemeris_time_s, state_transition_matrix);
+    libra::Matrix<3, 3> dcm_derivative;
     for (size_t i = 0; i < 3; i++) {
       for (size_t j = 0; j < 3; j++) {
-        dcm_j2000_to_mcmf_[i][j] = state_transition_matrix[i][j];
+        updated_dcm_j2000_to_mcmf_[i][j] = state_transition_matrix[i][j];
+        dcm_derivative[i][j] = state_transition_matrix[i + 3][j];
       }
     }
-  } else {
-    dcm_j2000_to_mcmf_ = libra::MakeIdentityMatrix<3>();
+    // dC/dt C^T = -[w x]
+    const libra::Matrix<3, 3> skew = dcm_derivative * updated_dcm_j2000_to_mcmf_.Transpose();
+    angular_velocity_mcmf_rad_s_[0] = 0.5 * (skew[1][2] - skew[2][1]);
+    angular_velocity_mcmf_rad_s_[1] = 0.5 * (skew[2][0] - skew[0][2]);
+    angular_velocity_mcmf_rad_s_[2] = 0.5 * (skew[0][1] - skew[1][0]);
   }
+  updated_ephemeris_time_s_ = ephemeris_time_s;
+  is_updated_ = true;
 }
 
 MoonRotationMode ConvertMoonRotationMode(const std::string mode) {
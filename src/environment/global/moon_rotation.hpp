@@ -6,10 +6,12 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
 
+#include "celestial_body_handle.hpp"
 #include "celestial_information.hpp"
 #include "math_physics/math/matrix.hpp"
 #include "math_physics/math/vector.hpp"
 #include "simulation_time.hpp"
+#include "utilities/snapshot.hpp"
 
 class CelestialInformation;
 
@@ -47,19 +49,86 @@ class MoonRotation {
    * @param [in] simulation_time: simulation_time
    */
   void Update(const SimulationTime &simulation_time);
+  /**
+   * @fn SetUpdateInterval_s
+   * @brief Set the interval of the full calculation of the DCM
+   * @details The DCM and the angular velocity of the Moon are calculated from the Moon orbit or SPICE only when the interval has passed
+   *          from the latest calculation, and the DCM is propagated with the constant angular velocity in between. The angular velocity of
+   *          the Moon varies about 6% in a month with the eccentricity of the orbit, so the angle error is about 3.5e-13 rad times the
+   *          square of the interval in seconds (e.g., 4.5e-6 rad, 8 m on the Moon surface, for 3600 sec).
+   * @param [in] update_interval_s: Update interval [sec]. Zero or negative value calculates the DCM at every update.
+   */
+  inline void SetUpdateInterval_s(const double update_interval_s) { update_interval_s_ = update_interval_s; }
 
   /**
    * @fn GetDcmJ2000ToMcmf
    * @brief Return the DCM between J2000 inertial frame and the Moon Centered Moon Fixed frame
    * @note Because this is just a DCM, users need to consider the origin of the vector, which you want to convert with this matrix.
    */
-  inline const libra::Matrix<3, 3> GetDcmJ2000ToMcmf() const { return dcm_j2000_to_mcmf_; };
+  inline const libra::Matrix<3, 3> &GetDcmJ2000ToMcmf() const { return dcm_j2000_to_mcmf_; };
+  /**
+   * @fn GetDcmMcmfToJ2000
+   * @brief Return the DCM between the Moon Centered Moon Fixed frame and J2000 inertial frame
+   * @note The transpose is computed once per update so that users do not need to transpose the matrix by themselves
+   */
+  inline const libra::Matrix<3, 3> &GetDcmMcmfToJ2000() const { return dcm_mcmf_to_j2000_; };
+  /**
+   * @fn GetDcmJ2000ToMcmfDerivative
+   * @brief Return the time derivative of the DCM between J2000 inertial frame and the Moon Centered Moon Fixed frame [1/s]
+   */
+  inline const libra::Matrix<3, 3> &GetDcmJ2000ToMcmfDerivative() const { return dcm_j2000_to_mcmf_derivative_; };
+  /**
+   * @fn GetAngularVelocity_mcmf_rad_s
+   * @brief Return the angular velocity of the Moon in the Moon Centered Moon Fixed frame [rad/s]
+   */
+  inline const libra::Vector<3> &GetAngularVelocity_mcmf_rad_s() const { return angular_velocity_mcmf_rad_s_; };
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the current DCMs and the angular velocity to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  inline void SaveSnapshot(SnapshotWriter &snapshot) const {
+    snapshot.Write(dcm_j2000_to_mcmf_);
+    snapshot.Write(dcm_mcmf_to_j2000_);
+    snapshot.Write(dcm_j2000_to_mcmf_derivative_);
+    snapshot.Write(angular_velocity_mcmf_rad_s_);
+  }
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the current DCMs and the angular velocity from the snapshot without the calculation
+   * @param [in] snapshot: Snapshot reader
+   */
+  inline void LoadSnapshot(SnapshotReader &snapshot) {
+    snapshot.Read(dcm_j2000_to_mcmf_);
+    snapshot.Read(dcm_mcmf_to_j2000_);
+    snapshot.Read(dcm_j2000_to_mcmf_derivative_);
+    snapshot.Read(angular_velocity_mcmf_rad_s_);
+  }
 
  private:
-  MoonRotationMode mode_;                  //!< Rotation mode
-  libra::Matrix<3, 3> dcm_j2000_to_mcmf_;  //!< Direction Cosine Matrix J2000 to MCMF (Moon Centered Moon Fixed)
+  MoonRotationMode mode_;                              //!< Rotation mode
+  libra::Matrix<3, 3> dcm_j2000_to_mcmf_;              //!< Direction Cosine Matrix J2000 to MCMF (Moon Centered Moon Fixed)
+  libra::Matrix<3, 3> dcm_mcmf_to_j2000_;              //!< Direction Cosine Matrix MCMF to J2000
+  libra::Matrix<3, 3> dcm_j2000_to_mcmf_derivative_;   //!< Time derivative of the DCM J2000 to MCMF [1/s]
+  libra::Vector<3> angular_velocity_mcmf_rad_s_{0.0};  //!< Angular velocity of the Moon in the MCMF frame [rad/s]
+
+  // Cache of the latest full calculation
+  double update_interval_s_ = 0.0;                 //!< Interval of the full calculation [sec]
+  double updated_ephemeris_time_s_ = 0.0;          //!< Ephemeris time of the latest full calculation [sec]
+  bool is_updated_ = false;                        //!< Flag of the full calculation
+  libra::Matrix<3, 3> updated_dcm_j2000_to_mcmf_;  //!< DCM J2000 to MCMF at the latest full calculation
 
   const CelestialInformation &celestial_information_;  //!< Celestial Information to get moon orbit
+  CelestialBodyHandle moon_;                           //!< Handle of the Moon
+  CelestialBodyHandle earth_;                          //!< Handle of the Earth
+
+  /**
+   * @fn CalcDcmAndAngularVelocity
+   * @brief Calculate the DCM J2000 to MCMF and the angular velocity of the Moon with the current Moon orbit or SPICE
+   * @param [in] ephemeris_time_s: Ephemeris time [sec]
+   */
+  void CalcDcmAndAngularVelocity(const double ephemeris_time_s);
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
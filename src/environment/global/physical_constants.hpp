@@ -35,6 +35,7 @@ DEFINE_PHYSICAL_CONSTANT(earth_polar_radius_m, 6356752.0L)                     /
 DEFINE_PHYSICAL_CONSTANT(earth_gravitational_constant_m3_s2, 3.986004415e14L)  //!< Best estimate of the Earth's gravitational constants, TT [m3/s2]
 DEFINE_PHYSICAL_CONSTANT(earth_mean_angular_velocity_rad_s, 7.292115e-5L)      //!< Best estimate of the Earth's mean angular velocity, TT [rad/s]
 DEFINE_PHYSICAL_CONSTANT(earth_flattening, 3.352797e-3L)                       //!< The Earth flattening calculated from the earth radius above
+DEFINE_PHYSICAL_CONSTANT(earth_j2, 1.08262668e-3L)                             //!< Zonal harmonic J2 of the Earth calculated from the EGM96 C20
 }  // namespace astronomy
 
 #undef DEFINE_PHYSICAL_CONSTANT
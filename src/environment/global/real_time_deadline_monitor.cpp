@@ -0,0 +1,75 @@
+/**
+ *@file real_time_deadline_monitor.cpp
+ *@brief Class to monitor the deadline of each step in the real time simulation and to select the degradation actions
+ */
+
+#include "real_time_deadline_monitor.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+/**
+ * @fn ConvertActionsToString
+ * @brief Return the actions separated by the space
+ */
+std::string ConvertActionsToString(const unsigned int actions) {
+  std::string text;
+  if (actions & kRealTimeDegradationHoldDisturbances) text += "HOLD_DISTURBANCES ";
+  if (actions & kRealTimeDegradationDeferLogging) text += "DEFER_LOGGING ";
+  if (actions & kRealTimeDegradationReduceGeopotential) text += "REDUCE_GEOPOTENTIAL ";
+  if (text.empty()) return "RECOVERED";
+  text.pop_back();
+  return text;
+}
+}  // namespace
+
+RealTimeDeadlineMonitor::RealTimeDeadlineMonitor(const unsigned int enabled_actions, const double slack_threshold_s, const size_t recovery_steps,
+                                                 const size_t reduced_geopotential_degree, const double expensive_disturbance_time_s)
+    : enabled_actions_(enabled_actions & kRealTimeDegradationAll),
+      slack_threshold_s_(slack_threshold_s),
+      recovery_steps_(recovery_steps),
+      reduced_geopotential_degree_(reduced_geopotential_degree),
+      expensive_disturbance_time_s_(expensive_disturbance_time_s) {
+  for (size_t i = 0; i < kNumberOfActions; i++) number_of_degraded_steps_[i] = 0;
+}
+
+void RealTimeDeadlineMonitor::Update(const double elapsed_time_s, const double slack_s) {
+  if (!IsEnabled()) return;
+
+  unsigned int next_actions;
+  if (slack_s < slack_threshold_s_) {
+    number_of_in_time_steps_ = 0;
+    next_actions = enabled_actions_;
+  } else {
+    number_of_in_time_steps_++;
+    // Only the geopotential degree is kept reduced until the recovery
+    next_actions = active_actions_ & kRealTimeDegradationReduceGeopotential;
+    if (number_of_in_time_steps_ >= recovery_steps_) next_actions = 0;
+  }
+
+  if (next_actions != active_actions_) events_.push_back({elapsed_time_s, slack_s, next_actions});
+  active_actions_ = next_actions;
+  for (size_t i = 0; i < kNumberOfActions; i++) {
+    if (active_actions_ & (1u << i)) number_of_degraded_steps_[i]++;
+  }
+}
+
+void RealTimeDeadlineMonitor::PrintStatistics() const {
+  if (!IsEnabled()) return;
+  std::cout << "Real time degradation: " << events_.size() << " changes, degraded steps (hold disturbances "
+            << number_of_degraded_steps_[0] << ", defer logging " << number_of_degraded_steps_[1] << ", reduce geopotential "
+            << number_of_degraded_steps_[2] << ")" << std::endl;
+}
+
+bool RealTimeDeadlineMonitor::WriteEvents(const std::string& file_path) const {
+  std::ofstream file(file_path, std::ios::trunc);
+  if (!file.is_open()) return false;
+  file << "elapsed_time[s],slack[s],actions" << std::endl;
+  file << std::setprecision(9);
+  for (const auto& event : events_) {
+    file << event.elapsed_time_s << "," << event.slack_s << "," << ConvertActionsToString(event.actions) << std::endl;
+  }
+  return (bool)file;
+}
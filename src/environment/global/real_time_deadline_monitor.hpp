@@ -0,0 +1,123 @@
+/**
+ *@file real_time_deadline_monitor.hpp
+ *@brief Class to monitor the deadline of each step in the real time simulation and to select the degradation actions
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_REAL_TIME_DEADLINE_MONITOR_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_REAL_TIME_DEADLINE_MONITOR_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ *@enum RealTimeDegradationAction
+ *@brief Actions to reduce the calculation of the step after a step which is finished near or after the deadline
+ */
+enum RealTimeDegradationAction : unsigned int {
+  kRealTimeDegradationHoldDisturbances = 0x01,    //!< Hold the outputs of the expensive disturbances for a step
+  kRealTimeDegradationDeferLogging = 0x02,        //!< Defer the log output to the next step which is not degraded
+  kRealTimeDegradationReduceGeopotential = 0x04,  //!< Lower the geopotential degree until the steps are in time for the recovery steps
+  kRealTimeDegradationAll = 0x07,                 //!< All actions
+};
+
+/**
+ *@struct RealTimeDegradationEvent
+ *@brief Change of the degradation actions
+ */
+struct RealTimeDegradationEvent {
+  double elapsed_time_s;  //!< Simulation elapsed time of the step which changed the actions [s]
+  double slack_s;         //!< Wall clock time from the end of the step calculation to the deadline. Negative for the overrun. [s]
+  unsigned int actions;   //!< Actions applied from the next step as a combination of RealTimeDegradationAction. Zero for the recovery.
+};
+
+/**
+ *@class RealTimeDeadlineMonitor
+ *@brief Class to select the degradation actions of the next step from the slack of the step before the deadline
+ *@details When the slack of a step is smaller than the threshold (including the overrun), the enabled actions are applied to the next step.
+ *         The disturbance hold and the logging deferral are applied only to the next step, and the reduced geopotential degree is kept
+ *         until the steps are in time continuously for the recovery steps. Each change of the actions is stored as an event, and the
+ *         events are written after the simulation to keep the file access out of the real time loop.
+ */
+class RealTimeDeadlineMonitor {
+ public:
+  /**
+   *@fn RealTimeDeadlineMonitor
+   *@brief Constructor
+   *@param [in] enabled_actions: Combination of RealTimeDegradationAction. Zero disables the monitor.
+   *@param [in] slack_threshold_s: Minimum slack before the deadline to keep the full calculation [s]
+   *@param [in] recovery_steps: Number of the continuous steps in time to restore the geopotential degree
+   *@param [in] reduced_geopotential_degree: Geopotential degree during the degradation
+   *@param [in] expensive_disturbance_time_s: Average calculation time of the disturbances to be held [s]
+   */
+  RealTimeDeadlineMonitor(const unsigned int enabled_actions = 0, const double slack_threshold_s = 0.0, const size_t recovery_steps = 100,
+                          const size_t reduced_geopotential_degree = 8, const double expensive_disturbance_time_s = 1.0e-4);
+
+  /**
+   *@fn Update
+   *@brief Select the actions of the next step
+   *@param [in] elapsed_time_s: Simulation elapsed time after the step [s]
+   *@param [in] slack_s: Wall clock time from the end of the step calculation to the deadline. Negative for the overrun. [s]
+   */
+  void Update(const double elapsed_time_s, const double slack_s);
+
+  /**
+   *@fn IsEnabled
+   *@brief Return true when any action is enabled
+   */
+  inline bool IsEnabled() const { return enabled_actions_ != 0; }
+  /**
+   *@fn IsActive
+   *@brief Return true when the action is applied to the current step
+   */
+  inline bool IsActive(const RealTimeDegradationAction action) const { return (active_actions_ & action) != 0; }
+  /**
+   *@fn GetActiveActions
+   *@brief Return the actions applied to the current step as a combination of RealTimeDegradationAction
+   */
+  inline unsigned int GetActiveActions() const { return active_actions_; }
+  /**
+   *@fn GetReducedGeopotentialDegree
+   *@brief Return the geopotential degree during the degradation
+   */
+  inline size_t GetReducedGeopotentialDegree() const { return reduced_geopotential_degree_; }
+  /**
+   *@fn GetExpensiveDisturbanceTime_s
+   *@brief Return the average calculation time of the disturbances to be held [s]
+   */
+  inline double GetExpensiveDisturbanceTime_s() const { return expensive_disturbance_time_s_; }
+  /**
+   *@fn GetEvents
+   *@brief Return the changes of the actions
+   */
+  inline const std::vector<RealTimeDegradationEvent>& GetEvents() const { return events_; }
+
+  /**
+   *@fn PrintStatistics
+   *@brief Print the number of the degraded steps of each action
+   */
+  void PrintStatistics() const;
+  /**
+   *@fn WriteEvents
+   *@brief Write the changes of the actions in a CSV file
+   *@param [in] file_path: Path to the CSV file
+   *@return True when the file is written
+   */
+  bool WriteEvents(const std::string& file_path) const;
+
+ private:
+  static const size_t kNumberOfActions = 3;  //!< Number of the actions
+
+  unsigned int enabled_actions_;         //!< Enabled actions
+  double slack_threshold_s_;             //!< Minimum slack before the deadline to keep the full calculation [s]
+  size_t recovery_steps_;                //!< Number of the continuous steps in time to restore the geopotential degree
+  size_t reduced_geopotential_degree_;   //!< Geopotential degree during the degradation
+  double expensive_disturbance_time_s_;  //!< Average calculation time of the disturbances to be held [s]
+
+  unsigned int active_actions_ = 0;                    //!< Actions applied to the current step
+  size_t number_of_in_time_steps_ = 0;                 //!< Number of the continuous steps in time
+  size_t number_of_degraded_steps_[kNumberOfActions];  //!< Number of the steps where each action is applied
+  std::vector<RealTimeDegradationEvent> events_;       //!< Changes of the actions
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_REAL_TIME_DEADLINE_MONITOR_HPP_
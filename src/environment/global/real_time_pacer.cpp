@@ -0,0 +1,137 @@
+/**
+ *@file real_time_pacer.cpp
+ *@brief Class to pace the simulation steps with the wall clock time
+ */
+
+#include "real_time_pacer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#ifdef __linux__
+#include <errno.h>
+#include <time.h>
+#endif
+
+namespace {
+/**
+ * @fn SleepUntil
+ * @brief Sleep until the absolute deadline
+ */
+void SleepUntil(const std::chrono::steady_clock::time_point deadline) {
+#ifdef __linux__
+  // steady_clock is CLOCK_MONOTONIC on Linux. The absolute deadline is not delayed by the preemption before the sleep,
+  // and the sleep is restarted with the same deadline after the interruption by signals.
+  const long long deadline_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+  const struct timespec request = {(time_t)(deadline_ns / 1000000000), (long)(deadline_ns % 1000000000)};
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &request, NULL) == EINTR) {
+  }
+#else
+  std::this_thread::sleep_until(deadline);
+#endif
+}
+}  // namespace
+
+RealTimeOverrunMode ConvertRealTimeOverrunMode(const std::string mode) {
+  if (mode == "CATCH_UP") return RealTimeOverrunMode::kCatchUp;
+  if (mode == "REBASE") return RealTimeOverrunMode::kRebase;
+  if (mode != "" && mode != "SKIP_TIME") {
+    std::cout << "[Warning] real_time_overrun_mode: " << mode << " is not supported. SKIP_TIME is used." << std::endl;
+  }
+  return RealTimeOverrunMode::kSkipTime;
+}
+
+double RealTimePacingStatistics::GetLatenessStandardDeviation_s() const {
+  if (number_of_steps == 0) return 0.0;
+  const double average_s = GetAverageLateness_s();
+  return sqrt(std::max(sum_lateness2_s2 / (double)number_of_steps - average_s * average_s, 0.0));
+}
+
+RealTimePacer::RealTimePacer(const double simulation_speed, const RealTimeOverrunMode overrun_mode, const double skip_time_limit_s)
+    : simulation_speed_(simulation_speed),
+      overrun_mode_(overrun_mode),
+      skip_time_limit_s_(skip_time_limit_s),
+      spin_duration_(std::chrono::steady_clock::duration::zero()) {
+  Start(0.0);
+}
+
+void RealTimePacer::Start(const double elapsed_time_s) {
+  const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  // Shift the start time to keep the simulation speed after the elapsed time is restored from the snapshot
+  start_time_ = now - ConvertToClockDuration(elapsed_time_s);
+  last_in_time_step_time_ = now;
+  statistics_ = RealTimePacingStatistics();
+}
+
+double RealTimePacer::Wait(const double elapsed_time_s) {
+  const std::chrono::steady_clock::time_point deadline = start_time_ + ConvertToClockDuration(elapsed_time_s);
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  statistics_.last_slack_s = std::chrono::duration<double>(deadline - now).count();
+
+  if (now < deadline) {
+    const std::chrono::steady_clock::time_point sleep_end = deadline - spin_duration_;
+    if (now < sleep_end) {
+      statistics_.total_sleep_time_s += std::chrono::duration<double>(sleep_end - now).count();
+      SleepUntil(sleep_end);
+    }
+    // Spin phase
+    do {
+      now = std::chrono::steady_clock::now();
+    } while (now < deadline);
+    AddLateness(std::chrono::duration<double>(now - deadline).count());
+    last_in_time_step_time_ = now;
+    return elapsed_time_s;
+  }
+
+  // Overrun
+  const double overrun_s = std::chrono::duration<double>(now - deadline).count();
+  AddLateness(overrun_s);
+  statistics_.number_of_overruns++;
+  statistics_.max_overrun_s = std::max(statistics_.max_overrun_s, overrun_s);
+
+  switch (overrun_mode_) {
+    case RealTimeOverrunMode::kCatchUp:
+      // The next steps are executed without sleep until they are in time
+      return elapsed_time_s;
+    case RealTimeOverrunMode::kRebase:
+      start_time_ += now - deadline;
+      return elapsed_time_s;
+    case RealTimeOverrunMode::kSkipTime:
+    default:
+      break;
+  }
+
+  if (std::chrono::duration<double>(now - last_in_time_step_time_).count() <= skip_time_limit_s_) return elapsed_time_s;
+  // Skip time and warn only when execution time exceeds continuously for long time
+  std::cout << "Error: the specified step_sec is too small for this computer.\r\n";
+  // Forcibly set elapsed time as actual elapsed time. Reason: to catch up with real time when resume from a breakpoint
+  last_in_time_step_time_ = now;
+  return std::chrono::duration<double>(now - start_time_).count() * simulation_speed_;
+}
+
+void RealTimePacer::SetSpinDuration_s(const double spin_duration_s) {
+  const std::chrono::duration<double> spin_duration(std::max(spin_duration_s, 0.0));
+  spin_duration_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(spin_duration);
+}
+
+void RealTimePacer::PrintStatistics() const {
+  std::cout << "Real time pacing: " << statistics_.number_of_steps << " steps, " << statistics_.number_of_overruns << " overruns (max "
+            << statistics_.max_overrun_s * 1e3 << " ms), lateness average " << statistics_.GetAverageLateness_s() * 1e3 << " ms, standard deviation "
+            << statistics_.GetLatenessStandardDeviation_s() * 1e3 << " ms, max " << statistics_.max_lateness_s * 1e3 << " ms, sleep "
+            << statistics_.total_sleep_time_s << " s" << std::endl;
+}
+
+std::chrono::steady_clock::duration RealTimePacer::ConvertToClockDuration(const double elapsed_time_s) const {
+  if (simulation_speed_ <= 0.0) return std::chrono::steady_clock::duration::zero();
+  const std::chrono::duration<double> clock_elapsed_time_s(elapsed_time_s / simulation_speed_);
+  return std::chrono::duration_cast<std::chrono::steady_clock::duration>(clock_elapsed_time_s);
+}
+
+void RealTimePacer::AddLateness(const double lateness_s) {
+  statistics_.number_of_steps++;
+  statistics_.last_lateness_s = lateness_s;
+  statistics_.sum_lateness_s += lateness_s;
+  statistics_.sum_lateness2_s2 += lateness_s * lateness_s;
+  statistics_.max_lateness_s = std::max(statistics_.max_lateness_s, lateness_s);
+}
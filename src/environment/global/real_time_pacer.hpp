@@ -0,0 +1,142 @@
+/**
+ *@file real_time_pacer.hpp
+ *@brief Class to pace the simulation steps with the wall clock time
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_REAL_TIME_PACER_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_REAL_TIME_PACER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+/**
+ *@enum RealTimeOverrunMode
+ *@brief Handling of the steps which are finished after the wall clock deadline
+ */
+enum class RealTimeOverrunMode {
+  kSkipTime,  //!< Jump the simulation time to the wall clock time when the overrun continues longer than the limit (former behavior)
+  kCatchUp,   //!< Execute the delayed steps without sleep until the simulation catches up with the wall clock time
+  kRebase,    //!< Shift the following deadlines by the overrun, so the delay is not recovered
+};
+
+/**
+ *@fn ConvertRealTimeOverrunMode
+ *@brief Convert the setting string (SKIP_TIME, CATCH_UP, REBASE) to RealTimeOverrunMode
+ *@note Empty and unknown strings are converted to kSkipTime with the warning for the unknown strings.
+ */
+RealTimeOverrunMode ConvertRealTimeOverrunMode(const std::string mode);
+
+/**
+ *@struct RealTimePacingStatistics
+ *@brief Statistics of the wall clock time at the end of the waits
+ *@note The lateness is the wall clock time at the end of the wait minus the deadline of the step.
+ *      It is the wake up jitter of the sleep for the steps in time, and the overrun for the delayed steps.
+ */
+struct RealTimePacingStatistics {
+  size_t number_of_steps = 0;       //!< Number of paced steps
+  size_t number_of_overruns = 0;    //!< Number of steps finished after the deadline
+  double sum_lateness_s = 0.0;      //!< Sum of lateness [s]
+  double sum_lateness2_s2 = 0.0;    //!< Sum of squared lateness [s2]
+  double max_lateness_s = 0.0;      //!< Maximum lateness [s]
+  double max_overrun_s = 0.0;       //!< Maximum overrun [s]
+  double total_sleep_time_s = 0.0;  //!< Total wall clock time requested to sleep [s]
+  double last_lateness_s = 0.0;     //!< Lateness of the latest step [s]
+  double last_slack_s = 0.0;        //!< Wall clock time from the end of the latest step calculation to the deadline. Negative for the overrun. [s]
+
+  /**
+   *@fn GetAverageLateness_s
+   *@brief Return average lateness [s]
+   */
+  inline double GetAverageLateness_s() const { return number_of_steps > 0 ? sum_lateness_s / (double)number_of_steps : 0.0; }
+  /**
+   *@fn GetLatenessStandardDeviation_s
+   *@brief Return standard deviation of lateness [s]
+   */
+  double GetLatenessStandardDeviation_s() const;
+};
+
+/**
+ *@class RealTimePacer
+ *@brief Class to wait until the wall clock time of each simulation step
+ *@details The deadline of each step is calculated from the start of the pacing and the simulation elapsed time, and the pacer sleeps
+ *         until the absolute deadline. The sleep error does not accumulate since each deadline is independent of the previous wakeup.
+ *         The pacer busy-waits only in the spin duration before the deadline (zero by default) to remove the wake up jitter of the sleep
+ *         for the sub-millisecond step width.
+ */
+class RealTimePacer {
+ public:
+  /**
+   *@fn RealTimePacer
+   *@brief Constructor
+   *@param [in] simulation_speed: The speed of the simulation relative to real time
+   *@param [in] overrun_mode: Handling of the delayed steps
+   *@param [in] skip_time_limit_s: Maximum duration of the continuous overrun before the simulation time is skipped in kSkipTime [s]
+   */
+  RealTimePacer(const double simulation_speed = 1.0, const RealTimeOverrunMode overrun_mode = RealTimeOverrunMode::kSkipTime,
+                const double skip_time_limit_s = 1.0);
+
+  /**
+   *@fn Start
+   *@brief Start the pacing from now and reset the statistics
+   *@param [in] elapsed_time_s: Current simulation elapsed time [s]. The start is shifted to keep the speed after the snapshot restore.
+   */
+  void Start(const double elapsed_time_s);
+  /**
+   *@fn Wait
+   *@brief Wait until the wall clock time for the simulation elapsed time
+   *@param [in] elapsed_time_s: Simulation elapsed time after the step [s]
+   *@return Simulation elapsed time to continue [s]. It is changed only when the time is skipped in kSkipTime.
+   */
+  double Wait(const double elapsed_time_s);
+
+  /**
+   *@fn SetOverrunMode
+   *@brief Set handling of the delayed steps
+   */
+  inline void SetOverrunMode(const RealTimeOverrunMode overrun_mode) { overrun_mode_ = overrun_mode; }
+  /**
+   *@fn GetOverrunMode
+   *@brief Return handling of the delayed steps
+   */
+  inline RealTimeOverrunMode GetOverrunMode() const { return overrun_mode_; }
+  /**
+   *@fn SetSpinDuration_s
+   *@brief Set the duration of the busy-wait before the deadline. The sleep ends at the deadline minus the spin duration.
+   *@param [in] spin_duration_s: Spin duration [s]
+   */
+  void SetSpinDuration_s(const double spin_duration_s);
+  /**
+   *@fn GetStatistics
+   *@brief Return statistics of the pacing after Start
+   */
+  inline const RealTimePacingStatistics& GetStatistics() const { return statistics_; }
+  /**
+   *@fn PrintStatistics
+   *@brief Print statistics of the pacing
+   */
+  void PrintStatistics() const;
+
+ private:
+  double simulation_speed_;           //!< The speed of the simulation relative to real time
+  RealTimeOverrunMode overrun_mode_;  //!< Handling of the delayed steps
+  double skip_time_limit_s_;          //!< Maximum duration of the continuous overrun in kSkipTime [s]
+
+  std::chrono::steady_clock::time_point start_time_;              //!< Wall clock time at the simulation elapsed time zero
+  std::chrono::steady_clock::time_point last_in_time_step_time_;  //!< Wall clock time of the last step finished in time
+  std::chrono::steady_clock::duration spin_duration_;             //!< Busy-wait duration before the deadline
+  RealTimePacingStatistics statistics_;                           //!< Statistics of the pacing
+
+  /**
+   *@fn ConvertToClockDuration
+   *@brief Return the wall clock duration for the simulation elapsed time
+   */
+  std::chrono::steady_clock::duration ConvertToClockDuration(const double elapsed_time_s) const;
+  /**
+   *@fn AddLateness
+   *@brief Add the lateness to the statistics
+   */
+  void AddLateness(const double lateness_s);
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_REAL_TIME_PACER_HPP_
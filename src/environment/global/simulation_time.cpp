@@ -6,18 +6,16 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include "simulation_time.hpp"
 
-#include <SpiceUsr.h>
-
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
+#include "math_physics/time_system/date_time_format.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
-#ifdef WIN32
-#include <Windows.h>
-#else
-#include <errno.h>
-#endif
+#include "spice_access.hpp"
 
 using namespace std;
 
@@ -39,14 +37,19 @@ SimulationTime::SimulationTime(const double end_sec, const double step_sec, cons
   simulation_speed_ = sim_speed;
   display_period_ = (1.0 * end_sec / step_sec / 100);  // Update every 1%
   time_exceeds_continuously_limit_sec_ = 1.0;
+  real_time_pacer_ = RealTimePacer(simulation_speed_, RealTimeOverrunMode::kSkipTime, time_exceeds_continuously_limit_sec_);
 
   //  sscanf_s(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_month_, &start_day_, &start_hour_, &start_minute_, &start_sec_);
   sscanf(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_month_, &start_day_, &start_hour_, &start_minute_, &start_sec_);
   jday(start_year_, start_month_, start_day_, start_hour_, start_minute_, start_sec_, start_jd_);
+  if (start_year_ >= 1970) {
+    start_epoch_time_ = EpochTime(DateTime((size_t)start_year_, (size_t)start_month_, (size_t)start_day_, (size_t)start_hour_,
+                                           (size_t)start_minute_, start_sec_));
+  } else {
+    std::cerr << "[WARNINGS] SimulationTime: the epoch time is not available before 1970." << std::endl;
+  }
   current_jd_ = start_jd_;
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalendarDay(current_jd_);
+  InvalidateDerivedTimes();
   AssertTimeStepParams();
   InitializeState();
   SetParameters();
@@ -54,7 +57,7 @@ SimulationTime::SimulationTime(const double end_sec, const double step_sec, cons
   // Ephemeris time initialize
   std::ostringstream stream;
   stream << std::fixed << std::setprecision(11) << "jd " << start_jd_;
-  str2et_c(stream.str().c_str(), &start_ephemeris_time_);
+  start_ephemeris_time_ = SpiceAccess::ConvertStringToEphemerisTime(stream.str());
 }
 
 SimulationTime::~SimulationTime() {}
@@ -90,53 +93,37 @@ void SimulationTime::SetParameters(void) {
 
 void SimulationTime::UpdateTime(void) {
   InitializeState();
-  elapsed_time_sec_ += step_sec_;
-  if (simulation_speed_ > 0) {
-    chrono::system_clock clk;
-    int toWaitTime = (int)(elapsed_time_sec_ * 1000 -
-                           chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_start_time_millisec_).count() * simulation_speed_);
-    if (toWaitTime <= 0) {
-      // When the execution time is larger than specified step_sec
-
-      int exceeded_duration_ms = (int)chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_last_time_completed_step_in_time_).count();
-      if (exceeded_duration_ms > time_exceeds_continuously_limit_sec_ * 1000) {
-        // Skip time and warn only when execution time exceeds continuously for long time
-
-        cout << "Error: the specified step_sec is too small for this computer.\r\n";
-
-        // Forcibly set elapsed_tim_sec_ as actual elapsed time Reason: to catch up with real time when resume from a breakpoint
-        elapsed_time_sec_ =
-            (chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() * simulation_speed_);
-
-        clock_last_time_completed_step_in_time_ = clk.now();
-      }
-    } else {
-      clock_last_time_completed_step_in_time_ = clk.now();
-
-#ifdef WIN32
-      Sleep(toWaitTime);
-#else
-      const struct timespec req = {toWaitTime / 1000, (toWaitTime % 1000) * 1000000};
-      nanosleep(&req, NULL);
-#endif
+  // In the event driven mode, the steps without any update are skipped at once.
+  // The elapsed time is accumulated step by step to keep the same values at the events.
+  int number_of_steps = is_event_driven_ ? CalcStepsToNextEvent() : 1;
+  for (int i = 0; i < number_of_steps; i++) {
+    elapsed_time_sec_ += step_sec_;
+    if (elapsed_time_sec_ > end_sec_) {
+      number_of_steps = i + 1;
+      break;
     }
   }
+  if (simulation_speed_ > 0) {
+    // Sleep until the absolute wall clock deadline of the elapsed time
+    elapsed_time_sec_ = real_time_pacer_.Wait(elapsed_time_sec_);
+    // Select the degradation of the next step with the slack of this step
+    real_time_deadline_monitor_.Update(elapsed_time_sec_, real_time_pacer_.GetStatistics().last_slack_s);
+  }
 
-  attitude_update_counter_++;
-  orbit_update_counter_++;
-  thermal_update_counter_++;
-  component_update_counter_++;
-  log_counter_++;
-  display_counter_++;
+  attitude_update_counter_ += number_of_steps;
+  orbit_update_counter_ += number_of_steps;
+  thermal_update_counter_ += number_of_steps;
+  component_update_counter_ += number_of_steps;
+  log_counter_ += number_of_steps;
+  display_counter_ += number_of_steps;
 
   if (elapsed_time_sec_ > end_sec_) {
     state_.finish = true;
   }
 
+  // The sidereal time, the decimal year, and the UTC are calculated when they are accessed
   current_jd_ = start_jd_ + elapsed_time_sec_ / (60.0 * 60.0 * 24.0);
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalendarDay(current_jd_);
+  InvalidateDerivedTimes();
 
   attitude_update_flag_ = false;
   if (double(attitude_update_counter_) * step_sec_ >= attitude_update_interval_sec_) {
@@ -175,7 +162,136 @@ void SimulationTime::UpdateTime(void) {
   state_.running = true;
 }
 
-void SimulationTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
+void SimulationTime::InvalidateDerivedTimes() {
+  // Called in UpdateTime before the concurrent spacecraft updates start
+  is_sidereal_time_updated_.store(false, std::memory_order_relaxed);
+  is_decimal_year_updated_.store(false, std::memory_order_relaxed);
+  is_utc_updated_.store(false, std::memory_order_relaxed);
+}
+
+EpochTime SimulationTime::GetCurrentEpochTime(void) const {
+  const double elapsed_integer_s = floor(elapsed_time_sec_);
+  double fraction_s = start_epoch_time_.GetFraction_s() + (elapsed_time_sec_ - elapsed_integer_s);
+  uint64_t time_s = start_epoch_time_.GetTime_s() + (uint64_t)elapsed_integer_s;
+  if (fraction_s >= 1.0) {
+    fraction_s -= 1.0;
+    time_s++;
+  }
+  return EpochTime(time_s, fraction_s);
+}
+
+double SimulationTime::GetCurrentSiderealTime(void) const {
+  if (!is_sidereal_time_updated_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(derived_time_mutex_);
+    if (!is_sidereal_time_updated_.load(std::memory_order_relaxed)) {
+      current_sidereal_ = gstime(current_jd_);
+      is_sidereal_time_updated_.store(true, std::memory_order_release);
+    }
+  }
+  return current_sidereal_;
+}
+
+double SimulationTime::GetCurrentDecimalYear(void) const {
+  if (!is_decimal_year_updated_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(derived_time_mutex_);
+    if (!is_decimal_year_updated_.load(std::memory_order_relaxed)) {
+      JdToDecyear(current_jd_, &current_decyear_);
+      is_decimal_year_updated_.store(true, std::memory_order_release);
+    }
+  }
+  return current_decyear_;
+}
+
+const UTC SimulationTime::GetCurrentUtc(void) const {
+  if (!is_utc_updated_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(derived_time_mutex_);
+    if (!is_utc_updated_.load(std::memory_order_relaxed)) {
+      current_utc_ = ConvJDtoCalendarDay(current_jd_);
+      is_utc_updated_.store(true, std::memory_order_release);
+    }
+  }
+  return current_utc_;
+}
+
+int SimulationTime::CalcStepsToNextEvent() const {
+  // Number of steps until the counter satisfies counter * step_sec_ >= interval_sec as the flag judgement in UpdateTime
+  auto calc_steps = [&](const int counter, const double interval_sec) {
+    int due_counter = (int)ceil(interval_sec / step_sec_);
+    while (due_counter > 0 && double(due_counter - 1) * step_sec_ >= interval_sec) due_counter--;
+    while (double(due_counter) * step_sec_ < interval_sec) due_counter++;
+    return std::max(due_counter - counter, 1);
+  };
+
+  int number_of_steps = calc_steps(attitude_update_counter_, attitude_update_interval_sec_);
+  number_of_steps = std::min(number_of_steps, calc_steps(orbit_update_counter_, orbit_update_interval_sec_));
+  number_of_steps = std::min(number_of_steps, calc_steps(thermal_update_counter_, thermal_update_interval_sec_));
+  number_of_steps = std::min(number_of_steps, calc_steps(component_update_counter_, component_update_interval_sec_));
+  number_of_steps = std::min(number_of_steps, calc_steps(log_counter_, log_output_interval_sec_));
+  number_of_steps = std::min(number_of_steps, std::max((int)ceil(display_period_) - display_counter_, 1));
+  return number_of_steps;
+}
+
+void SimulationTime::ResetClock(void) { real_time_pacer_.Start(elapsed_time_sec_); }
+
+void SimulationTime::PrintRealTimePacingStatistics() const {
+  if (simulation_speed_ > 0) {
+    real_time_pacer_.PrintStatistics();
+    real_time_deadline_monitor_.PrintStatistics();
+  }
+}
+
+void SimulationTime::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("SIMULATION_TIME");
+  snapshot.Write(start_jd_);
+  snapshot.Write(step_sec_);
+  snapshot.Write(elapsed_time_sec_);
+  snapshot.Write(current_jd_);
+  snapshot.Write(GetCurrentSiderealTime());
+  snapshot.Write(GetCurrentDecimalYear());
+  snapshot.Write(GetCurrentUtc());
+  snapshot.Write(attitude_update_counter_);
+  snapshot.Write(attitude_update_flag_);
+  snapshot.Write(orbit_update_counter_);
+  snapshot.Write(orbit_update_flag_);
+  snapshot.Write(thermal_update_counter_);
+  snapshot.Write(thermal_update_flag_);
+  snapshot.Write(component_update_counter_);
+  snapshot.Write(component_update_flag_);
+  snapshot.Write(log_counter_);
+  snapshot.Write(display_counter_);
+  snapshot.Write(state_);
+}
+
+void SimulationTime::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("SIMULATION_TIME");
+  double start_jd, step_sec;
+  snapshot.Read(start_jd);
+  snapshot.Read(step_sec);
+  if (start_jd != start_jd_ || step_sec != step_sec_) {
+    throw std::invalid_argument("Snapshot is made with the different start time or step width of the simulation.");
+  }
+  snapshot.Read(elapsed_time_sec_);
+  snapshot.Read(current_jd_);
+  snapshot.Read(current_sidereal_);
+  snapshot.Read(current_decyear_);
+  snapshot.Read(current_utc_);
+  is_sidereal_time_updated_.store(true, std::memory_order_relaxed);
+  is_decimal_year_updated_.store(true, std::memory_order_relaxed);
+  is_utc_updated_.store(true, std::memory_order_relaxed);
+  snapshot.Read(attitude_update_counter_);
+  snapshot.Read(attitude_update_flag_);
+  snapshot.Read(orbit_update_counter_);
+  snapshot.Read(orbit_update_flag_);
+  snapshot.Read(thermal_update_counter_);
+  snapshot.Read(thermal_update_flag_);
+  snapshot.Read(component_update_counter_);
+  snapshot.Read(component_update_flag_);
+  snapshot.Read(log_counter_);
+  snapshot.Read(display_counter_);
+  snapshot.Read(state_);
+  // The end time can be changed from the snapshot
+  state_.finish = elapsed_time_sec_ > end_sec_;
+}
 
 void SimulationTime::PrintStartDateTime(void) const {
   int sec_int = int(start_sec_ + 0.5);
@@ -204,6 +320,13 @@ string SimulationTime::GetLogHeader() const {
 
   str_tmp += WriteScalar("elapsed_time", "s");
   str_tmp += WriteScalar("time", "UTC");
+  // Pacing statistics only in the real time simulation
+  if (simulation_speed_ > 0) {
+    str_tmp += WriteScalar("real_time_lateness", "s");
+    str_tmp += WriteScalar("real_time_max_lateness", "s");
+    str_tmp += WriteScalar("real_time_number_of_overruns", "");
+    if (real_time_deadline_monitor_.IsEnabled()) str_tmp += WriteScalar("real_time_degradation_actions", "");
+  }
 
   return str_tmp;
 }
@@ -215,12 +338,21 @@ string SimulationTime::GetLogValue() const {
 
   const char kSize = 100;
   char ymdhms[kSize];
-  double sec_floor = floor(current_utc_.second * 1e3) / 1e3;
+  const UTC current_utc = GetCurrentUtc();
+  double sec_floor = floor(current_utc.second * 1e3) / 1e3;
 
-  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f,", current_utc_.year, current_utc_.month, current_utc_.day, current_utc_.hour,
-           current_utc_.minute, sec_floor);
+  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f,", current_utc.year, current_utc.month, current_utc.day, current_utc.hour,
+           current_utc.minute, sec_floor);
   str_tmp += ymdhms;
 
+  if (simulation_speed_ > 0) {
+    const RealTimePacingStatistics& statistics = real_time_pacer_.GetStatistics();
+    str_tmp += WriteScalar(statistics.last_lateness_s);
+    str_tmp += WriteScalar(statistics.max_lateness_s);
+    str_tmp += WriteScalar(statistics.number_of_overruns);
+    if (real_time_deadline_monitor_.IsEnabled()) str_tmp += WriteScalar(real_time_deadline_monitor_.GetActiveActions());
+  }
+
   return str_tmp;
 }
 
@@ -232,16 +364,18 @@ void SimulationTime::InitializeState() {
 }
 
 // wrapper function of invjday @ sgp4ext for interface adjustment
-void SimulationTime::ConvJDtoCalendarDay(const double JD) {
+UTC SimulationTime::ConvJDtoCalendarDay(const double JD) {
   int year, mon, day, hr, minute;
   double sec;
   invjday(JD, year, mon, day, hr, minute, sec);
-  current_utc_.year = (unsigned int)(year);
-  current_utc_.month = (unsigned int)(mon);
-  current_utc_.day = (unsigned int)(day);
-  current_utc_.hour = (unsigned int)(hr);
-  current_utc_.minute = (unsigned int)(minute);
-  current_utc_.second = sec;
+  UTC utc;
+  utc.year = (unsigned int)(year);
+  utc.month = (unsigned int)(mon);
+  utc.day = (unsigned int)(day);
+  utc.hour = (unsigned int)(hr);
+  utc.minute = (unsigned int)(minute);
+  utc.second = sec;
+  return utc;
 }
 
 SimulationTime* InitSimulationTime(std::string file_name) {
@@ -272,6 +406,27 @@ SimulationTime* InitSimulationTime(std::string file_name) {
   SimulationTime* simTime = new SimulationTime(end_sec, step_sec, attitude_update_interval_sec, attitude_rk_step_sec, orbit_update_interval_sec,
                                                orbit_rk_step_sec, thermal_update_interval_sec, thermal_rk_step_sec, compo_propagate_step_sec,
                                                log_output_interval_sec, start_ymdhms.c_str(), sim_speed);
+  simTime->SetEventDrivenTimeAdvance(ini_file.ReadEnable(section, "event_driven_time_advance"));
+  simTime->SetRealTimeOverrunMode(ConvertRealTimeOverrunMode(ini_file.ReadString(section, "real_time_overrun_mode")));
+  simTime->SetRealTimeSpinDuration_s(ini_file.ReadDouble(section, "real_time_spin_duration_s"));
+
+  // Degradation of the calculation after the steps near or after the deadline
+  unsigned int degradation_actions = 0;
+  if (ini_file.ReadEnable(section, "real_time_degradation_hold_disturbances")) degradation_actions |= kRealTimeDegradationHoldDisturbances;
+  if (ini_file.ReadEnable(section, "real_time_degradation_defer_logging")) degradation_actions |= kRealTimeDegradationDeferLogging;
+  if (ini_file.ReadEnable(section, "real_time_degradation_reduce_geopotential")) degradation_actions |= kRealTimeDegradationReduceGeopotential;
+  if (degradation_actions != 0 && sim_speed > 0) {
+    // The threshold is the ratio of the wall clock time of a step
+    const double slack_threshold_s = ini_file.ReadDouble(section, "real_time_degradation_slack_ratio") * step_sec / sim_speed;
+    const int recovery_steps = ini_file.ReadInt(section, "real_time_degradation_recovery_steps");
+    const int reduced_geopotential_degree = ini_file.ReadInt(section, "real_time_degradation_geopotential_degree");
+    const double expensive_disturbance_time_s = ini_file.ReadDouble(section, "real_time_degradation_expensive_disturbance_time_s");
+    if (recovery_steps < 0 || reduced_geopotential_degree < 0) {
+      throw std::invalid_argument("InitSimulationTime: real_time_degradation recovery steps and geopotential degree must not be negative.");
+    }
+    simTime->SetRealTimeDeadlineMonitor(RealTimeDeadlineMonitor(degradation_actions, slack_threshold_s, (size_t)recovery_steps,
+                                                                (size_t)reduced_geopotential_degree, expensive_disturbance_time_s));
+  }
 
   return simTime;
 }
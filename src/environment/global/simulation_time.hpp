@@ -10,11 +10,15 @@
 #define _WINSOCKAPI_  // stops windows.h including winsock.h
 #endif
 
+#include <atomic>
+#include <mutex>
 #include <string>
-// #include <time.h>
-#include <chrono>
 
 #include "logger/loggable.hpp"
+#include "math_physics/time_system/epoch_time.hpp"
+#include "real_time_deadline_monitor.hpp"
+#include "real_time_pacer.hpp"
+#include "utilities/snapshot.hpp"
 #include "math_physics/orbit/sgp4/sgp4ext.h"
 #include "math_physics/orbit/sgp4/sgp4io.h"
 #include "math_physics/orbit/sgp4/sgp4unit.h"
@@ -89,8 +93,61 @@ class SimulationTime : public ILoggable {
   /**
    *@fn ResetClock
    *@brief Reset simulation start time as PC’s time
+   *@note The start time is shifted by the elapsed time so that the simulation restored from the snapshot keeps the real time.
    */
   void ResetClock(void);
+  /**
+   *@fn SaveSnapshot
+   *@brief Write the elapsed time and the update counters to the snapshot
+   *@param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   *@fn LoadSnapshot
+   *@brief Restore the elapsed time and the update counters from the snapshot
+   *@note Throws std::invalid_argument when the start time or the step width is different from the snapshot. The end time can be changed.
+   *@param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+  /**
+   *@fn SetEventDrivenTimeAdvance
+   *@brief Set the time advance mode
+   *@param [in] is_event_driven: When true, UpdateTime skips the steps where no update flag is set
+   */
+  inline void SetEventDrivenTimeAdvance(const bool is_event_driven) { is_event_driven_ = is_event_driven; }
+  /**
+   *@fn SetRealTimeOverrunMode
+   *@brief Set handling of the steps finished after the wall clock deadline in the real time simulation
+   *@param [in] overrun_mode: Overrun handling mode
+   */
+  inline void SetRealTimeOverrunMode(const RealTimeOverrunMode overrun_mode) { real_time_pacer_.SetOverrunMode(overrun_mode); }
+  /**
+   *@fn SetRealTimeSpinDuration_s
+   *@brief Set the duration of the busy-wait before the wall clock deadline in the real time simulation
+   *@param [in] spin_duration_s: Spin duration [sec]
+   */
+  inline void SetRealTimeSpinDuration_s(const double spin_duration_s) { real_time_pacer_.SetSpinDuration_s(spin_duration_s); }
+  /**
+   *@fn SetRealTimeDeadlineMonitor
+   *@brief Set the deadline monitor to degrade the calculation after the steps near or after the deadline in the real time simulation
+   *@param [in] deadline_monitor: Deadline monitor
+   */
+  inline void SetRealTimeDeadlineMonitor(const RealTimeDeadlineMonitor& deadline_monitor) { real_time_deadline_monitor_ = deadline_monitor; }
+  /**
+   *@fn GetRealTimeDeadlineMonitor
+   *@brief Return the deadline monitor which has the degradation actions of the current step
+   */
+  inline const RealTimeDeadlineMonitor& GetRealTimeDeadlineMonitor() const { return real_time_deadline_monitor_; }
+  /**
+   *@fn GetRealTimePacingStatistics
+   *@brief Return the statistics of the real time pacing after ResetClock
+   */
+  inline const RealTimePacingStatistics& GetRealTimePacingStatistics() const { return real_time_pacer_.GetStatistics(); }
+  /**
+   *@fn PrintRealTimePacingStatistics
+   *@brief Print the statistics of the real time pacing when the simulation speed is set
+   */
+  void PrintRealTimePacingStatistics() const;
 
   /**
    *@fn GetState
@@ -187,26 +244,41 @@ class SimulationTime : public ILoggable {
    *@brief Return current Julian day [day]
    */
   inline double GetCurrentTime_jd(void) const { return current_jd_; };
+  /**
+   *@fn GetCurrentEpochTime
+   *@brief Return current time as the epoch time with the integer seconds and the fraction
+   *@note The resolution does not depend on the date, while the Julian day in double has the resolution of about 40 us. The epoch time is not
+   *      available when the simulation starts before 1970.
+   */
+  EpochTime GetCurrentEpochTime(void) const;
   /**
    *@fn GetCurrentSiderealTime
    *@brief Return current sidereal day [day]
+   *@note Calculated at the first access in the step. Thread-safe for the concurrent spacecraft updates.
    */
-  inline double GetCurrentSiderealTime(void) const { return current_sidereal_; };
+  double GetCurrentSiderealTime(void) const;
   /**
    *@fn GetCurrentDecimalYear
    *@brief Return current decimal year [year]
+   *@note Calculated at the first access in the step. Thread-safe for the concurrent spacecraft updates.
    */
-  inline double GetCurrentDecimalYear(void) const { return current_decyear_; };
+  double GetCurrentDecimalYear(void) const;
   /**
    *@fn GetCurrentUtc
    *@brief Return current UTC calendar expression
+   *@note Calculated at the first access in the step. Thread-safe for the concurrent spacecraft updates.
    */
-  inline const UTC GetCurrentUtc(void) const { return current_utc_; };
+  const UTC GetCurrentUtc(void) const;
   /**
    *@fn GetCurrentEphemerisTime
    *@brief Return current Ephemeris time
    */
   inline double GetCurrentEphemerisTime(void) const { return start_ephemeris_time_ + elapsed_time_sec_; };
+  /**
+   *@fn GetStartEphemerisTime
+   *@brief Return simulation start Ephemeris Time
+   */
+  inline double GetStartEphemerisTime(void) const { return start_ephemeris_time_; };
 
   /**
    *@fn GetStartYear
@@ -261,9 +333,16 @@ class SimulationTime : public ILoggable {
   // Variables
   double elapsed_time_sec_;  //!< Elapsed time from start of simulation [sec]
   double current_jd_;        //!< Current Julian date [day]
-  double current_sidereal_;  //!< Current Greenwich sidereal time (GST) [day]
-  double current_decyear_;   //!< Current decimal year [year]
-  UTC current_utc_;          //!< UTC calendar day
+
+  // Derived time expressions calculated at the first access in the step
+  // The spacecraft read them concurrently, so the flags are released after the values are written under the mutex.
+  mutable double current_sidereal_;                            //!< Current Greenwich sidereal time (GST) [day]
+  mutable double current_decyear_;                             //!< Current decimal year [year]
+  mutable UTC current_utc_;                                    //!< UTC calendar day
+  mutable std::atomic<bool> is_sidereal_time_updated_{false};  //!< Current sidereal time is calculated in the step
+  mutable std::atomic<bool> is_decimal_year_updated_{false};   //!< Current decimal year is calculated in the step
+  mutable std::atomic<bool> is_utc_updated_{false};            //!< Current UTC is calculated in the step
+  mutable std::mutex derived_time_mutex_;                      //!< Mutex for the calculation of the derived time expressions
 
   // Timing controller
   int attitude_update_counter_;   //!< Update counter for attitude calculation
@@ -277,11 +356,11 @@ class SimulationTime : public ILoggable {
   int log_counter_;               //!< Update counter for log output
   int display_counter_;           //!< Update counter for display output
   TimeState state_;               //!< State of timing controller
+  bool is_event_driven_ = false;  //!< Skip the steps where no update flag is set
 
   // Calculation time measure
-  std::chrono::system_clock::time_point clock_start_time_millisec_;  //!< Simulation start time [ms]
-  // chrono::system_clock::time_point clock_elapsed_time_millisec_;  //!< Simulation elapsed time in real time simulation [ms]
-  std::chrono::system_clock::time_point clock_last_time_completed_step_in_time_;  //!< Simulation finished time [ms]
+  RealTimePacer real_time_pacer_;                       //!< Pacing controller of the real time simulation
+  RealTimeDeadlineMonitor real_time_deadline_monitor_;  //!< Degradation controller of the real time simulation
 
   // Constants
   double end_sec_;                        //!< Time from start of simulation to end [sec]
@@ -299,6 +378,7 @@ class SimulationTime : public ILoggable {
 
   double start_ephemeris_time_;  //!< Simulation start Ephemeris Time
   double start_jd_;              //!< Simulation start Julian date [day]
+  EpochTime start_epoch_time_;   //!< Simulation start epoch time
   int start_year_;               //!< Simulation start year
   int start_month_;              //!< Simulation start month
   int start_day_;                //!< Simulation start day
@@ -319,12 +399,22 @@ class SimulationTime : public ILoggable {
    * @brief Check the timing setting parameters are correct
    */
   void AssertTimeStepParams();
+  /**
+   * @fn CalcStepsToNextEvent
+   * @brief Calculate the number of steps until any update flag is set
+   */
+  int CalcStepsToNextEvent() const;
+  /**
+   * @fn InvalidateDerivedTimes
+   * @brief Mark the derived time expressions to be calculated at the next access
+   */
+  void InvalidateDerivedTimes();
   /**
    * @fn ConvJDtoCalendarDay
    * @brief Convert Julian date to UTC Calendar date
    * @note wrapper function of invjday @ sgp4ext for interface adjustment
    */
-  void ConvJDtoCalendarDay(const double JD);
+  static UTC ConvJDtoCalendarDay(const double JD);
 };
 
 /**
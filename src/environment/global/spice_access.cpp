@@ -0,0 +1,278 @@
+/**
+ * @file spice_access.cpp
+ * @brief Thread-safe access layer of the SPICE toolkit
+ */
+
+#include "spice_access.hpp"
+
+#include <SpiceUsr.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+
+/**
+ * @struct SpiceCache
+ * @brief Information cached by SpiceAccess. It must be accessed with the mutex locked.
+ */
+struct SpiceCache {
+  std::set<std::string> loaded_kernels_;        //!< Loaded kernel files
+  std::vector<std::string> on_demand_kernels_;  //!< Kernel files to be loaded at the first query of the states
+  std::map<std::string, int> body_ids_;         //!< NAIF ID codes of the body names
+  std::map<int, std::string> body_names_;       //!< Body names of the NAIF ID codes
+  std::set<std::string> not_found_body_names_;  //!< Body names which are not found
+};
+
+static SpiceCache& GetSpiceCache() {
+  static SpiceCache cache;
+  return cache;
+}
+
+static const int kMaxNameLength = 100;  //!< Maximum length of the body name
+
+/**
+ * @struct SpkSegment
+ * @brief Segment of an SPK file
+ */
+struct SpkSegment {
+  double descriptor[5];  //!< Segment descriptor
+  std::string name;      //!< Segment name
+  int body_id;           //!< NAIF ID code of the target body
+  int center_id;         //!< NAIF ID code of the center body
+  double begin_time;     //!< Start of the coverage (ephemeris time) [sec]
+  double end_time;       //!< End of the coverage (ephemeris time) [sec]
+};
+
+/**
+ * @fn ReadSpkSegments
+ * @brief Read the segments of the SPK file opened with dafopr_c. It must be called with the mutex locked.
+ * @param [in] handle: Handle of the file
+ */
+static std::vector<SpkSegment> ReadSpkSegments(const SpiceInt handle) {
+  std::vector<SpkSegment> segments;
+  SpiceBoolean found;
+  dafbfs_c(handle);
+  daffna_c(&found);
+  while (found == SPICETRUE) {
+    SpkSegment segment;
+    SpiceDouble double_components[2];
+    SpiceInt integer_components[6];
+    SpiceChar name[kMaxNameLength];
+    dafgs_c(segment.descriptor);
+    dafus_c(segment.descriptor, 2, 6, double_components, integer_components);
+    dafgn_c(kMaxNameLength, name);
+    segment.name = name;
+    segment.body_id = (int)integer_components[0];
+    segment.center_id = (int)integer_components[1];
+    segment.begin_time = double_components[0];
+    segment.end_time = double_components[1];
+    segments.push_back(segment);
+    daffna_c(&found);
+  }
+  return segments;
+}
+
+/**
+ * @fn AddCenterBodies
+ * @brief Add the centers of the segments of the bodies recursively until the solar system barycenter
+ * @param [in] segments: Segments of the SPK file
+ * @param [in] start_ephemeris_time: Start of the time span (ephemeris time) [sec]
+ * @param [in] end_ephemeris_time: End of the time span (ephemeris time) [sec]
+ * @param [in/out] body_ids: NAIF ID codes of the bodies
+ */
+static void AddCenterBodies(const std::vector<SpkSegment>& segments, const double start_ephemeris_time, const double end_ephemeris_time,
+                            std::set<int>& body_ids) {
+  bool is_added = true;
+  while (is_added) {
+    is_added = false;
+    for (const auto& segment : segments) {
+      if (segment.end_time < start_ephemeris_time || segment.begin_time > end_ephemeris_time) continue;
+      if (body_ids.count(segment.body_id) > 0 && body_ids.count(segment.center_id) == 0) {
+        body_ids.insert(segment.center_id);
+        is_added = true;
+      }
+    }
+  }
+}
+
+/**
+ * @fn IsFileReadable
+ * @brief Return true when the file can be opened
+ */
+static bool IsFileReadable(const std::string& file_name) { return std::ifstream(file_name).is_open(); }
+
+/**
+ * @fn LoadOnDemandKernels
+ * @brief Load the kernels registered by LoadKernelOnDemand. It must be called with the mutex locked.
+ */
+static void LoadOnDemandKernels() {
+  SpiceCache& cache = GetSpiceCache();
+  if (cache.on_demand_kernels_.empty()) return;
+  for (const auto& file_name : cache.on_demand_kernels_) {
+    if (cache.loaded_kernels_.count(file_name) > 0) continue;
+    furnsh_c(file_name.c_str());
+    cache.loaded_kernels_.insert(file_name);
+  }
+  cache.on_demand_kernels_.clear();
+  cache.body_ids_.clear();
+  cache.body_names_.clear();
+  cache.not_found_body_names_.clear();
+}
+
+void SpiceAccess::LoadKernel(const std::string& file_name) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceCache& cache = GetSpiceCache();
+  if (cache.loaded_kernels_.count(file_name) > 0) return;
+
+  furnsh_c(file_name.c_str());
+  cache.loaded_kernels_.insert(file_name);
+  // The conversion between the body names and IDs can be changed by the kernel
+  cache.body_ids_.clear();
+  cache.body_names_.clear();
+  cache.not_found_body_names_.clear();
+}
+
+void SpiceAccess::LoadKernelOnDemand(const std::string& file_name) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceCache& cache = GetSpiceCache();
+  if (cache.loaded_kernels_.count(file_name) > 0) return;
+  if (std::find(cache.on_demand_kernels_.begin(), cache.on_demand_kernels_.end(), file_name) != cache.on_demand_kernels_.end()) return;
+  cache.on_demand_kernels_.push_back(file_name);
+}
+
+bool SpiceAccess::ReplaceKernelOnDemand(const std::string& file_name, const std::string& new_file_name) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceCache& cache = GetSpiceCache();
+  auto kernel = std::find(cache.on_demand_kernels_.begin(), cache.on_demand_kernels_.end(), file_name);
+  if (kernel == cache.on_demand_kernels_.end()) return false;
+  *kernel = new_file_name;
+  return true;
+}
+
+bool SpiceAccess::ExtractSpkSubset(const std::string& source_file_name, const std::string& subset_file_name, const std::vector<int>& body_ids,
+                                   const double start_ephemeris_time, const double end_ephemeris_time) {
+  if (!IsFileReadable(source_file_name)) return false;
+
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceInt source_handle;
+  dafopr_c(source_file_name.c_str(), &source_handle);
+  const std::vector<SpkSegment> segments = ReadSpkSegments(source_handle);
+  std::set<int> needed_body_ids(body_ids.begin(), body_ids.end());
+  AddCenterBodies(segments, start_ephemeris_time, end_ephemeris_time, needed_body_ids);
+
+  // spkopn_c cannot overwrite the file
+  const std::string temporary_file_name = subset_file_name + ".tmp";
+  std::remove(temporary_file_name.c_str());
+  SpiceInt subset_handle;
+  spkopn_c(temporary_file_name.c_str(), "S2E SPK subset", 0, &subset_handle);
+  for (const auto& segment : segments) {
+    if (needed_body_ids.count(segment.body_id) == 0) continue;
+    const double begin_time = std::max(segment.begin_time, start_ephemeris_time);
+    const double end_time = std::min(segment.end_time, end_ephemeris_time);
+    if (begin_time > end_time) continue;
+    SpiceDouble descriptor[5];
+    std::copy(segment.descriptor, segment.descriptor + 5, descriptor);
+    spksub_c(source_handle, descriptor, segment.name.c_str(), begin_time, end_time, subset_handle);
+  }
+  spkcls_c(subset_handle);
+  dafcls_c(source_handle);
+
+  std::remove(subset_file_name.c_str());
+  return std::rename(temporary_file_name.c_str(), subset_file_name.c_str()) == 0;
+}
+
+bool SpiceAccess::IsSpkCovering(const std::string& file_name, const std::vector<int>& body_ids, const double start_ephemeris_time,
+                                const double end_ephemeris_time) {
+  if (!IsFileReadable(file_name)) return false;
+
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceInt handle;
+  dafopr_c(file_name.c_str(), &handle);
+  const std::vector<SpkSegment> segments = ReadSpkSegments(handle);
+  dafcls_c(handle);
+
+  std::set<int> needed_body_ids(body_ids.begin(), body_ids.end());
+  AddCenterBodies(segments, start_ephemeris_time, end_ephemeris_time, needed_body_ids);
+  for (const int body_id : needed_body_ids) {
+    if (body_id == 0) continue;  // Solar system barycenter is the origin
+    bool is_covered = false;
+    for (const auto& segment : segments) {
+      if (segment.body_id == body_id && segment.begin_time <= start_ephemeris_time && segment.end_time >= end_ephemeris_time) is_covered = true;
+    }
+    if (!is_covered) return false;
+  }
+  return true;
+}
+
+bool SpiceAccess::ConvertBodyNameToId(const std::string& body_name, int& body_id) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceCache& cache = GetSpiceCache();
+  auto cached_id = cache.body_ids_.find(body_name);
+  if (cached_id != cache.body_ids_.end()) {
+    body_id = cached_id->second;
+    return true;
+  }
+  if (cache.not_found_body_names_.count(body_name) > 0) return false;
+
+  SpiceInt id;
+  SpiceBoolean found;
+  bodn2c_c(body_name.c_str(), &id, &found);
+  if (found != SPICETRUE) {
+    cache.not_found_body_names_.insert(body_name);
+    return false;
+  }
+  cache.body_ids_[body_name] = (int)id;
+  body_id = (int)id;
+  return true;
+}
+
+std::string SpiceAccess::ConvertBodyIdToName(const int body_id) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceCache& cache = GetSpiceCache();
+  auto cached_name = cache.body_names_.find(body_id);
+  if (cached_name != cache.body_names_.end()) return cached_name->second;
+
+  SpiceChar name_buffer[kMaxNameLength];
+  SpiceBoolean found;
+  bodc2n_c((SpiceInt)body_id, kMaxNameLength, name_buffer, &found);
+  std::string name = "";
+  if (found == SPICETRUE) name = name_buffer;
+  cache.body_names_[body_id] = name;
+  return name;
+}
+
+void SpiceAccess::GetBodyConstants(const int body_id, const std::string& item, const int max_number_of_values, double* values) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceInt dim;
+  bodvcd_c((SpiceInt)body_id, item.c_str(), (SpiceInt)max_number_of_values, &dim, (SpiceDouble*)values);
+}
+
+void SpiceAccess::GetState(const std::string& target_name, const double ephemeris_time, const std::string& frame_name,
+                           const std::string& aberration_correction, const std::string& observer_name, double state[6]) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  LoadOnDemandKernels();
+  SpiceDouble light_time;
+  spkezr_c(target_name.c_str(), (SpiceDouble)ephemeris_time, frame_name.c_str(), aberration_correction.c_str(), observer_name.c_str(),
+           (SpiceDouble*)state, &light_time);
+}
+
+void SpiceAccess::GetStateTransformation(const std::string& from_frame_name, const std::string& to_frame_name, const double ephemeris_time,
+                                         double matrix[6][6]) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  LoadOnDemandKernels();
+  sxform_c(from_frame_name.c_str(), to_frame_name.c_str(), (SpiceDouble)ephemeris_time, (SpiceDouble(*)[6])matrix);
+}
+
+double SpiceAccess::ConvertStringToEphemerisTime(const std::string& time_string) {
+  std::lock_guard<std::mutex> lock(GetMutex());
+  SpiceDouble ephemeris_time;
+  str2et_c(time_string.c_str(), &ephemeris_time);
+  return (double)ephemeris_time;
+}
+
+std::mutex& SpiceAccess::GetMutex() {
+  static std::mutex spice_mutex;
+  return spice_mutex;
+}
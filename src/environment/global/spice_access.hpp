@@ -0,0 +1,141 @@
+/**
+ * @file spice_access.hpp
+ * @brief Thread-safe access layer of the SPICE toolkit
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_SPICE_ACCESS_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_SPICE_ACCESS_HPP_
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class SpiceAccess
+ * @brief Thread-safe access layer of the SPICE toolkit
+ * @details CSPICE is not thread-safe. All SPICE functions used in S2E are called through this class, which serializes them with a mutex.
+ *          The body name and ID conversions are cached since they do not change after the kernels are loaded.
+ *          The kernels registered by LoadKernelOnDemand are loaded at the first query of the states, so the large SPK files are not opened
+ *          when the states are not calculated with SPICE (e.g., ephemeris cache made from a compact subset, or environment replay).
+ *          Users who call CSPICE functions directly must lock the mutex given by GetMutex.
+ */
+class SpiceAccess {
+ public:
+  /**
+   * @fn LoadKernel
+   * @brief Load a SPICE kernel file. The file which is already loaded is not loaded again.
+   * @note Wrapper of furnsh_c
+   * @param [in] file_name: Path to the kernel file
+   */
+  static void LoadKernel(const std::string& file_name);
+  /**
+   * @fn LoadKernelOnDemand
+   * @brief Register a SPICE kernel file to be loaded at the first call of GetState or GetStateTransformation
+   * @param [in] file_name: Path to the kernel file
+   */
+  static void LoadKernelOnDemand(const std::string& file_name);
+  /**
+   * @fn ReplaceKernelOnDemand
+   * @brief Replace a kernel file registered by LoadKernelOnDemand before it is loaded (e.g., with its subset)
+   * @param [in] file_name: Path to the registered kernel file
+   * @param [in] new_file_name: Path to the kernel file to be loaded instead
+   * @return False when the file is not registered or already loaded
+   */
+  static bool ReplaceKernelOnDemand(const std::string& file_name, const std::string& new_file_name);
+
+  /**
+   * @fn ExtractSpkSubset
+   * @brief Write a compact SPK file which has only the segments of the bodies in the time span
+   * @details The segments of the centers of the bodies (e.g., the earth-moon barycenter for the earth) are also extracted to calculate the
+   *          states between any of the bodies. The file is written to a temporary file and renamed, so the processes which read the same
+   *          subset are not affected by the writing.
+   * @note Wrapper of spksub_c. The source file does not need to be loaded.
+   * @param [in] source_file_name: Path to the source SPK file
+   * @param [in] subset_file_name: Path to the subset SPK file to be written
+   * @param [in] body_ids: NAIF ID codes of the bodies
+   * @param [in] start_ephemeris_time: Start of the time span (ephemeris time) [sec]
+   * @param [in] end_ephemeris_time: End of the time span (ephemeris time) [sec]
+   * @return False when the source file cannot be read or the subset file cannot be written
+   */
+  static bool ExtractSpkSubset(const std::string& source_file_name, const std::string& subset_file_name, const std::vector<int>& body_ids,
+                               const double start_ephemeris_time, const double end_ephemeris_time);
+  /**
+   * @fn IsSpkCovering
+   * @brief Return true when the SPK file has the segments of the bodies and their centers over the time span
+   * @param [in] file_name: Path to the SPK file
+   * @param [in] body_ids: NAIF ID codes of the bodies
+   * @param [in] start_ephemeris_time: Start of the time span (ephemeris time) [sec]
+   * @param [in] end_ephemeris_time: End of the time span (ephemeris time) [sec]
+   */
+  static bool IsSpkCovering(const std::string& file_name, const std::vector<int>& body_ids, const double start_ephemeris_time,
+                            const double end_ephemeris_time);
+
+  /**
+   * @fn ConvertBodyNameToId
+   * @brief Convert the body name to the NAIF ID code
+   * @note Wrapper of bodn2c_c
+   * @param [in] body_name: Name of the body
+   * @param [out] body_id: NAIF ID code
+   * @return False when the name is not found
+   */
+  static bool ConvertBodyNameToId(const std::string& body_name, int& body_id);
+  /**
+   * @fn ConvertBodyIdToName
+   * @brief Convert the NAIF ID code to the body name
+   * @note Wrapper of bodc2n_c
+   * @param [in] body_id: NAIF ID code
+   * @return Name of the body. Empty string when the ID is not found.
+   */
+  static std::string ConvertBodyIdToName(const int body_id);
+  /**
+   * @fn GetBodyConstants
+   * @brief Get constants of the body from the kernel pool
+   * @note Wrapper of bodvcd_c
+   * @param [in] body_id: NAIF ID code
+   * @param [in] item: Name of the constants (e.g., GM, RADII)
+   * @param [in] max_number_of_values: Size of the output array
+   * @param [out] values: Values of the constants
+   */
+  static void GetBodyConstants(const int body_id, const std::string& item, const int max_number_of_values, double* values);
+
+  /**
+   * @fn GetState
+   * @brief Get the state (position and velocity) of the target body relative to the observer
+   * @note Wrapper of spkezr_c
+   * @param [in] target_name: Name of the target body
+   * @param [in] ephemeris_time: Ephemeris time [sec]
+   * @param [in] frame_name: Name of the reference frame
+   * @param [in] aberration_correction: Aberration correction setting
+   * @param [in] observer_name: Name of the observer body
+   * @param [out] state: Position [km] and velocity [km/s]
+   */
+  static void GetState(const std::string& target_name, const double ephemeris_time, const std::string& frame_name,
+                       const std::string& aberration_correction, const std::string& observer_name, double state[6]);
+  /**
+   * @fn GetStateTransformation
+   * @brief Get the state transformation matrix between the frames
+   * @note Wrapper of sxform_c
+   * @param [in] from_frame_name: Name of the source frame
+   * @param [in] to_frame_name: Name of the destination frame
+   * @param [in] ephemeris_time: Ephemeris time [sec]
+   * @param [out] matrix: State transformation matrix
+   */
+  static void GetStateTransformation(const std::string& from_frame_name, const std::string& to_frame_name, const double ephemeris_time,
+                                     double matrix[6][6]);
+  /**
+   * @fn ConvertStringToEphemerisTime
+   * @brief Convert the time string to the ephemeris time
+   * @note Wrapper of str2et_c
+   * @param [in] time_string: Time string (e.g., "jd 2451545.0")
+   * @return Ephemeris time [sec]
+   */
+  static double ConvertStringToEphemerisTime(const std::string& time_string);
+
+  /**
+   * @fn GetMutex
+   * @brief Return the mutex to serialize the SPICE function calls
+   */
+  static std::mutex& GetMutex();
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_SPICE_ACCESS_HPP_
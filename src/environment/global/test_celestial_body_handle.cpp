@@ -0,0 +1,33 @@
+/**
+ * @file test_celestial_body_handle.cpp
+ * @brief Test codes for CelestialBodyHandle struct with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "celestial_body_handle.hpp"
+
+/**
+ * @brief Test for the comparison of the valid and invalid handles
+ */
+TEST(CelestialBodyHandle, Equality) {
+  CelestialBodyHandle sun, earth, another_sun;
+  sun.index_ = 0;
+  sun.is_valid_ = true;
+  earth.index_ = 1;
+  earth.is_valid_ = true;
+  another_sun.index_ = 0;
+  another_sun.is_valid_ = true;
+  EXPECT_TRUE(sun == another_sun);
+  EXPECT_FALSE(sun == earth);
+
+  // The index of the invalid handles is not compared
+  CelestialBodyHandle invalid, invalid_with_index;
+  invalid_with_index.index_ = 3;
+  EXPECT_TRUE(invalid == invalid_with_index);
+  EXPECT_FALSE(invalid == sun);
+  EXPECT_FALSE(sun == invalid);
+
+  // The invalid handle with the same index as a valid handle
+  CelestialBodyHandle invalid_with_sun_index;
+  EXPECT_FALSE(invalid_with_sun_index == sun);
+}
@@ -0,0 +1,148 @@
+/**
+ * @file test_clock_generator.cpp
+ * @brief Test codes for ClockGenerator class and the batch tick of Component with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <components/base/component.hpp>
+#include <string>
+#include <vector>
+
+#include "clock_generator.hpp"
+
+namespace {
+std::vector<size_t> batch_sizes;           //!< Number of the tickables of each call of the batch tick function
+std::vector<std::string> called_routines;  //!< Routines called in the order
+
+/**
+ * @class CountingTickable
+ * @brief Tickable to record the calls of the batch tick function
+ */
+class CountingTickable : public ITickable {
+ public:
+  CountingTickable(const std::string& name, const unsigned int prescaler, const bool is_batched)
+      : name_(name), prescaler_(prescaler), is_batched_(is_batched) {}
+
+  void Tick(const unsigned int count) override {
+    if (count % prescaler_ == 0) called_routines.push_back(name_);
+  }
+  void FastTick(const unsigned int fast_count) override {
+    (void)fast_count;
+    called_routines.push_back(name_ + "_fast");
+  }
+  unsigned int GetPrescaler() const override { return prescaler_; }
+  BatchTickFunction GetBatchTickFunction() const override { return is_batched_ ? &BatchTick : nullptr; }
+
+ private:
+  std::string name_;
+  unsigned int prescaler_;
+  bool is_batched_;
+
+  static void BatchTick(ITickable* const* tickables, const size_t number_of_tickables, const unsigned int count) {
+    batch_sizes.push_back(number_of_tickables);
+    for (size_t i = 0; i < number_of_tickables; i++) tickables[i]->Tick(count);
+  }
+};
+
+/**
+ * @class BatchedComponent
+ * @brief Component ticked by TickBatch
+ */
+class BatchedComponent : public Component {
+ public:
+  BatchedComponent(const std::string& name, const unsigned int prescaler, ClockGenerator* clock_generator)
+      : Component(prescaler, clock_generator), name_(name) {}
+  BatchedComponent(const std::string& name, const unsigned int prescaler, ClockGenerator* clock_generator, PowerPort* power_port)
+      : Component(prescaler, clock_generator, power_port), name_(name) {}
+
+  void MainRoutine(const int time_count) override { called_routines.push_back(name_ + "@" + std::to_string(time_count)); }
+  void PowerOffRoutine() override { called_routines.push_back(name_ + "_off"); }
+  ITickable::BatchTickFunction GetBatchTickFunction() const override { return GetBatchTickFunctionOf<BatchedComponent>(); }
+
+ protected:
+  std::string name_;
+};
+
+/**
+ * @class DerivedComponent
+ * @brief Component derived from BatchedComponent which overrides MainRoutine
+ */
+class DerivedComponent : public BatchedComponent {
+ public:
+  DerivedComponent(const std::string& name, const unsigned int prescaler, ClockGenerator* clock_generator)
+      : BatchedComponent(name, prescaler, clock_generator) {}
+
+  void MainRoutine(const int time_count) override { called_routines.push_back(name_ + "_derived@" + std::to_string(time_count)); }
+};
+}  // namespace
+
+/**
+ * @brief Test for the grouping of the consecutive due tickables with the same batch tick function
+ */
+TEST(ClockGenerator, BatchTickGrouping) {
+  ClockGenerator clock_generator;
+  CountingTickable a("a", 1, true), b("b", 2, true), c("c", 1, true), d("d", 1, false), e("e", 1, true);
+  for (ITickable* tickable : std::vector<ITickable*>{&a, &b, &c, &d, &e}) clock_generator.RegisterComponent(tickable);
+  clock_generator.ClearTimerCount();
+
+  // b is due only at the even counts, and d breaks the run
+  batch_sizes.clear();
+  called_routines.clear();
+  clock_generator.TickToComponents();
+  EXPECT_EQ((std::vector<size_t>{3, 1}), batch_sizes);
+  EXPECT_EQ((std::vector<std::string>{"a", "b", "c", "d", "e"}), called_routines);
+
+  batch_sizes.clear();
+  called_routines.clear();
+  clock_generator.TickToComponents();
+  EXPECT_EQ((std::vector<size_t>{2, 1}), batch_sizes);
+  EXPECT_EQ((std::vector<std::string>{"a", "c", "d", "e"}), called_routines);
+
+  // The fast tick of a breaks the run since it is called between a and b
+  a.SetNeedsFastUpdate(true);
+  batch_sizes.clear();
+  called_routines.clear();
+  clock_generator.TickToComponents();
+  EXPECT_EQ((std::vector<size_t>{1, 2, 1}), batch_sizes);
+  EXPECT_EQ((std::vector<std::string>{"a", "a_fast", "b", "c", "d", "e"}), called_routines);
+
+  // The sleeping tickable is removed from the run
+  a.SetNeedsFastUpdate(false);
+  c.SetIsSleeping(true);
+  batch_sizes.clear();
+  called_routines.clear();
+  clock_generator.TickToComponents();
+  EXPECT_EQ((std::vector<size_t>{1, 1}), batch_sizes);
+  EXPECT_EQ((std::vector<std::string>{"a", "d", "e"}), called_routines);
+}
+
+/**
+ * @brief Test for TickBatch of Component against the tick of each component
+ */
+TEST(ClockGenerator, TickBatch) {
+  ClockGenerator clock_generator;
+  PowerPort power_port(0, 1.0);
+  BatchedComponent first("first", 1, &clock_generator);
+  BatchedComponent second("second", 2, &clock_generator);
+  DerivedComponent derived("derived", 1, &clock_generator);
+  BatchedComponent third("third", 1, &clock_generator);
+  BatchedComponent off("off", 1, &clock_generator, &power_port);
+
+  // Only the components whose concrete type is the template argument are batched
+  EXPECT_NE(nullptr, first.GetBatchTickFunction());
+  EXPECT_EQ(nullptr, derived.GetBatchTickFunction());
+
+  clock_generator.ClearTimerCount();
+  called_routines.clear();
+  clock_generator.TickToComponents();
+  clock_generator.TickToComponents();
+  const std::vector<std::string> expected_routines = {"first@0", "second@0", "derived_derived@0", "third@0", "off_off",
+                                                      "first@1", "derived_derived@1", "third@1", "off_off"};
+  EXPECT_EQ(expected_routines, called_routines);
+
+  // The power on is reflected at the next tick
+  power_port.SetVoltage_V(5.0);
+  called_routines.clear();
+  clock_generator.TickToComponents();
+  EXPECT_EQ((std::vector<std::string>{"first@2", "second@2", "derived_derived@2", "third@2", "off@2"}), called_routines);
+}
@@ -0,0 +1,159 @@
+/**
+ * @file test_real_time_pacer.cpp
+ * @brief Test codes for RealTimePacer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "real_time_pacer.hpp"
+
+namespace {
+/**
+ * @fn GetElapsedTime_s
+ * @brief Return the wall clock time from the start [s]
+ */
+double GetElapsedTime_s(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+/**
+ * @brief Test for the conversion of the setting string
+ */
+TEST(RealTimePacer, ConvertOverrunMode) {
+  EXPECT_EQ(RealTimeOverrunMode::kSkipTime, ConvertRealTimeOverrunMode(""));
+  EXPECT_EQ(RealTimeOverrunMode::kSkipTime, ConvertRealTimeOverrunMode("SKIP_TIME"));
+  EXPECT_EQ(RealTimeOverrunMode::kCatchUp, ConvertRealTimeOverrunMode("CATCH_UP"));
+  EXPECT_EQ(RealTimeOverrunMode::kRebase, ConvertRealTimeOverrunMode("REBASE"));
+  EXPECT_EQ(RealTimeOverrunMode::kSkipTime, ConvertRealTimeOverrunMode("UNKNOWN"));
+}
+
+/**
+ * @brief Test for the average and the standard deviation of the lateness
+ */
+TEST(RealTimePacer, Statistics) {
+  RealTimePacingStatistics statistics;
+  EXPECT_DOUBLE_EQ(0.0, statistics.GetAverageLateness_s());
+  EXPECT_DOUBLE_EQ(0.0, statistics.GetLatenessStandardDeviation_s());
+
+  const double latenesses_s[] = {1.0e-4, 3.0e-4, 2.0e-4, 6.0e-4};
+  for (const double lateness_s : latenesses_s) {
+    statistics.number_of_steps++;
+    statistics.sum_lateness_s += lateness_s;
+    statistics.sum_lateness2_s2 += lateness_s * lateness_s;
+  }
+  EXPECT_NEAR(3.0e-4, statistics.GetAverageLateness_s(), 1e-15);
+  EXPECT_NEAR(sqrt(3.5e-8), statistics.GetLatenessStandardDeviation_s(), 1e-12);
+}
+
+/**
+ * @brief Test for the steps in time with the simulation speed
+ */
+TEST(RealTimePacer, InTime) {
+  RealTimePacer pacer(2.0);
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  pacer.Start(0.0);
+  // The deadlines are absolute, so the steps do not accumulate the sleep errors
+  for (size_t step = 1; step <= 10; step++) {
+    EXPECT_DOUBLE_EQ(step * 0.01, pacer.Wait(step * 0.01));
+  }
+  EXPECT_GE(GetElapsedTime_s(start), 0.05);
+
+  const RealTimePacingStatistics& statistics = pacer.GetStatistics();
+  EXPECT_EQ(10u, statistics.number_of_steps);
+  EXPECT_GE(statistics.GetAverageLateness_s(), 0.0);
+  EXPECT_GE(statistics.max_lateness_s, statistics.last_lateness_s);
+  EXPECT_LE(statistics.total_sleep_time_s, 0.05);
+
+  // The start is shifted for the elapsed time restored from the snapshot
+  const std::chrono::steady_clock::time_point restart = std::chrono::steady_clock::now();
+  pacer.Start(100.0);
+  EXPECT_EQ(0u, pacer.GetStatistics().number_of_steps);
+  pacer.Wait(100.02);
+  const double restart_elapsed_time_s = GetElapsedTime_s(restart);
+  EXPECT_GE(restart_elapsed_time_s, 0.01);
+  EXPECT_LT(restart_elapsed_time_s, 1.0);
+}
+
+/**
+ * @brief Test for the handling of the overrun in each mode
+ */
+TEST(RealTimePacer, Overrun) {
+  // The delayed steps are executed without sleep, and the deadlines are kept
+  {
+    RealTimePacer pacer(1.0, RealTimeOverrunMode::kCatchUp);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pacer.Start(0.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_DOUBLE_EQ(0.01, pacer.Wait(0.01));
+    EXPECT_EQ(1u, pacer.GetStatistics().number_of_overruns);
+    EXPECT_GE(pacer.GetStatistics().max_overrun_s, 0.02);
+    EXPECT_LT(pacer.GetStatistics().last_slack_s, -0.02);
+    pacer.Wait(0.05);
+    EXPECT_GE(GetElapsedTime_s(start), 0.05);
+  }
+  // The following deadlines are shifted by the overrun
+  {
+    RealTimePacer pacer(1.0, RealTimeOverrunMode::kRebase);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pacer.Start(0.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_DOUBLE_EQ(0.01, pacer.Wait(0.01));
+    const double overrun_s = pacer.GetStatistics().max_overrun_s;
+    EXPECT_GE(overrun_s, 0.02);
+    pacer.Wait(0.03);
+    EXPECT_GE(GetElapsedTime_s(start), 0.03 + overrun_s);
+    EXPECT_EQ(1u, pacer.GetStatistics().number_of_overruns);
+  }
+  // The simulation time jumps to the wall clock time only after the overrun continues longer than the limit
+  {
+    RealTimePacer pacer(1.0, RealTimeOverrunMode::kSkipTime, 0.1);
+    pacer.Start(0.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_DOUBLE_EQ(0.001, pacer.Wait(0.001));
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_GE(pacer.Wait(0.002), 0.16);
+    EXPECT_EQ(2u, pacer.GetStatistics().number_of_overruns);
+  }
+}
+
+/**
+ * @brief Test for the busy-wait before the deadline
+ */
+TEST(RealTimePacer, SpinPhase) {
+  // The sleep ends at the deadline minus the spin duration
+  {
+    RealTimePacer pacer;
+    pacer.SetSpinDuration_s(0.01);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pacer.Start(0.0);
+    pacer.Wait(0.03);
+    EXPECT_GE(GetElapsedTime_s(start), 0.03);
+    EXPECT_LE(pacer.GetStatistics().total_sleep_time_s, 0.02);
+    EXPECT_GT(pacer.GetStatistics().total_sleep_time_s, 0.01);
+    EXPECT_GE(pacer.GetStatistics().last_lateness_s, 0.0);
+    EXPECT_EQ(0u, pacer.GetStatistics().number_of_overruns);
+  }
+  // The spin duration longer than the step does not sleep
+  {
+    RealTimePacer pacer;
+    pacer.SetSpinDuration_s(1.0);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pacer.Start(0.0);
+    pacer.Wait(0.01);
+    EXPECT_GE(GetElapsedTime_s(start), 0.01);
+    EXPECT_DOUBLE_EQ(0.0, pacer.GetStatistics().total_sleep_time_s);
+  }
+  // The negative spin duration is treated as zero
+  {
+    RealTimePacer pacer;
+    pacer.SetSpinDuration_s(-1.0);
+    pacer.Start(0.0);
+    pacer.Wait(0.01);
+    EXPECT_GT(pacer.GetStatistics().total_sleep_time_s, 0.005);
+    EXPECT_LE(pacer.GetStatistics().total_sleep_time_s, 0.01);
+  }
+}
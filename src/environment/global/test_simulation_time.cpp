@@ -0,0 +1,106 @@
+/**
+ * @file test_simulation_time.cpp
+ * @brief Test codes for SimulationTime class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "simulation_time.hpp"
+
+/**
+ * @brief Test for the lazy derived time expressions against the eager formulas after UpdateTime
+ */
+TEST(SimulationTime, DerivedTimes) {
+  SimulationTime simulation_time(100.0, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 1.0, "2020/04/01 12:00:00.0", 0.0);
+  for (size_t step = 0; step < 25; step++) {
+    simulation_time.UpdateTime();
+    const double current_time_jd = simulation_time.GetCurrentTime_jd();
+    double decimal_year;
+    JdToDecyear(current_time_jd, &decimal_year);
+    int year, month, day, hour, minute;
+    double second;
+    invjday(current_time_jd, year, month, day, hour, minute, second);
+
+    // The second access returns the cached values
+    for (size_t access = 0; access < 2; access++) {
+      EXPECT_DOUBLE_EQ(gstime(current_time_jd), simulation_time.GetCurrentSiderealTime());
+      EXPECT_DOUBLE_EQ(decimal_year, simulation_time.GetCurrentDecimalYear());
+      const UTC utc = simulation_time.GetCurrentUtc();
+      EXPECT_EQ((unsigned int)year, utc.year);
+      EXPECT_EQ((unsigned int)month, utc.month);
+      EXPECT_EQ((unsigned int)day, utc.day);
+      EXPECT_EQ((unsigned int)hour, utc.hour);
+      EXPECT_EQ((unsigned int)minute, utc.minute);
+      EXPECT_DOUBLE_EQ(second, utc.second);
+    }
+  }
+  EXPECT_EQ(2020u, simulation_time.GetCurrentUtc().year);
+  EXPECT_EQ(4u, simulation_time.GetCurrentUtc().month);
+  EXPECT_NEAR(2.5, simulation_time.GetCurrentUtc().second, 1e-4);  // Limited by the resolution of the Julian day
+}
+
+/**
+ * @brief Test for the first access of the derived time expressions from several threads in the same step
+ */
+TEST(SimulationTime, ConcurrentAccess) {
+  SimulationTime simulation_time(100.0, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 1.0, "2020/04/01 12:00:00.0", 0.0);
+  const size_t number_of_threads = 4;
+  for (size_t step = 0; step < 50; step++) {
+    simulation_time.UpdateTime();
+    const double expected_sidereal_time = gstime(simulation_time.GetCurrentTime_jd());
+    std::vector<double> sidereal_times(number_of_threads), seconds(number_of_threads);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < number_of_threads; i++) {
+      threads.emplace_back([&, i]() {
+        sidereal_times[i] = simulation_time.GetCurrentSiderealTime();
+        seconds[i] = simulation_time.GetCurrentUtc().second;
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    for (size_t i = 0; i < number_of_threads; i++) {
+      EXPECT_DOUBLE_EQ(expected_sidereal_time, sidereal_times[i]);
+      EXPECT_DOUBLE_EQ(seconds[0], seconds[i]);
+    }
+  }
+}
+
+/**
+ * @brief Test for the snapshot round trip
+ */
+TEST(SimulationTime, Snapshot) {
+  SimulationTime original_time(100.0, 0.1, 0.2, 0.1, 0.3, 0.1, 0.5, 0.1, 0.1, 1.0, "2020/04/01 12:00:00.0", 0.0);
+  for (size_t step = 0; step < 13; step++) original_time.UpdateTime();
+  std::stringstream stream;
+  SnapshotWriter writer(stream);
+  original_time.SaveSnapshot(writer);
+  ASSERT_TRUE(writer.IsGood());
+
+  SimulationTime restored_time(100.0, 0.1, 0.2, 0.1, 0.3, 0.1, 0.5, 0.1, 0.1, 1.0, "2020/04/01 12:00:00.0", 0.0);
+  SnapshotReader reader(stream);
+  restored_time.LoadSnapshot(reader);
+
+  // The update flags and the counters continue as the original
+  for (size_t step = 0; step < 20; step++) {
+    EXPECT_DOUBLE_EQ(original_time.GetElapsedTime_s(), restored_time.GetElapsedTime_s());
+    EXPECT_DOUBLE_EQ(original_time.GetCurrentTime_jd(), restored_time.GetCurrentTime_jd());
+    EXPECT_DOUBLE_EQ(original_time.GetCurrentSiderealTime(), restored_time.GetCurrentSiderealTime());
+    EXPECT_EQ(original_time.GetAttitudePropagateFlag(), restored_time.GetAttitudePropagateFlag());
+    EXPECT_EQ(original_time.GetOrbitPropagateFlag(), restored_time.GetOrbitPropagateFlag());
+    EXPECT_EQ(original_time.GetThermalPropagateFlag(), restored_time.GetThermalPropagateFlag());
+    EXPECT_EQ(original_time.GetState().log_output, restored_time.GetState().log_output);
+    original_time.UpdateTime();
+    restored_time.UpdateTime();
+  }
+
+  // The snapshot with the different step width is rejected
+  std::stringstream other_stream;
+  SnapshotWriter other_writer(other_stream);
+  original_time.SaveSnapshot(other_writer);
+  SimulationTime other_time(100.0, 0.2, 0.2, 0.2, 0.4, 0.2, 0.6, 0.2, 0.2, 1.0, "2020/04/01 12:00:00.0", 0.0);
+  SnapshotReader other_reader(other_stream);
+  EXPECT_THROW(other_time.LoadSnapshot(other_reader), std::invalid_argument);
+}
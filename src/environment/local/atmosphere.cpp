@@ -5,6 +5,8 @@
 
 #include "atmosphere.hpp"
 
+#include <cmath>
+
 #include "logger/log_utility.hpp"
 #include "math_physics/atmosphere/harris_priester_model.hpp"
 #include "math_physics/atmosphere/simple_air_density_model.hpp"
@@ -19,12 +21,14 @@ Atmosphere::Atmosphere(const std::string model, const std::string space_weather_
                        const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time)
     : model_(model),
       air_density_kg_m3_(0.0),
+      space_weather_table_(std::make_shared<const nrlmsise_space_weather_table>()),
       is_manual_param_used_(is_manual_param),
       manual_daily_f107_(manual_f107),
       manual_average_f107_(manual_f107a),
       manual_ap_(manual_ap),
       gauss_standard_deviation_rate_(gauss_standard_deviation_rate),
       local_celestial_information_(local_celestial_information) {
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
   if (model_ == "STANDARD") {
     // Standard
     std::cerr << "Air density model : STANDARD" << std::endl;
@@ -52,22 +56,38 @@ Atmosphere::Atmosphere(const std::string model, const std::string space_weather_
 
 double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const Orbit& orbit) {
   if (!is_calc_enabled_) return 0;
+  libra::Vector<3> sun_direction_i(0.0);
+  if (model_ == "HARRIS_PRIESTER") {
+    sun_direction_i = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m(sun_).CalcNormalizedVector();
+  }
+  return CalcAirDensityAtPosition_kg_m3(decimal_year, orbit.GetGeodeticPosition(), sun_direction_i);
+}
+
+double Atmosphere::CalcAirDensity_kg_m3(const LocalEnvironmentState& state) {
+  if (!is_calc_enabled_) return 0;
+  return CalcAirDensityAtPosition_kg_m3(state.decimal_year, state.geodetic_position, state.sun_direction_from_center_i);
+}
 
+double Atmosphere::CalcAirDensityAtPosition_kg_m3(const double decimal_year, const GeodeticPosition& position,
+                                                  const libra::Vector<3>& sun_direction_i) {
   if (model_ == "STANDARD") {
     // Standard model
-    double altitude_m = orbit.GetGeodeticPosition().GetAltitude_m();
+    double altitude_m = position.GetAltitude_m();
     air_density_kg_m3_ = libra::atmosphere::CalcAirDensityWithSimpleModel(altitude_m);
   } else if (model_ == "NRLMSISE00") {
     // NRLMSISE00 model
-    double lat_rad = orbit.GetGeodeticPosition().GetLatitude_rad();
-    double lon_rad = orbit.GetGeodeticPosition().GetLongitude_rad();
-    double alt_m = orbit.GetGeodeticPosition().GetAltitude_m();
-    air_density_kg_m3_ = CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, space_weather_table_, is_manual_param_used_, manual_daily_f107_,
-                                        manual_average_f107_, manual_ap_);
+    double lat_rad = position.GetLatitude_rad();
+    double lon_rad = position.GetLongitude_rad();
+    double alt_m = position.GetAltitude_m();
+    if (is_nrlmsise00_cache_enabled_) {
+      air_density_kg_m3_ = CalcNrlmsise00WithCache(decimal_year, lat_rad, lon_rad, alt_m);
+    } else {
+      air_density_kg_m3_ = CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, *space_weather_table_, is_manual_param_used_, manual_daily_f107_,
+                                          manual_average_f107_, manual_ap_);
+    }
   } else if (model_ == "HARRIS_PRIESTER") {
     // Harris-Priester
-    libra::Vector<3> sun_direction_eci = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("SUN").CalcNormalizedVector();
-    air_density_kg_m3_ = libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(orbit.GetGeodeticPosition(), sun_direction_eci);
+    air_density_kg_m3_ = libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(position, sun_direction_i);
   } else {
     // No suitable model
     return air_density_kg_m3_ = 0.0;
@@ -76,6 +96,52 @@ double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const Orbit&
   return AddNoise(air_density_kg_m3_);
 }
 
+void Atmosphere::EnableNrlmsise00Cache(const libra::atmosphere::DensityGridCache::Settings& settings) {
+  nrlmsise00_cache_ = libra::atmosphere::DensityGridCache(settings);
+  nrlmsise00_cache_day_key_ = -1;
+  is_nrlmsise00_cache_enabled_ = true;
+}
+
+double Atmosphere::CalcNrlmsise00WithCache(const double decimal_year, const double lat_rad, const double lon_rad, const double alt_m) {
+  int year;
+  int day_of_year;
+  double seconds;
+  ConvertDecyearToNRLMSISE00Time(decimal_year, year, day_of_year, seconds);
+
+  // The grid is valid only for the day since the space weather parameters and the day of year are inputs of the model
+  const int day_key = year * 1000 + day_of_year;
+  if (day_key != nrlmsise00_cache_day_key_) {
+    nrlmsise00_cache_.Reset();
+    nrlmsise00_cache_day_key_ = day_key;
+    nrlmsise00_cache_f107_ = manual_daily_f107_;
+    nrlmsise00_cache_f107a_ = manual_average_f107_;
+    nrlmsise00_cache_ap_ = manual_ap_;
+    if (!is_manual_param_used_) {
+      if (!GetNRLMSISE00SpaceWeather(decimal_year, *space_weather_table_, nrlmsise00_cache_f107_, nrlmsise00_cache_f107a_, nrlmsise00_cache_ap_)) {
+        nrlmsise00_cache_day_key_ = -1;
+        return 0.0;
+      }
+    }
+  }
+
+  const double f107 = nrlmsise00_cache_f107_;
+  const double f107a = nrlmsise00_cache_f107a_;
+  const double ap = nrlmsise00_cache_ap_;
+  double local_time_h = seconds / 3600.0 + lon_rad * libra::rad_to_deg / 15.0;
+  local_time_h = fmod(local_time_h, 24.0);
+  if (local_time_h < 0.0) local_time_h += 24.0;
+
+  // Grid points are evaluated at the longitude which gives the local time at the current UT
+  auto grid_model = [&](const double grid_alt_m, const double grid_lat_rad, const double grid_local_time_h) {
+    const double grid_lon_rad = 15.0 * (grid_local_time_h - seconds / 3600.0) * libra::deg_to_rad;
+    return CalcNRLMSISE00WithSpaceWeather(day_of_year, seconds, grid_lat_rad, grid_lon_rad, grid_alt_m, f107, f107a, ap);
+  };
+  auto query_model = [&]() {
+    return CalcNRLMSISE00WithSpaceWeather(day_of_year, seconds, lat_rad, lon_rad, alt_m, f107, f107a, ap);
+  };
+  return nrlmsise00_cache_.CalcDensity_kg_m3(alt_m, lat_rad, local_time_h, grid_model, query_model);
+}
+
 double Atmosphere::AddNoise(const double rho_kg_m3) {
   // RandomWalk rw(rho_kg_m3*rw_stepwidth_,rho_kg_m3*rw_stddev_,rho_kg_m3*rw_limit_);
   libra::NormalRand nr(0.0, rho_kg_m3 * gauss_standard_deviation_rate_, global_randomization.MakeSeed());
@@ -128,8 +194,33 @@ Atmosphere InitAtmosphere(const std::string initialize_file_path, const LocalCel
 
   Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap,
                         local_celestial_information, simulation_time);
+  if (conf.ReadEnable(section, "nrlmsise00_cache")) {
+    libra::atmosphere::DensityGridCache::Settings cache_settings;
+    cache_settings.min_altitude_m = conf.ReadDouble(section, "nrlmsise00_cache_min_altitude_km") * 1000.0;
+    cache_settings.max_altitude_m = conf.ReadDouble(section, "nrlmsise00_cache_max_altitude_km") * 1000.0;
+    cache_settings.altitude_step_m = conf.ReadDouble(section, "nrlmsise00_cache_altitude_step_km") * 1000.0;
+    cache_settings.latitude_step_rad = conf.ReadDouble(section, "nrlmsise00_cache_latitude_step_deg") * libra::deg_to_rad;
+    cache_settings.local_time_step_h = conf.ReadDouble(section, "nrlmsise00_cache_local_time_step_h");
+    cache_settings.max_relative_error = conf.ReadDouble(section, "nrlmsise00_cache_max_relative_error");
+    atmosphere.EnableNrlmsise00Cache(cache_settings);
+  }
   atmosphere.SetCalcFlag(conf.ReadEnable(section, INI_CALC_LABEL));
   atmosphere.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  atmosphere.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return atmosphere;
 }
+
+void Atmosphere::SaveSnapshot(SnapshotWriter& snapshot) const { snapshot.Write(air_density_kg_m3_); }
+
+void Atmosphere::LoadSnapshot(SnapshotReader& snapshot) { snapshot.Read(air_density_kg_m3_); }
+
+MemoryUsage Atmosphere::GetMemoryUsage() const {
+  const size_t owned_bytes = sizeof(*this) - sizeof(nrlmsise00_cache_) + nrlmsise00_cache_.GetMemoryUsage_bytes() + CalcHeapMemory_bytes(model_);
+  size_t shared_bytes = 0;
+  if (space_weather_table_ != nullptr) {
+    shared_bytes = sizeof(nrlmsise_space_weather_table) + CalcHeapMemory_bytes(space_weather_table_->data) +
+                   CalcHeapMemory_bytes(space_weather_table_->daily_index) + CalcHeapMemory_bytes(space_weather_table_->monthly_index);
+  }
+  return MemoryUsage("Atmosphere", owned_bytes, shared_bytes);
+}
@@ -5,15 +5,20 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_HPP_
 #define S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_HPP_
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "dynamics/orbit/orbit.hpp"
 #include "environment/global/simulation_time.hpp"
 #include "environment/local/local_celestial_information.hpp"
+#include "environment/local/local_environment_state.hpp"
 #include "logger/loggable.hpp"
+#include "math_physics/atmosphere/density_grid_cache.hpp"
 #include "math_physics/atmosphere/wrapper_nrlmsise00.hpp"
 #include "math_physics/math/vector.hpp"
+#include "utilities/memory_usage.hpp"
+#include "utilities/snapshot.hpp"
 
 /**
  * @class Atmosphere
@@ -50,6 +55,23 @@ class Atmosphere : public ILoggable {
    * @return Atmospheric density [kg/m^3]
    */
   double CalcAirDensity_kg_m3(const double decimal_year, const Orbit& orbit);
+  /**
+   * @fn CalcAirDensity
+   * @brief Calculate atmospheric density with the shared inputs of the local environment
+   * @param [in] state: Shared inputs of the local environment in the step
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcAirDensity_kg_m3(const LocalEnvironmentState& state);
+  /**
+   * @fn CalcAirDensityAtPosition_kg_m3
+   * @brief Calculate atmospheric density at the position
+   * @note The calculation flag is not checked, and the result is also stored as the air density of this instance.
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] position: Geodetic position of the target point
+   * @param [in] sun_direction_i: Unit vector from the center body to the sun in the inertial frame
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcAirDensityAtPosition_kg_m3(const double decimal_year, const GeodeticPosition& position, const libra::Vector<3>& sun_direction_i);
   /**
    * @fn GetAirDensity
    * @brief Return Atmospheric density [kg/m^3]
@@ -60,6 +82,26 @@ class Atmosphere : public ILoggable {
    * @brief Set calculation flag (true: Enable, false: Disable)
    */
   inline void SetCalcFlag(const bool is_calc_enabled) { is_calc_enabled_ = is_calc_enabled; }
+  /**
+   * @fn EnableNrlmsise00Cache
+   * @brief Enable the density grid cache for the NRLMSISE00 model
+   * @note The grid is cleared when the day changes, since the space weather parameters are updated daily.
+   * @param [in] settings: Grid settings of the cache
+   */
+  void EnableNrlmsise00Cache(const libra::atmosphere::DensityGridCache::Settings& settings);
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the air density to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the air density from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
 
   // Override ILoggable
   /**
@@ -73,6 +115,12 @@ class Atmosphere : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage. The space weather table is reported as the shared memory.
+   */
+  MemoryUsage GetMemoryUsage() const;
+
  private:
   // General information
   bool is_calc_enabled_ = true;  //!< Calculation enable flag
@@ -80,13 +128,21 @@ class Atmosphere : public ILoggable {
   double air_density_kg_m3_;     //!< Atmospheric density [kg/m^3]
 
   // NRLMSISE-00 model information
-  std::vector<nrlmsise_table> space_weather_table_;  //!< Space weather table
-  bool is_manual_param_used_;                        //!< Flag to use manual parameters
+  std::shared_ptr<const nrlmsise_space_weather_table> space_weather_table_;  //!< Space weather table shared between the instances
+  bool is_manual_param_used_;                                                //!< Flag to use manual parameters
   // Reference of the following setting parameters https://www.swpc.noaa.gov/phenomena/f107-cm-radio-emissions
   double manual_daily_f107_;    //!< Manual daily f10.7 value
   double manual_average_f107_;  //!< Manual 3-month averaged f10.7 value
   double manual_ap_;            //!< Manual ap value Ref: http://wdc.kugi.kyoto-u.ac.jp/kp/kpexp-j.html
 
+  // NRLMSISE-00 density grid cache
+  bool is_nrlmsise00_cache_enabled_ = false;              //!< Flag to use the density grid cache
+  libra::atmosphere::DensityGridCache nrlmsise00_cache_;  //!< Density grid cache
+  int nrlmsise00_cache_day_key_ = -1;                     //!< Day of the cached grid (year * 1000 + day of year)
+  double nrlmsise00_cache_f107_ = 0.0;                    //!< Daily f10.7 value of the cached day
+  double nrlmsise00_cache_f107a_ = 0.0;                   //!< 3-month averaged f10.7 value of the cached day
+  double nrlmsise00_cache_ap_ = 0.0;                      //!< ap value of the cached day
+
   // Noise Information
   double gauss_standard_deviation_rate_;  //!< Standard deviation of density noise (defined as percentage)
   // TODO: Add random walk noise
@@ -96,6 +152,7 @@ class Atmosphere : public ILoggable {
 
   // References
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  CelestialBodyHandle sun_;                                       //!< Handle of the sun
 
   // Functions
   /**
@@ -105,6 +162,16 @@ class Atmosphere : public ILoggable {
    * @return Atmospheric density with noise [kg/m^3]
    */
   double AddNoise(const double rho_kg_m3);
+  /**
+   * @fn CalcNrlmsise00WithCache
+   * @brief Calculate NRLMSISE00 atmospheric density with the density grid cache
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] lat_rad: Latitude [rad]
+   * @param [in] lon_rad: Longitude [rad]
+   * @param [in] alt_m: Altitude [m]
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcNrlmsise00WithCache(const double decimal_year, const double lat_rad, const double lon_rad, const double alt_m);
 };
 
 /**
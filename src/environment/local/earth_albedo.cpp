@@ -0,0 +1,168 @@
+/**
+ * @file earth_albedo.cpp
+ * @brief Class to calculate the irradiance of the earth albedo and the earth infrared radiation on the spacecraft surfaces
+ */
+#include "earth_albedo.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "environment/global/physical_constants.hpp"
+#include "logger/log_utility.hpp"
+#include "math_physics/math/constants.hpp"
+#include "setting_file_reader/initialize_file_access.hpp"
+#include "utilities/shared_data_registry.hpp"
+
+namespace {
+const double kWinterSolsticeDecimalYear = 1981.9726;  //!< Northern winter solstice of the Knocke-Ries model (1981-12-22) [year]
+}  // namespace
+
+EarthAlbedo::EarthAlbedo(const libra::AlbedoKernelTable::Settings& kernel_settings,
+                         const libra::EarthReflectivityGrid::Settings& reflectivity_settings, const double solar_constant_W_m2)
+    : solar_constant_W_m2_(solar_constant_W_m2) {
+  // The tables do not depend on the spacecraft, so they are shared between the instances with the same settings
+  const std::string kernel_key =
+      MakeSharedDataKey(kernel_settings.min_radius_ratio, kernel_settings.max_radius_ratio, kernel_settings.number_of_radius_ratios,
+                        kernel_settings.angle_step_rad, kernel_settings.number_of_cap_divisions);
+  kernel_table_ = SharedDataRegistry<libra::AlbedoKernelTable>::Get(
+      kernel_key, [&]() { return std::make_shared<const libra::AlbedoKernelTable>(kernel_settings); });
+  const std::string reflectivity_key = MakeSharedDataKey(reflectivity_settings.latitude_step_rad, reflectivity_settings.season_step_rad);
+  reflectivity_grid_ = SharedDataRegistry<libra::EarthReflectivityGrid>::Get(reflectivity_key, [&]() {
+    return std::make_shared<const libra::EarthReflectivityGrid>(reflectivity_settings, libra::CalcKnockeEarthRadiationProperties);
+  });
+}
+
+void EarthAlbedo::Update(const LocalEnvironmentState& state) {
+  if (!IsCalcEnabled) return;
+
+  const double distance_m = state.center_body_position_from_spacecraft_b_m.CalcNorm();
+  radius_ratio_ = std::min(environment::earth_equatorial_radius_m / distance_m, 1.0);
+  zenith_b_ = -1.0 / distance_m * state.center_body_position_from_spacecraft_b_m;
+
+  // Local frame around the nadir with the sun in the XZ plane
+  const libra::Vector<3> sun_direction_b = state.sun_position_from_spacecraft_b_m.CalcNormalizedVector();
+  const double cos_sun_zenith = std::clamp(InnerProduct(zenith_b_, sun_direction_b), -1.0, 1.0);
+  sun_zenith_angle_rad_ = acos(cos_sun_zenith);
+  sun_side_b_ = sun_direction_b - cos_sun_zenith * zenith_b_;
+  if (sun_side_b_.CalcNorm() < 1.0e-9) {
+    // The azimuth is arbitrary when the sun is at the zenith or the nadir
+    sun_side_b_ = libra::Vector<3>(0.0);
+    sun_side_b_[fabs(zenith_b_[0]) < 0.9 ? 0 : 1] = 1.0;
+    sun_side_b_ -= InnerProduct(sun_side_b_, zenith_b_) * zenith_b_;
+  }
+  sun_side_b_ = sun_side_b_.CalcNormalizedVector();
+  cross_b_ = OuterProduct(zenith_b_, sun_side_b_);
+
+  const double sun_distance_au = state.sun_distance_m / environment::astronomical_unit_m;
+  solar_flux_W_m2_ = solar_constant_W_m2_ / (sun_distance_au * sun_distance_au);
+
+  const double season_angle_rad = libra::tau * (state.decimal_year - kWinterSolsticeDecimalYear);
+  reflectivity_grid_->CalcProperties(state.geodetic_position.GetLatitude_rad(), season_angle_rad, reflectivity_, emissivity_);
+}
+
+void EarthAlbedo::CalcNormalAngles(const libra::Vector<3>& normal_b, double& nadir_angle_rad, double& azimuth_rad) const {
+  nadir_angle_rad = acos(std::clamp(-InnerProduct(normal_b, zenith_b_), -1.0, 1.0));
+  azimuth_rad = atan2(InnerProduct(normal_b, cross_b_), InnerProduct(normal_b, sun_side_b_));
+}
+
+double EarthAlbedo::CalcAlbedoIrradiance_W_m2(const libra::Vector<3>& normal_b) const {
+  if (!IsCalcEnabled || radius_ratio_ <= 0.0) return 0.0;
+  double nadir_angle_rad, azimuth_rad;
+  CalcNormalAngles(normal_b, nadir_angle_rad, azimuth_rad);
+  return solar_flux_W_m2_ * reflectivity_ * kernel_table_->CalcAlbedoKernel(radius_ratio_, sun_zenith_angle_rad_, nadir_angle_rad, azimuth_rad);
+}
+
+double EarthAlbedo::CalcInfraredIrradiance_W_m2(const libra::Vector<3>& normal_b) const {
+  if (!IsCalcEnabled || radius_ratio_ <= 0.0) return 0.0;
+  const double nadir_angle_rad = acos(std::clamp(-InnerProduct(normal_b, zenith_b_), -1.0, 1.0));
+  // The emitted flux is normalized by the mean solar flux on the earth
+  return 0.25 * solar_flux_W_m2_ * emissivity_ * kernel_table_->CalcInfraredKernel(radius_ratio_, nadir_angle_rad);
+}
+
+void EarthAlbedo::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(radius_ratio_);
+  snapshot.Write(sun_zenith_angle_rad_);
+  snapshot.Write(zenith_b_);
+  snapshot.Write(sun_side_b_);
+  snapshot.Write(cross_b_);
+  snapshot.Write(solar_flux_W_m2_);
+  snapshot.Write(reflectivity_);
+  snapshot.Write(emissivity_);
+}
+
+void EarthAlbedo::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(radius_ratio_);
+  snapshot.Read(sun_zenith_angle_rad_);
+  snapshot.Read(zenith_b_);
+  snapshot.Read(sun_side_b_);
+  snapshot.Read(cross_b_);
+  snapshot.Read(solar_flux_W_m2_);
+  snapshot.Read(reflectivity_);
+  snapshot.Read(emissivity_);
+}
+
+std::string EarthAlbedo::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  str_tmp += WriteScalar("earth_reflectivity_at_sub_spacecraft_point");
+  str_tmp += WriteScalar("earth_emissivity_at_sub_spacecraft_point");
+  str_tmp += WriteScalar("earth_albedo_irradiance_on_nadir_facing_surface", "W/m2");
+  str_tmp += WriteScalar("earth_infrared_irradiance_on_nadir_facing_surface", "W/m2");
+
+  return str_tmp;
+}
+
+std::string EarthAlbedo::GetLogValue() const {
+  std::string str_tmp = "";
+
+  const libra::Vector<3> nadir_b = -1.0 * zenith_b_;
+  str_tmp += WriteScalar(reflectivity_);
+  str_tmp += WriteScalar(emissivity_);
+  str_tmp += WriteScalar(CalcAlbedoIrradiance_W_m2(nadir_b));
+  str_tmp += WriteScalar(CalcInfraredIrradiance_W_m2(nadir_b));
+
+  return str_tmp;
+}
+
+MemoryUsage EarthAlbedo::GetMemoryUsage() const {
+  const size_t shared_bytes = kernel_table_->GetMemoryUsage_bytes() + reflectivity_grid_->GetMemoryUsage_bytes();
+  return MemoryUsage("EarthAlbedo", sizeof(*this), shared_bytes);
+}
+
+EarthAlbedo InitEarthAlbedo(const std::string initialize_file_path, const double solar_constant_W_m2) {
+  auto conf = IniAccess(initialize_file_path);
+  const char* section = "EARTH_ALBEDO";
+
+  libra::AlbedoKernelTable::Settings kernel_settings;
+  libra::EarthReflectivityGrid::Settings reflectivity_settings;
+  const bool is_calc_enabled = conf.ReadEnable(section, INI_CALC_LABEL);
+  if (is_calc_enabled) {
+    // The radius ratio of the kernel table is calculated from the altitude range
+    const double radius_m = environment::earth_equatorial_radius_m;
+    kernel_settings.min_radius_ratio = radius_m / (radius_m + conf.ReadDouble(section, "kernel_max_altitude_km") * 1000.0);
+    kernel_settings.max_radius_ratio = radius_m / (radius_m + conf.ReadDouble(section, "kernel_min_altitude_km") * 1000.0);
+    kernel_settings.number_of_radius_ratios = (size_t)std::max(conf.ReadInt(section, "kernel_number_of_altitudes"), 2);
+    kernel_settings.angle_step_rad = conf.ReadDouble(section, "kernel_angle_step_deg") * libra::deg_to_rad;
+    kernel_settings.number_of_cap_divisions = (size_t)std::max(conf.ReadInt(section, "kernel_number_of_cap_divisions"), 1);
+    reflectivity_settings.latitude_step_rad = conf.ReadDouble(section, "reflectivity_grid_latitude_step_deg") * libra::deg_to_rad;
+    reflectivity_settings.season_step_rad = conf.ReadDouble(section, "reflectivity_grid_season_step_day") / 365.25 * libra::tau;
+    if (kernel_settings.angle_step_rad <= 0.0 || reflectivity_settings.latitude_step_rad <= 0.0 || reflectivity_settings.season_step_rad <= 0.0) {
+      throw std::invalid_argument("EARTH_ALBEDO: The steps of the kernel table and the reflectivity grid must be positive.");
+    }
+  } else {
+    // The smallest tables since they are not used
+    kernel_settings.number_of_radius_ratios = 2;
+    kernel_settings.angle_step_rad = libra::pi;
+    kernel_settings.number_of_cap_divisions = 1;
+    reflectivity_settings.latitude_step_rad = libra::pi;
+    reflectivity_settings.season_step_rad = libra::tau;
+  }
+
+  EarthAlbedo earth_albedo(kernel_settings, reflectivity_settings, solar_constant_W_m2);
+  earth_albedo.IsCalcEnabled = is_calc_enabled;
+  earth_albedo.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  earth_albedo.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
+
+  return earth_albedo;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file earth_albedo.hpp
+ * @brief Class to calculate the irradiance of the earth albedo and the earth infrared radiation on the spacecraft surfaces
+ */
+
+#ifndef S2E_ENVIRONMENT_LOCAL_EARTH_ALBEDO_HPP_
+#define S2E_ENVIRONMENT_LOCAL_EARTH_ALBEDO_HPP_
+
+#include <memory>
+#include <string>
+
+#include "environment/local/local_environment_state.hpp"
+#include "logger/loggable.hpp"
+#include "math_physics/albedo/albedo_kernel_table.hpp"
+#include "math_physics/albedo/earth_reflectivity_grid.hpp"
+#include "math_physics/math/vector.hpp"
+#include "utilities/memory_usage.hpp"
+#include "utilities/snapshot.hpp"
+
+/**
+ * @class EarthAlbedo
+ * @brief Class to calculate the irradiance of the earth albedo and the earth infrared radiation on the spacecraft surfaces
+ * @details The geometry of the spacecraft, the earth, and the sun is calculated once in each update. The irradiance on a surface is
+ *          interpolated from the kernel table of the cap integration with the reflectivity and the emissivity at the sub-spacecraft
+ *          point, so the sun sensors, the solar array panels, and the thermal nodes share the update and pay only a table lookup.
+ *          The tables are shared between the instances with the same settings (e.g., spacecraft in a constellation).
+ */
+class EarthAlbedo : public ILoggable {
+ public:
+  bool IsCalcEnabled = true;  //!< Calculation flag
+
+  /**
+   * @fn EarthAlbedo
+   * @brief Constructor
+   * @param [in] kernel_settings: Settings of the kernel table
+   * @param [in] reflectivity_settings: Settings of the reflectivity grid of the Knocke-Ries model
+   * @param [in] solar_constant_W_m2: Solar constant at 1 AU [W/m2]
+   */
+  EarthAlbedo(const libra::AlbedoKernelTable::Settings& kernel_settings, const libra::EarthReflectivityGrid::Settings& reflectivity_settings,
+              const double solar_constant_W_m2);
+  /**
+   * @fn ~EarthAlbedo
+   * @brief Destructor
+   */
+  virtual ~EarthAlbedo() {}
+
+  /**
+   * @fn Update
+   * @brief Update the geometry and the surface properties at the sub-spacecraft point
+   * @param [in] state: Shared inputs of the local environment in the step
+   */
+  void Update(const LocalEnvironmentState& state);
+
+  /**
+   * @fn CalcAlbedoIrradiance_W_m2
+   * @brief Calculate the irradiance of the sunlight reflected by the earth on a surface
+   * @param [in] normal_b: Unit normal vector of the surface in the body frame
+   * @return Irradiance [W/m2]. Zero when the calculation is disabled.
+   */
+  double CalcAlbedoIrradiance_W_m2(const libra::Vector<3>& normal_b) const;
+  /**
+   * @fn CalcInfraredIrradiance_W_m2
+   * @brief Calculate the irradiance of the infrared radiation emitted by the earth on a surface
+   * @param [in] normal_b: Unit normal vector of the surface in the body frame
+   * @return Irradiance [W/m2]. Zero when the calculation is disabled.
+   */
+  double CalcInfraredIrradiance_W_m2(const libra::Vector<3>& normal_b) const;
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the geometry and the surface properties to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the geometry and the surface properties from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage. The tables are reported as the shared memory.
+   */
+  MemoryUsage GetMemoryUsage() const;
+
+ private:
+  std::shared_ptr<const libra::AlbedoKernelTable> kernel_table_;           //!< Kernel table of the cap integration
+  std::shared_ptr<const libra::EarthReflectivityGrid> reflectivity_grid_;  //!< Reflectivity and emissivity grid
+  double solar_constant_W_m2_;                                             //!< Solar constant at 1 AU [W/m2]
+
+  // Geometry and properties at the latest update
+  double radius_ratio_ = 0.0;          //!< Earth radius / distance from the earth center
+  double sun_zenith_angle_rad_ = 0.0;  //!< Sun zenith angle at the sub-spacecraft point [rad]
+  libra::Vector<3> zenith_b_{0.0};     //!< Zenith direction in the body frame
+  libra::Vector<3> sun_side_b_{0.0};   //!< Horizontal direction to the sun side in the body frame
+  libra::Vector<3> cross_b_{0.0};      //!< Horizontal direction perpendicular to the sun plane in the body frame
+  double solar_flux_W_m2_ = 0.0;       //!< Solar flux at the earth [W/m2]
+  double reflectivity_ = 0.0;          //!< Reflectivity at the sub-spacecraft point
+  double emissivity_ = 0.0;            //!< Emissivity at the sub-spacecraft point
+
+  /**
+   * @fn CalcNormalAngles
+   * @brief Calculate the nadir angle and the azimuth of the surface normal
+   */
+  void CalcNormalAngles(const libra::Vector<3>& normal_b, double& nadir_angle_rad, double& azimuth_rad) const;
+};
+
+/**
+ * @fn InitEarthAlbedo
+ * @brief Initialize the earth albedo
+ * @param [in] initialize_file_path: Path to initialize file
+ * @param [in] solar_constant_W_m2: Solar constant at 1 AU [W/m2]
+ */
+EarthAlbedo InitEarthAlbedo(const std::string initialize_file_path, const double solar_constant_W_m2);
+
+#endif  // S2E_ENVIRONMENT_LOCAL_EARTH_ALBEDO_HPP_
@@ -5,11 +5,12 @@
 
 #include "geomagnetic_field.hpp"
 
-#include "math_physics/geomagnetic/igrf.h"
+#include <cmath>
+
+#include "math_physics/math/constants.hpp"
 #include "math_physics/randomization/global_randomization.hpp"
-#include "math_physics/randomization/normal_randomization.hpp"
-#include "math_physics/randomization/random_walk.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
+#include "utilities/shared_data_registry.hpp"
 
 GeomagneticField::GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT,
                                    const double random_walk_limit_nT, const double white_noise_standard_deviation_nT)
@@ -18,7 +19,9 @@ GeomagneticField::GeomagneticField(const std::string igrf_file_name, const doubl
       random_walk_standard_deviation_nT_(random_walk_srandard_deviation_nT),
       random_walk_limit_nT_(random_walk_limit_nT),
       white_noise_standard_deviation_nT_(white_noise_standard_deviation_nT),
-      igrf_file_name_(igrf_file_name) {
+      igrf_file_name_(igrf_file_name),
+      random_walk_(0.1, libra::Vector<3>(random_walk_srandard_deviation_nT), libra::Vector<3>(random_walk_limit_nT)),
+      white_noise_(0.0, white_noise_standard_deviation_nT, global_randomization.MakeSeed()) {
   set_file_path(igrf_file_name_.c_str());
 }
 
@@ -30,8 +33,26 @@ void GeomagneticField::CalcMagneticField(const double decimal_year, const double
   const double lon_rad = position.GetLongitude_rad();
   const double alt_m = position.GetAltitude_m();
 
+  // The secular variation of the coefficients is negligible in a day
+  const int day = (int)floor(decimal_year * 365.25);
+  if (day != coefficients_day_) {
+    IgrfPrepareCoefficients((day + 0.5) / 365.25, &igrf_coefficients_);
+    coefficients_day_ = day;
+    if (is_field_grid_enabled_) UpdateFieldGrid();
+  }
+
   double magnetic_field_array_i_nT[3];
-  IgrfCalc(decimal_year, lat_rad, lon_rad, alt_m, sidereal_day, magnetic_field_array_i_nT);
+  double magnetic_field_array_ecef_nT[3];
+  if (is_field_grid_enabled_ && field_grid_->CalcField(alt_m, lat_rad, lon_rad, magnetic_field_array_ecef_nT)) {
+    // Same rotation as TransMagaxisToECI
+    const double cos_side = cos(sidereal_day);
+    const double sin_side = sin(sidereal_day);
+    magnetic_field_array_i_nT[0] = cos_side * magnetic_field_array_ecef_nT[0] - sin_side * magnetic_field_array_ecef_nT[1];
+    magnetic_field_array_i_nT[1] = sin_side * magnetic_field_array_ecef_nT[0] + cos_side * magnetic_field_array_ecef_nT[1];
+    magnetic_field_array_i_nT[2] = magnetic_field_array_ecef_nT[2];
+  } else {
+    IgrfEvaluate(&igrf_coefficients_, evaluation_degree_, lat_rad, lon_rad, alt_m, sidereal_day, &igrf_workspace_, magnetic_field_array_i_nT);
+  }
   AddNoise(magnetic_field_array_i_nT);
   for (int i = 0; i < 3; ++i) {
     magnetic_field_i_nT_[i] = magnetic_field_array_i_nT[i];
@@ -39,17 +60,33 @@ void GeomagneticField::CalcMagneticField(const double decimal_year, const double
   magnetic_field_b_nT_ = quaternion_i2b.FrameConversion(magnetic_field_i_nT_);
 }
 
-void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
-  static libra::Vector<3> standard_deviation(random_walk_standard_deviation_nT_);
-  static libra::Vector<3> limit(random_walk_limit_nT_);
-  static RandomWalk<3> random_walk(0.1, standard_deviation, limit);
+void GeomagneticField::EnableFieldGrid(const libra::GeomagneticFieldGrid::Settings& settings) {
+  grid_settings_ = settings;
+  is_field_grid_enabled_ = true;
+  coefficients_day_ = -1;
+}
 
-  static libra::NormalRand white_noise(0.0, white_noise_standard_deviation_nT_, global_randomization.MakeSeed());
+void GeomagneticField::UpdateFieldGrid() {
+  // Grids are shared between the instances with the same settings, and they are released when no instance uses the day.
+  const std::string key =
+      MakeSharedDataKey(igrf_file_name_, evaluation_degree_, coefficients_day_, grid_settings_.min_altitude_m, grid_settings_.max_altitude_m,
+                        grid_settings_.altitude_step_m, grid_settings_.latitude_step_rad, grid_settings_.longitude_step_rad);
+
+  auto load = [this]() {
+    // The field is evaluated in the earth fixed frame with zero sidereal time
+    auto calc_field = [this](const double altitude_m, const double latitude_rad, const double longitude_rad, double field[3]) {
+      IgrfEvaluate(&igrf_coefficients_, evaluation_degree_, latitude_rad, longitude_rad, altitude_m, 0.0, &igrf_workspace_, field);
+    };
+    return std::make_shared<const libra::GeomagneticFieldGrid>(grid_settings_, calc_field);
+  };
+  field_grid_ = SharedDataRegistry<libra::GeomagneticFieldGrid>::Get(key, load, SharedDataRetention::kWhileUsed);
+}
 
+void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
   for (int i = 0; i < 3; ++i) {
-    magnetic_field_array_i_nT[i] += random_walk[i] + white_noise;
+    magnetic_field_array_i_nT[i] += random_walk_[i] + white_noise_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
 }
 
 std::string GeomagneticField::GetLogHeader() const {
@@ -73,6 +110,7 @@ std::string GeomagneticField::GetLogValue() const {
 GeomagneticField InitGeomagneticField(std::string initialize_file_path) {
   auto conf = IniAccess(initialize_file_path);
   const char* section = "MAGNETIC_FIELD_ENVIRONMENT";
+  GlobalRandomization::StreamScope stream_scope(section);
 
   std::string fname = conf.ReadString(section, "coefficient_file");
   double mag_rwdev = conf.ReadDouble(section, "magnetic_field_random_walk_standard_deviation_nT");
@@ -80,8 +118,38 @@ GeomagneticField InitGeomagneticField(std::string initialize_file_path) {
   double mag_wnvar = conf.ReadDouble(section, "magnetic_field_white_noise_standard_deviation_nT");
 
   GeomagneticField geomagnetic_field(fname, mag_rwdev, mag_rwlimit, mag_wnvar);
+  geomagnetic_field.SetEvaluationDegree(conf.ReadInt(section, "evaluation_degree"));
+  if (conf.ReadEnable(section, "field_grid")) {
+    libra::GeomagneticFieldGrid::Settings grid_settings;
+    grid_settings.min_altitude_m = conf.ReadDouble(section, "field_grid_min_altitude_km") * 1000.0;
+    grid_settings.max_altitude_m = conf.ReadDouble(section, "field_grid_max_altitude_km") * 1000.0;
+    grid_settings.altitude_step_m = conf.ReadDouble(section, "field_grid_altitude_step_km") * 1000.0;
+    grid_settings.latitude_step_rad = conf.ReadDouble(section, "field_grid_latitude_step_deg") * libra::deg_to_rad;
+    grid_settings.longitude_step_rad = conf.ReadDouble(section, "field_grid_longitude_step_deg") * libra::deg_to_rad;
+    geomagnetic_field.EnableFieldGrid(grid_settings);
+  }
   geomagnetic_field.IsCalcEnabled = conf.ReadEnable(section, INI_CALC_LABEL);
   geomagnetic_field.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  geomagnetic_field.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   return geomagnetic_field;
 }
+
+void GeomagneticField::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(magnetic_field_i_nT_);
+  snapshot.Write(magnetic_field_b_nT_);
+  random_walk_.SaveSnapshot(snapshot);
+  snapshot.Write(white_noise_);
+}
+
+void GeomagneticField::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(magnetic_field_i_nT_);
+  snapshot.Read(magnetic_field_b_nT_);
+  random_walk_.LoadSnapshot(snapshot);
+  snapshot.Read(white_noise_);
+}
+
+MemoryUsage GeomagneticField::GetMemoryUsage() const {
+  const size_t shared_bytes = field_grid_ != nullptr ? field_grid_->GetMemoryUsage_bytes() : 0;
+  return MemoryUsage("GeomagneticField", sizeof(*this) + CalcHeapMemory_bytes(igrf_file_name_), shared_bytes);
+}
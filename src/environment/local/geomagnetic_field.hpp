@@ -6,10 +6,19 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 #define S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 
+#include <memory>
+#include <string>
+
 #include "logger/loggable.hpp"
+#include "math_physics/geomagnetic/geomagnetic_field_grid.hpp"
+#include "math_physics/geomagnetic/igrf.h"
 #include "math_physics/geodesy/geodetic_position.hpp"
 #include "math_physics/math/quaternion.hpp"
 #include "math_physics/math/vector.hpp"
+#include "math_physics/randomization/normal_randomization.hpp"
+#include "math_physics/randomization/random_walk.hpp"
+#include "utilities/memory_usage.hpp"
+#include "utilities/snapshot.hpp"
 
 /**
  * @class GeomagneticField
@@ -56,6 +65,33 @@ class GeomagneticField : public ILoggable {
    * @brief Return magnetic field vector in the body fixed frame [nT]
    */
   inline libra::Vector<3> GetGeomagneticField_b_nT() const { return magnetic_field_b_nT_; }
+  /**
+   * @fn SetEvaluationDegree
+   * @brief Set the degree of the IGRF evaluation
+   * @param [in] evaluation_degree: Degree of the evaluation. All degrees of the coefficient file are used when it is zero.
+   */
+  inline void SetEvaluationDegree(const int evaluation_degree) { evaluation_degree_ = evaluation_degree; }
+  /**
+   * @fn EnableFieldGrid
+   * @brief Enable the interpolation of the field vectors on the grid evaluated once per day
+   * @note The grids are shared between the instances with the same settings (e.g., spacecraft in a constellation).
+   *       IGRF is evaluated directly at the altitudes out of the grid.
+   * @param [in] settings: Grid settings
+   */
+  void EnableFieldGrid(const libra::GeomagneticFieldGrid::Settings& settings);
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the magnetic field and the states of the noise to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the magnetic field and the states of the noise from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
 
   // Override ILoggable
   /**
@@ -69,6 +105,12 @@ class GeomagneticField : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage. The field grid is reported as the shared memory.
+   */
+  MemoryUsage GetMemoryUsage() const;
+
  private:
   libra::Vector<3> magnetic_field_i_nT_;      //!< Magnetic field vector at the inertial frame [nT]
   libra::Vector<3> magnetic_field_b_nT_;      //!< Magnetic field vector at the spacecraft body fixed frame [nT]
@@ -76,6 +118,19 @@ class GeomagneticField : public ILoggable {
   double random_walk_limit_nT_;               //!< Limit of Random Walk [nT]
   double white_noise_standard_deviation_nT_;  //!< Standard deviation of white noise [nT]
   std::string igrf_file_name_;                //!< Path to the initialize file
+  RandomWalk<3> random_walk_;                 //!< Random walk noise [nT]
+  libra::NormalRand white_noise_;             //!< White noise [nT]
+
+  // IGRF evaluation
+  int evaluation_degree_ = 0;           //!< Degree of the evaluation. Zero means all degrees.
+  int coefficients_day_ = -1;           //!< Day index of the cached coefficients (floor of decimal year * 365.25)
+  IgrfCoefficients igrf_coefficients_;  //!< Gauss coefficients interpolated for the day
+  IgrfWorkspace igrf_workspace_;        //!< Workspace of the Legendre functions
+
+  // Field grid
+  bool is_field_grid_enabled_ = false;                             //!< Flag to use the field grid
+  libra::GeomagneticFieldGrid::Settings grid_settings_;            //!< Settings of the field grid
+  std::shared_ptr<const libra::GeomagneticFieldGrid> field_grid_;  //!< Field grid of the day of the cached coefficients
 
   /**
    * @fn AddNoise
@@ -83,6 +138,11 @@ class GeomagneticField : public ILoggable {
    * @param [in/out] magnetic_field_array_i_nT: input true magnetic field, output magnetic field with noise
    */
   void AddNoise(double* magnetic_field_array_i_nT);
+  /**
+   * @fn UpdateFieldGrid
+   * @brief Get the shared field grid for the day of the cached coefficients
+   */
+  void UpdateFieldGrid();
 };
 
 /**
@@ -5,17 +5,19 @@
 
 #include "local_celestial_information.hpp"
 
-#include <SpiceUsr.h>
-
 #include <algorithm>
 #include <iostream>
 #include <locale>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 
+#include "environment/global/spice_access.hpp"
 #include "logger/log_utility.hpp"
 
 LocalCelestialInformation::LocalCelestialInformation(const CelestialInformation* global_celestial_information)
-    : global_celestial_information_(global_celestial_information) {
+    : global_celestial_information_(global_celestial_information), spacecraft_angular_velocity_rad_s_(0.0) {
+  is_body_frame_updated_.assign(global_celestial_information_->GetNumberOfSelectedBodies(), true);
   int num_of_state = global_celestial_information_->GetNumberOfSelectedBodies() * 3;
   celestial_body_position_from_center_b_m_ = new double[num_of_state];
   celestial_body_velocity_from_center_b_m_s_ = new double[num_of_state];
@@ -57,39 +59,44 @@ void LocalCelestialInformation::UpdateAllObjectsInformation(const libra::Vector<
       celestial_body_velocity_from_spacecraft_i_m_s_[i * 3 + j] = celestial_body_velocity_i_m_s[j] - spacecraft_velocity_from_center_i_m_s[j];
     }
   }
-  CalcAllPosVel_b(quaternion_i2b, spacecraft_angular_velocity_rad_s);
+  // The body frame vectors are converted on demand
+  quaternion_i2b_ = quaternion_i2b;
+  spacecraft_angular_velocity_rad_s_ = spacecraft_angular_velocity_rad_s;
+  std::fill(is_body_frame_updated_.begin(), is_body_frame_updated_.end(), false);
 
   return;
 }
 
-void LocalCelestialInformation::CalcAllPosVel_b(const libra::Quaternion quaternion_i2b, const libra::Vector<3> spacecraft_angular_velocity_rad_s) {
-  libra::Vector<3> celestial_body_position_i_m, celestial_body_velocity_i_m_s;
-  double r_buf1_i[3], velocity_buf1_i[3], r_buf1_b[3], velocity_buf1_b[3];
-  double r_buf2_i[3], velocity_buf2_i[3], r_buf2_b[3], velocity_buf2_b[3];
-  for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    celestial_body_position_i_m = global_celestial_information_->GetPositionFromCenter_i_m(i);
-    celestial_body_velocity_i_m_s = global_celestial_information_->GetVelocityFromCenter_i_m_s(i);
-    for (int j = 0; j < 3; j++) {
-      r_buf1_i[j] = celestial_body_position_i_m[j];
-      r_buf2_i[j] = celestial_body_position_from_spacecraft_i_m_[i * 3 + j];
-      velocity_buf1_i[j] = celestial_body_velocity_i_m_s[j];
-      velocity_buf2_i[j] = celestial_body_velocity_from_spacecraft_i_m_s_[i * 3 + j];
-    }
-    ConvertInertialToBody(r_buf1_i, r_buf1_b, quaternion_i2b);
-    ConvertInertialToBody(r_buf2_i, r_buf2_b, quaternion_i2b);
-    ConvertVelocityInertialToBody(r_buf1_i, velocity_buf1_i, velocity_buf1_b, quaternion_i2b, spacecraft_angular_velocity_rad_s);
-    ConvertVelocityInertialToBody(r_buf2_i, velocity_buf2_i, velocity_buf2_b, quaternion_i2b, spacecraft_angular_velocity_rad_s);
+void LocalCelestialInformation::UpdateBodyFrame(const size_t index) const {
+  if (is_body_frame_updated_[index]) return;
+  is_body_frame_updated_[index] = true;
+
+  const int i = (int)index;
+  libra::Vector<3> celestial_body_position_i_m = global_celestial_information_->GetPositionFromCenter_i_m(i);
+  libra::Vector<3> celestial_body_velocity_i_m_s = global_celestial_information_->GetVelocityFromCenter_i_m_s(i);
+  double r_buf1_i[3], velocity_buf1_i[3];
+  for (int j = 0; j < 3; j++) {
+    r_buf1_i[j] = celestial_body_position_i_m[j];
+    velocity_buf1_i[j] = celestial_body_velocity_i_m_s[j];
+  }
+  const double* r_buf2_i = celestial_body_position_from_spacecraft_i_m_ + i * 3;
+  const double* velocity_buf2_i = celestial_body_velocity_from_spacecraft_i_m_s_ + i * 3;
+
+  ConvertInertialToBody(r_buf1_i, celestial_body_position_from_center_b_m_ + i * 3, quaternion_i2b_);
+  ConvertInertialToBody(r_buf2_i, celestial_body_position_from_spacecraft_b_m_ + i * 3, quaternion_i2b_);
+  ConvertVelocityInertialToBody(r_buf1_i, velocity_buf1_i, celestial_body_velocity_from_center_b_m_s_ + i * 3, quaternion_i2b_,
+                                spacecraft_angular_velocity_rad_s_);
+  ConvertVelocityInertialToBody(r_buf2_i, velocity_buf2_i, celestial_body_velocity_from_spacecraft_b_m_s_ + i * 3, quaternion_i2b_,
+                                spacecraft_angular_velocity_rad_s_);
+}
 
-    for (int j = 0; j < 3; j++) {
-      celestial_body_position_from_center_b_m_[i * 3 + j] = r_buf1_b[j];
-      celestial_body_position_from_spacecraft_b_m_[i * 3 + j] = r_buf2_b[j];
-      celestial_body_velocity_from_center_b_m_s_[i * 3 + j] = velocity_buf1_b[j];
-      celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j] = velocity_buf2_b[j];
-    }
+void LocalCelestialInformation::UpdateAllBodyFrames() const {
+  for (size_t i = 0; i < is_body_frame_updated_.size(); i++) {
+    UpdateBodyFrame(i);
   }
 }
 
-void LocalCelestialInformation::ConvertInertialToBody(const double* input_i, double* output_b, libra::Quaternion quaternion_i2b) {
+void LocalCelestialInformation::ConvertInertialToBody(const double* input_i, double* output_b, libra::Quaternion quaternion_i2b) const {
   libra::Vector<3> temp_i;
   for (int i = 0; i < 3; i++) {
     temp_i[i] = input_i[i];
@@ -101,7 +108,8 @@ void LocalCelestialInformation::ConvertInertialToBody(const double* input_i, dou
 }
 
 void LocalCelestialInformation::ConvertVelocityInertialToBody(const double* position_i, const double* velocity_i, double* velocity_b,
-                                                              const libra::Quaternion quaternion_i2b, const libra::Vector<3> angular_velocity_b) {
+                                                              const libra::Quaternion quaternion_i2b,
+                                                              const libra::Vector<3> angular_velocity_b) const {
   // copy input vector
   libra::Vector<3> vi;
   for (int i = 0; i < 3; i++) {
@@ -132,47 +140,43 @@ void LocalCelestialInformation::ConvertVelocityInertialToBody(const double* posi
 }
 
 libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->GetBodyHandle(body_name));
+}
+
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const CelestialBodyHandle body) const {
   libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
   for (int i = 0; i < 3; i++) {
-    position[i] = celestial_body_position_from_spacecraft_i_m_[index * 3 + i];
+    position[i] = celestial_body_position_from_spacecraft_i_m_[body.index_ * 3 + i];
   }
   return position;
 }
 
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_i_m() const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_i_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->GetCenterBodyHandle());
 }
 
 libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->GetBodyHandle(body_name));
+}
+
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const CelestialBodyHandle body) const {
+  UpdateBodyFrame(body.index_);
   libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
   for (int i = 0; i < 3; i++) {
-    position[i] = celestial_body_position_from_spacecraft_b_m_[index * 3 + i];
+    position[i] = celestial_body_position_from_spacecraft_b_m_[body.index_ * 3 + i];
   }
   return position;
 }
 
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_b_m(void) const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_b_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->GetCenterBodyHandle());
 }
 
 std::string LocalCelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int maxlen = 100;
-  char namebuf[maxlen];
   std::string str_tmp = "";
   for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    SpiceInt planet_id = global_celestial_information_->GetSelectedBodyIds()[i];
     // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    std::string name = namebuf;
+    std::string name = SpiceAccess::ConvertBodyIdToName(global_celestial_information_->GetSelectedBodyIds()[i]);
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -186,6 +190,7 @@ std::string LocalCelestialInformation::GetLogHeader() const {
 }
 
 std::string LocalCelestialInformation::GetLogValue() const {
+  UpdateAllBodyFrames();
   std::string str_tmp = "";
   for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
     for (int j = 0; j < 3; j++) {
@@ -197,3 +202,33 @@ std::string LocalCelestialInformation::GetLogValue() const {
   }
   return str_tmp;
 }
+
+void LocalCelestialInformation::SaveSnapshot(SnapshotWriter& snapshot) const {
+  UpdateAllBodyFrames();
+  const size_t num_of_state = (size_t)global_celestial_information_->GetNumberOfSelectedBodies() * 3;
+  for (const double* states : {celestial_body_position_from_center_b_m_, celestial_body_velocity_from_center_b_m_s_,
+                               celestial_body_position_from_spacecraft_i_m_, celestial_body_velocity_from_spacecraft_i_m_s_,
+                               celestial_body_position_from_spacecraft_b_m_, celestial_body_velocity_from_spacecraft_b_m_s_}) {
+    snapshot.Write(std::vector<double>(states, states + num_of_state));
+  }
+}
+
+void LocalCelestialInformation::LoadSnapshot(SnapshotReader& snapshot) {
+  const size_t num_of_state = (size_t)global_celestial_information_->GetNumberOfSelectedBodies() * 3;
+  for (double* states : {celestial_body_position_from_center_b_m_, celestial_body_velocity_from_center_b_m_s_,
+                         celestial_body_position_from_spacecraft_i_m_, celestial_body_velocity_from_spacecraft_i_m_s_,
+                         celestial_body_position_from_spacecraft_b_m_, celestial_body_velocity_from_spacecraft_b_m_s_}) {
+    std::vector<double> values;
+    snapshot.Read(values);
+    if (values.size() != num_of_state) throw std::invalid_argument("Snapshot is made with the different celestial bodies.");
+    std::copy(values.begin(), values.end(), states);
+  }
+  // The restored body frame vectors are used until the next update
+  std::fill(is_body_frame_updated_.begin(), is_body_frame_updated_.end(), true);
+}
+
+MemoryUsage LocalCelestialInformation::GetMemoryUsage() const {
+  // Six vector lists of the bodies
+  const size_t bodies_bytes = global_celestial_information_->GetNumberOfSelectedBodies() * 6 * 3 * sizeof(double);
+  return MemoryUsage("LocalCelestialInformation", sizeof(*this) + bodies_bytes);
+}
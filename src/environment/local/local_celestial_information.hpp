@@ -6,11 +6,16 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
 #define S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
 
+#include <vector>
+
 #include "../global/celestial_information.hpp"
+#include "utilities/snapshot.hpp"
 
 /**
  * @class LocalCelestialInformation
  * @brief Class to manage celestial body information in the spacecraft body frame
+ * @details The body frame vectors are converted on the first access to the body in each update, so the update costs only the conversions
+ *          of the bodies the users actually read.
  */
 class LocalCelestialInformation : public ILoggable {
  public:
@@ -44,6 +49,12 @@ class LocalCelestialInformation : public ILoggable {
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_i_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_i_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] body Handle of the body given by CelestialInformation::GetBodyHandle
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_i_m(const CelestialBodyHandle body) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_i_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Inertial frame)
@@ -56,6 +67,12 @@ class LocalCelestialInformation : public ILoggable {
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_b_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_b_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] body Handle of the body given by CelestialInformation::GetBodyHandle
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_b_m(const CelestialBodyHandle body) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_b_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Body fixed frame)
@@ -68,6 +85,19 @@ class LocalCelestialInformation : public ILoggable {
    */
   inline const CelestialInformation& GetGlobalInformation() const { return *global_celestial_information_; }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the positions and velocities of the celestial bodies to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the positions and velocities of the celestial bodies from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -80,6 +110,12 @@ class LocalCelestialInformation : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the body information seen from the spacecraft
+   */
+  MemoryUsage GetMemoryUsage() const;
+
  private:
   const CelestialInformation* global_celestial_information_;  //!< Global celestial information
   // Local Information
@@ -89,14 +125,21 @@ class LocalCelestialInformation : public ILoggable {
   double* celestial_body_position_from_spacecraft_b_m_;    //!< Celestial body position from the spacecraft in the spacecraft body fixed frame [m]
   double* celestial_body_velocity_from_center_b_m_s_;      //!< Celestial body velocity from the center body in the spacecraft body fixed frame [m/s]
   double* celestial_body_velocity_from_spacecraft_b_m_s_;  //!< Celestial body velocity from the spacecraft in the spacecraft body fixed frame [m/s]
+  libra::Quaternion quaternion_i2b_;                       //!< Spacecraft attitude quaternion from the inertial frame to the body fixed frame
+  libra::Vector<3> spacecraft_angular_velocity_rad_s_;     //!< Spacecraft angular velocity with respect to the inertial frame [rad/s]
+  mutable std::vector<bool> is_body_frame_updated_;        //!< Flags of the body frame vectors converted in the latest update
 
   /**
-   * @fn CalcAllPosVel_b
-   * @brief Frame conversion to the body frame for all selected celestial bodies
-   * @param [in] quaternion_i2b: Spacecraft attitude quaternion from the inertial frame to the body fixed frame
-   * @param [in] spacecraft_angular_velocity_rad_s: Spacecraft angular velocity with respect to the inertial frame [rad/s]
+   * @fn UpdateBodyFrame
+   * @brief Frame conversion to the body frame of a selected celestial body when it is not converted in the latest update
+   * @param [in] index: Index of the body
+   */
+  void UpdateBodyFrame(const size_t index) const;
+  /**
+   * @fn UpdateAllBodyFrames
+   * @brief Frame conversion to the body frame of all selected celestial bodies not converted in the latest update
    */
-  void CalcAllPosVel_b(const libra::Quaternion quaternion_i2b, const libra::Vector<3> spacecraft_angular_velocity_rad_s);
+  void UpdateAllBodyFrames() const;
 
   /**
    * @fn ConvertInertialToBody
@@ -105,7 +148,7 @@ class LocalCelestialInformation : public ILoggable {
    * @param [out] output_b: Output vector in the body fixed frame
    * @param [in] quaternion_i2b: Spacecraft attitude quaternion from the inertial frame to the body fixed frame
    */
-  void ConvertInertialToBody(const double* input_i, double* output_b, const libra::Quaternion quaternion_i2b);
+  void ConvertInertialToBody(const double* input_i, double* output_b, const libra::Quaternion quaternion_i2b) const;
 
   /**
    * @fn ConvertVelocityInertialToBody
@@ -117,7 +160,7 @@ class LocalCelestialInformation : public ILoggable {
    * @param [in] angular_velocity_b: Spacecraft angular velocity with respect to the inertial frame [rad/s]
    */
   void ConvertVelocityInertialToBody(const double* position_i, const double* velocity_i, double* velocity_b, const libra::Quaternion quaternion_i2b,
-                                     const libra::Vector<3> angular_velocity_b);
+                                     const libra::Vector<3> angular_velocity_b) const;
 };
 
 #endif  // S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
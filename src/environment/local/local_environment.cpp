@@ -7,6 +7,7 @@
 #include "dynamics/attitude/attitude.hpp"
 #include "dynamics/orbit/orbit.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
+#include "utilities/step_profiler.hpp"
 
 LocalEnvironment::LocalEnvironment(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
                                    const int spacecraft_id) {
@@ -18,6 +19,7 @@ LocalEnvironment::~LocalEnvironment() {
   delete solar_radiation_pressure_environment_;
   delete atmosphere_;
   delete celestial_information_;
+  delete earth_albedo_;
 }
 
 void LocalEnvironment::Initialize(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
@@ -35,12 +37,18 @@ void LocalEnvironment::Initialize(const SimulationConfiguration* simulation_conf
   atmosphere_ = new Atmosphere(InitAtmosphere(ini_fname, celestial_information_, &global_environment->GetSimulationTime()));
   solar_radiation_pressure_environment_ =
       new SolarRadiationPressureEnvironment(InitSolarRadiationPressureEnvironment(ini_fname, celestial_information_));
+  earth_albedo_ = new EarthAlbedo(InitEarthAlbedo(ini_fname, solar_radiation_pressure_environment_->GetSolarConstant_W_m2()));
 
   // Force to disable when the center body is not the Earth
   if (global_environment->GetCelestialInformation().GetCenterBodyName() != "EARTH") {
     geomagnetic_field_->IsCalcEnabled = false;
     atmosphere_->SetCalcFlag(false);
+    earth_albedo_->IsCalcEnabled = false;
   }
+  // The components using the sunlight access the albedo through the solar radiation pressure environment
+  if (earth_albedo_->IsCalcEnabled) solar_radiation_pressure_environment_->SetEarthAlbedo(earth_albedo_);
+
+  sun_ = global_environment->GetCelestialInformation().GetBodyHandle("SUN");
 
   // Log setting for Local celestial information
   IniAccess conf = IniAccess(ini_fname);
@@ -48,6 +56,8 @@ void LocalEnvironment::Initialize(const SimulationConfiguration* simulation_conf
 }
 
 void LocalEnvironment::Update(const Dynamics* dynamics, const SimulationTime* simulation_time) {
+  static const size_t profile_section_id = StepProfiler::RegisterSection("LocalEnvironment::Update");
+  ScopedProfileTimer timer(profile_section_id);
   auto& orbit = dynamics->GetOrbit();
   auto& attitude = dynamics->GetAttitude();
 
@@ -55,20 +65,73 @@ void LocalEnvironment::Update(const Dynamics* dynamics, const SimulationTime* si
   if (simulation_time->GetAttitudePropagateFlag()) {
     celestial_information_->UpdateAllObjectsInformation(orbit.GetPosition_i_m(), orbit.GetVelocity_i_m_s(), attitude.GetQuaternion_i2b(),
                                                         attitude.GetAngularVelocity_b_rad_s());
-    geomagnetic_field_->CalcMagneticField(simulation_time->GetCurrentDecimalYear(), simulation_time->GetCurrentSiderealTime(),
-                                          orbit.GetGeodeticPosition(), attitude.GetQuaternion_i2b());
+  }
+  // The state is filled at every update since the disturbances read it at every update
+  UpdateState(dynamics, simulation_time);
+
+  if (simulation_time->GetAttitudePropagateFlag()) {
+    geomagnetic_field_->CalcMagneticField(state_.decimal_year, state_.sidereal_day, state_.geodetic_position, state_.quaternion_i2b);
+    earth_albedo_->Update(state_);
   }
 
   // Update local environments that depend only on the position
   if (simulation_time->GetOrbitPropagateFlag()) {
-    solar_radiation_pressure_environment_->UpdateAllStates();
-    atmosphere_->CalcAirDensity_kg_m3(simulation_time->GetCurrentDecimalYear(), orbit);
+    solar_radiation_pressure_environment_->UpdateAllStates(state_);
+    atmosphere_->CalcAirDensity_kg_m3(state_);
   }
 }
 
+void LocalEnvironment::UpdateState(const Dynamics* dynamics, const SimulationTime* simulation_time) {
+  const Orbit& orbit = dynamics->GetOrbit();
+  const CelestialInformation& global_information = celestial_information_->GetGlobalInformation();
+
+  state_.decimal_year = simulation_time->GetCurrentDecimalYear();
+  state_.sidereal_day = simulation_time->GetCurrentSiderealTime();
+
+  state_.spacecraft_position_i_m = orbit.GetPosition_i_m();
+  state_.quaternion_i2b = dynamics->GetAttitude().GetQuaternion_i2b();
+  state_.geodetic_position = orbit.GetGeodeticPosition();
+
+  state_.sun_position_from_spacecraft_i_m = celestial_information_->GetPositionFromSpacecraft_i_m(sun_);
+  state_.sun_position_from_spacecraft_b_m = celestial_information_->GetPositionFromSpacecraft_b_m(sun_);
+  state_.sun_distance_m = state_.sun_position_from_spacecraft_i_m.CalcNorm();
+  state_.sun_direction_from_center_i = global_information.GetPositionFromCenter_i_m(sun_).CalcNormalizedVector();
+  state_.center_body_position_from_spacecraft_i_m = celestial_information_->GetCenterBodyPositionFromSpacecraft_i_m();
+  state_.center_body_position_from_spacecraft_b_m = celestial_information_->GetCenterBodyPositionFromSpacecraft_b_m();
+}
+
+void LocalEnvironment::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("LOCAL_ENVIRONMENT");
+  geomagnetic_field_->SaveSnapshot(snapshot);
+  solar_radiation_pressure_environment_->SaveSnapshot(snapshot);
+  atmosphere_->SaveSnapshot(snapshot);
+  celestial_information_->SaveSnapshot(snapshot);
+  earth_albedo_->SaveSnapshot(snapshot);
+}
+
+void LocalEnvironment::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("LOCAL_ENVIRONMENT");
+  geomagnetic_field_->LoadSnapshot(snapshot);
+  solar_radiation_pressure_environment_->LoadSnapshot(snapshot);
+  atmosphere_->LoadSnapshot(snapshot);
+  celestial_information_->LoadSnapshot(snapshot);
+  earth_albedo_->LoadSnapshot(snapshot);
+}
+
 void LocalEnvironment::LogSetup(Logger& logger) {
   logger.AddLogList(geomagnetic_field_);
   logger.AddLogList(solar_radiation_pressure_environment_);
   logger.AddLogList(atmosphere_);
   logger.AddLogList(celestial_information_);
+  logger.AddLogList(earth_albedo_);
+}
+
+MemoryUsage LocalEnvironment::GetMemoryUsage() const {
+  MemoryUsage memory_usage("LocalEnvironment", sizeof(*this));
+  memory_usage.AddChild(atmosphere_->GetMemoryUsage());
+  memory_usage.AddChild(geomagnetic_field_->GetMemoryUsage());
+  memory_usage.AddChild(solar_radiation_pressure_environment_->GetMemoryUsage());
+  memory_usage.AddChild(celestial_information_->GetMemoryUsage());
+  memory_usage.AddChild(earth_albedo_->GetMemoryUsage());
+  return memory_usage;
 }
@@ -8,11 +8,14 @@
 
 #include "atmosphere.hpp"
 #include "dynamics/dynamics.hpp"
+#include "earth_albedo.hpp"
 #include "environment/global/global_environment.hpp"
 #include "geomagnetic_field.hpp"
 #include "local_celestial_information.hpp"
+#include "local_environment_state.hpp"
 #include "simulation/simulation_configuration.hpp"
 #include "solar_radiation_pressure_environment.hpp"
+#include "utilities/case_arena.hpp"
 
 class Dynamics;
 
@@ -20,7 +23,7 @@ class Dynamics;
  * @class LocalEnvironment
  * @brief Class to manage local environments
  */
-class LocalEnvironment {
+class LocalEnvironment : public ArenaAllocated {
  public:
   /**
    * @fn LocalEnvironment
@@ -44,12 +47,31 @@ class LocalEnvironment {
    */
   void Update(const Dynamics* dynamics, const SimulationTime* simulation_time);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the local environments to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the states of the local environments from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
   /**
    * @fn LogSetup
    * @brief Log setup for local environments
    */
   void LogSetup(Logger& logger);
 
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the local environments
+   */
+  MemoryUsage GetMemoryUsage() const;
+
   /**
    * @fn GetAtmosphere
    * @brief Return Atmosphere class
@@ -70,12 +92,24 @@ class LocalEnvironment {
    * @brief Return LocalCelestialInformation class
    */
   inline const LocalCelestialInformation& GetCelestialInformation() const { return *celestial_information_; }
+  /**
+   * @fn GetEarthAlbedo
+   * @brief Return EarthAlbedo class
+   */
+  inline const EarthAlbedo& GetEarthAlbedo() const { return *earth_albedo_; }
+  /**
+   * @fn GetState
+   * @brief Return the shared inputs of the local environment models and the disturbances in the latest update
+   */
+  inline const LocalEnvironmentState& GetState() const { return state_; }
 
  private:
   Atmosphere* atmosphere_;                                                   //!< Atmospheric density of the earth
   GeomagneticField* geomagnetic_field_;                                      //!< Magnetic field of the earth
   SolarRadiationPressureEnvironment* solar_radiation_pressure_environment_;  //!< Solar radiation pressure
   LocalCelestialInformation* celestial_information_;                         //!< Celestial information
+  EarthAlbedo* earth_albedo_;                                                //!< Earth albedo and infrared radiation
+  LocalEnvironmentState state_;                                              //!< Shared inputs of the models in the latest update
 
   /**
    * @fn Initialize
@@ -85,6 +119,15 @@ class LocalEnvironment {
    * @param [in] spacecraft_id: Satellite ID
    */
   void Initialize(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment, const int spacecraft_id);
+  /**
+   * @fn UpdateState
+   * @brief Fill the shared inputs of the models with the dynamics, the simulation time, and the celestial information
+   * @param [in] dynamics: Dynamics information of the satellite
+   * @param [in] simulation_time: Simulation time
+   */
+  void UpdateState(const Dynamics* dynamics, const SimulationTime* simulation_time);
+
+  CelestialBodyHandle sun_;  //!< Handle of the sun
 };
 
 #endif  // S2E_ENVIRONMENT_LOCAL_LOCAL_ENVIRONMENT_HPP_
@@ -0,0 +1,38 @@
+/**
+ * @file local_environment_state.hpp
+ * @brief Shared inputs of the local environment models and the disturbances in a step
+ */
+
+#ifndef S2E_ENVIRONMENT_LOCAL_LOCAL_ENVIRONMENT_STATE_HPP_
+#define S2E_ENVIRONMENT_LOCAL_LOCAL_ENVIRONMENT_STATE_HPP_
+
+#include "math_physics/geodesy/geodetic_position.hpp"
+#include "math_physics/math/quaternion.hpp"
+#include "math_physics/math/vector.hpp"
+
+/**
+ * @struct LocalEnvironmentState
+ * @brief Shared inputs of the local environment models and the disturbances in a step
+ * @details LocalEnvironment fills the state once per step from the dynamics, the simulation time, and the celestial information, so that
+ *          the models do not look up the bodies and do not recompute the same norms and frame conversions.
+ */
+struct LocalEnvironmentState {
+  // Time
+  double decimal_year = 0.0;  //!< Decimal year [year]
+  double sidereal_day = 0.0;  //!< Greenwich sidereal time [day]
+
+  // Spacecraft
+  libra::Vector<3> spacecraft_position_i_m{0.0};  //!< Spacecraft position in the inertial frame [m]
+  libra::Quaternion quaternion_i2b;               //!< Quaternion from the inertial frame to the body frame
+  GeodeticPosition geodetic_position;             //!< Geodetic position of the spacecraft
+
+  // Celestial bodies
+  libra::Vector<3> sun_position_from_spacecraft_i_m{0.0};          //!< Sun position from the spacecraft in the inertial frame [m]
+  libra::Vector<3> sun_position_from_spacecraft_b_m{0.0};          //!< Sun position from the spacecraft in the body frame [m]
+  double sun_distance_m = 0.0;                                     //!< Distance from the spacecraft to the sun [m]
+  libra::Vector<3> sun_direction_from_center_i{0.0};               //!< Unit vector from the center body to the sun in the inertial frame
+  libra::Vector<3> center_body_position_from_spacecraft_i_m{0.0};  //!< Center body position from the spacecraft in the inertial frame [m]
+  libra::Vector<3> center_body_position_from_spacecraft_b_m{0.0};  //!< Center body position from the spacecraft in the body frame [m]
+};
+
+#endif  // S2E_ENVIRONMENT_LOCAL_LOCAL_ENVIRONMENT_STATE_HPP_
@@ -16,25 +16,43 @@
 SolarRadiationPressureEnvironment::SolarRadiationPressureEnvironment(LocalCelestialInformation* local_celestial_information)
     : local_celestial_information_(local_celestial_information) {
   solar_radiation_pressure_N_m2_ = solar_constant_W_m2_ / environment::speed_of_light_m_s;
-  shadow_source_name_list_.push_back(local_celestial_information_->GetGlobalInformation().GetCenterBodyName());
-  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m("SUN");
+  sun_ = local_celestial_information_->GetGlobalInformation().GetBodyHandle("SUN");
+  shadow_source_list_.push_back(local_celestial_information_->GetGlobalInformation().GetCenterBodyHandle());
+  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(sun_);
 }
 
 void SolarRadiationPressureEnvironment::UpdateAllStates() {
   if (!IsCalcEnabled) return;
 
-  UpdatePressure();
+  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_);
+  const double distance_sat_to_sun_m = r_sc2sun_eci.CalcNorm();
+  UpdatePressure(distance_sat_to_sun_m);
+  UpdateShadowCoefficient(r_sc2sun_eci, distance_sat_to_sun_m);
+}
+
+void SolarRadiationPressureEnvironment::UpdateAllStates(const LocalEnvironmentState& state) {
+  if (!IsCalcEnabled) return;
+
+  UpdatePressure(state.sun_distance_m);
+  UpdateShadowCoefficient(state.sun_position_from_spacecraft_i_m, state.sun_distance_m);
+}
+
+void SolarRadiationPressureEnvironment::UpdateShadowCoefficient(const libra::Vector<3>& r_sc2sun_eci, const double distance_sat_to_sun_m) {
   shadow_coefficient_ = 1.0;  // Initialize for multiple shadow source
-  for (auto shadow_source_name : shadow_source_name_list_) {
-    CalcShadowCoefficient(shadow_source_name);
+  // The apparent radius of the sun is common for all shadow sources
+  const double sin_sd_sun = sun_radius_m_ / distance_sat_to_sun_m;
+  const double cos_sd_sun = sqrt(std::max(1.0 - sin_sd_sun * sin_sd_sun, 0.0));
+  const double sd_sun = asin(sin_sd_sun);
+  for (const auto& shadow_source : shadow_source_list_) {
+    if (shadow_source == sun_) continue;
+    CalcShadowCoefficient(shadow_source, r_sc2sun_eci, sd_sun, sin_sd_sun, cos_sd_sun);
+    if (shadow_coefficient_ <= 0.0) break;  // Already in the umbra
   }
 }
 
-void SolarRadiationPressureEnvironment::UpdatePressure() {
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
-  const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
+void SolarRadiationPressureEnvironment::UpdatePressure(const double distance_sat_to_sun_m) {
   solar_radiation_pressure_N_m2_ =
-      solar_constant_W_m2_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun / environment::astronomical_unit_m, 2.0);
+      solar_constant_W_m2_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun_m / environment::astronomical_unit_m, 2.0);
 }
 
 std::string SolarRadiationPressureEnvironment::GetLogHeader() const {
@@ -55,24 +73,26 @@ std::string SolarRadiationPressureEnvironment::GetLogValue() const {
   return str_tmp;
 }
 
-void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow_source_name) {
-  if (shadow_source_name == "SUN") {
-    shadow_coefficient_ *= 1.0;
-    return;
+void SolarRadiationPressureEnvironment::CalcShadowCoefficient(const CelestialBodyHandle shadow_source, const libra::Vector<3>& r_sc2sun_eci,
+                                                              const double sd_sun, const double sin_sd_sun, const double cos_sd_sun) {
+  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source);
+  const libra::Vector<3> r_source2sun_eci = r_sc2sun_eci - r_sc2source_eci;
+  const double distance_sat_to_source_m = r_sc2source_eci.CalcNorm();
+  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(shadow_source);
+
+  // Bounding cone: the source cannot occult the sun when the angle of deviation is larger than the sum of the apparent radii. Both radii are
+  // less than pi/2, so the test compares the cosines and skips the trigonometric functions for the sources far from the sun direction.
+  const double sin_sd_source = shadow_source_radius_m / distance_sat_to_source_m;
+  const double cos_delta = InnerProduct(r_sc2source_eci, r_source2sun_eci) / distance_sat_to_source_m / r_source2sun_eci.CalcNorm();
+  if (sin_sd_source < 1.0) {
+    const double cos_sd_source = sqrt(1.0 - sin_sd_source * sin_sd_source);
+    if (cos_delta < cos_sd_sun * cos_sd_source - sin_sd_sun * sin_sd_source) return;
   }
 
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
-  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_name.c_str());
-
-  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m(shadow_source_name.c_str());
-
-  const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
-  const double sd_sun = asin(sun_radius_m_ / distance_sat_to_sun);                     // Apparent radius of the sun
-  const double sd_source = asin(shadow_source_radius_m / r_sc2source_eci.CalcNorm());  // Apparent radius of the shadow source
+  const double sd_source = asin(std::min(sin_sd_source, 1.0));  // Apparent radius of the shadow source
 
   // Angle of deviation from shadow source center to sun center
-  libra::Vector<3> r_source2sun_eci = r_sc2sun_eci - r_sc2source_eci;
-  const double delta = acos(InnerProduct(r_sc2source_eci, r_sc2sun_eci - r_sc2source_eci) / r_sc2source_eci.CalcNorm() / r_source2sun_eci.CalcNorm());
+  const double delta = acos(std::min(std::max(cos_delta, -1.0), 1.0));
   // The angle between the center of the sun and the common chord
   const double x = (delta * delta + sd_sun * sd_sun - sd_source * sd_source) / (2.0 * delta);
   // The length of the common chord of the apparent solar disk and apparent telestial disk
@@ -87,7 +107,7 @@ void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow
     shadow_coefficient_ *= 0.0;
   } else if (c < fabs(a - b) && a > b)  // The occultation is partial but maximum
   {
-    shadow_coefficient_ = 1.0 - (b * b) / (a * a);
+    shadow_coefficient_ *= 1.0 - (b * b) / (a * a);
   } else if (fabs(a - b) <= c && c <= (a + b))  // spacecraft is in penumbra
   {
     double A = a * a * acos(x / a) + b * b * acos((c - x) / b) - c * y;  // The area of the occulted segment of the apparent solar disk
@@ -102,6 +122,43 @@ void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow
   }
 }
 
+double SolarRadiationPressureEnvironment::CalcPenumbraSwitchingFunction_rad(const libra::Vector<3>& spacecraft_position_i_m) const {
+  double switching_function_rad = libra::pi;
+  for (const auto& shadow_source : shadow_source_list_) {
+    if (shadow_source == sun_) continue;
+    double a, b, c;
+    CalcApparentAngles_rad(shadow_source, spacecraft_position_i_m, a, b, c);
+    switching_function_rad = std::min(switching_function_rad, c - (a + b));
+  }
+  return switching_function_rad;
+}
+
+double SolarRadiationPressureEnvironment::CalcUmbraSwitchingFunction_rad(const libra::Vector<3>& spacecraft_position_i_m) const {
+  double switching_function_rad = libra::pi;
+  for (const auto& shadow_source : shadow_source_list_) {
+    if (shadow_source == sun_) continue;
+    double a, b, c;
+    CalcApparentAngles_rad(shadow_source, spacecraft_position_i_m, a, b, c);
+    switching_function_rad = std::min(switching_function_rad, c - fabs(a - b));
+  }
+  return switching_function_rad;
+}
+
+void SolarRadiationPressureEnvironment::CalcApparentAngles_rad(const CelestialBodyHandle shadow_source,
+                                                               const libra::Vector<3>& spacecraft_position_i_m, double& sun_radius_rad,
+                                                               double& source_radius_rad, double& separation_rad) const {
+  const CelestialInformation& global_information = local_celestial_information_->GetGlobalInformation();
+  const libra::Vector<3> r_sc2sun_eci = global_information.GetPositionFromCenter_i_m(sun_) - spacecraft_position_i_m;
+  const libra::Vector<3> r_sc2source_eci = global_information.GetPositionFromCenter_i_m(shadow_source) - spacecraft_position_i_m;
+
+  sun_radius_rad = asin(sun_radius_m_ / r_sc2sun_eci.CalcNorm());
+  source_radius_rad = asin(global_information.GetMeanRadius_m(shadow_source) / r_sc2source_eci.CalcNorm());
+  // Same definition with CalcShadowCoefficient so that the events match with the change of the shadow coefficient
+  const libra::Vector<3> r_source2sun_eci = r_sc2sun_eci - r_sc2source_eci;
+  const double cos_separation = InnerProduct(r_sc2source_eci, r_source2sun_eci) / r_sc2source_eci.CalcNorm() / r_source2sun_eci.CalcNorm();
+  separation_rad = acos(std::min(std::max(cos_separation, -1.0), 1.0));
+}
+
 SolarRadiationPressureEnvironment InitSolarRadiationPressureEnvironment(std::string initialize_file_path,
                                                                         LocalCelestialInformation* local_celestial_information) {
   auto conf = IniAccess(initialize_file_path);
@@ -110,6 +167,7 @@ SolarRadiationPressureEnvironment InitSolarRadiationPressureEnvironment(std::str
   SolarRadiationPressureEnvironment srp_env(local_celestial_information);
   srp_env.IsCalcEnabled = conf.ReadEnable(section, INI_CALC_LABEL);
   srp_env.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
+  srp_env.log_prescaler_ = conf.ReadInt(section, INI_LOG_PRESCALER_LABEL);
 
   size_t number_of_third_shadow_source = conf.ReadInt(section, "number_of_third_shadow_source");
   std::vector<std::string> list = conf.ReadVectorString(section, "third_shadow_source_name", number_of_third_shadow_source);
@@ -119,3 +177,17 @@ SolarRadiationPressureEnvironment InitSolarRadiationPressureEnvironment(std::str
 
   return srp_env;
 }
+
+void SolarRadiationPressureEnvironment::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(solar_radiation_pressure_N_m2_);
+  snapshot.Write(shadow_coefficient_);
+}
+
+void SolarRadiationPressureEnvironment::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(solar_radiation_pressure_N_m2_);
+  snapshot.Read(shadow_coefficient_);
+}
+
+MemoryUsage SolarRadiationPressureEnvironment::GetMemoryUsage() const {
+  return MemoryUsage("SolarRadiationPressureEnvironment", sizeof(*this) + CalcHeapMemory_bytes(shadow_source_list_));
+}
@@ -8,6 +8,10 @@
 
 #include "environment/global/physical_constants.hpp"
 #include "environment/local/local_celestial_information.hpp"
+#include "environment/local/local_environment_state.hpp"
+#include "utilities/snapshot.hpp"
+
+class EarthAlbedo;
 
 /**
  * @class SolarRadiationPressureEnvironment
@@ -35,6 +39,12 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    * @brief Update pressure and shadow coefficients
    */
   void UpdateAllStates();
+  /**
+   * @fn UpdateAllStates
+   * @brief Update pressure and shadow coefficients with the shared inputs of the local environment
+   * @param [in] state: Shared inputs of the local environment in the step
+   */
+  void UpdateAllStates(const LocalEnvironmentState& state);
 
   /**
    * @fn AddShadowSource
@@ -43,7 +53,7 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    */
   void AddShadowSource(const std::string shadow_source_name) {
     // TODO: Add assertion
-    shadow_source_name_list_.push_back(shadow_source_name);
+    shadow_source_list_.push_back(local_celestial_information_->GetGlobalInformation().GetBodyHandle(shadow_source_name.c_str()));
   }
 
   // Getter
@@ -67,6 +77,17 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    * @brief Return solar constant value [W/m^2]
    */
   inline double GetSolarConstant_W_m2() const { return solar_constant_W_m2_; }
+  /**
+   * @fn GetEarthAlbedo
+   * @brief Return the earth albedo and infrared model shared by the components using the sunlight (nullptr when it is not set)
+   */
+  inline const EarthAlbedo* GetEarthAlbedo() const { return earth_albedo_; }
+  /**
+   * @fn SetEarthAlbedo
+   * @brief Set the earth albedo and infrared model
+   * @param [in] earth_albedo: Earth albedo model owned by the local environment
+   */
+  inline void SetEarthAlbedo(const EarthAlbedo* earth_albedo) { earth_albedo_ = earth_albedo; }
   /**
    * @fn GetShadowCoefficient
    * @brief Return shadow function
@@ -78,6 +99,37 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    */
   inline bool GetIsEclipsed() const { return (shadow_coefficient_ >= 1.0 ? false : true); }
 
+  /**
+   * @fn CalcPenumbraSwitchingFunction_rad
+   * @brief Calculate the switching function of the penumbra for the event detection
+   * @note The angular separation between the sun and the shadow source minus the sum of their apparent radii. It changes its sign
+   *       smoothly at the penumbra entry and exit, while the shadow coefficient is constant in sunlight.
+   * @param [in] spacecraft_position_i_m: Spacecraft position from the center body in the inertial frame [m]
+   * @return Minimum value for the shadow sources (Negative in the penumbra or the umbra) [rad]
+   */
+  double CalcPenumbraSwitchingFunction_rad(const libra::Vector<3>& spacecraft_position_i_m) const;
+  /**
+   * @fn CalcUmbraSwitchingFunction_rad
+   * @brief Calculate the switching function of the umbra for the event detection
+   * @note The angular separation between the sun and the shadow source minus the difference of their apparent radii.
+   * @param [in] spacecraft_position_i_m: Spacecraft position from the center body in the inertial frame [m]
+   * @return Minimum value for the shadow sources (Negative in the umbra) [rad]
+   */
+  double CalcUmbraSwitchingFunction_rad(const libra::Vector<3>& spacecraft_position_i_m) const;
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the pressure and the shadow coefficient to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the pressure and the shadow coefficient from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -90,27 +142,59 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage
+   */
+  MemoryUsage GetMemoryUsage() const;
+
  private:
-  double solar_radiation_pressure_N_m2_;              //!< Solar radiation pressure [N/m^2]
-  double solar_constant_W_m2_ = 1366.0;               //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
-  double shadow_coefficient_ = 1.0;                   //!< Shadow function
-  double sun_radius_m_;                               //!< Sun radius [m]
-  std::vector<std::string> shadow_source_name_list_;  //!< Shadow source name list
+  double solar_radiation_pressure_N_m2_;                 //!< Solar radiation pressure [N/m^2]
+  double solar_constant_W_m2_ = 1366.0;                  //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
+  double shadow_coefficient_ = 1.0;                      //!< Shadow function
+  double sun_radius_m_;                                  //!< Sun radius [m]
+  std::vector<CelestialBodyHandle> shadow_source_list_;  //!< Shadow source handle list
+  CelestialBodyHandle sun_;                              //!< Handle of the sun
 
   LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  const EarthAlbedo* earth_albedo_ = nullptr;               //!< Earth albedo and infrared model
 
   /**
    * @fn UpdatePressure
    * @brief Update pressure with solar distance
+   * @param [in] distance_sat_to_sun_m: Distance from the spacecraft to the sun [m]
    */
-  void UpdatePressure();
+  void UpdatePressure(const double distance_sat_to_sun_m);
 
+  /**
+   * @fn UpdateShadowCoefficient
+   * @brief Update shadow coefficient with all shadow sources
+   * @param [in] r_sc2sun_eci: Sun position from the spacecraft in the inertial frame [m]
+   * @param [in] distance_sat_to_sun_m: Distance from the spacecraft to the sun [m]
+   */
+  void UpdateShadowCoefficient(const libra::Vector<3>& r_sc2sun_eci, const double distance_sat_to_sun_m);
   /**
    * @fn CalcShadowCoefficient
-   * @brief Calculate shadow coefficient
-   * @param [in] shadow_source_name_: Shadow source name
+   * @brief Multiply the shadow coefficient by the occultation of a shadow source
+   * @param [in] shadow_source: Handle of the shadow source
+   * @param [in] r_sc2sun_eci: Sun position from the spacecraft in the inertial frame [m]
+   * @param [in] sd_sun: Apparent radius of the sun [rad]
+   * @param [in] sin_sd_sun: Sine of the apparent radius of the sun
+   * @param [in] cos_sd_sun: Cosine of the apparent radius of the sun
+   */
+  void CalcShadowCoefficient(const CelestialBodyHandle shadow_source, const libra::Vector<3>& r_sc2sun_eci, const double sd_sun,
+                             const double sin_sd_sun, const double cos_sd_sun);
+  /**
+   * @fn CalcApparentAngles_rad
+   * @brief Calculate the apparent radii of the sun and the shadow source and their angular separation seen from the spacecraft
+   * @param [in] shadow_source: Handle of the shadow source
+   * @param [in] spacecraft_position_i_m: Spacecraft position from the center body in the inertial frame [m]
+   * @param [out] sun_radius_rad: Apparent radius of the sun [rad]
+   * @param [out] source_radius_rad: Apparent radius of the shadow source [rad]
+   * @param [out] separation_rad: Angular separation between the sun and the shadow source [rad]
    */
-  void CalcShadowCoefficient(std::string shadow_source_name);
+  void CalcApparentAngles_rad(const CelestialBodyHandle shadow_source, const libra::Vector<3>& spacecraft_position_i_m, double& sun_radius_rad,
+                              double& source_radius_rad, double& separation_rad) const;
 };
 
 /**
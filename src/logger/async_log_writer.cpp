@@ -0,0 +1,70 @@
+/**
+ * @file async_log_writer.cpp
+ * @brief Class to write log rows to a file in a background thread
+ */
+
+#include "async_log_writer.hpp"
+
+#include <chrono>
+
+static const std::chrono::microseconds kIdleWaitTime(500);  //!< Sleep time of the writer thread when the buffer is empty
+
+AsyncLogWriter::AsyncLogWriter(std::ostream& stream, const size_t number_of_slots, const FullBufferPolicy full_buffer_policy)
+    : stream_(stream), full_buffer_policy_(full_buffer_policy), slots_(number_of_slots > 0 ? number_of_slots : 1), head_(0), tail_(0) {
+  is_running_.store(true);
+  writer_thread_ = std::thread(&AsyncLogWriter::Run, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() { Stop(); }
+
+bool AsyncLogWriter::Push(std::string& row) {
+  const size_t tail = tail_.load(std::memory_order_relaxed);
+  size_t head = head_.load(std::memory_order_acquire);
+  if (tail - head >= slots_.size()) {
+    if (full_buffer_policy_ == FullBufferPolicy::kDrop || !is_running_.load()) {
+      number_of_dropped_rows_++;
+      row.clear();
+      return false;
+    }
+    number_of_blocked_pushes_++;
+    while (tail - head >= slots_.size()) {
+      std::this_thread::yield();
+      head = head_.load(std::memory_order_acquire);
+    }
+  }
+
+  std::string& slot = slots_[tail % slots_.size()];
+  slot.swap(row);
+  row.clear();
+  tail_.store(tail + 1, std::memory_order_release);
+
+  number_of_pushed_rows_++;
+  if (tail + 1 - head > max_number_of_used_slots_) max_number_of_used_slots_ = tail + 1 - head;
+  return true;
+}
+
+void AsyncLogWriter::Stop() {
+  if (!writer_thread_.joinable()) return;
+  is_running_.store(false);
+  writer_thread_.join();
+  stream_.flush();
+}
+
+void AsyncLogWriter::Run() {
+  while (is_running_.load()) {
+    if (!Drain()) std::this_thread::sleep_for(kIdleWaitTime);
+  }
+  // Write the rows pushed before the stop request
+  Drain();
+}
+
+bool AsyncLogWriter::Drain() {
+  size_t head = head_.load(std::memory_order_relaxed);
+  const size_t tail = tail_.load(std::memory_order_acquire);
+  if (head == tail) return false;
+  for (; head != tail; head++) {
+    stream_ << slots_[head % slots_.size()];
+    head_.store(head + 1, std::memory_order_release);
+  }
+  return true;
+}
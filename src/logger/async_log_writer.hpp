@@ -0,0 +1,116 @@
+/**
+ * @file async_log_writer.hpp
+ * @brief Class to write log rows to a file in a background thread
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_ASYNC_LOG_WRITER_HPP_
+#define S2E_LIBRARY_LOGGER_ASYNC_LOG_WRITER_HPP_
+
+#include <atomic>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class AsyncLogWriter
+ * @brief Class to write log rows to a file in a background thread
+ * @note The rows are passed through a bounded single-producer single-consumer lock-free ring buffer.
+ *       Push must be called from one thread (the simulation thread), and the output stream must not be accessed by the others while
+ *       the writer is running.
+ */
+class AsyncLogWriter {
+ public:
+  /**
+   * @enum FullBufferPolicy
+   * @brief Behavior of Push when the ring buffer is full
+   */
+  enum class FullBufferPolicy {
+    kBlock,  //!< Wait until the writer thread makes a space. No row is lost.
+    kDrop,   //!< Drop the row. The simulation is never stalled by the disk.
+  };
+
+  /**
+   * @fn AsyncLogWriter
+   * @brief Constructor
+   * @param [in] stream: Output stream. It must be alive until Stop is called.
+   * @param [in] number_of_slots: Number of rows stored in the ring buffer
+   * @param [in] full_buffer_policy: Behavior when the ring buffer is full
+   */
+  AsyncLogWriter(std::ostream& stream, const size_t number_of_slots, const FullBufferPolicy full_buffer_policy);
+  /**
+   * @fn ~AsyncLogWriter
+   * @brief Destructor. Write all remaining rows and stop the writer thread.
+   */
+  ~AsyncLogWriter();
+
+  /**
+   * @fn Push
+   * @brief Pass a row to the writer thread
+   * @note The content of row is swapped with a used slot string to reuse the allocated memory, so row is cleared after the call.
+   * @param [in/out] row: Text of the row
+   * @return True when the row is stored in the buffer. False when it is dropped.
+   */
+  bool Push(std::string& row);
+  /**
+   * @fn Stop
+   * @brief Write all remaining rows and stop the writer thread
+   */
+  void Stop();
+
+  // Getter
+  /**
+   * @fn GetNumberOfPushedRows
+   * @brief Return number of rows stored in the buffer
+   */
+  inline size_t GetNumberOfPushedRows() const { return number_of_pushed_rows_; }
+  /**
+   * @fn GetNumberOfDroppedRows
+   * @brief Return number of rows dropped since the buffer was full (kDrop policy)
+   */
+  inline size_t GetNumberOfDroppedRows() const { return number_of_dropped_rows_; }
+  /**
+   * @fn GetNumberOfBlockedPushes
+   * @brief Return number of pushes which waited for the writer thread since the buffer was full (kBlock policy)
+   */
+  inline size_t GetNumberOfBlockedPushes() const { return number_of_blocked_pushes_; }
+  /**
+   * @fn GetMaxNumberOfUsedSlots
+   * @brief Return the maximum number of rows waiting in the buffer
+   */
+  inline size_t GetMaxNumberOfUsedSlots() const { return max_number_of_used_slots_; }
+  /**
+   * @fn GetNumberOfSlots
+   * @brief Return number of rows stored in the ring buffer
+   */
+  inline size_t GetNumberOfSlots() const { return slots_.size(); }
+
+ private:
+  std::ostream& stream_;                       //!< Output stream
+  const FullBufferPolicy full_buffer_policy_;  //!< Behavior when the ring buffer is full
+  std::vector<std::string> slots_;             //!< Ring buffer
+  std::atomic<size_t> head_;                   //!< Total number of rows written by the writer thread
+  std::atomic<size_t> tail_;                   //!< Total number of rows pushed by the producer
+  std::atomic<bool> is_running_;               //!< Flag to keep the writer thread running
+  std::thread writer_thread_;                  //!< Writer thread
+
+  // Counters (accessed only by the producer)
+  size_t number_of_pushed_rows_ = 0;     //!< Number of rows stored in the buffer
+  size_t number_of_dropped_rows_ = 0;    //!< Number of dropped rows
+  size_t number_of_blocked_pushes_ = 0;  //!< Number of pushes which waited for the writer thread
+  size_t max_number_of_used_slots_ = 0;  //!< Maximum number of rows waiting in the buffer
+
+  /**
+   * @fn Run
+   * @brief Main function of the writer thread
+   */
+  void Run();
+  /**
+   * @fn Drain
+   * @brief Write all rows in the buffer to the stream
+   * @return True when one or more rows are written
+   */
+  bool Drain();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_ASYNC_LOG_WRITER_HPP_
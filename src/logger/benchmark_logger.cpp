@@ -0,0 +1,113 @@
+/**
+ * @file benchmark_logger.cpp
+ * @brief Benchmark codes for the log output throughput of each file format
+ */
+#include <iostream>
+#include <string>
+#include <utilities/benchmark_measurement.hpp>
+#include <vector>
+
+#include "logger.hpp"
+
+/**
+ * @class BenchmarkLoggable
+ * @brief Loggable with the vectors like the spacecraft states
+ */
+class BenchmarkLoggable : public ILoggable {
+ public:
+  /**
+   * @fn BenchmarkLoggable
+   * @brief Constructor
+   * @param [in] number_of_vectors: Number of three dimensional vectors
+   * @param [in] is_typed_output_enabled: Use AppendLogValue instead of GetLogValue
+   */
+  BenchmarkLoggable(const size_t number_of_vectors, const bool is_typed_output_enabled)
+      : vectors_(number_of_vectors, libra::Vector<3>(0.0)), is_typed_output_enabled_(is_typed_output_enabled) {}
+
+  /**
+   * @fn Update
+   * @brief Update the values to avoid the same output
+   */
+  void Update() {
+    for (size_t i = 0; i < vectors_.size(); i++) {
+      for (size_t n = 0; n < 3; n++) vectors_[i][n] += 1.0e-3 * (double)(i + n + 1);
+    }
+  }
+
+  virtual std::string GetLogHeader() const {
+    std::string str_tmp = "";
+    for (size_t i = 0; i < vectors_.size(); i++) str_tmp += WriteVector("vector" + std::to_string(i), "b", "m", 3);
+    return str_tmp;
+  }
+  virtual std::string GetLogValue() const {
+    std::string str_tmp = "";
+    for (const libra::Vector<3>& vector : vectors_) str_tmp += WriteVector(vector);
+    return str_tmp;
+  }
+  virtual bool AppendLogValue(ILogValueSink& sink) const {
+    if (!is_typed_output_enabled_) return false;
+    for (const libra::Vector<3>& vector : vectors_) sink.AppendVector(vector);
+    return true;
+  }
+
+ private:
+  std::vector<libra::Vector<3>> vectors_;  //!< Logged vectors
+  bool is_typed_output_enabled_;           //!< Use AppendLogValue
+};
+
+/**
+ * @fn MeasureLogger
+ * @brief Measure the time to write a row and print the throughput
+ * @param [in] name: Name of the configuration
+ * @param [in] logger: Logger
+ * @param [in] loggable: Logged object
+ */
+void MeasureLogger(const std::string name, Logger& logger, BenchmarkLoggable& loggable) {
+  const size_t number_of_rows = 20000;
+  logger.AddLogList(&loggable);
+  logger.WriteHeaders();
+  const double row_ns = MeasureNanosecondsPerCall(
+      [&]() {
+        loggable.Update();
+        logger.WriteValues();
+      },
+      number_of_rows);
+  std::cout << name << ", " << row_ns << ", " << 1.0e9 / row_ns << std::endl;
+}
+
+int main() {
+  const size_t number_of_vectors = 30;
+  // The files are written in the current directory with the time prefix
+  const std::string data_path = "./";
+
+  std::cout << number_of_vectors * 3 << " columns" << std::endl;
+  std::cout << "format, write [ns/row], throughput [rows/s]" << std::endl;
+  {
+    BenchmarkLoggable loggable(number_of_vectors, false);
+    Logger logger("benchmark_csv_text.csv", data_path, "", false, true, false, LogFileFormat::kCsv);
+    MeasureLogger("CSV with GetLogValue", logger, loggable);
+  }
+  {
+    BenchmarkLoggable loggable(number_of_vectors, true);
+    Logger logger("benchmark_csv_typed.csv", data_path, "", false, true, false, LogFileFormat::kCsv);
+    MeasureLogger("CSV with AppendLogValue", logger, loggable);
+  }
+  {
+    BenchmarkLoggable loggable(number_of_vectors, true);
+    Logger logger("benchmark_csv_async.csv", data_path, "", false, true, false, LogFileFormat::kCsv);
+    logger.EnableAsyncWriter(1024, AsyncLogWriter::FullBufferPolicy::kBlock);
+    MeasureLogger("CSV with async writer", logger, loggable);
+  }
+  {
+    BenchmarkLoggable loggable(number_of_vectors, true);
+    Logger logger("benchmark_binary.csv", data_path, "", false, true, false, LogFileFormat::kBinary);
+    MeasureLogger("Binary", logger, loggable);
+  }
+  {
+    BenchmarkLoggable loggable(number_of_vectors, true);
+    Logger logger("benchmark_binary_gzip.csv", data_path, "", false, true, false, LogFileFormat::kBinary, LogCompression::kGzip);
+    MeasureLogger("Binary with gzip", logger, loggable);
+  }
+
+  return 0;
+}
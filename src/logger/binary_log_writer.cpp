@@ -0,0 +1,215 @@
+/**
+ * @file binary_log_writer.cpp
+ * @brief Class to write log values in a binary columnar format
+ */
+
+#include "binary_log_writer.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+static const char kBinaryLogMagic[8] = {'S', '2', 'E', 'B', 'L', 'O', 'G', '\0'};  //!< Magic number of the binary log file
+
+BinaryLogWriter::BinaryLogWriter()
+    : stream_(nullptr),
+      log_store_(nullptr),
+      case_index_(0),
+      record_type_(MonteCarloLogStore::RecordType::kCaseLog),
+      is_schema_written_(false),
+      current_column_index_(0),
+      number_of_rows_(0) {}
+
+BinaryLogWriter::~BinaryLogWriter() { Close(); }
+
+bool BinaryLogWriter::Open(const std::string& file_path, const bool is_compression_enabled) {
+  const std::string opened_file_path = is_compression_enabled ? file_path + ".gz" : file_path;
+  file_.open(opened_file_path, std::ios::out | std::ios::binary);
+  if (!file_.is_open()) {
+    std::cerr << "Error opening binary log file: " << opened_file_path << std::endl;
+    return false;
+  }
+  if (is_compression_enabled) {
+    compressed_stream_buffer_.reset(new CompressedStreamBuffer(file_.rdbuf()));
+    stream_.rdbuf(compressed_stream_buffer_.get());
+  } else {
+    stream_.rdbuf(file_.rdbuf());
+  }
+  return true;
+}
+
+bool BinaryLogWriter::OpenStore(MonteCarloLogStore* log_store, const uint64_t case_index, const MonteCarloLogStore::RecordType record_type) {
+  if (log_store == nullptr || !log_store->IsOpened()) return false;
+  log_store_ = log_store;
+  case_index_ = case_index;
+  record_type_ = record_type;
+  stream_.rdbuf(&store_buffer_);
+  return true;
+}
+
+void BinaryLogWriter::Close() {
+  if (!IsOpened()) return;
+  if (current_column_index_ > 0) EndRow();
+  Flush();
+  stream_.flush();
+  if (log_store_ != nullptr) {
+    AppendBufferToStore();
+    log_store_ = nullptr;
+    return;
+  }
+  compressed_stream_buffer_.reset();
+  file_.close();
+}
+
+void BinaryLogWriter::AppendBufferToStore() {
+  const std::string data = store_buffer_.str();
+  log_store_->AppendRecord(record_type_, case_index_, data.data(), data.size());
+  store_buffer_.str("");
+}
+
+void BinaryLogWriter::AppendHeaders(const std::string& csv_headers) {
+  std::stringstream stream(csv_headers);
+  std::string name;
+  while (std::getline(stream, name, ',')) {
+    if (name.empty()) continue;
+    Column column;
+    column.name_ = name;
+    columns_.push_back(column);
+  }
+}
+
+void BinaryLogWriter::AppendValues(const std::string& csv_values) {
+  size_t start = 0;
+  while (start < csv_values.size()) {
+    size_t end = csv_values.find(',', start);
+    if (end == std::string::npos) end = csv_values.size();
+    const std::string value = csv_values.substr(start, end - start);
+    start = end + 1;
+    // Empty fields (e.g., skipped by the log prescaler) keep their columns as the missing values
+    if (value.empty()) {
+      AppendMissingValues(1);
+      continue;
+    }
+
+    // Store the value as double when the whole text is a number
+    char* parse_end = nullptr;
+    const double number = std::strtod(value.c_str(), &parse_end);
+    if (parse_end != value.c_str() && *parse_end == '\0') {
+      AppendDouble(number);
+    } else {
+      AppendString(value);
+    }
+  }
+}
+
+void BinaryLogWriter::AppendDouble(const double value, const int precision) {
+  (void)precision;
+  Column* column = GetCurrentColumn(ColumnType::kDouble);
+  if (column == nullptr) return;
+  if (column->type_ == ColumnType::kDouble) {
+    column->double_values_.push_back(value);
+  } else {
+    std::stringstream stream;
+    stream << value;
+    column->string_values_.push_back(stream.str());
+  }
+}
+
+void BinaryLogWriter::AppendInteger(const long long value) { AppendDouble((double)value); }
+
+void BinaryLogWriter::AppendString(const std::string& value) {
+  Column* column = GetCurrentColumn(ColumnType::kString);
+  if (column == nullptr) return;
+  if (column->type_ == ColumnType::kString) {
+    column->string_values_.push_back(value);
+  } else {
+    if (!column->is_type_mismatch_warned_) {
+      std::cerr << "[Warning] BinaryLogWriter: The text value " << value << " is written to the numerical column " << column->name_
+                << " as NaN." << std::endl;
+      column->is_type_mismatch_warned_ = true;
+    }
+    column->double_values_.push_back(std::numeric_limits<double>::quiet_NaN());
+  }
+}
+
+void BinaryLogWriter::AppendMissingValues(const size_t number_of_values) {
+  for (size_t i = 0; i < number_of_values; i++) {
+    Column* column = GetCurrentColumn(ColumnType::kDouble);
+    if (column == nullptr) return;
+    if (column->type_ == ColumnType::kDouble) {
+      column->double_values_.push_back(std::numeric_limits<double>::quiet_NaN());
+    } else {
+      column->string_values_.push_back("");
+    }
+  }
+}
+
+void BinaryLogWriter::EndRow() {
+  // Fill the missing values
+  for (; current_column_index_ < columns_.size(); current_column_index_++) {
+    Column& column = columns_[current_column_index_];
+    if (column.type_ == ColumnType::kDouble) {
+      column.double_values_.push_back(std::numeric_limits<double>::quiet_NaN());
+    } else {
+      column.string_values_.push_back("");
+    }
+  }
+  current_column_index_ = 0;
+  number_of_rows_++;
+  if (number_of_rows_ >= kNumberOfRowsPerChunk) Flush();
+}
+
+void BinaryLogWriter::Flush() {
+  if (!IsOpened()) return;
+  if (!is_schema_written_) WriteSchema();
+  if (number_of_rows_ == 0) return;
+
+  stream_.write(reinterpret_cast<const char*>(&number_of_rows_), sizeof(number_of_rows_));
+  for (auto& column : columns_) {
+    if (column.type_ == ColumnType::kDouble) {
+      stream_.write(reinterpret_cast<const char*>(column.double_values_.data()), column.double_values_.size() * sizeof(double));
+      column.double_values_.clear();
+    } else {
+      for (const auto& value : column.string_values_) {
+        const uint32_t length = (uint32_t)value.size();
+        stream_.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        stream_.write(value.data(), length);
+      }
+      column.string_values_.clear();
+    }
+  }
+  number_of_rows_ = 0;
+  if (log_store_ != nullptr) AppendBufferToStore();
+}
+
+BinaryLogWriter::Column* BinaryLogWriter::GetCurrentColumn(const ColumnType type) {
+  // The column types are determined by the first row
+  const bool is_first_row = !is_schema_written_ && number_of_rows_ == 0;
+  if (current_column_index_ >= columns_.size()) {
+    if (!is_first_row) return nullptr;
+    Column column;
+    column.name_ = "column" + std::to_string(current_column_index_);
+    columns_.push_back(column);
+  }
+  Column* column = &columns_[current_column_index_];
+  if (is_first_row) column->type_ = type;
+  current_column_index_++;
+  return column;
+}
+
+void BinaryLogWriter::WriteSchema() {
+  stream_.write(kBinaryLogMagic, sizeof(kBinaryLogMagic));
+  const uint32_t version = kVersion;
+  stream_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  const uint32_t number_of_columns = (uint32_t)columns_.size();
+  stream_.write(reinterpret_cast<const char*>(&number_of_columns), sizeof(number_of_columns));
+  for (const auto& column : columns_) {
+    const uint8_t type = (uint8_t)column.type_;
+    stream_.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    const uint32_t length = (uint32_t)column.name_.size();
+    stream_.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    stream_.write(column.name_.data(), length);
+  }
+  is_schema_written_ = true;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file binary_log_writer.hpp
+ * @brief Class to write log values in a binary columnar format
+ * @note File format (all values are little endian)
+ *       Header: magic "S2EBLOG\0" (8 bytes), version (uint32), number of columns (uint32),
+ *               and for each column: type (uint8), name length (uint32), name (characters without null termination)
+ *       Chunk : number of rows (uint32), and for each column the values of all rows in the chunk
+ *               kDouble column: raw double values (8 bytes each), kString column: length (uint32) and characters for each row
+ *       The chunks continue until the end of the file. Use scripts/Plot/convert_binary_log_to_csv.py to convert it to CSV.
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_BINARY_LOG_WRITER_HPP_
+#define S2E_LIBRARY_LOGGER_BINARY_LOG_WRITER_HPP_
+
+#include <stdint.h>
+
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "compressed_stream_buffer.hpp"
+#include "log_value_sink.hpp"
+#include "monte_carlo_log_store.hpp"
+
+/**
+ * @class BinaryLogWriter
+ * @brief Class to write log values in a binary columnar format
+ */
+class BinaryLogWriter : public ILogValueSink {
+ public:
+  /**
+   * @enum ColumnType
+   * @brief Value type of the column
+   */
+  enum class ColumnType : uint8_t {
+    kDouble = 0,  //!< 64bit floating point value
+    kString = 1,  //!< Text value (e.g., date time)
+  };
+
+  /**
+   * @fn BinaryLogWriter
+   * @brief Constructor
+   */
+  BinaryLogWriter();
+  /**
+   * @fn ~BinaryLogWriter
+   * @brief Destructor. Flush the remaining rows and close the file.
+   */
+  ~BinaryLogWriter();
+
+  /**
+   * @fn Open
+   * @brief Open the binary log file
+   * @param [in] file_path: Path to the binary log file
+   * @param [in] is_compression_enabled: Compress the file with gzip in chunks. The extension .gz is appended to file_path.
+   * @return True when the file is opened successfully
+   */
+  bool Open(const std::string& file_path, const bool is_compression_enabled = false);
+  /**
+   * @fn OpenStore
+   * @brief Write the binary log to the Monte-Carlo log store instead of a file
+   * @note Each chunk is appended to the store as a record when it is flushed, so the memory usage does not depend on the length of the log.
+   * @param [in] log_store: Monte-Carlo log store. It should be alive until this writer is closed.
+   * @param [in] case_index: Index of the case
+   * @param [in] record_type: Type of the records
+   * @return True when the store is opened
+   */
+  bool OpenStore(MonteCarloLogStore* log_store, const uint64_t case_index,
+                 const MonteCarloLogStore::RecordType record_type = MonteCarloLogStore::RecordType::kCaseLog);
+  /**
+   * @fn Close
+   * @brief Flush the remaining rows and close the file
+   */
+  void Close();
+  /**
+   * @fn IsOpened
+   * @brief Return true when the file is opened
+   */
+  inline bool IsOpened() const { return file_.is_open() || log_store_ != nullptr; }
+
+  /**
+   * @fn AppendHeaders
+   * @brief Append column names with the CSV header format generated by ILoggable::GetLogHeader
+   * @param [in] csv_headers: Comma separated column names
+   */
+  void AppendHeaders(const std::string& csv_headers);
+  /**
+   * @fn AppendValues
+   * @brief Append values to the current row with the CSV value format generated by ILoggable::GetLogValue
+   * @note Numerical values are stored as double, and the other values are stored as string. Empty values are stored as the missing values
+   *       (NaN or empty string) to keep the following values in their columns. A text value in a numerical column is stored as NaN with a
+   *       warning.
+   * @param [in] csv_values: Comma separated values
+   */
+  void AppendValues(const std::string& csv_values);
+  /**
+   * @fn AppendDouble
+   * @brief Append a double value to the current row
+   * @param [in] value: Value
+   * @param [in] precision: Not used since the value is stored without loss
+   */
+  void AppendDouble(const double value, const int precision = 6) override;
+  /**
+   * @fn AppendInteger
+   * @brief Append an integer value to the current row. It is stored as double.
+   * @param [in] value: Value
+   */
+  void AppendInteger(const long long value) override;
+  /**
+   * @fn AppendString
+   * @brief Append a string value to the current row
+   * @param [in] value: Value
+   */
+  void AppendString(const std::string& value) override;
+  /**
+   * @fn AppendMissingValues
+   * @brief Append NaN or empty string to the current row
+   * @param [in] number_of_values: Number of the values
+   */
+  void AppendMissingValues(const size_t number_of_values) override;
+  /**
+   * @fn EndRow
+   * @brief Finish the current row. The missing values are filled with NaN or empty string.
+   */
+  void EndRow();
+  /**
+   * @fn Flush
+   * @brief Write the buffered rows to the file as a chunk
+   */
+  void Flush();
+
+  static const uint32_t kVersion = 1;                  //!< Version of the file format
+  static const uint32_t kNumberOfRowsPerChunk = 1024;  //!< Number of rows buffered before writing a chunk
+
+ private:
+  /**
+   * @struct Column
+   * @brief Buffer of a column
+   */
+  struct Column {
+    std::string name_;                        //!< Column name
+    ColumnType type_ = ColumnType::kDouble;   //!< Value type
+    std::vector<double> double_values_;       //!< Buffered values for kDouble column
+    std::vector<std::string> string_values_;  //!< Buffered values for kString column
+    bool is_type_mismatch_warned_ = false;    //!< Flag to show the warning of a text value in the kDouble column once
+  };
+
+  std::ofstream file_;                                                //!< Output file stream
+  std::ostream stream_;                                               //!< Stream to write the data via the compression if enabled
+  std::unique_ptr<CompressedStreamBuffer> compressed_stream_buffer_;  //!< Compression of the file
+
+  MonteCarloLogStore* log_store_;               //!< Monte-Carlo log store. nullptr to write the file.
+  uint64_t case_index_;                         //!< Index of the case in the log store
+  MonteCarloLogStore::RecordType record_type_;  //!< Type of the records in the log store
+  std::stringbuf store_buffer_;                 //!< Buffer of the chunk appended to the log store
+
+  std::vector<Column> columns_;  //!< Columns
+  bool is_schema_written_;       //!< Flag to show the header of the file is already written
+  size_t current_column_index_;  //!< Index of the column for the next appended value
+  uint32_t number_of_rows_;      //!< Number of rows buffered in the columns
+
+  /**
+   * @fn GetCurrentColumn
+   * @brief Return the column for the next appended value. A new column is added on the first row when the header is not enough.
+   * @param [in] type: Value type of the appended value used for a new column
+   * @return Pointer to the column. nullptr when the row has more values than the columns.
+   */
+  Column* GetCurrentColumn(const ColumnType type);
+  /**
+   * @fn WriteSchema
+   * @brief Write the header of the file
+   */
+  void WriteSchema();
+  /**
+   * @fn AppendBufferToStore
+   * @brief Append the buffered data to the log store as a record
+   */
+  void AppendBufferToStore();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_BINARY_LOG_WRITER_HPP_
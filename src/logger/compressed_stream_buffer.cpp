@@ -0,0 +1,79 @@
+/**
+ * @file compressed_stream_buffer.cpp
+ * @brief Stream buffer to compress the output in chunks
+ */
+
+#include "compressed_stream_buffer.hpp"
+
+#include <iostream>
+
+#ifdef USE_LOG_COMPRESSION
+#include <zlib.h>
+
+static const int kCompressionLevel = 1;      //!< zlib compression level. The speed is prioritized since it runs in the simulation loop.
+static const int kGzipWindowBits = 15 + 16;  //!< Maximum window size with the gzip header
+static const int kMemoryLevel = 8;           //!< zlib default memory level
+#endif
+
+CompressedStreamBuffer::CompressedStreamBuffer(std::streambuf* destination, const size_t chunk_size_byte)
+    : destination_(destination), input_buffer_(chunk_size_byte > 0 ? chunk_size_byte : kDefaultChunkSize_byte) {
+  setp(input_buffer_.data(), input_buffer_.data() + input_buffer_.size());
+}
+
+CompressedStreamBuffer::~CompressedStreamBuffer() { sync(); }
+
+bool CompressedStreamBuffer::IsSupported() {
+#ifdef USE_LOG_COMPRESSION
+  return true;
+#else
+  return false;
+#endif
+}
+
+CompressedStreamBuffer::int_type CompressedStreamBuffer::overflow(int_type character) {
+  if (!CompressChunk()) return traits_type::eof();
+  if (!traits_type::eq_int_type(character, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(character);
+    pbump(1);
+  }
+  return traits_type::not_eof(character);
+}
+
+int CompressedStreamBuffer::sync() {
+  if (!CompressChunk()) return -1;
+  return destination_->pubsync();
+}
+
+bool CompressedStreamBuffer::CompressChunk() {
+  const size_t input_size = (size_t)(pptr() - pbase());
+  if (input_size == 0) return true;
+  setp(input_buffer_.data(), input_buffer_.data() + input_buffer_.size());
+
+#ifdef USE_LOG_COMPRESSION
+  z_stream stream;
+  stream.zalloc = Z_NULL;
+  stream.zfree = Z_NULL;
+  stream.opaque = Z_NULL;
+  if (deflateInit2(&stream, kCompressionLevel, Z_DEFLATED, kGzipWindowBits, kMemoryLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+    std::cerr << "Error initializing log compression" << std::endl;
+    return false;
+  }
+  // The gzip header and trailer are not included in deflateBound of some zlib versions
+  output_buffer_.resize(deflateBound(&stream, (uLong)input_size) + 32);
+  stream.next_in = reinterpret_cast<Bytef*>(input_buffer_.data());
+  stream.avail_in = (uInt)input_size;
+  stream.next_out = reinterpret_cast<Bytef*>(output_buffer_.data());
+  stream.avail_out = (uInt)output_buffer_.size();
+  const int result = deflate(&stream, Z_FINISH);
+  const size_t output_size = output_buffer_.size() - stream.avail_out;
+  deflateEnd(&stream);
+  if (result != Z_STREAM_END) {
+    std::cerr << "Error compressing log" << std::endl;
+    return false;
+  }
+  return destination_->sputn(output_buffer_.data(), (std::streamsize)output_size) == (std::streamsize)output_size;
+#else
+  // Write without compression when the compression library is not linked
+  return destination_->sputn(input_buffer_.data(), (std::streamsize)input_size) == (std::streamsize)input_size;
+#endif
+}
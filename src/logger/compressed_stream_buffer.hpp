@@ -0,0 +1,68 @@
+/**
+ * @file compressed_stream_buffer.hpp
+ * @brief Stream buffer to compress the output in chunks
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_COMPRESSED_STREAM_BUFFER_HPP_
+#define S2E_LIBRARY_LOGGER_COMPRESSED_STREAM_BUFFER_HPP_
+
+#include <streambuf>
+#include <vector>
+
+/**
+ * @class CompressedStreamBuffer
+ * @brief Stream buffer to compress the output in chunks
+ * @note Each chunk is written as an independent gzip member, and the concatenation of the members is a valid gzip file.
+ *       So the output can be read by the standard tools (e.g., gzip, Python gzip module, pandas) block by block without loading the whole
+ *       file, and the file written before an abnormal termination can be read up to the last completed chunk.
+ *       The compression is available when S2E is built with the USE_LOG_COMPRESSION option (zlib).
+ */
+class CompressedStreamBuffer : public std::streambuf {
+ public:
+  /**
+   * @fn CompressedStreamBuffer
+   * @brief Constructor
+   * @param [in] destination: Stream buffer to write the compressed data (e.g., std::ofstream::rdbuf() opened with the binary mode)
+   * @param [in] chunk_size_byte: Size of the uncompressed data compressed at once [byte]
+   */
+  CompressedStreamBuffer(std::streambuf* destination, const size_t chunk_size_byte = kDefaultChunkSize_byte);
+  /**
+   * @fn ~CompressedStreamBuffer
+   * @brief Destructor. Compress and write the remaining data.
+   */
+  ~CompressedStreamBuffer();
+
+  /**
+   * @fn IsSupported
+   * @brief Return true when S2E is built with the compression library
+   */
+  static bool IsSupported();
+
+  static const size_t kDefaultChunkSize_byte = 1024 * 1024;  //!< Default chunk size [byte]
+
+ protected:
+  /**
+   * @fn overflow
+   * @brief Override overflow function of std::streambuf to compress the full chunk
+   */
+  int_type overflow(int_type character) override;
+  /**
+   * @fn sync
+   * @brief Override sync function of std::streambuf to compress the buffered data as a chunk
+   */
+  int sync() override;
+
+ private:
+  std::streambuf* destination_;      //!< Destination of the compressed data
+  std::vector<char> input_buffer_;   //!< Buffer of the uncompressed data
+  std::vector<char> output_buffer_;  //!< Buffer of the compressed data
+
+  /**
+   * @fn CompressChunk
+   * @brief Compress the buffered data and write it to the destination
+   * @return True when succeeded
+   */
+  bool CompressChunk();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_COMPRESSED_STREAM_BUFFER_HPP_
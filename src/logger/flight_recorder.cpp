@@ -0,0 +1,144 @@
+/**
+ * @file flight_recorder.cpp
+ * @brief Class to keep the latest log rows in a fixed size memory window and dump them to a file at the triggers
+ */
+
+#include "flight_recorder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "log_channel_filter.hpp"
+
+FlightRecorder::FlightRecorder(const FlightRecorderConfig& config, const std::string& file_path_prefix)
+    : config_(config), file_path_prefix_(file_path_prefix) {
+  rows_.resize(std::max(config_.window_rows + config_.post_trigger_rows, (size_t)1));
+  threshold_column_ids_.resize(config_.thresholds.size());
+  is_threshold_exceeded_.assign(config_.thresholds.size(), false);
+}
+
+FlightRecorder::~FlightRecorder() {
+  if (is_triggered_) Dump();
+}
+
+void FlightRecorder::AppendHeader(const std::string& header) {
+  header_ += header;
+  is_header_resolved_ = false;
+}
+
+void FlightRecorder::PushRow(const std::string& row) {
+  if (!is_header_resolved_) ResolveThresholdColumns();
+
+  // The string of the oldest row is reused
+  rows_[next_row_id_] = row;
+  next_row_id_ = (next_row_id_ + 1) % rows_.size();
+  if (number_of_stored_rows_ < rows_.size()) number_of_stored_rows_++;
+
+  if (is_triggered_) {
+    if (remaining_post_trigger_rows_ > 0) remaining_post_trigger_rows_--;
+    if (remaining_post_trigger_rows_ == 0) Dump();
+  }
+  if (!config_.thresholds.empty()) CheckThresholds(row);
+}
+
+void FlightRecorder::Trigger(const std::string& reason) {
+  if (is_triggered_) return;
+  if (number_of_dumps_ >= config_.max_dumps) {
+    if (!is_max_dumps_warned_) {
+      std::cout << "[Warning] FlightRecorder: The number of dumps reached " << config_.max_dumps << ". The later triggers are ignored."
+                << std::endl;
+      is_max_dumps_warned_ = true;
+    }
+    return;
+  }
+
+  is_triggered_ = true;
+  remaining_post_trigger_rows_ = config_.post_trigger_rows;
+  trigger_reason_ = reason;
+  if (remaining_post_trigger_rows_ == 0) Dump();
+}
+
+bool FlightRecorder::NotifyEvent(const std::string& event_name) {
+  for (const auto& pattern : config_.trigger_events) {
+    if (LogChannelFilter::MatchGlob(pattern, event_name)) {
+      Trigger("event " + event_name);
+      return true;
+    }
+  }
+  return false;
+}
+
+void FlightRecorder::ResolveThresholdColumns() {
+  for (size_t i = 0; i < config_.thresholds.size(); i++) {
+    threshold_column_ids_[i].clear();
+    size_t begin = 0;
+    for (size_t column_id = 0; begin < header_.size(); column_id++) {
+      size_t end = header_.find(',', begin);
+      if (end == std::string::npos) end = header_.size();
+      if (LogChannelFilter::MatchGlob(config_.thresholds[i].column_pattern, header_.substr(begin, end - begin))) {
+        threshold_column_ids_[i].push_back(column_id);
+      }
+      begin = end + 1;
+    }
+    if (threshold_column_ids_[i].empty()) {
+      std::cout << "[Warning] FlightRecorder: No log column matches " << config_.thresholds[i].column_pattern << "." << std::endl;
+    }
+  }
+  is_header_resolved_ = true;
+}
+
+void FlightRecorder::CheckThresholds(const std::string& row) {
+  field_offsets_.clear();
+  field_offsets_.push_back(0);
+  for (size_t position = row.find(','); position != std::string::npos; position = row.find(',', position + 1)) {
+    field_offsets_.push_back(position + 1);
+  }
+
+  for (size_t i = 0; i < config_.thresholds.size(); i++) {
+    bool is_exceeded = false;
+    double exceeded_value = 0.0;
+    for (const auto column_id : threshold_column_ids_[i]) {
+      if (column_id >= field_offsets_.size()) continue;
+      // The empty fields (e.g., skipped by the log prescaler) are not parsed as values
+      const char* field = row.c_str() + field_offsets_[column_id];
+      char* field_end;
+      const double value = strtod(field, &field_end);
+      if (field_end != field && fabs(value) >= config_.thresholds[i].threshold) {
+        is_exceeded = true;
+        exceeded_value = value;
+        break;
+      }
+    }
+    if (is_exceeded && !is_threshold_exceeded_[i]) {
+      Trigger("threshold " + config_.thresholds[i].column_pattern + " = " + std::to_string(exceeded_value));
+    }
+    is_threshold_exceeded_[i] = is_exceeded;
+  }
+}
+
+void FlightRecorder::Dump() {
+  const std::string dump_file_path = file_path_prefix_ + "flight_record_" + std::to_string(number_of_dumps_) + ".csv";
+  std::ofstream dump_file(dump_file_path);
+  if (!dump_file.is_open()) {
+    std::cerr << "Error opening flight record file: " << dump_file_path << std::endl;
+  } else {
+    dump_file << header_ << "\n";
+    // From the oldest row
+    const size_t oldest_row_id = (next_row_id_ + rows_.size() - number_of_stored_rows_) % rows_.size();
+    for (size_t i = 0; i < number_of_stored_rows_; i++) {
+      dump_file << rows_[(oldest_row_id + i) % rows_.size()] << "\n";
+    }
+  }
+
+  const std::string trigger_list_path = file_path_prefix_ + "flight_record_triggers.csv";
+  std::ofstream trigger_list(trigger_list_path, number_of_dumps_ == 0 ? std::ios::out : std::ios::app);
+  if (number_of_dumps_ == 0) trigger_list << "dump_index,number_of_rows,reason\n";
+  trigger_list << number_of_dumps_ << "," << number_of_stored_rows_ << "," << trigger_reason_ << "\n";
+
+  number_of_dumps_++;
+  is_triggered_ = false;
+  remaining_post_trigger_rows_ = 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file flight_recorder.hpp
+ * @brief Class to keep the latest log rows in a fixed size memory window and dump them to a file at the triggers
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_FLIGHT_RECORDER_HPP_
+#define S2E_LIBRARY_LOGGER_FLIGHT_RECORDER_HPP_
+
+#include <string>
+#include <vector>
+
+/**
+ * @struct FlightRecorderThreshold
+ * @brief Trigger of the flight recorder by the values of the log columns
+ */
+struct FlightRecorderThreshold {
+  std::string column_pattern;  //!< Glob pattern of the column headers (see LogChannelFilter)
+  double threshold = 0.0;      //!< The dump is triggered when the absolute value of a matched column reaches the threshold
+};
+
+/**
+ * @struct FlightRecorderConfig
+ * @brief Settings of the flight recorder
+ */
+struct FlightRecorderConfig {
+  size_t window_rows = 6000;                        //!< Number of the rows kept before the trigger
+  size_t post_trigger_rows = 600;                   //!< Number of the rows recorded after the trigger before the dump
+  size_t max_dumps = 10;                            //!< Maximum number of the dump files. The later triggers are ignored.
+  size_t summary_interval = 100;                    //!< Every summary_interval-th row is written to the log file. Zero for no rows.
+  std::vector<FlightRecorderThreshold> thresholds;  //!< Triggers by the values of the columns
+  std::vector<std::string> trigger_events;          //!< Glob patterns of the event names which trigger the dump
+};
+
+/**
+ * @class FlightRecorder
+ * @brief Class to keep the latest log rows in a fixed size memory window and dump them to a file at the triggers
+ * @details All rows are stored in a ring buffer of window_rows + post_trigger_rows rows. When a trigger occurs, post_trigger_rows more rows
+ *          are recorded, and the whole window is written to <file_path_prefix>flight_record_<dump index>.csv with the header. The dumps and
+ *          their trigger reasons are listed in <file_path_prefix>flight_record_triggers.csv. The row strings are reused, so the memory
+ *          does not grow after the window is filled, and the disk usage is limited by max_dumps.
+ */
+class FlightRecorder {
+ public:
+  /**
+   * @fn FlightRecorder
+   * @brief Constructor
+   * @param [in] config: Settings of the flight recorder
+   * @param [in] file_path_prefix: Prefix of the paths to the dump files including the directory
+   */
+  FlightRecorder(const FlightRecorderConfig& config, const std::string& file_path_prefix);
+  /**
+   * @fn ~FlightRecorder
+   * @brief Destructor. The window is dumped when a trigger is waiting for the post trigger rows.
+   */
+  ~FlightRecorder();
+
+  /**
+   * @fn AppendHeader
+   * @brief Append column names with the CSV header format generated by ILoggable::GetLogHeader
+   * @param [in] header: Comma separated column names
+   */
+  void AppendHeader(const std::string& header);
+  /**
+   * @fn PushRow
+   * @brief Store a row in the window and check the threshold triggers
+   * @param [in] row: Comma separated values of a row without the newline
+   */
+  void PushRow(const std::string& row);
+  /**
+   * @fn Trigger
+   * @brief Trigger the dump of the window (e.g., an anomaly flag of a component)
+   * @note The trigger is ignored while the previous trigger is waiting for the post trigger rows or when max_dumps is reached
+   * @param [in] reason: Reason written in the trigger list
+   */
+  void Trigger(const std::string& reason);
+  /**
+   * @fn NotifyEvent
+   * @brief Trigger the dump when the event name matches one of the trigger event patterns
+   * @param [in] event_name: Name of the detected event
+   * @return True when the event matches a pattern
+   */
+  bool NotifyEvent(const std::string& event_name);
+
+  /**
+   * @fn IsSummaryRow
+   * @brief Return true when the row is written to the log file as a summary row
+   * @param [in] row_index: Index of the row from the start of the log
+   */
+  inline bool IsSummaryRow(const size_t row_index) const { return config_.summary_interval > 0 && row_index % config_.summary_interval == 0; }
+  /**
+   * @fn IsTriggered
+   * @brief Return true while a trigger is waiting for the post trigger rows
+   */
+  inline bool IsTriggered() const { return is_triggered_; }
+  /**
+   * @fn GetNumberOfDumps
+   * @brief Return number of the dump files
+   */
+  inline size_t GetNumberOfDumps() const { return number_of_dumps_; }
+  /**
+   * @fn GetNumberOfStoredRows
+   * @brief Return number of the rows in the window
+   */
+  inline size_t GetNumberOfStoredRows() const { return number_of_stored_rows_; }
+
+ private:
+  FlightRecorderConfig config_;   //!< Settings
+  std::string file_path_prefix_;  //!< Prefix of the paths to the dump files
+  std::string header_;            //!< Header text
+
+  std::vector<std::string> rows_;     //!< Ring buffer of the rows
+  size_t next_row_id_ = 0;            //!< Index of the slot for the next row
+  size_t number_of_stored_rows_ = 0;  //!< Number of the rows in the ring buffer
+
+  bool is_header_resolved_ = false;                        //!< Flag to show the threshold columns are resolved with the header
+  std::vector<std::vector<size_t>> threshold_column_ids_;  //!< Indices of the columns matched with each threshold trigger
+  std::vector<bool> is_threshold_exceeded_;                //!< Threshold state of the previous row to trigger only at the rising edge
+  std::vector<size_t> field_offsets_;                      //!< Offsets of the fields in the current row
+
+  bool is_triggered_ = false;               //!< Flag to show a trigger is waiting for the post trigger rows
+  size_t remaining_post_trigger_rows_ = 0;  //!< Number of the post trigger rows before the dump
+  std::string trigger_reason_;              //!< Reason of the waiting trigger
+  size_t number_of_dumps_ = 0;              //!< Number of the dump files
+  bool is_max_dumps_warned_ = false;        //!< Flag to show the warning of max_dumps once
+
+  /**
+   * @fn ResolveThresholdColumns
+   * @brief Find the columns of the threshold triggers in the header
+   */
+  void ResolveThresholdColumns();
+  /**
+   * @fn CheckThresholds
+   * @brief Trigger the dump when a threshold is reached in the row
+   * @param [in] row: Comma separated values of a row
+   */
+  void CheckThresholds(const std::string& row);
+  /**
+   * @fn Dump
+   * @brief Write the window to a dump file and add the trigger to the trigger list
+   */
+  void Dump();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_FLIGHT_RECORDER_HPP_
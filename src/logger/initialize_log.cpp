@@ -5,6 +5,9 @@
 
 #include "initialize_log.hpp"
 
+#include <algorithm>
+#include <iostream>
+
 #include "../setting_file_reader/initialize_file_access.hpp"
 
 Logger* InitLog(std::string file_name) {
@@ -12,19 +15,145 @@ Logger* InitLog(std::string file_name) {
 
   std::string log_file_path = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
   bool log_ini = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
+  // The log is enabled when the setting is not written for the compatibility with the former initialize files
+  bool is_log_enabled = ini_file.ReadString("SIMULATION_SETTINGS", "log_output") != "DISABLE";
+  if (!is_log_enabled) log_ini = false;
 
-  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true);
+  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, is_log_enabled, true, ReadLogFileFormat(file_name),
+                           ReadLogCompression(file_name));
+  InitLogChannelFilter(log, file_name);
+  InitAsyncLogWriter(log, file_name);
+  InitTelemetryPublisher(log, file_name);
+  InitFlightRecorder(log, file_name);
 
   return log;
 }
 
-Logger* InitMonteCarloLog(std::string file_name, bool enable) {
+LogFileFormat ReadLogFileFormat(std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  const std::string format = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_format");
+  if (format == "BINARY") {
+    return LogFileFormat::kBinary;
+  } else if (format != "" && format != "CSV") {
+    std::cout << "[Warning] log_file_format: " << format << " is not supported. CSV is used." << std::endl;
+  }
+  return LogFileFormat::kCsv;
+}
+
+LogCompression ReadLogCompression(std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  const std::string compression = ini_file.ReadString("SIMULATION_SETTINGS", "log_compression");
+  if (compression == "GZIP") {
+    return LogCompression::kGzip;
+  } else if (compression != "" && compression != "NONE") {
+    std::cout << "[Warning] log_compression: " << compression << " is not supported. The log is not compressed." << std::endl;
+  }
+  return LogCompression::kNone;
+}
+
+void InitLogChannelFilter(Logger* logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "SIMULATION_SETTINGS";
+
+  LogChannelFilter channel_filter;
+  for (const auto& pattern : ini_file.ReadStrVector(section, "log_channel_include")) {
+    channel_filter.AddIncludePattern(pattern);
+  }
+  for (const auto& pattern : ini_file.ReadStrVector(section, "log_channel_exclude")) {
+    channel_filter.AddExcludePattern(pattern);
+  }
+  logger->SetChannelFilter(channel_filter);
+}
+
+void InitAsyncLogWriter(Logger* logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "SIMULATION_SETTINGS";
+
+  if (!ini_file.ReadEnable(section, "async_log_writing")) return;
+
+  int buffer_size = ini_file.ReadInt(section, "async_log_buffer_size");
+  if (buffer_size <= 0) {
+    std::cout << "[Warning] async_log_buffer_size must be larger than 0. 4096 is used." << std::endl;
+    buffer_size = 4096;
+  }
+
+  AsyncLogWriter::FullBufferPolicy policy = AsyncLogWriter::FullBufferPolicy::kBlock;
+  const std::string policy_name = ini_file.ReadString(section, "async_log_full_buffer_policy");
+  if (policy_name == "DROP") {
+    policy = AsyncLogWriter::FullBufferPolicy::kDrop;
+  } else if (policy_name != "BLOCK") {
+    std::cout << "[Warning] async_log_full_buffer_policy: " << policy_name << " is not supported. BLOCK is used." << std::endl;
+  }
+
+  logger->EnableAsyncWriter((size_t)buffer_size, policy);
+}
+
+void InitTelemetryPublisher(Logger* logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "SIMULATION_SETTINGS";
+
+  if (!ini_file.ReadEnable(section, "telemetry_publishing")) return;
+
+  TelemetryPublisherConfig config;
+  const std::string transport = ini_file.ReadString(section, "telemetry_transport");
+  if (transport == "SHARED_MEMORY") {
+    config.transport = TelemetryTransport::kSharedMemory;
+  } else if (transport != "UDP") {
+    std::cout << "[Warning] telemetry_transport: " << transport << " is not supported. UDP is used." << std::endl;
+  }
+  config.remote_address = ini_file.ReadString(section, "telemetry_remote_address");
+  config.remote_port = (unsigned short)ini_file.ReadInt(section, "telemetry_remote_port");
+  config.shared_memory_name = ini_file.ReadString(section, "telemetry_shared_memory_name");
+  config.period_s = ini_file.ReadDouble(section, "telemetry_period_s");
+  config.channels = ini_file.ReadStrVector(section, "telemetry_channel");
+
+  if (!logger->EnableTelemetryPublisher(config)) {
+    std::cout << "[Warning] The telemetry publisher cannot be opened. The telemetry is disabled." << std::endl;
+  }
+}
+
+void InitFlightRecorder(Logger* logger, std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "SIMULATION_SETTINGS";
+
+  if (!ini_file.ReadEnable(section, "flight_recorder")) return;
+
+  FlightRecorderConfig config;
+  const int window_rows = ini_file.ReadInt(section, "flight_recorder_window_rows");
+  if (window_rows <= 0) {
+    std::cout << "[Warning] flight_recorder_window_rows must be larger than 0. " << config.window_rows << " is used." << std::endl;
+  } else {
+    config.window_rows = (size_t)window_rows;
+  }
+  config.post_trigger_rows = (size_t)std::max(ini_file.ReadInt(section, "flight_recorder_post_trigger_rows"), 0);
+  config.max_dumps = (size_t)std::max(ini_file.ReadInt(section, "flight_recorder_max_dumps"), 0);
+  config.summary_interval = (size_t)std::max(ini_file.ReadInt(section, "flight_recorder_summary_interval"), 0);
+
+  const std::vector<std::string> threshold_columns = ini_file.ReadStrVector(section, "flight_recorder_threshold_column");
+  for (size_t i = 0; i < threshold_columns.size(); i++) {
+    FlightRecorderThreshold threshold;
+    threshold.column_pattern = threshold_columns[i];
+    const std::string key = "flight_recorder_threshold(" + std::to_string(i) + ")";
+    threshold.threshold = ini_file.ReadDouble(section, key.c_str());
+    config.thresholds.push_back(threshold);
+  }
+  config.trigger_events = ini_file.ReadStrVector(section, "flight_recorder_trigger_event");
+
+  logger->EnableFlightRecorder(config);
+}
+
+Logger* InitMonteCarloLog(std::string file_name, bool enable, const unsigned int shard_index, const unsigned int number_of_shards) {
   IniAccess ini_file(file_name);
 
   std::string log_file_path = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
   bool log_ini = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
 
-  Logger* log = new Logger("monte_carlo.csv", log_file_path, file_name, log_ini, enable);
+  std::string log_file_name = "monte_carlo.csv";
+  if (number_of_shards > 1) log_file_name = "monte_carlo_shard" + std::to_string(shard_index) + ".csv";
+
+  Logger* log = new Logger(log_file_name, log_file_path, file_name, log_ini, enable);
 
   return log;
 }
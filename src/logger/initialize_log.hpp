@@ -15,12 +15,63 @@
  */
 Logger* InitLog(std::string file_name);
 
+/**
+ * @fn ReadLogFileFormat
+ * @brief Read the format of the log file (log_file_format in SIMULATION_SETTINGS)
+ * @param [in] file_name: Path to the simulation base initialize file
+ * @return Log file format. CSV when the key is not set.
+ */
+LogFileFormat ReadLogFileFormat(std::string file_name);
+
+/**
+ * @fn ReadLogCompression
+ * @brief Read the compression of the log file (log_compression in SIMULATION_SETTINGS)
+ * @param [in] file_name: Path to the simulation base initialize file
+ * @return Log compression. No compression when the key is not set.
+ */
+LogCompression ReadLogCompression(std::string file_name);
+
+/**
+ * @fn InitLogChannelFilter
+ * @brief Set the channel filter of the logger with log_channel_include(i) and log_channel_exclude(i) in SIMULATION_SETTINGS
+ * @param [in/out] logger: Target logger
+ * @param [in] file_name: Path to the simulation base initialize file
+ */
+void InitLogChannelFilter(Logger* logger, std::string file_name);
+
+/**
+ * @fn InitAsyncLogWriter
+ * @brief Enable the asynchronous log writing of the logger when async_log_writing is enabled in SIMULATION_SETTINGS
+ * @param [in/out] logger: Target logger
+ * @param [in] file_name: Path to the simulation base initialize file
+ */
+void InitAsyncLogWriter(Logger* logger, std::string file_name);
+
+/**
+ * @fn InitTelemetryPublisher
+ * @brief Enable the live telemetry of the logger when telemetry_publishing is enabled in SIMULATION_SETTINGS
+ * @param [in/out] logger: Target logger
+ * @param [in] file_name: Path to the simulation base initialize file
+ */
+void InitTelemetryPublisher(Logger* logger, std::string file_name);
+
+/**
+ * @fn InitFlightRecorder
+ * @brief Enable the flight recorder mode of the logger when flight_recorder is enabled in SIMULATION_SETTINGS
+ * @param [in/out] logger: Target logger
+ * @param [in] file_name: Path to the simulation base initialize file
+ */
+void InitFlightRecorder(Logger* logger, std::string file_name);
 /**
  * @fn InitMonteCarloLog
- * @brief Initialize logger for Monte-Carlo simulation (mont.csv)
+ * @brief Initialize logger for Monte-Carlo simulation (monte_carlo.csv)
+ * @note When the cases are divided into shards, the log file is named monte_carlo_shard<shard_index>.csv. The shards have consecutive
+ *       case ranges, so the merged result is obtained by concatenating the files in the order of the shard index without their headers.
  * @param [in] file_name: File name of the log file
  * @param [in] enable: Enable flag for logging
+ * @param [in] shard_index: Index of the shard executed in this process
+ * @param [in] number_of_shards: Number of shards
  */
-Logger* InitMonteCarloLog(std::string file_name, bool enable);
+Logger* InitMonteCarloLog(std::string file_name, bool enable, const unsigned int shard_index = 0, const unsigned int number_of_shards = 1);
 
 #endif  // S2E_LIBRARY_LOGGER_INITIALIZE_LOG_HPP_
@@ -0,0 +1,92 @@
+/**
+ * @file log_channel_filter.cpp
+ * @brief Selection of the log channels (columns) with glob patterns
+ */
+
+#include "log_channel_filter.hpp"
+
+bool LogChannelFilter::IsSelected(const std::string& column_name) const {
+  bool is_included = include_patterns_.empty();
+  for (const auto& pattern : include_patterns_) {
+    if (MatchGlob(pattern, column_name)) {
+      is_included = true;
+      break;
+    }
+  }
+  if (!is_included) return false;
+  for (const auto& pattern : exclude_patterns_) {
+    if (MatchGlob(pattern, column_name)) return false;
+  }
+  return true;
+}
+
+bool LogChannelFilter::IsAnySelected(const std::string& header) const {
+  size_t begin = 0;
+  while (begin < header.size()) {
+    size_t end = header.find(',', begin);
+    if (end == std::string::npos) end = header.size();
+    if (IsSelected(header.substr(begin, end - begin))) return true;
+    begin = end + 1;
+  }
+  return false;
+}
+
+std::string LogChannelFilter::FilterHeader(const std::string& header, std::vector<bool>& column_mask) const {
+  std::string filtered_header;
+  column_mask.clear();
+  bool is_all_selected = true;
+  size_t begin = 0;
+  while (begin < header.size()) {
+    size_t end = header.find(',', begin);
+    if (end == std::string::npos) end = header.size();
+    const bool is_selected = IsSelected(header.substr(begin, end - begin));
+    column_mask.push_back(is_selected);
+    if (is_selected) {
+      filtered_header.append(header, begin, end - begin);
+      filtered_header.push_back(',');
+    } else {
+      is_all_selected = false;
+    }
+    begin = end + 1;
+  }
+  if (is_all_selected) column_mask.clear();
+  return filtered_header;
+}
+
+std::string LogChannelFilter::FilterValues(const std::string& values, const std::vector<bool>& column_mask) {
+  std::string filtered_values;
+  size_t begin = 0;
+  for (size_t i = 0; begin < values.size(); i++) {
+    size_t end = values.find(',', begin);
+    if (end == std::string::npos) end = values.size();
+    // The columns out of the mask (e.g., the loggable changed its columns) are kept
+    if (i >= column_mask.size() || column_mask[i]) {
+      filtered_values.append(values, begin, end - begin);
+      filtered_values.push_back(',');
+    }
+    begin = end + 1;
+  }
+  return filtered_values;
+}
+
+bool LogChannelFilter::MatchGlob(const std::string& pattern, const std::string& text) {
+  // Greedy matching with backtracking to the last '*'
+  size_t p = 0, t = 0;
+  size_t star_p = std::string::npos, star_t = 0;
+  while (t < text.size()) {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t])) {
+      p++;
+      t++;
+    } else if (p < pattern.size() && pattern[p] == '*') {
+      star_p = p++;
+      star_t = t;
+    } else if (star_p != std::string::npos) {
+      p = star_p + 1;
+      t = ++star_t;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*') p++;
+  return p == pattern.size();
+}
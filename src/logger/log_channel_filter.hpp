@@ -0,0 +1,84 @@
+/**
+ * @file log_channel_filter.hpp
+ * @brief Selection of the log channels (columns) with glob patterns
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_CHANNEL_FILTER_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_CHANNEL_FILTER_HPP_
+
+#include <string>
+#include <vector>
+
+/**
+ * @class LogChannelFilter
+ * @brief Selection of the log channels (columns) with glob patterns on the header names
+ * @details A channel is selected when it matches one of the include patterns (or no include pattern is set) and matches none of the
+ *          exclude patterns. The patterns are matched with the whole header of the column including the unit
+ *          (e.g., spacecraft_angular_velocity_b_x[rad/s]). '*' matches any text and '?' matches any character. The other characters
+ *          including '[' are matched literally since they appear in the headers.
+ */
+class LogChannelFilter {
+ public:
+  /**
+   * @fn AddIncludePattern
+   * @brief Add a pattern of the selected channels
+   * @param [in] pattern: Glob pattern
+   */
+  inline void AddIncludePattern(const std::string& pattern) { include_patterns_.push_back(pattern); }
+  /**
+   * @fn AddExcludePattern
+   * @brief Add a pattern of the channels removed from the selection
+   * @param [in] pattern: Glob pattern
+   */
+  inline void AddExcludePattern(const std::string& pattern) { exclude_patterns_.push_back(pattern); }
+
+  /**
+   * @fn IsEnabled
+   * @brief Return true when any pattern is set. All channels are selected otherwise.
+   */
+  inline bool IsEnabled() const { return !include_patterns_.empty() || !exclude_patterns_.empty(); }
+  /**
+   * @fn IsSelected
+   * @brief Return true when the channel is selected
+   * @param [in] column_name: Header of the column without the comma
+   */
+  bool IsSelected(const std::string& column_name) const;
+  /**
+   * @fn IsAnySelected
+   * @brief Return true when any channel in the header text is selected
+   * @note Loggables use this to skip the calculation of the values which are not selected.
+   * @param [in] header: Header text of the columns separated by comma as generated by ILoggable::GetLogHeader
+   */
+  bool IsAnySelected(const std::string& header) const;
+  /**
+   * @fn FilterHeader
+   * @brief Remove the channels which are not selected from the header text
+   * @param [in] header: Header text of the columns separated by comma
+   * @param [out] column_mask: Selection of each column. It is cleared when all columns are selected.
+   * @return Header text of the selected columns
+   */
+  std::string FilterHeader(const std::string& header, std::vector<bool>& column_mask) const;
+
+  /**
+   * @fn FilterValues
+   * @brief Remove the values of the columns which are not selected from the value text
+   * @param [in] values: Value text separated by comma as generated by ILoggable::GetLogValue
+   * @param [in] column_mask: Selection of each column given by FilterHeader
+   * @return Value text of the selected columns
+   */
+  static std::string FilterValues(const std::string& values, const std::vector<bool>& column_mask);
+  /**
+   * @fn MatchGlob
+   * @brief Match the text with the glob pattern
+   * @param [in] pattern: Glob pattern with '*' and '?'
+   * @param [in] text: Target text
+   * @return True when the whole text matches the pattern
+   */
+  static bool MatchGlob(const std::string& pattern, const std::string& text);
+
+ private:
+  std::vector<std::string> include_patterns_;  //!< Patterns of the selected channels. Empty selects all channels.
+  std::vector<std::string> exclude_patterns_;  //!< Patterns of the channels removed from the selection
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_CHANNEL_FILTER_HPP_
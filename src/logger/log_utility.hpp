@@ -6,11 +6,32 @@
 #ifndef S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
 #define S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
 
+#include <charconv>
 #include <iomanip>
 #include <math_physics/math/matrix_vector.hpp>
 #include <math_physics/math/quaternion.hpp>
 #include <sstream>
 #include <string>
+#include <type_traits>
+
+/**
+ * @fn AppendLogDouble
+ * @brief Append a double value and a comma to the text
+ * @note The format is the same as std::ostream with std::setprecision (printf %g), but it is generated by std::to_chars without the stream.
+ * @param [out] text: Text to append the value
+ * @param [in] value: Value
+ * @param [in] precision: precision for the value (number of digit)
+ */
+inline void AppendLogDouble(std::string& text, const double value, const int precision = 6);
+/**
+ * @fn AppendLogScalar
+ * @brief Append a scalar value and a comma to the text with the same format as WriteScalar
+ * @param [out] text: Text to append the value
+ * @param [in] scalar: scalar value
+ * @param [in] precision: precision for the value (number of digit)
+ */
+template <typename T>
+inline void AppendLogScalar(std::string& text, const T scalar, const int precision = 6);
 
 /**
  * @fn WriteScalar
@@ -82,22 +103,61 @@ inline std::string WriteQuaternion(const std::string name, const std::string fra
 //
 // Libraries for log writing
 //
+void AppendLogDouble(std::string& text, const double value, const int precision) {
+  char buffer[64];
+  // %g of printf treats the negative precision as the default precision
+  const std::to_chars_result result =
+      std::to_chars(buffer, buffer + sizeof(buffer) - 1, value, std::chars_format::general, precision < 0 ? 6 : precision);
+  if (result.ec != std::errc()) {
+    // Too many digits for the buffer
+    std::stringstream str_tmp;
+    str_tmp << std::setprecision(precision) << value << ",";
+    text.append(str_tmp.str());
+    return;
+  }
+  char* end = result.ptr;
+  *end++ = ',';
+  text.append(buffer, end);
+}
+
+template <typename T>
+void AppendLogScalar(std::string& text, const T scalar, const int precision) {
+  if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) {
+    AppendLogDouble(text, scalar, precision);
+  } else if constexpr (std::is_same<T, bool>::value) {
+    text.append(scalar ? "1," : "0,");
+  } else if constexpr (std::is_integral<T>::value && !std::is_same<T, char>::value && !std::is_same<T, signed char>::value &&
+                       !std::is_same<T, unsigned char>::value) {
+    // The precision is not used for the integers as std::ostream
+    char buffer[32];
+    const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer) - 1, scalar);
+    char* end = result.ptr;
+    *end++ = ',';
+    text.append(buffer, end);
+  } else {
+    std::stringstream str_tmp;
+    str_tmp << std::setprecision(precision) << scalar << ",";
+    text.append(str_tmp.str());
+  }
+}
+
 template <typename T>
 std::string WriteScalar(const T scalar, const int precision) {
-  std::stringstream str_tmp;
-  str_tmp << std::setprecision(precision) << scalar << ",";
-  return str_tmp.str();
+  std::string text;
+  AppendLogScalar(text, scalar, precision);
+  return text;
 }
 std::string WriteScalar(const std::string name, const std::string unit) { return name + "[" + unit + "],"; }
 
 template <size_t NUM>
 std::string WriteVector(const libra::Vector<NUM, double> vector, const int precision) {
-  std::stringstream str_tmp;
+  std::string text;
+  text.reserve(NUM * 16);
 
   for (size_t n = 0; n < NUM; n++) {
-    str_tmp << std::setprecision(precision) << vector[n] << ",";
+    AppendLogDouble(text, vector[n], precision);
   }
-  return str_tmp.str();
+  return text;
 }
 std::string WriteVector(const std::string name, const std::string frame, const std::string unit, const size_t length) {
   std::stringstream str_tmp;
@@ -116,14 +176,15 @@ std::string WriteVector(const std::string name, const std::string frame, const s
 
 template <size_t ROW, size_t COLUMN>
 std::string WriteMatrix(const libra::Matrix<ROW, COLUMN, double> matrix, const int precision) {
-  std::stringstream str_tmp;
+  std::string text;
+  text.reserve(ROW * COLUMN * 16);
 
   for (size_t n = 0; n < ROW; n++) {
     for (size_t m = 0; m < COLUMN; m++) {
-      str_tmp << std::setprecision(precision) << matrix[n][m] << ",";
+      AppendLogDouble(text, matrix[n][m], precision);
     }
   }
-  return str_tmp.str();
+  return text;
 }
 std::string WriteMatrix(const std::string name, const std::string frame, const std::string unit, const size_t row_length,
                         const size_t column_length) {
@@ -139,12 +200,13 @@ std::string WriteMatrix(const std::string name, const std::string frame, const s
 }
 
 std::string WriteQuaternion(const libra::Quaternion quaternion, const int precision) {
-  std::stringstream str_tmp;
+  std::string text;
+  text.reserve(4 * 16);
 
   for (size_t i = 0; i < 4; i++) {
-    str_tmp << std::setprecision(precision) << quaternion[i] << ",";
+    AppendLogDouble(text, quaternion[i], precision);
   }
-  return str_tmp.str();
+  return text;
 }
 std::string WriteQuaternion(const std::string name, const std::string frame) {
   std::stringstream str_tmp;
@@ -0,0 +1,43 @@
+/**
+ * @file log_value_sink.cpp
+ * @brief Interface to receive typed log values without building strings
+ */
+
+#include "log_value_sink.hpp"
+
+#include "log_utility.hpp"
+
+static const size_t kInitialBufferSize = 1024;  //!< Initial capacity of the CSV text buffer
+
+CsvLogValueSink::CsvLogValueSink() { buffer_.reserve(kInitialBufferSize); }
+
+void CsvLogValueSink::AppendDouble(const double value, const int precision) { AppendLogDouble(buffer_, value, precision); }
+
+void CsvLogValueSink::AppendInteger(const long long value) { AppendLogScalar(buffer_, value); }
+
+void CsvLogValueSink::AppendString(const std::string& value) {
+  buffer_.append(value);
+  buffer_.push_back(',');
+}
+
+void CsvLogValueSink::AppendMissingValues(const size_t number_of_values) { buffer_.append(number_of_values, ','); }
+
+void MaskedLogValueSink::AppendDouble(const double value, const int precision) {
+  if (IsNextColumnSelected()) target_->AppendDouble(value, precision);
+}
+
+void MaskedLogValueSink::AppendInteger(const long long value) {
+  if (IsNextColumnSelected()) target_->AppendInteger(value);
+}
+
+void MaskedLogValueSink::AppendString(const std::string& value) {
+  if (IsNextColumnSelected()) target_->AppendString(value);
+}
+
+void MaskedLogValueSink::AppendMissingValues(const size_t number_of_values) {
+  size_t number_of_selected_values = 0;
+  for (size_t i = 0; i < number_of_values; i++) {
+    if (IsNextColumnSelected()) number_of_selected_values++;
+  }
+  if (number_of_selected_values > 0) target_->AppendMissingValues(number_of_selected_values);
+}
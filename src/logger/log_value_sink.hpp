@@ -0,0 +1,206 @@
+/**
+ * @file log_value_sink.hpp
+ * @brief Interface to receive typed log values without building strings
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_VALUE_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_VALUE_SINK_HPP_
+
+#include <math_physics/math/matrix.hpp>
+#include <math_physics/math/quaternion.hpp>
+#include <math_physics/math/vector.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class ILogValueSink
+ * @brief Interface to receive typed log values
+ * @note The values must be appended in the same order as the headers given by ILoggable::GetLogHeader.
+ *       The precision is used only by text outputs and has the same meaning as the precision of WriteScalar in log_utility.hpp.
+ */
+class ILogValueSink {
+ public:
+  /**
+   * @fn ~ILogValueSink
+   * @brief Destructor
+   */
+  virtual ~ILogValueSink() {}
+
+  /**
+   * @fn AppendDouble
+   * @brief Append a double value
+   * @param [in] value: Value
+   * @param [in] precision: Precision for the value (number of digit)
+   */
+  virtual void AppendDouble(const double value, const int precision = 6) = 0;
+  /**
+   * @fn AppendInteger
+   * @brief Append an integer value
+   * @param [in] value: Value
+   */
+  virtual void AppendInteger(const long long value) = 0;
+  /**
+   * @fn AppendString
+   * @brief Append a text value (e.g., date time)
+   * @param [in] value: Value. It must not include comma.
+   */
+  virtual void AppendString(const std::string& value) = 0;
+  /**
+   * @fn AppendMissingValues
+   * @brief Append empty values for the columns which are not written in this row
+   * @param [in] number_of_values: Number of the columns
+   */
+  virtual void AppendMissingValues(const size_t number_of_values) = 0;
+
+  /**
+   * @fn AppendVector
+   * @brief Append all elements of a vector
+   * @param [in] vector: Vector value
+   * @param [in] precision: Precision for the value (number of digit)
+   */
+  template <size_t NUM>
+  inline void AppendVector(const libra::Vector<NUM, double>& vector, const int precision = 6) {
+    for (size_t n = 0; n < NUM; n++) {
+      AppendDouble(vector[n], precision);
+    }
+  }
+  /**
+   * @fn AppendMatrix
+   * @brief Append all elements of a matrix in row major order
+   * @param [in] matrix: Matrix value
+   * @param [in] precision: Precision for the value (number of digit)
+   */
+  template <size_t ROW, size_t COLUMN>
+  inline void AppendMatrix(const libra::Matrix<ROW, COLUMN, double>& matrix, const int precision = 6) {
+    for (size_t n = 0; n < ROW; n++) {
+      for (size_t m = 0; m < COLUMN; m++) {
+        AppendDouble(matrix[n][m], precision);
+      }
+    }
+  }
+  /**
+   * @fn AppendQuaternion
+   * @brief Append all elements of a quaternion in the order of x, y, z, w
+   * @param [in] quaternion: Quaternion
+   * @param [in] precision: Precision for the value (number of digit)
+   */
+  inline void AppendQuaternion(const libra::Quaternion& quaternion, const int precision = 6) {
+    for (size_t i = 0; i < 4; i++) {
+      AppendDouble(quaternion[i], precision);
+    }
+  }
+};
+
+/**
+ * @class CsvLogValueSink
+ * @brief Log value sink to generate CSV text with the same format as log_utility.hpp
+ * @note The internal buffer is reused, so no memory allocation occurs after the buffer has grown enough.
+ *       The numbers are formatted by std::to_chars (see AppendLogDouble in log_utility.hpp).
+ */
+class CsvLogValueSink : public ILogValueSink {
+ public:
+  /**
+   * @fn CsvLogValueSink
+   * @brief Constructor
+   */
+  CsvLogValueSink();
+
+  /**
+   * @fn AppendDouble
+   * @brief Override AppendDouble function of ILogValueSink
+   */
+  void AppendDouble(const double value, const int precision = 6) override;
+  /**
+   * @fn AppendInteger
+   * @brief Override AppendInteger function of ILogValueSink
+   */
+  void AppendInteger(const long long value) override;
+  /**
+   * @fn AppendString
+   * @brief Override AppendString function of ILogValueSink
+   */
+  void AppendString(const std::string& value) override;
+  /**
+   * @fn AppendMissingValues
+   * @brief Override AppendMissingValues function of ILogValueSink
+   */
+  void AppendMissingValues(const size_t number_of_values) override;
+
+  /**
+   * @fn AppendText
+   * @brief Append the CSV text generated by ILoggable::GetLogValue as is
+   * @param [in] text: CSV text which ends with comma
+   */
+  inline void AppendText(const std::string& text) { buffer_.append(text); }
+
+  /**
+   * @fn Clear
+   * @brief Clear the text while keeping the allocated memory
+   */
+  inline void Clear() { buffer_.clear(); }
+  /**
+   * @fn GetText
+   * @brief Return the generated CSV text
+   */
+  inline const std::string& GetText() const { return buffer_; }
+
+ private:
+  std::string buffer_;  //!< Generated CSV text
+};
+
+/**
+ * @class MaskedLogValueSink
+ * @brief Log value sink to forward only the values of the selected columns to another sink
+ * @note The values of the columns which are not selected are dropped before they are formatted.
+ */
+class MaskedLogValueSink : public ILogValueSink {
+ public:
+  /**
+   * @fn Reset
+   * @brief Set the destination and the column selection, and restart from the first column
+   * @param [in] target: Sink to receive the selected values
+   * @param [in] column_mask: Selection of each column. The columns out of the mask are forwarded.
+   */
+  inline void Reset(ILogValueSink* target, const std::vector<bool>* column_mask) {
+    target_ = target;
+    column_mask_ = column_mask;
+    column_index_ = 0;
+  }
+
+  /**
+   * @fn AppendDouble
+   * @brief Override AppendDouble function of ILogValueSink
+   */
+  void AppendDouble(const double value, const int precision = 6) override;
+  /**
+   * @fn AppendInteger
+   * @brief Override AppendInteger function of ILogValueSink
+   */
+  void AppendInteger(const long long value) override;
+  /**
+   * @fn AppendString
+   * @brief Override AppendString function of ILogValueSink
+   */
+  void AppendString(const std::string& value) override;
+  /**
+   * @fn AppendMissingValues
+   * @brief Override AppendMissingValues function of ILogValueSink
+   */
+  void AppendMissingValues(const size_t number_of_values) override;
+
+ private:
+  ILogValueSink* target_ = nullptr;                 //!< Sink to receive the selected values
+  const std::vector<bool>* column_mask_ = nullptr;  //!< Selection of each column
+  size_t column_index_ = 0;                         //!< Index of the next column
+
+  /**
+   * @fn IsNextColumnSelected
+   * @brief Return true when the next column is selected and move to the following column
+   */
+  inline bool IsNextColumnSelected() {
+    const size_t index = column_index_++;
+    return index >= column_mask_->size() || (*column_mask_)[index];
+  }
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_VALUE_SINK_HPP_
@@ -8,7 +8,9 @@
 
 #include <string>
 
+#include "log_channel_filter.hpp"
 #include "log_utility.hpp"  // This is not necessary but include here for convenience
+#include "log_value_sink.hpp"
 
 /**
  * @class ILoggable
@@ -31,7 +33,33 @@ class ILoggable {
    */
   virtual std::string GetLogValue() const = 0;
 
+  /**
+   * @fn AppendLogValue
+   * @brief Append typed values to the sink instead of generating the text by GetLogValue
+   * @note Optional. Logger uses this function when it is implemented, and it must output the same values as GetLogValue.
+   * @param [out] sink: Sink to receive the values
+   * @return True when this function is implemented. False to use GetLogValue.
+   */
+  virtual bool AppendLogValue(ILogValueSink& sink) const {
+    (void)sink;
+    return false;
+  }
+
+  /**
+   * @fn IsLogChannelSelected
+   * @brief Return true when any column of the header is selected by the channel filter of the logger
+   * @note Optional. The logger removes the columns which are not selected in any case, but the loggable can skip the calculation and the
+   *       formatting of the values with this function. The same columns must be skipped in GetLogHeader and GetLogValue.
+   * @param [in] header: Header text of the columns (e.g., the result of WriteVector for the header)
+   */
+  inline bool IsLogChannelSelected(const std::string& header) const {
+    return log_channel_filter_ == nullptr || log_channel_filter_->IsAnySelected(header);
+  }
+
   bool is_log_enabled_ = true;  //!< Log enable flag
+  int log_prescaler_ = 1;        //!< The values are written once per this number of log output timings. 1 or less writes every time.
+  //! Channel filter of the logger set by Logger. nullptr selects all channels.
+  const LogChannelFilter* log_channel_filter_ = nullptr;
 };
 
 #endif  // S2E_LIBRARY_LOGGER_LOGGABLE_HPP_
@@ -5,7 +5,10 @@
 
 #include "logger.hpp"
 
+#include <algorithm>
+#include <cerrno>
 #include <ctime>
+#include <iostream>
 #include <sstream>
 #ifdef _WIN32
 #include <direct.h>
@@ -13,90 +16,313 @@
 #include <sys/stat.h>
 #endif
 
-std::vector<ILoggable *> log_list_;
-bool Logger::is_directory_created_ = false;
+#include "utilities/step_profiler.hpp"
+
+static const size_t kUnknownNumberOfColumns = static_cast<size_t>(-1);  //!< Number of columns of a loggable added after WriteHeaders
 
 Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-               const bool is_enabled)
-    : is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled) {
+               const bool is_enabled, const bool is_directory_creation_enabled, const LogFileFormat log_file_format,
+               const LogCompression log_compression)
+    : is_enabled_(is_enabled),
+      log_output_counter_(0),
+      csv_stream_(nullptr),
+      log_file_format_(log_file_format),
+      is_ini_save_enabled_(is_ini_save_enabled) {
   is_file_opened_ = false;
   if (is_enabled_ == false) return;
 
   // Get current time to append it to the filename
   time_t timer = time(NULL);
   struct tm *now;
-  now = localtime(&timer);
+  struct tm now_buffer;
+#ifdef WIN32
+  localtime_s(&now_buffer, &timer);
+  now = &now_buffer;
+#else
+  now = localtime_r(&timer, &now_buffer);
+#endif
   char start_time_c[64];
   strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
 
   // Create directory
-  if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
+  if (is_ini_save_enabled_ == true || is_directory_creation_enabled == true) {
     directory_path_ = CreateDirectory(data_path, start_time_c);
   } else {
     directory_path_ = data_path;
   }
+  // Compression
+  bool is_compression_enabled = log_compression != LogCompression::kNone;
+  if (is_compression_enabled && !CompressedStreamBuffer::IsSupported()) {
+    std::cout << "[Warning] Logger: The log compression is not available. Build S2E with USE_LOG_COMPRESSION option." << std::endl;
+    is_compression_enabled = false;
+  }
+
+  // No file is used for the in-memory capture
+  if (log_file_format_ == LogFileFormat::kMemory) return;
+
   // Create File
   std::stringstream file_path;
   file_path << directory_path_ << start_time_c << "_" << file_name;
-  if (is_enabled_) {
+  file_path_ = file_path.str();
+  if (log_file_format_ == LogFileFormat::kBinary) {
+    std::string binary_file_path = file_path.str();
+    const std::string csv_extension = ".csv";
+    if (binary_file_path.size() >= csv_extension.size() &&
+        binary_file_path.compare(binary_file_path.size() - csv_extension.size(), csv_extension.size(), csv_extension) == 0) {
+      binary_file_path.erase(binary_file_path.size() - csv_extension.size());
+    }
+    is_file_opened_ = binary_log_writer_.Open(binary_file_path + ".s2elog", is_compression_enabled);
+  } else if (is_compression_enabled) {
+    csv_file_.open(file_path.str() + ".gz", std::ios::out | std::ios::binary);
+    is_file_opened_ = csv_file_.is_open();
+    if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path.str() << ".gz" << std::endl;
+    compressed_stream_buffer_.reset(new CompressedStreamBuffer(csv_file_.rdbuf()));
+    csv_stream_.rdbuf(compressed_stream_buffer_.get());
+  } else {
     csv_file_.open(file_path.str());
     is_file_opened_ = csv_file_.is_open();
     if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path.str() << std::endl;
+    csv_stream_.rdbuf(csv_file_.rdbuf());
   }
 
   // Copy SimBase.ini
   CopyFileToLogDirectory(ini_file_name);
 }
 
+Logger::Logger(MonteCarloLogStore *log_store, const unsigned long long case_index, const std::string &directory_path)
+    : is_enabled_(true),
+      log_output_counter_(0),
+      csv_stream_(nullptr),
+      log_file_format_(LogFileFormat::kBinary),
+      is_ini_save_enabled_(false),
+      directory_path_(directory_path) {
+  is_file_opened_ = binary_log_writer_.OpenStore(log_store, case_index);
+  if (!is_file_opened_) std::cerr << "Error opening Monte-Carlo log store for case " << case_index << std::endl;
+}
+
 Logger::~Logger(void) {
+  if (async_log_writer_ != nullptr) {
+    if (!row_buffer_.empty()) async_log_writer_->Push(row_buffer_);
+    async_log_writer_->Stop();
+    if (async_log_writer_->GetNumberOfDroppedRows() > 0) {
+      std::cout << "[Warning] Logger: " << async_log_writer_->GetNumberOfDroppedRows() << " rows are dropped since the log buffer was full."
+                << std::endl;
+    }
+    if (async_log_writer_->GetNumberOfBlockedPushes() > 0) {
+      std::cout << "[Warning] Logger: The simulation waited for the log writer " << async_log_writer_->GetNumberOfBlockedPushes()
+                << " times. Increase the log buffer size to avoid it." << std::endl;
+    }
+    async_log_writer_.reset();
+  }
   if (is_file_opened_) {
+    csv_stream_.flush();
+    compressed_stream_buffer_.reset();
     csv_file_.close();
+    binary_log_writer_.Close();
   }
 }
 
 void Logger::WriteHeaders(const bool add_newline) {
-  for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
-    if (!((*itr)->is_log_enabled_)) continue;
-    Write((*itr)->GetLogHeader());
+  // The numbers of columns are used to fill the values of the loggables skipped by the log prescaler
+  number_of_log_columns_.assign(log_list_.size(), 0);
+  log_column_masks_.assign(log_list_.size(), std::vector<bool>());
+  for (size_t i = 0; i < log_list_.size(); i++) {
+    if (!(log_list_[i]->is_log_enabled_)) continue;
+    std::string header = log_list_[i]->GetLogHeader();
+    if (channel_filter_.IsEnabled()) header = channel_filter_.FilterHeader(header, log_column_masks_[i]);
+    number_of_log_columns_[i] = (size_t)std::count(header.begin(), header.end(), ',');
+
+    if (log_file_format_ == LogFileFormat::kBinary) {
+      if (is_enabled_) binary_log_writer_.AppendHeaders(header);
+    } else if (log_file_format_ == LogFileFormat::kMemory) {
+      if (is_enabled_) memory_log_capture_.AppendHeaders(header);
+    } else {
+      Write(header);
+      if (flight_recorder_ != nullptr) flight_recorder_->AppendHeader(header);
+    }
   }
-  if (add_newline) WriteNewLine();
+  if (add_newline && log_file_format_ == LogFileFormat::kCsv) WriteNewLine();
 }
 
 void Logger::WriteValues(const bool add_newline) {
-  for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
-    if (!((*itr)->is_log_enabled_)) continue;
-    Write((*itr)->GetLogValue());
+  static const size_t profile_section_id = StepProfiler::RegisterSection("Logger::WriteValues");
+  ScopedProfileTimer timer(profile_section_id);
+  // The values are not generated for the disabled log
+  if (!is_enabled_) return;
+  if (number_of_log_columns_.size() != log_list_.size()) number_of_log_columns_.resize(log_list_.size(), kUnknownNumberOfColumns);
+  if (log_column_masks_.size() != log_list_.size()) log_column_masks_.resize(log_list_.size());
+
+  if (log_file_format_ == LogFileFormat::kBinary) {
+    for (size_t i = 0; i < log_list_.size(); i++) {
+      const ILoggable *loggable = log_list_[i];
+      if (!(loggable->is_log_enabled_)) continue;
+      if (!IsLogOutputTiming(*loggable)) {
+        binary_log_writer_.AppendMissingValues(GetNumberOfLogColumns(i));
+      } else if (!AppendLoggableValues(i, binary_log_writer_)) {
+        binary_log_writer_.AppendValues(value_text_);
+      }
+    }
+    if (add_newline) binary_log_writer_.EndRow();
+    log_output_counter_++;
+    return;
   }
+
+  if (log_file_format_ == LogFileFormat::kMemory) {
+    for (size_t i = 0; i < log_list_.size(); i++) {
+      const ILoggable *loggable = log_list_[i];
+      if (!(loggable->is_log_enabled_)) continue;
+      if (!IsLogOutputTiming(*loggable)) {
+        memory_log_capture_.AppendMissingValues(GetNumberOfLogColumns(i));
+      } else if (!AppendLoggableValues(i, memory_log_capture_)) {
+        memory_log_capture_.AppendValues(value_text_);
+      }
+    }
+    if (add_newline) memory_log_capture_.EndRow();
+    log_output_counter_++;
+    return;
+  }
+
+  // The whole row is generated in the reused buffer and written at once
+  csv_log_value_sink_.Clear();
+  for (size_t i = 0; i < log_list_.size(); i++) {
+    const ILoggable *loggable = log_list_[i];
+    if (!(loggable->is_log_enabled_)) continue;
+    if (!IsLogOutputTiming(*loggable)) {
+      csv_log_value_sink_.AppendMissingValues(GetNumberOfLogColumns(i));
+    } else if (!AppendLoggableValues(i, csv_log_value_sink_)) {
+      csv_log_value_sink_.AppendText(value_text_);
+    }
+  }
+  if (flight_recorder_ != nullptr) {
+    // All rows are kept in the window, and only the summary rows are written to the log file
+    flight_recorder_->PushRow(csv_log_value_sink_.GetText());
+    if (!flight_recorder_->IsSummaryRow(log_output_counter_)) {
+      log_output_counter_++;
+      return;
+    }
+  }
+  Write(csv_log_value_sink_.GetText());
   if (add_newline) WriteNewLine();
+  log_output_counter_++;
 }
 
-void Logger::WriteNewLine() { Write("\n"); }
+void Logger::WriteNewLine() {
+  Write("\n");
+  if (async_log_writer_ != nullptr && is_enabled_) async_log_writer_->Push(row_buffer_);
+}
 
-void Logger::Write(const std::string log, const bool flag) {
+void Logger::Write(const std::string& log, const bool flag) {
   if (flag && is_enabled_) {
-    csv_file_ << log;
+    if (async_log_writer_ != nullptr) {
+      row_buffer_.append(log);
+    } else {
+      csv_stream_ << log;
+    }
+  }
+}
+
+void Logger::EnableAsyncWriter(const size_t number_of_slots, const AsyncLogWriter::FullBufferPolicy full_buffer_policy) {
+  if (!is_file_opened_ || async_log_writer_ != nullptr) return;
+  if (log_file_format_ != LogFileFormat::kCsv) {
+    std::cout << "[Warning] Logger: The asynchronous writing is supported only for the CSV format." << std::endl;
+    return;
+  }
+  async_log_writer_.reset(new AsyncLogWriter(csv_stream_, number_of_slots, full_buffer_policy));
+}
+
+bool Logger::EnableTelemetryPublisher(const TelemetryPublisherConfig &config) {
+  telemetry_publisher_.reset(new TelemetryPublisher(config));
+  if (!telemetry_publisher_->Open()) {
+    telemetry_publisher_.reset();
+    return false;
+  }
+  return true;
+}
+
+void Logger::EnableFlightRecorder(const FlightRecorderConfig &config) {
+  if (!is_enabled_ || flight_recorder_ != nullptr) return;
+  if (log_file_format_ != LogFileFormat::kCsv) {
+    std::cout << "[Warning] Logger: The flight recorder is supported only for the CSV format." << std::endl;
+    return;
+  }
+  // The dump files are named after the log file (e.g., <time>_default_flight_record_0.csv)
+  std::string file_path_prefix = file_path_;
+  const std::string csv_extension = ".csv";
+  if (file_path_prefix.size() >= csv_extension.size() &&
+      file_path_prefix.compare(file_path_prefix.size() - csv_extension.size(), csv_extension.size(), csv_extension) == 0) {
+    file_path_prefix.erase(file_path_prefix.size() - csv_extension.size());
   }
+  flight_recorder_.reset(new FlightRecorder(config, file_path_prefix + "_"));
 }
 
-void Logger::AddLogList(ILoggable *loggable) { log_list_.push_back(loggable); }
+void Logger::AddLogList(ILoggable *loggable) {
+  if (channel_filter_.IsEnabled()) loggable->log_channel_filter_ = &channel_filter_;
+  log_list_.push_back(loggable);
+}
 
-void Logger::ClearLogList() { log_list_.clear(); }
+void Logger::ClearLogList() {
+  log_list_.clear();
+  number_of_log_columns_.clear();
+  log_column_masks_.clear();
+}
+
+void Logger::SetChannelFilter(const LogChannelFilter &channel_filter) {
+  channel_filter_ = channel_filter;
+  const LogChannelFilter *loggable_filter = channel_filter_.IsEnabled() ? &channel_filter_ : nullptr;
+  for (auto loggable : log_list_) {
+    loggable->log_channel_filter_ = loggable_filter;
+  }
+}
+
+bool Logger::AppendLoggableValues(const size_t index, ILogValueSink &sink) {
+  const ILoggable *loggable = log_list_[index];
+  const std::vector<bool> &column_mask = log_column_masks_[index];
+  if (column_mask.empty()) {
+    if (loggable->AppendLogValue(sink)) return true;
+    value_text_ = loggable->GetLogValue();
+    return false;
+  }
+
+  // The loggable generates the columns which are not selected, so they are removed here
+  masked_log_value_sink_.Reset(&sink, &column_mask);
+  if (loggable->AppendLogValue(masked_log_value_sink_)) return true;
+  value_text_ = LogChannelFilter::FilterValues(loggable->GetLogValue(), column_mask);
+  return false;
+}
+
+bool Logger::IsLogOutputTiming(const ILoggable &loggable) const {
+  if (loggable.log_prescaler_ <= 1) return true;
+  return log_output_counter_ % (size_t)loggable.log_prescaler_ == 0;
+}
+
+size_t Logger::GetNumberOfLogColumns(const size_t index) {
+  if (number_of_log_columns_[index] == kUnknownNumberOfColumns) {
+    std::string header = log_list_[index]->GetLogHeader();
+    if (channel_filter_.IsEnabled()) header = channel_filter_.FilterHeader(header, log_column_masks_[index]);
+    number_of_log_columns_[index] = (size_t)std::count(header.begin(), header.end(), ',');
+  }
+  return number_of_log_columns_[index];
+}
 
 std::string Logger::CreateDirectory(const std::string &data_path, const std::string &time) {
   std::string directory_path_tmp_ = data_path + "/logs_" + time + "/";
   // Make directory
   int rtn_mkdir = 0;
+  for (unsigned int suffix = 1;; suffix++) {
 #ifdef WIN32
-  rtn_mkdir = _mkdir(directory_path_tmp_.c_str());
+    rtn_mkdir = _mkdir(directory_path_tmp_.c_str());
 #else
-  rtn_mkdir = mkdir(directory_path_tmp_.c_str(), 0777);
+    rtn_mkdir = mkdir(directory_path_tmp_.c_str(), 0777);
 #endif
+    if (rtn_mkdir == 0 || errno != EEXIST) break;
+    // The directory is already created in the same second
+    directory_path_tmp_ = data_path + "/logs_" + time + "_" + std::to_string(suffix) + "/";
+  }
   if (rtn_mkdir == 0) {
   } else {
     std::cerr << "Error making directory: " << directory_path_tmp_ << std::endl;
     return data_path;
   }
-  is_directory_created_ = true;
   return directory_path_tmp_;
 }
 
@@ -108,6 +334,8 @@ void Logger::CopyFileToLogDirectory(const std::string &ini_file_name) {
   std::string file_name = GetFileName(ini_file_name);
   std::string to_file_name = directory_path_ + file_name;
   std::ifstream is(ini_file_name, ios::in | ios::binary);
+  // In-memory ini files (e.g., constellation members) do not exist on the file system
+  if (!is.is_open()) return;
   std::ofstream os(to_file_name, ios::out | ios::binary);
   os << is.rdbuf();
 
@@ -9,10 +9,36 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include <fstream>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "async_log_writer.hpp"
+#include "binary_log_writer.hpp"
+#include "compressed_stream_buffer.hpp"
+#include "flight_recorder.hpp"
 #include "loggable.hpp"
+#include "memory_log_capture.hpp"
+#include "telemetry_publisher.hpp"
+
+/**
+ * @enum LogFileFormat
+ * @brief Format of the log output file
+ */
+enum class LogFileFormat {
+  kCsv,     //!< CSV text
+  kBinary,  //!< Binary columnar format (see binary_log_writer.hpp)
+  kMemory,  //!< Keep selected channels in memory without writing a file (see memory_log_capture.hpp)
+};
+
+/**
+ * @enum LogCompression
+ * @brief Compression of the log output file
+ */
+enum class LogCompression {
+  kNone,  //!< No compression
+  kGzip,  //!< gzip compression in chunks (see compressed_stream_buffer.hpp)
+};
 
 /**
  * @class Logger
@@ -28,9 +54,22 @@ class Logger {
    * @param [in] ini_file_name: Initialize file name
    * @param [in] is_ini_save_enabled: Enable flag to save ini files
    * @param [in] is_enabled: Enable flag for logging
+   * @param [in] is_directory_creation_enabled: Enable flag to create a new log directory in data_path. The directory is created when
+   *                                            is_ini_save_enabled is true regardless of this flag.
+   * @param [in] log_file_format: Format of the log file. The extension of file_name is replaced with .s2elog for the binary format.
+   * @param [in] log_compression: Compression of the log file. The extension .gz is appended for the gzip compression.
    */
   Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-         const bool is_enabled = true);
+         const bool is_enabled = true, const bool is_directory_creation_enabled = true, const LogFileFormat log_file_format = LogFileFormat::kCsv,
+         const LogCompression log_compression = LogCompression::kNone);
+  /**
+   * @fn Logger
+   * @brief Constructor to write the log of a Monte-Carlo case to the log store in the binary format instead of a file
+   * @param [in] log_store: Monte-Carlo log store. It should be alive until this logger is deleted.
+   * @param [in] case_index: Index of the case
+   * @param [in] directory_path: Path to the directory for the other log files of the case (e.g., event log)
+   */
+  Logger(MonteCarloLogStore *log_store, const unsigned long long case_index, const std::string &directory_path);
   /**
    * @fn ~Logger
    * @brief Destructor
@@ -48,6 +87,14 @@ class Logger {
    * @brief Clear the log list
    */
   void ClearLogList();
+  /**
+   * @fn SetChannelFilter
+   * @brief Set the selection of the log channels (columns) written by this logger
+   * @note Call this before writing the headers. The filter is also given to the loggables in the log list so that they can skip the
+   *       calculation of the channels which are not selected. A loggable uses the filter of the last logger which it is added to.
+   * @param [in] channel_filter: Channel filter
+   */
+  void SetChannelFilter(const LogChannelFilter &channel_filter);
 
   /**
    * @fn WriteHeaders
@@ -58,6 +105,8 @@ class Logger {
   /**
    * @fn WriteValues
    * @brief Write all values in the log list
+   * @note The values of the loggables whose log_prescaler_ is larger than 1 are written once per log_prescaler_ calls, and the columns
+   *       are left empty (NaN for the binary format) in the other rows.
    * @param add_newline: Add newline or not
    */
   void WriteValues(const bool add_newline = true);
@@ -67,6 +116,53 @@ class Logger {
    * @brief Set enable flag of the log
    */
   inline void Enable(const bool enable) { is_enabled_ = enable; }
+  /**
+   * @fn EnableAsyncWriter
+   * @brief Write the CSV log file in a background thread to avoid stalling the simulation by the disk access
+   * @note Call this before writing the headers. The binary format does not support it since it is already written in chunks.
+   * @param [in] number_of_slots: Number of rows stored in the ring buffer between the simulation and the writer thread
+   * @param [in] full_buffer_policy: Behavior when the ring buffer is full
+   */
+  void EnableAsyncWriter(const size_t number_of_slots, const AsyncLogWriter::FullBufferPolicy full_buffer_policy);
+  /**
+   * @fn EnableTelemetryPublisher
+   * @brief Stream the values in the log list to external viewers independently of the log file
+   * @param [in] config: Settings of the telemetry publisher
+   * @return True when the transport is opened
+   */
+  bool EnableTelemetryPublisher(const TelemetryPublisherConfig &config);
+  /**
+   * @fn PublishTelemetry
+   * @brief Publish the values in the log list when the telemetry period has passed. Call this at every simulation step.
+   * @param [in] elapsed_time_s: Elapsed simulation time [s]
+   */
+  inline void PublishTelemetry(const double elapsed_time_s) {
+    if (telemetry_publisher_ != nullptr) telemetry_publisher_->Publish(log_list_, elapsed_time_s);
+  }
+  /**
+   * @fn EnableFlightRecorder
+   * @brief Keep all rows in a memory window dumped at the triggers, and write only the summary rows to the log file (e.g., long soak tests)
+   * @note Call this before writing the headers. Only the CSV format is supported. Each WriteValues call is treated as a row.
+   *       The dump files are written in the log directory with the name of the log file as the prefix.
+   * @param [in] config: Settings of the flight recorder
+   */
+  void EnableFlightRecorder(const FlightRecorderConfig &config);
+  /**
+   * @fn TriggerFlightRecorder
+   * @brief Trigger the dump of the flight recorder (e.g., an anomaly flag of a component). Nothing is done when it is disabled.
+   * @param [in] reason: Reason written in the trigger list
+   */
+  inline void TriggerFlightRecorder(const std::string &reason) {
+    if (flight_recorder_ != nullptr) flight_recorder_->Trigger(reason);
+  }
+  /**
+   * @fn NotifyEvent
+   * @brief Notify a detected event to trigger the flight recorder when the event name matches its trigger events
+   * @param [in] event_name: Name of the detected event
+   */
+  inline void NotifyEvent(const std::string &event_name) {
+    if (flight_recorder_ != nullptr) flight_recorder_->NotifyEvent(event_name);
+  }
   /**
    * @fn CopyFileToLogDirectory
    * @brief Copy a file (e.g., ini file) into the log directory
@@ -85,16 +181,69 @@ class Logger {
    * @brief Return the path to the directory for log files
    */
   inline std::string GetLogPath() const { return directory_path_; }
+  /**
+   * @fn GetLogFileFormat
+   * @brief Return the format of the log file
+   */
+  inline LogFileFormat GetLogFileFormat() const { return log_file_format_; }
+  /**
+   * @fn GetChannelFilter
+   * @brief Return the selection of the log channels
+   */
+  inline const LogChannelFilter &GetChannelFilter() const { return channel_filter_; }
+  /**
+   * @fn GetAsyncLogWriter
+   * @brief Return the asynchronous writer to access its counters. nullptr when the asynchronous writing is disabled.
+   */
+  inline const AsyncLogWriter *GetAsyncLogWriter() const { return async_log_writer_.get(); }
+  /**
+   * @fn GetTelemetryPublisher
+   * @brief Return the telemetry publisher. nullptr when the telemetry is disabled.
+   */
+  inline const TelemetryPublisher *GetTelemetryPublisher() const { return telemetry_publisher_.get(); }
+  /**
+   * @fn GetFlightRecorder
+   * @brief Return the flight recorder. nullptr when the flight recorder mode is disabled.
+   */
+  inline const FlightRecorder *GetFlightRecorder() const { return flight_recorder_.get(); }
+  /**
+   * @fn GetMemoryLogCapture
+   * @brief Return the in-memory log capture used for the kMemory format
+   */
+  inline MemoryLogCapture &GetMemoryLogCapture() { return memory_log_capture_; }
+  inline const MemoryLogCapture &GetMemoryLogCapture() const { return memory_log_capture_; }
 
  private:
   std::ofstream csv_file_;             //!< CSV file stream
   bool is_enabled_;                    //!< Enable flag for logging
   bool is_file_opened_;                //!< Is the CSV file opened?
-  static bool is_directory_created_;   //!< Is the log output directory is created in the scenario
   std::vector<ILoggable *> log_list_;  //!< Log list
 
+  size_t log_output_counter_;                  //!< Number of WriteValues calls to handle the log prescaler of each loggable
+  std::vector<size_t> number_of_log_columns_;  //!< Number of columns of each loggable in log_list_
+
+  LogChannelFilter channel_filter_;                  //!< Selection of the log channels
+  std::vector<std::vector<bool>> log_column_masks_;  //!< Selected columns of each loggable in log_list_. Empty when all are selected.
+  MaskedLogValueSink masked_log_value_sink_;         //!< Sink to drop the values of the columns which are not selected
+  std::string value_text_;                           //!< Value text of a loggable which does not support the typed values
+
+  std::ostream csv_stream_;                                           //!< Stream to write the CSV text via the compression if enabled
+  std::unique_ptr<CompressedStreamBuffer> compressed_stream_buffer_;  //!< Compression of the CSV file
+
+  CsvLogValueSink csv_log_value_sink_;   //!< Sink to generate CSV text from typed log values
+  LogFileFormat log_file_format_;        //!< Format of the log file
+  BinaryLogWriter binary_log_writer_;    //!< Writer for the binary format
+  MemoryLogCapture memory_log_capture_;  //!< In-memory log capture for the kMemory format
+
+  std::unique_ptr<AsyncLogWriter> async_log_writer_;  //!< Writer thread for the asynchronous writing
+  std::string row_buffer_;                            //!< Text of the current row for the asynchronous writing
+
+  std::unique_ptr<TelemetryPublisher> telemetry_publisher_;  //!< Publisher of the live telemetry
+  std::unique_ptr<FlightRecorder> flight_recorder_;          //!< Flight recorder of the rows. nullptr when the mode is disabled.
+
   bool is_ini_save_enabled_;    //!< Enable flag to save ini files
   std::string directory_path_;  //!< Path to the directory for log files
+  std::string file_path_;       //!< Path to the log file without the extension for the format and the compression
 
   /**
    * @fn Write
@@ -102,17 +251,39 @@ class Logger {
    * @param [in] log: Write target
    * @param [in] flag: Enable flag to write
    */
-  void Write(const std::string log, const bool flag = true);
+  void Write(const std::string& log, const bool flag = true);
 
   /**
    * @fn WriteNewline
    * @brief Write newline
    */
   void WriteNewLine();
+  /**
+   * @fn IsLogOutputTiming
+   * @brief Return true when the values of the loggable are written in the current row
+   * @param [in] loggable: Target loggable
+   */
+  bool IsLogOutputTiming(const ILoggable &loggable) const;
+  /**
+   * @fn AppendLoggableValues
+   * @brief Append the values of the loggable to the sink without the columns which are not selected by the channel filter
+   * @param [in] index: Index of the loggable in log_list_
+   * @param [out] sink: Sink to receive the typed values
+   * @return True when the values are appended to the sink. False when the loggable does not support the typed values and the CSV text
+   *         of the selected values is stored in value_text_ instead.
+   */
+  bool AppendLoggableValues(const size_t index, ILogValueSink &sink);
+  /**
+   * @fn GetNumberOfLogColumns
+   * @brief Return the number of columns of the loggable
+   * @param [in] index: Index of the loggable in log_list_
+   */
+  size_t GetNumberOfLogColumns(const size_t index);
 
   /**
    * @fn CreateDirectory
    * @brief Create a directory to store the log files
+   * @note A suffix is added to the directory name when the directory already exists, e.g. created by another simulation case in parallel
    * @param [in] data_path: Path to `data` directory
    * @param[in] time: Time stamp (YYYYMMDD_hhmmss)
    * @return Path to the created directory
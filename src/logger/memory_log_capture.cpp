@@ -0,0 +1,170 @@
+/**
+ * @file memory_log_capture.cpp
+ * @brief Class to keep selected log channels in memory and reduce them to statistics
+ */
+
+#include "memory_log_capture.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+MemoryLogCapture::MemoryLogCapture() : current_column_index_(0) {}
+
+void MemoryLogCapture::AddChannel(const std::string& column_name) {
+  Channel channel;
+  channel.name_ = column_name;
+  channels_.push_back(channel);
+}
+
+bool MemoryLogCapture::SetStatistics(const std::vector<std::string>& statistic_names) {
+  bool is_succeeded = true;
+  statistics_.clear();
+  for (const auto& name : statistic_names) {
+    Statistic statistic;
+    statistic.name_ = name;
+    if (name == "MIN") {
+      statistic.type_ = StatisticType::kMinimum;
+    } else if (name == "MAX") {
+      statistic.type_ = StatisticType::kMaximum;
+    } else if (name == "MEAN") {
+      statistic.type_ = StatisticType::kMean;
+    } else if (name == "FINAL") {
+      statistic.type_ = StatisticType::kFinal;
+    } else if (name.size() > 1 && name[0] == 'P') {
+      char* parse_end = nullptr;
+      statistic.percentile_ = std::strtod(name.c_str() + 1, &parse_end);
+      if (*parse_end != '\0' || statistic.percentile_ < 0.0 || statistic.percentile_ > 100.0) {
+        std::cout << "[Warning] MemoryLogCapture: " << name << " is not a valid percentile." << std::endl;
+        is_succeeded = false;
+        continue;
+      }
+      statistic.type_ = StatisticType::kPercentile;
+    } else {
+      std::cout << "[Warning] MemoryLogCapture: " << name << " is not supported." << std::endl;
+      is_succeeded = false;
+      continue;
+    }
+    statistics_.push_back(statistic);
+  }
+  return is_succeeded;
+}
+
+void MemoryLogCapture::Reset() {
+  for (auto& channel : channels_) {
+    channel.values_.clear();
+  }
+  current_column_index_ = 0;
+}
+
+void MemoryLogCapture::AppendHeaders(const std::string& csv_headers) {
+  std::stringstream stream(csv_headers);
+  std::string name;
+  while (std::getline(stream, name, ',')) {
+    if (name.empty()) continue;
+    int channel_index = -1;
+    for (size_t i = 0; i < channels_.size(); i++) {
+      if (channels_[i].name_ == name) channel_index = (int)i;
+    }
+    channel_index_of_column_.push_back(channel_index);
+  }
+}
+
+void MemoryLogCapture::AppendValues(const std::string& csv_values) {
+  size_t start = 0;
+  while (start < csv_values.size()) {
+    size_t end = csv_values.find(',', start);
+    if (end == std::string::npos) end = csv_values.size();
+    const std::string value = csv_values.substr(start, end - start);
+    start = end + 1;
+    if (value.empty()) continue;
+
+    char* parse_end = nullptr;
+    const double number = std::strtod(value.c_str(), &parse_end);
+    if (parse_end != value.c_str() && *parse_end == '\0') {
+      AppendDouble(number);
+    } else {
+      AppendString(value);
+    }
+  }
+}
+
+void MemoryLogCapture::AppendDouble(const double value, const int precision) {
+  (void)precision;
+  Store(value);
+}
+
+void MemoryLogCapture::AppendInteger(const long long value) { Store((double)value); }
+
+void MemoryLogCapture::AppendString(const std::string& value) {
+  (void)value;
+  current_column_index_++;
+}
+
+void MemoryLogCapture::AppendMissingValues(const size_t number_of_values) { current_column_index_ += number_of_values; }
+
+void MemoryLogCapture::EndRow() { current_column_index_ = 0; }
+
+double MemoryLogCapture::CalcStatistic(const size_t channel_index, const Statistic& statistic) const {
+  const std::vector<double>& values = channels_[channel_index].values_;
+  if (values.empty()) return std::numeric_limits<double>::quiet_NaN();
+
+  switch (statistic.type_) {
+    case StatisticType::kMinimum:
+      return *std::min_element(values.begin(), values.end());
+    case StatisticType::kMaximum:
+      return *std::max_element(values.begin(), values.end());
+    case StatisticType::kMean: {
+      double sum = 0.0;
+      for (double value : values) sum += value;
+      return sum / (double)values.size();
+    }
+    case StatisticType::kFinal:
+      return values.back();
+    case StatisticType::kPercentile: {
+      std::vector<double> sorted_values(values);
+      std::sort(sorted_values.begin(), sorted_values.end());
+      const double position = statistic.percentile_ / 100.0 * (double)(sorted_values.size() - 1);
+      const size_t lower_index = (size_t)position;
+      if (lower_index + 1 >= sorted_values.size()) return sorted_values.back();
+      const double ratio = position - (double)lower_index;
+      return sorted_values[lower_index] * (1.0 - ratio) + sorted_values[lower_index + 1] * ratio;
+    }
+    default:
+      return std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+std::string MemoryLogCapture::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  for (const auto& channel : channels_) {
+    for (const auto& statistic : statistics_) {
+      str_tmp += statistic.name_ + "(" + channel.name_ + "),";
+    }
+  }
+
+  return str_tmp;
+}
+
+std::string MemoryLogCapture::GetLogValue() const {
+  std::string str_tmp = "";
+
+  for (size_t i = 0; i < channels_.size(); i++) {
+    for (const auto& statistic : statistics_) {
+      str_tmp += WriteScalar(CalcStatistic(i, statistic), 16);
+    }
+  }
+
+  return str_tmp;
+}
+
+void MemoryLogCapture::Store(const double value) {
+  if (current_column_index_ < channel_index_of_column_.size()) {
+    const int channel_index = channel_index_of_column_[current_column_index_];
+    if (channel_index >= 0) channels_[(size_t)channel_index].values_.push_back(value);
+  }
+  current_column_index_++;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file memory_log_capture.hpp
+ * @brief Class to keep selected log channels in memory and reduce them to statistics
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_MEMORY_LOG_CAPTURE_HPP_
+#define S2E_LIBRARY_LOGGER_MEMORY_LOG_CAPTURE_HPP_
+
+#include <string>
+#include <vector>
+
+#include "log_value_sink.hpp"
+#include "loggable.hpp"
+
+/**
+ * @class MemoryLogCapture
+ * @brief Class to keep selected log channels in memory and reduce them to statistics
+ * @details The values are received as a log value sink, and only the channels (columns) selected by the header name are stored.
+ *          As a loggable, it outputs the statistics of the stored values (e.g., one summary row per Monte-Carlo simulation case).
+ */
+class MemoryLogCapture : public ILogValueSink, public ILoggable {
+ public:
+  /**
+   * @enum StatisticType
+   * @brief Type of the statistic calculated from the stored values
+   */
+  enum class StatisticType {
+    kMinimum,     //!< Minimum value
+    kMaximum,     //!< Maximum value
+    kMean,        //!< Mean value
+    kFinal,       //!< Last value
+    kPercentile,  //!< Percentile with linear interpolation
+  };
+
+  /**
+   * @struct Statistic
+   * @brief Statistic calculated from the stored values
+   */
+  struct Statistic {
+    StatisticType type_;       //!< Type
+    double percentile_ = 0.0;  //!< Percentile [%] for kPercentile
+    std::string name_;         //!< Name used in the header
+  };
+
+  /**
+   * @fn MemoryLogCapture
+   * @brief Constructor
+   */
+  MemoryLogCapture();
+
+  // Settings
+  /**
+   * @fn AddChannel
+   * @brief Add a channel to store
+   * @param [in] column_name: Header of the column (e.g., spacecraft_angular_velocity_b_x[rad/s])
+   */
+  void AddChannel(const std::string& column_name);
+  /**
+   * @fn SetStatistics
+   * @brief Set the statistics calculated for all channels
+   * @param [in] statistic_names: Names of the statistics. MIN, MAX, MEAN, FINAL, and P<percentile> (e.g., P95) are supported.
+   * @return False when an unsupported name is included. The unsupported names are ignored.
+   */
+  bool SetStatistics(const std::vector<std::string>& statistic_names);
+  /**
+   * @fn Reset
+   * @brief Clear the stored values while keeping the channel settings
+   */
+  void Reset();
+
+  // Inputs from Logger
+  /**
+   * @fn AppendHeaders
+   * @brief Append column names with the CSV header format generated by ILoggable::GetLogHeader
+   * @param [in] csv_headers: Comma separated column names
+   */
+  void AppendHeaders(const std::string& csv_headers);
+  /**
+   * @fn AppendValues
+   * @brief Append values with the CSV value format generated by ILoggable::GetLogValue
+   * @param [in] csv_values: Comma separated values
+   */
+  void AppendValues(const std::string& csv_values);
+  /**
+   * @fn AppendDouble
+   * @brief Override AppendDouble function of ILogValueSink
+   */
+  void AppendDouble(const double value, const int precision = 6) override;
+  /**
+   * @fn AppendInteger
+   * @brief Override AppendInteger function of ILogValueSink
+   */
+  void AppendInteger(const long long value) override;
+  /**
+   * @fn AppendString
+   * @brief Override AppendString function of ILogValueSink. Text values are not stored.
+   */
+  void AppendString(const std::string& value) override;
+  /**
+   * @fn AppendMissingValues
+   * @brief Override AppendMissingValues function of ILogValueSink. The missing values are not stored.
+   */
+  void AppendMissingValues(const size_t number_of_values) override;
+  /**
+   * @fn EndRow
+   * @brief Finish the current row
+   */
+  void EndRow();
+
+  // Outputs
+  /**
+   * @fn CalcStatistic
+   * @brief Calculate the statistic of the channel
+   * @param [in] channel_index: Index of the channel in the order of AddChannel
+   * @param [in] statistic: Statistic
+   * @return The statistic. NaN when no value is stored.
+   */
+  double CalcStatistic(const size_t channel_index, const Statistic& statistic) const;
+  /**
+   * @fn GetValues
+   * @brief Return the stored values of the channel
+   * @param [in] channel_index: Index of the channel in the order of AddChannel
+   */
+  inline const std::vector<double>& GetValues(const size_t channel_index) const { return channels_[channel_index].values_; }
+  /**
+   * @fn GetNumberOfChannels
+   * @brief Return number of channels
+   */
+  inline size_t GetNumberOfChannels() const { return channels_.size(); }
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable. The header is <statistic>(<channel>) for each channel and statistic.
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+
+ private:
+  /**
+   * @struct Channel
+   * @brief Stored values of a channel
+   */
+  struct Channel {
+    std::string name_;            //!< Column name
+    std::vector<double> values_;  //!< Stored values
+  };
+
+  std::vector<Channel> channels_;             //!< Channels
+  std::vector<Statistic> statistics_;         //!< Statistics calculated for all channels
+  std::vector<int> channel_index_of_column_;  //!< Index of the channel for each column. -1 for the columns not stored.
+  size_t current_column_index_;               //!< Index of the column for the next appended value
+
+  /**
+   * @fn Store
+   * @brief Store the value of the current column when it is a channel
+   */
+  void Store(const double value);
+};
+
+#endif  // S2E_LIBRARY_LOGGER_MEMORY_LOG_CAPTURE_HPP_
@@ -0,0 +1,75 @@
+/**
+ * @file monte_carlo_log_store.cpp
+ * @brief Single container file to store the logs of all cases of a Monte-Carlo campaign
+ */
+
+#include "monte_carlo_log_store.hpp"
+
+#include <iostream>
+
+static const char kStoreMagic[8] = {'S', '2', 'E', 'M', 'C', 'L', 'O', 'G'};   //!< Magic number at the beginning of the file
+static const char kIndexMagic[8] = {'S', '2', 'E', 'M', 'C', 'I', 'D', 'X'};   //!< Magic number at the beginning of the index
+static const char kFooterMagic[8] = {'S', '2', 'E', 'M', 'C', 'E', 'N', 'D'};  //!< Magic number at the end of the file
+
+MonteCarloLogStore::MonteCarloLogStore() : position_(0) {}
+
+MonteCarloLogStore::~MonteCarloLogStore() { Close(); }
+
+bool MonteCarloLogStore::Open(const std::string& file_path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_.open(file_path, std::ios::out | std::ios::binary);
+  if (!file_.is_open()) {
+    std::cerr << "Error opening Monte-Carlo log store: " << file_path << std::endl;
+    return false;
+  }
+  file_path_ = file_path;
+  file_.write(kStoreMagic, sizeof(kStoreMagic));
+  const uint32_t version = kVersion;
+  file_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  position_ = sizeof(kStoreMagic) + sizeof(version);
+  index_.clear();
+  return true;
+}
+
+void MonteCarloLogStore::Close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!file_.is_open()) return;
+
+  const uint64_t index_offset = position_;
+  file_.write(kIndexMagic, sizeof(kIndexMagic));
+  const uint64_t number_of_records = index_.size();
+  file_.write(reinterpret_cast<const char*>(&number_of_records), sizeof(number_of_records));
+  for (const auto& entry : index_) {
+    const uint8_t type = (uint8_t)entry.type_;
+    file_.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    file_.write(reinterpret_cast<const char*>(&entry.case_index_), sizeof(entry.case_index_));
+    file_.write(reinterpret_cast<const char*>(&entry.offset_), sizeof(entry.offset_));
+    file_.write(reinterpret_cast<const char*>(&entry.size_), sizeof(entry.size_));
+  }
+  file_.write(reinterpret_cast<const char*>(&index_offset), sizeof(index_offset));
+  file_.write(kFooterMagic, sizeof(kFooterMagic));
+  file_.close();
+}
+
+void MonteCarloLogStore::AppendRecord(const RecordType type, const uint64_t case_index, const char* data, const size_t size) {
+  if (size == 0) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!file_.is_open()) return;
+
+  const uint8_t type_value = (uint8_t)type;
+  const uint64_t payload_size = size;
+  file_.write(reinterpret_cast<const char*>(&type_value), sizeof(type_value));
+  file_.write(reinterpret_cast<const char*>(&case_index), sizeof(case_index));
+  file_.write(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+  position_ += sizeof(type_value) + sizeof(case_index) + sizeof(payload_size);
+
+  IndexEntry entry;
+  entry.type_ = type;
+  entry.case_index_ = case_index;
+  entry.offset_ = position_;
+  entry.size_ = payload_size;
+  index_.push_back(entry);
+
+  file_.write(data, size);
+  position_ += payload_size;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file monte_carlo_log_store.hpp
+ * @brief Single container file to store the logs of all cases of a Monte-Carlo campaign
+ * @note File format (all values are little endian)
+ *       Header : magic "S2EMCLOG" (8 bytes), version (uint32)
+ *       Record : type (uint8), case index (uint64), payload size (uint64), payload
+ *       Index  : magic "S2EMCIDX" (8 bytes), number of records (uint64),
+ *                and for each record: type (uint8), case index (uint64), offset of the payload (uint64), payload size (uint64)
+ *       Footer : offset of the index (uint64), magic "S2EMCEND" (8 bytes)
+ *       The payloads of the same case and type concatenated in the file order make a binary log stream (see binary_log_writer.hpp).
+ *       The records of the cases executed in parallel are interleaved. The index and the footer are written when the store is closed,
+ *       and the records can be read sequentially without them (e.g., after an abnormal termination).
+ *       Use scripts/Plot/extract_monte_carlo_log_store.py to extract the CSV logs of the cases.
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_MONTE_CARLO_LOG_STORE_HPP_
+#define S2E_LIBRARY_LOGGER_MONTE_CARLO_LOG_STORE_HPP_
+
+#include <stdint.h>
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class MonteCarloLogStore
+ * @brief Single container file to store the logs of all cases of a Monte-Carlo campaign
+ * @details The log of each case is written as the binary log chunks tagged with the case index, instead of a file for each case.
+ *          The cases executed in the worker threads append their chunks concurrently, and the randomized parameters of each case are
+ *          stored in the same file as a one row binary log.
+ */
+class MonteCarloLogStore {
+ public:
+  /**
+   * @enum RecordType
+   * @brief Type of the record
+   */
+  enum class RecordType : uint8_t {
+    kCaseLog = 0,     //!< Log of the case
+    kParameters = 1,  //!< Randomized parameters of the case
+  };
+
+  /**
+   * @fn MonteCarloLogStore
+   * @brief Constructor
+   */
+  MonteCarloLogStore();
+  /**
+   * @fn ~MonteCarloLogStore
+   * @brief Destructor. Write the index and close the file.
+   */
+  ~MonteCarloLogStore();
+
+  /**
+   * @fn Open
+   * @brief Open the container file
+   * @param [in] file_path: Path to the container file
+   * @return True when the file is opened successfully
+   */
+  bool Open(const std::string& file_path);
+  /**
+   * @fn Close
+   * @brief Write the index and the footer, and close the file
+   */
+  void Close();
+  /**
+   * @fn IsOpened
+   * @brief Return true when the file is opened
+   */
+  inline bool IsOpened() const { return file_.is_open(); }
+  /**
+   * @fn GetFilePath
+   * @brief Return path to the container file
+   */
+  inline const std::string& GetFilePath() const { return file_path_; }
+
+  /**
+   * @fn AppendRecord
+   * @brief Append a record. This function can be called from multiple threads.
+   * @param [in] type: Type of the record
+   * @param [in] case_index: Index of the case
+   * @param [in] data: Payload
+   * @param [in] size: Size of the payload [bytes]
+   */
+  void AppendRecord(const RecordType type, const uint64_t case_index, const char* data, const size_t size);
+
+  static const uint32_t kVersion = 1;  //!< Version of the file format
+
+ private:
+  /**
+   * @struct IndexEntry
+   * @brief Index of a record
+   */
+  struct IndexEntry {
+    RecordType type_;      //!< Type of the record
+    uint64_t case_index_;  //!< Index of the case
+    uint64_t offset_;      //!< Offset of the payload in the file [bytes]
+    uint64_t size_;        //!< Size of the payload [bytes]
+  };
+
+  std::ofstream file_;             //!< Output file stream
+  std::string file_path_;          //!< Path to the container file
+  uint64_t position_;              //!< Current size of the file [bytes]
+  std::vector<IndexEntry> index_;  //!< Index of the records
+  std::mutex mutex_;               //!< Mutex for the concurrent appending
+};
+
+#endif  // S2E_LIBRARY_LOGGER_MONTE_CARLO_LOG_STORE_HPP_
@@ -0,0 +1,270 @@
+/**
+ * @file telemetry_publisher.cpp
+ * @brief Live streaming of the log channels to external viewers through UDP or POSIX shared memory
+ */
+
+#include "telemetry_publisher.hpp"
+
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace {
+const char kPacketMagic[4] = {'S', '2', 'E', 'T'};  //!< Magic number at the beginning of the packets
+const size_t kPacketHeaderSize = 16;                //!< Size of the packet header [bytes]
+const size_t kSchemaHeaderSize = 8;                 //!< Size of the number of columns and the length of the header text [bytes]
+const size_t kDataHeaderSize = 12;                  //!< Size of the elapsed time and the number of values [bytes]
+
+/**
+ * @class TelemetryValueSink
+ * @brief Log value sink to collect the values as doubles
+ */
+class TelemetryValueSink : public ILogValueSink {
+ public:
+  explicit TelemetryValueSink(std::vector<double>& values) : values_(values) {}
+  void AppendDouble(const double value, const int precision = 6) override {
+    (void)precision;
+    values_.push_back(value);
+  }
+  void AppendInteger(const long long value) override { values_.push_back((double)value); }
+  void AppendString(const std::string& value) override {
+    (void)value;
+    values_.push_back(std::numeric_limits<double>::quiet_NaN());
+  }
+  void AppendMissingValues(const size_t number_of_values) override {
+    values_.insert(values_.end(), number_of_values, std::numeric_limits<double>::quiet_NaN());
+  }
+
+ private:
+  std::vector<double>& values_;  //!< Collected values
+};
+
+/**
+ * @fn AppendBytes
+ * @brief Append the bytes of the value to the packet
+ */
+template <typename T>
+void AppendBytes(std::vector<unsigned char>& packet, const T& value) {
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+  packet.insert(packet.end(), bytes, bytes + sizeof(T));
+}
+}  // namespace
+
+TelemetryPublisher::TelemetryPublisher(const TelemetryPublisherConfig& config) : kConfig(config) {
+  schema_packet_.reserve(kMaxPacketSize);
+  data_packet_.reserve(kMaxPacketSize);
+}
+
+TelemetryPublisher::~TelemetryPublisher() { Close(); }
+
+bool TelemetryPublisher::Open() {
+  if (is_opened_) return true;
+  if (!(kConfig.period_s > 0.0)) {
+    std::cerr << "Error: The telemetry period must be positive." << std::endl;
+    return false;
+  }
+#ifdef WIN32
+  std::cout << "[Warning] The telemetry publisher is not supported on Windows." << std::endl;
+  return false;
+#else
+  if (kConfig.transport == TelemetryTransport::kUdp) {
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(kConfig.remote_port);
+    if (inet_pton(AF_INET, kConfig.remote_address.c_str(), &address.sin_addr) != 1) {
+      std::cerr << "Error: Telemetry address " << kConfig.remote_address << " is not a valid IPv4 address." << std::endl;
+      return false;
+    }
+    socket_descriptor_ = socket(AF_INET, SOCK_DGRAM, 0);
+    if (socket_descriptor_ < 0) {
+      std::cerr << "Error: The telemetry socket cannot be created: " << strerror(errno) << std::endl;
+      return false;
+    }
+    fcntl(socket_descriptor_, F_SETFD, FD_CLOEXEC);
+    fcntl(socket_descriptor_, F_SETFL, fcntl(socket_descriptor_, F_GETFL, 0) | O_NONBLOCK);
+    // The connected UDP socket sends to the viewer with send()
+    if (connect(socket_descriptor_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+      std::cerr << "Error: The telemetry socket cannot be connected: " << strerror(errno) << std::endl;
+      close(socket_descriptor_);
+      socket_descriptor_ = -1;
+      return false;
+    }
+  } else {
+    const int descriptor = shm_open(kConfig.shared_memory_name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (descriptor < 0) {
+      std::cerr << "Error: Telemetry shared memory " << kConfig.shared_memory_name << " cannot be created: " << strerror(errno) << std::endl;
+      return false;
+    }
+    const size_t size = 2 * kSharedMemorySlotSize;
+    if (ftruncate(descriptor, (off_t)size) != 0) {
+      std::cerr << "Error: Telemetry shared memory " << kConfig.shared_memory_name << " cannot be resized: " << strerror(errno) << std::endl;
+      close(descriptor);
+      return false;
+    }
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (memory == MAP_FAILED) {
+      std::cerr << "Error: Telemetry shared memory " << kConfig.shared_memory_name << " cannot be mapped: " << strerror(errno) << std::endl;
+      return false;
+    }
+    memset(memory, 0, size);
+    shared_memory_ = memory;
+  }
+
+  is_opened_ = true;
+  next_publish_time_s_ = 0.0;
+  schema_id_ = 0;
+  sequence_number_ = 0;
+  source_header_.clear();
+  return true;
+#endif
+}
+
+void TelemetryPublisher::Close() {
+  if (!is_opened_) return;
+#ifndef WIN32
+  if (socket_descriptor_ >= 0) {
+    close(socket_descriptor_);
+    socket_descriptor_ = -1;
+  }
+  if (shared_memory_ != nullptr) {
+    munmap(shared_memory_, 2 * kSharedMemorySlotSize);
+    shm_unlink(kConfig.shared_memory_name.c_str());
+    shared_memory_ = nullptr;
+  }
+#endif
+  is_opened_ = false;
+}
+
+void TelemetryPublisher::Publish(const std::vector<ILoggable*>& log_list, const double elapsed_time_s) {
+  if (!is_opened_ || elapsed_time_s < next_publish_time_s_) return;
+  next_publish_time_s_ += kConfig.period_s * (std::floor((elapsed_time_s - next_publish_time_s_) / kConfig.period_s) + 1.0);
+
+  if (UpdateSchema(log_list)) Send(schema_packet_, 0);
+  if (selected_columns_.empty()) return;
+
+  // Values of all columns in the order of the headers
+  all_values_.clear();
+  TelemetryValueSink sink(all_values_);
+  for (const ILoggable* loggable : log_list) {
+    if (!(loggable->is_log_enabled_)) continue;
+    if (loggable->AppendLogValue(sink)) continue;
+    std::stringstream value_stream(loggable->GetLogValue());
+    std::string value;
+    while (std::getline(value_stream, value, ',')) {
+      char* end;
+      const double number = std::strtod(value.c_str(), &end);
+      const bool is_number = end != value.c_str() && *end == '\0';
+      all_values_.push_back(is_number ? number : std::numeric_limits<double>::quiet_NaN());
+    }
+  }
+
+  WriteHeader(data_packet_, kDataPacket);
+  AppendBytes(data_packet_, elapsed_time_s);
+  AppendBytes(data_packet_, (uint32_t)selected_columns_.size());
+  for (const size_t column : selected_columns_) {
+    const double value = column < all_values_.size() ? all_values_[column] : std::numeric_limits<double>::quiet_NaN();
+    AppendBytes(data_packet_, value);
+  }
+  Send(data_packet_, 1);
+  sequence_number_++;
+
+  // The viewers which start later receive the schema. The shared memory keeps the schema in its slot.
+  if (kConfig.transport == TelemetryTransport::kUdp && sequence_number_ % kSchemaInterval == 0) Send(schema_packet_, 0);
+}
+
+bool TelemetryPublisher::UpdateSchema(const std::vector<ILoggable*>& log_list) {
+  std::string header;
+  for (const ILoggable* loggable : log_list) {
+    if (loggable->is_log_enabled_) header += loggable->GetLogHeader();
+  }
+  if (schema_id_ != 0 && header == source_header_) return false;
+  source_header_ = header;
+
+  // Select the columns while they fit in a packet
+  selected_columns_.clear();
+  column_names_.clear();
+  std::string schema_text;
+  std::stringstream header_stream(header);
+  std::string name;
+  bool is_truncated = false;
+  for (size_t column = 0; std::getline(header_stream, name, ','); column++) {
+    bool is_selected = kConfig.channels.empty();
+    for (const auto& channel : kConfig.channels) {
+      if (name.find(channel) != std::string::npos) {
+        is_selected = true;
+        break;
+      }
+    }
+    if (!is_selected) continue;
+    const size_t schema_size = kPacketHeaderSize + kSchemaHeaderSize + schema_text.size() + name.size() + 1;
+    const size_t data_size = kPacketHeaderSize + kDataHeaderSize + (selected_columns_.size() + 1) * sizeof(double);
+    if (schema_size > kMaxPacketSize || data_size > kMaxPacketSize) {
+      is_truncated = true;
+      break;
+    }
+    selected_columns_.push_back(column);
+    column_names_.push_back(name);
+    schema_text += name + ",";
+  }
+  if (is_truncated) {
+    std::cout << "[Warning] Telemetry publisher: Only the first " << selected_columns_.size() << " columns are published to fit in a packet."
+              << std::endl;
+  }
+
+  schema_id_++;
+  WriteHeader(schema_packet_, kSchemaPacket);
+  AppendBytes(schema_packet_, (uint32_t)selected_columns_.size());
+  AppendBytes(schema_packet_, (uint32_t)schema_text.size());
+  schema_packet_.insert(schema_packet_.end(), schema_text.begin(), schema_text.end());
+  return true;
+}
+
+void TelemetryPublisher::Send(const std::vector<unsigned char>& packet, const size_t slot) {
+#ifdef WIN32
+  (void)packet;
+  (void)slot;
+#else
+  if (socket_descriptor_ >= 0) {
+    // Nobody may be listening (ECONNREFUSED) or the socket buffer may be full (EAGAIN). The packet is dropped in both cases.
+    if (send(socket_descriptor_, packet.data(), packet.size(), MSG_DONTWAIT) < 0) number_of_dropped_packets_++;
+    return;
+  }
+  if (shared_memory_ == nullptr) return;
+
+  // Seqlock: the counter is odd while the slot is written
+  unsigned char* slot_head = static_cast<unsigned char*>(shared_memory_) + slot * kSharedMemorySlotSize;
+  std::atomic<uint32_t>* counter = reinterpret_cast<std::atomic<uint32_t>*>(slot_head);
+  const uint32_t count = counter->load(std::memory_order_relaxed);
+  counter->store(count + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  const uint32_t size = (uint32_t)packet.size();
+  memcpy(slot_head + sizeof(uint32_t), &size, sizeof(size));
+  memcpy(slot_head + 2 * sizeof(uint32_t), packet.data(), packet.size());
+  counter->store(count + 2, std::memory_order_release);
+#endif
+}
+
+void TelemetryPublisher::WriteHeader(std::vector<unsigned char>& packet, const uint16_t packet_type) const {
+  packet.assign(kPacketMagic, kPacketMagic + sizeof(kPacketMagic));
+  AppendBytes(packet, (uint16_t)kVersion);
+  AppendBytes(packet, packet_type);
+  AppendBytes(packet, schema_id_);
+  AppendBytes(packet, sequence_number_);
+}
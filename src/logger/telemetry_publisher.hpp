@@ -0,0 +1,155 @@
+/**
+ * @file telemetry_publisher.hpp
+ * @brief Live streaming of the log channels to external viewers through UDP or POSIX shared memory
+ * @note Packet format (all values are little endian)
+ *       Header : magic "S2ET" (4 bytes), version (uint16), packet type (uint16), schema ID (uint32), sequence number (uint32)
+ *       Schema : number of columns (uint32), length of the header text (uint32), header text (comma separated column names)
+ *       Data   : elapsed time [s] (double), number of values (uint32), values (double x number of values)
+ *       The data packet is decoded with the schema packet of the same schema ID. The schema packet is sent before the first data packet,
+ *       when the schema changes, and periodically for the viewers which start later.
+ *       Shared memory layout: two slots (schema and data) of the latest packets. Each slot has a sequence counter (uint32, odd while
+ *       writing), the packet size (uint32), and the packet. The viewer retries when the counter is odd or changes during the copy.
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_TELEMETRY_PUBLISHER_HPP_
+#define S2E_LIBRARY_LOGGER_TELEMETRY_PUBLISHER_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "loggable.hpp"
+
+/**
+ * @enum TelemetryTransport
+ * @brief Transport of the telemetry packets
+ */
+enum class TelemetryTransport {
+  kUdp,           //!< UDP datagrams to the viewer
+  kSharedMemory,  //!< Latest packets in POSIX shared memory
+};
+
+/**
+ * @struct TelemetryPublisherConfig
+ * @brief Settings of the telemetry publisher
+ */
+struct TelemetryPublisherConfig {
+  TelemetryTransport transport = TelemetryTransport::kUdp;  //!< Transport
+  std::string remote_address = "127.0.0.1";                 //!< IPv4 address of the viewer (UDP)
+  unsigned short remote_port = 0;                           //!< Port number of the viewer (UDP)
+  std::string shared_memory_name = "/s2e_telemetry";        //!< Name of the shared memory object (shared memory)
+  double period_s = 0.1;                                    //!< Publication period in the simulation time [s]
+  std::vector<std::string> channels;                        //!< Published columns which include one of these texts. Empty for all.
+};
+
+/**
+ * @class TelemetryPublisher
+ * @brief Publisher of the selected columns of the loggables to external viewers
+ * @details The values are collected with ILoggable::AppendLogValue (or GetLogValue) and sent as a packet of doubles. The text values
+ *          (e.g., date time) are sent as NaN. All system calls are non-blocking, so the simulation thread never waits for the viewers, and
+ *          the packets are dropped when nobody listens.
+ */
+class TelemetryPublisher {
+ public:
+  /**
+   * @fn TelemetryPublisher
+   * @brief Constructor
+   * @param [in] config: Settings of the publisher
+   */
+  TelemetryPublisher(const TelemetryPublisherConfig& config);
+  /**
+   * @fn ~TelemetryPublisher
+   * @brief Destructor. Close the socket or remove the shared memory object.
+   */
+  ~TelemetryPublisher();
+
+  /**
+   * @fn Open
+   * @brief Open the socket or create the shared memory object
+   * @return True when the transport is opened
+   */
+  bool Open();
+  /**
+   * @fn Close
+   * @brief Close the transport
+   */
+  void Close();
+
+  /**
+   * @fn Publish
+   * @brief Publish the values of the loggables when the period has passed since the last publication
+   * @param [in] log_list: Loggables. The disabled loggables are skipped.
+   * @param [in] elapsed_time_s: Elapsed simulation time [s]
+   */
+  void Publish(const std::vector<ILoggable*>& log_list, const double elapsed_time_s);
+
+  // Getters
+  /**
+   * @fn IsOpened
+   * @brief Return true when the transport is opened
+   */
+  inline bool IsOpened() const { return is_opened_; }
+  /**
+   * @fn GetNumberOfPublishedPackets
+   * @brief Return number of the published data packets
+   */
+  inline uint32_t GetNumberOfPublishedPackets() const { return sequence_number_; }
+  /**
+   * @fn GetNumberOfDroppedPackets
+   * @brief Return number of the packets which the transport did not accept
+   */
+  inline uint64_t GetNumberOfDroppedPackets() const { return number_of_dropped_packets_; }
+  /**
+   * @fn GetColumnNames
+   * @brief Return names of the published columns
+   */
+  inline const std::vector<std::string>& GetColumnNames() const { return column_names_; }
+
+  static const uint16_t kVersion = 1;                 //!< Version of the packet format
+  static const uint16_t kSchemaPacket = 0;            //!< Packet type of the schema
+  static const uint16_t kDataPacket = 1;              //!< Packet type of the data
+  static const size_t kMaxPacketSize = 65507;         //!< Maximum size of a packet (UDP payload over IPv4) [bytes]
+  static const uint32_t kSchemaInterval = 50;         //!< The schema packet is resent once per this number of data packets
+  static const size_t kSharedMemorySlotSize = 65536;  //!< Size of a slot in the shared memory (counter, size, and packet) [bytes]
+
+ private:
+  const TelemetryPublisherConfig kConfig;  //!< Settings of the publisher
+
+  bool is_opened_ = false;                  //!< Flag of the opened transport
+  int socket_descriptor_ = -1;              //!< UDP socket
+  void* shared_memory_ = nullptr;           //!< Mapped shared memory
+  double next_publish_time_s_ = 0.0;        //!< Elapsed time of the next publication [s]
+  uint32_t schema_id_ = 0;                  //!< ID of the current schema. Zero before the schema is made.
+  uint32_t sequence_number_ = 0;            //!< Number of the published data packets
+  uint64_t number_of_dropped_packets_ = 0;  //!< Number of the packets which the transport did not accept
+
+  std::string source_header_;                 //!< Header text of all enabled loggables used to make the schema
+  std::vector<size_t> selected_columns_;      //!< Indices of the published columns in all columns of the enabled loggables
+  std::vector<std::string> column_names_;     //!< Names of the published columns
+  std::vector<double> all_values_;            //!< Values of all columns of the enabled loggables
+  std::vector<unsigned char> schema_packet_;  //!< Encoded schema packet
+  std::vector<unsigned char> data_packet_;    //!< Buffer to encode the data packet
+
+  /**
+   * @fn UpdateSchema
+   * @brief Make the schema again when the headers of the enabled loggables change
+   * @param [in] log_list: Loggables
+   * @return True when the schema changes
+   */
+  bool UpdateSchema(const std::vector<ILoggable*>& log_list);
+  /**
+   * @fn Send
+   * @brief Send the packet without blocking
+   * @param [in] packet: Encoded packet
+   * @param [in] slot: Slot in the shared memory (0: schema, 1: data)
+   */
+  void Send(const std::vector<unsigned char>& packet, const size_t slot);
+  /**
+   * @fn WriteHeader
+   * @brief Write the packet header at the beginning of the packet
+   */
+  void WriteHeader(std::vector<unsigned char>& packet, const uint16_t packet_type) const;
+};
+
+#endif  // S2E_LIBRARY_LOGGER_TELEMETRY_PUBLISHER_HPP_
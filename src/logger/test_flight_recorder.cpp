@@ -0,0 +1,200 @@
+/**
+ * @file test_flight_recorder.cpp
+ * @brief Test codes for FlightRecorder class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "flight_recorder.hpp"
+
+namespace {
+const std::string kFilePathPrefix = "test_flight_recorder_";
+const std::string kHeader = "elapsed_time[s],rate_x[rad/s],rate_y[rad/s],";
+
+/**
+ * @fn ReadLines
+ * @brief Return the lines of the file. Empty when the file does not exist.
+ * @param [in] file_path: Path to the file
+ */
+std::vector<std::string> ReadLines(const std::string& file_path) {
+  std::ifstream file(file_path);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line)) lines.push_back(line);
+  return lines;
+}
+
+/**
+ * @fn MakeRow
+ * @brief Make the row of the time step with the rate values
+ * @param [in] step: Index of the row
+ * @param [in] rate_x: Value of the rate_x column
+ */
+std::string MakeRow(const size_t step, const double rate_x = 0.0) {
+  return std::to_string(step) + "," + std::to_string(rate_x) + ",0,";
+}
+
+/**
+ * @fn GetDumpFilePath
+ * @brief Return the path to the dump file
+ * @param [in] dump_index: Index of the dump
+ */
+std::string GetDumpFilePath(const size_t dump_index) { return kFilePathPrefix + "flight_record_" + std::to_string(dump_index) + ".csv"; }
+
+/**
+ * @fn RemoveDumpFiles
+ * @brief Remove the dump files and the trigger list
+ */
+void RemoveDumpFiles() {
+  for (size_t dump_index = 0; dump_index < 10; dump_index++) std::remove(GetDumpFilePath(dump_index).c_str());
+  std::remove((kFilePathPrefix + "flight_record_triggers.csv").c_str());
+}
+}  // namespace
+
+/**
+ * @brief Test for the window with the post trigger rows written at the manual trigger
+ */
+TEST(FlightRecorder, TriggerWindowDump) {
+  RemoveDumpFiles();
+  FlightRecorderConfig config;
+  config.window_rows = 5;
+  config.post_trigger_rows = 2;
+  config.max_dumps = 2;
+  config.summary_interval = 4;
+  {
+    FlightRecorder recorder(config, kFilePathPrefix);
+    recorder.AppendHeader(kHeader);
+    EXPECT_TRUE(recorder.IsSummaryRow(0));
+    EXPECT_FALSE(recorder.IsSummaryRow(3));
+    EXPECT_TRUE(recorder.IsSummaryRow(8));
+
+    // The memory is limited to the window and the post trigger rows
+    for (size_t step = 0; step < 20; step++) recorder.PushRow(MakeRow(step));
+    EXPECT_EQ(7u, recorder.GetNumberOfStoredRows());
+
+    recorder.Trigger("anomaly");
+    EXPECT_TRUE(recorder.IsTriggered());
+    // The trigger is ignored while the previous trigger is waiting
+    recorder.Trigger("second anomaly");
+    recorder.PushRow(MakeRow(20));
+    EXPECT_EQ(0u, recorder.GetNumberOfDumps());
+    recorder.PushRow(MakeRow(21));
+    EXPECT_FALSE(recorder.IsTriggered());
+    EXPECT_EQ(1u, recorder.GetNumberOfDumps());
+
+    // The last 7 rows from the oldest one
+    std::vector<std::string> expected_lines = {kHeader};
+    for (size_t step = 15; step <= 21; step++) expected_lines.push_back(MakeRow(step));
+    EXPECT_EQ(expected_lines, ReadLines(GetDumpFilePath(0)));
+
+    // The trigger waiting for the post trigger rows is dumped at the destruction
+    recorder.Trigger("end");
+    recorder.PushRow(MakeRow(22));
+    EXPECT_EQ(1u, recorder.GetNumberOfDumps());
+  }
+  std::vector<std::string> expected_lines = {kHeader};
+  for (size_t step = 16; step <= 22; step++) expected_lines.push_back(MakeRow(step));
+  EXPECT_EQ(expected_lines, ReadLines(GetDumpFilePath(1)));
+  EXPECT_EQ(std::vector<std::string>({"dump_index,number_of_rows,reason", "0,7,anomaly", "1,7,end"}),
+            ReadLines(kFilePathPrefix + "flight_record_triggers.csv"));
+
+  RemoveDumpFiles();
+}
+
+/**
+ * @brief Test for the window dumped before it is filled and the limit of the number of dumps
+ */
+TEST(FlightRecorder, PartialWindowAndMaxDumps) {
+  RemoveDumpFiles();
+  FlightRecorderConfig config;
+  config.window_rows = 100;
+  config.post_trigger_rows = 0;
+  config.max_dumps = 2;
+  FlightRecorder recorder(config, kFilePathPrefix);
+  recorder.AppendHeader(kHeader);
+  recorder.PushRow(MakeRow(0));
+  recorder.PushRow(MakeRow(1));
+
+  // Without the post trigger rows, the window is dumped immediately
+  recorder.Trigger("first");
+  EXPECT_EQ(1u, recorder.GetNumberOfDumps());
+  EXPECT_EQ(std::vector<std::string>({kHeader, MakeRow(0), MakeRow(1)}), ReadLines(GetDumpFilePath(0)));
+
+  recorder.PushRow(MakeRow(2));
+  recorder.Trigger("second");
+  recorder.Trigger("third");
+  EXPECT_EQ(2u, recorder.GetNumberOfDumps());
+  EXPECT_FALSE(recorder.IsTriggered());
+  EXPECT_EQ(std::vector<std::string>({kHeader, MakeRow(0), MakeRow(1), MakeRow(2)}), ReadLines(GetDumpFilePath(1)));
+  EXPECT_TRUE(ReadLines(GetDumpFilePath(2)).empty());
+
+  RemoveDumpFiles();
+}
+
+/**
+ * @brief Test for the threshold trigger at the rising edge of the matched columns
+ */
+TEST(FlightRecorder, ThresholdTrigger) {
+  RemoveDumpFiles();
+  FlightRecorderConfig config;
+  config.window_rows = 3;
+  config.post_trigger_rows = 1;
+  config.thresholds.push_back({"rate_*", 0.5});
+  FlightRecorder recorder(config, kFilePathPrefix);
+  recorder.AppendHeader(kHeader);
+
+  recorder.PushRow(MakeRow(0, 0.1));
+  recorder.PushRow(MakeRow(1, -0.4));
+  // The skipped field is not parsed as zero or a value
+  recorder.PushRow("2,,0,");
+  EXPECT_FALSE(recorder.IsTriggered());
+  // The absolute value is compared
+  recorder.PushRow(MakeRow(3, -0.6));
+  EXPECT_TRUE(recorder.IsTriggered());
+  recorder.PushRow(MakeRow(4, 0.7));
+  EXPECT_EQ(1u, recorder.GetNumberOfDumps());
+  EXPECT_EQ(std::vector<std::string>({kHeader, MakeRow(1, -0.4), "2,,0,", MakeRow(3, -0.6), MakeRow(4, 0.7)}), ReadLines(GetDumpFilePath(0)));
+
+  // The value kept above the threshold does not trigger again, and the next rising edge triggers
+  recorder.PushRow(MakeRow(5, 0.8));
+  EXPECT_FALSE(recorder.IsTriggered());
+  recorder.PushRow(MakeRow(6, 0.0));
+  recorder.PushRow(MakeRow(7, 0.9));
+  EXPECT_TRUE(recorder.IsTriggered());
+  recorder.PushRow(MakeRow(8, 0.0));
+  EXPECT_EQ(2u, recorder.GetNumberOfDumps());
+
+  const std::vector<std::string> trigger_lines = ReadLines(kFilePathPrefix + "flight_record_triggers.csv");
+  ASSERT_EQ(3u, trigger_lines.size());
+  EXPECT_EQ("0,4,threshold rate_* = -0.600000", trigger_lines[1]);
+
+  RemoveDumpFiles();
+}
+
+/**
+ * @brief Test for the trigger by the detected events
+ */
+TEST(FlightRecorder, EventTrigger) {
+  RemoveDumpFiles();
+  FlightRecorderConfig config;
+  config.window_rows = 2;
+  config.post_trigger_rows = 0;
+  config.trigger_events = {"eclipse_*", "sun_pointing_lost"};
+  FlightRecorder recorder(config, kFilePathPrefix);
+  recorder.AppendHeader(kHeader);
+  recorder.PushRow(MakeRow(0));
+
+  EXPECT_FALSE(recorder.NotifyEvent("ground_station_visible"));
+  EXPECT_EQ(0u, recorder.GetNumberOfDumps());
+  EXPECT_TRUE(recorder.NotifyEvent("eclipse_entry"));
+  EXPECT_TRUE(recorder.NotifyEvent("sun_pointing_lost"));
+  EXPECT_EQ(2u, recorder.GetNumberOfDumps());
+  EXPECT_EQ(std::vector<std::string>({"dump_index,number_of_rows,reason", "0,1,event eclipse_entry", "1,1,event sun_pointing_lost"}),
+            ReadLines(kFilePathPrefix + "flight_record_triggers.csv"));
+
+  RemoveDumpFiles();
+}
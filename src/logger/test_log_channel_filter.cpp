@@ -0,0 +1,110 @@
+/**
+ * @file test_log_channel_filter.cpp
+ * @brief Test codes for LogChannelFilter class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "log_channel_filter.hpp"
+
+/**
+ * @brief Test for the glob matching
+ */
+TEST(LogChannelFilter, MatchGlob) {
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("", ""));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("", "a"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("*", ""));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("*", "any_text"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("**", "any_text"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("abc", "abc"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("abc", "abcd"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("abcd", "abc"));
+
+  // '?' matches a single character
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("a?c", "abc"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("a?c", "ac"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("a?c", "abbc"));
+
+  // '*' needs the backtracking when the first candidate fails
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("a*b*c", "aXbYbZc"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("*_x*", "angular_velocity_b_x[rad/s]"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("*ab", "aab"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("*aab", "aaab"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("*ab", "aba"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("a*b", "ac"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("a*", "a"));
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("a*?", "ab"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("a*?", "a"));
+
+  // '[' in the headers is matched literally
+  EXPECT_TRUE(LogChannelFilter::MatchGlob("*[rad/s]", "spacecraft_angular_velocity_b_x[rad/s]"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("*[rad/s]", "spacecraft_angular_velocity_b_x[deg/s]"));
+  EXPECT_FALSE(LogChannelFilter::MatchGlob("[a]", "a"));
+}
+
+/**
+ * @brief Test for the include and exclude patterns
+ */
+TEST(LogChannelFilter, IsSelected) {
+  LogChannelFilter filter;
+  EXPECT_FALSE(filter.IsEnabled());
+  EXPECT_TRUE(filter.IsSelected("any_column[m]"));
+
+  // Only the exclude patterns select all the other channels
+  filter.AddExcludePattern("*_z*");
+  EXPECT_TRUE(filter.IsEnabled());
+  EXPECT_TRUE(filter.IsSelected("position_i_x[m]"));
+  EXPECT_FALSE(filter.IsSelected("position_i_z[m]"));
+
+  // The exclude patterns have priority over the include patterns
+  filter.AddIncludePattern("position_*");
+  filter.AddIncludePattern("velocity_*");
+  EXPECT_TRUE(filter.IsSelected("position_i_x[m]"));
+  EXPECT_TRUE(filter.IsSelected("velocity_i_y[m/s]"));
+  EXPECT_FALSE(filter.IsSelected("velocity_i_z[m/s]"));
+  EXPECT_FALSE(filter.IsSelected("quaternion_i2b_x[-]"));
+
+  EXPECT_TRUE(filter.IsAnySelected("quaternion_i2b_x[-],position_i_y[m],"));
+  EXPECT_FALSE(filter.IsAnySelected("quaternion_i2b_x[-],position_i_z[m],"));
+  EXPECT_FALSE(filter.IsAnySelected(""));
+}
+
+/**
+ * @brief Test for the header and the values filtered with the column mask
+ */
+TEST(LogChannelFilter, FilterHeader) {
+  const std::string header = "elapsed_time[s],position_i_x[m],position_i_y[m],position_i_z[m],quaternion_i2b_x[-],";
+  const std::string values = "1.5,7000000,0,-1e+03,0.5,";
+  std::vector<bool> column_mask;
+
+  LogChannelFilter filter;
+  filter.AddIncludePattern("elapsed_time*");
+  filter.AddIncludePattern("position_*");
+  filter.AddExcludePattern("*_y[m]");
+  EXPECT_EQ("elapsed_time[s],position_i_x[m],position_i_z[m],", filter.FilterHeader(header, column_mask));
+  EXPECT_EQ(std::vector<bool>({true, true, false, true, false}), column_mask);
+  EXPECT_EQ("1.5,7000000,-1e+03,", LogChannelFilter::FilterValues(values, column_mask));
+
+  // The columns out of the mask are kept
+  EXPECT_EQ("1.5,7000000,-1e+03,9,", LogChannelFilter::FilterValues(values + "9,", column_mask));
+
+  // The mask is cleared when all columns are selected, and the values are not changed
+  LogChannelFilter select_all_filter;
+  select_all_filter.AddExcludePattern("attitude_*");
+  EXPECT_EQ(header, select_all_filter.FilterHeader(header, column_mask));
+  EXPECT_TRUE(column_mask.empty());
+  EXPECT_EQ(values, LogChannelFilter::FilterValues(values, column_mask));
+
+  // The header without the last comma is also divided
+  EXPECT_EQ("position_i_x[m],", filter.FilterHeader("quaternion_i2b_x[-],position_i_x[m]", column_mask));
+  EXPECT_EQ(std::vector<bool>({false, true}), column_mask);
+
+  // No channel is selected
+  LogChannelFilter exclude_all_filter;
+  exclude_all_filter.AddExcludePattern("*");
+  EXPECT_EQ("", exclude_all_filter.FilterHeader(header, column_mask));
+  EXPECT_EQ(std::vector<bool>(5, false), column_mask);
+  EXPECT_EQ("", LogChannelFilter::FilterValues(values, column_mask));
+}
@@ -0,0 +1,106 @@
+/**
+ * @file test_log_utility.cpp
+ * @brief Test codes for the log utility functions with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "log_utility.hpp"
+
+namespace {
+/**
+ * @fn WriteWithStream
+ * @brief Write the value and a comma with std::stringstream and std::setprecision as the former implementation
+ */
+template <typename T>
+std::string WriteWithStream(const T value, const int precision) {
+  std::stringstream stream;
+  stream << std::setprecision(precision) << value << ",";
+  return stream.str();
+}
+}  // namespace
+
+/**
+ * @brief Test for AppendLogDouble against std::stringstream with std::setprecision
+ */
+TEST(LogUtility, AppendLogDouble) {
+  std::vector<double> values = {0.0,
+                                -0.0,
+                                1.0,
+                                -1.5,
+                                0.1,
+                                123456.0,
+                                1234567.0,
+                                1.0e-5,
+                                1.0e-4,
+                                9.9999995e-5,
+                                999999.5,
+                                6378137.0,
+                                3.986004418e14,
+                                std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::lowest(),
+                                std::numeric_limits<double>::min(),
+                                std::numeric_limits<double>::denorm_min(),
+                                std::numeric_limits<double>::epsilon(),
+                                std::numeric_limits<double>::infinity(),
+                                -std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::quiet_NaN()};
+  // Random values in the wide range of the exponent and random bit patterns including the subnormal numbers
+  std::mt19937_64 generator(0x5eed);
+  std::uniform_real_distribution<double> mantissa_distribution(-10.0, 10.0);
+  std::uniform_int_distribution<int> exponent_distribution(-30, 30);
+  for (size_t i = 0; i < 500; i++) {
+    values.push_back(mantissa_distribution(generator) * pow(10.0, exponent_distribution(generator)));
+    const uint64_t bits = generator();
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    values.push_back(value);
+  }
+
+  const std::vector<int> precisions = {-1, 0, 1, 2, 3, 6, 10, 15, 16, 17, 20, 30, 60, 100};
+  for (const int precision : precisions) {
+    for (const double value : values) {
+      std::string text = "prefix,";
+      AppendLogDouble(text, value, precision);
+      EXPECT_EQ("prefix," + WriteWithStream(value, precision), text) << "precision " << precision;
+    }
+  }
+}
+
+/**
+ * @brief Test for the scalar, vector, matrix and quaternion values against std::stringstream
+ */
+TEST(LogUtility, WriteValues) {
+  EXPECT_EQ(WriteWithStream(0.1f, 6), WriteScalar(0.1f));
+  EXPECT_EQ(WriteWithStream(1.0 / 3.0, 10), WriteScalar(1.0 / 3.0, 10));
+  EXPECT_EQ("1,0,", WriteScalar(true) + WriteScalar(false));
+  EXPECT_EQ("-123456789,", WriteScalar(-123456789));
+  EXPECT_EQ("18446744073709551615,", WriteScalar(std::numeric_limits<unsigned long long>::max()));
+  EXPECT_EQ("a,", WriteScalar('a'));
+  EXPECT_EQ("text,", WriteScalar(std::string("text")));
+
+  libra::Vector<3> vector;
+  vector[0] = 1.0 / 3.0;
+  vector[1] = -2.0e-10;
+  vector[2] = 6378137.0;
+  EXPECT_EQ(WriteWithStream(vector[0], 8) + WriteWithStream(vector[1], 8) + WriteWithStream(vector[2], 8), WriteVector(vector, 8));
+
+  libra::Matrix<2, 2> matrix;
+  matrix[0][0] = 1.0;
+  matrix[0][1] = 2.5;
+  matrix[1][0] = -3.25e20;
+  matrix[1][1] = 0.0;
+  EXPECT_EQ("1,2.5,-3.25e+20,0,", WriteMatrix(matrix));
+
+  const libra::Quaternion quaternion(0.5, -0.5, 0.5, -0.5);
+  EXPECT_EQ("0.5,-0.5,0.5,-0.5,", WriteQuaternion(quaternion));
+}
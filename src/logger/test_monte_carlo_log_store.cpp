@@ -0,0 +1,260 @@
+/**
+ * @file test_monte_carlo_log_store.cpp
+ * @brief Test codes for MonteCarloLogStore class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "binary_log_writer.hpp"
+#include "monte_carlo_log_store.hpp"
+
+namespace {
+const std::string kStoreFile = "test_monte_carlo_log_store.bin";
+const std::string kBinaryLogFile = "test_monte_carlo_log_store_case.bin";
+
+/**
+ * @struct Record
+ * @brief Record read from the container file
+ */
+struct Record {
+  uint8_t type;         //!< Type of the record
+  uint64_t case_index;  //!< Index of the case
+  uint64_t offset;      //!< Offset of the payload [bytes]
+  std::string payload;  //!< Payload
+};
+
+/**
+ * @struct ContainerFile
+ * @brief Contents of the container file
+ */
+struct ContainerFile {
+  std::string data;              //!< Whole file
+  uint32_t version = 0;          //!< Version of the file format
+  std::vector<Record> records;   //!< Records read sequentially
+  std::vector<Record> index;     //!< Index entries. The payload is read with the offset and the size.
+  size_t index_offset = 0;       //!< Offset of the index [bytes]. Zero when the index is missing.
+  bool is_footer_valid = false;  //!< The footer points to the index
+};
+
+/**
+ * @fn ReadValue
+ * @brief Read a value at the position and advance the position
+ * @param [in] data: Whole file
+ * @param [in/out] position: Position in the file [bytes]
+ */
+template <typename T>
+T ReadValue(const std::string& data, size_t& position) {
+  T value;
+  std::memcpy(&value, data.data() + position, sizeof(T));
+  position += sizeof(T);
+  return value;
+}
+
+/**
+ * @fn ReadContainerFile
+ * @brief Read the records sequentially, and the index and the footer of the container file
+ * @param [in] file_path: Path to the container file
+ */
+ContainerFile ReadContainerFile(const std::string& file_path) {
+  ContainerFile container;
+  std::ifstream file(file_path, std::ios::binary);
+  std::stringstream stream;
+  stream << file.rdbuf();
+  container.data = stream.str();
+  const std::string& data = container.data;
+  if (data.compare(0, 8, "S2EMCLOG") != 0) return container;
+
+  size_t position = 8;
+  container.version = ReadValue<uint32_t>(data, position);
+  while (position < data.size() && data.compare(position, 8, "S2EMCIDX") != 0) {
+    Record record;
+    record.type = ReadValue<uint8_t>(data, position);
+    record.case_index = ReadValue<uint64_t>(data, position);
+    const uint64_t size = ReadValue<uint64_t>(data, position);
+    record.offset = position;
+    record.payload = data.substr(position, size);
+    position += size;
+    container.records.push_back(record);
+  }
+  if (position >= data.size()) return container;
+
+  container.index_offset = position;
+  position += 8;
+  const uint64_t number_of_records = ReadValue<uint64_t>(data, position);
+  for (uint64_t i = 0; i < number_of_records; i++) {
+    Record entry;
+    entry.type = ReadValue<uint8_t>(data, position);
+    entry.case_index = ReadValue<uint64_t>(data, position);
+    entry.offset = ReadValue<uint64_t>(data, position);
+    const uint64_t size = ReadValue<uint64_t>(data, position);
+    entry.payload = data.substr(entry.offset, size);
+    container.index.push_back(entry);
+  }
+  container.is_footer_valid =
+      ReadValue<uint64_t>(data, position) == container.index_offset && data.compare(position, 8, "S2EMCEND") == 0 && position + 8 == data.size();
+  return container;
+}
+
+/**
+ * @fn ConcatenatePayloads
+ * @brief Concatenate the payloads of the case and the type in the file order
+ * @param [in] records: Records
+ * @param [in] type: Type of the record
+ * @param [in] case_index: Index of the case
+ */
+std::string ConcatenatePayloads(const std::vector<Record>& records, const MonteCarloLogStore::RecordType type, const uint64_t case_index) {
+  std::string payloads;
+  for (const auto& record : records) {
+    if (record.type == (uint8_t)type && record.case_index == case_index) payloads += record.payload;
+  }
+  return payloads;
+}
+}  // namespace
+
+/**
+ * @brief Test for the records appended from the parallel cases, and the random access with the index
+ */
+TEST(MonteCarloLogStore, ConcurrentAppend) {
+  const size_t number_of_cases = 4;
+  const size_t number_of_chunks = 50;
+  {
+    MonteCarloLogStore store;
+    EXPECT_FALSE(store.IsOpened());
+    ASSERT_TRUE(store.Open(kStoreFile));
+    EXPECT_EQ(kStoreFile, store.GetFilePath());
+
+    std::vector<std::thread> workers;
+    for (uint64_t case_index = 0; case_index < number_of_cases; case_index++) {
+      workers.emplace_back([&store, case_index, number_of_chunks]() {
+        const std::string parameters = "parameters" + std::to_string(case_index);
+        store.AppendRecord(MonteCarloLogStore::RecordType::kParameters, case_index, parameters.data(), parameters.size());
+        for (size_t chunk = 0; chunk < number_of_chunks; chunk++) {
+          const std::string data = "case" + std::to_string(case_index) + "_chunk" + std::to_string(chunk) + ";";
+          store.AppendRecord(MonteCarloLogStore::RecordType::kCaseLog, case_index, data.data(), data.size());
+        }
+        // The empty payload is not recorded
+        store.AppendRecord(MonteCarloLogStore::RecordType::kCaseLog, case_index, nullptr, 0);
+      });
+    }
+    for (auto& worker : workers) worker.join();
+    store.Close();
+    EXPECT_FALSE(store.IsOpened());
+    // The record after the close is ignored
+    store.AppendRecord(MonteCarloLogStore::RecordType::kCaseLog, 0, "ignored", 7);
+  }
+
+  const ContainerFile container = ReadContainerFile(kStoreFile);
+  EXPECT_EQ((uint32_t)MonteCarloLogStore::kVersion, container.version);
+  ASSERT_EQ(number_of_cases * (number_of_chunks + 1), container.records.size());
+  EXPECT_TRUE(container.is_footer_valid);
+
+  // The chunks of each case keep their order even when the cases are interleaved
+  for (uint64_t case_index = 0; case_index < number_of_cases; case_index++) {
+    std::string expected_log;
+    for (size_t chunk = 0; chunk < number_of_chunks; chunk++) {
+      expected_log += "case" + std::to_string(case_index) + "_chunk" + std::to_string(chunk) + ";";
+    }
+    EXPECT_EQ(expected_log, ConcatenatePayloads(container.records, MonteCarloLogStore::RecordType::kCaseLog, case_index));
+    EXPECT_EQ("parameters" + std::to_string(case_index),
+              ConcatenatePayloads(container.records, MonteCarloLogStore::RecordType::kParameters, case_index));
+  }
+
+  // The index points to the same records as the sequential reading
+  ASSERT_EQ(container.records.size(), container.index.size());
+  for (size_t i = 0; i < container.records.size(); i++) {
+    EXPECT_EQ(container.records[i].type, container.index[i].type);
+    EXPECT_EQ(container.records[i].case_index, container.index[i].case_index);
+    EXPECT_EQ(container.records[i].offset, container.index[i].offset);
+    EXPECT_EQ(container.records[i].payload, container.index[i].payload);
+  }
+
+  std::remove(kStoreFile.c_str());
+}
+
+/**
+ * @brief Test for the records readable sequentially without the index, the reopening, and the invalid file path
+ */
+TEST(MonteCarloLogStore, ReadWithoutIndex) {
+  MonteCarloLogStore invalid_store;
+  EXPECT_FALSE(invalid_store.Open("test_monte_carlo_log_store_missing_directory/store.bin"));
+  EXPECT_FALSE(invalid_store.IsOpened());
+  invalid_store.AppendRecord(MonteCarloLogStore::RecordType::kCaseLog, 0, "ignored", 7);
+
+  MonteCarloLogStore store;
+  ASSERT_TRUE(store.Open(kStoreFile));
+  store.AppendRecord(MonteCarloLogStore::RecordType::kCaseLog, 7, "abc", 3);
+  store.AppendRecord(MonteCarloLogStore::RecordType::kParameters, 7, "p", 1);
+  store.AppendRecord(MonteCarloLogStore::RecordType::kCaseLog, 7, "de", 2);
+  store.Close();
+  const ContainerFile container = ReadContainerFile(kStoreFile);
+  ASSERT_TRUE(container.is_footer_valid);
+
+  // The file without the index and the footer as the abnormal termination
+  const std::string truncated_file = kStoreFile + ".truncated";
+  std::ofstream(truncated_file, std::ios::binary) << container.data.substr(0, container.index_offset);
+  const ContainerFile truncated_container = ReadContainerFile(truncated_file);
+  EXPECT_FALSE(truncated_container.is_footer_valid);
+  EXPECT_EQ(3u, truncated_container.records.size());
+  EXPECT_EQ("abcde", ConcatenatePayloads(truncated_container.records, MonteCarloLogStore::RecordType::kCaseLog, 7));
+  EXPECT_EQ("p", ConcatenatePayloads(truncated_container.records, MonteCarloLogStore::RecordType::kParameters, 7));
+
+  // Reopening starts a new file
+  ASSERT_TRUE(store.Open(kStoreFile));
+  store.AppendRecord(MonteCarloLogStore::RecordType::kParameters, 1, "x", 1);
+  store.Close();
+  const ContainerFile reopened_container = ReadContainerFile(kStoreFile);
+  ASSERT_EQ(1u, reopened_container.records.size());
+  ASSERT_EQ(1u, reopened_container.index.size());
+  EXPECT_EQ("x", reopened_container.index[0].payload);
+
+  std::remove(kStoreFile.c_str());
+  std::remove(truncated_file.c_str());
+}
+
+/**
+ * @brief Test for the binary log written to the store as the same stream as the binary log file
+ */
+TEST(MonteCarloLogStore, BinaryLogWriterStore) {
+  auto write_rows = [](BinaryLogWriter& writer) {
+    writer.AppendHeaders("time[s],value[m],date,");
+    // More rows than a chunk to append the records before the close
+    for (uint32_t row = 0; row < BinaryLogWriter::kNumberOfRowsPerChunk + 10; row++) {
+      writer.AppendValues(std::to_string(row * 0.1) + "," + std::to_string(row * 1.5) + ",2020/01/01,");
+      writer.EndRow();
+    }
+  };
+
+  {
+    BinaryLogWriter file_writer;
+    ASSERT_TRUE(file_writer.Open(kBinaryLogFile));
+    write_rows(file_writer);
+  }
+  std::ifstream binary_log_file(kBinaryLogFile, std::ios::binary);
+  std::stringstream binary_log;
+  binary_log << binary_log_file.rdbuf();
+
+  {
+    MonteCarloLogStore store;
+    ASSERT_TRUE(store.Open(kStoreFile));
+    BinaryLogWriter store_writer;
+    EXPECT_FALSE(store_writer.OpenStore(nullptr, 3));
+    ASSERT_TRUE(store_writer.OpenStore(&store, 3));
+    EXPECT_TRUE(store_writer.IsOpened());
+    write_rows(store_writer);
+    store_writer.Close();
+    EXPECT_FALSE(store_writer.IsOpened());
+  }
+  const ContainerFile container = ReadContainerFile(kStoreFile);
+  EXPECT_GE(container.records.size(), 2u);
+  EXPECT_EQ(binary_log.str(), ConcatenatePayloads(container.records, MonteCarloLogStore::RecordType::kCaseLog, 3));
+
+  std::remove(kStoreFile.c_str());
+  std::remove(kBinaryLogFile.c_str());
+}
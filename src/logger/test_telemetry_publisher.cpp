@@ -0,0 +1,325 @@
+/**
+ * @file test_telemetry_publisher.cpp
+ * @brief Test codes for TelemetryPublisher class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "telemetry_publisher.hpp"
+
+namespace {
+/**
+ * @class TestLoggable
+ * @brief Loggable with the numerical and the text values generated by GetLogValue
+ */
+class TestLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const override { return header_; }
+  std::string GetLogValue() const override { return "1.5,-2.5,2020/01/01 00:00:00," + std::to_string(position_m_) + ","; }
+
+  std::string header_ = "rate_x[rad/s],rate_y[rad/s],date,position_x[m],";  //!< Header
+  double position_m_ = 0.0;                                                //!< Value of the position column
+};
+
+/**
+ * @class TestSinkLoggable
+ * @brief Loggable with the typed values
+ */
+class TestSinkLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const override { return "counter[-],"; }
+  std::string GetLogValue() const override { return "0,"; }
+  bool AppendLogValue(ILogValueSink& sink) const override {
+    sink.AppendInteger(42);
+    return true;
+  }
+};
+
+/**
+ * @struct Packet
+ * @brief Decoded telemetry packet
+ */
+struct Packet {
+  uint16_t version = 0;            //!< Version of the packet format
+  uint16_t type = 0;               //!< Packet type
+  uint32_t schema_id = 0;          //!< Schema ID
+  uint32_t sequence_number = 0;    //!< Sequence number
+  std::string schema_text;         //!< Header text of the schema packet
+  uint32_t number_of_columns = 0;  //!< Number of columns of the schema packet
+  double elapsed_time_s = 0.0;     //!< Elapsed time of the data packet [s]
+  std::vector<double> values;      //!< Values of the data packet
+};
+
+/**
+ * @fn ReadValue
+ * @brief Read a value at the position and advance the position
+ * @param [in] data: Packet
+ * @param [in/out] position: Position in the packet [bytes]
+ */
+template <typename T>
+T ReadValue(const std::vector<unsigned char>& data, size_t& position) {
+  T value;
+  std::memcpy(&value, data.data() + position, sizeof(T));
+  position += sizeof(T);
+  return value;
+}
+
+/**
+ * @fn DecodePacket
+ * @brief Decode the telemetry packet
+ * @param [in] data: Packet
+ */
+Packet DecodePacket(const std::vector<unsigned char>& data) {
+  Packet packet;
+  EXPECT_EQ(0, std::memcmp(data.data(), "S2ET", 4));
+  size_t position = 4;
+  packet.version = ReadValue<uint16_t>(data, position);
+  packet.type = ReadValue<uint16_t>(data, position);
+  packet.schema_id = ReadValue<uint32_t>(data, position);
+  packet.sequence_number = ReadValue<uint32_t>(data, position);
+  if (packet.type == TelemetryPublisher::kSchemaPacket) {
+    packet.number_of_columns = ReadValue<uint32_t>(data, position);
+    const uint32_t length = ReadValue<uint32_t>(data, position);
+    packet.schema_text = std::string(data.begin() + position, data.begin() + position + length);
+    position += length;
+  } else {
+    packet.elapsed_time_s = ReadValue<double>(data, position);
+    const uint32_t number_of_values = ReadValue<uint32_t>(data, position);
+    for (uint32_t i = 0; i < number_of_values; i++) packet.values.push_back(ReadValue<double>(data, position));
+  }
+  EXPECT_EQ(data.size(), position);
+  return packet;
+}
+
+/**
+ * @class UdpReceiver
+ * @brief Non-blocking UDP socket of the viewer bound to a free port of the loopback address
+ */
+class UdpReceiver {
+ public:
+  UdpReceiver() {
+    socket_descriptor_ = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = 0;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(socket_descriptor_, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+    socklen_t length = sizeof(address);
+    getsockname(socket_descriptor_, reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+    fcntl(socket_descriptor_, F_SETFL, fcntl(socket_descriptor_, F_GETFL, 0) | O_NONBLOCK);
+  }
+  ~UdpReceiver() { Close(); }
+  void Close() {
+    if (socket_descriptor_ >= 0) close(socket_descriptor_);
+    socket_descriptor_ = -1;
+  }
+  /**
+   * @fn ReceivePackets
+   * @brief Return the decoded packets received since the last call
+   */
+  std::vector<Packet> ReceivePackets() {
+    std::vector<Packet> packets;
+    std::vector<unsigned char> buffer(TelemetryPublisher::kMaxPacketSize);
+    ssize_t size;
+    while ((size = recv(socket_descriptor_, buffer.data(), buffer.size(), 0)) > 0) {
+      packets.push_back(DecodePacket(std::vector<unsigned char>(buffer.begin(), buffer.begin() + size)));
+    }
+    return packets;
+  }
+
+  unsigned short port_ = 0;     //!< Bound port number
+  int socket_descriptor_ = -1;  //!< UDP socket
+};
+
+/**
+ * @fn ReadSharedMemorySlot
+ * @brief Read the packet in the slot of the shared memory with the retry of the sequence lock
+ * @param [in] memory: Mapped shared memory
+ * @param [in] slot: Slot (0: schema, 1: data)
+ */
+Packet ReadSharedMemorySlot(const unsigned char* memory, const size_t slot) {
+  const unsigned char* slot_head = memory + slot * TelemetryPublisher::kSharedMemorySlotSize;
+  uint32_t counter_before, counter_after, size;
+  std::vector<unsigned char> data;
+  do {
+    std::memcpy(&counter_before, slot_head, sizeof(uint32_t));
+    std::memcpy(&size, slot_head + sizeof(uint32_t), sizeof(uint32_t));
+    data.assign(slot_head + 2 * sizeof(uint32_t), slot_head + 2 * sizeof(uint32_t) + size);
+    std::memcpy(&counter_after, slot_head, sizeof(uint32_t));
+  } while (counter_before % 2 != 0 || counter_before != counter_after);
+  return DecodePacket(data);
+}
+}  // namespace
+
+/**
+ * @brief Test for the invalid settings
+ */
+TEST(TelemetryPublisher, OpenError) {
+  TelemetryPublisherConfig config;
+  config.period_s = 0.0;
+  TelemetryPublisher zero_period_publisher(config);
+  EXPECT_FALSE(zero_period_publisher.Open());
+  EXPECT_FALSE(zero_period_publisher.IsOpened());
+
+  config.period_s = 0.1;
+  config.remote_address = "localhost";
+  TelemetryPublisher invalid_address_publisher(config);
+  EXPECT_FALSE(invalid_address_publisher.Open());
+
+  // The publisher which is not opened ignores the publication
+  TestLoggable loggable;
+  invalid_address_publisher.Publish({&loggable}, 0.0);
+  EXPECT_EQ(0u, invalid_address_publisher.GetNumberOfPublishedPackets());
+}
+
+/**
+ * @brief Test for the schema and the data packets of the selected channels through UDP
+ */
+TEST(TelemetryPublisher, UdpSchemaAndData) {
+  UdpReceiver receiver;
+  TelemetryPublisherConfig config;
+  config.remote_port = receiver.port_;
+  config.period_s = 0.25;
+  config.channels = {"rate_", "date", "counter"};
+  TelemetryPublisher publisher(config);
+  ASSERT_TRUE(publisher.Open());
+
+  TestLoggable loggable;
+  TestSinkLoggable sink_loggable;
+  TestLoggable disabled_loggable;
+  disabled_loggable.is_log_enabled_ = false;
+  const std::vector<ILoggable*> log_list = {&loggable, &disabled_loggable, &sink_loggable};
+  publisher.Publish(log_list, 0.0);
+  EXPECT_EQ(std::vector<std::string>({"rate_x[rad/s]", "rate_y[rad/s]", "date", "counter[-]"}), publisher.GetColumnNames());
+
+  // The schema is sent before the first data packet
+  std::vector<Packet> packets = receiver.ReceivePackets();
+  ASSERT_EQ(2u, packets.size());
+  EXPECT_EQ((uint16_t)TelemetryPublisher::kVersion, packets[0].version);
+  EXPECT_EQ((uint16_t)TelemetryPublisher::kSchemaPacket, packets[0].type);
+  EXPECT_EQ(1u, packets[0].schema_id);
+  EXPECT_EQ(4u, packets[0].number_of_columns);
+  EXPECT_EQ("rate_x[rad/s],rate_y[rad/s],date,counter[-],", packets[0].schema_text);
+  EXPECT_EQ((uint16_t)TelemetryPublisher::kDataPacket, packets[1].type);
+  EXPECT_EQ(1u, packets[1].schema_id);
+  EXPECT_EQ(0u, packets[1].sequence_number);
+  EXPECT_DOUBLE_EQ(0.0, packets[1].elapsed_time_s);
+  ASSERT_EQ(4u, packets[1].values.size());
+  EXPECT_DOUBLE_EQ(1.5, packets[1].values[0]);
+  EXPECT_DOUBLE_EQ(-2.5, packets[1].values[1]);
+  // The text value is sent as NaN
+  EXPECT_TRUE(std::isnan(packets[1].values[2]));
+  EXPECT_DOUBLE_EQ(42.0, packets[1].values[3]);
+
+  // The publication waits for the period
+  publisher.Publish(log_list, 0.125);
+  EXPECT_TRUE(receiver.ReceivePackets().empty());
+  publisher.Publish(log_list, 0.25);
+  packets = receiver.ReceivePackets();
+  ASSERT_EQ(1u, packets.size());
+  EXPECT_EQ(1u, packets[0].sequence_number);
+  EXPECT_DOUBLE_EQ(0.25, packets[0].elapsed_time_s);
+
+  // The schema is sent again when the header changes
+  loggable.header_ = "rate_x[rad/s],rate_z[rad/s],date,position_x[m],";
+  publisher.Publish(log_list, 0.5);
+  packets = receiver.ReceivePackets();
+  ASSERT_EQ(2u, packets.size());
+  EXPECT_EQ((uint16_t)TelemetryPublisher::kSchemaPacket, packets[0].type);
+  EXPECT_EQ(2u, packets[0].schema_id);
+  EXPECT_EQ("rate_x[rad/s],rate_z[rad/s],date,counter[-],", packets[0].schema_text);
+  EXPECT_EQ(2u, packets[1].schema_id);
+
+  // The schema is resent periodically for the viewers which start later
+  size_t number_of_schema_packets = 0;
+  for (uint32_t step = 3; step < 3 + TelemetryPublisher::kSchemaInterval; step++) {
+    publisher.Publish(log_list, step * config.period_s);
+    for (const auto& packet : receiver.ReceivePackets()) {
+      if (packet.type == TelemetryPublisher::kSchemaPacket) number_of_schema_packets++;
+    }
+  }
+  EXPECT_EQ(1u, number_of_schema_packets);
+  EXPECT_EQ(3u + TelemetryPublisher::kSchemaInterval, publisher.GetNumberOfPublishedPackets());
+  EXPECT_EQ(0u, publisher.GetNumberOfDroppedPackets());
+}
+
+/**
+ * @brief Test for the publication without the viewer
+ */
+TEST(TelemetryPublisher, UdpWithoutViewer) {
+  UdpReceiver receiver;
+  TelemetryPublisherConfig config;
+  config.remote_port = receiver.port_;
+  receiver.Close();
+  TelemetryPublisher publisher(config);
+  ASSERT_TRUE(publisher.Open());
+
+  // The packets are dropped without blocking the simulation
+  TestLoggable loggable;
+  for (size_t step = 0; step < 10; step++) publisher.Publish({&loggable}, step * config.period_s);
+  EXPECT_EQ(10u, publisher.GetNumberOfPublishedPackets());
+  EXPECT_GT(publisher.GetNumberOfDroppedPackets(), 0u);
+
+  publisher.Close();
+  EXPECT_FALSE(publisher.IsOpened());
+}
+
+/**
+ * @brief Test for the latest packets in the shared memory and the removal at the close
+ */
+TEST(TelemetryPublisher, SharedMemory) {
+  TelemetryPublisherConfig config;
+  config.transport = TelemetryTransport::kSharedMemory;
+  config.shared_memory_name = "/s2e_test_telemetry_" + std::to_string(getpid());
+  config.period_s = 1.0;
+  config.channels = {"position"};
+  TelemetryPublisher publisher(config);
+  ASSERT_TRUE(publisher.Open());
+
+  const int descriptor = shm_open(config.shared_memory_name.c_str(), O_RDONLY, 0);
+  ASSERT_GE(descriptor, 0);
+  const size_t size = 2 * TelemetryPublisher::kSharedMemorySlotSize;
+  void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+  ASSERT_NE(MAP_FAILED, memory);
+  const unsigned char* shared_memory = static_cast<const unsigned char*>(memory);
+
+  TestLoggable loggable;
+  for (size_t step = 0; step < 3; step++) {
+    loggable.position_m_ = 10.0 * step;
+    publisher.Publish({&loggable}, (double)step);
+  }
+  const Packet schema_packet = ReadSharedMemorySlot(shared_memory, 0);
+  EXPECT_EQ((uint16_t)TelemetryPublisher::kSchemaPacket, schema_packet.type);
+  EXPECT_EQ("position_x[m],", schema_packet.schema_text);
+  // Only the latest data packet is kept
+  const Packet data_packet = ReadSharedMemorySlot(shared_memory, 1);
+  EXPECT_EQ((uint16_t)TelemetryPublisher::kDataPacket, data_packet.type);
+  EXPECT_EQ(2u, data_packet.sequence_number);
+  EXPECT_DOUBLE_EQ(2.0, data_packet.elapsed_time_s);
+  ASSERT_EQ(1u, data_packet.values.size());
+  EXPECT_DOUBLE_EQ(20.0, data_packet.values[0]);
+  // The counters are even after the writing
+  uint32_t counter;
+  std::memcpy(&counter, shared_memory + TelemetryPublisher::kSharedMemorySlotSize, sizeof(counter));
+  EXPECT_EQ(6u, counter);
+
+  munmap(memory, size);
+  publisher.Close();
+  EXPECT_LT(shm_open(config.shared_memory_name.c_str(), O_RDONLY, 0), 0);
+}
+#endif  // WIN32
@@ -0,0 +1,183 @@
+/**
+ * @file albedo_kernel_table.cpp
+ * @brief Table of the irradiance kernels of the reflected and emitted radiation of a spherical body on a flat plate
+ */
+
+#include "albedo_kernel_table.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <math_physics/math/constants.hpp>
+
+namespace libra {
+
+namespace {
+/**
+ * @struct CapCell
+ * @brief Surface element of the visible cap seen from the spacecraft
+ */
+struct CapCell {
+  double direction[3];     //!< Unit vector from the spacecraft to the element in the local frame (Z: zenith, X: sun side)
+  double albedo_weight;    //!< Radiance of the reflected sunlight per solar flux and reflectivity x solid angle
+  double infrared_weight;  //!< Radiance of the emitted radiation per exitance x solid angle
+};
+
+/**
+ * @fn MakeCapCells
+ * @brief Divide the visible cap into the elements with the midpoint rule
+ * @param [in] radius_ratio: Body radius / distance from the body center
+ * @param [in] sun_zenith_angle_rad: Sun zenith angle at the sub-spacecraft point [rad]
+ * @param [in] number_of_cap_divisions: Number of divisions of the central angle. The azimuth is divided into four times of it.
+ * @param [out] cells: Surface elements
+ */
+void MakeCapCells(const double radius_ratio, const double sun_zenith_angle_rad, const size_t number_of_cap_divisions, std::vector<CapCell>& cells) {
+  // The lengths are normalized by the body radius
+  const double distance = 1.0 / radius_ratio;
+  const double max_central_angle_rad = acos(radius_ratio);
+  const size_t number_of_azimuth_divisions = 4 * number_of_cap_divisions;
+  const double central_angle_step_rad = max_central_angle_rad / (double)number_of_cap_divisions;
+  const double azimuth_step_rad = tau / (double)number_of_azimuth_divisions;
+  const double sun_direction[3] = {sin(sun_zenith_angle_rad), 0.0, cos(sun_zenith_angle_rad)};
+
+  cells.resize(number_of_cap_divisions * number_of_azimuth_divisions);
+  size_t cell_index = 0;
+  for (size_t i = 0; i < number_of_cap_divisions; i++) {
+    const double central_angle_rad = central_angle_step_rad * ((double)i + 0.5);
+    const double sin_central = sin(central_angle_rad);
+    const double cos_central = cos(central_angle_rad);
+    const double area = sin_central * central_angle_step_rad * azimuth_step_rad;
+    const double squared_range = 1.0 + distance * distance - 2.0 * distance * cos_central;
+    const double range = sqrt(squared_range);
+    const double cos_emission = (distance * cos_central - 1.0) / range;
+    const double solid_angle_sr = std::max(cos_emission, 0.0) * area / squared_range;
+    for (size_t j = 0; j < number_of_azimuth_divisions; j++) {
+      const double azimuth_rad = azimuth_step_rad * ((double)j + 0.5);
+      const double surface_normal[3] = {sin_central * cos(azimuth_rad), sin_central * sin(azimuth_rad), cos_central};
+      const double cos_incidence = surface_normal[0] * sun_direction[0] + surface_normal[2] * sun_direction[2];
+
+      CapCell& cell = cells[cell_index++];
+      cell.direction[0] = surface_normal[0] / range;
+      cell.direction[1] = surface_normal[1] / range;
+      cell.direction[2] = (surface_normal[2] - distance) / range;
+      cell.albedo_weight = std::max(cos_incidence, 0.0) / pi * solid_angle_sr;
+      cell.infrared_weight = solid_angle_sr / pi;
+    }
+  }
+}
+
+/**
+ * @fn CalcPlateNormal
+ * @brief Calculate the plate normal in the local frame (Z: zenith, X: sun side)
+ */
+inline void CalcPlateNormal(const double normal_nadir_angle_rad, const double normal_azimuth_rad, double normal[3]) {
+  normal[0] = sin(normal_nadir_angle_rad) * cos(normal_azimuth_rad);
+  normal[1] = sin(normal_nadir_angle_rad) * sin(normal_azimuth_rad);
+  normal[2] = -cos(normal_nadir_angle_rad);
+}
+}  // namespace
+
+AlbedoKernelTable::AlbedoKernelTable(const Settings& settings) {
+  const double max_radius_ratio = std::clamp(settings.max_radius_ratio, 1.0e-3, 1.0 - 1.0e-6);
+  min_radius_ratio_ = std::clamp(settings.min_radius_ratio, 1.0e-3, max_radius_ratio);
+  number_of_radius_ratios_ = std::max(settings.number_of_radius_ratios, (size_t)2);
+  radius_ratio_step_ = (max_radius_ratio - min_radius_ratio_) / (double)(number_of_radius_ratios_ - 1);
+  const size_t angle_division = std::max((size_t)ceil(pi / settings.angle_step_rad - 1.0e-9), (size_t)1);
+  number_of_angles_ = angle_division + 1;
+  angle_step_rad_ = pi / (double)angle_division;
+  const size_t number_of_cap_divisions = std::max(settings.number_of_cap_divisions, (size_t)1);
+
+  albedo_kernel_.assign(number_of_radius_ratios_ * number_of_angles_ * number_of_angles_ * number_of_angles_, 0.0);
+  infrared_kernel_.assign(number_of_radius_ratios_ * number_of_angles_, 0.0);
+  std::vector<CapCell> cells;
+  for (size_t i = 0; i < number_of_radius_ratios_; i++) {
+    const double radius_ratio = min_radius_ratio_ + radius_ratio_step_ * (double)i;
+    for (size_t j = 0; j < number_of_angles_; j++) {
+      // The direction and the solid angle of the elements are shared by all plate normals
+      MakeCapCells(radius_ratio, angle_step_rad_ * (double)j, number_of_cap_divisions, cells);
+      for (size_t k = 0; k < number_of_angles_; k++) {
+        for (size_t l = 0; l < number_of_angles_; l++) {
+          double normal[3];
+          CalcPlateNormal(angle_step_rad_ * (double)k, angle_step_rad_ * (double)l, normal);
+          double albedo_kernel = 0.0;
+          double infrared_kernel = 0.0;
+          for (const auto& cell : cells) {
+            const double cos_plate = normal[0] * cell.direction[0] + normal[1] * cell.direction[1] + normal[2] * cell.direction[2];
+            if (cos_plate <= 0.0) continue;
+            albedo_kernel += cos_plate * cell.albedo_weight;
+            infrared_kernel += cos_plate * cell.infrared_weight;
+          }
+          albedo_kernel_[((i * number_of_angles_ + j) * number_of_angles_ + k) * number_of_angles_ + l] = albedo_kernel;
+          // The infrared kernel does not depend on the sun and the azimuth
+          if (j == 0 && l == 0) infrared_kernel_[i * number_of_angles_ + k] = infrared_kernel;
+        }
+      }
+    }
+  }
+}
+
+void AlbedoKernelTable::IntegrateKernels(const double radius_ratio, const double sun_zenith_angle_rad, const double normal_nadir_angle_rad,
+                                         const double normal_azimuth_rad, const size_t number_of_cap_divisions, double& albedo_kernel,
+                                         double& infrared_kernel) {
+  std::vector<CapCell> cells;
+  MakeCapCells(radius_ratio, sun_zenith_angle_rad, std::max(number_of_cap_divisions, (size_t)1), cells);
+  double normal[3];
+  CalcPlateNormal(normal_nadir_angle_rad, normal_azimuth_rad, normal);
+  albedo_kernel = 0.0;
+  infrared_kernel = 0.0;
+  for (const auto& cell : cells) {
+    const double cos_plate = normal[0] * cell.direction[0] + normal[1] * cell.direction[1] + normal[2] * cell.direction[2];
+    if (cos_plate <= 0.0) continue;
+    albedo_kernel += cos_plate * cell.albedo_weight;
+    infrared_kernel += cos_plate * cell.infrared_weight;
+  }
+}
+
+double AlbedoKernelTable::CalcAlbedoKernel(const double radius_ratio, const double sun_zenith_angle_rad, const double normal_nadir_angle_rad,
+                                           const double normal_azimuth_rad) const {
+  double wr, ws, wn, wa;
+  const size_t i0 = CalcRadiusPosition(radius_ratio, wr);
+  const size_t j0 = CalcAnglePosition(sun_zenith_angle_rad, ws);
+  const size_t k0 = CalcAnglePosition(normal_nadir_angle_rad, wn);
+  // The kernel is symmetric about the sun plane
+  const size_t l0 = CalcAnglePosition(fabs(remainder(normal_azimuth_rad, tau)), wa);
+
+  double kernel = 0.0;
+  for (size_t i = 0; i < 2; i++) {
+    const double weight_i = i == 0 ? 1.0 - wr : wr;
+    for (size_t j = 0; j < 2; j++) {
+      const double weight_ij = weight_i * (j == 0 ? 1.0 - ws : ws);
+      for (size_t k = 0; k < 2; k++) {
+        const double weight_ijk = weight_ij * (k == 0 ? 1.0 - wn : wn);
+        const size_t offset = (((i0 + i) * number_of_angles_ + j0 + j) * number_of_angles_ + k0 + k) * number_of_angles_ + l0;
+        kernel += weight_ijk * ((1.0 - wa) * albedo_kernel_[offset] + wa * albedo_kernel_[offset + 1]);
+      }
+    }
+  }
+  return kernel;
+}
+
+double AlbedoKernelTable::CalcInfraredKernel(const double radius_ratio, const double normal_nadir_angle_rad) const {
+  double wr, wn;
+  const size_t i0 = CalcRadiusPosition(radius_ratio, wr);
+  const size_t k0 = CalcAnglePosition(normal_nadir_angle_rad, wn);
+  const double* kernel0 = &infrared_kernel_[i0 * number_of_angles_ + k0];
+  const double* kernel1 = kernel0 + number_of_angles_;
+  return (1.0 - wr) * ((1.0 - wn) * kernel0[0] + wn * kernel0[1]) + wr * ((1.0 - wn) * kernel1[0] + wn * kernel1[1]);
+}
+
+size_t AlbedoKernelTable::CalcRadiusPosition(const double radius_ratio, double& weight) const {
+  const double position = std::clamp((radius_ratio - min_radius_ratio_) / radius_ratio_step_, 0.0, (double)(number_of_radius_ratios_ - 1));
+  const size_t index = std::min((size_t)position, number_of_radius_ratios_ - 2);
+  weight = position - (double)index;
+  return index;
+}
+
+size_t AlbedoKernelTable::CalcAnglePosition(const double angle_rad, double& weight) const {
+  const double position = std::clamp(angle_rad / angle_step_rad_, 0.0, (double)(number_of_angles_ - 1));
+  const size_t index = std::min((size_t)position, number_of_angles_ - 2);
+  weight = position - (double)index;
+  return index;
+}
+
+}  // namespace libra
@@ -0,0 +1,113 @@
+/**
+ * @file albedo_kernel_table.hpp
+ * @brief Table of the irradiance kernels of the reflected and emitted radiation of a spherical body on a flat plate
+ */
+
+#ifndef S2E_LIBRARY_ALBEDO_ALBEDO_KERNEL_TABLE_HPP_
+#define S2E_LIBRARY_ALBEDO_ALBEDO_KERNEL_TABLE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class AlbedoKernelTable
+ * @brief Table of the irradiance kernels of the reflected and emitted radiation of a spherical body on a flat plate
+ * @details The kernels are the integrals over the visible cap of the body with uniform Lambertian surface properties:
+ *          - Albedo kernel: Irradiance on the plate by the reflected sunlight normalized by the solar flux and the reflectivity
+ *          - Infrared kernel: Irradiance on the plate by the emitted radiation normalized by the exitance (the view factor to the body)
+ *          The albedo kernel depends on the radius ratio (body radius / distance from the body center), the sun zenith angle at the
+ *          sub-spacecraft point, the angle between the plate normal and the nadir direction, and the azimuth of the normal from the sun
+ *          plane. The infrared kernel depends on the radius ratio and the nadir angle of the normal. The kernels are integrated once in
+ *          the constructor and interpolated multilinearly, so the irradiance of a plate costs a table lookup instead of the cap
+ *          integration. The instance is not modified after the construction, so it can be shared between spacecraft and threads.
+ */
+class AlbedoKernelTable {
+ public:
+  /**
+   * @struct Settings
+   * @brief Table settings
+   */
+  struct Settings {
+    double min_radius_ratio = 0.137;      //!< Minimum radius ratio (body radius / distance from the body center) of the table
+    double max_radius_ratio = 0.97;       //!< Maximum radius ratio of the table
+    size_t number_of_radius_ratios = 24;  //!< Number of the radius ratios
+    double angle_step_rad = 0.174533;     //!< Step of the sun zenith angle, the nadir angle, and the azimuth of the normal [rad]
+    size_t number_of_cap_divisions = 24;  //!< Number of divisions of the central angle in the cap integration
+  };
+
+  /**
+   * @fn AlbedoKernelTable
+   * @brief Constructor. The kernels are integrated at all table points.
+   * @param [in] settings: Table settings. The angle step is adjusted to divide the range [0, pi] equally.
+   */
+  AlbedoKernelTable(const Settings& settings);
+
+  /**
+   * @fn CalcAlbedoKernel
+   * @brief Interpolate the albedo kernel
+   * @param [in] radius_ratio: Body radius / distance from the body center. It is clamped to the table range.
+   * @param [in] sun_zenith_angle_rad: Angle between the zenith and the sun direction at the sub-spacecraft point [rad]
+   * @param [in] normal_nadir_angle_rad: Angle between the plate normal and the nadir direction [rad]
+   * @param [in] normal_azimuth_rad: Azimuth of the plate normal around the nadir measured from the sun side of the sun plane [rad]
+   * @return Irradiance / (solar flux x reflectivity)
+   */
+  double CalcAlbedoKernel(const double radius_ratio, const double sun_zenith_angle_rad, const double normal_nadir_angle_rad,
+                          const double normal_azimuth_rad) const;
+  /**
+   * @fn CalcInfraredKernel
+   * @brief Interpolate the infrared kernel
+   * @param [in] radius_ratio: Body radius / distance from the body center. It is clamped to the table range.
+   * @param [in] normal_nadir_angle_rad: Angle between the plate normal and the nadir direction [rad]
+   * @return Irradiance / exitance of the body surface
+   */
+  double CalcInfraredKernel(const double radius_ratio, const double normal_nadir_angle_rad) const;
+
+  /**
+   * @fn IntegrateKernels
+   * @brief Integrate the kernels over the visible cap directly
+   * @param [in] radius_ratio: Body radius / distance from the body center
+   * @param [in] sun_zenith_angle_rad: Sun zenith angle at the sub-spacecraft point [rad]
+   * @param [in] normal_nadir_angle_rad: Nadir angle of the plate normal [rad]
+   * @param [in] normal_azimuth_rad: Azimuth of the plate normal from the sun plane [rad]
+   * @param [in] number_of_cap_divisions: Number of divisions of the central angle
+   * @param [out] albedo_kernel: Albedo kernel
+   * @param [out] infrared_kernel: Infrared kernel
+   */
+  static void IntegrateKernels(const double radius_ratio, const double sun_zenith_angle_rad, const double normal_nadir_angle_rad,
+                               const double normal_azimuth_rad, const size_t number_of_cap_divisions, double& albedo_kernel,
+                               double& infrared_kernel);
+
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the table including the kernels [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    return sizeof(*this) + (albedo_kernel_.capacity() + infrared_kernel_.capacity()) * sizeof(double);
+  }
+
+ private:
+  double min_radius_ratio_;              //!< Minimum radius ratio of the table
+  double radius_ratio_step_;             //!< Step of the radius ratio
+  double angle_step_rad_;                //!< Step of the angles [rad]
+  size_t number_of_radius_ratios_;       //!< Number of the radius ratios
+  size_t number_of_angles_;              //!< Number of the angles in [0, pi] including both ends
+  std::vector<double> albedo_kernel_;    //!< Albedo kernel ordered by radius ratio, sun zenith angle, nadir angle, and azimuth
+  std::vector<double> infrared_kernel_;  //!< Infrared kernel ordered by radius ratio and nadir angle
+
+  /**
+   * @fn CalcRadiusPosition
+   * @brief Return the first index and the weight of the second index of the radius ratio interpolation
+   */
+  size_t CalcRadiusPosition(const double radius_ratio, double& weight) const;
+  /**
+   * @fn CalcAnglePosition
+   * @brief Return the first index and the weight of the second index of the angle interpolation in [0, pi]
+   */
+  size_t CalcAnglePosition(const double angle_rad, double& weight) const;
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_ALBEDO_ALBEDO_KERNEL_TABLE_HPP_
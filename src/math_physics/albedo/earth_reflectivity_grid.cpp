@@ -0,0 +1,72 @@
+/**
+ * @file earth_reflectivity_grid.cpp
+ * @brief Class to interpolate the reflectivity and the emissivity of the earth surface on a latitude and season grid
+ */
+
+#include "earth_reflectivity_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <math_physics/math/constants.hpp>
+
+namespace libra {
+
+EarthReflectivityGrid::EarthReflectivityGrid(const Settings& settings,
+                                             const std::function<void(const double, const double, double&, double&)>& calc_properties) {
+  const size_t latitude_division = std::max((size_t)ceil(pi / settings.latitude_step_rad - 1.0e-9), (size_t)1);
+  number_of_latitudes_ = latitude_division + 1;
+  number_of_seasons_ = std::max((size_t)ceil(tau / settings.season_step_rad - 1.0e-9), (size_t)1);
+  latitude_step_rad_ = pi / (double)latitude_division;
+  season_step_rad_ = tau / (double)number_of_seasons_;
+
+  properties_.resize(number_of_latitudes_ * number_of_seasons_ * 2);
+  for (size_t i = 0; i < number_of_latitudes_; i++) {
+    const double latitude_rad = -pi_2 + latitude_step_rad_ * (double)i;
+    for (size_t j = 0; j < number_of_seasons_; j++) {
+      double* properties = &properties_[(i * number_of_seasons_ + j) * 2];
+      calc_properties(latitude_rad, season_step_rad_ * (double)j, properties[0], properties[1]);
+    }
+  }
+}
+
+void EarthReflectivityGrid::CalcProperties(const double latitude_rad, const double season_angle_rad, double& reflectivity,
+                                           double& emissivity) const {
+  // Latitude
+  const double latitude_position = std::clamp((latitude_rad + pi_2) / latitude_step_rad_, 0.0, (double)(number_of_latitudes_ - 1));
+  size_t i0 = (size_t)latitude_position;
+  if (i0 == number_of_latitudes_ - 1) i0--;
+  const double wa = latitude_position - (double)i0;
+
+  // Season angle (periodic)
+  double season_position = fmod(season_angle_rad, tau) / season_step_rad_;
+  if (season_position < 0.0) season_position += (double)number_of_seasons_;
+  size_t j0 = (size_t)season_position;
+  if (j0 >= number_of_seasons_) j0 = 0;
+  const size_t j1 = (j0 + 1) % number_of_seasons_;
+  const double wb = std::clamp(season_position - floor(season_position), 0.0, 1.0);
+
+  const double* p00 = &properties_[(i0 * number_of_seasons_ + j0) * 2];
+  const double* p01 = &properties_[(i0 * number_of_seasons_ + j1) * 2];
+  const double* p10 = &properties_[((i0 + 1) * number_of_seasons_ + j0) * 2];
+  const double* p11 = &properties_[((i0 + 1) * number_of_seasons_ + j1) * 2];
+  double interpolated[2];
+  for (size_t c = 0; c < 2; c++) {
+    const double p0 = p00[c] + (p01[c] - p00[c]) * wb;
+    const double p1 = p10[c] + (p11[c] - p10[c]) * wb;
+    interpolated[c] = p0 + (p1 - p0) * wa;
+  }
+  reflectivity = interpolated[0];
+  emissivity = interpolated[1];
+}
+
+void CalcKnockeEarthRadiationProperties(const double latitude_rad, const double season_angle_rad, double& reflectivity, double& emissivity) {
+  // Legendre polynomials of the sine of the latitude
+  const double p1 = sin(latitude_rad);
+  const double p2 = 0.5 * (3.0 * p1 * p1 - 1.0);
+  const double cos_season = cos(season_angle_rad);
+  reflectivity = 0.34 + 0.10 * cos_season * p1 + 0.29 * p2;
+  emissivity = 0.68 - 0.07 * cos_season * p1 - 0.18 * p2;
+}
+
+}  // namespace libra
@@ -0,0 +1,78 @@
+/**
+ * @file earth_reflectivity_grid.hpp
+ * @brief Class to interpolate the reflectivity and the emissivity of the earth surface on a latitude and season grid
+ */
+
+#ifndef S2E_LIBRARY_ALBEDO_EARTH_REFLECTIVITY_GRID_HPP_
+#define S2E_LIBRARY_ALBEDO_EARTH_REFLECTIVITY_GRID_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class EarthReflectivityGrid
+ * @brief Class to interpolate the reflectivity and the emissivity of the earth surface on a grid of latitude and season angle
+ * @details The properties are evaluated at all grid points in the constructor and interpolated bilinearly. The season angle is measured
+ *          from the northern winter solstice and is periodic. The instance is not modified after the construction, so it can be shared
+ *          between spacecraft and threads.
+ */
+class EarthReflectivityGrid {
+ public:
+  /**
+   * @struct Settings
+   * @brief Grid settings
+   */
+  struct Settings {
+    double latitude_step_rad = 0.0872665;  //!< Latitude step of the grid [rad]
+    double season_step_rad = 0.172142;     //!< Season angle step of the grid [rad]
+  };
+
+  /**
+   * @fn EarthReflectivityGrid
+   * @brief Constructor
+   * @param [in] settings: Grid settings. The steps are adjusted to divide the ranges equally.
+   * @param [in] calc_properties: Function to calculate the properties: (latitude_rad, season_angle_rad, reflectivity, emissivity)
+   */
+  EarthReflectivityGrid(const Settings& settings, const std::function<void(const double, const double, double&, double&)>& calc_properties);
+
+  /**
+   * @fn CalcProperties
+   * @brief Interpolate the reflectivity and the emissivity
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] season_angle_rad: Season angle from the northern winter solstice [rad]
+   * @param [out] reflectivity: Reflectivity of the sunlight
+   * @param [out] emissivity: Emissivity normalized by the mean solar flux on the earth (1/4 of the solar flux)
+   */
+  void CalcProperties(const double latitude_rad, const double season_angle_rad, double& reflectivity, double& emissivity) const;
+
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the grid including the properties [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const { return sizeof(*this) + properties_.capacity() * sizeof(double); }
+
+ private:
+  double latitude_step_rad_;        //!< Latitude step of the grid [rad]
+  double season_step_rad_;          //!< Season angle step of the grid [rad]
+  size_t number_of_latitudes_;      //!< Number of latitudes including both poles
+  size_t number_of_seasons_;        //!< Number of season angles. The last angle is connected to the first one.
+  std::vector<double> properties_;  //!< Reflectivity and emissivity ordered by latitude and season angle
+};
+
+/**
+ * @fn CalcKnockeEarthRadiationProperties
+ * @brief Calculate the zonal reflectivity and emissivity of the earth with the Knocke-Ries model
+ * @note Ref: P. C. Knocke, J. C. Ries, and B. D. Tapley, Earth radiation pressure effects on satellites, AIAA 88-4292, 1988.
+ * @param [in] latitude_rad: Latitude [rad]
+ * @param [in] season_angle_rad: Season angle from the northern winter solstice (December 22) [rad]
+ * @param [out] reflectivity: Reflectivity of the sunlight
+ * @param [out] emissivity: Emissivity normalized by the mean solar flux on the earth
+ */
+void CalcKnockeEarthRadiationProperties(const double latitude_rad, const double season_angle_rad, double& reflectivity, double& emissivity);
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_ALBEDO_EARTH_REFLECTIVITY_GRID_HPP_
@@ -0,0 +1,58 @@
+/**
+ * @file test_albedo_kernel_table.cpp
+ * @brief Test codes for AlbedoKernelTable class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "albedo_kernel_table.hpp"
+
+/**
+ * @brief Test for the infrared kernel with the analytical view factor of a plate facing the nadir
+ */
+TEST(AlbedoKernelTable, InfraredViewFactor) {
+  libra::AlbedoKernelTable::Settings settings;
+  settings.number_of_radius_ratios = 4;
+  settings.min_radius_ratio = 0.3;
+  settings.max_radius_ratio = 0.9;
+  libra::AlbedoKernelTable table(settings);
+
+  for (size_t i = 0; i < 4; i++) {
+    const double radius_ratio = 0.3 + 0.2 * (double)i;
+    // The view factor of a plate facing the nadir is (radius / distance)^2
+    EXPECT_NEAR(radius_ratio * radius_ratio, table.CalcInfraredKernel(radius_ratio, 0.0), 1.0e-2 * radius_ratio * radius_ratio);
+    // A plate facing the zenith does not see the body
+    EXPECT_DOUBLE_EQ(0.0, table.CalcInfraredKernel(radius_ratio, 3.141592653589793));
+  }
+}
+
+/**
+ * @brief Test for the interpolation of the albedo kernel against the direct integration
+ */
+TEST(AlbedoKernelTable, AlbedoInterpolation) {
+  libra::AlbedoKernelTable::Settings settings;
+  settings.number_of_radius_ratios = 8;
+  settings.min_radius_ratio = 0.5;
+  settings.max_radius_ratio = 0.95;
+  libra::AlbedoKernelTable table(settings);
+
+  const double radius_ratio = 0.93;  // About 480 km altitude of the earth
+  double maximum_kernel = 0.0;
+  table.IntegrateKernels(radius_ratio, 0.0, 0.0, 0.0, settings.number_of_cap_divisions, maximum_kernel, maximum_kernel);
+  for (size_t i = 0; i < 20; i++) {
+    const double sun_zenith_angle_rad = 0.16 * (double)i;
+    const double normal_nadir_angle_rad = 0.11 * (double)i + 0.3;
+    const double normal_azimuth_rad = -0.37 * (double)i;
+    double albedo_kernel, infrared_kernel;
+    table.IntegrateKernels(radius_ratio, sun_zenith_angle_rad, normal_nadir_angle_rad, normal_azimuth_rad, settings.number_of_cap_divisions,
+                           albedo_kernel, infrared_kernel);
+    EXPECT_NEAR(albedo_kernel, table.CalcAlbedoKernel(radius_ratio, sun_zenith_angle_rad, normal_nadir_angle_rad, normal_azimuth_rad),
+                3.0e-2 * maximum_kernel);
+    EXPECT_NEAR(infrared_kernel, table.CalcInfraredKernel(radius_ratio, normal_nadir_angle_rad), 3.0e-2 * maximum_kernel);
+    EXPECT_LE(albedo_kernel, infrared_kernel);
+  }
+
+  // No reflection when the sub-spacecraft point is at the midnight
+  EXPECT_DOUBLE_EQ(0.0, table.CalcAlbedoKernel(radius_ratio, 3.141592653589793, 0.0, 0.0));
+}
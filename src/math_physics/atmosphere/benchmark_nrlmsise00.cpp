@@ -0,0 +1,37 @@
+/**
+ * @file benchmark_nrlmsise00.cpp
+ * @brief Benchmark codes for NRLMSISE-00 air density calculation
+ */
+#include <iostream>
+#include <utilities/benchmark_measurement.hpp>
+#include <vector>
+
+#include "wrapper_nrlmsise00.hpp"
+
+int main() {
+  // The manual space weather parameters are used to measure the model itself without the space weather file
+  const nrlmsise_space_weather_table table;
+  const double decyear = 2022.5;
+  const double latitude_rad = 0.6;
+  const double f107 = 150.0;
+  const double f107a = 150.0;
+  const double ap = 3.0;
+  const size_t number_of_calls = 100000;
+
+  std::cout << "altitude [km], density [kg/m3], calculation [ns/call]" << std::endl;
+  const std::vector<double> altitudes_km = {200.0, 400.0, 800.0};
+  for (double altitude_km : altitudes_km) {
+    double longitude_rad = 0.0;
+    double density_kg_m3 = 0.0;
+    const double calculation_ns = MeasureNanosecondsPerCall(
+        [&]() {
+          // Change the longitude to avoid the calculation being skipped by the cache in the model
+          longitude_rad += 1.0e-6;
+          density_kg_m3 = CalcNRLMSISE00(decyear, latitude_rad, longitude_rad, altitude_km * 1000.0, table, true, f107, f107a, ap);
+        },
+        number_of_calls);
+    std::cout << altitude_km << ", " << density_kg_m3 << ", " << calculation_ns << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file density_grid_cache.cpp
+ * @brief Cache of atmospheric density on an altitude-latitude-local solar time grid
+ */
+
+#include "density_grid_cache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../math/constants.hpp"
+
+namespace libra::atmosphere {
+
+DensityGridCache::DensityGridCache(const Settings& settings) : settings_(settings) {
+  settings_.altitude_step_m = std::max(settings_.altitude_step_m, 1.0);
+  settings_.max_altitude_m = std::max(settings_.max_altitude_m, settings_.min_altitude_m + settings_.altitude_step_m);
+  altitude_num_ = (size_t)ceil((settings_.max_altitude_m - settings_.min_altitude_m) / settings_.altitude_step_m) + 1;
+  settings_.max_altitude_m = settings_.min_altitude_m + settings_.altitude_step_m * (double)(altitude_num_ - 1);
+
+  // Adjust the steps to divide the range equally
+  latitude_num_ = std::max((size_t)2, (size_t)round(libra::pi / std::max(settings_.latitude_step_rad, 1.0e-3)) + 1);
+  settings_.latitude_step_rad = libra::pi / (double)(latitude_num_ - 1);
+  local_time_num_ = std::max((size_t)1, (size_t)round(24.0 / std::max(settings_.local_time_step_h, 1.0e-2)));
+  settings_.local_time_step_h = 24.0 / (double)local_time_num_;
+
+  Reset();
+}
+
+void DensityGridCache::Reset() {
+  log_densities_.assign(altitude_num_ * latitude_num_ * local_time_num_, std::numeric_limits<double>::quiet_NaN());
+  cell_states_.assign((altitude_num_ - 1) * (latitude_num_ - 1) * local_time_num_, CellState::kUnknown);
+  number_of_model_evaluations_ = 0;
+  number_of_direct_cells_ = 0;
+}
+
+double DensityGridCache::CalcDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_time_h,
+                                           const std::function<double(double, double, double)>& grid_model,
+                                           const std::function<double()>& query_model) {
+  if (altitude_m < settings_.min_altitude_m || altitude_m > settings_.max_altitude_m) {
+    number_of_model_evaluations_++;
+    return query_model();
+  }
+
+  // Cell and ratio in the cell
+  const double altitude_position = (altitude_m - settings_.min_altitude_m) / settings_.altitude_step_m;
+  const size_t altitude_index = std::min(altitude_num_ - 2, (size_t)altitude_position);
+  const double altitude_ratio = altitude_position - (double)altitude_index;
+
+  const double latitude_position = (std::max(-libra::pi_2, std::min(libra::pi_2, latitude_rad)) + libra::pi_2) / settings_.latitude_step_rad;
+  const size_t latitude_index = std::min(latitude_num_ - 2, (size_t)latitude_position);
+  const double latitude_ratio = std::max(0.0, std::min(1.0, latitude_position - (double)latitude_index));
+
+  double wrapped_local_time_h = fmod(local_time_h, 24.0);
+  if (wrapped_local_time_h < 0.0) wrapped_local_time_h += 24.0;
+  const double local_time_position = wrapped_local_time_h / settings_.local_time_step_h;
+  const size_t local_time_index = std::min(local_time_num_ - 1, (size_t)local_time_position);
+  const size_t local_time_upper_index = (local_time_index + 1) % local_time_num_;
+  const double local_time_ratio = std::max(0.0, std::min(1.0, local_time_position - (double)local_time_index));
+
+  const size_t cell_index = (altitude_index * (latitude_num_ - 1) + latitude_index) * local_time_num_ + local_time_index;
+  CellState& cell_state = cell_states_[cell_index];
+  if (cell_state == CellState::kDirect) {
+    number_of_model_evaluations_++;
+    return query_model();
+  }
+
+  // Trilinear interpolation of the logarithm
+  double log_density = 0.0;
+  for (size_t i = 0; i < 2; i++) {
+    const double weight_altitude = (i == 0) ? 1.0 - altitude_ratio : altitude_ratio;
+    for (size_t j = 0; j < 2; j++) {
+      const double weight_latitude = (j == 0) ? 1.0 - latitude_ratio : latitude_ratio;
+      for (size_t k = 0; k < 2; k++) {
+        const double weight_local_time = (k == 0) ? 1.0 - local_time_ratio : local_time_ratio;
+        const size_t local_time_grid_index = (k == 0) ? local_time_index : local_time_upper_index;
+        const double grid_log_density = GetLogDensity(altitude_index + i, latitude_index + j, local_time_grid_index, grid_model);
+        log_density += weight_altitude * weight_latitude * weight_local_time * grid_log_density;
+      }
+    }
+  }
+  const double density_kg_m3 = exp(log_density);
+
+  if (cell_state == CellState::kUnknown) {
+    number_of_model_evaluations_++;
+    const double true_density_kg_m3 = query_model();
+    if (true_density_kg_m3 > 0.0 && fabs(density_kg_m3 - true_density_kg_m3) <= settings_.max_relative_error * true_density_kg_m3) {
+      cell_state = CellState::kInterpolate;
+    } else {
+      cell_state = CellState::kDirect;
+      number_of_direct_cells_++;
+      return true_density_kg_m3;
+    }
+  }
+  return density_kg_m3;
+}
+
+double DensityGridCache::GetLogDensity(const size_t altitude_index, const size_t latitude_index, const size_t local_time_index,
+                                       const std::function<double(double, double, double)>& grid_model) {
+  double& log_density = log_densities_[(altitude_index * latitude_num_ + latitude_index) * local_time_num_ + local_time_index];
+  if (std::isnan(log_density)) {
+    const double altitude_m = settings_.min_altitude_m + settings_.altitude_step_m * (double)altitude_index;
+    const double latitude_rad = -libra::pi_2 + settings_.latitude_step_rad * (double)latitude_index;
+    const double local_time_h = settings_.local_time_step_h * (double)local_time_index;
+    number_of_model_evaluations_++;
+    // Guard for the logarithm. The tolerance check rejects the cell in this case.
+    log_density = log(std::max(grid_model(altitude_m, latitude_rad, local_time_h), std::numeric_limits<double>::min()));
+  }
+  return log_density;
+}
+
+}  // namespace libra::atmosphere
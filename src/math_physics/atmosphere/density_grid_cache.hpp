@@ -0,0 +1,116 @@
+/**
+ * @file density_grid_cache.hpp
+ * @brief Cache of atmospheric density on an altitude-latitude-local solar time grid
+ */
+#ifndef S2E_LIBRARY_ATMOSPHERE_DENSITY_GRID_CACHE_HPP_
+#define S2E_LIBRARY_ATMOSPHERE_DENSITY_GRID_CACHE_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace libra::atmosphere {
+
+/**
+ * @class DensityGridCache
+ * @brief Cache of atmospheric density on an altitude-latitude-local solar time grid
+ * @details The logarithm of the density is trilinearly interpolated. The grid points are evaluated with the model only when a cell including
+ *          them is used at first. At the first use of each cell, the interpolated value is compared with the model value at the query point,
+ *          and the cell is evaluated by the model directly after that when the relative error exceeds the tolerance. The cache should be reset
+ *          when the inputs other than the grid axes (e.g., day and space weather) are changed.
+ */
+class DensityGridCache {
+ public:
+  /**
+   * @struct Settings
+   * @brief Grid settings
+   */
+  struct Settings {
+    double min_altitude_m = 100.0e3;       //!< Lower limit of the grid altitude [m]
+    double max_altitude_m = 1000.0e3;      //!< Upper limit of the grid altitude [m]
+    double altitude_step_m = 10.0e3;       //!< Altitude step [m]
+    double latitude_step_rad = 0.0872665;  //!< Latitude step [rad]
+    double local_time_step_h = 1.0;        //!< Local solar time step [hour]
+    double max_relative_error = 0.01;      //!< Tolerance of the relative error of the interpolation
+  };
+
+  /**
+   * @fn DensityGridCache
+   * @brief Default constructor with the default settings
+   */
+  DensityGridCache() : DensityGridCache(Settings()) {}
+  /**
+   * @fn DensityGridCache
+   * @brief Constructor
+   * @param [in] settings: Grid settings
+   */
+  explicit DensityGridCache(const Settings& settings);
+
+  /**
+   * @fn CalcDensity_kg_m3
+   * @brief Calculate the density with the cache
+   * @param [in] altitude_m: Altitude [m]
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] local_time_h: Local solar time [hour]
+   * @param [in] grid_model: Density model evaluated at the grid point: (altitude_m, latitude_rad, local_time_h) -> density [kg/m3]
+   * @param [in] query_model: Density model evaluated at the query point. Used out of the grid and for the error check.
+   * @return Density [kg/m3]
+   */
+  double CalcDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_time_h,
+                           const std::function<double(double, double, double)>& grid_model, const std::function<double()>& query_model);
+  /**
+   * @fn Reset
+   * @brief Clear the cached values
+   */
+  void Reset();
+
+  // Getters
+  /**
+   * @fn GetNumberOfModelEvaluations
+   * @return Number of evaluations of the density models since the last reset
+   */
+  inline size_t GetNumberOfModelEvaluations() const { return number_of_model_evaluations_; }
+  /**
+   * @fn GetNumberOfDirectCells
+   * @return Number of cells evaluated by the model directly since the tolerance is not satisfied
+   */
+  inline size_t GetNumberOfDirectCells() const { return number_of_direct_cells_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the cache including the grid values and the cell states [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    return sizeof(*this) + log_densities_.capacity() * sizeof(double) + cell_states_.capacity() * sizeof(CellState);
+  }
+
+ private:
+  /**
+   * @enum CellState
+   * @brief State of a grid cell
+   */
+  enum class CellState : uint8_t {
+    kUnknown,      //!< Not used yet
+    kInterpolate,  //!< The interpolation satisfies the tolerance
+    kDirect,       //!< The model is directly evaluated
+  };
+
+  Settings settings_;                   //!< Grid settings
+  size_t altitude_num_;                 //!< Number of altitude grid points
+  size_t latitude_num_;                 //!< Number of latitude grid points
+  size_t local_time_num_;               //!< Number of local solar time grid points in [0, 24)
+  std::vector<double> log_densities_;   //!< Logarithm of the density at the grid points. NaN when not evaluated.
+  std::vector<CellState> cell_states_;  //!< State of the cells
+  size_t number_of_model_evaluations_;  //!< Number of evaluations of the density models
+  size_t number_of_direct_cells_;       //!< Number of cells evaluated directly
+
+  /**
+   * @fn GetLogDensity
+   * @brief Return the logarithm of the density at the grid point, evaluating the model if required
+   */
+  double GetLogDensity(const size_t altitude_index, const size_t latitude_index, const size_t local_time_index,
+                       const std::function<double(double, double, double)>& grid_model);
+};
+
+}  // namespace libra::atmosphere
+
+#endif  // S2E_LIBRARY_ATMOSPHERE_DENSITY_GRID_CACHE_HPP_
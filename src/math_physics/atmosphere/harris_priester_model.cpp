@@ -4,39 +4,88 @@
  */
 #include "harris_priester_model.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <math_physics/math/constants.hpp>
 #include <utilities/macros.hpp>
+#include <vector>
 
 #include "harris_priester_coefficients.hpp"
 
 namespace libra::atmosphere {
 
+namespace {
 /**
- * @fn CalcScaleHeight_km
- * @brief Calculate scale height
- * @param [in] density_itr: Iterator for density map table
- * @return Scale height [km]
+ * @struct HarrisPriesterTable
+ * @brief Coefficient tables of the Harris-Priester model arranged for the fast search of the altitude interval
+ * @details The altitude range of the table is divided into bins of the same width, and the interval of the table at the bottom of each bin is
+ *          precomputed. The nodes of the table are on the bin boundaries, so the interval is found without the search of the map.
  */
-double CalcScaleHeight_km(const std::map<double, double>::const_iterator density_itr);
+struct HarrisPriesterTable {
+  std::vector<double> height_km;                //!< Height of the nodes [km]
+  std::vector<double> min_density_g_km3;        //!< Minimum (antapex) density at the nodes [g/km3]
+  std::vector<double> max_density_g_km3;        //!< Maximum (apex) density at the nodes [g/km3]
+  std::vector<double> min_inverse_scale_1_km;   //!< Inverse of the scale height of the minimum density in each interval [1/km]
+  std::vector<double> max_inverse_scale_1_km;   //!< Inverse of the scale height of the maximum density in each interval [1/km]
+  std::vector<size_t> bin_to_interval;          //!< Interval index at the bottom of each altitude bin
+  static constexpr double kBinWidth_km = 10.0;  //!< Width of the altitude bins [km]
+
+  /**
+   * @fn HarrisPriesterTable
+   * @brief Constructor. Make the tables from harris_priester_coefficients.hpp.
+   */
+  HarrisPriesterTable() {
+    // The min and max tables have the same heights
+    for (auto min_itr = harris_priester_min_density_table.begin(), max_itr = harris_priester_max_density_table.begin();
+         min_itr != harris_priester_min_density_table.end(); min_itr++, max_itr++) {
+      height_km.push_back(min_itr->first);
+      min_density_g_km3.push_back(min_itr->second);
+      max_density_g_km3.push_back(max_itr->second);
+    }
+    for (size_t i = 0; i + 1 < height_km.size(); i++) {
+      // Inverse of the scale height of CalcScaleHeight_km: (h_1 - h_2) / log(rho_2 / rho_1)
+      min_inverse_scale_1_km.push_back(log(min_density_g_km3[i + 1] / min_density_g_km3[i]) / (height_km[i] - height_km[i + 1]));
+      max_inverse_scale_1_km.push_back(log(max_density_g_km3[i + 1] / max_density_g_km3[i]) / (height_km[i] - height_km[i + 1]));
+    }
+    const size_t number_of_bins = (size_t)ceil((height_km.back() - height_km.front()) / kBinWidth_km);
+    size_t interval = 0;
+    for (size_t bin = 0; bin < number_of_bins; bin++) {
+      const double bin_bottom_km = height_km.front() + bin * kBinWidth_km;
+      while (interval + 2 < height_km.size() && height_km[interval + 1] <= bin_bottom_km) interval++;
+      bin_to_interval.push_back(interval);
+    }
+  }
+
+  /**
+   * @fn FindInterval
+   * @brief Return index of the interval including the altitude. The altitude should be clamped to the lowest height of the table.
+   */
+  inline size_t FindInterval(const double altitude_km) const {
+    const size_t bin = (size_t)((altitude_km - height_km.front()) / kBinWidth_km);
+    if (bin >= bin_to_interval.size()) return height_km.size() - 2;
+    size_t interval = bin_to_interval[bin];
+    // Nodes which are not on the bin boundaries
+    while (interval + 2 < height_km.size() && height_km[interval + 1] <= altitude_km) interval++;
+    return interval;
+  }
+};
+
 /**
- * @fn CalcApexDensity_g_km3
- * @brief Calculate Apex or Antapex density
- * @param [in] density_itr: Iterator for density map table
- * @param [in] altitude_km: Altitude [km]
- * @return Apex or Antapex density
+ * @fn GetHarrisPriesterTable
+ * @brief Return the table made at the first call
  */
-double CalcApexDensity_g_km3(const std::map<double, double>::const_iterator density_itr, const double altitude_km);
-
-double CalcAirDensityWithHarrisPriester_kg_m3(const GeodeticPosition geodetic_position, const libra::Vector<3> sun_direction_eci, const double f10_7,
-                                              const double exponent_parameter) {
-  // Altitude
-  double altitude_km = geodetic_position.GetAltitude_m() / 1000.0;
-
-  // Position
-  libra::Vector<3> position_ecef_m = geodetic_position.CalcEcefPosition();
+const HarrisPriesterTable& GetHarrisPriesterTable() {
+  static const HarrisPriesterTable table;
+  return table;
+}
 
-  // Phi: angle between the satellite position and apex of the diurnal bulge
+/**
+ * @fn CalcApexDirection
+ * @brief Calculate direction of the apex of the diurnal bulge
+ * @param [in] sun_direction_eci: Sun direction unit vector in ECI frame
+ * @return Apex direction unit vector
+ */
+libra::Vector<3> CalcApexDirection(const libra::Vector<3> sun_direction_eci) {
   double sun_ra_rad;   //!< Right ascension of the sun phi
   double sun_dec_rad;  //!< Declination of the sun theta
   sun_ra_rad = atan2(sun_direction_eci[1], sun_direction_eci[0]);
@@ -47,45 +96,57 @@ double CalcAirDensityWithHarrisPriester_kg_m3(const GeodeticPosition geodetic_po
   apex_direction[0] = cos(sun_dec_rad) * cos(apex_ra_rad);
   apex_direction[1] = cos(sun_dec_rad) * sin(apex_ra_rad);
   apex_direction[2] = sin(sun_dec_rad);
-
-  double beta_rad = libra::InnerProduct(position_ecef_m.CalcNormalizedVector(), apex_direction);
-  double cos_phi = pow(0.5 + beta_rad / 2.0, exponent_parameter / 2.0);
-
-  // Find density coefficients from altitude
-  UNUSED(f10_7);  // TODO: Use F10.7 value to search coefficients
-  auto min_density_itr = harris_priester_min_density_table.upper_bound(altitude_km);
-  auto max_density_itr = harris_priester_max_density_table.upper_bound(altitude_km);
-  if (min_density_itr == harris_priester_min_density_table.begin()) return min_density_itr->second;
-  if (min_density_itr == harris_priester_min_density_table.end()) return (min_density_itr->second + max_density_itr->second) / 2.0;
-  min_density_itr = prev(min_density_itr);
-  max_density_itr = prev(max_density_itr);
-
-  // Calculate density
-  double antapex_density_g_km3 = CalcApexDensity_g_km3(min_density_itr, altitude_km);
-  double apex_density_g_km3 = CalcApexDensity_g_km3(max_density_itr, altitude_km);
-
-  double density_g_km3 = antapex_density_g_km3 + (apex_density_g_km3 - antapex_density_g_km3) * cos_phi;
-
-  return density_g_km3 * 1e-12;  // Unit conversion g/km3 -> kg/m^3
+  return apex_direction;
 }
+}  // namespace
 
-double CalcScaleHeight_km(const std::map<double, double>::const_iterator density_itr) {
-  const double height_1_km = density_itr->first;
-  const double density_1_g_km3 = density_itr->second;
-  const double height_2_km = next(density_itr)->first;
-  const double density_2_g_km3 = next(density_itr)->second;
-
-  double scale_height_km = (height_1_km - height_2_km) / log(density_2_g_km3 / density_1_g_km3);
-  return scale_height_km;
+double CalcAirDensityWithHarrisPriester_kg_m3(const GeodeticPosition geodetic_position, const libra::Vector<3> sun_direction_eci, const double f10_7,
+                                              const double exponent_parameter) {
+  double air_density_kg_m3;
+  CalcAirDensityWithHarrisPriester_kg_m3(&geodetic_position, 1, sun_direction_eci, &air_density_kg_m3, f10_7, exponent_parameter);
+  return air_density_kg_m3;
 }
 
-double CalcApexDensity_g_km3(const std::map<double, double>::const_iterator density_itr, const double altitude_km) {
-  const double scale_height_km = CalcScaleHeight_km(density_itr);
-  const double height_km = density_itr->first;
-  const double density_g_km3 = density_itr->second;
+void CalcAirDensityWithHarrisPriester_kg_m3(const GeodeticPosition* geodetic_positions, const size_t number_of_positions,
+                                            const libra::Vector<3> sun_direction_eci, double* air_densities_kg_m3, const double f10_7,
+                                            const double exponent_parameter) {
+  const HarrisPriesterTable& table = GetHarrisPriesterTable();
+  // Phi: angle between the satellite position and apex of the diurnal bulge
+  const libra::Vector<3> apex_direction = CalcApexDirection(sun_direction_eci);
+  UNUSED(f10_7);  // TODO: Use F10.7 value to search coefficients
 
-  double apex_density_g_km3 = density_g_km3 * exp((height_km - altitude_km) / scale_height_km);
-  return apex_density_g_km3;
+  const size_t kChunkSize = 64;
+  double cos_phi[kChunkSize];
+  double min_base_g_km3[kChunkSize], max_base_g_km3[kChunkSize];
+  double min_exponent[kChunkSize], max_exponent[kChunkSize];
+  for (size_t begin = 0; begin < number_of_positions; begin += kChunkSize) {
+    const size_t count = std::min(kChunkSize, number_of_positions - begin);
+
+    // Geometry and table search
+    for (size_t j = 0; j < count; j++) {
+      const GeodeticPosition& geodetic_position = geodetic_positions[begin + j];
+      const double altitude_km = std::max(geodetic_position.GetAltitude_m() / 1000.0, table.height_km.front());
+      libra::Vector<3> position_ecef_m = geodetic_position.CalcEcefPosition();
+      double beta_rad = libra::InnerProduct(position_ecef_m.CalcNormalizedVector(), apex_direction);
+      cos_phi[j] = pow(0.5 + beta_rad / 2.0, exponent_parameter / 2.0);
+
+      const size_t interval = table.FindInterval(altitude_km);
+      const double height_difference_km = table.height_km[interval] - altitude_km;
+      min_base_g_km3[j] = table.min_density_g_km3[interval];
+      max_base_g_km3[j] = table.max_density_g_km3[interval];
+      min_exponent[j] = height_difference_km * table.min_inverse_scale_1_km[interval];
+      max_exponent[j] = height_difference_km * table.max_inverse_scale_1_km[interval];
+    }
+
+    // Exponential interpolation of the antapex and apex densities
+    double* output = air_densities_kg_m3 + begin;
+    for (size_t j = 0; j < count; j++) {
+      const double antapex_density_g_km3 = min_base_g_km3[j] * exp(min_exponent[j]);
+      const double apex_density_g_km3 = max_base_g_km3[j] * exp(max_exponent[j]);
+      const double density_g_km3 = antapex_density_g_km3 + (apex_density_g_km3 - antapex_density_g_km3) * cos_phi[j];
+      output[j] = density_g_km3 * 1e-12;  // Unit conversion g/km3 -> kg/m^3
+    }
+  }
 }
 
 }  // namespace libra::atmosphere
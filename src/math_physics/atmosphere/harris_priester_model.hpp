@@ -18,10 +18,26 @@ namespace libra::atmosphere {
  * @param [in] sun_direction_eci: Sun direction unit vector in ECI frame
  * @param [in] f10_7: F10.7 radiation index (not used now)
  * @param [in] exponent_parameter: n in the equation. n=2 for low inclination orbit and n=6 for polar orbit.
- * @return Atmospheric density [kg/m^3]
+ * @return Atmospheric density [kg/m^3]. The density at the lowest altitude of the table is used below it, and the highest interval of the
+ *         table is extrapolated above it.
  */
 double CalcAirDensityWithHarrisPriester_kg_m3(const GeodeticPosition geodetic_position, const libra::Vector<3> sun_direction_eci,
                                               const double f10_7 = 100.0, const double exponent_parameter = 4);
+/**
+ * @fn CalcAirDensityWithHarrisPriester_kg_m3
+ * @brief Calculate atmospheric density with Harris-Priester method for many positions at the same time
+ * @note The altitude interval of the coefficient table is found with a precomputed index, and the exponential interpolation is done in a
+ *       separated loop without branches so that the compiler can vectorize it.
+ * @param [in] geodetic_positions: Geodetic positions of the spacecraft
+ * @param [in] number_of_positions: Number of the positions
+ * @param [in] sun_direction_eci: Sun direction unit vector in ECI frame shared by all positions
+ * @param [out] air_densities_kg_m3: Atmospheric density at each position [kg/m^3]
+ * @param [in] f10_7: F10.7 radiation index (not used now)
+ * @param [in] exponent_parameter: n in the equation. n=2 for low inclination orbit and n=6 for polar orbit.
+ */
+void CalcAirDensityWithHarrisPriester_kg_m3(const GeodeticPosition* geodetic_positions, const size_t number_of_positions,
+                                            const libra::Vector<3> sun_direction_eci, double* air_densities_kg_m3, const double f10_7 = 100.0,
+                                            const double exponent_parameter = 4);
 
 }  // namespace libra::atmosphere
 
@@ -4,138 +4,102 @@
  */
 #include "simple_air_density_model.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace libra::atmosphere {
 
-double CalcAirDensityWithSimpleModel(const double altitude_m) {
-  double altitude_km = altitude_m / 1000.0;
-  double scale_height_km;
-  double base_height_km;
-  double base_rho_kg_m3;
+namespace {
+/**
+ * @struct SimpleModelLayer
+ * @brief Coefficients of an altitude layer of the simple model
+ */
+struct SimpleModelLayer {
+  double base_height_km;   //!< Bottom altitude of the layer [km]
+  double scale_height_km;  //!< Scale height [km]
+  double base_rho_kg_m3;   //!< Density at the bottom altitude [kg/m3]
+};
+
+// scale_height_km values: Ref "ミッション解析と軌道設計の基礎" (in Japanese)
+const SimpleModelLayer kSimpleModelLayers[] = {
+    {0.0, 7.249, 1.225},        {25.0, 6.349, 3.899E-2},    {30.0, 6.682, 1.774E-2},    {40.0, 7.554, 3.972E-3},    {50.0, 8.382, 1.057E-3},
+    {60.0, 7.714, 3.206E-4},    {70.0, 6.549, 8.770E-5},    {80.0, 5.799, 1.905E-5},    {90.0, 5.382, 3.396E-6},    {100.0, 5.877, 5.297E-7},
+    {110.0, 7.263, 9.661E-8},   {120.0, 9.473, 2.438E-8},   {130.0, 12.636, 8.484E-9},  {140.0, 16.149, 3.845E-9},  {150.0, 22.523, 2.070E-9},
+    {180.0, 29.740, 5.464E-10}, {200.0, 37.105, 2.789E-10}, {250.0, 45.546, 7.248E-11}, {300.0, 53.628, 2.418E-11}, {350.0, 53.298, 9.158E-12},
+    {400.0, 58.515, 3.725E-12}, {450.0, 60.828, 1.585E-12}, {500.0, 63.822, 6.967E-13}, {600.0, 71.835, 1.454E-13}, {700.0, 88.667, 3.614E-14},
+    {800.0, 124.64, 1.170E-14}, {900.0, 181.05, 5.245E-15}, {1000.0, 268.0, 3.019E-15}};
+const size_t kNumberOfSimpleModelLayers = sizeof(kSimpleModelLayers) / sizeof(kSimpleModelLayers[0]);  //!< Number of the layers
+
+const double kLayerBinWidth_km = 5.0;   //!< Width of the altitude bins. All layer boundaries are on the bin boundaries. [km]
+const size_t kNumberOfLayerBins = 200;  //!< Number of the bins up to the bottom of the highest layer
 
-  // scale_height_km values: Ref "ミッション解析と軌道設計の基礎" (in Japanese)
-  if (altitude_km > 1000.0) {
-    scale_height_km = 268.0;
-    base_height_km = 1000.0;
-    base_rho_kg_m3 = 3.019E-15;
-  } else if (altitude_km >= 900.0 && altitude_km < 1000.0) {
-    scale_height_km = 181.05;
-    base_height_km = 900.0;
-    base_rho_kg_m3 = 5.245E-15;
-  } else if (altitude_km >= 800.0 && altitude_km < 900.0) {
-    scale_height_km = 124.64;
-    base_height_km = 800.0;
-    base_rho_kg_m3 = 1.170E-14;
-  } else if (altitude_km >= 700.0 && altitude_km < 800.0) {
-    scale_height_km = 88.667;
-    base_height_km = 700.0;
-    base_rho_kg_m3 = 3.614E-14;
-  } else if (altitude_km >= 600.0 && altitude_km < 700.0) {
-    scale_height_km = 71.835;
-    base_height_km = 600.0;
-    base_rho_kg_m3 = 1.454E-13;
-  } else if (altitude_km >= 500.0 && altitude_km < 600.0) {
-    scale_height_km = 63.822;
-    base_height_km = 500.0;
-    base_rho_kg_m3 = 6.967E-13;
-  } else if (altitude_km >= 450.0 && altitude_km < 500.0) {
-    scale_height_km = 60.828;
-    base_height_km = 450.0;
-    base_rho_kg_m3 = 1.585E-12;
-  } else if (altitude_km >= 400.0 && altitude_km < 450.0) {
-    scale_height_km = 58.515;
-    base_height_km = 400.0;
-    base_rho_kg_m3 = 3.725E-12;
-  } else if (altitude_km >= 350.0 && altitude_km < 400.0) {
-    scale_height_km = 53.298;
-    base_height_km = 350.0;
-    base_rho_kg_m3 = 9.158E-12;
-  } else if (altitude_km >= 300.0 && altitude_km < 350.0) {
-    scale_height_km = 53.628;
-    base_height_km = 300.0;
-    base_rho_kg_m3 = 2.418E-11;
-  } else if (altitude_km >= 250.0 && altitude_km < 300.0) {
-    scale_height_km = 45.546;
-    base_height_km = 250.0;
-    base_rho_kg_m3 = 7.248E-11;
-  } else if (altitude_km >= 200.0 && altitude_km < 250.0) {
-    scale_height_km = 37.105;
-    base_height_km = 200.0;
-    base_rho_kg_m3 = 2.789E-10;
-  } else if (altitude_km >= 180.0 && altitude_km < 200.0) {
-    scale_height_km = 29.740;
-    base_height_km = 180.0;
-    base_rho_kg_m3 = 5.464E-10;
-  } else if (altitude_km >= 150.0 && altitude_km < 180.0) {
-    scale_height_km = 22.523;
-    base_height_km = 150.0;
-    base_rho_kg_m3 = 2.070E-9;
-  } else if (altitude_km >= 140.0 && altitude_km < 150.0) {
-    scale_height_km = 16.149;
-    base_height_km = 140.0;
-    base_rho_kg_m3 = 3.845E-9;
-  } else if (altitude_km >= 130.0 && altitude_km < 140.0) {
-    scale_height_km = 12.636;
-    base_height_km = 130.0;
-    base_rho_kg_m3 = 8.484E-9;
-  } else if (altitude_km >= 120.0 && altitude_km < 130.0) {
-    scale_height_km = 9.473;
-    base_height_km = 120.0;
-    base_rho_kg_m3 = 2.438E-8;
-  } else if (altitude_km >= 110.0 && altitude_km < 120.0) {
-    scale_height_km = 7.263;
-    base_height_km = 110.0;
-    base_rho_kg_m3 = 9.661E-8;
-  } else if (altitude_km >= 100.0 && altitude_km < 110.0) {
-    scale_height_km = 5.877;
-    base_height_km = 100.0;
-    base_rho_kg_m3 = 5.297E-7;
-  } else if (altitude_km >= 90.0 && altitude_km < 100.0) {
-    scale_height_km = 5.382;
-    base_height_km = 90.0;
-    base_rho_kg_m3 = 3.396E-6;
-  } else if (altitude_km >= 80.0 && altitude_km < 90.0) {
-    scale_height_km = 5.799;
-    base_height_km = 80.0;
-    base_rho_kg_m3 = 1.905E-5;
-  } else if (altitude_km >= 70.0 && altitude_km < 80.0) {
-    scale_height_km = 6.549;
-    base_height_km = 70.0;
-    base_rho_kg_m3 = 8.770E-5;
-  } else if (altitude_km >= 60.0 && altitude_km < 70.0) {
-    scale_height_km = 7.714;
-    base_height_km = 60.0;
-    base_rho_kg_m3 = 3.206E-4;
-  } else if (altitude_km >= 50.0 && altitude_km < 60.0) {
-    scale_height_km = 8.382;
-    base_height_km = 50.0;
-    base_rho_kg_m3 = 1.057E-3;
-  } else if (altitude_km >= 40.0 && altitude_km < 50.0) {
-    scale_height_km = 7.554;
-    base_height_km = 40.0;
-    base_rho_kg_m3 = 3.972E-3;
-  } else if (altitude_km >= 30.0 && altitude_km < 40.0) {
-    scale_height_km = 6.682;
-    base_height_km = 30.0;
-    base_rho_kg_m3 = 1.774E-2;
-  } else if (altitude_km >= 25.0 && altitude_km < 30.0) {
-    scale_height_km = 6.349;
-    base_height_km = 25.0;
-    base_rho_kg_m3 = 3.899E-2;
-  } else if (altitude_km >= 0.0 && altitude_km < 25.0) {
-    scale_height_km = 7.249;
-    base_height_km = 0.0;
-    base_rho_kg_m3 = 1.225;
-  } else {  // In case of altitude_km is minus value
-    scale_height_km = 7.249;
-    base_height_km = 0.0;
-    base_rho_kg_m3 = 0.0;
-    return 0.0;
+/**
+ * @struct SimpleModelLayerIndex
+ * @brief Layer index of each altitude bin
+ */
+struct SimpleModelLayerIndex {
+  unsigned char bin_to_layer[kNumberOfLayerBins];  //!< Layer index of each altitude bin
+
+  /**
+   * @fn SimpleModelLayerIndex
+   * @brief Constructor
+   */
+  SimpleModelLayerIndex() {
+    size_t layer = 0;
+    for (size_t bin = 0; bin < kNumberOfLayerBins; bin++) {
+      const double bin_bottom_km = bin * kLayerBinWidth_km;
+      while (layer + 1 < kNumberOfSimpleModelLayers && kSimpleModelLayers[layer + 1].base_height_km <= bin_bottom_km) layer++;
+      bin_to_layer[bin] = (unsigned char)layer;
+    }
   }
 
-  double rho_kg_m3 = base_rho_kg_m3 * exp(-(altitude_km - base_height_km) / scale_height_km);
+  /**
+   * @fn FindLayer
+   * @brief Return index of the layer including the non-negative altitude
+   */
+  inline size_t FindLayer(const double altitude_km) const {
+    const size_t bin = (size_t)(altitude_km / kLayerBinWidth_km);
+    if (bin >= kNumberOfLayerBins) return kNumberOfSimpleModelLayers - 1;
+    return bin_to_layer[bin];
+  }
+};
+
+const SimpleModelLayerIndex kSimpleModelLayerIndex;  //!< Layer index of the altitude bins
+}  // namespace
+
+double CalcAirDensityWithSimpleModel(const double altitude_m) {
+  double rho_kg_m3;
+  CalcAirDensityWithSimpleModel(&altitude_m, 1, &rho_kg_m3);
   return rho_kg_m3;
 }
 
+void CalcAirDensityWithSimpleModel(const double* altitudes_m, const size_t number_of_altitudes, double* air_densities_kg_m3) {
+  const size_t kChunkSize = 64;
+  double base_rho_kg_m3[kChunkSize];
+  double exponent[kChunkSize];
+  for (size_t begin = 0; begin < number_of_altitudes; begin += kChunkSize) {
+    const size_t count = std::min(kChunkSize, number_of_altitudes - begin);
+
+    // Layer search
+    for (size_t j = 0; j < count; j++) {
+      const double altitude_km = altitudes_m[begin + j] / 1000.0;
+      if (altitude_km < 0.0) {
+        // In case of altitude_km is minus value
+        base_rho_kg_m3[j] = 0.0;
+        exponent[j] = 0.0;
+        continue;
+      }
+      const SimpleModelLayer& layer = kSimpleModelLayers[kSimpleModelLayerIndex.FindLayer(altitude_km)];
+      base_rho_kg_m3[j] = layer.base_rho_kg_m3;
+      exponent[j] = -(altitude_km - layer.base_height_km) / layer.scale_height_km;
+    }
+
+    // Exponential interpolation
+    double* output = air_densities_kg_m3 + begin;
+    for (size_t j = 0; j < count; j++) {
+      output[j] = base_rho_kg_m3[j] * exp(exponent[j]);
+    }
+  }
+}
+
 }  // namespace libra::atmosphere
@@ -5,6 +5,8 @@
 #ifndef S2E_LIBRARY_ATMOSPHERE_SIMPLE_AIR_DENSITY_MODEL_HPP_
 #define S2E_LIBRARY_ATMOSPHERE_SIMPLE_AIR_DENSITY_MODEL_HPP_
 
+#include <cstddef>
+
 namespace libra::atmosphere {
 
 /**
@@ -14,6 +16,16 @@ namespace libra::atmosphere {
  * @return Atmospheric density [kg/m^3]
  */
 double CalcAirDensityWithSimpleModel(const double altitude_m);
+/**
+ * @fn CalcAirDensityWithSimpleModel
+ * @brief Calculate atmospheric density with simplest method for many altitudes at the same time
+ * @note The layer is found with a precomputed altitude index, and the exponential interpolation is done in a separated loop without
+ *       branches so that the compiler can vectorize it.
+ * @param [in] altitudes_m: Altitudes of spacecraft [m]
+ * @param [in] number_of_altitudes: Number of the altitudes
+ * @param [out] air_densities_kg_m3: Atmospheric density at each altitude [kg/m^3]
+ */
+void CalcAirDensityWithSimpleModel(const double* altitudes_m, const size_t number_of_altitudes, double* air_densities_kg_m3);
 
 }  // namespace libra::atmosphere
 
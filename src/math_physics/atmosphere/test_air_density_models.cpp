@@ -0,0 +1,79 @@
+/**
+ * @file test_air_density_models.cpp
+ * @brief Test codes for Harris-Priester and simple air density models with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "harris_priester_model.hpp"
+#include "simple_air_density_model.hpp"
+
+/**
+ * @brief Test for the densities at the nodes of the coefficient table
+ */
+TEST(HarrisPriesterModel, TableNodes) {
+  libra::Vector<3> sun_direction_eci(0.0);
+  sun_direction_eci[0] = 1.0;
+
+  // The apex and antapex densities are the same at 100 km
+  EXPECT_NEAR(497400.0e-12, libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(GeodeticPosition(0.0, 0.0, 100.0e3), sun_direction_eci),
+              1.0e-15);
+  // Below the table
+  EXPECT_NEAR(497400.0e-12, libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(GeodeticPosition(0.0, 0.0, 50.0e3), sun_direction_eci),
+              1.0e-15);
+
+  // Antapex density at 400 km: the position is opposite to the apex direction (sun direction + 30 deg)
+  const double antapex_longitude_rad = 30.0 * 3.141592653589793 / 180.0 - 3.141592653589793;
+  EXPECT_NEAR(2.249e-12,
+              libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(GeodeticPosition(0.0, antapex_longitude_rad, 400.0e3), sun_direction_eci),
+              1.0e-18);
+}
+
+/**
+ * @brief Test for the batch calculation
+ */
+TEST(HarrisPriesterModel, Batch) {
+  libra::Vector<3> sun_direction_eci(0.0);
+  sun_direction_eci[0] = 0.6;
+  sun_direction_eci[2] = 0.8;
+
+  // More positions than the chunk size including the outside of the table
+  std::vector<GeodeticPosition> positions;
+  for (size_t i = 0; i < 200; i++) {
+    const double altitude_m = 50.0e3 + i * 5.5e3;
+    positions.push_back(GeodeticPosition(0.01 * i - 1.0, 0.03 * i - 3.0, altitude_m));
+  }
+  std::vector<double> densities_kg_m3(positions.size());
+  libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(positions.data(), positions.size(), sun_direction_eci, densities_kg_m3.data(), 100.0,
+                                                            6.0);
+
+  for (size_t i = 0; i < positions.size(); i++) {
+    const double expected_kg_m3 = libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(positions[i], sun_direction_eci, 100.0, 6.0);
+    EXPECT_DOUBLE_EQ(expected_kg_m3, densities_kg_m3[i]);
+    if (i > 0) {
+      // The density decreases with the altitude
+      EXPECT_GT(densities_kg_m3[i - 1] * 1.5, densities_kg_m3[i]);
+    }
+  }
+}
+
+/**
+ * @brief Test for the batch calculation of the simple model
+ */
+TEST(SimpleAirDensityModel, Batch) {
+  std::vector<double> altitudes_m;
+  for (size_t i = 0; i < 300; i++) {
+    altitudes_m.push_back(-10.0e3 + i * 5.0e3);
+  }
+  std::vector<double> densities_kg_m3(altitudes_m.size());
+  libra::atmosphere::CalcAirDensityWithSimpleModel(altitudes_m.data(), altitudes_m.size(), densities_kg_m3.data());
+
+  for (size_t i = 0; i < altitudes_m.size(); i++) {
+    EXPECT_DOUBLE_EQ(libra::atmosphere::CalcAirDensityWithSimpleModel(altitudes_m[i]), densities_kg_m3[i]);
+  }
+  EXPECT_DOUBLE_EQ(0.0, densities_kg_m3[0]);
+  EXPECT_DOUBLE_EQ(1.225, densities_kg_m3[2]);
+  EXPECT_DOUBLE_EQ(3.725E-12, libra::atmosphere::CalcAirDensityWithSimpleModel(400.0e3));
+}
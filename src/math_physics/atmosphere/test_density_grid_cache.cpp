@@ -0,0 +1,69 @@
+/**
+ * @file test_density_grid_cache.cpp
+ * @brief Test codes for DensityGridCache class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "density_grid_cache.hpp"
+
+namespace {
+/**
+ * @brief Analytic density model with exponential altitude profile and diurnal variation
+ */
+double CalcTestDensity(const double altitude_m, const double latitude_rad, const double local_time_h) {
+  const double diurnal = 1.0 + 0.3 * cos(2.0 * 3.141592653589793 * (local_time_h - 14.0) / 24.0) * cos(latitude_rad);
+  return 1.0e-9 * exp(-(altitude_m - 200.0e3) / 50.0e3) * diurnal;
+}
+}  // namespace
+
+/**
+ * @brief Test for the interpolation accuracy and the reuse of the grid points
+ */
+TEST(DensityGridCache, Interpolation) {
+  libra::atmosphere::DensityGridCache::Settings settings;
+  settings.max_relative_error = 0.01;
+  libra::atmosphere::DensityGridCache cache(settings);
+
+  size_t number_of_evaluations_first_pass = 0;
+  for (size_t pass = 0; pass < 2; pass++) {
+    for (double local_time_h = 0.0; local_time_h < 24.0; local_time_h += 0.1) {
+      const double altitude_m = 400.0e3 + 10.0e3 * sin(local_time_h);
+      const double latitude_rad = 0.9 * sin(0.5 * local_time_h);
+      auto grid_model = [](double alt, double lat, double lst) { return CalcTestDensity(alt, lat, lst); };
+      auto query_model = [&]() { return CalcTestDensity(altitude_m, latitude_rad, local_time_h); };
+      const double expected = CalcTestDensity(altitude_m, latitude_rad, local_time_h);
+      EXPECT_NEAR(expected, cache.CalcDensity_kg_m3(altitude_m, latitude_rad, local_time_h, grid_model, query_model), 0.01 * expected);
+    }
+    if (pass == 0) number_of_evaluations_first_pass = cache.GetNumberOfModelEvaluations();
+  }
+  EXPECT_EQ(0, cache.GetNumberOfDirectCells());
+  // The second pass uses only the cached values
+  EXPECT_EQ(number_of_evaluations_first_pass, cache.GetNumberOfModelEvaluations());
+}
+
+/**
+ * @brief Test for the direct evaluation when the tolerance is not satisfied
+ */
+TEST(DensityGridCache, Tolerance) {
+  libra::atmosphere::DensityGridCache::Settings settings;
+  settings.max_relative_error = 0.0;
+  libra::atmosphere::DensityGridCache cache(settings);
+
+  const double altitude_m = 405.0e3;
+  const double latitude_rad = 0.3;
+  const double local_time_h = 10.5;
+  auto grid_model = [](double alt, double lat, double lst) { return CalcTestDensity(alt, lat, lst); };
+  auto query_model = [&]() { return CalcTestDensity(altitude_m, latitude_rad, local_time_h); };
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(CalcTestDensity(altitude_m, latitude_rad, local_time_h),
+                     cache.CalcDensity_kg_m3(altitude_m, latitude_rad, local_time_h, grid_model, query_model));
+  }
+  EXPECT_EQ(1, cache.GetNumberOfDirectCells());
+
+  // Out of the altitude range
+  auto query_model_high = [&]() { return CalcTestDensity(2000.0e3, latitude_rad, local_time_h); };
+  EXPECT_DOUBLE_EQ(CalcTestDensity(2000.0e3, latitude_rad, local_time_h),
+                   cache.CalcDensity_kg_m3(2000.0e3, latitude_rad, local_time_h, grid_model, query_model_high));
+}
@@ -17,7 +17,9 @@ extern "C" {
 #include <cmath> /* maths functions */
 #include <environment/global/physical_constants.hpp>
 #include <math_physics/math/constants.hpp>
+#include <mutex>
 #include <numeric>
+#include <utilities/shared_data_registry.hpp>
 
 #include "wrapper_nrlmsise00.hpp" /* header for nrlmsise-00.h */
 
@@ -27,8 +29,6 @@ using namespace std;
 /* ------------------------------ DEFINES ---------------------------- */
 /* ------------------------------------------------------------------- */
 
-static double decyear_monthly;
-
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
 void ConvertDaysToMonthDay(int days, int is_leap_year, int* month_day) {
@@ -132,6 +132,15 @@ double ConvertDateToDecyear(int year, int month, int day) {
   return (double)year + days / (double)days_per_year;
 }
 
+int ConvertDateToDayNumber(int year, int month, int day) {
+  // Days from 0000-03-01 in the proleptic Gregorian calendar
+  if (month <= 2) {
+    year--;
+    month += 12;
+  }
+  return 365 * year + year / 4 - year / 100 + year / 400 + (153 * (month - 3) + 2) / 5 + day - 1;
+}
+
 int ConvertMonthStrToMonthNum(string month_str) {
   if (month_str == "Jan") {
     return 1;
@@ -165,95 +174,118 @@ int ConvertMonthStrToMonthNum(string month_str) {
 /* ------------------------------------------------------------------- */
 /* --------------------------CalcNRLMSISE00--------------------------- */
 /* ------------------------------------------------------------------- */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const nrlmsise_space_weather_table& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap) {
+  double f107 = manual_f107;
+  double f107a = manual_f107a;
+  double ap = manual_ap;
+  if (!is_manual_param) {
+    // f10.7 and ap from table
+    // If the table size is zero, return 0
+    if (!GetNRLMSISE00SpaceWeather(decyear, table, f107, f107a, ap)) return 0.0;
+  }
+
+  int year;
+  int day_of_year;
+  double seconds;
+  ConvertDecyearToNRLMSISE00Time(decyear, year, day_of_year, seconds);
+  return CalcNRLMSISE00WithSpaceWeather(day_of_year, seconds, latrad, lonrad, alt, f107, f107a, ap);
+}
+
+bool GetNRLMSISE00SpaceWeather(double decyear, const nrlmsise_space_weather_table& table, double& f107, double& f107a, double& ap) {
+  if (table.data.size() == 0) return false;
+
+  int date[6];
+  ConvertDecyearToDate(decyear, date);
+
+  // Match year, month, date. After the monthly update date, match year, month with the first data of the month.
+  // The dates outside the table use the first or the last data
+  size_t idx;
+  bool is_out_of_range;
+  if (decyear < table.decyear_monthly) {
+    const int offset = ConvertDateToDayNumber(date[0], date[1], date[2]) - table.first_day_number;
+    is_out_of_range = offset < 0 || offset >= (int)table.daily_index.size();
+    idx = table.daily_index[std::clamp(offset, 0, (int)table.daily_index.size() - 1)];
+  } else {
+    const int offset = date[0] * 12 + date[1] - 1 - table.first_month_number;
+    is_out_of_range = offset < 0 || offset >= (int)table.monthly_index.size();
+    idx = table.monthly_index[std::clamp(offset, 0, (int)table.monthly_index.size() - 1)];
+  }
+  if (is_out_of_range) {
+    static std::once_flag out_of_range_warning_flag;
+    std::call_once(out_of_range_warning_flag, [decyear]() {
+      cerr << "The decimal year " << decyear << " is out of the space weather table for NRLMSISE00 atmosphere model. The nearest data is used."
+           << endl;
+    });
+  }
+
+  f107a = table.data[idx].Ctr81_adj;
+  f107 = table.data[idx].F107_adj;
+  ap = table.data[idx].Ap_avg;
+  return true;
+}
+
+void ConvertDecyearToNRLMSISE00Time(double decyear, int& year, int& day_of_year, double& seconds) {
+  int date[6];
+  ConvertDecyearToDate(decyear, date);
+  year = date[0];
+  day_of_year = (int)((decyear - (int)decyear) * 365.25);
+  seconds = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
+}
+
+double CalcNRLMSISE00WithSpaceWeather(int day_of_year, double seconds, double latrad, double lonrad, double alt, double f107, double f107a,
+                                      double ap) {
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
   struct ap_array aph;
 
-  size_t i;
-  int date[6];
-  size_t idx = 0;
-
   /* input values */
-  for (i = 0; i < 24; i++) {
+  for (size_t i = 0; i < 24; i++) {
     flags.switches[i] = 1;
   }
 
-  ConvertDecyearToDate(decyear, date);
-
-  input.doy = (int)((decyear - (int)decyear) * 365.25);
+  input.doy = day_of_year;
   input.year = 0; /* without effect */
-  input.sec = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
+  input.sec = seconds;
   input.alt = alt / 1000.0;
   input.g_lat = latrad * libra::rad_to_deg;
   input.g_long = lonrad * libra::rad_to_deg;
   input.lst = input.sec / 3600.0 + lonrad * libra::rad_to_deg / 15.0;
+  input.f107 = f107;
+  input.f107A = f107a;
+  input.ap = ap;
 
-  if (is_manual_param) {
-    input.f107 = manual_f107;
-    input.f107A = manual_f107a;
-    input.ap = manual_ap;
-  } else {
-    // f10.7 and ap from table
-    // If the table size is zero, return 0
-    if (table.size() == 0) {
-      return 0.0;
-    }
-
-    // search table index
-    for (i = 0; i < table.size(); i++) {
-      if (decyear < decyear_monthly) {
-        // Match year, month, date
-        if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) {
-          idx = i;
-          break;
-        }
-      } else {
-        // Match year, month
-        if ((date[0] == table[i].year) && (date[1] == table[i].month)) {
-          idx = i;
-          break;
-        }
-      }
-    }
-
-    input.f107A = table[idx].Ctr81_adj;
-    input.f107 = table[idx].F107_adj;
-    input.ap = table[idx].Ap_avg;
-  }
-
-  for (i = 0; i < 7; i++) {
+  for (size_t i = 0; i < 7; i++) {
     aph.a[i] = input.ap;
   }
   input.ap_a = &aph;
 
-  gtd7(&input, &flags, &output);
+  {
+    // NRLMSISE-00 uses the global variables in the library, so it is serialized for the parallel spacecraft and simulation cases
+    static std::mutex nrlmsise00_mutex;
+    std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
+    gtd7(&input, &flags, &output);
+  }
   return output.d[5];
 }
 
 /* ------------------------------------------------------------------- */
 /* -----------------------ReadSpaceWeatherTable----------------------- */
 /* ------------------------------------------------------------------- */
-size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, vector<nrlmsise_table>& table) {
+/**
+ * @fn ReadSpaceWeatherTable
+ * @brief Parse the whole space weather table file and index it by the day number and the month number
+ * @param [in] filename: Path to the SpaceWeather file
+ * @param [out] table: Space weather table
+ * @return False when the file cannot be opened
+ */
+static bool ReadSpaceWeatherTable(const string& filename, nrlmsise_space_weather_table& table) {
   ifstream ifs(filename);
 
   if (!ifs.is_open()) {
     cerr << "File open error (SpaceWether.txt)" << endl;
-    return 0;
-  }
-
-  double decyear_ini = decyear;
-  double decyear_end = decyear + endsec / 86400.0 / 365.0;
-  int date_ini[6];
-  int date_end[6];
-
-  ConvertDecyearToDate(decyear_ini, date_ini);
-  ConvertDecyearToDate(decyear_end, date_end);
-
-  if (date_ini[0] < 2015 || date_ini[0] > 2043 || date_end[0] > 2043) {
-    cerr << "Year must be between 2015 and 2043 for NRLMSISE00 atmosphere model" << endl;
+    return false;
   }
 
   string line;
@@ -273,25 +305,15 @@ size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filena
 
         // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
         int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-        decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
+        table.decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
       }
       continue;
     }
 
-    int year = atoi(year_str.c_str());
-    int month = atoi(line.substr(5, 2).c_str());
-    int day = atoi(line.substr(8, 2).c_str());
-    double decyear_line = ConvertDateToDecyear(year, month, day);
-    // To get 1 month data, read the data before a month from the simulation starting date
-    double decyear_ini_ymd = ConvertDateToDecyear(date_ini[0], date_ini[1], date_ini[2]) - 31.0 / 365.0;  // Subtract one month
-    double decyear_end_ymd = ConvertDateToDecyear(date_end[0], date_end[1], date_end[2]);
-
-    if (decyear_line < decyear_ini_ymd || decyear_line > decyear_end_ymd) continue;
-
     // Read table data
-    line_data.year = year;
-    line_data.month = month;
-    line_data.day = day;
+    line_data.year = atoi(year_str.c_str());
+    line_data.month = atoi(line.substr(5, 2).c_str());
+    line_data.day = atoi(line.substr(8, 2).c_str());
     line_data.Ap_avg = atof(line.substr(80, 3).c_str());
     line_data.F107_adj = atof(line.substr(93, 5).c_str());
     line_data.Ctr81_adj = atof(line.substr(101, 5).c_str());
@@ -300,8 +322,65 @@ size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filena
     line_data.Ctr81_obs = atof(line.substr(119, 5).c_str());
     line_data.Lst81_obs = atof(line.substr(125, 5).c_str());
 
-    table.push_back(line_data);
+    table.data.push_back(line_data);
+  }
+  if (table.data.size() == 0) return true;
+
+  // Index the data. The days and months without data refer to the previous data.
+  const nrlmsise_table& first = table.data.front();
+  const nrlmsise_table& last = table.data.back();
+  table.first_day_number = ConvertDateToDayNumber(first.year, first.month, first.day);
+  table.first_month_number = first.year * 12 + first.month - 1;
+  const int day_num = ConvertDateToDayNumber(last.year, last.month, last.day) - table.first_day_number + 1;
+  const int month_num = last.year * 12 + last.month - 1 - table.first_month_number + 1;
+  vector<int> daily_index(max(day_num, 1), -1);
+  vector<int> monthly_index(max(month_num, 1), -1);
+  for (size_t i = 0; i < table.data.size(); i++) {
+    const nrlmsise_table& data = table.data[i];
+    const int day_offset = ConvertDateToDayNumber(data.year, data.month, data.day) - table.first_day_number;
+    const int month_offset = data.year * 12 + data.month - 1 - table.first_month_number;
+    if (day_offset >= 0 && day_offset < day_num && daily_index[day_offset] < 0) daily_index[day_offset] = (int)i;
+    if (month_offset >= 0 && month_offset < month_num && monthly_index[month_offset] < 0) monthly_index[month_offset] = (int)i;
+  }
+  table.daily_index.resize(daily_index.size());
+  table.monthly_index.resize(monthly_index.size());
+  size_t previous = 0;
+  for (size_t i = 0; i < daily_index.size(); i++) {
+    if (daily_index[i] >= 0) previous = daily_index[i];
+    table.daily_index[i] = previous;
+  }
+  previous = 0;
+  for (size_t i = 0; i < monthly_index.size(); i++) {
+    if (monthly_index[i] >= 0) previous = monthly_index[i];
+    table.monthly_index[i] = previous;
+  }
+
+  return true;
+}
+
+size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, std::shared_ptr<const nrlmsise_space_weather_table>& table) {
+  double decyear_ini = decyear;
+  double decyear_end = decyear + endsec / 86400.0 / 365.0;
+  int date_ini[6];
+  int date_end[6];
+
+  ConvertDecyearToDate(decyear_ini, date_ini);
+  ConvertDecyearToDate(decyear_end, date_end);
+
+  if (date_ini[0] < 2015 || date_ini[0] > 2043 || date_end[0] > 2043) {
+    cerr << "Year must be between 2015 and 2043 for NRLMSISE00 atmosphere model" << endl;
   }
 
-  return table.size();
+  // Tables are shared between the simulation cases and spacecraft. They are kept until the end of the process to avoid reloading them
+  // in the sequential Monte-Carlo simulation cases.
+  auto load = [&filename]() -> std::shared_ptr<const nrlmsise_space_weather_table> {
+    auto new_table = std::make_shared<nrlmsise_space_weather_table>();
+    if (!ReadSpaceWeatherTable(filename, *new_table)) return nullptr;
+    return new_table;
+  };
+  std::shared_ptr<const nrlmsise_space_weather_table> shared_table = SharedDataRegistry<nrlmsise_space_weather_table>::Get(filename, load);
+  if (shared_table == nullptr) return 0;
+  table = shared_table;
+
+  return table->data.size();
 }
@@ -8,6 +8,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -30,6 +31,20 @@ struct nrlmsise_table {
   double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
 };
 
+/**
+ * @struct nrlmsise_space_weather_table
+ * @brief Space weather table indexed by the integer day at the loading
+ * @note The table is not modified after the loading, so it can be shared between simulation cases and spacecraft.
+ */
+struct nrlmsise_space_weather_table {
+  std::vector<nrlmsise_table> data;   //!< Table data sorted by the date
+  double decyear_monthly = 0.0;       //!< Decimal year after which the data is updated once per month
+  int first_day_number = 0;           //!< Day number of the first element of daily_index
+  int first_month_number = 0;         //!< Month number (year * 12 + month - 1) of the first element of monthly_index
+  std::vector<size_t> daily_index;    //!< Index of the data for each day
+  std::vector<size_t> monthly_index;  //!< Index of the first data of the month for each month
+};
+
 /**
  * @fn CalcNRLMSISE00
  * @brief Read the space weather table file
@@ -44,19 +59,59 @@ struct nrlmsise_table {
  * @param [in] manual_ap: Manual setting Ap-index
  * @return Atmospheric density [kg/m3]
  */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const nrlmsise_space_weather_table& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap);
 
+/**
+ * @fn GetNRLMSISE00SpaceWeather
+ * @brief Get the space weather parameters of the day from the table
+ * @note The index is looked up by the day number. The dates out of the table are clamped to the first or the last data.
+ * @param [in] decyear: Decimal year
+ * @param [in] table: Space Weather table
+ * @param [out] f107: Daily F10.7
+ * @param [out] f107a: Averaged F10.7
+ * @param [out] ap: Ap-index
+ * @return False when the table is empty
+ */
+bool GetNRLMSISE00SpaceWeather(double decyear, const nrlmsise_space_weather_table& table, double& f107, double& f107a, double& ap);
+
+/**
+ * @fn ConvertDecyearToNRLMSISE00Time
+ * @brief Convert the decimal year to the time input of NRLMSISE00
+ * @param [in] decyear: Decimal year
+ * @param [out] year: Year
+ * @param [out] day_of_year: Day of year
+ * @param [out] seconds: Seconds in the day (UT) [sec]
+ */
+void ConvertDecyearToNRLMSISE00Time(double decyear, int& year, int& day_of_year, double& seconds);
+
+/**
+ * @fn CalcNRLMSISE00WithSpaceWeather
+ * @brief Calculate the air density with NRLMSISE00 model with given time and space weather parameters
+ * @param [in] day_of_year: Day of year
+ * @param [in] seconds: Seconds in the day (UT) [sec]
+ * @param [in] latrad: Latitude [rad]
+ * @param [in] lonrad: Longitude [rad]
+ * @param [in] alt: Altitude [m]
+ * @param [in] f107: Daily F10.7
+ * @param [in] f107a: Averaged F10.7
+ * @param [in] ap: Ap-index
+ * @return Atmospheric density [kg/m3]
+ */
+double CalcNRLMSISE00WithSpaceWeather(int day_of_year, double seconds, double latrad, double lonrad, double alt, double f107, double f107a,
+                                      double ap);
+
 /**
  * @fn GetSpaceWeatherTable_
  * @brief Read the space weather table file
+ * @note The file is parsed only once per process, and the table is shared between the callers with the same file name.
  * @param [in] decyear: Decimal year of the simulation start time
  * @param [in] endsec: Simulation end time [sec]
  * @param [in] filename: Path to the SpaceWeather file (Ex: ftp://ftp.agi.com/pub/DynamicEarthData/SpaceWeather-v1.2.txt)
- * @param [out] table: Space weather table
+ * @param [out] table: Space weather table. It is not modified when the file cannot be read.
  * @return Size of table
  */
-size_t GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::vector<nrlmsise_table>& table);
+size_t GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::shared_ptr<const nrlmsise_space_weather_table>& table);
 
 /* ------------------------------------------------------------------- */
 /* ----------------------- COMPILATION TWEAKS ------------------------ */
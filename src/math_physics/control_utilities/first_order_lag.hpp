@@ -37,6 +37,12 @@ class FirstOrderLag {
    * @brief Return output
    */
   inline double GetOutput() const { return output_; }
+  /**
+   * @fn SetOutput
+   * @brief Set output (e.g. to restore the state)
+   * @param [in] output: Output of the system
+   */
+  inline void SetOutput(const double output) { output_ = output; }
 
  private:
   double output_ = 0.0;           //!< Output of the system
@@ -9,6 +9,47 @@
 #include <environment/global/physical_constants.hpp>
 #include <math_physics/math/constants.hpp>
 #include <math_physics/math/matrix.hpp>
+#include <utilities/macros.hpp>
+
+namespace {
+/**
+ * @fn CalcGeodeticFromEcefVermeille
+ * @brief Calculate latitude and altitude with the closed form solution by Vermeille
+ * @note Valid outside the evolute of the ellipsoid (about 43 km around the Earth center)
+ * @param [in] x_m: X component of the position in the ECEF frame [m]
+ * @param [in] y_m: Y component of the position in the ECEF frame [m]
+ * @param [in] z_m: Z component of the position in the ECEF frame [m]
+ * @param [out] latitude_rad: Latitude [rad]
+ * @param [out] altitude_m: Altitude [m]
+ */
+inline void CalcGeodeticFromEcefVermeille(const double x_m, const double y_m, const double z_m, double& latitude_rad, double& altitude_m) {
+  const double earth_radius_m = environment::earth_equatorial_radius_m;
+  const double flattening = environment::earth_flattening;
+  const double e2 = flattening * (2.0 - flattening);
+  const double e4 = e2 * e2;
+
+  const double rho2_m2 = x_m * x_m + y_m * y_m;
+  const double p = rho2_m2 / (earth_radius_m * earth_radius_m);
+  const double q = (1.0 - e2) * z_m * z_m / (earth_radius_m * earth_radius_m);
+  const double r = (p + q - e4) / 6.0;
+  const double s = e4 * p * q / (4.0 * r * r * r);
+  const double t = std::cbrt(1.0 + s + std::sqrt(s * (2.0 + s)));
+  const double u = r * (1.0 + t + 1.0 / t);
+  const double v = std::sqrt(u * u + e4 * q);
+  const double w = e2 * (u + v - q) / (2.0 * v);
+  const double k = std::sqrt(u + v + w * w) - w;
+  const double d_m = k * std::sqrt(rho2_m2) / (k + e2);
+  const double d_z_m = std::sqrt(d_m * d_m + z_m * z_m);
+
+  latitude_rad = 2.0 * std::atan2(z_m, d_m + d_z_m);
+  altitude_m = (k + e2 - 1.0) / k * d_z_m;
+}
+}  // namespace
+
+GeodeticConversionMethod SetGeodeticConversionMethod(const std::string method) {
+  if (method == "VERMEILLE") return GeodeticConversionMethod::kVermeille;
+  return GeodeticConversionMethod::kIterative;
+}
 
 GeodeticPosition::GeodeticPosition() {
   latitude_rad_ = 0.0;
@@ -24,6 +65,13 @@ GeodeticPosition::GeodeticPosition(const double latitude_rad, const double longi
 }
 
 void GeodeticPosition::UpdateFromEcef(const libra::Vector<3> position_ecef_m) {
+  if (conversion_method_ == GeodeticConversionMethod::kVermeille) {
+    longitude_rad_ = FMod2p(AcTan(position_ecef_m[1], position_ecef_m[0]));
+    CalcGeodeticFromEcefVermeille(position_ecef_m[0], position_ecef_m[1], position_ecef_m[2], latitude_rad_, altitude_m_);
+    CalcQuaternionXcxfToLtc();
+    return;
+  }
+
   const double earth_radius_m = environment::earth_equatorial_radius_m;
   const double flattening = environment::earth_flattening;
 
@@ -52,6 +100,21 @@ void GeodeticPosition::UpdateFromEcef(const libra::Vector<3> position_ecef_m) {
   return;
 }
 
+void GeodeticPosition::CalcGeodeticFromEcef(const size_t number_of_points, const double* position_x_ecef_m, const double* position_y_ecef_m,
+                                            const double* position_z_ecef_m, double* latitude_rad, double* longitude_rad, double* altitude_m) {
+  const double* RESTRICT x_m = position_x_ecef_m;
+  const double* RESTRICT y_m = position_y_ecef_m;
+  const double* RESTRICT z_m = position_z_ecef_m;
+  double* RESTRICT lat_rad = latitude_rad;
+  double* RESTRICT lon_rad = longitude_rad;
+  double* RESTRICT alt_m = altitude_m;
+  for (size_t i = 0; i < number_of_points; i++) {
+    const double theta_rad = std::atan2(y_m[i], x_m[i]);
+    lon_rad[i] = theta_rad + libra::tau * (theta_rad < 0.0);
+    CalcGeodeticFromEcefVermeille(x_m[i], y_m[i], z_m[i], lat_rad[i], alt_m[i]);
+  }
+}
+
 libra::Vector<3> GeodeticPosition::CalcEcefPosition() const {
   const double earth_radius_m = environment::earth_equatorial_radius_m;
   const double flattening = environment::earth_flattening;
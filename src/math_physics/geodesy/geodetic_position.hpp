@@ -8,6 +8,23 @@
 
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <string>
+
+/**
+ * @enum GeodeticConversionMethod
+ * @brief Method to convert the ECEF position to the geodetic position
+ */
+enum class GeodeticConversionMethod {
+  kIterative,  //!< Fixed point iteration of the latitude until the convergence
+  kVermeille,  //!< Closed form solution (H. Vermeille, Journal of Geodesy, 2002) without iteration
+};
+
+/**
+ * @fn SetGeodeticConversionMethod
+ * @brief Convert string to GeodeticConversionMethod
+ * @param [in] method: Method name (ITERATIVE or VERMEILLE)
+ */
+GeodeticConversionMethod SetGeodeticConversionMethod(const std::string method);
 
 /**
  * @class GeodeticPosition
@@ -35,6 +52,20 @@ class GeodeticPosition {
    * @param [in] position_ecef_m: Position vector in the ECEF frame [m]
    */
   void UpdateFromEcef(const libra::Vector<3> position_ecef_m);
+  /**
+   * @fn CalcGeodeticFromEcef
+   * @brief Calculate the geodetic positions of many points at once with the closed form solution (e.g., constellations and ground tracks)
+   * @note The quaternion to the LTC frame is not calculated. The result is the same with UpdateFromEcef of kVermeille.
+   * @param [in] number_of_points: Number of points
+   * @param [in] position_x_ecef_m: X component of the positions in the ECEF frame [m]
+   * @param [in] position_y_ecef_m: Y component of the positions in the ECEF frame [m]
+   * @param [in] position_z_ecef_m: Z component of the positions in the ECEF frame [m]
+   * @param [out] latitude_rad: Latitude of each point [rad]
+   * @param [out] longitude_rad: Longitude of each point [rad] (0 to 2π east of the Greenwich meridian)
+   * @param [out] altitude_m: Altitude of each point [m]
+   */
+  static void CalcGeodeticFromEcef(const size_t number_of_points, const double* position_x_ecef_m, const double* position_y_ecef_m,
+                                   const double* position_z_ecef_m, double* latitude_rad, double* longitude_rad, double* altitude_m);
 
   /**
    * @fn CalcEcefPosition
@@ -42,6 +73,12 @@ class GeodeticPosition {
    */
   libra::Vector<3> CalcEcefPosition() const;
 
+  /**
+   * @fn SetConversionMethod
+   * @brief Set the method used in UpdateFromEcef
+   */
+  inline void SetConversionMethod(const GeodeticConversionMethod conversion_method) { conversion_method_ = conversion_method; }
+
   // Getter
   /**
    * @fn GetLatitude_rad
@@ -69,6 +106,8 @@ class GeodeticPosition {
   double longitude_rad_;  //!< Longitude [rad] East: 0 to π, West: 2π to π (i.e., defined as 0 to 2π [rad] east of the Greenwich meridian)
   double altitude_m_;     //!< Altitude [m]
 
+  GeodeticConversionMethod conversion_method_ = GeodeticConversionMethod::kIterative;  //!< Method used in UpdateFromEcef
+
   libra::Quaternion quaternion_xcxf_to_ltc_;  //!< Conversion quaternion from XCXF (e.g. ECEF) to LTC (Local Topographic Coordinate)
 
   /**
@@ -0,0 +1,62 @@
+/**
+ * @file test_geodetic_position.cpp
+ * @brief Test codes for GeodeticPosition class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "geodetic_position.hpp"
+
+/**
+ * @brief Test for the identity of the closed form conversion with the iterative conversion
+ */
+TEST(GeodeticPosition, VermeilleConversion) {
+  for (double altitude_m = -1000.0; altitude_m < 40000.0e3; altitude_m = altitude_m * 1.5 + 5000.0) {
+    for (double latitude_rad = -1.5; latitude_rad < 1.5; latitude_rad += 0.1) {
+      const GeodeticPosition reference(latitude_rad, 2.0, altitude_m);
+      const libra::Vector<3> position_ecef_m = reference.CalcEcefPosition();
+
+      GeodeticPosition iterative, vermeille;
+      vermeille.SetConversionMethod(GeodeticConversionMethod::kVermeille);
+      iterative.UpdateFromEcef(position_ecef_m);
+      vermeille.UpdateFromEcef(position_ecef_m);
+
+      EXPECT_NEAR(latitude_rad, vermeille.GetLatitude_rad(), 1e-12);
+      EXPECT_NEAR(2.0, vermeille.GetLongitude_rad(), 1e-12);
+      EXPECT_NEAR(altitude_m, vermeille.GetAltitude_m(), 1e-6);
+      EXPECT_NEAR(iterative.GetLatitude_rad(), vermeille.GetLatitude_rad(), 1e-9);
+      EXPECT_NEAR(iterative.GetAltitude_m(), vermeille.GetAltitude_m(), 1e-3);
+    }
+  }
+}
+
+/**
+ * @brief Test for the identity of the batch conversion with the single point conversion
+ */
+TEST(GeodeticPosition, BatchConversion) {
+  std::vector<double> x_m, y_m, z_m;
+  for (size_t i = 0; i < 101; i++) {
+    const GeodeticPosition reference(-1.5 + 0.03 * i, 0.0628 * i, 500.0e3 + 1.0e3 * i);
+    const libra::Vector<3> position_ecef_m = reference.CalcEcefPosition();
+    x_m.push_back(position_ecef_m[0]);
+    y_m.push_back(position_ecef_m[1]);
+    z_m.push_back(position_ecef_m[2]);
+  }
+  std::vector<double> latitude_rad(x_m.size()), longitude_rad(x_m.size()), altitude_m(x_m.size());
+  GeodeticPosition::CalcGeodeticFromEcef(x_m.size(), x_m.data(), y_m.data(), z_m.data(), latitude_rad.data(), longitude_rad.data(),
+                                         altitude_m.data());
+
+  for (size_t i = 0; i < x_m.size(); i++) {
+    GeodeticPosition vermeille;
+    vermeille.SetConversionMethod(GeodeticConversionMethod::kVermeille);
+    libra::Vector<3> position_ecef_m;
+    position_ecef_m[0] = x_m[i];
+    position_ecef_m[1] = y_m[i];
+    position_ecef_m[2] = z_m[i];
+    vermeille.UpdateFromEcef(position_ecef_m);
+    EXPECT_NEAR(vermeille.GetLatitude_rad(), latitude_rad[i], 1e-14);
+    EXPECT_NEAR(vermeille.GetLongitude_rad(), longitude_rad[i], 1e-14);
+    EXPECT_NEAR(vermeille.GetAltitude_m(), altitude_m[i], 1e-8);
+  }
+}
@@ -0,0 +1,51 @@
+/**
+ * @file benchmark_igrf.cpp
+ * @brief Benchmark codes for IGRF evaluation with the prepared coefficients compared with the legacy calculation
+ */
+#include <iostream>
+#include <string>
+#include <utilities/benchmark_measurement.hpp>
+#include <vector>
+
+#include "igrf.h"
+
+int main() {
+  const std::string file_path = std::string(CORE_DIR_FROM_EXE) + "/src/math_physics/geomagnetic/igrf13.coef";
+  set_file_path(file_path.c_str());
+
+  const double decyear = 2022.5;
+  const double latitude_rad = 0.6;
+  const double longitude_rad = 2.4;
+  const double altitude_m = 500.0e3;
+  const double sidereal_rad = 1.2;
+  const size_t number_of_calls = 200000;
+
+  IgrfCoefficients coefficients;
+  IgrfWorkspace workspace;
+  const double prepare_ns = MeasureNanosecondsPerCall([&]() { IgrfPrepareCoefficients(decyear, &coefficients); }, 10000);
+
+  double magnetic_field_i_nT[3] = {0.0, 0.0, 0.0};
+  const double legacy_ns = MeasureNanosecondsPerCall(
+      [&]() { IgrfCalc(decyear, latitude_rad, longitude_rad, altitude_m, sidereal_rad, magnetic_field_i_nT); }, number_of_calls);
+  std::cout << "prepare coefficients [ns/call], legacy full degree [ns/call]" << std::endl;
+  std::cout << prepare_ns << ", " << legacy_ns << std::endl;
+
+  std::cout << "degree, prepared evaluation [ns/call]" << std::endl;
+  const std::vector<int> degrees = {1, 4, 8, coefficients.max_degree};
+  for (int degree : degrees) {
+    double sum_z_nT = 0.0;
+    const double evaluate_ns = MeasureNanosecondsPerCall(
+        [&]() {
+          IgrfEvaluate(&coefficients, degree, latitude_rad, longitude_rad, altitude_m, sidereal_rad, &workspace, magnetic_field_i_nT);
+          sum_z_nT += magnetic_field_i_nT[2];
+        },
+        number_of_calls);
+    std::cout << degree << ", " << evaluate_ns << std::endl;
+    // Use the results to avoid optimization
+    if (sum_z_nT != sum_z_nT) {
+      std::cout << "NaN detected" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file geomagnetic_field_grid.cpp
+ * @brief Class to interpolate the geomagnetic field vectors on a spherical grid
+ */
+
+#include "geomagnetic_field_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <math_physics/math/constants.hpp>
+
+namespace libra {
+
+GeomagneticFieldGrid::GeomagneticFieldGrid(const Settings& settings,
+                                           const std::function<void(const double, const double, const double, double[3])>& calc_field)
+    : min_altitude_m_(settings.min_altitude_m), max_altitude_m_(std::max(settings.max_altitude_m, settings.min_altitude_m)) {
+  const double altitude_range_m = max_altitude_m_ - min_altitude_m_;
+  const size_t altitude_division = std::max((size_t)ceil(altitude_range_m / settings.altitude_step_m), (size_t)1);
+  const size_t latitude_division = std::max((size_t)ceil(pi / settings.latitude_step_rad), (size_t)1);
+  number_of_altitudes_ = altitude_division + 1;
+  number_of_latitudes_ = latitude_division + 1;
+  number_of_longitudes_ = std::max((size_t)ceil(tau / settings.longitude_step_rad), (size_t)1);
+  altitude_step_m_ = altitude_range_m / (double)altitude_division;
+  latitude_step_rad_ = pi / (double)latitude_division;
+  longitude_step_rad_ = tau / (double)number_of_longitudes_;
+
+  field_.resize(GetNumberOfGridPoints() * 3);
+  for (size_t i = 0; i < number_of_altitudes_; i++) {
+    const double altitude_m = min_altitude_m_ + altitude_step_m_ * (double)i;
+    for (size_t j = 0; j < number_of_latitudes_; j++) {
+      const double latitude_rad = -pi_2 + latitude_step_rad_ * (double)j;
+      for (size_t k = 0; k < number_of_longitudes_; k++) {
+        const double longitude_rad = longitude_step_rad_ * (double)k;
+        calc_field(altitude_m, latitude_rad, longitude_rad, &field_[GetOffset(i, j, k)]);
+      }
+    }
+  }
+}
+
+bool GeomagneticFieldGrid::CalcField(const double altitude_m, const double latitude_rad, const double longitude_rad, double field[3]) const {
+  if (!IsInRange(altitude_m)) return false;
+
+  // Altitude
+  double altitude_position = 0.0;
+  if (altitude_step_m_ > 0.0) altitude_position = (altitude_m - min_altitude_m_) / altitude_step_m_;
+  size_t i0 = std::min((size_t)altitude_position, number_of_altitudes_ - 1);
+  if (i0 == number_of_altitudes_ - 1 && i0 > 0) i0--;
+  const size_t i1 = std::min(i0 + 1, number_of_altitudes_ - 1);
+  const double wa = std::clamp(altitude_position - (double)i0, 0.0, 1.0);
+
+  // Latitude
+  const double latitude_position = std::clamp((latitude_rad + pi_2) / latitude_step_rad_, 0.0, (double)(number_of_latitudes_ - 1));
+  size_t j0 = (size_t)latitude_position;
+  if (j0 == number_of_latitudes_ - 1) j0--;
+  const size_t j1 = j0 + 1;
+  const double wb = latitude_position - (double)j0;
+
+  // Longitude (periodic)
+  double longitude_position = fmod(longitude_rad, tau) / longitude_step_rad_;
+  if (longitude_position < 0.0) longitude_position += (double)number_of_longitudes_;
+  size_t k0 = (size_t)longitude_position;
+  if (k0 >= number_of_longitudes_) k0 = 0;
+  const size_t k1 = (k0 + 1) % number_of_longitudes_;
+  const double wc = std::clamp(longitude_position - floor(longitude_position), 0.0, 1.0);
+
+  const double* f000 = &field_[GetOffset(i0, j0, k0)];
+  const double* f001 = &field_[GetOffset(i0, j0, k1)];
+  const double* f010 = &field_[GetOffset(i0, j1, k0)];
+  const double* f011 = &field_[GetOffset(i0, j1, k1)];
+  const double* f100 = &field_[GetOffset(i1, j0, k0)];
+  const double* f101 = &field_[GetOffset(i1, j0, k1)];
+  const double* f110 = &field_[GetOffset(i1, j1, k0)];
+  const double* f111 = &field_[GetOffset(i1, j1, k1)];
+  double interpolated[3];
+  for (size_t c = 0; c < 3; c++) {
+    const double f00 = f000[c] + (f001[c] - f000[c]) * wc;
+    const double f01 = f010[c] + (f011[c] - f010[c]) * wc;
+    const double f10 = f100[c] + (f101[c] - f100[c]) * wc;
+    const double f11 = f110[c] + (f111[c] - f110[c]) * wc;
+    const double f0 = f00 + (f01 - f00) * wb;
+    const double f1 = f10 + (f11 - f10) * wb;
+    interpolated[c] = f0 + (f1 - f0) * wa;
+    // The model can diverge at the grid points on the poles
+    if (!std::isfinite(interpolated[c])) return false;
+  }
+  for (size_t c = 0; c < 3; c++) field[c] = interpolated[c];
+  return true;
+}
+
+}  // namespace libra
@@ -0,0 +1,95 @@
+/**
+ * @file geomagnetic_field_grid.hpp
+ * @brief Class to interpolate the geomagnetic field vectors on a spherical grid
+ */
+
+#ifndef S2E_LIBRARY_GEOMAGNETIC_GEOMAGNETIC_FIELD_GRID_HPP_
+#define S2E_LIBRARY_GEOMAGNETIC_GEOMAGNETIC_FIELD_GRID_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class GeomagneticFieldGrid
+ * @brief Class to interpolate the geomagnetic field vectors on a grid of altitude shells, latitude, and longitude
+ * @details The field vectors are evaluated at all grid points in the constructor and interpolated trilinearly.
+ *          The vectors are stored in the earth fixed frame, which is smooth also near the poles. The instance is not modified after
+ *          the construction, so it can be shared between spacecraft and threads.
+ */
+class GeomagneticFieldGrid {
+ public:
+  /**
+   * @struct Settings
+   * @brief Grid settings
+   */
+  struct Settings {
+    double min_altitude_m = 200.0e3;        //!< Minimum altitude of the grid [m]
+    double max_altitude_m = 2000.0e3;       //!< Maximum altitude of the grid [m]
+    double altitude_step_m = 50.0e3;        //!< Altitude step of the grid [m]
+    double latitude_step_rad = 0.0872665;   //!< Latitude step of the grid [rad]
+    double longitude_step_rad = 0.0872665;  //!< Longitude step of the grid [rad]
+  };
+
+  /**
+   * @fn GeomagneticFieldGrid
+   * @brief Constructor
+   * @param [in] settings: Grid settings. The steps are adjusted to divide the ranges equally.
+   * @param [in] calc_field: Function to calculate the field vector in the earth fixed frame: (altitude_m, latitude_rad, longitude_rad, field)
+   */
+  GeomagneticFieldGrid(const Settings& settings, const std::function<void(const double, const double, const double, double[3])>& calc_field);
+
+  /**
+   * @fn CalcField
+   * @brief Interpolate the field vector
+   * @param [in] altitude_m: Geodetic altitude [m]
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [out] field: Field vector in the earth fixed frame with the unit of calc_field
+   * @return False when the altitude is out of the grid or the grid points around the position have non-finite values.
+   *         The field is not modified in this case.
+   */
+  bool CalcField(const double altitude_m, const double latitude_rad, const double longitude_rad, double field[3]) const;
+
+  // Getters
+  /**
+   * @fn IsInRange
+   * @return True when the altitude is covered by the grid
+   */
+  inline bool IsInRange(const double altitude_m) const { return min_altitude_m_ <= altitude_m && altitude_m <= max_altitude_m_; }
+  /**
+   * @fn GetNumberOfGridPoints
+   * @return Number of grid points
+   */
+  inline size_t GetNumberOfGridPoints() const { return number_of_altitudes_ * number_of_latitudes_ * number_of_longitudes_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the grid including the field vectors [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const { return sizeof(*this) + field_.capacity() * sizeof(double); }
+
+ private:
+  double min_altitude_m_;        //!< Minimum altitude of the grid [m]
+  double max_altitude_m_;        //!< Maximum altitude of the grid [m]
+  double altitude_step_m_;       //!< Altitude step of the grid [m]
+  double latitude_step_rad_;     //!< Latitude step of the grid [rad]
+  double longitude_step_rad_;    //!< Longitude step of the grid [rad]
+  size_t number_of_altitudes_;   //!< Number of altitude shells
+  size_t number_of_latitudes_;   //!< Number of latitudes including both poles
+  size_t number_of_longitudes_;  //!< Number of longitudes. The last longitude is connected to the first one.
+  std::vector<double> field_;    //!< Field vectors ordered by altitude, latitude, longitude, and component
+
+  /**
+   * @fn GetOffset
+   * @brief Return the offset of the vector of the grid point in field_
+   */
+  inline size_t GetOffset(const size_t altitude_index, const size_t latitude_index, const size_t longitude_index) const {
+    return ((altitude_index * number_of_latitudes_ + latitude_index) * number_of_longitudes_ + longitude_index) * 3;
+  }
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_GEOMAGNETIC_GEOMAGNETIC_FIELD_GRID_HPP_
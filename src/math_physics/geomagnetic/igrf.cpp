@@ -46,6 +46,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
 using namespace std;
 
 #include "../../math_physics/orbit/sgp4/sgp4ext.h"
@@ -64,7 +65,7 @@ double testglobal[3];
 
 // TODO: Consider how to fix the following constant values in this library copied from outside
 
-#define MxOD 19
+#define MxOD IGRF_MAX_DEGREE
 #define URAD (180. / 3.14159265359)
 
 #define PI 3.14159265358979323846
@@ -85,6 +86,10 @@ static double vgh[MxOD + 1][MxOD + 1], vght[MxOD + 1][MxOD + 1];
 // coeff file path
 static char coeff_file[256];
 
+// The functions use the global variables in this file, so they are serialized for the parallel simulation cases
+static std::mutex igrf_mutex;
+static bool is_coefficient_file_read = false;
+
 static void fcalc(void);
 
 void set_file_path(const char *fname) { strcpy(coeff_file, fname); }
@@ -441,14 +446,14 @@ int TransMagaxisToECI(const double *mag, double *pos, double lonrad, double thet
 // IGRFの計算を実行するメインルーチン
 // Output	:	mag[3]	ECI座標での磁界の値[nT]
 void IgrfCalc(double decyear, double latrad, double lonrad, double alt, double side, double *mag) {
-  static bool first_flg = true;
+  std::lock_guard<std::mutex> lock(igrf_mutex);
 
-  if (first_flg == true) {
+  if (is_coefficient_file_read == false) {
     // gigrf(10,decyear);	//ファイル読み込み
     // gigrf(11, decyear);
     // gigrf(12, decyear);
     gigrf(13, decyear);
-    first_flg = false;
+    is_coefficient_file_read = true;
   }
   tyear(decyear);  // 実行年の設定
   igrfc(latrad * RAD2DEG, lonrad * RAD2DEG, alt,
@@ -469,4 +474,102 @@ void IgrfCalc(double decyear, double latrad, double lonrad, double alt, double s
   testglobal[2] = mag[2];
 
   TransMagaxisToECI(mag, mag, lonrad, thetarad, side);
-}
\ No newline at end of file
+}
+
+void IgrfPrepareCoefficients(double decyear, IgrfCoefficients *coefficients) {
+  std::lock_guard<std::mutex> lock(igrf_mutex);
+
+  if (is_coefficient_file_read == false) {
+    gigrf(13, decyear);
+    is_coefficient_file_read = true;
+  }
+
+  // Same as tyear without modifying the global coefficients
+  const double dyear = decyear - tzero;
+  coefficients->decyear = decyear;
+  coefficients->max_degree = maxod;
+  for (int nn = 0; nn <= MxOD; nn++) {
+    for (int mm = 0; mm <= MxOD; mm++) {
+      coefficients->g[mm][nn] = gh[mm][nn] + ght[mm][nn] * dyear;
+    }
+  }
+}
+
+void IgrfEvaluate(const IgrfCoefficients *coefficients, int degree, double latrad, double lonrad, double alt, double side, IgrfWorkspace *workspace,
+                  double *mag) {
+  int nmax = coefficients->max_degree;
+  if (degree > 0 && degree < nmax) nmax = degree;
+  const double(*gc)[MxOD + 1] = coefficients->g;
+  double *wrar = workspace->rar;
+  double *wcsp = workspace->csp;
+  double *wsnp = workspace->snp;
+  double(*wp)[MxOD + 1] = workspace->p;
+
+  // Geocentric position on the WGS84 ellipsoid (same as mfldg with the constants set in gigrf)
+  const double wre = 6378.137;
+  const double wrp = wre * (1. - 1. / 298.25722);
+  const double wre2 = wre * wre, wrp2 = wrp * wrp;
+  const double wre4 = wre2 * wre2, wrp4 = wrp2 * wrp2;
+  const double hi = alt / 1000.;
+  // The angles are converted with URAD as mfldg since the recursion of the Legendre functions is sensitive near the poles
+  const double wslat = sin(latrad * RAD2DEG / URAD);
+  const double wslat2 = wslat * wslat;
+  const double wclat2 = 1. - wslat2;
+  const double rm2 = wre2 * wclat2 + wrp2 * wslat2;
+  const double rm = sqrt(rm2);
+  const double rrm = (wre4 * wclat2 + wrp4 * wslat2) / rm2;
+  const double wr = sqrt(rrm + 2. * hi * rm + hi * hi);
+  const double wcth = wslat * (hi + wrp2 / rm) / wr;
+  const double wsth = sqrt(1. - wcth * wcth);
+  const double wphi = lonrad * RAD2DEG / URAD;
+  const double wcph = cos(wphi);
+  const double wsph = sin(wphi);
+
+  // Same as fcalc up to the degree
+  double t, pn1m, tx, ty, tz;
+  int n, m;
+  t = 6371.2 / wr;
+  wrar[0] = t * t;
+  for (n = 0; n < nmax; n++) wrar[n + 1] = wrar[n] * t;
+  wp[0][0] = 1.;
+  wp[1][0] = 0.;
+  wp[0][1] = wcth;
+  wp[1][1] = wsth;
+  wp[2][0] = -wsth;
+  wp[2][1] = wcth;
+  for (n = 1; n < nmax; n++) {
+    wp[0][n + 1] = (wp[0][n] * wcth * (n + n + 1) - wp[0][n - 1] * n) / (n + 1);
+    wp[n + 2][0] = (wp[0][n + 1] * wcth - wp[0][n]) * (n + 1) / wsth;
+    for (m = 0; m <= n; m++) {
+      pn1m = wp[m][n + 1];
+      wp[m + 1][n + 1] = (wp[m][n] * (n + m + 1) - pn1m * wcth * (n - m + 1)) / wsth;
+      wp[n + 2][m + 1] = pn1m * (n + m + 2) * (n - m + 1) - wp[m + 1][n + 1] * wcth * (m + 1) / wsth;
+    }
+  }
+  wcsp[0] = 1.;
+  wsnp[0] = 0.;
+  for (m = 0; m < nmax; m++) {
+    wcsp[m + 1] = wcsp[m] * wcph - wsnp[m] * wsph;
+    wsnp[m + 1] = wsnp[m] * wcph + wcsp[m] * wsph;
+  }
+  double wx = 0., wy = 0., wz = 0.;
+  for (n = 0; n < nmax; n++) {
+    tx = gc[0][n + 1] * wp[n + 2][0];
+    ty = 0.;
+    tz = gc[0][n + 1] * wp[0][n + 1];
+    for (m = 0; m <= n; m++) {
+      tx += (gc[m + 1][n + 1] * wcsp[m + 1] + gc[n + 1][m] * wsnp[m + 1]) * wp[n + 2][m + 1];
+      ty += (gc[m + 1][n + 1] * wsnp[m + 1] - gc[n + 1][m] * wcsp[m + 1]) * wp[m + 1][n + 1] * (m + 1);
+      tz += (gc[m + 1][n + 1] * wcsp[m + 1] + gc[n + 1][m] * wsnp[m + 1]) * wp[m + 1][n + 1];
+    }
+    wx += wrar[n + 1] * tx;
+    wy += wrar[n + 1] * ty;
+    wz -= wrar[n + 1] * tz * (n + 2);
+  }
+  wy /= wsth;
+
+  mag[0] = wx;
+  mag[1] = wy;
+  mag[2] = wz;
+  TransMagaxisToECI(mag, mag, lonrad, acos(wcth), side);
+}
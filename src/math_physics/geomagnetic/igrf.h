@@ -7,6 +7,30 @@
 #ifndef __igrf_H__
 #define __igrf_H__
 
+#define IGRF_MAX_DEGREE 19  //!< Maximum degree supported by this library
+
+/**
+ * @struct IgrfCoefficients
+ * @brief Gauss coefficients interpolated at a time with the layout of the internal table of this library
+ * @note The coefficients are prepared by IgrfPrepareCoefficients and they can be reused for the evaluation near the time.
+ */
+struct IgrfCoefficients {
+  double decyear = 0.0;                                //!< Decimal year of the coefficients
+  int max_degree = 0;                                  //!< Maximum degree of the coefficients
+  double g[IGRF_MAX_DEGREE + 1][IGRF_MAX_DEGREE + 1];  //!< Coefficients scaled for the recursion of the Legendre functions
+};
+
+/**
+ * @struct IgrfWorkspace
+ * @brief Workspace for the evaluation of IGRF to avoid the global variables in this library
+ */
+struct IgrfWorkspace {
+  double rar[IGRF_MAX_DEGREE + 1];                     //!< Powers of the radius ratio
+  double csp[IGRF_MAX_DEGREE + 1];                     //!< cos(m * longitude)
+  double snp[IGRF_MAX_DEGREE + 1];                     //!< sin(m * longitude)
+  double p[IGRF_MAX_DEGREE + 2][IGRF_MAX_DEGREE + 1];  //!< Legendre functions and their derivatives
+};
+
 extern double testglobal[3];
 
 void set_file_path(const char *fname);
@@ -27,4 +51,28 @@ void igrfelement(double *mag, double *thetarad);
 int TransMagaxisToECI(const double *mag, double *pos, double lonrad, double thetarad, double gmst);
 void IgrfCalc(double decyear, double latrad, double lonrad, double alt, double side, double *mag);
 
+/**
+ * @fn IgrfPrepareCoefficients
+ * @brief Interpolate the Gauss coefficients at the time
+ * @note The coefficient file is read at the first call.
+ * @param [in] decyear: Decimal year [year]
+ * @param [out] coefficients: Interpolated coefficients
+ */
+void IgrfPrepareCoefficients(double decyear, IgrfCoefficients *coefficients);
+/**
+ * @fn IgrfEvaluate
+ * @brief Calculate the magnetic field with the prepared coefficients
+ * @note This function does not use the global variables in this library, so it can be called in parallel with different workspaces.
+ * @param [in] coefficients: Coefficients prepared by IgrfPrepareCoefficients
+ * @param [in] degree: Degree of the evaluation. The maximum degree of the coefficients is used when it is zero or larger than the maximum.
+ * @param [in] latrad: Geodetic latitude [rad]
+ * @param [in] lonrad: Longitude [rad]
+ * @param [in] alt: Altitude [m]
+ * @param [in] side: Greenwich sidereal time [rad]
+ * @param [in,out] workspace: Workspace
+ * @param [out] mag: Magnetic field in the ECI frame [nT]
+ */
+void IgrfEvaluate(const IgrfCoefficients *coefficients, int degree, double latrad, double lonrad, double alt, double side, IgrfWorkspace *workspace,
+                  double *mag);
+
 #endif  //__igrf_H__
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * @file test_geomagnetic_field_grid.cpp
+ * @brief Test codes for GeomagneticFieldGrid class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "geomagnetic_field_grid.hpp"
+
+namespace {
+/**
+ * @brief Tilted dipole field in the earth fixed frame on a spherical earth [nT]
+ */
+void CalcTestField(const double altitude_m, const double latitude_rad, const double longitude_rad, double field[3]) {
+  const double radius_m = 6371.2e3 + altitude_m;
+  const double position[3] = {radius_m * cos(latitude_rad) * cos(longitude_rad), radius_m * cos(latitude_rad) * sin(longitude_rad),
+                              radius_m * sin(latitude_rad)};
+  const double moment[3] = {1.0e4, -5.0e3, -3.0e4};  // Field at the equator on the surface [nT]
+  double dot = 0.0;
+  for (size_t i = 0; i < 3; i++) dot += moment[i] * position[i] / radius_m;
+  const double scale = pow(6371.2e3 / radius_m, 3.0);
+  for (size_t i = 0; i < 3; i++) field[i] = scale * (3.0 * dot * position[i] / radius_m - moment[i]);
+}
+}  // namespace
+
+/**
+ * @brief Test for the interpolation accuracy including the poles and the longitude wrapping
+ */
+TEST(GeomagneticFieldGrid, Interpolation) {
+  libra::GeomagneticFieldGrid::Settings settings;
+  settings.altitude_step_m = 50.0e3;
+  settings.latitude_step_rad = 2.0 * 3.141592653589793 / 180.0;
+  settings.longitude_step_rad = settings.latitude_step_rad;
+  libra::GeomagneticFieldGrid grid(settings, CalcTestField);
+
+  for (size_t i = 0; i <= 100; i++) {
+    const double altitude_m = 300.0e3 + 7.3e3 * (double)i;
+    const double latitude_rad = -1.5707963267948966 + 0.0314159 * (double)i;
+    const double longitude_rad = -3.5 + 0.07 * (double)i;
+    double expected[3];
+    double interpolated[3];
+    CalcTestField(altitude_m, latitude_rad, longitude_rad, expected);
+    EXPECT_TRUE(grid.CalcField(altitude_m, latitude_rad, longitude_rad, interpolated));
+    for (size_t c = 0; c < 3; c++) {
+      EXPECT_NEAR(expected[c], interpolated[c], 100.0);
+    }
+  }
+}
+
+/**
+ * @brief Test for the grid points and the altitude range
+ */
+TEST(GeomagneticFieldGrid, Range) {
+  libra::GeomagneticFieldGrid::Settings settings;
+  libra::GeomagneticFieldGrid grid(settings, CalcTestField);
+
+  double expected[3];
+  double interpolated[3] = {0.0, 0.0, 0.0};
+  CalcTestField(settings.max_altitude_m, 0.0, 0.0, expected);
+  EXPECT_TRUE(grid.CalcField(settings.max_altitude_m, 0.0, 0.0, interpolated));
+  for (size_t c = 0; c < 3; c++) {
+    EXPECT_NEAR(expected[c], interpolated[c], 1.0e-6);
+  }
+
+  EXPECT_FALSE(grid.CalcField(settings.min_altitude_m - 1.0, 0.0, 0.0, interpolated));
+  EXPECT_FALSE(grid.CalcField(settings.max_altitude_m + 1.0, 0.0, 0.0, interpolated));
+  EXPECT_NEAR(expected[0], interpolated[0], 1.0e-6);
+}
@@ -0,0 +1,38 @@
+/**
+ * @file test_igrf.cpp
+ * @brief Test codes for IGRF functions with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "igrf.h"
+
+/**
+ * @brief Test for the evaluation with the prepared coefficients against the legacy calculation
+ */
+TEST(Igrf, EvaluateMatchesLegacyCalculation) {
+  const std::string file_path = std::string(CORE_DIR_FROM_EXE) + "/src/math_physics/geomagnetic/igrf13.coef";
+  set_file_path(file_path.c_str());
+
+  IgrfCoefficients coefficients;
+  IgrfWorkspace workspace;
+  const double decyears[3] = {2020.0, 2022.37, 2024.9};
+  for (const double decyear : decyears) {
+    IgrfPrepareCoefficients(decyear, &coefficients);
+    for (size_t i = 0; i < 20; i++) {
+      const double latitude_rad = -1.5 + 0.15 * (double)i;
+      const double longitude_rad = -3.0 + 0.31 * (double)i;
+      const double altitude_m = 300.0e3 + 40.0e3 * (double)i;
+      const double sidereal_rad = 0.2 * (double)i;
+
+      double legacy_nT[3], evaluated_nT[3];
+      IgrfCalc(decyear, latitude_rad, longitude_rad, altitude_m, sidereal_rad, legacy_nT);
+      IgrfEvaluate(&coefficients, 0, latitude_rad, longitude_rad, altitude_m, sidereal_rad, &workspace, evaluated_nT);
+      for (size_t axis = 0; axis < 3; axis++) {
+        // Bit-identical
+        EXPECT_EQ(legacy_nT[axis], evaluated_nT[axis]);
+      }
+    }
+  }
+}
@@ -157,6 +157,7 @@ AntexSatelliteData AntexFileReader::ReadAntexSatelliteData(std::ifstream& antex_
 
 AntexPhaseCenterData AntexFileReader::ReadPhaseCenterData(std::ifstream& antex_file, const AntexGridDefinition grid_information) {
   AntexPhaseCenterData phase_center_data;
+  std::vector<std::vector<double>> phase_center_variation_matrix;
   std::string line;
   while (1) {
     std::getline(antex_file, line);
@@ -174,22 +175,29 @@ AntexPhaseCenterData AntexFileReader::ReadPhaseCenterData(std::ifstream& antex_f
       phase_center_data.SetPhaseCenterOffset_mm(offset);
     }
     // Phase center variation
+    // The NOAZI row is followed by the azimuth rows (the azimuth angle and the values) when DAZI is not zero
     if (line.find("NOAZI") != std::string::npos) {
-      std::vector<double> phase_center_variation;
-      for (size_t i = 0; i < grid_information.GetNumberOfZenithGrid(); i++) {
-        double parameter = std::stod(line.substr(8 + i * 8, 8));
-        phase_center_variation.push_back(parameter);
-      }
-      std::vector<std::vector<double>> phase_center_variation_matrix;
-      phase_center_variation_matrix.push_back(phase_center_variation);
-      phase_center_data.SetPhaseCenterVariationMatrix_mm(phase_center_variation_matrix);
+      phase_center_variation_matrix.push_back(ReadPhaseCenterVariationRow(line, grid_information));
+    } else if (!phase_center_variation_matrix.empty() && grid_information.GetNumberOfAzimuthGrid() > 0 &&
+               phase_center_variation_matrix.size() <= grid_information.GetNumberOfAzimuthGrid()) {
+      phase_center_variation_matrix.push_back(ReadPhaseCenterVariationRow(line, grid_information));
     }
-    // TODO: implement DAZI
   }
+  phase_center_data.SetPhaseCenterVariationMatrix_mm(phase_center_variation_matrix);
 
   return phase_center_data;
 }
 
+std::vector<double> AntexFileReader::ReadPhaseCenterVariationRow(const std::string line, const AntexGridDefinition& grid_information) {
+  std::vector<double> phase_center_variation;
+  for (size_t i = 0; i < grid_information.GetNumberOfZenithGrid(); i++) {
+    if (line.size() < 8 + (i + 1) * 8) break;
+    double parameter = std::stod(line.substr(8 + i * 8, 8));
+    phase_center_variation.push_back(parameter);
+  }
+  return phase_center_variation;
+}
+
 DateTime AntexFileReader::ReadDateTime(std::string line) {
   size_t year, month, day, hour, minute;
   double second;
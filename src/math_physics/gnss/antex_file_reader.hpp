@@ -114,8 +114,6 @@ class AntexPhaseCenterData {
    */
   ~AntexPhaseCenterData() {}
 
-  // TODO: Implement phase center variation calculation from the matrix
-
   // Setter
   /**
    * @fn SetFrequencyName
@@ -134,7 +132,7 @@ class AntexPhaseCenterData {
   inline void SetGridInformation(const AntexGridDefinition grid_information) { grid_information_ = grid_information; }
   /**
    * @fn SetPhaseCenterVariationMatrix_mm
-   * @param[in] phase_center_variation_matrix_mm: Phase center variation matrix (azimuth, zenith) [mm]
+   * @param[in] phase_center_variation_matrix_mm: Phase center variation matrix (NOAZI row followed by the azimuth rows, zenith) [mm]
    */
   inline void SetPhaseCenterVariationMatrix_mm(const std::vector<std::vector<double>> phase_center_variation_matrix_mm) {
     phase_center_variation_matrix_mm_ = phase_center_variation_matrix_mm;
@@ -155,18 +153,19 @@ class AntexPhaseCenterData {
    * @fn GetGridInformation
    * @return Grid information
    */
-  inline AntexGridDefinition GetGridInformation() const { return grid_information_; }
+  inline const AntexGridDefinition& GetGridInformation() const { return grid_information_; }
   /**
    * @fn GetPhaseCenterVariationMatrix_mm
-   * @return Phase center variation matrix [mm] (column, row definition: [azimuth][zenith])
+   * @note Use AntexPhaseCenterVariationGrid for the interpolation
+   * @return Phase center variation matrix [mm] (column, row definition: [azimuth][zenith]. [0] is NOAZI, and [1 + i] is the i-th azimuth grid.)
    */
-  inline std::vector<std::vector<double>> GetPhaseCenterVariationMatrix_mm() const { return phase_center_variation_matrix_mm_; }
+  inline const std::vector<std::vector<double>>& GetPhaseCenterVariationMatrix_mm() const { return phase_center_variation_matrix_mm_; }
 
  private:
   std::string frequency_name_ = "";                                    //!< Frequency name
   libra::Vector<3> phase_center_offset_mm_{0.0};                       //!< Phase center offset [mm]
   AntexGridDefinition grid_information_;                               //!< Grid information
-  std::vector<std::vector<double>> phase_center_variation_matrix_mm_;  //!< Phase center variation [mm] (column, row definition: [azimuth][zenith])
+  std::vector<std::vector<double>> phase_center_variation_matrix_mm_;  //!< Phase center variation [mm] (NOAZI row followed by the azimuth rows)
 };
 
 /**
@@ -249,7 +248,7 @@ class AntexSatelliteData {
    * @param[in] frequency_index: Frequency index start from 0
    * @return Antenna phase center data
    */
-  inline AntexPhaseCenterData GetPhaseCenterData(const size_t frequency_index) const { return phase_center_data_[frequency_index]; };
+  inline const AntexPhaseCenterData& GetPhaseCenterData(const size_t frequency_index) const { return phase_center_data_[frequency_index]; };
 
  private:
   std::string antenna_type_;                             //!< Antenna type
@@ -296,9 +295,15 @@ class AntexFileReader {
    * @param[in] satellite_index: GNSS satellite index used in S2E
    * @return ANTEX data list for the GNSS satellite (including several valid time data)
    */
-  inline std::vector<AntexSatelliteData> GetAntexSatelliteData(const size_t satellite_index) const {
+  inline const std::vector<AntexSatelliteData>& GetAntexSatelliteData(const size_t satellite_index) const {
     return antex_satellite_data_.at(satellite_index);
   };
+  /**
+   * @fn IsAntexSatelliteDataAvailable
+   * @param[in] satellite_index: GNSS satellite index used in S2E
+   * @return True when the ANTEX data of the GNSS satellite is read
+   */
+  inline bool IsAntexSatelliteDataAvailable(const size_t satellite_index) const { return antex_satellite_data_.count(satellite_index) > 0; }
 
  private:
   bool is_file_read_succeeded_;                                             //!< File read success flag
@@ -334,6 +339,14 @@ class AntexFileReader {
    * @return ANTEX phase center data
    */
   AntexPhaseCenterData ReadPhaseCenterData(std::ifstream& antex_file, const AntexGridDefinition grid_information);
+  /**
+   * @fn ReadPhaseCenterVariationRow
+   * @brief Read a row of the phase center variation (NOAZI or an azimuth)
+   * @param[in] line: A single line in ANTEX file
+   * @param[in] grid_information: Grid information
+   * @return Phase center variation at the zenith grid [mm]
+   */
+  std::vector<double> ReadPhaseCenterVariationRow(const std::string line, const AntexGridDefinition& grid_information);
   /**
    * @fn ReadDateTime
    * @brief Read date time information in ANTEX file
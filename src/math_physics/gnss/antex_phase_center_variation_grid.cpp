@@ -0,0 +1,58 @@
+/**
+ * @file antex_phase_center_variation_grid.cpp
+ * @brief Phase center variation map of ANTEX in a contiguous array with the bilinear interpolation
+ */
+
+#include "antex_phase_center_variation_grid.hpp"
+
+#include <cmath>
+
+AntexPhaseCenterVariationGrid::AntexPhaseCenterVariationGrid(const AntexPhaseCenterData& phase_center_data) {
+  const AntexGridDefinition& grid = phase_center_data.GetGridInformation();
+  const std::vector<std::vector<double>>& matrix_mm = phase_center_data.GetPhaseCenterVariationMatrix_mm();
+  number_of_zenith_grid_ = grid.GetNumberOfZenithGrid();
+  if (matrix_mm.empty() || number_of_zenith_grid_ == 0) return;
+
+  zenith_start_angle_deg_ = grid.GetZenithStartAngle_deg();
+  inverse_zenith_step_deg_ = 1.0 / grid.GetZenithStepAngle_deg();
+
+  // The first row is NOAZI, and the azimuth rows follow it when DAZI is not zero
+  size_t first_row = 0;
+  if (grid.GetNumberOfAzimuthGrid() > 1 && matrix_mm.size() == grid.GetNumberOfAzimuthGrid() + 1) {
+    first_row = 1;
+    number_of_azimuth_grid_ = grid.GetNumberOfAzimuthGrid();
+    inverse_azimuth_step_deg_ = 1.0 / grid.GetAzimuthStepAngle_deg();
+  }
+
+  values_mm_.assign(number_of_azimuth_grid_ * number_of_zenith_grid_, 0.0);
+  for (size_t azimuth = 0; azimuth < number_of_azimuth_grid_; azimuth++) {
+    const std::vector<double>& row_mm = matrix_mm[first_row + azimuth];
+    for (size_t zenith = 0; zenith < number_of_zenith_grid_ && zenith < row_mm.size(); zenith++) {
+      values_mm_[azimuth * number_of_zenith_grid_ + zenith] = row_mm[zenith];
+    }
+  }
+}
+
+double AntexPhaseCenterVariationGrid::CalcPhaseCenterVariation_mm(const double zenith_angle_deg, const double azimuth_angle_deg) const {
+  if (values_mm_.empty()) return 0.0;
+
+  // Zenith cell
+  double zenith_position = (zenith_angle_deg - zenith_start_angle_deg_) * inverse_zenith_step_deg_;
+  if (zenith_position < 0.0) zenith_position = 0.0;
+  size_t zenith_index = (size_t)zenith_position;
+  if (zenith_index >= number_of_zenith_grid_) zenith_index = number_of_zenith_grid_ - 1;
+  const double zenith_ratio = zenith_position - (double)zenith_index;
+  if (!IsAzimuthDependent()) return CalcZenithInterpolation_mm(values_mm_.data(), zenith_index, zenith_ratio);
+
+  // Azimuth cell. The last azimuth grid point is 360 deg, so the upper index does not wrap.
+  const double wrapped_azimuth_deg = azimuth_angle_deg - 360.0 * std::floor(azimuth_angle_deg / 360.0);
+  const double azimuth_position = wrapped_azimuth_deg * inverse_azimuth_step_deg_;
+  size_t azimuth_index = (size_t)azimuth_position;
+  if (azimuth_index >= number_of_azimuth_grid_ - 1) azimuth_index = number_of_azimuth_grid_ - 2;
+  const double azimuth_ratio = azimuth_position - (double)azimuth_index;
+
+  const double* lower_row = values_mm_.data() + azimuth_index * number_of_zenith_grid_;
+  const double lower_mm = CalcZenithInterpolation_mm(lower_row, zenith_index, zenith_ratio);
+  const double upper_mm = CalcZenithInterpolation_mm(lower_row + number_of_zenith_grid_, zenith_index, zenith_ratio);
+  return lower_mm + azimuth_ratio * (upper_mm - lower_mm);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file antex_phase_center_variation_grid.hpp
+ * @brief Phase center variation map of ANTEX in a contiguous array with the bilinear interpolation
+ */
+
+#ifndef S2E_LIBRARY_GNSS_ANTEX_PHASE_CENTER_VARIATION_GRID_HPP_
+#define S2E_LIBRARY_GNSS_ANTEX_PHASE_CENTER_VARIATION_GRID_HPP_
+
+#include <vector>
+
+#include "antex_file_reader.hpp"
+
+/**
+ * @class AntexPhaseCenterVariationGrid
+ * @brief Phase center variation map of ANTEX in a contiguous array with the bilinear interpolation
+ * @details The map is copied once from AntexPhaseCenterData in the azimuth-major order, and the lookups calculate the cell indices directly
+ *          from the angles without any search or copy. The azimuth independent map (NOAZI) is used when the azimuth rows are not available.
+ */
+class AntexPhaseCenterVariationGrid {
+ public:
+  /**
+   * @fn AntexPhaseCenterVariationGrid
+   * @brief Default constructor. The variation is zero.
+   */
+  AntexPhaseCenterVariationGrid() {}
+  /**
+   * @fn AntexPhaseCenterVariationGrid
+   * @brief Constructor
+   * @param [in] phase_center_data: Phase center data of ANTEX
+   */
+  explicit AntexPhaseCenterVariationGrid(const AntexPhaseCenterData& phase_center_data);
+
+  /**
+   * @fn CalcPhaseCenterVariation_mm
+   * @brief Calculate the phase center variation with the bilinear interpolation
+   * @note The zenith angle is clamped in the grid range, and the azimuth angle is wrapped in [0, 360).
+   * @param [in] zenith_angle_deg: Zenith angle (nadir angle for GNSS satellites) [deg]
+   * @param [in] azimuth_angle_deg: Azimuth angle [deg]. It is ignored for the azimuth independent map.
+   * @return Phase center variation [mm]
+   */
+  double CalcPhaseCenterVariation_mm(const double zenith_angle_deg, const double azimuth_angle_deg = 0.0) const;
+
+  /**
+   * @fn IsAzimuthDependent
+   * @brief Return true when the map depends on the azimuth angle
+   */
+  inline bool IsAzimuthDependent() const { return number_of_azimuth_grid_ > 1; }
+  /**
+   * @fn IsEmpty
+   * @brief Return true when the map has no value
+   */
+  inline bool IsEmpty() const { return values_mm_.empty(); }
+
+ private:
+  double zenith_start_angle_deg_ = 0.0;    //!< Zenith grid start angle [deg]
+  double inverse_zenith_step_deg_ = 0.0;   //!< Inverse of the zenith grid step angle [1/deg]
+  double inverse_azimuth_step_deg_ = 0.0;  //!< Inverse of the azimuth grid step angle [1/deg]
+  size_t number_of_zenith_grid_ = 0;       //!< Number of zenith grid
+  size_t number_of_azimuth_grid_ = 1;      //!< Number of azimuth grid including 360 deg (1 for the azimuth independent map)
+  std::vector<double> values_mm_;          //!< Phase center variation [mm] ([azimuth * number_of_zenith_grid_ + zenith])
+
+  /**
+   * @fn CalcZenithInterpolation_mm
+   * @brief Calculate the linear interpolation along the zenith angle in an azimuth row
+   * @param [in] row: Pointer to the first value of the azimuth row
+   * @param [in] zenith_index: Index of the lower zenith grid point
+   * @param [in] zenith_ratio: Normalized zenith position in the cell [0, 1]
+   */
+  inline double CalcZenithInterpolation_mm(const double* row, const size_t zenith_index, const double zenith_ratio) const {
+    if (zenith_index + 1 >= number_of_zenith_grid_) return row[number_of_zenith_grid_ - 1];
+    return row[zenith_index] + zenith_ratio * (row[zenith_index + 1] - row[zenith_index]);
+  }
+};
+
+#endif  // S2E_LIBRARY_GNSS_ANTEX_PHASE_CENTER_VARIATION_GRID_HPP_
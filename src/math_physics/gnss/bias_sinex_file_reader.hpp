@@ -77,6 +77,7 @@ class BiasSolutionData {
   // Getters
   inline BiasIdentifier GetIdentifier() { return identifier_; }
   inline std::string GetSatelliteSvnCode() { return satellite_svn_code_; }
+  inline std::string GetSatelliteNumber() { return satellite_number_; }
   inline std::string GetStationName() { return station_name_; }
   inline BiasTargetSignal GetTargetSignal() { return target_signal_; }
   inline BiasUnit GetUnit() { return unit_; }
@@ -0,0 +1,185 @@
+/**
+ * @file gnss_satellite_state_table.cpp
+ * @brief Table of the GNSS satellite positions and clock offsets sampled at a fixed cadence
+ */
+
+#include "gnss_satellite_state_table.hpp"
+
+#include <cmath>
+#include <utilities/macros.hpp>
+
+void GnssSatelliteStateTable::Build(const double start_time_s, const double step_s, const size_t number_of_steps, const size_t number_of_satellites,
+                                    const Sampler& sampler) {
+  start_time_s_ = start_time_s;
+  step_s_ = step_s;
+  number_of_steps_ = step_s > 0.0 ? number_of_steps : 0;
+  number_of_satellites_ = number_of_satellites;
+  if (number_of_steps_ == 0) return;
+
+  const size_t number_of_points = number_of_steps_ + 1;
+  const size_t number_of_guarded_points = number_of_points + 2 * kNumberOfGuardPoints;
+  for (size_t i = 0; i < 4; i++) guarded_samples_[i].resize(number_of_guarded_points * number_of_satellites_);
+  is_valid_.assign(number_of_satellites_, 1);
+
+  // Sampling
+  for (size_t point = 0; point < number_of_guarded_points; point++) {
+    const double time_s = start_time_s_ + step_s_ * ((double)point - (double)kNumberOfGuardPoints);
+    for (size_t satellite = 0; satellite < number_of_satellites_; satellite++) {
+      libra::Vector<3> position_m(0.0);
+      double clock_offset_s = 0.0;
+      if (!sampler(satellite, time_s, position_m, clock_offset_s)) is_valid_[satellite] = 0;
+      const size_t index = point * number_of_satellites_ + satellite;
+      for (size_t axis = 0; axis < 3; axis++) guarded_samples_[axis][index] = position_m[axis];
+      guarded_samples_[3][index] = clock_offset_s;
+    }
+  }
+
+  // Grid points and the time derivatives with the five-point central difference
+  const size_t number_of_states = number_of_points * number_of_satellites_;
+  for (size_t axis = 0; axis < 3; axis++) {
+    position_m_[axis].resize(number_of_states);
+    velocity_m_s_[axis].resize(number_of_states);
+  }
+  clock_offset_s_.resize(number_of_states);
+  clock_drift_s_s_.resize(number_of_states);
+
+  const double coefficient = 1.0 / (12.0 * step_s_);
+  const size_t n = number_of_satellites_;
+  for (size_t i = 0; i < 4; i++) {
+    // The grid point p corresponds to the guarded point p + 2
+    const double* RESTRICT samples = guarded_samples_[i].data();
+    double* RESTRICT values = i < 3 ? position_m_[i].data() : clock_offset_s_.data();
+    double* RESTRICT derivatives = i < 3 ? velocity_m_s_[i].data() : clock_drift_s_s_.data();
+    for (size_t j = 0; j < number_of_states; j++) {
+      const size_t k = j + kNumberOfGuardPoints * n;
+      values[j] = samples[k];
+      derivatives[j] = coefficient * (samples[k - 2 * n] - 8.0 * samples[k - n] + 8.0 * samples[k + n] - samples[k + 2 * n]);
+    }
+  }
+
+  // The invalid satellites are zero for CalcPositionArray_m
+  for (size_t satellite = 0; satellite < number_of_satellites_; satellite++) {
+    if (is_valid_[satellite]) continue;
+    for (size_t point = 0; point < number_of_points; point++) {
+      const size_t index = point * number_of_satellites_ + satellite;
+      for (size_t axis = 0; axis < 3; axis++) {
+        position_m_[axis][index] = 0.0;
+        velocity_m_s_[axis][index] = 0.0;
+      }
+    }
+  }
+}
+
+bool GnssSatelliteStateTable::FindInterval(const double time_s, size_t& index, double& ratio) const {
+  if (!IsInRange(time_s)) return false;
+  const double position = (time_s - start_time_s_) / step_s_;
+  index = (size_t)position;
+  if (index >= number_of_steps_) index = number_of_steps_ - 1;  // The end point is in the last interval
+  ratio = position - (double)index;
+  return true;
+}
+
+bool GnssSatelliteStateTable::CalcState(const size_t satellite_index, const double time_s, libra::Vector<3>& position_m,
+                                        double& clock_offset_s) const {
+  if (!IsValid(satellite_index)) return false;
+  size_t index;
+  double s;
+  if (!FindInterval(time_s, index, s)) return false;
+
+  // Cubic Hermite basis with the normalized time s in [0, 1]
+  const double s2 = s * s, s3 = s2 * s;
+  const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+  const double h10 = (s3 - 2.0 * s2 + s) * step_s_;
+  const double h01 = -2.0 * s3 + 3.0 * s2;
+  const double h11 = (s3 - s2) * step_s_;
+  const size_t i0 = index * number_of_satellites_ + satellite_index;
+  const size_t i1 = i0 + number_of_satellites_;
+  for (size_t axis = 0; axis < 3; axis++) {
+    const double* p = position_m_[axis].data();
+    const double* v = velocity_m_s_[axis].data();
+    position_m[axis] = h00 * p[i0] + h10 * v[i0] + h01 * p[i1] + h11 * v[i1];
+  }
+  clock_offset_s = h00 * clock_offset_s_[i0] + h10 * clock_drift_s_s_[i0] + h01 * clock_offset_s_[i1] + h11 * clock_drift_s_s_[i1];
+  return true;
+}
+
+bool GnssSatelliteStateTable::CalcPositionArray_m(const double time_s, std::vector<double> (&positions_m)[3]) const {
+  size_t index;
+  double s;
+  if (!FindInterval(time_s, index, s)) return false;
+
+  const double s2 = s * s, s3 = s2 * s;
+  const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+  const double h10 = (s3 - 2.0 * s2 + s) * step_s_;
+  const double h01 = -2.0 * s3 + 3.0 * s2;
+  const double h11 = (s3 - s2) * step_s_;
+  const size_t offset = index * number_of_satellites_;
+  for (size_t axis = 0; axis < 3; axis++) {
+    if (positions_m[axis].size() != number_of_satellites_) positions_m[axis].resize(number_of_satellites_);
+    const double* RESTRICT p0 = position_m_[axis].data() + offset;
+    const double* RESTRICT v0 = velocity_m_s_[axis].data() + offset;
+    const double* RESTRICT p1 = p0 + number_of_satellites_;
+    const double* RESTRICT v1 = v0 + number_of_satellites_;
+    double* RESTRICT output = positions_m[axis].data();
+    for (size_t i = 0; i < number_of_satellites_; i++) {
+      output[i] = h00 * p0[i] + h10 * v0[i] + h01 * p1[i] + h11 * v1[i];
+    }
+  }
+  return true;
+}
+
+bool GnssSatelliteStateTable::CalcStateArray(const std::vector<size_t>& satellite_indices, const std::vector<double>& times_s,
+                                             std::vector<double> (&positions_m)[3], std::vector<double> (&velocities_m_s)[3],
+                                             std::vector<double>& clock_offsets_s, std::vector<double>& clock_drifts_s_s) const {
+  const size_t number_of_states = satellite_indices.size();
+  if (times_s.size() != number_of_states) return false;
+  for (size_t i = 0; i < number_of_states; i++) {
+    if (!IsValid(satellite_indices[i]) || !IsInRange(times_s[i])) return false;
+  }
+  for (size_t axis = 0; axis < 3; axis++) {
+    positions_m[axis].resize(number_of_states);
+    velocities_m_s[axis].resize(number_of_states);
+  }
+  clock_offsets_s.resize(number_of_states);
+  clock_drifts_s_s.resize(number_of_states);
+
+  const double inverse_step = 1.0 / step_s_;
+  for (size_t i = 0; i < number_of_states; i++) {
+    size_t index;
+    double s;
+    FindInterval(times_s[i], index, s);
+
+    // Cubic Hermite basis and the time derivatives
+    const double s2 = s * s, s3 = s2 * s;
+    const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    const double h10 = (s3 - 2.0 * s2 + s) * step_s_;
+    const double h01 = -2.0 * s3 + 3.0 * s2;
+    const double h11 = (s3 - s2) * step_s_;
+    const double dh00 = (6.0 * s2 - 6.0 * s) * inverse_step;
+    const double dh10 = 3.0 * s2 - 4.0 * s + 1.0;
+    const double dh11 = 3.0 * s2 - 2.0 * s;
+    const size_t i0 = index * number_of_satellites_ + satellite_indices[i];
+    const size_t i1 = i0 + number_of_satellites_;
+    for (size_t axis = 0; axis < 3; axis++) {
+      const double* p = position_m_[axis].data();
+      const double* v = velocity_m_s_[axis].data();
+      positions_m[axis][i] = h00 * p[i0] + h10 * v[i0] + h01 * p[i1] + h11 * v[i1];
+      velocities_m_s[axis][i] = dh00 * (p[i0] - p[i1]) + dh10 * v[i0] + dh11 * v[i1];
+    }
+    const double* c = clock_offset_s_.data();
+    const double* d = clock_drift_s_s_.data();
+    clock_offsets_s[i] = h00 * c[i0] + h10 * d[i0] + h01 * c[i1] + h11 * d[i1];
+    clock_drifts_s_s[i] = dh00 * (c[i0] - c[i1]) + dh10 * d[i0] + dh11 * d[i1];
+  }
+  return true;
+}
+
+size_t GnssSatelliteStateTable::GetMemoryUsage_bytes() const {
+  size_t bytes = sizeof(*this);
+  for (size_t axis = 0; axis < 3; axis++) {
+    bytes += (position_m_[axis].capacity() + velocity_m_s_[axis].capacity()) * sizeof(double);
+  }
+  for (const auto& samples : guarded_samples_) bytes += samples.capacity() * sizeof(double);
+  bytes += (clock_offset_s_.capacity() + clock_drift_s_s_.capacity()) * sizeof(double) + is_valid_.capacity();
+  return bytes;
+}
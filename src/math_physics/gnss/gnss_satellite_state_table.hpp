@@ -0,0 +1,153 @@
+/**
+ * @file gnss_satellite_state_table.hpp
+ * @brief Table of the GNSS satellite positions and clock offsets sampled at a fixed cadence
+ */
+
+#ifndef S2E_LIBRARY_GNSS_GNSS_SATELLITE_STATE_TABLE_HPP_
+#define S2E_LIBRARY_GNSS_GNSS_SATELLITE_STATE_TABLE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "../math/vector.hpp"
+
+/**
+ * @class GnssSatelliteStateTable
+ * @brief Table of the GNSS satellite positions and clock offsets sampled at a fixed cadence
+ * @details The positions and the clock offsets of all satellites are sampled once at the grid points in the structure of arrays layout
+ *          (sample-major, so the states of all satellites at a grid point are contiguous). Their time derivatives are calculated with the
+ *          five-point central difference of the samples including two guard points at each side, and the states at any time in the table
+ *          range are calculated with the cubic Hermite interpolation. The buffers are reused when the table is rebuilt.
+ */
+class GnssSatelliteStateTable {
+ public:
+  /**
+   * @fn GnssSatelliteStateTable
+   * @brief Default constructor. The table is empty.
+   */
+  GnssSatelliteStateTable() {}
+
+  /**
+   * @typedef Sampler
+   * @brief Function to calculate the state of a satellite
+   * @note Arguments: satellite index, time [s], position [m] (output), clock offset [s] (output). Return false when the state is not available.
+   */
+  typedef std::function<bool(const size_t, const double, libra::Vector<3>&, double&)> Sampler;
+
+  /**
+   * @fn Build
+   * @brief Sample the states of all satellites and build the table
+   * @param [in] start_time_s: Time of the first grid point [s]
+   * @param [in] step_s: Interval of the grid points [s]
+   * @param [in] number_of_steps: Number of the intervals in the table range
+   * @param [in] number_of_satellites: Number of satellites
+   * @param [in] sampler: Function to calculate the state of a satellite. It is called at the grid points and the guard points.
+   */
+  void Build(const double start_time_s, const double step_s, const size_t number_of_steps, const size_t number_of_satellites,
+             const Sampler& sampler);
+  /**
+   * @fn Clear
+   * @brief Clear the table range. The buffers are kept.
+   */
+  inline void Clear() { number_of_steps_ = 0; }
+
+  /**
+   * @fn IsInRange
+   * @brief Return true when the time is in the table range
+   * @param [in] time_s: Time [s]
+   */
+  inline bool IsInRange(const double time_s) const {
+    return number_of_steps_ > 0 && time_s >= start_time_s_ && time_s <= start_time_s_ + step_s_ * (double)number_of_steps_;
+  }
+  /**
+   * @fn IsValid
+   * @brief Return true when the states of the satellite are available at all sampled points
+   * @param [in] satellite_index: Index of the satellite
+   */
+  inline bool IsValid(const size_t satellite_index) const { return satellite_index < is_valid_.size() && is_valid_[satellite_index] != 0; }
+
+  /**
+   * @fn CalcState
+   * @brief Calculate the state of a satellite with the cubic Hermite interpolation
+   * @param [in] satellite_index: Index of the satellite
+   * @param [in] time_s: Time [s]
+   * @param [out] position_m: Position [m]
+   * @param [out] clock_offset_s: Clock offset [s]
+   * @return False when the time is out of range or the satellite is not valid. The outputs are not modified in this case.
+   */
+  bool CalcState(const size_t satellite_index, const double time_s, libra::Vector<3>& position_m, double& clock_offset_s) const;
+  /**
+   * @fn CalcPositionArray_m
+   * @brief Calculate the positions of all satellites with the cubic Hermite interpolation
+   * @note The positions of the invalid satellites are zero.
+   * @param [in] time_s: Time [s]
+   * @param [out] positions_m: Positions for each axis [m]. The arrays are resized only when the number of satellites is changed.
+   * @return False when the time is out of range. The outputs are not modified in this case.
+   */
+  bool CalcPositionArray_m(const double time_s, std::vector<double> (&positions_m)[3]) const;
+  /**
+   * @fn CalcStateArray
+   * @brief Calculate the states of the listed satellites at their own times with the cubic Hermite interpolation
+   * @note It is used in the batched iterations of the signal transmission time, where the time differs for each satellite.
+   * @param [in] satellite_indices: Indices of the satellites
+   * @param [in] times_s: Time for each listed satellite [s]
+   * @param [out] positions_m: Positions for each axis [m]
+   * @param [out] velocities_m_s: Velocities for each axis [m/s]
+   * @param [out] clock_offsets_s: Clock offsets [s]
+   * @param [out] clock_drifts_s_s: Clock drifts [s/s]
+   * @return False when a time is out of range or a satellite is not valid. The outputs are not modified in this case.
+   */
+  bool CalcStateArray(const std::vector<size_t>& satellite_indices, const std::vector<double>& times_s, std::vector<double> (&positions_m)[3],
+                      std::vector<double> (&velocities_m_s)[3], std::vector<double>& clock_offsets_s, std::vector<double>& clock_drifts_s_s) const;
+
+  // Getters
+  /**
+   * @fn GetStartTime_s
+   * @brief Return time of the first grid point [s]
+   */
+  inline double GetStartTime_s() const { return start_time_s_; }
+  /**
+   * @fn GetEndTime_s
+   * @brief Return time of the last grid point [s]
+   */
+  inline double GetEndTime_s() const { return start_time_s_ + step_s_ * (double)number_of_steps_; }
+  /**
+   * @fn GetNumberOfSatellites
+   * @brief Return number of satellites
+   */
+  inline size_t GetNumberOfSatellites() const { return number_of_satellites_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @brief Return the memory of the table [bytes]
+   */
+  size_t GetMemoryUsage_bytes() const;
+
+ private:
+  static const size_t kNumberOfGuardPoints = 2;  //!< Number of the guard points at each side for the central difference
+
+  double start_time_s_ = 0.0;        //!< Time of the first grid point [s]
+  double step_s_ = 1.0;              //!< Interval of the grid points [s]
+  size_t number_of_steps_ = 0;       //!< Number of the intervals in the table range
+  size_t number_of_satellites_ = 0;  //!< Number of satellites
+
+  // States at the grid points in the sample-major order
+  std::vector<double> position_m_[3];       //!< Position for each axis [m]
+  std::vector<double> velocity_m_s_[3];     //!< Time derivative of the position for each axis [m/s]
+  std::vector<double> clock_offset_s_;      //!< Clock offset [s]
+  std::vector<double> clock_drift_s_s_;     //!< Time derivative of the clock offset [s/s]
+  std::vector<unsigned char> is_valid_;     //!< Flag of the satellite which is available at all points
+  std::vector<double> guarded_samples_[4];  //!< Buffer of the samples including the guard points (position and clock offset)
+
+  /**
+   * @fn FindInterval
+   * @brief Find the interval of the grid including the time
+   * @param [in] time_s: Time [s]
+   * @param [out] index: Index of the first grid point of the interval
+   * @param [out] ratio: Normalized time in the interval [0, 1]
+   * @return False when the time is out of range
+   */
+  bool FindInterval(const double time_s, size_t& index, double& ratio) const;
+};
+
+#endif  // S2E_LIBRARY_GNSS_GNSS_SATELLITE_STATE_TABLE_HPP_
@@ -19,8 +19,8 @@
  * @param [in] file_type: File type and extensions (ex. ORB.SP3)
  * @return: file name
  */
-std::string GetOrbitClockFinalFileName(const std::string header, const size_t year_doy, const std::string period = "15M",
-                                       const std::string file_type = "ORB.SP3") {
+inline std::string GetOrbitClockFinalFileName(const std::string header, const size_t year_doy, const std::string period = "15M",
+                                              const std::string file_type = "ORB.SP3") {
   std::string file_name = header + "_" + std::to_string(year_doy) + "0000_01D_" + period + "_" + file_type;
 
   return file_name;
@@ -33,7 +33,7 @@ std::string GetOrbitClockFinalFileName(const std::string header, const size_t ye
  * @param [in] doy: 3-digit Day of year
  * @return: Merged number
  */
-size_t MergeYearDoy(const size_t year, const size_t doy) { return year * 1000 + doy; }
+inline size_t MergeYearDoy(const size_t year, const size_t doy) { return year * 1000 + doy; }
 
 /**
  * @fn PerseYearFromYearDoy
@@ -41,7 +41,7 @@ size_t MergeYearDoy(const size_t year, const size_t doy) { return year * 1000 +
  * @param [in] year_doy: Merged number of year(YYY) and day of year(DDD) (YYYYDDD)
  * @return: year
  */
-size_t PerseYearFromYearDoy(const size_t year_doy) { return year_doy / 1000; }
+inline size_t PerseYearFromYearDoy(const size_t year_doy) { return year_doy / 1000; }
 
 /**
  * @fn PerseDoyFromYearDoy
@@ -49,7 +49,7 @@ size_t PerseYearFromYearDoy(const size_t year_doy) { return year_doy / 1000; }
  * @param [in] year_doy: Merged number of year(YYY) and day of year(DDD) (YYYYDDD)
  * @return: day of year
  */
-size_t PerseDoyFromYearDoy(const size_t year_doy) {
+inline size_t PerseDoyFromYearDoy(const size_t year_doy) {
   size_t year = PerseYearFromYearDoy(year_doy);
   return year_doy - year * 1000;
 }
@@ -60,7 +60,7 @@ size_t PerseDoyFromYearDoy(const size_t year_doy) {
  * @param [in] year_doy: Merged number of year(YYY) and day of year(DDD) (YYYYDDD)
  * @return: Incremented value
  */
-size_t IncrementYearDoy(const size_t year_doy) {
+inline size_t IncrementYearDoy(const size_t year_doy) {
   size_t output = year_doy + 1;
   size_t doy = PerseDoyFromYearDoy(output);
 
@@ -8,10 +8,146 @@
 
 #include "sp3_file_reader.hpp"
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <math_physics/gravity/gravity_coefficients_cache.hpp>
+#include <utilities/memory_usage.hpp>
 
-Sp3FileReader::Sp3FileReader(const std::string file_name) { ReadFile(file_name); }
+namespace {
+const char kBinaryFileIdentifier[8] = {'S', '2', 'E', 'S', 'P', '3', 'B', '2'};  //!< Identifier at the head of the binary file
+
+/**
+ * @struct Sp3BinaryRecord
+ * @brief Data record of a satellite at an epoch in the binary file
+ */
+struct Sp3BinaryRecord {
+  double position_km_[3];                        //!< Satellite position [km]
+  double clock_us_;                              //!< Satellite clock offset [us]
+  double position_standard_deviation_[3];        //!< Satellite position standard deviation [-]
+  double clock_standard_deviation_;              //!< Satellite clock offset standard deviation [-]
+  double velocity_dm_s_[3];                      //!< Satellite velocity [dm/s]
+  double clock_rate_;                            //!< Satellite clock offset change rate [-]
+  double velocity_standard_deviation_[3];        //!< Satellite velocity standard deviation [-]
+  double clock_rate_standard_deviation_;         //!< Satellite clock offset change rate standard deviation [-]
+  int32_t position_clock_correlation_[10];       //!< Position and clock correlation in the order of Sp3PositionClockCorrelation
+  int32_t velocity_clock_rate_correlation_[10];  //!< Velocity and clock rate correlation in the order of Sp3VelocityClockRateCorrelation
+  uint64_t flags_;                               //!< Bit flags (1: clock event, 2: clock prediction, 4: maneuver, 8: orbit prediction)
+};
+
+void ConvertToArray(const Sp3PositionClockCorrelation& correlation, int32_t (&values)[10]) {
+  values[0] = correlation.position_x_standard_deviation_mm_;
+  values[1] = correlation.position_y_standard_deviation_mm_;
+  values[2] = correlation.position_z_standard_deviation_mm_;
+  values[3] = correlation.clock_standard_deviation_ps_;
+  values[4] = correlation.x_y_correlation_;
+  values[5] = correlation.x_z_correlation_;
+  values[6] = correlation.x_clock_correlation_;
+  values[7] = correlation.y_z_correlation_;
+  values[8] = correlation.y_clock_correlation_;
+  values[9] = correlation.z_clock_correlation_;
+}
+
+void ConvertFromArray(const int32_t (&values)[10], Sp3PositionClockCorrelation& correlation) {
+  correlation.position_x_standard_deviation_mm_ = values[0];
+  correlation.position_y_standard_deviation_mm_ = values[1];
+  correlation.position_z_standard_deviation_mm_ = values[2];
+  correlation.clock_standard_deviation_ps_ = values[3];
+  correlation.x_y_correlation_ = values[4];
+  correlation.x_z_correlation_ = values[5];
+  correlation.x_clock_correlation_ = values[6];
+  correlation.y_z_correlation_ = values[7];
+  correlation.y_clock_correlation_ = values[8];
+  correlation.z_clock_correlation_ = values[9];
+}
+
+void ConvertToArray(const Sp3VelocityClockRateCorrelation& correlation, int32_t (&values)[10]) {
+  values[0] = correlation.velocity_x_standard_deviation_;
+  values[1] = correlation.velocity_y_standard_deviation_;
+  values[2] = correlation.velocity_z_standard_deviation_;
+  values[3] = correlation.clock_rate_standard_deviation_;
+  values[4] = correlation.x_y_correlation_;
+  values[5] = correlation.x_z_correlation_;
+  values[6] = correlation.x_clock_correlation_;
+  values[7] = correlation.y_z_correlation_;
+  values[8] = correlation.y_clock_correlation_;
+  values[9] = correlation.z_clock_correlation_;
+}
+
+void ConvertFromArray(const int32_t (&values)[10], Sp3VelocityClockRateCorrelation& correlation) {
+  correlation.velocity_x_standard_deviation_ = values[0];
+  correlation.velocity_y_standard_deviation_ = values[1];
+  correlation.velocity_z_standard_deviation_ = values[2];
+  correlation.clock_rate_standard_deviation_ = values[3];
+  correlation.x_y_correlation_ = values[4];
+  correlation.x_z_correlation_ = values[5];
+  correlation.x_clock_correlation_ = values[6];
+  correlation.y_z_correlation_ = values[7];
+  correlation.y_clock_correlation_ = values[8];
+  correlation.z_clock_correlation_ = values[9];
+}
+
+/**
+ * @fn GetWindowData
+ * @brief Return the data of the satellite in the window, or the default value when the data is not included in the file
+ */
+template <typename T>
+T GetWindowData(const std::map<size_t, std::vector<T>>& data, const size_t satellite_id, const size_t window_epoch_id) {
+  const auto satellite_data = data.find(satellite_id);
+  if (satellite_data == data.end() || window_epoch_id >= satellite_data->second.size()) return T();
+  return satellite_data->second[window_epoch_id];
+}
+
+template <typename T>
+void WriteValue(std::ofstream& file, const T value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T ReadValue(std::ifstream& file) {
+  T value{};
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+void WriteFixedString(std::ofstream& file, const std::string value, const size_t length) {
+  std::string fixed_value = value;
+  fixed_value.resize(length, ' ');
+  file.write(fixed_value.data(), length);
+}
+
+std::string ReadFixedString(std::ifstream& file, const size_t length) {
+  std::string value(length, ' ');
+  file.read(&value[0], length);
+  return value;
+}
+
+void WriteDateTime(std::ofstream& file, const DateTime date_time) {
+  WriteValue<uint64_t>(file, date_time.GetYear());
+  WriteValue<uint64_t>(file, date_time.GetMonth());
+  WriteValue<uint64_t>(file, date_time.GetDay());
+  WriteValue<uint64_t>(file, date_time.GetHour());
+  WriteValue<uint64_t>(file, date_time.GetMinute());
+  WriteValue<double>(file, date_time.GetSecond());
+}
+
+DateTime ReadDateTime(std::ifstream& file) {
+  const size_t year = (size_t)ReadValue<uint64_t>(file);
+  const size_t month = (size_t)ReadValue<uint64_t>(file);
+  const size_t day = (size_t)ReadValue<uint64_t>(file);
+  const size_t hour = (size_t)ReadValue<uint64_t>(file);
+  const size_t minute = (size_t)ReadValue<uint64_t>(file);
+  const double second = ReadValue<double>(file);
+  return DateTime(year, month, day, hour, minute, second);
+}
+}  // namespace
+
+Sp3FileReader::Sp3FileReader(const std::string file_name, const size_t number_of_window_epochs)
+    : file_name_(file_name), number_of_window_epochs_(number_of_window_epochs) {
+  if (number_of_window_epochs_ == 0) number_of_window_epochs_ = 1;
+  ReadFile(file_name);
+}
 
 DateTime Sp3FileReader::GetEpochData(const size_t epoch_id) const {
   if (epoch_id > epoch_.size()) {
@@ -22,15 +158,34 @@ DateTime Sp3FileReader::GetEpochData(const size_t epoch_id) const {
 }
 
 Sp3PositionClock Sp3FileReader::GetPositionClock(const size_t epoch_id, const size_t satellite_id) {
-  Sp3PositionClock zero;
-  if (epoch_id >= epoch_.size()) {
-    return zero;
-  }
-  if (satellite_id >= position_clock_.size()) {
-    return zero;
-  }
+  if (!PrepareWindow(epoch_id, satellite_id)) return Sp3PositionClock();
+  return GetWindowData(position_clock_, satellite_id, epoch_id - window_start_epoch_id_);
+}
+
+Sp3PositionClockCorrelation Sp3FileReader::GetPositionClockCorrelation(const size_t epoch_id, const size_t satellite_id) {
+  if (!PrepareWindow(epoch_id, satellite_id)) return Sp3PositionClockCorrelation();
+  return GetWindowData(position_clock_correlation_, satellite_id, epoch_id - window_start_epoch_id_);
+}
 
-  return position_clock_[satellite_id][epoch_id];
+Sp3VelocityClockRate Sp3FileReader::GetVelocityClockRate(const size_t epoch_id, const size_t satellite_id) {
+  if (!PrepareWindow(epoch_id, satellite_id)) return Sp3VelocityClockRate();
+  return GetWindowData(velocity_clock_rate_, satellite_id, epoch_id - window_start_epoch_id_);
+}
+
+Sp3VelocityClockRateCorrelation Sp3FileReader::GetVelocityClockRateCorrelation(const size_t epoch_id, const size_t satellite_id) {
+  if (!PrepareWindow(epoch_id, satellite_id)) return Sp3VelocityClockRateCorrelation();
+  return GetWindowData(velocity_clock_rate_correlation_, satellite_id, epoch_id - window_start_epoch_id_);
+}
+
+bool Sp3FileReader::PrepareWindow(const size_t epoch_id, const size_t satellite_id) {
+  if (epoch_id >= epoch_.size()) return false;
+  if (satellite_id >= header_.number_of_satellites_) return false;
+
+  // Decode the window including the epoch
+  if (epoch_id < window_start_epoch_id_ || epoch_id >= window_start_epoch_id_ + number_of_loaded_epochs_) {
+    if (!LoadWindow(epoch_id)) return false;
+  }
+  return true;
 }
 
 double Sp3FileReader::GetSatelliteClockOffset(const size_t epoch_id, const size_t satellite_id) {
@@ -44,6 +199,15 @@ libra::Vector<3> Sp3FileReader::GetSatellitePosition_km(const size_t epoch_id, c
 }
 
 bool Sp3FileReader::ReadFile(const std::string file_name) {
+  // Binary file
+  if (IsBinaryFile(file_name)) {
+    std::ifstream binary_file(file_name, std::ios::binary);
+    binary_file.seekg(sizeof(kBinaryFileIdentifier));
+    if (!ReadBinaryHeader(binary_file)) return false;
+    is_binary_file_ = true;
+    return LoadWindow(0);
+  }
+
   // File open
   std::ifstream sp3_file(file_name);
   if (!sp3_file.is_open()) {
@@ -54,9 +218,50 @@ bool Sp3FileReader::ReadFile(const std::string file_name) {
   // Header
   size_t line_number = ReadHeader(sp3_file);
   if (line_number == 0) return false;
+  CalcFileChecksum(file_name, source_checksum_);
+
+  // Index the epoch lines. The orbit and clock data are decoded in LoadWindow.
+  std::string line;
+  std::streampos line_position = sp3_file.tellg();
+  while (epoch_.size() < header_.number_of_epoch_ && std::getline(sp3_file, line)) {
+    if (line.find("* ") == 0) {
+      size_t year, month, day, hour, minute;
+      double second;
+      sscanf(line.substr(3, 28).c_str(), "%zu %2zu %2zu %2zu %2zu %12lf", &year, &month, &day, &hour, &minute, &second);
+      epoch_.push_back(DateTime(year, month, day, hour, minute, second));
+      epoch_offsets_.push_back(line_position);
+    }
+    line_position = sp3_file.tellg();
+  }
+  if (epoch_.size() != header_.number_of_epoch_) {
+    std::cout << "[Warning] SP3 file number of epoch and epoch lines are incompatible: " << file_name << std::endl;
+    return false;
+  }
+
+  sp3_file.close();
+  return LoadWindow(0);
+}
+
+bool Sp3FileReader::LoadWindow(const size_t epoch_id) {
+  position_clock_.clear();
+  position_clock_correlation_.clear();
+  velocity_clock_rate_.clear();
+  velocity_clock_rate_correlation_.clear();
+  number_of_loaded_epochs_ = 0;
+  window_start_epoch_id_ = epoch_id;
+  if (epoch_id >= epoch_.size()) return false;
+  if (is_binary_file_) return LoadBinaryWindow(epoch_id);
+
+  std::ifstream sp3_file(file_name_);
+  if (!sp3_file.is_open()) {
+    std::cout << "[Warning] SP3 file not found: " << file_name_ << std::endl;
+    return false;
+  }
+  sp3_file.seekg(epoch_offsets_[epoch_id]);
 
   // Read epoch wise data
-  for (size_t epoch_id = 0; epoch_id < header_.number_of_epoch_; epoch_id++) {
+  const size_t end_epoch_id = std::min(epoch_id + number_of_window_epochs_, epoch_offsets_.size());
+  for (size_t window_epoch_id = epoch_id; window_epoch_id < end_epoch_id; window_epoch_id++) {
     std::string line;
     // Epoch information
     std::getline(sp3_file, line);
@@ -64,10 +269,6 @@ bool Sp3FileReader::ReadFile(const std::string file_name) {
       std::cout << "[Warning] SP3 file Epoch line first character error: " << line << std::endl;
       return false;
     }
-    size_t year, month, day, hour, minute;
-    double second;
-    sscanf(line.substr(3, 28).c_str(), "%zu %2zu %2zu %2zu %2zu %12lf", &year, &month, &day, &hour, &minute, &second);
-    epoch_.push_back(DateTime(year, month, day, hour, minute, second));
 
     // Orbit and Clock information
     for (size_t satellite_id = 0; satellite_id < header_.number_of_satellites_; satellite_id++) {
@@ -83,12 +284,14 @@ bool Sp3FileReader::ReadFile(const std::string file_name) {
       // [Optional] Position and Clock Correlation
       std::streampos previous_position = sp3_file.tellg();
       std::getline(sp3_file, line);
+      // The default value is stored when the record is omitted to keep the index of the epoch
+      Sp3PositionClockCorrelation position_clock_correlation;
       if (line.find("EP") != 0) {
         sp3_file.seekg(previous_position);
       } else {
-        Sp3PositionClockCorrelation position_clock_correlation = DecodePositionClockCorrelation(line);
-        position_clock_correlation_[satellite_id].push_back(position_clock_correlation);
+        position_clock_correlation = DecodePositionClockCorrelation(line);
       }
+      position_clock_correlation_[satellite_id].push_back(position_clock_correlation);
 
       // Velocity and Clock rate
       if (header_.mode_ == Sp3Mode::kVelocity) {
@@ -104,26 +307,214 @@ bool Sp3FileReader::ReadFile(const std::string file_name) {
         // [Optional] Velocity and Clock rate Correlation
         previous_position = sp3_file.tellg();
         std::getline(sp3_file, line);
+        Sp3VelocityClockRateCorrelation velocity_clock_rate_correlation;
         if (line.find("EV") != 0) {
           sp3_file.seekg(previous_position);
         } else {
-          Sp3VelocityClockRateCorrelation velocity_clock_rate_correlation = DecodeVelocityClockRateCorrelation(line);
-          velocity_clock_rate_correlation_[satellite_id].push_back(velocity_clock_rate_correlation);
+          velocity_clock_rate_correlation = DecodeVelocityClockRateCorrelation(line);
         }
+        velocity_clock_rate_correlation_[satellite_id].push_back(velocity_clock_rate_correlation);
       }
     }
+    number_of_loaded_epochs_++;
   }
 
-  // Test
-  DateTime test = epoch_[0];
-  test = epoch_[1];
-  std::vector<Sp3PositionClock> test_p = position_clock_[0];
-  test_p = position_clock_[1];
-
   sp3_file.close();
   return true;
 }
 
+bool Sp3FileReader::WriteBinaryFile(const std::string binary_file_name) {
+  if (epoch_.empty()) return false;
+  // The file is renamed after the write so that the other readers do not see the partially written file
+  const std::string temporary_file_name = binary_file_name + ".tmp";
+  std::ofstream binary_file(temporary_file_name, std::ios::binary | std::ios::trunc);
+  if (!binary_file.is_open()) {
+    std::cout << "[Warning] SP3 binary file cannot be opened: " << temporary_file_name << std::endl;
+    return false;
+  }
+
+  // Header
+  binary_file.write(kBinaryFileIdentifier, sizeof(kBinaryFileIdentifier));
+  WriteValue<uint64_t>(binary_file, source_checksum_);
+  WriteValue<uint32_t>(binary_file, (uint32_t)header_.mode_);
+  WriteValue<uint32_t>(binary_file, (uint32_t)header_.orbit_type_);
+  WriteValue<uint64_t>(binary_file, header_.number_of_epoch_);
+  WriteValue<uint64_t>(binary_file, header_.number_of_satellites_);
+  WriteDateTime(binary_file, header_.start_epoch_);
+  WriteValue<uint64_t>(binary_file, header_.start_gps_time_.GetWeek());
+  WriteValue<double>(binary_file, header_.start_gps_time_.GetElapsedTimeFromWeek_s());
+  WriteValue<double>(binary_file, header_.epoch_interval_s_);
+  WriteValue<uint64_t>(binary_file, header_.start_time_mjday_);
+  WriteValue<double>(binary_file, header_.start_time_mjday_fractional_day_);
+  WriteValue<double>(binary_file, header_.base_number_position_);
+  WriteValue<double>(binary_file, header_.base_number_clock_);
+  WriteFixedString(binary_file, header_.used_data_, 5);
+  WriteFixedString(binary_file, header_.coordinate_system_, 5);
+  WriteFixedString(binary_file, header_.agency_name_, 4);
+  WriteFixedString(binary_file, header_.file_type_, 2);
+  WriteFixedString(binary_file, header_.time_system_, 3);
+  for (size_t satellite_id = 0; satellite_id < header_.number_of_satellites_; satellite_id++) {
+    WriteFixedString(binary_file, header_.satellite_ids_[satellite_id], 3);
+    WriteValue<uint16_t>(binary_file, header_.satellite_accuracy_[satellite_id]);
+  }
+
+  // Epochs
+  for (const auto& epoch : epoch_) {
+    WriteDateTime(binary_file, epoch);
+  }
+
+  // Data records in the order of [epoch_id][satellite_id]
+  for (size_t epoch_id = 0; epoch_id < epoch_.size(); epoch_id++) {
+    for (size_t satellite_id = 0; satellite_id < header_.number_of_satellites_; satellite_id++) {
+      const Sp3PositionClock position_clock = GetPositionClock(epoch_id, satellite_id);
+      const Sp3VelocityClockRate velocity_clock_rate = GetVelocityClockRate(epoch_id, satellite_id);
+      Sp3BinaryRecord record;
+      for (size_t axis = 0; axis < 3; axis++) {
+        record.position_km_[axis] = position_clock.position_km_[axis];
+        record.position_standard_deviation_[axis] = position_clock.position_standard_deviation_[axis];
+        record.velocity_dm_s_[axis] = velocity_clock_rate.velocity_dm_s_[axis];
+        record.velocity_standard_deviation_[axis] = velocity_clock_rate.velocity_standard_deviation_[axis];
+      }
+      record.clock_us_ = position_clock.clock_us_;
+      record.clock_standard_deviation_ = position_clock.clock_standard_deviation_;
+      record.clock_rate_ = velocity_clock_rate.clock_rate_;
+      record.clock_rate_standard_deviation_ = velocity_clock_rate.clock_rate_standard_deviation_;
+      ConvertToArray(GetPositionClockCorrelation(epoch_id, satellite_id), record.position_clock_correlation_);
+      ConvertToArray(GetVelocityClockRateCorrelation(epoch_id, satellite_id), record.velocity_clock_rate_correlation_);
+      record.flags_ = (position_clock.clock_event_flag_ ? 1 : 0) | (position_clock.clock_prediction_flag_ ? 2 : 0) |
+                      (position_clock.maneuver_flag_ ? 4 : 0) | (position_clock.orbit_prediction_flag_ ? 8 : 0);
+      binary_file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+  }
+
+  const bool is_written = binary_file.good();
+  binary_file.close();
+  if (!is_written) {
+    std::remove(temporary_file_name.c_str());
+    return false;
+  }
+  std::remove(binary_file_name.c_str());
+  return std::rename(temporary_file_name.c_str(), binary_file_name.c_str()) == 0;
+}
+
+bool Sp3FileReader::IsBinaryFile(const std::string file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.is_open()) return false;
+  char identifier[sizeof(kBinaryFileIdentifier)];
+  file.read(identifier, sizeof(identifier));
+  if (!file) return false;
+  return std::equal(identifier, identifier + sizeof(identifier), kBinaryFileIdentifier);
+}
+
+bool Sp3FileReader::IsBinaryFileUpToDate(const std::string binary_file_name, const std::string source_file_name) {
+  if (!IsBinaryFile(binary_file_name)) return false;
+  std::ifstream binary_file(binary_file_name, std::ios::binary);
+  binary_file.seekg(sizeof(kBinaryFileIdentifier));
+  const uint64_t stored_checksum = ReadValue<uint64_t>(binary_file);
+  if (!binary_file) return false;
+
+  uint64_t source_checksum;
+  if (!CalcFileChecksum(source_file_name, source_checksum)) return false;
+  return stored_checksum == source_checksum;
+}
+
+bool Sp3FileReader::ReadBinaryHeader(std::ifstream& binary_file) {
+  source_checksum_ = ReadValue<uint64_t>(binary_file);
+  header_.mode_ = (Sp3Mode)ReadValue<uint32_t>(binary_file);
+  header_.orbit_type_ = (Sp3OrbitType)ReadValue<uint32_t>(binary_file);
+  header_.number_of_epoch_ = (size_t)ReadValue<uint64_t>(binary_file);
+  header_.number_of_satellites_ = (size_t)ReadValue<uint64_t>(binary_file);
+  header_.start_epoch_ = ReadDateTime(binary_file);
+  const size_t gps_week = (size_t)ReadValue<uint64_t>(binary_file);
+  header_.start_gps_time_ = GpsTime(gps_week, ReadValue<double>(binary_file));
+  header_.epoch_interval_s_ = ReadValue<double>(binary_file);
+  header_.start_time_mjday_ = (size_t)ReadValue<uint64_t>(binary_file);
+  header_.start_time_mjday_fractional_day_ = ReadValue<double>(binary_file);
+  header_.base_number_position_ = ReadValue<double>(binary_file);
+  header_.base_number_clock_ = ReadValue<double>(binary_file);
+  header_.used_data_ = ReadFixedString(binary_file, 5);
+  header_.coordinate_system_ = ReadFixedString(binary_file, 5);
+  header_.agency_name_ = ReadFixedString(binary_file, 4);
+  header_.file_type_ = ReadFixedString(binary_file, 2);
+  header_.time_system_ = ReadFixedString(binary_file, 3);
+  for (size_t satellite_id = 0; satellite_id < header_.number_of_satellites_ && binary_file; satellite_id++) {
+    header_.satellite_ids_.push_back(ReadFixedString(binary_file, 3));
+    header_.satellite_accuracy_.push_back(ReadValue<uint16_t>(binary_file));
+  }
+  for (size_t epoch_id = 0; epoch_id < header_.number_of_epoch_ && binary_file; epoch_id++) {
+    epoch_.push_back(ReadDateTime(binary_file));
+  }
+  if (!binary_file) {
+    std::cout << "[Warning] SP3 binary file header read error: " << file_name_ << std::endl;
+    epoch_.clear();
+    return false;
+  }
+
+  binary_data_offset_ = binary_file.tellg();
+  return true;
+}
+
+bool Sp3FileReader::LoadBinaryWindow(const size_t epoch_id) {
+  std::ifstream binary_file(file_name_, std::ios::binary);
+  if (!binary_file.is_open()) {
+    std::cout << "[Warning] SP3 binary file not found: " << file_name_ << std::endl;
+    return false;
+  }
+
+  // The records of the window are contiguous in the file
+  const size_t number_of_satellites = header_.number_of_satellites_;
+  const size_t number_of_epochs = std::min(number_of_window_epochs_, epoch_.size() - epoch_id);
+  std::vector<Sp3BinaryRecord> records(number_of_epochs * number_of_satellites);
+  binary_file.seekg(binary_data_offset_ + (std::streamoff)(epoch_id * number_of_satellites * sizeof(Sp3BinaryRecord)));
+  binary_file.read(reinterpret_cast<char*>(records.data()), (std::streamsize)(records.size() * sizeof(Sp3BinaryRecord)));
+  if (!binary_file) {
+    std::cout << "[Warning] SP3 binary file data read error: " << file_name_ << std::endl;
+    return false;
+  }
+
+  for (size_t window_epoch_id = 0; window_epoch_id < number_of_epochs; window_epoch_id++) {
+    for (size_t satellite_id = 0; satellite_id < number_of_satellites; satellite_id++) {
+      const Sp3BinaryRecord& record = records[window_epoch_id * number_of_satellites + satellite_id];
+      Sp3PositionClock position_clock;
+      position_clock.satellite_id_ = header_.satellite_ids_[satellite_id];
+      for (size_t axis = 0; axis < 3; axis++) {
+        position_clock.position_km_[axis] = record.position_km_[axis];
+        position_clock.position_standard_deviation_[axis] = record.position_standard_deviation_[axis];
+      }
+      position_clock.clock_us_ = record.clock_us_;
+      position_clock.clock_standard_deviation_ = record.clock_standard_deviation_;
+      position_clock.clock_event_flag_ = (record.flags_ & 1) != 0;
+      position_clock.clock_prediction_flag_ = (record.flags_ & 2) != 0;
+      position_clock.maneuver_flag_ = (record.flags_ & 4) != 0;
+      position_clock.orbit_prediction_flag_ = (record.flags_ & 8) != 0;
+      position_clock_[satellite_id].push_back(position_clock);
+
+      Sp3PositionClockCorrelation position_clock_correlation;
+      ConvertFromArray(record.position_clock_correlation_, position_clock_correlation);
+      position_clock_correlation_[satellite_id].push_back(position_clock_correlation);
+
+      if (header_.mode_ == Sp3Mode::kVelocity) {
+        Sp3VelocityClockRate velocity_clock_rate;
+        velocity_clock_rate.satellite_id_ = header_.satellite_ids_[satellite_id];
+        for (size_t axis = 0; axis < 3; axis++) {
+          velocity_clock_rate.velocity_dm_s_[axis] = record.velocity_dm_s_[axis];
+          velocity_clock_rate.velocity_standard_deviation_[axis] = record.velocity_standard_deviation_[axis];
+        }
+        velocity_clock_rate.clock_rate_ = record.clock_rate_;
+        velocity_clock_rate.clock_rate_standard_deviation_ = record.clock_rate_standard_deviation_;
+        velocity_clock_rate_[satellite_id].push_back(velocity_clock_rate);
+
+        Sp3VelocityClockRateCorrelation velocity_clock_rate_correlation;
+        ConvertFromArray(record.velocity_clock_rate_correlation_, velocity_clock_rate_correlation);
+        velocity_clock_rate_correlation_[satellite_id].push_back(velocity_clock_rate_correlation);
+      }
+    }
+  }
+  number_of_loaded_epochs_ = number_of_epochs;
+
+  return true;
+}
+
 size_t Sp3FileReader::SearchNearestEpochId(const EpochTime time) {
   size_t nearest_epoch_id = 0;
 
@@ -145,6 +536,15 @@ size_t Sp3FileReader::SearchNearestEpochId(const EpochTime time) {
   return nearest_epoch_id;
 }
 
+size_t Sp3FileReader::GetMemoryUsage_bytes() const {
+  size_t bytes = sizeof(*this) + CalcHeapMemory_bytes(epoch_) + CalcHeapMemory_bytes(epoch_offsets_) + CalcHeapMemory_bytes(file_name_);
+  for (const auto& data : position_clock_) bytes += CalcHeapMemory_bytes(data.second);
+  for (const auto& data : position_clock_correlation_) bytes += CalcHeapMemory_bytes(data.second);
+  for (const auto& data : velocity_clock_rate_) bytes += CalcHeapMemory_bytes(data.second);
+  for (const auto& data : velocity_clock_rate_correlation_) bytes += CalcHeapMemory_bytes(data.second);
+  return bytes;
+}
+
 size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
   size_t line_number = 0;
   std::string line;
@@ -160,7 +560,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
   // Read contents
   if (line[2] == 'P') {
     header_.mode_ = Sp3Mode::kPosition;
-  } else if (line[3] == 'V') {
+  } else if (line[2] == 'V') {
     header_.mode_ = Sp3Mode::kVelocity;
   } else {
     header_.mode_ = Sp3Mode::kOther;
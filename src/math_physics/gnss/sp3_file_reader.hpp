@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 
+#include <fstream>
 #include <map>
 #include <math_physics/math/vector.hpp>
 #include <math_physics/time_system/date_time_format.hpp>
@@ -154,7 +155,12 @@ struct Sp3VelocityClockRateCorrelation {
 
 /**
  * @class Sp3FileReader
- * @brief
+ * @brief Class to read the SP3 file and provide functions to access the data
+ * @details The header and the epoch list with the file offset of each epoch are read at the construction. The orbit and clock data are
+ *          decoded only for the window of the epochs including the accessed epoch, so the memory use does not depend on the file length.
+ *          When an epoch out of the current window is accessed, the window starting at the epoch is read from the file.
+ *          The binary file written by WriteBinaryFile is also accepted as the file name. The binary file has the position, clock, velocity,
+ *          clock rate and correlation records with fixed offsets, so the window is read without the text decoding.
  */
 class Sp3FileReader {
  public:
@@ -162,8 +168,9 @@ class Sp3FileReader {
    * @fn Sp3FileReader
    * @brief Constructor
    * @param[in] file_name: File name of target SP3 file with directory path
+   * @param[in] number_of_window_epochs: Number of epochs decoded at once
    */
-  Sp3FileReader(const std::string file_name);
+  Sp3FileReader(const std::string file_name, const size_t number_of_window_epochs = 32);
 
   // Getter
   // Header information
@@ -175,16 +182,60 @@ class Sp3FileReader {
   // Data
   DateTime GetEpochData(const size_t epoch_id) const;
   Sp3PositionClock GetPositionClock(const size_t epoch_id, const size_t satellite_id);
+  Sp3PositionClockCorrelation GetPositionClockCorrelation(const size_t epoch_id, const size_t satellite_id);
+  Sp3VelocityClockRate GetVelocityClockRate(const size_t epoch_id, const size_t satellite_id);
+  Sp3VelocityClockRateCorrelation GetVelocityClockRateCorrelation(const size_t epoch_id, const size_t satellite_id);
   double GetSatelliteClockOffset(const size_t epoch_id, const size_t satellite_id);
   libra::Vector<3> GetSatellitePosition_km(const size_t epoch_id, const size_t satellite_id);
 
   size_t SearchNearestEpochId(const EpochTime time);
 
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @brief Return the memory of the reader including the epoch list and the decoded window [bytes]
+   * @note The memory of the node of the maps is not included.
+   */
+  size_t GetMemoryUsage_bytes() const;
+
+  /**
+   * @fn WriteBinaryFile
+   * @brief Write the header, the epochs, and all data records of all epochs into the binary file with the checksum of the source SP3 file
+   * @note The byte order of the binary file is the native order of the machine. The file is written to a temporary file and renamed, so
+   *       a reader never sees a partially written file.
+   * @param[in] binary_file_name: File name of the output binary file with directory path
+   * @return true: File write success, false: File write error
+   */
+  bool WriteBinaryFile(const std::string binary_file_name);
+
+  /**
+   * @fn IsBinaryFile
+   * @brief Return true when the file is the binary file written by WriteBinaryFile
+   * @param[in] file_name: File name with directory path
+   */
+  static bool IsBinaryFile(const std::string file_name);
+  /**
+   * @fn IsBinaryFileUpToDate
+   * @brief Return true when the file is the binary file written from the current contents of the source SP3 file
+   * @param[in] binary_file_name: File name of the binary file with directory path
+   * @param[in] source_file_name: File name of the source SP3 file with directory path
+   */
+  static bool IsBinaryFileUpToDate(const std::string binary_file_name, const std::string source_file_name);
+
  private:
-  Sp3Header header_;             //!< SP3 header information
-  std::vector<DateTime> epoch_;  //!< Epoch data list
+  Sp3Header header_;                           //!< SP3 header information
+  std::vector<DateTime> epoch_;                //!< Epoch data list
+  std::vector<std::streampos> epoch_offsets_;  //!< File offset of the epoch line of each epoch
+
+  // Window of the decoded epochs
+  std::string file_name_;               //!< File name of the SP3 file with directory path
+  size_t number_of_window_epochs_;      //!< Number of epochs decoded at once
+  size_t window_start_epoch_id_ = 0;    //!< First epoch ID of the window
+  size_t number_of_loaded_epochs_ = 0;  //!< Number of decoded epochs in the window
+  bool is_binary_file_ = false;         //!< true when the file is the binary file
+  std::streampos binary_data_offset_;   //!< File offset of the first data record in the binary file
+  uint64_t source_checksum_ = 0;        //!< Checksum of the source SP3 file
 
-  // Orbit and clock data (Use as position_clock_[satellite_id][epoch_id])
+  // Orbit and clock data in the window (Use as position_clock_[satellite_id][epoch_id - window_start_epoch_id_])
   std::map<size_t, std::vector<Sp3PositionClock>> position_clock_;                                  //!< Position and Clock data
   std::map<size_t, std::vector<Sp3PositionClockCorrelation>> position_clock_correlation_;           //!< Position and Clock correlation
   std::map<size_t, std::vector<Sp3VelocityClockRate>> velocity_clock_rate_;                         //!< Velocity and Clock rate data
@@ -197,6 +248,35 @@ class Sp3FileReader {
    * @return true: File read success, false: File read error
    */
   bool ReadFile(const std::string file_name);
+  /**
+   * @fn LoadWindow
+   * @brief Decode the orbit and clock data of the window starting at the epoch
+   * @param[in] epoch_id: First epoch ID of the window
+   * @return true: File read success, false: File read error
+   */
+  bool LoadWindow(const size_t epoch_id);
+  /**
+   * @fn PrepareWindow
+   * @brief Decode the window including the epoch when it is not decoded yet
+   * @param[in] epoch_id: Epoch ID
+   * @param[in] satellite_id: Satellite ID
+   * @return true: The data of the epoch and the satellite is available, false: Out of range or file read error
+   */
+  bool PrepareWindow(const size_t epoch_id, const size_t satellite_id);
+  /**
+   * @fn ReadBinaryHeader
+   * @brief Read the header and the epochs of the binary file
+   * @param[in] binary_file: file stream of the binary file at the position after the identifier
+   * @return true: File read success, false: File read error
+   */
+  bool ReadBinaryHeader(std::ifstream& binary_file);
+  /**
+   * @fn LoadBinaryWindow
+   * @brief Read the data records of the window starting at the epoch from the binary file
+   * @param[in] epoch_id: First epoch ID of the window
+   * @return true: File read success, false: File read error
+   */
+  bool LoadBinaryWindow(const size_t epoch_id);
   /**
    * @fn ReadHeader
    * @brief Read SP3 file
@@ -0,0 +1,52 @@
+/**
+ * @file test_antex_phase_center_variation_grid.cpp
+ * @brief Test codes for AntexPhaseCenterVariationGrid class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "antex_phase_center_variation_grid.hpp"
+
+/**
+ * @brief Test the azimuth independent map in the ANTEX file
+ */
+TEST(AntexPhaseCenterVariationGrid, AzimuthIndependent) {
+  std::string test_file_name = "/src/math_physics/gnss/example.atx";
+  AntexFileReader antex_file(CORE_DIR_FROM_EXE + test_file_name);
+  ASSERT_TRUE(antex_file.GetFileReadSuccessFlag());
+
+  AntexPhaseCenterVariationGrid grid(antex_file.GetAntexSatelliteData(0)[0].GetPhaseCenterData(0));
+  EXPECT_FALSE(grid.IsAzimuthDependent());
+  // Grid points: -0.8 (0 deg), -0.9 (1 deg), -0.9 (2 deg), -0.8 (3 deg), -0.4 (4 deg), 0.2 (5 deg)
+  EXPECT_DOUBLE_EQ(-0.8, grid.CalcPhaseCenterVariation_mm(0.0));
+  EXPECT_DOUBLE_EQ(-0.4, grid.CalcPhaseCenterVariation_mm(4.0, 123.0));
+  EXPECT_NEAR(-0.1, grid.CalcPhaseCenterVariation_mm(4.5), 1e-12);
+  // Clamped at the edges
+  EXPECT_DOUBLE_EQ(-0.8, grid.CalcPhaseCenterVariation_mm(-1.0));
+  EXPECT_DOUBLE_EQ(-0.9, grid.CalcPhaseCenterVariation_mm(30.0));
+}
+
+/**
+ * @brief Test the bilinear interpolation of the azimuth dependent map
+ */
+TEST(AntexPhaseCenterVariationGrid, AzimuthDependent) {
+  // Zenith 0, 5, 10 deg and azimuth 0, 90, 180, 270, 360 deg. The value is zenith + azimuth / 10.
+  AntexPhaseCenterData phase_center_data;
+  phase_center_data.SetGridInformation(AntexGridDefinition(0.0, 10.0, 5.0, 90.0));
+  std::vector<std::vector<double>> matrix_mm;
+  matrix_mm.push_back({0.0, 0.0, 0.0});  // NOAZI
+  for (size_t azimuth = 0; azimuth < 5; azimuth++) {
+    std::vector<double> row_mm;
+    for (size_t zenith = 0; zenith < 3; zenith++) row_mm.push_back(5.0 * zenith + 9.0 * azimuth);
+    matrix_mm.push_back(row_mm);
+  }
+  phase_center_data.SetPhaseCenterVariationMatrix_mm(matrix_mm);
+
+  AntexPhaseCenterVariationGrid grid(phase_center_data);
+  EXPECT_TRUE(grid.IsAzimuthDependent());
+  EXPECT_DOUBLE_EQ(0.0, grid.CalcPhaseCenterVariation_mm(0.0, 0.0));
+  EXPECT_NEAR(7.0 + 13.5, grid.CalcPhaseCenterVariation_mm(7.0, 135.0), 1e-12);
+  EXPECT_NEAR(10.0 + 35.9, grid.CalcPhaseCenterVariation_mm(10.0, 359.0), 1e-12);
+  // The azimuth is wrapped
+  EXPECT_NEAR(2.0 + 9.0, grid.CalcPhaseCenterVariation_mm(2.0, -270.0), 1e-12);
+  EXPECT_NEAR(2.0 + 0.9, grid.CalcPhaseCenterVariation_mm(2.0, 369.0), 1e-12);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file test_gnss_satellite_state_table.cpp
+ * @brief Test functions for GnssSatelliteStateTable with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "gnss_satellite_state_table.hpp"
+
+namespace {
+// Circular orbits similar to the GPS satellites
+const double kRadius_m = 2.656e7;
+const double kAngularVelocity_rad_s = 1.4585e-4;
+
+bool CalcCircularOrbit(const size_t satellite, const double time_s, libra::Vector<3>& position_m, double& clock_offset_s) {
+  const double phase_rad = kAngularVelocity_rad_s * time_s + 0.5 * (double)satellite;
+  position_m[0] = kRadius_m * cos(phase_rad);
+  position_m[1] = kRadius_m * sin(phase_rad) * cos(0.96);
+  position_m[2] = kRadius_m * sin(phase_rad) * sin(0.96);
+  clock_offset_s = 1e-4 + 1e-11 * time_s + 1e-15 * time_s * time_s;
+  return true;
+}
+}  // namespace
+
+/**
+ * @brief Test the interpolation of the circular orbits
+ */
+TEST(GnssSatelliteStateTable, CircularOrbit) {
+  GnssSatelliteStateTable table;
+  table.Build(100.0, 60.0, 30, 4, CalcCircularOrbit);
+
+  EXPECT_FALSE(table.IsInRange(99.0));
+  EXPECT_TRUE(table.IsInRange(100.0));
+  EXPECT_TRUE(table.IsInRange(1900.0));
+  EXPECT_FALSE(table.IsInRange(1901.0));
+
+  std::vector<double> positions_m[3];
+  for (double time_s = 100.0; time_s <= 1900.0; time_s += 17.3) {
+    ASSERT_TRUE(table.CalcPositionArray_m(time_s, positions_m));
+    for (size_t satellite = 0; satellite < 4; satellite++) {
+      libra::Vector<3> expected_position_m;
+      double expected_clock_offset_s;
+      CalcCircularOrbit(satellite, time_s, expected_position_m, expected_clock_offset_s);
+
+      libra::Vector<3> position_m;
+      double clock_offset_s;
+      ASSERT_TRUE(table.CalcState(satellite, time_s, position_m, clock_offset_s));
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(expected_position_m[axis], position_m[axis], 1e-3);
+        EXPECT_DOUBLE_EQ(position_m[axis], positions_m[axis][satellite]);
+      }
+      EXPECT_NEAR(expected_clock_offset_s, clock_offset_s, 1e-15);
+    }
+  }
+}
+
+/**
+ * @brief Test the satellites which are not available
+ */
+TEST(GnssSatelliteStateTable, InvalidSatellite) {
+  GnssSatelliteStateTable table;
+  auto sampler = [](const size_t satellite, const double time_s, libra::Vector<3>& position_m, double& clock_offset_s) {
+    CalcCircularOrbit(satellite, time_s, position_m, clock_offset_s);
+    return satellite != 1;
+  };
+  table.Build(0.0, 30.0, 10, 3, sampler);
+
+  libra::Vector<3> position_m;
+  double clock_offset_s;
+  EXPECT_TRUE(table.IsValid(0));
+  EXPECT_FALSE(table.IsValid(1));
+  EXPECT_FALSE(table.CalcState(1, 100.0, position_m, clock_offset_s));
+  EXPECT_FALSE(table.CalcState(0, 301.0, position_m, clock_offset_s));
+
+  std::vector<double> positions_m[3];
+  ASSERT_TRUE(table.CalcPositionArray_m(100.0, positions_m));
+  for (size_t axis = 0; axis < 3; axis++) {
+    EXPECT_DOUBLE_EQ(0.0, positions_m[axis][1]);
+  }
+}
+
+/**
+ * @brief Test the states of the listed satellites at their own times
+ */
+TEST(GnssSatelliteStateTable, StateArray) {
+  GnssSatelliteStateTable table;
+  table.Build(0.0, 60.0, 30, 4, CalcCircularOrbit);
+
+  const std::vector<size_t> satellite_indices = {3, 0, 2};
+  const std::vector<double> times_s = {100.0, 943.7, 1799.9};
+  std::vector<double> positions_m[3], velocities_m_s[3], clock_offsets_s, clock_drifts_s_s;
+  ASSERT_TRUE(table.CalcStateArray(satellite_indices, times_s, positions_m, velocities_m_s, clock_offsets_s, clock_drifts_s_s));
+  for (size_t i = 0; i < satellite_indices.size(); i++) {
+    // The expected time derivatives are calculated with the central difference
+    libra::Vector<3> expected_position_m, previous_position_m, next_position_m;
+    double expected_clock_offset_s, previous_clock_offset_s, next_clock_offset_s;
+    CalcCircularOrbit(satellite_indices[i], times_s[i], expected_position_m, expected_clock_offset_s);
+    CalcCircularOrbit(satellite_indices[i], times_s[i] - 1e-3, previous_position_m, previous_clock_offset_s);
+    CalcCircularOrbit(satellite_indices[i], times_s[i] + 1e-3, next_position_m, next_clock_offset_s);
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(expected_position_m[axis], positions_m[axis][i], 1e-3);
+      EXPECT_NEAR((next_position_m[axis] - previous_position_m[axis]) * 5e2, velocities_m_s[axis][i], 1e-3);
+    }
+    EXPECT_NEAR(expected_clock_offset_s, clock_offsets_s[i], 1e-15);
+    EXPECT_NEAR((next_clock_offset_s - previous_clock_offset_s) * 5e2, clock_drifts_s_s[i], 1e-13);
+  }
+
+  const std::vector<double> out_of_range_times_s = {100.0, 1801.0, 200.0};
+  EXPECT_FALSE(table.CalcStateArray(satellite_indices, out_of_range_times_s, positions_m, velocities_m_s, clock_offsets_s, clock_drifts_s_s));
+}
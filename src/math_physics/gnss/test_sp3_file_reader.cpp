@@ -4,8 +4,60 @@
  */
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+#include <string>
+
 #include "sp3_file_reader.hpp"
 
+namespace {
+/**
+ * @fn WriteVelocitySp3File
+ * @brief Write the SP3 file with the velocity, the correlation records and the flags
+ * @param [in] file_name: File name
+ * @param [in] clock_us: Clock offset of the first satellite at the first epoch [us]
+ */
+void WriteVelocitySp3File(const std::string file_name, const double clock_us) {
+  std::ofstream file(file_name);
+  file << "#dV2013  4  3 12  4  1.23456789       2 ORBIT WGS84 BCT MGEX\n";
+  file << "## 1734 259200.00000000   900.00000000 56385 0.1234567891234\n";
+  file << "+    2   G01G02\n";
+  file << "++         1  2\n";
+  file << "%c M  cc GPS ccc cccc cccc cccc cccc ccccc ccccc ccccc ccccc\n";
+  file << "%c cc cc ccc ccc cccc cccc cccc cccc ccccc ccccc ccccc ccccc\n";
+  file << "%f  1.2500000  1.025000000  0.00000000000  0.000000000000000\n";
+  file << "%f  0.0000000  0.000000000  0.00000000000  0.000000000000000\n";
+  file << "%i    0    0    0    0      0      0      0      0         0\n";
+  file << "%i    0    0    0    0      0      0      0      0         0\n";
+  file << "/* Comment\n";
+  char line[128];
+  for (int epoch_id = 0; epoch_id < 2; epoch_id++) {
+    file << "*  2013  4  3 12 " << (epoch_id == 0 ? " 4" : "19") << "  1.23456789\n";
+    for (int satellite_id = 0; satellite_id < 2; satellite_id++) {
+      const double offset = 100.0 * epoch_id + 10.0 * satellite_id;
+      const double clock = (epoch_id == 0 && satellite_id == 0) ? clock_us : 171.736636 + offset;
+      snprintf(line, sizeof(line), "PG%02d%14.6f%14.6f%14.6f%14.6f", satellite_id + 1, -15163.034377 + offset, -1301.934894 + offset,
+               21473.065529 + offset, clock);
+      // Standard deviations and flags only for the first satellite
+      file << line << (satellite_id == 0 ? " 10 11 12 123 EP  MP" : "") << "\n";
+      // The position correlation record is omitted for the second satellite
+      if (satellite_id == 0) {
+        snprintf(line, sizeof(line), "EP  %4d %4d %4d %7d %8d %8d %8d %8d %8d %8d", 55, 55 + epoch_id, 60, 222, 1234567, -1234567, 5999999, -30,
+                 -40, 50);
+        file << line << "\n";
+      }
+      snprintf(line, sizeof(line), "VG%02d%14.6f%14.6f%14.6f%14.6f", satellite_id + 1, 1234.567890 + offset, -2345.678901, 3456.789012,
+               -0.123456 + offset);
+      file << line << "\n";
+      snprintf(line, sizeof(line), "EV  %4d %4d %4d %7d %8d %8d %8d %8d %8d %8d", 22, 22, 22 + satellite_id, 111, 1234567, 1234567, -1234567,
+               -1234567, 1234567, 1234567 + epoch_id);
+      file << line << "\n";
+    }
+  }
+  file << "EOF\n";
+}
+}  // namespace
+
 /**
  * @brief Test Constructor
  */
@@ -57,3 +109,132 @@ TEST(Sp3FileReader, Constructor) {
   EXPECT_DOUBLE_EQ(-5590.944265, sp3_file.GetSatellitePosition_km(1, 118)[2]);
   EXPECT_DOUBLE_EQ(97.367506, sp3_file.GetSatelliteClockOffset(1, 118));
 }
+
+/**
+ * @brief Test window loading
+ */
+TEST(Sp3FileReader, WindowLoading) {
+  std::string test_file_name = "/src/math_physics/gnss/example.sp3";
+  Sp3FileReader sp3_file(CORE_DIR_FROM_EXE + test_file_name, 1);
+
+  EXPECT_EQ(2, sp3_file.GetNumberOfEpoch());
+  EXPECT_EQ(19, sp3_file.GetEpochData(1).GetMinute());
+
+  // The windows are decoded in both directions
+  EXPECT_DOUBLE_EQ(-32428.005614, sp3_file.GetSatellitePosition_km(1, 118)[0]);
+  EXPECT_DOUBLE_EQ(97.367506, sp3_file.GetSatelliteClockOffset(1, 118));
+  EXPECT_DOUBLE_EQ(-15163.034377, sp3_file.GetSatellitePosition_km(0, 0)[0]);
+  EXPECT_DOUBLE_EQ(171.736636, sp3_file.GetSatelliteClockOffset(0, 0));
+  EXPECT_DOUBLE_EQ(24629.027242, sp3_file.GetSatellitePosition_km(1, 118)[1]);
+
+  // Out of range
+  EXPECT_DOUBLE_EQ(SP3_BAD_CLOCK_VALUE, sp3_file.GetSatelliteClockOffset(2, 0));
+  EXPECT_DOUBLE_EQ(SP3_BAD_CLOCK_VALUE, sp3_file.GetSatelliteClockOffset(0, 119));
+}
+
+/**
+ * @brief Test binary file
+ */
+TEST(Sp3FileReader, BinaryFile) {
+  std::string test_file_name = "/src/math_physics/gnss/example.sp3";
+  Sp3FileReader sp3_file(CORE_DIR_FROM_EXE + test_file_name);
+  EXPECT_FALSE(Sp3FileReader::IsBinaryFile(CORE_DIR_FROM_EXE + test_file_name));
+
+  const std::string binary_file_name = "test_sp3_file_reader.bin";
+  EXPECT_TRUE(sp3_file.WriteBinaryFile(binary_file_name));
+  EXPECT_TRUE(Sp3FileReader::IsBinaryFile(binary_file_name));
+
+  Sp3FileReader binary_file(binary_file_name, 1);
+  EXPECT_EQ(2, binary_file.GetNumberOfEpoch());
+  EXPECT_EQ(119, binary_file.GetNumberOfSatellites());
+  EXPECT_EQ(sp3_file.GetHeader().satellite_ids_, binary_file.GetHeader().satellite_ids_);
+  EXPECT_EQ(sp3_file.GetHeader().coordinate_system_, binary_file.GetHeader().coordinate_system_);
+  EXPECT_DOUBLE_EQ(sp3_file.GetHeader().epoch_interval_s_, binary_file.GetHeader().epoch_interval_s_);
+  EXPECT_EQ(1734, binary_file.GetStartEpochGpsTime().GetWeek());
+  EXPECT_EQ(19, binary_file.GetEpochData(1).GetMinute());
+  EXPECT_DOUBLE_EQ(1.23456789, binary_file.GetEpochData(1).GetSecond());
+
+  for (size_t epoch_id = 0; epoch_id < 2; epoch_id++) {
+    for (size_t satellite_id = 0; satellite_id < 119; satellite_id++) {
+      Sp3PositionClock text_data = sp3_file.GetPositionClock(epoch_id, satellite_id);
+      Sp3PositionClock binary_data = binary_file.GetPositionClock(epoch_id, satellite_id);
+      EXPECT_EQ(text_data.satellite_id_, binary_data.satellite_id_);
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_DOUBLE_EQ(text_data.position_km_[axis], binary_data.position_km_[axis]);
+      }
+      EXPECT_DOUBLE_EQ(text_data.clock_us_, binary_data.clock_us_);
+      EXPECT_EQ(text_data.orbit_prediction_flag_, binary_data.orbit_prediction_flag_);
+    }
+  }
+  std::remove(binary_file_name.c_str());
+}
+
+/**
+ * @brief Test the round trip of all records between the text and the binary files, and the update check of the binary file
+ */
+TEST(Sp3FileReader, BinaryFileRoundTrip) {
+  const std::string text_file_name = "test_sp3_file_reader_velocity.sp3";
+  const std::string binary_file_name = text_file_name + ".bin";
+  WriteVelocitySp3File(text_file_name, 171.736636);
+  Sp3FileReader sp3_file(text_file_name);
+  ASSERT_EQ(2, sp3_file.GetNumberOfEpoch());
+  ASSERT_EQ(2, sp3_file.GetNumberOfSatellites());
+  EXPECT_EQ(Sp3Mode::kVelocity, sp3_file.GetHeader().mode_);
+  EXPECT_FALSE(Sp3FileReader::IsBinaryFileUpToDate(binary_file_name, text_file_name));
+  EXPECT_TRUE(sp3_file.WriteBinaryFile(binary_file_name));
+  EXPECT_TRUE(Sp3FileReader::IsBinaryFileUpToDate(binary_file_name, text_file_name));
+  // The temporary file is renamed
+  EXPECT_FALSE(std::ifstream(binary_file_name + ".tmp").is_open());
+
+  // The decoded records
+  EXPECT_DOUBLE_EQ(1234.567890, sp3_file.GetVelocityClockRate(0, 0).velocity_dm_s_[0]);
+  EXPECT_DOUBLE_EQ(99.876544, sp3_file.GetVelocityClockRate(1, 0).clock_rate_);
+  EXPECT_EQ(56, sp3_file.GetPositionClockCorrelation(1, 0).position_y_standard_deviation_mm_);
+  EXPECT_EQ(-1234567, sp3_file.GetPositionClockCorrelation(0, 0).x_z_correlation_);
+  EXPECT_EQ(0, sp3_file.GetPositionClockCorrelation(0, 1).x_z_correlation_);
+  EXPECT_EQ(23, sp3_file.GetVelocityClockRateCorrelation(0, 1).velocity_z_standard_deviation_);
+  EXPECT_TRUE(sp3_file.GetPositionClock(0, 0).maneuver_flag_);
+
+  Sp3FileReader binary_file(binary_file_name, 1);
+  EXPECT_EQ(Sp3Mode::kVelocity, binary_file.GetHeader().mode_);
+  for (size_t epoch_id = 0; epoch_id < 2; epoch_id++) {
+    for (size_t satellite_id = 0; satellite_id < 2; satellite_id++) {
+      const Sp3PositionClock text_position = sp3_file.GetPositionClock(epoch_id, satellite_id);
+      const Sp3PositionClock binary_position = binary_file.GetPositionClock(epoch_id, satellite_id);
+      const Sp3VelocityClockRate text_velocity = sp3_file.GetVelocityClockRate(epoch_id, satellite_id);
+      const Sp3VelocityClockRate binary_velocity = binary_file.GetVelocityClockRate(epoch_id, satellite_id);
+      EXPECT_EQ(text_velocity.satellite_id_, binary_velocity.satellite_id_);
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_DOUBLE_EQ(text_position.position_km_[axis], binary_position.position_km_[axis]);
+        EXPECT_DOUBLE_EQ(text_position.position_standard_deviation_[axis], binary_position.position_standard_deviation_[axis]);
+        EXPECT_DOUBLE_EQ(text_velocity.velocity_dm_s_[axis], binary_velocity.velocity_dm_s_[axis]);
+      }
+      EXPECT_DOUBLE_EQ(text_position.clock_us_, binary_position.clock_us_);
+      EXPECT_DOUBLE_EQ(text_position.clock_standard_deviation_, binary_position.clock_standard_deviation_);
+      EXPECT_EQ(text_position.clock_event_flag_, binary_position.clock_event_flag_);
+      EXPECT_EQ(text_position.clock_prediction_flag_, binary_position.clock_prediction_flag_);
+      EXPECT_EQ(text_position.maneuver_flag_, binary_position.maneuver_flag_);
+      EXPECT_EQ(text_position.orbit_prediction_flag_, binary_position.orbit_prediction_flag_);
+      EXPECT_DOUBLE_EQ(text_velocity.clock_rate_, binary_velocity.clock_rate_);
+
+      const Sp3PositionClockCorrelation text_position_correlation = sp3_file.GetPositionClockCorrelation(epoch_id, satellite_id);
+      const Sp3PositionClockCorrelation binary_position_correlation = binary_file.GetPositionClockCorrelation(epoch_id, satellite_id);
+      EXPECT_EQ(text_position_correlation.position_y_standard_deviation_mm_, binary_position_correlation.position_y_standard_deviation_mm_);
+      EXPECT_EQ(text_position_correlation.clock_standard_deviation_ps_, binary_position_correlation.clock_standard_deviation_ps_);
+      EXPECT_EQ(text_position_correlation.x_z_correlation_, binary_position_correlation.x_z_correlation_);
+      EXPECT_EQ(text_position_correlation.z_clock_correlation_, binary_position_correlation.z_clock_correlation_);
+      const Sp3VelocityClockRateCorrelation text_velocity_correlation = sp3_file.GetVelocityClockRateCorrelation(epoch_id, satellite_id);
+      const Sp3VelocityClockRateCorrelation binary_velocity_correlation = binary_file.GetVelocityClockRateCorrelation(epoch_id, satellite_id);
+      EXPECT_EQ(text_velocity_correlation.velocity_z_standard_deviation_, binary_velocity_correlation.velocity_z_standard_deviation_);
+      EXPECT_EQ(text_velocity_correlation.clock_rate_standard_deviation_, binary_velocity_correlation.clock_rate_standard_deviation_);
+      EXPECT_EQ(text_velocity_correlation.z_clock_correlation_, binary_velocity_correlation.z_clock_correlation_);
+    }
+  }
+
+  // The binary file is not valid after the update of the SP3 file
+  WriteVelocitySp3File(text_file_name, 171.736637);
+  EXPECT_TRUE(Sp3FileReader::IsBinaryFile(binary_file_name));
+  EXPECT_FALSE(Sp3FileReader::IsBinaryFileUpToDate(binary_file_name, text_file_name));
+  std::remove(text_file_name.c_str());
+  std::remove(binary_file_name.c_str());
+}
@@ -0,0 +1,71 @@
+/**
+ * @file benchmark_gravity_potential.cpp
+ * @brief Benchmark codes for Gravity Potential class
+ */
+#include <iostream>
+#include <utilities/benchmark_measurement.hpp>
+#include <vector>
+
+#include "gravity_potential.hpp"
+
+int main() {
+  const std::vector<size_t> degrees = {2, 10, 70, 360};
+
+  std::cout << "degree, acceleration [ns/call], partial_derivative [ns/call], acceleration_and_partial_derivative [ns/call], "
+            << "batched acceleration [ns/position]" << std::endl;
+  for (size_t degree : degrees) {
+    // Kaula's rule like coefficients to keep the magnitude realistic
+    std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+    std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+    for (size_t n = 2; n <= degree; n++) {
+      for (size_t m = 0; m <= n; m++) {
+        c[n][m] = 1.0e-5 / (double)(n * n);
+        if (m > 0) s[n][m] = 0.5e-5 / (double)(n * n);
+      }
+    }
+    GravityPotential gravity_potential(degree, c, s);
+
+    libra::Vector<3> position_xcxf_m;
+    position_xcxf_m[0] = 4.0e6;
+    position_xcxf_m[1] = 3.0e6;
+    position_xcxf_m[2] = 4.5e6;
+
+    // Keep the number of evaluated terms roughly constant for each degree
+    const size_t number_of_calls = 2000000 / ((degree + 1) * (degree + 1)) + 10;
+
+    libra::Vector<3> acceleration_xcxf_m_s2(0.0);
+    const double acceleration_ns = MeasureNanosecondsPerCall(
+        [&]() { acceleration_xcxf_m_s2 += gravity_potential.CalcAcceleration_xcxf_m_s2(position_xcxf_m); }, number_of_calls);
+    libra::Matrix<3, 3> partial_derivative_xcxf_s2(0.0);
+    const double partial_derivative_ns = MeasureNanosecondsPerCall(
+        [&]() { partial_derivative_xcxf_s2 += gravity_potential.CalcPartialDerivative_xcxf_s2(position_xcxf_m); }, number_of_calls);
+    const double fused_ns = MeasureNanosecondsPerCall(
+        [&]() {
+          gravity_potential.CalcAccelerationAndPartialDerivative_xcxf(position_xcxf_m, acceleration_xcxf_m_s2, partial_derivative_xcxf_s2);
+        },
+        number_of_calls);
+
+    // Batched calculation
+    const size_t number_of_positions = 64;
+    std::vector<double> position_x_xcxf_m(number_of_positions), position_y_xcxf_m(number_of_positions), position_z_xcxf_m(number_of_positions);
+    for (size_t i = 0; i < number_of_positions; i++) {
+      position_x_xcxf_m[i] = position_xcxf_m[0] + 1.0e3 * i;
+      position_y_xcxf_m[i] = position_xcxf_m[1] - 1.0e3 * i;
+      position_z_xcxf_m[i] = position_xcxf_m[2];
+    }
+    std::vector<double> acceleration_x_xcxf_m_s2, acceleration_y_xcxf_m_s2, acceleration_z_xcxf_m_s2;
+    auto batch_function = [&]() {
+      gravity_potential.CalcAcceleration_xcxf_m_s2(position_x_xcxf_m, position_y_xcxf_m, position_z_xcxf_m, acceleration_x_xcxf_m_s2,
+                                                   acceleration_y_xcxf_m_s2, acceleration_z_xcxf_m_s2);
+    };
+    const double batch_ns = MeasureNanosecondsPerCall(batch_function, number_of_calls / number_of_positions + 1) / (double)number_of_positions;
+
+    std::cout << degree << ", " << acceleration_ns << ", " << partial_derivative_ns << ", " << fused_ns << ", " << batch_ns << std::endl;
+    // Use the results to avoid optimization
+    if (acceleration_xcxf_m_s2[0] != acceleration_xcxf_m_s2[0] || partial_derivative_xcxf_s2[0][0] != partial_derivative_xcxf_s2[0][0]) {
+      std::cout << "NaN detected" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file gravity_acceleration_grid.cpp
+ * @brief Precomputed gravity acceleration on a radius-latitude-longitude grid in the body fixed frame
+ */
+
+#include "gravity_acceleration_grid.hpp"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../math/constants.hpp"
+#include "../randomization/low_discrepancy_sequence.hpp"
+#include "gravity_coefficients_cache.hpp"
+
+namespace {
+const char kGridMagic[8] = {'S', '2', 'E', 'G', 'G', 'R', 'I', 'D'};  //!< Identifier of the grid file
+const uint32_t kGridVersion = 1;                                      //!< Version of the grid file format
+
+/**
+ * @struct GridFileHeader
+ * @brief Header of the grid file. The size is a multiple of 8 bytes to align the values for the memory mapping.
+ */
+struct GridFileHeader {
+  char magic_[8];                  //!< Identifier of the grid file
+  uint32_t version_;               //!< Version of the grid file format
+  uint32_t reserved_;              //!< Reserved for the alignment
+  uint64_t source_checksum_;       //!< Checksum of the coefficients and the degree
+  double min_radius_m_;            //!< Lower limit of the grid radius [m]
+  double max_radius_m_;            //!< Upper limit of the grid radius [m]
+  double radius_step_m_;           //!< Radius step [m]
+  double angle_step_rad_;          //!< Latitude and longitude step in the settings [rad]
+  uint64_t number_of_radii_;       //!< Number of radius shells
+  uint64_t number_of_latitudes_;   //!< Number of latitudes
+  uint64_t number_of_longitudes_;  //!< Number of longitudes
+};
+
+/**
+ * @fn CalcLagrangeWeights
+ * @brief Calculate the weights of the 4-point Lagrange interpolation with the nodes at 0, 1, 2, and 3
+ * @param [in] x: Position of the interpolation in the node coordinate
+ * @param [out] weights: Weights of the nodes
+ */
+inline void CalcLagrangeWeights(const double x, double weights[4]) {
+  weights[0] = -(x - 1.0) * (x - 2.0) * (x - 3.0) / 6.0;
+  weights[1] = x * (x - 2.0) * (x - 3.0) / 2.0;
+  weights[2] = -x * (x - 1.0) * (x - 3.0) / 2.0;
+  weights[3] = x * (x - 1.0) * (x - 2.0) / 6.0;
+}
+
+/**
+ * @fn SelectStencil
+ * @brief Select the first node of the 4-point stencil around the position, shifted inside the range at the boundaries
+ * @param [in] u: Position in the grid index coordinate
+ * @param [in] number_of_points: Number of the grid points (4 at least)
+ * @param [out] x: Position in the node coordinate of the stencil
+ * @return Index of the first node
+ */
+inline size_t SelectStencil(const double u, const size_t number_of_points, double& x) {
+  long first_index = (long)std::floor(u) - 1;
+  first_index = std::max(0L, std::min(first_index, (long)number_of_points - 4));
+  x = u - (double)first_index;
+  return (size_t)first_index;
+}
+}  // namespace
+
+void GravityAccelerationGrid::SetDimensions(const Settings& settings) {
+  settings_ = settings;
+  const double radius_range_m = std::max(settings_.max_radius_m - settings_.min_radius_m, 0.0);
+  number_of_radii_ = std::max<size_t>((size_t)std::ceil(radius_range_m / settings_.radius_step_m - 1.0e-9) + 1, 4);
+  settings_.max_radius_m = settings_.min_radius_m + (double)(number_of_radii_ - 1) * settings_.radius_step_m;
+
+  number_of_latitudes_ = std::max<size_t>((size_t)std::round(libra::pi / settings_.angle_step_rad) + 1, 4);
+  latitude_step_rad_ = libra::pi / (double)(number_of_latitudes_ - 1);
+  number_of_longitudes_ = std::max<size_t>((size_t)std::round(libra::tau / settings_.angle_step_rad), 4);
+  longitude_step_rad_ = libra::tau / (double)number_of_longitudes_;
+}
+
+void GravityAccelerationGrid::Build(const GravityPotential& gravity_potential, const Settings& settings, const uint64_t source_checksum,
+                                    const unsigned int number_of_threads) {
+  SetDimensions(settings);
+  source_checksum_ = source_checksum;
+  is_memory_mapped_ = false;
+  double* values = new double[GetNumberOfValues()];
+  values_ = std::shared_ptr<const double>(values, std::default_delete<const double[]>());
+
+  // The rows of the longitudes at each radius and latitude are evaluated with the batched calculation
+  std::atomic<size_t> next_row(0);
+  auto worker = [&]() {
+    GravityPotential worker_gravity_potential(gravity_potential);
+    std::vector<double> x_m(number_of_longitudes_), y_m(number_of_longitudes_), z_m(number_of_longitudes_);
+    std::vector<double> acceleration_x_m_s2, acceleration_y_m_s2, acceleration_z_m_s2;
+    while (true) {
+      const size_t row = next_row++;
+      if (row >= number_of_radii_ * number_of_latitudes_) break;
+      const size_t radius_index = row / number_of_latitudes_;
+      const size_t latitude_index = row % number_of_latitudes_;
+      const double radius_m = settings_.min_radius_m + (double)radius_index * settings_.radius_step_m;
+      const double latitude_rad = -libra::pi_2 + (double)latitude_index * latitude_step_rad_;
+      for (size_t longitude_index = 0; longitude_index < number_of_longitudes_; longitude_index++) {
+        const double longitude_rad = (double)longitude_index * longitude_step_rad_;
+        x_m[longitude_index] = radius_m * std::cos(latitude_rad) * std::cos(longitude_rad);
+        y_m[longitude_index] = radius_m * std::cos(latitude_rad) * std::sin(longitude_rad);
+        z_m[longitude_index] = radius_m * std::sin(latitude_rad);
+      }
+      worker_gravity_potential.CalcAcceleration_xcxf_m_s2(x_m, y_m, z_m, acceleration_x_m_s2, acceleration_y_m_s2, acceleration_z_m_s2);
+      double* row_values = values + GetOffset(radius_index, latitude_index, 0);
+      for (size_t longitude_index = 0; longitude_index < number_of_longitudes_; longitude_index++) {
+        row_values[longitude_index * 3 + 0] = acceleration_x_m_s2[longitude_index];
+        row_values[longitude_index * 3 + 1] = acceleration_y_m_s2[longitude_index];
+        row_values[longitude_index * 3 + 2] = acceleration_z_m_s2[longitude_index];
+      }
+    }
+  };
+
+  if (number_of_threads <= 1) {
+    worker();
+  } else {
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < number_of_threads; i++) {
+      threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+}
+
+bool GravityAccelerationGrid::Read(const std::string& file_path, const Settings& settings, const uint64_t source_checksum) {
+  values_.reset();
+  is_memory_mapped_ = false;
+
+  GridFileHeader header;
+  {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file) return false;
+  }
+  SetDimensions(settings);
+  source_checksum_ = source_checksum;
+  if (std::memcmp(header.magic_, kGridMagic, sizeof(kGridMagic)) != 0) return false;
+  if (header.version_ != kGridVersion || header.source_checksum_ != source_checksum_) return false;
+  if (header.min_radius_m_ != settings_.min_radius_m || header.max_radius_m_ != settings_.max_radius_m ||
+      header.radius_step_m_ != settings_.radius_step_m || header.angle_step_rad_ != settings_.angle_step_rad) {
+    return false;
+  }
+  if (header.number_of_radii_ != number_of_radii_ || header.number_of_latitudes_ != number_of_latitudes_ ||
+      header.number_of_longitudes_ != number_of_longitudes_) {
+    return false;
+  }
+  const size_t file_size = sizeof(header) + GetValuesSize_bytes();
+
+#ifndef WIN32
+  // The values are mapped read-only, so the pages are shared with the other processes using the same file (e.g., Monte-Carlo shards)
+  const int descriptor = open(file_path.c_str(), O_RDONLY);
+  if (descriptor >= 0) {
+    struct stat status;
+    void* memory = MAP_FAILED;
+    if (fstat(descriptor, &status) == 0 && (size_t)status.st_size == file_size) {
+      memory = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    }
+    close(descriptor);
+    if (memory != MAP_FAILED) {
+      const double* values = reinterpret_cast<const double*>(static_cast<const char*>(memory) + sizeof(header));
+      values_ = std::shared_ptr<const double>(values, [memory, file_size](const double*) { munmap(memory, file_size); });
+      is_memory_mapped_ = true;
+      return true;
+    }
+  }
+#endif
+
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file.is_open()) return false;
+  file.seekg(sizeof(header));
+  double* values = new double[GetNumberOfValues()];
+  std::shared_ptr<const double> read_values(values, std::default_delete<const double[]>());
+  file.read(reinterpret_cast<char*>(values), GetValuesSize_bytes());
+  if (!file) return false;
+  values_ = read_values;
+  return true;
+}
+
+bool GravityAccelerationGrid::Write(const std::string& file_path) const {
+  if (!IsValid()) return false;
+  GridFileHeader header;
+  std::memcpy(header.magic_, kGridMagic, sizeof(kGridMagic));
+  header.version_ = kGridVersion;
+  header.reserved_ = 0;
+  header.source_checksum_ = source_checksum_;
+  header.min_radius_m_ = settings_.min_radius_m;
+  header.max_radius_m_ = settings_.max_radius_m;
+  header.radius_step_m_ = settings_.radius_step_m;
+  header.angle_step_rad_ = settings_.angle_step_rad;
+  header.number_of_radii_ = number_of_radii_;
+  header.number_of_latitudes_ = number_of_latitudes_;
+  header.number_of_longitudes_ = number_of_longitudes_;
+
+  // The grid is written to a temporary file and renamed, so the processes which map or read the existing file do not see the truncated file.
+  // The temporary file name is unique for each thread to write the same grid concurrently (e.g., Monte-Carlo shards).
+  const std::string temporary_file_path = file_path + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+  std::ofstream file(temporary_file_path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) return false;
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(values_.get()), GetValuesSize_bytes());
+  const bool is_written = file.good();
+  file.close();
+  if (!is_written) {
+    std::remove(temporary_file_path.c_str());
+    return false;
+  }
+  // rename does not replace the existing file on Windows
+  if (std::rename(temporary_file_path.c_str(), file_path.c_str()) == 0) return true;
+  std::remove(file_path.c_str());
+  if (std::rename(temporary_file_path.c_str(), file_path.c_str()) == 0) return true;
+  std::remove(temporary_file_path.c_str());
+  return false;
+}
+
+bool GravityAccelerationGrid::CalcAcceleration_xcxf_m_s2(const libra::Vector<3>& position_xcxf_m, libra::Vector<3>& acceleration_xcxf_m_s2) const {
+  if (!IsValid()) return false;
+  const double radius_m = position_xcxf_m.CalcNorm();
+  if (radius_m < settings_.min_radius_m || radius_m > settings_.max_radius_m) return false;
+
+  const double latitude_rad = std::asin(position_xcxf_m[2] / radius_m);
+  double longitude_rad = std::atan2(position_xcxf_m[1], position_xcxf_m[0]);
+  if (longitude_rad < 0.0) longitude_rad += libra::tau;
+
+  double x;
+  double radius_weights[4], latitude_weights[4], longitude_weights[4];
+  const size_t radius_index = SelectStencil((radius_m - settings_.min_radius_m) / settings_.radius_step_m, number_of_radii_, x);
+  CalcLagrangeWeights(x, radius_weights);
+  const size_t latitude_index = SelectStencil((latitude_rad + libra::pi_2) / latitude_step_rad_, number_of_latitudes_, x);
+  CalcLagrangeWeights(x, latitude_weights);
+  // The longitude is periodic, so the stencil is wrapped instead of shifted
+  const double longitude_u = longitude_rad / longitude_step_rad_;
+  const long longitude_floor = (long)std::floor(longitude_u);
+  CalcLagrangeWeights(longitude_u - (double)(longitude_floor - 1), longitude_weights);
+  size_t longitude_indices[4];
+  for (long i = 0; i < 4; i++) {
+    const long n = (long)number_of_longitudes_;
+    longitude_indices[i] = (size_t)(((longitude_floor - 1 + i) % n + n) % n);
+  }
+
+  double acceleration_m_s2[3] = {0.0, 0.0, 0.0};
+  const double* values = values_.get();
+  for (size_t i = 0; i < 4; i++) {
+    for (size_t j = 0; j < 4; j++) {
+      const double weight_ij = radius_weights[i] * latitude_weights[j];
+      const double* row_values = values + GetOffset(radius_index + i, latitude_index + j, 0);
+      for (size_t k = 0; k < 4; k++) {
+        const double weight = weight_ij * longitude_weights[k];
+        const double* point_values = row_values + longitude_indices[k] * 3;
+        acceleration_m_s2[0] += weight * point_values[0];
+        acceleration_m_s2[1] += weight * point_values[1];
+        acceleration_m_s2[2] += weight * point_values[2];
+      }
+    }
+  }
+  for (size_t i = 0; i < 3; i++) acceleration_xcxf_m_s2[i] = acceleration_m_s2[i];
+  return true;
+}
+
+double GravityAccelerationGrid::CalcMaximumError_m_s2(const GravityPotential& gravity_potential, const size_t number_of_samples) const {
+  if (!IsValid()) return 0.0;
+  GravityPotential direct_gravity_potential(gravity_potential);
+  const libra::SobolSequence sobol_sequence;
+  double maximum_error_m_s2 = 0.0;
+  for (size_t i = 0; i < number_of_samples; i++) {
+    // Uniform samples in the shell volume except the first point of the sequence at the corner
+    const double radius_m = settings_.min_radius_m + sobol_sequence.CalcPoint(i + 1, 0) * (settings_.max_radius_m - settings_.min_radius_m);
+    const double sin_latitude = 2.0 * sobol_sequence.CalcPoint(i + 1, 1) - 1.0;
+    const double longitude_rad = libra::tau * sobol_sequence.CalcPoint(i + 1, 2);
+    const double cos_latitude = std::sqrt(1.0 - sin_latitude * sin_latitude);
+    libra::Vector<3> position_xcxf_m;
+    position_xcxf_m[0] = radius_m * cos_latitude * std::cos(longitude_rad);
+    position_xcxf_m[1] = radius_m * cos_latitude * std::sin(longitude_rad);
+    position_xcxf_m[2] = radius_m * sin_latitude;
+
+    libra::Vector<3> interpolated_acceleration_m_s2(0.0);
+    if (!CalcAcceleration_xcxf_m_s2(position_xcxf_m, interpolated_acceleration_m_s2)) continue;
+    const libra::Vector<3> direct_acceleration_m_s2 = direct_gravity_potential.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+    maximum_error_m_s2 = std::max(maximum_error_m_s2, (interpolated_acceleration_m_s2 - direct_acceleration_m_s2).CalcNorm());
+  }
+  return maximum_error_m_s2;
+}
+
+bool CalcGravityAccelerationGridChecksum(const std::string& coefficients_file_path, const size_t degree, uint64_t& checksum) {
+  if (!CalcFileChecksum(coefficients_file_path, checksum)) return false;
+  // Continue the FNV-1a hash with the degree
+  const uint64_t fnv_prime = 1099511628211ULL;
+  for (size_t i = 0; i < sizeof(uint64_t); i++) {
+    checksum ^= ((uint64_t)degree >> (8 * i)) & 0xff;
+    checksum *= fnv_prime;
+  }
+  return true;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file gravity_acceleration_grid.hpp
+ * @brief Precomputed gravity acceleration on a radius-latitude-longitude grid in the body fixed frame
+ */
+
+#ifndef S2E_LIBRARY_GRAVITY_GRAVITY_ACCELERATION_GRID_HPP_
+#define S2E_LIBRARY_GRAVITY_GRAVITY_ACCELERATION_GRID_HPP_
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "../math/vector.hpp"
+#include "gravity_potential.hpp"
+
+/**
+ * @class GravityAccelerationGrid
+ * @brief Precomputed gravity acceleration on a radius-latitude-longitude grid in the XCXF frame
+ * @details The acceleration of GravityPotential is evaluated once at the grid points in a thin radius shell (e.g., the altitude band of a
+ *          station-keeping analysis), and the acceleration at a position in the shell is interpolated with the 4-point Lagrange polynomials
+ *          along the radius, the geocentric latitude, and the longitude. The calculation cost is 64 grid points for any degree instead of
+ *          the O(degree^2) recursion. The grid is stored in a binary file with the checksum of the coefficients file, and the file is
+ *          memory-mapped when it is read. The grid values are shared between the copies of the instance.
+ * @note The stencil is shifted inside the grid at the boundaries of the radius and the latitude, so the error increases near the poles.
+ *       Use CalcMaximumError_m_s2 to check the error against the direct evaluation.
+ */
+class GravityAccelerationGrid {
+ public:
+  /**
+   * @struct Settings
+   * @brief Grid settings
+   */
+  struct Settings {
+    double min_radius_m = 6.678137e6;    //!< Lower limit of the grid radius [m]
+    double max_radius_m = 6.878137e6;    //!< Upper limit of the grid radius [m]
+    double radius_step_m = 10.0e3;       //!< Radius step [m]
+    double angle_step_rad = 0.00872665;  //!< Latitude and longitude step [rad]
+  };
+
+  /**
+   * @fn GravityAccelerationGrid
+   * @brief Default constructor without the grid values
+   */
+  GravityAccelerationGrid() {}
+
+  /**
+   * @fn Build
+   * @brief Evaluate the acceleration at all grid points with the gravity potential
+   * @param [in] gravity_potential: Gravity potential. It is copied for each thread.
+   * @param [in] settings: Grid settings. The radius range is extended to have 4 points at least.
+   * @param [in] source_checksum: Checksum of the coefficients and the degree to identify the grid file
+   * @param [in] number_of_threads: Number of threads to evaluate the grid points
+   */
+  void Build(const GravityPotential& gravity_potential, const Settings& settings, const uint64_t source_checksum,
+             const unsigned int number_of_threads = 1);
+  /**
+   * @fn Read
+   * @brief Read the grid file. The file is memory-mapped when it is supported by the platform.
+   * @param [in] file_path: Path to the grid file
+   * @param [in] settings: Grid settings which should match with the file
+   * @param [in] source_checksum: Checksum which should match with the file
+   * @return True when the file matches with the settings and the checksum
+   */
+  bool Read(const std::string& file_path, const Settings& settings, const uint64_t source_checksum);
+  /**
+   * @fn Write
+   * @brief Write the grid file
+   * @param [in] file_path: Path to the grid file
+   * @return True when the file is written
+   */
+  bool Write(const std::string& file_path) const;
+
+  /**
+   * @fn CalcAcceleration_xcxf_m_s2
+   * @brief Interpolate the acceleration at the position
+   * @param [in] position_xcxf_m: Position in the XCXF frame [m]
+   * @param [out] acceleration_xcxf_m_s2: Acceleration in the XCXF frame [m/s2]. Not updated when the function returns false.
+   * @return False when the position is out of the radius range or the grid is not built
+   */
+  bool CalcAcceleration_xcxf_m_s2(const libra::Vector<3>& position_xcxf_m, libra::Vector<3>& acceleration_xcxf_m_s2) const;
+  /**
+   * @fn CalcMaximumError_m_s2
+   * @brief Calculate the maximum norm of the difference from the direct evaluation at the sample points in the grid
+   * @param [in] gravity_potential: Gravity potential used to build the grid
+   * @param [in] number_of_samples: Number of the sample points placed with a low discrepancy sequence in the shell
+   * @return Maximum error [m/s2]
+   */
+  double CalcMaximumError_m_s2(const GravityPotential& gravity_potential, const size_t number_of_samples) const;
+
+  // Getters
+  /**
+   * @fn IsValid
+   * @return True when the grid values are built or read
+   */
+  inline bool IsValid() const { return values_ != nullptr; }
+  /**
+   * @fn GetSettings
+   * @return Grid settings
+   */
+  inline const Settings& GetSettings() const { return settings_; }
+  /**
+   * @fn IsMemoryMapped
+   * @return True when the grid values are memory-mapped from the file
+   */
+  inline bool IsMemoryMapped() const { return is_memory_mapped_; }
+  /**
+   * @fn GetValuesSize_bytes
+   * @return Size of the grid values shared between the copies [bytes]
+   */
+  inline size_t GetValuesSize_bytes() const { return GetNumberOfValues() * sizeof(double); }
+
+ private:
+  Settings settings_;                     //!< Grid settings
+  uint64_t source_checksum_ = 0;          //!< Checksum of the coefficients and the degree
+  size_t number_of_radii_ = 0;            //!< Number of radius shells
+  size_t number_of_latitudes_ = 0;        //!< Number of latitudes including both poles
+  size_t number_of_longitudes_ = 0;       //!< Number of longitudes. The last longitude is connected to the first one.
+  double latitude_step_rad_ = 0.0;        //!< Latitude step adjusted to divide the range equally [rad]
+  double longitude_step_rad_ = 0.0;       //!< Longitude step adjusted to divide the full circle equally [rad]
+  std::shared_ptr<const double> values_;  //!< Accelerations ordered by radius, latitude, longitude, and component
+  bool is_memory_mapped_ = false;         //!< Flag to show the values are memory-mapped from the file
+
+  /**
+   * @fn SetDimensions
+   * @brief Calculate the number of the grid points from the settings
+   */
+  void SetDimensions(const Settings& settings);
+  /**
+   * @fn GetNumberOfValues
+   * @brief Return the number of doubles of the grid values
+   */
+  inline size_t GetNumberOfValues() const { return number_of_radii_ * number_of_latitudes_ * number_of_longitudes_ * 3; }
+  /**
+   * @fn GetOffset
+   * @brief Return the offset of the acceleration of the grid point in the values
+   */
+  inline size_t GetOffset(const size_t radius_index, const size_t latitude_index, const size_t longitude_index) const {
+    return ((radius_index * number_of_latitudes_ + latitude_index) * number_of_longitudes_ + longitude_index) * 3;
+  }
+};
+
+/**
+ * @fn CalcGravityAccelerationGridChecksum
+ * @brief Calculate the checksum to identify the grid from the coefficients file and the gravity settings
+ * @param [in] coefficients_file_path: Path to the coefficients file
+ * @param [in] degree: Degree of the gravity potential
+ * @param [out] checksum: Calculated checksum
+ * @return True when the coefficients file is read successfully
+ */
+bool CalcGravityAccelerationGridChecksum(const std::string& coefficients_file_path, const size_t degree, uint64_t& checksum);
+
+#endif  // S2E_LIBRARY_GRAVITY_GRAVITY_ACCELERATION_GRID_HPP_
@@ -0,0 +1,133 @@
+/**
+ * @file gravity_coefficients_cache.cpp
+ * @brief Functions to store and load spherical harmonics gravity coefficients in a compact binary cache file
+ */
+
+#include "gravity_coefficients_cache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <utilities/shared_data_registry.hpp>
+
+namespace {
+const char kCacheMagic[8] = {'S', '2', 'E', 'G', 'R', 'A', 'V', '\0'};  //!< Identifier of the cache file
+const uint32_t kCacheVersion = 1;                                       //!< Version of the cache file format
+
+/**
+ * @struct CacheHeader
+ * @brief Header of the cache file
+ */
+struct CacheHeader {
+  char magic_[8];             //!< Identifier of the cache file
+  uint32_t version_;          //!< Version of the cache file format
+  uint32_t degree_;           //!< Maximum degree stored in the cache file
+  uint64_t source_checksum_;  //!< Checksum of the source file
+  double gravity_constant_;   //!< Gravity constant written in the source file
+  double reference_radius_;   //!< Reference radius written in the source file
+};
+}  // namespace
+
+std::string GetGravityCoefficientsCachePath(const std::string& source_file_path) { return source_file_path + ".s2ecache"; }
+
+bool CalcFileChecksum(const std::string& file_path, uint64_t& checksum) {
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file.is_open()) return false;
+
+  const uint64_t fnv_offset_basis = 14695981039346656037ULL;
+  const uint64_t fnv_prime = 1099511628211ULL;
+  checksum = fnv_offset_basis;
+
+  char buffer[65536];
+  while (file) {
+    file.read(buffer, sizeof(buffer));
+    const std::streamsize read_size = file.gcount();
+    for (std::streamsize i = 0; i < read_size; i++) {
+      checksum ^= (uint64_t)(unsigned char)buffer[i];
+      checksum *= fnv_prime;
+    }
+  }
+  return true;
+}
+
+bool ReadGravityCoefficientsCache(const std::string& source_file_path, const size_t degree, GravityCoefficients& coefficients) {
+  std::ifstream cache_file(GetGravityCoefficientsCachePath(source_file_path), std::ios::binary);
+  if (!cache_file.is_open()) return false;
+
+  CacheHeader header;
+  cache_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!cache_file) return false;
+  if (std::memcmp(header.magic_, kCacheMagic, sizeof(kCacheMagic)) != 0) return false;
+  if (header.version_ != kCacheVersion) return false;
+  if (header.degree_ < degree) return false;
+
+  uint64_t source_checksum;
+  if (!CalcFileChecksum(source_file_path, source_checksum)) return false;
+  if (header.source_checksum_ != source_checksum) return false;
+
+  // Read the triangular tables and keep the required degree only
+  const size_t number_of_coefficients = ((size_t)header.degree_ + 1) * ((size_t)header.degree_ + 2) / 2;
+  std::vector<double> c_triangular(number_of_coefficients);
+  std::vector<double> s_triangular(number_of_coefficients);
+  cache_file.read(reinterpret_cast<char*>(c_triangular.data()), number_of_coefficients * sizeof(double));
+  cache_file.read(reinterpret_cast<char*>(s_triangular.data()), number_of_coefficients * sizeof(double));
+  if (!cache_file) return false;
+
+  coefficients.degree_ = degree;
+  coefficients.gravity_constant_ = header.gravity_constant_;
+  coefficients.reference_radius_ = header.reference_radius_;
+  coefficients.c_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  coefficients.s_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 0; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      coefficients.c_[n][m] = c_triangular[n * (n + 1) / 2 + m];
+      coefficients.s_[n][m] = s_triangular[n * (n + 1) / 2 + m];
+    }
+  }
+  return true;
+}
+
+bool WriteGravityCoefficientsCache(const std::string& source_file_path, const GravityCoefficients& coefficients) {
+  CacheHeader header;
+  std::memcpy(header.magic_, kCacheMagic, sizeof(kCacheMagic));
+  header.version_ = kCacheVersion;
+  header.degree_ = (uint32_t)coefficients.degree_;
+  if (!CalcFileChecksum(source_file_path, header.source_checksum_)) return false;
+  header.gravity_constant_ = coefficients.gravity_constant_;
+  header.reference_radius_ = coefficients.reference_radius_;
+
+  const size_t degree = coefficients.degree_;
+  const size_t number_of_coefficients = (degree + 1) * (degree + 2) / 2;
+  std::vector<double> c_triangular(number_of_coefficients, 0.0);
+  std::vector<double> s_triangular(number_of_coefficients, 0.0);
+  for (size_t n = 0; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c_triangular[n * (n + 1) / 2 + m] = coefficients.c_[n][m];
+      s_triangular[n * (n + 1) / 2 + m] = coefficients.s_[n][m];
+    }
+  }
+
+  const std::string cache_file_path = GetGravityCoefficientsCachePath(source_file_path);
+  std::ofstream cache_file(cache_file_path, std::ios::binary | std::ios::trunc);
+  if (!cache_file.is_open()) {
+    std::cout << "[Warning] Gravity coefficients cache file cannot be created: " << cache_file_path << std::endl;
+    return false;
+  }
+  cache_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  cache_file.write(reinterpret_cast<const char*>(c_triangular.data()), number_of_coefficients * sizeof(double));
+  cache_file.write(reinterpret_cast<const char*>(s_triangular.data()), number_of_coefficients * sizeof(double));
+  return (bool)cache_file;
+}
+
+std::shared_ptr<const GravityCoefficients> GetSharedGravityCoefficients(const std::string& source_file_path, const size_t degree,
+                                                                        const std::function<bool(GravityCoefficients&)>& read_coefficients) {
+  auto load = [degree, &read_coefficients]() -> std::shared_ptr<const GravityCoefficients> {
+    std::shared_ptr<GravityCoefficients> coefficients = std::make_shared<GravityCoefficients>();
+    coefficients->degree_ = degree;
+    coefficients->c_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+    coefficients->s_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+    if (!read_coefficients(*coefficients)) return nullptr;
+    return coefficients;
+  };
+  return SharedDataRegistry<GravityCoefficients>::Get(MakeSharedDataKey(source_file_path, degree), load);
+}
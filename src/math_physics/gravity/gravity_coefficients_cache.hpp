@@ -0,0 +1,79 @@
+/**
+ * @file gravity_coefficients_cache.hpp
+ * @brief Functions to store and load spherical harmonics gravity coefficients in a compact binary cache file
+ * @note The text coefficient files (e.g., EGM96, GRGM1200A) take long time to parse for high degree settings.
+ *       The cache file stores the coefficients in the triangular order (n = 0...degree, m = 0...n) with the checksum of the source file,
+ *       and it is used only when the checksum matches with the current source file.
+ */
+
+#ifndef S2E_LIBRARY_GRAVITY_GRAVITY_COEFFICIENTS_CACHE_HPP_
+#define S2E_LIBRARY_GRAVITY_GRAVITY_COEFFICIENTS_CACHE_HPP_
+
+#include <stdint.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct GravityCoefficients
+ * @brief Spherical harmonics gravity coefficients stored in the cache file
+ */
+struct GravityCoefficients {
+  size_t degree_ = 0;                   //!< Maximum degree
+  double gravity_constant_ = 0.0;       //!< Gravity constant written in the source file (unit depends on the source file)
+  double reference_radius_ = 0.0;       //!< Reference radius written in the source file (unit depends on the source file)
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+};
+
+/**
+ * @fn GetGravityCoefficientsCachePath
+ * @brief Return the cache file path for the source coefficients file
+ * @param [in] source_file_path: Path to the source text coefficients file
+ */
+std::string GetGravityCoefficientsCachePath(const std::string& source_file_path);
+
+/**
+ * @fn CalcFileChecksum
+ * @brief Calculate the 64bit FNV-1a hash of the file
+ * @param [in] file_path: Path to the target file
+ * @param [out] checksum: Calculated checksum
+ * @return True when the file is read successfully
+ */
+bool CalcFileChecksum(const std::string& file_path, uint64_t& checksum);
+
+/**
+ * @fn ReadGravityCoefficientsCache
+ * @brief Read the coefficients from the cache file
+ * @param [in] source_file_path: Path to the source text coefficients file
+ * @param [in] degree: Required maximum degree
+ * @param [out] coefficients: Read coefficients. The size of the coefficient tables is (degree + 1) x (degree + 1).
+ * @return True when a valid cache exists for the source file and the degree
+ */
+bool ReadGravityCoefficientsCache(const std::string& source_file_path, const size_t degree, GravityCoefficients& coefficients);
+
+/**
+ * @fn WriteGravityCoefficientsCache
+ * @brief Write the coefficients to the cache file
+ * @param [in] source_file_path: Path to the source text coefficients file
+ * @param [in] coefficients: Coefficients read from the source file
+ * @return True when the cache file is written successfully
+ */
+bool WriteGravityCoefficientsCache(const std::string& source_file_path, const GravityCoefficients& coefficients);
+
+/**
+ * @fn GetSharedGravityCoefficients
+ * @brief Return the coefficients shared between the instances with the same source file and degree
+ * @note The coefficients are read only once in the process and shared by SharedDataRegistry (e.g., spacecraft, branches of the simulation
+ *       case, and sequential Monte-Carlo simulation cases).
+ * @param [in] source_file_path: Path to the source text coefficients file
+ * @param [in] degree: Required maximum degree
+ * @param [in] read_coefficients: Function to read the coefficients when they are not shared yet. Return false when the read fails.
+ * @return Shared coefficients. nullptr when read_coefficients fails.
+ */
+std::shared_ptr<const GravityCoefficients> GetSharedGravityCoefficients(const std::string& source_file_path, const size_t degree,
+                                                                        const std::function<bool(GravityCoefficients&)>& read_coefficients);
+
+#endif  // S2E_LIBRARY_GRAVITY_GRAVITY_COEFFICIENTS_CACHE_HPP_
@@ -5,87 +5,174 @@
 
 #include "gravity_potential.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <utilities/memory_usage.hpp>
+
+namespace {
+/**
+ * @fn MakeGravityCoefficients
+ * @brief Make the coefficients from the tables
+ */
+std::shared_ptr<const GravityCoefficients> MakeGravityCoefficients(const size_t degree, const std::vector<std::vector<double>>& cosine_coefficients,
+                                                                   const std::vector<std::vector<double>>& sine_coefficients) {
+  std::shared_ptr<GravityCoefficients> coefficients = std::make_shared<GravityCoefficients>();
+  coefficients->degree_ = degree;
+  coefficients->c_ = cosine_coefficients;
+  coefficients->s_ = sine_coefficients;
+  return coefficients;
+}
+}  // namespace
 
 GravityPotential::GravityPotential(const size_t degree, const std::vector<std::vector<double>> cosine_coefficients,
                                    const std::vector<std::vector<double>> sine_coefficients, const double gravity_constants_m3_s2,
                                    const double center_body_radius_m)
+    : GravityPotential(degree, MakeGravityCoefficients(degree, cosine_coefficients, sine_coefficients), gravity_constants_m3_s2,
+                       center_body_radius_m) {}
+
+GravityPotential::GravityPotential(const size_t degree, const std::shared_ptr<const GravityCoefficients> coefficients,
+                                   const double gravity_constants_m3_s2, const double center_body_radius_m)
     : degree_(degree),
-      c_(cosine_coefficients),
-      s_(sine_coefficients),
+      coefficients_(coefficients),
       gravity_constants_m3_s2_(gravity_constants_m3_s2),
       center_body_radius_m_(center_body_radius_m) {
   // degree
-  if (degree_ <= 1) {  // TODO: Consider this assertion is needed
+  if (degree_ <= 1 || coefficients_ == nullptr) {  // TODO: Consider this assertion is needed
     degree_ = 0;
   }
   // coefficients
   // TODO Check size
+
+  // Workspace for V and W functions
+  // The partial derivative calculation requires V and W functions up to degree + 2
+  if (degree_ > 0) {
+    degree_vw_max_ = degree_ + 2;
+    const size_t workspace_size = GetVwIndex(degree_vw_max_, degree_vw_max_) + 1;
+    v_.assign(workspace_size, 0.0);
+    w_.assign(workspace_size, 0.0);
+    InitializeNormalizationFactors();
+  }
+  maximum_degree_ = degree_;
+}
+
+void GravityPotential::SetDegree(const size_t degree) {
+  // The tables are in the triangular layout, so the tables of the maximum degree are used for the lower degree
+  degree_ = std::min(degree, maximum_degree_);
+  if (degree_ <= 1) degree_ = 0;
 }
 
 libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m) {
   libra::Vector<3> acceleration_xcxf_m_s2(0.0);
   if (degree_ <= 0) return acceleration_xcxf_m_s2;  // TODO: Consider this assertion is needed
 
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
+  // Calc V and W
+  CalcVw(position_xcxf_m, degree_ + 1);
+
+  return CalcAccelerationFromVw();
+}
+
+libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) {
+  libra::Matrix<3, 3> partial_derivative(0.0);
+  if (degree_ <= 0) return partial_derivative;
 
   // Calc V and W
-  const size_t degree_vw = degree_ + 1;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
+  CalcVw(position_xcxf_m, degree_ + 2);
 
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
-      } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
-      }
+  return CalcPartialDerivativeFromVw();
+}
+
+void GravityPotential::CalcAccelerationAndPartialDerivative_xcxf(const libra::Vector<3> &position_xcxf_m, libra::Vector<3> &acceleration_xcxf_m_s2,
+                                                                  libra::Matrix<3, 3> &partial_derivative_xcxf_s2) {
+  if (degree_ <= 0) {
+    acceleration_xcxf_m_s2 = libra::Vector<3>(0.0);
+    partial_derivative_xcxf_s2 = libra::Matrix<3, 3>(0.0);
+    return;
+  }
+
+  // Calc V and W once up to the degree required by the partial derivative
+  CalcVw(position_xcxf_m, degree_ + 2);
+
+  acceleration_xcxf_m_s2 = CalcAccelerationFromVw();
+  partial_derivative_xcxf_s2 = CalcPartialDerivativeFromVw();
+}
+
+void GravityPotential::CalcAcceleration_xcxf_m_s2(const std::vector<double> &position_x_xcxf_m, const std::vector<double> &position_y_xcxf_m,
+                                                  const std::vector<double> &position_z_xcxf_m, std::vector<double> &acceleration_x_xcxf_m_s2,
+                                                  std::vector<double> &acceleration_y_xcxf_m_s2, std::vector<double> &acceleration_z_xcxf_m_s2) {
+  const size_t number_of_positions = position_x_xcxf_m.size();
+  acceleration_x_xcxf_m_s2.assign(number_of_positions, 0.0);
+  acceleration_y_xcxf_m_s2.assign(number_of_positions, 0.0);
+  acceleration_z_xcxf_m_s2.assign(number_of_positions, 0.0);
+  if (degree_ <= 0) return;
+  if (position_y_xcxf_m.size() != number_of_positions || position_z_xcxf_m.size() != number_of_positions) {
+    std::cerr << "[WARNING] GravityPotential: the sizes of the position arrays are different." << std::endl;
+    return;
+  }
+
+  // The batch workspace is allocated only when the batched calculation is used
+  const size_t workspace_size = (GetVwIndex(degree_ + 1, degree_ + 1) + 1) * kBatchSize;
+  if (v_batch_.size() < workspace_size) {
+    v_batch_.assign(workspace_size, 0.0);
+    w_batch_.assign(workspace_size, 0.0);
+  }
+
+  for (size_t offset = 0; offset < number_of_positions; offset += kBatchSize) {
+    const size_t block_size = std::min(kBatchSize, number_of_positions - offset);
+
+    // Unused lanes of the last block are filled with the first position of the block
+    double x_m[kBatchSize], y_m[kBatchSize], z_m[kBatchSize];
+    for (size_t k = 0; k < kBatchSize; k++) {
+      const size_t position_id = (k < block_size) ? offset + k : offset;
+      x_m[k] = position_x_xcxf_m[position_id];
+      y_m[k] = position_y_xcxf_m[position_id];
+      z_m[k] = position_z_xcxf_m[position_id];
+    }
+
+    CalcVwBatch(x_m, y_m, z_m, degree_ + 1);
+
+    double acceleration_x_m_s2[kBatchSize], acceleration_y_m_s2[kBatchSize], acceleration_z_m_s2[kBatchSize];
+    CalcAccelerationFromVwBatch(acceleration_x_m_s2, acceleration_y_m_s2, acceleration_z_m_s2);
+
+    for (size_t k = 0; k < block_size; k++) {
+      acceleration_x_xcxf_m_s2[offset + k] = acceleration_x_m_s2[k];
+      acceleration_y_xcxf_m_s2[offset + k] = acceleration_y_m_s2[k];
+      acceleration_z_xcxf_m_s2[offset + k] = acceleration_z_m_s2[k];
     }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
   }
+}
+
+libra::Vector<3> GravityPotential::CalcAccelerationFromVw() {
+  const std::vector<std::vector<double>> &c = coefficients_->c_;
+  const std::vector<std::vector<double>> &s = coefficients_->s_;
+  libra::Vector<3> acceleration_xcxf_m_s2(0.0);
 
   // Calc Acceleration
   for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
   {
     m_ = 0;
     const double n_d = (double)n_;
-    const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
-    const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    const double *v_n1 = &v_[GetVwIndex(n_ + 1, 0)];  // V(n+1, m) row
+    const double *w_n1 = &w_[GetVwIndex(n_ + 1, 0)];  // W(n+1, m) row
+    const size_t index_n0 = GetVwIndex(n_, 0);
     // m_==0
-    acceleration_xcxf_m_s2[0] += -c_[n_][0] * v[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[1] += -c_[n_][0] * w[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[2] += (n_ + 1.0) * (-c_[n_][0] * v[n_ + 1][0] - s_[n_][0] * w[n_ + 1][0]) * normalize;
+    acceleration_xcxf_m_s2[0] += -c[n_][0] * v_n1[1] * acceleration_normalize_xy1_[index_n0];
+    acceleration_xcxf_m_s2[1] += -c[n_][0] * w_n1[1] * acceleration_normalize_xy1_[index_n0];
+    acceleration_xcxf_m_s2[2] += (n_ + 1.0) * (-c[n_][0] * v_n1[0] - s[n_][0] * w_n1[0]) * acceleration_normalize_z_[index_n0];
     for (m_ = 1; m_ <= n_; m_++) {
       const double m_d = (double)m_;
-      const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
-      const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
-      double normalize_xy2;
-      if (m_ == 1) {
-        normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
-      } else {
-        normalize_xy2 = normalize * sqrt(factorial);
-      }
-      const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
-
-      acceleration_xcxf_m_s2[0] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * v[n_ + 1][m_ + 1] - s_[n_][m_] * w[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (c_[n_][m_] * v[n_ + 1][m_ - 1] + s_[n_][m_] * w[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[1] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * w[n_ + 1][m_ + 1] + s_[n_][m_] * v[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (-c_[n_][m_] * w[n_ + 1][m_ - 1] + s_[n_][m_] * v[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[2] += (n_d - m_d + 1.0) * (-c_[n_][m_] * v[n_ + 1][m_] - s_[n_][m_] * w[n_ + 1][m_]) * normalize_z;
+      const size_t index_nm = GetVwIndex(n_, m_);
+      const double normalize_xy1 = acceleration_normalize_xy1_[index_nm];
+      const double normalize_xy2 = acceleration_normalize_xy2_[index_nm];
+      const double normalize_z = acceleration_normalize_z_[index_nm];
+
+      acceleration_xcxf_m_s2[0] += 0.5 * (normalize_xy1 * (-c[n_][m_] * v_n1[m_ + 1] - s[n_][m_] * w_n1[m_ + 1]) +
+                                          normalize_xy2 * (c[n_][m_] * v_n1[m_ - 1] + s[n_][m_] * w_n1[m_ - 1]));
+      acceleration_xcxf_m_s2[1] += 0.5 * (normalize_xy1 * (-c[n_][m_] * w_n1[m_ + 1] + s[n_][m_] * v_n1[m_ + 1]) +
+                                          normalize_xy2 * (-c[n_][m_] * w_n1[m_ - 1] + s[n_][m_] * v_n1[m_ - 1]));
+      acceleration_xcxf_m_s2[2] += (n_d - m_d + 1.0) * (-c[n_][m_] * v_n1[m_] - s[n_][m_] * w_n1[m_]) * normalize_z;
     }
   }
   acceleration_xcxf_m_s2 *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
@@ -93,130 +180,64 @@ libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vecto
   return acceleration_xcxf_m_s2;
 }
 
-libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) {
+libra::Matrix<3, 3> GravityPotential::CalcPartialDerivativeFromVw() {
+  const std::vector<std::vector<double>> &c = coefficients_->c_;
+  const std::vector<std::vector<double>> &s = coefficients_->s_;
   libra::Matrix<3, 3> partial_derivative(0.0);
-  if (degree_ <= 0) return partial_derivative;
-
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
-
-  // Calc V and W
-  const size_t degree_vw = degree_ + 2;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
-      } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
-      }
-    }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
-  }
 
   // Calc partial derivatives
   for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
   {
     const double n_d = (double)n_;
-
-    // C_n_0 * V_n+2_m
-    const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
-    const double normalize_cn0_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
-    const double normalize_cn0_v22 = normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
+    const double *v_n2 = &v_[GetVwIndex(n_ + 2, 0)];  // V(n+2, m) row
+    const double *w_n2 = &w_[GetVwIndex(n_ + 2, 0)];  // W(n+2, m) row
 
     for (m_ = 0; m_ <= n_; m_++) {
-      const double m_d = (double)m_;
+      const size_t index_nm = GetVwIndex(n_, m_);
+      const double normalize_xy_p2 = partial_derivative_normalize_xy_p2_[index_nm];
+      const double normalize_xy_0 = partial_derivative_normalize_xy_0_[index_nm];
 
       // dx/dx, dx/dy, dy/dy
       if (m_ == 0) {
-        partial_derivative[0][0] +=
-            0.5 * (c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
-        partial_derivative[1][1] +=
-            0.5 * (-c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
+        partial_derivative[0][0] += 0.5 * (c[n_][0] * v_n2[2] * normalize_xy_p2 - c[n_][0] * v_n2[0] * normalize_xy_0);
+        partial_derivative[1][1] += 0.5 * (-c[n_][0] * v_n2[2] * normalize_xy_p2 - c[n_][0] * v_n2[0] * normalize_xy_0);
 
-        partial_derivative[0][1] += 0.5 * (c_[n_][0] * w[n_ + 2][2] * normalize_cn0_v22);
+        partial_derivative[0][1] += 0.5 * (c[n_][0] * w_n2[2] * normalize_xy_p2);
       } else if (m_ == 1) {
-        const double normalize_cn1_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
-        const double normalize_cn1_v21_with_coeff = n_d * (n_d + 1.0) * normalize_cn1_v21;
-        const double normalize_cn1_v23 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][1] * v[n_ + 2][3] + s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (3.0 * c_[n_][1] * v[n_ + 2][1] + s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][1] * v[n_ + 2][3] - s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * v[n_ + 2][1] + 3.0 * s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-
-        partial_derivative[0][1] += 0.25 * ((c_[n_][1] * w[n_ + 2][3] - s_[n_][1] * v[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * w[n_ + 2][1] + s_[n_][1] * v[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-      } else if (m_ == 2) {
-        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
-        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(2.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
-        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
-        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[0][0] += 0.25 * ((c[n_][1] * v_n2[3] + s[n_][1] * w_n2[3]) * normalize_xy_p2 -
+                                            (3.0 * c[n_][1] * v_n2[1] + s[n_][1] * w_n2[1]) * normalize_xy_0);
+        partial_derivative[1][1] += 0.25 * ((-c[n_][1] * v_n2[3] - s[n_][1] * w_n2[3]) * normalize_xy_p2 -
+                                            (c[n_][1] * v_n2[1] + 3.0 * s[n_][1] * w_n2[1]) * normalize_xy_0);
+
+        partial_derivative[0][1] += 0.25 * ((c[n_][1] * w_n2[3] - s[n_][1] * v_n2[3]) * normalize_xy_p2 -
+                                            (c[n_][1] * w_n2[1] + s[n_][1] * v_n2[1]) * normalize_xy_0);
       } else {
-        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
-        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(1.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
-        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
-        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        const double normalize_xy_m2 = partial_derivative_normalize_xy_m2_[index_nm];
+
+        partial_derivative[0][0] += 0.25 * ((c[n_][m_] * v_n2[m_ + 2] + s[n_][m_] * w_n2[m_ + 2]) * normalize_xy_p2 -
+                                            (c[n_][m_] * v_n2[m_] + s[n_][m_] * w_n2[m_]) * normalize_xy_0 +
+                                            (c[n_][m_] * v_n2[m_ - 2] + s[n_][m_] * w_n2[m_ - 2]) * normalize_xy_m2);
+        partial_derivative[1][1] += 0.25 * ((-c[n_][m_] * v_n2[m_ + 2] - s[n_][m_] * w_n2[m_ + 2]) * normalize_xy_p2 -
+                                            (c[n_][m_] * v_n2[m_] + s[n_][m_] * w_n2[m_]) * normalize_xy_0 -
+                                            (c[n_][m_] * v_n2[m_ - 2] + s[n_][m_] * w_n2[m_ - 2]) * normalize_xy_m2);
+        partial_derivative[0][1] += 0.25 * ((c[n_][m_] * w_n2[m_ + 2] - s[n_][m_] * v_n2[m_ + 2]) * normalize_xy_p2 +
+                                            (-c[n_][m_] * w_n2[m_ - 2] + s[n_][m_] * v_n2[m_ - 2]) * normalize_xy_m2);
       }
       // dx/dz, dy/dz
+      const double normalize_z_p1 = partial_derivative_normalize_z_p1_[index_nm];
       if (m_ == 0) {
-        partial_derivative[0][2] += (n_d + 1.0) * (c_[n_][0] * v[n_ + 2][1] * normalize_cn0_v21);
-        partial_derivative[1][2] += (n_d + 1.0) * (c_[n_][0] * w[n_ + 2][1] * normalize_cn0_v21);
-      } else if (m_ == 1) {
-        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
-        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
-        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt(2.0 * (n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
-        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
-
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+        partial_derivative[0][2] += (n_d + 1.0) * (c[n_][0] * v_n2[1] * normalize_z_p1);
+        partial_derivative[1][2] += (n_d + 1.0) * (c[n_][0] * w_n2[1] * normalize_z_p1);
       } else {
-        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
-        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
-        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
-        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
-
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+        const double normalize_z_m1 = partial_derivative_normalize_z_m1_[index_nm];
+
+        partial_derivative[0][2] += 0.5 * ((+c[n_][m_] * v_n2[m_ + 1] + s[n_][m_] * w_n2[m_ + 1]) * normalize_z_p1 +
+                                           (-c[n_][m_] * v_n2[m_ - 1] - s[n_][m_] * w_n2[m_ - 1]) * normalize_z_m1);
+        partial_derivative[1][2] += 0.5 * ((+c[n_][m_] * w_n2[m_ + 1] - s[n_][m_] * v_n2[m_ + 1]) * normalize_z_p1 +
+                                           (+c[n_][m_] * w_n2[m_ - 1] - s[n_][m_] * v_n2[m_ - 1]) * normalize_z_m1);
       }
       // dz/dz
-      double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-      double normalize_cnm_v20_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-      partial_derivative[2][2] += (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff;
+      partial_derivative[2][2] += (c[n_][m_] * v_n2[m_] + s[n_][m_] * w_n2[m_]) * partial_derivative_normalize_zz_[index_nm];
     }
   }
   // Symmetry property
@@ -230,48 +251,282 @@ libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra:
   return partial_derivative;
 }
 
-void GravityPotential::v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev) {
-  if (n_ != m_) return;
+void GravityPotential::InitializeNormalizationFactors() {
+  // V and W recursion
+  const size_t vw_table_size = GetVwIndex(degree_vw_max_, degree_vw_max_) + 1;
+  vw_nn_normalize_.assign(degree_vw_max_ + 1, 0.0);
+  vw_nm_normalize_1_.assign(vw_table_size, 0.0);
+  vw_nm_normalize_2_.assign(vw_table_size, 0.0);
+  for (size_t n = 1; n <= degree_vw_max_; n++) {
+    const double n_d = (double)n;
+    if (n == 1) {
+      vw_nn_normalize_[n] = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+    } else {
+      vw_nn_normalize_[n] = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+    }
+    for (size_t m = 0; m < n; m++) {
+      const double m_d = (double)m;
+      const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize;
+      if (n <= 1) {
+        c2_normalize = 1.0;
+      } else {
+        c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+      }
+      vw_nm_normalize_1_[GetVwIndex(n, m)] = c_normalize * c1;
+      vw_nm_normalize_2_[GetVwIndex(n, m)] = c_normalize * c2 * c2_normalize;
+    }
+  }
+
+  // Acceleration and partial derivative
+  const size_t table_size = GetVwIndex(degree_, degree_) + 1;
+  acceleration_normalize_xy1_.assign(table_size, 0.0);
+  acceleration_normalize_xy2_.assign(table_size, 0.0);
+  acceleration_normalize_z_.assign(table_size, 0.0);
+  partial_derivative_normalize_xy_p2_.assign(table_size, 0.0);
+  partial_derivative_normalize_xy_0_.assign(table_size, 0.0);
+  partial_derivative_normalize_xy_m2_.assign(table_size, 0.0);
+  partial_derivative_normalize_z_p1_.assign(table_size, 0.0);
+  partial_derivative_normalize_z_m1_.assign(table_size, 0.0);
+  partial_derivative_normalize_zz_.assign(table_size, 0.0);
+  for (size_t n = 0; n <= degree_; n++) {
+    const double n_d = (double)n;
+    const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+    const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
+
+    for (size_t m = 0; m <= n; m++) {
+      const double m_d = (double)m;
+      const size_t index = GetVwIndex(n, m);
+
+      // Acceleration
+      if (m == 0) {
+        acceleration_normalize_xy1_[index] = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+        acceleration_normalize_z_[index] = normalize;
+      } else {
+        const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+        acceleration_normalize_xy1_[index] = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+        if (m == 1) {
+          acceleration_normalize_xy2_[index] = normalize * sqrt(factorial) * sqrt(2.0);
+        } else {
+          acceleration_normalize_xy2_[index] = normalize * sqrt(factorial);
+        }
+        acceleration_normalize_z_[index] = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+      }
+
+      // Partial derivative: dx/dx, dx/dy, dy/dy
+      if (m == 0) {
+        partial_derivative_normalize_xy_p2_[index] = normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
+        partial_derivative_normalize_xy_0_[index] = (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20;
+      } else if (m == 1) {
+        const double normalize_cn1_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
+        partial_derivative_normalize_xy_p2_[index] = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
+        partial_derivative_normalize_xy_0_[index] = n_d * (n_d + 1.0) * normalize_cn1_v21;
+      } else {
+        const double factorial_m2 = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0);
+        const double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt((m == 2 ? 2.0 : 1.0) / factorial_m2);
+        const double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+        partial_derivative_normalize_xy_p2_[index] =
+            normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
+        partial_derivative_normalize_xy_0_[index] = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
+        partial_derivative_normalize_xy_m2_[index] = factorial_m2 * normalize_cnm_v2m2;
+      }
+
+      // Partial derivative: dx/dz, dy/dz
+      if (m == 0) {
+        partial_derivative_normalize_z_p1_[index] = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
+      } else {
+        const double factorial_m1 = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0);
+        const double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
+        const double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt((m == 1 ? 2.0 : 1.0) * (n_d + m_d + 1.0) / factorial_m1);
+        partial_derivative_normalize_z_p1_[index] = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
+        partial_derivative_normalize_z_m1_[index] = factorial_m1 * normalize_cnm_v2m1;
+      }
+
+      // Partial derivative: dz/dz
+      const double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+      partial_derivative_normalize_zz_[index] = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
+    }
+  }
+}
 
-  const double n_d = (double)n_;
+void GravityPotential::CalcVw(const libra::Vector<3> &position_xcxf_m, const size_t degree_vw) {
+  xcxf_x_m_ = position_xcxf_m[0];
+  xcxf_y_m_ = position_xcxf_m[1];
+  xcxf_z_m_ = position_xcxf_m[2];
+  radius_m_ = position_xcxf_m.CalcNorm();
 
   const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
   const double x_tmp = xcxf_x_m_ * tmp;
   const double y_tmp = xcxf_y_m_ * tmp;
-  double c_normalize;
-  if (n_ == 1) {
-    c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
-  } else {
-    c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+  const double z_tmp = xcxf_z_m_ * tmp;
+  const double re_tmp = center_body_radius_m_ * tmp;
+
+  // n = m = 0
+  v_[0] = center_body_radius_m_ / radius_m_;
+  w_[0] = 0.0;
+
+  for (m_ = 0; m_ <= degree_vw; m_++) {
+    // n = m
+    if (m_ > 0) {
+      const size_t index_nn = GetVwIndex(m_, m_);
+      const size_t index_prev = GetVwIndex(m_ - 1, m_ - 1);
+      v_[index_nn] = vw_nn_normalize_[m_] * (x_tmp * v_[index_prev] - y_tmp * w_[index_prev]);
+      w_[index_nn] = vw_nn_normalize_[m_] * (x_tmp * w_[index_prev] + y_tmp * v_[index_prev]);
+    }
+    // n != m
+    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
+      const size_t index_nm = GetVwIndex(n_, m_);
+      const size_t index_prev = GetVwIndex(n_ - 1, m_);
+      const double c1 = vw_nm_normalize_1_[index_nm] * z_tmp;
+      if (n_ <= m_ + 1) {
+        v_[index_nm] = c1 * v_[index_prev];
+        w_[index_nm] = c1 * w_[index_prev];
+      } else {
+        const size_t index_prev2 = GetVwIndex(n_ - 2, m_);
+        const double c2 = vw_nm_normalize_2_[index_nm] * re_tmp;
+        v_[index_nm] = c1 * v_[index_prev] - c2 * v_[index_prev2];
+        w_[index_nm] = c1 * w_[index_prev] - c2 * w_[index_prev2];
+      }
+    }
+  }
+}
+
+void GravityPotential::CalcVwBatch(const double *x_m, const double *y_m, const double *z_m, const size_t degree_vw) {
+  double x_tmp[kBatchSize], y_tmp[kBatchSize], z_tmp[kBatchSize], re_tmp[kBatchSize];
+  for (size_t k = 0; k < kBatchSize; k++) {
+    const double radius_m = sqrt(x_m[k] * x_m[k] + y_m[k] * y_m[k] + z_m[k] * z_m[k]);
+    const double tmp = center_body_radius_m_ / (radius_m * radius_m);
+    x_tmp[k] = x_m[k] * tmp;
+    y_tmp[k] = y_m[k] * tmp;
+    z_tmp[k] = z_m[k] * tmp;
+    re_tmp[k] = center_body_radius_m_ * tmp;
+
+    // n = m = 0
+    v_batch_[k] = center_body_radius_m_ / radius_m;
+    w_batch_[k] = 0.0;
   }
 
-  *v_nn = c_normalize * (x_tmp * v_prev - y_tmp * w_prev);
-  *w_nn = c_normalize * (x_tmp * w_prev + y_tmp * v_prev);
-  return;
+  for (size_t m = 0; m <= degree_vw; m++) {
+    // n = m
+    if (m > 0) {
+      double *v_nn = &v_batch_[GetVwIndex(m, m) * kBatchSize];
+      double *w_nn = &w_batch_[GetVwIndex(m, m) * kBatchSize];
+      const double *v_prev = &v_batch_[GetVwIndex(m - 1, m - 1) * kBatchSize];
+      const double *w_prev = &w_batch_[GetVwIndex(m - 1, m - 1) * kBatchSize];
+      const double c_normalize = vw_nn_normalize_[m];
+      for (size_t k = 0; k < kBatchSize; k++) {
+        v_nn[k] = c_normalize * (x_tmp[k] * v_prev[k] - y_tmp[k] * w_prev[k]);
+        w_nn[k] = c_normalize * (x_tmp[k] * w_prev[k] + y_tmp[k] * v_prev[k]);
+      }
+    }
+    // n != m
+    for (size_t n = m + 1; n <= degree_vw; n++) {
+      const size_t index_nm = GetVwIndex(n, m);
+      double *v_nm = &v_batch_[index_nm * kBatchSize];
+      double *w_nm = &w_batch_[index_nm * kBatchSize];
+      const double *v_prev = &v_batch_[GetVwIndex(n - 1, m) * kBatchSize];
+      const double *w_prev = &w_batch_[GetVwIndex(n - 1, m) * kBatchSize];
+      const double c1_normalize = vw_nm_normalize_1_[index_nm];
+      if (n <= m + 1) {
+        for (size_t k = 0; k < kBatchSize; k++) {
+          const double c1 = c1_normalize * z_tmp[k];
+          v_nm[k] = c1 * v_prev[k];
+          w_nm[k] = c1 * w_prev[k];
+        }
+      } else {
+        const double *v_prev2 = &v_batch_[GetVwIndex(n - 2, m) * kBatchSize];
+        const double *w_prev2 = &w_batch_[GetVwIndex(n - 2, m) * kBatchSize];
+        const double c2_normalize = vw_nm_normalize_2_[index_nm];
+        for (size_t k = 0; k < kBatchSize; k++) {
+          const double c1 = c1_normalize * z_tmp[k];
+          const double c2 = c2_normalize * re_tmp[k];
+          v_nm[k] = c1 * v_prev[k] - c2 * v_prev2[k];
+          w_nm[k] = c1 * w_prev[k] - c2 * w_prev2[k];
+        }
+      }
+    }
+  }
 }
 
-void GravityPotential::v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2,
-                                     const double w_prev2) {
-  if (n_ == m_) return;
+void GravityPotential::CalcAccelerationFromVwBatch(double *acceleration_x_m_s2, double *acceleration_y_m_s2, double *acceleration_z_m_s2) const {
+  const std::vector<std::vector<double>> &c = coefficients_->c_;
+  const std::vector<std::vector<double>> &s = coefficients_->s_;
+  for (size_t k = 0; k < kBatchSize; k++) {
+    acceleration_x_m_s2[k] = 0.0;
+    acceleration_y_m_s2[k] = 0.0;
+    acceleration_z_m_s2[k] = 0.0;
+  }
 
-  const double m_d = (double)m_;
-  const double n_d = (double)n_;
+  for (size_t n = 0; n <= degree_; n++) {
+    const double n_d = (double)n;
+    const double *v_n1 = &v_batch_[GetVwIndex(n + 1, 0) * kBatchSize];  // V(n+1, m) row
+    const double *w_n1 = &w_batch_[GetVwIndex(n + 1, 0) * kBatchSize];  // W(n+1, m) row
+
+    // m = 0
+    const size_t index_n0 = GetVwIndex(n, 0);
+    const double c_n0 = c[n][0];
+    const double s_n0 = s[n][0];
+    const double normalize_xy_n0 = acceleration_normalize_xy1_[index_n0];
+    const double normalize_z_n0 = acceleration_normalize_z_[index_n0];
+    for (size_t k = 0; k < kBatchSize; k++) {
+      acceleration_x_m_s2[k] += -c_n0 * v_n1[kBatchSize + k] * normalize_xy_n0;
+      acceleration_y_m_s2[k] += -c_n0 * w_n1[kBatchSize + k] * normalize_xy_n0;
+      acceleration_z_m_s2[k] += (n + 1.0) * (-c_n0 * v_n1[k] - s_n0 * w_n1[k]) * normalize_z_n0;
+    }
 
-  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
-  const double z_tmp = xcxf_z_m_ * tmp;
-  const double re_tmp = center_body_radius_m_ * tmp;
-  const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
-  const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
-  double c_normalize, c2_normalize;
-
-  c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
-  if (n_ <= 1) {
-    c2_normalize = 1.0;
-  } else {
-    c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+    for (size_t m = 1; m <= n; m++) {
+      const double m_d = (double)m;
+      const size_t index_nm = GetVwIndex(n, m);
+      const double c_nm = c[n][m];
+      const double s_nm = s[n][m];
+      const double normalize_xy1 = acceleration_normalize_xy1_[index_nm];
+      const double normalize_xy2 = acceleration_normalize_xy2_[index_nm];
+      const double normalize_z = acceleration_normalize_z_[index_nm];
+      const double *v_p1 = &v_n1[(m + 1) * kBatchSize];
+      const double *w_p1 = &w_n1[(m + 1) * kBatchSize];
+      const double *v_0 = &v_n1[m * kBatchSize];
+      const double *w_0 = &w_n1[m * kBatchSize];
+      const double *v_m1 = &v_n1[(m - 1) * kBatchSize];
+      const double *w_m1 = &w_n1[(m - 1) * kBatchSize];
+
+      for (size_t k = 0; k < kBatchSize; k++) {
+        acceleration_x_m_s2[k] += 0.5 * (normalize_xy1 * (-c_nm * v_p1[k] - s_nm * w_p1[k]) + normalize_xy2 * (c_nm * v_m1[k] + s_nm * w_m1[k]));
+        acceleration_y_m_s2[k] += 0.5 * (normalize_xy1 * (-c_nm * w_p1[k] + s_nm * v_p1[k]) + normalize_xy2 * (-c_nm * w_m1[k] + s_nm * v_m1[k]));
+        acceleration_z_m_s2[k] += (n_d - m_d + 1.0) * (-c_nm * v_0[k] - s_nm * w_0[k]) * normalize_z;
+      }
+    }
+  }
+
+  const double coefficient = gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
+  for (size_t k = 0; k < kBatchSize; k++) {
+    acceleration_x_m_s2[k] *= coefficient;
+    acceleration_y_m_s2[k] *= coefficient;
+    acceleration_z_m_s2[k] *= coefficient;
   }
+}
+
+size_t GravityPotential::GetMemoryUsage_bytes() const {
+  size_t bytes = sizeof(*this) + CalcHeapMemory_bytes(v_) + CalcHeapMemory_bytes(w_);
+  bytes += CalcHeapMemory_bytes(v_batch_) + CalcHeapMemory_bytes(w_batch_);
+  const std::vector<double>* normalization_factors[] = {&vw_nn_normalize_,
+                                                        &vw_nm_normalize_1_,
+                                                        &vw_nm_normalize_2_,
+                                                        &acceleration_normalize_xy1_,
+                                                        &acceleration_normalize_xy2_,
+                                                        &acceleration_normalize_z_,
+                                                        &partial_derivative_normalize_xy_p2_,
+                                                        &partial_derivative_normalize_xy_0_,
+                                                        &partial_derivative_normalize_xy_m2_,
+                                                        &partial_derivative_normalize_z_p1_,
+                                                        &partial_derivative_normalize_z_m1_,
+                                                        &partial_derivative_normalize_zz_};
+  for (const auto factors : normalization_factors) bytes += CalcHeapMemory_bytes(*factors);
+  return bytes;
+}
 
-  *v_nm = c_normalize * (c1 * z_tmp * v_prev - c2 * c2_normalize * re_tmp * v_prev2);
-  *w_nm = c_normalize * (c1 * z_tmp * w_prev - c2 * c2_normalize * re_tmp * w_prev2);
-  return;
+size_t GravityPotential::GetCoefficientsMemoryUsage_bytes() const {
+  if (coefficients_ == nullptr) return 0;
+  return sizeof(GravityCoefficients) + CalcHeapMemory_bytes(coefficients_->c_) + CalcHeapMemory_bytes(coefficients_->s_);
 }
@@ -7,10 +7,12 @@
 #define S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
 
 #include <environment/global/physical_constants.hpp>
+#include <memory>
 #include <vector>
 
 #include "../math/matrix.hpp"
 #include "../math/vector.hpp"
+#include "gravity_coefficients_cache.hpp"
 
 /**
  * @class GravityPotential
@@ -34,6 +36,16 @@ class GravityPotential {
                    const std::vector<std::vector<double>> sine_coefficients,
                    const double gravity_constants_m3_s2 = environment::earth_gravitational_constant_m3_s2,
                    const double center_body_radius_m = environment::earth_equatorial_radius_m);
+  /**
+   * @fn GravityPotential
+   * @brief Constructor with the coefficients shared between the instances
+   * @note The copies of the instance also share the coefficients, and only the workspace is copied.
+   * @param [in] degree: Maximum degree setting to calculate the geo-potential
+   * @param [in] coefficients: Coefficients whose tables have (degree + 1) x (degree + 1) elements at least
+   */
+  GravityPotential(const size_t degree, const std::shared_ptr<const GravityCoefficients> coefficients,
+                   const double gravity_constants_m3_s2 = environment::earth_gravitational_constant_m3_s2,
+                   const double center_body_radius_m = environment::earth_equatorial_radius_m);
   /**
    * @fn ~GravityPotential
    * @brief Destructor
@@ -56,31 +68,150 @@ class GravityPotential {
    */
   libra::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m);
 
+  /**
+   * @fn CalcAccelerationAndPartialDerivative_xcxf
+   * @brief Calculate the acceleration and its partial derivative in the XCXF frame with a single V and W recursion
+   * @note This is faster than calling CalcAcceleration_xcxf_m_s2 and CalcPartialDerivative_xcxf_s2 separately (e.g., for STM propagation)
+   * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
+   * @param [out] acceleration_xcxf_m_s2: Acceleration in XCXF frame [m/s2]
+   * @param [out] partial_derivative_xcxf_s2: Partial derivative of acceleration in XCXF frame [-/s2]
+   */
+  void CalcAccelerationAndPartialDerivative_xcxf(const libra::Vector<3> &position_xcxf_m, libra::Vector<3> &acceleration_xcxf_m_s2,
+                                                 libra::Matrix<3, 3> &partial_derivative_xcxf_s2);
+
+  /**
+   * @fn CalcAcceleration_xcxf_m_s2
+   * @brief Calculate the high-order gravity in the XCXF frame for many positions at once
+   * @note The positions are processed in blocks of kBatchSize, and the V and W recursion is evaluated across the positions in a block,
+   *       so the coefficient and normalization factor loads are shared and the inner loops can be vectorized by the compiler.
+   *       The result of each position is identical with the single position version.
+   * @param [in] position_x_xcxf_m: X component of the positions in the XCXF frame [m]
+   * @param [in] position_y_xcxf_m: Y component of the positions in the XCXF frame [m]
+   * @param [in] position_z_xcxf_m: Z component of the positions in the XCXF frame [m]
+   * @param [out] acceleration_x_xcxf_m_s2: X component of the accelerations in the XCXF frame [m/s2]
+   * @param [out] acceleration_y_xcxf_m_s2: Y component of the accelerations in the XCXF frame [m/s2]
+   * @param [out] acceleration_z_xcxf_m_s2: Z component of the accelerations in the XCXF frame [m/s2]
+   */
+  void CalcAcceleration_xcxf_m_s2(const std::vector<double> &position_x_xcxf_m, const std::vector<double> &position_y_xcxf_m,
+                                  const std::vector<double> &position_z_xcxf_m, std::vector<double> &acceleration_x_xcxf_m_s2,
+                                  std::vector<double> &acceleration_y_xcxf_m_s2, std::vector<double> &acceleration_z_xcxf_m_s2);
+
+  /**
+   * @fn SetDegree
+   * @brief Change the degree used in the calculation without the reallocation of the tables (e.g., to reduce the calculation temporarily)
+   * @param [in] degree: Degree. It is limited to the degree at the construction, and the degree smaller than 2 disables the calculation.
+   */
+  void SetDegree(const size_t degree);
+  /**
+   * @fn GetDegree
+   * @brief Return the degree used in the calculation
+   */
+  inline size_t GetDegree() const { return degree_; }
+
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @brief Return the memory owned by this instance including the workspace and the normalization factor tables [bytes]
+   */
+  size_t GetMemoryUsage_bytes() const;
+  /**
+   * @fn GetCoefficientsMemoryUsage_bytes
+   * @brief Return the memory of the coefficients shared between the instances [bytes]
+   */
+  size_t GetCoefficientsMemoryUsage_bytes() const;
+
+  static constexpr size_t kBatchSize = 4;  //!< Number of positions evaluated together in the batched calculation
+
  private:
-  size_t degree_ = 0;                   //!< Maximum degree
-  size_t n_ = 0, m_ = 0;                //!< Degree and order (FIXME: follow naming rule)
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  double gravity_constants_m3_s2_;      //!< Gravity constant of the center body [m3/s2]
-  double center_body_radius_m_;         //!< Radius of the center body [m]
+  size_t degree_ = 0;                                        //!< Degree used in the calculation
+  size_t maximum_degree_ = 0;                                //!< Maximum degree of the tables
+  size_t n_ = 0, m_ = 0;                                     //!< Degree and order (FIXME: follow naming rule)
+  std::shared_ptr<const GravityCoefficients> coefficients_;  //!< Cosine and sine coefficients shared between the instances
+  double gravity_constants_m3_s2_;                           //!< Gravity constant of the center body [m3/s2]
+  double center_body_radius_m_;                              //!< Radius of the center body [m]
 
   // calculation
   double radius_m_ = 0.0;                                    //!< Radius [m]
   double xcxf_x_m_ = 0.0, xcxf_y_m_ = 0.0, xcxf_z_m_ = 0.0;  //!< Spacecraft position in XCXF frame [m]
 
+  // Workspace for V and W functions (triangular layout, allocated once in the constructor)
+  size_t degree_vw_max_ = 0;  //!< Maximum degree of the V and W functions stored in the workspace
+  std::vector<double> v_;     //!< V function workspace. Use GetVwIndex to access V(n, m)
+  std::vector<double> w_;     //!< W function workspace. Use GetVwIndex to access W(n, m)
+
+  /**
+   * @fn GetVwIndex
+   * @brief Return the index in the triangular V and W workspace
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  inline size_t GetVwIndex(const size_t n, const size_t m) const { return n * (n + 1) / 2 + m; }
+
+  // Normalization factor tables (triangular layout, calculated once in the constructor). Use GetVwIndex to access (n, m)
+  std::vector<double> vw_nn_normalize_;                     //!< Normalization factor of the V and W recursion for n = m (indexed by n)
+  std::vector<double> vw_nm_normalize_1_;                   //!< Normalization factor for V(n-1, m) in the V and W recursion for n != m
+  std::vector<double> vw_nm_normalize_2_;                   //!< Normalization factor for V(n-2, m) in the V and W recursion for n != m
+  std::vector<double> acceleration_normalize_xy1_;          //!< Normalization factor for V(n+1, m+1) terms of the x and y acceleration
+  std::vector<double> acceleration_normalize_xy2_;          //!< Normalization factor for V(n+1, m-1) terms of the x and y acceleration
+  std::vector<double> acceleration_normalize_z_;            //!< Normalization factor for V(n+1, m) terms of the z acceleration
+  std::vector<double> partial_derivative_normalize_xy_p2_;  //!< Normalization factor for V(n+2, m+2) terms of the xx, xy, and yy elements
+  std::vector<double> partial_derivative_normalize_xy_0_;   //!< Normalization factor for V(n+2, m) terms of the xx, xy, and yy elements
+  std::vector<double> partial_derivative_normalize_xy_m2_;  //!< Normalization factor for V(n+2, m-2) terms of the xx, xy, and yy elements
+  std::vector<double> partial_derivative_normalize_z_p1_;   //!< Normalization factor for V(n+2, m+1) terms of the xz and yz elements
+  std::vector<double> partial_derivative_normalize_z_m1_;   //!< Normalization factor for V(n+2, m-1) terms of the xz and yz elements
+  std::vector<double> partial_derivative_normalize_zz_;     //!< Normalization factor for V(n+2, m) terms of the zz element
+
+  /**
+   * @fn InitializeNormalizationFactors
+   * @brief Calculate the normalization factor tables for the V and W recursion, acceleration, and partial derivative
+   */
+  void InitializeNormalizationFactors();
+
+  /**
+   * @fn CalcVw
+   * @brief Calculate V and W functions up to the target degree and store them in the workspace
+   * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
+   * @param [in] degree_vw: Maximum degree of the V and W functions
+   */
+  void CalcVw(const libra::Vector<3> &position_xcxf_m, const size_t degree_vw);
+
+  /**
+   * @fn CalcAccelerationFromVw
+   * @brief Calculate the acceleration with the V and W functions in the workspace
+   * @note The V and W functions should be calculated up to degree + 1 before calling this function
+   * @return Acceleration in XCXF frame [m/s2]
+   */
+  libra::Vector<3> CalcAccelerationFromVw();
+
+  /**
+   * @fn CalcPartialDerivativeFromVw
+   * @brief Calculate the partial derivative of the acceleration with the V and W functions in the workspace
+   * @note The V and W functions should be calculated up to degree + 2 before calling this function
+   * @return Partial derivative of acceleration in XCXF frame [-/s2]
+   */
+  libra::Matrix<3, 3> CalcPartialDerivativeFromVw();
+
+  // Workspace for the batched calculation (interleaved layout: index = GetVwIndex(n, m) * kBatchSize + position number)
+  std::vector<double> v_batch_;  //!< V function workspace for the batched calculation
+  std::vector<double> w_batch_;  //!< W function workspace for the batched calculation
+
   /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
-   * @note FIXME: fix function name
+   * @fn CalcVwBatch
+   * @brief Calculate V and W functions for kBatchSize positions and store them in the batch workspace
+   * @param [in] x_m: X component of the positions in the XCXF frame [m]
+   * @param [in] y_m: Y component of the positions in the XCXF frame [m]
+   * @param [in] z_m: Z component of the positions in the XCXF frame [m]
+   * @param [in] degree_vw: Maximum degree of the V and W functions
    */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
+  void CalcVwBatch(const double *x_m, const double *y_m, const double *z_m, const size_t degree_vw);
 
   /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
-   * @note FIXME: fix function name
+   * @fn CalcAccelerationFromVwBatch
+   * @brief Calculate the accelerations of kBatchSize positions with the V and W functions in the batch workspace
+   * @param [out] acceleration_x_m_s2: X component of the accelerations in the XCXF frame [m/s2]
+   * @param [out] acceleration_y_m_s2: Y component of the accelerations in the XCXF frame [m/s2]
+   * @param [out] acceleration_z_m_s2: Z component of the accelerations in the XCXF frame [m/s2]
    */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+  void CalcAccelerationFromVwBatch(double *acceleration_x_m_s2, double *acceleration_y_m_s2, double *acceleration_z_m_s2) const;
 };
 
 #endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
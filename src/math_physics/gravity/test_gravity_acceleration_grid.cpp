@@ -0,0 +1,132 @@
+/**
+ * @file test_gravity_acceleration_grid.cpp
+ * @brief Test codes for GravityAccelerationGrid class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "gravity_acceleration_grid.hpp"
+
+namespace {
+/**
+ * @brief Make the gravity potential with unit coefficients in the normalized units
+ */
+GravityPotential MakeGravityPotential() {
+  const size_t degree = 10;
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 1.0e-3));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 1.0e-3));
+  return GravityPotential(degree, c, s, 1.0, 1.0);
+}
+
+/**
+ * @brief Grid settings of the shell in the normalized units
+ */
+GravityAccelerationGrid::Settings MakeSettings() {
+  GravityAccelerationGrid::Settings settings;
+  settings.min_radius_m = 1.05;
+  settings.max_radius_m = 1.10;
+  settings.radius_step_m = 0.01;
+  settings.angle_step_rad = 1.0 * M_PI / 180.0;
+  return settings;
+}
+}  // namespace
+
+/**
+ * @brief Test for the interpolation error against the direct calculation
+ */
+TEST(GravityAccelerationGrid, Interpolation) {
+  GravityPotential gravity_potential = MakeGravityPotential();
+  GravityAccelerationGrid grid;
+  EXPECT_FALSE(grid.IsValid());
+  grid.Build(gravity_potential, MakeSettings(), 1);
+  EXPECT_TRUE(grid.IsValid());
+
+  // Position in the shell
+  libra::Vector<3> position_xcxf_m;
+  position_xcxf_m[0] = 0.6;
+  position_xcxf_m[1] = -0.7;
+  position_xcxf_m[2] = 0.52;
+  libra::Vector<3> acceleration_xcxf_m_s2(0.0);
+  EXPECT_TRUE(grid.CalcAcceleration_xcxf_m_s2(position_xcxf_m, acceleration_xcxf_m_s2));
+  const libra::Vector<3> direct_acceleration_xcxf_m_s2 = gravity_potential.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+  const double scale = direct_acceleration_xcxf_m_s2.CalcNorm();
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(direct_acceleration_xcxf_m_s2[i], acceleration_xcxf_m_s2[i], 1.0e-4 * scale);
+  }
+  EXPECT_LT(grid.CalcMaximumError_m_s2(gravity_potential, 200), 1.0e-4 * scale);
+
+  // Out of the shell
+  position_xcxf_m[2] = 1.0;
+  EXPECT_FALSE(grid.CalcAcceleration_xcxf_m_s2(position_xcxf_m, acceleration_xcxf_m_s2));
+}
+
+/**
+ * @brief Test for write and read of the grid file
+ */
+TEST(GravityAccelerationGrid, WriteAndRead) {
+  const std::string file_path = "test_gravity_acceleration_grid.s2egrid";
+  GravityPotential gravity_potential = MakeGravityPotential();
+  GravityAccelerationGrid grid;
+  grid.Build(gravity_potential, MakeSettings(), 1);
+  EXPECT_TRUE(grid.Write(file_path));
+
+  GravityAccelerationGrid read_grid;
+  EXPECT_TRUE(read_grid.Read(file_path, MakeSettings(), 1));
+  libra::Vector<3> position_xcxf_m;
+  position_xcxf_m[0] = -0.2;
+  position_xcxf_m[1] = 0.3;
+  position_xcxf_m[2] = -1.0;
+  libra::Vector<3> acceleration_xcxf_m_s2(0.0), read_acceleration_xcxf_m_s2(0.0);
+  EXPECT_TRUE(grid.CalcAcceleration_xcxf_m_s2(position_xcxf_m, acceleration_xcxf_m_s2));
+  EXPECT_TRUE(read_grid.CalcAcceleration_xcxf_m_s2(position_xcxf_m, read_acceleration_xcxf_m_s2));
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(acceleration_xcxf_m_s2[i], read_acceleration_xcxf_m_s2[i]);
+  }
+
+  // The grid file is not used for the different checksum or settings
+  EXPECT_FALSE(read_grid.Read(file_path, MakeSettings(), 2));
+  GravityAccelerationGrid::Settings settings = MakeSettings();
+  settings.angle_step_rad *= 2.0;
+  EXPECT_FALSE(read_grid.Read(file_path, settings, 1));
+  EXPECT_FALSE(read_grid.IsValid());
+
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for the grid file overwritten while the previous file is used
+ */
+TEST(GravityAccelerationGrid, Overwrite) {
+  const std::string file_path = "test_gravity_acceleration_grid_overwrite.s2egrid";
+  GravityPotential gravity_potential = MakeGravityPotential();
+  GravityAccelerationGrid grid;
+  grid.Build(gravity_potential, MakeSettings(), 1);
+  EXPECT_TRUE(grid.Write(file_path));
+  GravityAccelerationGrid read_grid;
+  ASSERT_TRUE(read_grid.Read(file_path, MakeSettings(), 1));
+
+  libra::Vector<3> position_xcxf_m;
+  position_xcxf_m[0] = 0.5;
+  position_xcxf_m[1] = 0.5;
+  position_xcxf_m[2] = 0.8;
+  libra::Vector<3> acceleration_xcxf_m_s2(0.0), read_acceleration_xcxf_m_s2(0.0);
+  EXPECT_TRUE(grid.CalcAcceleration_xcxf_m_s2(position_xcxf_m, acceleration_xcxf_m_s2));
+
+  // The existing file is replaced, and the grid read before keeps the values
+  EXPECT_TRUE(grid.Write(file_path));
+  EXPECT_TRUE(read_grid.CalcAcceleration_xcxf_m_s2(position_xcxf_m, read_acceleration_xcxf_m_s2));
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(acceleration_xcxf_m_s2[i], read_acceleration_xcxf_m_s2[i]);
+  }
+  GravityAccelerationGrid overwritten_grid;
+  EXPECT_TRUE(overwritten_grid.Read(file_path, MakeSettings(), 1));
+
+  // The failed write keeps the existing file
+  GravityAccelerationGrid empty_grid;
+  EXPECT_FALSE(empty_grid.Write(file_path));
+  EXPECT_FALSE(grid.Write("not_existing_directory/" + file_path));
+  EXPECT_TRUE(overwritten_grid.Read(file_path, MakeSettings(), 1));
+
+  std::remove(file_path.c_str());
+}
@@ -0,0 +1,105 @@
+/**
+ * @file test_gravity_coefficients_cache.cpp
+ * @brief Test codes for gravity coefficients cache functions with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <utilities/shared_data_registry.hpp>
+
+#include "gravity_coefficients_cache.hpp"
+
+/**
+ * @brief Test for write and read of the cache file
+ */
+TEST(GravityCoefficientsCache, WriteAndRead) {
+  const std::string source_file_path = "test_gravity_coefficients_cache_source.txt";
+  const size_t degree = 4;
+
+  // Dummy source file
+  std::ofstream source_file(source_file_path);
+  source_file << "dummy coefficients" << std::endl;
+  source_file.close();
+
+  GravityCoefficients coefficients;
+  coefficients.degree_ = degree;
+  coefficients.gravity_constant_ = 4902.8;
+  coefficients.reference_radius_ = 1738.0;
+  coefficients.c_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  coefficients.s_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 0; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      coefficients.c_[n][m] = 1.0e-3 * n + 1.0e-6 * m;
+      coefficients.s_[n][m] = -1.0e-3 * n + 1.0e-6 * m;
+    }
+  }
+  EXPECT_TRUE(WriteGravityCoefficientsCache(source_file_path, coefficients));
+
+  // Read with smaller degree
+  const size_t read_degree = 3;
+  GravityCoefficients read_coefficients;
+  EXPECT_TRUE(ReadGravityCoefficientsCache(source_file_path, read_degree, read_coefficients));
+  EXPECT_EQ(read_degree, read_coefficients.degree_);
+  EXPECT_DOUBLE_EQ(coefficients.gravity_constant_, read_coefficients.gravity_constant_);
+  EXPECT_DOUBLE_EQ(coefficients.reference_radius_, read_coefficients.reference_radius_);
+  ASSERT_EQ(read_degree + 1, read_coefficients.c_.size());
+  for (size_t n = 0; n <= read_degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      EXPECT_DOUBLE_EQ(coefficients.c_[n][m], read_coefficients.c_[n][m]);
+      EXPECT_DOUBLE_EQ(coefficients.s_[n][m], read_coefficients.s_[n][m]);
+    }
+  }
+
+  // Larger degree than the cache is not available
+  EXPECT_FALSE(ReadGravityCoefficientsCache(source_file_path, degree + 1, read_coefficients));
+
+  // Cache is invalid when the source file is modified
+  source_file.open(source_file_path, std::ios::app);
+  source_file << "modified" << std::endl;
+  source_file.close();
+  EXPECT_FALSE(ReadGravityCoefficientsCache(source_file_path, read_degree, read_coefficients));
+
+  std::remove(source_file_path.c_str());
+  std::remove(GetGravityCoefficientsCachePath(source_file_path).c_str());
+}
+
+/**
+ * @brief Test for the coefficients shared between the instances
+ */
+TEST(GravityCoefficientsCache, SharedCoefficients) {
+  const std::string source_file_path = "test_gravity_coefficients_shared_source.txt";
+  const size_t degree = 4;
+  size_t number_of_reads = 0;
+  auto read_coefficients = [&number_of_reads](GravityCoefficients& coefficients) {
+    number_of_reads++;
+    coefficients.c_[2][0] = -4.8e-4;
+    return true;
+  };
+
+  std::shared_ptr<const GravityCoefficients> coefficients = GetSharedGravityCoefficients(source_file_path, degree, read_coefficients);
+  ASSERT_NE(nullptr, coefficients);
+  EXPECT_EQ(degree, coefficients->degree_);
+  EXPECT_EQ(degree + 1, coefficients->c_.size());
+  EXPECT_DOUBLE_EQ(-4.8e-4, coefficients->c_[2][0]);
+
+  // The coefficients are read only once while they are held
+  EXPECT_EQ(coefficients, GetSharedGravityCoefficients(source_file_path, degree, read_coefficients));
+  EXPECT_EQ(1u, number_of_reads);
+  EXPECT_NE(coefficients, GetSharedGravityCoefficients(source_file_path, degree - 1, read_coefficients));
+  EXPECT_EQ(2u, number_of_reads);
+
+  // The coefficients are kept for the next simulation case after all instances are released
+  coefficients.reset();
+  EXPECT_NE(nullptr, GetSharedGravityCoefficients(source_file_path, degree, read_coefficients));
+  EXPECT_EQ(2u, number_of_reads);
+
+  // The coefficients are read again after the registry releases them
+  SharedDataRegistry<GravityCoefficients>::ReleaseUnusedData();
+  EXPECT_EQ(0u, SharedDataRegistry<GravityCoefficients>::GetNumberOfData());
+  EXPECT_NE(nullptr, GetSharedGravityCoefficients(source_file_path, degree, read_coefficients));
+  EXPECT_EQ(3u, number_of_reads);
+
+  // Failure of the read
+  EXPECT_EQ(nullptr, GetSharedGravityCoefficients("not_found.txt", degree, [](GravityCoefficients&) { return false; }));
+}
@@ -153,3 +153,127 @@ TEST(GravityPotential, PartialDerivative2) {
     }
   }
 }
+
+/**
+ * @brief Test for fused acceleration and partial derivative calculation
+ */
+TEST(GravityPotential, AccelerationAndPartialDerivative) {
+  const size_t degree = 10;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Unit coefficients
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+
+  // Initialize GravityPotential
+  GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+
+  // Calculation check
+  libra::Vector<3> position_xcxf_m;
+  position_xcxf_m[0] = 1.0;
+  position_xcxf_m[1] = 0.5;
+  position_xcxf_m[2] = 1.0;
+  const double accuracy = 1.0e-10;
+
+  libra::Vector<3> acceleration_xcxf_m_s2;
+  libra::Matrix<3, 3> partial_derivative_xcxf_s2;
+  gravity_potential_.CalcAccelerationAndPartialDerivative_xcxf(position_xcxf_m, acceleration_xcxf_m_s2, partial_derivative_xcxf_s2);
+
+  // Compare with the separated calculations
+  libra::Vector<3> expected_acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+  libra::Matrix<3, 3> expected_partial_derivative_xcxf_s2 = gravity_potential_.CalcPartialDerivative_xcxf_s2(position_xcxf_m);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected_acceleration_xcxf_m_s2[i], acceleration_xcxf_m_s2[i], accuracy);
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_NEAR(expected_partial_derivative_xcxf_s2[i][j], partial_derivative_xcxf_s2[i][j], accuracy);
+    }
+  }
+}
+
+/**
+ * @brief Test for batched acceleration calculation
+ */
+TEST(GravityPotential, AccelerationBatch) {
+  const size_t degree = 10;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Unit coefficients
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+
+  // Initialize GravityPotential
+  GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+
+  // Number of positions is not a multiple of the batch size to check the last block
+  const size_t number_of_positions = 2 * GravityPotential::kBatchSize + 1;
+  std::vector<double> position_x_xcxf_m, position_y_xcxf_m, position_z_xcxf_m;
+  for (size_t i = 0; i < number_of_positions; i++) {
+    position_x_xcxf_m.push_back(1.0 + 0.1 * i);
+    position_y_xcxf_m.push_back(-0.5 + 0.2 * i);
+    position_z_xcxf_m.push_back(0.3 * i);
+  }
+
+  std::vector<double> acceleration_x_xcxf_m_s2, acceleration_y_xcxf_m_s2, acceleration_z_xcxf_m_s2;
+  gravity_potential_.CalcAcceleration_xcxf_m_s2(position_x_xcxf_m, position_y_xcxf_m, position_z_xcxf_m, acceleration_x_xcxf_m_s2,
+                                                acceleration_y_xcxf_m_s2, acceleration_z_xcxf_m_s2);
+
+  // Compare with the single position calculation
+  ASSERT_EQ(number_of_positions, acceleration_x_xcxf_m_s2.size());
+  for (size_t i = 0; i < number_of_positions; i++) {
+    libra::Vector<3> position_xcxf_m;
+    position_xcxf_m[0] = position_x_xcxf_m[i];
+    position_xcxf_m[1] = position_y_xcxf_m[i];
+    position_xcxf_m[2] = position_z_xcxf_m[i];
+    libra::Vector<3> expected_acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+    EXPECT_DOUBLE_EQ(expected_acceleration_xcxf_m_s2[0], acceleration_x_xcxf_m_s2[i]);
+    EXPECT_DOUBLE_EQ(expected_acceleration_xcxf_m_s2[1], acceleration_y_xcxf_m_s2[i]);
+    EXPECT_DOUBLE_EQ(expected_acceleration_xcxf_m_s2[2], acceleration_z_xcxf_m_s2[i]);
+  }
+}
+
+/**
+ * @brief Test for the change of the degree after the construction
+ */
+TEST(GravityPotential, SetDegree) {
+  const size_t degree = 10;
+  const size_t reduced_degree = 4;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Unit coefficients
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+
+  // Initialize GravityPotential
+  GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+  GravityPotential reduced_gravity_potential_(reduced_degree, c_, s_, 1.0, 1.0);
+
+  libra::Vector<3> position_xcxf_m;
+  position_xcxf_m[0] = 1.0;
+  position_xcxf_m[1] = 1.0;
+  position_xcxf_m[2] = 1.0;
+  const libra::Vector<3> full_acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+
+  // Same result as the instance constructed with the reduced degree
+  gravity_potential_.SetDegree(reduced_degree);
+  EXPECT_EQ(reduced_degree, gravity_potential_.GetDegree());
+  libra::Vector<3> acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+  const libra::Vector<3> expected_acceleration_xcxf_m_s2 = reduced_gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+  for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(expected_acceleration_xcxf_m_s2[i], acceleration_xcxf_m_s2[i]);
+
+  // The degree is limited to the degree at the construction
+  gravity_potential_.SetDegree(degree + 10);
+  EXPECT_EQ(degree, gravity_potential_.GetDegree());
+  acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+  for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(full_acceleration_xcxf_m_s2[i], acceleration_xcxf_m_s2[i]);
+
+  // Degree smaller than 2 disables the calculation
+  gravity_potential_.SetDegree(1);
+  acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+  for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(0.0, acceleration_xcxf_m_s2[i]);
+}
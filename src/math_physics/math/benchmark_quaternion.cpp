@@ -0,0 +1,65 @@
+/**
+ * @file benchmark_quaternion.cpp
+ * @brief Benchmark codes for the quaternion operations used in the attitude propagation
+ */
+#include <iostream>
+#include <string>
+#include <utilities/benchmark_measurement.hpp>
+
+#include "quaternion.hpp"
+
+/**
+ * @fn PrintResult
+ * @brief Print the measured time
+ * @param [in] name: Name of the calculation
+ * @param [in] time_ns: Calculation time [ns/call]
+ */
+void PrintResult(const std::string name, const double time_ns) { std::cout << name << ", " << time_ns << std::endl; }
+
+int main() {
+  const size_t number_of_calls = 10000000;
+
+  libra::Quaternion quaternion(0.1, -0.3, 0.2, 0.9);
+  quaternion.Normalize();
+  libra::Quaternion rotation(0.01, 0.02, -0.01, 1.0);
+  rotation.Normalize();
+  libra::Vector<3> vector;
+  vector[0] = 0.3;
+  vector[1] = -0.2;
+  vector[2] = 0.9;
+  libra::Vector<3> axis;
+  axis[0] = 0.0;
+  axis[1] = 0.6;
+  axis[2] = 0.8;
+
+  // The outputs are fed back to the inputs to avoid the optimization of the loops
+  std::cout << "calculation, time [ns/call]" << std::endl;
+  PrintResult("product", MeasureNanosecondsPerCall([&]() { quaternion = quaternion * rotation; }, number_of_calls));
+  PrintResult("normalize", MeasureNanosecondsPerCall([&]() { quaternion = (1.0 + 1.0e-9) * quaternion.Normalize(); }, number_of_calls));
+  PrintResult("conjugate", MeasureNanosecondsPerCall([&]() { quaternion = quaternion.Conjugate(); }, number_of_calls));
+  PrintResult("frame conversion", MeasureNanosecondsPerCall([&]() { vector = quaternion.FrameConversion(vector); }, number_of_calls));
+  PrintResult("inverse frame conversion", MeasureNanosecondsPerCall([&]() { vector = quaternion.InverseFrameConversion(vector); }, number_of_calls));
+  libra::Matrix<3, 3> dcm = quaternion.ConvertToDcm();
+  PrintResult("convert to DCM", MeasureNanosecondsPerCall(
+                                    [&]() {
+                                      quaternion[3] += 1.0e-12 * dcm[0][1];
+                                      dcm = quaternion.ConvertToDcm();
+                                    },
+                                    number_of_calls));
+  PrintResult("convert from DCM",
+              MeasureNanosecondsPerCall([&]() { quaternion = libra::Quaternion::ConvertFromDcm(dcm) * rotation; }, number_of_calls));
+  double angle_rad = 0.1;
+  PrintResult("axis angle", MeasureNanosecondsPerCall(
+                                 [&]() {
+                                   angle_rad += 1.0e-9;
+                                   quaternion = libra::Quaternion(axis, angle_rad) * quaternion;
+                                 },
+                                 number_of_calls));
+
+  // Use the results to avoid optimization
+  if (quaternion[0] != quaternion[0] || vector[0] != vector[0] || dcm[0][0] != dcm[0][0]) {
+    std::cout << "NaN detected" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file benchmark_small_matrix_vector.cpp
+ * @brief Benchmark codes for the 3x3 matrix products and the quaternion frame conversion compared with the generic calculations
+ */
+#include <iostream>
+#include <string>
+#include <utilities/benchmark_measurement.hpp>
+
+#include "matrix_vector.hpp"
+#include "quaternion.hpp"
+
+/**
+ * @fn PrintResult
+ * @brief Print the measured times
+ * @param [in] name: Name of the calculation
+ * @param [in] generic_ns: Calculation time of the generic calculation [ns/call]
+ * @param [in] specialized_ns: Calculation time of the specialized calculation [ns/call]
+ */
+void PrintResult(const std::string name, const double generic_ns, const double specialized_ns) {
+  std::cout << name << ", " << generic_ns << ", " << specialized_ns << ", " << generic_ns / specialized_ns << std::endl;
+}
+
+int main() {
+  const size_t number_of_calls = 10000000;
+
+  libra::Matrix<3, 3> matrix;
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      matrix[i][j] = 0.1 * (double)(i * 3 + j) - 0.4;
+    }
+  }
+  libra::Vector<3> vector;
+  vector[0] = 0.3;
+  vector[1] = -0.2;
+  vector[2] = 0.9;
+  libra::Quaternion quaternion(0.1, -0.3, 0.2, 0.9);
+  quaternion.Normalize();
+
+  // The outputs are fed back to the inputs to avoid the optimization of the loops
+  std::cout << "calculation, generic [ns/call], specialized [ns/call], speed up" << std::endl;
+
+  libra::Vector<3> result = vector;
+  const double generic_matrix_vector_ns = MeasureNanosecondsPerCall(
+      [&]() { result = 0.5 * libra::operator*<3, 3, double, double>(matrix, result) + vector; }, number_of_calls);
+  const double matrix_vector_ns = MeasureNanosecondsPerCall([&]() { result = 0.5 * (matrix * result) + vector; }, number_of_calls);
+  PrintResult("Matrix<3, 3> * Vector<3>", generic_matrix_vector_ns, matrix_vector_ns);
+
+  libra::Matrix<3, 3> product = matrix;
+  const double generic_matrix_matrix_ns =
+      MeasureNanosecondsPerCall([&]() { product = 0.5 * libra::operator*<3, 3, 3, double>(matrix, product); }, number_of_calls);
+  const double matrix_matrix_ns = MeasureNanosecondsPerCall([&]() { product = 0.5 * (matrix * product); }, number_of_calls);
+  PrintResult("Matrix<3, 3> * Matrix<3, 3>", generic_matrix_matrix_ns, matrix_matrix_ns);
+
+  const double generic_frame_conversion_ns = MeasureNanosecondsPerCall(
+      [&]() {
+        libra::Quaternion temp = (quaternion.Conjugate() * result) * quaternion;
+        for (size_t i = 0; i < 3; i++) result[i] = temp[i];
+      },
+      number_of_calls);
+  const double frame_conversion_ns = MeasureNanosecondsPerCall([&]() { result = quaternion.FrameConversion(result); }, number_of_calls);
+  PrintResult("Quaternion::FrameConversion", generic_frame_conversion_ns, frame_conversion_ns);
+
+  // Use the results to avoid optimization
+  if (result[0] != result[0] || product[0][0] != product[0][0]) {
+    std::cout << "NaN detected" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file chebyshev_series.cpp
+ * @brief Chebyshev series approximation of a function in a finite interval
+ */
+
+#include "chebyshev_series.hpp"
+
+#include <cmath>
+
+#include "constants.hpp"
+
+namespace libra {
+
+ChebyshevSeries::ChebyshevSeries(const double start, const double end, const std::vector<double>& coefficients)
+    : start_(start), end_(end), coefficients_(coefficients) {
+  if (coefficients_.empty()) coefficients_.push_back(0.0);
+
+  // Coefficients of the derivative (Numerical Recipes in C, chder)
+  const size_t number_of_coefficients = coefficients_.size();
+  derivative_coefficients_.assign(number_of_coefficients, 0.0);
+  if (number_of_coefficients > 1) {
+    derivative_coefficients_[number_of_coefficients - 2] = 2.0 * (double)(number_of_coefficients - 1) * coefficients_[number_of_coefficients - 1];
+    for (size_t j = number_of_coefficients - 2; j > 0; j--) {
+      derivative_coefficients_[j - 1] = derivative_coefficients_[j + 1] + 2.0 * (double)j * coefficients_[j];
+    }
+  }
+  const double scale = 2.0 / (end_ - start_);
+  for (auto& coefficient : derivative_coefficients_) coefficient *= scale;
+}
+
+std::vector<double> ChebyshevSeries::CalcNodes(const double start, const double end, const size_t degree) {
+  const size_t number_of_nodes = degree + 1;
+  std::vector<double> nodes(number_of_nodes);
+  const double center = 0.5 * (end + start);
+  const double half_width = 0.5 * (end - start);
+  for (size_t k = 0; k < number_of_nodes; k++) {
+    nodes[k] = center + half_width * cos(pi * ((double)k + 0.5) / (double)number_of_nodes);
+  }
+  return nodes;
+}
+
+ChebyshevSeries ChebyshevSeries::Fit(const double start, const double end, const std::vector<double>& values) {
+  const size_t number_of_nodes = values.size();
+  std::vector<double> coefficients(number_of_nodes, 0.0);
+  for (size_t j = 0; j < number_of_nodes; j++) {
+    double sum = 0.0;
+    for (size_t k = 0; k < number_of_nodes; k++) {
+      sum += values[k] * cos(pi * (double)j * ((double)k + 0.5) / (double)number_of_nodes);
+    }
+    coefficients[j] = 2.0 * sum / (double)number_of_nodes;
+  }
+  return ChebyshevSeries(start, end, coefficients);
+}
+
+double ChebyshevSeries::Calc(const double x) const { return CalcClenshaw(coefficients_, Normalize(x)); }
+
+double ChebyshevSeries::CalcDerivative(const double x) const { return CalcClenshaw(derivative_coefficients_, Normalize(x)); }
+
+double ChebyshevSeries::CalcClenshaw(const std::vector<double>& coefficients, const double normalized_x) {
+  double b_k1 = 0.0;  // b_{k+1}
+  double b_k2 = 0.0;  // b_{k+2}
+  const double two_x = 2.0 * normalized_x;
+  for (size_t k = coefficients.size() - 1; k > 0; k--) {
+    const double b_k = two_x * b_k1 - b_k2 + coefficients[k];
+    b_k2 = b_k1;
+    b_k1 = b_k;
+  }
+  return normalized_x * b_k1 - b_k2 + 0.5 * coefficients[0];
+}
+
+}  // namespace libra
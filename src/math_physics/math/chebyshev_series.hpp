@@ -0,0 +1,110 @@
+/**
+ * @file chebyshev_series.hpp
+ * @brief Chebyshev series approximation of a function in a finite interval
+ */
+
+#ifndef S2E_LIBRARY_MATH_CHEBYSHEV_SERIES_HPP_
+#define S2E_LIBRARY_MATH_CHEBYSHEV_SERIES_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class ChebyshevSeries
+ * @brief Class to approximate a function in the interval [start, end] with a Chebyshev series
+ * @note Ref: Numerical Recipes in C, Section. 5.8
+ */
+class ChebyshevSeries {
+ public:
+  /**
+   * @fn ChebyshevSeries
+   * @brief Constructor
+   * @param [in] start: Start of the interval
+   * @param [in] end: End of the interval
+   * @param [in] coefficients: Chebyshev coefficients c_0, c_1, ..., c_n. The series is c_0 / 2 + sum(c_k T_k(x)).
+   */
+  ChebyshevSeries(const double start, const double end, const std::vector<double>& coefficients);
+
+  /**
+   * @fn CalcNodes
+   * @brief Calculate the Chebyshev nodes where the function should be sampled for Fit
+   * @param [in] start: Start of the interval
+   * @param [in] end: End of the interval
+   * @param [in] degree: Degree of the series
+   * @return degree + 1 independent variables
+   */
+  static std::vector<double> CalcNodes(const double start, const double end, const size_t degree);
+  /**
+   * @fn Fit
+   * @brief Generate the series from the function values at the Chebyshev nodes
+   * @param [in] start: Start of the interval
+   * @param [in] end: End of the interval
+   * @param [in] values: Function values at the nodes given by CalcNodes. The degree is set as values.size() - 1.
+   * @return Fitted series
+   */
+  static ChebyshevSeries Fit(const double start, const double end, const std::vector<double>& values);
+
+  /**
+   * @fn Calc
+   * @brief Calculate the approximated value with Clenshaw's recurrence
+   * @param [in] x: Target independent variable. It should be in the interval.
+   * @return Approximated value at x
+   */
+  double Calc(const double x) const;
+  /**
+   * @fn CalcDerivative
+   * @brief Calculate the derivative of the approximated function
+   * @param [in] x: Target independent variable. It should be in the interval.
+   * @return Approximated derivative at x
+   */
+  double CalcDerivative(const double x) const;
+
+  // Getters
+  /**
+   * @fn IsInRange
+   * @return True when x is in the interval
+   */
+  inline bool IsInRange(const double x) const { return start_ <= x && x <= end_; }
+  /**
+   * @fn GetDegree
+   * @return Degree of the series
+   */
+  inline size_t GetDegree() const { return coefficients_.size() - 1; }
+  /**
+   * @fn GetCoefficients
+   * @return Chebyshev coefficients
+   */
+  inline const std::vector<double>& GetCoefficients() const { return coefficients_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the series including the coefficients [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    return sizeof(*this) + (coefficients_.capacity() + derivative_coefficients_.capacity()) * sizeof(double);
+  }
+
+ private:
+  double start_;                                 //!< Start of the interval
+  double end_;                                   //!< End of the interval
+  std::vector<double> coefficients_;             //!< Chebyshev coefficients
+  std::vector<double> derivative_coefficients_;  //!< Chebyshev coefficients of the derivative
+
+  /**
+   * @fn Normalize
+   * @brief Convert the independent variable into [-1, 1]
+   */
+  inline double Normalize(const double x) const { return (2.0 * x - start_ - end_) / (end_ - start_); }
+  /**
+   * @fn CalcClenshaw
+   * @brief Calculate the series with Clenshaw's recurrence
+   * @param [in] coefficients: Chebyshev coefficients
+   * @param [in] normalized_x: Independent variable in [-1, 1]
+   */
+  static double CalcClenshaw(const std::vector<double>& coefficients, const double normalized_x);
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_CHEBYSHEV_SERIES_HPP_
@@ -0,0 +1,281 @@
+/**
+ * @file dense_matrix.cpp
+ * @brief Dense matrix class with the size determined at run time and its decompositions
+ */
+
+#include "dense_matrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace libra {
+
+namespace {
+const size_t kBlockSize = 64;  //!< Number of rows and columns of the blocks (64 x 64 doubles = 32 kB)
+}  // namespace
+
+DenseMatrix::DenseMatrix(const size_t row_length, const size_t column_length, const double value)
+    : row_length_(row_length), column_length_(column_length), data_(row_length * column_length, value) {}
+
+void DenseMatrix::FillUp(const double value) { std::fill(data_.begin(), data_.end(), value); }
+
+DenseMatrix DenseMatrix::Transpose() const {
+  DenseMatrix transposed(column_length_, row_length_);
+  for (size_t i0 = 0; i0 < row_length_; i0 += kBlockSize) {
+    const size_t i_end = std::min(i0 + kBlockSize, row_length_);
+    for (size_t j0 = 0; j0 < column_length_; j0 += kBlockSize) {
+      const size_t j_end = std::min(j0 + kBlockSize, column_length_);
+      for (size_t i = i0; i < i_end; i++) {
+        for (size_t j = j0; j < j_end; j++) {
+          transposed[j][i] = (*this)[i][j];
+        }
+      }
+    }
+  }
+  return transposed;
+}
+
+double& DenseMatrix::operator()(const size_t row, const size_t column) {
+  if (row >= row_length_ || column >= column_length_) {
+    throw std::invalid_argument("Argument exceeds the range of matrix.");
+  }
+  return (*this)[row][column];
+}
+
+const double& DenseMatrix::operator()(const size_t row, const size_t column) const {
+  if (row >= row_length_ || column >= column_length_) {
+    throw std::invalid_argument("Argument exceeds the range of matrix.");
+  }
+  return (*this)[row][column];
+}
+
+DenseMatrix operator*(const DenseMatrix& lhs, const DenseMatrix& rhs) {
+  if (lhs.GetColumnLength() != rhs.GetRowLength()) {
+    throw std::invalid_argument("Matrix sizes do not match for the multiplication.");
+  }
+  const size_t row_length = lhs.GetRowLength();
+  const size_t inner_length = lhs.GetColumnLength();
+  const size_t column_length = rhs.GetColumnLength();
+
+  DenseMatrix result(row_length, column_length);
+  for (size_t k0 = 0; k0 < inner_length; k0 += kBlockSize) {
+    const size_t k_end = std::min(k0 + kBlockSize, inner_length);
+    for (size_t j0 = 0; j0 < column_length; j0 += kBlockSize) {
+      const size_t j_end = std::min(j0 + kBlockSize, column_length);
+      for (size_t i = 0; i < row_length; i++) {
+        double* result_row = result[i];
+        for (size_t k = k0; k < k_end; k++) {
+          const double lhs_ik = lhs[i][k];
+          const double* rhs_row = rhs[k];
+          for (size_t j = j0; j < j_end; j++) {
+            result_row[j] += lhs_ik * rhs_row[j];
+          }
+        }
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<double> operator*(const DenseMatrix& matrix, const std::vector<double>& vector) {
+  if (matrix.GetColumnLength() != vector.size()) {
+    throw std::invalid_argument("Matrix and vector sizes do not match for the multiplication.");
+  }
+  std::vector<double> result(matrix.GetRowLength(), 0.0);
+  for (size_t i = 0; i < matrix.GetRowLength(); i++) {
+    const double* row = matrix[i];
+    double sum = 0.0;
+    for (size_t j = 0; j < matrix.GetColumnLength(); j++) {
+      sum += row[j] * vector[j];
+    }
+    result[i] = sum;
+  }
+  return result;
+}
+
+DenseLuDecomposition::DenseLuDecomposition(const DenseMatrix& matrix) : lu_matrix_(matrix) {
+  const size_t n = matrix.GetRowLength();
+  if (n != matrix.GetColumnLength()) {
+    throw std::invalid_argument("LU decomposition needs a square matrix.");
+  }
+  pivot_indices_.assign(n, 0);
+  DenseMatrix& a = lu_matrix_;
+
+  for (size_t k0 = 0; k0 < n; k0 += kBlockSize) {
+    const size_t k_end = std::min(k0 + kBlockSize, n);
+
+    // Panel: columns [k0, k_end) with the partial pivoting
+    for (size_t k = k0; k < k_end; k++) {
+      size_t pivot = k;
+      double biggest = fabs(a[k][k]);
+      for (size_t i = k + 1; i < n; i++) {
+        if (fabs(a[i][k]) > biggest) {
+          biggest = fabs(a[i][k]);
+          pivot = i;
+        }
+      }
+      if (biggest == 0.0) {
+        throw std::invalid_argument("Given matrix is singular!!");
+      }
+      pivot_indices_[k] = pivot;
+      if (pivot != k) {
+        std::swap_ranges(a[k], a[k] + n, a[pivot]);
+      }
+
+      const double inverse_diagonal = 1.0 / a[k][k];
+      for (size_t i = k + 1; i < n; i++) {
+        a[i][k] *= inverse_diagonal;
+        const double l_ik = a[i][k];
+        for (size_t j = k + 1; j < k_end; j++) {
+          a[i][j] -= l_ik * a[k][j];
+        }
+      }
+    }
+    if (k_end == n) break;
+
+    // U12 = L11^-1 A12
+    for (size_t k = k0; k < k_end; k++) {
+      for (size_t i = k + 1; i < k_end; i++) {
+        const double l_ik = a[i][k];
+        for (size_t j = k_end; j < n; j++) {
+          a[i][j] -= l_ik * a[k][j];
+        }
+      }
+    }
+
+    // A22 -= L21 U12
+    for (size_t j0 = k_end; j0 < n; j0 += kBlockSize) {
+      const size_t j_end = std::min(j0 + kBlockSize, n);
+      for (size_t i = k_end; i < n; i++) {
+        double* row = a[i];
+        for (size_t k = k0; k < k_end; k++) {
+          const double l_ik = row[k];
+          const double* u_row = a[k];
+          for (size_t j = j0; j < j_end; j++) {
+            row[j] -= l_ik * u_row[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+std::vector<double> DenseLuDecomposition::Solve(const std::vector<double>& b) const {
+  std::vector<double> x = b;
+  SolveInPlace(x);
+  return x;
+}
+
+void DenseLuDecomposition::SolveInPlace(std::vector<double>& b_x) const {
+  const size_t n = lu_matrix_.GetRowLength();
+  if (b_x.size() != n) {
+    throw std::invalid_argument("Vector size does not match the matrix size.");
+  }
+  std::vector<double>& x = b_x;
+  for (size_t k = 0; k < n; k++) {
+    std::swap(x[k], x[pivot_indices_[k]]);
+  }
+  // L y = P b
+  for (size_t i = 0; i < n; i++) {
+    const double* row = lu_matrix_[i];
+    double sum = x[i];
+    for (size_t j = 0; j < i; j++) {
+      sum -= row[j] * x[j];
+    }
+    x[i] = sum;
+  }
+  // U x = y
+  for (size_t i = n; i-- > 0;) {
+    const double* row = lu_matrix_[i];
+    double sum = x[i];
+    for (size_t j = i + 1; j < n; j++) {
+      sum -= row[j] * x[j];
+    }
+    x[i] = sum / row[i];
+  }
+}
+
+DenseCholeskyDecomposition::DenseCholeskyDecomposition(const DenseMatrix& matrix) : lower_matrix_(matrix) {
+  const size_t n = matrix.GetRowLength();
+  if (n != matrix.GetColumnLength()) {
+    throw std::invalid_argument("Cholesky decomposition needs a square matrix.");
+  }
+  DenseMatrix& a = lower_matrix_;
+
+  for (size_t k0 = 0; k0 < n; k0 += kBlockSize) {
+    const size_t k_end = std::min(k0 + kBlockSize, n);
+
+    // L11 and L21 = A21 L11^-T. The contributions of the previous panels are already subtracted.
+    for (size_t k = k0; k < k_end; k++) {
+      double diagonal = a[k][k];
+      for (size_t m = k0; m < k; m++) {
+        diagonal -= a[k][m] * a[k][m];
+      }
+      if (diagonal <= 0.0) {
+        throw std::invalid_argument("Given matrix is not positive definite!!");
+      }
+      a[k][k] = sqrt(diagonal);
+
+      const double inverse_diagonal = 1.0 / a[k][k];
+      for (size_t i = k + 1; i < n; i++) {
+        double sum = a[i][k];
+        for (size_t m = k0; m < k; m++) {
+          sum -= a[i][m] * a[k][m];
+        }
+        a[i][k] = sum * inverse_diagonal;
+      }
+    }
+
+    // A22 -= L21 L21^T (lower part only)
+    for (size_t j0 = k_end; j0 < n; j0 += kBlockSize) {
+      const size_t j_end = std::min(j0 + kBlockSize, n);
+      for (size_t i = j0; i < n; i++) {
+        const double* l_i = a[i];
+        for (size_t j = j0; j < std::min(j_end, i + 1); j++) {
+          const double* l_j = a[j];
+          double sum = 0.0;
+          for (size_t m = k0; m < k_end; m++) {
+            sum += l_i[m] * l_j[m];
+          }
+          a[i][j] -= sum;
+        }
+      }
+    }
+  }
+
+  // Clear the upper part
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = i + 1; j < n; j++) {
+      a[i][j] = 0.0;
+    }
+  }
+}
+
+std::vector<double> DenseCholeskyDecomposition::Solve(const std::vector<double>& b) const {
+  const size_t n = lower_matrix_.GetRowLength();
+  if (b.size() != n) {
+    throw std::invalid_argument("Vector size does not match the matrix size.");
+  }
+  std::vector<double> x = b;
+  // L y = b
+  for (size_t i = 0; i < n; i++) {
+    const double* row = lower_matrix_[i];
+    double sum = x[i];
+    for (size_t j = 0; j < i; j++) {
+      sum -= row[j] * x[j];
+    }
+    x[i] = sum / row[i];
+  }
+  // L^T x = y
+  for (size_t i = n; i-- > 0;) {
+    x[i] /= lower_matrix_[i][i];
+    const double* row = lower_matrix_[i];
+    for (size_t j = 0; j < i; j++) {
+      x[j] -= row[j] * x[i];
+    }
+  }
+  return x;
+}
+
+}  // namespace libra
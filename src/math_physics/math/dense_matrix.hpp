@@ -0,0 +1,208 @@
+/**
+ * @file dense_matrix.hpp
+ * @brief Dense matrix class with the size determined at run time and its decompositions
+ */
+
+#ifndef S2E_LIBRARY_MATH_DENSE_MATRIX_HPP_
+#define S2E_LIBRARY_MATH_DENSE_MATRIX_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class DenseMatrix
+ * @brief Dense matrix class with the size determined at run time
+ * @details The elements are stored in the row-major order in a contiguous array. Use libra::Matrix for the small matrices whose size
+ *          is fixed at the compile time.
+ */
+class DenseMatrix {
+ public:
+  /**
+   * @fn DenseMatrix
+   * @brief Default constructor. The matrix is empty.
+   */
+  DenseMatrix() : row_length_(0), column_length_(0) {}
+  /**
+   * @fn DenseMatrix
+   * @brief Constructor with initialize the elements as all same value
+   * @param [in] row_length: Number of rows
+   * @param [in] column_length: Number of columns
+   * @param [in] value: The value for initializing
+   */
+  DenseMatrix(const size_t row_length, const size_t column_length, const double value = 0.0);
+
+  /**
+   * @fn GetRowLength
+   * @brief Return row number
+   */
+  inline size_t GetRowLength() const { return row_length_; }
+  /**
+   * @fn GetColumnLength
+   * @brief Return column number
+   */
+  inline size_t GetColumnLength() const { return column_length_; }
+
+  /**
+   * @fn FillUp
+   * @brief Fill up all elements with same value
+   * @param [in] value: Scalar value to fill up
+   */
+  void FillUp(const double value);
+
+  /**
+   * @fn Transpose
+   * @brief Calculate and return transposed matrix
+   * @return Result of transposed matrix
+   */
+  DenseMatrix Transpose() const;
+
+  /**
+   * @fn Operator []
+   * @brief Operator to access the elements similar with the 2D-array using `[][]`
+   * @param [in] row: Target row number
+   * @return Pointer to the first element of the row
+   */
+  inline double* operator[](const size_t row) { return data_.data() + row * column_length_; }
+  /**
+   * @fn Operator [] (const ver.)
+   * @brief Operator to access the elements similar with the 2D-array using `[][]`
+   * @param [in] row: Target row number
+   * @return Const pointer to the first element of the row
+   */
+  inline const double* operator[](const size_t row) const { return data_.data() + row * column_length_; }
+
+  /**
+   * @fn Operator ()
+   * @brief Operator to access the element value
+   * @details This operator has assertion to detect range over
+   * @param [in] row: Target row number
+   * @param [in] column: Target column number
+   * @return Value of the target element
+   */
+  double& operator()(const size_t row, const size_t column);
+  /**
+   * @fn Operator () (const ver.)
+   * @brief Operator to access the element value
+   * @details This operator has assertion to detect range over
+   * @param [in] row: Target row number
+   * @param [in] column: Target column number
+   * @return Value of the target element
+   */
+  const double& operator()(const size_t row, const size_t column) const;
+
+ private:
+  size_t row_length_;         //!< Number of rows
+  size_t column_length_;      //!< Number of columns
+  std::vector<double> data_;  //!< Elements in the row-major order
+};
+
+/**
+ * @fn operator *
+ * @brief Multiply two matrices
+ * @note The calculation is divided into the blocks to reuse the elements in the cache
+ * @param [in] lhs: Left hand side matrix
+ * @param [in] rhs: Right hand side matrix
+ * @return Result of multiplied matrix
+ */
+DenseMatrix operator*(const DenseMatrix& lhs, const DenseMatrix& rhs);
+
+/**
+ * @fn operator *
+ * @brief Multiply matrix and vector
+ * @param [in] matrix: Target matrix
+ * @param [in] vector: Target vector
+ * @return Result of multiplied vector
+ */
+std::vector<double> operator*(const DenseMatrix& matrix, const std::vector<double>& vector);
+
+/**
+ * @class DenseLuDecomposition
+ * @brief LU decomposition with the partial pivoting of the dense matrix: P A = L U
+ * @details The right-looking blocked algorithm is used, so the most of the calculation is the update of the trailing sub-matrix with
+ *          the contiguous row access.
+ */
+class DenseLuDecomposition {
+ public:
+  /**
+   * @fn DenseLuDecomposition
+   * @brief Default constructor. The decomposition is empty.
+   */
+  DenseLuDecomposition() {}
+  /**
+   * @fn DenseLuDecomposition
+   * @brief Constructor. The decomposition is calculated here.
+   * @note std::invalid_argument is thrown when the matrix is not square or singular.
+   * @param [in] matrix: Target matrix
+   */
+  DenseLuDecomposition(const DenseMatrix& matrix);
+
+  /**
+   * @fn Solve
+   * @brief Solve the linear system A x = b
+   * @param [in] b: Right hand side vector
+   * @return Solution x
+   */
+  std::vector<double> Solve(const std::vector<double>& b) const;
+  /**
+   * @fn SolveInPlace
+   * @brief Solve the linear system A x = b without the allocation of the solution
+   * @param [in,out] b_x: Right hand side vector as the input and solution x as the output
+   */
+  void SolveInPlace(std::vector<double>& b_x) const;
+
+  // Getters
+  /**
+   * @fn GetLuMatrix
+   * @brief Return the decomposed matrix. The strictly lower part is L without the unit diagonal, and the upper part is U.
+   */
+  inline const DenseMatrix& GetLuMatrix() const { return lu_matrix_; }
+  /**
+   * @fn GetPivotIndices
+   * @brief Return the row swapped with each row in the decomposition
+   */
+  inline const std::vector<size_t>& GetPivotIndices() const { return pivot_indices_; }
+
+ private:
+  DenseMatrix lu_matrix_;              //!< Decomposed matrix
+  std::vector<size_t> pivot_indices_;  //!< Row swapped with each row
+};
+
+/**
+ * @class DenseCholeskyDecomposition
+ * @brief Cholesky decomposition of the symmetric positive definite dense matrix: A = L L^T
+ * @details The right-looking blocked algorithm is used. Only the lower part of the given matrix is referred.
+ */
+class DenseCholeskyDecomposition {
+ public:
+  /**
+   * @fn DenseCholeskyDecomposition
+   * @brief Constructor. The decomposition is calculated here.
+   * @note std::invalid_argument is thrown when the matrix is not square or not positive definite.
+   * @param [in] matrix: Target matrix
+   */
+  DenseCholeskyDecomposition(const DenseMatrix& matrix);
+
+  /**
+   * @fn Solve
+   * @brief Solve the linear system A x = b
+   * @param [in] b: Right hand side vector
+   * @return Solution x
+   */
+  std::vector<double> Solve(const std::vector<double>& b) const;
+
+  // Getters
+  /**
+   * @fn GetLowerMatrix
+   * @brief Return the lower triangular matrix L. The upper part is zero.
+   */
+  inline const DenseMatrix& GetLowerMatrix() const { return lower_matrix_; }
+
+ private:
+  DenseMatrix lower_matrix_;  //!< Lower triangular matrix
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_DENSE_MATRIX_HPP_
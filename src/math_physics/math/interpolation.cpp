@@ -5,49 +5,57 @@
 
 #include "interpolation.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace libra {
 
 double Interpolation::CalcPolynomial(const double x) const {
-  // Search nearest point
-  size_t nearest_x_id = FindNearestPoint(x);
-
-  // Neville's algorithm
-  double y_output = dependent_variables_[nearest_x_id];
-  std::vector<double> down_diff = dependent_variables_;
-  std::vector<double> up_diff = dependent_variables_;
-  size_t d_idx = 1;
-  for (size_t m = 1; m < degree_; m++) {
-    // Calculate C and D
-    for (size_t i = 0; i < degree_ - m; i++) {
-      double denominator = independent_variables_[i] - independent_variables_[i + m];
-      double down_minus_up = down_diff[i + 1] - up_diff[i];
-      up_diff[i] = (independent_variables_[i + m] - x) * down_minus_up / denominator;
-      down_diff[i] = (independent_variables_[i] - x) * down_minus_up / denominator;
-    }
+  // Barycentric formula of the second kind
+  double numerator = 0.0;
+  double denominator = 0.0;
+  for (size_t i = 0; i < degree_; i++) {
+    const double difference = x - independent_variables_[i];
+    if (difference == 0.0) return dependent_variables_[i];
+    const double term = polynomial_weights_[i] / difference;
+    numerator += term * dependent_variables_[i];
+    denominator += term;
+  }
+  return numerator / denominator;
+}
 
-    // Upstream first calculation
-    double dy;
-    if (nearest_x_id >= m) {
-      dy = up_diff[nearest_x_id - d_idx];
-      d_idx++;
-    } else {
-      dy = down_diff[0];
+double Interpolation::CalcPolynomialDerivative(const double x) const {
+  // p(x) = N(x) / D(x) with N(x) = sum(w_i y_i / (x - x_i)) and D(x) = sum(w_i / (x - x_i))
+  double numerator = 0.0;
+  double denominator = 0.0;
+  double numerator_derivative = 0.0;
+  double denominator_derivative = 0.0;
+  for (size_t i = 0; i < degree_; i++) {
+    const double difference = x - independent_variables_[i];
+    if (difference == 0.0) {
+      // p'(x_i) = sum_{j != i} (w_j / w_i) (y_j - y_i) / (x_i - x_j)
+      double derivative = 0.0;
+      for (size_t j = 0; j < degree_; j++) {
+        if (j == i) continue;
+        derivative += polynomial_weights_[j] / polynomial_weights_[i] * (dependent_variables_[j] - dependent_variables_[i]) /
+                      (independent_variables_[i] - independent_variables_[j]);
+      }
+      return derivative;
     }
-    y_output += dy;
+    const double term = polynomial_weights_[i] / difference;
+    numerator += term * dependent_variables_[i];
+    denominator += term;
+    numerator_derivative -= term / difference * dependent_variables_[i];
+    denominator_derivative -= term / difference;
   }
-
-  return y_output;
+  return (numerator_derivative * denominator - numerator * denominator_derivative) / (denominator * denominator);
 }
 
 double Interpolation::CalcTrigonometric(const double x, const double period) const {
-  double y_output = 0.0;
   size_t end_id = degree_;
   size_t start_id = 0;
 
   // Modify to odd number degrees
-  // TODO: implement more efficient method
   if (degree_ % 2 == 0) {
     size_t nearest_point = FindNearestPoint(x);
     // Remove the farthest point
@@ -57,30 +65,79 @@ double Interpolation::CalcTrigonometric(const double x, const double period) con
       start_id++;
     }
   }
+  // The weights of the other periods are calculated locally without modifying the shared object
+  std::vector<double> local_weights;
+  if (period != trigonometric_period_) CalcTrigonometricWeights(start_id, end_id, period, local_weights);
+  const std::vector<double>& weights = (period != trigonometric_period_) ? local_weights : trigonometric_weights_[start_id];
 
+  // The basis function t_i(x) = prod_{j != i} sin(period * (x - x_j) / 2) / sin(period * (x_i - x_j) / 2) is evaluated as
+  // t_i(x) = w_i * L(x) / sin(period * (x - x_i) / 2) with L(x) = prod_j sin(period * (x - x_j) / 2)
+  double product = 1.0;
+  double sum = 0.0;
   for (size_t i = start_id; i < end_id; ++i) {
-    double t_k = 1.0;
-    for (size_t j = start_id; j < end_id; ++j) {
-      if (i == j) continue;
-      t_k *= sin(period * (x - independent_variables_[j]) / 2.0) / sin(period * (independent_variables_[i] - independent_variables_[j]) / 2.0);
-    }
-    y_output += t_k * dependent_variables_[i];
+    const double sin_difference = sin(period * (x - independent_variables_[i]) / 2.0);
+    if (sin_difference == 0.0) return dependent_variables_[i];
+    product *= sin_difference;
+    sum += weights[i] * dependent_variables_[i] / sin_difference;
   }
 
-  return y_output;
+  return product * sum;
 }
 
 bool Interpolation::PushAndPopData(const double independent_variable, const double dependent_variable) {
   if (independent_variable <= independent_variables_.back()) {
     return false;
   }
-  independent_variables_.erase(independent_variables_.begin());
-  independent_variables_.push_back(independent_variable);
-  dependent_variables_.erase(dependent_variables_.begin());
-  dependent_variables_.push_back(dependent_variable);
+  // Shift without reallocation
+  std::copy(independent_variables_.begin() + 1, independent_variables_.end(), independent_variables_.begin());
+  independent_variables_.back() = independent_variable;
+  std::copy(dependent_variables_.begin() + 1, dependent_variables_.end(), dependent_variables_.begin());
+  dependent_variables_.back() = dependent_variable;
+
+  UpdatePolynomialWeights();
+  UpdateTrigonometricWeights();
   return true;
 }
 
+void Interpolation::SetTrigonometricPeriod(const double period) {
+  trigonometric_period_ = period;
+  UpdateTrigonometricWeights();
+}
+
+void Interpolation::UpdatePolynomialWeights() {
+  polynomial_weights_.assign(degree_, 1.0);
+  for (size_t i = 0; i < degree_; i++) {
+    double product = 1.0;
+    for (size_t j = 0; j < degree_; j++) {
+      if (i == j) continue;
+      product *= independent_variables_[i] - independent_variables_[j];
+    }
+    polynomial_weights_[i] = 1.0 / product;
+  }
+}
+
+void Interpolation::UpdateTrigonometricWeights() {
+  if (trigonometric_period_ == 0.0 || degree_ == 0) return;
+  if (degree_ % 2 == 0) {
+    CalcTrigonometricWeights(0, degree_ - 1, trigonometric_period_, trigonometric_weights_[0]);
+    CalcTrigonometricWeights(1, degree_, trigonometric_period_, trigonometric_weights_[1]);
+  } else {
+    CalcTrigonometricWeights(0, degree_, trigonometric_period_, trigonometric_weights_[0]);
+  }
+}
+
+void Interpolation::CalcTrigonometricWeights(const size_t start_id, const size_t end_id, const double period, std::vector<double>& weights) const {
+  weights.assign(degree_, 0.0);
+  for (size_t i = start_id; i < end_id; i++) {
+    double product = 1.0;
+    for (size_t j = start_id; j < end_id; j++) {
+      if (i == j) continue;
+      product *= sin(period * (independent_variables_[i] - independent_variables_[j]) / 2.0);
+    }
+    weights[i] = 1.0 / product;
+  }
+}
+
 size_t Interpolation::FindNearestPoint(const double x) const {
   size_t output = 0;
   double difference1 = fabs(x - independent_variables_[0]);
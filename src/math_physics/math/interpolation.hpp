@@ -30,26 +30,46 @@ class Interpolation {
     if (degree_ < 2) {
       std::cout << "[WARNINGS] Interpolation degree is smaller than 2" << std::endl;
     }
+    UpdatePolynomialWeights();
   }
 
   /**
    * @fn CalcPolynomial
-   * @brief Calculate polynomial interpolation with Neville's algorithm
-   * @note Ref: Numerical Recipes in C, Section. 3.1
+   * @brief Calculate polynomial interpolation with the barycentric Lagrange formula
+   * @note Ref: J.-P. Berrut and L. N. Trefethen, "Barycentric Lagrange Interpolation", SIAM Review, 46(3), 2004
+   *       The weights are computed when the data is updated, so the calculation cost is O(degree).
    * @param [in] x: Target independent variable
    * @return Interpolated value at x
    */
   double CalcPolynomial(const double x) const;
+  /**
+   * @fn CalcPolynomialDerivative
+   * @brief Calculate the first derivative of the polynomial interpolation
+   * @note The derivative of the barycentric formula. At the nodes, the differentiation matrix of the nodes is used.
+   * @param [in] x: Target independent variable
+   * @return Derivative of the interpolated value at x
+   */
+  double CalcPolynomialDerivative(const double x) const;
 
   /**
    * @fn CalcTrigonometric
    * @brief Calculate trigonometric interpolation
+   * @note The denominators of the basis functions are computed when the data is updated for the period set by SetTrigonometricPeriod, so
+   *       the calculation cost is O(degree) for the period. They are computed in each call for the other periods (O(degree^2)).
+   *       This function does not modify the object, so it can be called from several threads at once.
    * @param [in] x: Target independent variable
    * @param [in] period: Characteristic period
    * @return Interpolated value at x
    */
   double CalcTrigonometric(const double x, const double period = 1.0) const;
 
+  /**
+   * @fn SetTrigonometricPeriod
+   * @brief Set the characteristic period of the trigonometric interpolation and compute the weights for it
+   * @param [in] period: Characteristic period
+   */
+  void SetTrigonometricPeriod(const double period);
+
   /**
    * @fn PushAndPopData
    * @brief Push new data to the tail and erase the head data
@@ -69,17 +89,51 @@ class Interpolation {
    * @fn GetIndependentVariables
    * @return List of independent variables
    */
-  inline std::vector<double> GetIndependentVariables() const { return independent_variables_; }
+  inline const std::vector<double>& GetIndependentVariables() const { return independent_variables_; }
   /**
    * @fn GetDependentVariables
    * @return List of dependent variables
    */
-  inline std::vector<double> GetDependentVariables() const { return dependent_variables_; }
+  inline const std::vector<double>& GetDependentVariables() const { return dependent_variables_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the interpolation including the data lists and the weights [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    const size_t number_of_elements = independent_variables_.capacity() + dependent_variables_.capacity() + polynomial_weights_.capacity() +
+                                      trigonometric_weights_[0].capacity() + trigonometric_weights_[1].capacity();
+    return sizeof(*this) + number_of_elements * sizeof(double);
+  }
 
  private:
   std::vector<double> independent_variables_{0.0};  //!< List of independent variable
   std::vector<double> dependent_variables_{0.0};    //!< List of dependent variable
   size_t degree_;                                   //!< Degree of interpolation
+  std::vector<double> polynomial_weights_;          //!< Barycentric weights of the polynomial interpolation
+
+  // Weights of the trigonometric interpolation for each node set (0: all nodes or without the last node for even degree, 1: without the first)
+  std::vector<double> trigonometric_weights_[2];  //!< Inverse of the denominators of the basis functions
+  double trigonometric_period_ = 0.0;             //!< Characteristic period of the weights. Zero when the weights are not computed.
+
+  /**
+   * @fn UpdatePolynomialWeights
+   * @brief Update the barycentric weights of the polynomial interpolation
+   */
+  void UpdatePolynomialWeights();
+  /**
+   * @fn UpdateTrigonometricWeights
+   * @brief Update the weights of the trigonometric interpolation for trigonometric_period_
+   */
+  void UpdateTrigonometricWeights();
+  /**
+   * @fn CalcTrigonometricWeights
+   * @brief Calculate the weights of the trigonometric interpolation
+   * @param [in] start_id: First index of the nodes
+   * @param [in] end_id: Index after the last of the nodes
+   * @param [in] period: Characteristic period
+   * @param [out] weights: Inverse of the denominators of the basis functions
+   */
+  void CalcTrigonometricWeights(const size_t start_id, const size_t end_id, const double period, std::vector<double>& weights) const;
 
   /**
    * @fn FindNearestPoint
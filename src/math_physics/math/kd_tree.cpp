@@ -0,0 +1,105 @@
+/**
+ * @file kd_tree.cpp
+ * @brief k-d tree for range and nearest neighbor search of points in three-dimensional space
+ */
+
+#include "kd_tree.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace libra {
+
+void KdTree::Build(const std::vector<Vector<3>>& points) {
+  points_.assign(points.begin(), points.end());
+  order_.resize(points_.size());
+  for (size_t i = 0; i < order_.size(); i++) order_[i] = i;
+  BuildSubTree(0, order_.size(), 0);
+}
+
+std::vector<size_t> KdTree::FindInRange(const Vector<3>& center, const double radius) const {
+  std::vector<size_t> indices;
+  if (radius < 0.0) return indices;
+  SearchInRange(0, order_.size(), 0, center, radius * radius, indices);
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+bool KdTree::FindNearest(const Vector<3>& position, size_t& index, const size_t excluded_index) const {
+  size_t nearest_index = kNoExcludedIndex;
+  double nearest_distance_squared = std::numeric_limits<double>::infinity();
+  SearchNearest(0, order_.size(), 0, position, excluded_index, nearest_index, nearest_distance_squared);
+  if (nearest_index == kNoExcludedIndex) return false;
+  index = nearest_index;
+  return true;
+}
+
+void KdTree::BuildSubTree(const size_t begin, const size_t end, const size_t depth) {
+  if (end - begin <= 1) return;
+  const size_t axis = depth % 3;
+  const size_t median = begin + (end - begin) / 2;
+  std::nth_element(order_.begin() + begin, order_.begin() + median, order_.begin() + end,
+                   [&](const size_t a, const size_t b) { return points_[a][axis] < points_[b][axis]; });
+  BuildSubTree(begin, median, depth + 1);
+  BuildSubTree(median + 1, end, depth + 1);
+}
+
+void KdTree::SearchInRange(const size_t begin, const size_t end, const size_t depth, const Vector<3>& center, const double radius_squared,
+                           std::vector<size_t>& indices) const {
+  if (begin >= end) return;
+  const size_t axis = depth % 3;
+  const size_t median = begin + (end - begin) / 2;
+  const size_t node = order_[median];
+
+  if (CalcDistanceSquared(node, center) <= radius_squared) indices.push_back(node);
+
+  const double difference = center[axis] - points_[node][axis];
+  // The points in the left sub-tree are less than or equal to the node, and the points in the right sub-tree are greater than or equal to it
+  if (difference <= 0.0 || difference * difference <= radius_squared) {
+    SearchInRange(begin, median, depth + 1, center, radius_squared, indices);
+  }
+  if (difference >= 0.0 || difference * difference <= radius_squared) {
+    SearchInRange(median + 1, end, depth + 1, center, radius_squared, indices);
+  }
+}
+
+void KdTree::SearchNearest(const size_t begin, const size_t end, const size_t depth, const Vector<3>& position, const size_t excluded_index,
+                           size_t& nearest_index, double& nearest_distance_squared) const {
+  if (begin >= end) return;
+  const size_t axis = depth % 3;
+  const size_t median = begin + (end - begin) / 2;
+  const size_t node = order_[median];
+
+  if (node != excluded_index) {
+    const double distance_squared = CalcDistanceSquared(node, position);
+    if (distance_squared < nearest_distance_squared) {
+      nearest_distance_squared = distance_squared;
+      nearest_index = node;
+    }
+  }
+
+  // Search the side including the position first, and the other side only when it can include a nearer point
+  const double difference = position[axis] - points_[node][axis];
+  if (difference < 0.0) {
+    SearchNearest(begin, median, depth + 1, position, excluded_index, nearest_index, nearest_distance_squared);
+    if (difference * difference < nearest_distance_squared) {
+      SearchNearest(median + 1, end, depth + 1, position, excluded_index, nearest_index, nearest_distance_squared);
+    }
+  } else {
+    SearchNearest(median + 1, end, depth + 1, position, excluded_index, nearest_index, nearest_distance_squared);
+    if (difference * difference < nearest_distance_squared) {
+      SearchNearest(begin, median, depth + 1, position, excluded_index, nearest_index, nearest_distance_squared);
+    }
+  }
+}
+
+double KdTree::CalcDistanceSquared(const size_t point_index, const Vector<3>& position) const {
+  double distance_squared = 0.0;
+  for (size_t i = 0; i < 3; i++) {
+    const double difference = points_[point_index][i] - position[i];
+    distance_squared += difference * difference;
+  }
+  return distance_squared;
+}
+
+}  // namespace libra
@@ -0,0 +1,95 @@
+/**
+ * @file kd_tree.hpp
+ * @brief k-d tree for range and nearest neighbor search of points in three-dimensional space
+ */
+
+#ifndef S2E_LIBRARY_MATH_KD_TREE_HPP_
+#define S2E_LIBRARY_MATH_KD_TREE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "vector.hpp"
+
+namespace libra {
+
+/**
+ * @class KdTree
+ * @brief k-d tree for range and nearest neighbor search of points in three-dimensional space
+ * @details The tree is stored implicitly as a permutation of the point indices: the median of each sub-range is the node, and the
+ *          left and right sub-ranges are the children. The split axis is selected by the depth. The buffers are reused when the tree is
+ *          rebuilt, so it can be rebuilt every step without allocation once the number of points is fixed.
+ */
+class KdTree {
+ public:
+  /**
+   * @fn KdTree
+   * @brief Default constructor. The tree is empty.
+   */
+  KdTree() {}
+
+  /**
+   * @fn Build
+   * @brief Build the tree
+   * @param [in] points: Points. The index in this list is used as the result of the search.
+   */
+  void Build(const std::vector<Vector<3>>& points);
+
+  /**
+   * @fn FindInRange
+   * @brief Find the points within the range
+   * @param [in] center: Center of the search sphere
+   * @param [in] radius: Radius of the search sphere
+   * @return Indices of the points whose distance from the center is less than or equal to the radius (in ascending order)
+   */
+  std::vector<size_t> FindInRange(const Vector<3>& center, const double radius) const;
+  /**
+   * @fn FindNearest
+   * @brief Find the nearest point
+   * @param [in] position: Query position
+   * @param [out] index: Index of the nearest point
+   * @param [in] excluded_index: Index of the point excluded from the search (e.g., the query point itself)
+   * @return False when no point is found. The index is not modified in this case.
+   */
+  bool FindNearest(const Vector<3>& position, size_t& index, const size_t excluded_index = kNoExcludedIndex) const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfPoints
+   * @return Number of points in the tree
+   */
+  inline size_t GetNumberOfPoints() const { return points_.size(); }
+
+  static const size_t kNoExcludedIndex = static_cast<size_t>(-1);  //!< Value of excluded_index to search all points
+
+ private:
+  std::vector<Vector<3>> points_;  //!< Points
+  std::vector<size_t> order_;      //!< Point indices ordered as the implicit tree
+
+  /**
+   * @fn BuildSubTree
+   * @brief Build the sub-tree of order_[begin, end)
+   */
+  void BuildSubTree(const size_t begin, const size_t end, const size_t depth);
+  /**
+   * @fn SearchInRange
+   * @brief Search the points within the range in the sub-tree of order_[begin, end)
+   */
+  void SearchInRange(const size_t begin, const size_t end, const size_t depth, const Vector<3>& center, const double radius_squared,
+                     std::vector<size_t>& indices) const;
+  /**
+   * @fn SearchNearest
+   * @brief Search the nearest point in the sub-tree of order_[begin, end)
+   */
+  void SearchNearest(const size_t begin, const size_t end, const size_t depth, const Vector<3>& position, const size_t excluded_index,
+                     size_t& nearest_index, double& nearest_distance_squared) const;
+  /**
+   * @fn CalcDistanceSquared
+   * @brief Calculate the squared distance between the point and the position
+   */
+  double CalcDistanceSquared(const size_t point_index, const Vector<3>& position) const;
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_KD_TREE_HPP_
@@ -20,16 +20,16 @@ class Matrix {
  public:
   /**
    * @fn Matrix
-   * @brief Default constructor without any initialization
+   * @brief Default constructor with the zero initialization
    */
-  inline Matrix() {}
+  inline constexpr Matrix() : matrix_() {}
 
   /**
    * @fn Matrix
    * @brief Constructor with initialize the elements as all same value
    * @param [in] n: The value for initializing
    */
-  Matrix(const T& n);
+  constexpr Matrix(const T& n);
 
   typedef T (*TP)[C];         //!< Define the pointer of the array as TP type
   typedef const T (*CTP)[C];  //!< Define the const pointer of the array as CTP type
@@ -38,20 +38,20 @@ class Matrix {
    * @fn GetRowLength
    * @brief Return row number
    */
-  inline size_t GetRowLength() const { return R; }
+  inline constexpr size_t GetRowLength() const { return R; }
 
   /**
    * @fn GetColumnLength
    * @brief Return column number
    */
-  inline size_t GetColumnLength() const { return C; }
+  inline constexpr size_t GetColumnLength() const { return C; }
 
   /**
    * @fn FillUp
    * @brief Fill up all elements with same value
    * @param [in] t: Scalar value to fill up
    */
-  void FillUp(const T& t);
+  constexpr void FillUp(const T& t);
 
   /**
    * @fn CalcTrace
@@ -59,7 +59,7 @@ class Matrix {
    * @return Trace of the matrix
    * @note When the matrix is not a square matrix, 0.0 is returned
    */
-  T CalcTrace() const;
+  constexpr T CalcTrace() const;
 
   /**
    * @fn Print
@@ -74,21 +74,21 @@ class Matrix {
    * @brief Calculate and return transposed matrix
    * @return Result of transposed matrix
    */
-  const Matrix<C, R, T> Transpose() const;
+  constexpr const Matrix<C, R, T> Transpose() const;
 
   /**
    * @fn Cast operator to directly access the elements
    * @brief Operator to access the elements similar with the 2D-array using `[]`
    * @return Pointer to the data storing array
    */
-  inline operator TP() { return matrix_; }
+  inline constexpr operator TP() { return matrix_; }
 
   /**
    * @fn Cast operator to directly access the elements (const ver.)
    * @brief Operator to access the elements similar with the 2D-array using `[]`
    * @return Const pointer to the data storing array
    */
-  inline operator CTP() const { return matrix_; }
+  inline constexpr operator CTP() const { return matrix_; }
 
   /**
    * @fn Operator ()
@@ -98,7 +98,7 @@ class Matrix {
    * @param [in] column: Target column number
    * @return Value of the target element
    */
-  inline T& operator()(size_t row, size_t column) {
+  inline constexpr T& operator()(size_t row, size_t column) {
     if (!IsValidRange(row, column)) {
       throw std::invalid_argument("Argument exceeds the range of matrix.");
     }
@@ -113,7 +113,7 @@ class Matrix {
    * @param [in] column: Target column number
    * @return Value of the target element
    */
-  inline const T& operator()(size_t row, size_t column) const {
+  inline constexpr const T& operator()(size_t row, size_t column) const {
     if (!IsValidRange(row, column)) {
       throw std::invalid_argument("Argument exceeds the range of matrix.");
     }
@@ -127,7 +127,7 @@ class Matrix {
    * @param [in] m: Adding matrix
    * @return Result of added matrix
    */
-  const Matrix<R, C, T>& operator+=(const Matrix<R, C, T>& m);
+  constexpr const Matrix<R, C, T>& operator+=(const Matrix<R, C, T>& m);
 
   /**
    * @fn Operator -=
@@ -136,7 +136,7 @@ class Matrix {
    * @param [in] m: Subtracting matrix
    * @return Result of subtracted matrix
    */
-  const Matrix<R, C, T>& operator-=(const Matrix<R, C, T>& m);
+  constexpr const Matrix<R, C, T>& operator-=(const Matrix<R, C, T>& m);
 
   /**
    * @fn Operator *=
@@ -145,7 +145,7 @@ class Matrix {
    * @param [in] n: Multiplying scalar value
    * @return Result of multiplied matrix
    */
-  const Matrix<R, C, T>& operator*=(const T& n);
+  constexpr const Matrix<R, C, T>& operator*=(const T& n);
 
   /**
    * @fn Operator /=
@@ -154,7 +154,7 @@ class Matrix {
    * @param [in] n: Dividing scalar value
    * @return Result of multiplied matrix
    */
-  const Matrix<R, C, T>& operator/=(const T& n);
+  constexpr const Matrix<R, C, T>& operator/=(const T& n);
 
  private:
   T matrix_[R][C];  //!< Array to save the elements
@@ -166,7 +166,7 @@ class Matrix {
    * @param [in] column: Target column number
    * @return True: row/column number is in the range
    */
-  inline bool IsValidRange(size_t row, size_t column) { return (row < R && column < C); }
+  inline constexpr bool IsValidRange(size_t row, size_t column) const { return (row < R && column < C); }
 };
 
 /**
@@ -177,7 +177,7 @@ class Matrix {
  * @return Result of added matrix
  */
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T> operator+(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs);
+constexpr const Matrix<R, C, T> operator+(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs);
 
 /**
  * @fn operator -
@@ -187,7 +187,7 @@ const Matrix<R, C, T> operator+(const Matrix<R, C, T>& lhs, const Matrix<R, C, T
  * @return Result of subtracted matrix
  */
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T> operator-(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs);
+constexpr const Matrix<R, C, T> operator-(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs);
 
 /**
  * @fn operator *
@@ -197,7 +197,7 @@ const Matrix<R, C, T> operator-(const Matrix<R, C, T>& lhs, const Matrix<R, C, T
  * @return Result of multiplied matrix
  */
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T> operator*(const T& lhs, const Matrix<R, C, T>& rhs);
+constexpr const Matrix<R, C, T> operator*(const T& lhs, const Matrix<R, C, T>& rhs);
 
 /**
  * @fn operator *
@@ -207,7 +207,18 @@ const Matrix<R, C, T> operator*(const T& lhs, const Matrix<R, C, T>& rhs);
  * @return Result of multiplied matrix
  */
 template <size_t R, size_t C1, size_t C2, typename T>
-const Matrix<R, C2, T> operator*(const Matrix<R, C1, T>& lhs, const Matrix<C1, C2, T>& rhs);
+constexpr const Matrix<R, C2, T> operator*(const Matrix<R, C1, T>& lhs, const Matrix<C1, C2, T>& rhs);
+
+/**
+ * @fn operator *
+ * @brief Multiply two 3x3 matrices
+ * @note Unrolled overload selected instead of the generic one for the frequently used size
+ * @param [in] lhs: Left hand side matrix
+ * @param [in] rhs: Right hand side matrix
+ * @return Result of multiplied matrix
+ */
+template <typename T>
+constexpr const Matrix<3, 3, T> operator*(const Matrix<3, 3, T>& lhs, const Matrix<3, 3, T>& rhs);
 
 /**
  * @fn MakeIdentityMatrix
@@ -215,7 +226,7 @@ const Matrix<R, C2, T> operator*(const Matrix<R, C1, T>& lhs, const Matrix<C1, C
  * @return The identity matrix
  */
 template <size_t R, typename T = double>
-Matrix<R, R, T> MakeIdentityMatrix();
+constexpr Matrix<R, R, T> MakeIdentityMatrix();
 
 /**
  * @fn MakeRotationMatrixX
@@ -12,7 +12,7 @@
 namespace libra {
 
 template <size_t R, size_t C, typename T>
-Matrix<R, C, T>::Matrix(const T& n) {
+constexpr Matrix<R, C, T>::Matrix(const T& n) : matrix_() {
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
       matrix_[i][j] = n;
@@ -21,7 +21,7 @@ Matrix<R, C, T>::Matrix(const T& n) {
 }
 
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T>& Matrix<R, C, T>::operator+=(const Matrix<R, C, T>& m) {
+constexpr const Matrix<R, C, T>& Matrix<R, C, T>::operator+=(const Matrix<R, C, T>& m) {
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
       matrix_[i][j] += m.matrix_[i][j];
@@ -31,7 +31,7 @@ const Matrix<R, C, T>& Matrix<R, C, T>::operator+=(const Matrix<R, C, T>& m) {
 }
 
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T>& Matrix<R, C, T>::operator*=(const T& n) {
+constexpr const Matrix<R, C, T>& Matrix<R, C, T>::operator*=(const T& n) {
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
       matrix_[i][j] *= n;
@@ -41,12 +41,12 @@ const Matrix<R, C, T>& Matrix<R, C, T>::operator*=(const T& n) {
 }
 
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T>& Matrix<R, C, T>::operator/=(const T& n) {
+constexpr const Matrix<R, C, T>& Matrix<R, C, T>::operator/=(const T& n) {
   return operator*=(1.0 / n);
 }
 
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T>& Matrix<R, C, T>::operator-=(const Matrix<R, C, T>& m) {
+constexpr const Matrix<R, C, T>& Matrix<R, C, T>::operator-=(const Matrix<R, C, T>& m) {
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
       matrix_[i][j] -= m.matrix_[i][j];
@@ -56,7 +56,7 @@ const Matrix<R, C, T>& Matrix<R, C, T>::operator-=(const Matrix<R, C, T>& m) {
 }
 
 template <size_t R, size_t C, typename T>
-void Matrix<R, C, T>::FillUp(const T& t) {
+constexpr void Matrix<R, C, T>::FillUp(const T& t) {
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
       matrix_[i][j] = t;
@@ -65,7 +65,7 @@ void Matrix<R, C, T>::FillUp(const T& t) {
 }
 
 template <size_t R, size_t C, typename T>
-T Matrix<R, C, T>::CalcTrace() const {
+constexpr T Matrix<R, C, T>::CalcTrace() const {
   T trace = 0.0;
 
   if (R != C) return trace;
@@ -88,7 +88,7 @@ void Matrix<R, C, T>::Print(char delimiter, std::ostream& stream) const {
 }
 
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T> operator+(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs) {
+constexpr const Matrix<R, C, T> operator+(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs) {
   Matrix<R, C, T> temp;
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
@@ -99,7 +99,7 @@ const Matrix<R, C, T> operator+(const Matrix<R, C, T>& lhs, const Matrix<R, C, T
 }
 
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T> operator-(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs) {
+constexpr const Matrix<R, C, T> operator-(const Matrix<R, C, T>& lhs, const Matrix<R, C, T>& rhs) {
   Matrix<R, C, T> temp;
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
@@ -110,7 +110,7 @@ const Matrix<R, C, T> operator-(const Matrix<R, C, T>& lhs, const Matrix<R, C, T
 }
 
 template <size_t R, size_t C, typename T>
-const Matrix<R, C, T> operator*(const T& rhs, const Matrix<R, C, T>& lhs) {
+constexpr const Matrix<R, C, T> operator*(const T& rhs, const Matrix<R, C, T>& lhs) {
   Matrix<R, C, T> temp;
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
@@ -121,7 +121,7 @@ const Matrix<R, C, T> operator*(const T& rhs, const Matrix<R, C, T>& lhs) {
 }
 
 template <size_t R, size_t C1, size_t C2, typename T>
-const Matrix<R, C2, T> operator*(const Matrix<R, C1, T>& lhs, const Matrix<C1, C2, T>& rhs) {
+constexpr const Matrix<R, C2, T> operator*(const Matrix<R, C1, T>& lhs, const Matrix<C1, C2, T>& rhs) {
   Matrix<R, C2, T> temp(0);
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C2; ++j) {
@@ -133,8 +133,19 @@ const Matrix<R, C2, T> operator*(const Matrix<R, C1, T>& lhs, const Matrix<C1, C
   return temp;
 }
 
+template <typename T>
+constexpr const Matrix<3, 3, T> operator*(const Matrix<3, 3, T>& lhs, const Matrix<3, 3, T>& rhs) {
+  Matrix<3, 3, T> temp;
+  for (size_t i = 0; i < 3; ++i) {
+    temp[i][0] = lhs[i][0] * rhs[0][0] + lhs[i][1] * rhs[1][0] + lhs[i][2] * rhs[2][0];
+    temp[i][1] = lhs[i][0] * rhs[0][1] + lhs[i][1] * rhs[1][1] + lhs[i][2] * rhs[2][1];
+    temp[i][2] = lhs[i][0] * rhs[0][2] + lhs[i][1] * rhs[1][2] + lhs[i][2] * rhs[2][2];
+  }
+  return temp;
+}
+
 template <size_t R, size_t C, typename T>
-const Matrix<C, R, T> Matrix<R, C, T>::Transpose() const {
+constexpr const Matrix<C, R, T> Matrix<R, C, T>::Transpose() const {
   Matrix<C, R, T> temp;
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
@@ -145,7 +156,7 @@ const Matrix<C, R, T> Matrix<R, C, T>::Transpose() const {
 }
 
 template <size_t R, typename T>
-Matrix<R, R, T> MakeIdentityMatrix() {
+constexpr Matrix<R, R, T> MakeIdentityMatrix() {
   Matrix<R, R, T> m(0.0);
   for (size_t i = 0; i < R; ++i) {
     m[i][i] = 1.0;
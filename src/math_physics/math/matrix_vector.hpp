@@ -19,7 +19,18 @@ namespace libra {
  * @return Result of multiplied matrix
  */
 template <size_t R, size_t C, typename TM, typename TC>
-Vector<R, TC> operator*(const Matrix<R, C, TM>& matrix, const Vector<C, TC>& vector);
+constexpr Vector<R, TC> operator*(const Matrix<R, C, TM>& matrix, const Vector<C, TC>& vector);
+
+/**
+ * @fn operator*
+ * @brief Multiply 3x3 matrix and 3D vector
+ * @note Unrolled overload selected instead of the generic one for the frequently used size
+ * @param [in] matrix: Target matrix
+ * @param [in] vector: Target vector
+ * @return Result of multiplied matrix
+ */
+template <typename TM, typename TC>
+constexpr Vector<3, TC> operator*(const Matrix<3, 3, TM>& matrix, const Vector<3, TC>& vector);
 
 /**
  * @fn CalcInverseMatrix
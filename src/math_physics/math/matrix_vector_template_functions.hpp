@@ -11,7 +11,7 @@
 namespace libra {
 
 template <size_t R, size_t C, typename TM, typename TC>
-Vector<R, TC> operator*(const Matrix<R, C, TM>& matrix, const Vector<C, TC>& vector) {
+constexpr Vector<R, TC> operator*(const Matrix<R, C, TM>& matrix, const Vector<C, TC>& vector) {
   Vector<R, TC> temp(0.0);
   for (size_t i = 0; i < R; ++i) {
     for (size_t j = 0; j < C; ++j) {
@@ -21,6 +21,15 @@ Vector<R, TC> operator*(const Matrix<R, C, TM>& matrix, const Vector<C, TC>& vec
   return temp;
 }
 
+template <typename TM, typename TC>
+constexpr Vector<3, TC> operator*(const Matrix<3, 3, TM>& matrix, const Vector<3, TC>& vector) {
+  Vector<3, TC> temp;
+  temp[0] = matrix[0][0] * vector[0] + matrix[0][1] * vector[1] + matrix[0][2] * vector[2];
+  temp[1] = matrix[1][0] * vector[0] + matrix[1][1] * vector[1] + matrix[1][2] * vector[2];
+  temp[2] = matrix[2][0] * vector[0] + matrix[2][1] * vector[1] + matrix[2][2] * vector[2];
+  return temp;
+}
+
 template <std::size_t N>
 Matrix<N, N> CalcInverseMatrix(const Matrix<N, N>& matrix) {
   Matrix<N, N> temp(matrix);
@@ -6,6 +6,10 @@
 #ifndef S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 #define S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 
+#include <memory>
+#include <utilities/snapshot.hpp>
+
+#include "../numerical_integration/numerical_integrator_manager.hpp"
 #include "./vector.hpp"
 
 namespace libra {
@@ -58,6 +62,29 @@ class OrdinaryDifferentialEquation {
    */
   void Setup(const double initial_independent_variable, const Vector<N>& initial_state);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the independent variable, the state, and the derivative to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the independent variable, the state, and the derivative from the snapshot
+   * @note Multistep methods restart from the restored state since their derivative history is not saved.
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
+  /**
+   * @fn SetIntegrationMethod
+   * @brief Select the numerical integration method used in Update
+   * @note The built-in RK4 is used when this function is not called.
+   *       Multistep methods such as kAbm keep the derivative history between the updates, and they restart when the state is set from outside.
+   * @param [in] method: Numerical integration method
+   */
+  void SetIntegrationMethod(const numerical_integration::NumericalIntegrationMethod method);
+
   /**
    * @fn SetStepWidth
    * @brief Initialize the state vector
@@ -87,6 +114,7 @@ class OrdinaryDifferentialEquation {
   /**
    * @fn GetDerivative
    * @brief Return const reference of differentiate state vector
+   * @note It is not updated when the integration method is set by SetIntegrationMethod.
    */
   inline const Vector<N>& GetDerivative() const { return derivative_; }
 
@@ -109,6 +137,38 @@ class OrdinaryDifferentialEquation {
   Vector<N> state_;              //!< Latest state vector
   Vector<N> derivative_;         //!< Latest differentiate of the state vector
   double step_width_s_;          //!< Step width
+
+  /**
+   * @class DerivativeAdapter
+   * @brief Adapter to use the derivative function with the integrators in numerical_integration
+   */
+  class DerivativeAdapter : public numerical_integration::InterfaceOde<N> {
+   public:
+    explicit DerivativeAdapter(OrdinaryDifferentialEquation<N>* ode) : ode_(ode) {}
+    Vector<N> DerivativeFunction(const double independent_variable, const Vector<N>& state) const override {
+      Vector<N> derivative(0.0);
+      ode_->DerivativeFunction(independent_variable, state, derivative);
+      return derivative;
+    }
+    void CalcDerivative(const double independent_variable, const Vector<N>& state, Vector<N>& derivative) const override {
+      ode_->DerivativeFunction(independent_variable, state, derivative);
+    }
+    inline const OrdinaryDifferentialEquation<N>* GetOde() const { return ode_; }
+
+   private:
+    OrdinaryDifferentialEquation<N>* ode_;  //!< Target ODE
+  };
+
+  bool is_integration_method_set_ = false;                                                    //!< Use the integrator instead of the built-in RK4
+  numerical_integration::NumericalIntegrationMethod integration_method_;                      //!< Selected integration method
+  std::shared_ptr<DerivativeAdapter> derivative_adapter_;                                     //!< Adapter for the integrator
+  std::shared_ptr<numerical_integration::NumericalIntegratorManager<N>> integrator_manager_;  //!< Integrator of the selected method
+
+  /**
+   * @fn UpdateWithIntegrator
+   * @brief Update the state with the selected integrator
+   */
+  void UpdateWithIntegrator();
 };
 
 }  // namespace libra
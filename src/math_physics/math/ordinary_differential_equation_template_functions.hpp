@@ -17,31 +17,84 @@ void OrdinaryDifferentialEquation<N>::Setup(double initial_independent_variable,
   state_ = initial_state;
 }
 
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(independent_variable_);
+  snapshot.Write(state_);
+  snapshot.Write(derivative_);
+  snapshot.Write(step_width_s_);
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(independent_variable_);
+  snapshot.Read(state_);
+  snapshot.Read(derivative_);
+  snapshot.Read(step_width_s_);
+}
+
 template <size_t N>
 OrdinaryDifferentialEquation<N>& OrdinaryDifferentialEquation<N>::operator++() {
   Update();
   return *this;
 }
 
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::SetIntegrationMethod(const numerical_integration::NumericalIntegrationMethod method) {
+  is_integration_method_set_ = true;
+  integration_method_ = method;
+  derivative_adapter_.reset();
+  integrator_manager_.reset();
+}
+
 template <size_t N>
 void OrdinaryDifferentialEquation<N>::Update() {
+  if (is_integration_method_set_) {
+    UpdateWithIntegrator();
+    return;
+  }
+
   DerivativeFunction(independent_variable_, state_, derivative_);  // Current derivative calculation
 
   // 4th order Runge-Kutta method
-  Vector<N> k1(derivative_);
-  k1 *= step_width_s_;
-  Vector<N> k2((double)state_.GetLength());
-  DerivativeFunction(independent_variable_ + 0.5 * step_width_s_, state_ + 0.5 * k1, k2);
-  k2 *= step_width_s_;
-  Vector<N> k3((double)state_.GetLength());
-  DerivativeFunction(independent_variable_ + 0.5 * step_width_s_, state_ + 0.5 * k2, k3);
-  k3 *= step_width_s_;
-  Vector<N> k4((double)state_.GetLength());
-  DerivativeFunction(independent_variable_ + step_width_s_, state_ + k3, k4);
-  k4 *= step_width_s_;
-
-  state_ += (1.0 / 6.0) * (k1 + 2.0 * (k2 + k3) + k4);  // Update state vector
-  independent_variable_ += step_width_s_;               // Update independent variable
+  // The stages are written into the buffers in place to avoid the temporary vectors in each step
+  const double half_step_s = 0.5 * step_width_s_;
+  Vector<N> stage_state(0.0);
+  Vector<N> k2(0.0), k3(0.0), k4(0.0);
+  for (size_t i = 0; i < N; i++) stage_state[i] = state_[i] + half_step_s * derivative_[i];
+  DerivativeFunction(independent_variable_ + half_step_s, stage_state, k2);
+  for (size_t i = 0; i < N; i++) stage_state[i] = state_[i] + half_step_s * k2[i];
+  DerivativeFunction(independent_variable_ + half_step_s, stage_state, k3);
+  for (size_t i = 0; i < N; i++) stage_state[i] = state_[i] + step_width_s_ * k3[i];
+  DerivativeFunction(independent_variable_ + step_width_s_, stage_state, k4);
+
+  // Update state vector
+  const double sixth_step_s = step_width_s_ / 6.0;
+  for (size_t i = 0; i < N; i++) state_[i] += sixth_step_s * (derivative_[i] + 2.0 * (k2[i] + k3[i]) + k4[i]);
+  independent_variable_ += step_width_s_;  // Update independent variable
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::UpdateWithIntegrator() {
+  // The integrator is generated for each instance since the adapter refers to this instance
+  if (derivative_adapter_ == nullptr || derivative_adapter_->GetOde() != this) {
+    derivative_adapter_ = std::make_shared<DerivativeAdapter>(this);
+    integrator_manager_ =
+        std::make_shared<numerical_integration::NumericalIntegratorManager<N>>(step_width_s_, *derivative_adapter_, integration_method_);
+  }
+  auto integrator = integrator_manager_->GetIntegrator();
+
+  // Synchronize the state when it is modified from outside
+  bool is_state_modified = integrator->GetCurrentIndependentVariable() != independent_variable_;
+  for (size_t i = 0; i < N; i++) {
+    if (integrator->GetState()[i] != state_[i]) is_state_modified = true;
+  }
+  if (is_state_modified) integrator->SetState(independent_variable_, state_);
+
+  integrator->SetStepWidth(step_width_s_);
+  integrator->Integrate();
+  state_ = integrator->GetState();
+  independent_variable_ = integrator->GetCurrentIndependentVariable();
 }
 
 }  // namespace libra
@@ -54,56 +54,10 @@ Quaternion::Quaternion(const Vector<3>& vector_before, const Vector<3>& vector_a
   }
 }
 
-Quaternion operator-(const Quaternion& lhs, const Quaternion& rhs) {
-  Quaternion temp;
-  for (int i = 0; i < 4; ++i) {
-    temp[i] = lhs[i] - rhs[i];
-  }
-  return temp;
-}
-
-Quaternion operator+(const Quaternion& lhs, const Quaternion& rhs) {
-  Quaternion temp;
-  for (int i = 0; i < 4; ++i) {
-    temp[i] = lhs[i] + rhs[i];
-  }
-  return temp;
-}
-
-Quaternion operator*(const Quaternion& lhs, const Quaternion& rhs) {
-  Quaternion temp;
-
-  temp[0] = lhs[3] * rhs[0] - lhs[2] * rhs[1] + lhs[1] * rhs[2] + lhs[0] * rhs[3];
-  temp[1] = lhs[2] * rhs[0] + lhs[3] * rhs[1] - lhs[0] * rhs[2] + lhs[1] * rhs[3];
-  temp[2] = -lhs[1] * rhs[0] + lhs[0] * rhs[1] + lhs[3] * rhs[2] + lhs[2] * rhs[3];
-  temp[3] = -lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2] + lhs[3] * rhs[3];
-
-  return temp;
-}
-
-Quaternion operator*(const Quaternion& lhs, const Vector<3>& rhs) {
-  Quaternion temp;
-
-  temp[0] = lhs[1] * rhs[2] - lhs[2] * rhs[1] + lhs[3] * rhs[0];
-  temp[1] = -lhs[0] * rhs[2] + lhs[2] * rhs[0] + lhs[3] * rhs[1];
-  temp[2] = lhs[0] * rhs[1] - lhs[1] * rhs[0] + lhs[3] * rhs[2];
-  temp[3] = -lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2];
-
-  return temp;
-}
-
-Quaternion operator*(const double& lhs, const Quaternion& rhs) {
-  Quaternion temp;
-  for (size_t i = 0; i < 4; i++) {
-    temp[i] = lhs * rhs[i];
-  }
-  return temp;
-}
-
 Quaternion Quaternion::Normalize(void) {
   double n = 0.0;
   for (int i = 0; i < 4; ++i) {
-    n += pow(quaternion_[i], 2.0);
+    n += quaternion_[i] * quaternion_[i];
   }
   if (n == 0.0) {
     return quaternion_;
@@ -117,32 +71,6 @@ Quaternion Quaternion::Normalize(void) {
   return quaternion_;
 }
 
-Quaternion Quaternion::Conjugate(void) const {
-  Quaternion temp(quaternion_);
-  for (int i = 0; i < 3; ++i) {
-    temp[i] *= -1.0;
-  }
-  return temp;
-}
-
-Matrix<3, 3> Quaternion::ConvertToDcm(void) const {
-  Matrix<3, 3> dcm;
-
-  dcm[0][0] = quaternion_[3] * quaternion_[3] + quaternion_[0] * quaternion_[0] - quaternion_[1] * quaternion_[1] - quaternion_[2] * quaternion_[2];
-  dcm[0][1] = 2.0 * (quaternion_[0] * quaternion_[1] + quaternion_[3] * quaternion_[2]);
-  dcm[0][2] = 2.0 * (quaternion_[0] * quaternion_[2] - quaternion_[3] * quaternion_[1]);
-
-  dcm[1][0] = 2.0 * (quaternion_[0] * quaternion_[1] - quaternion_[3] * quaternion_[2]);
-  dcm[1][1] = quaternion_[3] * quaternion_[3] - quaternion_[0] * quaternion_[0] + quaternion_[1] * quaternion_[1] - quaternion_[2] * quaternion_[2];
-  dcm[1][2] = 2.0 * (quaternion_[1] * quaternion_[2] + quaternion_[3] * quaternion_[0]);
-
-  dcm[2][0] = 2.0 * (quaternion_[0] * quaternion_[2] + quaternion_[3] * quaternion_[1]);
-  dcm[2][1] = 2.0 * (quaternion_[1] * quaternion_[2] - quaternion_[3] * quaternion_[0]);
-  dcm[2][2] = quaternion_[3] * quaternion_[3] - quaternion_[0] * quaternion_[0] - quaternion_[1] * quaternion_[1] + quaternion_[2] * quaternion_[2];
-
-  return dcm;
-}
-
 Quaternion Quaternion::ConvertFromDcm(const Matrix<3, 3> dcm) {
   Quaternion q;
   q[0] = sqrt(1 + dcm[0][0] - dcm[1][1] - dcm[2][2]) / 2;
@@ -212,28 +140,6 @@ Quaternion Quaternion::ConvertFromEuler(const Vector<3> euler) {
   return Quaternion::ConvertFromDcm(dcm);
 }
 
-Vector<3> Quaternion::FrameConversion(const Vector<3>& vector) const {
-  Quaternion conjugate = Conjugate();
-  Quaternion temp1 = conjugate * vector;
-  Quaternion temp2 = temp1 * quaternion_;
-  Vector<3> answer;
-  for (int i = 0; i < 3; ++i) {
-    answer[i] = temp2[i];
-  }
-  return answer;
-}
-
-Vector<3> Quaternion::InverseFrameConversion(const Vector<3>& vector) const {
-  Quaternion conjugate = Conjugate();
-  Quaternion temp1 = quaternion_ * vector;
-  Quaternion temp2 = temp1 * conjugate;
-  Vector<3> answer;
-  for (int i = 0; i < 3; ++i) {
-    answer[i] = temp2[i];
-  }
-  return answer;
-}
-
 Vector<4> Quaternion::ConvertToVector() { return quaternion_; }
 
 }  // namespace libra
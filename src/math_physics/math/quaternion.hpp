@@ -19,9 +19,9 @@ class Quaternion {
  public:
   /**
    * @fn Quaternion
-   * @brief Default constructor without any initialization
+   * @brief Default constructor with the zero initialization
    */
-  inline Quaternion() {}
+  inline constexpr Quaternion() {}
   /**
    * @fn Quaternion
    * @brief Constructor with initialization
@@ -30,7 +30,7 @@ class Quaternion {
    * @param [in] quaternion_z: The third element of Quaternion (Z)
    * @param [in] quaternion_w: The fourth element of Quaternion (W)
    */
-  inline Quaternion(const double quaternion_x, const double quaternion_y, const double quaternion_z, const double quaternion_w) {
+  inline constexpr Quaternion(const double quaternion_x, const double quaternion_y, const double quaternion_z, const double quaternion_w) {
     quaternion_[0] = quaternion_x;
     quaternion_[1] = quaternion_y;
     quaternion_[2] = quaternion_z;
@@ -41,7 +41,7 @@ class Quaternion {
    * @brief Constructor initialized with vector
    * @param [in] quaternion_vector: Vector storing quaternion
    */
-  inline Quaternion(const Vector<4>& quaternion_vector) : quaternion_(quaternion_vector) {}
+  inline constexpr Quaternion(const Vector<4>& quaternion_vector) : quaternion_(quaternion_vector) {}
   /**
    * @fn Quaternion
    * @brief Constructor initialized with rotation expression
@@ -63,7 +63,7 @@ class Quaternion {
    * @param [in] quaternion_vector: Vector
    * @return Quaternion
    */
-  inline Quaternion& operator=(const Vector<4>& quaternion_vector) {
+  inline constexpr Quaternion& operator=(const Vector<4>& quaternion_vector) {
     quaternion_ = quaternion_vector;
     return *this;
   }
@@ -74,19 +74,19 @@ class Quaternion {
    * @note Users can use Quaternion as Vector<4> object
    * @return Const reference to the internal Vector<4>
    */
-  inline operator const Vector<4>&() const { return quaternion_; }
+  inline constexpr operator const Vector<4>&() const { return quaternion_; }
 
   /**
    * @fn Cast operator
    * @brief Operator to directly access the element like array with [] operator
    */
-  inline operator double*() { return quaternion_; }
+  inline constexpr operator double*() { return quaternion_; }
 
   /**
    * @fn Cast operator (const ver.)
    * @brief Operator to directly access the element like array with [] operator
    */
-  inline operator const double*() const { return quaternion_; }
+  inline constexpr operator const double*() const { return quaternion_; }
 
   /**
    * @fn Normalize
@@ -100,14 +100,14 @@ class Quaternion {
    * @brief Calculate Conjugate quaternion
    * @return Conjugated quaternion
    */
-  Quaternion Conjugate(void) const;
+  constexpr Quaternion Conjugate(void) const;
 
   /**
    * @fn ConvertToDcm
    * @brief Convert quaternion to Direction Cosine Matrix
    * @return DCM
    */
-  Matrix<3, 3> ConvertToDcm(void) const;
+  constexpr Matrix<3, 3> ConvertToDcm(void) const;
 
   /**
    * @fn ConvertFromDcm
@@ -138,7 +138,7 @@ class Quaternion {
    * @param [in] vector: Target vector
    * @return Converted vector
    */
-  Vector<3> FrameConversion(const Vector<3>& vector) const;
+  constexpr Vector<3> FrameConversion(const Vector<3>& vector) const;
 
   /**
    * @fn InverseFrameConversion
@@ -146,7 +146,7 @@ class Quaternion {
    * @param [in] vector: Target vector
    * @return Converted vector
    */
-  Vector<3> InverseFrameConversion(const Vector<3>& vector) const;
+  constexpr Vector<3> InverseFrameConversion(const Vector<3>& vector) const;
 
   /**
    * @fn ConvertToVector
@@ -166,7 +166,7 @@ class Quaternion {
  * @param [in] rhs: Right hand side quaternion
  * @return Quaternion
  */
-Quaternion operator+(const Quaternion& lhs, const Quaternion& rhs);
+constexpr Quaternion operator+(const Quaternion& lhs, const Quaternion& rhs);
 
 /**
  * @fn operator-
@@ -175,7 +175,7 @@ Quaternion operator+(const Quaternion& lhs, const Quaternion& rhs);
  * @param [in] rhs: Right hand side quaternion
  * @return Quaternion
  */
-Quaternion operator-(const Quaternion& lhs, const Quaternion& rhs);
+constexpr Quaternion operator-(const Quaternion& lhs, const Quaternion& rhs);
 
 /**
  * @fn operator*
@@ -184,7 +184,7 @@ Quaternion operator-(const Quaternion& lhs, const Quaternion& rhs);
  * @param [in] rhs: Right hand side quaternion
  * @return Quaternion
  */
-Quaternion operator*(const Quaternion& lhs, const Quaternion& rhs);
+constexpr Quaternion operator*(const Quaternion& lhs, const Quaternion& rhs);
 
 /**
  * @fn operator*
@@ -193,7 +193,7 @@ Quaternion operator*(const Quaternion& lhs, const Quaternion& rhs);
  * @param [in] rhs: Right hand side vector
  * @return Quaternion
  */
-Quaternion operator*(const Quaternion& lhs, const Vector<3>& rhs);
+constexpr Quaternion operator*(const Quaternion& lhs, const Vector<3>& rhs);
 
 /**
  * @fn operator*
@@ -202,7 +202,107 @@ Quaternion operator*(const Quaternion& lhs, const Vector<3>& rhs);
  * @param [in] rhs: Right hand side quaternion
  * @return Quaternion
  */
-Quaternion operator*(const double& lhs, const Quaternion& rhs);
+constexpr Quaternion operator*(const double& lhs, const Quaternion& rhs);
+
+constexpr Quaternion Quaternion::Conjugate(void) const {
+  Quaternion temp(quaternion_);
+  for (int i = 0; i < 3; ++i) {
+    temp[i] *= -1.0;
+  }
+  return temp;
+}
+
+constexpr Matrix<3, 3> Quaternion::ConvertToDcm(void) const {
+  Matrix<3, 3> dcm;
+
+  dcm[0][0] = quaternion_[3] * quaternion_[3] + quaternion_[0] * quaternion_[0] - quaternion_[1] * quaternion_[1] - quaternion_[2] * quaternion_[2];
+  dcm[0][1] = 2.0 * (quaternion_[0] * quaternion_[1] + quaternion_[3] * quaternion_[2]);
+  dcm[0][2] = 2.0 * (quaternion_[0] * quaternion_[2] - quaternion_[3] * quaternion_[1]);
+
+  dcm[1][0] = 2.0 * (quaternion_[0] * quaternion_[1] - quaternion_[3] * quaternion_[2]);
+  dcm[1][1] = quaternion_[3] * quaternion_[3] - quaternion_[0] * quaternion_[0] + quaternion_[1] * quaternion_[1] - quaternion_[2] * quaternion_[2];
+  dcm[1][2] = 2.0 * (quaternion_[1] * quaternion_[2] + quaternion_[3] * quaternion_[0]);
+
+  dcm[2][0] = 2.0 * (quaternion_[0] * quaternion_[2] + quaternion_[3] * quaternion_[1]);
+  dcm[2][1] = 2.0 * (quaternion_[1] * quaternion_[2] - quaternion_[3] * quaternion_[0]);
+  dcm[2][2] = quaternion_[3] * quaternion_[3] - quaternion_[0] * quaternion_[0] - quaternion_[1] * quaternion_[1] + quaternion_[2] * quaternion_[2];
+
+  return dcm;
+}
+
+constexpr Vector<3> Quaternion::FrameConversion(const Vector<3>& vector) const {
+  // Vector part of q* v q written without the quaternion products
+  // (w^2 - |u|^2) v + 2 (u.v) u - 2 w (u x v), where u is the vector part and w is the scalar part of q
+  const double x = quaternion_[0], y = quaternion_[1], z = quaternion_[2], w = quaternion_[3];
+  const double scalar_coefficient = w * w - (x * x + y * y + z * z);
+  const double axis_coefficient = 2.0 * (x * vector[0] + y * vector[1] + z * vector[2]);
+  const double cross_coefficient = -2.0 * w;
+  Vector<3> answer;
+  answer[0] = scalar_coefficient * vector[0] + axis_coefficient * x + cross_coefficient * (y * vector[2] - z * vector[1]);
+  answer[1] = scalar_coefficient * vector[1] + axis_coefficient * y + cross_coefficient * (z * vector[0] - x * vector[2]);
+  answer[2] = scalar_coefficient * vector[2] + axis_coefficient * z + cross_coefficient * (x * vector[1] - y * vector[0]);
+  return answer;
+}
+
+constexpr Vector<3> Quaternion::InverseFrameConversion(const Vector<3>& vector) const {
+  // Vector part of q v q*: (w^2 - |u|^2) v + 2 (u.v) u + 2 w (u x v)
+  const double x = quaternion_[0], y = quaternion_[1], z = quaternion_[2], w = quaternion_[3];
+  const double scalar_coefficient = w * w - (x * x + y * y + z * z);
+  const double axis_coefficient = 2.0 * (x * vector[0] + y * vector[1] + z * vector[2]);
+  const double cross_coefficient = 2.0 * w;
+  Vector<3> answer;
+  answer[0] = scalar_coefficient * vector[0] + axis_coefficient * x + cross_coefficient * (y * vector[2] - z * vector[1]);
+  answer[1] = scalar_coefficient * vector[1] + axis_coefficient * y + cross_coefficient * (z * vector[0] - x * vector[2]);
+  answer[2] = scalar_coefficient * vector[2] + axis_coefficient * z + cross_coefficient * (x * vector[1] - y * vector[0]);
+  return answer;
+}
+
+constexpr Quaternion operator-(const Quaternion& lhs, const Quaternion& rhs) {
+  Quaternion temp;
+  for (int i = 0; i < 4; ++i) {
+    temp[i] = lhs[i] - rhs[i];
+  }
+  return temp;
+}
+
+constexpr Quaternion operator+(const Quaternion& lhs, const Quaternion& rhs) {
+  Quaternion temp;
+  for (int i = 0; i < 4; ++i) {
+    temp[i] = lhs[i] + rhs[i];
+  }
+  return temp;
+}
+
+constexpr Quaternion operator*(const Quaternion& lhs, const Quaternion& rhs) {
+  Quaternion temp;
+
+  temp[0] = lhs[3] * rhs[0] - lhs[2] * rhs[1] + lhs[1] * rhs[2] + lhs[0] * rhs[3];
+  temp[1] = lhs[2] * rhs[0] + lhs[3] * rhs[1] - lhs[0] * rhs[2] + lhs[1] * rhs[3];
+  temp[2] = -lhs[1] * rhs[0] + lhs[0] * rhs[1] + lhs[3] * rhs[2] + lhs[2] * rhs[3];
+  temp[3] = -lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2] + lhs[3] * rhs[3];
+
+  return temp;
+}
+
+constexpr Quaternion operator*(const Quaternion& lhs, const Vector<3>& rhs) {
+  Quaternion temp;
+
+  temp[0] = lhs[1] * rhs[2] - lhs[2] * rhs[1] + lhs[3] * rhs[0];
+  temp[1] = -lhs[0] * rhs[2] + lhs[2] * rhs[0] + lhs[3] * rhs[1];
+  temp[2] = lhs[0] * rhs[1] - lhs[1] * rhs[0] + lhs[3] * rhs[2];
+  temp[3] = -lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2];
+
+  return temp;
+}
+
+constexpr Quaternion operator*(const double& lhs, const Quaternion& rhs) {
+  Quaternion temp;
+  for (size_t i = 0; i < 4; i++) {
+    temp[i] = lhs * rhs[i];
+  }
+  return temp;
+}
+
 }  // namespace libra
 
 #endif  // S2E_LIBRARY_MATH_QUATERNION_HPP_
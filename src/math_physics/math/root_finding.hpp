@@ -0,0 +1,104 @@
+/**
+ * @file root_finding.hpp
+ * @brief Mathematical root finding method
+ */
+
+#ifndef S2E_LIBRARY_MATH_ROOT_FINDING_HPP_
+#define S2E_LIBRARY_MATH_ROOT_FINDING_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+namespace libra {
+
+/**
+ * @fn CalcRootWithBrentMethod
+ * @brief Find a root of the function in the bracket with Brent's method (inverse quadratic interpolation, secant, and bisection)
+ * @note Ref: Numerical Recipes in C, Section. 9.3
+ * @param [in] function: Target function which has the signature double(double)
+ * @param [in] lower: Lower bound of the bracket
+ * @param [in] upper: Upper bound of the bracket
+ * @param [in] tolerance: Tolerance of the independent variable
+ * @param [in] maximum_iterations: Maximum number of iterations
+ * @return Root of the function. The bound which has the smaller absolute function value is returned when the bracket is invalid.
+ */
+template <typename F>
+double CalcRootWithBrentMethod(F function, const double lower, const double upper, const double tolerance = 1.0e-9,
+                               const size_t maximum_iterations = 100) {
+  double a = lower, b = upper, c = upper;
+  double fa = function(a), fb = function(b);
+  if (fa == 0.0) return a;
+  if (fb == 0.0) return b;
+  if ((fa > 0.0) == (fb > 0.0)) {
+    std::cout << "[WARNINGS] Root finding: the function does not change its sign in the bracket" << std::endl;
+    return (fabs(fa) < fabs(fb)) ? a : b;
+  }
+
+  double fc = fb;
+  double d = b - a, e = d;
+  for (size_t i = 0; i < maximum_iterations; i++) {
+    if ((fb > 0.0) == (fc > 0.0)) {
+      // Rename so that the root is between b and c
+      c = a;
+      fc = fa;
+      d = b - a;
+      e = d;
+    }
+    if (fabs(fc) < fabs(fb)) {
+      // b is the best estimation
+      a = b;
+      b = c;
+      c = a;
+      fa = fb;
+      fb = fc;
+      fc = fa;
+    }
+    const double tolerance_1 = 2.0 * 1.0e-16 * fabs(b) + 0.5 * tolerance;
+    const double middle = 0.5 * (c - b);
+    if (fabs(middle) <= tolerance_1 || fb == 0.0) return b;
+
+    if (fabs(e) >= tolerance_1 && fabs(fa) > fabs(fb)) {
+      // Inverse quadratic interpolation or secant method
+      double p, q;
+      const double s = fb / fa;
+      if (a == c) {
+        p = 2.0 * middle * s;
+        q = 1.0 - s;
+      } else {
+        const double r = fb / fc;
+        q = fa / fc;
+        p = s * (2.0 * middle * q * (q - r) - (b - a) * (r - 1.0));
+        q = (q - 1.0) * (r - 1.0) * (s - 1.0);
+      }
+      if (p > 0.0) q = -q;
+      p = fabs(p);
+      if (2.0 * p < fmin(3.0 * middle * q - fabs(tolerance_1 * q), fabs(e * q))) {
+        // Accept the interpolation
+        e = d;
+        d = p / q;
+      } else {
+        // Use the bisection since the interpolation failed
+        d = middle;
+        e = d;
+      }
+    } else {
+      // Use the bisection since the bounds are decreasing too slowly
+      d = middle;
+      e = d;
+    }
+    a = b;
+    fa = fb;
+    if (fabs(d) > tolerance_1) {
+      b += d;
+    } else {
+      b += (middle > 0.0) ? tolerance_1 : -tolerance_1;
+    }
+    fb = function(b);
+  }
+  return b;
+}
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_ROOT_FINDING_HPP_
@@ -0,0 +1,145 @@
+/**
+ * @file sparse_matrix.cpp
+ * @brief Sparse matrix class in the compressed sparse row (CSR) format and its iterative solver
+ */
+
+#include "sparse_matrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace libra {
+
+namespace {
+/**
+ * @fn CalcInnerProduct
+ * @brief Inner product of two vectors with the same size
+ */
+double CalcInnerProduct(const std::vector<double>& lhs, const std::vector<double>& rhs) {
+  double sum = 0.0;
+  for (size_t i = 0; i < lhs.size(); i++) {
+    sum += lhs[i] * rhs[i];
+  }
+  return sum;
+}
+}  // namespace
+
+SparseMatrix::SparseMatrix(const size_t row_length, const size_t column_length, std::vector<SparseMatrixElement> elements)
+    : row_length_(row_length), column_length_(column_length), row_offsets_(row_length + 1, 0) {
+  for (const auto& element : elements) {
+    if (element.row_ >= row_length_ || element.column_ >= column_length_) {
+      throw std::invalid_argument("Argument exceeds the range of matrix.");
+    }
+  }
+  std::sort(elements.begin(), elements.end(), [](const SparseMatrixElement& lhs, const SparseMatrixElement& rhs) {
+    return (lhs.row_ != rhs.row_) ? lhs.row_ < rhs.row_ : lhs.column_ < rhs.column_;
+  });
+
+  column_indices_.reserve(elements.size());
+  values_.reserve(elements.size());
+  for (size_t i = 0; i < elements.size(); i++) {
+    const bool is_same_position = !values_.empty() && elements[i].row_ == elements[i - 1].row_ && elements[i].column_ == elements[i - 1].column_;
+    if (is_same_position) {
+      values_.back() += elements[i].value_;
+      continue;
+    }
+    column_indices_.push_back(elements[i].column_);
+    values_.push_back(elements[i].value_);
+    row_offsets_[elements[i].row_ + 1]++;
+  }
+  for (size_t row = 0; row < row_length_; row++) {
+    row_offsets_[row + 1] += row_offsets_[row];
+  }
+}
+
+void SparseMatrix::Multiply(const std::vector<double>& x, std::vector<double>& y) const {
+  if (x.size() != column_length_) {
+    throw std::invalid_argument("Matrix and vector sizes do not match for the multiplication.");
+  }
+  y.resize(row_length_);
+  for (size_t row = 0; row < row_length_; row++) {
+    double sum = 0.0;
+    for (size_t k = row_offsets_[row]; k < row_offsets_[row + 1]; k++) {
+      sum += values_[k] * x[column_indices_[k]];
+    }
+    y[row] = sum;
+  }
+}
+
+double SparseMatrix::GetValue(const size_t row, const size_t column) const {
+  if (row >= row_length_ || column >= column_length_) {
+    throw std::invalid_argument("Argument exceeds the range of matrix.");
+  }
+  const auto begin = column_indices_.begin() + row_offsets_[row];
+  const auto end = column_indices_.begin() + row_offsets_[row + 1];
+  const auto itr = std::lower_bound(begin, end, column);
+  if (itr == end || *itr != column) return 0.0;
+  return values_[itr - column_indices_.begin()];
+}
+
+IterativeSolverResult SolveWithConjugateGradient(const SparseMatrix& matrix, const std::vector<double>& b, std::vector<double>& x,
+                                                 const double tolerance, const size_t max_iterations) {
+  const size_t n = matrix.GetRowLength();
+  if (n != matrix.GetColumnLength() || b.size() != n) {
+    throw std::invalid_argument("Conjugate gradient method needs a square matrix and the vector with the same size.");
+  }
+  if (x.size() != n) x.assign(n, 0.0);
+
+  std::vector<double> inverse_diagonal(n);
+  for (size_t i = 0; i < n; i++) {
+    const double diagonal = matrix.GetValue(i, i);
+    if (diagonal <= 0.0) {
+      throw std::invalid_argument("Conjugate gradient method needs positive diagonal elements.");
+    }
+    inverse_diagonal[i] = 1.0 / diagonal;
+  }
+
+  IterativeSolverResult result;
+  result.is_converged_ = false;
+  result.number_of_iterations_ = 0;
+  result.relative_residual_ = 0.0;
+
+  const double b_norm = sqrt(CalcInnerProduct(b, b));
+  if (b_norm == 0.0) {
+    x.assign(n, 0.0);
+    result.is_converged_ = true;
+    return result;
+  }
+
+  // r = b - A x, z = M^-1 r, p = z
+  std::vector<double> r, z(n), p(n), ap(n);
+  matrix.Multiply(x, r);
+  for (size_t i = 0; i < n; i++) {
+    r[i] = b[i] - r[i];
+    z[i] = inverse_diagonal[i] * r[i];
+  }
+  p = z;
+  double rz = CalcInnerProduct(r, z);
+
+  const size_t iteration_limit = (max_iterations == 0) ? n : max_iterations;
+  result.relative_residual_ = sqrt(CalcInnerProduct(r, r)) / b_norm;
+  while (result.relative_residual_ > tolerance && result.number_of_iterations_ < iteration_limit) {
+    matrix.Multiply(p, ap);
+    const double p_ap = CalcInnerProduct(p, ap);
+    if (p_ap <= 0.0) break;  // The matrix is not positive definite
+    const double alpha = rz / p_ap;
+    for (size_t i = 0; i < n; i++) {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * ap[i];
+      z[i] = inverse_diagonal[i] * r[i];
+    }
+    const double new_rz = CalcInnerProduct(r, z);
+    const double beta = new_rz / rz;
+    rz = new_rz;
+    for (size_t i = 0; i < n; i++) {
+      p[i] = z[i] + beta * p[i];
+    }
+    result.number_of_iterations_++;
+    result.relative_residual_ = sqrt(CalcInnerProduct(r, r)) / b_norm;
+  }
+  result.is_converged_ = result.relative_residual_ <= tolerance;
+  return result;
+}
+
+}  // namespace libra
@@ -0,0 +1,116 @@
+/**
+ * @file sparse_matrix.hpp
+ * @brief Sparse matrix class in the compressed sparse row (CSR) format and its iterative solver
+ */
+
+#ifndef S2E_LIBRARY_MATH_SPARSE_MATRIX_HPP_
+#define S2E_LIBRARY_MATH_SPARSE_MATRIX_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @struct SparseMatrixElement
+ * @brief Non-zero element of the sparse matrix used for the construction
+ */
+struct SparseMatrixElement {
+  size_t row_;     //!< Row number
+  size_t column_;  //!< Column number
+  double value_;   //!< Value
+};
+
+/**
+ * @class SparseMatrix
+ * @brief Sparse matrix class in the compressed sparse row (CSR) format
+ * @details The column numbers and the values of the non-zero elements are stored in the row order in contiguous arrays, and the offset of
+ *          each row in the arrays is stored in another array.
+ */
+class SparseMatrix {
+ public:
+  /**
+   * @fn SparseMatrix
+   * @brief Default constructor. The matrix is empty.
+   */
+  SparseMatrix() : row_length_(0), column_length_(0), row_offsets_(1, 0) {}
+  /**
+   * @fn SparseMatrix
+   * @brief Constructor
+   * @note The values of the elements at the same position are summed up. std::invalid_argument is thrown when an element is out of range.
+   * @param [in] row_length: Number of rows
+   * @param [in] column_length: Number of columns
+   * @param [in] elements: Non-zero elements in any order
+   */
+  SparseMatrix(const size_t row_length, const size_t column_length, std::vector<SparseMatrixElement> elements);
+
+  /**
+   * @fn Multiply
+   * @brief Calculate y = A x
+   * @param [in] x: Target vector
+   * @param [out] y: Result vector. The buffer is reused when the size matches.
+   */
+  void Multiply(const std::vector<double>& x, std::vector<double>& y) const;
+
+  /**
+   * @fn GetValue
+   * @brief Return the element value
+   * @param [in] row: Target row number
+   * @param [in] column: Target column number
+   * @return Value of the element. Zero when the element is not stored.
+   */
+  double GetValue(const size_t row, const size_t column) const;
+
+  // Getters
+  /**
+   * @fn GetRowLength
+   * @brief Return row number
+   */
+  inline size_t GetRowLength() const { return row_length_; }
+  /**
+   * @fn GetColumnLength
+   * @brief Return column number
+   */
+  inline size_t GetColumnLength() const { return column_length_; }
+  /**
+   * @fn GetNumberOfNonZeros
+   * @brief Return number of the stored elements
+   */
+  inline size_t GetNumberOfNonZeros() const { return values_.size(); }
+
+ private:
+  size_t row_length_;                   //!< Number of rows
+  size_t column_length_;                //!< Number of columns
+  std::vector<size_t> row_offsets_;     //!< Offset of the first element of each row in the element arrays (size: row_length_ + 1)
+  std::vector<size_t> column_indices_;  //!< Column number of each element
+  std::vector<double> values_;          //!< Value of each element
+};
+
+/**
+ * @struct IterativeSolverResult
+ * @brief Result of the iterative linear system solver
+ */
+struct IterativeSolverResult {
+  bool is_converged_;            //!< True when the residual is smaller than the tolerance
+  size_t number_of_iterations_;  //!< Number of iterations
+  double relative_residual_;     //!< |b - A x| / |b| at the end
+};
+
+/**
+ * @fn SolveWithConjugateGradient
+ * @brief Solve the linear system A x = b with the conjugate gradient method with the Jacobi (diagonal) preconditioner
+ * @note The matrix should be symmetric positive definite (e.g., the conductance matrix of the thermal network or the normal matrix of the
+ *       least squares). std::invalid_argument is thrown when the sizes do not match or a diagonal element is not positive.
+ * @param [in] matrix: Coefficient matrix A
+ * @param [in] b: Right hand side vector
+ * @param [in/out] x: Initial guess and the solution. The zero vector is used as the initial guess when the size does not match.
+ * @param [in] tolerance: Tolerance of the relative residual
+ * @param [in] max_iterations: Maximum number of iterations. The matrix size is used when zero is set.
+ * @return Result of the solver
+ */
+IterativeSolverResult SolveWithConjugateGradient(const SparseMatrix& matrix, const std::vector<double>& b, std::vector<double>& x,
+                                                 const double tolerance = 1.0e-10, const size_t max_iterations = 0);
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_SPARSE_MATRIX_HPP_
@@ -0,0 +1,49 @@
+/**
+ * @file test_chebyshev_series.cpp
+ * @brief Test codes for ChebyshevSeries class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "chebyshev_series.hpp"
+
+/**
+ * @brief Test for a polynomial which is represented exactly by the series
+ */
+TEST(ChebyshevSeries, CubicFunction) {
+  const double start = -3.0;
+  const double end = 5.0;
+  std::vector<double> nodes = libra::ChebyshevSeries::CalcNodes(start, end, 3);
+  EXPECT_EQ(4, nodes.size());
+  std::vector<double> values;
+  for (double x : nodes) values.push_back(x * x * x - 2.0 * x + 1.0);
+  libra::ChebyshevSeries series = libra::ChebyshevSeries::Fit(start, end, values);
+
+  EXPECT_EQ(3, series.GetDegree());
+  for (double x = start; x <= end; x += 0.5) {
+    EXPECT_NEAR(x * x * x - 2.0 * x + 1.0, series.Calc(x), 1e-12);
+    EXPECT_NEAR(3.0 * x * x - 2.0, series.CalcDerivative(x), 1e-12);
+  }
+}
+
+/**
+ * @brief Test for a trigonometric function over a large offset interval like ephemeris time
+ */
+TEST(ChebyshevSeries, SineFunction) {
+  const double start = 7.0e8;
+  const double end = start + 86400.0;
+  const double omega = 2.0 * 3.141592653589793 / (27.3 * 86400.0);
+  std::vector<double> nodes = libra::ChebyshevSeries::CalcNodes(start, end, 12);
+  std::vector<double> values;
+  for (double x : nodes) values.push_back(4.0e8 * sin(omega * (x - start)));
+  libra::ChebyshevSeries series = libra::ChebyshevSeries::Fit(start, end, values);
+
+  EXPECT_TRUE(series.IsInRange(start));
+  EXPECT_TRUE(series.IsInRange(end));
+  EXPECT_FALSE(series.IsInRange(end + 1.0));
+  for (double x = start; x <= end; x += 600.0) {
+    EXPECT_NEAR(4.0e8 * sin(omega * (x - start)), series.Calc(x), 1e-4);
+    EXPECT_NEAR(4.0e8 * omega * cos(omega * (x - start)), series.CalcDerivative(x), 1e-6);
+  }
+}
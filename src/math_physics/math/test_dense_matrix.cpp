@@ -0,0 +1,142 @@
+/**
+ * @file test_dense_matrix.cpp
+ * @brief Test codes for DenseMatrix class and its decompositions with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#include "dense_matrix.hpp"
+
+namespace {
+/**
+ * @fn MakeTestMatrix
+ * @brief Make a diagonally dominant matrix deterministically. The size is larger than the block size of the calculations.
+ */
+libra::DenseMatrix MakeTestMatrix(const size_t n, const bool is_symmetric) {
+  libra::DenseMatrix matrix(n, n);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      matrix[i][j] = sin((double)(i * 7 + j * 13 + 1));
+      if (is_symmetric && j < i) matrix[i][j] = matrix[j][i];
+    }
+    matrix[i][i] += (double)n;
+  }
+  return matrix;
+}
+}  // namespace
+
+/**
+ * @brief Test for constructor and access
+ */
+TEST(DenseMatrix, Constructor) {
+  libra::DenseMatrix m(2, 3, 1.5);
+
+  EXPECT_EQ(2, m.GetRowLength());
+  EXPECT_EQ(3, m.GetColumnLength());
+  EXPECT_DOUBLE_EQ(1.5, m[1][2]);
+  m(1, 2) = 4.0;
+  EXPECT_DOUBLE_EQ(4.0, m[1][2]);
+  EXPECT_THROW(m(2, 0), std::invalid_argument);
+}
+
+/**
+ * @brief Test for multiplication and transpose
+ */
+TEST(DenseMatrix, Multiply) {
+  const size_t n = 150;
+  libra::DenseMatrix a = MakeTestMatrix(n, false);
+  libra::DenseMatrix a_t = a.Transpose();
+  libra::DenseMatrix product = a * a_t;
+
+  for (size_t i = 0; i < n; i += 37) {
+    for (size_t j = 0; j < n; j += 23) {
+      double expected = 0.0;
+      for (size_t k = 0; k < n; k++) {
+        expected += a[i][k] * a[j][k];
+      }
+      EXPECT_NEAR(expected, product[i][j], 1.0e-9);
+    }
+  }
+
+  std::vector<double> v(n, 1.0);
+  std::vector<double> av = a * v;
+  double expected = 0.0;
+  for (size_t k = 0; k < n; k++) expected += a[5][k];
+  EXPECT_NEAR(expected, av[5], 1.0e-12);
+}
+
+/**
+ * @brief Test for LU decomposition
+ */
+TEST(DenseMatrix, LuDecomposition) {
+  const size_t n = 150;
+  libra::DenseMatrix a = MakeTestMatrix(n, false);
+  std::vector<double> x_true(n);
+  for (size_t i = 0; i < n; i++) x_true[i] = cos((double)i);
+  const std::vector<double> b = a * x_true;
+
+  libra::DenseLuDecomposition lu(a);
+  std::vector<double> x = lu.Solve(b);
+  for (size_t i = 0; i < n; i++) {
+    EXPECT_NEAR(x_true[i], x[i], 1.0e-12);
+  }
+  std::vector<double> b_x = b;
+  lu.SolveInPlace(b_x);
+  for (size_t i = 0; i < n; i++) {
+    EXPECT_DOUBLE_EQ(x[i], b_x[i]);
+  }
+
+  // Pivoting is needed for this matrix
+  libra::DenseMatrix b_matrix(2, 2);
+  b_matrix[0][0] = 0.0;
+  b_matrix[0][1] = 1.0;
+  b_matrix[1][0] = 2.0;
+  b_matrix[1][1] = 3.0;
+  std::vector<double> solution = libra::DenseLuDecomposition(b_matrix).Solve({1.0, 8.0});
+  EXPECT_DOUBLE_EQ(2.5, solution[0]);
+  EXPECT_DOUBLE_EQ(1.0, solution[1]);
+}
+
+/**
+ * @brief Test for LU decomposition of the singular matrix
+ */
+TEST(DenseMatrix, LuDecompositionSingular) {
+  libra::DenseMatrix a(3, 3, 1.0);
+  EXPECT_THROW(libra::DenseLuDecomposition lu(a), std::invalid_argument);
+  libra::DenseMatrix b(2, 3, 1.0);
+  EXPECT_THROW(libra::DenseLuDecomposition lu(b), std::invalid_argument);
+}
+
+/**
+ * @brief Test for Cholesky decomposition
+ */
+TEST(DenseMatrix, CholeskyDecomposition) {
+  const size_t n = 150;
+  libra::DenseMatrix a = MakeTestMatrix(n, true);
+  std::vector<double> x_true(n);
+  for (size_t i = 0; i < n; i++) x_true[i] = cos((double)i);
+  const std::vector<double> b = a * x_true;
+
+  libra::DenseCholeskyDecomposition cholesky(a);
+  std::vector<double> x = cholesky.Solve(b);
+  for (size_t i = 0; i < n; i++) {
+    EXPECT_NEAR(x_true[i], x[i], 1.0e-12);
+  }
+
+  // L L^T = A
+  const libra::DenseMatrix& l = cholesky.GetLowerMatrix();
+  libra::DenseMatrix llt = l * l.Transpose();
+  for (size_t i = 0; i < n; i += 17) {
+    for (size_t j = 0; j < n; j += 19) {
+      EXPECT_NEAR(a[i][j], llt[i][j], 1.0e-10);
+    }
+  }
+  EXPECT_DOUBLE_EQ(0.0, l[0][n - 1]);
+
+  libra::DenseMatrix negative(2, 2, 0.0);
+  negative[0][0] = 1.0;
+  negative[1][1] = -1.0;
+  EXPECT_THROW(libra::DenseCholeskyDecomposition c(negative), std::invalid_argument);
+}
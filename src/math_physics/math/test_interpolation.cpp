@@ -41,6 +41,28 @@ TEST(Interpolation, PolynomialQuadraticFunction) {
   EXPECT_DOUBLE_EQ(pow(xx, 2.0), interpolation.CalcPolynomial(xx));
 }
 
+/**
+ * @brief Test for derivative of cubic function with polynomial interpolation
+ */
+TEST(Interpolation, PolynomialDerivativeCubicFunction) {
+  std::vector<double> x{0.0, 1.0, 2.0, 3.0, 4.0};
+  std::vector<double> y;
+  for (size_t i = 0; i < x.size(); i++) {
+    y.push_back(pow(x[i], 3.0) - 2.0 * x[i]);
+  }
+  libra::Interpolation interpolation(x, y);
+
+  double xx = 0.4;
+  EXPECT_NEAR(3.0 * pow(xx, 2.0) - 2.0, interpolation.CalcPolynomialDerivative(xx), 1e-12);
+  xx = 2.6;
+  EXPECT_NEAR(3.0 * pow(xx, 2.0) - 2.0, interpolation.CalcPolynomialDerivative(xx), 1e-12);
+  // On the nodes
+  xx = 0.0;
+  EXPECT_NEAR(3.0 * pow(xx, 2.0) - 2.0, interpolation.CalcPolynomialDerivative(xx), 1e-12);
+  xx = 3.0;
+  EXPECT_NEAR(3.0 * pow(xx, 2.0) - 2.0, interpolation.CalcPolynomialDerivative(xx), 1e-12);
+}
+
 /**
  * @brief Test for sin function with trigonometric interpolation
  */
@@ -117,3 +139,66 @@ TEST(Interpolation, PushAndPop) {
   ret = interpolation.PushAndPopData(1.0, 10.0);
   EXPECT_FALSE(ret);
 }
+
+/**
+ * @brief Test for interpolation after PushAndPop function
+ */
+TEST(Interpolation, InterpolationAfterPushAndPop) {
+  std::vector<double> x{0.0, 0.3 * libra::pi_2, 0.6 * libra::pi_2, 0.9 * libra::pi_2, 1.2 * libra::pi_2};
+  std::vector<double> y;
+  for (size_t i = 0; i < x.size(); i++) {
+    y.push_back(cos(x[i]));
+  }
+  libra::Interpolation interpolation(x, y);
+
+  double xx = 0.8 * libra::pi_2;
+  EXPECT_NEAR(cos(xx), interpolation.CalcTrigonometric(xx), 1e-6);
+  EXPECT_NEAR(cos(xx), interpolation.CalcPolynomial(xx), 1e-3);
+
+  // The weights are updated with the new data
+  for (size_t i = 0; i < 3; i++) {
+    const double new_x = (1.5 + 0.3 * i) * libra::pi_2;
+    interpolation.PushAndPopData(new_x, cos(new_x));
+  }
+  xx = 1.7 * libra::pi_2;
+  libra::Interpolation new_interpolation(interpolation.GetIndependentVariables(), interpolation.GetDependentVariables());
+  EXPECT_NEAR(cos(xx), interpolation.CalcTrigonometric(xx), 1e-6);
+  EXPECT_DOUBLE_EQ(new_interpolation.CalcTrigonometric(xx), interpolation.CalcTrigonometric(xx));
+  EXPECT_DOUBLE_EQ(new_interpolation.CalcPolynomial(xx), interpolation.CalcPolynomial(xx));
+
+  // Value at the node
+  xx = 1.5 * libra::pi_2;
+  EXPECT_DOUBLE_EQ(cos(xx), interpolation.CalcTrigonometric(xx));
+  EXPECT_DOUBLE_EQ(cos(xx), interpolation.CalcPolynomial(xx));
+}
+
+/**
+ * @brief Test for the weights of the trigonometric interpolation computed for the set period
+ */
+TEST(Interpolation, TrigonometricPeriod) {
+  const double period = 0.7;
+  std::vector<double> x{0.0, 0.5, 1.0, 1.5, 2.0, 2.5};
+  std::vector<double> y;
+  for (size_t i = 0; i < x.size(); i++) {
+    y.push_back(cos(period * x[i]) + sin(period * x[i]));
+  }
+  libra::Interpolation interpolation(x, y);
+  libra::Interpolation period_interpolation(x, y);
+  period_interpolation.SetTrigonometricPeriod(period);
+
+  // Same results with the weights for the set period and with the weights calculated in each call (even degree uses both node sets)
+  const double xx_list[3] = {0.3, 1.2, 2.2};
+  for (const double xx : xx_list) {
+    EXPECT_DOUBLE_EQ(interpolation.CalcTrigonometric(xx, period), period_interpolation.CalcTrigonometric(xx, period));
+    EXPECT_DOUBLE_EQ(interpolation.CalcTrigonometric(xx, 1.0), period_interpolation.CalcTrigonometric(xx, 1.0));
+  }
+
+  // The weights follow the new data
+  for (size_t i = 0; i < 2; i++) {
+    const double new_x = 3.0 + 0.5 * i;
+    interpolation.PushAndPopData(new_x, cos(period * new_x) + sin(period * new_x));
+    period_interpolation.PushAndPopData(new_x, cos(period * new_x) + sin(period * new_x));
+  }
+  EXPECT_DOUBLE_EQ(interpolation.CalcTrigonometric(2.7, period), period_interpolation.CalcTrigonometric(2.7, period));
+  EXPECT_NEAR(cos(period * 2.7) + sin(period * 2.7), period_interpolation.CalcTrigonometric(2.7, period), 1e-6);
+}
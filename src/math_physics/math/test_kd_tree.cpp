@@ -0,0 +1,74 @@
+/**
+ * @file test_kd_tree.cpp
+ * @brief Test codes for KdTree class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "kd_tree.hpp"
+
+namespace {
+/**
+ * @brief Generate points on a deterministic pseudo-random sequence
+ */
+std::vector<libra::Vector<3>> GeneratePoints(const size_t number_of_points) {
+  std::vector<libra::Vector<3>> points;
+  unsigned int seed = 12345;
+  for (size_t n = 0; n < number_of_points; n++) {
+    libra::Vector<3> point;
+    for (size_t i = 0; i < 3; i++) {
+      seed = seed * 1103515245 + 12345;
+      point[i] = (double)((seed >> 8) % 20001) - 10000.0;
+    }
+    points.push_back(point);
+  }
+  return points;
+}
+}  // namespace
+
+/**
+ * @brief Test for range search compared with brute force search
+ */
+TEST(KdTree, FindInRange) {
+  std::vector<libra::Vector<3>> points = GeneratePoints(500);
+  libra::KdTree tree;
+  tree.Build(points);
+  EXPECT_EQ(500, tree.GetNumberOfPoints());
+
+  const double radius = 3000.0;
+  for (size_t query = 0; query < 20; query++) {
+    const libra::Vector<3> center = points[query];
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < points.size(); i++) {
+      if ((points[i] - center).CalcNorm() <= radius) expected.push_back(i);
+    }
+    EXPECT_EQ(expected, tree.FindInRange(center, radius));
+  }
+}
+
+/**
+ * @brief Test for nearest neighbor search compared with brute force search
+ */
+TEST(KdTree, FindNearest) {
+  std::vector<libra::Vector<3>> points = GeneratePoints(500);
+  libra::KdTree tree;
+  tree.Build(points);
+
+  for (size_t query = 0; query < 20; query++) {
+    double nearest_distance = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < points.size(); i++) {
+      if (i == query) continue;
+      const double distance = (points[i] - points[query]).CalcNorm();
+      if (distance < nearest_distance) nearest_distance = distance;
+    }
+    size_t index;
+    EXPECT_TRUE(tree.FindNearest(points[query], index, query));
+    EXPECT_NE(query, index);
+    EXPECT_DOUBLE_EQ(nearest_distance, (points[index] - points[query]).CalcNorm());
+  }
+
+  libra::KdTree empty_tree;
+  size_t index;
+  EXPECT_FALSE(empty_tree.FindNearest(points[0], index));
+}
@@ -312,6 +312,34 @@ TEST(Matrix, OperatorMultiplyMatrix) {
   EXPECT_DOUBLE_EQ(64.0, result[1][1]);
 }
 
+/**
+ * @brief Test for operator* 3x3 Matrix
+ */
+TEST(Matrix, OperatorMultiplyMatrix3x3) {
+  const size_t N = 3;
+
+  libra::Matrix<N, N> a;
+  libra::Matrix<N, N> b;
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) {
+      a[i][j] = (double)(i * N + j + 1);
+      b[i][j] = (double)(i * N + j) - 4.0;
+    }
+  }
+
+  libra::Matrix<N, N> result = a * b;
+
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) {
+      double expected = 0.0;
+      for (size_t k = 0; k < N; k++) {
+        expected += a[i][k] * b[k][j];
+      }
+      EXPECT_DOUBLE_EQ(expected, result[i][j]);
+    }
+  }
+}
+
 /**
  * @brief Test for Transpose
  */
@@ -416,3 +444,29 @@ TEST(Matrix, MakeRotationMatrixZ) {
   EXPECT_DOUBLE_EQ(0.0, m[2][1]);
   EXPECT_DOUBLE_EQ(1.0, m[2][2]);
 }
+
+/**
+ * @brief Test for the calculation in the constant expression
+ */
+TEST(Matrix, ConstantExpression) {
+  constexpr libra::Matrix<2, 3> a = [] {
+    libra::Matrix<2, 3> m;
+    for (size_t i = 0; i < 2; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        m[i][j] = (double)(i * 3 + j + 1);
+      }
+    }
+    return m;
+  }();
+  constexpr libra::Matrix<3, 3> identity = libra::MakeIdentityMatrix<3>();
+
+  constexpr libra::Matrix<3, 2> transposed = a.Transpose();
+  constexpr libra::Matrix<2, 2> product = a * transposed;
+  constexpr libra::Matrix<2, 3> same = a * identity;
+  static_assert(transposed[2][1] == 6.0, "transpose");
+  static_assert(product[0][0] == 14.0 && product[0][1] == 32.0 && product[1][1] == 77.0, "product");
+  static_assert(same[1][2] == 6.0, "identity");
+  static_assert(identity.CalcTrace() == 3.0, "trace");
+
+  EXPECT_DOUBLE_EQ(32.0, product[1][0]);
+}
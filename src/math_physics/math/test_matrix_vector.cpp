@@ -34,6 +34,36 @@ TEST(MatrixVector, MultiplyMatrixVector) {
   EXPECT_DOUBLE_EQ(22.0, result[2]);
 }
 
+/**
+ * @brief Test for 3x3 Matrix * 3D Vector
+ */
+TEST(MatrixVector, MultiplyMatrixVector3x3) {
+  const size_t N = 3;
+
+  libra::Matrix<N, N> m;
+  libra::Vector<N> v;
+
+  m[0][0] = 1.0;
+  m[0][1] = 2.0;
+  m[0][2] = 3.0;
+  m[1][0] = -1.0;
+  m[1][1] = 0.0;
+  m[1][2] = 4.0;
+  m[2][0] = 3.0;
+  m[2][1] = 1.0;
+  m[2][2] = -2.0;
+
+  v[0] = 7.0;
+  v[1] = 1.0;
+  v[2] = -3.0;
+
+  libra::Vector<N> result = m * v;
+
+  EXPECT_DOUBLE_EQ(0.0, result[0]);
+  EXPECT_DOUBLE_EQ(-19.0, result[1]);
+  EXPECT_DOUBLE_EQ(28.0, result[2]);
+}
+
 /**
  * @brief Test for CalcInverseMatrix
  */
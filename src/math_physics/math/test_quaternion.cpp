@@ -457,3 +457,29 @@ TEST(Quaternion, OperatorScalarMultiply) {
   EXPECT_NEAR(q[2] * 2.3, result[2], accuracy);
   EXPECT_NEAR(q[3] * 2.3, result[3], accuracy);
 }
+
+/**
+ * @brief Test for the calculation in the constant expression
+ */
+TEST(Quaternion, ConstantExpression) {
+  // 90 deg rotation around the Z-axis
+  constexpr double half_sqrt2 = 0.70710678118654752440;
+  constexpr libra::Quaternion q(0.0, 0.0, half_sqrt2, half_sqrt2);
+  constexpr libra::Vector<3> v = [] {
+    libra::Vector<3> x;
+    x[0] = 1.0;
+    return x;
+  }();
+
+  constexpr libra::Vector<3> v_frame_conv = q.FrameConversion(v);
+  constexpr libra::Matrix<3, 3> dcm = q.ConvertToDcm();
+  constexpr libra::Quaternion q_identity = q * q.Conjugate();
+  static_assert(v_frame_conv[1] < -1.0 + 1.0e-15, "frame conversion");
+  static_assert(dcm[1][0] < -1.0 + 1.0e-15, "dcm");
+  static_assert(q_identity[3] > 1.0 - 1.0e-15, "conjugate");
+
+  const double accuracy = 1.0e-7;
+  EXPECT_NEAR(0.0, v_frame_conv[0], accuracy);
+  EXPECT_NEAR(-1.0, v_frame_conv[1], accuracy);
+  EXPECT_NEAR(0.0, v_frame_conv[2], accuracy);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file test_root_finding.cpp
+ * @brief Test codes for root finding functions with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "constants.hpp"
+#include "interpolation.hpp"
+#include "root_finding.hpp"
+
+/**
+ * @brief Test for cubic function with Brent's method
+ */
+TEST(RootFinding, BrentMethodCubicFunction) {
+  size_t number_of_calls = 0;
+  auto function = [&](const double x) {
+    number_of_calls++;
+    return x * x * x - 2.0 * x - 5.0;
+  };
+  const double root = libra::CalcRootWithBrentMethod(function, 2.0, 3.0, 1.0e-12);
+
+  EXPECT_NEAR(2.0945514815423265, root, 1.0e-12);
+  // Brent's method converges much faster than the bisection (40 iterations for 1e-12)
+  EXPECT_GT(20, number_of_calls);
+}
+
+/**
+ * @brief Test for the root at the bound and the decreasing function with Brent's method
+ */
+TEST(RootFinding, BrentMethodBoundAndDecreasingFunction) {
+  auto function = [](const double x) { return cos(x); };
+
+  EXPECT_DOUBLE_EQ(0.0, libra::CalcRootWithBrentMethod([](const double x) { return x; }, 0.0, 1.0));
+  EXPECT_NEAR(libra::pi_2, libra::CalcRootWithBrentMethod(function, 0.0, 3.0, 1.0e-12), 1.0e-12);
+}
+
+/**
+ * @brief Test for the invalid bracket with Brent's method
+ */
+TEST(RootFinding, BrentMethodInvalidBracket) {
+  auto function = [](const double x) { return x * x + 1.0; };
+
+  EXPECT_DOUBLE_EQ(0.5, libra::CalcRootWithBrentMethod(function, 0.5, 2.0));
+}
+
+/**
+ * @brief Test for the root of the polynomial interpolation with Brent's method
+ */
+TEST(RootFinding, BrentMethodPolynomialInterpolation) {
+  std::vector<double> x{0.0, 1.0, 2.0, 3.0};
+  std::vector<double> y;
+  for (size_t i = 0; i < x.size(); i++) {
+    y.push_back(sin(0.2 * x[i] - 0.48));
+  }
+  libra::Interpolation interpolation(x, y);
+
+  const double root = libra::CalcRootWithBrentMethod([&](const double xx) { return interpolation.CalcPolynomial(xx); }, 2.0, 3.0, 1.0e-9);
+  EXPECT_NEAR(2.4, root, 1.0e-4);
+}
@@ -0,0 +1,89 @@
+/**
+ * @file test_sparse_matrix.cpp
+ * @brief Test codes for SparseMatrix class and its iterative solver with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#include "sparse_matrix.hpp"
+
+namespace {
+/**
+ * @fn MakeLaplacianMatrix
+ * @brief Make the matrix of the one-dimensional heat conduction with the fixed boundary
+ */
+libra::SparseMatrix MakeLaplacianMatrix(const size_t n) {
+  std::vector<libra::SparseMatrixElement> elements;
+  for (size_t i = 0; i < n; i++) {
+    elements.push_back({i, i, 2.0 + 0.01 * (double)i});
+    if (i > 0) elements.push_back({i, i - 1, -1.0});
+    if (i + 1 < n) elements.push_back({i, i + 1, -1.0});
+  }
+  return libra::SparseMatrix(n, n, elements);
+}
+}  // namespace
+
+/**
+ * @brief Test for constructor
+ */
+TEST(SparseMatrix, Constructor) {
+  // Elements in random order with the duplicated position
+  std::vector<libra::SparseMatrixElement> elements = {{1, 2, 3.0}, {0, 0, 1.0}, {1, 0, 2.0}, {1, 2, 0.5}, {2, 1, -1.0}};
+  libra::SparseMatrix m(3, 3, elements);
+
+  EXPECT_EQ(3, m.GetRowLength());
+  EXPECT_EQ(3, m.GetColumnLength());
+  EXPECT_EQ(4, m.GetNumberOfNonZeros());
+  EXPECT_DOUBLE_EQ(1.0, m.GetValue(0, 0));
+  EXPECT_DOUBLE_EQ(2.0, m.GetValue(1, 0));
+  EXPECT_DOUBLE_EQ(3.5, m.GetValue(1, 2));
+  EXPECT_DOUBLE_EQ(-1.0, m.GetValue(2, 1));
+  EXPECT_DOUBLE_EQ(0.0, m.GetValue(2, 2));
+
+  std::vector<libra::SparseMatrixElement> out_of_range = {{3, 0, 1.0}};
+  EXPECT_THROW(libra::SparseMatrix(3, 3, out_of_range), std::invalid_argument);
+}
+
+/**
+ * @brief Test for multiplication
+ */
+TEST(SparseMatrix, Multiply) {
+  std::vector<libra::SparseMatrixElement> elements = {{0, 0, 1.0}, {0, 2, 2.0}, {1, 1, -3.0}};
+  libra::SparseMatrix m(2, 3, elements);
+
+  std::vector<double> y;
+  m.Multiply({1.0, 2.0, 3.0}, y);
+  ASSERT_EQ(2, y.size());
+  EXPECT_DOUBLE_EQ(7.0, y[0]);
+  EXPECT_DOUBLE_EQ(-6.0, y[1]);
+  EXPECT_THROW(m.Multiply({1.0, 2.0}, y), std::invalid_argument);
+}
+
+/**
+ * @brief Test for conjugate gradient method
+ */
+TEST(SparseMatrix, ConjugateGradient) {
+  const size_t n = 500;
+  libra::SparseMatrix a = MakeLaplacianMatrix(n);
+  std::vector<double> x_true(n);
+  for (size_t i = 0; i < n; i++) x_true[i] = sin(0.01 * (double)i);
+  std::vector<double> b;
+  a.Multiply(x_true, b);
+
+  std::vector<double> x;
+  libra::IterativeSolverResult result = libra::SolveWithConjugateGradient(a, b, x, 1.0e-12);
+
+  EXPECT_TRUE(result.is_converged_);
+  EXPECT_LT(result.relative_residual_, 1.0e-12);
+  EXPECT_LE(result.number_of_iterations_, n);
+  for (size_t i = 0; i < n; i++) {
+    EXPECT_NEAR(x_true[i], x[i], 1.0e-9);
+  }
+
+  // Restart from the solution
+  result = libra::SolveWithConjugateGradient(a, b, x, 1.0e-12);
+  EXPECT_TRUE(result.is_converged_);
+  EXPECT_EQ(0, result.number_of_iterations_);
+}
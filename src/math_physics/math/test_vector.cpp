@@ -447,3 +447,30 @@ TEST(Vector, GenerateOrthogonalUnitVector) {
 
   EXPECT_DOUBLE_EQ(90.0 * libra::deg_to_rad, angle_rad);
 }
+
+/**
+ * @brief Test for the calculation in the constant expression
+ */
+TEST(Vector, ConstantExpression) {
+  constexpr libra::Vector<3> a = [] {
+    libra::Vector<3> v;
+    v[0] = 1.0;
+    v[1] = 2.0;
+    v[2] = 3.0;
+    return v;
+  }();
+  constexpr libra::Vector<3> b(2.0);
+
+  constexpr libra::Vector<3> sum = a + b;
+  constexpr libra::Vector<3> scaled = 0.5 * a - b;
+  constexpr double inner = libra::InnerProduct(a, b);
+  constexpr libra::Vector<3> outer = libra::OuterProduct(a, b);
+  static_assert(sum[2] == 5.0, "sum");
+  static_assert(scaled[1] == -1.0, "scaled");
+  static_assert(inner == 12.0, "inner product");
+  static_assert(outer[0] == -2.0 && outer[1] == 4.0 && outer[2] == -2.0, "outer product");
+
+  EXPECT_DOUBLE_EQ(3.0, sum[0]);
+  EXPECT_DOUBLE_EQ(-1.5, scaled[0]);
+  EXPECT_DOUBLE_EQ(12.0, inner);
+}
@@ -22,28 +22,28 @@ class Vector {
  public:
   /**
    * @fn Vector
-   * @brief Constructor without any initialization
+   * @brief Constructor with the zero initialization
    */
-  inline Vector() {}
+  inline constexpr Vector() : vector_() {}
   /**
    * @fn Vector
    * @brief Constructor with initialize the elements as all same value
    * @param [in] n: The value for initializing
    */
-  explicit Vector(const T& n);
+  explicit constexpr Vector(const T& n);
 
   /**
    * @fn GetLength
    * @brief Return number of elements
    */
-  inline size_t GetLength() const { return N; }
+  inline constexpr size_t GetLength() const { return N; }
 
   /**
    * @fn FillUp
    * @brief Fill up all elements with same value
    * @param [in] n: Scalar value to fill up
    */
-  void FillUp(const T& n);
+  constexpr void FillUp(const T& n);
 
   /**
    * @fn Print
@@ -74,14 +74,14 @@ class Vector {
    * @brief Operator to access the elements similar with the 1D-array using `[]`
    * @return Pointer to the data storing array
    */
-  inline operator T*() { return vector_; }
+  inline constexpr operator T*() { return vector_; }
 
   /**
    * @fn Cast operator to directly access the elements (const ver.)
    * @brief Operator to access the elements similar with the 1D-array using `[]`
    * @return Pointer to the data storing array
    */
-  inline operator const T*() const { return vector_; }
+  inline constexpr operator const T*() const { return vector_; }
 
   /**
    * @fn Operator ()
@@ -90,7 +90,7 @@ class Vector {
    * @param [in] position: Target element number
    * @return Value of the target element
    */
-  inline T& operator()(std::size_t position) {
+  inline constexpr T& operator()(std::size_t position) {
     if (N <= position) {
       throw std::invalid_argument("Argument exceeds Vector's dimension.");
     }
@@ -104,7 +104,7 @@ class Vector {
    * @param [in] position: Target element number
    * @return Value of the target element
    */
-  inline T operator()(std::size_t position) const {
+  inline constexpr T operator()(std::size_t position) const {
     if (N <= position) {
       throw std::invalid_argument("Argument exceeds Vector's dimension.");
     }
@@ -118,7 +118,7 @@ class Vector {
    * @param [in] v: Adding vector
    * @return Result of added vector
    */
-  Vector<N, T>& operator+=(const Vector<N, T>& v);
+  constexpr Vector<N, T>& operator+=(const Vector<N, T>& v);
 
   /**
    * @fn Operator -=
@@ -127,7 +127,7 @@ class Vector {
    * @param [in] v: Subtracting vector
    * @return Result of subtracted vector
    */
-  Vector<N, T>& operator-=(const Vector<N, T>& v);
+  constexpr Vector<N, T>& operator-=(const Vector<N, T>& v);
 
   /**
    * @fn Operator *=
@@ -136,7 +136,7 @@ class Vector {
    * @param [in] n: Multiplying scalar value
    * @return Result of multiplied vector
    */
-  Vector<N, T>& operator*=(const T& n);
+  constexpr Vector<N, T>& operator*=(const T& n);
 
   /**
    * @fn Operator /=
@@ -145,14 +145,14 @@ class Vector {
    * @param [in] n: Dividing scalar value
    * @return Result of multiplied vector
    */
-  Vector<N, T>& operator/=(const T& n);
+  constexpr Vector<N, T>& operator/=(const T& n);
 
   /**
    * @fn Operator -
    * @brief Return negative value of the vector
    * @return negative vector
    */
-  Vector<N, T> operator-() const;
+  constexpr Vector<N, T> operator-() const;
 
  private:
   T vector_[N];  //!< Array to store elements
@@ -166,7 +166,7 @@ class Vector {
  * @return Result of added vector
  */
 template <size_t N, typename T>
-const Vector<N, T> operator+(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
+constexpr const Vector<N, T> operator+(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
 
 /**
  * @fn operator -
@@ -176,7 +176,7 @@ const Vector<N, T> operator+(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
  * @return Result of subtracted vector
  */
 template <size_t N, typename T>
-const Vector<N, T> operator-(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
+constexpr const Vector<N, T> operator-(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
 
 /**
  * @fn operator *
@@ -186,7 +186,7 @@ const Vector<N, T> operator-(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
  * @return Result of multiplied vector
  */
 template <size_t N, typename T>
-const Vector<N, T> operator*(const T& lhs, const Vector<N, T>& rhs);
+constexpr const Vector<N, T> operator*(const T& lhs, const Vector<N, T>& rhs);
 
 /**
  * @fn InnerProduct
@@ -196,7 +196,7 @@ const Vector<N, T> operator*(const T& lhs, const Vector<N, T>& rhs);
  * @return Result of scalar value
  */
 template <size_t N, typename T>
-const T InnerProduct(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
+constexpr const T InnerProduct(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
 
 /**
  * @fn OuterProduct
@@ -206,7 +206,7 @@ const T InnerProduct(const Vector<N, T>& lhs, const Vector<N, T>& rhs);
  * @return Result vector
  */
 template <typename T>
-const Vector<3, T> OuterProduct(const Vector<3, T>& lhs, const Vector<3, T>& rhs);
+constexpr const Vector<3, T> OuterProduct(const Vector<3, T>& lhs, const Vector<3, T>& rhs);
 
 /**
  * @fn CalcAngleTwoVectors_rad
@@ -11,14 +11,14 @@
 namespace libra {
 
 template <size_t N, typename T>
-Vector<N, T>::Vector(const T& n) {
+constexpr Vector<N, T>::Vector(const T& n) : vector_() {
   for (size_t i = 0; i < N; ++i) {
     vector_[i] = n;
   }
 }
 
 template <size_t N, typename T>
-Vector<N, T>& Vector<N, T>::operator+=(const Vector<N, T>& v) {
+constexpr Vector<N, T>& Vector<N, T>::operator+=(const Vector<N, T>& v) {
   for (size_t i = 0; i < N; ++i) {
     vector_[i] += v.vector_[i];
   }
@@ -26,7 +26,7 @@ Vector<N, T>& Vector<N, T>::operator+=(const Vector<N, T>& v) {
 }
 
 template <size_t N, typename T>
-Vector<N, T>& Vector<N, T>::operator-=(const Vector<N, T>& v) {
+constexpr Vector<N, T>& Vector<N, T>::operator-=(const Vector<N, T>& v) {
   for (size_t i = 0; i < N; ++i) {
     vector_[i] -= v.vector_[i];
   }
@@ -34,7 +34,7 @@ Vector<N, T>& Vector<N, T>::operator-=(const Vector<N, T>& v) {
 }
 
 template <size_t N, typename T>
-Vector<N, T>& Vector<N, T>::operator*=(const T& n) {
+constexpr Vector<N, T>& Vector<N, T>::operator*=(const T& n) {
   for (size_t i = 0; i < N; ++i) {
     vector_[i] *= n;
   }
@@ -42,19 +42,19 @@ Vector<N, T>& Vector<N, T>::operator*=(const T& n) {
 }
 
 template <size_t N, typename T>
-Vector<N, T>& Vector<N, T>::operator/=(const T& n) {
+constexpr Vector<N, T>& Vector<N, T>::operator/=(const T& n) {
   return operator*=(1.0 / n);
 }
 
 template <size_t N, typename T>
-Vector<N, T> Vector<N, T>::operator-() const {
+constexpr Vector<N, T> Vector<N, T>::operator-() const {
   Vector<N, T> temp = *this;
   temp *= -1;
   return temp;
 }
 
 template <size_t N, typename T>
-void Vector<N, T>::FillUp(const T& n) {
+constexpr void Vector<N, T>::FillUp(const T& n) {
   for (size_t i = 0; i < N; ++i) {
     vector_[i] = n;
   }
@@ -69,7 +69,7 @@ void Vector<N, T>::Print(char delimiter, std::ostream& stream) {
 }
 
 template <size_t N, typename T>
-const Vector<N, T> operator+(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
+constexpr const Vector<N, T> operator+(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
   Vector<N, T> temp;
   for (size_t i = 0; i < N; ++i) {
     temp[i] = lhs[i] + rhs[i];
@@ -78,7 +78,7 @@ const Vector<N, T> operator+(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
 }
 
 template <size_t N, typename T>
-const Vector<N, T> operator-(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
+constexpr const Vector<N, T> operator-(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
   Vector<N, T> temp;
   for (size_t i = 0; i < N; ++i) {
     temp[i] = lhs[i] - rhs[i];
@@ -87,7 +87,7 @@ const Vector<N, T> operator-(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
 }
 
 template <size_t N, typename T>
-const Vector<N, T> operator*(const T& lhs, const Vector<N, T>& rhs) {
+constexpr const Vector<N, T> operator*(const T& lhs, const Vector<N, T>& rhs) {
   Vector<N, T> temp;
   for (size_t i = 0; i < N; ++i) {
     temp[i] = lhs * rhs[i];
@@ -96,7 +96,7 @@ const Vector<N, T> operator*(const T& lhs, const Vector<N, T>& rhs) {
 }
 
 template <size_t N, typename T>
-const T InnerProduct(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
+constexpr const T InnerProduct(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
   T temp = 0;
   for (size_t i = 0; i < N; ++i) {
     temp += lhs[i] * rhs[i];
@@ -105,7 +105,7 @@ const T InnerProduct(const Vector<N, T>& lhs, const Vector<N, T>& rhs) {
 }
 
 template <typename T>
-const Vector<3, T> OuterProduct(const Vector<3, T>& lhs, const Vector<3, T>& rhs) {
+constexpr const Vector<3, T> OuterProduct(const Vector<3, T>& lhs, const Vector<3, T>& rhs) {
   Vector<3, T> temp;
   temp[0] = lhs[1] * rhs[2] - lhs[2] * rhs[1];
   temp[1] = lhs[2] * rhs[0] - lhs[0] * rhs[2];
@@ -117,7 +117,7 @@ template <size_t N, typename T>
 double Vector<N, T>::CalcNorm() const {
   double temp = 0.0;
   for (size_t i = 0; i < N; ++i) {
-    temp += pow((double)vector_[i], 2.0);
+    temp += (double)vector_[i] * (double)vector_[i];
   }
   return sqrt(temp);
 }
@@ -0,0 +1,325 @@
+/**
+ * @file articulated_body_system.cpp
+ * @brief Dynamics of the tree-structured multi-body system with the articulated-body algorithm
+ */
+
+#include "articulated_body_system.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+/**
+ * @fn MakeSpatialVector
+ * @brief Make the spatial vector from the angular part and the linear part
+ */
+libra::Vector<6> MakeSpatialVector(const libra::Vector<3>& angular, const libra::Vector<3>& linear) {
+  libra::Vector<6> spatial;
+  for (size_t i = 0; i < 3; i++) {
+    spatial[i] = angular[i];
+    spatial[i + 3] = linear[i];
+  }
+  return spatial;
+}
+
+/**
+ * @fn GetAngularPart
+ * @brief Return the angular part of the spatial vector
+ */
+libra::Vector<3> GetAngularPart(const libra::Vector<6>& spatial) {
+  libra::Vector<3> angular;
+  for (size_t i = 0; i < 3; i++) angular[i] = spatial[i];
+  return angular;
+}
+
+/**
+ * @fn GetLinearPart
+ * @brief Return the linear part of the spatial vector
+ */
+libra::Vector<3> GetLinearPart(const libra::Vector<6>& spatial) {
+  libra::Vector<3> linear;
+  for (size_t i = 0; i < 3; i++) linear[i] = spatial[i + 3];
+  return linear;
+}
+
+/**
+ * @fn CalcSkewMatrix
+ * @brief Return the matrix [v x] which satisfies [v x] u = v x u
+ */
+libra::Matrix<3, 3> CalcSkewMatrix(const libra::Vector<3>& v) {
+  libra::Matrix<3, 3> skew(0.0);
+  skew[0][1] = -v[2];
+  skew[0][2] = v[1];
+  skew[1][0] = v[2];
+  skew[1][2] = -v[0];
+  skew[2][0] = -v[1];
+  skew[2][1] = v[0];
+  return skew;
+}
+
+/**
+ * @fn CrossMotion
+ * @brief Spatial cross product of the motion vectors: v x m
+ */
+libra::Vector<6> CrossMotion(const libra::Vector<6>& v, const libra::Vector<6>& m) {
+  const libra::Vector<3> w = GetAngularPart(v);
+  const libra::Vector<3> m_angular = GetAngularPart(m);
+  return MakeSpatialVector(libra::OuterProduct(w, m_angular),
+                           libra::OuterProduct(w, GetLinearPart(m)) + libra::OuterProduct(GetLinearPart(v), m_angular));
+}
+
+/**
+ * @fn CrossForce
+ * @brief Spatial cross product of the motion vector and the force vector: v x* f
+ */
+libra::Vector<6> CrossForce(const libra::Vector<6>& v, const libra::Vector<6>& f) {
+  const libra::Vector<3> w = GetAngularPart(v);
+  const libra::Vector<3> f_linear = GetLinearPart(f);
+  return MakeSpatialVector(libra::OuterProduct(w, GetAngularPart(f)) + libra::OuterProduct(GetLinearPart(v), f_linear),
+                           libra::OuterProduct(w, f_linear));
+}
+
+/**
+ * @fn TransformMotion
+ * @brief Transform the motion vector from the parent frame to the child frame
+ * @param [in] rotation: Direction cosine matrix from the parent frame to the child frame
+ * @param [in] position: Position of the child frame origin in the parent frame
+ * @param [in] m: Motion vector in the parent frame
+ */
+libra::Vector<6> TransformMotion(const libra::Matrix<3, 3>& rotation, const libra::Vector<3>& position, const libra::Vector<6>& m) {
+  const libra::Vector<3> m_angular = GetAngularPart(m);
+  return MakeSpatialVector(rotation * m_angular, rotation * (GetLinearPart(m) - libra::OuterProduct(position, m_angular)));
+}
+
+/**
+ * @fn TransformForceToParent
+ * @brief Transform the force vector from the child frame to the parent frame
+ * @param [in] rotation: Direction cosine matrix from the parent frame to the child frame
+ * @param [in] position: Position of the child frame origin in the parent frame
+ * @param [in] f: Force vector in the child frame
+ */
+libra::Vector<6> TransformForceToParent(const libra::Matrix<3, 3>& rotation, const libra::Vector<3>& position, const libra::Vector<6>& f) {
+  const libra::Matrix<3, 3> rotation_transpose = rotation.Transpose();
+  const libra::Vector<3> f_linear = rotation_transpose * GetLinearPart(f);
+  return MakeSpatialVector(rotation_transpose * GetAngularPart(f) + libra::OuterProduct(position, f_linear), f_linear);
+}
+
+/**
+ * @fn MakeMotionTransformMatrix
+ * @brief Make the 6x6 matrix of TransformMotion
+ */
+libra::Matrix<6, 6> MakeMotionTransformMatrix(const libra::Matrix<3, 3>& rotation, const libra::Vector<3>& position) {
+  const libra::Matrix<3, 3> lower_left = -1.0 * (rotation * CalcSkewMatrix(position));
+  libra::Matrix<6, 6> transform(0.0);
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      transform[i][j] = rotation[i][j];
+      transform[i + 3][j] = lower_left[i][j];
+      transform[i + 3][j + 3] = rotation[i][j];
+    }
+  }
+  return transform;
+}
+
+/**
+ * @fn CalcJointRotation
+ * @brief Direction cosine matrix from the parent frame to the child frame rotated around the axis
+ * @param [in] axis: Unit vector of the rotation axis
+ * @param [in] angle_rad: Rotation angle [rad]
+ */
+libra::Matrix<3, 3> CalcJointRotation(const libra::Vector<3>& axis, const double angle_rad) {
+  const double cos_angle = cos(angle_rad);
+  const double sin_angle = sin(angle_rad);
+  libra::Matrix<3, 3> rotation = cos_angle * libra::MakeIdentityMatrix<3>() - sin_angle * CalcSkewMatrix(axis);
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      rotation[i][j] += (1.0 - cos_angle) * axis[i] * axis[j];
+    }
+  }
+  return rotation;
+}
+}  // namespace
+
+ArticulatedBodySystem::ArticulatedBodySystem(const std::vector<ArticulatedBody>& bodies) : bodies_(bodies) {
+  if (bodies_.empty()) {
+    throw std::invalid_argument("Articulated body system needs at least the base body.");
+  }
+  for (size_t i = 1; i < bodies_.size(); i++) {
+    if (bodies_[i].parent_id_ >= i) {
+      throw std::invalid_argument("The parent body should be listed before the child body.");
+    }
+    bodies_[i].joint_axis_ = bodies_[i].joint_axis_.CalcNormalizedVector();
+  }
+
+  const size_t number_of_bodies = bodies_.size();
+  spatial_inertia_.resize(number_of_bodies);
+  for (size_t i = 0; i < number_of_bodies; i++) {
+    spatial_inertia_[i] = CalcSpatialInertia(bodies_[i]);
+  }
+  rotation_from_parent_.assign(number_of_bodies, libra::MakeIdentityMatrix<3>());
+  velocity_.resize(number_of_bodies);
+  velocity_product_.resize(number_of_bodies);
+  articulated_inertia_.resize(number_of_bodies);
+  articulated_bias_force_.resize(number_of_bodies);
+  inertia_times_joint_axis_.resize(number_of_bodies);
+  joint_axis_inertia_.resize(number_of_bodies);
+  joint_bias_torque_.resize(number_of_bodies);
+  acceleration_.resize(number_of_bodies);
+}
+
+void ArticulatedBodySystem::SetBaseMassProperties(const double mass_kg, const libra::Vector<3>& center_of_mass_m,
+                                                  const libra::Matrix<3, 3>& inertia_tensor_kgm2) {
+  bodies_[0].mass_kg_ = mass_kg;
+  bodies_[0].center_of_mass_m_ = center_of_mass_m;
+  bodies_[0].inertia_tensor_kgm2_ = inertia_tensor_kgm2;
+  spatial_inertia_[0] = CalcSpatialInertia(bodies_[0]);
+}
+
+void ArticulatedBodySystem::CalcAcceleration(const libra::Vector<6>& base_velocity, const std::vector<double>& joint_angles_rad,
+                                             const std::vector<double>& joint_angular_velocities_rad_s, const std::vector<double>& joint_torques_Nm,
+                                             const libra::Vector<6>& base_external_force, const libra::Vector<3>& base_internal_angular_momentum_Nms,
+                                             libra::Vector<6>& base_acceleration, std::vector<double>& joint_angular_accelerations_rad_s2) {
+  const size_t number_of_joints = GetNumberOfJoints();
+  if (joint_torques_Nm.size() != number_of_joints) {
+    throw std::invalid_argument("Number of joint torques does not match the number of joints.");
+  }
+  UpdateKinematics(base_velocity, joint_angles_rad, joint_angular_velocities_rad_s);
+
+  // Rigid body inertia and bias force of each body
+  for (size_t i = 0; i < bodies_.size(); i++) {
+    articulated_inertia_[i] = spatial_inertia_[i];
+    articulated_bias_force_[i] = CrossForce(velocity_[i], spatial_inertia_[i] * velocity_[i]);
+  }
+  const libra::Vector<3> base_angular_velocity_rad_s = GetAngularPart(base_velocity);
+  articulated_bias_force_[0] += MakeSpatialVector(libra::OuterProduct(base_angular_velocity_rad_s, base_internal_angular_momentum_Nms),
+                                                  libra::Vector<3>(0.0));
+  articulated_bias_force_[0] -= base_external_force;
+
+  // Articulated-body inertia and bias force from the leaves to the base
+  for (size_t i = bodies_.size() - 1; i > 0; i--) {
+    const ArticulatedBody& body = bodies_[i];
+    const size_t joint_id = i - 1;
+    const libra::Vector<6> joint_axis = MakeSpatialVector(body.joint_axis_, libra::Vector<3>(0.0));
+
+    inertia_times_joint_axis_[i] = articulated_inertia_[i] * joint_axis;
+    joint_axis_inertia_[i] = libra::InnerProduct(joint_axis, inertia_times_joint_axis_[i]);
+    const double joint_torque_Nm = joint_torques_Nm[joint_id] - body.joint_stiffness_Nm_rad_ * joint_angles_rad[joint_id] -
+                                   body.joint_damping_Nms_rad_ * joint_angular_velocities_rad_s[joint_id];
+    joint_bias_torque_[i] = joint_torque_Nm - libra::InnerProduct(joint_axis, articulated_bias_force_[i]);
+
+    const libra::Vector<6>& u = inertia_times_joint_axis_[i];
+    libra::Matrix<6, 6> inertia_to_parent = articulated_inertia_[i];
+    for (size_t row = 0; row < 6; row++) {
+      for (size_t column = 0; column < 6; column++) {
+        inertia_to_parent[row][column] -= u[row] * u[column] / joint_axis_inertia_[i];
+      }
+    }
+    const libra::Vector<6> bias_force_to_parent =
+        articulated_bias_force_[i] + inertia_to_parent * velocity_product_[i] + (joint_bias_torque_[i] / joint_axis_inertia_[i]) * u;
+
+    const libra::Matrix<6, 6> transform = MakeMotionTransformMatrix(rotation_from_parent_[i], body.joint_position_parent_m_);
+    articulated_inertia_[body.parent_id_] += transform.Transpose() * inertia_to_parent * transform;
+    articulated_bias_force_[body.parent_id_] += TransformForceToParent(rotation_from_parent_[i], body.joint_position_parent_m_, bias_force_to_parent);
+  }
+
+  // Accelerations from the base to the leaves
+  libra::Matrix<6, 6> base_inertia = articulated_inertia_[0];
+  size_t pivot_indices[6];
+  libra::LuDecomposition(base_inertia, pivot_indices);
+  acceleration_[0] = -1.0 * articulated_bias_force_[0];
+  libra::SolveLinearSystemWithLu(base_inertia, pivot_indices, acceleration_[0]);
+  base_acceleration = acceleration_[0];
+
+  joint_angular_accelerations_rad_s2.resize(number_of_joints);
+  for (size_t i = 1; i < bodies_.size(); i++) {
+    const ArticulatedBody& body = bodies_[i];
+    const libra::Vector<6> acceleration =
+        TransformMotion(rotation_from_parent_[i], body.joint_position_parent_m_, acceleration_[body.parent_id_]) + velocity_product_[i];
+    const double joint_acceleration_rad_s2 =
+        (joint_bias_torque_[i] - libra::InnerProduct(inertia_times_joint_axis_[i], acceleration)) / joint_axis_inertia_[i];
+    joint_angular_accelerations_rad_s2[i - 1] = joint_acceleration_rad_s2;
+    acceleration_[i] = acceleration + MakeSpatialVector(joint_acceleration_rad_s2 * body.joint_axis_, libra::Vector<3>(0.0));
+  }
+}
+
+ArticulatedBodyMomentum ArticulatedBodySystem::CalcMomentum(const libra::Vector<6>& base_velocity, const std::vector<double>& joint_angles_rad,
+                                                            const std::vector<double>& joint_angular_velocities_rad_s) {
+  UpdateKinematics(base_velocity, joint_angles_rad, joint_angular_velocities_rad_s);
+
+  // Pose of each body frame in the base body frame
+  std::vector<libra::Matrix<3, 3>> rotation_from_base(bodies_.size(), libra::MakeIdentityMatrix<3>());
+  std::vector<libra::Vector<3>> position_in_base_m(bodies_.size(), libra::Vector<3>(0.0));
+
+  libra::Vector<6> momentum_around_origin(0.0);
+  libra::Vector<3> first_moment_of_mass_kgm(0.0);
+  double kinetic_energy_J = 0.0;
+  for (size_t i = 0; i < bodies_.size(); i++) {
+    const ArticulatedBody& body = bodies_[i];
+    if (i > 0) {
+      rotation_from_base[i] = rotation_from_parent_[i] * rotation_from_base[body.parent_id_];
+      position_in_base_m[i] = position_in_base_m[body.parent_id_] + rotation_from_base[body.parent_id_].Transpose() * body.joint_position_parent_m_;
+    }
+    const libra::Vector<6> momentum = spatial_inertia_[i] * velocity_[i];
+    momentum_around_origin += TransformForceToParent(rotation_from_base[i], position_in_base_m[i], momentum);
+    first_moment_of_mass_kgm += body.mass_kg_ * (position_in_base_m[i] + rotation_from_base[i].Transpose() * body.center_of_mass_m_);
+    kinetic_energy_J += 0.5 * libra::InnerProduct(velocity_[i], momentum);
+  }
+
+  ArticulatedBodyMomentum result;
+  result.center_of_mass_m_ = (1.0 / GetTotalMass_kg()) * first_moment_of_mass_kgm;
+  result.linear_momentum_Ns_ = GetLinearPart(momentum_around_origin);
+  result.angular_momentum_Nms_ = GetAngularPart(momentum_around_origin) - libra::OuterProduct(result.center_of_mass_m_, result.linear_momentum_Ns_);
+  result.kinetic_energy_J_ = kinetic_energy_J;
+  return result;
+}
+
+double ArticulatedBodySystem::CalcJointPotentialEnergy_J(const std::vector<double>& joint_angles_rad) const {
+  double energy_J = 0.0;
+  for (size_t i = 1; i < bodies_.size(); i++) {
+    energy_J += 0.5 * bodies_[i].joint_stiffness_Nm_rad_ * joint_angles_rad[i - 1] * joint_angles_rad[i - 1];
+  }
+  return energy_J;
+}
+
+double ArticulatedBodySystem::GetTotalMass_kg() const {
+  double mass_kg = 0.0;
+  for (const auto& body : bodies_) {
+    mass_kg += body.mass_kg_;
+  }
+  return mass_kg;
+}
+
+libra::Matrix<6, 6> ArticulatedBodySystem::CalcSpatialInertia(const ArticulatedBody& body) {
+  const libra::Matrix<3, 3> skew_center_of_mass = CalcSkewMatrix(body.center_of_mass_m_);
+  const libra::Matrix<3, 3> inertia_around_origin = body.inertia_tensor_kgm2_ - body.mass_kg_ * (skew_center_of_mass * skew_center_of_mass);
+  const libra::Matrix<3, 3> coupling = body.mass_kg_ * skew_center_of_mass;
+
+  libra::Matrix<6, 6> spatial_inertia(0.0);
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      spatial_inertia[i][j] = inertia_around_origin[i][j];
+      spatial_inertia[i][j + 3] = coupling[i][j];
+      spatial_inertia[i + 3][j] = coupling[j][i];
+    }
+    spatial_inertia[i + 3][i + 3] = body.mass_kg_;
+  }
+  return spatial_inertia;
+}
+
+void ArticulatedBodySystem::UpdateKinematics(const libra::Vector<6>& base_velocity, const std::vector<double>& joint_angles_rad,
+                                             const std::vector<double>& joint_angular_velocities_rad_s) {
+  const size_t number_of_joints = GetNumberOfJoints();
+  if (joint_angles_rad.size() != number_of_joints || joint_angular_velocities_rad_s.size() != number_of_joints) {
+    throw std::invalid_argument("Number of joint states does not match the number of joints.");
+  }
+
+  velocity_[0] = base_velocity;
+  velocity_product_[0] = libra::Vector<6>(0.0);
+  for (size_t i = 1; i < bodies_.size(); i++) {
+    const ArticulatedBody& body = bodies_[i];
+    rotation_from_parent_[i] = CalcJointRotation(body.joint_axis_, joint_angles_rad[i - 1]);
+    const libra::Vector<6> joint_velocity = MakeSpatialVector(joint_angular_velocities_rad_s[i - 1] * body.joint_axis_, libra::Vector<3>(0.0));
+    velocity_[i] = TransformMotion(rotation_from_parent_[i], body.joint_position_parent_m_, velocity_[body.parent_id_]) + joint_velocity;
+    velocity_product_[i] = CrossMotion(velocity_[i], joint_velocity);
+  }
+}
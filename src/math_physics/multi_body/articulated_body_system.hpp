@@ -0,0 +1,152 @@
+/**
+ * @file articulated_body_system.hpp
+ * @brief Dynamics of the tree-structured multi-body system with the articulated-body algorithm
+ * @note The algorithm follows R. Featherstone, "Rigid Body Dynamics Algorithms", Springer, 2008 (floating base articulated-body algorithm).
+ *       The spatial vectors are expressed as [angular part, linear part] in each body frame.
+ */
+
+#ifndef S2E_LIBRARY_MULTI_BODY_ARTICULATED_BODY_SYSTEM_HPP_
+#define S2E_LIBRARY_MULTI_BODY_ARTICULATED_BODY_SYSTEM_HPP_
+
+#include <vector>
+
+#include "../math/matrix_vector.hpp"
+
+/**
+ * @struct ArticulatedBody
+ * @brief Parameters of a rigid body and the revolute joint connecting it to the parent body
+ * @note The body frame origin is the joint position, and the body frame is parallel to the parent body frame when the joint angle is zero.
+ *       The joint parameters are ignored for the base body.
+ */
+struct ArticulatedBody {
+  size_t parent_id_;                          //!< Index of the parent body. It should be smaller than the index of this body.
+  libra::Vector<3> joint_position_parent_m_;  //!< Position of the joint in the parent body frame [m]
+  libra::Vector<3> joint_axis_;               //!< Unit vector of the joint rotation axis in the body frame
+  double joint_stiffness_Nm_rad_;             //!< Rotational spring constant of the joint [Nm/rad]
+  double joint_damping_Nms_rad_;              //!< Rotational damping coefficient of the joint [Nms/rad]
+  double mass_kg_;                            //!< Mass of the body [kg]
+  libra::Vector<3> center_of_mass_m_;         //!< Position of the center of mass in the body frame [m]
+  libra::Matrix<3, 3> inertia_tensor_kgm2_;   //!< Inertia tensor around the center of mass in the body frame [kg m^2]
+};
+
+/**
+ * @struct ArticulatedBodyMomentum
+ * @brief Momentum and kinetic energy of the whole multi-body system expressed in the base body frame
+ */
+struct ArticulatedBodyMomentum {
+  libra::Vector<3> angular_momentum_Nms_;  //!< Angular momentum around the center of mass of the system [Nms]
+  libra::Vector<3> linear_momentum_Ns_;    //!< Linear momentum [Ns]
+  libra::Vector<3> center_of_mass_m_;      //!< Center of mass of the system from the base body frame origin [m]
+  double kinetic_energy_J_;                //!< Kinetic energy [J]
+};
+
+/**
+ * @class ArticulatedBodySystem
+ * @brief Tree-structured multi-body system with the free-floating base body and the 1-DOF revolute joints
+ * @details The forward dynamics is calculated by the articulated-body algorithm whose cost is O(n) for the number of bodies n, so the
+ *          joint space mass matrix is neither assembled nor inverted. The joint of body k (k >= 1) is the (k - 1)-th joint.
+ */
+class ArticulatedBodySystem {
+ public:
+  /**
+   * @fn ArticulatedBodySystem
+   * @brief Constructor
+   * @note std::invalid_argument is thrown when the bodies are empty or the parent of a body is not listed before the body.
+   * @param [in] bodies: Bodies of the system in the topological order. The first body is the base body.
+   */
+  ArticulatedBodySystem(const std::vector<ArticulatedBody>& bodies);
+
+  /**
+   * @fn SetBaseMassProperties
+   * @brief Update the mass properties of the base body
+   * @param [in] mass_kg: Mass [kg]
+   * @param [in] center_of_mass_m: Position of the center of mass in the base body frame [m]
+   * @param [in] inertia_tensor_kgm2: Inertia tensor around the center of mass in the base body frame [kg m^2]
+   */
+  void SetBaseMassProperties(const double mass_kg, const libra::Vector<3>& center_of_mass_m, const libra::Matrix<3, 3>& inertia_tensor_kgm2);
+
+  /**
+   * @fn CalcAcceleration
+   * @brief Calculate the accelerations of the base body and the joints (forward dynamics)
+   * @note The joint torques of the springs and the dampers are added to the given joint torques inside.
+   * @param [in] base_velocity: Spatial velocity of the base body (angular velocity [rad/s], velocity of the frame origin [m/s])
+   * @param [in] joint_angles_rad: Joint angles [rad]
+   * @param [in] joint_angular_velocities_rad_s: Joint angular velocities [rad/s]
+   * @param [in] joint_torques_Nm: Joint torques by the actuators [Nm]
+   * @param [in] base_external_force: Spatial force acting on the base body (torque around the frame origin [Nm], force [N])
+   * @param [in] base_internal_angular_momentum_Nms: Angular momentum of the internal rotors (e.g. reaction wheels) in the base body [Nms]
+   * @param [out] base_acceleration: Time derivative of the base spatial velocity in the base body frame
+   * @param [out] joint_angular_accelerations_rad_s2: Joint angular accelerations [rad/s2]
+   */
+  void CalcAcceleration(const libra::Vector<6>& base_velocity, const std::vector<double>& joint_angles_rad,
+                        const std::vector<double>& joint_angular_velocities_rad_s, const std::vector<double>& joint_torques_Nm,
+                        const libra::Vector<6>& base_external_force, const libra::Vector<3>& base_internal_angular_momentum_Nms,
+                        libra::Vector<6>& base_acceleration, std::vector<double>& joint_angular_accelerations_rad_s2);
+
+  /**
+   * @fn CalcMomentum
+   * @brief Calculate the momentum and the kinetic energy of the system
+   * @note The internal rotors are not included.
+   * @param [in] base_velocity: Spatial velocity of the base body
+   * @param [in] joint_angles_rad: Joint angles [rad]
+   * @param [in] joint_angular_velocities_rad_s: Joint angular velocities [rad/s]
+   * @return Momentum and kinetic energy
+   */
+  ArticulatedBodyMomentum CalcMomentum(const libra::Vector<6>& base_velocity, const std::vector<double>& joint_angles_rad,
+                                       const std::vector<double>& joint_angular_velocities_rad_s);
+
+  /**
+   * @fn CalcJointPotentialEnergy_J
+   * @brief Calculate the potential energy stored in the joint springs [J]
+   * @param [in] joint_angles_rad: Joint angles [rad]
+   */
+  double CalcJointPotentialEnergy_J(const std::vector<double>& joint_angles_rad) const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfBodies
+   * @brief Return number of bodies including the base body
+   */
+  inline size_t GetNumberOfBodies() const { return bodies_.size(); }
+  /**
+   * @fn GetNumberOfJoints
+   * @brief Return number of joints
+   */
+  inline size_t GetNumberOfJoints() const { return bodies_.size() - 1; }
+  /**
+   * @fn GetTotalMass_kg
+   * @brief Return total mass of the system [kg]
+   */
+  double GetTotalMass_kg() const;
+
+ private:
+  std::vector<ArticulatedBody> bodies_;                     //!< Bodies
+  std::vector<libra::Matrix<6, 6>> spatial_inertia_;        //!< Spatial inertia of each body around the body frame origin
+  std::vector<libra::Matrix<3, 3>> rotation_from_parent_;   //!< Direction cosine matrix from the parent body frame to the body frame
+  std::vector<libra::Vector<6>> velocity_;                  //!< Spatial velocity of each body
+  std::vector<libra::Vector<6>> velocity_product_;          //!< Velocity-product acceleration of each body
+  std::vector<libra::Matrix<6, 6>> articulated_inertia_;    //!< Articulated-body inertia of each body
+  std::vector<libra::Vector<6>> articulated_bias_force_;    //!< Articulated-body bias force of each body
+  std::vector<libra::Vector<6>> inertia_times_joint_axis_;  //!< Articulated-body inertia multiplied by the joint motion subspace
+  std::vector<double> joint_axis_inertia_;                  //!< Articulated-body inertia seen from the joint axis
+  std::vector<double> joint_bias_torque_;                   //!< Joint torque with the bias force of the outer bodies
+  std::vector<libra::Vector<6>> acceleration_;              //!< Spatial acceleration of each body
+
+  /**
+   * @fn CalcSpatialInertia
+   * @brief Calculate the spatial inertia around the body frame origin
+   * @param [in] body: Target body
+   */
+  static libra::Matrix<6, 6> CalcSpatialInertia(const ArticulatedBody& body);
+  /**
+   * @fn UpdateKinematics
+   * @brief Calculate the joint rotations and the spatial velocities of all bodies (the first pass of the algorithm)
+   * @param [in] base_velocity: Spatial velocity of the base body
+   * @param [in] joint_angles_rad: Joint angles [rad]
+   * @param [in] joint_angular_velocities_rad_s: Joint angular velocities [rad/s]
+   */
+  void UpdateKinematics(const libra::Vector<6>& base_velocity, const std::vector<double>& joint_angles_rad,
+                        const std::vector<double>& joint_angular_velocities_rad_s);
+};
+
+#endif  // S2E_LIBRARY_MULTI_BODY_ARTICULATED_BODY_SYSTEM_HPP_
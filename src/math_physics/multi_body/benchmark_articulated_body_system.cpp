@@ -0,0 +1,61 @@
+/**
+ * @file benchmark_articulated_body_system.cpp
+ * @brief Benchmark codes for the forward dynamics of the articulated body system with the different number of bodies
+ */
+#include <chrono>
+#include <iostream>
+
+#include "articulated_body_system.hpp"
+
+/**
+ * @fn MakeChain
+ * @brief Make the chain of the bodies connected with the revolute joints whose axes rotate in the order x, y, z
+ * @param [in] number_of_bodies: Number of bodies including the base body
+ */
+std::vector<ArticulatedBody> MakeChain(const size_t number_of_bodies) {
+  std::vector<ArticulatedBody> bodies(number_of_bodies);
+  for (size_t i = 0; i < number_of_bodies; i++) {
+    ArticulatedBody& body = bodies[i];
+    body.parent_id_ = (i == 0) ? 0 : i - 1;
+    body.joint_position_parent_m_ = libra::Vector<3>(0.0);
+    body.joint_position_parent_m_[0] = (i == 1) ? 0.5 : 1.0;
+    body.joint_axis_ = libra::Vector<3>(0.0);
+    body.joint_axis_[i % 3] = 1.0;
+    body.joint_stiffness_Nm_rad_ = 1.0;
+    body.joint_damping_Nms_rad_ = 0.01;
+    body.mass_kg_ = (i == 0) ? 50.0 : 1.0;
+    body.center_of_mass_m_ = libra::Vector<3>(0.0);
+    body.center_of_mass_m_[0] = (i == 0) ? 0.0 : 0.5;
+    body.inertia_tensor_kgm2_ = (i == 0) ? 3.0 * libra::MakeIdentityMatrix<3>() : 0.1 * libra::MakeIdentityMatrix<3>();
+  }
+  return bodies;
+}
+
+int main() {
+  const size_t number_of_calls = 100000;
+  std::cout << "number of bodies, CalcAcceleration [us/call]" << std::endl;
+
+  for (size_t number_of_bodies = 1; number_of_bodies <= 16; number_of_bodies *= 2) {
+    ArticulatedBodySystem system(MakeChain(number_of_bodies));
+    const size_t number_of_joints = system.GetNumberOfJoints();
+
+    libra::Vector<6> base_velocity(0.0);
+    base_velocity[2] = 0.1;
+    std::vector<double> angles(number_of_joints, 0.1), rates(number_of_joints, 0.01), torques(number_of_joints, 0.0);
+    libra::Vector<6> base_acceleration;
+    std::vector<double> joint_accelerations;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < number_of_calls; i++) {
+      system.CalcAcceleration(base_velocity, angles, rates, torques, libra::Vector<6>(0.0), libra::Vector<3>(0.0), base_acceleration,
+                              joint_accelerations);
+      // The outputs are fed back to the inputs to avoid the optimization of the loop
+      base_velocity[0] = 1.0e-6 * base_acceleration[0];
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    const double elapsed_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    std::cout << number_of_bodies << ", " << elapsed_us / (double)number_of_calls << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file test_articulated_body_system.cpp
+ * @brief Test codes for ArticulatedBodySystem class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#include "articulated_body_system.hpp"
+
+namespace {
+/**
+ * @fn MakeBody
+ * @brief Make a body with the diagonal inertia tensor
+ */
+ArticulatedBody MakeBody(const size_t parent_id, const libra::Vector<3>& joint_position_parent_m, const libra::Vector<3>& joint_axis,
+                         const double mass_kg, const libra::Vector<3>& center_of_mass_m, const libra::Vector<3>& principal_inertia_kgm2,
+                         const double joint_stiffness_Nm_rad = 0.0) {
+  ArticulatedBody body;
+  body.parent_id_ = parent_id;
+  body.joint_position_parent_m_ = joint_position_parent_m;
+  body.joint_axis_ = joint_axis;
+  body.joint_stiffness_Nm_rad_ = joint_stiffness_Nm_rad;
+  body.joint_damping_Nms_rad_ = 0.0;
+  body.mass_kg_ = mass_kg;
+  body.center_of_mass_m_ = center_of_mass_m;
+  body.inertia_tensor_kgm2_ = libra::Matrix<3, 3>(0.0);
+  for (size_t i = 0; i < 3; i++) body.inertia_tensor_kgm2_[i][i] = principal_inertia_kgm2[i];
+  return body;
+}
+
+/**
+ * @fn MakeVector
+ * @brief Make a 3D vector
+ */
+libra::Vector<3> MakeVector(const double x, const double y, const double z) {
+  libra::Vector<3> vector;
+  vector[0] = x;
+  vector[1] = y;
+  vector[2] = z;
+  return vector;
+}
+}  // namespace
+
+/**
+ * @brief Test for the single rigid body which should follow Euler's equation
+ */
+TEST(ArticulatedBodySystem, SingleBodyEulerEquation) {
+  const libra::Vector<3> principal_inertia_kgm2 = MakeVector(1.0, 2.0, 3.0);
+  ArticulatedBodySystem system({MakeBody(0, libra::Vector<3>(0.0), libra::Vector<3>(0.0), 10.0, libra::Vector<3>(0.0), principal_inertia_kgm2)});
+
+  const libra::Vector<3> angular_velocity_rad_s = MakeVector(0.1, -0.2, 0.3);
+  const libra::Vector<3> torque_Nm = MakeVector(0.01, 0.02, -0.03);
+  const libra::Vector<3> wheel_angular_momentum_Nms = MakeVector(0.0, 0.0, 0.5);
+  libra::Vector<6> base_velocity(0.0), base_force(0.0);
+  for (size_t i = 0; i < 3; i++) {
+    base_velocity[i] = angular_velocity_rad_s[i];
+    base_force[i] = torque_Nm[i];
+  }
+
+  libra::Vector<6> base_acceleration;
+  std::vector<double> joint_accelerations;
+  system.CalcAcceleration(base_velocity, {}, {}, {}, base_force, wheel_angular_momentum_Nms, base_acceleration, joint_accelerations);
+
+  libra::Vector<3> angular_momentum_Nms;
+  for (size_t i = 0; i < 3; i++) angular_momentum_Nms[i] = principal_inertia_kgm2[i] * angular_velocity_rad_s[i];
+  const libra::Vector<3> expected_torque_Nm =
+      torque_Nm - libra::OuterProduct(angular_velocity_rad_s, angular_momentum_Nms + wheel_angular_momentum_Nms);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected_torque_Nm[i] / principal_inertia_kgm2[i], base_acceleration[i], 1e-12);
+    EXPECT_NEAR(0.0, base_acceleration[i + 3], 1e-12);
+  }
+  EXPECT_TRUE(joint_accelerations.empty());
+}
+
+/**
+ * @brief Test for the joint acceleration of the appendage connected to a very heavy base body
+ */
+TEST(ArticulatedBodySystem, FixedBaseJointAcceleration) {
+  const double heavy = 1.0e12;
+  const double mass_kg = 2.0;
+  const double arm_m = 0.5;
+  const double inertia_kgm2 = 0.1;
+  const double stiffness_Nm_rad = 3.0;
+  ArticulatedBodySystem system({MakeBody(0, libra::Vector<3>(0.0), libra::Vector<3>(0.0), heavy, libra::Vector<3>(0.0), libra::Vector<3>(heavy)),
+                                MakeBody(0, MakeVector(1.0, 0.0, 0.0), MakeVector(0.0, 0.0, 2.0), mass_kg, MakeVector(arm_m, 0.0, 0.0),
+                                         libra::Vector<3>(inertia_kgm2), stiffness_Nm_rad)});
+  EXPECT_EQ(2, system.GetNumberOfBodies());
+  EXPECT_EQ(1, system.GetNumberOfJoints());
+
+  const double angle_rad = 0.2;
+  const double torque_Nm = 1.5;
+  libra::Vector<6> base_acceleration;
+  std::vector<double> joint_accelerations;
+  system.CalcAcceleration(libra::Vector<6>(0.0), {angle_rad}, {0.0}, {torque_Nm}, libra::Vector<6>(0.0), libra::Vector<3>(0.0), base_acceleration,
+                          joint_accelerations);
+
+  const double joint_inertia_kgm2 = inertia_kgm2 + mass_kg * arm_m * arm_m;
+  ASSERT_EQ(1, joint_accelerations.size());
+  EXPECT_NEAR((torque_Nm - stiffness_Nm_rad * angle_rad) / joint_inertia_kgm2, joint_accelerations[0], 1e-9);
+  EXPECT_NEAR(system.GetTotalMass_kg(), heavy + mass_kg, 1e-3);
+}
+
+/**
+ * @brief Test for the conservation of the momentum and the energy of the free-floating chain with springs
+ */
+TEST(ArticulatedBodySystem, FreeFloatingConservation) {
+  const ArticulatedBody base =
+      MakeBody(0, libra::Vector<3>(0.0), libra::Vector<3>(0.0), 50.0, MakeVector(0.01, 0.02, 0.0), MakeVector(3.0, 4.0, 5.0));
+  ArticulatedBodySystem system({base,
+                                MakeBody(0, MakeVector(0.5, 0.0, 0.0), MakeVector(0.0, 1.0, 0.0), 2.0, MakeVector(0.5, 0.0, 0.0),
+                                         MakeVector(0.01, 0.2, 0.2), 5.0),
+                                MakeBody(1, MakeVector(1.0, 0.0, 0.0), MakeVector(0.0, 0.0, 1.0), 1.0, MakeVector(0.5, 0.0, 0.0),
+                                         MakeVector(0.01, 0.1, 0.1), 2.0),
+                                MakeBody(0, MakeVector(0.0, 0.0, -0.3), MakeVector(1.0, 1.0, 0.0), 5.0, MakeVector(0.0, 0.0, -0.2),
+                                         MakeVector(0.05, 0.05, 0.02))});
+  const size_t number_of_joints = system.GetNumberOfJoints();
+
+  // State: base velocity, joint angles, joint angular velocities
+  libra::Vector<6> base_velocity(0.0);
+  base_velocity[0] = 0.02;
+  base_velocity[1] = -0.05;
+  base_velocity[2] = 0.1;
+  std::vector<double> angles = {0.3, -0.2, 0.0};
+  std::vector<double> rates = {0.0, 0.1, 0.5};
+  const std::vector<double> torques(number_of_joints, 0.0);
+
+  const ArticulatedBodyMomentum initial = system.CalcMomentum(base_velocity, angles, rates);
+  const double initial_energy_J = initial.kinetic_energy_J_ + system.CalcJointPotentialEnergy_J(angles);
+
+  auto derivative = [&](const libra::Vector<6>& v, const std::vector<double>& q, const std::vector<double>& dq, libra::Vector<6>& dv,
+                        std::vector<double>& ddq) {
+    system.CalcAcceleration(v, q, dq, torques, libra::Vector<6>(0.0), libra::Vector<3>(0.0), dv, ddq);
+  };
+
+  // Classical Runge-Kutta method
+  const double dt = 0.001;
+  for (size_t step = 0; step < 5000; step++) {
+    libra::Vector<6> k_v[4];
+    std::vector<double> k_q[4], k_dq[4];
+    libra::Vector<6> stage_v = base_velocity;
+    std::vector<double> stage_q = angles, stage_dq = rates;
+    const double coefficients[4] = {0.0, 0.5, 0.5, 1.0};
+    for (size_t k = 0; k < 4; k++) {
+      if (k > 0) {
+        stage_v = base_velocity + coefficients[k] * dt * k_v[k - 1];
+        for (size_t j = 0; j < number_of_joints; j++) {
+          stage_q[j] = angles[j] + coefficients[k] * dt * k_q[k - 1][j];
+          stage_dq[j] = rates[j] + coefficients[k] * dt * k_dq[k - 1][j];
+        }
+      }
+      k_q[k] = stage_dq;
+      derivative(stage_v, stage_q, stage_dq, k_v[k], k_dq[k]);
+    }
+    base_velocity += (dt / 6.0) * (k_v[0] + 2.0 * k_v[1] + 2.0 * k_v[2] + k_v[3]);
+    for (size_t j = 0; j < number_of_joints; j++) {
+      angles[j] += (dt / 6.0) * (k_q[0][j] + 2.0 * k_q[1][j] + 2.0 * k_q[2][j] + k_q[3][j]);
+      rates[j] += (dt / 6.0) * (k_dq[0][j] + 2.0 * k_dq[1][j] + 2.0 * k_dq[2][j] + k_dq[3][j]);
+    }
+  }
+
+  // The momentum is expressed in the rotating base frame, so the norms are compared
+  const ArticulatedBodyMomentum final = system.CalcMomentum(base_velocity, angles, rates);
+  const double final_energy_J = final.kinetic_energy_J_ + system.CalcJointPotentialEnergy_J(angles);
+  EXPECT_NEAR(initial.angular_momentum_Nms_.CalcNorm(), final.angular_momentum_Nms_.CalcNorm(), 1e-9);
+  EXPECT_NEAR(initial.linear_momentum_Ns_.CalcNorm(), final.linear_momentum_Ns_.CalcNorm(), 1e-9);
+  EXPECT_NEAR(initial_energy_J, final_energy_J, 1e-9);
+  // The joints are actually moved
+  EXPECT_GT(fabs(angles[2]), 0.1);
+}
+
+/**
+ * @brief Test for the constructor with the wrong order of the bodies
+ */
+TEST(ArticulatedBodySystem, WrongBodyOrder) {
+  const ArticulatedBody base = MakeBody(0, libra::Vector<3>(0.0), libra::Vector<3>(0.0), 1.0, libra::Vector<3>(0.0), libra::Vector<3>(1.0));
+  const ArticulatedBody appendage = MakeBody(2, libra::Vector<3>(0.0), MakeVector(1.0, 0.0, 0.0), 1.0, libra::Vector<3>(0.0), libra::Vector<3>(1.0));
+  EXPECT_THROW(ArticulatedBodySystem({base, appendage, appendage}), std::invalid_argument);
+  EXPECT_THROW(ArticulatedBodySystem(std::vector<ArticulatedBody>()), std::invalid_argument);
+}
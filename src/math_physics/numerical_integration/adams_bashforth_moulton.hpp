@@ -0,0 +1,93 @@
+/**
+ * @file adams_bashforth_moulton.hpp
+ * @brief Class for 4th order Adams-Bashforth-Moulton predictor-corrector method
+ * @note Ref: E. Hairer, S. P. Norsett, and G. Wanner, "Solving Ordinary Differential Equations I", Section III.1, 1993
+ *            O. Montenbruck and E. Gill, "Satellite Orbits", Section 4.2.3, 2000
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_HPP_
+
+#include <array>
+
+#include "numerical_integrator.hpp"
+#include "runge_kutta_4.hpp"
+
+namespace libra::numerical_integration {
+
+/**
+ * @class AdamsBashforthMoulton
+ * @brief Class for 4th order Adams-Bashforth-Moulton predictor-corrector method
+ * @details The derivative function is evaluated twice per step (PECE mode) while the RK4 needs four evaluations.
+ *          The first steps after the state setting or the step width change are integrated with RK4 to fill the derivative history.
+ */
+template <size_t N>
+class AdamsBashforthMoulton : public NumericalIntegrator<N> {
+ public:
+  /**
+   * @fn AdamsBashforthMoulton
+   * @brief Constructor
+   * @param [in] step_width: Step width
+   * @param [in] ode: Ordinary differential equation
+   */
+  AdamsBashforthMoulton(const double step_width, const InterfaceOde<N>& ode);
+
+  /**
+   * @fn Integrate
+   * @brief Update the state vector with the numerical integration
+   */
+  void Integrate() override;
+  /**
+   * @fn CalcInterpolationState
+   * @brief Calculate interpolation state with the cubic Hermite polynomial of the stored derivatives
+   * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
+   * @return : interpolated state x(t0 + sigma * h)
+   */
+  Vector<N> CalcInterpolationState(const double sigma) const override;
+
+  /**
+   * @fn IsStartingUp
+   * @brief Return true when the next step is integrated with RK4 for the startup
+   */
+  inline bool IsStartingUp() const { return !IsHistoryConsistent() || number_of_derivatives_ < kNumberOfSteps; }
+
+ private:
+  static const size_t kNumberOfSteps = 4;                //!< Number of the derivatives used in the predictor
+  static constexpr double kStepWidthTolerance = 1.0e-9;  //!< Relative tolerance to treat the step width as unchanged
+
+  RungeKutta4<N> startup_integrator_;                         //!< Integrator for the startup steps
+  std::array<Vector<N>, kNumberOfSteps> derivative_history_;  //!< Ring buffer of the derivatives at the latest steps
+  size_t latest_derivative_index_ = 0;                        //!< Index of the latest derivative in the ring buffer
+  size_t number_of_derivatives_ = 0;                          //!< Number of the valid derivatives in the ring buffer
+  Vector<N> predicted_state_;                                 //!< Buffer of the predicted state
+  Vector<N> predicted_derivative_;                            //!< Buffer of the derivative at the predicted state
+  double history_step_width_;                                 //!< Step width of the derivative history
+  double history_independent_variable_;                       //!< Independent variable of the latest derivative
+  Vector<N> history_state_;                                   //!< State of the latest derivative
+
+  /**
+   * @fn GetPastDerivative
+   * @brief Return the derivative at the past step
+   * @param [in] steps_before: Number of the steps before the latest one
+   */
+  inline const Vector<N>& GetPastDerivative(const size_t steps_before) const {
+    return derivative_history_[(latest_derivative_index_ + steps_before) % kNumberOfSteps];
+  }
+  /**
+   * @fn PushDerivative
+   * @brief Calculate the derivative at the current state and store it as the latest one
+   */
+  void PushDerivative();
+
+  /**
+   * @fn IsHistoryConsistent
+   * @brief Return false when the state is set from outside after the last integration
+   */
+  bool IsHistoryConsistent() const;
+};
+
+}  // namespace libra::numerical_integration
+
+#include "adams_bashforth_moulton_implementation.hpp"
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_HPP_
@@ -0,0 +1,107 @@
+/**
+ * @file adams_bashforth_moulton_implementation.hpp
+ * @brief Implementation of 4th order Adams-Bashforth-Moulton predictor-corrector method
+ * @note Ref: E. Hairer, S. P. Norsett, and G. Wanner, "Solving Ordinary Differential Equations I", Section III.1, 1993
+ *            O. Montenbruck and E. Gill, "Satellite Orbits", Section 4.2.3, 2000
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_IMPLEMENTATION_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_IMPLEMENTATION_HPP_
+
+#include <cmath>
+
+#include "adams_bashforth_moulton.hpp"
+
+namespace libra::numerical_integration {
+
+template <size_t N>
+AdamsBashforthMoulton<N>::AdamsBashforthMoulton(const double step_width, const InterfaceOde<N>& ode)
+    : NumericalIntegrator<N>(step_width, ode),
+      startup_integrator_(step_width, ode),
+      predicted_state_(0.0),
+      predicted_derivative_(0.0),
+      history_step_width_(step_width),
+      history_independent_variable_(0.0),
+      history_state_(0.0) {
+  derivative_history_.fill(Vector<N>(0.0));
+}
+
+template <size_t N>
+void AdamsBashforthMoulton<N>::Integrate() {
+  const double step_width = this->step_width_;
+  if (!IsHistoryConsistent()) {
+    number_of_derivatives_ = 0;
+    PushDerivative();
+  } else if (fabs(step_width - history_step_width_) > kStepWidthTolerance * fabs(history_step_width_)) {
+    // The past derivatives are not on the new grid. Only the latest one is still valid.
+    number_of_derivatives_ = 1;
+  }
+
+  this->previous_state_ = this->current_state_;
+  if (IsStartingUp()) {
+    startup_integrator_.SetStepWidth(step_width);
+    startup_integrator_.SetState(this->current_independent_variable_, this->current_state_);
+    startup_integrator_.Integrate();
+    this->current_state_ = startup_integrator_.GetState();
+  } else {
+    const Vector<N>& f0 = GetPastDerivative(0);
+    const Vector<N>& f1 = GetPastDerivative(1);
+    const Vector<N>& f2 = GetPastDerivative(2);
+    const Vector<N>& f3 = GetPastDerivative(3);
+    const double h24 = step_width / 24.0;
+    // Predictor (Adams-Bashforth)
+    for (size_t n = 0; n < N; n++) {
+      predicted_state_[n] = this->current_state_[n] + h24 * (55.0 * f0[n] - 59.0 * f1[n] + 37.0 * f2[n] - 9.0 * f3[n]);
+    }
+    // Evaluation and Corrector (Adams-Moulton)
+    this->ode_.CalcDerivative(this->current_independent_variable_ + step_width, predicted_state_, predicted_derivative_);
+    for (size_t n = 0; n < N; n++) {
+      this->current_state_[n] += h24 * (9.0 * predicted_derivative_[n] + 19.0 * f0[n] - 5.0 * f1[n] + f2[n]);
+    }
+  }
+  this->previous_independent_variable_ = this->current_independent_variable_;
+  this->last_step_width_ = step_width;
+  this->current_independent_variable_ += step_width;
+
+  // Evaluation for the next step
+  PushDerivative();
+  history_step_width_ = step_width;
+  history_independent_variable_ = this->current_independent_variable_;
+  history_state_ = this->current_state_;
+}
+
+template <size_t N>
+Vector<N> AdamsBashforthMoulton<N>::CalcInterpolationState(const double sigma) const {
+  if (number_of_derivatives_ < 2 || !IsHistoryConsistent()) return this->current_state_;
+
+  const double sigma2 = sigma * sigma;
+  const double sigma3 = sigma2 * sigma;
+  const double h00 = 2.0 * sigma3 - 3.0 * sigma2 + 1.0;
+  const double h10 = sigma3 - 2.0 * sigma2 + sigma;
+  const double h01 = -2.0 * sigma3 + 3.0 * sigma2;
+  const double h11 = sigma3 - sigma2;
+
+  return h00 * this->previous_state_ + (h10 * this->last_step_width_) * GetPastDerivative(1) + h01 * this->current_state_ +
+         (h11 * this->last_step_width_) * GetPastDerivative(0);
+}
+
+template <size_t N>
+void AdamsBashforthMoulton<N>::PushDerivative() {
+  latest_derivative_index_ = (latest_derivative_index_ + kNumberOfSteps - 1) % kNumberOfSteps;
+  this->ode_.CalcDerivative(this->current_independent_variable_, this->current_state_, derivative_history_[latest_derivative_index_]);
+  if (number_of_derivatives_ < kNumberOfSteps) number_of_derivatives_++;
+}
+
+template <size_t N>
+bool AdamsBashforthMoulton<N>::IsHistoryConsistent() const {
+  if (number_of_derivatives_ == 0) return false;
+  if (history_independent_variable_ != this->current_independent_variable_) return false;
+  for (size_t i = 0; i < N; i++) {
+    if (history_state_[i] != this->current_state_[i]) return false;
+  }
+  return true;
+}
+
+}  // namespace libra::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_ADAMS_BASHFORTH_MOULTON_IMPLEMENTATION_HPP_
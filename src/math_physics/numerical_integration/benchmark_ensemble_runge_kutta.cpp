@@ -0,0 +1,77 @@
+/**
+ * @file benchmark_ensemble_runge_kutta.cpp
+ * @brief Benchmark codes for EnsembleRungeKutta4 class compared with RungeKutta4 for each member
+ */
+#include <iostream>
+#include <utilities/benchmark_measurement.hpp>
+#include <vector>
+
+#include "ensemble_runge_kutta_4.hpp"
+#include "ode_examples.hpp"
+#include "runge_kutta_4.hpp"
+
+/**
+ * @fn MeasureEnsemble
+ * @brief Measure the integration time per member and step for the ensemble and each member integration
+ * @param [in] ode: Ensemble of ordinary differential equations
+ * @param [in] initial_state: Initial state of the members
+ * @param [in] step_width: Step width
+ * @param [in] number_of_members: Number of members
+ */
+template <size_t N>
+void MeasureEnsemble(const libra::numerical_integration::InterfaceEnsembleOde<N>& ode, const libra::Vector<N>& initial_state, const double step_width,
+                     const size_t number_of_members) {
+  libra::numerical_integration::SingleMemberOde<N> single_ode(ode);
+  std::vector<libra::numerical_integration::RungeKutta4<N>> integrators;
+  libra::numerical_integration::EnsembleRungeKutta4<N> ensemble(step_width, number_of_members, ode);
+  for (size_t m = 0; m < number_of_members; m++) {
+    integrators.emplace_back(step_width, single_ode);
+    integrators[m].SetState(0.0, initial_state);
+    ensemble.SetState(m, initial_state);
+  }
+
+  // Keep the number of member steps roughly constant
+  const size_t number_of_calls = 2000000 / number_of_members + 10;
+  const double each_ns = MeasureNanosecondsPerCall(
+                             [&]() {
+                               for (auto& integrator : integrators) integrator.Integrate();
+                             },
+                             number_of_calls) /
+                         (double)number_of_members;
+  const double ensemble_ns = MeasureNanosecondsPerCall([&]() { ensemble.Integrate(); }, number_of_calls) / (double)number_of_members;
+
+  std::cout << number_of_members << ", " << each_ns << ", " << ensemble_ns << ", " << each_ns / ensemble_ns << std::endl;
+  // Use the results to avoid optimization
+  if (integrators[0].GetState()[0] != integrators[0].GetState()[0] || ensemble.GetState(0)[0] != ensemble.GetState(0)[0]) {
+    std::cout << "NaN detected" << std::endl;
+  }
+}
+
+int main() {
+  const std::vector<size_t> numbers_of_members = {1, 16, 256, 4096};
+
+  std::cout << "Two body orbit with J2" << std::endl;
+  std::cout << "members, each RK4 [ns/member/step], ensemble RK4 [ns/member/step], speed up" << std::endl;
+  libra::numerical_integration::ExampleEnsembleTwoBodyJ2OrbitOde orbit_ode;
+  libra::Vector<6> orbit_state(0.0);
+  orbit_state[0] = 6778137.0;
+  orbit_state[4] = 5000.0;
+  orbit_state[5] = 5814.0;
+  for (size_t number_of_members : numbers_of_members) {
+    MeasureEnsemble(orbit_ode, orbit_state, 1.0e-3, number_of_members);
+  }
+
+  std::cout << "Torque free rigid body" << std::endl;
+  std::cout << "members, each RK4 [ns/member/step], ensemble RK4 [ns/member/step], speed up" << std::endl;
+  libra::numerical_integration::ExampleEnsembleRigidBodyOde attitude_ode(1.0, 2.0, 3.0);
+  libra::Vector<7> attitude_state(0.0);
+  attitude_state[0] = 0.1;
+  attitude_state[1] = 0.02;
+  attitude_state[2] = 0.05;
+  attitude_state[6] = 1.0;
+  for (size_t number_of_members : numbers_of_members) {
+    MeasureEnsemble(attitude_ode, attitude_state, 1.0e-3, number_of_members);
+  }
+
+  return 0;
+}
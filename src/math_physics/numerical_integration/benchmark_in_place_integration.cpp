@@ -0,0 +1,49 @@
+/**
+ * @file benchmark_in_place_integration.cpp
+ * @brief Benchmark codes for the calculation time of the derivative calculation in place compared with the return value version
+ */
+#include <iostream>
+#include <string>
+#include <utilities/benchmark_measurement.hpp>
+
+#include "numerical_integrator_manager.hpp"
+#include "ode_examples.hpp"
+
+/**
+ * @fn MeasureIntegration
+ * @brief Measure the calculation time of a step of the integrator
+ * @param [in] step_width_s: Step width [s]
+ * @param [in] ode: Ordinary differential equation
+ * @param [in] method: Integration method
+ * @return Calculation time [ns/step]
+ */
+double MeasureIntegration(const double step_width_s, const libra::numerical_integration::InterfaceOde<6>& ode,
+                          const libra::numerical_integration::NumericalIntegrationMethod method) {
+  libra::Vector<6> initial_state(0.0);
+  initial_state[0] = 1.0;
+  initial_state[4] = 1.0;
+
+  libra::numerical_integration::NumericalIntegratorManager<6> integrator(step_width_s, ode, method);
+  integrator.GetIntegrator()->SetState(0.0, initial_state);
+  return MeasureNanosecondsPerCall([&]() { integrator.GetIntegrator()->Integrate(); }, 1000000);
+}
+
+int main() {
+  const double step_width_s = 0.001;
+  libra::numerical_integration::ExampleHarmonicOscillatorOde ode;
+  libra::numerical_integration::ExampleHarmonicOscillatorInPlaceOde in_place_ode;
+
+  const libra::numerical_integration::NumericalIntegrationMethod methods[] = {libra::numerical_integration::NumericalIntegrationMethod::kRk4,
+                                                                              libra::numerical_integration::NumericalIntegrationMethod::kDp5,
+                                                                              libra::numerical_integration::NumericalIntegrationMethod::kAbm};
+  const std::string names[] = {"RK4", "DP5", "ABM"};
+
+  std::cout << "integrator, return value [ns/step], in place [ns/step]" << std::endl;
+  for (size_t i = 0; i < 3; i++) {
+    const double value_ns = MeasureIntegration(step_width_s, ode, methods[i]);
+    const double in_place_ns = MeasureIntegration(step_width_s, in_place_ode, methods[i]);
+    std::cout << names[i] << ", " << value_ns << ", " << in_place_ns << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file benchmark_orbit_integrators.cpp
+ * @brief Benchmark codes for the calculation time and the accuracy of the integrators for one revolution of the two body orbit
+ */
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utilities/benchmark_measurement.hpp>
+#include <vector>
+
+#include "../math/constants.hpp"
+#include "dormand_prince_5.hpp"
+#include "ode_examples.hpp"
+#include "runge_kutta_4.hpp"
+#include "runge_kutta_fehlberg.hpp"
+
+/**
+ * @fn CalcCircularOrbitError
+ * @brief Return the position error after one revolution of the normalized circular orbit
+ * @param [in] state: State after one revolution
+ */
+double CalcCircularOrbitError(const libra::Vector<4>& state) {
+  const double dx = state[0] - 1.0;
+  const double dy = state[1];
+  return sqrt(dx * dx + dy * dy);
+}
+
+/**
+ * @fn MeasureFixedStep
+ * @brief Measure the calculation time and the accuracy of the fixed step integration for one revolution
+ * @param [in] name: Name of the integrator
+ * @param [in] integrator: Integrator
+ * @param [in] initial_state: Initial state
+ * @param [in] number_of_steps: Number of steps per revolution
+ */
+void MeasureFixedStep(const std::string name, libra::numerical_integration::NumericalIntegrator<4>& integrator, const libra::Vector<4>& initial_state,
+                      const size_t number_of_steps) {
+  integrator.SetStepWidth(libra::tau / (double)number_of_steps);
+  integrator.SetState(0.0, initial_state);
+  for (size_t i = 0; i < number_of_steps; i++) integrator.Integrate();
+  const double error = CalcCircularOrbitError(integrator.GetState());
+
+  const double step_ns = MeasureNanosecondsPerCall([&]() { integrator.Integrate(); }, 1000000);
+  std::cout << name << ", " << number_of_steps << ", " << step_ns << ", " << step_ns * (double)number_of_steps * 1e-3 << ", " << error << std::endl;
+}
+
+int main() {
+  // Normalized circular orbit (mu = 1, radius = 1) whose period is 2 pi
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::Vector<4> initial_state(0.0);
+  initial_state[0] = 1.0;
+  initial_state[3] = 1.0;
+
+  libra::numerical_integration::RungeKutta4<4> rk4(1.0, ode);
+  libra::numerical_integration::RungeKuttaFehlberg<4> rkf(1.0, ode);
+  libra::numerical_integration::DormandPrince5<4> dp5(1.0, ode);
+
+  std::cout << "integrator, steps per revolution, step [ns/step], revolution [us], position error" << std::endl;
+  const std::vector<size_t> numbers_of_steps = {64, 256, 1024};
+  for (size_t number_of_steps : numbers_of_steps) {
+    MeasureFixedStep("RK4", rk4, initial_state, number_of_steps);
+    MeasureFixedStep("RKF45", rkf, initial_state, number_of_steps);
+    MeasureFixedStep("DP5", dp5, initial_state, number_of_steps);
+  }
+
+  // Step width control with the local truncation error
+  std::cout << "integrator, error tolerance, steps per revolution, revolution [us], position error" << std::endl;
+  const std::vector<double> error_tolerances = {1e-6, 1e-9, 1e-12};
+  for (double error_tolerance : error_tolerances) {
+    size_t number_of_steps = 0;
+    const size_t number_of_revolutions = 100;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t revolution = 0; revolution < number_of_revolutions; revolution++) {
+      dp5.SetState(0.0, initial_state);
+      dp5.SetStepWidth(0.1);
+      number_of_steps = 0;
+      while (dp5.GetCurrentIndependentVariable() < libra::tau) {
+        dp5.SetStepWidth(std::min(dp5.GetStepWidth(), libra::tau - dp5.GetCurrentIndependentVariable()));
+        dp5.Integrate();
+        dp5.ControlStepWidth(error_tolerance);
+        number_of_steps++;
+      }
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    const double revolution_us =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) * 1e-3 / (double)number_of_revolutions;
+    std::cout << "DP5 adaptive, " << error_tolerance << ", " << number_of_steps << ", " << revolution_us << ", "
+              << CalcCircularOrbitError(dp5.GetState()) << std::endl;
+  }
+
+  return 0;
+}
@@ -128,7 +128,7 @@ Vector<N> DormandPrince5<N>::CalcInterpolationState(const double sigma) const {
 
   Vector<N> interpolation_state = this->previous_state_;
   for (size_t i = 0; i < this->number_of_stages_; i++) {
-    interpolation_state = interpolation_state + (sigma * this->step_width_ * interpolation_weights[i]) * this->slope_[i];
+    interpolation_state = interpolation_state + (sigma * this->last_step_width_ * interpolation_weights[i]) * this->slope_[i];
   }
 
   return interpolation_state;
@@ -13,20 +13,24 @@ template <size_t N>
 void EmbeddedRungeKutta<N>::Integrate() {
   this->CalcSlope();
 
+  // The difference of the lower order (eta) and the higher order (eta_hat) solutions is accumulated for the error evaluation
   this->previous_state_ = this->current_state_;
-  Vector<N> lower_current_state = this->current_state_;   //!< eta in the equation
-  Vector<N> higher_current_state = this->current_state_;  //!< eta_hat in the equation
+  Vector<N> truncation_error(0.0);
   for (size_t i = 0; i < this->number_of_stages_; i++) {
-    lower_current_state = lower_current_state + this->weights_[i] * this->step_width_ * this->slope_[i];
-    higher_current_state = higher_current_state + higher_order_weights_[i] * this->step_width_ * this->slope_[i];
+    const double lower_coefficient = this->weights_[i] * this->step_width_;
+    const double higher_coefficient = higher_order_weights_[i] * this->step_width_;
+    for (size_t n = 0; n < N; n++) {
+      truncation_error[n] += (lower_coefficient - higher_coefficient) * this->slope_[i][n];
+      this->current_state_[n] += higher_coefficient * this->slope_[i][n];
+    }
   }
 
   // Error evaluation
-  Vector<N> truncation_error = lower_current_state - higher_current_state;
   local_truncation_error_ = truncation_error.CalcNorm();
 
   // State update
-  this->current_state_ = higher_current_state;
+  this->previous_independent_variable_ = this->current_independent_variable_;
+  this->last_step_width_ = this->step_width_;
   this->current_independent_variable_ += this->step_width_;
 }
 
@@ -0,0 +1,113 @@
+/**
+ * @file ensemble_runge_kutta_4.hpp
+ * @brief Class for Classical 4th order Runge-Kutta method for ensemble of ordinary differential equations
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_ENSEMBLE_RUNGE_KUTTA_4_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_ENSEMBLE_RUNGE_KUTTA_4_HPP_
+
+#include <vector>
+
+#include "../math/vector.hpp"
+#include "interface_ensemble_ode.hpp"
+
+namespace libra::numerical_integration {
+
+/**
+ * @class EnsembleRungeKutta4
+ * @brief Class for Classical 4th order Runge-Kutta method to integrate many members of the same ODE in lockstep
+ * @details It is used for Monte Carlo or sigma point propagation. All members share the independent variable and the step width.
+ *          The states and the stage buffers are stored in the structure of arrays layout described in InterfaceEnsembleOde,
+ *          and they are allocated in the constructor. So the integration does not allocate memory.
+ */
+template <size_t N>
+class EnsembleRungeKutta4 {
+ public:
+  /**
+   * @fn EnsembleRungeKutta4
+   * @brief Constructor
+   * @param [in] step_width: Step width
+   * @param [in] number_of_members: Number of members
+   * @param [in] ode: Ensemble of ordinary differential equations
+   */
+  EnsembleRungeKutta4(const double step_width, const size_t number_of_members, const InterfaceEnsembleOde<N>& ode);
+
+  /**
+   * @fn Integrate
+   * @brief Update the state vectors of all members with the numerical integration
+   */
+  void Integrate();
+
+  /**
+   * @fn SetIndependentVariable
+   * @brief Set independent variable shared by all members
+   */
+  inline void SetIndependentVariable(const double independent_variable) { current_independent_variable_ = independent_variable; }
+  /**
+   * @fn SetState
+   * @brief Set state vector of a member
+   * @param [in] member: Index of the member
+   * @param [in] state: State vector
+   */
+  void SetState(const size_t member, const Vector<N>& state);
+  /**
+   * @fn SetStepWidth
+   * @brief Set step width used from the next integration
+   */
+  inline void SetStepWidth(const double step_width) { step_width_ = step_width; }
+
+  /**
+   * @fn GetState
+   * @brief Return state vector of a member
+   * @param [in] member: Index of the member
+   */
+  Vector<N> GetState(const size_t member) const;
+  /**
+   * @fn GetComponent
+   * @brief Return the array of a state component of all members
+   * @param [in] component: Index of the state component
+   * @return Pointer to number_of_members elements
+   */
+  inline const double* GetComponent(const size_t component) const { return &current_state_[component * number_of_members_]; }
+  /**
+   * @fn GetStepWidth
+   * @brief Return step width
+   */
+  inline double GetStepWidth() const { return step_width_; }
+  /**
+   * @fn GetCurrentIndependentVariable
+   * @brief Return current independent variable
+   */
+  inline double GetCurrentIndependentVariable() const { return current_independent_variable_; }
+  /**
+   * @fn GetNumberOfMembers
+   * @brief Return number of members
+   */
+  inline size_t GetNumberOfMembers() const { return number_of_members_; }
+
+ private:
+  double step_width_;                    //!< Step width
+  size_t number_of_members_;             //!< Number of members
+  const InterfaceEnsembleOde<N>& ode_;   //!< Ensemble of ordinary differential equations
+  double current_independent_variable_;  //!< Latest value of independent variable
+
+  std::vector<double> current_state_;  //!< Latest state vectors of all members
+  std::vector<double> stage_state_;    //!< Buffer of the state at each stage
+  std::vector<double> slope_;          //!< Buffer of the slope at each stage
+  std::vector<double> increment_;      //!< Buffer of the weighted sum of the slopes
+
+  /**
+   * @fn CalcStage
+   * @brief Calculate the slope at the stage and accumulate it
+   * @param [in] node: Node of the stage (c in the RK equation)
+   * @param [in] weight: Weight of the stage (b in the RK equation)
+   * @param [in] next_coefficient: Coefficient to generate the state of the next stage (a in the RK equation)
+   */
+  void CalcStage(const double node, const double weight, const double next_coefficient);
+};
+
+}  // namespace libra::numerical_integration
+
+#include "ensemble_runge_kutta_4_implementation.hpp"
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_ENSEMBLE_RUNGE_KUTTA_4_HPP_
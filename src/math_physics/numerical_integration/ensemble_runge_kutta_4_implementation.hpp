@@ -0,0 +1,82 @@
+/**
+ * @file ensemble_runge_kutta_4_implementation.hpp
+ * @brief Implementation of Classical 4th order Runge-Kutta method for ensemble of ordinary differential equations
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_ENSEMBLE_RUNGE_KUTTA_4_IMPLEMENTATION_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_ENSEMBLE_RUNGE_KUTTA_4_IMPLEMENTATION_HPP_
+
+#include <algorithm>
+#include <utilities/macros.hpp>
+
+#include "ensemble_runge_kutta_4.hpp"
+
+namespace libra::numerical_integration {
+
+template <size_t N>
+EnsembleRungeKutta4<N>::EnsembleRungeKutta4(const double step_width, const size_t number_of_members, const InterfaceEnsembleOde<N>& ode)
+    : step_width_(step_width), number_of_members_(number_of_members), ode_(ode), current_independent_variable_(0.0) {
+  current_state_.assign(N * number_of_members_, 0.0);
+  stage_state_.assign(N * number_of_members_, 0.0);
+  slope_.assign(N * number_of_members_, 0.0);
+  increment_.assign(N * number_of_members_, 0.0);
+}
+
+template <size_t N>
+void EnsembleRungeKutta4<N>::Integrate() {
+  std::copy(current_state_.begin(), current_state_.end(), stage_state_.begin());
+  std::fill(increment_.begin(), increment_.end(), 0.0);
+
+  // Classical 4th order Runge-Kutta (4-order, 4-stage)
+  CalcStage(0.0, 1.0 / 6.0, 0.5);
+  CalcStage(0.5, 1.0 / 3.0, 0.5);
+  CalcStage(0.5, 1.0 / 3.0, 1.0);
+  CalcStage(1.0, 1.0 / 6.0, 0.0);
+
+  const size_t size = N * number_of_members_;
+  double* RESTRICT current_state = current_state_.data();
+  const double* RESTRICT increment = increment_.data();
+  for (size_t k = 0; k < size; k++) {
+    current_state[k] += increment[k];
+  }
+  current_independent_variable_ += step_width_;
+}
+
+template <size_t N>
+void EnsembleRungeKutta4<N>::CalcStage(const double node, const double weight, const double next_coefficient) {
+  ode_.DerivativeFunction(current_independent_variable_ + node * step_width_, number_of_members_, stage_state_.data(), slope_.data());
+
+  const size_t size = N * number_of_members_;
+  const double weighted_step = weight * step_width_;
+  const double next_step = next_coefficient * step_width_;
+  const double* RESTRICT current_state = current_state_.data();
+  const double* RESTRICT slope = slope_.data();
+  double* RESTRICT stage_state = stage_state_.data();
+  double* RESTRICT increment = increment_.data();
+  for (size_t k = 0; k < size; k++) {
+    increment[k] += weighted_step * slope[k];
+    stage_state[k] = current_state[k] + next_step * slope[k];
+  }
+}
+
+template <size_t N>
+void EnsembleRungeKutta4<N>::SetState(const size_t member, const Vector<N>& state) {
+  if (member >= number_of_members_) return;
+  for (size_t i = 0; i < N; i++) {
+    current_state_[i * number_of_members_ + member] = state[i];
+  }
+}
+
+template <size_t N>
+Vector<N> EnsembleRungeKutta4<N>::GetState(const size_t member) const {
+  Vector<N> state(0.0);
+  if (member >= number_of_members_) return state;
+  for (size_t i = 0; i < N; i++) {
+    state[i] = current_state_[i * number_of_members_ + member];
+  }
+  return state;
+}
+
+}  // namespace libra::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_ENSEMBLE_RUNGE_KUTTA_4_IMPLEMENTATION_HPP_
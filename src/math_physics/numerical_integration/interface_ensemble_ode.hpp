@@ -0,0 +1,66 @@
+/**
+ * @file interface_ensemble_ode.hpp
+ * @brief Interface class for ensemble of ordinary differential equations
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_INTERFACE_ENSEMBLE_ODE_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_INTERFACE_ENSEMBLE_ODE_HPP_
+
+#include <cstddef>
+
+#include "interface_ode.hpp"
+
+namespace libra::numerical_integration {
+
+/**
+ * @class InterfaceEnsembleOde
+ * @brief Interface class for ensemble of ordinary differential equations which have the same form
+ * @details The states of the members are stored in the structure of arrays layout.
+ *          The i-th component of the m-th member is stored at [i * number_of_members + m].
+ *          The derivative function should loop over the members in the innermost loop so that the compiler can vectorize it.
+ */
+template <size_t N>
+class InterfaceEnsembleOde {
+ public:
+  /**
+   * @fn DerivativeFunction
+   * @brief Pure virtual function to define the difference equation for all members
+   * @param [in] independent_variable: Independent variable
+   * @param [in] number_of_members: Number of members
+   * @param [in] state: State vectors of all members (N * number_of_members elements)
+   * @param [out] derivative: Differentiated values of the state vectors of all members (N * number_of_members elements)
+   */
+  virtual void DerivativeFunction(const double independent_variable, const size_t number_of_members, const double* state,
+                                  double* derivative) const = 0;
+};
+
+/**
+ * @class SingleMemberOde
+ * @brief Adapter to use an ensemble ODE as an ODE for one member with the integrators for InterfaceOde
+ */
+template <size_t N>
+class SingleMemberOde : public InterfaceOde<N> {
+ public:
+  /**
+   * @fn SingleMemberOde
+   * @brief Constructor
+   * @param [in] ensemble_ode: Ensemble of ordinary differential equations
+   */
+  explicit SingleMemberOde(const InterfaceEnsembleOde<N>& ensemble_ode) : ensemble_ode_(ensemble_ode) {}
+
+  virtual Vector<N> DerivativeFunction(const double independent_variable, const Vector<N>& state) const {
+    Vector<N> derivative(0.0);
+    CalcDerivative(independent_variable, state, derivative);
+    return derivative;
+  }
+  virtual void CalcDerivative(const double independent_variable, const Vector<N>& state, Vector<N>& derivative) const {
+    ensemble_ode_.DerivativeFunction(independent_variable, 1, state, derivative);
+  }
+
+ private:
+  const InterfaceEnsembleOde<N>& ensemble_ode_;  //!< Ensemble of ordinary differential equations
+};
+
+}  // namespace libra::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_INTERFACE_ENSEMBLE_ODE_HPP_
@@ -25,6 +25,18 @@ class InterfaceOde {
    * @return Differentiated value of state vector
    */
   virtual Vector<N> DerivativeFunction(const double independent_variable, const Vector<N>& state) const = 0;
+  /**
+   * @fn CalcDerivative
+   * @brief Calculate the derivative into the storage owned by the caller
+   * @note The integrators call this function with their preallocated stage buffers.
+   *       Override this to write the derivative in place when the return value copy of DerivativeFunction is not negligible.
+   * @param [in] independent_variable: Independent variable
+   * @param [in] state: State vector
+   * @param [out] derivative: Differentiated value of state vector
+   */
+  virtual void CalcDerivative(const double independent_variable, const Vector<N>& state, Vector<N>& derivative) const {
+    derivative = DerivativeFunction(independent_variable, state);
+  }
 };
 
 }  // namespace libra::numerical_integration
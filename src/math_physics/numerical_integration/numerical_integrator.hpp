@@ -27,7 +27,13 @@ class NumericalIntegrator {
    * @param [in] ode: Ordinary differential equation
    */
   inline NumericalIntegrator(const double step_width, const InterfaceOde<N>& ode)
-      : step_width_(step_width), ode_(ode), current_independent_variable_(0.0), current_state_(0.0), previous_state_(0.0) {}
+      : step_width_(step_width),
+        ode_(ode),
+        current_independent_variable_(0.0),
+        previous_independent_variable_(0.0),
+        last_step_width_(0.0),
+        current_state_(0.0),
+        previous_state_(0.0) {}
   /**
    * @fn ~NumericalIntegrator
    * @brief Destructor
@@ -46,15 +52,37 @@ class NumericalIntegrator {
    */
   inline void SetState(const double independent_variable, const Vector<N>& state) {
     current_independent_variable_ = independent_variable;
+    previous_independent_variable_ = independent_variable;
+    last_step_width_ = 0.0;
     current_state_ = state;
     previous_state_ = state;
   }
 
+  /**
+   * @fn SetStepWidth
+   * @brief Set step width used from the next integration
+   */
+  inline void SetStepWidth(const double step_width) { step_width_ = step_width; }
+  /**
+   * @fn GetStepWidth
+   * @brief Return step width
+   */
+  inline double GetStepWidth() const { return step_width_; }
   /**
    * @fn GetState
    * @brief Return current state vector
    */
   inline const Vector<N>& GetState() const { return current_state_; }
+  /**
+   * @fn GetCurrentIndependentVariable
+   * @brief Return independent variable at the end of the last step
+   */
+  inline double GetCurrentIndependentVariable() const { return current_independent_variable_; }
+  /**
+   * @fn GetPreviousIndependentVariable
+   * @brief Return independent variable at the start of the last step
+   */
+  inline double GetPreviousIndependentVariable() const { return previous_independent_variable_; }
 
   /**
    * @fn CalcInterpolationState
@@ -63,16 +91,29 @@ class NumericalIntegrator {
    * @return : interpolated state x(t0 + sigma * h)
    */
   virtual Vector<N> CalcInterpolationState(const double sigma) const = 0;
+  /**
+   * @fn CalcInterpolationStateAt
+   * @brief Calculate interpolation state at the independent variable inside the last step
+   * @note The dense output uses only the slopes of the last step. It does not need any additional integration.
+   * @param [in] independent_variable: Target independent variable between GetPreviousIndependentVariable and GetCurrentIndependentVariable
+   * @return : interpolated state. The current state is returned when no step is integrated after SetState.
+   */
+  inline Vector<N> CalcInterpolationStateAt(const double independent_variable) const {
+    if (last_step_width_ == 0.0) return current_state_;
+    return CalcInterpolationState((independent_variable - previous_independent_variable_) / last_step_width_);
+  }
 
  protected:
   // Settings
   double step_width_;  //!< Step width. The unit is depending on the independent variable
 
   // States
-  const InterfaceOde<N>& ode_;           //!< Ordinary differential equation
-  double current_independent_variable_;  //!< Latest value of independent variable
-  Vector<N> current_state_;              //!< Latest state vector
-  Vector<N> previous_state_;             //!< Previous state vector
+  const InterfaceOde<N>& ode_;            //!< Ordinary differential equation
+  double current_independent_variable_;   //!< Latest value of independent variable
+  double previous_independent_variable_;  //!< Independent variable at the start of the last step
+  double last_step_width_;                //!< Step width used in the last step. The interpolation uses this instead of step_width_.
+  Vector<N> current_state_;               //!< Latest state vector
+  Vector<N> previous_state_;              //!< Previous state vector
 };
 
 }  // namespace libra::numerical_integration
@@ -8,6 +8,7 @@
 
 #include <memory>
 
+#include "adams_bashforth_moulton.hpp"
 #include "dormand_prince_5.hpp"
 #include "runge_kutta_4.hpp"
 #include "runge_kutta_fehlberg.hpp"
@@ -22,6 +23,7 @@ enum class NumericalIntegrationMethod {
   kRk4 = 0,  //!< 4th order Runge-Kutta
   kRkf,      //!< Runge-Kutta-Fehlberg
   kDp5,      //!< 5th order Dormand and Prince
+  kAbm,      //!< 4th order Adams-Bashforth-Moulton predictor-corrector
 };
 
 /**
@@ -48,6 +50,9 @@ class NumericalIntegratorManager {
       case NumericalIntegrationMethod::kDp5:
         integrator_ = std::make_shared<DormandPrince5<N>>(step_width, ode);
         break;
+      case NumericalIntegrationMethod::kAbm:
+        integrator_ = std::make_shared<AdamsBashforthMoulton<N>>(step_width, ode);
+        break;
       default:
         integrator_ = std::make_shared<RungeKutta4<N>>(step_width, ode);
         break;
@@ -6,7 +6,11 @@
 #ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_EXAMPLE_ODE_HPP_
 #define S2E_LIBRARY_NUMERICAL_INTEGRATION_EXAMPLE_ODE_HPP_
 
+#include <cfloat>
+#include <cmath>
+
 #include "../../utilities/macros.hpp"
+#include "interface_ensemble_ode.hpp"
 #include "interface_ode.hpp"
 
 namespace libra::numerical_integration {
@@ -75,7 +79,7 @@ class Example2dTwoBodyOrbitOde : public InterfaceOde<4> {
     output[1] = state[3];
     double denominator = pow(state[0] * state[0] + state[1] * state[1], 3.0 / 2.0);
     double inverse_square;
-    if (abs(denominator) <= DBL_EPSILON) {
+    if (fabs(denominator) <= DBL_EPSILON) {
       inverse_square = 0.0;  // singular
     } else {
       inverse_square = 1.0 / denominator;
@@ -86,6 +90,157 @@ class Example2dTwoBodyOrbitOde : public InterfaceOde<4> {
   }
 };
 
+/**
+ * @class ExampleHarmonicOscillatorOde
+ * @brief Class for 3D harmonic oscillator implementation example
+ */
+class ExampleHarmonicOscillatorOde : public InterfaceOde<6> {
+ public:
+  virtual Vector<6> DerivativeFunction(const double time_s, const Vector<6>& state) const {
+    UNUSED(time_s);
+
+    Vector<6> output(0.0);
+    for (size_t i = 0; i < 3; i++) {
+      output[i] = state[i + 3];
+      output[i + 3] = -1.0 * state[i];
+    }
+    return output;
+  }
+};
+
+/**
+ * @class ExampleHarmonicOscillatorInPlaceOde
+ * @brief Class for 3D harmonic oscillator implementation example which writes the derivative in place
+ */
+class ExampleHarmonicOscillatorInPlaceOde : public ExampleHarmonicOscillatorOde {
+ public:
+  virtual void CalcDerivative(const double time_s, const Vector<6>& state, Vector<6>& derivative) const {
+    UNUSED(time_s);
+
+    for (size_t i = 0; i < 3; i++) {
+      derivative[i] = state[i + 3];
+      derivative[i + 3] = -1.0 * state[i];
+    }
+  }
+};
+
+/**
+ * @class ExampleEnsembleTwoBodyJ2OrbitOde
+ * @brief Class for ensemble of the orbit equation of motion with the J2 term implementation example
+ * @note The state of each member is position [m] and velocity [m/s] in the inertial frame
+ */
+class ExampleEnsembleTwoBodyJ2OrbitOde : public InterfaceEnsembleOde<6> {
+ public:
+  /**
+   * @fn ExampleEnsembleTwoBodyJ2OrbitOde
+   * @brief Constructor
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] j2: J2 coefficient
+   * @param [in] radius_m: Equatorial radius [m]
+   */
+  ExampleEnsembleTwoBodyJ2OrbitOde(const double gravity_constant_m3_s2 = 3.986004418e14, const double j2 = 1.08262668e-3,
+                                   const double radius_m = 6378137.0)
+      : gravity_constant_m3_s2_(gravity_constant_m3_s2), j2_(j2), radius_m_(radius_m) {}
+
+  virtual void DerivativeFunction(const double time_s, const size_t number_of_members, const double* state, double* derivative) const {
+    UNUSED(time_s);
+
+    const double* RESTRICT x = state;
+    const double* RESTRICT y = state + number_of_members;
+    const double* RESTRICT z = state + 2 * number_of_members;
+    const double* RESTRICT vx = state + 3 * number_of_members;
+    const double* RESTRICT vy = state + 4 * number_of_members;
+    const double* RESTRICT vz = state + 5 * number_of_members;
+    double* RESTRICT dx = derivative;
+    double* RESTRICT dy = derivative + number_of_members;
+    double* RESTRICT dz = derivative + 2 * number_of_members;
+    double* RESTRICT dvx = derivative + 3 * number_of_members;
+    double* RESTRICT dvy = derivative + 4 * number_of_members;
+    double* RESTRICT dvz = derivative + 5 * number_of_members;
+    // The members are copied to the local variables to tell the compiler that they are not modified in the loop
+    const double gravity_constant_m3_s2 = gravity_constant_m3_s2_;
+    const double coefficient = 1.5 * j2_ * radius_m_ * radius_m_;
+    for (size_t m = 0; m < number_of_members; m++) {
+      dx[m] = vx[m];
+      dy[m] = vy[m];
+      dz[m] = vz[m];
+
+      const double r2 = x[m] * x[m] + y[m] * y[m] + z[m] * z[m];
+      const double inverse_r2 = 1.0 / r2;
+      const double mu_r3 = gravity_constant_m3_s2 * inverse_r2 / sqrt(r2);
+      const double j2_term = coefficient * inverse_r2;
+      const double z2_r2 = 5.0 * z[m] * z[m] * inverse_r2;
+      dvx[m] = -mu_r3 * x[m] * (1.0 + j2_term * (1.0 - z2_r2));
+      dvy[m] = -mu_r3 * y[m] * (1.0 + j2_term * (1.0 - z2_r2));
+      dvz[m] = -mu_r3 * z[m] * (1.0 + j2_term * (3.0 - z2_r2));
+    }
+  }
+
+ private:
+  double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
+  double j2_;                      //!< J2 coefficient
+  double radius_m_;                //!< Equatorial radius [m]
+};
+
+/**
+ * @class ExampleEnsembleRigidBodyOde
+ * @brief Class for ensemble of the torque free rigid body attitude dynamics and kinematics implementation example
+ * @note The state of each member is angular velocity [rad/s] and quaternion (x, y, z, w) same as AttitudeRk4
+ */
+class ExampleEnsembleRigidBodyOde : public InterfaceEnsembleOde<7> {
+ public:
+  /**
+   * @fn ExampleEnsembleRigidBodyOde
+   * @brief Constructor
+   * @param [in] inertia_x_kgm2: Principal moment of inertia around X axis [kg m2]
+   * @param [in] inertia_y_kgm2: Principal moment of inertia around Y axis [kg m2]
+   * @param [in] inertia_z_kgm2: Principal moment of inertia around Z axis [kg m2]
+   */
+  ExampleEnsembleRigidBodyOde(const double inertia_x_kgm2, const double inertia_y_kgm2, const double inertia_z_kgm2)
+      : coefficient_x_((inertia_y_kgm2 - inertia_z_kgm2) / inertia_x_kgm2),
+        coefficient_y_((inertia_z_kgm2 - inertia_x_kgm2) / inertia_y_kgm2),
+        coefficient_z_((inertia_x_kgm2 - inertia_y_kgm2) / inertia_z_kgm2) {}
+
+  virtual void DerivativeFunction(const double time_s, const size_t number_of_members, const double* state, double* derivative) const {
+    UNUSED(time_s);
+
+    const double* RESTRICT wx = state;
+    const double* RESTRICT wy = state + number_of_members;
+    const double* RESTRICT wz = state + 2 * number_of_members;
+    const double* RESTRICT q0 = state + 3 * number_of_members;
+    const double* RESTRICT q1 = state + 4 * number_of_members;
+    const double* RESTRICT q2 = state + 5 * number_of_members;
+    const double* RESTRICT q3 = state + 6 * number_of_members;
+    double* RESTRICT dwx = derivative;
+    double* RESTRICT dwy = derivative + number_of_members;
+    double* RESTRICT dwz = derivative + 2 * number_of_members;
+    double* RESTRICT dq0 = derivative + 3 * number_of_members;
+    double* RESTRICT dq1 = derivative + 4 * number_of_members;
+    double* RESTRICT dq2 = derivative + 5 * number_of_members;
+    double* RESTRICT dq3 = derivative + 6 * number_of_members;
+    // The members are copied to the local variables to tell the compiler that they are not modified in the loop
+    const double coefficient_x = coefficient_x_;
+    const double coefficient_y = coefficient_y_;
+    const double coefficient_z = coefficient_z_;
+    for (size_t m = 0; m < number_of_members; m++) {
+      // Euler's equation
+      dwx[m] = coefficient_x * wy[m] * wz[m];
+      dwy[m] = coefficient_y * wz[m] * wx[m];
+      dwz[m] = coefficient_z * wx[m] * wy[m];
+      // Kinematics
+      dq0[m] = 0.5 * (wz[m] * q1[m] - wy[m] * q2[m] + wx[m] * q3[m]);
+      dq1[m] = 0.5 * (-wz[m] * q0[m] + wx[m] * q2[m] + wy[m] * q3[m]);
+      dq2[m] = 0.5 * (wy[m] * q0[m] - wx[m] * q1[m] + wz[m] * q3[m]);
+      dq3[m] = 0.5 * (-wx[m] * q0[m] - wy[m] * q1[m] - wz[m] * q2[m]);
+    }
+  }
+
+ private:
+  double coefficient_x_;  //!< (Iy - Iz) / Ix
+  double coefficient_y_;  //!< (Iz - Ix) / Iy
+  double coefficient_z_;  //!< (Ix - Iy) / Iz
+};
+
 }  // namespace libra::numerical_integration
 
 #endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_EXAMPLE_ODE_HPP_s
@@ -47,12 +47,22 @@ class RungeKutta : public NumericalIntegrator<N> {
   std::vector<double> weights_;                 //!< Weights vector for general RK (b vector in the equation)
   std::vector<std::vector<double>> rk_matrix_;  //!< Runge-Kutta matrix for general RK (a matrix in the equation)
   std::vector<Vector<N>> slope_;                //!< Slope vector for general RK (k vector in the equation)
+  Vector<N> stage_state_;                       //!< Buffer of the state at each stage
 
   /**
    * @fn CalcSlope
    * @brief Calc slope vector (k in the RK equation)
+   * @note The slopes are written into the buffers allocated at the first call without any temporary vectors.
    */
   void CalcSlope();
+  /**
+   * @fn CalcHermiteInterpolationState
+   * @brief Calculate interpolation state with the cubic Hermite polynomial of the last step
+   * @note The states and the derivatives at the both ends of the step are used. It is available for any RK without a native interpolant.
+   * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
+   * @return : interpolated state x(t0 + sigma * h)
+   */
+  Vector<N> CalcHermiteInterpolationState(const double sigma) const;
 };
 
 }  // namespace libra::numerical_integration
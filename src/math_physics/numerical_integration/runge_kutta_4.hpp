@@ -6,8 +6,6 @@
 #ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_4_HPP_
 #define S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_4_HPP_
 
-#include <utilities/macros.hpp>
-
 #include "runge_kutta.hpp"
 
 namespace libra::numerical_integration {
@@ -44,11 +42,13 @@ class RungeKutta4 : public RungeKutta<N> {
     this->CalcSlope();
   }
 
-  // We did not implement the interpolation for RK4
-  Vector<N> CalcInterpolationState(const double sigma) const override {
-    UNUSED(sigma);
-    return this->current_state_;
-  }
+  /**
+   * @fn CalcInterpolationState
+   * @brief Calculate interpolation state with the cubic Hermite polynomial since RK4 does not have a native interpolant
+   * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
+   * @return : interpolated state x(t0 + sigma * h)
+   */
+  Vector<N> CalcInterpolationState(const double sigma) const override { return this->CalcHermiteInterpolationState(sigma); }
 };
 
 }  // namespace libra::numerical_integration
@@ -15,25 +15,51 @@ void RungeKutta<N>::Integrate() {
 
   this->previous_state_ = this->current_state_;
   for (size_t i = 0; i < number_of_stages_; i++) {
-    this->current_state_ = this->current_state_ + weights_[i] * this->step_width_ * slope_[i];
+    const double coefficient = weights_[i] * this->step_width_;
+    if (coefficient == 0.0) continue;
+    for (size_t n = 0; n < N; n++) {
+      this->current_state_[n] += coefficient * slope_[i][n];
+    }
   }
+  this->previous_independent_variable_ = this->current_independent_variable_;
+  this->last_step_width_ = this->step_width_;
   this->current_independent_variable_ += this->step_width_;
 }
 
 template <size_t N>
 void RungeKutta<N>::CalcSlope() {
-  slope_.assign(number_of_stages_, Vector<N>(0.0));
+  if (slope_.size() != number_of_stages_) slope_.assign(number_of_stages_, Vector<N>(0.0));
 
   for (size_t i = 0; i < number_of_stages_; i++) {
-    Vector<N> state = this->current_state_;
+    stage_state_ = this->current_state_;
     for (size_t j = 0; j < i; j++) {
-      state = state + rk_matrix_[i][j] * this->step_width_ * slope_[j];
+      const double coefficient = rk_matrix_[i][j] * this->step_width_;
+      if (coefficient == 0.0) continue;
+      for (size_t n = 0; n < N; n++) {
+        stage_state_[n] += coefficient * slope_[j][n];
+      }
     }
     double independent_variable = this->current_independent_variable_ + nodes_[i] * this->step_width_;
-    slope_[i] = this->ode_.DerivativeFunction(independent_variable, state);
+    this->ode_.CalcDerivative(independent_variable, stage_state_, slope_[i]);
   }
 }
 
+template <size_t N>
+Vector<N> RungeKutta<N>::CalcHermiteInterpolationState(const double sigma) const {
+  // The first slope is the derivative at the start of the last step
+  const Vector<N> end_derivative = this->ode_.DerivativeFunction(this->current_independent_variable_, this->current_state_);
+
+  const double sigma2 = sigma * sigma;
+  const double sigma3 = sigma2 * sigma;
+  const double h00 = 2.0 * sigma3 - 3.0 * sigma2 + 1.0;
+  const double h10 = sigma3 - 2.0 * sigma2 + sigma;
+  const double h01 = -2.0 * sigma3 + 3.0 * sigma2;
+  const double h11 = sigma3 - sigma2;
+
+  return h00 * this->previous_state_ + (h10 * this->last_step_width_) * slope_[0] + h01 * this->current_state_ +
+         (h11 * this->last_step_width_) * end_derivative;
+}
+
 }  // namespace libra::numerical_integration
 
 #endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_TEMPLATE_HPP_
@@ -0,0 +1,87 @@
+/**
+ * @file test_ensemble_runge_kutta.cpp
+ * @brief Test codes for EnsembleRungeKutta4 class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "ensemble_runge_kutta_4.hpp"
+#include "ode_examples.hpp"
+#include "runge_kutta_4.hpp"
+
+/**
+ * @brief Test for the orbit with J2 compared with the RK4 integration of each member
+ */
+TEST(ENSEMBLE_NUMERICAL_INTEGRATION, IntegrateTwoBodyJ2Orbit) {
+  const double step_width_s = 10.0;
+  const size_t number_of_members = 5;
+  libra::numerical_integration::ExampleEnsembleTwoBodyJ2OrbitOde ode;
+  libra::numerical_integration::SingleMemberOde<6> single_ode(ode);
+  libra::numerical_integration::EnsembleRungeKutta4<6> ensemble(step_width_s, number_of_members, ode);
+  EXPECT_EQ(number_of_members, ensemble.GetNumberOfMembers());
+
+  std::vector<libra::numerical_integration::RungeKutta4<6>> integrators;
+  for (size_t m = 0; m < number_of_members; m++) {
+    libra::Vector<6> initial_state(0.0);
+    initial_state[0] = 6778137.0 + 1.0e3 * (double)m;
+    initial_state[4] = 7668.6 * cos(0.9);
+    initial_state[5] = 7668.6 * sin(0.9) + 0.1 * (double)m;
+    ensemble.SetState(m, initial_state);
+    integrators.emplace_back(step_width_s, single_ode);
+    integrators[m].SetState(0.0, initial_state);
+  }
+
+  for (size_t i = 0; i < 600; i++) {
+    ensemble.Integrate();
+    for (auto& integrator : integrators) integrator.Integrate();
+  }
+
+  EXPECT_DOUBLE_EQ(6000.0, ensemble.GetCurrentIndependentVariable());
+  for (size_t m = 0; m < number_of_members; m++) {
+    libra::Vector<6> state = ensemble.GetState(m);
+    libra::Vector<6> reference = integrators[m].GetState();
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(reference[i], state[i], 1.0e-6);
+      EXPECT_NEAR(reference[i + 3], state[i + 3], 1.0e-9);
+    }
+    EXPECT_DOUBLE_EQ(state[2], ensemble.GetComponent(2)[m]);
+  }
+}
+
+/**
+ * @brief Test for the torque free rigid body with the conservation of the angular momentum and the quaternion norm
+ */
+TEST(ENSEMBLE_NUMERICAL_INTEGRATION, IntegrateRigidBody) {
+  const double step_width_s = 0.01;
+  const size_t number_of_members = 8;
+  const double inertia_kgm2[3] = {1.0, 2.0, 3.0};
+  libra::numerical_integration::ExampleEnsembleRigidBodyOde ode(inertia_kgm2[0], inertia_kgm2[1], inertia_kgm2[2]);
+  libra::numerical_integration::EnsembleRungeKutta4<7> ensemble(step_width_s, number_of_members, ode);
+
+  std::vector<double> initial_angular_momentum(number_of_members);
+  for (size_t m = 0; m < number_of_members; m++) {
+    libra::Vector<7> initial_state(0.0);
+    initial_state[0] = 0.1;
+    initial_state[1] = 0.01 * (double)m;
+    initial_state[2] = 0.05;
+    initial_state[6] = 1.0;
+    ensemble.SetState(m, initial_state);
+    double angular_momentum2 = 0.0;
+    for (size_t i = 0; i < 3; i++) angular_momentum2 += pow(inertia_kgm2[i] * initial_state[i], 2.0);
+    initial_angular_momentum[m] = sqrt(angular_momentum2);
+  }
+
+  for (size_t i = 0; i < 10000; i++) {
+    ensemble.Integrate();
+  }
+
+  for (size_t m = 0; m < number_of_members; m++) {
+    libra::Vector<7> state = ensemble.GetState(m);
+    double angular_momentum2 = 0.0;
+    for (size_t i = 0; i < 3; i++) angular_momentum2 += pow(inertia_kgm2[i] * state[i], 2.0);
+    EXPECT_NEAR(initial_angular_momentum[m], sqrt(angular_momentum2), 1.0e-9);
+
+    double quaternion_norm2 = 0.0;
+    for (size_t i = 3; i < 7; i++) quaternion_norm2 += state[i] * state[i];
+    EXPECT_NEAR(1.0, sqrt(quaternion_norm2), 1.0e-9);
+  }
+}
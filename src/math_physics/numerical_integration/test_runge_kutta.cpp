@@ -200,6 +200,28 @@ TEST(NUMERICAL_INTEGRATION, IntegrateQuadraticRkf) {
   EXPECT_NEAR(estimated_result, state[0], 1e-6);
 }
 
+/**
+ * @brief Test for interpolation with quadratic function with RK4
+ */
+TEST(NUMERICAL_INTEGRATION, InterpolationQuadraticRk4) {
+  double step_width_s = 10.0;
+  libra::numerical_integration::ExampleQuadraticOde ode;
+  libra::numerical_integration::RungeKutta4<1> rk4_ode(step_width_s, ode);
+
+  rk4_ode.Integrate();
+
+  // The cubic Hermite interpolation is exact for the quadratic function
+  double sigma = 0.1;
+  libra::Vector<1> state = rk4_ode.CalcInterpolationState(sigma);
+  double estimated_result = (step_width_s * sigma) * (step_width_s * sigma);
+  EXPECT_NEAR(estimated_result, state[0], 1e-6);
+
+  sigma = 0.515;
+  state = rk4_ode.CalcInterpolationState(sigma);
+  estimated_result = (step_width_s * sigma) * (step_width_s * sigma);
+  EXPECT_NEAR(estimated_result, state[0], 1e-6);
+}
+
 /**
  * @brief Test for interpolation with quadratic function with RKF
  */
@@ -279,6 +301,30 @@ TEST(NUMERICAL_INTEGRATION, InterpolationQuadraticDp5) {
   EXPECT_NEAR(estimated_result, state[0], 1e-8);
 }
 
+/**
+ * @brief Test for interpolation at the independent variable after the step width is changed
+ */
+TEST(NUMERICAL_INTEGRATION, InterpolationAtIndependentVariableDp5) {
+  libra::numerical_integration::ExampleQuadraticOde ode;
+  libra::numerical_integration::DormandPrince5<1> dp5_ode(10.0, ode);
+
+  // No step after the state setting
+  libra::Vector<1> state = dp5_ode.CalcInterpolationStateAt(5.0);
+  EXPECT_DOUBLE_EQ(0.0, state[0]);
+
+  dp5_ode.Integrate();
+  dp5_ode.Integrate();
+  EXPECT_DOUBLE_EQ(10.0, dp5_ode.GetPreviousIndependentVariable());
+  EXPECT_DOUBLE_EQ(20.0, dp5_ode.GetCurrentIndependentVariable());
+
+  // The interpolation uses the width of the last step
+  dp5_ode.SetStepWidth(3.0);
+  state = dp5_ode.CalcInterpolationStateAt(13.0);
+  EXPECT_NEAR(169.0, state[0], 1e-6);
+  state = dp5_ode.CalcInterpolationStateAt(17.5);
+  EXPECT_NEAR(306.25, state[0], 1e-6);
+}
+
 /**
  * @brief Test for integration with 1D position and velocity function with RK4
  */
@@ -509,6 +555,97 @@ TEST(NUMERICAL_INTEGRATION, Integrate2dTwoBodyOrbitLargeEccentricity) {
   EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_dp5[3], error_tolerance);
 }
 
+/**
+ * @brief Test for integration with 2D two body orbit with ABM
+ */
+TEST(NUMERICAL_INTEGRATION, Integrate2dTwoBodyOrbitAbm) {
+  // Half step width of the RK4 case for the same number of the derivative evaluations
+  double step_width_s = 0.05;
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::numerical_integration::NumericalIntegratorManager<4> numerical_integrator(
+      step_width_s, ode, libra::numerical_integration::NumericalIntegrationMethod::kAbm);
+  auto abm_ode = std::dynamic_pointer_cast<libra::numerical_integration::AdamsBashforthMoulton<4>>(numerical_integrator.GetIntegrator());
+  ASSERT_NE(nullptr, abm_ode);
+
+  libra::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  abm_ode->SetState(0.0, initial_state);
+
+  // RK4 startup
+  EXPECT_TRUE(abm_ode->IsStartingUp());
+  for (size_t i = 0; i < 3; i++) {
+    abm_ode->Integrate();
+  }
+  EXPECT_FALSE(abm_ode->IsStartingUp());
+
+  size_t step_num = 400;
+  for (size_t i = 3; i < step_num; i++) {
+    abm_ode->Integrate();
+  }
+  libra::Vector<4> state_abm = abm_ode->GetState();
+
+  // Estimation by Kepler Orbit calculation
+  libra::Vector<3> initial_position(0.0);
+  libra::Vector<3> initial_velocity(0.0);
+  initial_position[0] = initial_state[0];
+  initial_velocity[1] = initial_state[3];
+  OrbitalElements oe(1.0, 0.0, initial_position, initial_velocity);
+  KeplerOrbit kepler(1.0, oe);
+  kepler.CalcOrbit((double)(step_num * step_width_s) / (24.0 * 60.0 * 60.0));
+
+  double error_tolerance = 2e-4;
+  EXPECT_NEAR(kepler.GetPosition_i_m()[0], state_abm[0], error_tolerance);
+  EXPECT_NEAR(kepler.GetPosition_i_m()[1], state_abm[1], error_tolerance);
+  EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state_abm[2], error_tolerance);
+  EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_abm[3], error_tolerance);
+
+  // Restart after the state setting
+  abm_ode->SetState(0.0, initial_state);
+  EXPECT_TRUE(abm_ode->IsStartingUp());
+}
+
+/**
+ * @brief Comparison of the derivative calculation in place with the return value version
+ * @note The calculation times are compared in benchmark_in_place_integration.cpp
+ */
+TEST(NUMERICAL_INTEGRATION, IntegrateHarmonicOscillatorInPlace) {
+  double step_width_s = 0.001;
+  size_t step_num = 10000;
+  libra::numerical_integration::ExampleHarmonicOscillatorOde ode;
+  libra::numerical_integration::ExampleHarmonicOscillatorInPlaceOde in_place_ode;
+
+  libra::Vector<6> initial_state(0.0);
+  initial_state[0] = 1.0;
+  initial_state[4] = 1.0;
+
+  const libra::numerical_integration::NumericalIntegrationMethod methods[] = {libra::numerical_integration::NumericalIntegrationMethod::kRk4,
+                                                                              libra::numerical_integration::NumericalIntegrationMethod::kDp5,
+                                                                              libra::numerical_integration::NumericalIntegrationMethod::kAbm};
+  for (const auto method : methods) {
+    libra::numerical_integration::NumericalIntegratorManager<6> value_integrator(step_width_s, ode, method);
+    libra::numerical_integration::NumericalIntegratorManager<6> in_place_integrator(step_width_s, in_place_ode, method);
+    value_integrator.GetIntegrator()->SetState(0.0, initial_state);
+    in_place_integrator.GetIntegrator()->SetState(0.0, initial_state);
+
+    for (size_t i = 0; i < step_num; i++) {
+      value_integrator.GetIntegrator()->Integrate();
+      in_place_integrator.GetIntegrator()->Integrate();
+    }
+
+    // Both versions give the same result with the analytical solution
+    libra::Vector<6> value_state = value_integrator.GetIntegrator()->GetState();
+    libra::Vector<6> in_place_state = in_place_integrator.GetIntegrator()->GetState();
+    double time_s = step_width_s * step_num;
+    for (size_t i = 0; i < 6; i++) {
+      EXPECT_DOUBLE_EQ(value_state[i], in_place_state[i]);
+    }
+    EXPECT_NEAR(cos(time_s), in_place_state[0], 1e-6);
+    EXPECT_NEAR(sin(time_s), in_place_state[1], 1e-6);
+  }
+}
+
 /**
  * @brief Interpolation accuracy comparison among integrators for integration with 2D two body orbit with small eccentricity
  */
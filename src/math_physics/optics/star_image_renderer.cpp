@@ -0,0 +1,108 @@
+/**
+ * @file star_image_renderer.cpp
+ * @brief Class to render star images with a Gaussian point spread function
+ */
+
+#include "star_image_renderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace libra {
+
+StarImageRenderer::StarImageRenderer(const size_t width_pix, const size_t height_pix, const double psf_sigma_pix, const size_t tile_size_pix,
+                                     const size_t subpixel_division)
+    : width_pix_(width_pix),
+      height_pix_(height_pix),
+      tile_size_pix_(std::max(tile_size_pix, (size_t)1)),
+      subpixel_division_(std::max(subpixel_division, (size_t)1)) {
+  const double sigma_pix = std::max(psf_sigma_pix, 1.0e-3);
+  kernel_radius_pix_ = (size_t)ceil(3.0 * sigma_pix);  // 3 sigma covers 99.7% in each direction
+  kernel_size_pix_ = 2 * kernel_radius_pix_ + 1;
+
+  // Kernels integrated over each pixel for the sub-pixel offsets of the center: 0, 1 / division, ..., 1
+  kernels_.resize((subpixel_division_ + 1) * kernel_size_pix_);
+  const double scale = 1.0 / (sqrt(2.0) * sigma_pix);
+  for (size_t s = 0; s <= subpixel_division_; s++) {
+    const double offset_pix = (double)s / (double)subpixel_division_;
+    float* kernel = &kernels_[s * kernel_size_pix_];
+    double sum = 0.0;
+    for (size_t k = 0; k < kernel_size_pix_; k++) {
+      const double lower_pix = (double)k - (double)kernel_radius_pix_ - offset_pix;
+      const double weight = 0.5 * (erf((lower_pix + 1.0) * scale) - erf(lower_pix * scale));
+      kernel[k] = (float)weight;
+      sum += weight;
+    }
+    for (size_t k = 0; k < kernel_size_pix_; k++) kernel[k] = (float)(kernel[k] / sum);  // Conserve the total count
+  }
+
+  image_.assign(width_pix_ * height_pix_, 0.0f);
+  scaled_kernel_x_.resize(kernel_size_pix_);
+  number_of_x_tiles_ = (width_pix_ + tile_size_pix_ - 1) / tile_size_pix_;
+  const size_t number_of_y_tiles = (height_pix_ + tile_size_pix_ - 1) / tile_size_pix_;
+  is_rendered_.assign(number_of_x_tiles_ * number_of_y_tiles, 0);
+}
+
+void StarImageRenderer::ClearImage() {
+  for (size_t tile : rendered_tiles_) {
+    const size_t x_begin = (tile % number_of_x_tiles_) * tile_size_pix_;
+    const size_t y_begin = (tile / number_of_x_tiles_) * tile_size_pix_;
+    const size_t x_end = std::min(x_begin + tile_size_pix_, width_pix_);
+    const size_t y_end = std::min(y_begin + tile_size_pix_, height_pix_);
+    for (size_t y = y_begin; y < y_end; y++) {
+      std::fill(image_.begin() + y * width_pix_ + x_begin, image_.begin() + y * width_pix_ + x_end, 0.0f);
+    }
+    is_rendered_[tile] = 0;
+  }
+  rendered_tiles_.clear();
+}
+
+void StarImageRenderer::AddStar(const double x_pix, const double y_pix, const double count) {
+  if (!std::isfinite(x_pix) || !std::isfinite(y_pix)) return;
+
+  long first_x;
+  long first_y;
+  const float* kernel_x = GetKernel(x_pix, first_x);
+  const float* kernel_y = GetKernel(y_pix, first_y);
+
+  // Clip the kernel window with the image
+  const long x_begin = std::max(first_x, 0L);
+  const long y_begin = std::max(first_y, 0L);
+  const long x_end = std::min(first_x + (long)kernel_size_pix_, (long)width_pix_);
+  const long y_end = std::min(first_y + (long)kernel_size_pix_, (long)height_pix_);
+  if (x_begin >= x_end || y_begin >= y_end) return;
+
+  const size_t width = (size_t)(x_end - x_begin);
+  for (size_t i = 0; i < width; i++) {
+    scaled_kernel_x_[i] = (float)count * kernel_x[x_begin - first_x + (long)i];
+  }
+  // The inner loop is a contiguous multiply-add, which is vectorized by the compiler
+  for (long y = y_begin; y < y_end; y++) {
+    const float weight_y = kernel_y[y - first_y];
+    float* row = &image_[(size_t)y * width_pix_ + (size_t)x_begin];
+    for (size_t i = 0; i < width; i++) {
+      row[i] += weight_y * scaled_kernel_x_[i];
+    }
+  }
+
+  // Mark the rendered tiles
+  for (size_t tile_y = (size_t)y_begin / tile_size_pix_; tile_y <= (size_t)(y_end - 1) / tile_size_pix_; tile_y++) {
+    for (size_t tile_x = (size_t)x_begin / tile_size_pix_; tile_x <= (size_t)(x_end - 1) / tile_size_pix_; tile_x++) {
+      const size_t tile = tile_y * number_of_x_tiles_ + tile_x;
+      if (is_rendered_[tile]) continue;
+      is_rendered_[tile] = 1;
+      rendered_tiles_.push_back(tile);
+    }
+  }
+}
+
+const float* StarImageRenderer::GetKernel(const double position_pix, long& first_pixel) const {
+  const double center_pixel = floor(position_pix);
+  // The nearest kernel is selected (the offset 1 is included for rounding)
+  size_t subpixel = (size_t)((position_pix - center_pixel) * (double)subpixel_division_ + 0.5);
+  if (subpixel > subpixel_division_) subpixel = subpixel_division_;
+  first_pixel = (long)center_pixel - (long)kernel_radius_pix_;
+  return &kernels_[subpixel * kernel_size_pix_];
+}
+
+}  // namespace libra
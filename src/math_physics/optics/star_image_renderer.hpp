@@ -0,0 +1,104 @@
+/**
+ * @file star_image_renderer.hpp
+ * @brief Class to render star images with a Gaussian point spread function
+ */
+
+#ifndef S2E_LIBRARY_OPTICS_STAR_IMAGE_RENDERER_HPP_
+#define S2E_LIBRARY_OPTICS_STAR_IMAGE_RENDERER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class StarImageRenderer
+ * @brief Class to render point sources on an image with a Gaussian point spread function (PSF)
+ * @details The PSF is separable, so one dimensional kernels integrated over each pixel are precomputed for sub-pixel offsets.
+ *          The image is divided into tiles, and only the tiles touched since the last clear are cleared again.
+ *          The pixel (i, j) covers [i, i + 1) x [j, j + 1) in the image coordinates, and the image is stored row by row.
+ */
+class StarImageRenderer {
+ public:
+  /**
+   * @fn StarImageRenderer
+   * @brief Constructor
+   * @param [in] width_pix: Number of pixels in the X direction
+   * @param [in] height_pix: Number of pixels in the Y direction
+   * @param [in] psf_sigma_pix: Standard deviation of the Gaussian PSF [pixel]
+   * @param [in] tile_size_pix: Size of the square tiles [pixel]
+   * @param [in] subpixel_division: Number of divisions of a pixel for the precomputed kernels. The position is rounded to the division.
+   */
+  StarImageRenderer(const size_t width_pix, const size_t height_pix, const double psf_sigma_pix, const size_t tile_size_pix = 32,
+                    const size_t subpixel_division = 8);
+
+  /**
+   * @fn ClearImage
+   * @brief Clear the tiles rendered since the last clear
+   */
+  void ClearImage();
+  /**
+   * @fn AddStar
+   * @brief Accumulate a point source on the image
+   * @param [in] x_pix: X position in the image coordinates [pixel]
+   * @param [in] y_pix: Y position in the image coordinates [pixel]
+   * @param [in] count: Total count of the source. The part out of the image is lost.
+   */
+  void AddStar(const double x_pix, const double y_pix, const double count);
+
+  // Getters
+  /**
+   * @fn GetImage
+   * @return Pixel values ordered row by row (index: y * width + x)
+   */
+  inline const std::vector<float>& GetImage() const { return image_; }
+  /**
+   * @fn GetPixel
+   * @return Pixel value
+   */
+  inline float GetPixel(const size_t x, const size_t y) const { return image_[y * width_pix_ + x]; }
+  /**
+   * @fn GetWidth_pix
+   * @return Number of pixels in the X direction
+   */
+  inline size_t GetWidth_pix() const { return width_pix_; }
+  /**
+   * @fn GetHeight_pix
+   * @return Number of pixels in the Y direction
+   */
+  inline size_t GetHeight_pix() const { return height_pix_; }
+  /**
+   * @fn GetNumberOfRenderedTiles
+   * @return Number of tiles rendered since the last clear
+   */
+  inline size_t GetNumberOfRenderedTiles() const { return rendered_tiles_.size(); }
+
+ private:
+  size_t width_pix_;          //!< Number of pixels in the X direction
+  size_t height_pix_;         //!< Number of pixels in the Y direction
+  size_t tile_size_pix_;      //!< Size of the square tiles [pixel]
+  size_t number_of_x_tiles_;  //!< Number of tiles in the X direction
+  size_t subpixel_division_;  //!< Number of divisions of a pixel for the precomputed kernels
+  size_t kernel_radius_pix_;  //!< Half width of the kernels except the center pixel [pixel]
+  size_t kernel_size_pix_;    //!< Width of the kernels [pixel]
+
+  std::vector<float> kernels_;          //!< One dimensional kernels ordered by sub-pixel offset and pixel
+  std::vector<float> image_;            //!< Pixel values
+  std::vector<float> scaled_kernel_x_;  //!< Work area for the X kernel scaled by the count
+  std::vector<uint8_t> is_rendered_;    //!< Flags of the tiles rendered since the last clear
+  std::vector<size_t> rendered_tiles_;  //!< Indices of the tiles rendered since the last clear
+
+  /**
+   * @fn GetKernel
+   * @brief Return the kernel for the position and the first pixel covered by it
+   * @param [in] position_pix: Position in the image coordinates [pixel]
+   * @param [out] first_pixel: Index of the pixel of the first kernel element (can be negative)
+   * @return Pointer to the first kernel element
+   */
+  const float* GetKernel(const double position_pix, long& first_pixel) const;
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_OPTICS_STAR_IMAGE_RENDERER_HPP_
@@ -0,0 +1,53 @@
+/**
+ * @file test_star_image_renderer.cpp
+ * @brief Test codes for StarImageRenderer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "star_image_renderer.hpp"
+
+namespace {
+/**
+ * @brief Sum of all pixel values
+ */
+double CalcImageSum(const libra::StarImageRenderer& renderer) {
+  double sum = 0.0;
+  for (float value : renderer.GetImage()) sum += value;
+  return sum;
+}
+}  // namespace
+
+/**
+ * @brief Test for the total count and the symmetry of the rendered star
+ */
+TEST(StarImageRenderer, AddStar) {
+  libra::StarImageRenderer renderer(64, 48, 1.2);
+  renderer.AddStar(20.5, 30.5, 1000.0);
+
+  EXPECT_NEAR(1000.0, CalcImageSum(renderer), 1.0e-2);
+  EXPECT_NEAR(renderer.GetPixel(19, 30), renderer.GetPixel(21, 30), 1.0e-3);
+  EXPECT_NEAR(renderer.GetPixel(20, 29), renderer.GetPixel(20, 31), 1.0e-3);
+  EXPECT_GT(renderer.GetPixel(20, 30), renderer.GetPixel(21, 30));
+  EXPECT_GT(renderer.GetPixel(21, 30), renderer.GetPixel(21, 31));
+  EXPECT_EQ(0.0f, renderer.GetPixel(30, 30));
+
+  // The part out of the image is lost
+  renderer.AddStar(0.0, 0.0, 1000.0);
+  renderer.AddStar(-100.0, 1.0e10, 1000.0);
+  EXPECT_NEAR(1250.0, CalcImageSum(renderer), 1.0);
+}
+
+/**
+ * @brief Test for the tile clear
+ */
+TEST(StarImageRenderer, ClearImage) {
+  libra::StarImageRenderer renderer(100, 100, 1.0, 16);
+  renderer.AddStar(8.0, 8.0, 100.0);
+  EXPECT_EQ(1, renderer.GetNumberOfRenderedTiles());
+  renderer.AddStar(48.0, 99.0, 100.0);
+  EXPECT_EQ(3, renderer.GetNumberOfRenderedTiles());
+
+  renderer.ClearImage();
+  EXPECT_EQ(0, renderer.GetNumberOfRenderedTiles());
+  EXPECT_EQ(0.0, CalcImageSum(renderer));
+}
@@ -0,0 +1,125 @@
+/**
+ * @file conjunction_screening.cpp
+ * @brief Class to screen the close approaches between a spacecraft and the objects in a TLE catalogue
+ */
+#include "conjunction_screening.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../math/root_finding.hpp"
+
+ConjunctionScreening::ConjunctionScreening(Sgp4Catalogue& catalogue, const double threshold_distance_m, const unsigned int number_of_threads)
+    : catalogue_(catalogue), threshold_distance_m_(threshold_distance_m), number_of_threads_(number_of_threads) {}
+
+void ConjunctionScreening::Update(const double elapsed_time_s, const double current_time_jd, const libra::Vector<3> position_i_m,
+                                  const libra::Vector<3> velocity_i_m_s, const libra::Matrix<3, 3>& dcm_j2000_to_teme) {
+  const size_t number_of_objects = catalogue_.GetNumberOfObjects();
+  if (has_previous_sample_.size() != number_of_objects) {
+    has_previous_sample_.assign(number_of_objects, false);
+    relative_positions_i_m_.resize(number_of_objects);
+    relative_velocities_i_m_s_.resize(number_of_objects);
+  }
+  const double time_step_s = elapsed_time_s - previous_time_s_;
+  // The catalogue objects are propagated in the TEME frame
+  const libra::Vector<3> position_teme_m = dcm_j2000_to_teme * position_i_m;
+  const libra::Vector<3> velocity_teme_m_s = dcm_j2000_to_teme * velocity_i_m_s;
+
+  // Apogee/perigee filter and the propagation of the candidates
+  std::vector<bool> was_candidate = has_previous_sample_;
+  UpdateCandidates(position_teme_m, velocity_teme_m_s);
+  catalogue_.Propagate(current_time_jd, candidate_indices_, number_of_threads_);
+  std::fill(has_previous_sample_.begin(), has_previous_sample_.end(), false);
+
+  // A closer approach than the threshold is possible only for the objects within this distance at the end of the step
+  const double search_distance_m = threshold_distance_m_ + 0.5 * kMaxRelativeSpeed_m_s * time_step_s;
+  std::vector<ConjunctionEvent> new_events;
+  for (const size_t index : candidate_indices_) {
+    if (catalogue_.GetError(index) > 0) continue;
+    const libra::Vector<3> relative_position_i_m = catalogue_.GetPosition_i_m(index) - position_teme_m;
+    const libra::Vector<3> relative_velocity_i_m_s = catalogue_.GetVelocity_i_m_s(index) - velocity_teme_m_s;
+
+    if (was_candidate[index] && time_step_s > 0.0) {
+      const double previous_range_rate = InnerProduct(relative_positions_i_m_[index], relative_velocities_i_m_s_[index]);
+      const double current_range_rate = InnerProduct(relative_position_i_m, relative_velocity_i_m_s);
+      const double minimum_distance_m = std::min(relative_positions_i_m_[index].CalcNorm(), relative_position_i_m.CalcNorm());
+      if (previous_range_rate < 0.0 && current_range_rate >= 0.0 && minimum_distance_m <= search_distance_m) {
+        ConjunctionEvent event = RefineClosestApproach(index, time_step_s, relative_position_i_m, relative_velocity_i_m_s);
+        if (event.miss_distance_m_ <= threshold_distance_m_) new_events.push_back(event);
+      }
+    }
+    relative_positions_i_m_[index] = relative_position_i_m;
+    relative_velocities_i_m_s_[index] = relative_velocity_i_m_s;
+    has_previous_sample_[index] = true;
+  }
+
+  std::sort(new_events.begin(), new_events.end(), [](const ConjunctionEvent& lhs, const ConjunctionEvent& rhs) {
+    return lhs.time_of_closest_approach_s_ < rhs.time_of_closest_approach_s_;
+  });
+  const libra::Matrix<3, 3> dcm_teme_to_j2000 = dcm_j2000_to_teme.Transpose();
+  for (auto& event : new_events) {
+    event.relative_position_i_m_ = dcm_teme_to_j2000 * event.relative_position_i_m_;
+    event.time_of_closest_approach_jd_ = previous_time_jd_ + (current_time_jd - previous_time_jd_) *
+                                                                 (event.time_of_closest_approach_s_ - previous_time_s_) / time_step_s;
+    conjunction_events_.push_back(event);
+  }
+
+  previous_time_s_ = elapsed_time_s;
+  previous_time_jd_ = current_time_jd;
+}
+
+void ConjunctionScreening::UpdateCandidates(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s) {
+  // Apsis radii of the osculating orbit of the spacecraft
+  const double gravity_constant_m3_s2 = catalogue_.GetGravityConstant_m3_s2();
+  const double radius_m = position_i_m.CalcNorm();
+  const double specific_energy_m2_s2 = 0.5 * InnerProduct(velocity_i_m_s, velocity_i_m_s) - gravity_constant_m3_s2 / radius_m;
+  const double angular_momentum_m2_s = OuterProduct(position_i_m, velocity_i_m_s).CalcNorm();
+  const double semi_latus_rectum_m = angular_momentum_m2_s * angular_momentum_m2_s / gravity_constant_m3_s2;
+  const double eccentricity =
+      sqrt(std::max(0.0, 1.0 + 2.0 * specific_energy_m2_s2 * angular_momentum_m2_s * angular_momentum_m2_s /
+                              (gravity_constant_m3_s2 * gravity_constant_m3_s2)));
+  const double perigee_radius_m = semi_latus_rectum_m / (1.0 + eccentricity);
+  const double apogee_radius_m = (eccentricity < 1.0) ? semi_latus_rectum_m / (1.0 - eccentricity) : std::numeric_limits<double>::infinity();
+
+  candidate_indices_.clear();
+  for (size_t index = 0; index < catalogue_.GetNumberOfObjects(); index++) {
+    const double lower_radius_m = std::max(perigee_radius_m, catalogue_.GetPerigeeRadius_m(index));
+    const double upper_radius_m = std::min(apogee_radius_m, catalogue_.GetApogeeRadius_m(index));
+    if (lower_radius_m - upper_radius_m > threshold_distance_m_) continue;
+    candidate_indices_.push_back(index);
+  }
+}
+
+ConjunctionEvent ConjunctionScreening::RefineClosestApproach(const size_t object_index, const double time_step_s,
+                                                             const libra::Vector<3> relative_position_i_m,
+                                                             const libra::Vector<3> relative_velocity_i_m_s) const {
+  const libra::Vector<3>& r0 = relative_positions_i_m_[object_index];
+  const libra::Vector<3> v0 = time_step_s * relative_velocities_i_m_s_[object_index];
+  const libra::Vector<3>& r1 = relative_position_i_m;
+  const libra::Vector<3> v1 = time_step_s * relative_velocity_i_m_s;
+
+  // Cubic Hermite interpolation with the normalized time s in [0, 1]
+  auto calc_position = [&](const double s) {
+    const double s2 = s * s, s3 = s2 * s;
+    return (2.0 * s3 - 3.0 * s2 + 1.0) * r0 + (s3 - 2.0 * s2 + s) * v0 + (-2.0 * s3 + 3.0 * s2) * r1 + (s3 - s2) * v1;
+  };
+  auto calc_velocity = [&](const double s) {
+    const double s2 = s * s;
+    const libra::Vector<3> derivative =
+        (6.0 * s2 - 6.0 * s) * r0 + (3.0 * s2 - 4.0 * s + 1.0) * v0 + (-6.0 * s2 + 6.0 * s) * r1 + (3.0 * s2 - 2.0 * s) * v1;
+    return (1.0 / time_step_s) * derivative;
+  };
+  auto range_rate = [&](const double s) { return InnerProduct(calc_position(s), calc_velocity(s)); };
+
+  const double s = libra::CalcRootWithBrentMethod(range_rate, 0.0, 1.0, kTimeTolerance_s / time_step_s);
+
+  ConjunctionEvent event;
+  event.object_index_ = object_index;
+  event.time_of_closest_approach_s_ = previous_time_s_ + s * time_step_s;
+  event.time_of_closest_approach_jd_ = 0.0;
+  event.relative_position_i_m_ = calc_position(s);
+  event.miss_distance_m_ = event.relative_position_i_m_.CalcNorm();
+  event.relative_speed_m_s_ = calc_velocity(s).CalcNorm();
+  return event;
+}
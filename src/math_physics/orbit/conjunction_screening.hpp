@@ -0,0 +1,112 @@
+/**
+ * @file conjunction_screening.hpp
+ * @brief Class to screen the close approaches between a spacecraft and the objects in a TLE catalogue
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_CONJUNCTION_SCREENING_HPP_
+#define S2E_LIBRARY_ORBIT_CONJUNCTION_SCREENING_HPP_
+
+#include <vector>
+
+#include "../math/matrix_vector.hpp"
+#include "../math/vector.hpp"
+#include "sgp4_catalogue.hpp"
+
+/**
+ * @struct ConjunctionEvent
+ * @brief Information of a close approach
+ */
+struct ConjunctionEvent {
+  size_t object_index_;                     //!< Index of the object in the catalogue
+  double time_of_closest_approach_s_;       //!< Elapsed time of the closest approach [sec]
+  double time_of_closest_approach_jd_;      //!< Julian day of the closest approach [day]
+  double miss_distance_m_;                  //!< Distance at the closest approach [m]
+  double relative_speed_m_s_;               //!< Relative speed at the closest approach [m/s]
+  libra::Vector<3> relative_position_i_m_;  //!< Relative position of the object from the spacecraft in the J2000 frame at the closest approach [m]
+};
+
+/**
+ * @class ConjunctionScreening
+ * @brief Class to screen the close approaches between a spacecraft and the objects in a TLE catalogue
+ * @details The screening consists of the following three stages at each update.
+ *          1. Apogee/perigee filter: The objects whose radius band does not overlap with the band of the spacecraft are not propagated.
+ *          2. Coarse filter: The range rate sign change from negative to positive between the updates is detected for the objects which
+ *             can be closer than the threshold within the step considering the maximum relative speed.
+ *          3. Refinement: The time of closest approach is calculated with Brent's method on the cubic Hermite interpolation of the relative
+ *             position and velocity between the updates.
+ * @note The state of the spacecraft in the J2000 frame is converted to the TEME frame of the SGP4 outputs, and the screening is done in the
+ *       TEME frame. The rotation of the TEME frame against the J2000 frame within the step is neglected.
+ */
+class ConjunctionScreening {
+ public:
+  /**
+   * @fn ConjunctionScreening
+   * @brief Constructor
+   * @param [in] catalogue: TLE catalogue. The positions of the candidate objects are updated by this class.
+   * @param [in] threshold_distance_m: Threshold distance of the close approach [m]
+   * @param [in] number_of_threads: Number of threads for the catalogue propagation
+   */
+  ConjunctionScreening(Sgp4Catalogue& catalogue, const double threshold_distance_m, const unsigned int number_of_threads = 1);
+
+  /**
+   * @fn Update
+   * @brief Propagate the candidate objects and detect the close approaches between the previous and the current update
+   * @param [in] elapsed_time_s: Elapsed time [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   * @param [in] position_i_m: Position of the spacecraft in the J2000 frame [m] (e.g., Orbit::GetPosition_i_m)
+   * @param [in] velocity_i_m_s: Velocity of the spacecraft in the J2000 frame [m/s] (e.g., Orbit::GetVelocity_i_m_s)
+   * @param [in] dcm_j2000_to_teme: DCM from the J2000 frame to the TEME frame at the current time (e.g., EarthRotation::GetDcmJ2000ToTeme)
+   */
+  void Update(const double elapsed_time_s, const double current_time_jd, const libra::Vector<3> position_i_m,
+              const libra::Vector<3> velocity_i_m_s, const libra::Matrix<3, 3>& dcm_j2000_to_teme);
+
+  // Getters
+  /**
+   * @fn GetConjunctionEvents
+   * @brief Return all detected close approaches in the time order of the detection
+   */
+  inline const std::vector<ConjunctionEvent>& GetConjunctionEvents() const { return conjunction_events_; }
+  /**
+   * @fn GetNumberOfCandidates
+   * @brief Return number of the objects which pass the apogee/perigee filter in the latest update
+   */
+  inline size_t GetNumberOfCandidates() const { return candidate_indices_.size(); }
+
+ private:
+  static constexpr double kMaxRelativeSpeed_m_s = 16.0e3;  //!< Maximum relative speed between the Earth orbiting objects [m/s]
+  static constexpr double kTimeTolerance_s = 1.0e-3;       //!< Tolerance of the time of closest approach [sec]
+
+  Sgp4Catalogue& catalogue_;        //!< TLE catalogue
+  double threshold_distance_m_;     //!< Threshold distance of the close approach [m]
+  unsigned int number_of_threads_;  //!< Number of threads for the catalogue propagation
+
+  std::vector<size_t> candidate_indices_;                    //!< Indices of the objects which pass the apogee/perigee filter
+  std::vector<bool> has_previous_sample_;                    //!< Flag of the relative state sample in the previous update for each object
+  std::vector<libra::Vector<3>> relative_positions_i_m_;     //!< Relative position of each object in the TEME frame in the previous update [m]
+  std::vector<libra::Vector<3>> relative_velocities_i_m_s_;  //!< Relative velocity of each object in the TEME frame in the previous update [m/s]
+  double previous_time_s_ = 0.0;                             //!< Elapsed time of the previous update [sec]
+  double previous_time_jd_ = 0.0;                            //!< Julian day of the previous update [day]
+
+  std::vector<ConjunctionEvent> conjunction_events_;  //!< Detected close approaches
+
+  /**
+   * @fn UpdateCandidates
+   * @brief Select the objects whose radius band overlaps with the band of the spacecraft
+   * @param [in] position_i_m: Position of the spacecraft in the TEME frame [m]
+   * @param [in] velocity_i_m_s: Velocity of the spacecraft in the TEME frame [m/s]
+   */
+  void UpdateCandidates(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s);
+  /**
+   * @fn RefineClosestApproach
+   * @brief Calculate the closest approach between the previous and the current samples
+   * @param [in] object_index: Index of the object
+   * @param [in] time_step_s: Time between the samples [sec]
+   * @param [in] relative_position_i_m: Relative position in the TEME frame at the current sample [m]
+   * @param [in] relative_velocity_i_m_s: Relative velocity in the TEME frame at the current sample [m/s]
+   * @return Close approach information with the relative position in the TEME frame
+   */
+  ConjunctionEvent RefineClosestApproach(const size_t object_index, const double time_step_s, const libra::Vector<3> relative_position_i_m,
+                                         const libra::Vector<3> relative_velocity_i_m_s) const;
+};
+
+#endif  // S2E_LIBRARY_ORBIT_CONJUNCTION_SCREENING_HPP_
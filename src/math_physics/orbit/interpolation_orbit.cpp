@@ -27,6 +27,12 @@ bool InterpolationOrbit::PushAndPopData(const double time, const libra::Vector<3
   return true;
 }
 
+void InterpolationOrbit::SetTrigonometricPeriod(const double period) {
+  for (auto& interpolation : interpolation_position_) {
+    interpolation.SetTrigonometricPeriod(period);
+  }
+}
+
 libra::Vector<3> InterpolationOrbit::CalcPositionWithTrigonometric(const double time, const double period) const {
   libra::Vector<3> output_position;
   for (size_t axis = 0; axis < 3; axis++) {
@@ -34,3 +40,19 @@ libra::Vector<3> InterpolationOrbit::CalcPositionWithTrigonometric(const double
   }
   return output_position;
 }
+
+libra::Vector<3> InterpolationOrbit::CalcPositionWithPolynomial(const double time) const {
+  libra::Vector<3> output_position;
+  for (size_t axis = 0; axis < 3; axis++) {
+    output_position[axis] = interpolation_position_[axis].CalcPolynomial(time);
+  }
+  return output_position;
+}
+
+libra::Vector<3> InterpolationOrbit::CalcVelocityWithPolynomial(const double time) const {
+  libra::Vector<3> output_velocity;
+  for (size_t axis = 0; axis < 3; axis++) {
+    output_velocity[axis] = interpolation_position_[axis].CalcPolynomialDerivative(time);
+  }
+  return output_velocity;
+}
@@ -31,6 +31,12 @@ class InterpolationOrbit {
    * @param [in] position: Satellite position of the new data
    */
   bool PushAndPopData(const double time, const libra::Vector<3> position);
+  /**
+   * @fn SetTrigonometricPeriod
+   * @brief Set the characteristic period of the trigonometric interpolation to compute its weights when the data is updated
+   * @param [in] period: Characteristic period
+   */
+  void SetTrigonometricPeriod(const double period);
 
   /**
    * @fn CalcPositionWithTrigonometric
@@ -40,6 +46,20 @@ class InterpolationOrbit {
    * @return Calculated position
    */
   libra::Vector<3> CalcPositionWithTrigonometric(const double time, const double period = 0.0) const;
+  /**
+   * @fn CalcPositionWithPolynomial
+   * @brief Calculate interpolated position with polynomial method
+   * @param [in] time: time
+   * @return Calculated position
+   */
+  libra::Vector<3> CalcPositionWithPolynomial(const double time) const;
+  /**
+   * @fn CalcVelocityWithPolynomial
+   * @brief Calculate velocity as the time derivative of the polynomial interpolation of the position
+   * @param [in] time: time
+   * @return Calculated velocity (Unit of position per unit of time)
+   */
+  libra::Vector<3> CalcVelocityWithPolynomial(const double time) const;
 
   // Getters
   /**
@@ -51,19 +71,28 @@ class InterpolationOrbit {
    * @fn GetTimeList
    * @return Time list registered for the interpolation
    */
-  inline std::vector<double> GetTimeList() const { return interpolation_position_[0].GetIndependentVariables(); }
+  inline const std::vector<double>& GetTimeList() const { return interpolation_position_[0].GetIndependentVariables(); }
   /**
    * @fn GetTimeList
    * @param[in] axis: Axis of position [0, 2]
    * @return Position list registered for the interpolation
    * @note return id=2 data when the input axis is over 3.
    */
-  inline std::vector<double> GetPositionDataList(const size_t axis) const {
+  inline const std::vector<double>& GetPositionDataList(const size_t axis) const {
     if (axis > 3) {
       return interpolation_position_[2].GetDependentVariables();
     }
     return interpolation_position_[axis].GetDependentVariables();
   }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the interpolations of all axes [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    size_t bytes = sizeof(*this) + (interpolation_position_.capacity() - interpolation_position_.size()) * sizeof(libra::Interpolation);
+    for (const auto& interpolation : interpolation_position_) bytes += interpolation.GetMemoryUsage_bytes();
+    return bytes;
+  }
 
  private:
   std::vector<libra::Interpolation> interpolation_position_;  // 3D vector of interpolation
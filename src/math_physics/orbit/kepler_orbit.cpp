@@ -4,8 +4,9 @@
  */
 #include "kepler_orbit.hpp"
 
+#include <utilities/macros.hpp>
+
 #include "../math/matrix_vector.hpp"
-#include "../math/s2e_math.hpp"
 
 KeplerOrbit::KeplerOrbit() {}
 // Initialize with orbital elements
@@ -37,12 +38,9 @@ void KeplerOrbit::CalcOrbit(double time_jday) {
   double dt_s = (time_jday - oe_.GetEpoch_jday()) * (24.0 * 60.0 * 60.0);
 
   double mean_anomaly_rad = mean_motion_rad_s_ * dt_s;
-  double l_rad = libra::WrapTo2Pi(mean_anomaly_rad);
 
   // Solve Kepler Equation
-  double eccentric_anomaly_rad;
-  eccentric_anomaly_rad = SolveKeplerNewtonMethod(e, l_rad, 1.0e-5, 10);
-  double u_rad = libra::WrapTo2Pi(eccentric_anomaly_rad);
+  double u_rad = SolveKeplerEquation(e, mean_anomaly_rad);
 
   // Calc position and velocity in the plane
   double cos_u = cos(u_rad);
@@ -65,6 +63,16 @@ void KeplerOrbit::CalcOrbit(double time_jday) {
   velocity_i_m_s_ = dcm_inplane_to_i_ * vel_inplane_m_s;
 }
 
+void KeplerOrbit::SolveKeplerEquation(const size_t number_of_objects, const double* eccentricity, const double* mean_anomaly_rad,
+                                      double* eccentric_anomaly_rad) {
+  const double* RESTRICT e = eccentricity;
+  const double* RESTRICT l_rad = mean_anomaly_rad;
+  double* RESTRICT u_rad = eccentric_anomaly_rad;
+  for (size_t i = 0; i < number_of_objects; i++) {
+    u_rad[i] = SolveKeplerEquation(e[i], l_rad[i]);
+  }
+}
+
 double KeplerOrbit::SolveKeplerFirstOrder(const double eccentricity, const double mean_anomaly_rad, const double angle_limit_rad,
                                           const int iteration_limit) {
   double u_prev_rad = mean_anomaly_rad;
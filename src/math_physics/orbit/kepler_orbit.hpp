@@ -6,6 +6,10 @@
 #ifndef S2E_LIBRARY_ORBIT_KEPLER_ORBIT_HPP_
 #define S2E_LIBRARY_ORBIT_KEPLER_ORBIT_HPP_
 
+#include <cmath>
+#include <cstddef>
+
+#include "../math/constants.hpp"
 #include "../math/matrix.hpp"
 #include "../math/vector.hpp"
 #include "./orbital_elements.hpp"
@@ -51,6 +55,58 @@ class KeplerOrbit {
    * @brief Return velocity vector in the inertial frame [m/s]
    */
   inline const libra::Vector<3> GetVelocity_i_m_s() const { return velocity_i_m_s_; }
+  /**
+   * @fn GetOrbitalElements
+   * @brief Return orbital elements
+   */
+  inline const OrbitalElements& GetOrbitalElements() const { return oe_; }
+
+  /**
+   * @fn SolveKeplerEquation
+   * @brief Solve Kepler Equation with Markley's starter and a fifth order correction
+   * @note The error is about the machine precision for all elliptic orbits. The iteration count is fixed and there is no branch, so the
+   *       function can be inlined into the vectorized loops over many objects.
+   * @param [in] eccentricity: Eccentricity (0 <= e < 1)
+   * @param [in] mean_anomaly_rad: Mean anomaly [rad]
+   * @return Eccentric anomaly [rad] (The same revolution with the mean anomaly)
+   */
+  static inline double SolveKeplerEquation(const double eccentricity, const double mean_anomaly_rad) {
+    // Reduce to [-pi, pi)
+    const double revolution_rad = libra::tau * std::floor((mean_anomaly_rad + libra::pi) / libra::tau);
+    const double m = mean_anomaly_rad - revolution_rad;
+    const double e = eccentricity;
+
+    // Starter by the cubic approximation (F. L. Markley, Celestial Mechanics and Dynamical Astronomy, 1995)
+    const double alpha = (3.0 * libra::pi * libra::pi + 1.6 * libra::pi * (libra::pi - std::abs(m)) / (1.0 + e)) / (libra::pi * libra::pi - 6.0);
+    const double d = 3.0 * (1.0 - e) + alpha * e;
+    const double q = 2.0 * alpha * d * (1.0 - e) - m * m;
+    const double r = 3.0 * alpha * d * (d - 1.0 + e) * m + m * m * m;
+    const double w_sqrt = std::cbrt(std::abs(r) + std::sqrt(q * q * q + r * r));
+    const double w = w_sqrt * w_sqrt;
+    const double u_rad = (2.0 * r * w / (w * w + w * q + q * q) + m) / d;
+
+    // Fifth order correction
+    const double e_sin_u = e * std::sin(u_rad);
+    const double e_cos_u = e * std::cos(u_rad);
+    const double f0 = u_rad - e_sin_u - m;
+    const double f1 = 1.0 - e_cos_u;
+    const double delta_3 = -f0 / (f1 - 0.5 * f0 * e_sin_u / f1);
+    const double delta_4 = -f0 / (f1 + 0.5 * delta_3 * e_sin_u + delta_3 * delta_3 * e_cos_u / 6.0);
+    const double delta_5 =
+        -f0 / (f1 + 0.5 * delta_4 * e_sin_u + delta_4 * delta_4 * e_cos_u / 6.0 - delta_4 * delta_4 * delta_4 * e_sin_u / 24.0);
+
+    return u_rad + delta_5 + revolution_rad;
+  }
+  /**
+   * @fn SolveKeplerEquation
+   * @brief Solve Kepler Equation for many objects at once
+   * @param [in] number_of_objects: Number of objects
+   * @param [in] eccentricity: Eccentricity of each object
+   * @param [in] mean_anomaly_rad: Mean anomaly of each object [rad]
+   * @param [out] eccentric_anomaly_rad: Eccentric anomaly of each object [rad]
+   */
+  static void SolveKeplerEquation(const size_t number_of_objects, const double* eccentricity, const double* mean_anomaly_rad,
+                                  double* eccentric_anomaly_rad);
 
  protected:
   libra::Vector<3> position_i_m_;    //!< Position vector in the inertial frame [m]
@@ -0,0 +1,92 @@
+/**
+ * @file kepler_orbit_catalogue.cpp
+ * @brief Class to calculate Kepler orbits of many objects at once
+ */
+#include "kepler_orbit_catalogue.hpp"
+
+#include <cmath>
+#include <utilities/macros.hpp>
+
+#include "../math/matrix_vector.hpp"
+#include "kepler_orbit.hpp"
+
+KeplerOrbitCatalogue::KeplerOrbitCatalogue(const double gravity_constant_m3_s2) : gravity_constant_m3_s2_(gravity_constant_m3_s2) {}
+
+void KeplerOrbitCatalogue::AddObject(const OrbitalElements oe) {
+  const double a_m = oe.GetSemiMajorAxis_m();
+  const double e = oe.GetEccentricity();
+  epoch_jday_.push_back(oe.GetEpoch_jday());
+  semi_major_axis_m_.push_back(a_m);
+  eccentricity_.push_back(e);
+  mean_motion_rad_s_.push_back(std::sqrt(gravity_constant_m3_s2_ / (a_m * a_m * a_m)));
+  semi_minor_axis_m_.push_back(a_m * std::sqrt(1.0 - e * e));
+
+  // Same DCM with KeplerOrbit
+  libra::Matrix<3, 3> dcm_arg_perigee = libra::MakeRotationMatrixZ(-1.0 * oe.GetArgPerigee_rad());
+  libra::Matrix<3, 3> dcm_inclination = libra::MakeRotationMatrixX(-1.0 * oe.GetInclination_rad());
+  libra::Matrix<3, 3> dcm_raan = libra::MakeRotationMatrixZ(-1.0 * oe.GetRaan_rad());
+  libra::Matrix<3, 3> dcm_inplane_to_i = dcm_raan * (dcm_inclination * dcm_arg_perigee);
+  for (size_t axis = 0; axis < 3; axis++) {
+    perigee_direction_[axis].push_back(dcm_inplane_to_i[axis][0]);
+    semi_latus_rectum_direction_[axis].push_back(dcm_inplane_to_i[axis][1]);
+    positions_i_m_[axis].push_back(0.0);
+    velocities_i_m_s_[axis].push_back(0.0);
+  }
+}
+
+void KeplerOrbitCatalogue::Reserve(const size_t number_of_objects) {
+  epoch_jday_.reserve(number_of_objects);
+  semi_major_axis_m_.reserve(number_of_objects);
+  eccentricity_.reserve(number_of_objects);
+  mean_motion_rad_s_.reserve(number_of_objects);
+  semi_minor_axis_m_.reserve(number_of_objects);
+  for (size_t axis = 0; axis < 3; axis++) {
+    perigee_direction_[axis].reserve(number_of_objects);
+    semi_latus_rectum_direction_[axis].reserve(number_of_objects);
+    positions_i_m_[axis].reserve(number_of_objects);
+    velocities_i_m_s_[axis].reserve(number_of_objects);
+  }
+}
+
+void KeplerOrbitCatalogue::CalcOrbit(const double time_jday) {
+  const size_t number_of_objects = GetNumberOfObjects();
+  const double* RESTRICT epoch_jday = epoch_jday_.data();
+  const double* RESTRICT a_m = semi_major_axis_m_.data();
+  const double* RESTRICT e = eccentricity_.data();
+  const double* RESTRICT n_rad_s = mean_motion_rad_s_.data();
+  const double* RESTRICT b_m = semi_minor_axis_m_.data();
+  const double* RESTRICT px = perigee_direction_[0].data();
+  const double* RESTRICT py = perigee_direction_[1].data();
+  const double* RESTRICT pz = perigee_direction_[2].data();
+  const double* RESTRICT qx = semi_latus_rectum_direction_[0].data();
+  const double* RESTRICT qy = semi_latus_rectum_direction_[1].data();
+  const double* RESTRICT qz = semi_latus_rectum_direction_[2].data();
+  double* RESTRICT x = positions_i_m_[0].data();
+  double* RESTRICT y = positions_i_m_[1].data();
+  double* RESTRICT z = positions_i_m_[2].data();
+  double* RESTRICT vx = velocities_i_m_s_[0].data();
+  double* RESTRICT vy = velocities_i_m_s_[1].data();
+  double* RESTRICT vz = velocities_i_m_s_[2].data();
+
+  for (size_t i = 0; i < number_of_objects; i++) {
+    const double dt_s = (time_jday - epoch_jday[i]) * (24.0 * 60.0 * 60.0);
+    const double u_rad = KeplerOrbit::SolveKeplerEquation(e[i], n_rad_s[i] * dt_s);
+
+    // Position and velocity in the plane
+    const double cos_u = std::cos(u_rad);
+    const double sin_u = std::sin(u_rad);
+    const double pos_p_m = a_m[i] * (cos_u - e[i]);
+    const double pos_q_m = b_m[i] * sin_u;
+    const double n_e_cos_u = n_rad_s[i] / (1.0 - e[i] * cos_u);
+    const double vel_p_m_s = -1.0 * a_m[i] * sin_u * n_e_cos_u;
+    const double vel_q_m_s = b_m[i] * cos_u * n_e_cos_u;
+
+    // Transform to the inertial frame
+    x[i] = px[i] * pos_p_m + qx[i] * pos_q_m;
+    y[i] = py[i] * pos_p_m + qy[i] * pos_q_m;
+    z[i] = pz[i] * pos_p_m + qz[i] * pos_q_m;
+    vx[i] = px[i] * vel_p_m_s + qx[i] * vel_q_m_s;
+    vy[i] = py[i] * vel_p_m_s + qy[i] * vel_q_m_s;
+    vz[i] = pz[i] * vel_p_m_s + qz[i] * vel_q_m_s;
+  }
+}
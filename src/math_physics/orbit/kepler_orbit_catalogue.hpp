@@ -0,0 +1,106 @@
+/**
+ * @file kepler_orbit_catalogue.hpp
+ * @brief Class to calculate Kepler orbits of many objects at once
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_KEPLER_ORBIT_CATALOGUE_HPP_
+#define S2E_LIBRARY_ORBIT_KEPLER_ORBIT_CATALOGUE_HPP_
+
+#include <vector>
+
+#include "../math/vector.hpp"
+#include "./orbital_elements.hpp"
+
+/**
+ * @class KeplerOrbitCatalogue
+ * @brief Class to calculate Kepler orbits of many objects at once (e.g., debris population and constellation geometry studies)
+ * @details The orbital elements, the constants of each orbit, and the results are stored in the structure of arrays layout, and all objects
+ *          are calculated in a single loop without branches, so the loop is vectorized by the compiler. The result of each object is the
+ *          same with KeplerOrbit within the rounding error.
+ */
+class KeplerOrbitCatalogue {
+ public:
+  /**
+   * @fn KeplerOrbitCatalogue
+   * @brief Constructor
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+   */
+  KeplerOrbitCatalogue(const double gravity_constant_m3_s2);
+
+  /**
+   * @fn AddObject
+   * @brief Add an object
+   * @param [in] oe: Orbital elements (elliptic orbit)
+   */
+  void AddObject(const OrbitalElements oe);
+  /**
+   * @fn Reserve
+   * @brief Reserve the memory for the objects
+   * @param [in] number_of_objects: Number of objects
+   */
+  void Reserve(const size_t number_of_objects);
+
+  /**
+   * @fn CalcOrbit
+   * @brief Calculate the position and velocity of all objects
+   * @param [in] time_jday: Time expressed as Julian day [day]
+   */
+  void CalcOrbit(const double time_jday);
+
+  // Getters
+  /**
+   * @fn GetNumberOfObjects
+   * @brief Return number of objects
+   */
+  inline size_t GetNumberOfObjects() const { return epoch_jday_.size(); }
+  /**
+   * @fn GetPosition_i_m
+   * @brief Return position of the object in the inertial frame [m]
+   * @param [in] index: Index of the object
+   */
+  inline libra::Vector<3> GetPosition_i_m(const size_t index) const {
+    libra::Vector<3> position_i_m;
+    for (size_t axis = 0; axis < 3; axis++) position_i_m[axis] = positions_i_m_[axis][index];
+    return position_i_m;
+  }
+  /**
+   * @fn GetVelocity_i_m_s
+   * @brief Return velocity of the object in the inertial frame [m/s]
+   * @param [in] index: Index of the object
+   */
+  inline libra::Vector<3> GetVelocity_i_m_s(const size_t index) const {
+    libra::Vector<3> velocity_i_m_s;
+    for (size_t axis = 0; axis < 3; axis++) velocity_i_m_s[axis] = velocities_i_m_s_[axis][index];
+    return velocity_i_m_s;
+  }
+  /**
+   * @fn GetPositionArray_i_m
+   * @brief Return positions of all objects for an axis in the inertial frame [m]
+   * @param [in] axis: Axis of the position (0: x, 1: y, 2: z)
+   */
+  inline const std::vector<double>& GetPositionArray_i_m(const size_t axis) const { return positions_i_m_[axis]; }
+  /**
+   * @fn GetVelocityArray_i_m_s
+   * @brief Return velocities of all objects for an axis in the inertial frame [m/s]
+   * @param [in] axis: Axis of the velocity (0: x, 1: y, 2: z)
+   */
+  inline const std::vector<double>& GetVelocityArray_i_m_s(const size_t axis) const { return velocities_i_m_s_[axis]; }
+
+ private:
+  double gravity_constant_m3_s2_;  //!< Gravity constant of the center body [m3/s2]
+
+  // Orbital elements and constants of each object
+  std::vector<double> epoch_jday_;                      //!< Epoch of the perigee passage [day]
+  std::vector<double> semi_major_axis_m_;               //!< Semi-major axis [m]
+  std::vector<double> eccentricity_;                    //!< Eccentricity
+  std::vector<double> mean_motion_rad_s_;               //!< Mean motion [rad/s]
+  std::vector<double> semi_minor_axis_m_;               //!< Semi-minor axis [m]
+  std::vector<double> perigee_direction_[3];            //!< Unit vector to the perigee in the inertial frame for each axis
+  std::vector<double> semi_latus_rectum_direction_[3];  //!< Unit vector 90 deg ahead of the perigee in the orbit plane for each axis
+
+  // Results
+  std::vector<double> positions_i_m_[3];     //!< Position of each object in the inertial frame for each axis [m]
+  std::vector<double> velocities_i_m_s_[3];  //!< Velocity of each object in the inertial frame for each axis [m/s]
+};
+
+#endif  // S2E_LIBRARY_ORBIT_KEPLER_ORBIT_CATALOGUE_HPP_
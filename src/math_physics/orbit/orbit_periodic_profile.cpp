@@ -0,0 +1,29 @@
+/**
+ * @file orbit_periodic_profile.cpp
+ * @brief Table of a vector quantity over the argument of latitude recorded for one orbit
+ */
+
+#include "orbit_periodic_profile.hpp"
+
+namespace libra {
+
+double CalcArgumentOfLatitude_rad(const Vector<3>& position_i_m, const Vector<3>& velocity_i_m_s) {
+  const Vector<3> angular_momentum_direction = OuterProduct(position_i_m, velocity_i_m_s).CalcNormalizedVector();
+
+  // In-plane basis whose first axis points to the ascending node
+  Vector<3> node_direction(0.0);
+  node_direction[0] = -angular_momentum_direction[1];
+  node_direction[1] = angular_momentum_direction[0];
+  if (node_direction.CalcNorm() < 1.0e-9) {
+    node_direction[0] = 1.0;
+  } else {
+    node_direction = node_direction.CalcNormalizedVector();
+  }
+  const Vector<3> in_plane_direction = OuterProduct(angular_momentum_direction, node_direction);
+
+  double argument_of_latitude_rad = atan2(InnerProduct(position_i_m, in_plane_direction), InnerProduct(position_i_m, node_direction));
+  if (argument_of_latitude_rad < 0.0) argument_of_latitude_rad += tau;
+  return argument_of_latitude_rad;
+}
+
+}  // namespace libra
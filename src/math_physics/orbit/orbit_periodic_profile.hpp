@@ -0,0 +1,131 @@
+/**
+ * @file orbit_periodic_profile.hpp
+ * @brief Table of a vector quantity over the argument of latitude recorded for one orbit
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_ORBIT_PERIODIC_PROFILE_HPP_
+#define S2E_LIBRARY_ORBIT_ORBIT_PERIODIC_PROFILE_HPP_
+
+#include <utilities/snapshot.hpp>
+#include <vector>
+
+#include "../math/vector.hpp"
+
+namespace libra {
+
+/**
+ * @fn CalcArgumentOfLatitude_rad
+ * @brief Calculate the argument of latitude from the position and the velocity
+ * @note The angle is measured from the X axis instead of the ascending node for the equatorial orbits
+ * @param [in] position_i_m: Position in the inertial frame [m]
+ * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+ * @return Argument of latitude in the range [0, 2pi) [rad]
+ */
+double CalcArgumentOfLatitude_rad(const Vector<3>& position_i_m, const Vector<3>& velocity_i_m_s);
+
+/**
+ * @class OrbitPeriodicProfile
+ * @brief Table of a vector quantity over the argument of latitude recorded for one orbit
+ * @details The samples are averaged in the bins of the same width over the argument of latitude until the recorded angle reaches one
+ *          orbit. The empty bins (e.g., the sampling interval is longer than the bin width) are filled with the linear interpolation of the
+ *          neighboring bins. The recorded table is interpolated linearly between the bin centers and is kept until the next recording.
+ */
+template <size_t N>
+class OrbitPeriodicProfile {
+ public:
+  /**
+   * @fn OrbitPeriodicProfile
+   * @brief Constructor
+   * @param [in] number_of_bins: Number of the bins over one orbit
+   */
+  explicit OrbitPeriodicProfile(const size_t number_of_bins);
+
+  /**
+   * @fn StartRecording
+   * @brief Start a new recording. The previous table is kept until the recording finishes.
+   */
+  void StartRecording();
+  /**
+   * @fn Record
+   * @brief Add a sample to the recording
+   * @param [in] argument_of_latitude_rad: Argument of latitude of the sample [rad]
+   * @param [in] value: Sampled value
+   * @return True when the recording of one orbit finished with this sample
+   */
+  bool Record(const double argument_of_latitude_rad, const Vector<N>& value);
+  /**
+   * @fn Interpolate
+   * @brief Return the value of the recorded table at the argument of latitude
+   * @note The zero vector is returned before the first recording finishes
+   * @param [in] argument_of_latitude_rad: Argument of latitude [rad]
+   */
+  Vector<N> Interpolate(const double argument_of_latitude_rad) const;
+
+  /**
+   * @fn IsRecording
+   * @brief Return true while recording
+   */
+  inline bool IsRecording() const { return is_recording_; }
+  /**
+   * @fn IsValid
+   * @brief Return true when the table has been recorded
+   */
+  inline bool IsValid() const { return is_valid_; }
+  /**
+   * @fn GetNumberOfBins
+   * @brief Return the number of the bins over one orbit
+   */
+  inline size_t GetNumberOfBins() const { return table_.size(); }
+  /**
+   * @fn GetRecordedAngle_rad
+   * @brief Return the swept argument of latitude of the current recording [rad]
+   */
+  inline double GetRecordedAngle_rad() const { return recorded_angle_rad_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the table and the recording buffers [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    return sizeof(*this) + (table_.capacity() + sums_.capacity()) * sizeof(Vector<N>) + counts_.capacity() * sizeof(size_t);
+  }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the table and the recording state to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the table and the recording state from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
+ private:
+  double bin_width_rad_;                             //!< Width of the bins [rad]
+  std::vector<Vector<N>> table_;                     //!< Recorded values at the bin centers
+  std::vector<Vector<N>> sums_;                      //!< Sum of the samples in each bin of the current recording
+  std::vector<size_t> counts_;                       //!< Number of the samples in each bin of the current recording
+  bool is_recording_ = false;                        //!< Recording flag
+  bool is_valid_ = false;                            //!< Flag to show the table has been recorded
+  double recorded_angle_rad_ = 0.0;                  //!< Swept argument of latitude of the current recording [rad]
+  double previous_argument_of_latitude_rad_ = -1.0;  //!< Argument of latitude of the previous sample (negative before the first) [rad]
+
+  /**
+   * @fn FinishRecording
+   * @brief Make the table from the recorded samples
+   */
+  void FinishRecording();
+  /**
+   * @fn WrapAngle_rad
+   * @brief Return the angle in the range [0, 2pi) [rad]
+   */
+  static double WrapAngle_rad(const double angle_rad);
+};
+
+}  // namespace libra
+
+#include "orbit_periodic_profile_template_functions.hpp"
+
+#endif  // S2E_LIBRARY_ORBIT_ORBIT_PERIODIC_PROFILE_HPP_
@@ -0,0 +1,128 @@
+/**
+ * @file orbit_periodic_profile_template_functions.hpp
+ * @brief Table of a vector quantity over the argument of latitude recorded for one orbit (template functions)
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_ORBIT_PERIODIC_PROFILE_TEMPLATE_FUNCTIONS_HPP_
+#define S2E_LIBRARY_ORBIT_ORBIT_PERIODIC_PROFILE_TEMPLATE_FUNCTIONS_HPP_
+
+#include <algorithm>
+#include <cmath>
+
+#include "../math/constants.hpp"
+
+namespace libra {
+
+template <size_t N>
+OrbitPeriodicProfile<N>::OrbitPeriodicProfile(const size_t number_of_bins)
+    : bin_width_rad_(tau / (double)number_of_bins),
+      table_(number_of_bins, Vector<N>(0.0)),
+      sums_(number_of_bins, Vector<N>(0.0)),
+      counts_(number_of_bins, 0) {}
+
+template <size_t N>
+void OrbitPeriodicProfile<N>::StartRecording() {
+  for (size_t i = 0; i < table_.size(); i++) {
+    sums_[i] = Vector<N>(0.0);
+    counts_[i] = 0;
+  }
+  is_recording_ = true;
+  recorded_angle_rad_ = 0.0;
+  previous_argument_of_latitude_rad_ = -1.0;
+}
+
+template <size_t N>
+bool OrbitPeriodicProfile<N>::Record(const double argument_of_latitude_rad, const Vector<N>& value) {
+  if (!is_recording_) return false;
+
+  const double angle_rad = WrapAngle_rad(argument_of_latitude_rad);
+  const size_t bin_id = std::min((size_t)(angle_rad / bin_width_rad_), table_.size() - 1);
+  sums_[bin_id] += value;
+  counts_[bin_id]++;
+
+  if (previous_argument_of_latitude_rad_ >= 0.0) {
+    // Only the forward motion is counted (the step over a half orbit is regarded as a backward motion)
+    double step_rad = angle_rad - previous_argument_of_latitude_rad_;
+    if (step_rad < -pi) step_rad += tau;
+    if (step_rad > 0.0 && step_rad < pi) recorded_angle_rad_ += step_rad;
+  }
+  previous_argument_of_latitude_rad_ = angle_rad;
+
+  if (recorded_angle_rad_ < tau) return false;
+  FinishRecording();
+  return true;
+}
+
+template <size_t N>
+Vector<N> OrbitPeriodicProfile<N>::Interpolate(const double argument_of_latitude_rad) const {
+  if (!is_valid_) return Vector<N>(0.0);
+
+  // Linear interpolation between the bin centers
+  const size_t number_of_bins = table_.size();
+  const double position = WrapAngle_rad(argument_of_latitude_rad) / bin_width_rad_ - 0.5;
+  const double floor_position = floor(position);
+  const double ratio = position - floor_position;
+  const size_t lower_id = (size_t)((long)floor_position + (long)number_of_bins) % number_of_bins;
+  const size_t upper_id = (lower_id + 1) % number_of_bins;
+  return (1.0 - ratio) * table_[lower_id] + ratio * table_[upper_id];
+}
+
+template <size_t N>
+void OrbitPeriodicProfile<N>::FinishRecording() {
+  const size_t number_of_bins = table_.size();
+  std::vector<long> filled_ids;
+  for (size_t i = 0; i < number_of_bins; i++) {
+    if (counts_[i] == 0) continue;
+    table_[i] = (1.0 / (double)counts_[i]) * sums_[i];
+    filled_ids.push_back((long)i);
+  }
+
+  // Fill the empty bins with the neighboring filled bins (cyclic)
+  const long size = (long)number_of_bins;
+  for (size_t k = 0; k < filled_ids.size(); k++) {
+    const long lower_id = filled_ids[k];
+    const long upper_id = (k + 1 < filled_ids.size()) ? filled_ids[k + 1] : filled_ids[0] + size;
+    for (long i = lower_id + 1; i < upper_id; i++) {
+      const double ratio = (double)(i - lower_id) / (double)(upper_id - lower_id);
+      table_[i % size] = (1.0 - ratio) * table_[lower_id] + ratio * table_[upper_id % size];
+    }
+  }
+
+  is_recording_ = false;
+  is_valid_ = !filled_ids.empty();
+}
+
+template <size_t N>
+double OrbitPeriodicProfile<N>::WrapAngle_rad(const double angle_rad) {
+  double wrapped_angle_rad = fmod(angle_rad, tau);
+  if (wrapped_angle_rad < 0.0) wrapped_angle_rad += tau;
+  if (wrapped_angle_rad >= tau) wrapped_angle_rad = 0.0;
+  return wrapped_angle_rad;
+}
+
+template <size_t N>
+void OrbitPeriodicProfile<N>::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.Write(table_);
+  snapshot.Write(sums_);
+  snapshot.Write(counts_);
+  snapshot.Write(is_recording_);
+  snapshot.Write(is_valid_);
+  snapshot.Write(recorded_angle_rad_);
+  snapshot.Write(previous_argument_of_latitude_rad_);
+}
+
+template <size_t N>
+void OrbitPeriodicProfile<N>::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.Read(table_);
+  snapshot.Read(sums_);
+  snapshot.Read(counts_);
+  snapshot.Read(is_recording_);
+  snapshot.Read(is_valid_);
+  snapshot.Read(recorded_angle_rad_);
+  snapshot.Read(previous_argument_of_latitude_rad_);
+  bin_width_rad_ = tau / (double)table_.size();
+}
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_ORBIT_ORBIT_PERIODIC_PROFILE_TEMPLATE_FUNCTIONS_HPP_
@@ -4,6 +4,8 @@
  */
 #include "relative_orbit_models.hpp"
 
+#include "kepler_orbit.hpp"
+
 libra::Matrix<6, 6> CalcHillSystemMatrix(double orbit_radius_m, double gravity_constant_m3_s2) {
   libra::Matrix<6, 6> system_matrix;
 
@@ -91,3 +93,126 @@ libra::Matrix<6, 6> CalcHcwStm(double orbit_radius_m, double gravity_constant_m3
   stm[5][5] = cos(n * t);
   return stm;
 }
+
+libra::Matrix<6, 6> CalcYamanakaAnkersenStm(const double semi_latus_rectum_m, const double eccentricity, const double gravity_constant_m3_s2,
+                                            const double initial_true_anomaly_rad, const double elapsed_time_s) {
+  // The formulation is written in the frame of the original paper (x: along-track, z: radial inward) and converted at the end
+  const double e = eccentricity;
+  const double k2 = sqrt(gravity_constant_m3_s2 / pow(semi_latus_rectum_m, 3));
+  const double j = k2 * elapsed_time_s;
+  const double theta_0 = initial_true_anomaly_rad;
+  const double theta = PropagateTrueAnomaly_rad(semi_latus_rectum_m, e, gravity_constant_m3_s2, theta_0, elapsed_time_s);
+
+  const double rho_0 = 1.0 + e * cos(theta_0);
+  const double s_0 = rho_0 * sin(theta_0);
+  const double c_0 = rho_0 * cos(theta_0);
+  const double rho = 1.0 + e * cos(theta);
+  const double s = rho * sin(theta);
+  const double c = rho * cos(theta);
+  const double ds = cos(theta) + e * cos(2.0 * theta);
+  const double dc = -(sin(theta) + e * sin(2.0 * theta));
+
+  // In-plane motion: [x, z, vx, vz]
+  libra::Matrix<4, 4> to_transformed(0.0);  // Physical state to the transformed state at the initial time
+  to_transformed[0][0] = rho_0;
+  to_transformed[1][1] = rho_0;
+  to_transformed[2][0] = -e * sin(theta_0);
+  to_transformed[2][2] = 1.0 / (k2 * rho_0);
+  to_transformed[3][1] = -e * sin(theta_0);
+  to_transformed[3][3] = 1.0 / (k2 * rho_0);
+
+  libra::Matrix<4, 4> inverse_fundamental(0.0);  // Transformed state to the integration constants
+  const double inv_1_e2 = 1.0 / (1.0 - e * e);
+  inverse_fundamental[0][0] = 1.0;
+  inverse_fundamental[0][1] = inv_1_e2 * 3.0 * e * s_0 / rho_0 * (1.0 + 1.0 / rho_0);
+  inverse_fundamental[0][2] = -inv_1_e2 * e * s_0 * (1.0 + 1.0 / rho_0);
+  inverse_fundamental[0][3] = inv_1_e2 * (-e * c_0 + 2.0);
+  inverse_fundamental[1][1] = -inv_1_e2 * 3.0 * s_0 / rho_0 * (1.0 + e * e / rho_0);
+  inverse_fundamental[1][2] = inv_1_e2 * s_0 * (1.0 + 1.0 / rho_0);
+  inverse_fundamental[1][3] = inv_1_e2 * (c_0 - 2.0 * e);
+  inverse_fundamental[2][1] = -inv_1_e2 * 3.0 * (c_0 / rho_0 + e);
+  inverse_fundamental[2][2] = inv_1_e2 * (c_0 * (1.0 + 1.0 / rho_0) + e);
+  inverse_fundamental[2][3] = -inv_1_e2 * s_0;
+  inverse_fundamental[3][1] = inv_1_e2 * (3.0 * rho_0 + e * e - 1.0);
+  inverse_fundamental[3][2] = -inv_1_e2 * rho_0 * rho_0;
+  inverse_fundamental[3][3] = inv_1_e2 * e * s_0;
+
+  libra::Matrix<4, 4> fundamental(0.0);  // Integration constants to the transformed state
+  fundamental[0][0] = 1.0;
+  fundamental[0][1] = -c * (1.0 + 1.0 / rho);
+  fundamental[0][2] = s * (1.0 + 1.0 / rho);
+  fundamental[0][3] = 3.0 * rho * rho * j;
+  fundamental[1][1] = s;
+  fundamental[1][2] = c;
+  fundamental[1][3] = 2.0 - 3.0 * e * s * j;
+  fundamental[2][1] = 2.0 * s;
+  fundamental[2][2] = 2.0 * c - e;
+  fundamental[2][3] = 3.0 * (1.0 - 2.0 * e * s * j);
+  fundamental[3][1] = ds;
+  fundamental[3][2] = dc;
+  fundamental[3][3] = -3.0 * e * (ds * j + s / (rho * rho));
+
+  libra::Matrix<4, 4> from_transformed(0.0);  // Transformed state to the physical state at the final time
+  from_transformed[0][0] = 1.0 / rho;
+  from_transformed[1][1] = 1.0 / rho;
+  from_transformed[2][0] = k2 * e * sin(theta);
+  from_transformed[2][2] = k2 * rho;
+  from_transformed[3][1] = k2 * e * sin(theta);
+  from_transformed[3][3] = k2 * rho;
+
+  const libra::Matrix<4, 4> in_plane_stm = from_transformed * (fundamental * (inverse_fundamental * to_transformed));
+
+  // Out-of-plane motion: [y, vy]
+  libra::Matrix<2, 2> out_of_plane_to_transformed(0.0);
+  out_of_plane_to_transformed[0][0] = rho_0;
+  out_of_plane_to_transformed[1][0] = -e * sin(theta_0);
+  out_of_plane_to_transformed[1][1] = 1.0 / (k2 * rho_0);
+
+  const double d_theta = theta - theta_0;
+  libra::Matrix<2, 2> out_of_plane_rotation;
+  out_of_plane_rotation[0][0] = cos(d_theta);
+  out_of_plane_rotation[0][1] = sin(d_theta);
+  out_of_plane_rotation[1][0] = -sin(d_theta);
+  out_of_plane_rotation[1][1] = cos(d_theta);
+
+  libra::Matrix<2, 2> out_of_plane_from_transformed(0.0);
+  out_of_plane_from_transformed[0][0] = 1.0 / rho;
+  out_of_plane_from_transformed[1][0] = k2 * e * sin(theta);
+  out_of_plane_from_transformed[1][1] = k2 * rho;
+
+  const libra::Matrix<2, 2> out_of_plane_stm = out_of_plane_from_transformed * (out_of_plane_rotation * out_of_plane_to_transformed);
+
+  // Convert to the LVLH frame of S2E (x_paper = y, z_paper = -x, y_paper = -z)
+  libra::Matrix<6, 6> stm(0.0);
+  const size_t in_plane_index[4] = {1, 0, 4, 3};
+  const double in_plane_sign[4] = {1.0, -1.0, 1.0, -1.0};
+  for (size_t row = 0; row < 4; row++) {
+    for (size_t column = 0; column < 4; column++) {
+      stm[in_plane_index[row]][in_plane_index[column]] = in_plane_sign[row] * in_plane_sign[column] * in_plane_stm[row][column];
+    }
+  }
+  const size_t out_of_plane_index[2] = {2, 5};
+  for (size_t row = 0; row < 2; row++) {
+    for (size_t column = 0; column < 2; column++) {
+      stm[out_of_plane_index[row]][out_of_plane_index[column]] = out_of_plane_stm[row][column];
+    }
+  }
+  return stm;
+}
+
+double PropagateTrueAnomaly_rad(const double semi_latus_rectum_m, const double eccentricity, const double gravity_constant_m3_s2,
+                                const double initial_true_anomaly_rad, const double elapsed_time_s) {
+  const double e = eccentricity;
+  const double semi_major_axis_m = semi_latus_rectum_m / (1.0 - e * e);
+  const double mean_motion_rad_s = sqrt(gravity_constant_m3_s2 / pow(semi_major_axis_m, 3));
+
+  // The eccentric anomaly is in the same revolution with the true anomaly
+  const double theta_0_revolution_rad = libra::tau * floor((initial_true_anomaly_rad + libra::pi) / libra::tau);
+  const double half_theta_0 = 0.5 * (initial_true_anomaly_rad - theta_0_revolution_rad);
+  const double u_0_rad = 2.0 * atan2(sqrt(1.0 - e) * sin(half_theta_0), sqrt(1.0 + e) * cos(half_theta_0)) + theta_0_revolution_rad;
+  const double u_rad = KeplerOrbit::SolveKeplerEquation(e, u_0_rad - e * sin(u_0_rad) + mean_motion_rad_s * elapsed_time_s);
+
+  const double u_revolution_rad = libra::tau * floor((u_rad + libra::pi) / libra::tau);
+  const double half_u = 0.5 * (u_rad - u_revolution_rad);
+  return 2.0 * atan2(sqrt(1.0 + e) * sin(half_u), sqrt(1.0 - e) * cos(half_u)) + u_revolution_rad;
+}
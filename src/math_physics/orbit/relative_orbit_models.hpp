@@ -19,7 +19,7 @@ enum class RelativeOrbitModel { kHill = 0 };
  * @enum StmModel
  * @brief State Transition Matrix for the relative orbit
  */
-enum class StmModel { kHcw = 0 };
+enum class StmModel { kHcw = 0, kYamanakaAnkersen = 1 };
 
 // Dynamics Models
 /**
@@ -41,5 +41,31 @@ libra::Matrix<6, 6> CalcHillSystemMatrix(const double orbit_radius_m, const doub
  * @return State Transition Matrix
  */
 libra::Matrix<6, 6> CalcHcwStm(const double orbit_radius_m, const double gravity_constant_m3_s2, const double elapsed_time_s);
+/**
+ * @fn CalcYamanakaAnkersenStm
+ * @brief Calculate Yamanaka-Ankersen State Transition Matrix for the elliptic reference orbit
+ * @note The state is the relative position and velocity in the LVLH frame (x: radial, y: along-track, z: orbit normal) as same as HCW
+ * @param [in] semi_latus_rectum_m: Semi-latus rectum of the reference orbit [m]
+ * @param [in] eccentricity: Eccentricity of the reference orbit
+ * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+ * @param [in] initial_true_anomaly_rad: True anomaly of the reference orbit at the initial time [rad]
+ * @param [in] elapsed_time_s: Elapsed time [s]
+ * @return State Transition Matrix
+ */
+libra::Matrix<6, 6> CalcYamanakaAnkersenStm(const double semi_latus_rectum_m, const double eccentricity, const double gravity_constant_m3_s2,
+                                            const double initial_true_anomaly_rad, const double elapsed_time_s);
+
+/**
+ * @fn PropagateTrueAnomaly_rad
+ * @brief Calculate the true anomaly after the elapsed time on the Kepler orbit
+ * @param [in] semi_latus_rectum_m: Semi-latus rectum [m]
+ * @param [in] eccentricity: Eccentricity
+ * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+ * @param [in] initial_true_anomaly_rad: True anomaly at the initial time [rad]
+ * @param [in] elapsed_time_s: Elapsed time [s]
+ * @return True anomaly [rad]
+ */
+double PropagateTrueAnomaly_rad(const double semi_latus_rectum_m, const double eccentricity, const double gravity_constant_m3_s2,
+                                const double initial_true_anomaly_rad, const double elapsed_time_s);
 
 #endif  // S2E_LIBRARY_ORBIT_RELATIVE_ORBIT_MODEL_HPP_
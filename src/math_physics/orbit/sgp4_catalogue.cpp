@@ -0,0 +1,175 @@
+/**
+ * @file sgp4_catalogue.cpp
+ * @brief Class to propagate a catalogue of TLE objects with SGP4 method
+ */
+#include "sgp4_catalogue.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+#include "sgp4/sgp4io.h"
+
+Sgp4Catalogue::Sgp4Catalogue(const int wgs_setting) {
+  if (wgs_setting == 0) {
+    gravity_constant_setting_ = wgs72old;
+  } else if (wgs_setting == 1) {
+    gravity_constant_setting_ = wgs72;
+  } else {
+    gravity_constant_setting_ = wgs84;
+  }
+
+  double tumin, mu, radius_earth_km, xke, j2, j3, j4, j3oj2;
+  getgravconst(gravity_constant_setting_, tumin, mu, radius_earth_km, xke, j2, j3, j4, j3oj2);
+  earth_radius_m_ = radius_earth_km * 1000.0;
+  gravity_constant_m3_s2_ = mu * 1.0e9;
+}
+
+bool Sgp4Catalogue::AddTle(const std::string name, const std::string tle1, const std::string tle2) {
+  // twoline2rv rewrites the input lines, and all columns of the TLE format are accessed
+  const size_t kTleLength = 69;
+  char line1[130], line2[130];
+  memset(line1, ' ', kTleLength);
+  memset(line2, ' ', kTleLength);
+  memset(line1 + kTleLength, 0, sizeof(line1) - kTleLength);
+  memset(line2 + kTleLength, 0, sizeof(line2) - kTleLength);
+  memcpy(line1, tle1.c_str(), std::min(tle1.size(), sizeof(line1) - 1));
+  memcpy(line2, tle2.c_str(), std::min(tle2.size(), sizeof(line2) - 1));
+
+  char type_run = 'c', type_input = 0;
+  double start_mfe, stop_mfe, delta_min;
+  elsetrec sgp4_data;
+  twoline2rv(line1, line2, type_run, type_input, gravity_constant_setting_, start_mfe, stop_mfe, delta_min, sgp4_data);
+  if (sgp4_data.error > 0) {
+    std::cout << "[WARNINGS] SGP4 catalogue: the TLE of " << name << " cannot be initialized. (error code = " << sgp4_data.error << ")"
+              << std::endl;
+    return false;
+  }
+
+  sgp4_data_.push_back(sgp4_data);
+  names_.push_back(name);
+  for (size_t axis = 0; axis < 3; axis++) {
+    positions_i_m_[axis].push_back(0.0);
+    velocities_i_m_s_[axis].push_back(0.0);
+  }
+  return true;
+}
+
+size_t Sgp4Catalogue::ReadTleFile(const std::string file_path) {
+  std::ifstream file(file_path);
+  if (!file.is_open()) {
+    std::cerr << "[ERROR] SGP4 catalogue: the TLE file " << file_path << " is not found." << std::endl;
+    return 0;
+  }
+
+  size_t number_of_objects = 0;
+  std::string line, name, tle1;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty()) continue;
+
+    if (line.size() >= 2 && line[0] == '1' && line[1] == ' ') {
+      tle1 = line;
+    } else if (line.size() >= 2 && line[0] == '2' && line[1] == ' ' && !tle1.empty()) {
+      // The satellite number is used as the name for the two-line format
+      if (name.empty()) name = tle1.substr(2, 5);
+      if (AddTle(name, tle1, line)) number_of_objects++;
+      name.clear();
+      tle1.clear();
+    } else {
+      // Name line of the three-line format
+      name = line.substr(0, line.find_last_not_of(' ') + 1);
+      if (name.size() >= 2 && name[0] == '0' && name[1] == ' ') name = name.substr(2);
+      tle1.clear();
+    }
+  }
+  return number_of_objects;
+}
+
+void Sgp4Catalogue::Propagate(const double current_time_jd, const unsigned int number_of_threads) {
+  std::vector<size_t> indices(sgp4_data_.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  Propagate(current_time_jd, indices, number_of_threads);
+}
+
+void Sgp4Catalogue::Propagate(const double current_time_jd, const std::vector<size_t>& indices, const unsigned int number_of_threads) {
+  const size_t number_of_objects = indices.size();
+  if (number_of_threads <= 1 || number_of_objects < 2) {
+    PropagateObjects(current_time_jd, indices, 0, number_of_objects);
+    return;
+  }
+
+  // The threads write the separate blocks of the arrays, so no lock is needed
+  const size_t number_of_blocks = std::min((size_t)number_of_threads, number_of_objects);
+  const size_t block_size = (number_of_objects + number_of_blocks - 1) / number_of_blocks;
+  std::vector<std::thread> threads;
+  for (size_t block = 1; block < number_of_blocks; block++) {
+    const size_t begin_index = block * block_size;
+    const size_t end_index = std::min(begin_index + block_size, number_of_objects);
+    if (begin_index >= end_index) break;
+    threads.emplace_back(&Sgp4Catalogue::PropagateObjects, this, current_time_jd, std::cref(indices), begin_index, end_index);
+  }
+  PropagateObjects(current_time_jd, indices, 0, std::min(block_size, number_of_objects));
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void Sgp4Catalogue::PropagateObjects(const double current_time_jd, const std::vector<size_t>& indices, const size_t begin, const size_t end) {
+  double position_i_km[3];
+  double velocity_i_km_s[3];
+  for (size_t i = begin; i < end; i++) {
+    const size_t index = indices[i];
+    elsetrec& sgp4_data = sgp4_data_[index];
+    const double elapse_time_min = (current_time_jd - sgp4_data.jdsatepoch) * (24.0 * 60.0);
+    sgp4(gravity_constant_setting_, sgp4_data, elapse_time_min, position_i_km, velocity_i_km_s);
+
+    for (size_t axis = 0; axis < 3; axis++) {
+      positions_i_m_[axis][index] = position_i_km[axis] * 1000.0;
+      velocities_i_m_s_[axis][index] = velocity_i_km_s[axis] * 1000.0;
+    }
+  }
+}
+
+bool Sgp4Catalogue::CalcState(const size_t index, const double time_jd, libra::Vector<3>& position_i_m, libra::Vector<3>& velocity_i_m_s) const {
+  // sgp4 rewrites the working variables in the SGP4 data
+  elsetrec sgp4_data = sgp4_data_[index];
+  const double elapse_time_min = (time_jd - sgp4_data.jdsatepoch) * (24.0 * 60.0);
+  double position_i_km[3];
+  double velocity_i_km_s[3];
+  sgp4(gravity_constant_setting_, sgp4_data, elapse_time_min, position_i_km, velocity_i_km_s);
+
+  for (size_t axis = 0; axis < 3; axis++) {
+    position_i_m[axis] = position_i_km[axis] * 1000.0;
+    velocity_i_m_s[axis] = velocity_i_km_s[axis] * 1000.0;
+  }
+  return sgp4_data.error == 0;
+}
+
+std::vector<size_t> Sgp4Catalogue::FindObjectsWithinDistance(const libra::Vector<3> reference_position_i_m, const double distance_m) const {
+  std::vector<size_t> indices;
+  const double distance2_m2 = distance_m * distance_m;
+  const double* x_m = positions_i_m_[0].data();
+  const double* y_m = positions_i_m_[1].data();
+  const double* z_m = positions_i_m_[2].data();
+  for (size_t index = 0; index < sgp4_data_.size(); index++) {
+    const double dx_m = x_m[index] - reference_position_i_m[0];
+    const double dy_m = y_m[index] - reference_position_i_m[1];
+    const double dz_m = z_m[index] - reference_position_i_m[2];
+    if (dx_m * dx_m + dy_m * dy_m + dz_m * dz_m > distance2_m2) continue;
+    if (sgp4_data_[index].error > 0) continue;
+    indices.push_back(index);
+  }
+  return indices;
+}
+
+int Sgp4Catalogue::FindIndex(const long satellite_number) const {
+  for (size_t index = 0; index < sgp4_data_.size(); index++) {
+    if (sgp4_data_[index].satnum == satellite_number) return (int)index;
+  }
+  return -1;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file sgp4_catalogue.hpp
+ * @brief Class to propagate a catalogue of TLE objects with SGP4 method
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_SGP4_CATALOGUE_HPP_
+#define S2E_LIBRARY_ORBIT_SGP4_CATALOGUE_HPP_
+
+#include <string>
+#include <vector>
+
+#include "../math/vector.hpp"
+#include "sgp4/sgp4unit.h"
+
+/**
+ * @class Sgp4Catalogue
+ * @brief Class to propagate a catalogue of TLE objects with SGP4 method
+ * @details The SGP4 data of each object is the same with Sgp4OrbitPropagation, so the result of each object is identical to the single
+ *          object propagation. The position and velocity are stored in the structure of arrays layout to scan all objects efficiently in
+ *          the distance queries (e.g., conjunction screening). The objects are divided into the contiguous blocks for the threads.
+ */
+class Sgp4Catalogue {
+ public:
+  /**
+   * @fn Sgp4Catalogue
+   * @brief Constructor
+   * @param [in] wgs_setting: Wold Geodetic System (0: WGS72 old, 1: WGS72, 2: WGS84)
+   */
+  Sgp4Catalogue(const int wgs_setting = 2);
+
+  /**
+   * @fn AddTle
+   * @brief Add an object with TLE
+   * @param [in] name: Name of the object
+   * @param [in] tle1: The first line of TLE
+   * @param [in] tle2: The second line of TLE
+   * @return True when the TLE is added without the SGP4 initialization error
+   */
+  bool AddTle(const std::string name, const std::string tle1, const std::string tle2);
+  /**
+   * @fn ReadTleFile
+   * @brief Add all objects in the TLE file
+   * @note Both the two-line format and the three-line format with the name line are supported
+   * @param [in] file_path: Path to the TLE file
+   * @return Number of the added objects
+   */
+  size_t ReadTleFile(const std::string file_path);
+
+  /**
+   * @fn Propagate
+   * @brief Calculate the position and velocity of all objects
+   * @param [in] current_time_jd: Current Julian day [day]
+   * @param [in] number_of_threads: Number of threads including the calling thread
+   */
+  void Propagate(const double current_time_jd, const unsigned int number_of_threads = 1);
+  /**
+   * @fn Propagate
+   * @brief Calculate the position and velocity of the selected objects
+   * @note The position and velocity of the other objects are not updated
+   * @param [in] current_time_jd: Current Julian day [day]
+   * @param [in] indices: Indices of the objects to be propagated
+   * @param [in] number_of_threads: Number of threads including the calling thread
+   */
+  void Propagate(const double current_time_jd, const std::vector<size_t>& indices, const unsigned int number_of_threads = 1);
+  /**
+   * @fn CalcState
+   * @brief Calculate the position and velocity of an object at an arbitrary time without updating the stored states
+   * @note The SGP4 data is copied, so this function can be called from multiple threads at the same time
+   * @param [in] index: Index of the object
+   * @param [in] time_jd: Julian day [day]
+   * @param [out] position_i_m: Position of the object in the inertial frame [m]
+   * @param [out] velocity_i_m_s: Velocity of the object in the inertial frame [m/s]
+   * @return True when SGP4 has no error
+   */
+  bool CalcState(const size_t index, const double time_jd, libra::Vector<3>& position_i_m, libra::Vector<3>& velocity_i_m_s) const;
+
+  /**
+   * @fn FindObjectsWithinDistance
+   * @brief Return the indices of the objects within the distance from the reference position
+   * @note The objects with the SGP4 error are not included
+   * @param [in] reference_position_i_m: Reference position in the inertial frame [m]
+   * @param [in] distance_m: Threshold distance [m]
+   */
+  std::vector<size_t> FindObjectsWithinDistance(const libra::Vector<3> reference_position_i_m, const double distance_m) const;
+  /**
+   * @fn FindIndex
+   * @brief Return the index of the object with the satellite number. -1 is returned when the object is not found.
+   * @param [in] satellite_number: Satellite catalogue number
+   */
+  int FindIndex(const long satellite_number) const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfObjects
+   * @brief Return number of objects
+   */
+  inline size_t GetNumberOfObjects() const { return sgp4_data_.size(); }
+  /**
+   * @fn GetName
+   * @brief Return name of the object
+   * @param [in] index: Index of the object
+   */
+  inline const std::string& GetName(const size_t index) const { return names_[index]; }
+  /**
+   * @fn GetSatelliteNumber
+   * @brief Return satellite catalogue number of the object
+   * @param [in] index: Index of the object
+   */
+  inline long GetSatelliteNumber(const size_t index) const { return sgp4_data_[index].satnum; }
+  /**
+   * @fn GetError
+   * @brief Return SGP4 error code of the latest propagation (0 means no error)
+   * @param [in] index: Index of the object
+   */
+  inline int GetError(const size_t index) const { return sgp4_data_[index].error; }
+  /**
+   * @fn GetPerigeeRadius_m
+   * @brief Return perigee radius of the mean elements of the object [m]
+   * @param [in] index: Index of the object
+   */
+  inline double GetPerigeeRadius_m(const size_t index) const { return (sgp4_data_[index].altp + 1.0) * earth_radius_m_; }
+  /**
+   * @fn GetApogeeRadius_m
+   * @brief Return apogee radius of the mean elements of the object [m]
+   * @param [in] index: Index of the object
+   */
+  inline double GetApogeeRadius_m(const size_t index) const { return (sgp4_data_[index].alta + 1.0) * earth_radius_m_; }
+  /**
+   * @fn GetPosition_i_m
+   * @brief Return position of the object in the inertial frame [m]
+   * @param [in] index: Index of the object
+   */
+  inline libra::Vector<3> GetPosition_i_m(const size_t index) const {
+    libra::Vector<3> position_i_m;
+    for (size_t axis = 0; axis < 3; axis++) position_i_m[axis] = positions_i_m_[axis][index];
+    return position_i_m;
+  }
+  /**
+   * @fn GetVelocity_i_m_s
+   * @brief Return velocity of the object in the inertial frame [m/s]
+   * @param [in] index: Index of the object
+   */
+  inline libra::Vector<3> GetVelocity_i_m_s(const size_t index) const {
+    libra::Vector<3> velocity_i_m_s;
+    for (size_t axis = 0; axis < 3; axis++) velocity_i_m_s[axis] = velocities_i_m_s_[axis][index];
+    return velocity_i_m_s;
+  }
+  /**
+   * @fn GetRelativePosition_i_m
+   * @brief Return relative position of the object from the reference position in the inertial frame [m]
+   * @param [in] index: Index of the object
+   * @param [in] reference_position_i_m: Reference position in the inertial frame [m]
+   */
+  inline libra::Vector<3> GetRelativePosition_i_m(const size_t index, const libra::Vector<3> reference_position_i_m) const {
+    return GetPosition_i_m(index) - reference_position_i_m;
+  }
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of the Earth of the WGS setting [m3/s2]
+   */
+  inline double GetGravityConstant_m3_s2() const { return gravity_constant_m3_s2_; }
+  /**
+   * @fn GetPositionArray_i_m
+   * @brief Return positions of all objects for an axis in the inertial frame [m]
+   * @param [in] axis: Axis of the position (0: x, 1: y, 2: z)
+   */
+  inline const std::vector<double>& GetPositionArray_i_m(const size_t axis) const { return positions_i_m_[axis]; }
+
+ private:
+  gravconsttype gravity_constant_setting_;   //!< Gravity constant value type
+  double earth_radius_m_;                    //!< Earth radius of the gravity constant setting [m]
+  double gravity_constant_m3_s2_;            //!< Gravity constant of the Earth of the gravity constant setting [m3/s2]
+  std::vector<elsetrec> sgp4_data_;          //!< Structure data for SGP4 library of each object
+  std::vector<std::string> names_;           //!< Name of each object
+  std::vector<double> positions_i_m_[3];     //!< Position of each object in the inertial frame for each axis [m]
+  std::vector<double> velocities_i_m_s_[3];  //!< Velocity of each object in the inertial frame for each axis [m/s]
+
+  /**
+   * @fn PropagateObjects
+   * @brief Calculate the position and velocity of the objects in the range of the index list
+   * @param [in] current_time_jd: Current Julian day [day]
+   * @param [in] indices: Indices of the objects
+   * @param [in] begin: First position in the index list
+   * @param [in] end: Position after the last object in the index list
+   */
+  void PropagateObjects(const double current_time_jd, const std::vector<size_t>& indices, const size_t begin, const size_t end);
+};
+
+#endif  // S2E_LIBRARY_ORBIT_SGP4_CATALOGUE_HPP_
@@ -0,0 +1,129 @@
+/**
+ * @file test_conjunction_screening.cpp
+ * @brief Test codes for ConjunctionScreening class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <environment/global/earth_rotation.hpp>
+
+#include "conjunction_screening.hpp"
+
+namespace {
+const char* kIssTle1 = "1 25544U 98067A   20076.51604214  .00016717  00000-0  10270-3 0  9005";
+const char* kIssTle2 = "2 25544  51.6412  86.9962 0006063  30.9353 329.2153 15.49228202 17647";
+const char* kHstTle1 = "1 20580U 90037B   20076.50669788  .00000993  00000-0  37929-4 0  9994";
+const char* kHstTle2 = "2 20580  28.4697 123.5498 0002839 135.4135 298.3145 15.09313444440529";
+}  // namespace
+
+/**
+ * @brief Test for the fly-by with the linear relative motion
+ */
+TEST(ConjunctionScreening, LinearFlyBy) {
+  Sgp4Catalogue catalogue;
+  catalogue.AddTle("HST", kHstTle1, kHstTle2);
+  catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+  Sgp4Catalogue reference_catalogue;
+  reference_catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+
+  // The spacecraft passes the ISS with the miss distance of 200 m at 125 s
+  const double start_time_jd = 2458928.5;
+  const double time_of_closest_approach_s = 125.0;
+  libra::Vector<3> miss_vector_m(0.0), relative_velocity_m_s(0.0);
+  miss_vector_m[2] = 200.0;
+  relative_velocity_m_s[0] = 1000.0;
+
+  ConjunctionScreening screening(catalogue, 1000.0, 2);
+  for (double time_s = 0.0; time_s <= 300.0; time_s += 60.0) {
+    const double current_time_jd = start_time_jd + time_s / (24.0 * 60.0 * 60.0);
+    reference_catalogue.Propagate(current_time_jd);
+    const libra::Vector<3> position_i_m =
+        reference_catalogue.GetPosition_i_m(0) + miss_vector_m + (time_s - time_of_closest_approach_s) * relative_velocity_m_s;
+    const libra::Vector<3> velocity_i_m_s = reference_catalogue.GetVelocity_i_m_s(0) + relative_velocity_m_s;
+    screening.Update(time_s, current_time_jd, position_i_m, velocity_i_m_s, libra::MakeIdentityMatrix<3>());
+
+    // The perigee of HST is higher than the apogee of ISS
+    EXPECT_EQ(1, screening.GetNumberOfCandidates());
+  }
+
+  ASSERT_EQ(1, screening.GetConjunctionEvents().size());
+  const ConjunctionEvent& event = screening.GetConjunctionEvents()[0];
+  EXPECT_EQ(1, event.object_index_);
+  EXPECT_NEAR(time_of_closest_approach_s, event.time_of_closest_approach_s_, 1.0e-2);
+  EXPECT_NEAR(start_time_jd + time_of_closest_approach_s / (24.0 * 60.0 * 60.0), event.time_of_closest_approach_jd_, 1.0e-7);
+  EXPECT_NEAR(200.0, event.miss_distance_m_, 1.0);
+  EXPECT_NEAR(1000.0, event.relative_speed_m_s_, 1.0);
+}
+
+/**
+ * @brief Test for the fly-by farther than the threshold
+ */
+TEST(ConjunctionScreening, FarFlyBy) {
+  Sgp4Catalogue catalogue;
+  catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+
+  const double start_time_jd = 2458928.5;
+  libra::Vector<3> miss_vector_m(0.0), relative_velocity_m_s(0.0);
+  miss_vector_m[2] = 2000.0;
+  relative_velocity_m_s[0] = 1000.0;
+
+  ConjunctionScreening screening(catalogue, 1000.0);
+  Sgp4Catalogue reference_catalogue;
+  reference_catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+  for (double time_s = 0.0; time_s <= 300.0; time_s += 60.0) {
+    const double current_time_jd = start_time_jd + time_s / (24.0 * 60.0 * 60.0);
+    reference_catalogue.Propagate(current_time_jd);
+    const libra::Vector<3> position_i_m = reference_catalogue.GetPosition_i_m(0) + miss_vector_m + (time_s - 125.0) * relative_velocity_m_s;
+    screening.Update(time_s, current_time_jd, position_i_m, reference_catalogue.GetVelocity_i_m_s(0) + relative_velocity_m_s,
+                     libra::MakeIdentityMatrix<3>());
+  }
+
+  EXPECT_EQ(0, screening.GetConjunctionEvents().size());
+}
+
+/**
+ * @brief Test for the spacecraft state in the J2000 frame
+ */
+TEST(ConjunctionScreening, J2000Primary) {
+  Sgp4Catalogue catalogue;
+  catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+  Sgp4Catalogue reference_catalogue;
+  reference_catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+
+  // The same fly-by as LinearFlyBy defined in the TEME frame
+  const double start_time_jd = 2458928.5;
+  const double time_of_closest_approach_s = 125.0;
+  libra::Vector<3> miss_vector_m(0.0), relative_velocity_m_s(0.0);
+  miss_vector_m[2] = 200.0;
+  relative_velocity_m_s[0] = 1000.0;
+
+  EarthRotation earth_rotation(EarthRotationMode::kFull);
+  ConjunctionScreening screening(catalogue, 1000.0);
+  ConjunctionScreening screening_without_conversion(catalogue, 1000.0);
+  for (double time_s = 0.0; time_s <= 300.0; time_s += 60.0) {
+    const double current_time_jd = start_time_jd + time_s / (24.0 * 60.0 * 60.0);
+    reference_catalogue.Propagate(current_time_jd);
+    earth_rotation.Update(current_time_jd);
+    const libra::Matrix<3, 3>& dcm_j2000_to_teme = earth_rotation.GetDcmJ2000ToTeme();
+    const libra::Matrix<3, 3> dcm_teme_to_j2000 = dcm_j2000_to_teme.Transpose();
+    const libra::Vector<3> position_teme_m =
+        reference_catalogue.GetPosition_i_m(0) + miss_vector_m + (time_s - time_of_closest_approach_s) * relative_velocity_m_s;
+    const libra::Vector<3> velocity_teme_m_s = reference_catalogue.GetVelocity_i_m_s(0) + relative_velocity_m_s;
+    const libra::Vector<3> position_i_m = dcm_teme_to_j2000 * position_teme_m;
+    const libra::Vector<3> velocity_i_m_s = dcm_teme_to_j2000 * velocity_teme_m_s;
+    screening.Update(time_s, current_time_jd, position_i_m, velocity_i_m_s, dcm_j2000_to_teme);
+    screening_without_conversion.Update(time_s, current_time_jd, position_i_m, velocity_i_m_s, libra::MakeIdentityMatrix<3>());
+  }
+
+  ASSERT_EQ(1, screening.GetConjunctionEvents().size());
+  const ConjunctionEvent& event = screening.GetConjunctionEvents()[0];
+  EXPECT_NEAR(time_of_closest_approach_s, event.time_of_closest_approach_s_, 1.0e-2);
+  EXPECT_NEAR(200.0, event.miss_distance_m_, 1.0);
+  // The relative position is returned in the J2000 frame
+  const libra::Vector<3> miss_vector_i_m = earth_rotation.GetDcmJ2000ToTeme().Transpose() * miss_vector_m;
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(-miss_vector_i_m[i], event.relative_position_i_m_[i], 1.0);
+  }
+
+  // The frame difference of about 0.3 deg in 2020 is tens of kilometers in the orbit
+  EXPECT_EQ(0, screening_without_conversion.GetConjunctionEvents().size());
+}
@@ -48,3 +48,34 @@ TEST(InterpolationOrbit, PushAndPop) {
   bool ret = interpolation_orbit.PushAndPopData(time, position);
   EXPECT_FALSE(ret);
 }
+
+/**
+ * @brief Test for CalcPositionWithPolynomial and CalcVelocityWithPolynomial functions
+ */
+TEST(InterpolationOrbit, CalcPolynomial) {
+  size_t degree = 9;
+  InterpolationOrbit interpolation_orbit(degree);
+
+  // Circular orbit sampled every 30 s
+  const double radius_m = 7000e3;
+  const double angular_velocity_rad_s = 2.0 * M_PI / 5800.0;
+  for (size_t i = 0; i < degree; i++) {
+    double time = 30.0 * i;
+    double phase = angular_velocity_rad_s * time;
+    libra::Vector<3> position{0.0};
+    position[0] = radius_m * cos(phase);
+    position[1] = radius_m * sin(phase);
+    interpolation_orbit.PushAndPopData(time, position);
+  }
+
+  double time = 125.0;
+  double phase = angular_velocity_rad_s * time;
+  libra::Vector<3> position = interpolation_orbit.CalcPositionWithPolynomial(time);
+  EXPECT_NEAR(radius_m * cos(phase), position[0], 1e-3);
+  EXPECT_NEAR(radius_m * sin(phase), position[1], 1e-3);
+  EXPECT_NEAR(0.0, position[2], 1e-3);
+  libra::Vector<3> velocity = interpolation_orbit.CalcVelocityWithPolynomial(time);
+  EXPECT_NEAR(-radius_m * angular_velocity_rad_s * sin(phase), velocity[0], 1e-5);
+  EXPECT_NEAR(radius_m * angular_velocity_rad_s * cos(phase), velocity[1], 1e-5);
+  EXPECT_NEAR(0.0, velocity[2], 1e-5);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file test_kepler_orbit.cpp
+ * @brief Test codes for KeplerOrbit and KeplerOrbitCatalogue classes with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "kepler_orbit.hpp"
+#include "kepler_orbit_catalogue.hpp"
+
+/**
+ * @brief Test for the residual of Kepler Equation
+ */
+TEST(KeplerOrbit, SolveKeplerEquation) {
+  for (double e = 0.0; e < 0.999; e += 0.01) {
+    for (double mean_anomaly_rad = -10.0; mean_anomaly_rad < 10.0; mean_anomaly_rad += 0.0137) {
+      const double u_rad = KeplerOrbit::SolveKeplerEquation(e, mean_anomaly_rad);
+      EXPECT_NEAR(mean_anomaly_rad, u_rad - e * sin(u_rad), 1e-13);
+    }
+  }
+  // Same revolution with the mean anomaly
+  EXPECT_NEAR(4.0 * libra::pi, KeplerOrbit::SolveKeplerEquation(0.5, 4.0 * libra::pi), 1e-13);
+  // Highly eccentric orbit near the perigee
+  const double u_rad = KeplerOrbit::SolveKeplerEquation(0.9999, 1e-6);
+  EXPECT_NEAR(1e-6, u_rad - 0.9999 * sin(u_rad), 1e-15);
+}
+
+/**
+ * @brief Test for the identity of the batch solver with the single object solver
+ */
+TEST(KeplerOrbit, SolveKeplerEquationBatch) {
+  std::vector<double> e, mean_anomaly_rad;
+  for (size_t i = 0; i < 1001; i++) {
+    e.push_back(0.95 * i / 1000.0);
+    mean_anomaly_rad.push_back(-20.0 + 0.04 * i);
+  }
+  std::vector<double> u_rad(e.size());
+  KeplerOrbit::SolveKeplerEquation(e.size(), e.data(), mean_anomaly_rad.data(), u_rad.data());
+  for (size_t i = 0; i < e.size(); i++) {
+    EXPECT_NEAR(KeplerOrbit::SolveKeplerEquation(e[i], mean_anomaly_rad[i]), u_rad[i], 1e-14);
+  }
+}
+
+/**
+ * @brief Test for the identity of the catalogue with the single object calculation
+ */
+TEST(KeplerOrbitCatalogue, IdenticalToSingleObject) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double epoch_jday = 2460000.5;
+  std::vector<OrbitalElements> oe_list;
+  oe_list.push_back(OrbitalElements(epoch_jday, 6878.0e3, 0.001, 97.4 * libra::deg_to_rad, 30.0 * libra::deg_to_rad, 90.0 * libra::deg_to_rad));
+  oe_list.push_back(OrbitalElements(epoch_jday, 26560.0e3, 0.01, 55.0 * libra::deg_to_rad, 120.0 * libra::deg_to_rad, 10.0 * libra::deg_to_rad));
+  oe_list.push_back(OrbitalElements(epoch_jday, 24400.0e3, 0.73, 7.0 * libra::deg_to_rad, 200.0 * libra::deg_to_rad, 180.0 * libra::deg_to_rad));
+
+  KeplerOrbitCatalogue catalogue(gravity_constant_m3_s2);
+  catalogue.Reserve(oe_list.size());
+  for (const auto& oe : oe_list) catalogue.AddObject(oe);
+  EXPECT_EQ(oe_list.size(), catalogue.GetNumberOfObjects());
+
+  const double time_jday = epoch_jday + 0.37;
+  catalogue.CalcOrbit(time_jday);
+  for (size_t i = 0; i < oe_list.size(); i++) {
+    KeplerOrbit kepler_orbit(gravity_constant_m3_s2, oe_list[i]);
+    kepler_orbit.CalcOrbit(time_jday);
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(kepler_orbit.GetPosition_i_m()[axis], catalogue.GetPosition_i_m(i)[axis], 1e-6);
+      EXPECT_NEAR(kepler_orbit.GetVelocity_i_m_s()[axis], catalogue.GetVelocity_i_m_s(i)[axis], 1e-9);
+    }
+  }
+}
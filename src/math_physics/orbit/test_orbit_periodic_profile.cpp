@@ -0,0 +1,93 @@
+/**
+ * @file test_orbit_periodic_profile.cpp
+ * @brief Test codes for OrbitPeriodicProfile class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../math/constants.hpp"
+#include "orbit_periodic_profile.hpp"
+
+/**
+ * @brief Test for CalcArgumentOfLatitude_rad with an inclined orbit
+ */
+TEST(OrbitPeriodicProfile, ArgumentOfLatitude) {
+  const double inclination_rad = 60.0 * libra::deg_to_rad;
+  for (size_t i = 0; i < 12; i++) {
+    const double argument_of_latitude_rad = (double)i * 30.0 * libra::deg_to_rad;
+    // Ascending node on the Y axis (RAAN = 90 deg)
+    libra::Vector<3> position_i_m;
+    position_i_m[0] = -cos(inclination_rad) * sin(argument_of_latitude_rad);
+    position_i_m[1] = cos(argument_of_latitude_rad);
+    position_i_m[2] = sin(inclination_rad) * sin(argument_of_latitude_rad);
+    libra::Vector<3> velocity_i_m_s;
+    velocity_i_m_s[0] = -cos(inclination_rad) * cos(argument_of_latitude_rad);
+    velocity_i_m_s[1] = -sin(argument_of_latitude_rad);
+    velocity_i_m_s[2] = sin(inclination_rad) * cos(argument_of_latitude_rad);
+
+    const double result_rad = libra::CalcArgumentOfLatitude_rad(7.0e6 * position_i_m, 7.5e3 * velocity_i_m_s);
+    EXPECT_NEAR(argument_of_latitude_rad, result_rad, 1e-12);
+  }
+}
+
+/**
+ * @brief Test for the recording and the interpolation of a sinusoidal profile
+ */
+TEST(OrbitPeriodicProfile, RecordAndInterpolate) {
+  const size_t number_of_bins = 72;
+  libra::OrbitPeriodicProfile<2> profile(number_of_bins);
+  EXPECT_FALSE(profile.IsValid());
+  EXPECT_DOUBLE_EQ(0.0, profile.Interpolate(1.0)[0]);
+
+  // Start at the middle of the orbit and sample with a step smaller than the bin width
+  profile.StartRecording();
+  const double step_rad = 0.01;
+  const double start_rad = 2.0;
+  bool is_finished = false;
+  double angle_rad = start_rad;
+  for (; !is_finished; angle_rad += step_rad) {
+    EXPECT_TRUE(profile.IsRecording());
+    libra::Vector<2> value;
+    value[0] = sin(angle_rad);
+    value[1] = 1.0;
+    is_finished = profile.Record(angle_rad, value);
+  }
+  EXPECT_FALSE(profile.IsRecording());
+  EXPECT_TRUE(profile.IsValid());
+  EXPECT_NEAR(start_rad + libra::tau, angle_rad, 2.0 * step_rad);
+
+  // The bin average and the linear interpolation make the error of the order of the squared bin width
+  const double bin_width_rad = libra::tau / (double)number_of_bins;
+  for (double query_angle_rad = -1.0; query_angle_rad < 8.0; query_angle_rad += 0.37) {
+    const libra::Vector<2> value = profile.Interpolate(query_angle_rad);
+    EXPECT_NEAR(sin(query_angle_rad), value[0], bin_width_rad * bin_width_rad);
+    EXPECT_NEAR(1.0, value[1], 1e-12);
+  }
+}
+
+/**
+ * @brief Test for the recording with the sampling interval longer than the bin width
+ */
+TEST(OrbitPeriodicProfile, SparseSamples) {
+  libra::OrbitPeriodicProfile<1> profile(36);
+  profile.StartRecording();
+  const double step_rad = 40.0 * libra::deg_to_rad;
+  bool is_finished = false;
+  for (size_t i = 0; !is_finished; i++) {
+    libra::Vector<1> value;
+    value[0] = (double)(i % 9) * step_rad;
+    is_finished = profile.Record((double)i * step_rad, value);
+  }
+  EXPECT_TRUE(profile.IsValid());
+
+  // The empty bins are filled linearly between the sampled bins
+  const double bin_width_rad = 10.0 * libra::deg_to_rad;
+  EXPECT_NEAR(0.5 * step_rad, profile.Interpolate(2.5 * bin_width_rad)[0], 1e-12);
+
+  // A new recording keeps the previous table until it finishes
+  profile.StartRecording();
+  EXPECT_TRUE(profile.IsRecording());
+  EXPECT_TRUE(profile.IsValid());
+  EXPECT_NEAR(0.5 * step_rad, profile.Interpolate(2.5 * bin_width_rad)[0], 1e-12);
+}
@@ -0,0 +1,51 @@
+/**
+ * @file test_orbital_elements.cpp
+ * @brief Test codes for OrbitalElements class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "kepler_orbit.hpp"
+#include "orbital_elements.hpp"
+
+/**
+ * @brief Test for the RAAN calculated from the position and velocity in all quadrants
+ */
+TEST(OrbitalElements, RaanFromPositionVelocity) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double epoch_jday = 2460000.5;
+  const double inclination_rad = 51.6 * libra::deg_to_rad;
+  for (double raan_deg = 15.0; raan_deg < 360.0; raan_deg += 30.0) {
+    const double raan_rad = raan_deg * libra::deg_to_rad;
+    const OrbitalElements oe(epoch_jday, 6778.0e3, 0.001, inclination_rad, raan_rad, 40.0 * libra::deg_to_rad);
+    KeplerOrbit kepler_orbit(gravity_constant_m3_s2, oe);
+    const double time_jday = epoch_jday + 0.01;
+    kepler_orbit.CalcOrbit(time_jday);
+
+    const OrbitalElements result(gravity_constant_m3_s2, time_jday, kepler_orbit.GetPosition_i_m(), kepler_orbit.GetVelocity_i_m_s());
+    EXPECT_NEAR(raan_rad, result.GetRaan_rad(), 1e-9);
+    EXPECT_NEAR(inclination_rad, result.GetInclination_rad(), 1e-9);
+  }
+}
+
+/**
+ * @brief Test for the RAAN of a retrograde orbit whose ascending node is on the -X axis
+ */
+TEST(OrbitalElements, RaanRetrogradeOrbit) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double radius_m = 7000.0e3;
+  const double velocity_m_s = sqrt(gravity_constant_m3_s2 / radius_m);
+  const double inclination_rad = 120.0 * libra::deg_to_rad;
+
+  // At the ascending node on the -X axis, the velocity is in the Y-Z plane
+  libra::Vector<3> position_i_m(0.0);
+  position_i_m[0] = -radius_m;
+  libra::Vector<3> velocity_i_m_s(0.0);
+  velocity_i_m_s[1] = -velocity_m_s * cos(inclination_rad);
+  velocity_i_m_s[2] = velocity_m_s * sin(inclination_rad);
+
+  const OrbitalElements result(gravity_constant_m3_s2, 2460000.5, position_i_m, velocity_i_m_s);
+  EXPECT_NEAR(libra::pi, result.GetRaan_rad(), 1e-12);
+  EXPECT_NEAR(inclination_rad, result.GetInclination_rad(), 1e-12);
+}
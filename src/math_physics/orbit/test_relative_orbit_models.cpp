@@ -0,0 +1,68 @@
+/**
+ * @file test_relative_orbit_models.cpp
+ * @brief Test codes for the relative orbit models with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "../math/constants.hpp"
+#include "relative_orbit_models.hpp"
+
+/**
+ * @brief Test for the identity of the Yamanaka-Ankersen STM of the circular orbit with the HCW STM
+ */
+TEST(RelativeOrbitModels, YamanakaAnkersenCircularOrbit) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double orbit_radius_m = 6928.0e3;
+  for (double elapsed_time_s = 0.0; elapsed_time_s < 10000.0; elapsed_time_s += 777.0) {
+    const libra::Matrix<6, 6> hcw_stm = CalcHcwStm(orbit_radius_m, gravity_constant_m3_s2, elapsed_time_s);
+    const libra::Matrix<6, 6> ya_stm = CalcYamanakaAnkersenStm(orbit_radius_m, 0.0, gravity_constant_m3_s2, 1.0, elapsed_time_s);
+    for (size_t row = 0; row < 6; row++) {
+      for (size_t column = 0; column < 6; column++) {
+        EXPECT_NEAR(hcw_stm[row][column], ya_stm[row][column], 1e-6 * (1.0 + fabs(hcw_stm[row][column])));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the composition of the Yamanaka-Ankersen STM of the elliptic orbit
+ */
+TEST(RelativeOrbitModels, YamanakaAnkersenComposition) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double semi_latus_rectum_m = 12000.0e3 * (1.0 - 0.3 * 0.3);
+  const double eccentricity = 0.3;
+  const double initial_true_anomaly_rad = 0.7;
+  const double first_step_s = 1234.0;
+  const double second_step_s = 2345.0;
+
+  const double middle_true_anomaly_rad =
+      PropagateTrueAnomaly_rad(semi_latus_rectum_m, eccentricity, gravity_constant_m3_s2, initial_true_anomaly_rad, first_step_s);
+  const libra::Matrix<6, 6> first_stm =
+      CalcYamanakaAnkersenStm(semi_latus_rectum_m, eccentricity, gravity_constant_m3_s2, initial_true_anomaly_rad, first_step_s);
+  const libra::Matrix<6, 6> second_stm =
+      CalcYamanakaAnkersenStm(semi_latus_rectum_m, eccentricity, gravity_constant_m3_s2, middle_true_anomaly_rad, second_step_s);
+  const libra::Matrix<6, 6> total_stm =
+      CalcYamanakaAnkersenStm(semi_latus_rectum_m, eccentricity, gravity_constant_m3_s2, initial_true_anomaly_rad, first_step_s + second_step_s);
+  const libra::Matrix<6, 6> composed_stm = second_stm * first_stm;
+  for (size_t row = 0; row < 6; row++) {
+    for (size_t column = 0; column < 6; column++) {
+      EXPECT_NEAR(total_stm[row][column], composed_stm[row][column], 1e-8 * (1.0 + fabs(total_stm[row][column])));
+    }
+  }
+}
+
+/**
+ * @brief Test for the true anomaly propagation over revolutions
+ */
+TEST(RelativeOrbitModels, PropagateTrueAnomaly) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double semi_major_axis_m = 7000.0e3;
+  const double eccentricity = 0.1;
+  const double semi_latus_rectum_m = semi_major_axis_m * (1.0 - eccentricity * eccentricity);
+  const double period_s = libra::tau * sqrt(pow(semi_major_axis_m, 3) / gravity_constant_m3_s2);
+
+  EXPECT_NEAR(0.5, PropagateTrueAnomaly_rad(semi_latus_rectum_m, eccentricity, gravity_constant_m3_s2, 0.5, 0.0), 1e-12);
+  EXPECT_NEAR(0.5 + 2.0 * libra::tau,
+              PropagateTrueAnomaly_rad(semi_latus_rectum_m, eccentricity, gravity_constant_m3_s2, 0.5, 2.0 * period_s), 1e-9);
+  EXPECT_NEAR(libra::pi, PropagateTrueAnomaly_rad(semi_latus_rectum_m, eccentricity, gravity_constant_m3_s2, 0.0, 0.5 * period_s), 1e-9);
+}
@@ -0,0 +1,124 @@
+/**
+ * @file test_sgp4_catalogue.cpp
+ * @brief Test codes for Sgp4Catalogue class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "sgp4/sgp4io.h"
+#include "sgp4_catalogue.hpp"
+
+namespace {
+const char* kIssTle1 = "1 25544U 98067A   20076.51604214  .00016717  00000-0  10270-3 0  9005";
+const char* kIssTle2 = "2 25544  51.6412  86.9962 0006063  30.9353 329.2153 15.49228202 17647";
+const char* kHstTle1 = "1 20580U 90037B   20076.50669788  .00000993  00000-0  37929-4 0  9994";
+const char* kHstTle2 = "2 20580  28.4697 123.5498 0002839 135.4135 298.3145 15.09313444440529";
+}  // namespace
+
+/**
+ * @brief Test for the identity with the single object propagation
+ */
+TEST(Sgp4Catalogue, IdenticalToSingleObject) {
+  Sgp4Catalogue catalogue(2);
+  EXPECT_TRUE(catalogue.AddTle("ISS", kIssTle1, kIssTle2));
+  EXPECT_EQ(1, catalogue.GetNumberOfObjects());
+  EXPECT_EQ(25544, catalogue.GetSatelliteNumber(0));
+
+  // Same procedure with Sgp4OrbitPropagation
+  char tle1[80], tle2[80];
+  strcpy(tle1, kIssTle1);
+  strcpy(tle2, kIssTle2);
+  char type_run = 'c', type_input = 0;
+  double start_mfe, stop_mfe, delta_min;
+  elsetrec sgp4_data;
+  twoline2rv(tle1, tle2, type_run, type_input, wgs84, start_mfe, stop_mfe, delta_min, sgp4_data);
+
+  const double current_time_jd = 2458928.5;
+  double position_i_km[3], velocity_i_km_s[3];
+  sgp4(wgs84, sgp4_data, (current_time_jd - sgp4_data.jdsatepoch) * (24.0 * 60.0), position_i_km, velocity_i_km_s);
+
+  catalogue.Propagate(current_time_jd);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(position_i_km[i] * 1000.0, catalogue.GetPosition_i_m(0)[i]);
+    EXPECT_DOUBLE_EQ(velocity_i_km_s[i] * 1000.0, catalogue.GetVelocity_i_m_s(0)[i]);
+  }
+}
+
+/**
+ * @brief Test for the parallel propagation
+ */
+TEST(Sgp4Catalogue, ParallelPropagation) {
+  Sgp4Catalogue serial_catalogue, parallel_catalogue;
+  for (size_t i = 0; i < 101; i++) {
+    serial_catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+    serial_catalogue.AddTle("HST", kHstTle1, kHstTle2);
+    parallel_catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+    parallel_catalogue.AddTle("HST", kHstTle1, kHstTle2);
+  }
+
+  const double current_time_jd = 2458928.75;
+  serial_catalogue.Propagate(current_time_jd, 1);
+  parallel_catalogue.Propagate(current_time_jd, 4);
+  for (size_t index = 0; index < serial_catalogue.GetNumberOfObjects(); index++) {
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_DOUBLE_EQ(serial_catalogue.GetPosition_i_m(index)[i], parallel_catalogue.GetPosition_i_m(index)[i]);
+      EXPECT_DOUBLE_EQ(serial_catalogue.GetVelocity_i_m_s(index)[i], parallel_catalogue.GetVelocity_i_m_s(index)[i]);
+    }
+  }
+}
+
+/**
+ * @brief Test for the state calculation at an arbitrary time
+ */
+TEST(Sgp4Catalogue, CalcState) {
+  Sgp4Catalogue catalogue;
+  catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+
+  const double current_time_jd = 2458928.5;
+  catalogue.Propagate(current_time_jd);
+  libra::Vector<3> position_i_m, velocity_i_m_s;
+  EXPECT_TRUE(catalogue.CalcState(0, current_time_jd, position_i_m, velocity_i_m_s));
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(catalogue.GetPosition_i_m(0)[i], position_i_m[i]);
+    EXPECT_DOUBLE_EQ(catalogue.GetVelocity_i_m_s(0)[i], velocity_i_m_s[i]);
+  }
+
+  // The stored state is not changed
+  catalogue.CalcState(0, current_time_jd + 0.1, position_i_m, velocity_i_m_s);
+  EXPECT_NE(catalogue.GetPosition_i_m(0)[0], position_i_m[0]);
+  catalogue.Propagate(current_time_jd + 0.1);
+  EXPECT_DOUBLE_EQ(catalogue.GetPosition_i_m(0)[0], position_i_m[0]);
+}
+
+/**
+ * @brief Test for the TLE file reading and the distance query
+ */
+TEST(Sgp4Catalogue, ReadFileAndQuery) {
+  const std::string file_path = "test_sgp4_catalogue.tle";
+  {
+    std::ofstream file(file_path);
+    file << "ISS (ZARYA)\n" << kIssTle1 << "\n" << kIssTle2 << "\n";
+    file << kHstTle1 << "\r\n" << kHstTle2 << "\r\n";
+  }
+  Sgp4Catalogue catalogue;
+  EXPECT_EQ(2, catalogue.ReadTleFile(file_path));
+  std::remove(file_path.c_str());
+
+  EXPECT_EQ("ISS (ZARYA)", catalogue.GetName(0));
+  EXPECT_EQ("20580", catalogue.GetName(1));
+  EXPECT_EQ(1, catalogue.FindIndex(20580));
+  EXPECT_EQ(-1, catalogue.FindIndex(12345));
+
+  catalogue.Propagate(2458928.5);
+  const libra::Vector<3> iss_position_i_m = catalogue.GetPosition_i_m(0);
+  std::vector<size_t> indices = catalogue.FindObjectsWithinDistance(iss_position_i_m, 1.0);
+  ASSERT_EQ(1, indices.size());
+  EXPECT_EQ(0, indices[0]);
+
+  const double distance_m = catalogue.GetRelativePosition_i_m(1, iss_position_i_m).CalcNorm();
+  EXPECT_EQ(1, catalogue.FindObjectsWithinDistance(iss_position_i_m, distance_m * 0.99).size());
+  EXPECT_EQ(2, catalogue.FindObjectsWithinDistance(iss_position_i_m, distance_m * 1.01).size());
+}
@@ -0,0 +1,149 @@
+/**
+ * @file earth_orientation_parameters.cpp
+ * @brief Class to read the Earth orientation parameters (EOP) of IERS and provide the interpolated values
+ */
+
+#include "earth_orientation_parameters.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <utilities/shared_data_registry.hpp>
+
+#include "../math/constants.hpp"
+
+namespace {
+/**
+ * @fn ReadField
+ * @brief Read the floating point value in the fixed columns of the line
+ * @param [in] line: Line of the file
+ * @param [in] position: First position of the field (zero origin)
+ * @param [in] length: Length of the field
+ * @param [out] value: Read value
+ * @return true: the field has a value, false: the field is blank
+ */
+bool ReadField(const std::string& line, const size_t position, const size_t length, double& value) {
+  if (line.size() < position + length) return false;
+  const std::string field = line.substr(position, length);
+  if (field.find_first_not_of(' ') == std::string::npos) return false;
+  value = std::strtod(field.c_str(), nullptr);
+  return true;
+}
+
+/**
+ * @fn InterpolateUt1MinusUtc
+ * @brief Interpolate UT1 - UTC between the days
+ * @note The second value is shifted by one second when a leap second is inserted between the days, since UT1 - UTC is continuous until the
+ *       leap second at the end of the first day.
+ * @param [in] first_s: UT1 - UTC of the first day [sec]
+ * @param [in] second_s: UT1 - UTC of the second day [sec]
+ * @param [in] ratio: Ratio of the interpolation point between the days [0, 1)
+ */
+double InterpolateUt1MinusUtc(const double first_s, double second_s, const double ratio) {
+  if (second_s - first_s > 0.5) {
+    second_s -= 1.0;
+  } else if (second_s - first_s < -0.5) {
+    second_s += 1.0;
+  }
+  return first_s + (second_s - first_s) * ratio;
+}
+}  // namespace
+
+EarthOrientationParameters::EarthOrientationParameters(const std::string file_name) { ReadFile(file_name); }
+
+bool EarthOrientationParameters::ReadFile(const std::string file_name) {
+  std::ifstream eop_file(file_name);
+  if (!eop_file.is_open()) {
+    std::cout << "[WARNINGS] EOP file not found: " << file_name << std::endl;
+    return false;
+  }
+
+  // Read the days which have all parameters
+  // Column positions of finals2000A (zero origin): MJD 7-14, PM-x 18-26, PM-y 37-45, UT1-UTC 58-67
+  std::map<long, EarthOrientationParameterValues> days;
+  std::string line;
+  while (std::getline(eop_file, line)) {
+    double mjd, x_arcsec, y_arcsec, ut1_minus_utc_s;
+    if (!ReadField(line, 7, 8, mjd)) continue;
+    if (!ReadField(line, 18, 9, x_arcsec) || !ReadField(line, 37, 9, y_arcsec)) continue;
+    if (!ReadField(line, 58, 10, ut1_minus_utc_s)) continue;
+
+    EarthOrientationParameterValues values;
+    values.ut1_minus_utc_s_ = ut1_minus_utc_s;
+    values.polar_motion_x_rad_ = x_arcsec * libra::arcsec_to_rad;
+    values.polar_motion_y_rad_ = y_arcsec * libra::arcsec_to_rad;
+    days[lround(mjd)] = values;
+  }
+  if (days.empty()) {
+    std::cout << "[WARNINGS] EOP file has no data: " << file_name << std::endl;
+    return false;
+  }
+
+  // Make the uniform daily table and fill the missing days
+  const long start_mjd = days.begin()->first;
+  const size_t number_of_days = (size_t)(days.rbegin()->first - start_mjd + 1);
+  start_modified_julian_date_ = (double)start_mjd;
+  ut1_minus_utc_s_.assign(number_of_days, 0.0);
+  polar_motion_x_rad_.assign(number_of_days, 0.0);
+  polar_motion_y_rad_.assign(number_of_days, 0.0);
+
+  auto previous = days.begin();
+  for (auto current = days.begin(); current != days.end(); ++current) {
+    const long gap_days = current->first - previous->first;
+    for (long day = previous->first + 1; day <= current->first; day++) {
+      const size_t index = (size_t)(day - start_mjd);
+      const double ratio = (double)(day - previous->first) / (double)gap_days;
+      ut1_minus_utc_s_[index] = InterpolateUt1MinusUtc(previous->second.ut1_minus_utc_s_, current->second.ut1_minus_utc_s_, ratio);
+      polar_motion_x_rad_[index] = previous->second.polar_motion_x_rad_ +
+                                   (current->second.polar_motion_x_rad_ - previous->second.polar_motion_x_rad_) * ratio;
+      polar_motion_y_rad_[index] = previous->second.polar_motion_y_rad_ +
+                                   (current->second.polar_motion_y_rad_ - previous->second.polar_motion_y_rad_) * ratio;
+    }
+    // The listed day is set with the value in the file (the leap second shift above is not applied)
+    const size_t index = (size_t)(current->first - start_mjd);
+    ut1_minus_utc_s_[index] = current->second.ut1_minus_utc_s_;
+    polar_motion_x_rad_[index] = current->second.polar_motion_x_rad_;
+    polar_motion_y_rad_[index] = current->second.polar_motion_y_rad_;
+    previous = current;
+  }
+
+  return true;
+}
+
+EarthOrientationParameterValues EarthOrientationParameters::CalcValues(const double modified_julian_date_utc) const {
+  EarthOrientationParameterValues values;
+  if (!IsValid()) return values;
+
+  const double elapsed_days = modified_julian_date_utc - start_modified_julian_date_;
+  const size_t last_index = GetNumberOfDays() - 1;
+  if (elapsed_days <= 0.0 || last_index == 0) {
+    values.ut1_minus_utc_s_ = ut1_minus_utc_s_[0];
+    values.polar_motion_x_rad_ = polar_motion_x_rad_[0];
+    values.polar_motion_y_rad_ = polar_motion_y_rad_[0];
+    return values;
+  }
+  if (elapsed_days >= (double)last_index) {
+    values.ut1_minus_utc_s_ = ut1_minus_utc_s_[last_index];
+    values.polar_motion_x_rad_ = polar_motion_x_rad_[last_index];
+    values.polar_motion_y_rad_ = polar_motion_y_rad_[last_index];
+    return values;
+  }
+
+  const size_t index = (size_t)floor(elapsed_days);
+  const double ratio = elapsed_days - (double)index;
+  values.ut1_minus_utc_s_ = InterpolateUt1MinusUtc(ut1_minus_utc_s_[index], ut1_minus_utc_s_[index + 1], ratio);
+  values.polar_motion_x_rad_ = polar_motion_x_rad_[index] + (polar_motion_x_rad_[index + 1] - polar_motion_x_rad_[index]) * ratio;
+  values.polar_motion_y_rad_ = polar_motion_y_rad_[index] + (polar_motion_y_rad_[index + 1] - polar_motion_y_rad_[index]) * ratio;
+  return values;
+}
+
+std::shared_ptr<const EarthOrientationParameters> GetSharedEarthOrientationParameters(const std::string file_name) {
+  auto load = [&file_name]() -> std::shared_ptr<const EarthOrientationParameters> {
+    auto new_table = std::make_shared<const EarthOrientationParameters>(file_name);
+    if (!new_table->IsValid()) return nullptr;
+    return new_table;
+  };
+  return SharedDataRegistry<EarthOrientationParameters>::Get(file_name, load);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file earth_orientation_parameters.hpp
+ * @brief Class to read the Earth orientation parameters (EOP) of IERS and provide the interpolated values
+ * @note Support format: IERS finals2000A (finals2000A.all, finals2000A.data, finals2000A.daily)
+ *       Ref: https://maia.usno.navy.mil/ser7/readme.finals2000A
+ */
+
+#ifndef S2E_LIBRARY_PLANET_ROTATION_EARTH_ORIENTATION_PARAMETERS_HPP_
+#define S2E_LIBRARY_PLANET_ROTATION_EARTH_ORIENTATION_PARAMETERS_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct EarthOrientationParameterValues
+ * @brief Earth orientation parameters at an epoch
+ */
+struct EarthOrientationParameterValues {
+  double ut1_minus_utc_s_ = 0.0;     //!< UT1 - UTC [sec]
+  double polar_motion_x_rad_ = 0.0;  //!< X component of the polar motion [rad]
+  double polar_motion_y_rad_ = 0.0;  //!< Y component of the polar motion [rad]
+};
+
+/**
+ * @class EarthOrientationParameters
+ * @brief Class to read the Earth orientation parameters (EOP) of IERS and provide the interpolated values
+ * @details The file is parsed once into the table with the uniform daily interval, so the lookup is an index calculation and a linear
+ *          interpolation. The missing days in the file are filled with the linear interpolation. The values out of the table range are
+ *          clamped to the first or the last value of the table.
+ */
+class EarthOrientationParameters {
+ public:
+  /**
+   * @fn EarthOrientationParameters
+   * @brief Constructor
+   * @param [in] file_name: File name of the IERS finals2000A file with the directory path
+   */
+  EarthOrientationParameters(const std::string file_name);
+
+  /**
+   * @fn CalcValues
+   * @brief Calculate the Earth orientation parameters at the epoch with the linear interpolation
+   * @note The leap second between the days is considered in the interpolation of UT1 - UTC
+   * @param [in] modified_julian_date_utc: Modified Julian date in UTC [day]
+   * @return Earth orientation parameters
+   */
+  EarthOrientationParameterValues CalcValues(const double modified_julian_date_utc) const;
+
+  // Getters
+  /**
+   * @fn IsValid
+   * @brief Return true when the table has at least one day
+   */
+  inline bool IsValid() const { return !ut1_minus_utc_s_.empty(); }
+  /**
+   * @fn GetNumberOfDays
+   * @brief Return number of days in the table
+   */
+  inline size_t GetNumberOfDays() const { return ut1_minus_utc_s_.size(); }
+  /**
+   * @fn GetStartModifiedJulianDate
+   * @brief Return the first modified Julian date of the table [day]
+   */
+  inline double GetStartModifiedJulianDate() const { return start_modified_julian_date_; }
+  /**
+   * @fn GetEndModifiedJulianDate
+   * @brief Return the last modified Julian date of the table [day]
+   */
+  inline double GetEndModifiedJulianDate() const { return start_modified_julian_date_ + (double)GetNumberOfDays() - 1.0; }
+
+ private:
+  double start_modified_julian_date_ = 0.0;  //!< First modified Julian date of the table [day]
+  std::vector<double> ut1_minus_utc_s_;      //!< UT1 - UTC of each day [sec]
+  std::vector<double> polar_motion_x_rad_;   //!< X component of the polar motion of each day [rad]
+  std::vector<double> polar_motion_y_rad_;   //!< Y component of the polar motion of each day [rad]
+
+  /**
+   * @fn ReadFile
+   * @brief Read the IERS finals2000A file and make the daily table
+   * @param [in] file_name: File name of the IERS finals2000A file with the directory path
+   * @return true: success, false: failure
+   */
+  bool ReadFile(const std::string file_name);
+};
+
+/**
+ * @fn GetSharedEarthOrientationParameters
+ * @brief Return the Earth orientation parameters of the file shared in the process
+ * @note The file is read only at the first call for the file, and the table is kept by SharedDataRegistry until the end of the process
+ *       to avoid reloading it in the sequential Monte-Carlo simulation cases.
+ * @param [in] file_name: File name of the IERS finals2000A file with the directory path
+ * @return Shared table. nullptr when the file cannot be read.
+ */
+std::shared_ptr<const EarthOrientationParameters> GetSharedEarthOrientationParameters(const std::string file_name);
+
+#endif  // S2E_LIBRARY_PLANET_ROTATION_EARTH_ORIENTATION_PARAMETERS_HPP_
@@ -0,0 +1,97 @@
+/**
+ * @file test_earth_orientation_parameters.cpp
+ * @brief Test codes for EarthOrientationParameters class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "../math/constants.hpp"
+#include "earth_orientation_parameters.hpp"
+
+/**
+ * @brief Test Constructor
+ */
+TEST(EarthOrientationParameters, Constructor) {
+  std::string test_file_name = "/src/math_physics/planet_rotation/example_finals2000A.txt";
+  EarthOrientationParameters eop(CORE_DIR_FROM_EXE + test_file_name);
+
+  // The last line without values is not included
+  EXPECT_TRUE(eop.IsValid());
+  EXPECT_EQ(8, eop.GetNumberOfDays());
+  EXPECT_DOUBLE_EQ(57750.0, eop.GetStartModifiedJulianDate());
+  EXPECT_DOUBLE_EQ(57757.0, eop.GetEndModifiedJulianDate());
+
+  EarthOrientationParameterValues values = eop.CalcValues(57750.0);
+  EXPECT_NEAR(-0.405, values.ut1_minus_utc_s_, 1e-12);
+  EXPECT_NEAR(0.050 * libra::arcsec_to_rad, values.polar_motion_x_rad_, 1e-15);
+  EXPECT_NEAR(0.280 * libra::arcsec_to_rad, values.polar_motion_y_rad_, 1e-15);
+}
+
+/**
+ * @brief Test file not found
+ */
+TEST(EarthOrientationParameters, FileNotFound) {
+  EarthOrientationParameters eop("not_found.txt");
+  EXPECT_FALSE(eop.IsValid());
+
+  EarthOrientationParameterValues values = eop.CalcValues(57750.0);
+  EXPECT_DOUBLE_EQ(0.0, values.ut1_minus_utc_s_);
+  EXPECT_DOUBLE_EQ(0.0, values.polar_motion_x_rad_);
+  EXPECT_DOUBLE_EQ(0.0, values.polar_motion_y_rad_);
+}
+
+/**
+ * @brief Test interpolation
+ */
+TEST(EarthOrientationParameters, Interpolation) {
+  std::string test_file_name = "/src/math_physics/planet_rotation/example_finals2000A.txt";
+  EarthOrientationParameters eop(CORE_DIR_FROM_EXE + test_file_name);
+
+  EarthOrientationParameterValues values = eop.CalcValues(57751.25);
+  EXPECT_NEAR(-0.40625, values.ut1_minus_utc_s_, 1e-12);
+  EXPECT_NEAR(0.05125 * libra::arcsec_to_rad, values.polar_motion_x_rad_, 1e-15);
+  EXPECT_NEAR(0.27875 * libra::arcsec_to_rad, values.polar_motion_y_rad_, 1e-15);
+
+  // The missing day is filled with the linear interpolation
+  values = eop.CalcValues(57756.0);
+  EXPECT_NEAR(0.589, values.ut1_minus_utc_s_, 1e-12);
+  EXPECT_NEAR(0.056 * libra::arcsec_to_rad, values.polar_motion_x_rad_, 1e-15);
+  EXPECT_NEAR(0.274 * libra::arcsec_to_rad, values.polar_motion_y_rad_, 1e-15);
+}
+
+/**
+ * @brief Test leap second
+ */
+TEST(EarthOrientationParameters, LeapSecond) {
+  std::string test_file_name = "/src/math_physics/planet_rotation/example_finals2000A.txt";
+  EarthOrientationParameters eop(CORE_DIR_FROM_EXE + test_file_name);
+
+  // UT1 - UTC is continuous until the end of the day before the leap second
+  EXPECT_NEAR(-0.4085, eop.CalcValues(57753.5).ut1_minus_utc_s_, 1e-12);
+  EXPECT_NEAR(-0.409, eop.CalcValues(57753.0 + 1.0 - 1e-9).ut1_minus_utc_s_, 1e-9);
+  EXPECT_NEAR(0.591, eop.CalcValues(57754.0).ut1_minus_utc_s_, 1e-12);
+}
+
+/**
+ * @brief Test out of range
+ */
+TEST(EarthOrientationParameters, OutOfRange) {
+  std::string test_file_name = "/src/math_physics/planet_rotation/example_finals2000A.txt";
+  EarthOrientationParameters eop(CORE_DIR_FROM_EXE + test_file_name);
+
+  EXPECT_NEAR(-0.405, eop.CalcValues(57000.0).ut1_minus_utc_s_, 1e-12);
+  EXPECT_NEAR(0.588, eop.CalcValues(58000.0).ut1_minus_utc_s_, 1e-12);
+  EXPECT_NEAR(0.273 * libra::arcsec_to_rad, eop.CalcValues(58000.0).polar_motion_y_rad_, 1e-15);
+}
+
+/**
+ * @brief Test shared table
+ */
+TEST(EarthOrientationParameters, SharedTable) {
+  std::string test_file_name = CORE_DIR_FROM_EXE + std::string("/src/math_physics/planet_rotation/example_finals2000A.txt");
+  std::shared_ptr<const EarthOrientationParameters> eop_1 = GetSharedEarthOrientationParameters(test_file_name);
+  std::shared_ptr<const EarthOrientationParameters> eop_2 = GetSharedEarthOrientationParameters(test_file_name);
+
+  ASSERT_NE(nullptr, eop_1);
+  EXPECT_EQ(eop_1.get(), eop_2.get());
+  EXPECT_EQ(nullptr, GetSharedEarthOrientationParameters("not_found.txt"));
+}
@@ -0,0 +1,49 @@
+/**
+ * @file benchmark_normal_randomization.cpp
+ * @brief Benchmark codes for the normal random number generation with the different backends
+ */
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "normal_randomization.hpp"
+
+/**
+ * @fn MeasureNanosecondsPerValue
+ * @brief Measure the generation time of the normal random values
+ * @param [in] backend: Backend of the generator
+ * @param [in] use_fill: Use Fill function when true, otherwise use the cast operator
+ */
+double MeasureNanosecondsPerValue(const libra::NormalRandomizationBackend backend, const bool use_fill) {
+  const size_t number_of_values = 1000;
+  const size_t number_of_repeats = 10000;
+  libra::NormalRand::SetDefaultBackend(backend);
+  libra::NormalRand normal_rand(0.0, 1.0, 12345);
+  libra::NormalRand::SetDefaultBackend(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle);
+  std::vector<double> values(number_of_values);
+  double sum = 0.0;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (size_t repeat = 0; repeat < number_of_repeats; repeat++) {
+    if (use_fill) {
+      normal_rand.Fill(values.data(), number_of_values);
+    } else {
+      for (size_t i = 0; i < number_of_values; i++) values[i] = normal_rand;
+    }
+    // The outputs are used to avoid the optimization of the loop
+    sum += values[repeat % number_of_values];
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  if (sum == 1.0e300) std::cout << sum << std::endl;
+  const double elapsed_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  return elapsed_ns / (double)(number_of_values * number_of_repeats);
+}
+
+int main() {
+  std::cout << "backend, cast [ns/value], Fill [ns/value]" << std::endl;
+  std::cout << "MINIMAL_STANDARD_LCG, " << MeasureNanosecondsPerValue(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle, false)
+            << ", " << MeasureNanosecondsPerValue(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle, true) << std::endl;
+  std::cout << "PHILOX, " << MeasureNanosecondsPerValue(libra::NormalRandomizationBackend::kPhilox, false) << ", "
+            << MeasureNanosecondsPerValue(libra::NormalRandomizationBackend::kPhilox, true) << std::endl;
+  return 0;
+}
@@ -5,20 +5,87 @@
 
 #include "global_randomization.hpp"
 
-GlobalRandomization global_randomization;
+#include "philox_random_generator.hpp"
+
+thread_local GlobalRandomization global_randomization;
+
+GlobalRandomization::StreamScope::StreamScope(const std::string& name) { global_randomization.PushStreamName(name); }
+
+GlobalRandomization::StreamScope::~StreamScope() { global_randomization.PopStreamName(); }
 
 GlobalRandomization::GlobalRandomization() { seed_ = 0xdeadbeef; }
 
 void GlobalRandomization::SetSeed(const long seed) {
   base_randomizer_.Initialize(seed);
-  // double dl = base_randomizer_;
+  seed_ = seed;
+  stream_counts_.clear();
 }
 
 long GlobalRandomization::MakeSeed() {
+  if (!stream_keys_.empty()) {
+    // Counter-based derivation from (seed, stream, number of seeds made in the stream)
+    const uint64_t stream_key = stream_keys_.back();
+    const uint64_t count = stream_counts_[stream_key]++;
+    const uint32_t counter[4] = {(uint32_t)count, (uint32_t)(count >> 32), (uint32_t)stream_key, (uint32_t)(stream_key >> 32)};
+    const uint64_t seed = (uint64_t)seed_;
+    const uint32_t key[2] = {(uint32_t)seed, (uint32_t)(seed >> 32)};
+    uint32_t output[4];
+    libra::Philox4x32::CalcBlock(counter, key, output);
+    // The seed of the minimal standard LCG must be in [1, 2^31 - 2]
+    return (long)(output[0] % 0x7ffffffe) + 1;
+  }
+
   double rand = base_randomizer_;
   long seed = (long)((rand - 0.5) * kMaxSeed);
   if (seed == 0) {
     seed = 0xdeadbeef;
   }
   return seed;
-}
\ No newline at end of file
+}
+
+void GlobalRandomization::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("GLOBAL_RANDOMIZATION");
+  snapshot.Write(base_randomizer_);
+  snapshot.Write(seed_);
+  snapshot.Write((uint64_t)stream_counts_.size());
+  for (const auto& stream_count : stream_counts_) {
+    snapshot.Write(stream_count.first);
+    snapshot.Write(stream_count.second);
+  }
+}
+
+void GlobalRandomization::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("GLOBAL_RANDOMIZATION");
+  snapshot.Read(base_randomizer_);
+  snapshot.Read(seed_);
+  stream_counts_.clear();
+  const size_t number_of_streams = snapshot.ReadSize();
+  for (size_t i = 0; i < number_of_streams; i++) {
+    uint64_t stream_key = 0, count = 0;
+    snapshot.Read(stream_key);
+    snapshot.Read(count);
+    stream_counts_[stream_key] = count;
+  }
+}
+
+void GlobalRandomization::PushStreamName(const std::string& name) {
+  const uint64_t parent_key = stream_keys_.empty() ? 0 : stream_keys_.back();
+  stream_keys_.push_back(CalcStreamKey(parent_key, name));
+}
+
+void GlobalRandomization::PopStreamName() {
+  if (!stream_keys_.empty()) stream_keys_.pop_back();
+}
+
+uint64_t GlobalRandomization::CalcStreamKey(const uint64_t parent_key, const std::string& name) {
+  const uint64_t kFnvPrime = 0x100000001b3;
+  uint64_t key = 0xcbf29ce484222325 ^ parent_key;
+  for (const char c : name) {
+    key ^= (uint64_t)(unsigned char)c;
+    key *= kFnvPrime;
+  }
+  // Terminate the name to separate it from the names of the child scopes
+  key ^= (uint64_t)'/';
+  key *= kFnvPrime;
+  return key;
+}
@@ -6,15 +6,47 @@
 #ifndef S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
 #define S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
 
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utilities/snapshot.hpp>
+#include <vector>
+
 #include "./minimal_standard_linear_congruential_generator.hpp"
 
 /**
  * @class global_randomization.hpp
  * @brief Class to manage global randomization
  * @note Used to make randomized seed for other randomization
+ * @note Each thread has its own instance, and MonteCarloSimulationExecutor reseeds it at the beginning of each simulation case
+ * @note Inside a StreamScope, the seeds are derived from the seed of the case and the names of the scopes (e.g. spacecraft and component),
+ *       so they do not depend on the construction order of the other objects.
  */
 class GlobalRandomization {
  public:
+  /**
+   * @class StreamScope
+   * @brief RAII helper to name the randomization stream of the objects constructed in the scope
+   * @note The scopes can be nested, and the stream is identified by the names of all scopes (e.g. "SPACECRAFT_0" / "GYRO_SENSOR_1").
+   */
+  class StreamScope {
+   public:
+    /**
+     * @fn StreamScope
+     * @brief Constructor to enter the named scope of global_randomization in this thread
+     * @param [in] name: Name of the scope
+     */
+    explicit StreamScope(const std::string& name);
+    /**
+     * @fn ~StreamScope
+     * @brief Destructor to leave the scope
+     */
+    ~StreamScope();
+
+    StreamScope(const StreamScope&) = delete;
+    StreamScope& operator=(const StreamScope&) = delete;
+  };
+
   /**
    * @fn GlobalRandomization
    * @brief Constructor
@@ -23,20 +55,58 @@ class GlobalRandomization {
   /**
    * @fn SetSeed
    * @brief Set randomized seed value
+   * @note The counters of the named streams are also reset.
    */
   void SetSeed(const long seed);
   /**
    * @fn MakeSeed
-   * @brief Set randomized seed value
+   * @brief Make randomized seed value
+   * @note Outside of any StreamScope, the seeds are generated sequentially as the former versions.
    */
   long MakeSeed();
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the state of the randomization to the snapshot
+   * @note The names of the current scopes are not saved. Save the snapshot outside of any StreamScope.
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the state of the randomization from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
+  /**
+   * @fn PushStreamName
+   * @brief Enter the named scope. Use StreamScope instead of calling this directly.
+   * @param [in] name: Name of the scope
+   */
+  void PushStreamName(const std::string& name);
+  /**
+   * @fn PopStreamName
+   * @brief Leave the current scope
+   */
+  void PopStreamName();
+
  private:
   static const unsigned int kMaxSeed = 0xffffffff;  //!< Maximum value of seed
   libra::MinimalStandardLcg base_randomizer_;       //!< Base of global randomization
   long seed_;                                       //!< Seed of global randomization
+  std::vector<uint64_t> stream_keys_;               //!< Hash of the names of the nested scopes. The last one is the current stream.
+  std::map<uint64_t, uint64_t> stream_counts_;      //!< Number of seeds made in each stream
+
+  /**
+   * @fn CalcStreamKey
+   * @brief Calculate the hash of the name of the scope in the parent stream with 64 bit FNV-1a
+   * @param [in] parent_key: Key of the parent stream
+   * @param [in] name: Name of the scope
+   */
+  static uint64_t CalcStreamKey(const uint64_t parent_key, const std::string& name);
 };
 
-extern GlobalRandomization global_randomization;  //!< Global randomization
+extern thread_local GlobalRandomization global_randomization;  //!< Global randomization
 
 #endif  // S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
@@ -0,0 +1,169 @@
+/**
+ * @file low_discrepancy_sequence.cpp
+ * @brief Quasi-random sampling (Sobol sequence and Latin hypercube) keyed by the sample index
+ * @note Ref: S. Joe and F. Y. Kuo, "Constructing Sobol sequences with better two-dimensional projections", SIAM J. Sci. Comput. 30, 2008.
+ *       P. Acklam, "An algorithm for computing the inverse normal cumulative distribution function", 2003.
+ */
+
+#include "low_discrepancy_sequence.hpp"
+
+#include <cmath>
+
+#include "../math/constants.hpp"
+
+using libra::LatinHypercube;
+using libra::SobolSequence;
+
+namespace {
+/**
+ * @struct PrimitivePolynomial
+ * @brief Primitive polynomial and initial direction numbers of a dimension of the Sobol sequence
+ */
+struct PrimitivePolynomial {
+  uint32_t degree_;              //!< Degree of the polynomial s
+  uint32_t coefficients_;        //!< Coefficients a of the polynomial
+  uint32_t initial_numbers_[7];  //!< Initial direction numbers m_1, ..., m_s
+};
+
+// new-joe-kuo-6.21201 for the dimensions 2 to 21 (the first dimension is the van der Corput sequence)
+const PrimitivePolynomial kPrimitivePolynomials[SobolSequence::kMaxDimension - 1] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+};
+
+/**
+ * @struct DirectionNumbers
+ * @brief Direction numbers of all dimensions of the Sobol sequence
+ */
+struct DirectionNumbers {
+  uint32_t values_[SobolSequence::kMaxDimension][SobolSequence::kNumberOfBits];  //!< Direction numbers [dimension][bit]
+
+  DirectionNumbers() {
+    const size_t number_of_bits = SobolSequence::kNumberOfBits;
+    for (size_t bit = 0; bit < number_of_bits; bit++) {
+      values_[0][bit] = 1u << (number_of_bits - 1 - bit);
+    }
+    for (size_t dimension = 1; dimension < SobolSequence::kMaxDimension; dimension++) {
+      const PrimitivePolynomial& polynomial = kPrimitivePolynomials[dimension - 1];
+      const size_t degree = polynomial.degree_;
+      uint32_t* v = values_[dimension];
+      for (size_t bit = 0; bit < degree && bit < number_of_bits; bit++) {
+        v[bit] = polynomial.initial_numbers_[bit] << (number_of_bits - 1 - bit);
+      }
+      for (size_t bit = degree; bit < number_of_bits; bit++) {
+        v[bit] = v[bit - degree] ^ (v[bit - degree] >> degree);
+        for (size_t k = 1; k < degree; k++) {
+          v[bit] ^= ((polynomial.coefficients_ >> (degree - 1 - k)) & 1u) * v[bit - k];
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @fn MixBits
+ * @brief SplitMix64 finalizer to make the keys from the seed
+ */
+uint64_t MixBits(uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+  return value ^ (value >> 31);
+}
+}  // namespace
+
+SobolSequence::SobolSequence(const uint64_t scramble_seed) {
+  for (size_t dimension = 0; dimension < kMaxDimension; dimension++) {
+    digital_shifts_[dimension] = (uint32_t)(MixBits(scramble_seed + (dimension + 1) * 0x9e3779b97f4a7c15ULL) >> 32);
+  }
+}
+
+double SobolSequence::CalcPoint(const uint64_t sample_index, const size_t dimension) const {
+  static const DirectionNumbers direction_numbers;
+  const uint32_t* v = direction_numbers.values_[dimension];
+  uint32_t point = digital_shifts_[dimension];
+  uint64_t index = sample_index;
+  for (size_t bit = 0; index != 0 && bit < kNumberOfBits; bit++, index >>= 1) {
+    if (index & 1) point ^= v[bit];
+  }
+  return ((double)point + 0.5) * (1.0 / 4294967296.0);
+}
+
+LatinHypercube::LatinHypercube(const uint64_t number_of_samples, const uint64_t seed) : number_of_samples_(number_of_samples), seed_(seed) {
+  if (number_of_samples_ == 0) number_of_samples_ = 1;
+  number_of_bits_ = 0;
+  while (number_of_bits_ < 64 && (1ULL << number_of_bits_) < number_of_samples_) number_of_bits_++;
+  mask_ = number_of_bits_ >= 64 ? ~0ULL : (1ULL << number_of_bits_) - 1;
+}
+
+uint64_t LatinHypercube::CalcStratum(const uint64_t sample_index, const size_t dimension) const {
+  // Cycle walking: the domain is less than twice of the number of samples, so a few permutations are enough in average
+  uint64_t stratum = sample_index % number_of_samples_;
+  do {
+    stratum = Permute(stratum, dimension);
+  } while (stratum >= number_of_samples_);
+  return stratum;
+}
+
+uint64_t LatinHypercube::Permute(uint64_t value, const size_t dimension) const {
+  // Each operation is a bijection on the number_of_bits_ bit integers
+  const size_t shift = number_of_bits_ / 2 + 1;
+  for (size_t round = 0; round < kNumberOfRounds; round++) {
+    const uint64_t key = MixBits(seed_ + ((uint64_t)dimension * kNumberOfRounds + round + 1) * 0x9e3779b97f4a7c15ULL);
+    value = (value * (key | 1ULL)) & mask_;
+    value ^= value >> shift;
+    value = (value + (key >> 32)) & mask_;
+  }
+  return value;
+}
+
+double libra::CalcInverseStandardNormalCdf(const double probability) {
+  static const double a[6] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                              1.383577518672690e+02,  -3.066479806614716e+01, 2.506628277459239e+00};
+  static const double b[5] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02, 6.680131188771972e+01,
+                              -1.328068155288572e+01};
+  static const double c[6] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                              -2.549732539343734e+00, 4.374664141464968e+00,  2.938163982698783e+00};
+  static const double d[4] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00};
+  static const double kLowerRegion = 0.02425;
+
+  if (probability <= 0.0) return -HUGE_VAL;
+  if (probability >= 1.0) return HUGE_VAL;
+
+  // Rational approximation of Acklam (relative error 1.15e-9)
+  double x;
+  if (probability < kLowerRegion) {
+    const double q = std::sqrt(-2.0 * std::log(probability));
+    x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  } else if (probability <= 1.0 - kLowerRegion) {
+    const double q = probability - 0.5;
+    const double r = q * q;
+    x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+        (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+  } else {
+    const double q = std::sqrt(-2.0 * std::log(1.0 - probability));
+    x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  }
+
+  // One step of Halley's method to the full double precision
+  const double error = 0.5 * std::erfc(-x / std::sqrt(2.0)) - probability;
+  const double u = error * std::sqrt(libra::tau) * std::exp(0.5 * x * x);
+  return x - u / (1.0 + 0.5 * x * u);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file low_discrepancy_sequence.hpp
+ * @brief Quasi-random sampling (Sobol sequence and Latin hypercube) keyed by the sample index
+ * @note Ref: S. Joe and F. Y. Kuo, "Constructing Sobol sequences with better two-dimensional projections", SIAM J. Sci. Comput. 30, 2008.
+ *       P. Acklam, "An algorithm for computing the inverse normal cumulative distribution function", 2003.
+ */
+
+#ifndef S2E_LIBRARY_RANDOMIZATION_LOW_DISCREPANCY_SEQUENCE_HPP_
+#define S2E_LIBRARY_RANDOMIZATION_LOW_DISCREPANCY_SEQUENCE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libra {
+
+/**
+ * @class SobolSequence
+ * @brief Sobol sequence with the direction numbers of Joe and Kuo and the random digital shift
+ * @details Each point is calculated directly from the sample index, so any subset of the points (e.g., a shard of a Monte-Carlo campaign)
+ *          is generated without the other points. The digital shift (XOR of a random integer for each dimension) keeps the stratification of
+ *          the sequence and moves the first point from the origin.
+ */
+class SobolSequence {
+ public:
+  static const size_t kMaxDimension = 21;  //!< Number of supported dimensions
+  static const size_t kNumberOfBits = 32;  //!< Number of bits of the points. The sample index should be less than 2^32.
+
+  /**
+   * @fn SobolSequence
+   * @brief Constructor
+   * @param [in] scramble_seed: Seed of the random digital shift
+   */
+  explicit SobolSequence(const uint64_t scramble_seed = 0);
+
+  /**
+   * @fn CalcPoint
+   * @brief Calculate a coordinate of the point
+   * @param [in] sample_index: Index of the point
+   * @param [in] dimension: Index of the coordinate (0 <= dimension < kMaxDimension)
+   * @return Coordinate in (0, 1)
+   */
+  double CalcPoint(const uint64_t sample_index, const size_t dimension) const;
+
+ private:
+  uint32_t digital_shifts_[kMaxDimension];  //!< Random digital shift of each dimension
+};
+
+/**
+ * @class LatinHypercube
+ * @brief Latin hypercube sampling with a keyed permutation of the strata for each dimension
+ * @details The permutation is a bijection of the sample index calculated with cycle walking, so the stratum of a sample is calculated
+ *          without the table of all samples. Each dimension is divided into number_of_samples strata and each stratum has one sample.
+ */
+class LatinHypercube {
+ public:
+  /**
+   * @fn LatinHypercube
+   * @brief Constructor
+   * @param [in] number_of_samples: Number of samples (strata)
+   * @param [in] seed: Seed of the permutations
+   */
+  LatinHypercube(const uint64_t number_of_samples, const uint64_t seed);
+
+  /**
+   * @fn CalcStratum
+   * @brief Calculate the stratum of the sample
+   * @param [in] sample_index: Index of the sample (< number_of_samples)
+   * @param [in] dimension: Index of the coordinate
+   * @return Index of the stratum
+   */
+  uint64_t CalcStratum(const uint64_t sample_index, const size_t dimension) const;
+  /**
+   * @fn CalcPoint
+   * @brief Calculate a coordinate of the sample
+   * @param [in] sample_index: Index of the sample (< number_of_samples)
+   * @param [in] dimension: Index of the coordinate
+   * @param [in] jitter: Position in the stratum in (0, 1)
+   * @return Coordinate in (0, 1)
+   */
+  inline double CalcPoint(const uint64_t sample_index, const size_t dimension, const double jitter) const {
+    return ((double)CalcStratum(sample_index, dimension) + jitter) / (double)number_of_samples_;
+  }
+
+ private:
+  static const size_t kNumberOfRounds = 4;  //!< Number of rounds of the permutation
+
+  uint64_t number_of_samples_;  //!< Number of samples
+  uint64_t seed_;               //!< Seed of the permutations
+  size_t number_of_bits_;       //!< Number of bits of the permutation domain (2^number_of_bits_ >= number_of_samples_)
+  uint64_t mask_;               //!< Mask of the permutation domain
+
+  /**
+   * @fn Permute
+   * @brief Bijection in the permutation domain
+   * @param [in] value: Value in the permutation domain
+   * @param [in] dimension: Index of the coordinate to select the key
+   */
+  uint64_t Permute(uint64_t value, const size_t dimension) const;
+};
+
+/**
+ * @fn CalcInverseStandardNormalCdf
+ * @brief Calculate the inverse of the cumulative distribution function of the standard normal distribution
+ * @param [in] probability: Probability in (0, 1)
+ * @return Quantile of the standard normal distribution
+ */
+double CalcInverseStandardNormalCdf(const double probability);
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_RANDOMIZATION_LOW_DISCREPANCY_SEQUENCE_HPP_
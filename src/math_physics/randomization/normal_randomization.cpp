@@ -8,16 +8,81 @@ using libra::NormalRand;
 
 #include <cfloat>  //DBL_EPSILON
 #include <cmath>   //sqrt, log;
+#include <cstdlib>
 
-NormalRand::NormalRand() : average_(0.0), standard_deviation_(1.0), holder_(0.0), is_empty_(true) {}
+namespace {
+/**
+ * @struct ZigguratTable
+ * @brief Tables of the ziggurat method with 128 layers for the standard normal distribution
+ */
+struct ZigguratTable {
+  static const size_t kNumberOfLayers = 128;                 //!< Number of layers
+  static constexpr double kTailStart = 3.442619855899;       //!< Start of the tail region
+  static constexpr double kLayerArea = 9.91256303526217e-3;  //!< Area of each layer
+  uint32_t threshold_[kNumberOfLayers];                      //!< Threshold of the integer value to be inside the rectangle of the layer
+  double width_[kNumberOfLayers];                            //!< Conversion factor from the integer value to the x value
+  double density_[kNumberOfLayers];                          //!< Non-normalized density exp(-x^2/2) at the right edge of the layer
+
+  ZigguratTable() {
+    const double scale = 16777216.0;  // 2^24: range of the value
+    double x = kTailStart, previous_x = kTailStart;
+    const double q = kLayerArea / std::exp(-0.5 * x * x);
+    threshold_[0] = (uint32_t)((x / q) * scale);
+    threshold_[1] = 0;
+    width_[0] = q / scale;
+    width_[kNumberOfLayers - 1] = x / scale;
+    density_[0] = 1.0;
+    density_[kNumberOfLayers - 1] = std::exp(-0.5 * x * x);
+    for (size_t i = kNumberOfLayers - 2; i >= 1; i--) {
+      x = std::sqrt(-2.0 * std::log(kLayerArea / x + std::exp(-0.5 * x * x)));
+      threshold_[i + 1] = (uint32_t)((x / previous_x) * scale);
+      previous_x = x;
+      density_[i] = std::exp(-0.5 * x * x);
+      width_[i] = x / scale;
+    }
+  }
+};
+
+/**
+ * @fn GetZigguratTable
+ * @brief Return the table initialized at the first call
+ */
+const ZigguratTable& GetZigguratTable() {
+  static const ZigguratTable table;
+  return table;
+}
+}  // namespace
+
+thread_local libra::NormalRandomizationBackend NormalRand::default_backend_ = libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle;
+
+NormalRand::NormalRand()
+    : average_(0.0),
+      standard_deviation_(1.0),
+      holder_(0.0),
+      is_empty_(true),
+      backend_(default_backend_) {}
 
 NormalRand::NormalRand(double average, double standard_deviation)
-    : average_(average), standard_deviation_(standard_deviation), holder_(0.0), is_empty_(true) {}
+    : average_(average),
+      standard_deviation_(standard_deviation),
+      holder_(0.0),
+      is_empty_(true),
+      backend_(default_backend_) {}
 
 NormalRand::NormalRand(double average, double standard_deviation, long seed) throw()
-    : average_(average), standard_deviation_(standard_deviation), randomizer_(seed), holder_(0.0), is_empty_(true) {}
+    : average_(average),
+      standard_deviation_(standard_deviation),
+      randomizer_(seed),
+      holder_(0.0),
+      is_empty_(true),
+      backend_(default_backend_),
+      philox_randomizer_((uint64_t)seed) {}
 
 NormalRand::operator double() {
+  if (backend_ == libra::NormalRandomizationBackend::kPhilox) {
+    return GenerateStandardNormalZiggurat() * standard_deviation_ + average_;
+  }
+
   if (is_empty_) {
     double v1, v2, rsq;
     do {
@@ -36,3 +101,64 @@ NormalRand::operator double() {
     return holder_ * standard_deviation_ + average_;
   }
 }
+
+void NormalRand::Fill(double* values, const size_t number_of_values) {
+  if (backend_ == libra::NormalRandomizationBackend::kPhilox) {
+    for (size_t i = 0; i < number_of_values; i++) {
+      values[i] = GenerateStandardNormalZiggurat() * standard_deviation_ + average_;
+    }
+    return;
+  }
+  for (size_t i = 0; i < number_of_values; i++) {
+    values[i] = double(*this);
+  }
+}
+
+void NormalRand::Fill(float* values, const size_t number_of_values) {
+  if (backend_ == libra::NormalRandomizationBackend::kPhilox) {
+    for (size_t i = 0; i < number_of_values; i++) {
+      values[i] = (float)(GenerateStandardNormalZiggurat() * standard_deviation_ + average_);
+    }
+    return;
+  }
+  for (size_t i = 0; i < number_of_values; i++) {
+    values[i] = (float)double(*this);
+  }
+}
+
+void NormalRand::SetParameters(const double average, const double standard_deviation, const long seed) {
+  average_ = average;
+  standard_deviation_ = standard_deviation;
+  randomizer_.InitSeed(seed);
+  philox_randomizer_.InitSeed((uint64_t)seed);
+}
+
+void NormalRand::SetDefaultBackend(const libra::NormalRandomizationBackend backend) { default_backend_ = backend; }
+
+libra::NormalRandomizationBackend NormalRand::GetDefaultBackend() { return default_backend_; }
+
+double NormalRand::GenerateStandardNormalZiggurat() {
+  const ZigguratTable& table = GetZigguratTable();
+  const size_t layer_mask = ZigguratTable::kNumberOfLayers - 1;
+  while (true) {
+    const uint32_t random = philox_randomizer_.GenerateUint32();
+    const size_t layer = random & layer_mask;
+    const int32_t value = (int32_t)(random >> 7) - (1 << 24);  // Signed 25 bit integer
+    const double x = value * table.width_[layer];
+    // Inside the rectangle of the layer
+    if ((uint32_t)std::abs(value) < table.threshold_[layer]) return x;
+
+    if (layer == 0) {
+      // Tail of the distribution
+      double tail_x, tail_y;
+      do {
+        tail_x = -std::log(double(philox_randomizer_)) / ZigguratTable::kTailStart;
+        tail_y = -std::log(double(philox_randomizer_));
+      } while (tail_y + tail_y < tail_x * tail_x);
+      return (value > 0) ? ZigguratTable::kTailStart + tail_x : -ZigguratTable::kTailStart - tail_x;
+    }
+    // Wedge between the rectangle and the density function
+    const double y = table.density_[layer] + double(philox_randomizer_) * (table.density_[layer - 1] - table.density_[layer]);
+    if (y < std::exp(-0.5 * x * x)) return x;
+  }
+}
@@ -1,20 +1,34 @@
 /**
  * @file normal_randomization.hpp
- * @brief Class to generate random value with normal distribution with Box-Muller method
- * @note Ref: NUMERICAL RECIPES in C, p.216-p.217
+ * @brief Class to generate random value with normal distribution with polar Box-Muller method or ziggurat method
+ * @note Ref: NUMERICAL RECIPES in C, p.216-p.217 for the polar Box-Muller method
  */
 
 #ifndef S2E_LIBRARY_RANDOMIZATION_NORMAL_RANDOMIZATION_HPP_
 #define S2E_LIBRARY_RANDOMIZATION_NORMAL_RANDOMIZATION_HPP_
 
+#include <cstddef>
+
 #include "minimal_standard_linear_congruential_generator_with_shuffle.hpp"
+#include "philox_random_generator.hpp"
 using libra::MinimalStandardLcgWithShuffle;
 
 namespace libra {
 
+/**
+ * @enum NormalRandomizationBackend
+ * @brief Uniform random generator and transformation used in NormalRand
+ */
+enum class NormalRandomizationBackend {
+  kMinimalStandardLcgWithShuffle,  //!< Polar Box-Muller method with MinimalStandardLcgWithShuffle. Same sequence as the former versions.
+  kPhilox,                         //!< Ziggurat method with the counter-based Philox4x32-10
+};
+
 /**
  * @class NormalRand
- * @brief Class to generate random value with normal distribution with Box-Muller method
+ * @brief Class to generate random value with normal distribution
+ * @details The polar Box-Muller method is used for kMinimalStandardLcgWithShuffle and the ziggurat method is used for kPhilox.
+ * @note The backend is selected at the construction by the default backend of the thread given by SetDefaultBackend.
  */
 class NormalRand {
  public:
@@ -44,11 +58,28 @@ class NormalRand {
 
   /**
    * @fn Cast operator to double type
-   * @brief Generate random value with the Box-Muller method
+   * @brief Generate random value with the method of the backend
    * @return Randomized value
    */
   operator double();
 
+  /**
+   * @fn Fill
+   * @brief Generate randomized values at once
+   * @note The result is the same as the repeated cast to double.
+   * @param [out] values: Randomized values
+   * @param [in] number_of_values: Number of values
+   */
+  void Fill(double* values, const size_t number_of_values);
+  /**
+   * @fn Fill
+   * @brief Generate randomized values in single precision at once
+   * @note The result is the same as the repeated cast to double rounded to float, and the state advances in the same way.
+   * @param [out] values: Randomized values
+   * @param [in] number_of_values: Number of values
+   */
+  void Fill(float* values, const size_t number_of_values);
+
   /**
    * @fn GetAverage
    * @brief Return average
@@ -61,6 +92,12 @@ class NormalRand {
    */
   inline double GetStandardDeviation() const { return standard_deviation_; }
 
+  /**
+   * @fn GetBackend
+   * @brief Return backend
+   */
+  inline NormalRandomizationBackend GetBackend() const { return backend_; }
+
   /**
    * @fn SetAverage
    * @brief Set average
@@ -90,11 +127,19 @@ class NormalRand {
    * @param standard_deviation: Standard deviation of normal distribution
    * @param seed: Seed of randomization
    */
-  inline void SetParameters(const double average, const double standard_deviation, const long seed) {
-    average_ = average;
-    standard_deviation_ = standard_deviation;
-    randomizer_.InitSeed(seed);
-  }
+  void SetParameters(const double average, const double standard_deviation, const long seed);
+
+  /**
+   * @fn SetDefaultBackend
+   * @brief Set backend used by the instances constructed after this call in this thread
+   * @param [in] backend: Backend
+   */
+  static void SetDefaultBackend(const NormalRandomizationBackend backend);
+  /**
+   * @fn GetDefaultBackend
+   * @brief Return backend used by the instances constructed in this thread
+   */
+  static NormalRandomizationBackend GetDefaultBackend();
 
  private:
   double average_;                            //!< Average
@@ -104,6 +149,18 @@ class NormalRand {
                                               //!< The second value is stored and used in the next call.
                                               //!< It means that Box-Muller method is executed once per two call
   bool is_empty_;                             //!< Flag to show the holder_ has available value
+
+  NormalRandomizationBackend backend_;                              //!< Backend
+  Philox4x32 philox_randomizer_;                                    //!< Randomized origin for kPhilox backend
+  static thread_local NormalRandomizationBackend default_backend_;  //!< Backend of the instances constructed in this thread
+
+  /**
+   * @fn GenerateStandardNormalZiggurat
+   * @brief Generate standard normal value from philox_randomizer_ with the ziggurat method
+   * @note Ref: G. Marsaglia and W. W. Tsang, "The Ziggurat Method for Generating Random Variables", Journal of Statistical Software, 2000.
+   *       One 32 bit integer is used for about 99% of the values. The lower 7 bits are the layer index and the upper 25 bits are the value.
+   */
+  double GenerateStandardNormalZiggurat();
 };
 
 }  // namespace libra
@@ -0,0 +1,82 @@
+/**
+ * @file philox_random_generator.cpp
+ * @brief Counter-based random number generator Philox4x32-10
+ * @note Ref: J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3", SC11, 2011.
+ */
+
+#include "philox_random_generator.hpp"
+using libra::Philox4x32;
+
+namespace {
+const uint32_t kMultiplier0 = 0xD2511F53;  //!< Multiplier of the round function
+const uint32_t kMultiplier1 = 0xCD9E8D57;  //!< Multiplier of the round function
+const uint32_t kWeyl0 = 0x9E3779B9;        //!< Weyl sequence constant for the key schedule (golden ratio)
+const uint32_t kWeyl1 = 0xBB67AE85;        //!< Weyl sequence constant for the key schedule (sqrt(3) - 1)
+const size_t kNumberOfRounds = 10;         //!< Number of rounds
+}  // namespace
+
+Philox4x32::Philox4x32() { InitSeed(0xdeadbeef); }
+
+Philox4x32::Philox4x32(const uint64_t seed, const uint64_t stream_id) { InitSeed(seed, stream_id); }
+
+void Philox4x32::InitSeed(const uint64_t seed, const uint64_t stream_id) {
+  key_[0] = (uint32_t)seed;
+  key_[1] = (uint32_t)(seed >> 32);
+  counter_[0] = 0;
+  counter_[1] = 0;
+  counter_[2] = (uint32_t)stream_id;
+  counter_[3] = (uint32_t)(stream_id >> 32);
+  output_position_ = kBlockSize;
+}
+
+void Philox4x32::GenerateBlock(uint32_t output[kBlockSize]) {
+  CalcBlock(counter_, key_, output);
+  IncrementCounter();
+}
+
+Philox4x32::operator double() { return ConvertToUniform(GenerateUint32()); }
+
+void Philox4x32::FillUniform(double* values, const size_t number_of_values) {
+  size_t i = 0;
+  // Use the remaining outputs first to keep the same sequence as the cast operator
+  while (i < number_of_values && output_position_ < kBlockSize) {
+    values[i++] = ConvertToUniform(output_block_[output_position_++]);
+  }
+  uint32_t block[kBlockSize];
+  for (; i + kBlockSize <= number_of_values; i += kBlockSize) {
+    GenerateBlock(block);
+    for (size_t j = 0; j < kBlockSize; j++) {
+      values[i + j] = ConvertToUniform(block[j]);
+    }
+  }
+  for (; i < number_of_values; i++) {
+    values[i] = double(*this);
+  }
+}
+
+void Philox4x32::CalcBlock(const uint32_t counter[kBlockSize], const uint32_t key[2], uint32_t output[kBlockSize]) {
+  uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+  uint32_t k0 = key[0], k1 = key[1];
+  for (size_t round = 0; round < kNumberOfRounds; round++) {
+    const uint64_t product0 = (uint64_t)kMultiplier0 * c0;
+    const uint64_t product1 = (uint64_t)kMultiplier1 * c2;
+    const uint32_t new_c0 = (uint32_t)(product1 >> 32) ^ c1 ^ k0;
+    const uint32_t new_c2 = (uint32_t)(product0 >> 32) ^ c3 ^ k1;
+    c1 = (uint32_t)product1;
+    c3 = (uint32_t)product0;
+    c0 = new_c0;
+    c2 = new_c2;
+    // Key schedule for the next round
+    k0 += kWeyl0;
+    k1 += kWeyl1;
+  }
+  output[0] = c0;
+  output[1] = c1;
+  output[2] = c2;
+  output[3] = c3;
+}
+
+void Philox4x32::IncrementCounter() {
+  counter_[0]++;
+  if (counter_[0] == 0) counter_[1]++;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file philox_random_generator.hpp
+ * @brief Counter-based random number generator Philox4x32-10
+ * @note Ref: J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3", SC11, 2011.
+ */
+
+#ifndef S2E_LIBRARY_RANDOMIZATION_PHILOX_RANDOM_GENERATOR_HPP_
+#define S2E_LIBRARY_RANDOMIZATION_PHILOX_RANDOM_GENERATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libra {
+
+/**
+ * @class Philox4x32
+ * @brief Counter-based random number generator Philox4x32-10
+ * @details The output block is a bijection of the 128 bit counter with the 64 bit key (seed), so the generator has no internal state
+ *          except the counter. The upper 64 bits of the counter are used as the stream ID, and the generators with different stream IDs
+ *          give independent sequences with the same seed. Any position of the sequence can be generated directly, and the sequences
+ *          do not depend on the number of threads or the order of the calculation.
+ */
+class Philox4x32 {
+ public:
+  static const size_t kBlockSize = 4;  //!< Number of 32 bit integers generated at once
+
+  /**
+   * @fn Philox4x32
+   * @brief Default constructor with default seed value
+   */
+  Philox4x32();
+  /**
+   * @fn Philox4x32
+   * @brief Constructor with seed value
+   * @param [in] seed: Seed of randomization (key)
+   * @param [in] stream_id: Stream ID
+   */
+  explicit Philox4x32(const uint64_t seed, const uint64_t stream_id = 0);
+
+  /**
+   * @fn InitSeed
+   * @brief Set seed value and stream ID, and reset the sequence
+   * @param [in] seed: Seed of randomization (key)
+   * @param [in] stream_id: Stream ID
+   */
+  void InitSeed(const uint64_t seed, const uint64_t stream_id = 0);
+
+  /**
+   * @fn GenerateBlock
+   * @brief Generate the output block of the current counter and increment the counter
+   * @param [out] output: Generated random integers
+   */
+  void GenerateBlock(uint32_t output[kBlockSize]);
+
+  /**
+   * @fn GenerateUint32
+   * @brief Generate a random 32 bit integer. The outputs of a block are used in order.
+   * @return Generated random integer
+   */
+  inline uint32_t GenerateUint32() {
+    if (output_position_ >= kBlockSize) {
+      GenerateBlock(output_block_);
+      output_position_ = 0;
+    }
+    return output_block_[output_position_++];
+  }
+
+  /**
+   * @fn Cast operator of double type
+   * @brief Generate randomized value in (0, 1) when casting
+   * @return Generated randomized value
+   */
+  operator double();
+
+  /**
+   * @fn FillUniform
+   * @brief Generate randomized values in (0, 1)
+   * @note The result is the same as the repeated cast to double.
+   * @param [out] values: Generated randomized values
+   * @param [in] number_of_values: Number of values
+   */
+  void FillUniform(double* values, const size_t number_of_values);
+
+  /**
+   * @fn CalcBlock
+   * @brief Calculate the output block of Philox4x32-10
+   * @param [in] counter: Counter
+   * @param [in] key: Key
+   * @param [out] output: Output block
+   */
+  static void CalcBlock(const uint32_t counter[kBlockSize], const uint32_t key[2], uint32_t output[kBlockSize]);
+
+  /**
+   * @fn ConvertToUniform
+   * @brief Convert 32 bit integer to the double value in (0, 1)
+   */
+  static inline double ConvertToUniform(const uint32_t value) { return ((double)value + 0.5) * (1.0 / 4294967296.0); }
+
+ private:
+  uint32_t key_[2];                    //!< Key given by the seed
+  uint32_t counter_[kBlockSize];       //!< Counter. The lower 64 bits are the position of the block and the upper 64 bits are the stream ID.
+  uint32_t output_block_[kBlockSize];  //!< Output block not used yet
+  size_t output_position_;             //!< Position of the next output in output_block_
+
+  /**
+   * @fn IncrementCounter
+   * @brief Increment the position of the block in the counter
+   */
+  void IncrementCounter();
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_RANDOMIZATION_PHILOX_RANDOM_GENERATOR_HPP_
@@ -35,6 +35,19 @@ class RandomWalk : public libra::OrdinaryDifferentialEquation<N> {
    */
   virtual void DerivativeFunction(double x, const libra::Vector<N>& state, libra::Vector<N>& rhs);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the state and the states of the excitation noise to the snapshot
+   * @param [out] snapshot: Snapshot writer
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the state and the states of the excitation noise from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  void LoadSnapshot(SnapshotReader& snapshot);
+
  private:
   libra::Vector<N> limit_;                  //!< Limit of random walk
   libra::NormalRand normal_randomizer_[N];  //!< Random walk excitation noise
@@ -32,4 +32,20 @@ void RandomWalk<N>::DerivativeFunction(double x, const libra::Vector<N>& state,
   }
 }
 
+template <size_t N>
+void RandomWalk<N>::SaveSnapshot(SnapshotWriter& snapshot) const {
+  libra::OrdinaryDifferentialEquation<N>::SaveSnapshot(snapshot);
+  for (size_t i = 0; i < N; ++i) {
+    snapshot.Write(normal_randomizer_[i]);
+  }
+}
+
+template <size_t N>
+void RandomWalk<N>::LoadSnapshot(SnapshotReader& snapshot) {
+  libra::OrdinaryDifferentialEquation<N>::LoadSnapshot(snapshot);
+  for (size_t i = 0; i < N; ++i) {
+    snapshot.Read(normal_randomizer_[i]);
+  }
+}
+
 #endif  // S2E_LIBRARY_RANDOMIZATION_RANDOM_WALK_TEMPLATE_FUNCTIONS_HPP_
@@ -0,0 +1,140 @@
+/**
+ * @file test_global_randomization.cpp
+ * @brief Test codes for GlobalRandomization class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "global_randomization.hpp"
+#include "random_walk.hpp"
+
+/**
+ * @brief Test for the seeds made in the named streams which should not depend on the other streams
+ */
+TEST(GlobalRandomization, StreamScope) {
+  global_randomization.SetSeed(12345);
+  long gyro_seeds[2];
+  long star_sensor_seed;
+  {
+    GlobalRandomization::StreamScope spacecraft_scope("SPACECRAFT_0");
+    {
+      GlobalRandomization::StreamScope component_scope("GYRO_SENSOR_1");
+      gyro_seeds[0] = global_randomization.MakeSeed();
+      gyro_seeds[1] = global_randomization.MakeSeed();
+    }
+    {
+      GlobalRandomization::StreamScope component_scope("STAR_SENSOR_1");
+      star_sensor_seed = global_randomization.MakeSeed();
+    }
+  }
+  EXPECT_NE(gyro_seeds[0], gyro_seeds[1]);
+  EXPECT_NE(gyro_seeds[0], star_sensor_seed);
+
+  // Reversed construction order with an additional component
+  global_randomization.SetSeed(12345);
+  {
+    GlobalRandomization::StreamScope spacecraft_scope("SPACECRAFT_0");
+    {
+      GlobalRandomization::StreamScope component_scope("MAGNETOMETER_1");
+      global_randomization.MakeSeed();
+    }
+    {
+      GlobalRandomization::StreamScope component_scope("STAR_SENSOR_1");
+      EXPECT_EQ(star_sensor_seed, global_randomization.MakeSeed());
+    }
+    {
+      GlobalRandomization::StreamScope component_scope("GYRO_SENSOR_1");
+      EXPECT_EQ(gyro_seeds[0], global_randomization.MakeSeed());
+      EXPECT_EQ(gyro_seeds[1], global_randomization.MakeSeed());
+    }
+  }
+
+  // Other spacecraft and other case
+  {
+    GlobalRandomization::StreamScope spacecraft_scope("SPACECRAFT_1");
+    GlobalRandomization::StreamScope component_scope("GYRO_SENSOR_1");
+    EXPECT_NE(gyro_seeds[0], global_randomization.MakeSeed());
+  }
+  global_randomization.SetSeed(54321);
+  {
+    GlobalRandomization::StreamScope spacecraft_scope("SPACECRAFT_0");
+    GlobalRandomization::StreamScope component_scope("GYRO_SENSOR_1");
+    EXPECT_NE(gyro_seeds[0], global_randomization.MakeSeed());
+  }
+}
+
+/**
+ * @brief Test for the seeds made outside of the scopes which should be the same as the former versions
+ */
+TEST(GlobalRandomization, SequentialSeed) {
+  global_randomization.SetSeed(12345);
+  const long first_seed = global_randomization.MakeSeed();
+  const long second_seed = global_randomization.MakeSeed();
+
+  global_randomization.SetSeed(12345);
+  EXPECT_EQ(first_seed, global_randomization.MakeSeed());
+  {
+    // The scoped seeds do not consume the sequential seeds
+    GlobalRandomization::StreamScope scope("SCOPE");
+    global_randomization.MakeSeed();
+  }
+  EXPECT_EQ(second_seed, global_randomization.MakeSeed());
+
+  // Same as the minimal standard LCG based seeds
+  libra::MinimalStandardLcg lcg(12345);
+  const double rand = lcg;
+  EXPECT_EQ((long)((rand - 0.5) * 0xffffffff), first_seed);
+}
+
+/**
+ * @brief Test for the seeds and the random values after the restoration from the snapshot
+ */
+TEST(GlobalRandomization, Snapshot) {
+  global_randomization.SetSeed(12345);
+  global_randomization.MakeSeed();
+  {
+    GlobalRandomization::StreamScope scope("SCOPE");
+    global_randomization.MakeSeed();
+  }
+  RandomWalk<3> random_walk(0.1, libra::Vector<3>(1.0), libra::Vector<3>(10.0));
+  for (size_t i = 0; i < 10; i++) ++random_walk;
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  SnapshotWriter writer(stream);
+  global_randomization.SaveSnapshot(writer);
+  random_walk.SaveSnapshot(writer);
+
+  // Expected values without the restoration
+  const long expected_sequential_seed = global_randomization.MakeSeed();
+  long expected_scoped_seed;
+  {
+    GlobalRandomization::StreamScope scope("SCOPE");
+    expected_scoped_seed = global_randomization.MakeSeed();
+  }
+  for (size_t i = 0; i < 10; i++) ++random_walk;
+  const libra::Vector<3> expected_state = static_cast<const RandomWalk<3>&>(random_walk).GetState();
+
+  global_randomization.SetSeed(54321);
+  RandomWalk<3> restored_random_walk(0.1, libra::Vector<3>(1.0), libra::Vector<3>(10.0));
+  SnapshotReader reader(stream);
+  global_randomization.LoadSnapshot(reader);
+  restored_random_walk.LoadSnapshot(reader);
+  EXPECT_EQ(expected_sequential_seed, global_randomization.MakeSeed());
+  {
+    GlobalRandomization::StreamScope scope("SCOPE");
+    EXPECT_EQ(expected_scoped_seed, global_randomization.MakeSeed());
+  }
+  for (size_t i = 0; i < 10; i++) ++restored_random_walk;
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(expected_state[i], restored_random_walk[i]);
+  }
+
+  // Mismatched tag and the end of the snapshot
+  std::stringstream wrong_stream(std::ios::in | std::ios::out | std::ios::binary);
+  SnapshotWriter wrong_writer(wrong_stream);
+  wrong_writer.WriteTag("ORBIT");
+  SnapshotReader wrong_reader(wrong_stream);
+  EXPECT_THROW(global_randomization.LoadSnapshot(wrong_reader), std::invalid_argument);
+  EXPECT_THROW(global_randomization.LoadSnapshot(wrong_reader), std::invalid_argument);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file test_low_discrepancy_sequence.cpp
+ * @brief Test codes for SobolSequence and LatinHypercube classes with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "low_discrepancy_sequence.hpp"
+
+/**
+ * @brief Test the stratification of the first 2^k points of the Sobol sequence in each dimension
+ */
+TEST(SobolSequence, Stratification) {
+  const libra::SobolSequence sobol(12345);
+  const size_t number_of_points = 256;
+  for (size_t dimension = 0; dimension < libra::SobolSequence::kMaxDimension; dimension++) {
+    std::vector<int> counts(number_of_points, 0);
+    for (size_t i = 0; i < number_of_points; i++) {
+      const double point = sobol.CalcPoint(i, dimension);
+      ASSERT_GT(point, 0.0);
+      ASSERT_LT(point, 1.0);
+      counts[(size_t)(point * number_of_points)]++;
+    }
+    for (size_t i = 0; i < number_of_points; i++) {
+      EXPECT_EQ(1, counts[i]) << "dimension " << dimension << ", stratum " << i;
+    }
+  }
+}
+
+/**
+ * @brief Test the stratification of the 2D projection of the first two dimensions
+ */
+TEST(SobolSequence, TwoDimensionalStratification) {
+  const libra::SobolSequence sobol(0);
+  const size_t number_of_points = 64;  // 8 x 8 cells
+  std::vector<int> counts(number_of_points, 0);
+  for (size_t i = 0; i < number_of_points; i++) {
+    const size_t x = (size_t)(sobol.CalcPoint(i, 0) * 8.0);
+    const size_t y = (size_t)(sobol.CalcPoint(i, 1) * 8.0);
+    counts[x * 8 + y]++;
+  }
+  for (size_t i = 0; i < number_of_points; i++) {
+    EXPECT_EQ(1, counts[i]);
+  }
+}
+
+/**
+ * @brief Test that the Latin hypercube puts one sample in each stratum of each dimension
+ */
+TEST(LatinHypercube, OneSamplePerStratum) {
+  const size_t number_of_samples = 1000;  // Not a power of two to use the cycle walking
+  const libra::LatinHypercube latin_hypercube(number_of_samples, 42);
+  std::vector<std::vector<int>> counts(3, std::vector<int>(number_of_samples, 0));
+  size_t number_of_fixed_points = 0;
+  for (size_t i = 0; i < number_of_samples; i++) {
+    for (size_t dimension = 0; dimension < 3; dimension++) {
+      const uint64_t stratum = latin_hypercube.CalcStratum(i, dimension);
+      ASSERT_LT(stratum, number_of_samples);
+      counts[dimension][stratum]++;
+    }
+    if (latin_hypercube.CalcStratum(i, 0) == latin_hypercube.CalcStratum(i, 1)) number_of_fixed_points++;
+    const double point = latin_hypercube.CalcPoint(i, 2, 0.5);
+    EXPECT_DOUBLE_EQ((latin_hypercube.CalcStratum(i, 2) + 0.5) / number_of_samples, point);
+  }
+  for (size_t dimension = 0; dimension < 3; dimension++) {
+    for (size_t i = 0; i < number_of_samples; i++) {
+      EXPECT_EQ(1, counts[dimension][i]);
+    }
+  }
+  // The permutations of the dimensions are different
+  EXPECT_LT(number_of_fixed_points, 20u);
+}
+
+/**
+ * @brief Test the inverse of the standard normal cumulative distribution function
+ */
+TEST(LowDiscrepancySequence, InverseStandardNormalCdf) {
+  EXPECT_NEAR(0.0, libra::CalcInverseStandardNormalCdf(0.5), 1e-15);
+  EXPECT_NEAR(1.959963984540054, libra::CalcInverseStandardNormalCdf(0.975), 1e-12);
+  EXPECT_NEAR(-2.326347874040841, libra::CalcInverseStandardNormalCdf(0.01), 1e-12);
+  EXPECT_NEAR(-5.997807015007686, libra::CalcInverseStandardNormalCdf(1e-9), 1e-9);
+  EXPECT_NEAR(1.0, libra::CalcInverseStandardNormalCdf(0.8413447460685429), 1e-12);
+}
@@ -0,0 +1,92 @@
+/**
+ * @file test_normal_randomization.cpp
+ * @brief Test codes for NormalRand class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "normal_randomization.hpp"
+
+/**
+ * @brief Test for the sequence of the default backend which should be the same as the former versions
+ */
+TEST(NormalRand, MinimalStandardLcgSequence) {
+  EXPECT_EQ(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle, libra::NormalRand::GetDefaultBackend());
+  libra::NormalRand normal_rand(1.0, 2.0, 12345);
+  EXPECT_EQ(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle, normal_rand.GetBackend());
+
+  const double expected[5] = {1.5063297974176755, 2.0750791795193901, -1.9829419157364216, 1.9653271606364409, 1.6080937392657084};
+  double values[5];
+  values[0] = normal_rand;
+  normal_rand.Fill(&values[1], 4);
+  for (size_t i = 0; i < 5; i++) {
+    EXPECT_NEAR(expected[i], values[i], 1e-15);
+  }
+}
+
+/**
+ * @brief Test for the statistics and the block generation of the Philox backend
+ */
+TEST(NormalRand, PhiloxBackend) {
+  libra::NormalRand::SetDefaultBackend(libra::NormalRandomizationBackend::kPhilox);
+  libra::NormalRand normal_rand(1.0, 2.0, 12345);
+  libra::NormalRand::SetDefaultBackend(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle);
+  EXPECT_EQ(libra::NormalRandomizationBackend::kPhilox, normal_rand.GetBackend());
+
+  const size_t number_of_values = 100001;
+  std::vector<double> expected(number_of_values);
+  double sum = 0.0, square_sum = 0.0;
+  size_t number_within_1sigma = 0, number_over_3sigma = 0;
+  for (size_t i = 0; i < number_of_values; i++) {
+    expected[i] = normal_rand;
+    sum += expected[i];
+    square_sum += expected[i] * expected[i];
+    const double normalized = fabs(expected[i] - 1.0) / 2.0;
+    if (normalized < 1.0) number_within_1sigma++;
+    if (normalized > 3.0) number_over_3sigma++;
+  }
+  const double average = sum / (double)number_of_values;
+  const double standard_deviation = sqrt(square_sum / (double)number_of_values - average * average);
+  EXPECT_NEAR(1.0, average, 0.02);
+  EXPECT_NEAR(2.0, standard_deviation, 0.02);
+  // Probabilities of the standard normal distribution
+  EXPECT_NEAR(0.682689, number_within_1sigma / (double)number_of_values, 0.005);
+  EXPECT_NEAR(0.002700, number_over_3sigma / (double)number_of_values, 0.0005);
+
+  // Same sequence with any split of the calls after the reseed
+  normal_rand.SetParameters(1.0, 2.0, 12345);
+  std::vector<double> values(number_of_values);
+  values[0] = normal_rand;
+  values[1] = normal_rand;
+  normal_rand.Fill(&values[2], 9);
+  normal_rand.Fill(&values[11], number_of_values - 11);
+  for (size_t i = 0; i < number_of_values; i++) {
+    EXPECT_DOUBLE_EQ(expected[i], values[i]);
+  }
+}
+
+/**
+ * @brief Test for the single precision block generation of both backends
+ */
+TEST(NormalRand, FillSinglePrecision) {
+  const libra::NormalRandomizationBackend backends[2] = {libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle,
+                                                         libra::NormalRandomizationBackend::kPhilox};
+  for (const auto backend : backends) {
+    libra::NormalRand::SetDefaultBackend(backend);
+    libra::NormalRand normal_rand_double(1.0, 2.0, 12345);
+    libra::NormalRand normal_rand_float(1.0, 2.0, 12345);
+    libra::NormalRand::SetDefaultBackend(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle);
+
+    double expected[64];
+    float values[64];
+    normal_rand_double.Fill(expected, 64);
+    normal_rand_float.Fill(values, 64);
+    for (size_t i = 0; i < 64; i++) {
+      EXPECT_EQ((float)expected[i], values[i]);
+    }
+    // The states advance in the same way
+    EXPECT_DOUBLE_EQ(double(normal_rand_double), double(normal_rand_float));
+  }
+}
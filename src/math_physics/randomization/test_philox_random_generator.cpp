@@ -0,0 +1,84 @@
+/**
+ * @file test_philox_random_generator.cpp
+ * @brief Test codes for Philox4x32 class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "philox_random_generator.hpp"
+
+/**
+ * @brief Test for the known answers of Philox4x32-10 in the Random123 library
+ */
+TEST(Philox4x32, KnownAnswer) {
+  uint32_t output[4];
+
+  const uint32_t zero_counter[4] = {0, 0, 0, 0};
+  const uint32_t zero_key[2] = {0, 0};
+  libra::Philox4x32::CalcBlock(zero_counter, zero_key, output);
+  EXPECT_EQ(0x6627e8d5u, output[0]);
+  EXPECT_EQ(0xe169c58du, output[1]);
+  EXPECT_EQ(0xbc57ac4cu, output[2]);
+  EXPECT_EQ(0x9b00dbd8u, output[3]);
+
+  const uint32_t max_counter[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+  const uint32_t max_key[2] = {0xffffffff, 0xffffffff};
+  libra::Philox4x32::CalcBlock(max_counter, max_key, output);
+  EXPECT_EQ(0x408f276du, output[0]);
+  EXPECT_EQ(0x41c83b0eu, output[1]);
+  EXPECT_EQ(0xa20bc7c6u, output[2]);
+  EXPECT_EQ(0x6d5451fdu, output[3]);
+
+  const uint32_t pi_counter[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+  const uint32_t pi_key[2] = {0xa4093822, 0x299f31d0};
+  libra::Philox4x32::CalcBlock(pi_counter, pi_key, output);
+  EXPECT_EQ(0xd16cfe09u, output[0]);
+  EXPECT_EQ(0x94fdccebu, output[1]);
+  EXPECT_EQ(0x5001e420u, output[2]);
+  EXPECT_EQ(0x24126ea1u, output[3]);
+}
+
+/**
+ * @brief Test for the uniform values and the block generation
+ */
+TEST(Philox4x32, FillUniform) {
+  const size_t number_of_values = 1001;
+  libra::Philox4x32 generator(12345, 7);
+  std::vector<double> expected(number_of_values);
+  double sum = 0.0;
+  for (size_t i = 0; i < number_of_values; i++) {
+    expected[i] = double(generator);
+    EXPECT_GT(expected[i], 0.0);
+    EXPECT_LT(expected[i], 1.0);
+    sum += expected[i];
+  }
+  EXPECT_NEAR(0.5, sum / (double)number_of_values, 0.03);
+
+  // Same sequence with any split of the calls
+  generator.InitSeed(12345, 7);
+  std::vector<double> values(number_of_values);
+  values[0] = double(generator);
+  generator.FillUniform(&values[1], 6);
+  generator.FillUniform(&values[7], number_of_values - 7);
+  for (size_t i = 0; i < number_of_values; i++) {
+    EXPECT_DOUBLE_EQ(expected[i], values[i]);
+  }
+}
+
+/**
+ * @brief Test for the independence of the streams
+ */
+TEST(Philox4x32, Stream) {
+  libra::Philox4x32 generator_0(12345, 0);
+  libra::Philox4x32 generator_1(12345, 1);
+  libra::Philox4x32 generator_1_copy(12345, 1);
+  uint32_t block_0[4], block_1[4], block_1_copy[4];
+  generator_0.GenerateBlock(block_0);
+  generator_1.GenerateBlock(block_1);
+  generator_1_copy.GenerateBlock(block_1_copy);
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_NE(block_0[i], block_1[i]);
+    EXPECT_EQ(block_1[i], block_1_copy[i]);
+  }
+}
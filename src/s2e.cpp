@@ -71,11 +71,14 @@ int main(int argc, char *argv[])
 
   auto simulation_case = SampleCase(ini_file);
   simulation_case.Initialize();
+  system_clock::time_point initialized = system_clock::now();
   simulation_case.Main();
 
   end = system_clock::now();
+  double initialization_time = static_cast<double>(duration_cast<microseconds>(initialized - start).count() / 1000000.0);
   double time = static_cast<double>(duration_cast<microseconds>(end - start).count() / 1000000.0);
-  std::cout << std::endl << "Simulation execution time: " << time << "sec" << std::endl << std::endl;
+  std::cout << std::endl << "Initialization time: " << initialization_time << "sec" << std::endl;
+  std::cout << "Simulation execution time: " << time << "sec" << std::endl << std::endl;
 
   return EXIT_SUCCESS;
 }
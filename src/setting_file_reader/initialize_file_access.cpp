@@ -8,112 +8,225 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cctype>
 #include <cstring>
+#include <filesystem>
 #include <limits>
-#include <regex>
+#include <mutex>
+#include <unordered_map>
 
 #include "../utilities/macros.hpp"
+#include "numeric_csv_table.hpp"
 
-#ifdef WIN32
-IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
-  // strcpy_s(file_path_char_, (size_t)_countof(file_path_char_), file_path_.c_str());
-  strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
+namespace {
+/**
+ * @struct CachedIniFile
+ * @brief Parsed ini file in the cache
+ */
+struct CachedIniFile {
+  std::filesystem::file_time_type last_write_time;  //!< Last write time of the file when it is parsed
+  std::shared_ptr<const INIReader> ini_reader;      //!< Parsed ini file
+  bool is_in_memory = false;                        //!< True for the ini file registered by RegisterInMemoryFile
+};
+
+/**
+ * @fn GetIniFileCacheMutex
+ * @brief Return the mutex of the cache
+ */
+std::mutex& GetIniFileCacheMutex() {
+  static std::mutex ini_file_cache_mutex;
+  return ini_file_cache_mutex;
+}
+
+/**
+ * @fn GetIniFileCache
+ * @brief Return the cache of the parsed ini files with the file path as the key
+ */
+std::unordered_map<std::string, CachedIniFile>& GetIniFileCache() {
+  static std::unordered_map<std::string, CachedIniFile> ini_file_cache;
+  return ini_file_cache;
+}
+
+/**
+ * @fn ReplaceAll
+ * @brief Replace all occurrences of the pattern in the string
+ */
+void ReplaceAll(std::string& value, const std::string& pattern, const std::string& replacement) {
+  for (size_t position = value.find(pattern); position != std::string::npos; position = value.find(pattern, position + replacement.size())) {
+    value.replace(position, pattern.size(), replacement);
+  }
+}
+
+/**
+ * @fn TrimAndLower
+ * @brief Return the string without the surrounding spaces in the lower case to compare the names as INIReader
+ */
+std::string TrimAndLower(const std::string& input) {
+  size_t begin = 0;
+  size_t end = input.size();
+  while (begin < end && std::isspace((unsigned char)input[begin])) begin++;
+  while (end > begin && std::isspace((unsigned char)input[end - 1])) end--;
+  std::string output = input.substr(begin, end - begin);
+  std::transform(output.begin(), output.end(), output.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+  return output;
 }
-#else
-IniAccess::IniAccess(const std::string file_path) : file_path_(file_path), ini_reader_(file_path) {
+}  // namespace
+
+IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
   strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
 
   std::string ext = ".ini";
   if (file_path_.size() < 4 || !std::equal(std::rbegin(ext), std::rend(ext), std::rbegin(file_path_))) {
     // this is not ini file(csv)
+    static const std::shared_ptr<const INIReader> empty_ini_reader = std::make_shared<const INIReader>("", 0);
+    ini_reader_ = empty_ini_reader;
     return;
   }
-  if (ini_reader_.ParseError() != 0) {
+  ini_reader_ = GetIniReader(file_path_);
+  if (ini_reader_->ParseError() != 0) {
     std::cerr << "Error reading INI file : " << file_path_ << std::endl;
-    std::cerr << "\t error code: " << ini_reader_.ParseError() << std::endl;
+    std::cerr << "\t error code: " << ini_reader_->ParseError() << std::endl;
     throw std::runtime_error("Error reading INI file");
   }
 }
-#endif
 
-std::vector<unsigned char> IniAccess::ReadVectorUnsignedChar(const char* section_name, const char* key_name, const size_t num) {
-  std::vector<unsigned char> data;
-  for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back((unsigned char)ReadInt(section_name, edited_key_name.str().c_str()));
+std::shared_ptr<const INIReader> IniAccess::GetIniReader(const std::string& file_path) {
+  std::error_code error_code;
+  const std::filesystem::file_time_type last_write_time = std::filesystem::last_write_time(file_path, error_code);
+
+  std::lock_guard<std::mutex> lock(GetIniFileCacheMutex());
+  auto& cache = GetIniFileCache();
+  auto cached_file = cache.find(file_path);
+  if (cached_file != cache.end() && cached_file->second.is_in_memory) return cached_file->second.ini_reader;
+  if (!error_code && cached_file != cache.end() && cached_file->second.last_write_time == last_write_time) {
+    return cached_file->second.ini_reader;
   }
-  return data;
-}
 
-double IniAccess::ReadDouble(const char* section_name, const char* key_name) {
-#ifdef WIN32
-  std::stringstream value;
-  double temp = 0;
+  std::shared_ptr<const INIReader> ini_reader = std::make_shared<const INIReader>(file_path);
+  // Files which cannot be opened are not cached to try again at the next access
+  if (!error_code) cache[file_path] = CachedIniFile{last_write_time, ini_reader};
+  return ini_reader;
+}
 
-  GetPrivateProfileStringA(section_name, key_name, 0, text_buffer_, kMaxCharLength, file_path_char_);
+bool IniAccess::RegisterInMemoryFile(const std::string& file_path, const std::string& content) {
+  std::shared_ptr<const INIReader> ini_reader = std::make_shared<const INIReader>(content.c_str(), content.size());
+  if (ini_reader->ParseError() != 0) {
+    std::cerr << "Error parsing in-memory INI file : " << file_path << std::endl;
+    std::cerr << "\t error code: " << ini_reader->ParseError() << std::endl;
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(GetIniFileCacheMutex());
+  GetIniFileCache()[file_path] = CachedIniFile{std::filesystem::file_time_type(), ini_reader, true};
+  return true;
+}
 
-  value << text_buffer_;  // input string
-  value >> temp;          // return as double
-  //	std::cout << text_buffer_;
+bool IniAccess::RegisterInMemoryFile(const std::string& file_path, const std::string& base_file_path,
+                                     const std::map<std::string, std::map<std::string, std::string>>& overridden_values) {
+  // Overridden values with the normalized names which are not written yet
+  std::map<std::string, std::map<std::string, std::pair<std::string, std::string>>> remaining_values;
+  std::vector<std::string> section_order;
+  for (const auto& section : overridden_values) {
+    const std::string section_key = TrimAndLower(section.first);
+    if (remaining_values.count(section_key) == 0) section_order.push_back(section.first);
+    for (const auto& value : section.second) {
+      remaining_values[section_key][TrimAndLower(value.first)] = std::make_pair(value.first, value.second);
+    }
+  }
 
-  return temp;
-#else
-  UNUSED(text_buffer_);
-  return ini_reader_.GetReal(section_name, key_name, 0);
-#endif
-}
+  std::ostringstream content;
+  std::string current_section;
+  // Write the overridden values of the current section which are not in the base file
+  auto flush_section = [&]() {
+    auto section = remaining_values.find(current_section);
+    if (section == remaining_values.end()) return;
+    for (const auto& value : section->second) {
+      content << value.second.first << " = " << value.second.second << "\n";
+    }
+    section->second.clear();
+  };
+
+  if (!base_file_path.empty()) {
+    std::ifstream base_file(base_file_path);
+    if (!base_file.is_open()) {
+      std::cerr << "Error reading base INI file : " << base_file_path << std::endl;
+      return false;
+    }
+    std::string line;
+    while (std::getline(base_file, line)) {
+      const std::string trimmed_line = TrimAndLower(line);
+      if (!trimmed_line.empty() && trimmed_line.front() == '[') {
+        flush_section();
+        const size_t section_end = trimmed_line.find(']');
+        current_section = TrimAndLower(trimmed_line.substr(1, section_end == std::string::npos ? std::string::npos : section_end - 1));
+        content << line << "\n";
+        continue;
+      }
+      const size_t delimiter_position = line.find_first_of("=:");
+      if (!trimmed_line.empty() && trimmed_line.front() != '/' && delimiter_position != std::string::npos) {
+        auto section = remaining_values.find(current_section);
+        if (section != remaining_values.end()) {
+          auto value = section->second.find(TrimAndLower(line.substr(0, delimiter_position)));
+          if (value != section->second.end()) {
+            content << line.substr(0, delimiter_position) << "= " << value->second.second << "\n";
+            section->second.erase(value);
+            continue;
+          }
+        }
+      }
+      content << line << "\n";
+    }
+    flush_section();
+  }
 
-int IniAccess::ReadInt(const char* section_name, const char* key_name) {
-#ifdef WIN32
-  int temp;
+  // Sections which are not in the base file
+  for (const auto& section_name : section_order) {
+    current_section = TrimAndLower(section_name);
+    if (remaining_values[current_section].empty()) continue;
+    content << "[" << section_name << "]\n";
+    flush_section();
+  }
 
-  temp = GetPrivateProfileIntA(section_name, key_name, 0, file_path_char_);
+  return RegisterInMemoryFile(file_path, content.str());
+}
 
-  return temp;
-#else
-  return (int)ini_reader_.GetInteger(section_name, key_name, 0);
-#endif
+void IniAccess::ClearCache() {
+  std::lock_guard<std::mutex> lock(GetIniFileCacheMutex());
+  GetIniFileCache().clear();
 }
 
-std::vector<int> IniAccess::ReadVectorInt(const char* section_name, const char* key_name, const size_t num) {
-  std::vector<int> data;
+std::vector<unsigned char> IniAccess::ReadVectorUnsignedChar(const char* section_name, const char* key_name, const size_t num) {
+  std::vector<unsigned char> data;
   for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back(ReadInt(section_name, edited_key_name.str().c_str()));
+    data.push_back((unsigned char)ReadInt(section_name, MakeIndexedKeyName(key_name, i).c_str()));
   }
   return data;
 }
 
-bool IniAccess::ReadBoolean(const char* section_name, const char* key_name) {
-#ifdef WIN32
-  int temp;
+double IniAccess::ReadDouble(const char* section_name, const char* key_name) { return ini_reader_->GetReal(section_name, key_name, 0); }
 
-  temp = GetPrivateProfileIntA(section_name, key_name, 0, file_path_char_);
-  if (temp > 0) {
-    return true;
+int IniAccess::ReadInt(const char* section_name, const char* key_name) { return (int)ini_reader_->GetInteger(section_name, key_name, 0); }
+
+std::vector<int> IniAccess::ReadVectorInt(const char* section_name, const char* key_name, const size_t num) {
+  std::vector<int> data;
+  for (size_t i = 0; i < num; i++) {
+    data.push_back(ReadInt(section_name, MakeIndexedKeyName(key_name, i).c_str()));
   }
-  return false;
-#else
-  return ini_reader_.GetBoolean(section_name, key_name, false);
-#endif
+  return data;
 }
 
+bool IniAccess::ReadBoolean(const char* section_name, const char* key_name) { return ini_reader_->GetBoolean(section_name, key_name, false); }
+
 void IniAccess::ReadDoubleArray(const char* section_name, const char* key_name, const int id, const int num, double* data) {
+  const std::string key_name_with_id = std::string(key_name) + std::to_string(id);
   for (int i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << id << "(" << i << ")";
-    data[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+    data[i] = ReadDouble(section_name, MakeIndexedKeyName(key_name_with_id.c_str(), i).c_str());
   }
 }
 
 std::vector<double> IniAccess::ReadVectorDouble(const char* section_name, const char* key_name, const size_t num) {
   std::vector<double> data;
   for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back(ReadDouble(section_name, edited_key_name.str().c_str()));
+    data.push_back(ReadDouble(section_name, MakeIndexedKeyName(key_name, i).c_str()));
   }
   return data;
 }
@@ -122,17 +235,14 @@ void IniAccess::ReadQuaternion(const char* section_name, const char* key_name, l
   libra::Quaternion temp;
   double norm = 0.0;
 
+  const std::string new_format_key_name = std::string(key_name) + "_";
   for (int i = 0; i < 4; i++) {  // Read Quaternion as new format
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "_(" << i << ")";
-    temp[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+    temp[i] = ReadDouble(section_name, MakeIndexedKeyName(new_format_key_name.c_str(), i).c_str());
     norm += temp[i] * temp[i];
   }
   if (norm == 0.0) {  // If it is not new format, try to read old format
     for (int i = 0; i < 4; i++) {
-      std::stringstream edited_key_name;
-      edited_key_name << key_name << "(" << i << ")";
-      data[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+      data[i] = ReadDouble(section_name, MakeIndexedKeyName(key_name, i).c_str());
     }
   } else {
     data[0] = temp[0];
@@ -143,36 +253,26 @@ void IniAccess::ReadQuaternion(const char* section_name, const char* key_name, l
 }
 
 void IniAccess::ReadChar(const char* section_name, const char* key_name, const int size, char* data) {
-#ifdef WIN32
-  GetPrivateProfileStringA(section_name, key_name, 0, data, size, file_path_char_);
-#else
   std::string string_data = ReadString(section_name, key_name);
   strncpy(data, string_data.c_str(), size);
-#endif
 }
 
 std::string IniAccess::ReadString(const char* section_name, const char* key_name) {
-  std::string value;
-#ifdef WIN32
-  char temp[kMaxCharLength];
-  ReadChar(section_name, key_name, kMaxCharLength, temp);
-  value = std::string(temp);
-#else
-  value = ini_reader_.GetString(section_name, key_name, "NULL");
-#endif
+  std::string value = ini_reader_->GetString(section_name, key_name, "NULL");
   // Special characters
-  // Inline comments
-  std::regex inline_comment_pattern("\\s*//.*");
-  value = std::regex_replace(value, inline_comment_pattern, "");
+  // Inline comments with the preceding spaces
+  const size_t comment_position = value.find("//");
+  if (comment_position != std::string::npos) {
+    size_t erase_position = comment_position;
+    while (erase_position > 0 && std::isspace((unsigned char)value[erase_position - 1])) erase_position--;
+    value.erase(erase_position);
+  }
   // INI_FILE_DIR
-  std::string ini_path = INI_FILE_DIR_FROM_EXE;
-  value = std::regex_replace(value, std::regex("INI_FILE_DIR_FROM_EXE"), ini_path);
+  ReplaceAll(value, "INI_FILE_DIR_FROM_EXE", INI_FILE_DIR_FROM_EXE);
   // EXT_LIB_DIR
-  std::string ext_lib_path = EXT_LIB_DIR_FROM_EXE;
-  value = std::regex_replace(value, std::regex("EXT_LIB_DIR_FROM_EXE"), ext_lib_path);
+  ReplaceAll(value, "EXT_LIB_DIR_FROM_EXE", EXT_LIB_DIR_FROM_EXE);
   // CORE_DIR
-  std::string s2e_core_path = CORE_DIR_FROM_EXE;
-  value = std::regex_replace(value, std::regex("CORE_DIR_FROM_EXE"), s2e_core_path);
+  ReplaceAll(value, "CORE_DIR_FROM_EXE", CORE_DIR_FROM_EXE);
 
   return value;
 }
@@ -180,9 +280,7 @@ std::string IniAccess::ReadString(const char* section_name, const char* key_name
 std::vector<std::string> IniAccess::ReadVectorString(const char* section_name, const char* key_name, const size_t num) {
   std::vector<std::string> data;
   for (size_t i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "(" << i << ")";
-    data.push_back(ReadString(section_name, edited_key_name.str().c_str()));
+    data.push_back(ReadString(section_name, MakeIndexedKeyName(key_name, i).c_str()));
   }
   return data;
 }
@@ -199,14 +297,8 @@ std::vector<std::string> IniAccess::ReadStrVector(const char* section_name, cons
   std::string temp;
   unsigned int i = 0;
   while (true) {
-    std::stringstream c_name;
-    c_name << key_name << "(" << i << ")";
-    temp = ReadString(section_name, c_name.str().c_str());
-#ifdef WIN32
-    if (temp.c_str()[0] == NULL) {
-#else
+    temp = ReadString(section_name, MakeIndexedKeyName(key_name, i).c_str());
     if (!strcmp(temp.c_str(), "NULL")) {
-#endif
       break;
     } else {
       data.push_back(temp);
@@ -227,46 +319,16 @@ std::vector<std::string> IniAccess::Split(const std::string& input, const char d
 }
 
 void IniAccess::ReadCsvDouble(std::vector<std::vector<double>>& output_value, const size_t node_num) {
-  std::ifstream ifs(file_path_char_);
-  if (!ifs.is_open()) {
-    std::cerr << "file open error. filename = " << file_path_char_ << std::endl;
-  }
-  std::string line;
-
-  output_value.reserve(node_num);
-  while (getline(ifs, line)) {
-    std::vector<std::string> string_vector = Split(line, ',');
-    std::vector<double> temp;
-    temp.reserve(node_num);
-    for (size_t i = 0; i < string_vector.size(); i++) {
-      temp.push_back(std::stod(string_vector.at(i)));
-    }
-    output_value.push_back(temp);
-  }
+  ReadCsvDoubleWithHeader(output_value, node_num, 0, 0);
 }
 
 void IniAccess::ReadCsvDoubleWithHeader(std::vector<std::vector<double>>& output_value, const size_t node_num, const size_t row_header_num,
                                         const size_t column_header_num) {
-  std::ifstream ifs(file_path_char_);
-  if (!ifs.is_open()) {
-    std::cerr << "file open error. filename = " << file_path_char_ << std::endl;
-  }
-  std::string line;
-  size_t line_num = 0;
-  output_value.reserve(node_num);
-  while (getline(ifs, line)) {
-    if (line_num >= row_header_num) {
-      std::vector<std::string> string_vector = Split(line, ',');
-      std::vector<double> temp;
-      temp.reserve(node_num);
-      for (size_t i = 0; i < string_vector.size(); i++) {
-        if (i >= column_header_num) {
-          temp.push_back(std::stod(string_vector.at(i)));
-        }
-      }
-      output_value.push_back(temp);
-    }
-    line_num++;
+  const NumericCsvTable table(file_path_, row_header_num, column_header_num);
+  // The rows are appended to the output as the previous reader did
+  output_value.reserve(output_value.size() + std::max(node_num, table.GetNumberOfRows()));
+  for (size_t row = 0; row < table.GetNumberOfRows(); row++) {
+    output_value.emplace_back(table.GetRow(row), table.GetRow(row) + table.GetNumberOfColumns());
   }
 }
 
@@ -10,19 +10,21 @@
 
 #define INI_CALC_LABEL "calculation"
 #define INI_LOG_LABEL "logging"
+#define INI_LOG_PRESCALER_LABEL "log_prescaler"
 
 #ifdef WIN32
 #define _WINSOCKAPI_  // stops windows.h including winsock.h
 #include <tchar.h>
 #define NOMINMAX
 #include <windows.h>
-#else
-#include "../../ExtLibraries/inih/cpp/INIReader.h"
 #endif
+#include "../../ExtLibraries/inih/cpp/INIReader.h"
 
 #include <fstream>
+#include <map>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -30,6 +32,8 @@
 /**
  * @class IniAccess
  * @brief Class to read and get parameters for the `ini` format file
+ * @note Each ini file is parsed once and the parsed values are shared between the instances in the process. The file is parsed again only
+ *       when its last write time is changed.
  */
 class IniAccess {
  public:
@@ -175,6 +179,8 @@ class IniAccess {
   /**
    * @fn ReadCsvDouble
    * @brief Read matrix value in CSV file
+   * @note The values are read by NumericCsvTable and the rows are appended to output_value. Empty lines are skipped, and the rows with the
+   *       different number of columns or non-numeric values throw std::invalid_argument.
    * @param[out] output_value: Read double matrix value
    * @param[in] node_num: Number of node. When reading n * m matrix, please substitute bigger number.
    */
@@ -182,6 +188,8 @@ class IniAccess {
   /**
    * @fn ReadCsvDoubleWithHeader
    * @brief Read matrix value in CSV file with header
+   * @note The values are read by NumericCsvTable and the rows are appended to output_value. Empty lines are skipped, and the rows with the
+   *       different number of columns or non-numeric values throw std::invalid_argument.
    * @param[out] output_value: Read double matrix value
    * @param[in] node_num: Number of node. When reading n * m matrix, please substitute bigger number.
    * @param[in] row_header_num: Number of rows of header
@@ -197,22 +205,62 @@ class IniAccess {
    */
   void ReadCsvString(std::vector<std::vector<std::string>>& output_value, const size_t node_num);
 
+  /**
+   * @fn RegisterInMemoryFile
+   * @brief Register the content of an ini file in the process to read it with the file path without the file system
+   * @note The registered content is used instead of the file with the same path until ClearCache. The file path must end with ".ini", and
+   *       the other ini files referred in the content can be also registered with their paths.
+   * @param[in] file_path: File path to access the content
+   * @param[in] content: Content in the ini format
+   * @return True when the content is parsed
+   */
+  static bool RegisterInMemoryFile(const std::string& file_path, const std::string& content);
+  /**
+   * @fn RegisterInMemoryFile
+   * @brief Register an ini file made of a base ini file and the overridden values in the process (e.g., a case of a parameter sweep)
+   * @note The values of the existing keys in the base file are replaced, and the other keys and sections are added. The section and key names
+   *       are compared without the case as INIReader.
+   * @param[in] file_path: File path to access the content. It can be same as base_file_path to override the file itself.
+   * @param[in] base_file_path: File path of the base ini file. Empty makes the content only with the overridden values.
+   * @param[in] overridden_values: Values with the section name and the key name (overridden_values[section][key] = value)
+   * @return True when the base file is read and the content is parsed
+   */
+  static bool RegisterInMemoryFile(const std::string& file_path, const std::string& base_file_path,
+                                   const std::map<std::string, std::map<std::string, std::string>>& overridden_values);
+  /**
+   * @fn ClearCache
+   * @brief Clear the parsed ini files shared in the process including the in-memory files
+   * @note Use when an ini file is rewritten within the resolution of the last write time
+   */
+  static void ClearCache();
+
  private:
   static const size_t kMaxCharLength = 1024;
-  std::string file_path_;                //!< File path in string
-  char file_path_char_[kMaxCharLength];  //!< File path in char
-  char text_buffer_[kMaxCharLength];     //!< buffer
-#ifndef WIN32
-  INIReader ini_reader_;  //!< ini ini_reader_
-#endif
+  std::string file_path_;                        //!< File path in string
+  char file_path_char_[kMaxCharLength];          //!< File path in char
+  std::shared_ptr<const INIReader> ini_reader_;  //!< Parsed ini file shared in the process
+
+  /**
+   * @fn GetIniReader
+   * @brief Return the parsed ini file in the cache, or parse and cache it
+   * @param[in] file_path: File path of ini file
+   */
+  static std::shared_ptr<const INIReader> GetIniReader(const std::string& file_path);
+  /**
+   * @fn MakeIndexedKeyName
+   * @brief Make the key name of an element of a vector (e.g. "key(0)")
+   * @param[in] key_name: Key name
+   * @param[in] index: Index of the element
+   */
+  static inline std::string MakeIndexedKeyName(const char* key_name, const size_t index) {
+    return std::string(key_name) + "(" + std::to_string(index) + ")";
+  }
 };
 
 template <size_t NumElement>
 void IniAccess::ReadVector(const char* section_name, const char* key_name, libra::Vector<NumElement>& data) {
   for (size_t i = 0; i < NumElement; i++) {
-    std::stringstream c_name;
-    c_name << key_name << "(" << i << ")";
-    data[i] = ReadDouble(section_name, c_name.str().c_str());
+    data[i] = ReadDouble(section_name, MakeIndexedKeyName(key_name, i).c_str());
   }
 }
 
@@ -0,0 +1,168 @@
+/**
+ * @file numeric_csv_table.cpp
+ * @brief Class to read a numeric table in a CSV file into a contiguous buffer
+ */
+
+#include "numeric_csv_table.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+const size_t kMinimumBlockSize = 64 * 1024;  //!< Minimum size of the block of lines parsed by a thread [byte]
+
+/**
+ * @struct ParsedBlock
+ * @brief Result of the parsing of a block of lines
+ */
+struct ParsedBlock {
+  std::vector<double> values;    //!< Values in the row-major order
+  size_t number_of_rows = 0;     //!< Number of rows
+  size_t number_of_columns = 0;  //!< Number of columns
+  const char* error = nullptr;   //!< Position of the error, nullptr when no error
+  std::string error_message;     //!< Error message
+};
+
+/**
+ * @fn IsSpace
+ * @brief Return true for the white spaces around the values
+ */
+inline bool IsSpace(const char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+/**
+ * @fn ParseBlock
+ * @brief Parse the lines in [begin, end)
+ * @param[in] begin: Beginning of the first line
+ * @param[in] end: End of the block (beginning of the next line or the end of the file)
+ * @param[in] column_header_num: Number of columns of header to be skipped
+ * @param[out] block: Parsed values
+ */
+void ParseBlock(const char* begin, const char* end, const size_t column_header_num, ParsedBlock& block) {
+  for (const char* line = begin; line < end;) {
+    const char* line_end = std::find(line, end, '\n');
+    const char* position = line;
+    while (position < line_end && IsSpace(*position)) position++;
+    if (position == line_end) {
+      // Empty line
+      line = (line_end < end) ? line_end + 1 : end;
+      continue;
+    }
+
+    size_t number_of_values = 0;
+    for (size_t column = 0;; column++) {
+      const char* field_end = std::find(position, line_end, ',');
+      if (column >= column_header_num) {
+        const char* value_begin = position;
+        const char* value_end = field_end;
+        while (value_begin < value_end && IsSpace(*value_begin)) value_begin++;
+        while (value_end > value_begin && IsSpace(*(value_end - 1))) value_end--;
+        if (value_begin < value_end && *value_begin == '+') value_begin++;
+        double value = 0.0;
+        const std::from_chars_result result = std::from_chars(value_begin, value_end, value);
+        if (value_begin == value_end || result.ec != std::errc() || result.ptr != value_end) {
+          block.error = line;
+          block.error_message = "invalid value \"" + std::string(position, field_end) + "\"";
+          return;
+        }
+        block.values.push_back(value);
+        number_of_values++;
+      }
+      if (field_end == line_end) break;
+      position = field_end + 1;
+      // Ignore the delimiter at the end of the line
+      while (position < line_end && IsSpace(*position)) position++;
+      if (position == line_end) break;
+    }
+
+    if (block.number_of_rows == 0) {
+      block.number_of_columns = number_of_values;
+    } else if (number_of_values != block.number_of_columns) {
+      block.error = line;
+      block.error_message = "number of columns " + std::to_string(number_of_values) + " is different from " + std::to_string(block.number_of_columns);
+      return;
+    }
+    block.number_of_rows++;
+    line = (line_end < end) ? line_end + 1 : end;
+  }
+}
+}  // namespace
+
+NumericCsvTable::NumericCsvTable(const size_t number_of_rows, const size_t number_of_columns, const double value)
+    : number_of_rows_(number_of_rows), number_of_columns_(number_of_columns), values_(number_of_rows * number_of_columns, value) {}
+
+NumericCsvTable::NumericCsvTable(const std::string& file_path, const size_t row_header_num, const size_t column_header_num,
+                                 const unsigned int number_of_threads)
+    : number_of_rows_(0), number_of_columns_(0) {
+  // Read the whole file at once
+  std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) throw std::invalid_argument(file_path + std::string(" cannot be opened."));
+  const std::streamsize file_size = file.tellg();
+  std::string buffer((size_t)std::max(file_size, (std::streamsize)0), '\0');
+  file.seekg(0);
+  file.read(&buffer[0], file_size);
+
+  const char* const file_begin = buffer.data();
+  const char* begin = file_begin;
+  const char* end = file_begin + buffer.size();
+  for (size_t line = 0; line < row_header_num && begin < end; line++) {
+    begin = std::find(begin, end, '\n');
+    if (begin < end) begin++;
+  }
+
+  // Split into the blocks of lines
+  size_t number_of_blocks = (number_of_threads == 0) ? std::max(std::thread::hardware_concurrency(), 1u) : number_of_threads;
+  number_of_blocks = std::max(std::min(number_of_blocks, (size_t)(end - begin) / kMinimumBlockSize), (size_t)1);
+  std::vector<const char*> boundaries{begin};
+  for (size_t block = 1; block < number_of_blocks; block++) {
+    const char* boundary = std::max(begin + (end - begin) * block / number_of_blocks, boundaries.back());
+    boundary = std::find(boundary, end, '\n');
+    if (boundary < end) boundary++;
+    boundaries.push_back(boundary);
+  }
+  boundaries.push_back(end);
+
+  // The threads write the separate blocks, so no lock is needed
+  std::vector<ParsedBlock> blocks(number_of_blocks);
+  std::vector<std::thread> threads;
+  for (size_t block = 1; block < number_of_blocks; block++) {
+    threads.emplace_back(ParseBlock, boundaries[block], boundaries[block + 1], column_header_num, std::ref(blocks[block]));
+  }
+  ParseBlock(boundaries[0], boundaries[1], column_header_num, blocks[0]);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Merge the blocks
+  size_t number_of_values = 0;
+  for (const auto& block : blocks) number_of_values += block.values.size();
+  values_.reserve(number_of_values);
+  for (size_t i = 0; i < number_of_blocks; i++) {
+    const ParsedBlock& block = blocks[i];
+    const char* error_position = block.error;
+    std::string error_message = block.error_message;
+    if (error_position == nullptr && block.number_of_rows > 0 && number_of_rows_ > 0 && block.number_of_columns != number_of_columns_) {
+      error_position = boundaries[i];
+      error_message = "number of columns " + std::to_string(block.number_of_columns) + " is different from " + std::to_string(number_of_columns_);
+    }
+    if (error_position != nullptr) {
+      const size_t line_number = (size_t)std::count(file_begin, error_position, '\n') + 1;
+      throw std::invalid_argument(file_path + " line " + std::to_string(line_number) + ": " + error_message);
+    }
+    if (block.number_of_rows == 0) continue;
+    if (number_of_rows_ == 0) number_of_columns_ = block.number_of_columns;
+    number_of_rows_ += block.number_of_rows;
+    values_.insert(values_.end(), block.values.begin(), block.values.end());
+  }
+}
+
+std::vector<std::vector<double>> NumericCsvTable::ConvertToNestedVector() const {
+  std::vector<std::vector<double>> nested_vector;
+  nested_vector.reserve(number_of_rows_);
+  for (size_t row = 0; row < number_of_rows_; row++) {
+    nested_vector.emplace_back(GetRow(row), GetRow(row) + number_of_columns_);
+  }
+  return nested_vector;
+}
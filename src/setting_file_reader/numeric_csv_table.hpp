@@ -0,0 +1,82 @@
+/**
+ * @file numeric_csv_table.hpp
+ * @brief Class to read a numeric table in a CSV file into a contiguous buffer
+ */
+
+#ifndef S2E_LIBRARY_INITIALIZE_NUMERIC_CSV_TABLE_HPP_
+#define S2E_LIBRARY_INITIALIZE_NUMERIC_CSV_TABLE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class NumericCsvTable
+ * @brief Numeric table in a CSV file stored in one row-major buffer
+ * @details The whole file is read at once and the values are parsed with std::from_chars without the intermediate strings.
+ *          Large files can be parsed by several threads which handle the separate blocks of lines.
+ * @note All rows must have the same number of columns. Empty lines are skipped.
+ */
+class NumericCsvTable {
+ public:
+  /**
+   * @fn NumericCsvTable
+   * @brief Constructor of the table filled with the value
+   * @param[in] number_of_rows: Number of rows
+   * @param[in] number_of_columns: Number of columns
+   * @param[in] value: Initial value of all elements
+   */
+  NumericCsvTable(const size_t number_of_rows = 0, const size_t number_of_columns = 0, const double value = 0.0);
+  /**
+   * @fn NumericCsvTable
+   * @brief Constructor to read the CSV file
+   * @note Throws std::invalid_argument when the file cannot be opened or has non-numeric values or rows with the different number of columns
+   * @param[in] file_path: File path of the CSV file
+   * @param[in] row_header_num: Number of rows of header to be skipped
+   * @param[in] column_header_num: Number of columns of header to be skipped
+   * @param[in] number_of_threads: Number of threads to parse the file. 0 means the number of hardware threads.
+   */
+  NumericCsvTable(const std::string& file_path, const size_t row_header_num, const size_t column_header_num = 0,
+                  const unsigned int number_of_threads = 1);
+
+  /**
+   * @fn GetNumberOfRows
+   * @brief Return number of rows
+   */
+  inline size_t GetNumberOfRows() const { return number_of_rows_; }
+  /**
+   * @fn GetNumberOfColumns
+   * @brief Return number of columns
+   */
+  inline size_t GetNumberOfColumns() const { return number_of_columns_; }
+  /**
+   * @fn GetValue
+   * @brief Return the value without range check
+   * @param[in] row: Row index
+   * @param[in] column: Column index
+   */
+  inline double GetValue(const size_t row, const size_t column) const { return values_[row * number_of_columns_ + column]; }
+  /**
+   * @fn GetRow
+   * @brief Return the pointer to the first value of the row
+   * @param[in] row: Row index
+   */
+  inline const double* GetRow(const size_t row) const { return values_.data() + row * number_of_columns_; }
+  /**
+   * @fn GetValues
+   * @brief Return all values in the row-major order
+   */
+  inline const std::vector<double>& GetValues() const { return values_; }
+  /**
+   * @fn ConvertToNestedVector
+   * @brief Return the values as the vector of rows
+   */
+  std::vector<std::vector<double>> ConvertToNestedVector() const;
+
+ private:
+  size_t number_of_rows_;       //!< Number of rows
+  size_t number_of_columns_;    //!< Number of columns
+  std::vector<double> values_;  //!< Values in the row-major order
+};
+
+#endif  // S2E_LIBRARY_INITIALIZE_NUMERIC_CSV_TABLE_HPP_
@@ -0,0 +1,109 @@
+/**
+ * @file test_initialize_file_access.cpp
+ * @brief Test codes for IniAccess class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "initialize_file_access.hpp"
+
+namespace {
+/**
+ * @fn WriteFile
+ * @brief Write the text to a file
+ */
+void WriteFile(const std::string& file_path, const std::string& text) {
+  std::ofstream file(file_path, std::ios::binary);
+  file << text;
+}
+}  // namespace
+
+/**
+ * @brief Test for the parse cache and its invalidation with the last write time
+ */
+TEST(IniAccess, ParseCache) {
+  const std::string file_path = "test_initialize_file_access_cache.ini";
+  WriteFile(file_path, "[SECTION]\nvalue = 1.5\n");
+  const std::filesystem::file_time_type first_write_time = std::filesystem::last_write_time(file_path);
+  EXPECT_DOUBLE_EQ(1.5, IniAccess(file_path).ReadDouble("SECTION", "value"));
+
+  // The cached values are used while the last write time is the same
+  WriteFile(file_path, "[SECTION]\nvalue = 2.5\n");
+  std::filesystem::last_write_time(file_path, first_write_time);
+  EXPECT_DOUBLE_EQ(1.5, IniAccess(file_path).ReadDouble("SECTION", "value"));
+
+  // The file is parsed again when the last write time is changed
+  std::filesystem::last_write_time(file_path, first_write_time + std::chrono::seconds(2));
+  EXPECT_DOUBLE_EQ(2.5, IniAccess(file_path).ReadDouble("SECTION", "value"));
+
+  // The file is parsed again after the explicit clear
+  WriteFile(file_path, "[SECTION]\nvalue = 3.5\n");
+  std::filesystem::last_write_time(file_path, first_write_time + std::chrono::seconds(2));
+  EXPECT_DOUBLE_EQ(2.5, IniAccess(file_path).ReadDouble("SECTION", "value"));
+  IniAccess::ClearCache();
+  EXPECT_DOUBLE_EQ(3.5, IniAccess(file_path).ReadDouble("SECTION", "value"));
+
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for the values read through the shared parsed file
+ */
+TEST(IniAccess, ReadValues) {
+  const std::string file_path = "test_initialize_file_access_values.ini";
+  WriteFile(file_path, "[SECTION]\nvector(0) = 1.0\nvector(1) = -2.0 ; comment\nvector(2) = 3.0e-1\nflag = ENABLE\nnumber = 7\n");
+  IniAccess first_access(file_path);
+  IniAccess second_access(file_path);
+
+  libra::Vector<3> vector;
+  second_access.ReadVector("SECTION", "vector", vector);
+  EXPECT_DOUBLE_EQ(1.0, vector[0]);
+  EXPECT_DOUBLE_EQ(-2.0, vector[1]);
+  EXPECT_DOUBLE_EQ(0.3, vector[2]);
+  EXPECT_TRUE(first_access.ReadEnable("SECTION", "flag"));
+  EXPECT_EQ(7, first_access.ReadInt("SECTION", "number"));
+
+  std::remove(file_path.c_str());
+  IniAccess::ClearCache();
+}
+
+/**
+ * @brief Test for the in-memory file made of the base file and the overridden values
+ */
+TEST(IniAccess, RegisterInMemoryFile) {
+  const std::string base_file_path = "test_initialize_file_access_base.ini";
+  WriteFile(base_file_path, "[SECTION]\n// value = 0.0\nValue = 1.5 ; comment\nother = 2\n\n[Next_Section]\nname = base\n");
+
+  // The existing keys are replaced without the case, and the new keys and sections are added
+  const std::string file_path = "test_initialize_file_access_memory.ini";
+  ASSERT_TRUE(IniAccess::RegisterInMemoryFile(
+      file_path, base_file_path, {{"section", {{"VALUE", "-3.5"}, {"added", "4"}}}, {"NEW_SECTION", {{"flag", "ENABLE"}}}, {"next_section", {}}}));
+  IniAccess memory_access(file_path);
+  EXPECT_DOUBLE_EQ(-3.5, memory_access.ReadDouble("SECTION", "value"));
+  EXPECT_EQ(2, memory_access.ReadInt("SECTION", "other"));
+  EXPECT_EQ(4, memory_access.ReadInt("SECTION", "added"));
+  EXPECT_EQ("base", memory_access.ReadString("Next_Section", "name"));
+  EXPECT_TRUE(memory_access.ReadEnable("NEW_SECTION", "flag"));
+  // The in-memory file does not exist in the file system
+  EXPECT_FALSE(std::filesystem::exists(file_path));
+
+  // The base file itself is overridden until the cache is cleared
+  ASSERT_TRUE(IniAccess::RegisterInMemoryFile(base_file_path, base_file_path, {{"SECTION", {{"other", "5"}}}}));
+  EXPECT_EQ(5, IniAccess(base_file_path).ReadInt("SECTION", "other"));
+  EXPECT_DOUBLE_EQ(1.5, IniAccess(base_file_path).ReadDouble("SECTION", "value"));
+  IniAccess::ClearCache();
+  EXPECT_EQ(2, IniAccess(base_file_path).ReadInt("SECTION", "other"));
+
+  // The content is made only of the overridden values without the base file
+  ASSERT_TRUE(IniAccess::RegisterInMemoryFile(file_path, "", {{"SECTION", {{"value", "7.5"}}}}));
+  EXPECT_DOUBLE_EQ(7.5, IniAccess(file_path).ReadDouble("SECTION", "value"));
+  EXPECT_FALSE(IniAccess::RegisterInMemoryFile(file_path, "test_initialize_file_access_missing.ini", {}));
+
+  std::remove(base_file_path.c_str());
+  IniAccess::ClearCache();
+}
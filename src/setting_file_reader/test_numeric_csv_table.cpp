@@ -0,0 +1,145 @@
+/**
+ * @file test_numeric_csv_table.cpp
+ * @brief Test codes for NumericCsvTable class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+#include "initialize_file_access.hpp"
+#include "numeric_csv_table.hpp"
+
+namespace {
+/**
+ * @fn WriteFile
+ * @brief Write the text to a file
+ */
+void WriteFile(const std::string& file_path, const std::string& text) {
+  std::ofstream file(file_path, std::ios::binary);
+  file << text;
+}
+
+/**
+ * @fn IsBitIdentical
+ * @brief Return true when the bit patterns of the values are the same
+ */
+bool IsBitIdentical(const double a, const double b) { return std::memcmp(&a, &b, sizeof(double)) == 0; }
+}  // namespace
+
+/**
+ * @brief Test for the header rows and columns
+ */
+TEST(NumericCsvTable, Header) {
+  const std::string file_path = "test_numeric_csv_table_header.csv";
+  WriteFile(file_path, "name,a,b,c\nx,1.0,2.0,3.0\ny,-4.5, +5e-3 ,6\r\n");
+  const NumericCsvTable table(file_path, 1, 1);
+  std::remove(file_path.c_str());
+
+  ASSERT_EQ(2, table.GetNumberOfRows());
+  ASSERT_EQ(3, table.GetNumberOfColumns());
+  EXPECT_DOUBLE_EQ(1.0, table.GetValue(0, 0));
+  EXPECT_DOUBLE_EQ(3.0, table.GetValue(0, 2));
+  EXPECT_DOUBLE_EQ(-4.5, table.GetValue(1, 0));
+  EXPECT_DOUBLE_EQ(5e-3, table.GetValue(1, 1));
+  EXPECT_DOUBLE_EQ(6.0, table.GetValue(1, 2));
+
+  EXPECT_THROW(NumericCsvTable("test_numeric_csv_table_not_found.csv", 0), std::invalid_argument);
+}
+
+/**
+ * @brief Test for the empty lines and the ragged rows
+ */
+TEST(NumericCsvTable, EmptyAndRaggedRows) {
+  const std::string file_path = "test_numeric_csv_table_rows.csv";
+
+  // Empty lines are skipped
+  WriteFile(file_path, "1,2,\n\n3,4\n \t\r\n5,6\n\n");
+  const NumericCsvTable table(file_path, 0);
+  ASSERT_EQ(3, table.GetNumberOfRows());
+  ASSERT_EQ(2, table.GetNumberOfColumns());
+  EXPECT_DOUBLE_EQ(4.0, table.GetValue(1, 1));
+  EXPECT_DOUBLE_EQ(5.0, table.GetValue(2, 0));
+
+  // Ragged rows and non-numeric values
+  WriteFile(file_path, "1,2\n3\n");
+  EXPECT_THROW(NumericCsvTable(file_path, 0), std::invalid_argument);
+  WriteFile(file_path, "1,2\n3,4,5\n");
+  EXPECT_THROW(NumericCsvTable(file_path, 0), std::invalid_argument);
+  WriteFile(file_path, "1,2\n3,abc\n");
+  EXPECT_THROW(NumericCsvTable(file_path, 0), std::invalid_argument);
+  WriteFile(file_path, "1,,2\n");
+  EXPECT_THROW(NumericCsvTable(file_path, 0), std::invalid_argument);
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for the parsing by several threads against std::stod
+ */
+TEST(NumericCsvTable, ThreadSplit) {
+  const std::string file_path = "test_numeric_csv_table_threads.csv";
+  const size_t number_of_rows = 5000;
+  const size_t number_of_columns = 8;
+
+  // About 800 kB to make several blocks
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+  std::uniform_int_distribution<int> exponent(-30, 30);
+  std::vector<std::string> fields;
+  std::string text = "header\n";
+  char field[64];
+  for (size_t row = 0; row < number_of_rows; row++) {
+    for (size_t column = 0; column < number_of_columns; column++) {
+      snprintf(field, sizeof(field), "%.17g", mantissa(generator) * pow(10.0, exponent(generator)));
+      fields.push_back(field);
+      text += (column == 0 ? "" : ",") + fields.back();
+    }
+    text += (row % 1000 == 999) ? "\n\n" : "\n";
+  }
+  WriteFile(file_path, text);
+
+  const NumericCsvTable single_thread_table(file_path, 1, 0, 1);
+  const NumericCsvTable multi_thread_table(file_path, 1, 0, 4);
+  ASSERT_EQ(number_of_rows, single_thread_table.GetNumberOfRows());
+  ASSERT_EQ(number_of_columns, single_thread_table.GetNumberOfColumns());
+  ASSERT_EQ(number_of_rows, multi_thread_table.GetNumberOfRows());
+  ASSERT_EQ(number_of_columns, multi_thread_table.GetNumberOfColumns());
+
+  size_t number_of_mismatches = 0;
+  for (size_t row = 0; row < number_of_rows; row++) {
+    for (size_t column = 0; column < number_of_columns; column++) {
+      const double expected = std::stod(fields[row * number_of_columns + column]);
+      if (!IsBitIdentical(expected, single_thread_table.GetValue(row, column))) number_of_mismatches++;
+      if (!IsBitIdentical(expected, multi_thread_table.GetValue(row, column))) number_of_mismatches++;
+    }
+  }
+  EXPECT_EQ(0, number_of_mismatches);
+
+  // A ragged row in the last block is detected by the thread of the block
+  WriteFile(file_path, text + "1,2\n");
+  EXPECT_THROW(NumericCsvTable(file_path, 1, 0, 4), std::invalid_argument);
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for the CSV reading functions of IniAccess
+ */
+TEST(NumericCsvTable, IniAccessReadCsvDouble) {
+  const std::string file_path = "test_numeric_csv_table_ini_access.csv";
+  WriteFile(file_path, "id,a,b\n0,1.5,2.5\n1,3.5,4.5\n");
+  IniAccess csv_file(file_path);
+
+  // The rows are appended to the output
+  std::vector<std::vector<double>> values{{-1.0}};
+  csv_file.ReadCsvDoubleWithHeader(values, 2, 1, 1);
+  ASSERT_EQ(3, values.size());
+  EXPECT_DOUBLE_EQ(-1.0, values[0][0]);
+  ASSERT_EQ(2, values[2].size());
+  EXPECT_DOUBLE_EQ(3.5, values[2][0]);
+  EXPECT_DOUBLE_EQ(4.5, values[2][1]);
+  std::remove(file_path.c_str());
+}
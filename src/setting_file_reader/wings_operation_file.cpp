@@ -6,6 +6,7 @@
 #include "wings_operation_file.hpp"
 
 #include <iostream>
+#include <sstream>
 
 WingsOperationFile::WingsOperationFile(const std::string file_path) {
   // File open
@@ -45,3 +46,83 @@ std::string WingsOperationFile::GetLatestLine() {
 
   return line;
 }
+
+void WingsOperationFile::Precompile(const C2aCommandDatabase& command_database) {
+  operations_.clear();
+  operations_.reserve(lines_.size());
+  for (const auto& line : lines_) {
+    operations_.push_back(CompileLine(line, command_database));
+  }
+  operation_pointer_ = 0;
+}
+
+const WingsOperation* WingsOperationFile::GetNextOperation() {
+  if (operation_pointer_ >= operations_.size()) return nullptr;
+  return &operations_[operation_pointer_++];
+}
+
+WingsOperation WingsOperationFile::CompileLine(const std::string& line, const C2aCommandDatabase& command_database) {
+  WingsOperation operation;
+
+  // Separate with space
+  std::istringstream token_stream(line);
+  std::string token;
+  std::vector<std::string> tokens;
+  while (token_stream >> token) {
+    tokens.push_back(token);
+  }
+  if (tokens.empty()) return operation;
+
+  // Handle WINGS commands
+  if (tokens[0].find("wait_sec") == 0) {
+    operation.type = WingsOperationType::kWait;
+    operation.wait_s = std::stod(tokens[1]);
+    return operation;
+  } else if (tokens[0].find("check_value") == 0 || tokens[0].find("let") == 0) {
+    // TODO: Support check_value and let command
+    return operation;
+  }
+
+  // Recognize C2A command: <target>_<command type>.<command name>
+  size_t first_underscore_position = tokens[0].find('_');
+  if (first_underscore_position == std::string::npos) return operation;
+  size_t first_dot_position = tokens[0].find('.');
+  std::string command_type = tokens[0].substr(first_underscore_position + 1, first_dot_position - (first_underscore_position + 1));
+  std::string command_name = tokens[0].substr(first_dot_position + 1);
+
+  // Get command code
+  C2aCommandInformation cmd_info = command_database.GetCommandInformation(command_name);
+  if (cmd_info.GetCommandName() == "Error") {
+    std::cerr << "WINGS Operation file: command " << command_name << " is not found in the C2A command database." << std::endl;
+  }
+  operation.command_id = cmd_info.GetCommandId();
+
+  // Get arguments
+  std::vector<std::string> arguments;
+  for (size_t i = 1; i < tokens.size(); i++) {
+    if (tokens[i].find("{") == 0) return operation;  // let command is not supported now TODO: support let command
+    arguments.push_back(tokens[i]);
+  }
+
+  // Read TI
+  if (command_type == "TL" || command_type == "BL") {
+    if (arguments.empty()) return operation;
+    operation.time_indicator = (uint32_t)std::stoi(arguments[0]);
+    arguments.erase(arguments.begin());
+  }
+  // Encode arguments
+  for (size_t arg_num = 0; arg_num < arguments.size(); arg_num++) {
+    uint8_t param[8];  // Maximum size of the argument types
+    size_t len = 0;
+    DecodeC2aCommandArgument(cmd_info.GetArgumentType(arg_num), arguments[arg_num], param, len);
+    operation.parameters.insert(operation.parameters.end(), param, param + len);
+  }
+
+  if (command_type == "RT") {
+    operation.type = WingsOperationType::kRealTimeCommand;
+  } else if (command_type == "TL") {
+    operation.type = WingsOperationType::kTimeLineCommand;
+  }
+  // TODO: Support BL command
+  return operation;
+}
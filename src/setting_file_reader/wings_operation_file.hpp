@@ -11,6 +11,29 @@
 
 #include "c2a_command_database.hpp"
 
+/**
+ * @enum WingsOperationType
+ * @brief Type of a line in the WINGS operation file
+ */
+enum class WingsOperationType {
+  kWait,             //!< wait_sec
+  kRealTimeCommand,  //!< Real time command (RT)
+  kTimeLineCommand,  //!< Time line command (TL)
+  kNoOperation,      //!< Unsupported lines (check_value, let, BL command, etc.)
+};
+
+/**
+ * @struct WingsOperation
+ * @brief Line of the WINGS operation file precompiled with the command database
+ */
+struct WingsOperation {
+  WingsOperationType type = WingsOperationType::kNoOperation;  //!< Type of the line
+  double wait_s = 0.0;                                         //!< Wait time of wait_sec [s]
+  size_t command_id = 0;                                       //!< Command ID (code) of the C2A command
+  uint32_t time_indicator = 0;                                 //!< Time indicator of the time line command
+  std::vector<uint8_t> parameters;                             //!< Encoded parameters of the C2A command
+};
+
 /**
  * @class WingsOperationFile
  * @brief A class to handle WINGS operation file
@@ -30,9 +53,38 @@ class WingsOperationFile {
    */
   std::string GetLatestLine();
 
+  /**
+   * @fn Precompile
+   * @brief Resolve the command names to the command IDs and encode the parameters of all lines
+   * @note The command names are looked up only here, so the precompiled operations can be dispatched without the text parsing.
+   * @param[in] command_database: C2A command database
+   */
+  void Precompile(const C2aCommandDatabase& command_database);
+  /**
+   * @fn GetNextOperation
+   * @brief Return next precompiled operation, or nullptr at the end of the operations
+   */
+  const WingsOperation* GetNextOperation();
+  /**
+   * @fn GetNumberOfOperations
+   * @brief Return number of the precompiled operations
+   */
+  inline size_t GetNumberOfOperations() const { return operations_.size(); }
+
  private:
   std::vector<std::string> lines_;  //!!< List of read operation command line
   size_t line_pointer_ = 0;         //!< Line pointer
+
+  std::vector<WingsOperation> operations_;  //!< Precompiled operations in the order of the lines
+  size_t operation_pointer_ = 0;            //!< Operation pointer
+
+  /**
+   * @fn CompileLine
+   * @brief Compile a line of the operation file
+   * @param[in] line: Line of the operation file
+   * @param[in] command_database: C2A command database
+   */
+  static WingsOperation CompileLine(const std::string& line, const C2aCommandDatabase& command_database);
 };
 
 #endif  // S2E_LIBRARY_INITIALIZE_WINGS_OPERATION_FILE_HPP_
@@ -0,0 +1,77 @@
+/**
+ * @file environment_replay.cpp
+ * @brief Record and replay of the environment and dynamics outputs for the component-only simulation
+ */
+
+#include "environment_replay.hpp"
+
+#include <stdexcept>
+
+namespace {
+const char* kReplayFileTag = "S2E_ENVIRONMENT_REPLAY";  //!< Tag at the beginning of the record file
+const uint32_t kReplayVersion = 1;                      //!< Version of the record format
+}  // namespace
+
+EnvironmentReplay::EnvironmentReplay(const Mode mode, const std::string& file_path, const size_t number_of_spacecraft) : mode_(mode) {
+  const std::ios::openmode open_mode = IsRecording() ? std::ios::out | std::ios::binary : std::ios::in | std::ios::binary;
+  file_.open(file_path, open_mode);
+  if (!file_.is_open()) throw std::invalid_argument("Environment replay file " + file_path + " cannot be opened.");
+
+  if (IsRecording()) {
+    SnapshotWriter header(file_);
+    header.WriteTag(kReplayFileTag);
+    header.Write(kReplayVersion);
+    header.Write((uint64_t)number_of_spacecraft);
+  } else {
+    SnapshotReader header(file_);
+    header.ReadTag(kReplayFileTag);
+    uint32_t version;
+    header.Read(version);
+    if (version != kReplayVersion)
+      throw std::invalid_argument("Environment replay file has the unsupported version " + std::to_string(version) + ".");
+    uint64_t recorded_number_of_spacecraft;
+    header.Read(recorded_number_of_spacecraft);
+    if (recorded_number_of_spacecraft != number_of_spacecraft) {
+      throw std::invalid_argument("Environment replay file is recorded with " + std::to_string(recorded_number_of_spacecraft) + " spacecraft, but " +
+                                  std::to_string(number_of_spacecraft) + " spacecraft are simulated.");
+    }
+  }
+
+  for (size_t i = 0; i < number_of_spacecraft + 1; i++) {
+    frames_.emplace_back(new std::stringstream(std::ios::in | std::ios::out | std::ios::binary));
+    writers_.emplace_back(new SnapshotWriter(*frames_.back()));
+    readers_.emplace_back(new SnapshotReader(*frames_.back()));
+  }
+}
+
+SnapshotWriter& EnvironmentReplay::GetSpacecraftWriter(const size_t spacecraft_id) { return *writers_[GetFrameIndex(spacecraft_id)]; }
+
+SnapshotReader& EnvironmentReplay::GetSpacecraftReader(const size_t spacecraft_id) { return *readers_[GetFrameIndex(spacecraft_id)]; }
+
+void EnvironmentReplay::WriteStep() {
+  SnapshotWriter step(file_);
+  for (auto& frame : frames_) {
+    step.Write(frame->str());
+    frame->str("");
+    frame->clear();
+  }
+}
+
+void EnvironmentReplay::ReadStep() {
+  if (file_.peek() == std::char_traits<char>::eof()) {
+    throw std::invalid_argument("Environment replay file ends before the end of the simulation. The end time must be the same as the record.");
+  }
+  SnapshotReader step(file_);
+  for (auto& frame : frames_) {
+    step.Read(frame_data_);
+    frame->str(frame_data_);
+    frame->clear();
+  }
+}
+
+size_t EnvironmentReplay::GetFrameIndex(const size_t spacecraft_id) const {
+  if (spacecraft_id + 1 >= frames_.size()) {
+    throw std::invalid_argument("Spacecraft " + std::to_string(spacecraft_id) + " is out of the spacecraft of the environment replay.");
+  }
+  return spacecraft_id + 1;
+}
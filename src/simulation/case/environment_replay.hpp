@@ -0,0 +1,106 @@
+/**
+ * @file environment_replay.hpp
+ * @brief Record and replay of the environment and dynamics outputs for the component-only simulation
+ */
+
+#ifndef S2E_SIMULATION_CASE_ENVIRONMENT_REPLAY_HPP_
+#define S2E_SIMULATION_CASE_ENVIRONMENT_REPLAY_HPP_
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utilities/snapshot.hpp>
+#include <vector>
+
+/**
+ * @class EnvironmentReplay
+ * @brief Record and replay of the environment and dynamics outputs for the component-only simulation
+ * @details In the record mode, the global environment and each spacecraft write the updated states of every step (celestial information,
+ *          dynamics, and local environment) to their frames, and the frames are appended to the file at the end of the step. In the replay
+ *          mode, the frames are read at the beginning of each step and restored instead of the calculation of the physics, so only the
+ *          components and the flight software are executed. The dynamics are not changed by the actuators in the replay (open loop).
+ * @note The frames of the spacecraft are separated, so the spacecraft can be recorded and replayed in the concurrent update.
+ *       The file is the native binary as the snapshot, and replayed only by the same build with the same time and spacecraft settings.
+ */
+class EnvironmentReplay {
+ public:
+  /**
+   * @enum Mode
+   * @brief Mode of the environment replay
+   */
+  enum class Mode {
+    kRecord,  //!< Record the frames to the file
+    kReplay,  //!< Replay the frames in the file
+  };
+
+  /**
+   * @fn EnvironmentReplay
+   * @brief Constructor. Open the file. Throws std::invalid_argument when the file cannot be opened or does not match the setting.
+   * @param [in] mode: Mode
+   * @param [in] file_path: Path to the record file
+   * @param [in] number_of_spacecraft: Number of the spacecraft. The ID of the spacecraft must be less than this number.
+   */
+  EnvironmentReplay(const Mode mode, const std::string& file_path, const size_t number_of_spacecraft);
+
+  /**
+   * @fn IsRecording
+   * @brief Return true in the record mode
+   */
+  inline bool IsRecording() const { return mode_ == Mode::kRecord; }
+  /**
+   * @fn IsReplaying
+   * @brief Return true in the replay mode
+   */
+  inline bool IsReplaying() const { return mode_ == Mode::kReplay; }
+
+  /**
+   * @fn GetGlobalEnvironmentWriter
+   * @brief Return the writer of the global environment frame of the current step (record mode)
+   */
+  inline SnapshotWriter& GetGlobalEnvironmentWriter() { return *writers_[0]; }
+  /**
+   * @fn GetSpacecraftWriter
+   * @brief Return the writer of the spacecraft frame of the current step (record mode)
+   * @param [in] spacecraft_id: ID of the spacecraft
+   */
+  SnapshotWriter& GetSpacecraftWriter(const size_t spacecraft_id);
+  /**
+   * @fn WriteStep
+   * @brief Append the frames of the current step to the file and clear them (record mode)
+   */
+  void WriteStep();
+
+  /**
+   * @fn ReadStep
+   * @brief Read the frames of the next step from the file (replay mode). Throws std::invalid_argument at the end of the file.
+   */
+  void ReadStep();
+  /**
+   * @fn GetGlobalEnvironmentReader
+   * @brief Return the reader of the global environment frame of the current step (replay mode)
+   */
+  inline SnapshotReader& GetGlobalEnvironmentReader() { return *readers_[0]; }
+  /**
+   * @fn GetSpacecraftReader
+   * @brief Return the reader of the spacecraft frame of the current step (replay mode)
+   * @param [in] spacecraft_id: ID of the spacecraft
+   */
+  SnapshotReader& GetSpacecraftReader(const size_t spacecraft_id);
+
+ private:
+  Mode mode_;                                               //!< Mode
+  std::fstream file_;                                       //!< Record file
+  std::vector<std::unique_ptr<std::stringstream>> frames_;  //!< Frames of the current step. 0 is the global environment, i + 1 is the spacecraft i.
+  std::vector<std::unique_ptr<SnapshotWriter>> writers_;    //!< Writers of the frames
+  std::vector<std::unique_ptr<SnapshotReader>> readers_;    //!< Readers of the frames
+  std::string frame_data_;                                  //!< Buffer to move the frame between the file and the frame stream
+
+  /**
+   * @fn GetFrameIndex
+   * @brief Return the index of the frame of the spacecraft. Throws std::invalid_argument when the ID is out of range.
+   */
+  size_t GetFrameIndex(const size_t spacecraft_id) const;
+};
+
+#endif  // S2E_SIMULATION_CASE_ENVIRONMENT_REPLAY_HPP_
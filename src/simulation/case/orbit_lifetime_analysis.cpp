@@ -0,0 +1,235 @@
+/**
+ * @file orbit_lifetime_analysis.cpp
+ * @brief Fast orbit lifetime analysis with the orbit-averaged air drag and the adaptive step width
+ */
+
+#include "orbit_lifetime_analysis.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <math_physics/math/constants.hpp>
+#include <math_physics/math/matrix_vector.hpp>
+#include <math_physics/math/s2e_math.hpp>
+#include <math_physics/orbit/kepler_orbit.hpp>
+#include <math_physics/orbit/sgp4/sgp4ext.h>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
+
+namespace {
+const double kDay_s = 24.0 * 60.0 * 60.0;  //!< Seconds of a day [s]
+
+/**
+ * @fn CalcSunDirection_i
+ * @brief Calculate the sun direction with the low precision formula of the Astronomical Almanac
+ * @param [in] time_jd: Julian day [day]
+ * @return Unit vector from the Earth to the sun in the inertial frame
+ */
+libra::Vector<3> CalcSunDirection_i(const double time_jd) {
+  const double days_from_j2000 = time_jd - 2451545.0;
+  const double mean_longitude_rad = (280.460 + 0.9856474 * days_from_j2000) * libra::deg_to_rad;
+  const double mean_anomaly_rad = (357.528 + 0.9856003 * days_from_j2000) * libra::deg_to_rad;
+  const double ecliptic_longitude_rad =
+      mean_longitude_rad + (1.915 * sin(mean_anomaly_rad) + 0.020 * sin(2.0 * mean_anomaly_rad)) * libra::deg_to_rad;
+  const double obliquity_rad = (23.439 - 0.0000004 * days_from_j2000) * libra::deg_to_rad;
+
+  libra::Vector<3> sun_direction_i;
+  sun_direction_i[0] = cos(ecliptic_longitude_rad);
+  sun_direction_i[1] = cos(obliquity_rad) * sin(ecliptic_longitude_rad);
+  sun_direction_i[2] = sin(obliquity_rad) * sin(ecliptic_longitude_rad);
+  return sun_direction_i;
+}
+}  // namespace
+
+OrbitLifetimeAnalysis::OrbitLifetimeAnalysis(const OrbitLifetimeSettings& settings, const Atmosphere& atmosphere, const double gravity_constant_m3_s2,
+                                             const double start_time_jd, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s)
+    : settings_(settings),
+      atmosphere_(atmosphere),
+      earth_rotation_(EarthRotationMode::kSimple),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      start_time_jd_(start_time_jd) {
+  if (settings_.number_of_orbit_samples == 0) settings_.number_of_orbit_samples = 1;
+  settings_.minimum_step_s = std::max(settings_.minimum_step_s, 1.0);
+  settings_.maximum_step_s = std::max(settings_.maximum_step_s, settings_.minimum_step_s);
+
+  OrbitalElements oe(gravity_constant_m3_s2_, start_time_jd_, position_i_m, velocity_i_m_s);
+  semi_major_axis_m_ = oe.GetSemiMajorAxis_m();
+  eccentricity_ = oe.GetEccentricity();
+  inclination_rad_ = oe.GetInclination_rad();
+  raan_rad_ = oe.GetRaan_rad();
+  arg_perigee_rad_ = oe.GetArgPerigee_rad();
+
+  is_reentered_ = CalcPerigeeAltitude_m(semi_major_axis_m_, eccentricity_) <= settings_.reentry_altitude_m;
+  AddSample(is_reentered_ ? 0.0 : CalcDecayRates(0.0, semi_major_axis_m_, eccentricity_).averaged_air_density_kg_m3);
+}
+
+bool OrbitLifetimeAnalysis::Step() {
+  if (IsFinished()) return false;
+
+  // Step width from the decay rate of the perigee altitude at the step start
+  const DecayRates start_rates = CalcDecayRates(elapsed_time_s_, semi_major_axis_m_, eccentricity_);
+  const double perigee_altitude_m = CalcPerigeeAltitude_m(semi_major_axis_m_, eccentricity_);
+  const double perigee_altitude_rate_m_s =
+      start_rates.semi_major_axis_m_s * (1.0 - eccentricity_) - semi_major_axis_m_ * start_rates.eccentricity_1_s;
+  double step_s = settings_.maximum_step_s;
+  if (perigee_altitude_rate_m_s < 0.0) {
+    step_s = settings_.maximum_decay_ratio * (perigee_altitude_m - settings_.reentry_altitude_m) / (-perigee_altitude_rate_m_s);
+  }
+  step_s = std::min(std::max(step_s, settings_.minimum_step_s), settings_.maximum_step_s);
+  step_s = std::min(step_s, settings_.maximum_duration_s - elapsed_time_s_);
+
+  // Midpoint method for the decay
+  const double middle_semi_major_axis_m = semi_major_axis_m_ + 0.5 * step_s * start_rates.semi_major_axis_m_s;
+  const double middle_eccentricity = std::max(0.0, eccentricity_ + 0.5 * step_s * start_rates.eccentricity_1_s);
+  const DecayRates middle_rates = CalcDecayRates(elapsed_time_s_ + 0.5 * step_s, middle_semi_major_axis_m, middle_eccentricity);
+
+  // Secular J2 rates (Ref: Vallado, Fundamentals of Astrodynamics and Applications, Section 9.6)
+  const double n_rad_s = sqrt(gravity_constant_m3_s2_ / pow(middle_semi_major_axis_m, 3.0));
+  const double semi_latus_rectum_m = middle_semi_major_axis_m * (1.0 - middle_eccentricity * middle_eccentricity);
+  const double radius_ratio = environment::earth_equatorial_radius_m / semi_latus_rectum_m;
+  const double k_rad_s = 1.5 * environment::earth_j2 * radius_ratio * radius_ratio * n_rad_s;
+  const double cos_i = cos(inclination_rad_);
+  raan_rad_ = libra::WrapTo2Pi(raan_rad_ - k_rad_s * cos_i * step_s);
+  arg_perigee_rad_ = libra::WrapTo2Pi(arg_perigee_rad_ + 0.5 * k_rad_s * (5.0 * cos_i * cos_i - 1.0) * step_s);
+
+  const double next_semi_major_axis_m = semi_major_axis_m_ + step_s * middle_rates.semi_major_axis_m_s;
+  const double next_eccentricity = std::max(0.0, eccentricity_ + step_s * middle_rates.eccentricity_1_s);
+  const double next_perigee_altitude_m = CalcPerigeeAltitude_m(next_semi_major_axis_m, next_eccentricity);
+  if (next_perigee_altitude_m <= settings_.reentry_altitude_m) {
+    // Reentry time with the linear interpolation of the perigee altitude in the step
+    const double ratio = (perigee_altitude_m - settings_.reentry_altitude_m) / (perigee_altitude_m - next_perigee_altitude_m);
+    step_s *= ratio;
+    semi_major_axis_m_ += ratio * (next_semi_major_axis_m - semi_major_axis_m_);
+    eccentricity_ += ratio * (next_eccentricity - eccentricity_);
+    is_reentered_ = true;
+  } else {
+    semi_major_axis_m_ = next_semi_major_axis_m;
+    eccentricity_ = next_eccentricity;
+  }
+  elapsed_time_s_ += step_s;
+  number_of_steps_++;
+
+  AddSample(middle_rates.averaged_air_density_kg_m3);
+  return true;
+}
+
+void OrbitLifetimeAnalysis::Run() {
+  while (Step()) {
+  }
+}
+
+bool OrbitLifetimeAnalysis::WriteDecayCurve(const std::string file_path) const {
+  std::ofstream file(file_path);
+  if (!file.is_open()) {
+    std::cerr << "[ERROR] Orbit lifetime analysis: the decay curve file " << file_path << " cannot be opened." << std::endl;
+    return false;
+  }
+
+  file << "elapsed_time_s,elapsed_time_day,semi_major_axis_m,eccentricity,perigee_altitude_m,apogee_altitude_m,averaged_air_density_kg_m3"
+       << std::endl;
+  for (const auto& sample : decay_curve_) {
+    file << std::fixed << std::setprecision(3) << sample.elapsed_time_s << "," << std::setprecision(6) << sample.elapsed_time_s / kDay_s << ",";
+    file << std::setprecision(3) << sample.semi_major_axis_m << "," << std::setprecision(8) << sample.eccentricity << ",";
+    file << std::setprecision(3) << sample.perigee_altitude_m << "," << sample.apogee_altitude_m << ",";
+    file << std::scientific << std::setprecision(6) << sample.averaged_air_density_kg_m3 << std::endl;
+  }
+  return true;
+}
+
+OrbitLifetimeAnalysis::DecayRates OrbitLifetimeAnalysis::CalcDecayRates(const double elapsed_time_s, const double semi_major_axis_m,
+                                                                        const double eccentricity) {
+  const double time_jd = start_time_jd_ + elapsed_time_s / kDay_s;
+  const double n_rad_s = sqrt(gravity_constant_m3_s2_ / pow(semi_major_axis_m, 3.0));
+  const libra::Vector<3> sun_direction_i = CalcSunDirection_i(time_jd);
+  double decimal_year;
+  JdToDecyear(time_jd, &decimal_year);
+
+  // The epoch is the time at the perigee
+  OrbitalElements oe(time_jd, semi_major_axis_m, eccentricity, inclination_rad_, raan_rad_, arg_perigee_rad_);
+  KeplerOrbit kepler_orbit(gravity_constant_m3_s2_, oe);
+
+  // Unit vector to the perigee
+  libra::Vector<3> perigee_direction_i;
+  perigee_direction_i[0] = cos(raan_rad_) * cos(arg_perigee_rad_) - sin(raan_rad_) * sin(arg_perigee_rad_) * cos(inclination_rad_);
+  perigee_direction_i[1] = sin(raan_rad_) * cos(arg_perigee_rad_) + cos(raan_rad_) * sin(arg_perigee_rad_) * cos(inclination_rad_);
+  perigee_direction_i[2] = sin(arg_perigee_rad_) * sin(inclination_rad_);
+
+  // Average over the points at the same interval of the mean anomaly, which is the average over the time
+  const size_t number_of_samples = settings_.number_of_orbit_samples;
+  double semi_major_axis_rate_m_s = 0.0;
+  libra::Vector<3> eccentricity_vector_rate_1_s(0.0);
+  double air_density_sum_kg_m3 = 0.0;
+  GeodeticPosition geodetic_position;
+  for (size_t i = 0; i < number_of_samples; i++) {
+    const double time_from_perigee_s = libra::tau * (double)i / (double)number_of_samples / n_rad_s;
+    const double sample_time_jd = time_jd + time_from_perigee_s / kDay_s;
+    kepler_orbit.CalcOrbit(sample_time_jd);
+    const libra::Vector<3> position_i_m = kepler_orbit.GetPosition_i_m();
+    const libra::Vector<3> velocity_i_m_s = kepler_orbit.GetVelocity_i_m_s();
+
+    earth_rotation_.Update(sample_time_jd);
+    geodetic_position.UpdateFromEcef(earth_rotation_.GetDcmJ2000ToEcef() * position_i_m);
+    const double air_density_kg_m3 = atmosphere_.CalcAirDensityAtPosition_kg_m3(decimal_year, geodetic_position, sun_direction_i);
+    air_density_sum_kg_m3 += air_density_kg_m3;
+
+    // Air drag with the atmosphere rotating with the Earth around the z-axis of the inertial frame
+    libra::Vector<3> relative_velocity_i_m_s = velocity_i_m_s;
+    relative_velocity_i_m_s[0] += environment::earth_mean_angular_velocity_rad_s * position_i_m[1];
+    relative_velocity_i_m_s[1] -= environment::earth_mean_angular_velocity_rad_s * position_i_m[0];
+    const libra::Vector<3> drag_acceleration_i_m_s2 =
+        (-0.5 * settings_.ballistic_coefficient_m2_kg * air_density_kg_m3 * relative_velocity_i_m_s.CalcNorm()) * relative_velocity_i_m_s;
+
+    // Gauss variational equations in the vector form
+    const double velocity_work = InnerProduct(velocity_i_m_s, drag_acceleration_i_m_s2);
+    semi_major_axis_rate_m_s += 2.0 * semi_major_axis_m * semi_major_axis_m / gravity_constant_m3_s2_ * velocity_work;
+    eccentricity_vector_rate_1_s += (1.0 / gravity_constant_m3_s2_) * (2.0 * velocity_work * position_i_m -
+                                                                        InnerProduct(position_i_m, drag_acceleration_i_m_s2) * velocity_i_m_s -
+                                                                        InnerProduct(position_i_m, velocity_i_m_s) * drag_acceleration_i_m_s2);
+  }
+
+  DecayRates rates;
+  rates.semi_major_axis_m_s = semi_major_axis_rate_m_s / (double)number_of_samples;
+  // The direction of the eccentricity vector is not defined for the circular orbit
+  rates.eccentricity_1_s = eccentricity > 1.0e-6 ? InnerProduct(perigee_direction_i, eccentricity_vector_rate_1_s) / (double)number_of_samples : 0.0;
+  rates.averaged_air_density_kg_m3 = air_density_sum_kg_m3 / (double)number_of_samples;
+  return rates;
+}
+
+void OrbitLifetimeAnalysis::AddSample(const double averaged_air_density_kg_m3) {
+  OrbitLifetimeSample sample;
+  sample.elapsed_time_s = elapsed_time_s_;
+  sample.semi_major_axis_m = semi_major_axis_m_;
+  sample.eccentricity = eccentricity_;
+  sample.perigee_altitude_m = CalcPerigeeAltitude_m(semi_major_axis_m_, eccentricity_);
+  sample.apogee_altitude_m = semi_major_axis_m_ * (1.0 + eccentricity_) - environment::earth_equatorial_radius_m;
+  sample.averaged_air_density_kg_m3 = averaged_air_density_kg_m3;
+  decay_curve_.push_back(sample);
+}
+
+double OrbitLifetimeAnalysis::CalcPerigeeAltitude_m(const double semi_major_axis_m, const double eccentricity) {
+  return semi_major_axis_m * (1.0 - eccentricity) - environment::earth_equatorial_radius_m;
+}
+
+OrbitLifetimeSettings InitOrbitLifetimeSettings(const std::string file_name, const double maximum_duration_s) {
+  IniAccess ini_file(file_name);
+  const char* section = "ORBIT_LIFETIME";
+
+  OrbitLifetimeSettings settings;
+  settings.ballistic_coefficient_m2_kg = ini_file.ReadDouble(section, "ballistic_coefficient_m2_kg");
+  settings.reentry_altitude_m = ini_file.ReadDouble(section, "reentry_altitude_km") * 1000.0;
+  settings.maximum_duration_s = maximum_duration_s;
+  settings.minimum_step_s = ini_file.ReadDouble(section, "minimum_step_s");
+  settings.maximum_step_s = ini_file.ReadDouble(section, "maximum_step_s");
+  settings.maximum_decay_ratio = ini_file.ReadDouble(section, "maximum_decay_ratio");
+  const int number_of_orbit_samples = ini_file.ReadInt(section, "number_of_orbit_samples");
+  if (settings.ballistic_coefficient_m2_kg <= 0.0 || settings.minimum_step_s <= 0.0 || settings.maximum_decay_ratio <= 0.0 ||
+      number_of_orbit_samples <= 0) {
+    throw std::invalid_argument(
+        "ORBIT_LIFETIME: ballistic_coefficient_m2_kg, minimum_step_s, maximum_decay_ratio, or number_of_orbit_samples is not positive.");
+  }
+  settings.number_of_orbit_samples = (size_t)number_of_orbit_samples;
+  return settings;
+}
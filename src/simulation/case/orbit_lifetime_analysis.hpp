@@ -0,0 +1,173 @@
+/**
+ * @file orbit_lifetime_analysis.hpp
+ * @brief Fast orbit lifetime analysis with the orbit-averaged air drag and the adaptive step width
+ */
+
+#ifndef S2E_SIMULATION_CASE_ORBIT_LIFETIME_ANALYSIS_HPP_
+#define S2E_SIMULATION_CASE_ORBIT_LIFETIME_ANALYSIS_HPP_
+
+#include <environment/global/earth_rotation.hpp>
+#include <environment/local/atmosphere.hpp>
+#include <math_physics/math/vector.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @struct OrbitLifetimeSettings
+ * @brief Settings of the orbit lifetime analysis
+ */
+struct OrbitLifetimeSettings {
+  double ballistic_coefficient_m2_kg = 0.01;  //!< Drag coefficient times the area per mass [m2/kg]
+  double reentry_altitude_m = 120.0e3;        //!< Perigee altitude to finish the analysis as the reentry [m]
+  double maximum_duration_s = 0.0;            //!< Maximum duration of the analysis [s]
+  double minimum_step_s = 600.0;              //!< Minimum step width [s]
+  double maximum_step_s = 86400.0;            //!< Maximum step width [s]
+  double maximum_decay_ratio = 0.02;          //!< Maximum decay of the perigee altitude above the reentry altitude in a step (ratio)
+  size_t number_of_orbit_samples = 36;        //!< Number of the points on the orbit to average the drag
+};
+
+/**
+ * @struct OrbitLifetimeSample
+ * @brief Sample of the decay curve
+ */
+struct OrbitLifetimeSample {
+  double elapsed_time_s;              //!< Elapsed time from the start of the analysis [s]
+  double semi_major_axis_m;           //!< Mean semi-major axis [m]
+  double eccentricity;                //!< Mean eccentricity
+  double perigee_altitude_m;          //!< Perigee altitude above the Earth equatorial radius [m]
+  double apogee_altitude_m;           //!< Apogee altitude above the Earth equatorial radius [m]
+  double averaged_air_density_kg_m3;  //!< Air density averaged over the orbit [kg/m3]
+};
+
+/**
+ * @class OrbitLifetimeAnalysis
+ * @brief Fast orbit lifetime analysis with the orbit-averaged air drag and the adaptive step width
+ * @details The mean semi-major axis and eccentricity decay with the air drag averaged over the points of the Kepler orbit at the same
+ *          interval of the mean anomaly, and the node and the perigee rotate with the secular J2 rates. The air density is calculated with
+ *          a copy of the Atmosphere of the spacecraft, so the density grid cache of NRLMSISE00 is used when it is enabled. The step width is
+ *          selected so that the perigee altitude decreases by the ratio of the altitude above the reentry altitude, so the steps are large
+ *          in the high orbit and small near the reentry. The analysis finishes when the perigee altitude reaches the reentry altitude.
+ * @note The attitude, the components, and the other disturbances are not calculated. The sun direction is calculated with the low precision
+ *       analytic formula of the Astronomical Almanac, which is enough for the diurnal bulge of the atmosphere.
+ */
+class OrbitLifetimeAnalysis {
+ public:
+  /**
+   * @fn OrbitLifetimeAnalysis
+   * @brief Constructor
+   * @param [in] settings: Settings of the analysis
+   * @param [in] atmosphere: Atmosphere of the spacecraft. It is copied.
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] start_time_jd: Julian day at the start of the analysis [day]
+   * @param [in] position_i_m: Initial position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial velocity in the inertial frame [m/s]
+   */
+  OrbitLifetimeAnalysis(const OrbitLifetimeSettings& settings, const Atmosphere& atmosphere, const double gravity_constant_m3_s2,
+                        const double start_time_jd, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s);
+
+  /**
+   * @fn Step
+   * @brief Propagate a step
+   * @return False when the analysis has already finished
+   */
+  bool Step();
+  /**
+   * @fn Run
+   * @brief Propagate until the reentry or the maximum duration
+   */
+  void Run();
+
+  // Getters
+  /**
+   * @fn IsFinished
+   * @return True when the reentry is detected or the maximum duration is reached
+   */
+  inline bool IsFinished() const { return is_reentered_ || elapsed_time_s_ >= settings_.maximum_duration_s; }
+  /**
+   * @fn IsReentered
+   * @return True when the perigee altitude reaches the reentry altitude
+   */
+  inline bool IsReentered() const { return is_reentered_; }
+  /**
+   * @fn GetElapsedTime_s
+   * @return Elapsed time from the start of the analysis. The lifetime after the reentry. [s]
+   */
+  inline double GetElapsedTime_s() const { return elapsed_time_s_; }
+  /**
+   * @fn GetNumberOfSteps
+   * @return Number of the steps
+   */
+  inline size_t GetNumberOfSteps() const { return number_of_steps_; }
+  /**
+   * @fn GetDecayCurve
+   * @return Samples at the initial state and at the end of each step
+   */
+  inline const std::vector<OrbitLifetimeSample>& GetDecayCurve() const { return decay_curve_; }
+
+  /**
+   * @fn WriteDecayCurve
+   * @brief Write the decay curve in a CSV file
+   * @param [in] file_path: Path to the CSV file
+   * @return True when the file is written
+   */
+  bool WriteDecayCurve(const std::string file_path) const;
+
+ private:
+  /**
+   * @struct DecayRates
+   * @brief Orbit-averaged rates of the mean elements by the air drag
+   */
+  struct DecayRates {
+    double semi_major_axis_m_s;         //!< Rate of the semi-major axis [m/s]
+    double eccentricity_1_s;            //!< Rate of the eccentricity [1/s]
+    double averaged_air_density_kg_m3;  //!< Air density averaged over the orbit [kg/m3]
+  };
+
+  OrbitLifetimeSettings settings_;  //!< Settings of the analysis
+  Atmosphere atmosphere_;           //!< Atmosphere to calculate the air density
+  EarthRotation earth_rotation_;    //!< Earth rotation to calculate the geodetic positions
+  double gravity_constant_m3_s2_;   //!< Gravity constant [m3/s2]
+  double start_time_jd_;            //!< Julian day at the start of the analysis [day]
+  double elapsed_time_s_ = 0.0;     //!< Elapsed time from the start of the analysis [s]
+  size_t number_of_steps_ = 0;      //!< Number of the steps
+  bool is_reentered_ = false;       //!< Flag of the reentry
+
+  // Mean elements
+  double semi_major_axis_m_;  //!< Mean semi-major axis [m]
+  double eccentricity_;       //!< Mean eccentricity
+  double inclination_rad_;    //!< Mean inclination [rad]
+  double raan_rad_;           //!< Mean right ascension of the ascending node [rad]
+  double arg_perigee_rad_;    //!< Mean argument of perigee [rad]
+
+  std::vector<OrbitLifetimeSample> decay_curve_;  //!< Decay curve
+
+  /**
+   * @fn CalcDecayRates
+   * @brief Calculate the orbit-averaged rates of the semi-major axis and the eccentricity by the air drag
+   * @param [in] elapsed_time_s: Elapsed time of the orbit [s]
+   * @param [in] semi_major_axis_m: Semi-major axis [m]
+   * @param [in] eccentricity: Eccentricity
+   */
+  DecayRates CalcDecayRates(const double elapsed_time_s, const double semi_major_axis_m, const double eccentricity);
+  /**
+   * @fn AddSample
+   * @brief Add the current mean elements to the decay curve
+   * @param [in] averaged_air_density_kg_m3: Air density averaged over the orbit [kg/m3]
+   */
+  void AddSample(const double averaged_air_density_kg_m3);
+  /**
+   * @fn CalcPerigeeAltitude_m
+   * @brief Calculate the perigee altitude above the Earth equatorial radius [m]
+   */
+  static double CalcPerigeeAltitude_m(const double semi_major_axis_m, const double eccentricity);
+};
+
+/**
+ * @fn InitOrbitLifetimeSettings
+ * @brief Read the settings of the orbit lifetime analysis
+ * @param [in] file_name: Path to the simulation base initialize file
+ * @param [in] maximum_duration_s: Maximum duration of the analysis [s]
+ */
+OrbitLifetimeSettings InitOrbitLifetimeSettings(const std::string file_name, const double maximum_duration_s);
+
+#endif  // S2E_SIMULATION_CASE_ORBIT_LIFETIME_ANALYSIS_HPP_
@@ -5,11 +5,27 @@
 
 #include "simulation_case.hpp"
 
+#include <fstream>
 #include <logger/initialize_log.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
+#include <math_physics/randomization/normal_randomization.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <simulation/case/orbit_lifetime_analysis.hpp>
+#include <simulation/monte_carlo_simulation/simulation_object.hpp>
+#include <simulation/spacecraft/constellation_builder.hpp>
+#include <simulation/spacecraft/spacecraft.hpp>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utilities/case_arena.hpp>
+#include <utilities/step_profiler.hpp>
 
-SimulationCase::SimulationCase(const std::string initialize_base_file) {
+namespace {
+const char* kSnapshotFileTag = "S2E_SIMULATION_SNAPSHOT";  //!< Tag at the beginning of the snapshot file
+const uint32_t kSnapshotVersion = 2;                       //!< Version of the snapshot format
+}  // namespace
+
+SimulationCase::SimulationCase(const std::string initialize_base_file) : monte_carlo_simulator_(nullptr) {
   // Initialize Log
   simulation_configuration_.main_logger_ = InitLog(initialize_base_file);
 
@@ -18,19 +34,40 @@ SimulationCase::SimulationCase(const std::string initialize_base_file) {
 }
 
 SimulationCase::SimulationCase(const std::string initialize_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator,
-                               const std::string log_path) {
+                               const std::string log_path)
+    : monte_carlo_simulator_(&monte_carlo_simulator) {
   if (monte_carlo_simulator.IsEnabled() == false) {
     // Monte Carlo simulation is disabled
     simulation_configuration_.main_logger_ = InitLog(initialize_base_file);
   } else {
     // Monte Carlo Simulation is enabled
-    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + ".csv";
+    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetCaseIndex()) + ".csv";
 
     IniAccess ini_file(initialize_base_file);
     bool save_ini_files = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
 
-    simulation_configuration_.main_logger_ =
-        new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag());
+    // In-memory log capture: keep only the selected channels and write their statistics as the case result
+    const std::vector<std::string> log_capture_channels = ini_file.ReadStrVector("MONTE_CARLO_EXECUTION", "log_capture_channel");
+    if (!log_capture_channels.empty()) {
+      simulation_configuration_.main_logger_ = new Logger(log_file_name, log_path, initialize_base_file, false, true, false, LogFileFormat::kMemory);
+      MemoryLogCapture& log_capture = simulation_configuration_.main_logger_->GetMemoryLogCapture();
+      for (const auto& channel : log_capture_channels) {
+        log_capture.AddChannel(channel);
+      }
+      log_capture.SetStatistics(ini_file.Split(ini_file.ReadString("MONTE_CARLO_EXECUTION", "log_capture_statistics"), ','));
+    } else if (monte_carlo_simulator.GetLogStore() != nullptr && monte_carlo_simulator.GetSaveLogHistoryFlag()) {
+      // All cases append their logs to the single container file of the campaign
+      simulation_configuration_.main_logger_ = new Logger(monte_carlo_simulator.GetLogStore(), monte_carlo_simulator.GetCaseIndex(), log_path);
+      InitLogChannelFilter(simulation_configuration_.main_logger_, initialize_base_file);
+    } else {
+      // The log directory is created by the Monte-Carlo simulation logger, so each case writes its log into log_path
+      simulation_configuration_.main_logger_ =
+          new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag(), false,
+                     ReadLogFileFormat(initialize_base_file), ReadLogCompression(initialize_base_file));
+      InitLogChannelFilter(simulation_configuration_.main_logger_, initialize_base_file);
+      InitAsyncLogWriter(simulation_configuration_.main_logger_, initialize_base_file);
+      InitFlightRecorder(simulation_configuration_.main_logger_, initialize_base_file);
+    }
   }
   // Initialize Simulation Configuration
   InitializeSimulationConfiguration(initialize_base_file);
@@ -39,11 +76,44 @@ SimulationCase::SimulationCase(const std::string initialize_base_file, const Mon
 SimulationCase::~SimulationCase() { delete global_environment_; }
 
 void SimulationCase::Initialize() {
+  // Connect the nodes of the distributed simulation before the target objects are split across them
+  if (simulation_configuration_.is_distributed_simulation_enabled_) {
+    distributed_node_ = std::make_unique<DistributedSimulationNode>(
+        simulation_configuration_.distributed_node_id_, simulation_configuration_.number_of_distributed_nodes_,
+        simulation_configuration_.distributed_coordinator_address_, simulation_configuration_.distributed_coordinator_port_,
+        simulation_configuration_.distributed_sync_period_s_);
+    distributed_node_->Connect();
+  }
+
   // Target Objects Initialize
-  InitializeTargetObjects();
+  {
+    CaseArena::Scope arena_scope(case_arena_.get());
+    InitializeTargetObjects();
+  }
+
+  // Resume the simulation from the snapshot
+  if (!simulation_configuration_.load_snapshot_file_.empty()) {
+    LoadSnapshot(simulation_configuration_.load_snapshot_file_);
+  }
 
   // Write headers to the log
   simulation_configuration_.main_logger_->WriteHeaders();
+  event_detector_.LogSetup(*(simulation_configuration_.main_logger_));
+  // The detected events trigger the flight recorder of the main logger
+  Logger* main_logger = simulation_configuration_.main_logger_;
+  event_detector_.SetEventListener([main_logger](const DetectedEvent& event) { main_logger->NotifyEvent(event.name_); });
+
+  // Memory usage after the initialization
+  if (simulation_configuration_.is_memory_usage_report_enabled_) {
+    std::cout << "\nMemory usage\n";
+    GetMemoryUsage().Write(std::cout);
+    if (case_arena_ != nullptr) {
+      std::cout << "Case arena: " << case_arena_->GetAllocatedBytes() / 1024.0 << " KiB allocated in ";
+      std::cout << case_arena_->GetReservedBytes() / 1024.0 << " KiB" << std::endl;
+    }
+    std::cout << "Current RSS: " << GetCurrentResidentSetSize_bytes() / (1024.0 * 1024.0) << " MiB, ";
+    std::cout << "Peak RSS: " << GetPeakResidentSetSize_bytes() / (1024.0 * 1024.0) << " MiB" << std::endl;
+  }
 
   // Start the simulation
   std::cout << "\nSimulationDateTime \n";
@@ -51,24 +121,218 @@ void SimulationCase::Initialize() {
 }
 
 void SimulationCase::Main() {
+  if (simulation_configuration_.is_orbit_lifetime_mode_enabled_ && RunOrbitLifetimeAnalysis()) return;
+
+  StartSteps();
+  while (!IsFinished()) {
+    Step();
+  }
+  FinishSteps();
+}
+
+void SimulationCase::StartSteps() {
   global_environment_->Reset();  // for MonteCarlo Simulation
-  while (!global_environment_->GetSimulationTime().GetState().finish) {
-    // Logging
-    if (global_environment_->GetSimulationTime().GetState().log_output) {
+  if (simulation_configuration_.is_step_profiler_enabled_) {
+    StepProfiler::Enable(!simulation_configuration_.step_profiler_trace_file_.empty(),
+                         simulation_configuration_.is_step_profiler_hardware_counter_enabled_);
+  }
+  event_detector_.Update(global_environment_->GetSimulationTime().GetElapsedTime_s());
+}
+
+bool SimulationCase::Step() {
+  if (IsFinished()) return false;
+
+  // Logging
+  // The log output is deferred to the next step which is not degraded to keep the real time deadline
+  if (global_environment_->GetSimulationTime().GetState().log_output || is_log_deferred_) {
+    if (global_environment_->GetSimulationTime().GetRealTimeDeadlineMonitor().IsActive(kRealTimeDegradationDeferLogging)) {
+      is_log_deferred_ = true;
+    } else {
       simulation_configuration_.main_logger_->WriteValues();
+      is_log_deferred_ = false;
     }
+  }
+  // Live telemetry to the external viewers
+  simulation_configuration_.main_logger_->PublishTelemetry(global_environment_->GetSimulationTime().GetElapsedTime_s());
 
-    // Global Environment Update
+  // Global Environment Update
+  if (environment_replay_ != nullptr && environment_replay_->IsReplaying()) {
+    environment_replay_->ReadStep();
+    global_environment_->UpdateWithReplayFrame(environment_replay_->GetGlobalEnvironmentReader());
+  } else {
     global_environment_->Update();
+    if (environment_replay_ != nullptr) global_environment_->SaveReplayFrame(environment_replay_->GetGlobalEnvironmentWriter());
+  }
 
-    // Target Objects Update
-    UpdateTargetObjects();
+  // Target Objects Update
+  UpdateTargetObjects();
+  if (environment_replay_ != nullptr && environment_replay_->IsRecording()) environment_replay_->WriteStep();
 
-    // Debug output
-    if (global_environment_->GetSimulationTime().GetState().disp_output) {
-      std::cout << "Progress: " << global_environment_->GetSimulationTime().GetProgressionRate() << "%\r";
+  // Exchange the spacecraft states and the packets with the other nodes of the distributed simulation
+  if (distributed_node_ != nullptr) {
+    distributed_node_->Synchronize(global_environment_->GetSimulationTime().GetElapsedTime_s());
+  }
+
+  // Event detection with the updated target objects
+  event_detector_.Update(global_environment_->GetSimulationTime().GetElapsedTime_s());
+
+  // Snapshot
+  if (!is_snapshot_saved_ && !simulation_configuration_.save_snapshot_file_.empty() &&
+      global_environment_->GetSimulationTime().GetElapsedTime_s() >= simulation_configuration_.save_snapshot_time_s_) {
+    SaveSnapshot(simulation_configuration_.save_snapshot_file_);
+    is_snapshot_saved_ = true;
+  }
+
+  // Debug output
+  if (global_environment_->GetSimulationTime().GetState().disp_output) {
+    std::cout << "Progress: " << global_environment_->GetSimulationTime().GetProgressionRate() << "%\r";
+  }
+
+  return true;
+}
+
+bool SimulationCase::IsFinished() const { return global_environment_->GetSimulationTime().GetState().finish; }
+
+void SimulationCase::FinishSteps() {
+  FinishTargetObjects();
+  global_environment_->GetSimulationTime().PrintRealTimePacingStatistics();
+  const RealTimeDeadlineMonitor& deadline_monitor = global_environment_->GetSimulationTime().GetRealTimeDeadlineMonitor();
+  if (deadline_monitor.IsEnabled()) {
+    const std::string degradation_file_path = simulation_configuration_.main_logger_->GetLogPath() + "real_time_degradation.csv";
+    if (!deadline_monitor.WriteEvents(degradation_file_path)) {
+      std::cout << "[Warning] Real time degradation file " << degradation_file_path << " cannot be written." << std::endl;
     }
   }
+  if (distributed_node_ != nullptr) {
+    distributed_node_->PrintStatistics();
+  }
+  if (simulation_configuration_.is_memory_usage_report_enabled_) {
+    std::cout << "Peak RSS: " << GetPeakResidentSetSize_bytes() / (1024.0 * 1024.0) << " MiB" << std::endl;
+  }
+  if (simulation_configuration_.is_step_profiler_enabled_) {
+    StepProfiler::Disable();
+    StepProfiler::WriteSummary(std::cout);
+    if (!simulation_configuration_.step_profiler_trace_file_.empty()) {
+      const std::string trace_file_path = simulation_configuration_.main_logger_->GetLogPath() + simulation_configuration_.step_profiler_trace_file_;
+      if (!StepProfiler::WriteChromeTrace(trace_file_path)) {
+        std::cout << "[Warning] Trace file " << trace_file_path << " cannot be written." << std::endl;
+      }
+    }
+  }
+
+  // Pass the statistics of the in-memory log capture to the Monte-Carlo simulator as the result of this case
+  if (monte_carlo_simulator_ != nullptr && simulation_configuration_.main_logger_->GetLogFileFormat() == LogFileFormat::kMemory) {
+    monte_carlo_simulator_->SetCaseResult(simulation_configuration_.main_logger_->GetMemoryLogCapture());
+  }
+}
+
+void SimulationCase::ResetForMonteCarloCase(const MonteCarloSimulationExecutor& monte_carlo_simulator) {
+  if (initial_state_snapshot_.empty()) {
+    std::ostringstream stream(std::ios::binary);
+    SaveSnapshot(stream);
+    initial_state_snapshot_ = stream.str();
+  } else {
+    // global_randomization is already reseeded for this case, so keep it over the restoration
+    std::stringstream randomization_stream(std::ios::in | std::ios::out | std::ios::binary);
+    SnapshotWriter randomization_writer(randomization_stream);
+    global_randomization.SaveSnapshot(randomization_writer);
+
+    std::istringstream stream(initial_state_snapshot_, std::ios::binary);
+    LoadSnapshot(stream);
+
+    SnapshotReader randomization_reader(randomization_stream);
+    global_randomization.LoadSnapshot(randomization_reader);
+  }
+
+  monte_carlo_simulator_ = &monte_carlo_simulator;
+  SimulationObject::SetAllParameters(monte_carlo_simulator);
+  event_detector_.Reset();
+  if (simulation_configuration_.main_logger_->GetLogFileFormat() == LogFileFormat::kMemory) {
+    simulation_configuration_.main_logger_->GetMemoryLogCapture().Reset();
+  }
+}
+
+MemoryUsage SimulationCase::GetMemoryUsage() const {
+  MemoryUsage memory_usage("SimulationCase", sizeof(*this));
+  memory_usage.AddChild(global_environment_->GetMemoryUsage());
+  AddTargetObjectsMemoryUsage(memory_usage);
+  return memory_usage;
+}
+
+bool SimulationCase::IsLocalSpacecraft(const size_t spacecraft_id) const {
+  if (distributed_node_ == nullptr) return true;
+  return distributed_node_->IsLocalSpacecraft(spacecraft_id);
+}
+
+void SimulationCase::UpdateSpacecraft(const std::vector<Spacecraft*>& spacecraft_list) {
+  if (spacecraft_updater_ == nullptr) {
+    spacecraft_updater_ = std::make_unique<ParallelSpacecraftUpdater>(simulation_configuration_.number_of_spacecraft_update_threads_);
+  }
+  spacecraft_updater_->Update(spacecraft_list, &(global_environment_->GetSimulationTime()));
+}
+
+bool SimulationCase::RunOrbitLifetimeAnalysis() {
+  const Spacecraft* spacecraft = GetOrbitLifetimeTarget();
+  if (spacecraft == nullptr) {
+    std::cout << "[Warning] Orbit lifetime mode is not supported in this simulation case. The simulation steps are executed." << std::endl;
+    return false;
+  }
+
+  const SimulationTime& simulation_time = global_environment_->GetSimulationTime();
+  const OrbitLifetimeSettings settings =
+      InitOrbitLifetimeSettings(simulation_configuration_.initialize_base_file_name_, simulation_time.GetEndTime_s());
+  const Orbit& orbit = spacecraft->GetDynamics().GetOrbit();
+  OrbitLifetimeAnalysis analysis(settings, spacecraft->GetLocalEnvironment().GetAtmosphere(),
+                                 global_environment_->GetCelestialInformation().GetCenterBodyGravityConstant_m3_s2(),
+                                 simulation_time.GetCurrentTime_jd(), orbit.GetPosition_i_m(), orbit.GetVelocity_i_m_s());
+  analysis.Run();
+
+  std::cout << "\nOrbit lifetime analysis: " << analysis.GetNumberOfSteps() << " steps" << std::endl;
+  if (analysis.IsReentered()) {
+    std::cout << "Reentry after " << analysis.GetElapsedTime_s() / (24.0 * 60.0 * 60.0) << " days" << std::endl;
+  } else {
+    std::cout << "No reentry in " << analysis.GetElapsedTime_s() / (24.0 * 60.0 * 60.0) << " days" << std::endl;
+  }
+  analysis.WriteDecayCurve(simulation_configuration_.main_logger_->GetLogPath() + "orbit_lifetime.csv");
+  return true;
+}
+
+void SimulationCase::SaveSnapshot(const std::string& file_path) const {
+  std::ofstream file(file_path, std::ios::binary);
+  if (!file.is_open()) {
+    std::cout << "[Warning] Snapshot file " << file_path << " cannot be opened. The snapshot is not saved." << std::endl;
+    return;
+  }
+  SaveSnapshot(file);
+  if (!file.good()) {
+    std::cout << "[Warning] Snapshot file " << file_path << " is not written correctly." << std::endl;
+  }
+}
+
+void SimulationCase::LoadSnapshot(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file.is_open()) throw std::invalid_argument("Snapshot file " + file_path + " cannot be opened.");
+  LoadSnapshot(file);
+}
+
+void SimulationCase::SaveSnapshot(std::ostream& stream) const {
+  SnapshotWriter snapshot(stream);
+  snapshot.WriteTag(kSnapshotFileTag);
+  snapshot.Write(kSnapshotVersion);
+  global_environment_->SaveSnapshot(snapshot);
+  global_randomization.SaveSnapshot(snapshot);
+  SaveTargetObjectsSnapshot(snapshot);
+}
+
+void SimulationCase::LoadSnapshot(std::istream& stream) {
+  SnapshotReader snapshot(stream);
+  snapshot.ReadTag(kSnapshotFileTag);
+  uint32_t version;
+  snapshot.Read(version);
+  if (version != kSnapshotVersion) throw std::invalid_argument("Snapshot has the unsupported version " + std::to_string(version) + ".");
+  global_environment_->LoadSnapshot(snapshot);
+  global_randomization.LoadSnapshot(snapshot);
+  LoadTargetObjectsSnapshot(snapshot);
 }
 
 std::string SimulationCase::GetLogHeader() const {
@@ -92,6 +356,45 @@ void SimulationCase::InitializeSimulationConfiguration(const std::string initial
   // Spacecraft
   simulation_configuration_.number_of_simulated_spacecraft_ = simulation_base_ini.ReadInt(section, "number_of_simulated_spacecraft");
   simulation_configuration_.spacecraft_file_list_ = simulation_base_ini.ReadStrVector(section, "spacecraft_file");
+  // Constellation members are added after the listed spacecraft
+  const char* constellation_section = "CONSTELLATION";
+  const ConstellationPattern constellation_pattern =
+      SetConstellationPattern(simulation_base_ini.ReadString(constellation_section, "constellation_pattern"));
+  if (constellation_pattern != ConstellationPattern::kDisable) {
+    const int number_of_members = simulation_base_ini.ReadInt(constellation_section, "number_of_spacecraft");
+    const int number_of_planes = simulation_base_ini.ReadInt(constellation_section, "number_of_planes");
+    const int phasing_parameter = simulation_base_ini.ReadInt(constellation_section, "phasing_parameter");
+    if (number_of_members < 0 || number_of_planes < 0 || phasing_parameter < 0) {
+      throw std::invalid_argument("CONSTELLATION: number_of_spacecraft, number_of_planes, or phasing_parameter is negative.");
+    }
+    ConstellationBuilder constellation_builder(simulation_base_ini.ReadString(constellation_section, "template_spacecraft_file"),
+                                               constellation_pattern, (size_t)number_of_members, (size_t)number_of_planes,
+                                               (size_t)phasing_parameter);
+    const std::vector<std::string> member_files = constellation_builder.Build();
+    if (simulation_configuration_.spacecraft_file_list_.size() > simulation_configuration_.number_of_simulated_spacecraft_) {
+      simulation_configuration_.spacecraft_file_list_.resize(simulation_configuration_.number_of_simulated_spacecraft_);
+    }
+    simulation_configuration_.spacecraft_file_list_.insert(simulation_configuration_.spacecraft_file_list_.end(), member_files.begin(),
+                                                           member_files.end());
+    simulation_configuration_.number_of_simulated_spacecraft_ = (unsigned int)simulation_configuration_.spacecraft_file_list_.size();
+  }
+  const int number_of_spacecraft_update_threads = simulation_base_ini.ReadInt(section, "number_of_spacecraft_update_threads");
+  simulation_configuration_.number_of_spacecraft_update_threads_ =
+      number_of_spacecraft_update_threads > 1 ? (unsigned int)number_of_spacecraft_update_threads : 1;
+  simulation_configuration_.is_thermal_propagated_concurrently_ = simulation_base_ini.ReadEnable(section, "concurrent_thermal_propagation");
+  const int number_of_thermal_threads = simulation_base_ini.ReadInt(section, "number_of_thermal_threads");
+  const int thermal_parallel_node_threshold = simulation_base_ini.ReadInt(section, "thermal_parallel_node_threshold");
+  simulation_configuration_.thermal_parallel_node_threshold_ = thermal_parallel_node_threshold > 0 ? (size_t)thermal_parallel_node_threshold : 0;
+  if (simulation_configuration_.is_thermal_propagated_concurrently_ || simulation_configuration_.thermal_parallel_node_threshold_ > 0) {
+    // At least one worker is needed to propagate the thermal dynamics concurrently with the attitude and orbit
+    simulation_configuration_.number_of_thermal_threads_ = number_of_thermal_threads > 2 ? (unsigned int)number_of_thermal_threads : 2;
+    thermal_thread_pool_ = std::make_unique<ThreadPool>(simulation_configuration_.number_of_thermal_threads_);
+    simulation_configuration_.thermal_thread_pool_ = thermal_thread_pool_.get();
+  }
+  simulation_configuration_.is_global_environment_updated_concurrently_ =
+      simulation_base_ini.ReadEnable(section, "concurrent_global_environment_update");
+  simulation_configuration_.is_event_detection_enabled_ = simulation_base_ini.ReadEnable(section, "event_detection");
+  simulation_configuration_.is_orbit_lifetime_mode_enabled_ = simulation_base_ini.ReadEnable("ORBIT_LIFETIME", "orbit_lifetime_mode");
 
   // Ground Station
   simulation_configuration_.number_of_simulated_ground_station_ = simulation_base_ini.ReadInt(section, "number_of_simulated_ground_station");
@@ -101,6 +404,68 @@ void SimulationCase::InitializeSimulationConfiguration(const std::string initial
   simulation_configuration_.inter_sc_communication_file_ = simulation_base_ini.ReadString(section, "inter_sat_comm_file");
   simulation_configuration_.gnss_file_ = simulation_base_ini.ReadString(section, "gnss_file");
 
+  // Snapshot
+  simulation_configuration_.save_snapshot_file_ = simulation_base_ini.ReadString(section, "save_snapshot_file");
+  if (simulation_configuration_.save_snapshot_file_ == "NULL") simulation_configuration_.save_snapshot_file_ = "";
+  simulation_configuration_.save_snapshot_time_s_ = simulation_base_ini.ReadDouble(section, "save_snapshot_time_s");
+  simulation_configuration_.load_snapshot_file_ = simulation_base_ini.ReadString(section, "load_snapshot_file");
+  if (simulation_configuration_.load_snapshot_file_ == "NULL") simulation_configuration_.load_snapshot_file_ = "";
+
+  // Environment record and replay
+  simulation_configuration_.environment_record_file_ = simulation_base_ini.ReadString(section, "environment_record_file");
+  if (simulation_configuration_.environment_record_file_ == "NULL") simulation_configuration_.environment_record_file_ = "";
+  simulation_configuration_.environment_replay_file_ = simulation_base_ini.ReadString(section, "environment_replay_file");
+  if (simulation_configuration_.environment_replay_file_ == "NULL") simulation_configuration_.environment_replay_file_ = "";
+  if (!simulation_configuration_.environment_replay_file_.empty()) {
+    if (!simulation_configuration_.environment_record_file_.empty()) {
+      std::cout << "[Warning] environment_record_file and environment_replay_file are set. Only the replay is executed." << std::endl;
+    }
+    environment_replay_ = std::make_unique<EnvironmentReplay>(EnvironmentReplay::Mode::kReplay, simulation_configuration_.environment_replay_file_,
+                                                              simulation_configuration_.number_of_simulated_spacecraft_);
+  } else if (!simulation_configuration_.environment_record_file_.empty()) {
+    environment_replay_ = std::make_unique<EnvironmentReplay>(EnvironmentReplay::Mode::kRecord, simulation_configuration_.environment_record_file_,
+                                                              simulation_configuration_.number_of_simulated_spacecraft_);
+  }
+  simulation_configuration_.environment_replay_ = environment_replay_.get();
+
+  // Profiler
+  simulation_configuration_.is_step_profiler_enabled_ = simulation_base_ini.ReadEnable(section, "step_profiler");
+  simulation_configuration_.step_profiler_trace_file_ = simulation_base_ini.ReadString(section, "step_profiler_trace_file");
+  if (simulation_configuration_.step_profiler_trace_file_ == "NULL") simulation_configuration_.step_profiler_trace_file_ = "";
+  simulation_configuration_.is_step_profiler_hardware_counter_enabled_ = simulation_base_ini.ReadEnable(section, "step_profiler_hardware_counter");
+  simulation_configuration_.is_memory_usage_report_enabled_ = simulation_base_ini.ReadEnable(section, "memory_usage_report");
+  simulation_configuration_.is_case_arena_enabled_ = simulation_base_ini.ReadEnable(section, "case_arena");
+  if (simulation_configuration_.is_case_arena_enabled_) case_arena_ = std::make_unique<CaseArena>();
+
+  // Distributed simulation
+  const char* distributed_section = "DISTRIBUTED_SIMULATION";
+  simulation_configuration_.is_distributed_simulation_enabled_ = simulation_base_ini.ReadEnable(distributed_section, "distributed_simulation");
+  if (simulation_configuration_.is_distributed_simulation_enabled_) {
+    const int node_id = simulation_base_ini.ReadInt(distributed_section, "node_id");
+    const int number_of_nodes = simulation_base_ini.ReadInt(distributed_section, "number_of_nodes");
+    const int coordinator_port = simulation_base_ini.ReadInt(distributed_section, "coordinator_port");
+    if (node_id < 0 || number_of_nodes < 1 || coordinator_port <= 0 || coordinator_port > 65535) {
+      throw std::invalid_argument("DISTRIBUTED_SIMULATION: node_id, number_of_nodes, or coordinator_port is out of range.");
+    }
+    simulation_configuration_.distributed_node_id_ = (unsigned int)node_id;
+    simulation_configuration_.number_of_distributed_nodes_ = (unsigned int)number_of_nodes;
+    simulation_configuration_.distributed_coordinator_address_ = simulation_base_ini.ReadString(distributed_section, "coordinator_address");
+    simulation_configuration_.distributed_coordinator_port_ = (unsigned short)coordinator_port;
+    simulation_configuration_.distributed_sync_period_s_ = simulation_base_ini.ReadDouble(distributed_section, "sync_period_s");
+  }
+
+  // Randomization backend of the normal random values generated in this case
+  const std::string normal_randomization_backend = simulation_base_ini.ReadString(section, "normal_randomization_backend");
+  if (normal_randomization_backend == "PHILOX") {
+    libra::NormalRand::SetDefaultBackend(libra::NormalRandomizationBackend::kPhilox);
+  } else {
+    if (normal_randomization_backend != "" && normal_randomization_backend != "MINIMAL_STANDARD_LCG") {
+      std::cout << "[Warning] normal_randomization_backend: " << normal_randomization_backend << " is not supported. MINIMAL_STANDARD_LCG is used."
+                << std::endl;
+    }
+    libra::NormalRand::SetDefaultBackend(libra::NormalRandomizationBackend::kMinimalStandardLcgWithShuffle);
+  }
+
   // Global Environment
   global_environment_ = new GlobalEnvironment(&simulation_configuration_);
   global_environment_->LogSetup(*(simulation_configuration_.main_logger_));
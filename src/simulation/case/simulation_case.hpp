@@ -8,10 +8,22 @@
 
 #include <environment/global/global_environment.hpp>
 #include <logger/loggable.hpp>
+#include <memory>
 #include <simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp>
+#include <simulation/event_detection/event_detector.hpp>
+#include <simulation/multiple_spacecraft/distributed_simulation_node.hpp>
+#include <simulation/multiple_spacecraft/parallel_spacecraft_updater.hpp>
+#include <utilities/case_arena.hpp>
+#include <utilities/macros.hpp>
+#include <utilities/memory_usage.hpp>
+#include <utilities/snapshot.hpp>
+#include <utilities/thread_pool.hpp>
+#include <vector>
 
 #include "../simulation_configuration.hpp"
+#include "environment_replay.hpp"
 class Logger;
+class Spacecraft;
 
 /**
  * @class SimulationCase
@@ -31,6 +43,9 @@ class SimulationCase : public ILoggable {
    * @param[in] initialize_base_file: File path to initialize base file
    * @param[in] monte_carlo_simulator: Monte-Carlo simulator
    * @param[in] log_path: Log output file path for Monte-Carlo simulation
+   * @note When log_capture_channel is set in MONTE_CARLO_EXECUTION, the selected channels are kept in memory instead of writing the log
+   *       file, and their statistics are passed to the simulator by MonteCarloSimulationExecutor::SetCaseResult at the end of Main.
+   *       When the log store of the simulator is opened, the log is appended to the store instead of a file for each case.
    */
   SimulationCase(const std::string initialize_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path);
   /**
@@ -51,6 +66,41 @@ class SimulationCase : public ILoggable {
    */
   virtual void Main();
 
+  /**
+   * @fn StartSteps
+   * @brief Prepare the step execution. Main calls StartSteps, Step until IsFinished, and FinishSteps.
+   * @note Call these functions instead of Main to drive the simulation step by step (see SimulationRunner).
+   */
+  void StartSteps();
+  /**
+   * @fn Step
+   * @brief Execute one simulation step (logging, global environment, target objects, event detection, and snapshot)
+   * @return False when the simulation is already finished and the step is not executed
+   */
+  bool Step();
+  /**
+   * @fn IsFinished
+   * @brief Return true when the elapsed time reaches the end time
+   */
+  bool IsFinished() const;
+  /**
+   * @fn FinishSteps
+   * @brief Write the statistics of the simulation and pass the result of the Monte-Carlo case
+   */
+  void FinishSteps();
+
+  /**
+   * @fn ResetForMonteCarloCase
+   * @brief Reset the initialized simulation to reuse it for the next Monte-Carlo case without the reconstruction
+   * @details The first call saves the snapshot of the initialized states, and the later calls restore them. Then the randomized parameters of
+   *          the case are applied to the SimulationObjects. The randomization stream of global_randomization is kept for the case seed.
+   * @note Call this function after Initialize and before Main of each case (see MonteCarloSimulationExecutor::ExecuteWithReuse). Only the states
+   *       written by SaveTargetObjectsSnapshot are restored, and the noise sequences of the components are common to the reused cases. The log
+   *       rows of the reused cases are appended to the log file of the first case, and the in-memory log capture is cleared for each case.
+   * @param[in] monte_carlo_simulator: Monte-Carlo simulator of the case with the randomized parameters
+   */
+  void ResetForMonteCarloCase(const MonteCarloSimulationExecutor& monte_carlo_simulator);
+
   /**
    * @fn GetLogHeader
    * @brief Virtual function of Log header settings for Monte-Carlo Simulation result
@@ -74,9 +124,55 @@ class SimulationCase : public ILoggable {
    */
   inline const GlobalEnvironment& GetGlobalEnvironment() const { return *global_environment_; }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Save the simulation state to resume the simulation with LoadSnapshot
+   * @note The snapshot is the native binary and restored only by the same build with the same initialize files.
+   * @param[in] file_path: File path of the snapshot
+   */
+  void SaveSnapshot(const std::string& file_path) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the simulation state saved by SaveSnapshot
+   * @note Call this function after InitializeTargetObjects. Throws std::invalid_argument when the snapshot does not match the setting.
+   * @param[in] file_path: File path of the snapshot
+   */
+  void LoadSnapshot(const std::string& file_path);
+  /**
+   * @fn SaveSnapshot
+   * @brief Save the simulation state to the stream (e.g., std::stringstream to branch the simulation in the process)
+   * @details To branch the simulation, load the saved state to the other instances of the case made with the same initialize files.
+   *          The branches can be executed in the separate threads. The immutable data (gravity coefficients, star catalogue, ephemeris cache,
+   *          space weather table, and earth orientation parameters) are shared between the instances, so each branch holds only its mutable state.
+   * @param[out] stream: Output stream opened in the binary mode
+   */
+  void SaveSnapshot(std::ostream& stream) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the simulation state saved by SaveSnapshot from the stream
+   * @param[in] stream: Input stream opened in the binary mode
+   */
+  void LoadSnapshot(std::istream& stream);
+
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage tree of the global environment and the target objects
+   */
+  MemoryUsage GetMemoryUsage() const;
+
  protected:
-  SimulationConfiguration simulation_configuration_;  //!< Simulation setting
-  GlobalEnvironment* global_environment_;             //!< Global Environment
+  std::unique_ptr<CaseArena> case_arena_;                          //!< Arena of the target objects. Declared first to outlive them.
+  SimulationConfiguration simulation_configuration_;               //!< Simulation setting
+  GlobalEnvironment* global_environment_;                          //!< Global Environment
+  const MonteCarloSimulationExecutor* monte_carlo_simulator_;      //!< Monte-Carlo simulator. nullptr for the normal simulation.
+  std::unique_ptr<ParallelSpacecraftUpdater> spacecraft_updater_;  //!< Updater to update the spacecraft concurrently
+  std::unique_ptr<ThreadPool> thermal_thread_pool_;                //!< Thread pool shared by the thermal propagation of all spacecraft
+  std::unique_ptr<DistributedSimulationNode> distributed_node_;    //!< Node of the distributed simulation. nullptr for a single process.
+  EventDetector event_detector_;                                   //!< Event detector. Add the switching functions in InitializeTargetObjects.
+  bool is_snapshot_saved_ = false;                                 //!< Flag to save the snapshot only once
+  bool is_log_deferred_ = false;                                   //!< Log output deferred by the real time degradation
+  std::string initial_state_snapshot_;                             //!< Snapshot of the initialized states to reuse the Monte-Carlo case
+  std::unique_ptr<EnvironmentReplay> environment_replay_;          //!< Record or replay of the environment. nullptr when it is disabled.
 
   /**
    * @fn InitializeSimulationConfiguration
@@ -96,6 +192,65 @@ class SimulationCase : public ILoggable {
    * @brief Virtual function to update target objects(spacecraft and ground station)
    */
   virtual void UpdateTargetObjects() = 0;
+
+  /**
+   * @fn SaveTargetObjectsSnapshot
+   * @brief Virtual function to write the states of the target objects to the snapshot
+   * @note Override this function to support the snapshot in the user defined simulation case
+   * @param[out] snapshot: Snapshot writer
+   */
+  virtual void SaveTargetObjectsSnapshot(SnapshotWriter& snapshot) const { UNUSED(snapshot); }
+  /**
+   * @fn LoadTargetObjectsSnapshot
+   * @brief Virtual function to restore the states of the target objects from the snapshot in the same order as SaveTargetObjectsSnapshot
+   * @param[in] snapshot: Snapshot reader
+   */
+  virtual void LoadTargetObjectsSnapshot(SnapshotReader& snapshot) { UNUSED(snapshot); }
+  /**
+   * @fn AddTargetObjectsMemoryUsage
+   * @brief Virtual function to add the memory usage of the target objects to the tree
+   * @note Override this function to report the memory usage in the user defined simulation case
+   * @param[out] memory_usage: Memory usage of the simulation case
+   */
+  virtual void AddTargetObjectsMemoryUsage(MemoryUsage& memory_usage) const { UNUSED(memory_usage); }
+  /**
+   * @fn GetOrbitLifetimeTarget
+   * @brief Virtual function to return the spacecraft of the orbit lifetime analysis
+   * @note Override this function to support the orbit lifetime mode in the user defined simulation case
+   * @return Target spacecraft. nullptr disables the orbit lifetime mode.
+   */
+  virtual const Spacecraft* GetOrbitLifetimeTarget() const { return nullptr; }
+  /**
+   * @fn FinishTargetObjects
+   * @brief Virtual function to write the results of the target objects at the end of the steps
+   * @note Override this function to output the analysis results over the whole simulation in the user defined simulation case
+   */
+  virtual void FinishTargetObjects() {}
+
+  /**
+   * @fn IsLocalSpacecraft
+   * @brief Return true when the spacecraft is simulated in this process. It is always true without the distributed simulation.
+   * @note Create only the local spacecraft in InitializeTargetObjects and register them to distributed_node_.
+   * @param[in] spacecraft_id: ID of the spacecraft
+   */
+  bool IsLocalSpacecraft(const size_t spacecraft_id) const;
+
+  /**
+   * @fn UpdateSpacecraft
+   * @brief Update the spacecraft with number_of_spacecraft_update_threads in SIMULATION_SETTINGS, and wait for the completion
+   * @note Call this function in UpdateTargetObjects instead of Spacecraft::Update of each spacecraft, and update RelativeInformation and
+   *       InterSpacecraftCommunication after that. See ParallelSpacecraftUpdater for the condition of the concurrent update.
+   * @param[in] spacecraft_list: Spacecraft to be updated
+   */
+  void UpdateSpacecraft(const std::vector<Spacecraft*>& spacecraft_list);
+
+ private:
+  /**
+   * @fn RunOrbitLifetimeAnalysis
+   * @brief Run the orbit lifetime analysis of the target spacecraft instead of the simulation steps
+   * @return False when the target spacecraft is not set
+   */
+  bool RunOrbitLifetimeAnalysis();
 };
 
 #endif  // S2E_SIMULATION_CASE_SIMULATION_CASE_HPP_
@@ -0,0 +1,55 @@
+/**
+ * @file simulation_runner.cpp
+ * @brief Step-level API to embed the simulation case in a process (e.g., the outer loop of an optimizer)
+ */
+
+#include "simulation_runner.hpp"
+
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <sstream>
+
+SimulationRunner::SimulationRunner(std::unique_ptr<SimulationCase> simulation_case) : simulation_case_(std::move(simulation_case)) {
+  if (simulation_case_ == nullptr) throw std::invalid_argument("SimulationRunner: The simulation case is null.");
+  simulation_case_->Initialize();
+
+  std::ostringstream stream(std::ios::binary);
+  simulation_case_->SaveSnapshot(stream);
+  initial_state_snapshot_ = stream.str();
+
+  simulation_case_->StartSteps();
+  is_started_ = true;
+}
+
+SimulationRunner::SimulationRunner(const std::function<std::unique_ptr<SimulationCase>(const std::string&)>& factory,
+                                   const std::string& initialize_base_file)
+    : SimulationRunner(factory(initialize_base_file)) {}
+
+SimulationRunner::~SimulationRunner() {
+  if (is_started_) simulation_case_->FinishSteps();
+}
+
+bool SimulationRunner::RegisterInMemoryFile(const std::string& file_path, const std::string& content) {
+  return IniAccess::RegisterInMemoryFile(file_path, content);
+}
+
+size_t SimulationRunner::Step(const size_t number_of_steps) {
+  size_t number_of_executed_steps = 0;
+  while (number_of_executed_steps < number_of_steps && simulation_case_->Step()) {
+    number_of_executed_steps++;
+  }
+  return number_of_executed_steps;
+}
+
+size_t SimulationRunner::RunToEnd() {
+  size_t number_of_executed_steps = 0;
+  while (simulation_case_->Step()) {
+    number_of_executed_steps++;
+  }
+  return number_of_executed_steps;
+}
+
+void SimulationRunner::Reset() {
+  std::istringstream stream(initial_state_snapshot_, std::ios::binary);
+  simulation_case_->LoadSnapshot(stream);
+  simulation_case_->StartSteps();
+}
@@ -0,0 +1,114 @@
+/**
+ * @file simulation_runner.hpp
+ * @brief Step-level API to embed the simulation case in a process (e.g., the outer loop of an optimizer)
+ */
+
+#ifndef S2E_SIMULATION_CASE_SIMULATION_RUNNER_HPP_
+#define S2E_SIMULATION_CASE_SIMULATION_RUNNER_HPP_
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "simulation_case.hpp"
+
+/**
+ * @class SimulationRunner
+ * @brief Step-level API to embed the simulation case in a process
+ * @details The runner initializes the simulation case and drives it step by step. The initialized state is kept as the snapshot, so Reset
+ *          restores it without the reconstruction and the parse of the initialize files. Many evaluations can be executed in the process by
+ *          the pattern: Reset, set the parameters of the evaluation to the target objects, Step, and read the states.
+ * @note The initialize files are parsed once in the process (see IniAccess). They can be also given in memory by RegisterInMemoryFile.
+ *       Set log_output = DISABLE in SIMULATION_SETTINGS to run without the disk logging.
+ */
+class SimulationRunner {
+ public:
+  /**
+   * @fn SimulationRunner
+   * @brief Constructor. Initialize the simulation case and prepare the step execution.
+   * @param [in] simulation_case: Simulation case which is constructed and not initialized
+   */
+  explicit SimulationRunner(std::unique_ptr<SimulationCase> simulation_case);
+  /**
+   * @fn SimulationRunner
+   * @brief Constructor with the factory of the simulation case
+   * @param [in] factory: Function to construct the simulation case with the initialize file path (e.g., [](const std::string& file) {
+   *                      return std::make_unique<SampleCase>(file); })
+   * @param [in] initialize_base_file: File path of the base initialize file
+   */
+  SimulationRunner(const std::function<std::unique_ptr<SimulationCase>(const std::string&)>& factory, const std::string& initialize_base_file);
+  /**
+   * @fn ~SimulationRunner
+   * @brief Destructor. Finish the simulation and destroy the simulation case.
+   */
+  ~SimulationRunner();
+
+  /**
+   * @fn RegisterInMemoryFile
+   * @brief Register the content of an initialize file to construct the case without the file (see IniAccess::RegisterInMemoryFile)
+   * @param [in] file_path: File path to access the content. It must end with ".ini".
+   * @param [in] content: Content in the ini format
+   * @return True when the content is parsed
+   */
+  static bool RegisterInMemoryFile(const std::string& file_path, const std::string& content);
+
+  /**
+   * @fn Step
+   * @brief Execute the simulation steps
+   * @param [in] number_of_steps: Number of the steps
+   * @return Number of the executed steps. It is less than number_of_steps when the simulation reaches the end time.
+   */
+  size_t Step(const size_t number_of_steps = 1);
+  /**
+   * @fn RunToEnd
+   * @brief Execute the simulation steps until the end time
+   * @return Number of the executed steps
+   */
+  size_t RunToEnd();
+  /**
+   * @fn Reset
+   * @brief Restore the initialized state to start the simulation again
+   * @note The states written by SaveTargetObjectsSnapshot of the simulation case are restored.
+   */
+  void Reset();
+
+  // Getters
+  /**
+   * @fn IsFinished
+   * @brief Return true when the simulation reaches the end time
+   */
+  inline bool IsFinished() const { return simulation_case_->IsFinished(); }
+  /**
+   * @fn GetElapsedTime_s
+   * @brief Return the elapsed simulation time [s]
+   */
+  inline double GetElapsedTime_s() const { return simulation_case_->GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s(); }
+  /**
+   * @fn GetGlobalEnvironment
+   * @brief Return the global environment
+   */
+  inline const GlobalEnvironment& GetGlobalEnvironment() const { return simulation_case_->GetGlobalEnvironment(); }
+  /**
+   * @fn GetSimulationCase
+   * @brief Return the simulation case
+   */
+  inline SimulationCase& GetSimulationCase() { return *simulation_case_; }
+  /**
+   * @fn GetSimulationCase
+   * @brief Return the simulation case as the user defined type to read its typed states. Throws std::invalid_argument for the other type.
+   */
+  template <typename T>
+  T& GetSimulationCase() {
+    T* simulation_case = dynamic_cast<T*>(simulation_case_.get());
+    if (simulation_case == nullptr) throw std::invalid_argument("The simulation case is not the requested type.");
+    return *simulation_case;
+  }
+
+ private:
+  std::unique_ptr<SimulationCase> simulation_case_;  //!< Simulation case
+  std::string initial_state_snapshot_;               //!< Snapshot of the initialized state
+  bool is_started_ = false;                          //!< Flag of the started step execution
+};
+
+#endif  // S2E_SIMULATION_CASE_SIMULATION_RUNNER_HPP_
@@ -0,0 +1,190 @@
+/**
+ * @file test_environment_replay.cpp
+ * @brief Test codes for EnvironmentReplay class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "environment_replay.hpp"
+#include "simulation_case.hpp"
+
+namespace {
+const std::string kReplayFile = "test_environment_replay.bin";
+const std::string kTestIniDirectory = "test_environment_replay_ini";
+const std::string kTestIniFile = kTestIniDirectory + "/sample_simulation_base.ini";
+
+/**
+ * @fn WriteTestIniFiles
+ * @brief Write the initialize files made from the sample files for the short simulation with the environment record or replay
+ * @note The directories are written as the relative paths since the values starting with '/' are read as the comments
+ * @param [in] mode: Mode of the environment replay
+ * @param [in] simulation_duration_s: Simulation duration [s]
+ */
+void WriteTestIniFiles(const EnvironmentReplay::Mode mode, const std::string& simulation_duration_s) {
+  const std::string core_directory = std::filesystem::relative(CORE_DIR_FROM_EXE).generic_string();
+  const std::string sample_directory = core_directory + "/data/sample/initialize_files";
+  // The celestial bodies are not selected to run without the SPICE kernels
+  std::map<std::string, std::string> overwritten_values = {
+      {"simulation_duration_s", simulation_duration_s}, {"log_output", "DISABLE"},        {"save_initialize_files", "DISABLE"},
+      {"log_file_save_directory", "./"},                {"number_of_selected_body", "0"}, {"event_detection", "DISABLE"}};
+  overwritten_values[mode == EnvironmentReplay::Mode::kRecord ? "environment_record_file" : "environment_replay_file"] = kReplayFile;
+
+  std::filesystem::create_directories(kTestIniDirectory);
+  for (const auto& entry : std::filesystem::directory_iterator(sample_directory)) {
+    if (entry.path().extension() != ".ini") continue;
+    std::ifstream sample_file(entry.path());
+    std::ofstream test_file(kTestIniDirectory + "/" + entry.path().filename().generic_string());
+    std::string line;
+    while (std::getline(sample_file, line)) {
+      for (const auto& value : overwritten_values) {
+        if (line.compare(0, value.first.size() + 1, value.first + " ") == 0 || line.compare(0, value.first.size() + 1, value.first + "=") == 0) {
+          line = value.first + " = " + value.second;
+        }
+      }
+      size_t position;
+      while ((position = line.find("INI_FILE_DIR_FROM_EXE")) != std::string::npos) line.replace(position, 21, kTestIniDirectory);
+      while ((position = line.find("CORE_DIR_FROM_EXE")) != std::string::npos) line.replace(position, 17, core_directory);
+      while ((position = line.find("EXT_LIB_DIR_FROM_EXE")) != std::string::npos) line.replace(position, 20, "ext_lib_dir_for_test");
+      test_file << line << "\n";
+    }
+  }
+}
+
+/**
+ * @struct CaseResult
+ * @brief Values of each step stored by the simulation case
+ */
+struct CaseResult {
+  std::vector<double> elapsed_times_s;  //!< Elapsed time
+  std::vector<double> states;           //!< State of the target object
+};
+
+/**
+ * @class TestReplayCase
+ * @brief Simulation case with a target object which stores the time and its state of each step
+ * @note The Spacecraft needs the SPICE kernels for the sun, so the target object writes and reads the spacecraft frame as the Spacecraft does.
+ */
+class TestReplayCase : public SimulationCase {
+ public:
+  /**
+   * @fn TestReplayCase
+   * @brief Constructor
+   * @param [in] seed: Seed of the state of the target object. The replay must not depend on it.
+   */
+  explicit TestReplayCase(const unsigned int seed) : SimulationCase(kTestIniFile), generator_(seed) {}
+
+  CaseResult result_;  //!< Stored values of each step
+
+ private:
+  std::mt19937 generator_;  //!< Generator of the state of the target object
+
+  void InitializeTargetObjects() override {}
+  void UpdateTargetObjects() override {
+    EnvironmentReplay* environment_replay = simulation_configuration_.environment_replay_;
+    ASSERT_NE(nullptr, environment_replay);
+    double state;
+    if (environment_replay->IsReplaying()) {
+      environment_replay->GetSpacecraftReader(0).Read(state);
+    } else {
+      state = std::uniform_real_distribution<double>(0.0, 1.0)(generator_);
+      environment_replay->GetSpacecraftWriter(0).Write(state);
+    }
+    result_.elapsed_times_s.push_back(global_environment_->GetSimulationTime().GetElapsedTime_s());
+    result_.states.push_back(state);
+  }
+};
+
+/**
+ * @fn RunCase
+ * @brief Run the simulation case and return the stored values. The record file is closed at the end of the case.
+ * @param [in] mode: Mode of the environment replay
+ * @param [in] seed: Seed of the state of the target object
+ * @param [in] simulation_duration_s: Simulation duration [s]
+ */
+CaseResult RunCase(const EnvironmentReplay::Mode mode, const unsigned int seed, const std::string& simulation_duration_s = "5") {
+  WriteTestIniFiles(mode, simulation_duration_s);
+  TestReplayCase simulation_case(seed);
+  simulation_case.Initialize();
+  simulation_case.Main();
+  IniAccess::ClearCache();
+  return simulation_case.result_;
+}
+}  // namespace
+
+/**
+ * @brief Test for the frames of the global environment and the spacecraft written and read step by step
+ */
+TEST(EnvironmentReplay, FrameRoundTrip) {
+  {
+    EnvironmentReplay record(EnvironmentReplay::Mode::kRecord, kReplayFile, 2);
+    EXPECT_TRUE(record.IsRecording());
+    EXPECT_FALSE(record.IsReplaying());
+    EXPECT_THROW(record.GetSpacecraftWriter(2), std::invalid_argument);
+    for (size_t step = 0; step < 3; step++) {
+      record.GetGlobalEnvironmentWriter().Write((double)step);
+      record.GetSpacecraftWriter(0).Write(std::vector<double>(step, 0.5));
+      // The empty frame is also kept
+      if (step != 1) record.GetSpacecraftWriter(1).Write(std::string("spacecraft1_step") + std::to_string(step));
+      record.WriteStep();
+    }
+  }
+
+  EnvironmentReplay replay(EnvironmentReplay::Mode::kReplay, kReplayFile, 2);
+  EXPECT_TRUE(replay.IsReplaying());
+  for (size_t step = 0; step < 3; step++) {
+    replay.ReadStep();
+    double time_s;
+    replay.GetGlobalEnvironmentReader().Read(time_s);
+    EXPECT_DOUBLE_EQ((double)step, time_s);
+    std::vector<double> values;
+    replay.GetSpacecraftReader(0).Read(values);
+    EXPECT_EQ(std::vector<double>(step, 0.5), values);
+    if (step != 1) {
+      std::string text;
+      replay.GetSpacecraftReader(1).Read(text);
+      EXPECT_EQ(std::string("spacecraft1_step") + std::to_string(step), text);
+    }
+  }
+  // The simulation longer than the record is rejected
+  EXPECT_THROW(replay.ReadStep(), std::invalid_argument);
+
+  // The different number of the spacecraft and the missing file are rejected
+  EXPECT_THROW(EnvironmentReplay(EnvironmentReplay::Mode::kReplay, kReplayFile, 1), std::invalid_argument);
+  std::remove(kReplayFile.c_str());
+  EXPECT_THROW(EnvironmentReplay(EnvironmentReplay::Mode::kReplay, kReplayFile, 2), std::invalid_argument);
+}
+
+/**
+ * @brief Test for the replayed time and spacecraft frame equal to the recorded simulation, and the replay longer than the record
+ */
+TEST(EnvironmentReplay, RecordAndReplaySimulation) {
+  const CaseResult record = RunCase(EnvironmentReplay::Mode::kRecord, 117);
+  // The different seed shows that the state is read from the record
+  const CaseResult replay = RunCase(EnvironmentReplay::Mode::kReplay, 118);
+
+  ASSERT_GT(record.states.size(), 1u);
+  ASSERT_EQ(record.states.size(), replay.states.size());
+  for (size_t step = 0; step < record.states.size(); step++) {
+    EXPECT_EQ(record.elapsed_times_s[step], replay.elapsed_times_s[step]) << "step " << step;
+    EXPECT_EQ(record.states[step], replay.states[step]) << "step " << step;
+  }
+  // The states differ from the ones generated by the seed of the replay
+  std::mt19937 replay_generator(118);
+  EXPECT_NE(std::uniform_real_distribution<double>(0.0, 1.0)(replay_generator), replay.states.front());
+
+  // The replay longer than the record is rejected at the end of the record
+  EXPECT_THROW(RunCase(EnvironmentReplay::Mode::kReplay, 118, "10"), std::invalid_argument);
+  IniAccess::ClearCache();
+
+  std::filesystem::remove_all(kTestIniDirectory);
+  std::remove(kReplayFile.c_str());
+}
@@ -0,0 +1,235 @@
+/**
+ * @file test_simulation_case.cpp
+ * @brief Test codes for SimulationCase class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <dynamics/attitude/attitude_rk4.hpp>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include "simulation_case.hpp"
+
+namespace {
+const std::string kTestIniFile = "test_simulation_case.ini";
+
+/**
+ * @fn WriteTestIniFile
+ * @brief Write the initialize base file made from the sample file for the short simulation without the log output and external libraries
+ */
+void WriteTestIniFile() {
+  const std::string ini_directory = std::string(CORE_DIR_FROM_EXE) + "/data/sample/initialize_files";
+  // The celestial bodies are not selected to run without the SPICE kernels
+  const std::map<std::string, std::string> overwritten_values = {{"simulation_duration_s", "20"},     {"log_output", "DISABLE"},
+                                                                 {"save_initialize_files", "DISABLE"}, {"log_file_save_directory", "./"},
+                                                                 {"number_of_selected_body", "0"},     {"event_detection", "DISABLE"}};
+
+  std::ifstream sample_file(ini_directory + "/sample_simulation_base.ini");
+  std::ofstream test_file(kTestIniFile);
+  std::string line;
+  while (std::getline(sample_file, line)) {
+    for (const auto& value : overwritten_values) {
+      if (line.compare(0, value.first.size() + 1, value.first + " ") == 0 || line.compare(0, value.first.size() + 1, value.first + "=") == 0) {
+        line = value.first + " = " + value.second;
+      }
+    }
+    size_t position;
+    while ((position = line.find("INI_FILE_DIR_FROM_EXE")) != std::string::npos) line.replace(position, 21, ini_directory);
+    while ((position = line.find("EXT_LIB_DIR_FROM_EXE")) != std::string::npos) line.replace(position, 20, "ext_lib_dir_for_test");
+    test_file << line << "\n";
+  }
+}
+
+/**
+ * @class TestSimulationCase
+ * @brief Simulation case with an attitude randomized by the Monte-Carlo simulation
+ */
+class TestSimulationCase : public SimulationCase {
+ public:
+  TestSimulationCase(const MonteCarloSimulationExecutor& monte_carlo_simulator)
+      : SimulationCase(kTestIniFile, monte_carlo_simulator, "./") {}
+
+  const AttitudeRk4& GetAttitude() const { return *attitude_; }
+
+ private:
+  libra::Matrix<3, 3> inertia_tensor_kgm2_{0.0};  //!< Inertia tensor referred by the attitude
+  std::unique_ptr<AttitudeRk4> attitude_;
+
+  void InitializeTargetObjects() override {
+    inertia_tensor_kgm2_[0][0] = 0.1;
+    inertia_tensor_kgm2_[1][1] = 0.2;
+    inertia_tensor_kgm2_[2][2] = 0.3;
+    libra::Vector<3> torque_b_Nm(0.0);
+    torque_b_Nm[0] = 1.0e-4;
+    attitude_ = std::make_unique<AttitudeRk4>(libra::Vector<3>(0.0), libra::Quaternion(0.0, 0.0, 0.0, 1.0), inertia_tensor_kgm2_, torque_b_Nm,
+                                              0.01, "attitude0");
+  }
+  void UpdateTargetObjects() override {
+    const SimulationTime& simulation_time = global_environment_->GetSimulationTime();
+    if (simulation_time.GetAttitudePropagateFlag()) attitude_->Propagate(simulation_time.GetElapsedTime_s());
+  }
+  void SaveTargetObjectsSnapshot(SnapshotWriter& snapshot) const override { attitude_->SaveSnapshot(snapshot); }
+  void LoadTargetObjectsSnapshot(SnapshotReader& snapshot) override { attitude_->LoadSnapshot(snapshot); }
+};
+
+/**
+ * @fn ExecuteTestCases
+ * @brief Execute the Monte-Carlo simulation with the test case and return the final attitude of each case
+ * @param [in] is_case_reuse_enabled: Flag to reuse the simulation case
+ * @param [out] number_of_created_cases: Number of the constructed simulation cases
+ */
+std::map<unsigned long long, libra::Quaternion> ExecuteTestCases(const bool is_case_reuse_enabled, size_t& number_of_created_cases) {
+  MonteCarloSimulationExecutor monte_carlo_simulator(4);
+  monte_carlo_simulator.SetSeed(0x11223344, true);
+  monte_carlo_simulator.SetCaseReuse(is_case_reuse_enabled);
+  monte_carlo_simulator.AddInitializedMonteCarloParameter("attitude0", "angular_velocity_b_rad_s", libra::Vector<3>(0.0), libra::Vector<3>(0.05),
+                                                          InitializedMonteCarloParameters::RandomizationType::kCartesianNormal);
+
+  std::map<unsigned long long, libra::Quaternion> final_quaternions_i2b;
+  std::mutex mutex;
+  number_of_created_cases = 0;
+  monte_carlo_simulator.ExecuteWithReuse<TestSimulationCase>(
+      [&](const MonteCarloSimulationExecutor& case_executor) {
+        std::unique_ptr<TestSimulationCase> simulation_case = std::make_unique<TestSimulationCase>(case_executor);
+        simulation_case->Initialize();
+        number_of_created_cases++;
+        return simulation_case;
+      },
+      [&](TestSimulationCase& simulation_case, const MonteCarloSimulationExecutor& case_executor) {
+        simulation_case.ResetForMonteCarloCase(case_executor);
+        simulation_case.Main();
+        std::lock_guard<std::mutex> lock(mutex);
+        final_quaternions_i2b[case_executor.GetCaseIndex()] = simulation_case.GetAttitude().GetQuaternion_i2b();
+      });
+  return final_quaternions_i2b;
+}
+
+/**
+ * @fn ExecuteParallelCases
+ * @brief Execute the Monte-Carlo simulation with Execute and return the final attitude of each case
+ * @param [in] number_of_threads: Number of the worker threads. The cases are executed with the sequential loop of WillExecuteNextCase when
+ *                                it is zero.
+ */
+std::map<unsigned long long, libra::Quaternion> ExecuteParallelCases(const unsigned int number_of_threads) {
+  MonteCarloSimulationExecutor monte_carlo_simulator(6);
+  monte_carlo_simulator.SetSeed(0x11223344, true);
+  monte_carlo_simulator.SetNumberOfThreads(number_of_threads);
+  monte_carlo_simulator.AddInitializedMonteCarloParameter("attitude0", "angular_velocity_b_rad_s", libra::Vector<3>(0.0), libra::Vector<3>(0.05),
+                                                          InitializedMonteCarloParameters::RandomizationType::kCartesianNormal);
+
+  std::map<unsigned long long, libra::Quaternion> final_quaternions_i2b;
+  if (number_of_threads == 0) {
+    while (monte_carlo_simulator.WillExecuteNextCase()) {
+      monte_carlo_simulator.RandomizeAllParameters();
+      monte_carlo_simulator.AtTheBeginningOfEachCase();
+      TestSimulationCase simulation_case(monte_carlo_simulator);
+      simulation_case.Initialize();
+      simulation_case.Main();
+      final_quaternions_i2b[monte_carlo_simulator.GetCaseIndex()] = simulation_case.GetAttitude().GetQuaternion_i2b();
+      monte_carlo_simulator.AtTheEndOfEachCase();
+    }
+    return final_quaternions_i2b;
+  }
+
+  std::mutex mutex;
+  monte_carlo_simulator.Execute([&](const MonteCarloSimulationExecutor& case_executor) {
+    TestSimulationCase simulation_case(case_executor);
+    simulation_case.Initialize();
+    simulation_case.Main();
+    std::lock_guard<std::mutex> lock(mutex);
+    final_quaternions_i2b[case_executor.GetCaseIndex()] = simulation_case.GetAttitude().GetQuaternion_i2b();
+  });
+  return final_quaternions_i2b;
+}
+}  // namespace
+
+/**
+ * @brief Test for the reused Monte-Carlo cases against the cases constructed for each execution
+ */
+TEST(SimulationCase, MonteCarloCaseReuse) {
+  WriteTestIniFile();
+  size_t number_of_fresh_cases, number_of_reused_cases;
+  const std::map<unsigned long long, libra::Quaternion> fresh_results = ExecuteTestCases(false, number_of_fresh_cases);
+  const std::map<unsigned long long, libra::Quaternion> reused_results = ExecuteTestCases(true, number_of_reused_cases);
+  std::remove(kTestIniFile.c_str());
+
+  EXPECT_EQ(4, number_of_fresh_cases);
+  EXPECT_EQ(1, number_of_reused_cases);
+  ASSERT_EQ(4, fresh_results.size());
+  ASSERT_EQ(4, reused_results.size());
+  for (const auto& fresh_result : fresh_results) {
+    const libra::Quaternion& reused_quaternion_i2b = reused_results.at(fresh_result.first);
+    for (size_t i = 0; i < 4; i++) {
+      EXPECT_DOUBLE_EQ(fresh_result.second[i], reused_quaternion_i2b[i]);
+    }
+  }
+  // The cases are randomized
+  EXPECT_NE(fresh_results.at(0)[0], fresh_results.at(1)[0]);
+}
+
+/**
+ * @brief Test for the parallel Monte-Carlo execution against the sequential loop
+ */
+TEST(SimulationCase, MonteCarloParallelExecution) {
+  WriteTestIniFile();
+  const std::map<unsigned long long, libra::Quaternion> sequential_results = ExecuteParallelCases(0);
+  const std::map<unsigned long long, libra::Quaternion> single_thread_results = ExecuteParallelCases(1);
+  const std::map<unsigned long long, libra::Quaternion> multi_thread_results = ExecuteParallelCases(3);
+  std::remove(kTestIniFile.c_str());
+
+  ASSERT_EQ(6, sequential_results.size());
+  ASSERT_EQ(6, single_thread_results.size());
+  ASSERT_EQ(6, multi_thread_results.size());
+  // The results do not depend on the number of threads since the cases are seeded with the case index
+  for (const auto& sequential_result : sequential_results) {
+    for (size_t i = 0; i < 4; i++) {
+      EXPECT_DOUBLE_EQ(sequential_result.second[i], single_thread_results.at(sequential_result.first)[i]);
+      EXPECT_DOUBLE_EQ(sequential_result.second[i], multi_thread_results.at(sequential_result.first)[i]);
+    }
+  }
+}
+
+/**
+ * @brief Test for the simulation resumed from the snapshot against the continued simulation
+ */
+TEST(SimulationCase, Snapshot) {
+  WriteTestIniFile();
+  MonteCarloSimulationExecutor monte_carlo_simulator(1);
+
+  // The cases are constructed one by one since the simulation object names are unique
+  std::stringstream stream;
+  double saved_time_s, original_end_time_s;
+  libra::Quaternion original_quaternion_i2b;
+  {
+    TestSimulationCase original_case(monte_carlo_simulator);
+    original_case.Initialize();
+    original_case.StartSteps();
+    while (original_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s() < 10.0) original_case.Step();
+    original_case.SaveSnapshot(stream);
+    saved_time_s = original_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s();
+    while (original_case.Step()) {
+    }
+    original_case.FinishSteps();
+    original_end_time_s = original_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s();
+    original_quaternion_i2b = original_case.GetAttitude().GetQuaternion_i2b();
+  }
+
+  TestSimulationCase resumed_case(monte_carlo_simulator);
+  resumed_case.Initialize();
+  resumed_case.LoadSnapshot(stream);
+  EXPECT_DOUBLE_EQ(saved_time_s, resumed_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s());
+  resumed_case.Main();
+  std::remove(kTestIniFile.c_str());
+
+  EXPECT_DOUBLE_EQ(original_end_time_s, resumed_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s());
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_DOUBLE_EQ(original_quaternion_i2b[i], resumed_case.GetAttitude().GetQuaternion_i2b()[i]);
+  }
+  // The attitude is propagated after the snapshot
+  EXPECT_NE(1.0, original_quaternion_i2b[3]);
+}
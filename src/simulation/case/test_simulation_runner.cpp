@@ -0,0 +1,138 @@
+/**
+ * @file test_simulation_runner.cpp
+ * @brief Test codes for SimulationRunner class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <dynamics/attitude/attitude_rk4.hpp>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "simulation_runner.hpp"
+
+namespace {
+const std::string kTestIniFile = "test_simulation_runner.ini";
+
+/**
+ * @fn RegisterTestIniFile
+ * @brief Register the initialize base file made from the sample file in memory for the 2 s simulation without the log output
+ */
+void RegisterTestIniFile() {
+  const std::string ini_directory = std::string(CORE_DIR_FROM_EXE) + "/data/sample/initialize_files";
+  // The celestial bodies are not selected to run without the SPICE kernels
+  const std::map<std::string, std::string> overwritten_values = {{"simulation_duration_s", "2"},      {"log_output", "DISABLE"},
+                                                                 {"save_initialize_files", "DISABLE"}, {"log_file_save_directory", "./"},
+                                                                 {"number_of_selected_body", "0"},     {"event_detection", "DISABLE"}};
+
+  std::ifstream sample_file(ini_directory + "/sample_simulation_base.ini");
+  std::stringstream content;
+  std::string line;
+  while (std::getline(sample_file, line)) {
+    for (const auto& value : overwritten_values) {
+      if (line.compare(0, value.first.size() + 1, value.first + " ") == 0 || line.compare(0, value.first.size() + 1, value.first + "=") == 0) {
+        line = value.first + " = " + value.second;
+      }
+    }
+    size_t position;
+    while ((position = line.find("INI_FILE_DIR_FROM_EXE")) != std::string::npos) line.replace(position, 21, ini_directory);
+    while ((position = line.find("EXT_LIB_DIR_FROM_EXE")) != std::string::npos) line.replace(position, 20, "ext_lib_dir_for_test");
+    content << line << "\n";
+  }
+  ASSERT_TRUE(SimulationRunner::RegisterInMemoryFile(kTestIniFile, content.str()));
+}
+
+/**
+ * @class TestRunnerCase
+ * @brief Simulation case with an attitude driven by a constant torque
+ */
+class TestRunnerCase : public SimulationCase {
+ public:
+  explicit TestRunnerCase(const std::string& initialize_base_file) : SimulationCase(initialize_base_file) {}
+
+  AttitudeRk4& GetAttitude() { return *attitude_; }
+
+ private:
+  libra::Matrix<3, 3> inertia_tensor_kgm2_{0.0};  //!< Inertia tensor referred by the attitude
+  std::unique_ptr<AttitudeRk4> attitude_;
+
+  void InitializeTargetObjects() override {
+    inertia_tensor_kgm2_[0][0] = 0.1;
+    inertia_tensor_kgm2_[1][1] = 0.2;
+    inertia_tensor_kgm2_[2][2] = 0.3;
+    libra::Vector<3> torque_b_Nm(0.0);
+    torque_b_Nm[0] = 1.0e-4;
+    attitude_ = std::make_unique<AttitudeRk4>(libra::Vector<3>(0.0), libra::Quaternion(0.0, 0.0, 0.0, 1.0), inertia_tensor_kgm2_, torque_b_Nm,
+                                              0.01, "runner_attitude");
+  }
+  void UpdateTargetObjects() override {
+    const SimulationTime& simulation_time = global_environment_->GetSimulationTime();
+    if (simulation_time.GetAttitudePropagateFlag()) attitude_->Propagate(simulation_time.GetElapsedTime_s());
+  }
+  void SaveTargetObjectsSnapshot(SnapshotWriter& snapshot) const override { attitude_->SaveSnapshot(snapshot); }
+  void LoadTargetObjectsSnapshot(SnapshotReader& snapshot) override { attitude_->LoadSnapshot(snapshot); }
+};
+}  // namespace
+
+/**
+ * @brief Test for the step execution and the reset to the initialized state
+ */
+TEST(SimulationRunner, ResetAndStep) {
+  RegisterTestIniFile();
+  SimulationRunner runner([](const std::string& file) { return std::make_unique<TestRunnerCase>(file); }, kTestIniFile);
+  AttitudeRk4& attitude = runner.GetSimulationCase<TestRunnerCase>().GetAttitude();
+  EXPECT_THROW(runner.GetSimulationCase<SimulationRunner>(), std::invalid_argument);
+
+  EXPECT_EQ(5u, runner.Step(5));
+  const double elapsed_time_s = runner.GetElapsedTime_s();
+  EXPECT_GT(elapsed_time_s, 0.0);
+  const libra::Quaternion quaternion_i2b = attitude.GetQuaternion_i2b();
+  const size_t number_of_remaining_steps = runner.RunToEnd();
+  EXPECT_GT(number_of_remaining_steps, 0u);
+  EXPECT_TRUE(runner.IsFinished());
+  EXPECT_EQ(0u, runner.Step());
+  const libra::Quaternion final_quaternion_i2b = attitude.GetQuaternion_i2b();
+
+  // The reset restores the initialized state and the same steps give the same result
+  runner.Reset();
+  EXPECT_FALSE(runner.IsFinished());
+  EXPECT_DOUBLE_EQ(0.0, runner.GetElapsedTime_s());
+  EXPECT_DOUBLE_EQ(1.0, attitude.GetQuaternion_i2b()[3]);
+  EXPECT_EQ(5u, runner.Step(5));
+  EXPECT_DOUBLE_EQ(elapsed_time_s, runner.GetElapsedTime_s());
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_DOUBLE_EQ(quaternion_i2b[i], attitude.GetQuaternion_i2b()[i]);
+  }
+  EXPECT_EQ(number_of_remaining_steps, runner.Step(number_of_remaining_steps + 10));
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_DOUBLE_EQ(final_quaternion_i2b[i], attitude.GetQuaternion_i2b()[i]);
+  }
+
+  // The parameters set after the reset are used in the evaluation
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[2] = 0.1;
+  libra::Quaternion spinning_quaternion_i2b;
+  for (size_t evaluation = 0; evaluation < 2; evaluation++) {
+    runner.Reset();
+    attitude.SetAngularVelocity_b_rad_s(angular_velocity_b_rad_s);
+    runner.RunToEnd();
+    if (evaluation == 0) {
+      spinning_quaternion_i2b = attitude.GetQuaternion_i2b();
+      EXPECT_NE(final_quaternion_i2b[2], spinning_quaternion_i2b[2]);
+    } else {
+      for (size_t i = 0; i < 4; i++) {
+        EXPECT_DOUBLE_EQ(spinning_quaternion_i2b[i], attitude.GetQuaternion_i2b()[i]);
+      }
+    }
+  }
+  IniAccess::ClearCache();
+}
+
+/**
+ * @brief Test for the null simulation case
+ */
+TEST(SimulationRunner, NullCase) { EXPECT_THROW(SimulationRunner runner(nullptr), std::invalid_argument); }
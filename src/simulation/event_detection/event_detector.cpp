@@ -0,0 +1,109 @@
+/**
+ * @file event_detector.cpp
+ * @brief Class to detect events (e.g., eclipse, AOS/LOS, and node crossings) with switching functions
+ */
+
+#include "event_detector.hpp"
+
+#include <algorithm>
+#include <logger/log_utility.hpp>
+#include <math_physics/math/interpolation.hpp>
+#include <math_physics/math/root_finding.hpp>
+
+void EventDetector::AddSwitchingFunction(const std::function<double()> switching_function, const std::string rising_event_name,
+                                         const std::string falling_event_name) {
+  SwitchingFunction new_function;
+  new_function.function_ = switching_function;
+  new_function.rising_event_name_ = rising_event_name;
+  new_function.falling_event_name_ = falling_event_name;
+  switching_functions_.push_back(new_function);
+}
+
+void EventDetector::LogSetup(const Logger& main_logger) {
+  if (switching_functions_.empty() || !main_logger.IsEnabled()) return;
+
+  // The event log is written in the same directory with the main log
+  event_logger_ = std::make_unique<Logger>("event.csv", main_logger.GetLogPath(), "", false, true, false);
+  event_logger_->AddLogList(this);
+  event_logger_->WriteHeaders();
+}
+
+void EventDetector::Reset() {
+  for (auto& switching_function : switching_functions_) {
+    switching_function.times_s_.clear();
+    switching_function.values_.clear();
+  }
+  detected_events_.clear();
+}
+
+void EventDetector::Update(const double time_s) {
+  std::vector<DetectedEvent> new_events;
+  for (auto& switching_function : switching_functions_) {
+    // Skip the duplicated sample at the same time (e.g., the first step after the initialization)
+    if (!switching_function.times_s_.empty() && time_s <= switching_function.times_s_.back()) continue;
+
+    switching_function.times_s_.push_back(time_s);
+    switching_function.values_.push_back(switching_function.function_());
+    if (switching_function.times_s_.size() > kNumberOfSamples) {
+      switching_function.times_s_.pop_front();
+      switching_function.values_.pop_front();
+    }
+    const size_t number_of_samples = switching_function.values_.size();
+    if (number_of_samples < 2) continue;
+
+    // Detect the sign change between the previous and the current samples
+    const double previous_value = switching_function.values_[number_of_samples - 2];
+    const double current_value = switching_function.values_[number_of_samples - 1];
+    DetectedEvent event;
+    if (previous_value < 0.0 && current_value >= 0.0) {
+      event.name_ = switching_function.rising_event_name_;
+    } else if (previous_value >= 0.0 && current_value < 0.0) {
+      event.name_ = switching_function.falling_event_name_;
+    } else {
+      continue;
+    }
+    event.time_s_ = CalcEventTime_s(switching_function);
+    new_events.push_back(event);
+  }
+
+  // Write the events in the time order
+  std::sort(new_events.begin(), new_events.end(), [](const DetectedEvent& lhs, const DetectedEvent& rhs) { return lhs.time_s_ < rhs.time_s_; });
+  for (const auto& event : new_events) {
+    detected_events_.push_back(event);
+    if (event_logger_ != nullptr) event_logger_->WriteValues();
+    if (event_listener_) event_listener_(event);
+  }
+}
+
+double EventDetector::CalcEventTime_s(const SwitchingFunction& switching_function) const {
+  const size_t number_of_samples = switching_function.times_s_.size();
+  const double lower_time_s = switching_function.times_s_[number_of_samples - 2];
+  const double upper_time_s = switching_function.times_s_[number_of_samples - 1];
+
+  // Polynomial interpolation of the switching function with the latest samples as the dense output
+  std::vector<double> times_s(switching_function.times_s_.begin(), switching_function.times_s_.end());
+  std::vector<double> values(switching_function.values_.begin(), switching_function.values_.end());
+  libra::Interpolation interpolation(times_s, values);
+
+  return libra::CalcRootWithBrentMethod([&](const double time_s) { return interpolation.CalcPolynomial(time_s); }, lower_time_s, upper_time_s,
+                                        kTimeTolerance_s);
+}
+
+std::string EventDetector::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  str_tmp += WriteScalar("event_time", "s");
+  str_tmp += WriteScalar("event_name");
+
+  return str_tmp;
+}
+
+std::string EventDetector::GetLogValue() const {
+  std::string str_tmp = "";
+
+  if (detected_events_.empty()) return str_tmp;
+  str_tmp += WriteScalar(detected_events_.back().time_s_, 15);
+  str_tmp += WriteScalar(detected_events_.back().name_);
+
+  return str_tmp;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file event_detector.hpp
+ * @brief Class to detect events (e.g., eclipse, AOS/LOS, and node crossings) with switching functions
+ */
+
+#ifndef S2E_SIMULATION_EVENT_DETECTION_EVENT_DETECTOR_HPP_
+#define S2E_SIMULATION_EVENT_DETECTION_EVENT_DETECTOR_HPP_
+
+#include <deque>
+#include <functional>
+#include <logger/loggable.hpp>
+#include <logger/logger.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct DetectedEvent
+ * @brief Information of a detected event
+ */
+struct DetectedEvent {
+  std::string name_;  //!< Event name
+  double time_s_;     //!< Elapsed time of the event [sec]
+};
+
+/**
+ * @class EventDetector
+ * @brief Class to detect events with switching functions
+ * @details The switching functions are evaluated at each simulation step, and the sign changes between the steps are detected. The event
+ *          time is refined with Brent's method on the polynomial interpolation of the latest samples of the switching function, so the
+ *          events are detected accurately with a coarse simulation step. The detected events are written in a compact event log file.
+ */
+class EventDetector : public ILoggable {
+ public:
+  /**
+   * @fn EventDetector
+   * @brief Constructor
+   */
+  EventDetector() {}
+  /**
+   * @fn ~EventDetector
+   * @brief Destructor
+   */
+  ~EventDetector() {}
+
+  /**
+   * @fn AddSwitchingFunction
+   * @brief Add a switching function to be monitored
+   * @param [in] switching_function: Function returning the value of the switching function at the current simulation time
+   * @param [in] rising_event_name: Event name when the switching function changes from negative to positive
+   * @param [in] falling_event_name: Event name when the switching function changes from positive to negative
+   */
+  void AddSwitchingFunction(const std::function<double()> switching_function, const std::string rising_event_name,
+                            const std::string falling_event_name);
+
+  /**
+   * @fn SetEventListener
+   * @brief Set the function called with each detected event (e.g., to trigger the flight recorder of the logger)
+   * @param [in] event_listener: Function called in the time order of the events
+   */
+  inline void SetEventListener(const std::function<void(const DetectedEvent&)> event_listener) { event_listener_ = event_listener; }
+
+  /**
+   * @fn LogSetup
+   * @brief Create the event log file in the log directory of the main logger
+   * @note The file is not created when no switching function is added
+   * @param [in] main_logger: Main logger
+   */
+  void LogSetup(const Logger& main_logger);
+
+  /**
+   * @fn Update
+   * @brief Evaluate the switching functions and detect the events between the previous and the current time
+   * @param [in] time_s: Current elapsed time [sec]
+   */
+  void Update(const double time_s);
+  /**
+   * @fn Reset
+   * @brief Clear the samples and the detected events to restart the detection from the initial time (e.g., reused Monte-Carlo case)
+   */
+  void Reset();
+
+  // Getters
+  /**
+   * @fn GetDetectedEvents
+   * @brief Return all detected events in the time order of the detection
+   */
+  inline const std::vector<DetectedEvent>& GetDetectedEvents() const { return detected_events_; }
+  /**
+   * @fn GetNumberOfSwitchingFunctions
+   * @brief Return number of the switching functions
+   */
+  inline size_t GetNumberOfSwitchingFunctions() const { return switching_functions_.size(); }
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable to write the latest event
+   */
+  virtual std::string GetLogValue() const;
+
+ private:
+  static const size_t kNumberOfSamples = 4;           //!< Number of samples for the interpolation (Cubic polynomial)
+  static constexpr double kTimeTolerance_s = 1.0e-6;  //!< Tolerance of the event time [sec]
+
+  /**
+   * @struct SwitchingFunction
+   * @brief Switching function and its latest samples
+   */
+  struct SwitchingFunction {
+    std::function<double()> function_;  //!< Switching function
+    std::string rising_event_name_;     //!< Event name for the change from negative to positive
+    std::string falling_event_name_;    //!< Event name for the change from positive to negative
+    std::deque<double> times_s_;        //!< Elapsed time of the latest samples [sec]
+    std::deque<double> values_;         //!< Values of the latest samples
+  };
+
+  std::vector<SwitchingFunction> switching_functions_;        //!< Switching functions
+  std::vector<DetectedEvent> detected_events_;                //!< Detected events
+  std::unique_ptr<Logger> event_logger_;                      //!< Logger for the event log file
+  std::function<void(const DetectedEvent&)> event_listener_;  //!< Function called with each detected event
+
+  /**
+   * @fn CalcEventTime_s
+   * @brief Refine the event time between the latest two samples
+   * @param [in] switching_function: Switching function with the samples
+   * @return Event time [sec]
+   */
+  double CalcEventTime_s(const SwitchingFunction& switching_function) const;
+};
+
+#endif  // S2E_SIMULATION_EVENT_DETECTION_EVENT_DETECTOR_HPP_
@@ -0,0 +1,78 @@
+/**
+ * @file test_event_detector.cpp
+ * @brief Test codes for EventDetector class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "event_detector.hpp"
+
+namespace {
+const double kPeriod_s = 100.0;
+const double kPhase_s = 23.0;
+}  // namespace
+
+/**
+ * @brief Test for the event times refined between the coarse steps
+ */
+TEST(EventDetector, EventTime) {
+  double time_s = 0.0;
+  EventDetector event_detector;
+  // Sine wave rising at kPhase_s + n * kPeriod_s and falling at kPhase_s + (n + 0.5) * kPeriod_s
+  event_detector.AddSwitchingFunction([&]() { return sin(2.0 * M_PI * (time_s - kPhase_s) / kPeriod_s); }, "RISE", "FALL");
+  std::vector<DetectedEvent> listened_events;
+  event_detector.SetEventListener([&](const DetectedEvent& event) { listened_events.push_back(event); });
+
+  const double step_s = 5.0;
+  for (size_t step = 0; step <= 60; step++) {
+    time_s = step * step_s;
+    event_detector.Update(time_s);
+    // The duplicated sample at the same time is skipped
+    event_detector.Update(time_s);
+  }
+
+  const std::vector<DetectedEvent>& events = event_detector.GetDetectedEvents();
+  ASSERT_EQ(6, events.size());
+  for (size_t i = 0; i < events.size(); i++) {
+    const bool is_rising = (i % 2 == 0);
+    const double expected_time_s = kPhase_s + i * 0.5 * kPeriod_s;
+    EXPECT_EQ(is_rising ? "RISE" : "FALL", events[i].name_);
+    // The error is much smaller than the step with the cubic interpolation
+    EXPECT_NEAR(expected_time_s, events[i].time_s_, 0.01);
+    EXPECT_EQ(events[i].name_, listened_events[i].name_);
+    EXPECT_DOUBLE_EQ(events[i].time_s_, listened_events[i].time_s_);
+  }
+
+  // The detection restarts after the reset
+  event_detector.Reset();
+  EXPECT_EQ(0, event_detector.GetDetectedEvents().size());
+  time_s = 0.0;
+  event_detector.Update(time_s);
+  EXPECT_EQ(0, event_detector.GetDetectedEvents().size());
+}
+
+/**
+ * @brief Test for the time order of the events detected in the same step
+ */
+TEST(EventDetector, TimeOrder) {
+  double time_s = 0.0;
+  EventDetector event_detector;
+  event_detector.AddSwitchingFunction([&]() { return time_s - 7.0; }, "LATE", "");
+  event_detector.AddSwitchingFunction([&]() { return time_s - 3.0; }, "EARLY", "");
+  EXPECT_EQ(2, event_detector.GetNumberOfSwitchingFunctions());
+
+  for (size_t step = 0; step <= 2; step++) {
+    time_s = step * 10.0;
+    event_detector.Update(time_s);
+  }
+
+  const std::vector<DetectedEvent>& events = event_detector.GetDetectedEvents();
+  ASSERT_EQ(2, events.size());
+  EXPECT_EQ("EARLY", events[0].name_);
+  EXPECT_NEAR(3.0, events[0].time_s_, 1.0e-6);
+  EXPECT_EQ("LATE", events[1].name_);
+  EXPECT_NEAR(7.0, events[1].time_s_, 1.0e-6);
+}
@@ -0,0 +1,167 @@
+/**
+ * @file coverage_map.cpp
+ * @brief Class to accumulate the ground coverage and the revisit statistics of the spacecraft on a latitude-longitude grid
+ */
+
+#include "coverage_map.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <math_physics/math/constants.hpp>
+#include <thread>
+
+CoverageMap::CoverageMap(const size_t number_of_latitude_cells, const size_t number_of_longitude_cells, const double pass_gap_s)
+    : number_of_latitude_cells_(std::max(number_of_latitude_cells, (size_t)1)),
+      number_of_longitude_cells_(std::max(number_of_longitude_cells, (size_t)1)),
+      pass_gap_s_(pass_gap_s) {
+  latitude_step_rad_ = libra::pi / (double)number_of_latitude_cells_;
+  longitude_step_rad_ = libra::tau / (double)number_of_longitude_cells_;
+  const size_t number_of_cells = number_of_latitude_cells_ * number_of_longitude_cells_;
+  last_covered_time_s_.assign(number_of_cells, 0.0);
+  number_of_passes_.assign(number_of_cells, 0);
+  max_revisit_time_s_.assign(number_of_cells, 0.0);
+  total_revisit_time_s_.assign(number_of_cells, 0.0);
+}
+
+CoverageFootprint CoverageMap::CalcFootprint(const GeodeticPosition& position, const double half_angle_rad, const double earth_radius_m) {
+  const double ratio = (earth_radius_m + position.GetAltitude_m()) / earth_radius_m;
+  // Nadir angle to the horizon
+  const double sin_nadir_angle = ratio * std::sin(half_angle_rad);
+
+  CoverageFootprint footprint;
+  footprint.latitude_rad_ = position.GetLatitude_rad();
+  footprint.longitude_rad_ = position.GetLongitude_rad();
+  if (sin_nadir_angle >= 1.0) {
+    footprint.central_angle_rad_ = std::acos(1.0 / ratio);
+  } else {
+    footprint.central_angle_rad_ = std::asin(sin_nadir_angle) - half_angle_rad;
+  }
+  return footprint;
+}
+
+void CoverageMap::Update(const std::vector<CoverageFootprint>& footprints, const double time_s, const unsigned int number_of_threads) {
+  if (footprints.empty()) return;
+
+  // The threads update their own latitude bands, so no lock is needed
+  const size_t number_of_bands = std::max((size_t)1, std::min((size_t)number_of_threads, number_of_latitude_cells_));
+  const size_t band_size = (number_of_latitude_cells_ + number_of_bands - 1) / number_of_bands;
+  std::vector<std::thread> threads;
+  for (size_t band = 1; band < number_of_bands; band++) {
+    const size_t begin_row = band * band_size;
+    const size_t end_row = std::min(begin_row + band_size, number_of_latitude_cells_);
+    if (begin_row >= end_row) break;
+    threads.emplace_back(&CoverageMap::UpdateRows, this, std::cref(footprints), time_s, begin_row, end_row);
+  }
+  UpdateRows(footprints, time_s, 0, std::min(band_size, number_of_latitude_cells_));
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void CoverageMap::UpdateRows(const std::vector<CoverageFootprint>& footprints, const double time_s, const size_t begin_row, const size_t end_row) {
+  const double band_min_latitude_rad = -libra::pi_2 + latitude_step_rad_ * (double)begin_row;
+  const double band_max_latitude_rad = -libra::pi_2 + latitude_step_rad_ * (double)end_row;
+
+  for (const auto& footprint : footprints) {
+    const double central_angle_rad = footprint.central_angle_rad_;
+    if (central_angle_rad <= 0.0) continue;
+    // Rows of the cell centers in the footprint
+    const double min_latitude_rad = std::max(footprint.latitude_rad_ - central_angle_rad, band_min_latitude_rad);
+    const double max_latitude_rad = std::min(footprint.latitude_rad_ + central_angle_rad, band_max_latitude_rad);
+    if (min_latitude_rad > max_latitude_rad) continue;
+    const double first_row_position = std::max(std::ceil((min_latitude_rad + libra::pi_2) / latitude_step_rad_ - 0.5), (double)begin_row);
+    const double last_row_position = std::min(std::floor((max_latitude_rad + libra::pi_2) / latitude_step_rad_ - 0.5), (double)end_row - 1.0);
+    if (first_row_position > last_row_position) continue;
+
+    const double sin_center_latitude = std::sin(footprint.latitude_rad_);
+    const double cos_center_latitude = std::cos(footprint.latitude_rad_);
+    const double cos_central_angle = std::cos(central_angle_rad);
+    for (size_t row = (size_t)first_row_position; row <= (size_t)last_row_position; row++) {
+      // Longitude half width of the spherical cap at the latitude of the row
+      const double latitude_rad = -libra::pi_2 + latitude_step_rad_ * ((double)row + 0.5);
+      const double denominator = std::cos(latitude_rad) * cos_center_latitude;
+      double half_width_rad = libra::pi;
+      if (denominator > 0.0) {
+        const double cos_half_width = (cos_central_angle - std::sin(latitude_rad) * sin_center_latitude) / denominator;
+        if (cos_half_width > 1.0) continue;
+        half_width_rad = cos_half_width < -1.0 ? libra::pi : std::acos(cos_half_width);
+      }
+
+      // Columns of the cell centers in the longitude range with the wrap around
+      const double first_position = std::ceil((footprint.longitude_rad_ - half_width_rad + libra::pi) / longitude_step_rad_ - 0.5);
+      const double last_position = std::floor((footprint.longitude_rad_ + half_width_rad + libra::pi) / longitude_step_rad_ - 0.5);
+      if (first_position > last_position) continue;
+      const size_t number_of_columns = std::min((size_t)(last_position - first_position) + 1, number_of_longitude_cells_);
+      const long long columns = (long long)number_of_longitude_cells_;
+      size_t column = (size_t)((((long long)first_position % columns) + columns) % columns);
+      const size_t row_offset = row * number_of_longitude_cells_;
+      for (size_t i = 0; i < number_of_columns; i++) {
+        UpdateCell(row_offset + column, time_s);
+        column++;
+        if (column == number_of_longitude_cells_) column = 0;
+      }
+    }
+  }
+}
+
+void CoverageMap::UpdateCell(const size_t index, const double time_s) {
+  if (number_of_passes_[index] == 0) {
+    number_of_passes_[index] = 1;
+  } else {
+    const double interval_s = time_s - last_covered_time_s_[index];
+    if (interval_s <= 0.0) return;  // Already covered by another spacecraft in the step
+    if (interval_s > pass_gap_s_) {
+      number_of_passes_[index]++;
+      max_revisit_time_s_[index] = std::max(max_revisit_time_s_[index], interval_s);
+      total_revisit_time_s_[index] += interval_s;
+    }
+  }
+  last_covered_time_s_[index] = time_s;
+}
+
+size_t CoverageMap::GetCellIndex(const double latitude_rad, const double longitude_rad) const {
+  const double row_position = std::floor((latitude_rad + libra::pi_2) / latitude_step_rad_);
+  const size_t row = (size_t)std::min(std::max(row_position, 0.0), (double)number_of_latitude_cells_ - 1.0);
+  const double wrapped_longitude_rad = longitude_rad - libra::tau * std::floor((longitude_rad + libra::pi) / libra::tau);
+  const double column_position = std::floor((wrapped_longitude_rad + libra::pi) / longitude_step_rad_);
+  const size_t column = (size_t)std::min(std::max(column_position, 0.0), (double)number_of_longitude_cells_ - 1.0);
+  return row * number_of_longitude_cells_ + column;
+}
+
+double CoverageMap::GetCoveredRatio() const {
+  // The cell area is proportional to the difference of the sine of the boundary latitudes
+  double covered_area = 0.0;
+  for (size_t row = 0; row < number_of_latitude_cells_; row++) {
+    const double lower_latitude_rad = -libra::pi_2 + latitude_step_rad_ * (double)row;
+    const double cell_area = std::sin(lower_latitude_rad + latitude_step_rad_) - std::sin(lower_latitude_rad);
+    size_t number_of_covered_cells = 0;
+    for (size_t column = 0; column < number_of_longitude_cells_; column++) {
+      if (number_of_passes_[row * number_of_longitude_cells_ + column] > 0) number_of_covered_cells++;
+    }
+    covered_area += cell_area * (double)number_of_covered_cells;
+  }
+  return covered_area / (2.0 * (double)number_of_longitude_cells_);
+}
+
+bool CoverageMap::WriteCoverageMap(const std::string file_path) const {
+  std::ofstream file(file_path);
+  if (!file.is_open()) {
+    std::cerr << "[ERROR] Coverage map: the coverage map file " << file_path << " cannot be opened." << std::endl;
+    return false;
+  }
+
+  file << "latitude_deg,longitude_deg,number_of_passes,max_revisit_time_s,mean_revisit_time_s" << std::endl;
+  for (size_t row = 0; row < number_of_latitude_cells_; row++) {
+    const double latitude_deg = (-libra::pi_2 + latitude_step_rad_ * ((double)row + 0.5)) * libra::rad_to_deg;
+    for (size_t column = 0; column < number_of_longitude_cells_; column++) {
+      const double longitude_deg = (-libra::pi + longitude_step_rad_ * ((double)column + 0.5)) * libra::rad_to_deg;
+      const size_t index = row * number_of_longitude_cells_ + column;
+      file << std::fixed << std::setprecision(4) << latitude_deg << "," << longitude_deg << "," << number_of_passes_[index] << ",";
+      file << std::setprecision(3) << max_revisit_time_s_[index] << "," << GetMeanRevisitTime_s(index) << std::endl;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file coverage_map.hpp
+ * @brief Class to accumulate the ground coverage and the revisit statistics of the spacecraft on a latitude-longitude grid
+ */
+
+#ifndef S2E_SIMULATION_GROUND_STATION_COVERAGE_MAP_HPP_
+#define S2E_SIMULATION_GROUND_STATION_COVERAGE_MAP_HPP_
+
+#include <environment/global/physical_constants.hpp>
+#include <math_physics/geodesy/geodetic_position.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @struct CoverageFootprint
+ * @brief Circular footprint of a sensor on the ground
+ */
+struct CoverageFootprint {
+  double latitude_rad_;       //!< Latitude of the footprint center [rad]
+  double longitude_rad_;      //!< Longitude of the footprint center [rad]
+  double central_angle_rad_;  //!< Earth central angle of the footprint radius [rad]
+};
+
+/**
+ * @class CoverageMap
+ * @brief Class to accumulate the ground coverage and the revisit statistics of the spacecraft on a latitude-longitude grid
+ * @details The footprints of all spacecraft in a step are rasterized on the grid with the spherical cap boundary of each latitude row, and
+ *          the statistics of the covered cells are updated in place. A cell covered by multiple spacecraft in a step is counted once. The
+ *          coverage continued within the pass gap time is the same pass, and the time from the last coverage to the start of the next pass is
+ *          the revisit time. The grid rows are divided into the contiguous bands for the threads, so the cells are updated without locks.
+ */
+class CoverageMap {
+ public:
+  /**
+   * @fn CoverageMap
+   * @brief Constructor
+   * @param [in] number_of_latitude_cells: Number of the cells in the latitude direction (from -90 deg to 90 deg)
+   * @param [in] number_of_longitude_cells: Number of the cells in the longitude direction (from -180 deg to 180 deg)
+   * @param [in] pass_gap_s: Maximum interval of the coverage in the same pass (e.g., 1.5 times the update interval) [sec]
+   */
+  CoverageMap(const size_t number_of_latitude_cells, const size_t number_of_longitude_cells, const double pass_gap_s);
+
+  /**
+   * @fn CalcFootprint
+   * @brief Calculate the footprint of a nadir pointing sensor with the circular field of view
+   * @note The footprint is limited by the horizon when the field of view is wider than the Earth.
+   * @param [in] position: Geodetic position of the spacecraft
+   * @param [in] half_angle_rad: Half angle of the field of view [rad]
+   * @param [in] earth_radius_m: Radius of the Earth [m]
+   */
+  static CoverageFootprint CalcFootprint(const GeodeticPosition& position, const double half_angle_rad,
+                                         const double earth_radius_m = environment::earth_equatorial_radius_m);
+
+  /**
+   * @fn Update
+   * @brief Update the coverage with the footprints of the spacecraft at the time
+   * @param [in] footprints: Footprints of the spacecraft
+   * @param [in] time_s: Elapsed time [sec]
+   * @param [in] number_of_threads: Number of threads including the calling thread
+   */
+  void Update(const std::vector<CoverageFootprint>& footprints, const double time_s, const unsigned int number_of_threads = 1);
+
+  /**
+   * @fn WriteCoverageMap
+   * @brief Write the statistics of all cells in a CSV file
+   * @param [in] file_path: Path to the coverage map file
+   * @return True when the file is written
+   */
+  bool WriteCoverageMap(const std::string file_path) const;
+
+  // Getters
+  /**
+   * @fn GetCellIndex
+   * @brief Return the index of the cell including the position
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   */
+  size_t GetCellIndex(const double latitude_rad, const double longitude_rad) const;
+  /**
+   * @fn GetNumberOfCells
+   * @brief Return number of cells
+   */
+  inline size_t GetNumberOfCells() const { return number_of_passes_.size(); }
+  /**
+   * @fn GetNumberOfPasses
+   * @brief Return number of passes over the cell
+   * @param [in] index: Index of the cell
+   */
+  inline unsigned int GetNumberOfPasses(const size_t index) const { return number_of_passes_[index]; }
+  /**
+   * @fn GetMaxRevisitTime_s
+   * @brief Return the maximum revisit time of the cell [sec]
+   * @param [in] index: Index of the cell
+   */
+  inline double GetMaxRevisitTime_s(const size_t index) const { return max_revisit_time_s_[index]; }
+  /**
+   * @fn GetMeanRevisitTime_s
+   * @brief Return the mean revisit time of the cell (zero before the second pass) [sec]
+   * @param [in] index: Index of the cell
+   */
+  inline double GetMeanRevisitTime_s(const size_t index) const {
+    return number_of_passes_[index] > 1 ? total_revisit_time_s_[index] / (double)(number_of_passes_[index] - 1) : 0.0;
+  }
+  /**
+   * @fn GetCoveredRatio
+   * @brief Return the area ratio of the cells covered at least once
+   */
+  double GetCoveredRatio() const;
+
+ private:
+  size_t number_of_latitude_cells_;   //!< Number of the cells in the latitude direction
+  size_t number_of_longitude_cells_;  //!< Number of the cells in the longitude direction
+  double latitude_step_rad_;          //!< Latitude width of the cells [rad]
+  double longitude_step_rad_;         //!< Longitude width of the cells [rad]
+  double pass_gap_s_;                 //!< Maximum interval of the coverage in the same pass [sec]
+
+  // Cell statistics in the row-major order (latitude, longitude)
+  std::vector<double> last_covered_time_s_;     //!< Last covered time (valid after the first pass) [sec]
+  std::vector<unsigned int> number_of_passes_;  //!< Number of passes
+  std::vector<double> max_revisit_time_s_;      //!< Maximum revisit time [sec]
+  std::vector<double> total_revisit_time_s_;    //!< Sum of the revisit time [sec]
+
+  /**
+   * @fn UpdateRows
+   * @brief Update the cells in the range of the latitude rows
+   * @param [in] footprints: Footprints of the spacecraft
+   * @param [in] time_s: Elapsed time [sec]
+   * @param [in] begin_row: First row
+   * @param [in] end_row: Row after the last row
+   */
+  void UpdateRows(const std::vector<CoverageFootprint>& footprints, const double time_s, const size_t begin_row, const size_t end_row);
+  /**
+   * @fn UpdateCell
+   * @brief Update the statistics of the covered cell
+   * @param [in] index: Index of the cell
+   * @param [in] time_s: Elapsed time [sec]
+   */
+  void UpdateCell(const size_t index, const double time_s);
+};
+
+#endif  // S2E_SIMULATION_GROUND_STATION_COVERAGE_MAP_HPP_
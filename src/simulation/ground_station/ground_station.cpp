@@ -46,7 +46,7 @@ void GroundStation::Initialize(const SimulationConfiguration* configuration, con
 void GroundStation::LogSetup(Logger& logger) { logger.AddLogList(this); }
 
 void GroundStation::Update(const EarthRotation& celestial_rotation, const Spacecraft& spacecraft) {
-  libra::Matrix<3, 3> dcm_ecef2eci = celestial_rotation.GetDcmJ2000ToEcef().Transpose();
+  libra::Matrix<3, 3> dcm_ecef2eci = celestial_rotation.GetDcmEcefToJ2000();
   position_i_m_ = dcm_ecef2eci * position_ecef_m_;
 
   is_visible_[spacecraft.GetSpacecraftId()] = CalcIsVisible(spacecraft.GetDynamics().GetOrbit().GetPosition_ecef_m());
@@ -69,6 +69,16 @@ bool GroundStation::CalcIsVisible(const libra::Vector<3> spacecraft_position_ece
   }
 }
 
+double GroundStation::CalcElevationAngle_rad(const libra::Vector<3> spacecraft_position_ecef_m) const {
+  libra::Quaternion q_ecef_to_ltc = geodetic_position_.GetQuaternionXcxfToLtc();
+
+  libra::Vector<3> sc_pos_ltc = q_ecef_to_ltc.FrameConversion(spacecraft_position_ecef_m - position_ecef_m_);  // Satellite position in LTC frame [m]
+  sc_pos_ltc = sc_pos_ltc.CalcNormalizedVector();
+
+  // The z-axis of the LTC frame is the zenith direction
+  return asin(sc_pos_ltc[2]);
+}
+
 std::string GroundStation::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -90,6 +90,14 @@ class GroundStation : public ILoggable {
    */
   bool IsVisible(const unsigned int spacecraft_id) const { return is_visible_.at(spacecraft_id); }
 
+  /**
+   * @fn CalcElevationAngle_rad
+   * @brief Calculate the elevation angle of the target spacecraft (e.g., for the switching function of the AOS and LOS events)
+   * @param [in] spacecraft_position_ecef_m: spacecraft position in ECEF frame [m]
+   * @return Elevation angle [rad]
+   */
+  double CalcElevationAngle_rad(const Vector<3> spacecraft_position_ecef_m) const;
+
  protected:
   unsigned int ground_station_id_;      //!< Ground station ID
   GeodeticPosition geodetic_position_;  //!< Ground Station Position in the geodetic frame
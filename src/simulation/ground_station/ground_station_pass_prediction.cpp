@@ -0,0 +1,253 @@
+/**
+ * @file ground_station_pass_prediction.cpp
+ * @brief Class to predict the passes of the spacecraft over the ground stations
+ */
+
+#include "ground_station_pass_prediction.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <environment/global/earth_rotation.hpp>
+#include <environment/global/physical_constants.hpp>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <math_physics/math/constants.hpp>
+#include <math_physics/math/matrix_vector.hpp>
+#include <math_physics/math/root_finding.hpp>
+#include <thread>
+
+namespace {
+/**
+ * @fn FindMaximumWithGoldenSection
+ * @brief Find the maximum point of the unimodal function in the bracket with the golden section search
+ * @param [in] function: Target function which has the signature double(double)
+ * @param [in] lower: Lower bound of the bracket
+ * @param [in] upper: Upper bound of the bracket
+ * @param [in] tolerance: Tolerance of the independent variable
+ * @return Maximum point of the function
+ */
+template <typename F>
+double FindMaximumWithGoldenSection(F function, double lower, double upper, const double tolerance) {
+  const double kInverseGoldenRatio = (sqrt(5.0) - 1.0) / 2.0;
+  double x1 = upper - kInverseGoldenRatio * (upper - lower);
+  double x2 = lower + kInverseGoldenRatio * (upper - lower);
+  double f1 = function(x1);
+  double f2 = function(x2);
+  while (upper - lower > tolerance) {
+    if (f1 < f2) {
+      lower = x1;
+      x1 = x2;
+      f1 = f2;
+      x2 = lower + kInverseGoldenRatio * (upper - lower);
+      f2 = function(x2);
+    } else {
+      upper = x2;
+      x2 = x1;
+      f2 = f1;
+      x1 = upper - kInverseGoldenRatio * (upper - lower);
+      f1 = function(x1);
+    }
+  }
+  return 0.5 * (lower + upper);
+}
+}  // namespace
+
+GroundStationPassPrediction::GroundStationPassPrediction(const Sgp4Catalogue& catalogue, const double coarse_step_s, const double time_tolerance_s)
+    : catalogue_(catalogue), coarse_step_s_(coarse_step_s), time_tolerance_s_(time_tolerance_s) {
+  if (coarse_step_s_ <= 0.0) {
+    std::cout << "[WARNINGS] Pass prediction: the coarse step must be positive. 60 sec is used." << std::endl;
+    coarse_step_s_ = 60.0;
+  }
+}
+
+void GroundStationPassPrediction::AddGroundStation(const GroundStation& ground_station) {
+  AddGroundStation(ground_station.GetGroundStationId(), ground_station.GetGeodeticPosition(), ground_station.GetElevationLimitAngle_deg());
+}
+
+void GroundStationPassPrediction::AddGroundStation(const int ground_station_id, const GeodeticPosition& geodetic_position,
+                                                   const double elevation_limit_angle_deg) {
+  GroundStationGeometry geometry;
+  geometry.id_ = ground_station_id;
+  geometry.position_ecef_m_ = geodetic_position.CalcEcefPosition();
+
+  libra::Vector<3> zenith_ltc(0.0);
+  zenith_ltc[2] = 1.0;
+  geometry.zenith_ecef_ = geodetic_position.GetQuaternionXcxfToLtc().InverseFrameConversion(zenith_ltc);
+
+  geometry.elevation_limit_rad_ = elevation_limit_angle_deg * libra::deg_to_rad;
+  geometry.sin_elevation_limit_ = sin(geometry.elevation_limit_rad_);
+  ground_stations_.push_back(geometry);
+}
+
+void GroundStationPassPrediction::Predict(const double start_time_jd, const double duration_s, const unsigned int number_of_threads) {
+  passes_.clear();
+  const size_t number_of_spacecraft = catalogue_.GetNumberOfObjects();
+  if (ground_stations_.empty() || number_of_spacecraft == 0 || duration_s <= 0.0) return;
+
+  // The threads write their own pass lists, so no lock is needed
+  const size_t number_of_blocks = std::max((size_t)1, std::min((size_t)number_of_threads, number_of_spacecraft));
+  const size_t block_size = (number_of_spacecraft + number_of_blocks - 1) / number_of_blocks;
+  std::vector<std::vector<GroundStationPass>> block_passes(number_of_blocks);
+  std::vector<std::thread> threads;
+  for (size_t block = 1; block < number_of_blocks; block++) {
+    const size_t begin_index = block * block_size;
+    const size_t end_index = std::min(begin_index + block_size, number_of_spacecraft);
+    if (begin_index >= end_index) break;
+    threads.emplace_back(&GroundStationPassPrediction::PredictSpacecraft, this, start_time_jd, duration_s, begin_index, end_index,
+                         std::ref(block_passes[block]));
+  }
+  PredictSpacecraft(start_time_jd, duration_s, 0, std::min(block_size, number_of_spacecraft), block_passes[0]);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& passes : block_passes) {
+    passes_.insert(passes_.end(), passes.begin(), passes.end());
+  }
+  std::sort(passes_.begin(), passes_.end(), [](const GroundStationPass& lhs, const GroundStationPass& rhs) {
+    if (lhs.aos_jd_ != rhs.aos_jd_) return lhs.aos_jd_ < rhs.aos_jd_;
+    if (lhs.spacecraft_index_ != rhs.spacecraft_index_) return lhs.spacecraft_index_ < rhs.spacecraft_index_;
+    return lhs.ground_station_id_ < rhs.ground_station_id_;
+  });
+}
+
+void GroundStationPassPrediction::PredictSpacecraft(const double start_time_jd, const double duration_s, const size_t begin, const size_t end,
+                                                    std::vector<GroundStationPass>& passes) const {
+  const double kSec2Day = 1.0 / (24.0 * 60.0 * 60.0);
+  const size_t number_of_ground_stations = ground_stations_.size();
+  const size_t number_of_steps = (size_t)ceil(duration_s / coarse_step_s_);
+  EarthRotation earth_rotation(EarthRotationMode::kSimple);  // Each thread has its own Earth rotation
+
+  for (size_t spacecraft_index = begin; spacecraft_index < end; spacecraft_index++) {
+    // Maximum angular velocity of the Earth central angle between the spacecraft and a ground station
+    const double perigee_radius_m = catalogue_.GetPerigeeRadius_m(spacecraft_index) - kRadiusMargin_m;
+    const double apogee_radius_m = catalogue_.GetApogeeRadius_m(spacecraft_index) + kRadiusMargin_m;
+    const double semi_major_axis_m = 0.5 * (perigee_radius_m + apogee_radius_m);
+    const double perigee_velocity_m_s = sqrt(catalogue_.GetGravityConstant_m3_s2() * (2.0 / perigee_radius_m - 1.0 / semi_major_axis_m));
+    const double max_angular_velocity_rad_s =
+        kAngularVelocityMargin * (perigee_velocity_m_s / perigee_radius_m + environment::earth_mean_angular_velocity_rad_s);
+
+    // Maximum central angle where the spacecraft at the apogee radius can be visible from each ground station
+    std::vector<double> max_central_angle_rad(number_of_ground_stations);
+    for (size_t gs_id = 0; gs_id < number_of_ground_stations; gs_id++) {
+      const double elevation_rad = ground_stations_[gs_id].elevation_limit_rad_ - kElevationMargin_rad;
+      const double ratio = ground_stations_[gs_id].position_ecef_m_.CalcNorm() * cos(elevation_rad) / apogee_radius_m;
+      max_central_angle_rad[gs_id] = (ratio >= 1.0) ? -1.0 : acos(ratio) - elevation_rad;
+    }
+
+    bool has_error = false;
+    auto calc_position_ecef_m = [&](const double time_s) {
+      const double time_jd = start_time_jd + time_s * kSec2Day;
+      libra::Vector<3> position_i_m, velocity_i_m_s;
+      if (!catalogue_.CalcState(spacecraft_index, time_jd, position_i_m, velocity_i_m_s)) has_error = true;
+      earth_rotation.Update(time_jd);
+      return libra::Vector<3>(earth_rotation.GetDcmJ2000ToEcef() * position_i_m);
+    };
+    // Positive when the elevation is higher than the elevation limit
+    auto calc_visibility = [&](const GroundStationGeometry& ground_station, const libra::Vector<3>& position_ecef_m) {
+      const libra::Vector<3> relative_position_ecef_m = position_ecef_m - ground_station.position_ecef_m_;
+      return InnerProduct(relative_position_ecef_m, ground_station.zenith_ecef_) / relative_position_ecef_m.CalcNorm() -
+             ground_station.sin_elevation_limit_;
+    };
+    auto add_pass = [&](const size_t gs_id, const double aos_s, const double los_s, const bool is_truncated) {
+      const GroundStationGeometry& ground_station = ground_stations_[gs_id];
+      auto visibility = [&](const double time_s) { return calc_visibility(ground_station, calc_position_ecef_m(time_s)); };
+      const double max_elevation_s = FindMaximumWithGoldenSection(visibility, aos_s, los_s, time_tolerance_s_);
+      const double sin_max_elevation = std::min(1.0, visibility(max_elevation_s) + ground_station.sin_elevation_limit_);
+
+      GroundStationPass pass;
+      pass.spacecraft_index_ = spacecraft_index;
+      pass.ground_station_id_ = ground_station.id_;
+      pass.aos_jd_ = start_time_jd + aos_s * kSec2Day;
+      pass.los_jd_ = start_time_jd + los_s * kSec2Day;
+      pass.max_elevation_jd_ = start_time_jd + max_elevation_s * kSec2Day;
+      pass.max_elevation_deg_ = asin(sin_max_elevation) * libra::rad_to_deg;
+      pass.is_truncated_ = is_truncated;
+      passes.push_back(pass);
+    };
+
+    std::vector<double> previous_central_angle_rad(number_of_ground_stations, 0.0);
+    std::vector<bool> is_in_pass(number_of_ground_stations, false);
+    std::vector<double> aos_s(number_of_ground_stations, 0.0);
+    std::vector<bool> is_aos_truncated(number_of_ground_stations, false);
+    double previous_time_s = 0.0;
+    for (size_t step = 0; step <= number_of_steps; step++) {
+      const double time_s = std::min(step * coarse_step_s_, duration_s);
+      const libra::Vector<3> position_ecef_m = calc_position_ecef_m(time_s);
+      if (has_error) break;
+      const libra::Vector<3> direction_ecef = position_ecef_m.CalcNormalizedVector();
+
+      for (size_t gs_id = 0; gs_id < number_of_ground_stations; gs_id++) {
+        const GroundStationGeometry& ground_station = ground_stations_[gs_id];
+        const double visibility = calc_visibility(ground_station, position_ecef_m);
+        const double cos_central_angle = InnerProduct(direction_ecef, ground_station.position_ecef_m_) / ground_station.position_ecef_m_.CalcNorm();
+        const double central_angle_rad = acos(std::max(-1.0, std::min(1.0, cos_central_angle)));
+        auto visibility_at = [&](const double t_s) { return calc_visibility(ground_station, calc_position_ecef_m(t_s)); };
+
+        if (step == 0) {
+          if (visibility >= 0.0) {
+            is_in_pass[gs_id] = true;
+            aos_s[gs_id] = 0.0;
+            is_aos_truncated[gs_id] = true;
+          }
+        } else if (is_in_pass[gs_id]) {
+          if (visibility < 0.0) {
+            const double los_s = libra::CalcRootWithBrentMethod(visibility_at, previous_time_s, time_s, time_tolerance_s_);
+            add_pass(gs_id, aos_s[gs_id], los_s, is_aos_truncated[gs_id]);
+            is_in_pass[gs_id] = false;
+          }
+        } else if (visibility >= 0.0) {
+          aos_s[gs_id] = libra::CalcRootWithBrentMethod(visibility_at, previous_time_s, time_s, time_tolerance_s_);
+          is_aos_truncated[gs_id] = false;
+          is_in_pass[gs_id] = true;
+        } else {
+          // Lower bound of the central angle in the step from the both ends
+          const double min_central_angle_rad =
+              0.5 * (previous_central_angle_rad[gs_id] + central_angle_rad - max_angular_velocity_rad_s * (time_s - previous_time_s));
+          if (min_central_angle_rad <= max_central_angle_rad[gs_id]) {
+            // Search a pass shorter than the step
+            const double peak_s = FindMaximumWithGoldenSection(visibility_at, previous_time_s, time_s, time_tolerance_s_);
+            if (visibility_at(peak_s) >= 0.0) {
+              const double short_aos_s = libra::CalcRootWithBrentMethod(visibility_at, previous_time_s, peak_s, time_tolerance_s_);
+              const double short_los_s = libra::CalcRootWithBrentMethod(visibility_at, peak_s, time_s, time_tolerance_s_);
+              add_pass(gs_id, short_aos_s, short_los_s, false);
+            }
+          }
+        }
+        previous_central_angle_rad[gs_id] = central_angle_rad;
+      }
+      previous_time_s = time_s;
+    }
+
+    if (has_error) {
+      std::cout << "[WARNINGS] Pass prediction: SGP4 error in " << catalogue_.GetName(spacecraft_index) << ". The prediction is stopped at "
+                << previous_time_s << " sec." << std::endl;
+    }
+    // The passes at the end of the window
+    for (size_t gs_id = 0; gs_id < number_of_ground_stations; gs_id++) {
+      if (is_in_pass[gs_id]) add_pass(gs_id, aos_s[gs_id], previous_time_s, true);
+    }
+  }
+}
+
+bool GroundStationPassPrediction::WriteContactPlan(const std::string file_path) const {
+  std::ofstream file(file_path);
+  if (!file.is_open()) {
+    std::cerr << "[ERROR] Pass prediction: the contact plan file " << file_path << " cannot be opened." << std::endl;
+    return false;
+  }
+
+  file << "spacecraft_name,satellite_number,ground_station_id,aos_jd,los_jd,duration_s,max_elevation_jd,max_elevation_deg,is_truncated"
+       << std::endl;
+  for (const auto& pass : passes_) {
+    file << catalogue_.GetName(pass.spacecraft_index_) << "," << catalogue_.GetSatelliteNumber(pass.spacecraft_index_) << ","
+         << pass.ground_station_id_ << ",";
+    file << std::fixed << std::setprecision(8) << pass.aos_jd_ << "," << pass.los_jd_ << ",";
+    file << std::setprecision(3) << (pass.los_jd_ - pass.aos_jd_) * (24.0 * 60.0 * 60.0) << ",";
+    file << std::setprecision(8) << pass.max_elevation_jd_ << ",";
+    file << std::setprecision(3) << pass.max_elevation_deg_ << "," << (pass.is_truncated_ ? 1 : 0) << std::endl;
+  }
+  return true;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file ground_station_pass_prediction.hpp
+ * @brief Class to predict the passes of the spacecraft over the ground stations
+ */
+
+#ifndef S2E_SIMULATION_GROUND_STATION_GROUND_STATION_PASS_PREDICTION_HPP_
+#define S2E_SIMULATION_GROUND_STATION_GROUND_STATION_PASS_PREDICTION_HPP_
+
+#include <math_physics/geodesy/geodetic_position.hpp>
+#include <math_physics/math/vector.hpp>
+#include <math_physics/orbit/sgp4_catalogue.hpp>
+#include <string>
+#include <vector>
+
+#include "ground_station.hpp"
+
+/**
+ * @struct GroundStationPass
+ * @brief Information of a pass of a spacecraft over a ground station
+ */
+struct GroundStationPass {
+  size_t spacecraft_index_;   //!< Index of the spacecraft in the catalogue
+  int ground_station_id_;     //!< ID of the ground station
+  double aos_jd_;             //!< Julian day of the acquisition of signal [day]
+  double los_jd_;             //!< Julian day of the loss of signal [day]
+  double max_elevation_jd_;   //!< Julian day of the maximum elevation [day]
+  double max_elevation_deg_;  //!< Maximum elevation angle [deg]
+  bool is_truncated_;         //!< The pass is truncated by the start or the end of the prediction window
+};
+
+/**
+ * @class GroundStationPassPrediction
+ * @brief Class to predict the passes (AOS, LOS, and maximum elevation) of the spacecraft over the ground stations
+ * @details The orbits are propagated with SGP4 independently of the simulation, so the passes over weeks are predicted without stepping the
+ *          simulation. The prediction consists of the following three stages for each spacecraft.
+ *          1. Coarse sampling: The elevation of the spacecraft from all ground stations is evaluated with the coarse step.
+ *          2. Analytic bound: The Earth central angle between the spacecraft and a ground station changes at most with the sum of the orbital
+ *             angular velocity at the perigee and the Earth rotation. The steps in which the central angle cannot reach the visibility
+ *             limit of the ground station are skipped, and the other steps are searched for a pass shorter than the coarse step.
+ *          3. Refinement: The AOS and LOS are calculated with Brent's method, and the maximum elevation is calculated with the golden section
+ *             search.
+ *          The spacecraft are divided into the contiguous blocks for the threads.
+ * @note The SGP4 outputs in the TEME frame are converted to the ECEF frame with the Greenwich mean sidereal time (EarthRotationMode::kSimple).
+ *       The coarse step must be shorter than the half of the shortest pass to be detected.
+ */
+class GroundStationPassPrediction {
+ public:
+  /**
+   * @fn GroundStationPassPrediction
+   * @brief Constructor
+   * @param [in] catalogue: TLE catalogue of the spacecraft
+   * @param [in] coarse_step_s: Step of the coarse sampling [sec]
+   * @param [in] time_tolerance_s: Tolerance of the AOS, LOS, and maximum elevation time [sec]
+   */
+  GroundStationPassPrediction(const Sgp4Catalogue& catalogue, const double coarse_step_s = 60.0, const double time_tolerance_s = 0.1);
+
+  /**
+   * @fn AddGroundStation
+   * @brief Add a ground station. The position and the elevation limit angle are copied.
+   * @param [in] ground_station: Ground station
+   */
+  void AddGroundStation(const GroundStation& ground_station);
+  /**
+   * @fn AddGroundStation
+   * @brief Add a ground station with its position and the elevation limit angle
+   * @param [in] ground_station_id: ID of the ground station
+   * @param [in] geodetic_position: Geodetic position of the ground station
+   * @param [in] elevation_limit_angle_deg: Elevation limit angle [deg]
+   */
+  void AddGroundStation(const int ground_station_id, const GeodeticPosition& geodetic_position, const double elevation_limit_angle_deg);
+
+  /**
+   * @fn Predict
+   * @brief Predict the passes of all spacecraft over all ground stations in the window. The previous results are cleared.
+   * @param [in] start_time_jd: Julian day of the start of the window [day]
+   * @param [in] duration_s: Duration of the window [sec]
+   * @param [in] number_of_threads: Number of threads including the calling thread
+   */
+  void Predict(const double start_time_jd, const double duration_s, const unsigned int number_of_threads = 1);
+
+  /**
+   * @fn WriteContactPlan
+   * @brief Write the predicted passes in a CSV file
+   * @param [in] file_path: Path to the contact plan file
+   * @return True when the file is written
+   */
+  bool WriteContactPlan(const std::string file_path) const;
+
+  // Getters
+  /**
+   * @fn GetPasses
+   * @brief Return the predicted passes sorted by AOS
+   */
+  inline const std::vector<GroundStationPass>& GetPasses() const { return passes_; }
+  /**
+   * @fn GetNumberOfGroundStations
+   * @brief Return number of the ground stations
+   */
+  inline size_t GetNumberOfGroundStations() const { return ground_stations_.size(); }
+
+ private:
+  static constexpr double kRadiusMargin_m = 50.0e3;       //!< Margin of the perigee and apogee radius for the osculating orbit [m]
+  static constexpr double kElevationMargin_rad = 0.005;   //!< Margin of the elevation for the geodetic and geocentric zenith difference [rad]
+  static constexpr double kAngularVelocityMargin = 1.05;  //!< Margin factor of the maximum angular velocity of the central angle
+
+  /**
+   * @struct GroundStationGeometry
+   * @brief Geometry of a ground station in the ECEF frame
+   */
+  struct GroundStationGeometry {
+    int id_;                            //!< ID of the ground station
+    libra::Vector<3> position_ecef_m_;  //!< Position in the ECEF frame [m]
+    libra::Vector<3> zenith_ecef_;      //!< Zenith direction in the ECEF frame
+    double elevation_limit_rad_;        //!< Elevation limit angle [rad]
+    double sin_elevation_limit_;        //!< Sine of the elevation limit angle
+  };
+
+  const Sgp4Catalogue& catalogue_;                      //!< TLE catalogue of the spacecraft
+  double coarse_step_s_;                                //!< Step of the coarse sampling [sec]
+  double time_tolerance_s_;                             //!< Tolerance of the event time [sec]
+  std::vector<GroundStationGeometry> ground_stations_;  //!< Ground stations
+  std::vector<GroundStationPass> passes_;               //!< Predicted passes
+
+  /**
+   * @fn PredictSpacecraft
+   * @brief Predict the passes of the spacecraft in the range of the index
+   * @param [in] start_time_jd: Julian day of the start of the window [day]
+   * @param [in] duration_s: Duration of the window [sec]
+   * @param [in] begin: First index of the spacecraft
+   * @param [in] end: Index after the last spacecraft
+   * @param [out] passes: Predicted passes
+   */
+  void PredictSpacecraft(const double start_time_jd, const double duration_s, const size_t begin, const size_t end,
+                         std::vector<GroundStationPass>& passes) const;
+};
+
+#endif  // S2E_SIMULATION_GROUND_STATION_GROUND_STATION_PASS_PREDICTION_HPP_
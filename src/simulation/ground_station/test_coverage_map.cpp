@@ -0,0 +1,135 @@
+/**
+ * @file test_coverage_map.cpp
+ * @brief Test codes for CoverageMap class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <math_physics/math/constants.hpp>
+#include <random>
+
+#include "coverage_map.hpp"
+
+namespace {
+/**
+ * @fn CalcCentralAngle_rad
+ * @brief Return the Earth central angle between two points on the sphere [rad]
+ */
+double CalcCentralAngle_rad(const double latitude_1_rad, const double longitude_1_rad, const double latitude_2_rad, const double longitude_2_rad) {
+  const double cos_angle = sin(latitude_1_rad) * sin(latitude_2_rad) + cos(latitude_1_rad) * cos(latitude_2_rad) * cos(longitude_1_rad - longitude_2_rad);
+  return acos(std::min(std::max(cos_angle, -1.0), 1.0));
+}
+}  // namespace
+
+/**
+ * @brief Test for the footprint of the nadir pointing sensor
+ */
+TEST(CoverageMap, Footprint) {
+  const double earth_radius_m = 6378136.6;
+  const double altitude_m = 500.0e3;
+  const GeodeticPosition position(0.1, -0.2, altitude_m);
+
+  const double half_angle_rad = 30.0 * libra::deg_to_rad;
+  const CoverageFootprint footprint = CoverageMap::CalcFootprint(position, half_angle_rad, earth_radius_m);
+  EXPECT_DOUBLE_EQ(0.1, footprint.latitude_rad_);
+  EXPECT_DOUBLE_EQ(-0.2, footprint.longitude_rad_);
+  const double ratio = (earth_radius_m + altitude_m) / earth_radius_m;
+  EXPECT_NEAR(asin(ratio * sin(half_angle_rad)) - half_angle_rad, footprint.central_angle_rad_, 1e-12);
+
+  // The field of view wider than the Earth is limited by the horizon
+  const CoverageFootprint wide_footprint = CoverageMap::CalcFootprint(position, 80.0 * libra::deg_to_rad, earth_radius_m);
+  EXPECT_NEAR(acos(1.0 / ratio), wide_footprint.central_angle_rad_, 1e-12);
+}
+
+/**
+ * @brief Test for the rasterization of the footprints against the brute force search of the cell centers
+ */
+TEST(CoverageMap, Rasterization) {
+  const size_t number_of_latitude_cells = 90;
+  const size_t number_of_longitude_cells = 180;
+  const double step_rad = 2.0 * libra::deg_to_rad;
+  // Footprints on the equator, over the pole, and across the date line
+  const double footprint_parameters_deg[3][3] = {{0.0, 0.0, 10.0}, {85.0, 30.0, 12.0}, {-40.0, 177.0, 15.0}};
+  for (const auto& parameter_deg : footprint_parameters_deg) {
+    CoverageMap coverage_map(number_of_latitude_cells, number_of_longitude_cells, 15.0);
+    CoverageFootprint footprint;
+    footprint.latitude_rad_ = parameter_deg[0] * libra::deg_to_rad;
+    footprint.longitude_rad_ = parameter_deg[1] * libra::deg_to_rad;
+    footprint.central_angle_rad_ = parameter_deg[2] * libra::deg_to_rad;
+    coverage_map.Update({footprint}, 0.0);
+
+    size_t number_of_mismatches = 0;
+    for (size_t row = 0; row < number_of_latitude_cells; row++) {
+      const double latitude_rad = -libra::pi_2 + step_rad * ((double)row + 0.5);
+      for (size_t column = 0; column < number_of_longitude_cells; column++) {
+        const double longitude_rad = -libra::pi + step_rad * ((double)column + 0.5);
+        const double angle_rad = CalcCentralAngle_rad(latitude_rad, longitude_rad, footprint.latitude_rad_, footprint.longitude_rad_);
+        // The cell centers on the boundary are not evaluated
+        if (std::abs(angle_rad - footprint.central_angle_rad_) < 1e-9) continue;
+        const bool is_covered = coverage_map.GetNumberOfPasses(coverage_map.GetCellIndex(latitude_rad, longitude_rad)) > 0;
+        if (is_covered != (angle_rad < footprint.central_angle_rad_)) number_of_mismatches++;
+      }
+    }
+    EXPECT_EQ(0, number_of_mismatches);
+  }
+
+  // A footprint covering the whole Earth
+  CoverageMap coverage_map(number_of_latitude_cells, number_of_longitude_cells, 15.0);
+  CoverageFootprint footprint{0.3, 1.0, libra::pi};
+  coverage_map.Update({footprint}, 0.0);
+  EXPECT_NEAR(1.0, coverage_map.GetCoveredRatio(), 1e-12);
+}
+
+/**
+ * @brief Test for the pass and revisit statistics
+ */
+TEST(CoverageMap, RevisitStatistics) {
+  CoverageMap coverage_map(18, 36, 15.0);
+  const CoverageFootprint footprint{0.0, 0.0, 10.0 * libra::deg_to_rad};  // Covers the center of the 10 deg cell
+  const size_t index = coverage_map.GetCellIndex(0.01, 0.01);
+
+  coverage_map.Update({footprint}, 0.0);
+  coverage_map.Update({footprint}, 10.0);  // Same pass
+  EXPECT_EQ(1, coverage_map.GetNumberOfPasses(index));
+  EXPECT_DOUBLE_EQ(0.0, coverage_map.GetMeanRevisitTime_s(index));
+
+  coverage_map.Update({footprint, footprint}, 100.0);  // Counted once for multiple spacecraft
+  EXPECT_EQ(2, coverage_map.GetNumberOfPasses(index));
+  EXPECT_DOUBLE_EQ(90.0, coverage_map.GetMaxRevisitTime_s(index));
+
+  coverage_map.Update({footprint}, 300.0);
+  EXPECT_EQ(3, coverage_map.GetNumberOfPasses(index));
+  EXPECT_DOUBLE_EQ(200.0, coverage_map.GetMaxRevisitTime_s(index));
+  EXPECT_DOUBLE_EQ(145.0, coverage_map.GetMeanRevisitTime_s(index));
+
+  // Cells out of the footprint
+  EXPECT_EQ(0, coverage_map.GetNumberOfPasses(coverage_map.GetCellIndex(0.5, 0.5)));
+}
+
+/**
+ * @brief Test for the update by several threads
+ */
+TEST(CoverageMap, Threads) {
+  CoverageMap single_thread_map(90, 180, 15.0);
+  CoverageMap multi_thread_map(90, 180, 15.0);
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  for (size_t step = 0; step < 50; step++) {
+    std::vector<CoverageFootprint> footprints;
+    for (size_t i = 0; i < 8; i++) {
+      footprints.push_back({asin(uniform(generator)), libra::pi * uniform(generator), 0.2 + 0.1 * uniform(generator)});
+    }
+    single_thread_map.Update(footprints, 10.0 * (double)step, 1);
+    multi_thread_map.Update(footprints, 10.0 * (double)step, 4);
+  }
+
+  size_t number_of_mismatches = 0;
+  for (size_t index = 0; index < single_thread_map.GetNumberOfCells(); index++) {
+    if (single_thread_map.GetNumberOfPasses(index) != multi_thread_map.GetNumberOfPasses(index)) number_of_mismatches++;
+    if (single_thread_map.GetMaxRevisitTime_s(index) != multi_thread_map.GetMaxRevisitTime_s(index)) number_of_mismatches++;
+  }
+  EXPECT_EQ(0, number_of_mismatches);
+  EXPECT_GT(single_thread_map.GetCoveredRatio(), 0.0);
+  EXPECT_DOUBLE_EQ(single_thread_map.GetCoveredRatio(), multi_thread_map.GetCoveredRatio());
+}
@@ -0,0 +1,151 @@
+/**
+ * @file test_ground_station_pass_prediction.cpp
+ * @brief Test codes for GroundStationPassPrediction class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <environment/global/earth_rotation.hpp>
+#include <fstream>
+#include <math_physics/math/constants.hpp>
+#include <string>
+
+#include "ground_station_pass_prediction.hpp"
+
+namespace {
+const char* kIssTle1 = "1 25544U 98067A   20076.51604214  .00016717  00000-0  10270-3 0  9005";
+const char* kIssTle2 = "2 25544  51.6412  86.9962 0006063  30.9353 329.2153 15.49228202 17647";
+const char* kHstTle1 = "1 20580U 90037B   20076.50669788  .00000993  00000-0  37929-4 0  9994";
+const char* kHstTle2 = "2 20580  28.4697 123.5498 0002839 135.4135 298.3145 15.09313444440529";
+
+const double kStartTime_jd = 2458928.5;
+const double kDuration_s = 24.0 * 60.0 * 60.0;
+
+/**
+ * @fn AddGroundStations
+ * @brief Add the ground stations in the middle latitude and on the equator
+ */
+void AddGroundStations(GroundStationPassPrediction& prediction) {
+  prediction.AddGroundStation(0, GeodeticPosition(35.7 * libra::deg_to_rad, 139.7 * libra::deg_to_rad, 40.0), 10.0);
+  prediction.AddGroundStation(1, GeodeticPosition(0.0, -50.0 * libra::deg_to_rad, 0.0), 5.0);
+}
+}  // namespace
+
+/**
+ * @brief Test for the passes against the brute force sampling of the elevation
+ */
+TEST(GroundStationPassPrediction, BruteForceSampling) {
+  Sgp4Catalogue catalogue;
+  ASSERT_TRUE(catalogue.AddTle("ISS", kIssTle1, kIssTle2));
+  ASSERT_TRUE(catalogue.AddTle("HST", kHstTle1, kHstTle2));
+  GroundStationPassPrediction prediction(catalogue, 60.0, 0.01);
+  AddGroundStations(prediction);
+  ASSERT_EQ(2, prediction.GetNumberOfGroundStations());
+  prediction.Predict(kStartTime_jd, kDuration_s);
+
+  // Elevation sampled every second with the same frame conversion
+  const double kSec2Day = 1.0 / (24.0 * 60.0 * 60.0);
+  const GeodeticPosition ground_station_positions[2] = {GeodeticPosition(35.7 * libra::deg_to_rad, 139.7 * libra::deg_to_rad, 40.0),
+                                                        GeodeticPosition(0.0, -50.0 * libra::deg_to_rad, 0.0)};
+  const double elevation_limit_deg[2] = {10.0, 5.0};
+  EarthRotation earth_rotation(EarthRotationMode::kSimple);
+  std::vector<GroundStationPass> reference_passes;
+  for (size_t spacecraft_index = 0; spacecraft_index < 2; spacecraft_index++) {
+    for (int gs_id = 0; gs_id < 2; gs_id++) {
+      const libra::Vector<3> ground_station_ecef_m = ground_station_positions[gs_id].CalcEcefPosition();
+      const libra::Quaternion q_ecef_to_ltc = ground_station_positions[gs_id].GetQuaternionXcxfToLtc();
+      bool is_in_pass = false;
+      GroundStationPass pass{};
+      for (size_t step = 0; step <= (size_t)kDuration_s; step++) {
+        const double time_jd = kStartTime_jd + (double)step * kSec2Day;
+        libra::Vector<3> position_i_m, velocity_i_m_s;
+        ASSERT_TRUE(catalogue.CalcState(spacecraft_index, time_jd, position_i_m, velocity_i_m_s));
+        earth_rotation.Update(time_jd);
+        const libra::Vector<3> position_ecef_m = earth_rotation.GetDcmJ2000ToEcef() * position_i_m;
+        const libra::Vector<3> direction_ltc = q_ecef_to_ltc.FrameConversion(position_ecef_m - ground_station_ecef_m).CalcNormalizedVector();
+        const double elevation_deg = asin(direction_ltc[2]) * libra::rad_to_deg;
+        if (elevation_deg >= elevation_limit_deg[gs_id]) {
+          if (!is_in_pass) {
+            is_in_pass = true;
+            pass.spacecraft_index_ = spacecraft_index;
+            pass.ground_station_id_ = gs_id;
+            pass.aos_jd_ = time_jd;
+            pass.max_elevation_deg_ = elevation_deg;
+            pass.is_truncated_ = step == 0;
+          }
+          pass.los_jd_ = time_jd;
+          pass.max_elevation_deg_ = std::max(pass.max_elevation_deg_, elevation_deg);
+        } else if (is_in_pass) {
+          is_in_pass = false;
+          reference_passes.push_back(pass);
+        }
+      }
+      if (is_in_pass) {
+        pass.is_truncated_ = true;
+        reference_passes.push_back(pass);
+      }
+    }
+  }
+
+  ASSERT_GT(reference_passes.size(), 4);
+  ASSERT_EQ(reference_passes.size(), prediction.GetPasses().size());
+  for (const auto& reference : reference_passes) {
+    bool is_found = false;
+    for (const auto& pass : prediction.GetPasses()) {
+      if (pass.spacecraft_index_ != reference.spacecraft_index_ || pass.ground_station_id_ != reference.ground_station_id_) continue;
+      if (std::abs(pass.aos_jd_ - reference.aos_jd_) > 1.5 * kSec2Day) continue;
+      is_found = true;
+      EXPECT_NEAR(reference.los_jd_, pass.los_jd_, 1.5 * kSec2Day);
+      EXPECT_NEAR(reference.max_elevation_deg_, pass.max_elevation_deg_, 0.05);
+      EXPECT_LE(pass.aos_jd_, pass.max_elevation_jd_);
+      EXPECT_LE(pass.max_elevation_jd_, pass.los_jd_);
+      EXPECT_EQ(reference.is_truncated_, pass.is_truncated_);
+    }
+    EXPECT_TRUE(is_found);
+  }
+
+  // Sorted by AOS
+  for (size_t i = 1; i < prediction.GetPasses().size(); i++) {
+    EXPECT_LE(prediction.GetPasses()[i - 1].aos_jd_, prediction.GetPasses()[i].aos_jd_);
+  }
+}
+
+/**
+ * @brief Test for the prediction by several threads and the contact plan file
+ */
+TEST(GroundStationPassPrediction, ThreadsAndContactPlan) {
+  Sgp4Catalogue catalogue;
+  for (size_t i = 0; i < 5; i++) {
+    catalogue.AddTle("ISS", kIssTle1, kIssTle2);
+    catalogue.AddTle("HST", kHstTle1, kHstTle2);
+  }
+  GroundStationPassPrediction single_thread_prediction(catalogue);
+  GroundStationPassPrediction multi_thread_prediction(catalogue);
+  AddGroundStations(single_thread_prediction);
+  AddGroundStations(multi_thread_prediction);
+  single_thread_prediction.Predict(kStartTime_jd, kDuration_s, 1);
+  multi_thread_prediction.Predict(kStartTime_jd, kDuration_s, 4);
+
+  const std::vector<GroundStationPass>& single_thread_passes = single_thread_prediction.GetPasses();
+  const std::vector<GroundStationPass>& multi_thread_passes = multi_thread_prediction.GetPasses();
+  ASSERT_GT(single_thread_passes.size(), 0);
+  ASSERT_EQ(single_thread_passes.size(), multi_thread_passes.size());
+  for (size_t i = 0; i < single_thread_passes.size(); i++) {
+    EXPECT_EQ(single_thread_passes[i].spacecraft_index_, multi_thread_passes[i].spacecraft_index_);
+    EXPECT_EQ(single_thread_passes[i].ground_station_id_, multi_thread_passes[i].ground_station_id_);
+    EXPECT_DOUBLE_EQ(single_thread_passes[i].aos_jd_, multi_thread_passes[i].aos_jd_);
+    EXPECT_DOUBLE_EQ(single_thread_passes[i].los_jd_, multi_thread_passes[i].los_jd_);
+  }
+
+  // One line for each pass after the header
+  const std::string file_path = "test_contact_plan.csv";
+  ASSERT_TRUE(single_thread_prediction.WriteContactPlan(file_path));
+  std::ifstream file(file_path);
+  std::string line;
+  size_t number_of_lines = 0;
+  while (std::getline(file, line)) number_of_lines++;
+  file.close();
+  EXPECT_EQ(single_thread_passes.size() + 1, number_of_lines);
+  std::remove(file_path.c_str());
+}
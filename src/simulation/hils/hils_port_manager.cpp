@@ -11,11 +11,46 @@
 
 HilsPortManager::HilsPortManager() {}
 
-HilsPortManager::~HilsPortManager() {}
+HilsPortManager::~HilsPortManager() {
+#if defined(USE_HILS) && !defined(WIN32)
+  for (auto& network_port : network_ports_) delete network_port.second;
+#endif
+}
+
+#if defined(USE_HILS) && !defined(WIN32)
+// Network transport functions
+int HilsPortManager::RegisterNetworkPort(unsigned int port_id, const HilsNetworkPortConfig& config) {
+  if (network_ports_.count(port_id) > 0 || uart_ports_[port_id] != nullptr) {
+    printf("Error: Port is already used\n");
+    return -1;
+  }
+  network_port_configs_[port_id] = config;
+  return 0;
+}
+
+void HilsPortManager::FlushNetworkPorts() {
+  for (auto& network_port : network_ports_) network_port.second->Flush();
+}
+#endif
 
 // UART Communication port functions
 int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_rate, unsigned int tx_buffer_size, unsigned int rx_buffer_size) {
 #ifdef USE_HILS
+#ifndef WIN32
+  if (network_port_configs_.count(port_id) > 0) {
+    // The baud rate is not used for the network transport
+    if (network_ports_.count(port_id) > 0) {
+      printf("Error: Port is already used\n");
+      return -1;
+    }
+    if (tx_buffer_size <= 0 || rx_buffer_size <= 0) {
+      printf("Error: Illegal parameter\n");
+      return -1;
+    }
+    network_ports_[port_id] = new HilsNetworkPort(network_port_configs_.at(port_id), tx_buffer_size, rx_buffer_size);
+    return 0;
+  }
+#endif
   if (uart_ports_[port_id] != nullptr) {
     printf("Error: Port is already used\n");
     return -1;
@@ -39,6 +74,13 @@ int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_
 // Close port and free resources
 int HilsPortManager::UartCloseComPort(unsigned int port_id) {
 #ifdef USE_HILS
+#ifndef WIN32
+  if (network_ports_.count(port_id) > 0) {
+    delete network_ports_.at(port_id);  // The port is closed in the destructor
+    network_ports_.erase(port_id);
+    return 0;
+  }
+#endif
   if (uart_ports_[port_id] == nullptr) {
     // Port not used
     return -1;
@@ -58,6 +100,9 @@ int HilsPortManager::UartCloseComPort(unsigned int port_id) {
 
 int HilsPortManager::UartReceive(unsigned int port_id, unsigned char* buffer, int offset, int length) {
 #ifdef USE_HILS
+#ifndef WIN32
+  if (network_ports_.count(port_id) > 0) return network_ports_.at(port_id)->ReadRx(buffer, offset, length);
+#endif
   HilsUartPort* port = uart_ports_[port_id];
   if (port == nullptr) return -1;
   int ret = port->ReadRx(buffer, offset, length);
@@ -83,6 +128,9 @@ int HilsPortManager::UartReceive(unsigned int port_id, unsigned char* buffer, in
 
 int HilsPortManager::UartSend(unsigned int port_id, const unsigned char* buffer, int offset, int length) {
 #ifdef USE_HILS
+#ifndef WIN32
+  if (network_ports_.count(port_id) > 0) return network_ports_.at(port_id)->WriteTx(buffer, offset, length);
+#endif
   HilsUartPort* port = uart_ports_[port_id];
   if (port == nullptr) return -1;
   int ret = port->WriteTx(buffer, offset, length);
@@ -129,6 +177,7 @@ int HilsPortManager::I2cTargetCloseComPort(unsigned int port_id) {
     // Port not used
     return -1;
   }
+  i2c_ports_[port_id]->StopAsyncService();
   i2c_ports_[port_id]->ClosePort();
   HilsI2cTargetPort* port = i2c_ports_.at(port_id);
   delete port;
@@ -243,6 +292,35 @@ int HilsPortManager::I2cTargetGetStoredFrameCounter(unsigned int port_id) {
 #endif
 }
 
+int HilsPortManager::I2cTargetStartAsyncService(unsigned int port_id, const unsigned int stored_frame_number, const unsigned char telemetry_size,
+                                                const unsigned int service_period_us) {
+#ifdef USE_HILS
+  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  if (port == nullptr) return -1;
+  return port->StartAsyncService(stored_frame_number, telemetry_size, service_period_us);
+#else
+  UNUSED(port_id);
+  UNUSED(stored_frame_number);
+  UNUSED(telemetry_size);
+  UNUSED(service_period_us);
+
+  return -1;
+#endif
+}
+
+int HilsPortManager::I2cTargetPublishRegisters(unsigned int port_id) {
+#ifdef USE_HILS
+  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  if (port == nullptr) return -1;
+  port->PublishRegisters();
+  return 0;
+#else
+  UNUSED(port_id);
+
+  return -1;
+#endif
+}
+
 // I2C Controller Communication port functions
 int HilsPortManager::I2cControllerConnectComPort(unsigned int port_id, unsigned int baud_rate, unsigned int tx_buffer_size,
                                                  unsigned int rx_buffer_size) {
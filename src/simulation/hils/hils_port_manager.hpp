@@ -7,14 +7,19 @@
 #define S2E_SIMULATION_HILS_HILS_PORT_MANAGER_HPP_
 
 #ifdef USE_HILS
-#include "ports/hils_i2c_target_port.hpp"
-#include "ports/hils_uart_port.hpp"
+#include <components/ports/hils_i2c_target_port.hpp>
+#include <components/ports/hils_uart_port.hpp>
+#ifndef WIN32
+#include <components/ports/hils_network_port.hpp>
+#endif
 #endif
 #include <map>
 
 /**
  * @class HilsPortManager
  * @brief Class to manage COM ports for HILS test
+ * @details On Linux, a UART (or I2C controller) port ID can be mapped onto UDP, TCP, or a shared memory ring with RegisterNetworkPort.
+ *          The traffic of the port is exchanged with another process through HilsNetworkPort instead of the COM port.
  */
 class HilsPortManager {
  public:
@@ -29,6 +34,23 @@ class HilsPortManager {
    */
   virtual ~HilsPortManager();
 
+#if defined(USE_HILS) && !defined(WIN32)
+  // Network transport functions
+  /**
+   * @fn RegisterNetworkPort
+   * @brief Map the port ID onto the network transport. It must be called before the port is connected.
+   * @param [in] port_id: COM port ID used by the components
+   * @param [in] config: Settings of the network transport
+   * @return 0: success, -1: the port is already connected
+   */
+  int RegisterNetworkPort(unsigned int port_id, const HilsNetworkPortConfig& config);
+  /**
+   * @fn FlushNetworkPorts
+   * @brief Send the batched TX data of all network ports. Call it at the end of each step when the batching is used.
+   */
+  void FlushNetworkPorts();
+#endif
+
   // UART Communication port functions
   /**
    * @fn UartConnectComPort
@@ -125,6 +147,24 @@ class HilsPortManager {
    * @return -1: error, others: stored frame counter
    */
   virtual int I2cTargetGetStoredFrameCounter(unsigned int port_id);
+  /**
+   * @fn I2cTargetStartAsyncService
+   * @brief Start the service thread to handle the I2C-USB converter asynchronously
+   * @param [in] port_id: COM port ID
+   * @param [in] stored_frame_number: Number of the telemetry frames kept stored in the converter
+   * @param [in] telemetry_size: Size of each telemetry frame [bytes]
+   * @param [in] service_period_us: Polling period of the converter [us]
+   * @return 0: success, -1: error
+   */
+  virtual int I2cTargetStartAsyncService(unsigned int port_id, const unsigned int stored_frame_number, const unsigned char telemetry_size,
+                                         const unsigned int service_period_us);
+  /**
+   * @fn I2cTargetPublishRegisters
+   * @brief Publish the registers to the service thread
+   * @param [in] port_id: COM port ID
+   * @return 0: success, -1: error
+   */
+  virtual int I2cTargetPublishRegisters(unsigned int port_id);
 
   // I2C Controller Communication port functions
   /**
@@ -165,6 +205,10 @@ class HilsPortManager {
 #ifdef USE_HILS
   std::map<int, HilsUartPort*> uart_ports_;      //!< UART ports
   std::map<int, HilsI2cTargetPort*> i2c_ports_;  //!< I2C ports
+#ifndef WIN32
+  std::map<int, HilsNetworkPortConfig> network_port_configs_;  //!< Settings of the port IDs mapped onto the network transport
+  std::map<int, HilsNetworkPort*> network_ports_;              //!< Connected network ports
+#endif
 #endif
 };
 
@@ -0,0 +1,315 @@
+/**
+ * @file ensemble_propagator.cpp
+ * @brief Batch propagation of the Monte-Carlo cases with a restricted set of dynamics
+ */
+
+#include "ensemble_propagator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <iostream>
+#include <math_physics/atmosphere/simple_air_density_model.hpp>
+#include <math_physics/math/matrix_vector.hpp>
+
+namespace {
+/**
+ * @fn CalcStep_s
+ * @brief Return the next step to reach the end time in the same way as AttitudeRk4::Propagate [s]
+ */
+inline double CalcStep_s(const double remaining_time_s, const double step_s) {
+  return (remaining_time_s - step_s > 1.0e-6) ? step_s : remaining_time_s;
+}
+
+const double kRk4StageFactors[3] = {0.5, 0.5, 1.0};  //!< Factors of the step to make the states of the RK4 stages
+const double kRk4Weights[4] = {1.0, 2.0, 2.0, 1.0};  //!< Weights of the RK4 stages
+}  // namespace
+
+void EnsembleStates::Resize(const size_t number_of_samples) {
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i].resize(number_of_samples);
+    velocity_i_m_s[i].resize(number_of_samples);
+    angular_velocity_b_rad_s[i].resize(number_of_samples);
+  }
+  for (size_t i = 0; i < 4; i++) {
+    quaternion_i2b[i].resize(number_of_samples);
+  }
+  minimum_altitude_m.resize(number_of_samples);
+}
+
+CpuEnsembleBackend::CpuEnsembleBackend(const unsigned int number_of_threads) : thread_pool_(number_of_threads) {}
+
+void CpuEnsembleBackend::Propagate(EnsembleStates& states, const EnsembleDynamicsParameters& parameters) {
+  const size_t number_of_samples = states.GetNumberOfSamples();
+  const size_t number_of_blocks = (number_of_samples + kBlockSize - 1) / kBlockSize;
+  thread_pool_.ParallelFor(number_of_blocks, [&](const size_t block_index) {
+    const size_t begin = block_index * kBlockSize;
+    const size_t end = std::min(begin + kBlockSize, number_of_samples);
+    PropagateOrbitBlock(states, parameters, begin, end);
+    PropagateAttitudeBlock(states, parameters, begin, end);
+  });
+}
+
+void CpuEnsembleBackend::PropagateOrbitBlock(EnsembleStates& states, const EnsembleDynamicsParameters& parameters, const size_t begin,
+                                             const size_t end) const {
+  const size_t n = end - begin;
+  double x[6][kBlockSize], stage_x[6][kBlockSize], k[6][kBlockSize], sum_k[6][kBlockSize];
+  double step_altitude_m[kBlockSize], drag_factor_1_m[kBlockSize], minimum_altitude_m[kBlockSize];
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < n; j++) {
+      x[i][j] = states.position_i_m[i][begin + j];
+      x[i + 3][j] = states.velocity_i_m_s[i][begin + j];
+    }
+  }
+  for (size_t j = 0; j < n; j++) {
+    minimum_altitude_m[j] = std::sqrt(x[0][j] * x[0][j] + x[1][j] * x[1][j] + x[2][j] * x[2][j]) - environment::earth_equatorial_radius_m;
+  }
+
+  const double j2_coefficient_m2 = 1.5 * environment::earth_j2 * environment::earth_equatorial_radius_m * environment::earth_equatorial_radius_m;
+  // The rotation axis of the Earth is the z-axis of the inertial frame as the J2 acceleration
+  const double earth_angular_velocity_rad_s = environment::earth_mean_angular_velocity_rad_s;
+  const double mu_m3_s2 = parameters.gravity_constant_m3_s2;
+
+  double time_s = 0.0;
+  while (parameters.duration_s - time_s > 1.0e-6) {
+    const double step_s = CalcStep_s(parameters.duration_s - time_s, parameters.orbit_step_s);
+
+    // The air density is held in the step
+    if (parameters.ballistic_coefficient_m2_kg > 0.0) {
+      for (size_t j = 0; j < n; j++) {
+        step_altitude_m[j] = std::sqrt(x[0][j] * x[0][j] + x[1][j] * x[1][j] + x[2][j] * x[2][j]) - environment::earth_equatorial_radius_m;
+      }
+      libra::atmosphere::CalcAirDensityWithSimpleModel(step_altitude_m, n, drag_factor_1_m);
+      for (size_t j = 0; j < n; j++) {
+        drag_factor_1_m[j] *= parameters.ballistic_coefficient_m2_kg;
+      }
+    } else {
+      std::fill(drag_factor_1_m, drag_factor_1_m + n, 0.0);
+    }
+
+    for (size_t stage = 0; stage < 4; stage++) {
+      const double(*input)[kBlockSize] = stage == 0 ? x : stage_x;
+      for (size_t j = 0; j < n; j++) {
+        const double r2_m2 = input[0][j] * input[0][j] + input[1][j] * input[1][j] + input[2][j] * input[2][j];
+        const double mu_r3 = mu_m3_s2 / (r2_m2 * std::sqrt(r2_m2));
+        const double j2_r2 = j2_coefficient_m2 / r2_m2;
+        const double z2_r2 = input[2][j] * input[2][j] / r2_m2;
+        const double horizontal_factor = mu_r3 * (1.0 + j2_r2 * (1.0 - 5.0 * z2_r2));
+        const double vertical_factor = mu_r3 * (1.0 + j2_r2 * (3.0 - 5.0 * z2_r2));
+        // Velocity relative to the atmosphere rotating with the Earth
+        const double relative_velocity_x_m_s = input[3][j] + earth_angular_velocity_rad_s * input[1][j];
+        const double relative_velocity_y_m_s = input[4][j] - earth_angular_velocity_rad_s * input[0][j];
+        const double relative_velocity_z_m_s = input[5][j];
+        const double relative_speed_m_s = std::sqrt(relative_velocity_x_m_s * relative_velocity_x_m_s +
+                                                    relative_velocity_y_m_s * relative_velocity_y_m_s +
+                                                    relative_velocity_z_m_s * relative_velocity_z_m_s);
+        const double drag_factor_1_s = -0.5 * drag_factor_1_m[j] * relative_speed_m_s;
+        k[0][j] = input[3][j];
+        k[1][j] = input[4][j];
+        k[2][j] = input[5][j];
+        k[3][j] = -horizontal_factor * input[0][j] + drag_factor_1_s * relative_velocity_x_m_s;
+        k[4][j] = -horizontal_factor * input[1][j] + drag_factor_1_s * relative_velocity_y_m_s;
+        k[5][j] = -vertical_factor * input[2][j] + drag_factor_1_s * relative_velocity_z_m_s;
+      }
+      for (size_t i = 0; i < 6; i++) {
+        for (size_t j = 0; j < n; j++) {
+          sum_k[i][j] = (stage == 0 ? 0.0 : sum_k[i][j]) + kRk4Weights[stage] * k[i][j];
+          if (stage < 3) stage_x[i][j] = x[i][j] + kRk4StageFactors[stage] * step_s * k[i][j];
+        }
+      }
+    }
+
+    const double sixth_step_s = step_s / 6.0;
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < n; j++) {
+        x[i][j] += sixth_step_s * sum_k[i][j];
+      }
+    }
+    for (size_t j = 0; j < n; j++) {
+      const double altitude_m = std::sqrt(x[0][j] * x[0][j] + x[1][j] * x[1][j] + x[2][j] * x[2][j]) - environment::earth_equatorial_radius_m;
+      minimum_altitude_m[j] = std::min(minimum_altitude_m[j], altitude_m);
+    }
+    time_s += step_s;
+  }
+
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < n; j++) {
+      states.position_i_m[i][begin + j] = x[i][j];
+      states.velocity_i_m_s[i][begin + j] = x[i + 3][j];
+    }
+  }
+  for (size_t j = 0; j < n; j++) {
+    states.minimum_altitude_m[begin + j] = minimum_altitude_m[j];
+  }
+}
+
+void CpuEnsembleBackend::PropagateAttitudeBlock(EnsembleStates& states, const EnsembleDynamicsParameters& parameters, const size_t begin,
+                                                const size_t end) const {
+  const size_t n = end - begin;
+  // x = [angular velocity, quaternion] as AttitudeRk4
+  double x[7][kBlockSize], stage_x[7][kBlockSize], k[7][kBlockSize], sum_k[7][kBlockSize];
+  for (size_t j = 0; j < n; j++) {
+    for (size_t i = 0; i < 3; i++) {
+      x[i][j] = states.angular_velocity_b_rad_s[i][begin + j];
+    }
+    for (size_t i = 0; i < 4; i++) {
+      x[i + 3][j] = states.quaternion_i2b[i][begin + j];
+    }
+  }
+
+  const libra::Matrix<3, 3> inverse_inertia_tensor = libra::CalcInverseMatrix(parameters.inertia_tensor_kgm2);
+  double inertia[3][3], inverse_inertia[3][3];
+  for (size_t r = 0; r < 3; r++) {
+    for (size_t c = 0; c < 3; c++) {
+      inertia[r][c] = parameters.inertia_tensor_kgm2[r][c];
+      inverse_inertia[r][c] = inverse_inertia_tensor[r][c];
+    }
+  }
+
+  double time_s = 0.0;
+  while (parameters.duration_s - time_s > 1.0e-6) {
+    const double step_s = CalcStep_s(parameters.duration_s - time_s, parameters.attitude_step_s);
+
+    for (size_t stage = 0; stage < 4; stage++) {
+      const double(*input)[kBlockSize] = stage == 0 ? x : stage_x;
+      for (size_t j = 0; j < n; j++) {
+        const double w0 = input[0][j], w1 = input[1][j], w2 = input[2][j];
+        const double h0 = inertia[0][0] * w0 + inertia[0][1] * w1 + inertia[0][2] * w2;
+        const double h1 = inertia[1][0] * w0 + inertia[1][1] * w1 + inertia[1][2] * w2;
+        const double h2 = inertia[2][0] * w0 + inertia[2][1] * w1 + inertia[2][2] * w2;
+        // Torque-free Euler equation: I dw/dt = - w x Iw
+        const double torque0 = -(w1 * h2 - w2 * h1);
+        const double torque1 = -(w2 * h0 - w0 * h2);
+        const double torque2 = -(w0 * h1 - w1 * h0);
+        k[0][j] = inverse_inertia[0][0] * torque0 + inverse_inertia[0][1] * torque1 + inverse_inertia[0][2] * torque2;
+        k[1][j] = inverse_inertia[1][0] * torque0 + inverse_inertia[1][1] * torque1 + inverse_inertia[1][2] * torque2;
+        k[2][j] = inverse_inertia[2][0] * torque0 + inverse_inertia[2][1] * torque1 + inverse_inertia[2][2] * torque2;
+        // Kinematics of AttitudeRk4::CalcAngularVelocityMatrix
+        const double q0 = input[3][j], q1 = input[4][j], q2 = input[5][j], q3 = input[6][j];
+        k[3][j] = 0.5 * (w2 * q1 - w1 * q2 + w0 * q3);
+        k[4][j] = 0.5 * (-w2 * q0 + w0 * q2 + w1 * q3);
+        k[5][j] = 0.5 * (w1 * q0 - w0 * q1 + w2 * q3);
+        k[6][j] = 0.5 * (-w0 * q0 - w1 * q1 - w2 * q2);
+      }
+      for (size_t i = 0; i < 7; i++) {
+        for (size_t j = 0; j < n; j++) {
+          sum_k[i][j] = (stage == 0 ? 0.0 : sum_k[i][j]) + kRk4Weights[stage] * k[i][j];
+          if (stage < 3) stage_x[i][j] = x[i][j] + kRk4StageFactors[stage] * step_s * k[i][j];
+        }
+      }
+    }
+
+    const double sixth_step_s = step_s / 6.0;
+    for (size_t i = 0; i < 7; i++) {
+      for (size_t j = 0; j < n; j++) {
+        x[i][j] += sixth_step_s * sum_k[i][j];
+      }
+    }
+    for (size_t j = 0; j < n; j++) {
+      const double norm = std::sqrt(x[3][j] * x[3][j] + x[4][j] * x[4][j] + x[5][j] * x[5][j] + x[6][j] * x[6][j]);
+      for (size_t i = 3; i < 7; i++) {
+        x[i][j] /= norm;
+      }
+    }
+    time_s += step_s;
+  }
+
+  for (size_t j = 0; j < n; j++) {
+    for (size_t i = 0; i < 3; i++) {
+      states.angular_velocity_b_rad_s[i][begin + j] = x[i][j];
+    }
+    for (size_t i = 0; i < 4; i++) {
+      states.quaternion_i2b[i][begin + j] = x[i + 3][j];
+    }
+  }
+}
+
+std::unique_ptr<EnsembleBackend> CreateEnsembleBackend(const std::string backend_name, const unsigned int number_of_threads) {
+  if (backend_name != "CPU") {
+    std::cout << "[Warning] Ensemble propagation: backend " << backend_name << " is not built. The CPU backend is used." << std::endl;
+  }
+  return std::make_unique<CpuEnsembleBackend>(number_of_threads);
+}
+
+std::string EnsembleSampleResult::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  str_tmp += WriteVector("spacecraft_position", "i", "m", 3);
+  str_tmp += WriteVector("spacecraft_velocity", "i", "m/s", 3);
+  str_tmp += WriteScalar("spacecraft_minimum_altitude", "m");
+  str_tmp += WriteQuaternion("spacecraft_quaternion", "i2b");
+  str_tmp += WriteVector("spacecraft_angular_velocity", "b", "rad/s", 3);
+
+  return str_tmp;
+}
+
+std::string EnsembleSampleResult::GetLogValue() const {
+  libra::Vector<3> position_i_m, velocity_i_m_s, angular_velocity_b_rad_s;
+  libra::Quaternion quaternion_i2b;
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i] = states_.position_i_m[i][sample_index_];
+    velocity_i_m_s[i] = states_.velocity_i_m_s[i][sample_index_];
+    angular_velocity_b_rad_s[i] = states_.angular_velocity_b_rad_s[i][sample_index_];
+  }
+  for (size_t i = 0; i < 4; i++) {
+    quaternion_i2b[i] = states_.quaternion_i2b[i][sample_index_];
+  }
+
+  std::string str_tmp = "";
+
+  str_tmp += WriteVector(position_i_m, 16);
+  str_tmp += WriteVector(velocity_i_m_s, 16);
+  str_tmp += WriteScalar(states_.minimum_altitude_m[sample_index_], 16);
+  str_tmp += WriteQuaternion(quaternion_i2b);
+  str_tmp += WriteVector(angular_velocity_b_rad_s);
+
+  return str_tmp;
+}
+
+EnsemblePropagator::EnsemblePropagator(const EnsembleDynamicsParameters& parameters, const libra::Vector<3>& position_i_m,
+                                       const libra::Vector<3>& velocity_i_m_s, const libra::Quaternion& quaternion_i2b,
+                                       const libra::Vector<3>& angular_velocity_b_rad_s, const size_t spacecraft_id, const size_t batch_size,
+                                       std::unique_ptr<EnsembleBackend> backend)
+    : parameters_(parameters),
+      position_i_m_(position_i_m),
+      velocity_i_m_s_(velocity_i_m_s),
+      quaternion_i2b_(quaternion_i2b),
+      angular_velocity_b_rad_s_(angular_velocity_b_rad_s),
+      orbit_object_name_("orbit" + std::to_string(spacecraft_id)),
+      attitude_object_name_("attitude" + std::to_string(spacecraft_id)),
+      batch_size_(batch_size > 0 ? batch_size : 1),
+      backend_(std::move(backend)) {}
+
+void EnsemblePropagator::Execute(MonteCarloSimulationExecutor& monte_carlo_simulator) {
+  monte_carlo_simulator.ExecuteBatches(batch_size_, [this](const std::vector<MonteCarloSimulationExecutor>& case_executors) {
+    states_.Resize(case_executors.size());
+    for (size_t sample_index = 0; sample_index < case_executors.size(); sample_index++) {
+      // The parameters which are not randomized keep the initial states of the initialize file
+      libra::Vector<3> position_i_m = position_i_m_;
+      libra::Vector<3> velocity_i_m_s = velocity_i_m_s_;
+      libra::Quaternion quaternion_i2b = quaternion_i2b_;
+      libra::Vector<3> angular_velocity_b_rad_s = angular_velocity_b_rad_s_;
+      const MonteCarloSimulationExecutor& case_executor = case_executors[sample_index];
+      case_executor.GetInitializedMonteCarloParameterVector(orbit_object_name_, "position_i_m", position_i_m);
+      case_executor.GetInitializedMonteCarloParameterVector(orbit_object_name_, "velocity_i_m_s", velocity_i_m_s);
+      case_executor.GetInitializedMonteCarloParameterQuaternion(attitude_object_name_, "quaternion_i2b", quaternion_i2b);
+      case_executor.GetInitializedMonteCarloParameterVector(attitude_object_name_, "angular_velocity_b_rad_s", angular_velocity_b_rad_s);
+
+      for (size_t i = 0; i < 3; i++) {
+        states_.position_i_m[i][sample_index] = position_i_m[i];
+        states_.velocity_i_m_s[i][sample_index] = velocity_i_m_s[i];
+        states_.angular_velocity_b_rad_s[i][sample_index] = angular_velocity_b_rad_s[i];
+      }
+      for (size_t i = 0; i < 4; i++) {
+        states_.quaternion_i2b[i][sample_index] = quaternion_i2b[i];
+      }
+    }
+
+    backend_->Propagate(states_, parameters_);
+
+    for (size_t sample_index = 0; sample_index < case_executors.size(); sample_index++) {
+      EnsembleSampleResult case_result(states_, sample_index);
+      case_executors[sample_index].SetCaseResult(case_result);
+    }
+  });
+}
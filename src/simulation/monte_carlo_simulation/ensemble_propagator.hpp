@@ -0,0 +1,225 @@
+/**
+ * @file ensemble_propagator.hpp
+ * @brief Batch propagation of the Monte-Carlo cases with a restricted set of dynamics
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_ENSEMBLE_PROPAGATOR_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_ENSEMBLE_PROPAGATOR_HPP_
+
+#include <logger/loggable.hpp>
+#include <math_physics/math/matrix.hpp>
+#include <math_physics/math/quaternion.hpp>
+#include <math_physics/math/vector.hpp>
+#include <memory>
+#include <string>
+#include <utilities/thread_pool.hpp>
+#include <vector>
+
+#include "monte_carlo_simulation_executor.hpp"
+
+/**
+ * @struct EnsembleDynamicsParameters
+ * @brief Parameters of the dynamics common to all samples of the ensemble
+ */
+struct EnsembleDynamicsParameters {
+  double gravity_constant_m3_s2;            //!< Gravity constant of the Earth [m3/s2]
+  double ballistic_coefficient_m2_kg;       //!< Drag coefficient times the area per mass [m2/kg]. Zero disables the air drag.
+  libra::Matrix<3, 3> inertia_tensor_kgm2;  //!< Inertia tensor of the spacecraft in the body frame [kgm2]
+  double duration_s;                        //!< Propagation duration [s]
+  double orbit_step_s;                      //!< Maximum step of the orbit propagation [s]
+  double attitude_step_s;                   //!< Maximum step of the attitude propagation [s]
+};
+
+/**
+ * @struct EnsembleStates
+ * @brief States of all samples of the ensemble stored as structure of arrays
+ */
+struct EnsembleStates {
+  std::vector<double> position_i_m[3];              //!< Spacecraft position in the inertial frame [m]
+  std::vector<double> velocity_i_m_s[3];            //!< Spacecraft velocity in the inertial frame [m/s]
+  std::vector<double> quaternion_i2b[4];            //!< Quaternion from the inertial frame to the body frame
+  std::vector<double> angular_velocity_b_rad_s[3];  //!< Angular velocity of the body frame [rad/s]
+  std::vector<double> minimum_altitude_m;           //!< Minimum altitude above the Earth equatorial radius in the propagation [m]
+
+  /**
+   * @fn Resize
+   * @brief Resize the arrays to the number of samples
+   */
+  void Resize(const size_t number_of_samples);
+  /**
+   * @fn GetNumberOfSamples
+   * @brief Return number of samples
+   */
+  inline size_t GetNumberOfSamples() const { return minimum_altitude_m.size(); }
+};
+
+/**
+ * @class EnsembleBackend
+ * @brief Abstract class of the backends which propagate all samples of the ensemble
+ * @note The backends must give the same results as the CPU backend within the rounding errors.
+ */
+class EnsembleBackend {
+ public:
+  /**
+   * @fn ~EnsembleBackend
+   * @brief Destructor
+   */
+  virtual ~EnsembleBackend() {}
+  /**
+   * @fn Propagate
+   * @brief Propagate all samples for the duration of the parameters
+   * @param [in/out] states: States of the samples
+   * @param [in] parameters: Parameters of the dynamics
+   */
+  virtual void Propagate(EnsembleStates& states, const EnsembleDynamicsParameters& parameters) = 0;
+  /**
+   * @fn GetName
+   * @brief Return name of the backend
+   */
+  virtual std::string GetName() const = 0;
+};
+
+/**
+ * @class CpuEnsembleBackend
+ * @brief Backend to propagate the samples with the threads of the CPU
+ * @details The samples are divided into blocks, and each block is propagated with the RK4 method in a thread. The states of a block are
+ *          updated stage by stage over the samples, so the loops over the samples are vectorized by the compiler.
+ *          The orbit is propagated with the two-body gravity, the J2 acceleration, and the air drag of the simple air density model with the
+ *          atmosphere rotating with the Earth. The air density is held in each step as ComposedForceModel. The attitude is the torque-free
+ *          rigid body rotation of AttitudeRk4.
+ */
+class CpuEnsembleBackend : public EnsembleBackend {
+ public:
+  /**
+   * @fn CpuEnsembleBackend
+   * @brief Constructor
+   * @param [in] number_of_threads: Number of threads including the calling thread
+   */
+  explicit CpuEnsembleBackend(const unsigned int number_of_threads);
+
+  /**
+   * @fn Propagate
+   * @brief Override function of EnsembleBackend
+   */
+  void Propagate(EnsembleStates& states, const EnsembleDynamicsParameters& parameters) override;
+  /**
+   * @fn GetName
+   * @brief Override function of EnsembleBackend
+   */
+  inline std::string GetName() const override { return "CPU"; }
+
+  static const size_t kBlockSize = 64;  //!< Number of samples propagated together in a thread
+
+ private:
+  ThreadPool thread_pool_;  //!< Thread pool to propagate the blocks
+
+  /**
+   * @fn PropagateOrbitBlock
+   * @brief Propagate the orbits of the samples in [begin, end)
+   */
+  void PropagateOrbitBlock(EnsembleStates& states, const EnsembleDynamicsParameters& parameters, const size_t begin, const size_t end) const;
+  /**
+   * @fn PropagateAttitudeBlock
+   * @brief Propagate the attitudes of the samples in [begin, end)
+   */
+  void PropagateAttitudeBlock(EnsembleStates& states, const EnsembleDynamicsParameters& parameters, const size_t begin, const size_t end) const;
+};
+
+/**
+ * @fn CreateEnsembleBackend
+ * @brief Make the backend of the ensemble propagation
+ * @note Only the CPU backend is built. The other backends fall back to the CPU backend with a warning.
+ * @param [in] backend_name: Name of the backend (CPU)
+ * @param [in] number_of_threads: Number of threads of the CPU backend
+ * @return Backend
+ */
+std::unique_ptr<EnsembleBackend> CreateEnsembleBackend(const std::string backend_name, const unsigned int number_of_threads);
+
+/**
+ * @class EnsembleSampleResult
+ * @brief Loggable to write the summary of a sample as the case result of the Monte-Carlo simulation
+ */
+class EnsembleSampleResult : public ILoggable {
+ public:
+  /**
+   * @fn EnsembleSampleResult
+   * @brief Constructor
+   * @param [in] states: States of the ensemble after the propagation
+   * @param [in] sample_index: Index of the sample in the ensemble
+   */
+  EnsembleSampleResult(const EnsembleStates& states, const size_t sample_index) : states_(states), sample_index_(sample_index) {}
+
+  /**
+   * @fn GetLogHeader
+   * @brief Override function of ILoggable
+   */
+  std::string GetLogHeader() const override;
+  /**
+   * @fn GetLogValue
+   * @brief Override function of ILoggable
+   */
+  std::string GetLogValue() const override;
+
+ private:
+  const EnsembleStates& states_;  //!< States of the ensemble
+  const size_t sample_index_;     //!< Index of the sample
+};
+
+/**
+ * @class EnsemblePropagator
+ * @brief Class to execute the Monte-Carlo cases as batches of the ensemble propagation
+ * @details The initial states of all cases are taken from the spacecraft initialize file, and the randomized parameters of the cases
+ *          (orbit<id>.position_i_m, orbit<id>.velocity_i_m_s, attitude<id>.quaternion_i2b, and attitude<id>.angular_velocity_b_rad_s) are
+ *          applied to them. The summary of each case is passed to MonteCarloSimulationExecutor::SetCaseResult.
+ *          The full simulation cases with the same settings are the reference of the results.
+ */
+class EnsemblePropagator {
+ public:
+  /**
+   * @fn EnsemblePropagator
+   * @brief Constructor
+   * @param [in] parameters: Parameters of the dynamics
+   * @param [in] position_i_m: Initial spacecraft position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial spacecraft velocity in the inertial frame [m/s]
+   * @param [in] quaternion_i2b: Initial quaternion from the inertial frame to the body frame
+   * @param [in] angular_velocity_b_rad_s: Initial angular velocity of the body frame [rad/s]
+   * @param [in] spacecraft_id: Spacecraft ID to make the names of the randomized parameters
+   * @param [in] batch_size: Number of cases propagated together
+   * @param [in] backend: Backend of the propagation
+   */
+  EnsemblePropagator(const EnsembleDynamicsParameters& parameters, const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s,
+                     const libra::Quaternion& quaternion_i2b, const libra::Vector<3>& angular_velocity_b_rad_s, const size_t spacecraft_id,
+                     const size_t batch_size, std::unique_ptr<EnsembleBackend> backend);
+
+  /**
+   * @fn Execute
+   * @brief Execute all cases of the Monte-Carlo simulation
+   * @param [in/out] monte_carlo_simulator: Monte-Carlo simulator
+   */
+  void Execute(MonteCarloSimulationExecutor& monte_carlo_simulator);
+
+  /**
+   * @fn GetBackend
+   * @brief Return backend of the propagation
+   */
+  inline const EnsembleBackend& GetBackend() const { return *backend_; }
+  /**
+   * @fn GetBatchSize
+   * @brief Return number of cases propagated together
+   */
+  inline size_t GetBatchSize() const { return batch_size_; }
+
+ private:
+  EnsembleDynamicsParameters parameters_;      //!< Parameters of the dynamics
+  libra::Vector<3> position_i_m_;              //!< Initial spacecraft position in the inertial frame [m]
+  libra::Vector<3> velocity_i_m_s_;            //!< Initial spacecraft velocity in the inertial frame [m/s]
+  libra::Quaternion quaternion_i2b_;           //!< Initial quaternion from the inertial frame to the body frame
+  libra::Vector<3> angular_velocity_b_rad_s_;  //!< Initial angular velocity of the body frame [rad/s]
+  std::string orbit_object_name_;              //!< Name of the orbit in the randomized parameters
+  std::string attitude_object_name_;           //!< Name of the attitude in the randomized parameters
+  size_t batch_size_;                          //!< Number of cases propagated together
+  std::unique_ptr<EnsembleBackend> backend_;   //!< Backend of the propagation
+  EnsembleStates states_;                      //!< States of the current batch
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_ENSEMBLE_PROPAGATOR_HPP_
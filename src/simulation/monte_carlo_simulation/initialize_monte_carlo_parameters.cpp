@@ -10,20 +10,17 @@
 using namespace std;
 
 random_device InitializedMonteCarloParameters::randomizer_;
-mt19937 InitializedMonteCarloParameters::mt_;
-uniform_real_distribution<>* InitializedMonteCarloParameters::uniform_distribution_;
-normal_distribution<>* InitializedMonteCarloParameters::normal_distribution_;
+thread_local mt19937 InitializedMonteCarloParameters::mt_;
+thread_local uniform_real_distribution<> InitializedMonteCarloParameters::uniform_distribution_(0.0, 1.0);
+thread_local normal_distribution<> InitializedMonteCarloParameters::normal_distribution_(0.0, 1.0);
+thread_local InitializedMonteCarloParameters::SamplingMethod InitializedMonteCarloParameters::sampling_method_ =
+    InitializedMonteCarloParameters::SamplingMethod::kPseudoRandom;
+thread_local unsigned long long InitializedMonteCarloParameters::sample_index_ = 0;
+thread_local size_t InitializedMonteCarloParameters::sample_dimension_ = 0;
+thread_local libra::SobolSequence InitializedMonteCarloParameters::sobol_sequence_;
+thread_local libra::LatinHypercube InitializedMonteCarloParameters::latin_hypercube_(1, 0);
 
 InitializedMonteCarloParameters::InitializedMonteCarloParameters() {
-  // Generate object when the first execution
-  static bool initial_setup_done = false;
-  if (!initial_setup_done) {
-    SetSeed();
-    InitializedMonteCarloParameters::uniform_distribution_ = new uniform_real_distribution<>(0.0, 1.0);
-    InitializedMonteCarloParameters::normal_distribution_ = new normal_distribution<>(0.0, 1.0);
-    initial_setup_done = true;
-  }
-
   // No randomization when SetRandomConfiguration is not called（No setting in MCSim.ini）
   randomization_type_ = kNoRandomization;
 }
@@ -34,6 +31,43 @@ void InitializedMonteCarloParameters::SetSeed(unsigned long seed, bool is_determ
   } else {
     InitializedMonteCarloParameters::mt_.seed(InitializedMonteCarloParameters::randomizer_());
   }
+  // Discard the cached value so that the generated sequence depends only on the seed
+  InitializedMonteCarloParameters::normal_distribution_.reset();
+}
+
+void InitializedMonteCarloParameters::SetSamplingPoint(const SamplingMethod sampling_method, const unsigned long long case_index,
+                                                       const unsigned long long number_of_cases, const unsigned long long sampling_seed) {
+  sampling_method_ = sampling_method;
+  sample_index_ = case_index;
+  sample_dimension_ = 0;
+  if (sampling_method_ == SamplingMethod::kSobol) {
+    sobol_sequence_ = libra::SobolSequence(sampling_seed);
+  } else if (sampling_method_ == SamplingMethod::kLatinHypercube) {
+    latin_hypercube_ = libra::LatinHypercube(number_of_cases, sampling_seed);
+  }
+}
+
+void InitializedMonteCarloParameters::SetFixedValue(const std::vector<double>& value) {
+  randomization_type_ = kFixedValue;
+  randomized_value_ = value;
+}
+
+size_t InitializedMonteCarloParameters::GetNumberOfSampleDimensions() const {
+  switch (randomization_type_) {
+    case kCartesianUniform:
+    case kCartesianNormal:
+      return mean_or_min_.size();
+    case kCircularNormalUniform:
+    case kCircularNormalNormal:
+      return 2;
+    case kSphericalNormalUniformUniform:
+    case kSphericalNormalNormal:
+    case kQuaternionUniform:
+    case kQuaternionNormal:
+      return 3;
+    default:
+      return 0;
+  }
 }
 
 void InitializedMonteCarloParameters::GetRandomizedScalar(double& destination) const {
@@ -89,17 +123,40 @@ void InitializedMonteCarloParameters::Randomize() {
     case kQuaternionNormal:
       GenerateQuaternionNormal();
       break;
+    case kFixedValue:
+      // Keep the value set by SetFixedValue
+      break;
     default:
       break;
   }
 }
 
+double InitializedMonteCarloParameters::GenerateUniformSample() {
+  const size_t dimension = sample_dimension_++;
+  if (sampling_method_ == SamplingMethod::kSobol && dimension < libra::SobolSequence::kMaxDimension) {
+    return sobol_sequence_.CalcPoint(sample_index_, dimension);
+  } else if (sampling_method_ == SamplingMethod::kLatinHypercube) {
+    // Avoid zero to keep the inverse CDF finite
+    double jitter = uniform_distribution_(mt_);
+    if (jitter <= 0.0) jitter = 0.5;
+    return latin_hypercube_.CalcPoint(sample_index_, dimension, jitter);
+  }
+  return uniform_distribution_(mt_);
+}
+
 double InitializedMonteCarloParameters::Generate1dUniform(double lb, double ub) {
-  return lb + (*InitializedMonteCarloParameters::uniform_distribution_)(InitializedMonteCarloParameters::mt_) * (ub - lb);
+  return lb + InitializedMonteCarloParameters::GenerateUniformSample() * (ub - lb);
 }
 
 double InitializedMonteCarloParameters::Generate1dNormal(double mean, double std) {
-  return mean + (*InitializedMonteCarloParameters::normal_distribution_)(InitializedMonteCarloParameters::mt_) * (std);
+  if (sampling_method_ == SamplingMethod::kPseudoRandom) {
+    sample_dimension_++;
+    return mean + InitializedMonteCarloParameters::normal_distribution_(InitializedMonteCarloParameters::mt_) * (std);
+  }
+  // The uniform sample of the Sobol fallback can be zero
+  double sample = GenerateUniformSample();
+  if (sample <= 0.0) sample = 0.5;
+  return mean + libra::CalcInverseStandardNormalCdf(sample) * (std);
 }
 
 void InitializedMonteCarloParameters::GenerateNoRandomization() { randomized_value_.clear(); }
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <math_physics/randomization/low_discrepancy_sequence.hpp>
 #include <random>
 #include <string>
 #include <vector>
@@ -33,6 +34,16 @@ class InitializedMonteCarloParameters {
     kSphericalNormalNormal,          //!< r and  θ follow normal distribution, and mean vector angle φ follows uniform distribution [0,2*pi]
     kQuaternionUniform,              //!< Perfectly Randomized libra::Quaternion
     kQuaternionNormal,               //!< Angle from the default quaternion θ follows normal distribution
+    kFixedValue,                     //!< Output the value set by SetFixedValue (e.g., a point of the ParameterSweep)
+  };
+  /**
+   * @enum SamplingMethod
+   * @brief Sampling method of the random variables used by all parameters
+   */
+  enum class SamplingMethod {
+    kPseudoRandom,    //!< Independent pseudo-random variables for each case
+    kSobol,           //!< Sobol sequence over all random variables of all parameters keyed by the case index
+    kLatinHypercube,  //!< Latin hypercube over all random variables of all parameters keyed by the case index
   };
 
   /**
@@ -45,8 +56,23 @@ class InitializedMonteCarloParameters {
   /**
    * @fn SetSeed
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
+   * @note The random number generator is owned by each thread. Set the seed in the thread which executes the randomization.
    */
   static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  /**
+   * @fn SetSamplingPoint
+   * @brief Set the sampling method and the sample of the case used by the following Randomize calls in the caller thread
+   * @details The random variables drawn by Randomize are assigned to the dimensions of the sample in the order of the draws, so call
+   *          Randomize of the parameters in the same order in all cases. The normal random variables are the inverse CDF of the uniform
+   *          samples. The Sobol sequence falls back to the pseudo-random variables beyond SobolSequence::kMaxDimension.
+   * @param [in] sampling_method: Sampling method
+   * @param [in] case_index: Index of the case (sample)
+   * @param [in] number_of_cases: Total number of the cases (strata of the Latin hypercube)
+   * @param [in] sampling_seed: Seed of the scramble of the Sobol sequence and the permutations of the Latin hypercube. Use the same seed
+   *                            in all cases.
+   */
+  static void SetSamplingPoint(const SamplingMethod sampling_method, const unsigned long long case_index, const unsigned long long number_of_cases,
+                               const unsigned long long sampling_seed);
   /**
    * @fn SetRandomConfiguration
    * @brief Set randomization parameters
@@ -54,6 +80,12 @@ class InitializedMonteCarloParameters {
   template <size_t NumElement1, size_t NumElement2>
   void SetRandomConfiguration(const libra::Vector<NumElement1>& mean_or_min, const libra::Vector<NumElement2>& sigma_or_max,
                               RandomizationType random_type);
+  /**
+   * @fn SetFixedValue
+   * @brief Set the value output instead of the randomized value. The randomization type is changed to kFixedValue.
+   * @param [in] value: Elements of the value (4 elements for quaternion)
+   */
+  void SetFixedValue(const std::vector<double>& value);
 
   // Getter
   /**
@@ -72,6 +104,16 @@ class InitializedMonteCarloParameters {
    * @brief Get randomized value results
    */
   void GetRandomizedScalar(double& destination) const;
+  /**
+   * @fn GetRandomizedValues
+   * @brief Return all randomized values. Empty for NoRandomization.
+   */
+  inline const std::vector<double>& GetRandomizedValues() const { return randomized_value_; }
+  /**
+   * @fn GetNumberOfSampleDimensions
+   * @brief Return number of random variables drawn in Randomize
+   */
+  size_t GetNumberOfSampleDimensions() const;
 
   // Calculation
   /**
@@ -87,11 +129,22 @@ class InitializedMonteCarloParameters {
   std::vector<double> sigma_or_max_;  //!< standard deviation or maximum value. Refer comment in Generate[RandomizationType] function.
 
   // For randomization
-  RandomizationType randomization_type_;                           //!< Randomization type
-  static std::random_device randomizer_;                           //!< Non-deterministic random number generator with time information
-  static std::mt19937 mt_;                                         //!< Deterministic random number generator
-  static std::uniform_real_distribution<>* uniform_distribution_;  //!< Uniform random number generator
-  static std::normal_distribution<>* normal_distribution_;         //!< Normal random number generator
+  RandomizationType randomization_type_;                                       //!< Randomization type
+  static std::random_device randomizer_;                                       //!< Non-deterministic random number generator with time information
+  static thread_local std::mt19937 mt_;                                        //!< Deterministic random number generator
+  static thread_local std::uniform_real_distribution<> uniform_distribution_;  //!< Uniform random number generator
+  static thread_local std::normal_distribution<> normal_distribution_;         //!< Normal random number generator
+  static thread_local SamplingMethod sampling_method_;                         //!< Sampling method
+  static thread_local unsigned long long sample_index_;                        //!< Index of the sample of the current case
+  static thread_local size_t sample_dimension_;                                //!< Dimension of the next random variable in the sample
+  static thread_local libra::SobolSequence sobol_sequence_;                    //!< Sobol sequence
+  static thread_local libra::LatinHypercube latin_hypercube_;                  //!< Latin hypercube
+
+  /**
+   * @fn GenerateUniformSample
+   * @brief Generate the uniform random variable in [0, 1) of the next dimension with the sampling method
+   */
+  static double GenerateUniformSample();
 
   /**
    * @fn Generate1dUniform
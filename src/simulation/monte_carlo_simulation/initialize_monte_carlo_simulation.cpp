@@ -5,8 +5,13 @@
 
 #include "initialize_monte_carlo_simulation.hpp"
 
+#include <cstdlib>
 #include <cstring>
+#include <environment/global/physical_constants.hpp>
+#include <iostream>
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
+#include <thread>
 
 #define MAX_CHAR_NUM 256
 
@@ -24,6 +29,55 @@ MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name) {
   bool log_history = ini_file.ReadEnable(section, "log_enable");
   monte_carlo_simulator->SetSaveLogHistoryFlag(log_history);
 
+  // Use all hardware threads when the number of threads is negative
+  int number_of_threads = ini_file.ReadInt(section, "number_of_threads");
+  if (number_of_threads < 0) number_of_threads = (int)std::thread::hardware_concurrency();
+  monte_carlo_simulator->SetNumberOfThreads(number_of_threads);
+
+  // Seed of randomization. A deterministic seed is required to execute the shards with the same per-case seeds.
+  const long seed = ini_file.ReadInt("RANDOMIZE", "rand_seed");
+  monte_carlo_simulator->SetSeed((unsigned long)seed, seed != 0);
+
+  // Sharding to divide the cases into multiple processes. The environment variables override the initialize file settings.
+  int number_of_shards = ini_file.ReadInt(section, "number_of_shards");
+  int shard_index = ini_file.ReadInt(section, "shard_index");
+  const char* number_of_shards_env = std::getenv("S2E_MONTE_CARLO_NUMBER_OF_SHARDS");
+  if (number_of_shards_env != nullptr) number_of_shards = std::atoi(number_of_shards_env);
+  const char* shard_index_env = std::getenv("S2E_MONTE_CARLO_SHARD_INDEX");
+  if (shard_index_env != nullptr) shard_index = std::atoi(shard_index_env);
+
+  // Reuse the initialized simulation case in each worker thread
+  monte_carlo_simulator->SetCaseReuse(ini_file.ReadEnable(section, "case_reuse"));
+
+  // Sampling method of the randomized parameters
+  const std::string sampling_method = ini_file.ReadString(section, "sampling_method");
+  if (sampling_method == "SOBOL") {
+    monte_carlo_simulator->SetSamplingMethod(InitializedMonteCarloParameters::SamplingMethod::kSobol);
+  } else if (sampling_method == "LATIN_HYPERCUBE") {
+    monte_carlo_simulator->SetSamplingMethod(InitializedMonteCarloParameters::SamplingMethod::kLatinHypercube);
+  } else {
+    if (sampling_method != "" && sampling_method != "PSEUDO_RANDOM") {
+      std::cout << "[Warning] Monte-Carlo simulation: sampling_method " << sampling_method << " is not supported. PSEUDO_RANDOM is used."
+                << std::endl;
+    }
+    monte_carlo_simulator->SetSamplingMethod(InitializedMonteCarloParameters::SamplingMethod::kPseudoRandom);
+  }
+
+  // Early stopping at the convergence of a statistic of the case results
+  const std::string convergence_column = ini_file.ReadString(section, "convergence_column");
+  if (!convergence_column.empty() && convergence_column != "NULL") {
+    const std::string convergence_statistic = ini_file.ReadString(section, "convergence_statistic");
+    const int minimum_number_of_cases = ini_file.ReadInt(section, "convergence_minimum_number_of_cases");
+    const bool is_target_set = monte_carlo_simulator->SetConvergenceTarget(
+        convergence_column, convergence_statistic, ini_file.ReadDouble(section, "convergence_confidence_level"),
+        ini_file.ReadDouble(section, "convergence_absolute_tolerance"), ini_file.ReadDouble(section, "convergence_relative_tolerance"),
+        minimum_number_of_cases > 0 ? (unsigned long long)minimum_number_of_cases : 0);
+    if (!is_target_set) {
+      std::cout << "[Warning] Monte-Carlo simulation: convergence_statistic " << convergence_statistic
+                << " or convergence_confidence_level is not supported. The early stopping is disabled." << std::endl;
+    }
+  }
+
   section = "MONTE_CARLO_RANDOMIZATION";
   std::vector<std::string> so_dot_ip_str_vec = ini_file.ReadStrVector(section, "parameter");
   std::vector<std::string> so_str_vec, ip_str_vec;
@@ -91,5 +145,104 @@ MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name) {
     monte_carlo_simulator->AddInitializedMonteCarloParameter(so_str, ip_str, mean_or_min, sigma_or_max, random_type);
   }
 
+  if (monte_carlo_simulator->GetSamplingMethod() == InitializedMonteCarloParameters::SamplingMethod::kSobol &&
+      monte_carlo_simulator->GetNumberOfSampleDimensions() > libra::SobolSequence::kMaxDimension) {
+    std::cout << "[Warning] Monte-Carlo simulation: The parameters need " << monte_carlo_simulator->GetNumberOfSampleDimensions()
+              << " random variables. The pseudo-random variables are used beyond " << libra::SobolSequence::kMaxDimension
+              << " dimensions of the Sobol sequence." << std::endl;
+  }
+
+  // Deterministic parameter grid instead of the random cases. The number of the cases is decided by the grid, so the shards are set after it.
+  section = "MONTE_CARLO_SWEEP";
+  if (ini_file.ReadEnable(section, "sweep_enable")) {
+    const std::string sweep_mode = ini_file.ReadString(section, "sweep_mode");
+    ParameterSweep::Mode mode = ParameterSweep::Mode::kFullFactorial;
+    if (sweep_mode == "ONE_AT_A_TIME") {
+      mode = ParameterSweep::Mode::kOneAtATime;
+    } else if (sweep_mode != "FULL_FACTORIAL") {
+      throw std::invalid_argument("MONTE_CARLO_SWEEP: sweep_mode " + sweep_mode + " is not supported.");
+    }
+    ParameterSweep parameter_sweep(mode);
+    for (const auto& name : ini_file.ReadStrVector(section, "parameter")) {
+      const int number_of_points = ini_file.ReadInt(section, (name + MonteCarloSimulationExecutor::separator_ + "number_of_points").c_str());
+      const int number_of_elements = ini_file.ReadInt(section, (name + MonteCarloSimulationExecutor::separator_ + "number_of_elements").c_str());
+      if (number_of_points <= 0 || number_of_elements <= 0) {
+        throw std::invalid_argument("MONTE_CARLO_SWEEP: number_of_points and number_of_elements of " + name + " must be positive.");
+      }
+      // The elements of the point i are read from <name>.point<i>(<element index>)
+      const std::string point_key_name = name + MonteCarloSimulationExecutor::separator_ + "point";
+      std::vector<std::vector<double>> points(number_of_points, std::vector<double>(number_of_elements));
+      for (int i = 0; i < number_of_points; i++) {
+        ini_file.ReadDoubleArray(section, point_key_name.c_str(), i, number_of_elements, points[i].data());
+      }
+      parameter_sweep.AddAxis(name, points);
+    }
+    monte_carlo_simulator->SetParameterSweep(parameter_sweep);
+  }
+
+  // The cases are divided into the shards after the number of the cases is decided
+  if (number_of_shards > 1) {
+    if (seed == 0) std::cout << "[Warning] Monte-Carlo simulation: rand_seed should be set to reproduce the cases among the shards." << std::endl;
+    monte_carlo_simulator->SetShard((unsigned int)shard_index, (unsigned int)number_of_shards);
+  }
+
   return monte_carlo_simulator;
 }
+
+void InitMonteCarloLogStore(std::string file_name, MonteCarloSimulationExecutor* monte_carlo_simulator, const std::string log_directory_path) {
+  IniAccess ini_file(file_name);
+  if (!ini_file.ReadEnable("MONTE_CARLO_EXECUTION", "log_store")) return;
+
+  std::string store_file_name = "monte_carlo_log.s2emc";
+  if (monte_carlo_simulator->GetNumberOfShards() > 1) {
+    store_file_name = "monte_carlo_log_shard" + std::to_string(monte_carlo_simulator->GetShardIndex()) + ".s2emc";
+  }
+  if (!monte_carlo_simulator->OpenLogStore(log_directory_path + store_file_name)) {
+    std::cout << "[Warning] Monte-Carlo simulation: The log store cannot be opened. The log file is written for each case." << std::endl;
+  }
+}
+
+EnsemblePropagator* InitEnsemblePropagator(std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "MONTE_CARLO_ENSEMBLE";
+  if (!ini_file.ReadEnable(section, "ensemble_enable")) return nullptr;
+
+  // Use all hardware threads when the number of threads is negative
+  int number_of_threads = ini_file.ReadInt(section, "number_of_threads");
+  if (number_of_threads < 0) number_of_threads = (int)std::thread::hardware_concurrency();
+  std::unique_ptr<EnsembleBackend> backend =
+      CreateEnsembleBackend(ini_file.ReadString(section, "backend"), number_of_threads > 0 ? (unsigned int)number_of_threads : 1);
+  const int batch_size = ini_file.ReadInt(section, "batch_size");
+
+  EnsembleDynamicsParameters parameters;
+  parameters.gravity_constant_m3_s2 = environment::earth_gravitational_constant_m3_s2;
+  parameters.duration_s = ini_file.ReadDouble("TIME", "simulation_duration_s");
+  parameters.orbit_step_s = ini_file.ReadDouble("TIME", "orbit_integral_step_s");
+  parameters.attitude_step_s = ini_file.ReadDouble("TIME", "attitude_integral_step_s");
+
+  // Same initial states as the full simulation of the first spacecraft
+  const std::vector<std::string> spacecraft_files = ini_file.ReadStrVector("SIMULATION_SETTINGS", "spacecraft_file");
+  if (spacecraft_files.empty()) throw std::invalid_argument("MONTE_CARLO_ENSEMBLE: spacecraft_file(0) is not set.");
+  IniAccess spacecraft_ini_file(spacecraft_files[0]);
+  libra::Vector<3> position_i_m, velocity_i_m_s, angular_velocity_b_rad_s;
+  libra::Quaternion quaternion_i2b;
+  spacecraft_ini_file.ReadVector("ORBIT", "initial_position_i_m", position_i_m);
+  spacecraft_ini_file.ReadVector("ORBIT", "initial_velocity_i_m_s", velocity_i_m_s);
+  spacecraft_ini_file.ReadQuaternion("ATTITUDE", "initial_quaternion_i2b", quaternion_i2b);
+  spacecraft_ini_file.ReadVector("ATTITUDE", "initial_angular_velocity_b_rad_s", angular_velocity_b_rad_s);
+
+  IniAccess structure_ini_file(spacecraft_ini_file.ReadString("SETTING_FILES", "structure_file"));
+  libra::Vector<9> inertia_tensor_kgm2;
+  structure_ini_file.ReadVector("KINEMATIC_PARAMETERS", "inertia_tensor_kgm2", inertia_tensor_kgm2);
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      parameters.inertia_tensor_kgm2[i][j] = inertia_tensor_kgm2[i * 3 + j];
+    }
+  }
+
+  IniAccess disturbance_ini_file(spacecraft_ini_file.ReadString("SETTING_FILES", "disturbance_file"));
+  parameters.ballistic_coefficient_m2_kg = disturbance_ini_file.ReadDouble("COMPOSED_FORCE_MODEL", "ballistic_coefficient_m2_kg");
+
+  return new EnsemblePropagator(parameters, position_i_m, velocity_i_m_s, quaternion_i2b, angular_velocity_b_rad_s, 0,
+                                batch_size > 0 ? (size_t)batch_size : 1, std::move(backend));
+}
@@ -6,13 +6,31 @@
 #ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_INITIALIZE_MONTE_CARLO_SIMULATION_HPP_
 #define S2E_SIMULATION_MONTE_CARLO_SIMULATION_INITIALIZE_MONTE_CARLO_SIMULATION_HPP_
 
+#include "ensemble_propagator.hpp"
 #include "initialize_monte_carlo_parameters.hpp"
 #include "monte_carlo_simulation_executor.hpp"
+#include "parameter_sweep.hpp"
 
 /**
  * @fn InitMonteCarloSimulation
  * @brief Initialize function for Monte-Carlo Simulator
  */
 MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name);
+/**
+ * @fn InitMonteCarloLogStore
+ * @brief Open the log store of the Monte-Carlo simulator when log_store is enabled in MONTE_CARLO_EXECUTION
+ * @param [in] file_name: Path to the initialize file
+ * @param [in] monte_carlo_simulator: Monte-Carlo simulator
+ * @param [in] log_directory_path: Path to the log directory of the campaign (e.g., GetLogPath of the logger made by InitMonteCarloLog)
+ */
+void InitMonteCarloLogStore(std::string file_name, MonteCarloSimulationExecutor* monte_carlo_simulator, const std::string log_directory_path);
+/**
+ * @fn InitEnsemblePropagator
+ * @brief Initialize the ensemble propagation of the Monte-Carlo cases with MONTE_CARLO_ENSEMBLE
+ * @note The initial states, the structure, and the ballistic coefficient are read from spacecraft_file(0) of SIMULATION_SETTINGS.
+ * @param [in] file_name: Path to the initialize file
+ * @return Ensemble propagator. nullptr when the ensemble propagation is disabled.
+ */
+EnsemblePropagator* InitEnsemblePropagator(std::string file_name);
 
 #endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_INITIALIZE_MONTE_CARLO_SIMULATION_HPP_
@@ -0,0 +1,126 @@
+/**
+ * @file monte_carlo_convergence_monitor.cpp
+ * @brief Monitor of the convergence of a statistic of the Monte-Carlo case results to stop the campaign early
+ */
+
+#include "monte_carlo_convergence_monitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <math_physics/randomization/low_discrepancy_sequence.hpp>
+#include <sstream>
+
+MonteCarloConvergenceMonitor::MonteCarloConvergenceMonitor()
+    : is_percentile_(false),
+      probability_(0.5),
+      z_score_(1.959963984540054),
+      absolute_tolerance_(0.0),
+      relative_tolerance_(0.0),
+      minimum_number_of_cases_(0),
+      is_column_missing_warned_(false),
+      number_of_values_(0),
+      mean_(0.0),
+      sum_of_squared_deviations_(0.0),
+      estimate_(std::numeric_limits<double>::quiet_NaN()),
+      confidence_half_width_(std::numeric_limits<double>::infinity()),
+      is_converged_(false) {}
+
+bool MonteCarloConvergenceMonitor::SetTarget(const std::string& column_name, const std::string& statistic_name, const double confidence_level,
+                                             const double absolute_tolerance, const double relative_tolerance,
+                                             const unsigned long long minimum_number_of_cases) {
+  column_name_.clear();
+  if (column_name.empty()) return true;
+
+  if (statistic_name == "MEAN") {
+    is_percentile_ = false;
+  } else if (statistic_name.size() > 1 && statistic_name[0] == 'P') {
+    char* end;
+    const double percentile = std::strtod(statistic_name.c_str() + 1, &end);
+    if (*end != '\0' || percentile < 0.0 || percentile > 100.0) return false;
+    is_percentile_ = true;
+    probability_ = percentile / 100.0;
+  } else {
+    return false;
+  }
+  if (confidence_level <= 0.0 || confidence_level >= 1.0) return false;
+
+  column_name_ = column_name;
+  statistic_name_ = statistic_name;
+  z_score_ = libra::CalcInverseStandardNormalCdf(0.5 + 0.5 * confidence_level);
+  absolute_tolerance_ = absolute_tolerance;
+  relative_tolerance_ = relative_tolerance;
+  minimum_number_of_cases_ = minimum_number_of_cases;
+  return true;
+}
+
+void MonteCarloConvergenceMonitor::AddCaseResult(const std::string& csv_header, const std::string& csv_value) {
+  if (!IsEnabled()) return;
+
+  std::stringstream header_stream(csv_header);
+  std::stringstream value_stream(csv_value);
+  std::string name, value;
+  while (std::getline(header_stream, name, ',')) {
+    if (!std::getline(value_stream, value, ',')) break;
+    if (name == column_name_) {
+      AddValue(std::strtod(value.c_str(), nullptr));
+      return;
+    }
+  }
+
+  if (!is_column_missing_warned_) {
+    std::cout << "[Warning] Monte-Carlo convergence monitor: Column " << column_name_ << " is not found in the case result." << std::endl;
+    is_column_missing_warned_ = true;
+  }
+}
+
+void MonteCarloConvergenceMonitor::AddValue(const double value) {
+  if (!IsEnabled() || std::isnan(value)) return;
+
+  number_of_values_++;
+  const double delta = value - mean_;
+  mean_ += delta / (double)number_of_values_;
+  sum_of_squared_deviations_ += delta * (value - mean_);
+
+  if (is_percentile_) {
+    sorted_values_.insert(std::upper_bound(sorted_values_.begin(), sorted_values_.end(), value), value);
+    CalcPercentileConfidence();
+  } else {
+    estimate_ = mean_;
+    if (number_of_values_ > 1) {
+      const double variance = sum_of_squared_deviations_ / (double)(number_of_values_ - 1);
+      confidence_half_width_ = z_score_ * std::sqrt(variance / (double)number_of_values_);
+    }
+  }
+
+  const double tolerance = std::max(absolute_tolerance_, relative_tolerance_ * std::abs(estimate_));
+  is_converged_ = number_of_values_ >= minimum_number_of_cases_ && confidence_half_width_ <= tolerance;
+}
+
+void MonteCarloConvergenceMonitor::CalcPercentileConfidence() {
+  const size_t n = sorted_values_.size();
+
+  // Same interpolation as MemoryLogCapture
+  const double position = probability_ * (double)(n - 1);
+  const size_t lower_index = (size_t)position;
+  if (lower_index + 1 >= n) {
+    estimate_ = sorted_values_.back();
+  } else {
+    const double ratio = position - (double)lower_index;
+    estimate_ = sorted_values_[lower_index] * (1.0 - ratio) + sorted_values_[lower_index + 1] * ratio;
+  }
+
+  // The rank of the percentile follows the binomial distribution B(n, p)
+  const double center_rank = (double)n * probability_;
+  const double rank_deviation = z_score_ * std::sqrt((double)n * probability_ * (1.0 - probability_));
+  const double lower_rank = std::floor(center_rank - rank_deviation);
+  const double upper_rank = std::ceil(center_rank + rank_deviation);
+  if (lower_rank < 0.0 || upper_rank > (double)(n - 1)) {
+    // Too few values in the tail to bound the interval
+    confidence_half_width_ = std::numeric_limits<double>::infinity();
+    return;
+  }
+  confidence_half_width_ = 0.5 * (sorted_values_[(size_t)upper_rank] - sorted_values_[(size_t)lower_rank]);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file monte_carlo_convergence_monitor.hpp
+ * @brief Monitor of the convergence of a statistic of the Monte-Carlo case results to stop the campaign early
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_CONVERGENCE_MONITOR_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_CONVERGENCE_MONITOR_HPP_
+
+#include <string>
+#include <vector>
+
+/**
+ * @class MonteCarloConvergenceMonitor
+ * @brief Monitor of the convergence of a statistic (mean or percentile) of a column of the case results
+ * @details The confidence interval of the mean is calculated with the running mean and variance (Welford), and that of the percentile is
+ *          calculated with the order statistics of the binomial distribution (normal approximation). The statistic is converged when the
+ *          number of cases reaches the minimum and the half width of the confidence interval is less than the tolerance.
+ */
+class MonteCarloConvergenceMonitor {
+ public:
+  /**
+   * @fn MonteCarloConvergenceMonitor
+   * @brief Constructor. The monitor is disabled until SetTarget is called.
+   */
+  MonteCarloConvergenceMonitor();
+
+  /**
+   * @fn SetTarget
+   * @brief Set the monitored statistic and the target precision
+   * @param [in] column_name: Name of the column of the case results (e.g., MAX(spacecraft_angular_velocity_b_x[rad/s])). Empty to disable.
+   * @param [in] statistic_name: Statistic of the column over the cases. MEAN or P<percentile> (e.g., P99)
+   * @param [in] confidence_level: Confidence level of the interval (e.g., 0.95)
+   * @param [in] absolute_tolerance: Tolerance of the half width of the confidence interval
+   * @param [in] relative_tolerance: Tolerance of the half width of the confidence interval relative to the absolute value of the statistic
+   * @param [in] minimum_number_of_cases: Minimum number of cases before the convergence
+   * @return False when the statistic is not supported. The monitor is disabled.
+   */
+  bool SetTarget(const std::string& column_name, const std::string& statistic_name, const double confidence_level, const double absolute_tolerance,
+                 const double relative_tolerance, const unsigned long long minimum_number_of_cases);
+
+  /**
+   * @fn AddCaseResult
+   * @brief Add the value of the monitored column in the result of a case
+   * @param [in] csv_header: Comma separated column names of the case result
+   * @param [in] csv_value: Comma separated values of the case result
+   */
+  void AddCaseResult(const std::string& csv_header, const std::string& csv_value);
+  /**
+   * @fn AddValue
+   * @brief Add the value of a case and update the convergence. NaN is ignored.
+   * @param [in] value: Value of the monitored column
+   */
+  void AddValue(const double value);
+
+  // Getters
+  /**
+   * @fn IsEnabled
+   * @brief Return true when the statistic is monitored
+   */
+  inline bool IsEnabled() const { return !column_name_.empty(); }
+  /**
+   * @fn IsConverged
+   * @brief Return true when the statistic converges to the target precision
+   */
+  inline bool IsConverged() const { return is_converged_; }
+  /**
+   * @fn GetNumberOfValues
+   * @brief Return number of the added values
+   */
+  inline unsigned long long GetNumberOfValues() const { return number_of_values_; }
+  /**
+   * @fn GetEstimate
+   * @brief Return current estimate of the statistic
+   */
+  inline double GetEstimate() const { return estimate_; }
+  /**
+   * @fn GetConfidenceHalfWidth
+   * @brief Return half width of the confidence interval of the statistic. Infinity when the interval is not available yet.
+   */
+  inline double GetConfidenceHalfWidth() const { return confidence_half_width_; }
+  /**
+   * @fn GetColumnName
+   * @brief Return name of the monitored column
+   */
+  inline const std::string& GetColumnName() const { return column_name_; }
+
+ private:
+  // Setting
+  std::string column_name_;                     //!< Name of the monitored column
+  std::string statistic_name_;                  //!< Name of the statistic
+  bool is_percentile_;                          //!< True for the percentile, false for the mean
+  double probability_;                          //!< Probability of the percentile [0, 1]
+  double z_score_;                              //!< Standard normal quantile of the confidence level
+  double absolute_tolerance_;                   //!< Tolerance of the half width of the confidence interval
+  double relative_tolerance_;                   //!< Relative tolerance of the half width of the confidence interval
+  unsigned long long minimum_number_of_cases_;  //!< Minimum number of cases before the convergence
+  bool is_column_missing_warned_;               //!< Flag to warn the missing column only once
+
+  // Running statistics
+  unsigned long long number_of_values_;  //!< Number of the added values
+  double mean_;                          //!< Running mean
+  double sum_of_squared_deviations_;     //!< Running sum of the squared deviations from the mean
+  std::vector<double> sorted_values_;    //!< Sorted values for the percentile
+  double estimate_;                      //!< Current estimate of the statistic
+  double confidence_half_width_;         //!< Half width of the confidence interval
+  bool is_converged_;                    //!< Convergence flag
+
+  /**
+   * @fn CalcPercentileConfidence
+   * @brief Calculate the estimate and the confidence half width of the percentile
+   */
+  void CalcPercentileConfidence();
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_CONVERGENCE_MONITOR_HPP_
@@ -5,23 +5,94 @@
 
 #include "monte_carlo_simulation_executor.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <logger/binary_log_writer.hpp>
+#include <logger/logger.hpp>
+#include <logger/monte_carlo_log_store.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
 using std::string;
 
+/**
+ * @class CaseResultLoggable
+ * @brief Loggable to write the stored result of a case with the case index
+ */
+class CaseResultLoggable : public ILoggable {
+ public:
+  CaseResultLoggable(const unsigned long long case_index, const std::string& header, const std::string& value)
+      : case_index_(case_index), header_(header), value_(value) {}
+  std::string GetLogHeader() const override { return "case_index," + header_; }
+  std::string GetLogValue() const override { return WriteScalar(case_index_) + value_; }
+
+ private:
+  const unsigned long long case_index_;  //!< Index of the case
+  const std::string& header_;            //!< Header of the result
+  const std::string& value_;             //!< Value of the result
+};
+
 MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long total_num_of_executions)
     : total_number_of_executions_(total_num_of_executions) {
   number_of_executions_done_ = 0;
   enabled_ = total_number_of_executions_ > 1 ? true : false;
   save_log_history_flag_ = !enabled_;
+  number_of_threads_ = 1;
+  SetSeed();
+  start_case_index_ = 0;
+  number_of_cases_in_range_ = std::numeric_limits<unsigned long long>::max();  // All cases
+  shard_index_ = 0;
+  number_of_shards_ = 1;
+  is_case_reuse_enabled_ = false;
+  sampling_method_ = InitializedMonteCarloParameters::SamplingMethod::kPseudoRandom;
+  case_result_logger_ = nullptr;
+  is_case_result_header_written_ = false;
 }
 
 bool MonteCarloSimulationExecutor::WillExecuteNextCase() {
+  if (convergence_monitor_.IsConverged()) return false;
   if (!enabled_) {
     return (number_of_executions_done_ < 1);
   } else {
-    return (number_of_executions_done_ < total_number_of_executions_);
+    return (GetCaseIndex() < GetEndCaseIndex());
   }
 }
 
+void MonteCarloSimulationExecutor::SetCaseRange(const unsigned long long start_case_index, const unsigned long long number_of_cases) {
+  start_case_index_ = start_case_index;
+  number_of_cases_in_range_ = number_of_cases;
+  number_of_executions_done_ = 0;
+}
+
+void MonteCarloSimulationExecutor::SetShard(const unsigned int shard_index, const unsigned int number_of_shards) {
+  if (number_of_shards == 0 || shard_index >= number_of_shards) {
+    std::cout << "[Warning] Monte-Carlo simulation: shard index " << shard_index << " is out of range of " << number_of_shards
+              << " shards. The sharding is ignored." << std::endl;
+    return;
+  }
+  shard_index_ = shard_index;
+  number_of_shards_ = number_of_shards;
+
+  // Distribute the remainder cases to the first shards
+  const unsigned long long base_number_of_cases = total_number_of_executions_ / number_of_shards_;
+  const unsigned long long remainder = total_number_of_executions_ % number_of_shards_;
+  const unsigned long long start_case_index = shard_index_ * base_number_of_cases + std::min<unsigned long long>(shard_index_, remainder);
+  const unsigned long long number_of_cases = base_number_of_cases + (shard_index_ < remainder ? 1 : 0);
+  SetCaseRange(start_case_index, number_of_cases);
+}
+
+unsigned long long MonteCarloSimulationExecutor::GetEndCaseIndex() const {
+  if (start_case_index_ >= total_number_of_executions_) return total_number_of_executions_;
+  if (number_of_cases_in_range_ > total_number_of_executions_ - start_case_index_) return total_number_of_executions_;
+  return start_case_index_ + number_of_cases_in_range_;
+}
+
 void MonteCarloSimulationExecutor::AtTheBeginningOfEachCase() {
   // Write CSV output of the randomization results
   ;
@@ -29,9 +100,64 @@ void MonteCarloSimulationExecutor::AtTheBeginningOfEachCase() {
 
 void MonteCarloSimulationExecutor::AtTheEndOfEachCase() {
   // Write CSV output of the simulation results
+  WriteCaseResult(GetCaseIndex());
   number_of_executions_done_++;
 }
 
+void MonteCarloSimulationExecutor::WriteCaseResult(const unsigned long long case_index) {
+  if (case_result_logger_ != nullptr && !case_result_value_.empty()) {
+    CaseResultLoggable case_result(case_index, case_result_header_, case_result_value_);
+    case_result_logger_->ClearLogList();
+    case_result_logger_->AddLogList(&case_result);
+    if (!is_case_result_header_written_) {
+      case_result_logger_->WriteHeaders();
+      is_case_result_header_written_ = true;
+    }
+    case_result_logger_->WriteValues();
+    case_result_logger_->ClearLogList();
+  }
+  if (!case_result_value_.empty()) convergence_monitor_.AddCaseResult(case_result_header_, case_result_value_);
+  case_result_header_.clear();
+  case_result_value_.clear();
+}
+
+void MonteCarloSimulationExecutor::SetCaseResult(const ILoggable& case_result) const {
+  case_result_header_ = case_result.GetLogHeader();
+  case_result_value_ = case_result.GetLogValue();
+  if (parameter_sweep_ != nullptr) {
+    case_result_header_ = parameter_sweep_->GetCaseHeader() + case_result_header_;
+    case_result_value_ = parameter_sweep_->GetCaseValue(GetCaseIndex()) + case_result_value_;
+  }
+}
+
+void MonteCarloSimulationExecutor::SetParameterSweep(const ParameterSweep& parameter_sweep) {
+  if (parameter_sweep.GetNumberOfCases() == 0) {
+    std::cout << "[Warning] Monte-Carlo simulation: The parameter sweep has no parameter. The sweep is ignored." << std::endl;
+    return;
+  }
+  parameter_sweep_ = std::make_shared<const ParameterSweep>(parameter_sweep);
+
+  // The swept parameters replace the randomization settings of the same parameters
+  for (size_t axis_index = 0; axis_index < parameter_sweep_->GetNumberOfAxes(); axis_index++) {
+    const std::string& name = parameter_sweep_->GetAxisName(axis_index);
+    if (init_parameter_list_.find(name) != init_parameter_list_.end()) {
+      std::cout << "[Warning] Monte-Carlo simulation: " << name << " is defined in both the randomization and the sweep. The sweep is used."
+                << std::endl;
+    }
+    init_parameter_list_[name].SetFixedValue(parameter_sweep_->GetPoint(0, axis_index));
+  }
+
+  total_number_of_executions_ = parameter_sweep_->GetNumberOfCases();
+  enabled_ = true;
+}
+
+bool MonteCarloSimulationExecutor::SetConvergenceTarget(const std::string& column_name, const std::string& statistic_name,
+                                                        const double confidence_level, const double absolute_tolerance,
+                                                        const double relative_tolerance, const unsigned long long minimum_number_of_cases) {
+  return convergence_monitor_.SetTarget(column_name, statistic_name, confidence_level, absolute_tolerance, relative_tolerance,
+                                        minimum_number_of_cases);
+}
+
 void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterDouble(string so_name, string init_monte_carlo_parameter_name,
                                                                            double& destination) const {
   if (!enabled_) return;
@@ -41,7 +167,7 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterDouble(strin
       // Not registered in ip_list（Not defined in MCSim.ini）
       return;  // return without any update of destination
     } else {
-      init_parameter_list_.at(name)->GetRandomizedScalar(destination);  // cannot use operator[] since it is const map
+      init_parameter_list_.at(name).GetRandomizedScalar(destination);  // cannot use operator[] since it is const map
     }
   }
 }
@@ -55,17 +181,194 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterQuaternion(s
       // Not registered in ip_list（Not defined in MCSim.ini）
       return;  // return without any update of destination
     } else {
-      init_parameter_list_.at(name)->GetRandomizedQuaternion(destination);  // cannot use operator[] since it is const map
+      init_parameter_list_.at(name).GetRandomizedQuaternion(destination);  // cannot use operator[] since it is const map
     }
   }
 }
 
 void MonteCarloSimulationExecutor::RandomizeAllParameters() {
-  for (auto ip : init_parameter_list_) {
-    ip.second->Randomize();
+  // Reseed the randomization streams of this thread so that each case is reproducible regardless of the execution order
+  const unsigned long long case_index = GetCaseIndex();
+  const unsigned long long case_seed = CalcCaseSeed(case_index);
+  InitializedMonteCarloParameters::SetSeed((unsigned long)case_seed, true);
+  // The seed of the minimal standard LCG must be in [1, 2^31 - 2]
+  global_randomization.SetSeed((long)(case_seed % 0x7ffffffe) + 1);
+  // The quasi-random sample of the case is selected with the case index, and scrambled with the base seed
+  InitializedMonteCarloParameters::SetSamplingPoint(sampling_method_, case_index, total_number_of_executions_, seed_);
+
+  for (auto& ip : init_parameter_list_) {
+    ip.second.Randomize();
   }
+  if (parameter_sweep_ != nullptr) {
+    for (size_t axis_index = 0; axis_index < parameter_sweep_->GetNumberOfAxes(); axis_index++) {
+      init_parameter_list_.at(parameter_sweep_->GetAxisName(axis_index))
+          .SetFixedValue(parameter_sweep_->GetPoint(case_index, axis_index));
+    }
+  }
+
+  if (log_store_ != nullptr) WriteParametersToLogStore();
+}
+
+bool MonteCarloSimulationExecutor::OpenLogStore(const std::string& file_path) {
+  std::shared_ptr<MonteCarloLogStore> log_store = std::make_shared<MonteCarloLogStore>();
+  if (!log_store->Open(file_path)) return false;
+  log_store_ = log_store;
+  return true;
+}
+
+void MonteCarloSimulationExecutor::CloseLogStore() {
+  if (log_store_ == nullptr) return;
+  log_store_->Close();
+  log_store_.reset();
+}
+
+void MonteCarloSimulationExecutor::WriteParametersToLogStore() const {
+  // Column names are <SimulationObject>.<parameter>(<element index>)
+  std::string csv_headers;
+  for (const auto& ip : init_parameter_list_) {
+    for (size_t i = 0; i < ip.second.GetRandomizedValues().size(); i++) {
+      csv_headers += ip.first + "(" + std::to_string(i) + "),";
+    }
+  }
+  if (csv_headers.empty()) return;
+
+  BinaryLogWriter parameter_writer;
+  if (!parameter_writer.OpenStore(log_store_.get(), GetCaseIndex(), MonteCarloLogStore::RecordType::kParameters)) return;
+  parameter_writer.AppendHeaders(csv_headers);
+  for (const auto& ip : init_parameter_list_) {
+    for (const double value : ip.second.GetRandomizedValues()) {
+      parameter_writer.AppendDouble(value);
+    }
+  }
+  parameter_writer.EndRow();
+  parameter_writer.Close();
+}
+
+size_t MonteCarloSimulationExecutor::GetNumberOfSampleDimensions() const {
+  size_t number_of_dimensions = 0;
+  for (const auto& ip : init_parameter_list_) {
+    number_of_dimensions += ip.second.GetNumberOfSampleDimensions();
+  }
+  return number_of_dimensions;
+}
+
+void MonteCarloSimulationExecutor::Execute(const std::function<void(const MonteCarloSimulationExecutor&)>& execute_case) {
+  ExecuteWorkers([&execute_case]() { return execute_case; });
+}
+
+void MonteCarloSimulationExecutor::ExecuteWorkers(
+    const std::function<std::function<void(const MonteCarloSimulationExecutor&)>()>& create_worker_function) {
+  const unsigned long long end_case_index = enabled_ ? GetEndCaseIndex() : 1;
+  // Copy the settings before starting the workers since number_of_executions_done_ is updated during the execution
+  const MonteCarloSimulationExecutor base_executor(*this);
+
+  std::atomic<unsigned long long> next_case_index(GetCaseIndex());
+  std::mutex mutex;
+  std::exception_ptr exception = nullptr;
+
+  auto worker = [&]() {
+    std::function<void(const MonteCarloSimulationExecutor&)> execute_case = create_worker_function();
+    while (true) {
+      const unsigned long long case_index = next_case_index++;
+      if (case_index >= end_case_index) break;
+
+      MonteCarloSimulationExecutor case_executor(base_executor);
+      case_executor.number_of_executions_done_ = case_index - start_case_index_;
+      try {
+        case_executor.RandomizeAllParameters();
+        case_executor.AtTheBeginningOfEachCase();
+        execute_case(case_executor);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (exception == nullptr) exception = std::current_exception();
+        next_case_index = end_case_index;  // Stop assigning new cases
+        break;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      case_result_header_ = case_executor.case_result_header_;
+      case_result_value_ = case_executor.case_result_value_;
+      WriteCaseResult(case_index);
+      AtTheEndOfEachCase();
+      if (convergence_monitor_.IsConverged()) next_case_index = end_case_index;  // Stop assigning new cases
+    }
+  };
+
+  if (number_of_threads_ <= 1) {
+    worker();
+  } else {
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < number_of_threads_; i++) {
+      threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  if (exception != nullptr) std::rethrow_exception(exception);
+
+  if (convergence_monitor_.IsConverged()) {
+    std::cout << "Monte-Carlo simulation: " << convergence_monitor_.GetColumnName() << " converged to " << convergence_monitor_.GetEstimate()
+              << " +/- " << convergence_monitor_.GetConfidenceHalfWidth() << " with " << convergence_monitor_.GetNumberOfValues()
+              << " cases. The remaining cases are skipped." << std::endl;
+  }
+}
+
+void MonteCarloSimulationExecutor::ExecuteBatches(const size_t batch_size,
+                                                  const std::function<void(const std::vector<MonteCarloSimulationExecutor>&)>& execute_batch) {
+  const unsigned long long end_case_index = enabled_ ? GetEndCaseIndex() : 1;
+  const unsigned long long number_of_cases_per_batch = batch_size > 0 ? batch_size : 1;
+  // Copy the settings before the execution since number_of_executions_done_ is updated during the execution
+  const MonteCarloSimulationExecutor base_executor(*this);
+
+  std::vector<MonteCarloSimulationExecutor> case_executors;
+  while (GetCaseIndex() < end_case_index && !convergence_monitor_.IsConverged()) {
+    const unsigned long long batch_start_case_index = GetCaseIndex();
+    const unsigned long long batch_end_case_index = std::min(batch_start_case_index + number_of_cases_per_batch, end_case_index);
+    case_executors.clear();
+    case_executors.reserve(batch_end_case_index - batch_start_case_index);
+    for (unsigned long long case_index = batch_start_case_index; case_index < batch_end_case_index; case_index++) {
+      case_executors.push_back(base_executor);
+      case_executors.back().number_of_executions_done_ = case_index - start_case_index_;
+      case_executors.back().RandomizeAllParameters();
+      case_executors.back().AtTheBeginningOfEachCase();
+    }
+
+    execute_batch(case_executors);
+
+    for (const auto& case_executor : case_executors) {
+      case_result_header_ = case_executor.case_result_header_;
+      case_result_value_ = case_executor.case_result_value_;
+      WriteCaseResult(case_executor.GetCaseIndex());
+      AtTheEndOfEachCase();
+    }
+  }
+
+  if (convergence_monitor_.IsConverged()) {
+    std::cout << "Monte-Carlo simulation: " << convergence_monitor_.GetColumnName() << " converged to " << convergence_monitor_.GetEstimate()
+              << " +/- " << convergence_monitor_.GetConfidenceHalfWidth() << " with " << convergence_monitor_.GetNumberOfValues()
+              << " cases. The remaining cases are skipped." << std::endl;
+  }
+}
+
+void MonteCarloSimulationExecutor::SetNumberOfThreads(const unsigned int number_of_threads) {
+  number_of_threads_ = number_of_threads > 0 ? number_of_threads : 1;
 }
 
 void MonteCarloSimulationExecutor::SetSeed(unsigned long seed, bool is_deterministic) {
-  InitializedMonteCarloParameters::SetSeed(seed, is_deterministic);
+  if (is_deterministic) {
+    seed_ = seed;
+  } else {
+    std::random_device randomizer;
+    seed_ = randomizer();
+  }
+}
+
+unsigned long long MonteCarloSimulationExecutor::CalcCaseSeed(const unsigned long long case_index) const {
+  // SplitMix64 to decorrelate the seeds of neighboring cases
+  unsigned long long seed = seed_ + (case_index + 1) * 0x9e3779b97f4a7c15ULL;
+  seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  seed = (seed ^ (seed >> 27)) * 0x94d049bb133111ebULL;
+  return seed ^ (seed >> 31);
 }
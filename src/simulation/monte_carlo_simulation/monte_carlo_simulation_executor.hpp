@@ -6,11 +6,20 @@
 #ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 #define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <math_physics/math/vector.hpp>
 #include <string>
+#include <vector>
 // #include "simulation_object.hpp"
 #include "initialize_monte_carlo_parameters.hpp"
+#include "monte_carlo_convergence_monitor.hpp"
+#include "parameter_sweep.hpp"
+
+class ILoggable;
+class Logger;
+class MonteCarloLogStore;
 
 /**
  * @class MonteCarloSimulationExecutor
@@ -19,11 +28,54 @@
 class MonteCarloSimulationExecutor {
  private:
   unsigned long long total_number_of_executions_;  //!< Total number of execution simulation case
-  unsigned long long number_of_executions_done_;   //!< Number of executed case
+  unsigned long long number_of_executions_done_;   //!< Number of executed case in this process
   bool enabled_;                                   //!< Flag to execute Monte-Carlo Simulation or not
   bool save_log_history_flag_;                     //!< Flag to store the log for each case or not
+  unsigned int number_of_threads_;                 //!< Number of worker threads to execute the simulation cases
+  unsigned long seed_;                             //!< Base seed to generate the seed of each simulation case
+  unsigned long long start_case_index_;            //!< Index of the first case executed in this process
+  unsigned long long number_of_cases_in_range_;    //!< Number of cases executed in this process
+  unsigned int shard_index_;                       //!< Index of the shard executed in this process
+  unsigned int number_of_shards_;                  //!< Number of shards to divide the cases
+  bool is_case_reuse_enabled_;                     //!< Flag to reuse the initialized simulation case in each worker thread
+
+  InitializedMonteCarloParameters::SamplingMethod sampling_method_;  //!< Sampling method of the randomized parameters
+
+  std::map<std::string, InitializedMonteCarloParameters> init_parameter_list_;  //!< List of InitializedMonteCarloParameters read from MCSim.ini
+
+  Logger* case_result_logger_;              //!< Logger to write one result row for each case
+  bool is_case_result_header_written_;      //!< Flag to show the header of the case results is already written
+  mutable std::string case_result_header_;  //!< Header of the result of the current case
+  mutable std::string case_result_value_;   //!< Value of the result of the current case
+
+  MonteCarloConvergenceMonitor convergence_monitor_;       //!< Monitor of the case results to stop the campaign at the convergence
+  std::shared_ptr<MonteCarloLogStore> log_store_;          //!< Container of the logs of all cases. Shared with the copies for the cases.
+  std::shared_ptr<const ParameterSweep> parameter_sweep_;  //!< Grid of the swept parameters. Shared with the copies for the cases.
 
-  std::map<std::string, InitializedMonteCarloParameters*> init_parameter_list_;  //!< List of InitializedMonteCarloParameters read from MCSim.ini
+  /**
+   * @fn CalcCaseSeed
+   * @brief Calculate the seed of the simulation case from the base seed and the case index
+   * @param [in] case_index: Index of the simulation case
+   * @return Seed for the simulation case
+   */
+  unsigned long long CalcCaseSeed(const unsigned long long case_index) const;
+  /**
+   * @fn WriteCaseResult
+   * @brief Write the stored result of the case to the case result logger and clear it
+   * @param [in] case_index: Index of the simulation case
+   */
+  void WriteCaseResult(const unsigned long long case_index);
+  /**
+   * @fn WriteParametersToLogStore
+   * @brief Write the randomized parameters of the current case to the log store as a one row binary log
+   */
+  void WriteParametersToLogStore() const;
+  /**
+   * @fn ExecuteWorkers
+   * @brief Execute all simulation cases with the worker threads
+   * @param [in] create_worker_function: Function called once in each worker thread to make the function which executes a case in the worker
+   */
+  void ExecuteWorkers(const std::function<std::function<void(const MonteCarloSimulationExecutor&)>()>& create_worker_function);
 
  public:
   static const char separator_ = '.';  //!< Deliminator for name of SimulationObject and InitializedMonteCarloParameters in the initialization file
@@ -50,13 +102,101 @@ class MonteCarloSimulationExecutor {
    * @brief Set log history flag
    */
   inline void SetSaveLogHistoryFlag(bool set) { save_log_history_flag_ = set; }
+  /**
+   * @fn SetNumberOfThreads
+   * @brief Set number of worker threads. The cases are executed sequentially when number_of_threads <= 1.
+   */
+  void SetNumberOfThreads(const unsigned int number_of_threads);
   /**
    * @fn SetSeed
-   * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
+   * @brief Set base seed of randomization. Use time infomation when is_deterministic = false.
+   * @note The seed of each case is generated from the base seed and the case index, so the results do not depend on the execution order.
+   */
+  void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  /**
+   * @fn SetCaseRange
+   * @brief Set the range of cases executed in this process
+   * @note The seed of each case depends only on the case index, so the results are identical to the execution without the range setting.
+   * @param [in] start_case_index: Index of the first case
+   * @param [in] number_of_cases: Number of cases. The range is clipped by the total number of execution.
    */
-  static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  void SetCaseRange(const unsigned long long start_case_index, const unsigned long long number_of_cases);
+  /**
+   * @fn SetShard
+   * @brief Divide the cases into shards and set the range of the specified shard
+   * @note Call this function after setting the total number of execution
+   * @param [in] shard_index: Index of the shard executed in this process (0 <= shard_index < number_of_shards)
+   * @param [in] number_of_shards: Number of shards
+   */
+  void SetShard(const unsigned int shard_index, const unsigned int number_of_shards);
+  /**
+   * @fn SetCaseReuse
+   * @brief Set flag to reuse the initialized simulation case in each worker thread (see ExecuteWithReuse)
+   */
+  inline void SetCaseReuse(const bool is_case_reuse_enabled) { is_case_reuse_enabled_ = is_case_reuse_enabled; }
+  /**
+   * @fn SetSamplingMethod
+   * @brief Set sampling method of the randomized parameters
+   * @note The quasi-random samples are keyed by the case index over all cases, so the shards give the same samples with a deterministic seed.
+   */
+  inline void SetSamplingMethod(const InitializedMonteCarloParameters::SamplingMethod sampling_method) { sampling_method_ = sampling_method; }
+  /**
+   * @fn SetCaseResultLogger
+   * @brief Set the logger to write one result row for each case in AtTheEndOfEachCase
+   * @note Use a dedicated logger since its log list is replaced when the results are written. The first column is the case index.
+   * @param [in] case_result_logger: Logger for the case results. nullptr to disable.
+   */
+  inline void SetCaseResultLogger(Logger* case_result_logger) { case_result_logger_ = case_result_logger; }
+  /**
+   * @fn SetCaseResult
+   * @brief Set the result of the current case written in AtTheEndOfEachCase (e.g., statistics of the in-memory log capture)
+   * @param [in] case_result: Loggable which outputs the result of the case
+   */
+  void SetCaseResult(const ILoggable& case_result) const;
+  /**
+   * @fn SetConvergenceTarget
+   * @brief Stop the campaign (or the shard) when a statistic of a column of the case results converges to the target precision
+   * @note The case results are set by SetCaseResult. See MonteCarloConvergenceMonitor::SetTarget for the arguments.
+   * @return False when the statistic is not supported. The early stopping is disabled.
+   */
+  bool SetConvergenceTarget(const std::string& column_name, const std::string& statistic_name, const double confidence_level,
+                            const double absolute_tolerance, const double relative_tolerance, const unsigned long long minimum_number_of_cases);
+  /**
+   * @fn SetParameterSweep
+   * @brief Execute the points of the parameter grid as the cases instead of the given number of the random cases
+   * @details The total number of execution is set to the number of the points, and the simulation is enabled. The swept parameters are
+   *          set to the SimulationObjects with SetParameters as the randomized parameters, and the other parameters are still randomized
+   *          with the per-case seeds. The values of the swept parameters are added to the head of the case result set by SetCaseResult,
+   *          so the case result logger writes a table of the sweep. Call this function before SetShard.
+   * @param [in] parameter_sweep: Grid of the swept parameters
+   */
+  void SetParameterSweep(const ParameterSweep& parameter_sweep);
+
+  /**
+   * @fn OpenLogStore
+   * @brief Open the container file to store the logs and the randomized parameters of all cases instead of a log file for each case
+   * @note The simulation cases write their logs to the store with Logger(MonteCarloLogStore*, ...). See monte_carlo_log_store.hpp.
+   * @param [in] file_path: Path to the container file
+   * @return True when the file is opened successfully
+   */
+  bool OpenLogStore(const std::string& file_path);
+  /**
+   * @fn CloseLogStore
+   * @brief Write the index of the log store and close it. Call this function after all cases are completed.
+   */
+  void CloseLogStore();
 
   // Getter
+  /**
+   * @fn GetLogStore
+   * @brief Return container of the logs of all cases. nullptr when the log store is not opened.
+   */
+  inline MonteCarloLogStore* GetLogStore() const { return log_store_.get(); }
+  /**
+   * @fn GetParameterSweep
+   * @brief Return grid of the swept parameters. nullptr when the parameter sweep is not set.
+   */
+  inline const ParameterSweep* GetParameterSweep() const { return parameter_sweep_.get(); }
   /**
    * @fn ISEnabled
    * @brief Return execute flag
@@ -69,9 +209,59 @@ class MonteCarloSimulationExecutor {
   inline unsigned long long GetTotalNumberOfExecutions() const { return total_number_of_executions_; }
   /**
    * @fn GetNumberOfExecutionsDone
-   * @brief Return number of executed case
+   * @brief Return number of executed case in this process
    */
   inline unsigned long long GetNumberOfExecutionsDone() const { return number_of_executions_done_; }
+  /**
+   * @fn GetCaseIndex
+   * @brief Return index of the current case over all cases (the first case of the range plus the number of executed cases)
+   */
+  inline unsigned long long GetCaseIndex() const { return start_case_index_ + number_of_executions_done_; }
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of worker threads
+   */
+  inline unsigned int GetNumberOfThreads() const { return number_of_threads_; }
+  /**
+   * @fn GetStartCaseIndex
+   * @brief Return index of the first case executed in this process
+   */
+  inline unsigned long long GetStartCaseIndex() const { return start_case_index_; }
+  /**
+   * @fn GetEndCaseIndex
+   * @brief Return index of the next case of the last case executed in this process
+   */
+  unsigned long long GetEndCaseIndex() const;
+  /**
+   * @fn GetShardIndex
+   * @brief Return index of the shard executed in this process
+   */
+  inline unsigned int GetShardIndex() const { return shard_index_; }
+  /**
+   * @fn GetNumberOfShards
+   * @brief Return number of shards
+   */
+  inline unsigned int GetNumberOfShards() const { return number_of_shards_; }
+  /**
+   * @fn GetConvergenceMonitor
+   * @brief Return monitor of the convergence of the case results
+   */
+  inline const MonteCarloConvergenceMonitor& GetConvergenceMonitor() const { return convergence_monitor_; }
+  /**
+   * @fn IsCaseReuseEnabled
+   * @brief Return flag to reuse the initialized simulation case in each worker thread
+   */
+  inline bool IsCaseReuseEnabled() const { return is_case_reuse_enabled_; }
+  /**
+   * @fn GetSamplingMethod
+   * @brief Return sampling method of the randomized parameters
+   */
+  inline InitializedMonteCarloParameters::SamplingMethod GetSamplingMethod() const { return sampling_method_; }
+  /**
+   * @fn GetNumberOfSampleDimensions
+   * @brief Return number of random variables drawn to randomize all parameters in a case
+   */
+  size_t GetNumberOfSampleDimensions() const;
   /**
    * @fn GetSaveLogHistoryFlag
    * @brief Return log history flag
@@ -103,6 +293,7 @@ class MonteCarloSimulationExecutor {
   /**
    * @fn WillExecuteNextCase
    * @brief Judge execution of next simulation case
+   * @note Return false when the monitored statistic of the case results converges
    */
   bool WillExecuteNextCase();
 
@@ -116,7 +307,7 @@ class MonteCarloSimulationExecutor {
   /**
    * @fn AtTheEndOfEachCase
    * @brief Process executed after the each simulation case.
-   * @details e.g. Log output of simulation results
+   * @details The result set by SetCaseResult is written to the case result logger as one row.
    */
   void AtTheEndOfEachCase();
 
@@ -132,8 +323,42 @@ class MonteCarloSimulationExecutor {
   /**
    * @fn RandomizeAllParameters
    * @brief Randomize all initialized parameter
+   * @note The randomization streams of the caller thread are reseeded with the seed of the current case before the randomization.
+   *       The swept parameters are set to the point of the current case.
    */
   void RandomizeAllParameters();
+
+  /**
+   * @fn Execute
+   * @brief Execute all simulation cases with the worker threads
+   * @details Each case is executed with its own copy of this executor whose parameters are already randomized. Since the randomization
+   *          streams are seeded from the case index, the results are identical to the sequential execution. When the monitored statistic
+   *          converges, no new case is started, and the cases already running in the other threads are completed.
+   * @param [in] execute_case: Function to construct, initialize and run a simulation case with the given executor
+   */
+  void Execute(const std::function<void(const MonteCarloSimulationExecutor&)>& execute_case);
+  /**
+   * @fn ExecuteWithReuse
+   * @brief Execute all simulation cases with the worker threads, and reuse one initialized simulation case in each worker
+   * @details The case is constructed and initialized only for the first case of each worker, and the later cases of the worker reset it
+   *          instead of rebuilding the global environment, the spacecraft, and the components. The case is destructed in the worker thread.
+   *          When the case reuse is disabled, a new case is constructed for every case as Execute.
+   * @param [in] create_case: Function to construct and initialize a simulation case with the given executor
+   * @param [in] execute_case: Function to reset the simulation case for the given executor (e.g., SimulationCase::ResetForMonteCarloCase) and run it
+   */
+  template <typename Case>
+  void ExecuteWithReuse(const std::function<std::unique_ptr<Case>(const MonteCarloSimulationExecutor&)>& create_case,
+                        const std::function<void(Case&, const MonteCarloSimulationExecutor&)>& execute_case);
+  /**
+   * @fn ExecuteBatches
+   * @brief Execute the simulation cases in batches which are propagated together (e.g., EnsemblePropagator)
+   * @details The parameters of all cases in a batch are randomized with the same per-case seeds as Execute, and the batch function sets the
+   *          result of each case with SetCaseResult of the given executors. The results are written in the order of the case index, and no
+   *          new batch is started when the monitored statistic converges.
+   * @param [in] batch_size: Maximum number of cases in a batch
+   * @param [in] execute_batch: Function to execute the cases with the given executors
+   */
+  void ExecuteBatches(const size_t batch_size, const std::function<void(const std::vector<MonteCarloSimulationExecutor>&)>& execute_batch);
 };
 
 template <size_t NumElement>
@@ -145,7 +370,7 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterVector(std::
     // Not registered in ip_list（Not defined in MCSim.ini）
     return;  // return without update the destination
   } else {
-    init_parameter_list_.at(name)->GetRandomizedVector(destination);  // cannot use operator[] since it is const map
+    init_parameter_list_.at(name).GetRandomizedVector(destination);  // cannot use operator[] since it is const map
   }
 }
 
@@ -157,13 +382,30 @@ void MonteCarloSimulationExecutor::AddInitializedMonteCarloParameter(std::string
   std::string name = so_name + MonteCarloSimulationExecutor::separator_ + init_monte_carlo_parameter_name;
   if (init_parameter_list_.find(name) == init_parameter_list_.end()) {
     // Register the parameter in ip_list if it is not registered yet
-    auto newparam = new InitializedMonteCarloParameters();
-    newparam->SetRandomConfiguration(mean_or_min, sigma_or_max, random_type);
-    init_parameter_list_[name] = newparam;
+    init_parameter_list_[name].SetRandomConfiguration(mean_or_min, sigma_or_max, random_type);
   } else {
     // Throw error if the parameter is already registered
     throw "More than one definition of one InitializedMonteCarloParameters.";
   }
 }
 
+template <typename Case>
+void MonteCarloSimulationExecutor::ExecuteWithReuse(const std::function<std::unique_ptr<Case>(const MonteCarloSimulationExecutor&)>& create_case,
+                                                    const std::function<void(Case&, const MonteCarloSimulationExecutor&)>& execute_case) {
+  const bool is_case_reuse_enabled = is_case_reuse_enabled_;
+  ExecuteWorkers([&create_case, &execute_case, is_case_reuse_enabled]() {
+    // The case is owned by the worker function, so that it is destructed in the worker thread which made it
+    std::shared_ptr<Case> simulation_case;
+    return std::function<void(const MonteCarloSimulationExecutor&)>(
+        [&create_case, &execute_case, is_case_reuse_enabled, simulation_case](const MonteCarloSimulationExecutor& case_executor) mutable {
+          if (simulation_case == nullptr || !is_case_reuse_enabled) {
+            // Destruct the previous case before the construction to release its SimulationObjects
+            simulation_case.reset();
+            simulation_case = create_case(case_executor);
+          }
+          execute_case(*simulation_case, case_executor);
+        });
+  });
+}
+
 #endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
@@ -0,0 +1,76 @@
+/**
+ * @file parameter_sweep.cpp
+ * @brief Deterministic grid of the parameters of the SimulationObjects executed as the cases of the Monte-Carlo simulation
+ */
+
+#include "parameter_sweep.hpp"
+
+#include <logger/log_utility.hpp>
+#include <stdexcept>
+
+ParameterSweep::ParameterSweep(const Mode mode) : mode_(mode) {}
+
+void ParameterSweep::AddAxis(const std::string& name, const std::vector<std::vector<double>>& points) {
+  if (points.empty()) throw std::invalid_argument("ParameterSweep: " + name + " has no point.");
+  for (const auto& point : points) {
+    if (point.size() != points[0].size()) throw std::invalid_argument("ParameterSweep: The points of " + name + " have different sizes.");
+  }
+  for (const auto& axis : axes_) {
+    if (axis.name == name) throw std::invalid_argument("ParameterSweep: " + name + " is defined more than once.");
+  }
+  axes_.push_back({name, points});
+}
+
+unsigned long long ParameterSweep::GetNumberOfCases() const {
+  if (axes_.empty()) return 0;
+  unsigned long long number_of_cases = 1;
+  for (const auto& axis : axes_) {
+    if (mode_ == Mode::kFullFactorial) {
+      number_of_cases *= axis.points.size();
+    } else {
+      number_of_cases += axis.points.size() - 1;
+    }
+  }
+  return number_of_cases;
+}
+
+size_t ParameterSweep::CalcPointIndex(const unsigned long long case_index, const size_t axis_index) const {
+  if (mode_ == Mode::kFullFactorial) {
+    // Mixed radix digits of the case index
+    unsigned long long divisor = 1;
+    for (size_t i = axis_index + 1; i < axes_.size(); i++) {
+      divisor *= axes_[i].points.size();
+    }
+    return (size_t)((case_index / divisor) % axes_[axis_index].points.size());
+  }
+
+  // The case 0 is the nominal point, and the axes take the other points in order
+  if (case_index == 0) return 0;
+  unsigned long long remaining_index = case_index - 1;
+  for (size_t i = 0; i < axes_.size(); i++) {
+    const unsigned long long number_of_variations = axes_[i].points.size() - 1;
+    if (remaining_index < number_of_variations) return i == axis_index ? (size_t)remaining_index + 1 : 0;
+    remaining_index -= number_of_variations;
+  }
+  return 0;
+}
+
+std::string ParameterSweep::GetCaseHeader() const {
+  std::string header;
+  for (const auto& axis : axes_) {
+    for (size_t i = 0; i < axis.points[0].size(); i++) {
+      header += axis.name + "(" + std::to_string(i) + "),";
+    }
+  }
+  return header;
+}
+
+std::string ParameterSweep::GetCaseValue(const unsigned long long case_index) const {
+  std::string value;
+  for (size_t axis_index = 0; axis_index < axes_.size(); axis_index++) {
+    for (const double element : GetPoint(case_index, axis_index)) {
+      AppendLogScalar(value, element, 10);
+    }
+  }
+  return value;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file parameter_sweep.hpp
+ * @brief Deterministic grid of the parameters of the SimulationObjects executed as the cases of the Monte-Carlo simulation
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_PARAMETER_SWEEP_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_PARAMETER_SWEEP_HPP_
+
+#include <string>
+#include <vector>
+
+/**
+ * @class ParameterSweep
+ * @brief Deterministic grid of the parameters of the SimulationObjects
+ * @details Each axis is a parameter named <SimulationObject>.<parameter> with the list of its points. The case index is converted to a
+ *          point of each axis, so the cases can be executed in any order, with the worker threads, and with the shards.
+ *          - FULL_FACTORIAL: All combinations of the points. The last axis changes fastest.
+ *          - ONE_AT_A_TIME: The first case uses the first point (nominal) of all axes, and the following cases change one axis at a time
+ *            to its other points while the other axes keep their nominal points.
+ */
+class ParameterSweep {
+ public:
+  /**
+   * @enum Mode
+   * @brief Combination of the points of the axes
+   */
+  enum class Mode {
+    kFullFactorial,  //!< All combinations of the points
+    kOneAtATime,     //!< Change one axis at a time from the nominal points
+  };
+
+  /**
+   * @fn ParameterSweep
+   * @brief Constructor
+   * @param [in] mode: Combination of the points of the axes
+   */
+  explicit ParameterSweep(const Mode mode = Mode::kFullFactorial);
+
+  /**
+   * @fn AddAxis
+   * @brief Add a parameter to sweep
+   * @note Throw std::invalid_argument when the points are empty, the points have different sizes, or the name is already added.
+   * @param [in] name: Name of the parameter as <SimulationObject>.<parameter>
+   * @param [in] points: Values of the parameter at each point. The first point is the nominal point of ONE_AT_A_TIME.
+   */
+  void AddAxis(const std::string& name, const std::vector<std::vector<double>>& points);
+
+  // Getters
+  /**
+   * @fn GetMode
+   * @brief Return combination of the points of the axes
+   */
+  inline Mode GetMode() const { return mode_; }
+  /**
+   * @fn GetNumberOfAxes
+   * @brief Return number of the swept parameters
+   */
+  inline size_t GetNumberOfAxes() const { return axes_.size(); }
+  /**
+   * @fn GetAxisName
+   * @brief Return name of the parameter of the axis as <SimulationObject>.<parameter>
+   */
+  inline const std::string& GetAxisName(const size_t axis_index) const { return axes_[axis_index].name; }
+  /**
+   * @fn GetNumberOfCases
+   * @brief Return number of the cases to execute all points of the grid. Zero when no axis is added.
+   */
+  unsigned long long GetNumberOfCases() const;
+  /**
+   * @fn CalcPointIndex
+   * @brief Calculate the index of the point of the axis in the case
+   * @param [in] case_index: Index of the case (0 <= case_index < GetNumberOfCases)
+   * @param [in] axis_index: Index of the axis
+   */
+  size_t CalcPointIndex(const unsigned long long case_index, const size_t axis_index) const;
+  /**
+   * @fn GetPoint
+   * @brief Return values of the parameter of the axis in the case
+   * @param [in] case_index: Index of the case (0 <= case_index < GetNumberOfCases)
+   * @param [in] axis_index: Index of the axis
+   */
+  inline const std::vector<double>& GetPoint(const unsigned long long case_index, const size_t axis_index) const {
+    return axes_[axis_index].points[CalcPointIndex(case_index, axis_index)];
+  }
+
+  /**
+   * @fn GetCaseHeader
+   * @brief Return the comma separated column names of the values of all axes as <SimulationObject>.<parameter>(<element index>)
+   */
+  std::string GetCaseHeader() const;
+  /**
+   * @fn GetCaseValue
+   * @brief Return the comma separated values of all axes in the case
+   * @param [in] case_index: Index of the case (0 <= case_index < GetNumberOfCases)
+   */
+  std::string GetCaseValue(const unsigned long long case_index) const;
+
+ private:
+  /**
+   * @struct Axis
+   * @brief Swept parameter
+   */
+  struct Axis {
+    std::string name;                         //!< Name of the parameter as <SimulationObject>.<parameter>
+    std::vector<std::vector<double>> points;  //!< Values of the parameter at each point
+  };
+
+  Mode mode_;               //!< Combination of the points of the axes
+  std::vector<Axis> axes_;  //!< Swept parameters
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_PARAMETER_SWEEP_HPP_
@@ -65,12 +65,13 @@ class SimulationObject {
   /**
    * @fn SetAllParameters
    * @brief Execute all SetParameter function for all SimulationObject instance
+   * @note The list is owned by each thread, so only the objects of the simulation case running in the caller thread are updated.
    */
   static void SetAllParameters(const MonteCarloSimulationExecutor& monte_carlo_simulator);
 
  private:
   std::string name_;  //!< Name to distinguish the target variable in initialize file for Monte-Carlo simulation
-  static std::map<std::string, SimulationObject*> object_list_;  //!< list of objects with simulation parameters
+  static thread_local std::map<std::string, SimulationObject*> object_list_;  //!< list of objects with simulation parameters in this thread
 };
 
 /**
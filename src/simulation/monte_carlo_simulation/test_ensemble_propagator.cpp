@@ -0,0 +1,175 @@
+/**
+ * @file test_ensemble_propagator.cpp
+ * @brief Test codes for the ensemble propagation with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <dynamics/attitude/attitude_rk4.hpp>
+#include <dynamics/orbit/rk4_orbit_propagation.hpp>
+#include <environment/global/physical_constants.hpp>
+#include <math_physics/gravity/gravity_potential.hpp>
+#include <string>
+
+#include "ensemble_propagator.hpp"
+
+namespace {
+const size_t kNumberOfSamples = 130;  //!< Number of samples over three blocks
+
+/**
+ * @fn MakeParameters
+ * @brief Make the parameters of the dynamics without the air drag
+ */
+EnsembleDynamicsParameters MakeParameters() {
+  EnsembleDynamicsParameters parameters;
+  parameters.gravity_constant_m3_s2 = environment::earth_gravitational_constant_m3_s2;
+  parameters.ballistic_coefficient_m2_kg = 0.0;
+  parameters.inertia_tensor_kgm2 = libra::Matrix<3, 3>(0.0);
+  parameters.inertia_tensor_kgm2[0][0] = 0.1;
+  parameters.inertia_tensor_kgm2[1][1] = 0.2;
+  parameters.inertia_tensor_kgm2[2][2] = 0.3;
+  parameters.inertia_tensor_kgm2[0][1] = parameters.inertia_tensor_kgm2[1][0] = 0.01;
+  parameters.duration_s = 1000.0;
+  parameters.orbit_step_s = 1.0;
+  parameters.attitude_step_s = 0.1;
+  return parameters;
+}
+
+/**
+ * @fn MakeStates
+ * @brief Make the different initial states of the samples
+ */
+EnsembleStates MakeStates() {
+  EnsembleStates states;
+  states.Resize(kNumberOfSamples);
+  for (size_t j = 0; j < kNumberOfSamples; j++) {
+    const double radius_m = 6778.0e3 + 1.0e3 * j;
+    const double inclination_rad = 0.01 * j;
+    const double speed_m_s = sqrt(environment::earth_gravitational_constant_m3_s2 / radius_m);
+    states.position_i_m[0][j] = radius_m;
+    states.position_i_m[1][j] = 0.0;
+    states.position_i_m[2][j] = 0.0;
+    states.velocity_i_m_s[0][j] = 0.0;
+    states.velocity_i_m_s[1][j] = speed_m_s * cos(inclination_rad);
+    states.velocity_i_m_s[2][j] = speed_m_s * sin(inclination_rad);
+    libra::Quaternion quaternion_i2b(0.1 * j, 0.2, -0.3, 1.0);
+    quaternion_i2b = quaternion_i2b.Normalize();
+    for (size_t i = 0; i < 4; i++) states.quaternion_i2b[i][j] = quaternion_i2b[i];
+    states.angular_velocity_b_rad_s[0][j] = 0.05 + 0.001 * j;
+    states.angular_velocity_b_rad_s[1][j] = -0.02;
+    states.angular_velocity_b_rad_s[2][j] = 0.01;
+  }
+  return states;
+}
+
+/**
+ * @fn PropagateReferenceOrbit
+ * @brief Propagate the orbit of a sample with Rk4OrbitPropagation and the J2 acceleration of GravityPotential held in each short step
+ * @return Position after the propagation [m]
+ */
+libra::Vector<3> PropagateReferenceOrbit(const EnsembleStates& initial_states, const size_t sample_index, const double duration_s) {
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", 0, nullptr, {});
+  libra::Vector<3> position_i_m, velocity_i_m_s;
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i] = initial_states.position_i_m[i][sample_index];
+    velocity_i_m_s[i] = initial_states.velocity_i_m_s[i][sample_index];
+  }
+  const double step_s = 0.1;
+  Rk4OrbitPropagation orbit(&celestial_information, environment::earth_gravitational_constant_m3_s2, step_s, position_i_m, velocity_i_m_s);
+  orbit.SetIsCalcEnabled(true);
+
+  // The normalized C20 of the J2 term. The ECEF frame is the inertial frame with the IDLE earth rotation.
+  std::vector<std::vector<double>> c(3, std::vector<double>(3, 0.0)), s(3, std::vector<double>(3, 0.0));
+  c[2][0] = -environment::earth_j2 / sqrt(5.0);
+  GravityPotential gravity_potential(2, c, s, environment::earth_gravitational_constant_m3_s2, environment::earth_equatorial_radius_m);
+
+  const size_t number_of_steps = (size_t)(duration_s / step_s + 0.5);
+  for (size_t step = 0; step < number_of_steps; step++) {
+    orbit.SetAcceleration_i_m_s2(gravity_potential.CalcAcceleration_xcxf_m_s2(orbit.GetPosition_i_m()));
+    orbit.Propagate((step + 1) * step_s, 0.0);
+  }
+  return orbit.GetPosition_i_m();
+}
+}  // namespace
+
+/**
+ * @brief Test for the orbit against Rk4OrbitPropagation
+ */
+TEST(CpuEnsembleBackend, Orbit) {
+  const EnsembleDynamicsParameters parameters = MakeParameters();
+  const EnsembleStates initial_states = MakeStates();
+  EnsembleStates states = initial_states;
+  CpuEnsembleBackend backend(2);
+  backend.Propagate(states, parameters);
+
+  for (const size_t sample_index : {(size_t)0, (size_t)70, kNumberOfSamples - 1}) {
+    const libra::Vector<3> reference_position_i_m = PropagateReferenceOrbit(initial_states, sample_index, parameters.duration_s);
+    // The difference comes from the J2 acceleration held in each step of the reference. The J2 effect itself is several kilometers.
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(reference_position_i_m[i], states.position_i_m[i][sample_index], 2.0);
+    }
+  }
+  // Circular orbits without the air drag
+  EXPECT_NEAR(6778.0e3 - environment::earth_equatorial_radius_m, states.minimum_altitude_m[0], 20.0e3);
+}
+
+/**
+ * @brief Test for the attitude against AttitudeRk4
+ */
+TEST(CpuEnsembleBackend, Attitude) {
+  const EnsembleDynamicsParameters parameters = MakeParameters();
+  const EnsembleStates initial_states = MakeStates();
+  EnsembleStates states = initial_states;
+  CpuEnsembleBackend backend(2);
+  backend.Propagate(states, parameters);
+
+  for (const size_t sample_index : {(size_t)0, (size_t)70, kNumberOfSamples - 1}) {
+    libra::Vector<3> angular_velocity_b_rad_s;
+    libra::Quaternion quaternion_i2b;
+    for (size_t i = 0; i < 3; i++) angular_velocity_b_rad_s[i] = initial_states.angular_velocity_b_rad_s[i][sample_index];
+    for (size_t i = 0; i < 4; i++) quaternion_i2b[i] = initial_states.quaternion_i2b[i][sample_index];
+    AttitudeRk4 attitude(angular_velocity_b_rad_s, quaternion_i2b, parameters.inertia_tensor_kgm2, libra::Vector<3>(0.0),
+                         parameters.attitude_step_s, "ensemble_attitude" + std::to_string(sample_index));
+    attitude.Propagate(parameters.duration_s);
+
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(attitude.GetAngularVelocity_b_rad_s()[i], states.angular_velocity_b_rad_s[i][sample_index], 1.0e-10);
+    }
+    for (size_t i = 0; i < 4; i++) {
+      EXPECT_NEAR(attitude.GetQuaternion_i2b()[i], states.quaternion_i2b[i][sample_index], 1.0e-9);
+    }
+  }
+}
+
+/**
+ * @brief Test for the results independent of the number of threads and the air drag
+ */
+TEST(CpuEnsembleBackend, ThreadsAndDrag) {
+  EnsembleDynamicsParameters parameters = MakeParameters();
+  EnsembleStates single_thread_states = MakeStates();
+  EnsembleStates multi_thread_states = single_thread_states;
+  CpuEnsembleBackend(1).Propagate(single_thread_states, parameters);
+  CpuEnsembleBackend(3).Propagate(multi_thread_states, parameters);
+  for (size_t j = 0; j < kNumberOfSamples; j++) {
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_DOUBLE_EQ(single_thread_states.position_i_m[i][j], multi_thread_states.position_i_m[i][j]);
+    }
+    for (size_t i = 0; i < 4; i++) {
+      EXPECT_DOUBLE_EQ(single_thread_states.quaternion_i2b[i][j], multi_thread_states.quaternion_i2b[i][j]);
+    }
+  }
+
+  // The air drag decreases the orbital energy
+  parameters.ballistic_coefficient_m2_kg = 0.22;  // Cd = 2.2, 1 m2, 10 kg
+  EnsembleStates drag_states = MakeStates();
+  CpuEnsembleBackend(1).Propagate(drag_states, parameters);
+  const auto calc_energy = [](const EnsembleStates& states, const size_t j) {
+    double r2 = 0.0, v2 = 0.0;
+    for (size_t i = 0; i < 3; i++) {
+      r2 += states.position_i_m[i][j] * states.position_i_m[i][j];
+      v2 += states.velocity_i_m_s[i][j] * states.velocity_i_m_s[i][j];
+    }
+    return 0.5 * v2 - environment::earth_gravitational_constant_m3_s2 / sqrt(r2);
+  };
+  EXPECT_LT(calc_energy(drag_states, 0), calc_energy(single_thread_states, 0) - 1.0);
+}
@@ -0,0 +1,212 @@
+/**
+ * @file test_monte_carlo_convergence_monitor.cpp
+ * @brief Test codes for MonteCarloConvergenceMonitor class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <logger/loggable.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "monte_carlo_convergence_monitor.hpp"
+#include "monte_carlo_simulation_executor.hpp"
+
+namespace {
+const double kZScore95 = 1.959963984540054;  //!< Standard normal quantile of the 95 % confidence level
+
+/**
+ * @class TestCaseResult
+ * @brief Case result with a single column
+ */
+class TestCaseResult : public ILoggable {
+ public:
+  explicit TestCaseResult(const double value) : value_(value) {}
+  std::string GetLogHeader() const override { return "case_id[-],result[-],"; }
+  std::string GetLogValue() const override { return "0," + std::to_string(value_) + ","; }
+
+ private:
+  double value_;  //!< Result value
+};
+}  // namespace
+
+/**
+ * @brief Test for the supported statistics and the disabled monitor
+ */
+TEST(MonteCarloConvergenceMonitor, SetTarget) {
+  MonteCarloConvergenceMonitor monitor;
+  EXPECT_FALSE(monitor.IsEnabled());
+  // The disabled monitor ignores the values and never converges
+  monitor.AddValue(1.0);
+  EXPECT_EQ(0u, monitor.GetNumberOfValues());
+  EXPECT_FALSE(monitor.IsConverged());
+
+  EXPECT_TRUE(monitor.SetTarget("", "MEAN", 0.95, 1.0, 0.0, 1));
+  EXPECT_FALSE(monitor.IsEnabled());
+  EXPECT_FALSE(monitor.SetTarget("result[-]", "MEDIAN", 0.95, 1.0, 0.0, 1));
+  EXPECT_FALSE(monitor.SetTarget("result[-]", "P", 0.95, 1.0, 0.0, 1));
+  EXPECT_FALSE(monitor.SetTarget("result[-]", "P101", 0.95, 1.0, 0.0, 1));
+  EXPECT_FALSE(monitor.SetTarget("result[-]", "P9x", 0.95, 1.0, 0.0, 1));
+  EXPECT_FALSE(monitor.SetTarget("result[-]", "MEAN", 1.0, 1.0, 0.0, 1));
+  EXPECT_FALSE(monitor.IsEnabled());
+
+  EXPECT_TRUE(monitor.SetTarget("result[-]", "P99.9", 0.95, 1.0, 0.0, 1));
+  EXPECT_TRUE(monitor.IsEnabled());
+  EXPECT_EQ("result[-]", monitor.GetColumnName());
+}
+
+/**
+ * @brief Test for the confidence interval of the mean and the convergence at the tolerance
+ */
+TEST(MonteCarloConvergenceMonitor, MeanConvergence) {
+  const double absolute_tolerance = 0.1;
+  MonteCarloConvergenceMonitor monitor;
+  ASSERT_TRUE(monitor.SetTarget("result[-]", "MEAN", 0.95, absolute_tolerance, 0.0, 100));
+
+  std::mt19937 generator(113);
+  std::normal_distribution<double> distribution(5.0, 2.0);
+  std::vector<double> values;
+  while (!monitor.IsConverged() && values.size() < 100000) {
+    const double value = distribution(generator);
+    values.push_back(value);
+    monitor.AddValue(value);
+    // NaN is ignored
+    monitor.AddValue(std::numeric_limits<double>::quiet_NaN());
+    ASSERT_EQ(values.size(), monitor.GetNumberOfValues());
+
+    // Two pass mean and sample standard deviation
+    const double n = (double)values.size();
+    double mean = 0.0;
+    for (const double v : values) mean += v / n;
+    double sum_of_squared_deviations = 0.0;
+    for (const double v : values) sum_of_squared_deviations += (v - mean) * (v - mean);
+    ASSERT_NEAR(mean, monitor.GetEstimate(), 1e-12);
+    if (values.size() == 1) {
+      EXPECT_TRUE(std::isinf(monitor.GetConfidenceHalfWidth()));
+      continue;
+    }
+    const double half_width = kZScore95 * sqrt(sum_of_squared_deviations / (n - 1.0) / n);
+    ASSERT_NEAR(half_width, monitor.GetConfidenceHalfWidth(), 1e-9);
+    // The convergence waits for the minimum number of cases and the tolerance
+    ASSERT_EQ(values.size() >= 100 && half_width <= absolute_tolerance, monitor.IsConverged()) << "case " << values.size();
+  }
+
+  // About (1.96 * 2.0 / 0.1)^2 = 1537 cases are needed, and the estimate is within the interval of the true mean
+  EXPECT_TRUE(monitor.IsConverged());
+  EXPECT_GT(monitor.GetNumberOfValues(), 1200u);
+  EXPECT_LT(monitor.GetNumberOfValues(), 1900u);
+  EXPECT_NEAR(5.0, monitor.GetEstimate(), 2.0 * absolute_tolerance);
+
+  // The relative tolerance is applied to the absolute value of the estimate
+  MonteCarloConvergenceMonitor relative_monitor;
+  ASSERT_TRUE(relative_monitor.SetTarget("result[-]", "MEAN", 0.95, 0.0, 0.03, 2));
+  for (const double value : values) {
+    relative_monitor.AddValue(-value);
+    if (relative_monitor.IsConverged()) break;
+  }
+  EXPECT_TRUE(relative_monitor.IsConverged());
+  EXPECT_LT(relative_monitor.GetNumberOfValues(), monitor.GetNumberOfValues());
+  EXPECT_LE(relative_monitor.GetConfidenceHalfWidth(), 0.03 * fabs(relative_monitor.GetEstimate()));
+}
+
+/**
+ * @brief Test for the percentile estimate and its order statistic interval
+ */
+TEST(MonteCarloConvergenceMonitor, PercentileConvergence) {
+  const double absolute_tolerance = 0.01;
+  MonteCarloConvergenceMonitor monitor;
+  ASSERT_TRUE(monitor.SetTarget("result[-]", "P90", 0.95, absolute_tolerance, 0.0, 10));
+
+  std::mt19937 generator(113);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  std::vector<double> values;
+  while (!monitor.IsConverged() && values.size() < 100000) {
+    const double value = distribution(generator);
+    values.push_back(value);
+    monitor.AddValue(value);
+
+    std::vector<double> sorted_values = values;
+    std::sort(sorted_values.begin(), sorted_values.end());
+    const size_t n = sorted_values.size();
+    // Linear interpolation between the order statistics
+    const double position = 0.9 * (double)(n - 1);
+    const size_t lower_index = (size_t)position;
+    double expected_estimate = sorted_values.back();
+    if (lower_index + 1 < n) {
+      const double ratio = position - (double)lower_index;
+      expected_estimate = sorted_values[lower_index] + ratio * (sorted_values[lower_index + 1] - sorted_values[lower_index]);
+    }
+    ASSERT_NEAR(expected_estimate, monitor.GetEstimate(), 1e-12);
+
+    // Ranks of the binomial interval
+    const double rank_deviation = kZScore95 * sqrt((double)n * 0.9 * 0.1);
+    const double lower_rank = floor((double)n * 0.9 - rank_deviation);
+    const double upper_rank = ceil((double)n * 0.9 + rank_deviation);
+    if (lower_rank < 0.0 || upper_rank > (double)(n - 1)) {
+      // Too few values in the upper tail
+      ASSERT_TRUE(std::isinf(monitor.GetConfidenceHalfWidth())) << "case " << n;
+      ASSERT_FALSE(monitor.IsConverged());
+    } else {
+      ASSERT_DOUBLE_EQ(0.5 * (sorted_values[(size_t)upper_rank] - sorted_values[(size_t)lower_rank]), monitor.GetConfidenceHalfWidth());
+    }
+  }
+
+  // The half width of the uniform distribution is about z * sqrt(p (1 - p) / n), so about 3500 cases are needed
+  EXPECT_TRUE(monitor.IsConverged());
+  EXPECT_GT(monitor.GetNumberOfValues(), 2500u);
+  EXPECT_LT(monitor.GetNumberOfValues(), 5000u);
+  EXPECT_NEAR(0.9, monitor.GetEstimate(), 2.0 * absolute_tolerance);
+}
+
+/**
+ * @brief Test for the column of the CSV case result
+ */
+TEST(MonteCarloConvergenceMonitor, AddCaseResult) {
+  MonteCarloConvergenceMonitor monitor;
+  ASSERT_TRUE(monitor.SetTarget("b[m]", "MEAN", 0.95, 1.0, 0.0, 1));
+  monitor.AddCaseResult("a[m],b[m],c[m],", "1.0,2.5,3.0,");
+  monitor.AddCaseResult("a[m],b[m]", "1.0,4.5");
+  EXPECT_EQ(2u, monitor.GetNumberOfValues());
+  EXPECT_DOUBLE_EQ(3.5, monitor.GetEstimate());
+
+  // The missing column and the missing value are not added
+  monitor.AddCaseResult("a[m],c[m],", "1.0,3.0,");
+  monitor.AddCaseResult("a[m],b[m],", "1.0,");
+  EXPECT_EQ(2u, monitor.GetNumberOfValues());
+}
+
+/**
+ * @brief Test for the early stop of the campaign at the convergence
+ */
+TEST(MonteCarloConvergenceMonitor, ExecutorEarlyStop) {
+  MonteCarloSimulationExecutor executor(1000);
+  ASSERT_TRUE(executor.SetConvergenceTarget("result[-]", "MEAN", 0.95, 0.05, 0.0, 20));
+
+  std::mt19937 generator(113);
+  std::normal_distribution<double> distribution(1.0, 0.1);
+  unsigned long long number_of_cases = 0;
+  while (executor.WillExecuteNextCase()) {
+    executor.SetCaseResult(TestCaseResult(distribution(generator)));
+    executor.AtTheEndOfEachCase();
+    number_of_cases++;
+  }
+  // The half width is already less than the tolerance at the minimum number of cases
+  EXPECT_EQ(20u, number_of_cases);
+  EXPECT_EQ(20u, executor.GetNumberOfExecutionsDone());
+  EXPECT_TRUE(executor.GetConvergenceMonitor().IsConverged());
+  EXPECT_NEAR(1.0, executor.GetConvergenceMonitor().GetEstimate(), 0.1);
+
+  // Without the convergence target, all cases are executed
+  MonteCarloSimulationExecutor full_executor(50);
+  number_of_cases = 0;
+  while (full_executor.WillExecuteNextCase()) {
+    full_executor.SetCaseResult(TestCaseResult(distribution(generator)));
+    full_executor.AtTheEndOfEachCase();
+    number_of_cases++;
+  }
+  EXPECT_EQ(50u, number_of_cases);
+  EXPECT_FALSE(full_executor.GetConvergenceMonitor().IsConverged());
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_parameter_sweep.cpp
+ * @brief Test codes for ParameterSweep class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "monte_carlo_simulation_executor.hpp"
+#include "parameter_sweep.hpp"
+
+namespace {
+/**
+ * @fn MakeSweep
+ * @brief Make the sweep of three axes with 2, 3, and 4 points
+ * @param [in] mode: Combination of the points of the axes
+ */
+ParameterSweep MakeSweep(const ParameterSweep::Mode mode) {
+  ParameterSweep sweep(mode);
+  sweep.AddAxis("spacecraft.mass_kg", {{10.0}, {20.0}});
+  sweep.AddAxis("spacecraft.offset_m", {{0.0, 1.0}, {0.5, 1.5}, {1.0, 2.0}});
+  sweep.AddAxis("orbit.altitude_km", {{400.0}, {500.0}, {600.0}, {700.0}});
+  return sweep;
+}
+}  // namespace
+
+/**
+ * @brief Test for the invalid axes
+ */
+TEST(ParameterSweep, AddAxis) {
+  ParameterSweep sweep;
+  EXPECT_EQ(ParameterSweep::Mode::kFullFactorial, sweep.GetMode());
+  EXPECT_EQ(0u, sweep.GetNumberOfCases());
+  EXPECT_THROW(sweep.AddAxis("spacecraft.mass_kg", {}), std::invalid_argument);
+  EXPECT_THROW(sweep.AddAxis("spacecraft.mass_kg", {{1.0}, {1.0, 2.0}}), std::invalid_argument);
+  EXPECT_EQ(0u, sweep.GetNumberOfAxes());
+
+  sweep.AddAxis("spacecraft.mass_kg", {{1.0}});
+  EXPECT_THROW(sweep.AddAxis("spacecraft.mass_kg", {{2.0}}), std::invalid_argument);
+  EXPECT_EQ(1u, sweep.GetNumberOfAxes());
+  EXPECT_EQ("spacecraft.mass_kg", sweep.GetAxisName(0));
+  EXPECT_EQ(1u, sweep.GetNumberOfCases());
+}
+
+/**
+ * @brief Test for the full factorial grid as the mixed radix digits of the case index
+ */
+TEST(ParameterSweep, FullFactorial) {
+  const ParameterSweep sweep = MakeSweep(ParameterSweep::Mode::kFullFactorial);
+  ASSERT_EQ(24u, sweep.GetNumberOfCases());
+
+  std::set<std::vector<size_t>> visited_points;
+  for (unsigned long long case_index = 0; case_index < sweep.GetNumberOfCases(); case_index++) {
+    // The last axis changes fastest
+    const std::vector<size_t> expected_point_indices = {(size_t)(case_index / 12), (size_t)(case_index / 4 % 3), (size_t)(case_index % 4)};
+    std::vector<size_t> point_indices;
+    for (size_t axis_index = 0; axis_index < sweep.GetNumberOfAxes(); axis_index++) {
+      point_indices.push_back(sweep.CalcPointIndex(case_index, axis_index));
+    }
+    EXPECT_EQ(expected_point_indices, point_indices) << "case " << case_index;
+    visited_points.insert(point_indices);
+  }
+  // All combinations are visited once
+  EXPECT_EQ(24u, visited_points.size());
+
+  EXPECT_EQ(std::vector<double>({20.0}), sweep.GetPoint(13, 0));
+  EXPECT_EQ(std::vector<double>({0.0, 1.0}), sweep.GetPoint(13, 1));
+  EXPECT_EQ(std::vector<double>({500.0}), sweep.GetPoint(13, 2));
+}
+
+/**
+ * @brief Test for the one at a time grid from the nominal points
+ */
+TEST(ParameterSweep, OneAtATime) {
+  const ParameterSweep sweep = MakeSweep(ParameterSweep::Mode::kOneAtATime);
+  // The nominal case and the other points of each axis
+  ASSERT_EQ(1u + 1u + 2u + 3u, sweep.GetNumberOfCases());
+
+  const std::vector<std::vector<size_t>> expected_point_indices = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 2, 0}, {0, 0, 1}, {0, 0, 2}, {0, 0, 3}};
+  for (unsigned long long case_index = 0; case_index < sweep.GetNumberOfCases(); case_index++) {
+    std::vector<size_t> point_indices;
+    for (size_t axis_index = 0; axis_index < sweep.GetNumberOfAxes(); axis_index++) {
+      point_indices.push_back(sweep.CalcPointIndex(case_index, axis_index));
+    }
+    EXPECT_EQ(expected_point_indices[case_index], point_indices) << "case " << case_index;
+  }
+
+  // The axis with a single point adds no case
+  ParameterSweep single_point_sweep(ParameterSweep::Mode::kOneAtATime);
+  single_point_sweep.AddAxis("spacecraft.mass_kg", {{10.0}});
+  single_point_sweep.AddAxis("orbit.altitude_km", {{400.0}, {500.0}});
+  ASSERT_EQ(2u, single_point_sweep.GetNumberOfCases());
+  EXPECT_EQ(0u, single_point_sweep.CalcPointIndex(1, 0));
+  EXPECT_EQ(1u, single_point_sweep.CalcPointIndex(1, 1));
+}
+
+/**
+ * @brief Test for the header and the values of the case result
+ */
+TEST(ParameterSweep, CaseHeaderAndValue) {
+  const ParameterSweep sweep = MakeSweep(ParameterSweep::Mode::kFullFactorial);
+  EXPECT_EQ("spacecraft.mass_kg(0),spacecraft.offset_m(0),spacecraft.offset_m(1),orbit.altitude_km(0),", sweep.GetCaseHeader());
+  EXPECT_EQ("10,0,1,400,", sweep.GetCaseValue(0));
+  EXPECT_EQ("20,1,2,700,", sweep.GetCaseValue(23));
+}
+
+/**
+ * @brief Test for the swept values given to the SimulationObjects through the executor
+ */
+TEST(ParameterSweep, ExecutorCases) {
+  const ParameterSweep sweep = MakeSweep(ParameterSweep::Mode::kOneAtATime);
+  MonteCarloSimulationExecutor executor(1);
+  executor.SetParameterSweep(sweep);
+  EXPECT_TRUE(executor.IsEnabled());
+  EXPECT_EQ(sweep.GetNumberOfCases(), executor.GetTotalNumberOfExecutions());
+
+  unsigned long long number_of_cases = 0;
+  while (executor.WillExecuteNextCase()) {
+    const unsigned long long case_index = executor.GetCaseIndex();
+    executor.RandomizeAllParameters();
+    double mass_kg = -1.0, altitude_km = -1.0;
+    executor.GetInitializedMonteCarloParameterDouble("spacecraft", "mass_kg", mass_kg);
+    executor.GetInitializedMonteCarloParameterDouble("orbit", "altitude_km", altitude_km);
+    EXPECT_DOUBLE_EQ(sweep.GetPoint(case_index, 0)[0], mass_kg) << "case " << case_index;
+    EXPECT_DOUBLE_EQ(sweep.GetPoint(case_index, 2)[0], altitude_km) << "case " << case_index;
+    executor.AtTheEndOfEachCase();
+    number_of_cases++;
+  }
+  EXPECT_EQ(sweep.GetNumberOfCases(), number_of_cases);
+
+  // The empty sweep is ignored
+  MonteCarloSimulationExecutor empty_sweep_executor(1);
+  empty_sweep_executor.SetParameterSweep(ParameterSweep());
+  EXPECT_FALSE(empty_sweep_executor.IsEnabled());
+  EXPECT_EQ(1u, empty_sweep_executor.GetTotalNumberOfExecutions());
+}
@@ -0,0 +1,301 @@
+/**
+ * @file distributed_simulation_node.cpp
+ * @brief Class to split the spacecraft of a simulation case across processes and synchronize them
+ */
+
+#include "distributed_simulation_node.hpp"
+
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cmath>
+#include <dynamics/dynamics.hpp>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utilities/snapshot.hpp>
+
+namespace {
+const char* kMessageTag = "S2E_DISTRIBUTED_SYNC";  //!< Tag at the beginning of the message of each node
+const double kTimeTolerance_s = 1e-6;              //!< Tolerance of the elapsed time to judge the synchronization points [s]
+}  // namespace
+
+DistributedSimulationNode::DistributedSimulationNode(const unsigned int node_id, const unsigned int number_of_nodes,
+                                                     const std::string& coordinator_address, const unsigned short coordinator_port,
+                                                     const double sync_period_s)
+    : node_id_(node_id),
+      number_of_nodes_(number_of_nodes),
+      coordinator_address_(coordinator_address),
+      coordinator_port_(coordinator_port),
+      sync_period_s_(sync_period_s),
+      next_sync_time_s_(sync_period_s) {
+  if (number_of_nodes_ == 0 || node_id_ >= number_of_nodes_) {
+    throw std::invalid_argument("Node ID " + std::to_string(node_id_) + " is out of the number of nodes " + std::to_string(number_of_nodes_) + ".");
+  }
+  if (!(sync_period_s_ > 0.0)) throw std::invalid_argument("The synchronization period of the distributed simulation must be positive.");
+}
+
+DistributedSimulationNode::~DistributedSimulationNode() {
+#ifndef WIN32
+  for (const int socket_descriptor : socket_descriptors_) close(socket_descriptor);
+#endif
+}
+
+void DistributedSimulationNode::Connect(const double timeout_s) {
+  if (number_of_nodes_ == 1) return;
+#ifdef WIN32
+  (void)timeout_s;
+  throw std::runtime_error("The distributed simulation is not supported on Windows.");
+#else
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(coordinator_port_);
+  if (inet_pton(AF_INET, coordinator_address_.c_str(), &address.sin_addr) != 1) {
+    throw std::invalid_argument("Coordinator address " + coordinator_address_ + " is not a valid IPv4 address.");
+  }
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout_s);
+  const int enable = 1;
+
+  if (node_id_ == 0) {
+    // Coordinator: accept all workers and sort the sockets in the order of the node ID
+    const int listen_descriptor = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    setsockopt(listen_descriptor, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (listen_descriptor < 0 || bind(listen_descriptor, (sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(listen_descriptor, (int)number_of_nodes_) != 0) {
+      if (listen_descriptor >= 0) close(listen_descriptor);
+      throw std::runtime_error("Coordinator cannot listen on port " + std::to_string(coordinator_port_) + ": " + strerror(errno));
+    }
+    socket_descriptors_.assign(number_of_nodes_ - 1, -1);
+    for (unsigned int i = 1; i < number_of_nodes_; i++) {
+      const int remaining_time_ms =
+          (int)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+      pollfd poll_descriptor = {listen_descriptor, POLLIN, 0};
+      if (remaining_time_ms <= 0 || poll(&poll_descriptor, 1, remaining_time_ms) <= 0) {
+        close(listen_descriptor);
+        throw std::runtime_error("Coordinator timed out waiting for the workers of the distributed simulation.");
+      }
+      const int socket_descriptor = accept4(listen_descriptor, nullptr, nullptr, SOCK_CLOEXEC);
+      if (socket_descriptor < 0) {
+        i--;
+        continue;
+      }
+      setsockopt(socket_descriptor, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+      uint32_t worker_id;
+      std::istringstream stream(ReceiveFrame(socket_descriptor));
+      SnapshotReader(stream).Read(worker_id);
+      if (worker_id == 0 || worker_id >= number_of_nodes_ || socket_descriptors_[worker_id - 1] >= 0) {
+        close(socket_descriptor);
+        close(listen_descriptor);
+        throw std::runtime_error("Worker node ID " + std::to_string(worker_id) + " is invalid or duplicated.");
+      }
+      socket_descriptors_[worker_id - 1] = socket_descriptor;
+    }
+    close(listen_descriptor);
+  } else {
+    // Worker: retry until the coordinator starts listening
+    while (true) {
+      const int socket_descriptor = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+      if (socket_descriptor >= 0 && connect(socket_descriptor, (sockaddr*)&address, sizeof(address)) == 0) {
+        setsockopt(socket_descriptor, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        socket_descriptors_.push_back(socket_descriptor);
+        break;
+      }
+      if (socket_descriptor >= 0) close(socket_descriptor);
+      if (std::chrono::steady_clock::now() > deadline) {
+        throw std::runtime_error("Worker cannot connect to the coordinator " + coordinator_address_ + ":" + std::to_string(coordinator_port_) + ".");
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    std::ostringstream stream;
+    SnapshotWriter(stream).Write((uint32_t)node_id_);
+    SendFrame(socket_descriptors_[0], stream.str());
+  }
+  std::cout << "Distributed simulation: node " << node_id_ << " of " << number_of_nodes_ << " nodes is connected." << std::endl;
+#endif
+}
+
+void DistributedSimulationNode::RegisterLocalSpacecraft(const size_t spacecraft_id, const Dynamics* dynamics) {
+  if (!IsLocalSpacecraft(spacecraft_id)) {
+    throw std::invalid_argument("Spacecraft " + std::to_string(spacecraft_id) + " is not assigned to node " + std::to_string(node_id_) + ".");
+  }
+  local_dynamics_[spacecraft_id] = dynamics;
+}
+
+void DistributedSimulationNode::SetRelativeInformation(RelativeInformation* relative_information, const size_t number_of_spacecraft) {
+  relative_information_ = relative_information;
+  for (size_t spacecraft_id = 0; spacecraft_id < number_of_spacecraft; spacecraft_id++) {
+    if (!IsLocalSpacecraft(spacecraft_id)) relative_information_->RegisterRemoteSpacecraft(spacecraft_id);
+  }
+}
+
+void DistributedSimulationNode::SetInterSpacecraftCommunication(InterSpacecraftCommunication* inter_spacecraft_communication) {
+  inter_spacecraft_communication_ = inter_spacecraft_communication;
+  inter_spacecraft_communication_->SetDistributedSimulationNode(this);
+}
+
+bool DistributedSimulationNode::Synchronize(const double elapsed_time_s) {
+  if (number_of_nodes_ == 1 || elapsed_time_s + kTimeTolerance_s < next_sync_time_s_) return false;
+  while (next_sync_time_s_ <= elapsed_time_s + kTimeTolerance_s) next_sync_time_s_ += sync_period_s_;
+
+  const auto start_time = std::chrono::steady_clock::now();
+  // All-gather through the coordinator. The gathered messages are in the order of the node ID.
+  std::vector<std::string> messages;
+  if (node_id_ == 0) {
+    messages.push_back(MakeMessage(elapsed_time_s));
+    for (const int socket_descriptor : socket_descriptors_) {
+      messages.push_back(ReceiveFrame(socket_descriptor));
+    }
+    std::ostringstream stream;
+    SnapshotWriter writer(stream);
+    writer.Write((uint64_t)messages.size());
+    for (const auto& message : messages) writer.Write(message);
+    const std::string gathered_message = stream.str();
+    for (const int socket_descriptor : socket_descriptors_) {
+      SendFrame(socket_descriptor, gathered_message);
+    }
+  } else {
+    SendFrame(socket_descriptors_[0], MakeMessage(elapsed_time_s));
+    std::istringstream stream(ReceiveFrame(socket_descriptors_[0]));
+    SnapshotReader reader(stream);
+    messages.resize(reader.ReadSize());
+    for (auto& message : messages) reader.Read(message);
+  }
+  for (const auto& message : messages) {
+    ApplyMessage(message, elapsed_time_s);
+  }
+
+  total_wait_time_s_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  number_of_synchronizations_++;
+  return true;
+}
+
+void DistributedSimulationNode::PrintStatistics() const {
+  if (number_of_nodes_ == 1) return;
+  std::cout << "Distributed simulation: node " << node_id_ << ", " << number_of_synchronizations_ << " synchronizations, ";
+  std::cout << total_wait_time_s_ << " s spent in the synchronization" << std::endl;
+}
+
+std::string DistributedSimulationNode::MakeMessage(const double elapsed_time_s) {
+  std::ostringstream stream;
+  SnapshotWriter writer(stream);
+  writer.WriteTag(kMessageTag);
+  writer.Write((uint32_t)node_id_);
+  writer.Write(elapsed_time_s);
+
+  writer.Write((uint64_t)local_dynamics_.size());
+  for (const auto& local_dynamics : local_dynamics_) {
+    const Orbit& orbit = local_dynamics.second->GetOrbit();
+    RemoteSpacecraftState state;
+    state.position_i_m = orbit.GetPosition_i_m();
+    state.velocity_i_m_s = orbit.GetVelocity_i_m_s();
+    state.quaternion_i2b = local_dynamics.second->GetAttitude().GetQuaternion_i2b();
+    state.quaternion_i2rtn = orbit.CalcQuaternion_i2lvlh();
+    writer.Write((uint64_t)local_dynamics.first);
+    writer.Write(state);
+  }
+
+  std::vector<InterSpacecraftPacket> packets;
+  if (inter_spacecraft_communication_ != nullptr) packets = inter_spacecraft_communication_->TakeRemotePackets();
+  writer.Write((uint64_t)packets.size());
+  for (const auto& packet : packets) {
+    writer.Write((uint64_t)packet.source_spacecraft_id);
+    writer.Write((uint64_t)packet.destination_spacecraft_id);
+    writer.Write(packet.send_time_s);
+    writer.Write(packet.delivery_time_s);
+    writer.Write(packet.data);
+  }
+  return stream.str();
+}
+
+void DistributedSimulationNode::ApplyMessage(const std::string& message, const double elapsed_time_s) {
+  std::istringstream stream(message);
+  SnapshotReader reader(stream);
+  reader.ReadTag(kMessageTag);
+  uint32_t node_id;
+  double node_elapsed_time_s;
+  reader.Read(node_id);
+  reader.Read(node_elapsed_time_s);
+  if (std::abs(node_elapsed_time_s - elapsed_time_s) > kTimeTolerance_s) {
+    throw std::runtime_error("Node " + std::to_string(node_id) + " is at " + std::to_string(node_elapsed_time_s) + " s while node " +
+                             std::to_string(node_id_) + " is at " + std::to_string(elapsed_time_s) +
+                             " s. The nodes must use the same initialize files.");
+  }
+  if (node_id == node_id_) return;
+
+  const size_t number_of_states = reader.ReadSize();
+  for (size_t i = 0; i < number_of_states; i++) {
+    uint64_t spacecraft_id;
+    RemoteSpacecraftState state;
+    reader.Read(spacecraft_id);
+    reader.Read(state);
+    if (relative_information_ != nullptr) relative_information_->SetRemoteSpacecraftState((size_t)spacecraft_id, state);
+  }
+
+  const size_t number_of_packets = reader.ReadSize();
+  for (size_t i = 0; i < number_of_packets; i++) {
+    InterSpacecraftPacket packet;
+    uint64_t spacecraft_id;
+    reader.Read(spacecraft_id);
+    packet.source_spacecraft_id = (size_t)spacecraft_id;
+    reader.Read(spacecraft_id);
+    packet.destination_spacecraft_id = (size_t)spacecraft_id;
+    reader.Read(packet.send_time_s);
+    reader.Read(packet.delivery_time_s);
+    reader.Read(packet.data);
+    if (inter_spacecraft_communication_ != nullptr && IsLocalSpacecraft(packet.destination_spacecraft_id)) {
+      inter_spacecraft_communication_->DeliverPacket(packet);
+    }
+  }
+}
+
+void DistributedSimulationNode::SendFrame(const int socket_descriptor, const std::string& data) {
+#ifdef WIN32
+  (void)socket_descriptor;
+  (void)data;
+#else
+  const uint64_t length = data.size();
+  std::string frame(reinterpret_cast<const char*>(&length), sizeof(length));
+  frame += data;
+  size_t sent_bytes = 0;
+  while (sent_bytes < frame.size()) {
+    const ssize_t ret = send(socket_descriptor, frame.data() + sent_bytes, frame.size() - sent_bytes, MSG_NOSIGNAL);
+    if (ret < 0 && errno == EINTR) continue;
+    if (ret <= 0) throw std::runtime_error("Connection of the distributed simulation is lost while sending.");
+    sent_bytes += (size_t)ret;
+  }
+#endif
+}
+
+std::string DistributedSimulationNode::ReceiveFrame(const int socket_descriptor) {
+#ifdef WIN32
+  (void)socket_descriptor;
+  return "";
+#else
+  auto receive = [socket_descriptor](char* buffer, const size_t size) {
+    size_t received_bytes = 0;
+    while (received_bytes < size) {
+      const ssize_t ret = recv(socket_descriptor, buffer + received_bytes, size - received_bytes, 0);
+      if (ret < 0 && errno == EINTR) continue;
+      if (ret <= 0) throw std::runtime_error("Connection of the distributed simulation is lost while receiving.");
+      received_bytes += (size_t)ret;
+    }
+  };
+  uint64_t length;
+  receive(reinterpret_cast<char*>(&length), sizeof(length));
+  std::string data(length, '\0');
+  if (length > 0) receive(&data[0], length);
+  return data;
+#endif
+}
@@ -0,0 +1,152 @@
+/**
+ * @file distributed_simulation_node.hpp
+ * @brief Class to split the spacecraft of a simulation case across processes and synchronize them
+ */
+
+#ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_DISTRIBUTED_SIMULATION_NODE_HPP_
+#define S2E_SIMULATION_MULTIPLE_SPACECRAFT_DISTRIBUTED_SIMULATION_NODE_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "inter_spacecraft_communication.hpp"
+#include "relative_information.hpp"
+
+class Dynamics;
+
+/**
+ * @class DistributedSimulationNode
+ * @brief Class to split the spacecraft of a simulation case across processes and synchronize them
+ * @details All processes (nodes) run the same simulation case with the same initialize files. Each node has its own replica of
+ *          GlobalEnvironment and simulates the spacecraft whose ID modulo the number of nodes is its node ID.
+ *          The nodes advance independently for the synchronization period (lookahead) and exchange the states of their spacecraft and the
+ *          inter-spacecraft packets at the synchronization points. Node 0 is the coordinator: it waits for the messages of all workers and
+ *          broadcasts the gathered messages, so no node goes beyond a synchronization point before all nodes reach it (conservative
+ *          synchronization). The remote states are therefore delayed by less than the synchronization period.
+ * @note The messages are written in the native byte order and sizes, so the nodes must run the same build on the same kind of machine.
+ *       Throws std::runtime_error when the connection fails or the nodes are out of synchronization.
+ */
+class DistributedSimulationNode {
+ public:
+  /**
+   * @fn DistributedSimulationNode
+   * @brief Constructor
+   * @param [in] node_id: ID of this node. 0 is the coordinator.
+   * @param [in] number_of_nodes: Number of nodes
+   * @param [in] coordinator_address: IPv4 address of the coordinator
+   * @param [in] coordinator_port: TCP port number of the coordinator
+   * @param [in] sync_period_s: Period of the synchronization (lookahead) [s]
+   */
+  DistributedSimulationNode(const unsigned int node_id, const unsigned int number_of_nodes, const std::string& coordinator_address,
+                            const unsigned short coordinator_port, const double sync_period_s);
+  /**
+   * @fn ~DistributedSimulationNode
+   * @brief Destructor. The connections are closed.
+   */
+  ~DistributedSimulationNode();
+
+  /**
+   * @fn Connect
+   * @brief Connect all nodes. It blocks until all workers are connected to the coordinator.
+   * @param [in] timeout_s: Time to wait for the other nodes [s]
+   */
+  void Connect(const double timeout_s = 60.0);
+
+  /**
+   * @fn IsLocalSpacecraft
+   * @brief Return true when the spacecraft is simulated in this node
+   * @param [in] spacecraft_id: ID of the spacecraft
+   */
+  inline bool IsLocalSpacecraft(const size_t spacecraft_id) const { return spacecraft_id % number_of_nodes_ == node_id_; }
+  /**
+   * @fn RegisterLocalSpacecraft
+   * @brief Register the dynamics of the spacecraft simulated in this node to send its state
+   * @param [in] spacecraft_id: ID of the spacecraft
+   * @param [in] dynamics: Dynamics of the spacecraft
+   */
+  void RegisterLocalSpacecraft(const size_t spacecraft_id, const Dynamics* dynamics);
+  /**
+   * @fn SetRelativeInformation
+   * @brief Set the relative information to receive the states of the remote spacecraft. The remote spacecraft are registered to it.
+   * @param [in] relative_information: Relative information
+   * @param [in] number_of_spacecraft: Number of spacecraft in all nodes
+   */
+  void SetRelativeInformation(RelativeInformation* relative_information, const size_t number_of_spacecraft);
+  /**
+   * @fn SetInterSpacecraftCommunication
+   * @brief Set the inter-spacecraft communication to exchange the packets with the other nodes
+   * @param [in] inter_spacecraft_communication: Inter-spacecraft communication
+   */
+  void SetInterSpacecraftCommunication(InterSpacecraftCommunication* inter_spacecraft_communication);
+
+  /**
+   * @fn Synchronize
+   * @brief Exchange the states and the packets with the other nodes when the elapsed time reaches the next synchronization point
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   * @return True when the synchronization is done
+   */
+  bool Synchronize(const double elapsed_time_s);
+  /**
+   * @fn PrintStatistics
+   * @brief Print the number of synchronizations and the time to wait for the other nodes
+   */
+  void PrintStatistics() const;
+
+  // Getters
+  /**
+   * @fn GetNodeId
+   * @brief Return ID of this node
+   */
+  inline unsigned int GetNodeId() const { return node_id_; }
+  /**
+   * @fn GetNumberOfNodes
+   * @brief Return number of nodes
+   */
+  inline unsigned int GetNumberOfNodes() const { return number_of_nodes_; }
+  /**
+   * @fn GetSyncPeriod_s
+   * @brief Return period of the synchronization [s]
+   */
+  inline double GetSyncPeriod_s() const { return sync_period_s_; }
+
+ private:
+  const unsigned int node_id_;             //!< ID of this node
+  const unsigned int number_of_nodes_;     //!< Number of nodes
+  const std::string coordinator_address_;  //!< IPv4 address of the coordinator
+  const unsigned short coordinator_port_;  //!< TCP port number of the coordinator
+  const double sync_period_s_;             //!< Period of the synchronization [s]
+
+  std::vector<int> socket_descriptors_;  //!< Sockets to the workers (coordinator) or to the coordinator (worker)
+  double next_sync_time_s_;              //!< Elapsed time of the next synchronization [s]
+
+  std::map<size_t, const Dynamics*> local_dynamics_;                        //!< Dynamics of the spacecraft in this node
+  RelativeInformation* relative_information_ = nullptr;                     //!< Relative information to store the remote states
+  InterSpacecraftCommunication* inter_spacecraft_communication_ = nullptr;  //!< Inter-spacecraft communication
+
+  unsigned long long number_of_synchronizations_ = 0;  //!< Number of the synchronizations
+  double total_wait_time_s_ = 0.0;                     //!< Total real time spent in the synchronizations [s]
+
+  /**
+   * @fn MakeMessage
+   * @brief Make the message of this node with the states of the local spacecraft and the remote packets
+   */
+  std::string MakeMessage(const double elapsed_time_s);
+  /**
+   * @fn ApplyMessage
+   * @brief Store the states of the remote spacecraft and deliver the packets to the local spacecraft in the message
+   */
+  void ApplyMessage(const std::string& message, const double elapsed_time_s);
+  /**
+   * @fn SendFrame
+   * @brief Send the data with its length
+   */
+  void SendFrame(const int socket_descriptor, const std::string& data);
+  /**
+   * @fn ReceiveFrame
+   * @brief Receive the data sent by SendFrame
+   */
+  std::string ReceiveFrame(const int socket_descriptor);
+};
+
+#endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_DISTRIBUTED_SIMULATION_NODE_HPP_
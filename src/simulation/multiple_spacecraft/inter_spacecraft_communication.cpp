@@ -5,10 +5,177 @@
 
 #include "inter_spacecraft_communication.hpp"
 
-#include <utilities/macros.hpp>
+#include <algorithm>
+#include <cstring>
+#include <environment/global/physical_constants.hpp>
+#include <setting_file_reader/initialize_file_access.hpp>
+
+#include "distributed_simulation_node.hpp"
+#include "relative_information.hpp"
 
 InterSpacecraftCommunication::InterSpacecraftCommunication(const SimulationConfiguration* simulation_configuration) {
-  UNUSED(simulation_configuration);
+  IniAccess ini_file(simulation_configuration->inter_sc_communication_file_);
+  const char* section = "INTER_SATELLITE_COMMUNICATION";
+  is_light_time_delay_enabled_ = ini_file.ReadEnable(section, "light_time_delay");
+  additional_latency_s_ = ini_file.ReadDouble(section, "additional_latency_s");
+  max_link_range_m_ = ini_file.ReadDouble(section, "max_link_range_m");
+  const int slot_size_byte = ini_file.ReadInt(section, "packet_pool_slot_size_byte");
+  const int number_of_slots = ini_file.ReadInt(section, "packet_pool_number_of_slots");
+  // Default pool when the file or the keys are not given
+  slot_size_byte_ = slot_size_byte > 0 ? (size_t)slot_size_byte : 1024;
+  const size_t slot_count = number_of_slots > 0 ? (size_t)number_of_slots : 4096;
+
+  slots_.resize(slot_count);
+  slot_data_.resize(slot_count * slot_size_byte_);
+  for (size_t slot = 0; slot < slot_count; slot++) {
+    slots_[slot].next = (slot + 1 < slot_count) ? slot + 1 : kNoSlot;
+  }
+  free_slot_ = 0;
 }
 
 InterSpacecraftCommunication::~InterSpacecraftCommunication() {}
+
+void InterSpacecraftCommunication::SetLinkAvailability(const size_t source_spacecraft_id, const size_t destination_spacecraft_id,
+                                                       const bool is_available) {
+  links_[std::make_pair(source_spacecraft_id, destination_spacecraft_id)].is_available = is_available;
+}
+
+bool InterSpacecraftCommunication::SendPacket(const InterSpacecraftPacket& packet) {
+  Link& link = links_[std::make_pair(packet.source_spacecraft_id, packet.destination_spacecraft_id)];
+  if (!link.is_available) {
+    number_of_dropped_packets_++;
+    return false;
+  }
+
+  double delay_s = additional_latency_s_;
+  if (relative_information_ != nullptr && (is_light_time_delay_enabled_ || max_link_range_m_ > 0.0)) {
+    const double distance_m = relative_information_->GetRelativeDistance_m(packet.destination_spacecraft_id, packet.source_spacecraft_id);
+    if (max_link_range_m_ > 0.0 && distance_m > max_link_range_m_) {
+      number_of_dropped_packets_++;
+      return false;
+    }
+    if (is_light_time_delay_enabled_) delay_s += distance_m / environment::speed_of_light_m_s;
+  }
+
+  if (distributed_simulation_node_ != nullptr && !distributed_simulation_node_->IsLocalSpacecraft(packet.destination_spacecraft_id)) {
+    remote_packets_.push_back(packet);
+    remote_packets_.back().delivery_time_s = packet.send_time_s + delay_s;
+    return true;
+  }
+
+  const double delivery_time_s = packet.send_time_s + delay_s;
+  if (delay_s <= 0.0) return EnqueuePacket(packet, delivery_time_s, received_packets_[packet.destination_spacecraft_id]);
+  if (!EnqueuePacket(packet, delivery_time_s, link.queue)) return false;
+  number_of_queued_packets_++;
+  return true;
+}
+
+void InterSpacecraftCommunication::Update(const double current_time_s) {
+  current_time_s_ = current_time_s;
+  if (number_of_queued_packets_ == 0) return;
+
+  for (auto& link : links_) {
+    PacketQueue& queue = link.second.queue;
+    if (queue.head == kNoSlot) continue;
+    PacketQueue& received_packets = received_packets_[link.first.second];
+    while (queue.head != kNoSlot && slots_[queue.head].delivery_time_s <= current_time_s) {
+      MoveHead(queue, received_packets);
+      number_of_queued_packets_--;
+    }
+  }
+}
+
+std::vector<InterSpacecraftPacket> InterSpacecraftCommunication::ReceivePackets(const size_t destination_spacecraft_id) {
+  std::vector<InterSpacecraftPacket> packets;
+  ReceivePackets(destination_spacecraft_id, packets);
+  return packets;
+}
+
+size_t InterSpacecraftCommunication::ReceivePackets(const size_t destination_spacecraft_id, std::vector<InterSpacecraftPacket>& packets) {
+  size_t number_of_packets = 0;
+  auto received_packets = received_packets_.find(destination_spacecraft_id);
+  if (received_packets != received_packets_.end()) {
+    PacketQueue& queue = received_packets->second;
+    while (queue.head != kNoSlot) {
+      const size_t slot = queue.head;
+      const QueuedPacket& header = slots_[slot];
+      if (packets.size() <= number_of_packets) packets.emplace_back();
+      InterSpacecraftPacket& packet = packets[number_of_packets];
+      packet.source_spacecraft_id = header.source_spacecraft_id;
+      packet.destination_spacecraft_id = header.destination_spacecraft_id;
+      packet.send_time_s = header.send_time_s;
+      packet.delivery_time_s = header.delivery_time_s;
+      const unsigned char* data = &slot_data_[slot * slot_size_byte_];
+      packet.data.assign(data, data + header.data_size);
+      number_of_packets++;
+
+      // Return the slot to the free list
+      queue.head = header.next;
+      slots_[slot].next = free_slot_;
+      free_slot_ = slot;
+    }
+    queue.tail = kNoSlot;
+  }
+  packets.resize(number_of_packets);
+
+  // The packets from the different links are merged in the order of the delivery time
+  std::stable_sort(packets.begin(), packets.end(), [](const InterSpacecraftPacket& lhs, const InterSpacecraftPacket& rhs) {
+    return lhs.delivery_time_s < rhs.delivery_time_s;
+  });
+  return number_of_packets;
+}
+
+void InterSpacecraftCommunication::DeliverPacket(const InterSpacecraftPacket& packet) {
+  if (packet.delivery_time_s <= current_time_s_) {
+    EnqueuePacket(packet, packet.delivery_time_s, received_packets_[packet.destination_spacecraft_id]);
+    return;
+  }
+  Link& link = links_[std::make_pair(packet.source_spacecraft_id, packet.destination_spacecraft_id)];
+  if (EnqueuePacket(packet, packet.delivery_time_s, link.queue)) number_of_queued_packets_++;
+}
+
+std::vector<InterSpacecraftPacket> InterSpacecraftCommunication::TakeRemotePackets() {
+  std::vector<InterSpacecraftPacket> packets;
+  packets.swap(remote_packets_);
+  return packets;
+}
+
+bool InterSpacecraftCommunication::EnqueuePacket(const InterSpacecraftPacket& packet, const double delivery_time_s, PacketQueue& queue) {
+  if (free_slot_ == kNoSlot || packet.data.size() > slot_size_byte_) {
+    number_of_dropped_packets_++;
+    return false;
+  }
+  const size_t slot = free_slot_;
+  QueuedPacket& header = slots_[slot];
+  free_slot_ = header.next;
+
+  header.source_spacecraft_id = packet.source_spacecraft_id;
+  header.destination_spacecraft_id = packet.destination_spacecraft_id;
+  header.send_time_s = packet.send_time_s;
+  header.delivery_time_s = delivery_time_s;
+  header.data_size = packet.data.size();
+  header.next = kNoSlot;
+  if (!packet.data.empty()) memcpy(&slot_data_[slot * slot_size_byte_], packet.data.data(), packet.data.size());
+
+  if (queue.tail == kNoSlot) {
+    queue.head = slot;
+  } else {
+    slots_[queue.tail].next = slot;
+  }
+  queue.tail = slot;
+  return true;
+}
+
+void InterSpacecraftCommunication::MoveHead(PacketQueue& source, PacketQueue& destination) {
+  const size_t slot = source.head;
+  source.head = slots_[slot].next;
+  if (source.head == kNoSlot) source.tail = kNoSlot;
+
+  slots_[slot].next = kNoSlot;
+  if (destination.tail == kNoSlot) {
+    destination.head = slot;
+  } else {
+    slots_[destination.tail].next = slot;
+  }
+  destination.tail = slot;
+}
@@ -6,17 +6,44 @@
 #ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_INTER_SPACECRAFT_COMMUNICATION_HPP_
 #define S2E_SIMULATION_MULTIPLE_SPACECRAFT_INTER_SPACECRAFT_COMMUNICATION_HPP_
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "../simulation_configuration.hpp"
 
+class DistributedSimulationNode;
+class RelativeInformation;
+
+/**
+ * @struct InterSpacecraftPacket
+ * @brief Packet sent from a spacecraft to another spacecraft
+ */
+struct InterSpacecraftPacket {
+  size_t source_spacecraft_id = 0;       //!< ID of the source spacecraft
+  size_t destination_spacecraft_id = 0;  //!< ID of the destination spacecraft
+  double send_time_s = 0.0;              //!< Elapsed time when the packet is sent [s]
+  double delivery_time_s = 0.0;          //!< Elapsed time when the packet is delivered [s] (Set by SendPacket)
+  std::vector<unsigned char> data;       //!< Data
+};
+
 /**
  * @class InterSpacecraftCommunication
  * @brief Base class of inter satellite communication
+ * @details The packets are delayed by the light time between the spacecraft and the additional latency, and they are dropped when the link
+ *          is not available. The delayed packets wait in the timestamped queue of each link (source and destination pair) and are moved
+ *          to the destination in batches by Update. The packets without delay are delivered immediately.
+ *          The data of the waiting packets is stored in a pool of fixed size slots allocated at the construction, so no memory is
+ *          allocated for each packet. In the distributed simulation, the packets to the spacecraft in the other processes are exchanged by
+ *          DistributedSimulationNode and queued in the destination process.
+ * @note The delay is fixed at the sending time, and the packets on a link are delivered in the sending order.
  */
 class InterSpacecraftCommunication {
  public:
   /**
    * @fn InterSpacecraftCommunication
    * @brief Constructor
+   * @param [in] simulation_configuration: Simulation configuration. The parameters are read from inter_sc_communication_file_.
    */
   InterSpacecraftCommunication(const SimulationConfiguration* simulation_configuration);
   /**
@@ -25,7 +52,151 @@ class InterSpacecraftCommunication {
    */
   ~InterSpacecraftCommunication();
 
+  /**
+   * @fn SetDistributedSimulationNode
+   * @brief Set the node of the distributed simulation to send the packets to the remote spacecraft
+   * @param [in] distributed_simulation_node: Node of the distributed simulation. nullptr delivers all packets in this process.
+   */
+  inline void SetDistributedSimulationNode(const DistributedSimulationNode* distributed_simulation_node) {
+    distributed_simulation_node_ = distributed_simulation_node;
+  }
+  /**
+   * @fn SetRelativeInformation
+   * @brief Set the relative information to calculate the light time delay and the link range
+   * @param [in] relative_information: Relative information. nullptr disables the light time delay and the range limit.
+   */
+  inline void SetRelativeInformation(const RelativeInformation* relative_information) { relative_information_ = relative_information; }
+  /**
+   * @fn SetLinkAvailability
+   * @brief Enable or disable the link from the source spacecraft to the destination spacecraft. All links are available by default.
+   * @param [in] source_spacecraft_id: ID of the source spacecraft
+   * @param [in] destination_spacecraft_id: ID of the destination spacecraft
+   * @param [in] is_available: Availability of the link
+   */
+  void SetLinkAvailability(const size_t source_spacecraft_id, const size_t destination_spacecraft_id, const bool is_available);
+
+  /**
+   * @fn SendPacket
+   * @brief Send the packet to the destination spacecraft
+   * @note The packet is dropped when the link is not available, the link range is exceeded, or the packet pool is full.
+   * @param [in] packet: Packet. The delivery time is calculated in this function.
+   * @return True when the packet is sent
+   */
+  bool SendPacket(const InterSpacecraftPacket& packet);
+  /**
+   * @fn Update
+   * @brief Deliver the queued packets whose delivery time has come
+   * @param [in] current_time_s: Current elapsed time [s]
+   */
+  void Update(const double current_time_s);
+  /**
+   * @fn ReceivePackets
+   * @brief Take the packets delivered to the spacecraft in the order of the delivery time
+   * @param [in] destination_spacecraft_id: ID of the destination spacecraft
+   */
+  std::vector<InterSpacecraftPacket> ReceivePackets(const size_t destination_spacecraft_id);
+  /**
+   * @fn ReceivePackets
+   * @brief Take the packets delivered to the spacecraft in the order of the delivery time into the buffer
+   * @note The buffer and the data of its packets are reused, so no memory is allocated when the buffer is kept by the caller.
+   * @param [in] destination_spacecraft_id: ID of the destination spacecraft
+   * @param [out] packets: Buffer of the packets
+   * @return Number of the packets
+   */
+  size_t ReceivePackets(const size_t destination_spacecraft_id, std::vector<InterSpacecraftPacket>& packets);
+
+  /**
+   * @fn DeliverPacket
+   * @brief Deliver the packet received from another process (used by DistributedSimulationNode)
+   * @param [in] packet: Packet with the delivery time
+   */
+  void DeliverPacket(const InterSpacecraftPacket& packet);
+  /**
+   * @fn TakeRemotePackets
+   * @brief Take the packets to the spacecraft in the other processes (used by DistributedSimulationNode)
+   */
+  std::vector<InterSpacecraftPacket> TakeRemotePackets();
+
+  // Getters
+  /**
+   * @fn GetNumberOfQueuedPackets
+   * @brief Return number of the packets waiting in the link queues
+   */
+  inline size_t GetNumberOfQueuedPackets() const { return number_of_queued_packets_; }
+  /**
+   * @fn GetNumberOfDroppedPackets
+   * @brief Return number of the dropped packets
+   */
+  inline size_t GetNumberOfDroppedPackets() const { return number_of_dropped_packets_; }
+
  private:
+  static const size_t kNoSlot = (size_t)-1;  //!< Index of no slot
+
+  /**
+   * @struct QueuedPacket
+   * @brief Header of a packet stored in the packet pool
+   */
+  struct QueuedPacket {
+    size_t source_spacecraft_id = 0;       //!< ID of the source spacecraft
+    size_t destination_spacecraft_id = 0;  //!< ID of the destination spacecraft
+    double send_time_s = 0.0;              //!< Elapsed time when the packet is sent [s]
+    double delivery_time_s = 0.0;          //!< Elapsed time when the packet is delivered [s]
+    size_t data_size = 0;                  //!< Size of the data [byte]
+    size_t next = kNoSlot;                 //!< Next slot in the queue or the free list
+  };
+  /**
+   * @struct PacketQueue
+   * @brief FIFO queue of the slots in the packet pool
+   */
+  struct PacketQueue {
+    size_t head = kNoSlot;  //!< First slot
+    size_t tail = kNoSlot;  //!< Last slot
+  };
+  /**
+   * @struct Link
+   * @brief Link from a spacecraft to another spacecraft
+   */
+  struct Link {
+    bool is_available = true;  //!< Availability of the link
+    PacketQueue queue;         //!< Packets waiting for the delivery time
+  };
+
+  const DistributedSimulationNode* distributed_simulation_node_ = nullptr;  //!< Node of the distributed simulation
+  const RelativeInformation* relative_information_ = nullptr;               //!< Relative information for the delay and the range
+  std::vector<InterSpacecraftPacket> remote_packets_;                       //!< Packets waiting for the next synchronization point
+
+  // Parameters
+  bool is_light_time_delay_enabled_ = false;  //!< Enable the light time delay
+  double additional_latency_s_ = 0.0;         //!< Latency added to all packets [s]
+  double max_link_range_m_ = 0.0;             //!< Maximum range of the links. Zero or negative means unlimited. [m]
+
+  // Packet pool
+  size_t slot_size_byte_;                 //!< Size of the data in a slot [byte]
+  std::vector<QueuedPacket> slots_;       //!< Headers of the slots
+  std::vector<unsigned char> slot_data_;  //!< Data of the slots
+  size_t free_slot_ = kNoSlot;            //!< First slot of the free list
+
+  std::map<std::pair<size_t, size_t>, Link> links_;  //!< Links indexed by the source and destination spacecraft ID
+  std::map<size_t, PacketQueue> received_packets_;   //!< Delivered packets for each destination spacecraft
+  double current_time_s_ = 0.0;                      //!< Elapsed time of the latest update [s]
+
+  size_t number_of_queued_packets_ = 0;   //!< Number of the packets in the link queues
+  size_t number_of_dropped_packets_ = 0;  //!< Number of the dropped packets
+
+  /**
+   * @fn EnqueuePacket
+   * @brief Store the packet in the pool and append it to the queue
+   * @param [in] packet: Packet
+   * @param [in] delivery_time_s: Elapsed time when the packet is delivered [s]
+   * @param [out] queue: Queue
+   * @return True when the packet is stored
+   */
+  bool EnqueuePacket(const InterSpacecraftPacket& packet, const double delivery_time_s, PacketQueue& queue);
+  /**
+   * @fn MoveHead
+   * @brief Move the first slot of the source queue to the end of the destination queue
+   */
+  void MoveHead(PacketQueue& source, PacketQueue& destination);
 };
 
 #endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_INTER_SPACECRAFT_COMMUNICATION_HPP_
@@ -0,0 +1,16 @@
+/**
+ * @file parallel_spacecraft_updater.cpp
+ * @brief Class to update multiple spacecraft concurrently
+ */
+
+#include "parallel_spacecraft_updater.hpp"
+
+#include "../spacecraft/spacecraft.hpp"
+
+ParallelSpacecraftUpdater::ParallelSpacecraftUpdater(const unsigned int number_of_threads) : thread_pool_(number_of_threads) {}
+
+ParallelSpacecraftUpdater::~ParallelSpacecraftUpdater() {}
+
+void ParallelSpacecraftUpdater::Update(const std::vector<Spacecraft*>& spacecraft_list, const SimulationTime* simulation_time) {
+  thread_pool_.ParallelFor(spacecraft_list.size(), [&](const size_t index) { spacecraft_list[index]->Update(simulation_time); });
+}
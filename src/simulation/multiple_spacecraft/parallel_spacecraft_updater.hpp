@@ -0,0 +1,57 @@
+/**
+ * @file parallel_spacecraft_updater.hpp
+ * @brief Class to update multiple spacecraft concurrently
+ */
+
+#ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_PARALLEL_SPACECRAFT_UPDATER_HPP_
+#define S2E_SIMULATION_MULTIPLE_SPACECRAFT_PARALLEL_SPACECRAFT_UPDATER_HPP_
+
+#include <utilities/thread_pool.hpp>
+#include <vector>
+
+class Spacecraft;
+class SimulationTime;
+
+/**
+ * @class ParallelSpacecraftUpdater
+ * @brief Class to update multiple spacecraft concurrently with a persistent thread pool
+ * @details The calling thread and the worker threads of ThreadPool take the next spacecraft from a shared index until all spacecraft are
+ *          updated, so the threads which finish earlier take more spacecraft. Update returns after all spacecraft are updated (barrier), so
+ *          RelativeInformation and InterSpacecraftCommunication can be updated after that.
+ * @note Spacecraft::Update must be independent of the other spacecraft. Do not use this class when a spacecraft reads the state of the
+ *       other spacecraft in its update (e.g., RELATIVE orbit propagation mode or inter-spacecraft communication between components).
+ */
+class ParallelSpacecraftUpdater {
+ public:
+  /**
+   * @fn ParallelSpacecraftUpdater
+   * @brief Constructor
+   * @param [in] number_of_threads: Number of threads including the calling thread. The spacecraft are updated serially when it is 1.
+   */
+  ParallelSpacecraftUpdater(const unsigned int number_of_threads);
+  /**
+   * @fn ~ParallelSpacecraftUpdater
+   * @brief Destructor
+   */
+  ~ParallelSpacecraftUpdater();
+
+  /**
+   * @fn Update
+   * @brief Update all spacecraft and wait for the completion
+   * @note An exception thrown in the update of a spacecraft is rethrown in the calling thread.
+   * @param [in] spacecraft_list: Spacecraft to be updated
+   * @param [in] simulation_time: Simulation time
+   */
+  void Update(const std::vector<Spacecraft*>& spacecraft_list, const SimulationTime* simulation_time);
+
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of threads including the calling thread
+   */
+  inline unsigned int GetNumberOfThreads() const { return thread_pool_.GetNumberOfThreads(); }
+
+ private:
+  ThreadPool thread_pool_;  //!< Thread pool to update the spacecraft
+};
+
+#endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_PARALLEL_SPACECRAFT_UPDATER_HPP_
@@ -5,72 +5,114 @@
 
 #include "relative_information.hpp"
 
+#include <algorithm>
+
 RelativeInformation::RelativeInformation() {}
 
 RelativeInformation::~RelativeInformation() {}
 
 void RelativeInformation::Update() {
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < dynamics_database_.size(); reference_spacecraft_id++) {
-      // Position
-      libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id] = target_sat_pos_i - reference_sat_pos_i;
-      relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id);
-
-      // Distance
-      relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id] =
-          relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id].CalcNorm();
-
-      // Velocity
-      libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id] = target_sat_vel_i - reference_sat_vel_i;
-      relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id);
-
-      // Attitude Quaternion
-      relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeAttitudeQuaternion(target_spacecraft_id, reference_spacecraft_id);
+  // The values of each spacecraft are shared by all pairs
+  for (size_t spacecraft_id = 0; spacecraft_id < GetNumberOfSpacecraft(); spacecraft_id++) {
+    const auto remote_state = remote_state_database_.find(spacecraft_id);
+    if (remote_state != remote_state_database_.end()) {
+      // The spacecraft simulated in another process
+      position_list_i_m_[spacecraft_id] = remote_state->second.position_i_m;
+      velocity_list_i_m_s_[spacecraft_id] = remote_state->second.velocity_i_m_s;
+      quaternion_i2b_list_[spacecraft_id] = remote_state->second.quaternion_i2b;
+      quaternion_i2rtn_list_[spacecraft_id] = remote_state->second.quaternion_i2rtn;
+    } else {
+      const Orbit& orbit = dynamics_database_.at(spacecraft_id)->GetOrbit();
+      position_list_i_m_[spacecraft_id] = orbit.GetPosition_i_m();
+      velocity_list_i_m_s_[spacecraft_id] = orbit.GetVelocity_i_m_s();
+      quaternion_i2b_list_[spacecraft_id] = dynamics_database_.at(spacecraft_id)->GetAttitude().GetQuaternion_i2b();
+      quaternion_i2rtn_list_[spacecraft_id] = orbit.CalcQuaternion_i2lvlh();
+    }
+    // Rotation vector of RTN frame
+    const double r2 = position_list_i_m_[spacecraft_id].CalcNorm() * position_list_i_m_[spacecraft_id].CalcNorm();
+    rtn_rotation_vector_list_i_rad_s_[spacecraft_id] = (1.0 / r2) * cross(position_list_i_m_[spacecraft_id], velocity_list_i_m_s_[spacecraft_id]);
+  }
+  spatial_index_.Build(position_list_i_m_);
+
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      UpdatePair(target_spacecraft_id, reference_spacecraft_id);
     }
   }
 }
 
+std::vector<size_t> RelativeInformation::FindSpacecraftInRange(const size_t spacecraft_id, const double range_m) const {
+  std::vector<size_t> spacecraft_ids = spatial_index_.FindInRange(position_list_i_m_[spacecraft_id], range_m);
+  spacecraft_ids.erase(std::remove(spacecraft_ids.begin(), spacecraft_ids.end(), spacecraft_id), spacecraft_ids.end());
+  return spacecraft_ids;
+}
+
+std::vector<size_t> RelativeInformation::FindVisibleSpacecraft(const size_t spacecraft_id, const double range_m,
+                                                               const double blocking_radius_m) const {
+  std::vector<size_t> spacecraft_ids = FindSpacecraftInRange(spacecraft_id, range_m);
+  const libra::Vector<3>& observer_position_i_m = position_list_i_m_[spacecraft_id];
+  auto is_blocked = [&](const size_t target_spacecraft_id) {
+    // Closest point of the line segment between the spacecraft to the origin
+    const libra::Vector<3> line_of_sight_i_m = position_list_i_m_[target_spacecraft_id] - observer_position_i_m;
+    const double length2 = InnerProduct(line_of_sight_i_m, line_of_sight_i_m);
+    if (length2 == 0.0) return false;
+    double ratio = -1.0 * InnerProduct(observer_position_i_m, line_of_sight_i_m) / length2;
+    ratio = std::max(0.0, std::min(1.0, ratio));
+    const libra::Vector<3> closest_point_i_m = observer_position_i_m + ratio * line_of_sight_i_m;
+    return closest_point_i_m.CalcNorm() < blocking_radius_m;
+  };
+  spacecraft_ids.erase(std::remove_if(spacecraft_ids.begin(), spacecraft_ids.end(), is_blocked), spacecraft_ids.end());
+  return spacecraft_ids;
+}
+
+bool RelativeInformation::FindNearestSpacecraft(const size_t spacecraft_id, size_t& nearest_spacecraft_id) const {
+  return spatial_index_.FindNearest(position_list_i_m_[spacecraft_id], nearest_spacecraft_id, spacecraft_id);
+}
+
 void RelativeInformation::RegisterDynamicsInfo(const size_t spacecraft_id, const Dynamics* dynamics) {
   dynamics_database_.emplace(spacecraft_id, dynamics);
   ResizeLists();
 }
 
+void RelativeInformation::RegisterRemoteSpacecraft(const size_t spacecraft_id) {
+  remote_state_database_.emplace(spacecraft_id, RemoteSpacecraftState());
+  ResizeLists();
+}
+
+void RelativeInformation::SetRemoteSpacecraftState(const size_t spacecraft_id, const RemoteSpacecraftState& state) {
+  remote_state_database_.at(spacecraft_id) = state;
+}
+
 void RelativeInformation::RemoveDynamicsInfo(const size_t spacecraft_id) {
   dynamics_database_.erase(spacecraft_id);
+  remote_state_database_.erase(spacecraft_id);
   ResizeLists();
 }
 
 std::string RelativeInformation::GetLogHeader() const {
   std::string str_tmp = "";
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(
           "satellite" + std::to_string(target_spacecraft_id) + "_position_from_satellite" + std::to_string(reference_spacecraft_id), "i", "m", 3);
     }
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(
           "satellite" + std::to_string(target_spacecraft_id) + "_velocity_from_satellite" + std::to_string(reference_spacecraft_id), "i", "m/s", 3);
     }
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(
           "satellite" + std::to_string(target_spacecraft_id) + "_position_from_satellite" + std::to_string(reference_spacecraft_id), "rtn", "m", 3);
     }
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(
           "satellite" + std::to_string(target_spacecraft_id) + "_velocity_from_satellite" + std::to_string(reference_spacecraft_id), "rtn", "m/s", 3);
@@ -82,25 +124,25 @@ std::string RelativeInformation::GetLogHeader() const {
 
 std::string RelativeInformation::GetLogValue() const {
   std::string str_tmp = "";
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id));
     }
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(GetRelativeVelocity_i_m_s(target_spacecraft_id, reference_spacecraft_id));
     }
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(GetRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id));
     }
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < GetNumberOfSpacecraft(); target_spacecraft_id++) {
     for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
       str_tmp += WriteVector(GetRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id));
     }
@@ -111,51 +153,60 @@ std::string RelativeInformation::GetLogValue() const {
 
 void RelativeInformation::LogSetup(Logger& logger) { logger.AddLogList(this); }
 
+void RelativeInformation::UpdatePair(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
+  const size_t t = target_spacecraft_id;
+  const size_t r = reference_spacecraft_id;
+
+  // The values in the inertial frame are antisymmetric, so they are calculated once for each pair
+  // Position
+  relative_position_list_i_m_[t][r] = position_list_i_m_[t] - position_list_i_m_[r];
+  relative_position_list_i_m_[r][t] = -1.0 * relative_position_list_i_m_[t][r];
+  // Distance
+  relative_distance_list_m_[t][r] = relative_position_list_i_m_[t][r].CalcNorm();
+  relative_distance_list_m_[r][t] = relative_distance_list_m_[t][r];
+  // Velocity
+  relative_velocity_list_i_m_s_[t][r] = velocity_list_i_m_s_[t] - velocity_list_i_m_s_[r];
+  relative_velocity_list_i_m_s_[r][t] = -1.0 * relative_velocity_list_i_m_s_[t][r];
+  // Attitude Quaternion
+  relative_attitude_quaternion_list_[t][r] = CalcRelativeAttitudeQuaternion(t, r);
+  relative_attitude_quaternion_list_[r][t] = relative_attitude_quaternion_list_[t][r].Conjugate();
+
+  // The values in the RTN frame depend on the reference spacecraft
+  relative_position_list_rtn_m_[t][r] = CalcRelativePosition_rtn_m(t, r);
+  relative_position_list_rtn_m_[r][t] = CalcRelativePosition_rtn_m(r, t);
+  relative_velocity_list_rtn_m_s_[t][r] = CalcRelativeVelocity_rtn_m_s(t, r);
+  relative_velocity_list_rtn_m_s_[r][t] = CalcRelativeVelocity_rtn_m_s(r, t);
+}
+
 libra::Quaternion RelativeInformation::CalcRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
   // Observer SC Body frame(obs_sat) -> ECI frame(i)
-  libra::Quaternion q_reference_i2b = dynamics_database_.at(reference_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
-  libra::Quaternion q_reference_b2i = q_reference_i2b.Conjugate();
+  libra::Quaternion q_reference_b2i = quaternion_i2b_list_[reference_spacecraft_id].Conjugate();
 
   // ECI frame(i) -> Target SC body frame(main_sat)
-  libra::Quaternion q_target_i2b = dynamics_database_.at(target_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
-
-  return q_target_i2b * q_reference_b2i;
+  return quaternion_i2b_list_[target_spacecraft_id] * q_reference_b2i;
 }
 
 libra::Vector<3> RelativeInformation::CalcRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
-
   // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
-
-  libra::Vector<3> relative_pos_rtn = q_i2rtn.FrameConversion(relative_pos_i);
-  return relative_pos_rtn;
+  return quaternion_i2rtn_list_[reference_spacecraft_id].FrameConversion(relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id]);
 }
 
 libra::Vector<3> RelativeInformation::CalcRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+  const libra::Vector<3>& relative_pos_i = relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id];
+  libra::Vector<3> relative_vel_i = relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id] -
+                                    cross(rtn_rotation_vector_list_i_rad_s_[reference_spacecraft_id], relative_pos_i);
 
   // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
-
-  // Rotation vector of RTN frame
-  libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> rot_vec_rtn_i = cross(reference_sat_pos_i, reference_sat_vel_i);
-  double r2_ref = reference_sat_pos_i.CalcNorm() * reference_sat_pos_i.CalcNorm();
-  rot_vec_rtn_i /= r2_ref;
-  libra::Vector<3> relative_vel_i = target_sat_vel_i - reference_sat_vel_i - cross(rot_vec_rtn_i, relative_pos_i);
-
-  libra::Vector<3> relative_vel_rtn = q_i2rtn.FrameConversion(relative_vel_i);
-  return relative_vel_rtn;
+  return quaternion_i2rtn_list_[reference_spacecraft_id].FrameConversion(relative_vel_i);
 }
 
 void RelativeInformation::ResizeLists() {
-  size_t size = dynamics_database_.size();
+  size_t size = GetNumberOfSpacecraft();
+  position_list_i_m_.assign(size, libra::Vector<3>(0));
+  velocity_list_i_m_s_.assign(size, libra::Vector<3>(0));
+  quaternion_i2b_list_.assign(size, libra::Quaternion(0, 0, 0, 1));
+  quaternion_i2rtn_list_.assign(size, libra::Quaternion(0, 0, 0, 1));
+  rtn_rotation_vector_list_i_rad_s_.assign(size, libra::Vector<3>(0));
   relative_position_list_i_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
   relative_velocity_list_i_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
   relative_distance_list_m_.assign(size, std::vector<double>(size, 0.0));
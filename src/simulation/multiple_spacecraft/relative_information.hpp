@@ -7,10 +7,23 @@
 #define S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 
 #include <string>
+#include <vector>
 
 #include "../../dynamics/dynamics.hpp"
 #include "../../logger/loggable.hpp"
 #include "../../logger/logger.hpp"
+#include "../../math_physics/math/kd_tree.hpp"
+
+/**
+ * @struct RemoteSpacecraftState
+ * @brief State of the spacecraft simulated in another process of the distributed simulation
+ */
+struct RemoteSpacecraftState {
+  libra::Vector<3> position_i_m{0.0};                      //!< Position in the inertial frame [m]
+  libra::Vector<3> velocity_i_m_s{0.0};                    //!< Velocity in the inertial frame [m/s]
+  libra::Quaternion quaternion_i2b{0.0, 0.0, 0.0, 1.0};    //!< Attitude quaternion from the inertial frame to the body frame
+  libra::Quaternion quaternion_i2rtn{0.0, 0.0, 0.0, 1.0};  //!< Quaternion from the inertial frame to the RTN frame
+};
 
 /**
  * @class RelativeInformation
@@ -32,6 +45,7 @@ class RelativeInformation : public ILoggable {
   /**
    * @fn Update
    * @brief Update all relative information
+   * @note Each pair of spacecraft is calculated once, and the values of the reverse direction are derived from it.
    */
   void Update();
   /**
@@ -41,6 +55,20 @@ class RelativeInformation : public ILoggable {
    * @param [in] dynamics: Dynamics information of the target spacecraft
    */
   void RegisterDynamicsInfo(const size_t spacecraft_id, const Dynamics* dynamics);
+  /**
+   * @fn RegisterRemoteSpacecraft
+   * @brief Register the spacecraft simulated in another process. Its state is given by SetRemoteSpacecraftState.
+   * @note GetReferenceSatDynamics is not available for the remote spacecraft.
+   * @param [in] spacecraft_id: ID of the remote spacecraft
+   */
+  void RegisterRemoteSpacecraft(const size_t spacecraft_id);
+  /**
+   * @fn SetRemoteSpacecraftState
+   * @brief Set the state of the remote spacecraft used in the following Update
+   * @param [in] spacecraft_id: ID of the remote spacecraft
+   * @param [in] state: State of the remote spacecraft
+   */
+  void SetRemoteSpacecraftState(const size_t spacecraft_id, const RemoteSpacecraftState& state);
   /**
    * @fn RegisterDynamicsInfo
    * @brief Remove dynamics information of target spacecraft
@@ -131,8 +159,47 @@ class RelativeInformation : public ILoggable {
     return dynamics_database_.at(reference_spacecraft_id);
   };
 
+  /**
+   * @fn GetNumberOfSpacecraft
+   * @brief Return number of the registered spacecraft including the remote spacecraft
+   */
+  inline size_t GetNumberOfSpacecraft() const { return dynamics_database_.size() + remote_state_database_.size(); }
+
+  // Proximity queries with the spatial index rebuilt in Update
+  /**
+   * @fn FindSpacecraftInRange
+   * @brief Find the spacecraft within the range from the spacecraft
+   * @param [in] spacecraft_id: ID of the spacecraft
+   * @param [in] range_m: Range [m]
+   * @return IDs of the spacecraft within the range except for the spacecraft itself (in ascending order)
+   */
+  std::vector<size_t> FindSpacecraftInRange(const size_t spacecraft_id, const double range_m) const;
+  /**
+   * @fn FindVisibleSpacecraft
+   * @brief Find the spacecraft within the range whose line of sight from the spacecraft is not blocked by the center body
+   * @param [in] spacecraft_id: ID of the spacecraft
+   * @param [in] range_m: Range [m]
+   * @param [in] blocking_radius_m: Radius of the sphere at the origin of the inertial frame which blocks the line of sight [m]
+   * @return IDs of the visible spacecraft except for the spacecraft itself (in ascending order)
+   */
+  std::vector<size_t> FindVisibleSpacecraft(const size_t spacecraft_id, const double range_m, const double blocking_radius_m) const;
+  /**
+   * @fn FindNearestSpacecraft
+   * @brief Find the nearest spacecraft from the spacecraft
+   * @param [in] spacecraft_id: ID of the spacecraft
+   * @param [out] nearest_spacecraft_id: ID of the nearest spacecraft
+   * @return False when there is no other spacecraft
+   */
+  bool FindNearestSpacecraft(const size_t spacecraft_id, size_t& nearest_spacecraft_id) const;
+  /**
+   * @fn GetSpatialIndex
+   * @brief Return the spatial index of the spacecraft position in the inertial frame. The point index is the spacecraft ID.
+   */
+  inline const libra::KdTree& GetSpatialIndex() const { return spatial_index_; }
+
  private:
-  std::map<const size_t, const Dynamics*> dynamics_database_;  //!< Dynamics database of all spacecraft
+  std::map<const size_t, const Dynamics*> dynamics_database_;            //!< Dynamics database of the spacecraft in this process
+  std::map<const size_t, RemoteSpacecraftState> remote_state_database_;  //!< States of the spacecraft simulated in the other processes
 
   std::vector<std::vector<libra::Vector<3>>> relative_position_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
   std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
@@ -141,6 +208,23 @@ class RelativeInformation : public ILoggable {
   std::vector<std::vector<double>> relative_distance_list_m_;                      //!< Relative distance list in unit [m]
   std::vector<std::vector<libra::Quaternion>> relative_attitude_quaternion_list_;  //!< Relative attitude quaternion list
 
+  // Values of each spacecraft used by all pairs
+  std::vector<libra::Vector<3>> position_list_i_m_;                 //!< Position in the inertial frame [m]
+  std::vector<libra::Vector<3>> velocity_list_i_m_s_;               //!< Velocity in the inertial frame [m/s]
+  std::vector<libra::Quaternion> quaternion_i2b_list_;              //!< Attitude quaternion from the inertial frame to the body frame
+  std::vector<libra::Quaternion> quaternion_i2rtn_list_;            //!< Quaternion from the inertial frame to the RTN frame
+  std::vector<libra::Vector<3>> rtn_rotation_vector_list_i_rad_s_;  //!< Rotation vector of the RTN frame in the inertial frame [rad/s]
+
+  libra::KdTree spatial_index_;  //!< Spatial index of the spacecraft position in the inertial frame
+
+  /**
+   * @fn UpdatePair
+   * @brief Update the relative information of both directions of the pair
+   * @param [in] target_spacecraft_id: ID of the spacecraft
+   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   */
+  void UpdatePair(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
+
   /**
    * @fn CalcRelativeAttitudeQuaternion
    * @brief Calculate and return the relative attitude quaternion
@@ -0,0 +1,195 @@
+/**
+ * @file test_distributed_simulation_node.cpp
+ * @brief Test codes for DistributedSimulationNode class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "distributed_simulation_node.hpp"
+
+namespace {
+const std::string kCoordinatorAddress = "127.0.0.1";
+
+/**
+ * @fn FindFreePort
+ * @brief Return a TCP port number of the loopback address which is not used now
+ */
+unsigned short FindFreePort() {
+  const int descriptor = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  bind(descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+  socklen_t length = sizeof(address);
+  getsockname(descriptor, reinterpret_cast<sockaddr*>(&address), &length);
+  close(descriptor);
+  return ntohs(address.sin_port);
+}
+
+/**
+ * @struct NodeResult
+ * @brief Results of a node running in a thread
+ */
+struct NodeResult {
+  std::vector<double> sync_times_s;                     //!< Elapsed times when the synchronization is done
+  std::vector<InterSpacecraftPacket> received_packets;  //!< Packets received by the local spacecraft
+  size_t number_of_registered_spacecraft = 0;           //!< Number of spacecraft in the relative information
+  std::exception_ptr exception;                         //!< Exception thrown in the thread
+};
+}  // namespace
+
+/**
+ * @brief Test for the invalid settings, the single node, and the assignment of the spacecraft
+ */
+TEST(DistributedSimulationNode, Settings) {
+  EXPECT_THROW(DistributedSimulationNode(2, 2, kCoordinatorAddress, 0, 1.0), std::invalid_argument);
+  EXPECT_THROW(DistributedSimulationNode(0, 0, kCoordinatorAddress, 0, 1.0), std::invalid_argument);
+  EXPECT_THROW(DistributedSimulationNode(0, 2, kCoordinatorAddress, 0, 0.0), std::invalid_argument);
+
+  // The single node does not connect or synchronize
+  DistributedSimulationNode single_node(0, 1, kCoordinatorAddress, 0, 1.0);
+  single_node.Connect(0.0);
+  EXPECT_FALSE(single_node.Synchronize(1.0));
+
+  DistributedSimulationNode node(1, 3, kCoordinatorAddress, 0, 1.0);
+  EXPECT_TRUE(node.IsLocalSpacecraft(1));
+  EXPECT_TRUE(node.IsLocalSpacecraft(4));
+  EXPECT_FALSE(node.IsLocalSpacecraft(2));
+  EXPECT_THROW(node.RegisterLocalSpacecraft(3, nullptr), std::invalid_argument);
+  EXPECT_THROW(DistributedSimulationNode(1, 2, "localhost", 0, 1.0).Connect(1.0), std::invalid_argument);
+}
+
+/**
+ * @brief Test for the timeouts of the coordinator and the worker without the other nodes
+ */
+TEST(DistributedSimulationNode, ConnectTimeout) {
+  const unsigned short port = FindFreePort();
+  DistributedSimulationNode coordinator(0, 2, kCoordinatorAddress, port, 1.0);
+  EXPECT_THROW(coordinator.Connect(0.2), std::runtime_error);
+  DistributedSimulationNode worker(1, 2, kCoordinatorAddress, port, 1.0);
+  EXPECT_THROW(worker.Connect(0.2), std::runtime_error);
+}
+
+/**
+ * @brief Test for the synchronization points and the inter-spacecraft packets exchanged between three nodes over TCP
+ */
+TEST(DistributedSimulationNode, PacketExchange) {
+  const unsigned int number_of_nodes = 3;
+  const size_t number_of_spacecraft = 6;
+  const size_t number_of_steps = 20;
+  const double step_s = 0.1;
+  const unsigned short port = FindFreePort();
+
+  SimulationConfiguration simulation_configuration;
+  simulation_configuration.main_logger_ = nullptr;
+  simulation_configuration.inter_sc_communication_file_ =
+      std::string(CORE_DIR_FROM_EXE) + "/data/sample/initialize_files/sample_inter_satellite_communication.ini";
+  std::vector<std::unique_ptr<InterSpacecraftCommunication>> communications;
+  for (unsigned int node_id = 0; node_id < number_of_nodes; node_id++) {
+    communications.push_back(std::make_unique<InterSpacecraftCommunication>(&simulation_configuration));
+  }
+  IniAccess::ClearCache();
+
+  // Each spacecraft sends a packet to the next spacecraft at every step, and the next spacecraft is always in another node
+  std::vector<NodeResult> results(number_of_nodes);
+  std::vector<std::thread> threads;
+  for (unsigned int node_id = 0; node_id < number_of_nodes; node_id++) {
+    threads.emplace_back([&, node_id]() {
+      NodeResult& result = results[node_id];
+      InterSpacecraftCommunication& communication = *communications[node_id];
+      try {
+        DistributedSimulationNode node(node_id, number_of_nodes, kCoordinatorAddress, port, 0.5);
+        RelativeInformation relative_information;
+        node.SetRelativeInformation(&relative_information, number_of_spacecraft);
+        node.SetInterSpacecraftCommunication(&communication);
+        result.number_of_registered_spacecraft = relative_information.GetNumberOfSpacecraft();
+        node.Connect(10.0);
+
+        for (size_t step = 1; step <= number_of_steps; step++) {
+          const double elapsed_time_s = step * step_s;
+          for (size_t spacecraft_id = node_id; spacecraft_id < number_of_spacecraft; spacecraft_id += number_of_nodes) {
+            InterSpacecraftPacket packet;
+            packet.source_spacecraft_id = spacecraft_id;
+            packet.destination_spacecraft_id = (spacecraft_id + 1) % number_of_spacecraft;
+            packet.send_time_s = elapsed_time_s;
+            packet.data = {(unsigned char)spacecraft_id, (unsigned char)step};
+            communication.SendPacket(packet);
+          }
+          communication.Update(elapsed_time_s);
+          if (node.Synchronize(elapsed_time_s)) result.sync_times_s.push_back(elapsed_time_s);
+          for (size_t spacecraft_id = node_id; spacecraft_id < number_of_spacecraft; spacecraft_id += number_of_nodes) {
+            for (const auto& packet : communication.ReceivePackets(spacecraft_id)) result.received_packets.push_back(packet);
+          }
+        }
+      } catch (...) {
+        result.exception = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (unsigned int node_id = 0; node_id < number_of_nodes; node_id++) {
+    const NodeResult& result = results[node_id];
+    ASSERT_EQ(nullptr, result.exception) << "node " << node_id;
+    // The remote spacecraft are registered to the relative information
+    EXPECT_EQ(number_of_spacecraft - number_of_spacecraft / number_of_nodes, result.number_of_registered_spacecraft);
+    // All nodes synchronize at the same points
+    ASSERT_EQ(4u, result.sync_times_s.size());
+    for (size_t i = 0; i < result.sync_times_s.size(); i++) EXPECT_NEAR(0.5 * (i + 1), result.sync_times_s[i], 1e-9);
+
+    // The packets sent until the last synchronization point are delivered in the sending order
+    ASSERT_EQ(number_of_steps * number_of_spacecraft / number_of_nodes, result.received_packets.size());
+    for (size_t spacecraft_id = node_id; spacecraft_id < number_of_spacecraft; spacecraft_id += number_of_nodes) {
+      const size_t source_spacecraft_id = (spacecraft_id + number_of_spacecraft - 1) % number_of_spacecraft;
+      size_t step = 0;
+      for (const auto& packet : result.received_packets) {
+        if (packet.destination_spacecraft_id != spacecraft_id) continue;
+        step++;
+        EXPECT_EQ(source_spacecraft_id, packet.source_spacecraft_id);
+        EXPECT_DOUBLE_EQ(step * step_s, packet.send_time_s);
+        EXPECT_EQ(std::vector<unsigned char>({(unsigned char)source_spacecraft_id, (unsigned char)step}), packet.data);
+      }
+      EXPECT_EQ(number_of_steps, step);
+    }
+  }
+}
+
+/**
+ * @brief Test for the nodes out of synchronization
+ */
+TEST(DistributedSimulationNode, TimeMismatch) {
+  const unsigned short port = FindFreePort();
+  std::exception_ptr worker_exception;
+  std::thread worker_thread([&]() {
+    try {
+      DistributedSimulationNode worker(1, 2, kCoordinatorAddress, port, 0.5);
+      worker.Connect(10.0);
+      // The worker skips the first synchronization point
+      worker.Synchronize(1.0);
+    } catch (...) {
+      worker_exception = std::current_exception();
+    }
+  });
+  DistributedSimulationNode coordinator(0, 2, kCoordinatorAddress, port, 0.5);
+  coordinator.Connect(10.0);
+  EXPECT_THROW(coordinator.Synchronize(0.5), std::runtime_error);
+  worker_thread.join();
+  ASSERT_NE(nullptr, worker_exception);
+  EXPECT_THROW(std::rethrow_exception(worker_exception), std::runtime_error);
+}
+#endif  // WIN32
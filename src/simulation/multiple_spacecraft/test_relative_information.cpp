@@ -0,0 +1,49 @@
+/**
+ * @file test_relative_information.cpp
+ * @brief Test codes for RelativeInformation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "relative_information.hpp"
+
+/**
+ * @brief Test for the relative information of both directions of each pair against the direct calculation
+ */
+TEST(RelativeInformation, PairUpdate) {
+  RelativeInformation relative_information;
+  const size_t number_of_spacecraft = 3;
+  RemoteSpacecraftState states[number_of_spacecraft];
+  for (size_t id = 0; id < number_of_spacecraft; id++) {
+    relative_information.RegisterRemoteSpacecraft(id);
+    for (size_t axis = 0; axis < 3; axis++) {
+      states[id].position_i_m[axis] = 7.0e6 * sin(1.0 + id * 3.0 + axis);
+      states[id].velocity_i_m_s[axis] = 7.0e3 * cos(2.0 + id * 5.0 + axis);
+    }
+    states[id].quaternion_i2b = libra::Quaternion(0.1 * id, 0.2, -0.3, 1.0).Normalize();
+    states[id].quaternion_i2rtn = libra::Quaternion(-0.2, 0.1 * id, 0.4, 1.0).Normalize();
+    relative_information.SetRemoteSpacecraftState(id, states[id]);
+  }
+  ASSERT_EQ(number_of_spacecraft, relative_information.GetNumberOfSpacecraft());
+  relative_information.Update();
+
+  for (size_t target = 0; target < number_of_spacecraft; target++) {
+    for (size_t reference = 0; reference < number_of_spacecraft; reference++) {
+      if (target == reference) continue;
+      const libra::Vector<3> position_i_m = states[target].position_i_m - states[reference].position_i_m;
+      const libra::Vector<3> velocity_i_m_s = states[target].velocity_i_m_s - states[reference].velocity_i_m_s;
+      const libra::Vector<3> position_rtn_m = states[reference].quaternion_i2rtn.FrameConversion(position_i_m);
+      const libra::Quaternion quaternion = states[target].quaternion_i2b * states[reference].quaternion_i2b.Conjugate();
+      EXPECT_NEAR(position_i_m.CalcNorm(), relative_information.GetRelativeDistance_m(target, reference), 1e-6);
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(position_i_m[axis], relative_information.GetRelativePosition_i_m(target, reference)[axis], 1e-6);
+        EXPECT_NEAR(velocity_i_m_s[axis], relative_information.GetRelativeVelocity_i_m_s(target, reference)[axis], 1e-9);
+        EXPECT_NEAR(position_rtn_m[axis], relative_information.GetRelativePosition_rtn_m(target, reference)[axis], 1e-6);
+      }
+      for (size_t i = 0; i < 4; i++) {
+        EXPECT_NEAR(quaternion[i], relative_information.GetRelativeAttitudeQuaternion(target, reference)[i], 1e-12);
+      }
+    }
+  }
+}
@@ -11,6 +11,9 @@
 
 #include "../logger/logger.hpp"
 
+class EnvironmentReplay;
+class ThreadPool;
+
 /**
  * @struct SimulationConfiguration
  * @brief Simulation setting information
@@ -19,8 +22,16 @@ struct SimulationConfiguration {
   std::string initialize_base_file_name_;  //!< Base file name for initialization
   Logger* main_logger_;                    //!< Main logger
 
-  unsigned int number_of_simulated_spacecraft_;    //!< Number of simulated spacecraft
-  std::vector<std::string> spacecraft_file_list_;  //!< File name list for spacecraft initialization
+  unsigned int number_of_simulated_spacecraft_;              //!< Number of simulated spacecraft
+  std::vector<std::string> spacecraft_file_list_;            //!< File name list for spacecraft initialization
+  unsigned int number_of_spacecraft_update_threads_;         //!< Number of threads to update the spacecraft concurrently
+  bool is_thermal_propagated_concurrently_ = false;          //!< Propagate the thermal dynamics concurrently with the attitude and orbit
+  unsigned int number_of_thermal_threads_ = 1;               //!< Number of threads of the thermal propagation including the calling thread
+  size_t thermal_parallel_node_threshold_ = 0;               //!< Minimum number of nodes to split the thermal node loop. Zero disables it.
+  ThreadPool* thermal_thread_pool_ = nullptr;                //!< Thread pool of the thermal propagation. Owned by SimulationCase.
+  bool is_global_environment_updated_concurrently_ = false;  //!< Update the independent parts of the global environment concurrently
+  bool is_event_detection_enabled_ = false;                  //!< Detect the events of the simulation case and write the event log
+  bool is_orbit_lifetime_mode_enabled_ = false;              //!< Run the orbit lifetime analysis instead of the simulation steps
 
   unsigned int number_of_simulated_ground_station_;    //!< Number of simulated spacecraft
   std::vector<std::string> ground_station_file_list_;  //!< File name for ground station initialization
@@ -28,6 +39,28 @@ struct SimulationConfiguration {
   std::string inter_sc_communication_file_;  //!< File name for inter-satellite communication initialization
   std::string gnss_file_;                    //!< File name for GNSS initialization
 
+  std::string save_snapshot_file_;     //!< File name to save the snapshot. Empty disables the save.
+  double save_snapshot_time_s_ = 0.0;  //!< Elapsed time to save the snapshot [s]
+  std::string load_snapshot_file_;     //!< File name of the snapshot to resume the simulation. Empty disables the load.
+
+  std::string environment_record_file_;              //!< File name to record the environment and dynamics. Empty disables the record.
+  std::string environment_replay_file_;              //!< File name of the record to replay the environment and dynamics. Empty disables it.
+  EnvironmentReplay* environment_replay_ = nullptr;  //!< Environment record or replay. nullptr when both are disabled. Owned by SimulationCase.
+
+  bool is_step_profiler_enabled_ = false;                   //!< Measure the calculation time of the subsystems with StepProfiler
+  std::string step_profiler_trace_file_;                    //!< File name of the Chrome trace in the log directory. Empty disables the trace.
+  bool is_step_profiler_hardware_counter_enabled_ = false;  //!< Measure the hardware performance counters with StepProfiler (Linux only)
+
+  bool is_memory_usage_report_enabled_ = false;  //!< Write the memory usage of the simulation objects at the initialization
+  bool is_case_arena_enabled_ = false;           //!< Allocate the target objects of the case in CaseArena
+
+  bool is_distributed_simulation_enabled_ = false;  //!< Split the spacecraft across the processes with DistributedSimulationNode
+  unsigned int distributed_node_id_ = 0;            //!< ID of this process in the distributed simulation. 0 is the coordinator.
+  unsigned int number_of_distributed_nodes_ = 1;    //!< Number of processes in the distributed simulation
+  std::string distributed_coordinator_address_;     //!< IPv4 address of the coordinator
+  unsigned short distributed_coordinator_port_ = 0;  //!< TCP port number of the coordinator
+  double distributed_sync_period_s_ = 1.0;          //!< Period of the synchronization between the processes (lookahead) [s]
+
   /**
    * @fn ~SimulationConfiguration
    * @brief Destructor
@@ -0,0 +1,89 @@
+/**
+ * @file constellation_builder.cpp
+ * @brief Class to generate the spacecraft of a constellation from one template spacecraft file
+ */
+
+#include "constellation_builder.hpp"
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <iostream>
+#include <map>
+#include <math_physics/math/constants.hpp>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <sstream>
+#include <stdexcept>
+
+ConstellationPattern SetConstellationPattern(const std::string pattern) {
+  if (pattern == "WALKER_DELTA") {
+    return ConstellationPattern::kWalkerDelta;
+  } else if (pattern == "WALKER_STAR") {
+    return ConstellationPattern::kWalkerStar;
+  } else if (pattern == "DISABLE" || pattern == "NULL") {
+    return ConstellationPattern::kDisable;
+  } else {
+    std::cout << "[Warning] constellation_pattern: " << pattern << " is not supported. The constellation is disabled." << std::endl;
+    return ConstellationPattern::kDisable;
+  }
+}
+
+ConstellationBuilder::ConstellationBuilder(const std::string template_spacecraft_file, const ConstellationPattern pattern,
+                                           const size_t number_of_spacecraft, const size_t number_of_planes, const size_t phasing_parameter)
+    : template_spacecraft_file_(template_spacecraft_file),
+      pattern_(pattern),
+      number_of_spacecraft_(number_of_spacecraft),
+      number_of_planes_(number_of_planes),
+      phasing_parameter_(phasing_parameter) {}
+
+std::vector<std::string> ConstellationBuilder::Build() const {
+  std::vector<std::string> member_files;
+  if (pattern_ == ConstellationPattern::kDisable || number_of_spacecraft_ == 0) return member_files;
+
+  if (number_of_planes_ == 0 || number_of_spacecraft_ % number_of_planes_ != 0 || phasing_parameter_ >= number_of_planes_) {
+    throw std::invalid_argument("CONSTELLATION: number_of_spacecraft must be divisible by number_of_planes, and phasing_parameter must be less "
+                                "than number_of_planes.");
+  }
+
+  // Orbital elements of the reference member
+  IniAccess template_ini(template_spacecraft_file_);
+  const char* section = "ORBIT";
+  const double semi_major_axis_m = template_ini.ReadDouble(section, "semi_major_axis_m");
+  const double raan_rad = template_ini.ReadDouble(section, "raan_rad");
+  const double epoch_jday = template_ini.ReadDouble(section, "epoch_jday");
+  if (semi_major_axis_m <= 0.0) {
+    throw std::invalid_argument("CONSTELLATION: The template spacecraft file " + template_spacecraft_file_ + " does not have the orbital elements.");
+  }
+  const double mean_motion_rad_s = std::sqrt(environment::earth_gravitational_constant_m3_s2 / std::pow(semi_major_axis_m, 3.0));
+
+  const size_t number_of_spacecraft_per_plane = number_of_spacecraft_ / number_of_planes_;
+  const double raan_spread_rad = pattern_ == ConstellationPattern::kWalkerStar ? libra::pi : libra::tau;
+  for (size_t plane_id = 0; plane_id < number_of_planes_; plane_id++) {
+    for (size_t spacecraft_id = 0; spacecraft_id < number_of_spacecraft_per_plane; spacecraft_id++) {
+      const double member_raan_rad = raan_rad + raan_spread_rad * (double)plane_id / (double)number_of_planes_;
+      const double mean_anomaly_shift_rad = libra::tau * (double)spacecraft_id / (double)number_of_spacecraft_per_plane +
+                                            libra::tau * (double)(phasing_parameter_ * plane_id) / (double)number_of_spacecraft_;
+      // The epoch is the time of the perigee passage, so the mean anomaly shift moves the epoch backward
+      const double member_epoch_jday = epoch_jday - mean_anomaly_shift_rad / mean_motion_rad_s / (24.0 * 60.0 * 60.0);
+
+      std::ostringstream raan_stream, epoch_stream;
+      raan_stream.precision(17);
+      epoch_stream.precision(17);
+      raan_stream << std::fmod(member_raan_rad, libra::tau);
+      epoch_stream << member_epoch_jday;
+      const std::map<std::string, std::map<std::string, std::string>> overridden_values = {
+          {section, {{"initialize_mode", "ORBITAL_ELEMENTS"}, {"raan_rad", raan_stream.str()}, {"epoch_jday", epoch_stream.str()}}}};
+
+      const std::string member_file = GetMemberFilePath(member_files.size());
+      if (!IniAccess::RegisterInMemoryFile(member_file, template_spacecraft_file_, overridden_values)) {
+        throw std::invalid_argument("CONSTELLATION: The template spacecraft file " + template_spacecraft_file_ + " cannot be read.");
+      }
+      member_files.push_back(member_file);
+    }
+  }
+  return member_files;
+}
+
+std::string ConstellationBuilder::GetMemberFilePath(const size_t member_id) const {
+  const size_t extension_position = template_spacecraft_file_.rfind(".ini");
+  return template_spacecraft_file_.substr(0, extension_position) + "_constellation_" + std::to_string(member_id) + ".ini";
+}
@@ -0,0 +1,74 @@
+/**
+ * @file constellation_builder.hpp
+ * @brief Class to generate the spacecraft of a constellation from one template spacecraft file
+ */
+
+#ifndef S2E_SIMULATION_SPACECRAFT_CONSTELLATION_BUILDER_HPP_
+#define S2E_SIMULATION_SPACECRAFT_CONSTELLATION_BUILDER_HPP_
+
+#include <string>
+#include <vector>
+
+/**
+ * @enum ConstellationPattern
+ * @brief Pattern of the orbit planes and the phases of the constellation
+ */
+enum class ConstellationPattern {
+  kDisable,      //!< No constellation
+  kWalkerDelta,  //!< Walker delta pattern (RAAN spread over 2 pi)
+  kWalkerStar,   //!< Walker star pattern (RAAN spread over pi)
+};
+
+/**
+ * @fn SetConstellationPattern
+ * @brief Convert the string to ConstellationPattern
+ * @param [in] pattern: Pattern name (DISABLE, WALKER_DELTA, or WALKER_STAR)
+ */
+ConstellationPattern SetConstellationPattern(const std::string pattern);
+
+/**
+ * @class ConstellationBuilder
+ * @brief Class to generate the spacecraft of a constellation from one template spacecraft file
+ * @details The template file is parsed once, and the spacecraft file of each member is registered in memory with the overridden orbital elements
+ *          (see IniAccess::RegisterInMemoryFile). The setting files referred in the template (structure, components, etc.) are shared by the
+ *          members through the parse cache of IniAccess, so the configuration work does not grow with the files of each member.
+ *          The Walker pattern i:T/P/F places T spacecraft on P planes. The RAAN of the plane p is raan + p * 2pi/P (delta) or raan + p * pi/P
+ *          (star), and the mean anomaly of the spacecraft s in the plane p is shifted by s * 2pi/(T/P) + p * F * 2pi/T from the template.
+ */
+class ConstellationBuilder {
+ public:
+  /**
+   * @fn ConstellationBuilder
+   * @brief Constructor
+   * @param [in] template_spacecraft_file: Spacecraft file with the orbital elements of the reference member
+   * @param [in] pattern: Pattern of the constellation
+   * @param [in] number_of_spacecraft: Total number of the spacecraft T
+   * @param [in] number_of_planes: Number of the orbit planes P. T must be divisible by P.
+   * @param [in] phasing_parameter: Phasing parameter F in [0, P-1]
+   */
+  ConstellationBuilder(const std::string template_spacecraft_file, const ConstellationPattern pattern, const size_t number_of_spacecraft,
+                       const size_t number_of_planes, const size_t phasing_parameter);
+
+  /**
+   * @fn Build
+   * @brief Register the spacecraft files of the members in memory. Throws std::invalid_argument when the setting is not valid.
+   * @return File paths of the members to be added to the spacecraft file list
+   */
+  std::vector<std::string> Build() const;
+
+ private:
+  std::string template_spacecraft_file_;  //!< Spacecraft file with the orbital elements of the reference member
+  ConstellationPattern pattern_;          //!< Pattern of the constellation
+  size_t number_of_spacecraft_;           //!< Total number of the spacecraft
+  size_t number_of_planes_;               //!< Number of the orbit planes
+  size_t phasing_parameter_;              //!< Phasing parameter
+
+  /**
+   * @fn GetMemberFilePath
+   * @brief Return the in-memory file path of the member
+   * @param [in] member_id: Member ID in the constellation
+   */
+  std::string GetMemberFilePath(const size_t member_id) const;
+};
+
+#endif  // S2E_SIMULATION_SPACECRAFT_CONSTELLATION_BUILDER_HPP_
@@ -6,8 +6,13 @@
 #ifndef S2E_SIMULATION_SPACECRAFT_INSTALLED_COMPONENTS_HPP_
 #define S2E_SIMULATION_SPACECRAFT_INSTALLED_COMPONENTS_HPP_
 
+#include <components/base/actuator_output_schedule.hpp>
 #include <logger/logger.hpp>
 #include <math_physics/math/vector.hpp>
+#include <utilities/macros.hpp>
+#include <utilities/memory_usage.hpp>
+#include <utilities/snapshot.hpp>
+#include <utilities/type_name.hpp>
 
 /**
  * @class InstalledComponents
@@ -35,6 +40,19 @@ class InstalledComponents {
    */
   virtual libra::Vector<3> GenerateTorque_b_Nm();
 
+  /**
+   * @fn GenerateOutputSchedule
+   * @brief Collect the piecewise-constant output schedules of the actuators for the coming interval
+   * @details Users need to override this function to call ReportOutputSchedule of the actuators. The force and torque reported here must not be
+   *          included in GenerateForce_b_N and GenerateTorque_b_Nm.
+   * @param [out] schedule: Output schedule to add the segments
+   * @param [in] interval_s: Length of the coming interval [sec]
+   */
+  virtual void GenerateOutputSchedule(ActuatorOutputSchedule& schedule, const double interval_s) {
+    UNUSED(schedule);
+    UNUSED(interval_s);
+  }
+
   /**
    * @fn ComponentInterference
    * @brief Handle component interference effect
@@ -47,6 +65,28 @@ class InstalledComponents {
    * @details Users need to override this function to add logger for components
    */
   virtual void LogSetup(Logger& logger);
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the internal states of the components to the snapshot
+   * @details Users need to override this function to call SaveSnapshot of the components which have the internal state
+   * @param [out] snapshot: Snapshot writer
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const { UNUSED(snapshot); }
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the internal states of the components from the snapshot
+   * @details Users need to override this function in the same order as SaveSnapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot) { UNUSED(snapshot); }
+
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the components
+   * @details Users need to override this function to add the memory usage of the components
+   */
+  virtual MemoryUsage GetMemoryUsage() const { return MemoryUsage(GetTypeName(typeid(*this)), sizeof(*this)); }
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_INSTALLED_COMPONENTS_HPP_
@@ -5,8 +5,15 @@
 
 #include "spacecraft.hpp"
 
+#include <disturbances/geopotential.hpp>
+#include <dynamics/orbit/stm_orbit_propagation.hpp>
 #include <logger/log_utility.hpp>
 #include <logger/logger.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <simulation/case/environment_replay.hpp>
+#include <stdexcept>
+#include <string>
 
 Spacecraft::Spacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment, const int spacecraft_id,
                        RelativeInformation* relative_information)
@@ -28,14 +35,30 @@ Spacecraft::~Spacecraft() {
 void Spacecraft::Initialize(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
                             const int spacecraft_id, RelativeInformation* relative_information) {
   clock_generator_.ClearTimerCount();
+  // The components constructed by the derived class are skipped while their power switch is off
+  IniAccess spacecraft_ini_file(simulation_configuration->spacecraft_file_list_[spacecraft_id]);
+  clock_generator_.SetSkipsPowerOffComponents(spacecraft_ini_file.ReadEnable("COMPONENT_FILES", "skip_power_off_components"));
+  // The randomized objects of each spacecraft use their own streams regardless of the construction order
+  GlobalRandomization::StreamScope stream_scope("SPACECRAFT_" + std::to_string(spacecraft_id));
   structure_ = new Structure(simulation_configuration, spacecraft_id);
   local_environment_ = new LocalEnvironment(simulation_configuration, global_environment, spacecraft_id);
   dynamics_ = new Dynamics(simulation_configuration, &(global_environment->GetSimulationTime()), local_environment_, spacecraft_id, structure_,
                            relative_information);
   disturbances_ = new Disturbances(simulation_configuration, spacecraft_id, structure_, global_environment);
 
+  // The variational equations use the same high-order gravity with the geopotential disturbance
+  const Geopotential* geopotential = disturbances_->GetGeopotential();
+  if (dynamics_->GetOrbit().GetPropagateMode() == OrbitPropagateMode::kStm && geopotential != nullptr && geopotential->IsCalculationEnabled()) {
+    static_cast<StmOrbitPropagation&>(dynamics_->SetOrbit()).SetGravityPotential(geopotential->GetGravityPotential());
+  }
+
+  // The disturbances with the stage mode are evaluated at each stage of the orbit integrator
+  dynamics_->SetOrbit().SetForceModel(disturbances_);
+
   simulation_configuration->main_logger_->CopyFileToLogDirectory(simulation_configuration->spacecraft_file_list_[spacecraft_id]);
 
+  environment_replay_ = simulation_configuration->environment_replay_;
+
   relative_information_ = relative_information;
   if (relative_information_ != nullptr) {
     relative_information_->RegisterDynamicsInfo(spacecraft_id, dynamics_);
@@ -49,12 +72,52 @@ void Spacecraft::LogSetup(Logger& logger) {
   components_->LogSetup(logger);
 }
 
+MemoryUsage Spacecraft::GetMemoryUsage() const {
+  MemoryUsage memory_usage("Spacecraft " + std::to_string(spacecraft_id_), sizeof(*this));
+  memory_usage.AddChild(dynamics_->GetMemoryUsage());
+  memory_usage.AddChild(local_environment_->GetMemoryUsage());
+  memory_usage.AddChild(disturbances_->GetMemoryUsage());
+  memory_usage.AddChild(MemoryUsage("Structure", structure_->GetMemoryUsage_bytes()));
+  memory_usage.AddChild(components_->GetMemoryUsage());
+  return memory_usage;
+}
+
+void Spacecraft::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("SPACECRAFT");
+  snapshot.Write(spacecraft_id_);
+  clock_generator_.SaveSnapshot(snapshot);
+  dynamics_->SaveSnapshot(snapshot);
+  local_environment_->SaveSnapshot(snapshot);
+  disturbances_->SaveSnapshot(snapshot);
+  components_->SaveSnapshot(snapshot);
+}
+
+void Spacecraft::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("SPACECRAFT");
+  unsigned int spacecraft_id;
+  snapshot.Read(spacecraft_id);
+  if (spacecraft_id != spacecraft_id_) {
+    throw std::invalid_argument("Snapshot of the spacecraft " + std::to_string(spacecraft_id) + " is loaded to the spacecraft " +
+                                std::to_string(spacecraft_id_) + ".");
+  }
+  clock_generator_.LoadSnapshot(snapshot);
+  dynamics_->LoadSnapshot(snapshot);
+  local_environment_->LoadSnapshot(snapshot);
+  disturbances_->LoadSnapshot(snapshot);
+  components_->LoadSnapshot(snapshot);
+}
+
 void Spacecraft::Update(const SimulationTime* simulation_time) {
+  if (environment_replay_ != nullptr && environment_replay_->IsReplaying()) {
+    UpdateWithReplayFrame(simulation_time);
+    return;
+  }
   dynamics_->ClearForceTorque();
 
   // Update local environment and disturbance
   local_environment_->Update(dynamics_, simulation_time);
   disturbances_->Update(*local_environment_, *dynamics_, simulation_time);
+  if (environment_replay_ != nullptr) SaveReplayFrame(environment_replay_->GetSpacecraftWriter(spacecraft_id_));
 
   // Update components
   clock_generator_.UpdateComponents(simulation_time);
@@ -68,9 +131,43 @@ void Spacecraft::Update(const SimulationTime* simulation_time) {
   // Add generated force and torque by components
   dynamics_->AddTorque_b_Nm(components_->GenerateTorque_b_Nm());
   dynamics_->AddForce_b_N(components_->GenerateForce_b_N());
+  actuator_output_schedule_.Clear();
+  const double step_s = simulation_time->GetSimulationStep_s();
+  components_->GenerateOutputSchedule(actuator_output_schedule_, step_s);
+  if (!actuator_output_schedule_.IsEmpty()) {
+    dynamics_->AddImpulse_b(actuator_output_schedule_.CalcImpulse_b_Ns(0.0, step_s), actuator_output_schedule_.CalcAngularImpulse_b_Nms(0.0, step_s),
+                            step_s);
+  }
 
   // Propagate dynamics
   dynamics_->Update(simulation_time, &(local_environment_->GetCelestialInformation()));
 }
 
 void Spacecraft::Clear(void) { dynamics_->ClearForceTorque(); }
+
+void Spacecraft::SaveReplayFrame(SnapshotWriter& frame) const {
+  frame.WriteTag("SPACECRAFT_FRAME");
+  frame.Write(spacecraft_id_);
+  dynamics_->SaveSnapshot(frame);
+  local_environment_->SaveSnapshot(frame);
+}
+
+void Spacecraft::UpdateWithReplayFrame(const SimulationTime* simulation_time) {
+  dynamics_->ClearForceTorque();
+
+  // Restore the dynamics and local environment seen by the components in the recorded step
+  SnapshotReader& frame = environment_replay_->GetSpacecraftReader(spacecraft_id_);
+  frame.ReadTag("SPACECRAFT_FRAME");
+  unsigned int spacecraft_id;
+  frame.Read(spacecraft_id);
+  if (spacecraft_id != spacecraft_id_) {
+    throw std::invalid_argument("Replay frame of the spacecraft " + std::to_string(spacecraft_id) + " is loaded to the spacecraft " +
+                                std::to_string(spacecraft_id_) + ".");
+  }
+  dynamics_->LoadSnapshot(frame);
+  local_environment_->LoadSnapshot(frame);
+
+  // Update components. Their outputs do not change the replayed dynamics.
+  clock_generator_.UpdateComponents(simulation_time);
+  components_->ComponentInterference();
+}
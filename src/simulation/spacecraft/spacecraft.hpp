@@ -11,6 +11,7 @@
 #include <environment/global/clock_generator.hpp>
 #include <environment/local/local_environment.hpp>
 #include <simulation/multiple_spacecraft/relative_information.hpp>
+#include <utilities/case_arena.hpp>
 
 #include "installed_components.hpp"
 #include "structure/structure.hpp"
@@ -19,7 +20,7 @@
  * @class Spacecraft
  * @brief Base class to express Spacecraft
  */
-class Spacecraft {
+class Spacecraft : public ArenaAllocated {
  public:
   /**
    * @fn Spacecraft
@@ -64,6 +65,27 @@ class Spacecraft {
    */
   virtual void LogSetup(Logger& logger);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the spacecraft to the snapshot
+   * @note Override this function and call it in the user defined spacecraft to add the states of the additional objects
+   * @param [out] snapshot: Snapshot writer
+   */
+  virtual void SaveSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the states of the spacecraft from the snapshot
+   * @param [in] snapshot: Snapshot reader
+   */
+  virtual void LoadSnapshot(SnapshotReader& snapshot);
+
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the spacecraft and the subsystems
+   * @note Override this function and call it in the user defined spacecraft to add the memory usage of the additional objects
+   */
+  virtual MemoryUsage GetMemoryUsage() const;
+
   // Getters
   /**
    * @fn GetDynamics
@@ -97,14 +119,30 @@ class Spacecraft {
   inline unsigned int GetSpacecraftId() const { return spacecraft_id_; }
 
  protected:
-  ClockGenerator clock_generator_;             //!< Origin of clock for the spacecraft
-  Dynamics* dynamics_;                         //!< Dynamics information of the spacecraft
-  RelativeInformation* relative_information_;  //!< Relative information with respect to the other spacecraft
-  LocalEnvironment* local_environment_;        //!< Local environment information around the spacecraft
-  Disturbances* disturbances_;                 //!< Disturbance information acting on the spacecraft
-  Structure* structure_;                       //!< Structure information of the spacecraft
-  InstalledComponents* components_;            //!< Components information installed on the spacecraft
-  const unsigned int spacecraft_id_;           //!< ID of the spacecraft
+  ClockGenerator clock_generator_;                   //!< Origin of clock for the spacecraft
+  Dynamics* dynamics_;                               //!< Dynamics information of the spacecraft
+  RelativeInformation* relative_information_;        //!< Relative information with respect to the other spacecraft
+  LocalEnvironment* local_environment_;              //!< Local environment information around the spacecraft
+  Disturbances* disturbances_;                       //!< Disturbance information acting on the spacecraft
+  Structure* structure_;                             //!< Structure information of the spacecraft
+  InstalledComponents* components_;                  //!< Components information installed on the spacecraft
+  ActuatorOutputSchedule actuator_output_schedule_;  //!< Output schedule of the actuators in the step
+  const unsigned int spacecraft_id_;                 //!< ID of the spacecraft
+  EnvironmentReplay* environment_replay_ = nullptr;  //!< Record or replay of the environment. nullptr when it is disabled.
+
+  /**
+   * @fn SaveReplayFrame
+   * @brief Write the dynamics and local environment of the step to the frame of the environment record
+   * @param [out] frame: Frame writer of the spacecraft
+   */
+  void SaveReplayFrame(SnapshotWriter& frame) const;
+  /**
+   * @fn UpdateWithReplayFrame
+   * @brief Update the components with the dynamics and local environment restored from the replay frame instead of the calculation
+   * @note The dynamics are not propagated, and the disturbances are not calculated.
+   * @param [in] simulation_time: Simulation time
+   */
+  void UpdateWithReplayFrame(const SimulationTime* simulation_time);
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_SPACECRAFT_HPP_
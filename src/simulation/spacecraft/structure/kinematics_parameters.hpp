@@ -42,6 +42,13 @@ class KinematicsParameters {
    * @brief Return Inertia tensor at body frame [kgm2]
    */
   inline const libra::Matrix<3, 3>& GetInertiaTensor_b_kgm2() const { return inertia_tensor_b_kgm2_; }
+  /**
+   * @fn GetVersion
+   * @brief Return the version number of the parameters
+   * @note The number is incremented by all setters. The users can keep the number used for their derived values and recalculate the
+   *       values only when the number is changed.
+   */
+  inline size_t GetVersion() const { return version_; }
 
   // Setter
   /**
@@ -51,6 +58,7 @@ class KinematicsParameters {
    */
   inline void SetCenterOfGravityVector_b_m(const libra::Vector<3> center_of_gravity_vector_b_m) {
     center_of_gravity_b_m_ = center_of_gravity_vector_b_m;
+    version_++;
   }
   /**
    * @fn SetMass_kg
@@ -58,7 +66,10 @@ class KinematicsParameters {
    * @param [in] mass_kg: Mass of the satellite [kg]
    */
   inline void SetMass_kg(const double mass_kg) {
-    if (mass_kg > 0.0) mass_kg_ = mass_kg;
+    if (mass_kg > 0.0) {
+      mass_kg_ = mass_kg;
+      version_++;
+    }
   }
   /**
    * @fn AddMass_kg
@@ -78,12 +89,14 @@ class KinematicsParameters {
   inline void SetInertiaTensor_b_kgm2(const libra::Matrix<3, 3> inertia_tensor_b_kgm2) {
     // TODO add assertion check
     inertia_tensor_b_kgm2_ = inertia_tensor_b_kgm2;
+    version_++;
   }
 
  private:
   libra::Vector<3> center_of_gravity_b_m_;     //!< Position vector of center of gravity at body frame [m]
   double mass_kg_;                             //!< Mass of the satellite [kg]
   libra::Matrix<3, 3> inertia_tensor_b_kgm2_;  //!< Inertia tensor at body frame [kgm2]
+  size_t version_ = 0;                         //!< Version number incremented when the parameters are set
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_STRUCTURE_KINEMATICS_PARAMETERS_HPP_
@@ -7,6 +7,7 @@
 #define S2E_SIMULATION_SPACECRAFT_STRUCTURE_STRUCTURE_HPP_
 
 #include <simulation/simulation_configuration.hpp>
+#include <utilities/case_arena.hpp>
 #include <vector>
 
 #include "kinematics_parameters.hpp"
@@ -17,7 +18,7 @@
  * @class Structure
  * @brief Class for spacecraft structure information
  */
-class Structure {
+class Structure : public ArenaAllocated {
  public:
   /**
    * @fn Structure
@@ -41,6 +42,13 @@ class Structure {
    * @brief Return surface information
    */
   inline const std::vector<Surface>& GetSurfaces() const { return surfaces_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @brief Return memory of the structure information including the surfaces [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    return sizeof(*this) + sizeof(KinematicsParameters) + sizeof(ResidualMagneticMoment) + surfaces_.capacity() * sizeof(Surface);
+  }
   /**
    * @fn GetKinematicsParameters
    * @brief Return kinematics information
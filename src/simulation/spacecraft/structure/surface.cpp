@@ -5,6 +5,8 @@
 
 #include "surface.hpp"
 
+#include <atomic>
+
 Surface::Surface(const libra::Vector<3> position_b_m, const libra::Vector<3> normal_b, const double area_m2, const double reflectivity,
                  const double specularity, const double air_specularity)
     : position_b_m_(position_b_m),
@@ -12,4 +14,10 @@ Surface::Surface(const libra::Vector<3> position_b_m, const libra::Vector<3> nor
       area_m2_(area_m2),
       reflectivity_(reflectivity),
       specularity_(specularity),
-      air_specularity_(air_specularity) {}
+      air_specularity_(air_specularity),
+      revision_(MakeRevision()) {}
+
+unsigned long long Surface::MakeRevision() {
+  static std::atomic<unsigned long long> next_revision{1};
+  return next_revision.fetch_add(1, std::memory_order_relaxed);
+}
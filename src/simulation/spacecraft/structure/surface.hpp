@@ -57,6 +57,12 @@ class Surface {
    * @brief Return specularity of air drag of the surface
    */
   inline const double& GetAirSpecularity(void) const { return air_specularity_; }
+  /**
+   * @fn GetRevision
+   * @brief Return revision of the surface parameters. It is unique among all surfaces and changed by the setters, so the users can skip
+   *        copying the parameters which are not changed.
+   */
+  inline unsigned long long GetRevision(void) const { return revision_; }
 
   // Setter
   /**
@@ -64,13 +70,19 @@ class Surface {
    * @brief Set position vector of geometric center of the surface in body frame [m]
    * @param[in] position_b_m: Position vector of geometric center of the surface in body frame [m]
    */
-  inline void SetPosition_b_m(const libra::Vector<3> position_b_m) { position_b_m_ = position_b_m; }
+  inline void SetPosition_b_m(const libra::Vector<3> position_b_m) {
+    position_b_m_ = position_b_m;
+    revision_ = MakeRevision();
+  }
   /**
    * @fn SetNormal
    * @brief Set normal vector of the surface in body frame
    * @param[in] normal_b: Normal vector of the surface in body frame
    */
-  inline void SetNormal_b(const libra::Vector<3> normal_b) { normal_b_ = normal_b.CalcNormalizedVector(); }
+  inline void SetNormal_b(const libra::Vector<3> normal_b) {
+    normal_b_ = normal_b.CalcNormalizedVector();
+    revision_ = MakeRevision();
+  }
   /**
    * @fn SetArea_m2
    * @brief Set area of the surface
@@ -78,6 +90,7 @@ class Surface {
    */
   inline void SetArea_m2(const double area_m2) {
     if (area_m2 > 0.0) area_m2_ = area_m2;
+    revision_ = MakeRevision();
   }
   /**
    * @fn SetReflectivity
@@ -86,6 +99,7 @@ class Surface {
    */
   inline void SetReflectivity(const double reflectivity) {
     if (reflectivity >= 0.0 && reflectivity <= 1.0) reflectivity_ = reflectivity;
+    revision_ = MakeRevision();
   }
   /**
    * @fn SetSpecularity
@@ -94,6 +108,7 @@ class Surface {
    */
   inline void SetSpecularity(const double specularity) {
     if (specularity >= 0.0 && specularity <= 1.0) specularity_ = specularity;
+    revision_ = MakeRevision();
   }
   /**
    * @fn SetAirSpecularity
@@ -102,6 +117,7 @@ class Surface {
    */
   inline void SetAirSpecularity(const double air_specularity) {
     if (air_specularity >= 0.0 && air_specularity <= 1.0) air_specularity_ = air_specularity;
+    revision_ = MakeRevision();
   }
 
  private:
@@ -111,6 +127,13 @@ class Surface {
   double reflectivity_;            //!< Total reflectivity for solar wavelength (1.0 - solar absorption)
   double specularity_;             //!< Ratio of specular reflection in the total reflected light
   double air_specularity_;         //!< Specularity for air drag
+  unsigned long long revision_;    //!< Revision of the parameters
+
+  /**
+   * @fn MakeRevision
+   * @brief Return a new revision number unique in the process
+   */
+  static unsigned long long MakeRevision();
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_STRUCTURE_SURFACE_HPP_
@@ -0,0 +1,109 @@
+/**
+ * @file surface_visibility_table.cpp
+ * @brief Table of the visible (not self-shadowed) fraction of each surface over the incident direction
+ */
+
+#include "surface_visibility_table.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <math_physics/math/constants.hpp>
+
+SurfaceVisibilityTable::SurfaceVisibilityTable(const std::vector<Surface>& surfaces, const double angle_step_deg, const size_t sample_num)
+    : surface_num_(surfaces.size()) {
+  // Adjust the steps to divide the range equally
+  const double step_deg = std::max(1.0, std::min(90.0, angle_step_deg));
+  azimuth_num_ = (size_t)round(360.0 / step_deg);
+  elevation_num_ = (size_t)round(180.0 / step_deg) + 1;
+  azimuth_step_deg_ = 360.0 / (double)azimuth_num_;
+  elevation_step_deg_ = 180.0 / (double)(elevation_num_ - 1);
+
+  fractions_.assign(azimuth_num_ * elevation_num_, std::vector<double>(surface_num_, 1.0));
+  for (size_t elevation_index = 0; elevation_index < elevation_num_; elevation_index++) {
+    const double elevation_rad = (-90.0 + elevation_step_deg_ * (double)elevation_index) * libra::deg_to_rad;
+    for (size_t azimuth_index = 0; azimuth_index < azimuth_num_; azimuth_index++) {
+      const double azimuth_rad = azimuth_step_deg_ * (double)azimuth_index * libra::deg_to_rad;
+      libra::Vector<3> direction_b;
+      direction_b[0] = cos(elevation_rad) * cos(azimuth_rad);
+      direction_b[1] = cos(elevation_rad) * sin(azimuth_rad);
+      direction_b[2] = sin(elevation_rad);
+      std::vector<double>& fractions = fractions_[elevation_index * azimuth_num_ + azimuth_index];
+      for (size_t i = 0; i < surface_num_; i++) {
+        fractions[i] = CalcVisibleFractionByRayCasting(surfaces, i, direction_b, sample_num);
+      }
+    }
+  }
+}
+
+void SurfaceVisibilityTable::CalcVisibleFraction(const libra::Vector<3>& incident_direction_b, std::vector<double>& visible_fractions) const {
+  visible_fractions.resize(surface_num_);
+  const double norm = incident_direction_b.CalcNorm();
+  if (norm == 0.0) {
+    std::fill(visible_fractions.begin(), visible_fractions.end(), 1.0);
+    return;
+  }
+
+  double azimuth_deg = atan2(incident_direction_b[1], incident_direction_b[0]) * libra::rad_to_deg;
+  if (azimuth_deg < 0.0) azimuth_deg += 360.0;
+  const double elevation_deg = asin(std::max(-1.0, std::min(1.0, incident_direction_b[2] / norm))) * libra::rad_to_deg;
+
+  // Uniform grid: the azimuth wraps around 360 deg and the elevation is saturated
+  const double azimuth_position = azimuth_deg / azimuth_step_deg_;
+  const size_t azimuth_lower = std::min(azimuth_num_ - 1, (size_t)azimuth_position);
+  const size_t azimuth_upper = (azimuth_lower + 1) % azimuth_num_;
+  const double azimuth_ratio = std::max(0.0, std::min(1.0, azimuth_position - (double)azimuth_lower));
+  const double elevation_position = (elevation_deg + 90.0) / elevation_step_deg_;
+  const size_t elevation_lower = std::min(elevation_num_ - 2, (size_t)elevation_position);
+  const size_t elevation_upper = elevation_lower + 1;
+  const double elevation_ratio = std::max(0.0, std::min(1.0, elevation_position - (double)elevation_lower));
+
+  const std::vector<double>& fraction_00 = fractions_[elevation_lower * azimuth_num_ + azimuth_lower];
+  const std::vector<double>& fraction_01 = fractions_[elevation_lower * azimuth_num_ + azimuth_upper];
+  const std::vector<double>& fraction_10 = fractions_[elevation_upper * azimuth_num_ + azimuth_lower];
+  const std::vector<double>& fraction_11 = fractions_[elevation_upper * azimuth_num_ + azimuth_upper];
+  const double weight_00 = (1.0 - elevation_ratio) * (1.0 - azimuth_ratio);
+  const double weight_01 = (1.0 - elevation_ratio) * azimuth_ratio;
+  const double weight_10 = elevation_ratio * (1.0 - azimuth_ratio);
+  const double weight_11 = elevation_ratio * azimuth_ratio;
+  for (size_t i = 0; i < surface_num_; i++) {
+    visible_fractions[i] = weight_00 * fraction_00[i] + weight_01 * fraction_01[i] + weight_10 * fraction_10[i] + weight_11 * fraction_11[i];
+  }
+}
+
+double SurfaceVisibilityTable::CalcVisibleFractionByRayCasting(const std::vector<Surface>& surfaces, const size_t surface_index,
+                                                               const libra::Vector<3>& incident_direction_b, const size_t sample_num) {
+  const Surface& target = surfaces[surface_index];
+  const libra::Vector<3> normal_b = target.GetNormal_b().CalcNormalizedVector();
+  const double radius_m = sqrt(target.GetArea_m2() / libra::pi);
+  if (sample_num == 0 || radius_m == 0.0) return 1.0;
+
+  // Orthonormal basis on the surface
+  libra::Vector<3> reference_b(0.0);
+  reference_b[(fabs(normal_b[0]) < 0.9) ? 0 : 1] = 1.0;
+  const libra::Vector<3> basis_1_b = OuterProduct(normal_b, reference_b).CalcNormalizedVector();
+  const libra::Vector<3> basis_2_b = OuterProduct(normal_b, basis_1_b);
+
+  // Sample points are distributed uniformly on the disk with the golden angle spiral
+  const double golden_angle_rad = libra::pi * (3.0 - sqrt(5.0));
+  size_t visible_num = 0;
+  for (size_t k = 0; k < sample_num; k++) {
+    const double r_m = radius_m * sqrt(((double)k + 0.5) / (double)sample_num);
+    const double angle_rad = golden_angle_rad * (double)k;
+    const libra::Vector<3> origin_b_m = target.GetPosition_b_m() + r_m * cos(angle_rad) * basis_1_b + r_m * sin(angle_rad) * basis_2_b;
+
+    bool is_blocked = false;
+    for (size_t j = 0; j < surfaces.size() && !is_blocked; j++) {
+      if (j == surface_index) continue;
+      const libra::Vector<3> blocker_normal_b = surfaces[j].GetNormal_b().CalcNormalizedVector();
+      const double denominator = InnerProduct(incident_direction_b, blocker_normal_b);
+      if (fabs(denominator) < 1.0e-12) continue;
+      const double distance_m = InnerProduct(surfaces[j].GetPosition_b_m() - origin_b_m, blocker_normal_b) / denominator;
+      if (distance_m <= 1.0e-9) continue;  // Blocker should be in the incident direction
+      const libra::Vector<3> hit_offset_b_m = origin_b_m + distance_m * incident_direction_b - surfaces[j].GetPosition_b_m();
+      const double blocker_radius2_m2 = surfaces[j].GetArea_m2() / libra::pi;
+      if (InnerProduct(hit_offset_b_m, hit_offset_b_m) <= blocker_radius2_m2) is_blocked = true;
+    }
+    if (!is_blocked) visible_num++;
+  }
+  return (double)visible_num / (double)sample_num;
+}
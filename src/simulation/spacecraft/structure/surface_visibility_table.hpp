@@ -0,0 +1,86 @@
+/**
+ * @file surface_visibility_table.hpp
+ * @brief Table of the visible (not self-shadowed) fraction of each surface over the incident direction
+ */
+
+#ifndef S2E_SIMULATION_SPACECRAFT_STRUCTURE_SURFACE_VISIBILITY_TABLE_HPP_
+#define S2E_SIMULATION_SPACECRAFT_STRUCTURE_SURFACE_VISIBILITY_TABLE_HPP_
+
+#include <vector>
+
+#include "surface.hpp"
+
+/**
+ * @class SurfaceVisibilityTable
+ * @brief Table of the visible (not self-shadowed) fraction of each surface over the incident direction
+ * @details Each surface is modeled as a disk with the same area. The fraction is calculated at the initialization by casting rays from sample
+ *          points on the surface to the incident direction and checking the intersection with the other surfaces. The incident direction is
+ *          tabulated on a uniform azimuth/elevation grid in the body frame and bilinearly interpolated at run time.
+ */
+class SurfaceVisibilityTable {
+ public:
+  /**
+   * @fn SurfaceVisibilityTable
+   * @brief Default constructor. The table is empty.
+   */
+  SurfaceVisibilityTable() : surface_num_(0), azimuth_num_(0), elevation_num_(0), azimuth_step_deg_(0.0), elevation_step_deg_(0.0) {}
+  /**
+   * @fn SurfaceVisibilityTable
+   * @brief Constructor to calculate the table
+   * @param [in] surfaces: Surfaces of the spacecraft
+   * @param [in] angle_step_deg: Step of the azimuth and elevation grid [deg]. It is adjusted to divide the range equally.
+   * @param [in] sample_num: Number of sample points on each surface
+   */
+  SurfaceVisibilityTable(const std::vector<Surface>& surfaces, const double angle_step_deg, const size_t sample_num);
+
+  /**
+   * @fn CalcVisibleFraction
+   * @brief Calculate the visible fraction of all surfaces by the interpolation
+   * @param [in] incident_direction_b: Direction to the disturbance source (e.g., sun or air flow) in the body frame
+   * @param [out] visible_fractions: Visible fraction of each surface (0 to 1)
+   */
+  void CalcVisibleFraction(const libra::Vector<3>& incident_direction_b, std::vector<double>& visible_fractions) const;
+
+  // Getters
+  /**
+   * @fn IsEnabled
+   * @return True when the table has values
+   */
+  inline bool IsEnabled() const { return surface_num_ > 0; }
+  /**
+   * @fn GetSurfaceNum
+   * @return Number of surfaces
+   */
+  inline size_t GetSurfaceNum() const { return surface_num_; }
+  /**
+   * @fn GetMemoryUsage_bytes
+   * @return Memory of the table [bytes]
+   */
+  inline size_t GetMemoryUsage_bytes() const {
+    size_t bytes = sizeof(*this) + fractions_.capacity() * sizeof(std::vector<double>);
+    for (const auto& fractions : fractions_) bytes += fractions.capacity() * sizeof(double);
+    return bytes;
+  }
+
+ private:
+  size_t surface_num_;                          //!< Number of surfaces
+  size_t azimuth_num_;                          //!< Number of azimuth grid points in [0, 360)
+  size_t elevation_num_;                        //!< Number of elevation grid points in [-90, 90]
+  double azimuth_step_deg_;                     //!< Step of the azimuth grid [deg]
+  double elevation_step_deg_;                   //!< Step of the elevation grid [deg]
+  std::vector<std::vector<double>> fractions_;  //!< Visible fraction of each surface. The index is (elevation index * azimuth num + azimuth index).
+
+  /**
+   * @fn CalcVisibleFractionByRayCasting
+   * @brief Calculate the visible fraction of a surface for an incident direction
+   * @param [in] surfaces: Surfaces of the spacecraft
+   * @param [in] surface_index: Index of the target surface
+   * @param [in] incident_direction_b: Unit vector to the disturbance source in the body frame
+   * @param [in] sample_num: Number of sample points on the surface
+   * @return Visible fraction
+   */
+  static double CalcVisibleFractionByRayCasting(const std::vector<Surface>& surfaces, const size_t surface_index,
+                                                const libra::Vector<3>& incident_direction_b, const size_t sample_num);
+};
+
+#endif  // S2E_SIMULATION_SPACECRAFT_STRUCTURE_SURFACE_VISIBILITY_TABLE_HPP_
@@ -0,0 +1,121 @@
+/**
+ * @file test_constellation_builder.cpp
+ * @brief Test codes for ConstellationBuilder class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <environment/global/physical_constants.hpp>
+#include <fstream>
+#include <iomanip>
+#include <math_physics/math/constants.hpp>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "constellation_builder.hpp"
+
+namespace {
+const std::string kTemplateFile = "test_constellation_builder.ini";
+const double kSemiMajorAxis_m = 7000.0e3;
+const double kRaan_rad = 0.1;
+const double kEpoch_jday = 2458940.5;
+
+/**
+ * @fn WriteTemplateFile
+ * @brief Write the template spacecraft file with the orbital elements
+ */
+void WriteTemplateFile() {
+  std::ofstream file(kTemplateFile);
+  file << std::setprecision(17) << "[ORBIT]\ninitialize_mode = POSITION_VELOCITY_I\nsemi_major_axis_m = " << kSemiMajorAxis_m
+       << "\neccentricity = 0.0\ninclination_rad = 0.9\nraan_rad = " << kRaan_rad << "\nargument_of_perigee_rad = 0.0\nepoch_jday = " << kEpoch_jday
+       << "\n";
+}
+
+/**
+ * @fn CalcAngleDifference_rad
+ * @brief Return the difference of the angles in [-pi, pi) [rad]
+ */
+double CalcAngleDifference_rad(const double angle_rad, const double reference_rad) {
+  return std::remainder(angle_rad - reference_rad, libra::tau);
+}
+
+/**
+ * @fn CheckWalkerPattern
+ * @brief Check the RAAN and the mean anomaly of the members against the Walker pattern
+ * @param [in] pattern: Pattern of the constellation
+ * @param [in] number_of_spacecraft: Total number of the spacecraft T
+ * @param [in] number_of_planes: Number of the orbit planes P
+ * @param [in] phasing_parameter: Phasing parameter F
+ */
+void CheckWalkerPattern(const ConstellationPattern pattern, const size_t number_of_spacecraft, const size_t number_of_planes,
+                        const size_t phasing_parameter) {
+  const std::vector<std::string> member_files =
+      ConstellationBuilder(kTemplateFile, pattern, number_of_spacecraft, number_of_planes, phasing_parameter).Build();
+  ASSERT_EQ(number_of_spacecraft, member_files.size());
+
+  const double mean_motion_rad_s = sqrt(environment::earth_gravitational_constant_m3_s2 / pow(kSemiMajorAxis_m, 3.0));
+  const double raan_spread_rad = pattern == ConstellationPattern::kWalkerStar ? libra::pi : libra::tau;
+  const size_t number_of_spacecraft_per_plane = number_of_spacecraft / number_of_planes;
+  for (size_t member_id = 0; member_id < member_files.size(); member_id++) {
+    const size_t plane_id = member_id / number_of_spacecraft_per_plane;
+    const size_t spacecraft_id = member_id % number_of_spacecraft_per_plane;
+    IniAccess member_ini(member_files[member_id]);
+    EXPECT_EQ("ORBITAL_ELEMENTS", member_ini.ReadString("ORBIT", "initialize_mode"));
+    EXPECT_DOUBLE_EQ(kSemiMajorAxis_m, member_ini.ReadDouble("ORBIT", "semi_major_axis_m"));
+    EXPECT_DOUBLE_EQ(0.9, member_ini.ReadDouble("ORBIT", "inclination_rad"));
+
+    const double expected_raan_rad = kRaan_rad + raan_spread_rad * plane_id / number_of_planes;
+    EXPECT_NEAR(0.0, CalcAngleDifference_rad(member_ini.ReadDouble("ORBIT", "raan_rad"), expected_raan_rad), 1e-12);
+
+    // The mean anomaly at the template epoch is the time from the member epoch multiplied by the mean motion
+    const double mean_anomaly_rad = (kEpoch_jday - member_ini.ReadDouble("ORBIT", "epoch_jday")) * 24.0 * 60.0 * 60.0 * mean_motion_rad_s;
+    const double expected_mean_anomaly_rad = libra::tau * spacecraft_id / number_of_spacecraft_per_plane +
+                                             libra::tau * (double)(phasing_parameter * plane_id) / number_of_spacecraft;
+    EXPECT_NEAR(0.0, CalcAngleDifference_rad(mean_anomaly_rad, expected_mean_anomaly_rad), 1e-6);
+  }
+}
+}  // namespace
+
+/**
+ * @brief Test for the conversion of the pattern name
+ */
+TEST(ConstellationBuilder, SetConstellationPattern) {
+  EXPECT_EQ(ConstellationPattern::kWalkerDelta, SetConstellationPattern("WALKER_DELTA"));
+  EXPECT_EQ(ConstellationPattern::kWalkerStar, SetConstellationPattern("WALKER_STAR"));
+  EXPECT_EQ(ConstellationPattern::kDisable, SetConstellationPattern("DISABLE"));
+  EXPECT_EQ(ConstellationPattern::kDisable, SetConstellationPattern("FLOWER"));
+}
+
+/**
+ * @brief Test for the RAAN and the phasing of the Walker patterns
+ */
+TEST(ConstellationBuilder, WalkerPattern) {
+  WriteTemplateFile();
+  CheckWalkerPattern(ConstellationPattern::kWalkerDelta, 24, 6, 0);
+  CheckWalkerPattern(ConstellationPattern::kWalkerDelta, 24, 6, 5);
+  CheckWalkerPattern(ConstellationPattern::kWalkerStar, 6, 3, 1);
+  CheckWalkerPattern(ConstellationPattern::kWalkerDelta, 1, 1, 0);
+
+  // The template itself is not changed
+  IniAccess template_ini(kTemplateFile);
+  EXPECT_EQ("POSITION_VELOCITY_I", template_ini.ReadString("ORBIT", "initialize_mode"));
+  std::remove(kTemplateFile.c_str());
+  IniAccess::ClearCache();
+}
+
+/**
+ * @brief Test for the invalid settings
+ */
+TEST(ConstellationBuilder, InvalidSetting) {
+  WriteTemplateFile();
+  EXPECT_TRUE(ConstellationBuilder(kTemplateFile, ConstellationPattern::kDisable, 24, 6, 1).Build().empty());
+  EXPECT_TRUE(ConstellationBuilder(kTemplateFile, ConstellationPattern::kWalkerDelta, 0, 6, 1).Build().empty());
+  EXPECT_THROW(ConstellationBuilder(kTemplateFile, ConstellationPattern::kWalkerDelta, 25, 6, 1).Build(), std::invalid_argument);
+  EXPECT_THROW(ConstellationBuilder(kTemplateFile, ConstellationPattern::kWalkerDelta, 24, 6, 6).Build(), std::invalid_argument);
+  EXPECT_THROW(ConstellationBuilder(kTemplateFile, ConstellationPattern::kWalkerDelta, 24, 0, 0).Build(), std::invalid_argument);
+  std::remove(kTemplateFile.c_str());
+  IniAccess::ClearCache();
+}
@@ -0,0 +1,50 @@
+/**
+ * @file benchmark_sample_case.cpp
+ * @brief Benchmark codes for the end-to-end simulation of the sample case and the SPICE state query
+ */
+#include <chrono>
+#include <environment/global/spice_access.hpp>
+#include <iostream>
+#include <string>
+#include <utilities/benchmark_measurement.hpp>
+
+#include "sample_case.hpp"
+
+int main(int argc, char *argv[]) {
+  std::string ini_file = std::string(INI_FILE_DIR_FROM_EXE) + "/sample_simulation_base.ini";
+  if (argc > 1) ini_file = std::string(argv[1]);
+
+  SampleCase simulation_case(ini_file);
+  simulation_case.Initialize();
+  const SimulationTime &simulation_time = simulation_case.GetGlobalEnvironment().GetSimulationTime();
+
+  // SPICE kernels are loaded in the initialization of the celestial information
+  double ephemeris_time = simulation_time.GetStartEphemerisTime();
+  double state_km[6];
+  double sum_position_km = 0.0;
+  const double spice_ns = MeasureNanosecondsPerCall(
+      [&]() {
+        ephemeris_time += 0.1;
+        SpiceAccess::GetState("SUN", ephemeris_time, "J2000", "NONE", "EARTH", state_km);
+        sum_position_km += state_km[0];
+      },
+      100000);
+  // Use the results to avoid optimization
+  if (sum_position_km != sum_position_km) {
+    std::cout << "NaN detected" << std::endl;
+  }
+
+  // The real time pacing should be disabled (simulation_speed_setting = 0) in the initialize file to measure the calculation time
+  const double number_of_steps = simulation_time.GetEndTime_s() / simulation_time.GetSimulationStep_s();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  simulation_case.Main();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  const double main_s = std::chrono::duration<double>(end - start).count();
+
+  std::cout << std::endl;
+  std::cout << "SPICE state query [ns/call], simulation steps, simulation [s], simulation [us/step], simulation speed [x real time]" << std::endl;
+  std::cout << spice_ns << ", " << number_of_steps << ", " << main_s << ", " << main_s * 1.0e6 / number_of_steps << ", "
+            << simulation_time.GetEndTime_s() / main_s << std::endl;
+
+  return 0;
+}
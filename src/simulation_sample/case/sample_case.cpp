@@ -5,31 +5,174 @@
 
 #include "sample_case.hpp"
 
+#include <algorithm>
+#include <iostream>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <simulation/ground_station/ground_station_pass_prediction.hpp>
+#include <stdexcept>
+
 SampleCase::SampleCase(std::string initialise_base_file) : SimulationCase(initialise_base_file) {}
 
 SampleCase::~SampleCase() {
-  delete sample_spacecraft_;
+  for (auto spacecraft : sample_spacecraft_list_) {
+    delete spacecraft;
+  }
   delete sample_ground_station_;
 }
 
 void SampleCase::InitializeTargetObjects() {
   // Instantiate the target of the simulation
   // `spacecraft_id` corresponds to the index of `spacecraft_file` in simulation_base.ini
-  const int spacecraft_id = 0;
-  sample_spacecraft_ = new SampleSpacecraft(&simulation_configuration_, global_environment_, spacecraft_id);
+  const unsigned int number_of_spacecraft = std::max(simulation_configuration_.number_of_simulated_spacecraft_, 1u);
+  if (simulation_configuration_.spacecraft_file_list_.size() < number_of_spacecraft) {
+    throw std::invalid_argument("The number of spacecraft_file is less than number_of_simulated_spacecraft.");
+  }
+  // In the distributed simulation, the other spacecraft are simulated in the other processes
+  for (unsigned int spacecraft_id = 0; spacecraft_id < number_of_spacecraft; spacecraft_id++) {
+    if (!IsLocalSpacecraft(spacecraft_id)) continue;
+    sample_spacecraft_list_.push_back(new SampleSpacecraft(&simulation_configuration_, global_environment_, spacecraft_id));
+    spacecraft_list_.push_back(sample_spacecraft_list_.back());
+    if (distributed_node_ != nullptr) {
+      distributed_node_->RegisterLocalSpacecraft(spacecraft_id, &(sample_spacecraft_list_.back()->GetDynamics()));
+    }
+  }
+  if (sample_spacecraft_list_.empty()) {
+    throw std::invalid_argument("No spacecraft is assigned to this process. number_of_nodes must not exceed number_of_simulated_spacecraft.");
+  }
   const int ground_station_id = 0;
   sample_ground_station_ = new SampleGroundStation(&simulation_configuration_, ground_station_id);
+  PredictGroundStationPasses();
 
   // Register the log output
-  sample_spacecraft_->LogSetup(*(simulation_configuration_.main_logger_));
+  for (auto spacecraft : sample_spacecraft_list_) {
+    spacecraft->LogSetup(*(simulation_configuration_.main_logger_));
+  }
   sample_ground_station_->LogSetup(*(simulation_configuration_.main_logger_));
+
+  InitializeCoverageMap();
+
+  // Register the switching functions of the first spacecraft for the event detection
+  if (simulation_configuration_.is_event_detection_enabled_) {
+    const Orbit* orbit = &(sample_spacecraft_list_[0]->GetDynamics().GetOrbit());
+    const SolarRadiationPressureEnvironment* srp = &(sample_spacecraft_list_[0]->GetLocalEnvironment().GetSolarRadiationPressure());
+    const GroundStation* ground_station = sample_ground_station_;
+    const double elevation_limit_rad = ground_station->GetElevationLimitAngle_deg() * libra::deg_to_rad;
+    event_detector_.AddSwitchingFunction([orbit, srp]() { return srp->CalcPenumbraSwitchingFunction_rad(orbit->GetPosition_i_m()); },
+                                         "PENUMBRA_EXIT", "PENUMBRA_ENTRY");
+    event_detector_.AddSwitchingFunction([orbit, srp]() { return srp->CalcUmbraSwitchingFunction_rad(orbit->GetPosition_i_m()); }, "UMBRA_EXIT",
+                                         "UMBRA_ENTRY");
+    event_detector_.AddSwitchingFunction(
+        [orbit, ground_station, elevation_limit_rad]() {
+          return ground_station->CalcElevationAngle_rad(orbit->GetPosition_ecef_m()) - elevation_limit_rad;
+        },
+        "AOS", "LOS");
+    // The z component of the position has the same sign with the sine of the argument of latitude
+    event_detector_.AddSwitchingFunction([orbit]() { return orbit->GetPosition_i_m()[2]; }, "ASCENDING_NODE", "DESCENDING_NODE");
+    // The radial velocity changes from negative to positive at the periapsis
+    event_detector_.AddSwitchingFunction([orbit]() { return InnerProduct(orbit->GetPosition_i_m(), orbit->GetVelocity_i_m_s()); }, "PERIAPSIS",
+                                         "APOAPSIS");
+  }
 }
 
 void SampleCase::UpdateTargetObjects() {
   // Spacecraft Update
-  sample_spacecraft_->Update(&(global_environment_->GetSimulationTime()));
+  UpdateSpacecraft(spacecraft_list_);
   // Ground Station Update
-  sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *sample_spacecraft_);
+  sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *sample_spacecraft_list_[0]);
+  // Coverage map Update
+  UpdateCoverageMap();
+}
+
+void SampleCase::SaveTargetObjectsSnapshot(SnapshotWriter& snapshot) const {
+  for (auto spacecraft : sample_spacecraft_list_) {
+    spacecraft->SaveSnapshot(snapshot);
+  }
+}
+
+void SampleCase::LoadTargetObjectsSnapshot(SnapshotReader& snapshot) {
+  for (auto spacecraft : sample_spacecraft_list_) {
+    spacecraft->LoadSnapshot(snapshot);
+  }
+}
+
+void SampleCase::AddTargetObjectsMemoryUsage(MemoryUsage& memory_usage) const {
+  for (auto spacecraft : sample_spacecraft_list_) {
+    memory_usage.AddChild(spacecraft->GetMemoryUsage());
+  }
+  memory_usage.AddChild(MemoryUsage("SampleGroundStation", sizeof(SampleGroundStation)));
+  if (coverage_map_ != nullptr) {
+    const size_t number_of_cells = coverage_map_->GetNumberOfCells();
+    memory_usage.AddChild(MemoryUsage("CoverageMap", sizeof(CoverageMap) + number_of_cells * (sizeof(unsigned int) + 3 * sizeof(double))));
+  }
+}
+
+const Spacecraft* SampleCase::GetOrbitLifetimeTarget() const {
+  if (sample_spacecraft_list_.empty()) return nullptr;
+  return sample_spacecraft_list_[0];
+}
+
+void SampleCase::FinishTargetObjects() {
+  if (coverage_map_ == nullptr) return;
+  const std::string file_path = simulation_configuration_.main_logger_->GetLogPath() + "coverage_map.csv";
+  if (!coverage_map_->WriteCoverageMap(file_path)) {
+    std::cout << "[Warning] Coverage map file " << file_path << " cannot be written." << std::endl;
+    return;
+  }
+  std::cout << "Coverage ratio: " << coverage_map_->GetCoveredRatio() * 100.0 << "%" << std::endl;
+}
+
+void SampleCase::PredictGroundStationPasses() const {
+  IniAccess simulation_base_ini(simulation_configuration_.initialize_base_file_name_);
+  const char* section = "PASS_PREDICTION";
+  if (!simulation_base_ini.ReadEnable(section, "pass_prediction")) return;
+
+  Sgp4Catalogue catalogue;
+  const std::string tle_file = simulation_base_ini.ReadString(section, "tle_file");
+  if (catalogue.ReadTleFile(tle_file) == 0) {
+    std::cout << "[Warning] No spacecraft is found in the TLE file " << tle_file << ". The pass prediction is skipped." << std::endl;
+    return;
+  }
+  GroundStationPassPrediction prediction(catalogue, simulation_base_ini.ReadDouble(section, "coarse_step_s"));
+  prediction.AddGroundStation(*sample_ground_station_);
+
+  const SimulationTime& simulation_time = global_environment_->GetSimulationTime();
+  const unsigned int number_of_threads = (unsigned int)std::max(simulation_base_ini.ReadInt(section, "number_of_threads"), 1);
+  prediction.Predict(simulation_time.GetCurrentTime_jd(), simulation_time.GetEndTime_s(), number_of_threads);
+  prediction.WriteContactPlan(simulation_configuration_.main_logger_->GetLogPath() + "contact_plan.csv");
+  std::cout << "Pass prediction: " << prediction.GetPasses().size() << " passes" << std::endl;
+}
+
+void SampleCase::InitializeCoverageMap() {
+  IniAccess simulation_base_ini(simulation_configuration_.initialize_base_file_name_);
+  const char* section = "COVERAGE_MAP";
+  if (!simulation_base_ini.ReadEnable(section, "coverage_map")) return;
+
+  coverage_update_interval_s_ = simulation_base_ini.ReadDouble(section, "update_interval_s");
+  coverage_half_angle_rad_ = simulation_base_ini.ReadDouble(section, "field_of_view_half_angle_deg") * libra::deg_to_rad;
+  number_of_coverage_threads_ = (unsigned int)std::max(simulation_base_ini.ReadInt(section, "number_of_threads"), 1);
+  const int number_of_latitude_cells = simulation_base_ini.ReadInt(section, "number_of_latitude_cells");
+  const int number_of_longitude_cells = simulation_base_ini.ReadInt(section, "number_of_longitude_cells");
+  if (coverage_update_interval_s_ <= 0.0 || number_of_latitude_cells <= 0 || number_of_longitude_cells <= 0) {
+    throw std::invalid_argument("The update interval and the numbers of the cells of the coverage map must be positive.");
+  }
+  // The cells covered in the consecutive updates belong to the same pass
+  const double pass_gap_s = 1.5 * coverage_update_interval_s_;
+  coverage_map_ = std::make_unique<CoverageMap>((size_t)number_of_latitude_cells, (size_t)number_of_longitude_cells, pass_gap_s);
+  next_coverage_update_time_s_ = 0.0;
+}
+
+void SampleCase::UpdateCoverageMap() {
+  if (coverage_map_ == nullptr) return;
+  const double elapsed_time_s = global_environment_->GetSimulationTime().GetElapsedTime_s();
+  if (elapsed_time_s < next_coverage_update_time_s_) return;
+  next_coverage_update_time_s_ += coverage_update_interval_s_;
+
+  coverage_footprints_.clear();
+  for (auto spacecraft : sample_spacecraft_list_) {
+    const GeodeticPosition position = spacecraft->GetDynamics().GetOrbit().GetGeodeticPosition();
+    coverage_footprints_.push_back(CoverageMap::CalcFootprint(position, coverage_half_angle_rad_));
+  }
+  coverage_map_->Update(coverage_footprints_, elapsed_time_s, number_of_coverage_threads_);
 }
 
 std::string SampleCase::GetLogHeader() const {
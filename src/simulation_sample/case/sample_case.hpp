@@ -6,7 +6,10 @@
 #ifndef S2E_SIMULATION_SAMPLE_CASE_SAMPLE_CASE_HPP_
 #define S2E_SIMULATION_SAMPLE_CASE_SAMPLE_CASE_HPP_
 
+#include <memory>
 #include <src/simulation/case/simulation_case.hpp>
+#include <src/simulation/ground_station/coverage_map.hpp>
+#include <vector>
 
 #include "../ground_station/sample_ground_station.hpp"
 #include "../spacecraft/sample_spacecraft.hpp"
@@ -41,8 +44,17 @@ class SampleCase : public SimulationCase {
   virtual std::string GetLogValue() const;
 
  private:
-  SampleSpacecraft* sample_spacecraft_;         //!< Instance of spacecraft
-  SampleGroundStation* sample_ground_station_;  //!< Instance of ground station
+  std::vector<SampleSpacecraft*> sample_spacecraft_list_;  //!< Instances of spacecraft. The first one is the target of the ground station.
+  std::vector<Spacecraft*> spacecraft_list_;               //!< Spacecraft list for the update
+  SampleGroundStation* sample_ground_station_;             //!< Instance of ground station
+
+  // Coverage map of the nadir pointing sensors of all spacecraft
+  std::unique_ptr<CoverageMap> coverage_map_;           //!< Coverage map (nullptr when it is disabled)
+  std::vector<CoverageFootprint> coverage_footprints_;  //!< Footprints of the spacecraft in the latest update
+  double coverage_update_interval_s_ = 0.0;             //!< Update interval of the coverage map [sec]
+  double next_coverage_update_time_s_ = 0.0;            //!< Elapsed time of the next update of the coverage map [sec]
+  double coverage_half_angle_rad_ = 0.0;                //!< Half angle of the field of view of the sensors [rad]
+  unsigned int number_of_coverage_threads_ = 1;         //!< Number of the threads to update the coverage map
 
   /**
    * @fn InitializeTargetObjects
@@ -55,6 +67,48 @@ class SampleCase : public SimulationCase {
    * @brief Override function of Main in SimulationCase
    */
   void UpdateTargetObjects();
+
+  /**
+   * @fn SaveTargetObjectsSnapshot
+   * @brief Override function of SaveTargetObjectsSnapshot in SimulationCase
+   */
+  void SaveTargetObjectsSnapshot(SnapshotWriter& snapshot) const;
+  /**
+   * @fn LoadTargetObjectsSnapshot
+   * @brief Override function of LoadTargetObjectsSnapshot in SimulationCase
+   */
+  void LoadTargetObjectsSnapshot(SnapshotReader& snapshot);
+  /**
+   * @fn AddTargetObjectsMemoryUsage
+   * @brief Override function of AddTargetObjectsMemoryUsage in SimulationCase
+   */
+  void AddTargetObjectsMemoryUsage(MemoryUsage& memory_usage) const;
+  /**
+   * @fn GetOrbitLifetimeTarget
+   * @brief Override function of GetOrbitLifetimeTarget in SimulationCase
+   */
+  const Spacecraft* GetOrbitLifetimeTarget() const;
+  /**
+   * @fn FinishTargetObjects
+   * @brief Override function of FinishTargetObjects in SimulationCase
+   */
+  void FinishTargetObjects();
+
+  /**
+   * @fn PredictGroundStationPasses
+   * @brief Predict the passes of the spacecraft in the TLE file over the ground station in the simulation duration
+   */
+  void PredictGroundStationPasses() const;
+  /**
+   * @fn InitializeCoverageMap
+   * @brief Read the coverage map settings from the simulation base file
+   */
+  void InitializeCoverageMap();
+  /**
+   * @fn UpdateCoverageMap
+   * @brief Update the coverage map with the footprints of the spacecraft at the update interval
+   */
+  void UpdateCoverageMap();
 };
 
 #endif  // S2E_SIMULATION_SAMPLE_CASE_SAMPLE_CASE_HPP_
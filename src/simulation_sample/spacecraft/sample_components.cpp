@@ -82,6 +82,8 @@ SampleComponents::SampleComponents(const Dynamics* dynamics, Structure* structur
   file_name = iniAccess.ReadString("COMPONENT_FILES", "thruster_file");
   configuration_->main_logger_->CopyFileToLogDirectory(file_name);
   thruster_ = new SimpleThruster(InitSimpleThruster(clock_generator, pcu_->GetPowerPort(2), 1, file_name, structure_, dynamics));
+  const double component_step_time_s = global_environment_->GetSimulationTime().GetComponentStepTime_s();
+  thruster_cluster_ = new ThrusterCluster(InitThrusterCluster(clock_generator, file_name, component_step_time_s, structure_, dynamics));
 
   // Mission
   const std::string telescope_ini_path = iniAccess.ReadString("COMPONENT_FILES", "telescope_file");
@@ -134,6 +136,14 @@ SampleComponents::SampleComponents(const Dynamics* dynamics, Structure* structur
   // UART tutorial. Comment out when not in use.
   // exp_hils_uart_responder_ = new ExampleSerialCommunicationForHils(clock_generator, 1, obc_, 3, 9600, hils_port_manager_, 1);
   // exp_hils_uart_sender_ = new ExampleSerialCommunicationForHils(clock_generator, 0, obc_, 4, 9600, hils_port_manager_, 0);
+  // To connect the ports through UDP instead of the COM ports (Linux), register the ports before creating the examples.
+  // HilsNetworkPortConfig responder_config, sender_config;
+  // responder_config.local_port = 50003;
+  // responder_config.remote_port = 50004;
+  // sender_config.local_port = 50004;
+  // sender_config.remote_port = 50003;
+  // hils_port_manager_->RegisterNetworkPort(3, responder_config);
+  // hils_port_manager_->RegisterNetworkPort(4, sender_config);
 
   // I2C tutorial. Comment out when not in use.
   // exp_hils_i2c_controller_ = new ExampleI2cControllerForHils(30, clock_generator, 5, 115200, 256, 256, hils_port_manager_);
@@ -147,6 +157,7 @@ SampleComponents::SampleComponents(const Dynamics* dynamics, Structure* structur
   // reaction_wheel_->SetTargetTorque_rw_Nm(0.01);
   // reaction_wheel_->SetDriveFlag(true);
   // thruster_->SetDuty(0.9);
+  // thruster_cluster_->SetDuty(0, 0.9);
 
   // force generator debug output
   // libra::Vector<3> force_N;
@@ -172,6 +183,7 @@ SampleComponents::~SampleComponents() {
   delete magnetorquer_;
   delete reaction_wheel_;
   delete thruster_;
+  delete thruster_cluster_;
   delete force_generator_;
   delete torque_generator_;
   delete angular_velocity_observer_;
@@ -205,6 +217,11 @@ libra::Vector<3> SampleComponents::GenerateTorque_b_Nm() {
   return torque_b_Nm_;
 }
 
+void SampleComponents::GenerateOutputSchedule(ActuatorOutputSchedule& schedule, const double interval_s) {
+  // The thrust of the thruster cluster is integrated with the on and off timings instead of the averaged thrust
+  thruster_cluster_->ReportOutputSchedule(schedule, interval_s);
+}
+
 void SampleComponents::ComponentInterference() { mtq_magnetometer_interference_->UpdateInterference(); }
 
 void SampleComponents::LogSetup(Logger& logger) {
@@ -216,6 +233,7 @@ void SampleComponents::LogSetup(Logger& logger) {
   logger.AddLogList(magnetorquer_);
   logger.AddLogList(reaction_wheel_);
   logger.AddLogList(thruster_);
+  logger.AddLogList(thruster_cluster_);
   logger.AddLogList(telescope_);
   logger.AddLogList(force_generator_);
   logger.AddLogList(torque_generator_);
@@ -223,3 +241,50 @@ void SampleComponents::LogSetup(Logger& logger) {
   logger.AddLogList(attitude_observer_);
   logger.AddLogList(orbit_observer_);
 }
+
+void SampleComponents::SaveSnapshot(SnapshotWriter& snapshot) const {
+  snapshot.WriteTag("SAMPLE_COMPONENTS");
+  gyro_sensor_->SaveSnapshot(snapshot);
+  magnetometer_->SaveSnapshot(snapshot);
+  star_sensor_->SaveSnapshot(snapshot);
+  sun_sensor_->SaveSnapshot(snapshot);
+  magnetorquer_->SaveSnapshot(snapshot);
+  reaction_wheel_->SaveSnapshot(snapshot);
+  mtq_magnetometer_interference_->SaveSnapshot(snapshot);
+}
+
+void SampleComponents::LoadSnapshot(SnapshotReader& snapshot) {
+  snapshot.ReadTag("SAMPLE_COMPONENTS");
+  gyro_sensor_->LoadSnapshot(snapshot);
+  magnetometer_->LoadSnapshot(snapshot);
+  star_sensor_->LoadSnapshot(snapshot);
+  sun_sensor_->LoadSnapshot(snapshot);
+  magnetorquer_->LoadSnapshot(snapshot);
+  reaction_wheel_->LoadSnapshot(snapshot);
+  mtq_magnetometer_interference_->LoadSnapshot(snapshot);
+}
+
+MemoryUsage SampleComponents::GetMemoryUsage() const {
+  MemoryUsage memory_usage("SampleComponents", sizeof(*this));
+  // Components
+  memory_usage.AddChild(MemoryUsage("OnBoardComputer", sizeof(OnBoardComputer)));
+  memory_usage.AddChild(MemoryUsage("PowerControlUnit", sizeof(PowerControlUnit)));
+  memory_usage.AddChild(MemoryUsage("GyroSensor", sizeof(GyroSensor)));
+  memory_usage.AddChild(MemoryUsage("Magnetometer", sizeof(Magnetometer)));
+  memory_usage.AddChild(MemoryUsage("StarSensor", sizeof(StarSensor)));
+  memory_usage.AddChild(MemoryUsage("SunSensor", sizeof(SunSensor)));
+  memory_usage.AddChild(MemoryUsage("GnssReceiver", sizeof(GnssReceiver)));
+  memory_usage.AddChild(MemoryUsage("Magnetorquer", sizeof(Magnetorquer)));
+  memory_usage.AddChild(MemoryUsage("ReactionWheel", sizeof(ReactionWheel)));
+  memory_usage.AddChild(MemoryUsage("SimpleThruster", sizeof(SimpleThruster)));
+  memory_usage.AddChild(MemoryUsage("ThrusterCluster", sizeof(ThrusterCluster)));
+  memory_usage.AddChild(MemoryUsage("ForceGenerator", sizeof(ForceGenerator)));
+  memory_usage.AddChild(MemoryUsage("TorqueGenerator", sizeof(TorqueGenerator)));
+  memory_usage.AddChild(MemoryUsage("AngularVelocityObserver", sizeof(AngularVelocityObserver)));
+  memory_usage.AddChild(MemoryUsage("AttitudeObserver", sizeof(AttitudeObserver)));
+  memory_usage.AddChild(MemoryUsage("OrbitObserver", sizeof(OrbitObserver)));
+  memory_usage.AddChild(MemoryUsage("Telescope", sizeof(Telescope)));
+  memory_usage.AddChild(MemoryUsage("Antenna", sizeof(Antenna)));
+  memory_usage.AddChild(MemoryUsage("MtqMagnetometerInterference", sizeof(MtqMagnetometerInterference)));
+  return memory_usage;
+}
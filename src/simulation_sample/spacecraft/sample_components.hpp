@@ -28,6 +28,7 @@
 #include <components/real/mission/telescope.hpp>
 #include <components/real/power/power_control_unit.hpp>
 #include <components/real/propulsion/simple_thruster.hpp>
+#include <components/real/propulsion/thruster_cluster.hpp>
 #include <dynamics/dynamics.hpp>
 #include <math_physics/math/vector.hpp>
 #include <simulation/hils/hils_port_manager.hpp>
@@ -44,6 +45,7 @@ class GnssReceiver;
 class Magnetorquer;
 class ReactionWheel;
 class SimpleThruster;
+class ThrusterCluster;
 class ForceGenerator;
 class TorqueGenerator;
 class AngularVelocityObserver;
@@ -80,6 +82,11 @@ class SampleComponents : public InstalledComponents {
    * @brief Return torque generated by components in unit Newton-meter in body fixed frame
    */
   libra::Vector<3> GenerateTorque_b_Nm() override;
+  /**
+   * @fn GenerateOutputSchedule
+   * @brief Collect the PWM output schedule of the thruster cluster
+   */
+  void GenerateOutputSchedule(ActuatorOutputSchedule& schedule, const double interval_s) override;
   /**
    * @fn ComponentInterference
    * @brief Handle component interference effect
@@ -92,6 +99,22 @@ class SampleComponents : public InstalledComponents {
    */
   void LogSetup(Logger& logger) override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the internal states of the components to the snapshot
+   */
+  void SaveSnapshot(SnapshotWriter& snapshot) const override;
+  /**
+   * @fn LoadSnapshot
+   * @brief Restore the internal states of the components from the snapshot
+   */
+  void LoadSnapshot(SnapshotReader& snapshot) override;
+  /**
+   * @fn GetMemoryUsage
+   * @brief Return the memory usage of the components
+   */
+  MemoryUsage GetMemoryUsage() const override;
+
   // Getter
   inline Antenna& GetAntenna() const { return *antenna_; }
 
@@ -101,14 +124,15 @@ class SampleComponents : public InstalledComponents {
   HilsPortManager* hils_port_manager_;  //!< Port manager for HILS test
 
   // AOCS
-  GyroSensor* gyro_sensor_;        //!< GyroSensor sensor
-  Magnetometer* magnetometer_;     //!< Magnetometer
-  StarSensor* star_sensor_;        //!< Star sensor
-  SunSensor* sun_sensor_;          //!< Sun sensor
-  GnssReceiver* gnss_receiver_;    //!< GNSS receiver
-  Magnetorquer* magnetorquer_;     //!< Magnetorquer
-  ReactionWheel* reaction_wheel_;  //!< Reaction Wheel
-  SimpleThruster* thruster_;       //!< Thruster
+  GyroSensor* gyro_sensor_;            //!< GyroSensor sensor
+  Magnetometer* magnetometer_;         //!< Magnetometer
+  StarSensor* star_sensor_;            //!< Star sensor
+  SunSensor* sun_sensor_;              //!< Sun sensor
+  GnssReceiver* gnss_receiver_;        //!< GNSS receiver
+  Magnetorquer* magnetorquer_;         //!< Magnetorquer
+  ReactionWheel* reaction_wheel_;      //!< Reaction Wheel
+  SimpleThruster* thruster_;           //!< Thruster
+  ThrusterCluster* thruster_cluster_;  //!< Thruster cluster
 
   // Ideal component
   ForceGenerator* force_generator_;                     //!< Ideal Force Generator
@@ -6,6 +6,7 @@
 #include "sample_spacecraft.hpp"
 
 #include <environment/global/clock_generator.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
 #include <math_physics/randomization/normal_randomization.hpp>
 
 #include "sample_components.hpp"
@@ -13,6 +14,7 @@
 SampleSpacecraft::SampleSpacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
                                    const unsigned int spacecraft_id)
     : Spacecraft(simulation_configuration, global_environment, spacecraft_id) {
+  GlobalRandomization::StreamScope stream_scope("SPACECRAFT_" + std::to_string(spacecraft_id));
   sample_components_ =
       new SampleComponents(dynamics_, structure_, local_environment_, global_environment, simulation_configuration, &clock_generator_, spacecraft_id);
   components_ = sample_components_;
@@ -0,0 +1,30 @@
+/**
+ * @file benchmark_measurement.hpp
+ * @brief Function to measure the calculation time in the benchmark executables
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_BENCHMARK_MEASUREMENT_HPP_
+#define S2E_LIBRARY_UTILITIES_BENCHMARK_MEASUREMENT_HPP_
+
+#include <chrono>
+#include <cstddef>
+
+/**
+ * @fn MeasureNanosecondsPerCall
+ * @brief Measure the average calculation time of the target function
+ * @param [in] function: Target function
+ * @param [in] number_of_calls: Number of calls to average
+ * @return Average calculation time [ns/call]
+ */
+template <typename F>
+double MeasureNanosecondsPerCall(F function, const size_t number_of_calls) {
+  function();  // warm up
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < number_of_calls; i++) {
+    function();
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / (double)number_of_calls;
+}
+
+#endif  // S2E_LIBRARY_UTILITIES_BENCHMARK_MEASUREMENT_HPP_
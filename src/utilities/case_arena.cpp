@@ -0,0 +1,70 @@
+/**
+ * @file case_arena.cpp
+ * @brief Monotonic arena to allocate the objects of a simulation case
+ */
+
+#include "case_arena.hpp"
+
+#include <cstdint>
+
+namespace {
+thread_local CaseArena* current_arena = nullptr;  //!< Arena of the Scope in the current thread
+
+const size_t kAlignment = alignof(std::max_align_t);  //!< Alignment of the allocations
+const size_t kHeaderSize = kAlignment;                //!< Size of the header before each ArenaAllocated object
+const uintptr_t kHeapTag = 0;                         //!< Header value of the objects allocated in the heap
+const uintptr_t kArenaTag = 1;                        //!< Header value of the objects allocated in the arena
+
+/**
+ * @fn AlignUp
+ * @brief Round up the size to the alignment
+ */
+size_t AlignUp(const size_t size_bytes) { return (size_bytes + kAlignment - 1) / kAlignment * kAlignment; }
+}  // namespace
+
+CaseArena::CaseArena(const size_t block_size_bytes) : block_size_bytes_(AlignUp(block_size_bytes)) {}
+
+CaseArena::~CaseArena() {}
+
+void* CaseArena::Allocate(const size_t size_bytes) {
+  const size_t aligned_size_bytes = AlignUp(size_bytes);
+  if (aligned_size_bytes > remaining_bytes_) {
+    const size_t new_block_size_bytes = aligned_size_bytes > block_size_bytes_ ? aligned_size_bytes : block_size_bytes_;
+    // operator new[] of char returns the memory aligned for any object of the size
+    blocks_.emplace_back(new char[new_block_size_bytes]);
+    reserved_bytes_ += new_block_size_bytes;
+    current_position_ = blocks_.back().get();
+    remaining_bytes_ = new_block_size_bytes;
+  }
+  void* pointer = current_position_;
+  current_position_ += aligned_size_bytes;
+  remaining_bytes_ -= aligned_size_bytes;
+  allocated_bytes_ += aligned_size_bytes;
+  return pointer;
+}
+
+CaseArena* CaseArena::GetCurrent() { return current_arena; }
+
+CaseArena::Scope::Scope(CaseArena* arena) : previous_arena_(current_arena) { current_arena = arena; }
+
+CaseArena::Scope::~Scope() { current_arena = previous_arena_; }
+
+void* ArenaAllocated::operator new(const size_t size_bytes) {
+  char* memory;
+  uintptr_t tag;
+  if (current_arena != nullptr) {
+    memory = static_cast<char*>(current_arena->Allocate(kHeaderSize + size_bytes));
+    tag = kArenaTag;
+  } else {
+    memory = static_cast<char*>(::operator new(kHeaderSize + size_bytes));
+    tag = kHeapTag;
+  }
+  *reinterpret_cast<uintptr_t*>(memory) = tag;
+  return memory + kHeaderSize;
+}
+
+void ArenaAllocated::operator delete(void* pointer) noexcept {
+  if (pointer == nullptr) return;
+  char* memory = static_cast<char*>(pointer) - kHeaderSize;
+  if (*reinterpret_cast<uintptr_t*>(memory) == kHeapTag) ::operator delete(memory);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file case_arena.hpp
+ * @brief Monotonic arena to allocate the objects of a simulation case
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_CASE_ARENA_HPP_
+#define S2E_LIBRARY_UTILITIES_CASE_ARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+ * @class CaseArena
+ * @brief Monotonic arena to allocate the objects of a simulation case
+ * @details The objects of the classes derived from ArenaAllocated are allocated in the arena while CaseArena::Scope is alive in the thread.
+ *          The memory is allocated from large blocks in order, so the objects of a spacecraft are placed close together, and all blocks are
+ *          released at once when the arena is destructed. The destructors of the objects are still called by delete, but the memory of each
+ *          object is not freed one by one.
+ * @note The arena must outlive all objects allocated in it. The arena is not thread safe, and only the thread which owns the Scope allocates
+ *       in it (the objects constructed in the other threads are allocated in the heap).
+ */
+class CaseArena {
+ public:
+  /**
+   * @fn CaseArena
+   * @brief Constructor
+   * @param [in] block_size_bytes: Size of each memory block [bytes]. The larger objects have their own block.
+   */
+  explicit CaseArena(const size_t block_size_bytes = 1024 * 1024);
+  /**
+   * @fn ~CaseArena
+   * @brief Destructor. Release all blocks.
+   */
+  ~CaseArena();
+
+  CaseArena(const CaseArena&) = delete;
+  CaseArena& operator=(const CaseArena&) = delete;
+
+  /**
+   * @fn Allocate
+   * @brief Allocate the memory aligned for any object
+   * @param [in] size_bytes: Size of the memory [bytes]
+   * @return Allocated memory
+   */
+  void* Allocate(const size_t size_bytes);
+
+  /**
+   * @fn GetAllocatedBytes
+   * @brief Return total size of the allocated memory [bytes]
+   */
+  inline size_t GetAllocatedBytes() const { return allocated_bytes_; }
+  /**
+   * @fn GetReservedBytes
+   * @brief Return total size of the memory blocks [bytes]
+   */
+  inline size_t GetReservedBytes() const { return reserved_bytes_; }
+  /**
+   * @fn GetCurrent
+   * @brief Return the arena of the Scope in the current thread, or nullptr
+   */
+  static CaseArena* GetCurrent();
+
+  /**
+   * @class Scope
+   * @brief RAII object to allocate the ArenaAllocated objects in the arena in the current thread
+   */
+  class Scope {
+   public:
+    /**
+     * @fn Scope
+     * @brief Constructor. Start the allocation in the arena.
+     * @param [in] arena: Arena. nullptr allocates in the heap.
+     */
+    explicit Scope(CaseArena* arena);
+    /**
+     * @fn ~Scope
+     * @brief Destructor. Restore the previous arena.
+     */
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    CaseArena* previous_arena_;  //!< Arena of the previous scope in the thread
+  };
+
+ private:
+  size_t block_size_bytes_;                      //!< Size of each memory block [bytes]
+  std::vector<std::unique_ptr<char[]>> blocks_;  //!< Memory blocks
+  char* current_position_ = nullptr;             //!< Next free position in the last block
+  size_t remaining_bytes_ = 0;                   //!< Free size in the last block [bytes]
+  size_t allocated_bytes_ = 0;                   //!< Total size of the allocated memory [bytes]
+  size_t reserved_bytes_ = 0;                    //!< Total size of the memory blocks [bytes]
+};
+
+/**
+ * @class ArenaAllocated
+ * @brief Base class of the objects which are allocated in CaseArena when a Scope is alive
+ * @details Each allocation has a header to record where it is allocated, so the objects allocated in the heap and in the arena can be deleted
+ *          in the same way.
+ */
+class ArenaAllocated {
+ public:
+  /**
+   * @fn operator new
+   * @brief Allocate in the current arena, or in the heap when no arena is set
+   */
+  static void* operator new(const size_t size_bytes);
+  /**
+   * @fn operator delete
+   * @brief Free the memory allocated in the heap. The memory in the arena is released with the arena.
+   */
+  static void operator delete(void* pointer) noexcept;
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_CASE_ARENA_HPP_
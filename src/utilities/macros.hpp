@@ -7,5 +7,6 @@
 #define S2E_LIBRARY_UTILITIES_MACROS_HPP_
 
 #define UNUSED(x) (void)(x)  //!< Macro to avoid unused warnings
+#define RESTRICT __restrict  //!< Macro to declare that the pointer does not alias any other pointer. It enables the loop vectorization.
 
 #endif  // S2E_LIBRARY_UTILITIES_MACROS_HPP_
@@ -0,0 +1,107 @@
+/**
+ * @file memory_usage.cpp
+ * @brief Memory usage tree of the simulation objects and the resident set size of the process
+ */
+
+#include "memory_usage.hpp"
+
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#ifdef WIN32
+#include <windows.h>
+// windows.h must be included before psapi.h
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+namespace {
+/**
+ * @fn FormatBytes
+ * @brief Return the memory size with the binary prefix
+ */
+std::string FormatBytes(const size_t bytes) {
+  const char* units[] = {"B", "KiB", "MiB", "GiB"};
+  double value = (double)bytes;
+  size_t unit = 0;
+  while (value >= 1024.0 && unit < 3) {
+    value /= 1024.0;
+    unit++;
+  }
+  std::stringstream stream;
+  stream << std::fixed << std::setprecision(unit == 0 ? 0 : 1) << value << " " << units[unit];
+  return stream.str();
+}
+}  // namespace
+
+MemoryUsage& MemoryUsage::AddChild(const MemoryUsage& child) {
+  children.push_back(child);
+  return children.back();
+}
+
+size_t MemoryUsage::CalcTotalOwned_bytes() const {
+  size_t bytes = owned_bytes;
+  for (const auto& child : children) bytes += child.CalcTotalOwned_bytes();
+  return bytes;
+}
+
+size_t MemoryUsage::CalcTotalShared_bytes() const {
+  size_t bytes = shared_bytes;
+  for (const auto& child : children) bytes += child.CalcTotalShared_bytes();
+  return bytes;
+}
+
+void MemoryUsage::Write(std::ostream& stream, const size_t depth) const {
+  stream << std::string(depth * 2, ' ') << name << ": " << FormatBytes(CalcTotalOwned_bytes());
+  if (!children.empty()) stream << " (self " << FormatBytes(owned_bytes) << ")";
+  const size_t total_shared_bytes = CalcTotalShared_bytes();
+  if (total_shared_bytes > 0) stream << ", shared " << FormatBytes(total_shared_bytes);
+  stream << std::endl;
+  for (const auto& child : children) child.Write(stream, depth + 1);
+}
+
+size_t GetPeakResidentSetSize_bytes() {
+#ifdef WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+  return (size_t)counters.PeakWorkingSetSize;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+  return (size_t)usage.ru_maxrss;  // bytes
+#else
+  return (size_t)usage.ru_maxrss * 1024;  // kilobytes
+#endif
+#endif
+}
+
+size_t GetCurrentResidentSetSize_bytes() {
+#if defined(WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+  return (size_t)counters.WorkingSetSize;
+#elif defined(__APPLE__)
+  mach_task_basic_info info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) return 0;
+  return (size_t)info.resident_size;
+#elif defined(__linux__)
+  // The second value of statm is the number of resident pages
+  FILE* file = fopen("/proc/self/statm", "r");
+  if (file == NULL) return 0;
+  long total_pages = 0;
+  long resident_pages = 0;
+  const int number_of_read_values = fscanf(file, "%ld %ld", &total_pages, &resident_pages);
+  fclose(file);
+  if (number_of_read_values != 2) return 0;
+  return (size_t)resident_pages * (size_t)sysconf(_SC_PAGESIZE);
+#else
+  return 0;
+#endif
+}
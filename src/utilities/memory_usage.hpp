@@ -0,0 +1,97 @@
+/**
+ * @file memory_usage.hpp
+ * @brief Memory usage tree of the simulation objects and the resident set size of the process
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_MEMORY_USAGE_HPP_
+#define S2E_LIBRARY_UTILITIES_MEMORY_USAGE_HPP_
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @struct MemoryUsage
+ * @brief Node of the memory usage tree
+ * @details The owned bytes are the object itself and the heap memory owned only by the object. The shared bytes are the immutable data
+ *          shared with the other instances (e.g., coefficients tables and catalogues in SharedDataRegistry). They are reported by each user,
+ *          so the shared bytes are not summed into the total of the process.
+ */
+struct MemoryUsage {
+  std::string name;                  //!< Name of the object
+  size_t owned_bytes = 0;            //!< Memory owned by the object without the children [bytes]
+  size_t shared_bytes = 0;           //!< Memory shared with the other objects without the children [bytes]
+  std::vector<MemoryUsage> children;  //!< Memory usage of the sub-objects
+
+  /**
+   * @fn MemoryUsage
+   * @brief Constructor
+   * @param [in] name: Name of the object
+   * @param [in] owned_bytes: Memory owned by the object [bytes]
+   * @param [in] shared_bytes: Memory shared with the other objects [bytes]
+   */
+  MemoryUsage(const std::string& name = "", const size_t owned_bytes = 0, const size_t shared_bytes = 0)
+      : name(name), owned_bytes(owned_bytes), shared_bytes(shared_bytes) {}
+
+  /**
+   * @fn AddChild
+   * @brief Add the memory usage of a sub-object
+   * @return Reference to the added child
+   */
+  MemoryUsage& AddChild(const MemoryUsage& child);
+  /**
+   * @fn CalcTotalOwned_bytes
+   * @brief Return the owned memory including the children [bytes]
+   */
+  size_t CalcTotalOwned_bytes() const;
+  /**
+   * @fn CalcTotalShared_bytes
+   * @brief Return the shared memory including the children [bytes]
+   */
+  size_t CalcTotalShared_bytes() const;
+  /**
+   * @fn Write
+   * @brief Write the tree with the totals of each node
+   * @param [out] stream: Output stream
+   * @param [in] depth: Depth of this node for the indent
+   */
+  void Write(std::ostream& stream, const size_t depth = 0) const;
+};
+
+/**
+ * @fn CalcHeapMemory_bytes
+ * @brief Return the heap memory allocated by the vector [bytes]
+ */
+template <typename T>
+size_t CalcHeapMemory_bytes(const std::vector<T>& vector) {
+  return vector.capacity() * sizeof(T);
+}
+/**
+ * @fn CalcHeapMemory_bytes
+ * @brief Return the heap memory allocated by the nested vector [bytes]
+ */
+template <typename T>
+size_t CalcHeapMemory_bytes(const std::vector<std::vector<T>>& vector) {
+  size_t bytes = vector.capacity() * sizeof(std::vector<T>);
+  for (const auto& element : vector) bytes += CalcHeapMemory_bytes(element);
+  return bytes;
+}
+/**
+ * @fn CalcHeapMemory_bytes
+ * @brief Return the heap memory allocated by the string [bytes]. The string in the small buffer of the object is treated as zero.
+ */
+inline size_t CalcHeapMemory_bytes(const std::string& string) { return string.capacity() > 15 ? string.capacity() + 1 : 0; }
+
+/**
+ * @fn GetPeakResidentSetSize_bytes
+ * @brief Return the peak resident set size of the process [bytes]. Zero when it is not available on the platform.
+ */
+size_t GetPeakResidentSetSize_bytes();
+/**
+ * @fn GetCurrentResidentSetSize_bytes
+ * @brief Return the current resident set size of the process [bytes]. Zero when it is not available on the platform.
+ */
+size_t GetCurrentResidentSetSize_bytes();
+
+#endif  // S2E_LIBRARY_UTILITIES_MEMORY_USAGE_HPP_
@@ -11,6 +11,7 @@ typedef unsigned char byte;
 /**
  * @class RingBuffer
  * @brief Class to emulate ring buffer
+ * @note This class is not thread-safe. Use SpscRingBuffer to share the buffer between two threads.
  */
 class RingBuffer {
  public:
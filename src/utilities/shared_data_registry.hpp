@@ -0,0 +1,148 @@
+/**
+ * @file shared_data_registry.hpp
+ * @brief Registry of the immutable data shared between the spacecraft and the simulation cases in the process
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_SHARED_DATA_REGISTRY_HPP_
+#define S2E_LIBRARY_UTILITIES_SHARED_DATA_REGISTRY_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+/**
+ * @enum SharedDataRetention
+ * @brief Retention policy of the shared data
+ */
+enum class SharedDataRetention {
+  kWhileUsed,  //!< Released when no instance uses the data (e.g., the data depends on the simulation period)
+  kProcess,    //!< Kept until the end of the process or ReleaseUnusedData to avoid reloading in the sequential simulation cases
+};
+
+/**
+ * @fn MakeSharedDataKey
+ * @brief Make the key of the shared data from the file path and the parameters
+ * @note The floating point parameters are written with 17 digits to distinguish all values.
+ * @param [in] parameters: File path and parameters which determine the contents of the data
+ * @return Comma separated key
+ */
+template <typename... Parameters>
+std::string MakeSharedDataKey(const Parameters&... parameters) {
+  std::ostringstream key;
+  key.precision(17);
+  const char* delimiter = "";
+  using Expander = int[];
+  (void)Expander{0, ((key << delimiter << parameters, delimiter = ","), 0)...};
+  return key.str();
+}
+
+/**
+ * @class SharedDataRegistry
+ * @brief Registry which hands out the read-only data shared by the key
+ * @details The data is loaded only once for the key, and all instances with the same key refer the same const data.
+ *          The registry is thread safe, so the simulation cases executed in parallel can use it.
+ *          The registry is separated for each data type T.
+ */
+template <typename T>
+class SharedDataRegistry {
+ public:
+  /**
+   * @fn Get
+   * @brief Return the data shared with the key, and load it when it is not registered yet
+   * @note The loader is called with the lock of the registry of T, so it must not call Get of the same T.
+   * @param [in] key: Key made from the file path and the parameters (e.g., MakeSharedDataKey)
+   * @param [in] load: Function to load the data. Return nullptr when the load fails.
+   * @param [in] retention: Retention policy of the loaded data
+   * @return Shared data. nullptr when the load fails, and the failure is not registered.
+   */
+  static std::shared_ptr<const T> Get(const std::string& key, const std::function<std::shared_ptr<const T>()>& load,
+                                      const SharedDataRetention retention = SharedDataRetention::kProcess) {
+    std::lock_guard<std::mutex> lock(GetMutex());
+    std::map<std::string, Entry>& entries = GetEntries();
+    auto itr = entries.find(key);
+    if (itr != entries.end()) {
+      std::shared_ptr<const T> data = itr->second.data.lock();
+      if (data != nullptr) return data;
+    }
+
+    std::shared_ptr<const T> data = load();
+    if (data == nullptr) return nullptr;
+    Entry& entry = entries[key];
+    entry.data = data;
+    entry.kept_data = (retention == SharedDataRetention::kProcess) ? data : nullptr;
+
+    // Remove the released data (e.g., data of the previous days)
+    for (itr = entries.begin(); itr != entries.end();) {
+      if (itr->second.data.expired()) {
+        itr = entries.erase(itr);
+      } else {
+        itr++;
+      }
+    }
+    return data;
+  }
+
+  /**
+   * @fn GetNumberOfData
+   * @brief Return the number of the registered data which are still alive
+   */
+  static size_t GetNumberOfData() {
+    std::lock_guard<std::mutex> lock(GetMutex());
+    size_t number_of_data = 0;
+    for (const auto& entry : GetEntries()) {
+      if (!entry.second.data.expired()) number_of_data++;
+    }
+    return number_of_data;
+  }
+
+  /**
+   * @fn ReleaseUnusedData
+   * @brief Release the data kept by the registry which no instance uses now
+   * @note The data used by the instances are kept and still shared.
+   */
+  static void ReleaseUnusedData() {
+    std::lock_guard<std::mutex> lock(GetMutex());
+    std::map<std::string, Entry>& entries = GetEntries();
+    for (auto itr = entries.begin(); itr != entries.end();) {
+      if (itr->second.kept_data.use_count() == 1) itr->second.kept_data = nullptr;
+      if (itr->second.data.expired()) {
+        itr = entries.erase(itr);
+      } else {
+        itr++;
+      }
+    }
+  }
+
+ private:
+  /**
+   * @struct Entry
+   * @brief Registered data
+   */
+  struct Entry {
+    std::weak_ptr<const T> data;          //!< Shared data
+    std::shared_ptr<const T> kept_data;  //!< Reference held by the registry for SharedDataRetention::kProcess
+  };
+
+  /**
+   * @fn GetMutex
+   * @brief Return the mutex of the registry of T
+   */
+  static std::mutex& GetMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+  /**
+   * @fn GetEntries
+   * @brief Return the registered data of T
+   */
+  static std::map<std::string, Entry>& GetEntries() {
+    static std::map<std::string, Entry> entries;
+    return entries;
+  }
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_SHARED_DATA_REGISTRY_HPP_
@@ -6,74 +6,161 @@
 #include "slip.hpp"
 
 #include <algorithm>
-#include <iterator>
-
-static uint8_t kSlipFend_ = 0xc0;   //!< FEND: Frame End
-static uint8_t kSlipFesc_ = 0xdb;   //!< FESC: Frame Escape
-static uint8_t kSlipTfend_ = 0xdc;  //!< TFEND: Transposed Frame End
-static uint8_t kSlipTfesc_ = 0xdd;  //!< TFESC: Transposed Frame Escape
-
-std::vector<uint8_t> decode_slip(const std::vector<uint8_t> in) {
-  std::vector<uint8_t> out = in;
-
-  // Footer Search
-  auto fend_itr = std::find(out.begin(), out.end(), kSlipFend_);
-  out.erase(fend_itr, out.end());  // Delete
-
-  // FESC search
-  auto fesc_itr = out.begin();
-  while (1) {
-    fesc_itr = std::find(fesc_itr, out.end(), kSlipFesc_);
-    if (fesc_itr == out.end()) break;
-    // convert
-    if (*(fesc_itr + 1) == kSlipTfend_) {
-      *(fesc_itr + 1) = kSlipFend_;
-    } else if (*(fesc_itr + 1) == kSlipTfesc_) {
-      *(fesc_itr + 1) = kSlipFesc_;
+
+static const uint8_t kSlipFend_ = 0xc0;   //!< FEND: Frame End
+static const uint8_t kSlipFesc_ = 0xdb;   //!< FESC: Frame Escape
+static const uint8_t kSlipTfend_ = 0xdc;  //!< TFEND: Transposed Frame End
+static const uint8_t kSlipTfesc_ = 0xdd;  //!< TFESC: Transposed Frame Escape
+
+/**
+ * @fn EncodeSlipBytes
+ * @brief Encode a SLIP frame and pass the encoded bytes to the output function one by one
+ */
+template <typename OutputFunction>
+static void EncodeSlipBytes(const uint8_t* data, const size_t length, const bool with_header, OutputFunction output) {
+  if (with_header) output(kSlipFend_);
+  for (size_t i = 0; i < length; i++) {
+    if (data[i] == kSlipFend_) {
+      output(kSlipFesc_);
+      output(kSlipTfend_);
+    } else if (data[i] == kSlipFesc_) {
+      output(kSlipFesc_);
+      output(kSlipTfesc_);
     } else {
-      // TODO error handling
+      output(data[i]);
     }
-    fesc_itr = out.erase(fesc_itr);
-    ++fesc_itr;
   }
+  output(kSlipFend_);
+}
+
+std::vector<uint8_t> decode_slip(const std::vector<uint8_t>& in) {
+  // Only the first frame is decoded
+  const auto fend_itr = std::find(in.begin(), in.end(), kSlipFend_);
+  const size_t frame_length = (size_t)(fend_itr - in.begin());
+
+  std::vector<uint8_t> out(frame_length);
+  SlipDecoder decoder(out.data(), out.size());
+  decoder.Feed(in.data(), frame_length, nullptr);
+  out.resize(decoder.GetPartialFrameLength());
+  return out;
+}
+
+std::vector<uint8_t> decode_slip_with_header(const std::vector<uint8_t>& in) {
+  if (in.empty()) return std::vector<uint8_t>();
+  return decode_slip(std::vector<uint8_t>(in.begin() + 1, in.end()));
+}
+
+std::vector<uint8_t> encode_slip(const std::vector<uint8_t>& in) {
+  std::vector<uint8_t> out(CalcSlipEncodedLength(in.data(), in.size()));
+  EncodeSlipFrame(in.data(), in.size(), out.data(), out.size());
+  return out;
+}
 
+std::vector<uint8_t> encode_slip_with_header(const std::vector<uint8_t>& in) {
+  std::vector<uint8_t> out(CalcSlipEncodedLength(in.data(), in.size(), true));
+  EncodeSlipFrame(in.data(), in.size(), out.data(), out.size(), true);
   return out;
 }
 
-std::vector<uint8_t> decode_slip_with_header(const std::vector<uint8_t> in) {
-  std::vector<uint8_t> in_without_header = in;
-  in_without_header.erase(in_without_header.begin(), in_without_header.begin() + 1);
-  return decode_slip(in_without_header);
+size_t CalcSlipEncodedLength(const uint8_t* data, const size_t length, const bool with_header) {
+  size_t encoded_length = length + 1;
+  if (with_header) encoded_length++;
+  for (size_t i = 0; i < length; i++) {
+    if (data[i] == kSlipFend_ || data[i] == kSlipFesc_) encoded_length++;
+  }
+  return encoded_length;
+}
+
+size_t EncodeSlipFrame(const uint8_t* data, const size_t length, uint8_t* output, const size_t output_size, const bool with_header) {
+  const size_t encoded_length = CalcSlipEncodedLength(data, length, with_header);
+  if (encoded_length > output_size) return 0;
+
+  size_t position = 0;
+  EncodeSlipBytes(data, length, with_header, [&](const uint8_t byte) { output[position++] = byte; });
+  return encoded_length;
 }
 
-std::vector<uint8_t> encode_slip(const std::vector<uint8_t> in) {
-  std::vector<uint8_t> out = in;
+bool EncodeSlipFrame(const uint8_t* data, const size_t length, SpscRingBuffer& buffer, const bool with_header) {
+  const size_t encoded_length = CalcSlipEncodedLength(data, length, with_header);
+  if (encoded_length > buffer.GetCapacity() - buffer.GetSize()) return false;
+
+  // The frame is encoded directly into the contiguous free regions of the buffer
+  unsigned char* region = nullptr;
+  size_t region_length = 0;
+  size_t position = 0;
+  EncodeSlipBytes(data, length, with_header, [&](const uint8_t byte) {
+    if (position == region_length) {
+      if (region != nullptr) buffer.CommitWrite(position);
+      region = buffer.PeekWritableRegion(region_length);
+      position = 0;
+    }
+    region[position++] = byte;
+  });
+  buffer.CommitWrite(position);
+  return true;
+}
 
-  // FESC search
-  auto fesc_itr = out.begin();
-  while (1) {
-    fesc_itr = std::find(fesc_itr, out.end(), kSlipFesc_);
-    if (fesc_itr == out.end()) break;
-    // convert
-    fesc_itr = out.insert(fesc_itr + 1, kSlipTfesc_);
+size_t SlipDecoder::Feed(const uint8_t* data, const size_t length, const FrameHandler& handler) {
+  size_t completed_frames = 0;
+  for (size_t i = 0; i < length; i++) {
+    if (!FeedByte(data[i])) continue;
+    completed_frames++;
+    if (handler) handler(frame_buffer_, frame_length_);
+    frame_length_ = 0;
   }
+  return completed_frames;
+}
 
-  // FEND search
-  auto fend_itr = out.begin();
-  while (1) {
-    fend_itr = std::find(fend_itr, out.end(), kSlipFend_);
-    if (fend_itr == out.end()) break;
-    // convert
-    *fend_itr = kSlipFesc_;
-    fend_itr = out.insert(fend_itr + 1, kSlipTfend_);
+size_t SlipDecoder::Feed(SpscRingBuffer& buffer, const FrameHandler& handler) {
+  size_t completed_frames = 0;
+  size_t region_length = 0;
+  const unsigned char* region = buffer.PeekReadableRegion(region_length);
+  while (region_length > 0) {
+    completed_frames += Feed(region, region_length, handler);
+    buffer.CommitRead(region_length);
+    region = buffer.PeekReadableRegion(region_length);
   }
+  return completed_frames;
+}
 
-  out.push_back(kSlipFend_);
-  return out;
+void SlipDecoder::Reset() {
+  frame_length_ = 0;
+  is_escaped_ = false;
+  is_oversize_ = false;
 }
 
-std::vector<uint8_t> encode_slip_with_header(const std::vector<uint8_t> in) {
-  std::vector<uint8_t> out = encode_slip(in);
-  out.insert(out.begin(), kSlipFend_);
-  return out;
+bool SlipDecoder::FeedByte(const uint8_t byte) {
+  if (byte == kSlipFend_) {
+    const bool is_completed = !is_oversize_ && frame_length_ > 0;
+    if (!is_completed) frame_length_ = 0;
+    is_escaped_ = false;
+    is_oversize_ = false;
+    if (is_completed) number_of_frames_++;
+    return is_completed;
+  }
+  if (is_oversize_) return false;
+
+  uint8_t decoded_byte = byte;
+  if (is_escaped_) {
+    is_escaped_ = false;
+    if (byte == kSlipTfend_) {
+      decoded_byte = kSlipFend_;
+    } else if (byte == kSlipTfesc_) {
+      decoded_byte = kSlipFesc_;
+    } else {
+      number_of_escape_errors_++;
+    }
+  } else if (byte == kSlipFesc_) {
+    is_escaped_ = true;
+    return false;
+  }
+
+  if (frame_length_ >= frame_buffer_size_) {
+    is_oversize_ = true;
+    frame_length_ = 0;
+    number_of_oversize_frames_++;
+    return false;
+  }
+  frame_buffer_[frame_length_++] = decoded_byte;
+  return false;
 }
@@ -8,6 +8,9 @@
 
 #include <stdint.h>
 
+#include <cstddef>
+#include <functional>
+#include <utilities/spsc_ring_buffer.hpp>
 #include <vector>
 
 /**
@@ -16,14 +19,14 @@
  * @param [in] in: Input data
  * @return Decoded data
  */
-std::vector<uint8_t> decode_slip(std::vector<uint8_t> in);
+std::vector<uint8_t> decode_slip(const std::vector<uint8_t>& in);
 /**
  * @fn decode_slip_with_header
  * @brief Decode SLIP data with Header
  * @param [in] in: Input data
  * @return Decoded data
  */
-std::vector<uint8_t> decode_slip_with_header(std::vector<uint8_t> in);
+std::vector<uint8_t> decode_slip_with_header(const std::vector<uint8_t>& in);
 
 /**
  * @fn encode_slip
@@ -31,13 +34,128 @@ std::vector<uint8_t> decode_slip_with_header(std::vector<uint8_t> in);
  * @param [in] in: Input data
  * @return Encoded data
  */
-std::vector<uint8_t> encode_slip(std::vector<uint8_t> in);
+std::vector<uint8_t> encode_slip(const std::vector<uint8_t>& in);
 /**
  * @fn encode_slip_with_header
  * @brief Encode SLIP data
  * @param [in] in: Input data
  * @return Encoded data
  */
-std::vector<uint8_t> encode_slip_with_header(std::vector<uint8_t> in);
+std::vector<uint8_t> encode_slip_with_header(const std::vector<uint8_t>& in);
+
+/**
+ * @fn CalcSlipEncodedLength
+ * @brief Calculate length of the encoded SLIP frame
+ * @param [in] data: Data of the frame
+ * @param [in] length: Length of the data
+ * @param [in] with_header: Add FEND before the frame
+ * @return Length of the encoded frame
+ */
+size_t CalcSlipEncodedLength(const uint8_t* data, const size_t length, const bool with_header = false);
+/**
+ * @fn EncodeSlipFrame
+ * @brief Encode a SLIP frame into the buffer without allocation
+ * @param [in] data: Data of the frame
+ * @param [in] length: Length of the data
+ * @param [out] output: Buffer to store the encoded frame
+ * @param [in] output_size: Size of the output buffer
+ * @param [in] with_header: Add FEND before the frame
+ * @return Length of the encoded frame. Zero when the output buffer is too small.
+ */
+size_t EncodeSlipFrame(const uint8_t* data, const size_t length, uint8_t* output, const size_t output_size, const bool with_header = false);
+/**
+ * @fn EncodeSlipFrame
+ * @brief Encode a SLIP frame directly into the ring buffer (producer)
+ * @param [in] data: Data of the frame
+ * @param [in] length: Length of the data
+ * @param [in/out] buffer: Ring buffer to store the encoded frame
+ * @param [in] with_header: Add FEND before the frame
+ * @return True when the frame is written. Nothing is written when the free space of the buffer is not enough for the whole frame.
+ */
+bool EncodeSlipFrame(const uint8_t* data, const size_t length, SpscRingBuffer& buffer, const bool with_header = false);
+
+/**
+ * @class SlipDecoder
+ * @brief Streaming SLIP decoder to extract the frames from the byte stream of any fragmentation
+ * @details The decoder is a state machine fed with the received bytes. The frame is decoded into the frame buffer given by the caller, and
+ *          the handler is called with the frame at each FEND, so no memory is allocated in the decoding. The empty frames, such as FEND
+ *          used as the header, are ignored. The frame longer than the frame buffer is dropped until the next FEND.
+ */
+class SlipDecoder {
+ public:
+  /**
+   * @brief Handler of the decoded frame. The frame is valid only in the handler.
+   */
+  using FrameHandler = std::function<void(const uint8_t* frame, const size_t length)>;
+
+  /**
+   * @fn SlipDecoder
+   * @brief Constructor
+   * @param [in] frame_buffer: Buffer to store the decoded frame. It must outlive the decoder.
+   * @param [in] frame_buffer_size: Size of the frame buffer, which is the maximum length of the decoded frame
+   */
+  SlipDecoder(uint8_t* frame_buffer, const size_t frame_buffer_size) : frame_buffer_(frame_buffer), frame_buffer_size_(frame_buffer_size) {}
+
+  /**
+   * @fn Feed
+   * @brief Decode the received bytes
+   * @param [in] data: Received bytes
+   * @param [in] length: Number of the received bytes
+   * @param [in] handler: Handler called for each completed frame
+   * @return Number of the completed frames
+   */
+  size_t Feed(const uint8_t* data, const size_t length, const FrameHandler& handler);
+  /**
+   * @fn Feed
+   * @brief Decode all bytes stored in the ring buffer and consume them (consumer)
+   * @param [in/out] buffer: Ring buffer of the received bytes
+   * @param [in] handler: Handler called for each completed frame
+   * @return Number of the completed frames
+   */
+  size_t Feed(SpscRingBuffer& buffer, const FrameHandler& handler);
+  /**
+   * @fn Reset
+   * @brief Discard the frame in decoding
+   */
+  void Reset();
+
+  /**
+   * @fn GetPartialFrameLength
+   * @brief Return length of the frame in decoding
+   */
+  inline size_t GetPartialFrameLength() const { return frame_length_; }
+  /**
+   * @fn GetNumberOfFrames
+   * @brief Return number of the completed frames
+   */
+  inline size_t GetNumberOfFrames() const { return number_of_frames_; }
+  /**
+   * @fn GetNumberOfEscapeErrors
+   * @brief Return number of FESC followed by an invalid byte. The byte is stored as it is.
+   */
+  inline size_t GetNumberOfEscapeErrors() const { return number_of_escape_errors_; }
+  /**
+   * @fn GetNumberOfOversizeFrames
+   * @brief Return number of the frames dropped since they are longer than the frame buffer
+   */
+  inline size_t GetNumberOfOversizeFrames() const { return number_of_oversize_frames_; }
+
+ private:
+  uint8_t* frame_buffer_;                 //!< Buffer to store the decoded frame
+  size_t frame_buffer_size_;              //!< Size of the frame buffer
+  size_t frame_length_ = 0;               //!< Length of the frame in decoding
+  bool is_escaped_ = false;               //!< Flag of the received FESC
+  bool is_oversize_ = false;              //!< Flag of the frame in dropping until the next FEND
+  size_t number_of_frames_ = 0;           //!< Number of the completed frames
+  size_t number_of_escape_errors_ = 0;    //!< Number of FESC followed by an invalid byte
+  size_t number_of_oversize_frames_ = 0;  //!< Number of the dropped frames longer than the frame buffer
+
+  /**
+   * @fn FeedByte
+   * @brief Decode a byte
+   * @return True when a frame is completed
+   */
+  bool FeedByte(const uint8_t byte);
+};
 
 #endif  // S2E_LIBRARY_UTILITIES_SLIP_HPP_
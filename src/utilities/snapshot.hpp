@@ -0,0 +1,161 @@
+/**
+ * @file snapshot.hpp
+ * @brief Classes to write and read the simulation state as a binary snapshot
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_SNAPSHOT_HPP_
+#define S2E_LIBRARY_UTILITIES_SNAPSHOT_HPP_
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class SnapshotWriter
+ * @brief Class to write the simulation state as a binary snapshot
+ * @details The values are written in the native byte order and the native sizes,
+ *          so the snapshot is only restored by the same build of the simulator on the same kind of machine.
+ */
+class SnapshotWriter {
+ public:
+  /**
+   * @fn SnapshotWriter
+   * @brief Constructor
+   * @param [in] stream: Output stream opened in the binary mode
+   */
+  explicit SnapshotWriter(std::ostream& stream) : stream_(stream) {}
+
+  /**
+   * @fn Write
+   * @brief Write the value of the trivially copyable type (e.g. double, libra::Vector, libra::NormalRand)
+   * @param [in] value: Value
+   */
+  template <typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only the trivially copyable types can be written as they are.");
+    stream_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  /**
+   * @fn Write
+   * @brief Write the vector of the trivially copyable type with its size
+   * @param [in] values: Values
+   */
+  template <typename T>
+  void Write(const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only the trivially copyable types can be written as they are.");
+    Write((uint64_t)values.size());
+    if (!values.empty()) stream_.write(reinterpret_cast<const char*>(values.data()), sizeof(T) * values.size());
+  }
+  /**
+   * @fn Write
+   * @brief Write the string with its size
+   * @param [in] value: String
+   */
+  void Write(const std::string& value) {
+    Write((uint64_t)value.size());
+    stream_.write(value.data(), value.size());
+  }
+  /**
+   * @fn WriteTag
+   * @brief Write the tag to check that the following state is restored by the same kind of object
+   * @param [in] tag: Tag name
+   */
+  void WriteTag(const std::string& tag) { Write(tag); }
+
+  /**
+   * @fn IsGood
+   * @brief Return true when all values are written without error
+   */
+  inline bool IsGood() const { return stream_.good(); }
+
+ private:
+  std::ostream& stream_;  //!< Output stream
+};
+
+/**
+ * @class SnapshotReader
+ * @brief Class to read the simulation state from a binary snapshot written by SnapshotWriter
+ * @note Throws std::invalid_argument when the snapshot is shorter than expected or the tag does not match.
+ */
+class SnapshotReader {
+ public:
+  /**
+   * @fn SnapshotReader
+   * @brief Constructor
+   * @param [in] stream: Input stream opened in the binary mode
+   */
+  explicit SnapshotReader(std::istream& stream) : stream_(stream) {}
+
+  /**
+   * @fn Read
+   * @brief Read the value of the trivially copyable type
+   * @param [out] value: Value
+   */
+  template <typename T>
+  void Read(T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only the trivially copyable types can be read as they are.");
+    ReadBytes(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+  /**
+   * @fn Read
+   * @brief Read the vector of the trivially copyable type with its size
+   * @param [out] values: Values
+   */
+  template <typename T>
+  void Read(std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only the trivially copyable types can be read as they are.");
+    values.resize(ReadSize());
+    if (!values.empty()) ReadBytes(reinterpret_cast<char*>(values.data()), sizeof(T) * values.size());
+  }
+  /**
+   * @fn Read
+   * @brief Read the string with its size
+   * @param [out] value: String
+   */
+  void Read(std::string& value) {
+    value.resize(ReadSize());
+    if (!value.empty()) ReadBytes(&value[0], value.size());
+  }
+  /**
+   * @fn ReadSize
+   * @brief Read the size written with the vector or the string
+   */
+  size_t ReadSize() {
+    uint64_t size = 0;
+    Read(size);
+    return (size_t)size;
+  }
+  /**
+   * @fn ReadTag
+   * @brief Read the tag and check it is the expected one
+   * @param [in] tag: Expected tag name
+   */
+  void ReadTag(const std::string& tag) {
+    // The size is checked first to avoid the huge allocation for the broken snapshot
+    const size_t size = ReadSize();
+    std::string read_tag(size <= kMaxTagLength ? size : 0, '\0');
+    if (!read_tag.empty()) ReadBytes(&read_tag[0], read_tag.size());
+    if (size > kMaxTagLength || read_tag != tag) {
+      throw std::invalid_argument("Snapshot has " + read_tag + " where " + tag + " is expected. The snapshot is made with the different setting.");
+    }
+  }
+
+ private:
+  std::istream& stream_;                  //!< Input stream
+  static const size_t kMaxTagLength = 256;  //!< Maximum length of the tag
+
+  /**
+   * @fn ReadBytes
+   * @brief Read the bytes and check the size
+   */
+  void ReadBytes(char* buffer, const size_t size) {
+    stream_.read(buffer, size);
+    if ((size_t)stream_.gcount() != size) throw std::invalid_argument("Snapshot ends unexpectedly.");
+  }
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_SNAPSHOT_HPP_
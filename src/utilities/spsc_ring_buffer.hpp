@@ -0,0 +1,181 @@
+/**
+ * @file spsc_ring_buffer.hpp
+ * @brief Lock-free single-producer single-consumer ring buffer of bytes
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_SPSC_RING_BUFFER_HPP_
+#define S2E_LIBRARY_UTILITIES_SPSC_RING_BUFFER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+/**
+ * @class SpscRingBuffer
+ * @brief Lock-free single-producer single-consumer ring buffer of bytes
+ * @details The read and write indices are monotonic counters published with the acquire/release ordering, and the storage size is the power
+ *          of two so that the index is converted to the position with a mask. Unlike RingBuffer, the bytes which do not fit in the
+ *          buffer are not written and counted as the overflow, so the unread data is never overwritten.
+ * @note Write, PeekWritableRegion, and CommitWrite must be called from the producer thread, and Read, PeekReadableRegion, CommitRead,
+ *       and Clear from the consumer thread. The getters can be called from both threads.
+ */
+class SpscRingBuffer {
+ public:
+  /**
+   * @fn SpscRingBuffer
+   * @brief Constructor
+   * @param [in] capacity: Maximum number of bytes stored in the buffer
+   */
+  explicit SpscRingBuffer(const size_t capacity)
+      : capacity_(std::max(capacity, (size_t)1)),
+        buffer_(CalcStorageSize(capacity_)),
+        mask_(buffer_.size() - 1),
+        read_index_(0),
+        write_index_(0),
+        overflow_bytes_(0),
+        high_water_mark_bytes_(0) {}
+
+  /**
+   * @fn Write
+   * @brief Write data to the buffer (producer)
+   * @param [in] data: Data
+   * @param [in] length: Length of the data
+   * @return Number of written bytes. The bytes which do not fit in the buffer are counted as the overflow.
+   */
+  inline size_t Write(const unsigned char* data, const size_t length) {
+    size_t written_bytes = 0;
+    while (written_bytes < length) {
+      size_t region_length;
+      unsigned char* region = PeekWritableRegion(region_length);
+      if (region_length == 0) break;
+      region_length = std::min(region_length, length - written_bytes);
+      memcpy(region, data + written_bytes, region_length);
+      CommitWrite(region_length);
+      written_bytes += region_length;
+    }
+    if (written_bytes < length) overflow_bytes_.fetch_add(length - written_bytes, std::memory_order_relaxed);
+    return written_bytes;
+  }
+  /**
+   * @fn Read
+   * @brief Read data from the buffer (consumer)
+   * @param [out] data: Buffer to store the data
+   * @param [in] length: Maximum length to read
+   * @return Number of read bytes
+   */
+  inline size_t Read(unsigned char* data, const size_t length) {
+    size_t read_bytes = 0;
+    while (read_bytes < length) {
+      size_t region_length;
+      const unsigned char* region = PeekReadableRegion(region_length);
+      if (region_length == 0) break;
+      region_length = std::min(region_length, length - read_bytes);
+      memcpy(data + read_bytes, region, region_length);
+      CommitRead(region_length);
+      read_bytes += region_length;
+    }
+    return read_bytes;
+  }
+
+  /**
+   * @fn PeekWritableRegion
+   * @brief Return the contiguous free region to write the data directly (producer)
+   * @param [out] length: Length of the region. Zero when the buffer is full.
+   * @return Head of the region
+   */
+  inline unsigned char* PeekWritableRegion(size_t& length) {
+    const size_t write_index = write_index_.load(std::memory_order_relaxed);
+    const size_t read_index = read_index_.load(std::memory_order_acquire);
+    const size_t position = write_index & mask_;
+    length = std::min(capacity_ - (write_index - read_index), buffer_.size() - position);
+    return &buffer_[position];
+  }
+  /**
+   * @fn CommitWrite
+   * @brief Publish the bytes written in the region returned by PeekWritableRegion (producer)
+   * @param [in] length: Number of written bytes. It must not exceed the length of the region.
+   */
+  inline void CommitWrite(const size_t length) {
+    const size_t write_index = write_index_.load(std::memory_order_relaxed) + length;
+    write_index_.store(write_index, std::memory_order_release);
+    const size_t size = write_index - read_index_.load(std::memory_order_acquire);
+    if (size > high_water_mark_bytes_.load(std::memory_order_relaxed)) high_water_mark_bytes_.store(size, std::memory_order_relaxed);
+  }
+  /**
+   * @fn PeekReadableRegion
+   * @brief Return the contiguous region of the stored data to read it directly (consumer)
+   * @param [out] length: Length of the region. Zero when the buffer is empty.
+   * @return Head of the region
+   */
+  inline const unsigned char* PeekReadableRegion(size_t& length) const {
+    const size_t read_index = read_index_.load(std::memory_order_relaxed);
+    const size_t write_index = write_index_.load(std::memory_order_acquire);
+    const size_t position = read_index & mask_;
+    length = std::min(write_index - read_index, buffer_.size() - position);
+    return &buffer_[position];
+  }
+  /**
+   * @fn CommitRead
+   * @brief Release the bytes read from the region returned by PeekReadableRegion (consumer)
+   * @param [in] length: Number of read bytes. It must not exceed the length of the region.
+   */
+  inline void CommitRead(const size_t length) {
+    read_index_.store(read_index_.load(std::memory_order_relaxed) + length, std::memory_order_release);
+  }
+  /**
+   * @fn Clear
+   * @brief Discard all bytes in the buffer (consumer)
+   */
+  inline void Clear() { read_index_.store(write_index_.load(std::memory_order_acquire), std::memory_order_release); }
+
+  // Getters
+  /**
+   * @fn GetSize
+   * @brief Return number of bytes in the buffer
+   */
+  inline size_t GetSize() const {
+    const size_t read_index = read_index_.load(std::memory_order_acquire);
+    return write_index_.load(std::memory_order_acquire) - read_index;
+  }
+  /**
+   * @fn GetCapacity
+   * @brief Return maximum number of bytes stored in the buffer
+   */
+  inline size_t GetCapacity() const { return capacity_; }
+  /**
+   * @fn GetOverflowBytes
+   * @brief Return total number of bytes not written since the buffer was full
+   */
+  inline size_t GetOverflowBytes() const { return overflow_bytes_.load(std::memory_order_relaxed); }
+  /**
+   * @fn GetHighWaterMarkBytes
+   * @brief Return maximum number of bytes stored in the buffer at the same time
+   */
+  inline size_t GetHighWaterMarkBytes() const { return high_water_mark_bytes_.load(std::memory_order_relaxed); }
+
+ private:
+  static const size_t kCacheLineSize = 64;  //!< Cache line size to separate the indices updated by the different threads
+
+  const size_t capacity_;              //!< Maximum number of bytes stored in the buffer
+  std::vector<unsigned char> buffer_;  //!< Storage with the power of two size
+  const size_t mask_;                  //!< Mask to convert the index to the position in the storage
+
+  alignas(kCacheLineSize) std::atomic<size_t> read_index_;   //!< Total number of bytes read by the consumer
+  alignas(kCacheLineSize) std::atomic<size_t> write_index_;  //!< Total number of bytes written by the producer
+  std::atomic<size_t> overflow_bytes_;                       //!< Total number of bytes not written since the buffer was full
+  std::atomic<size_t> high_water_mark_bytes_;                //!< Maximum number of bytes stored at the same time
+
+  /**
+   * @fn CalcStorageSize
+   * @brief Return the smallest power of two which is not less than the capacity
+   */
+  static size_t CalcStorageSize(const size_t capacity) {
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+    return size;
+  }
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_SPSC_RING_BUFFER_HPP_
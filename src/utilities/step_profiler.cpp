@@ -0,0 +1,401 @@
+/**
+ * @file step_profiler.cpp
+ * @brief Low overhead profiler to measure the calculation time of each subsystem in the simulation step
+ */
+
+#include "step_profiler.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "type_name.hpp"
+
+std::atomic<bool> StepProfiler::is_enabled_(false);
+std::atomic<bool> StepProfiler::is_trace_enabled_(false);
+std::atomic<bool> StepProfiler::is_hardware_counter_enabled_(false);
+
+namespace {
+/**
+ * @struct TraceEvent
+ * @brief Measurement stored for the Chrome trace
+ */
+struct TraceEvent {
+  size_t section_id;    //!< Section ID
+  size_t thread_index;  //!< Index of the thread
+  int64_t start_ns;     //!< Start time from the enable of the profiler [ns]
+  int64_t duration_ns;  //!< Duration [ns]
+};
+
+/**
+ * @struct ThreadBuffer
+ * @brief Measurements of a thread
+ * @note The mutex is locked only by the owner thread during the simulation, so it is not contended.
+ */
+struct ThreadBuffer {
+  std::mutex mutex;                                //!< Mutex to read the buffer from other threads
+  size_t thread_index = 0;                         //!< Index of the thread
+  std::vector<ProfileSectionStatistics> sections;  //!< Statistics indexed by the section ID
+  std::vector<TraceEvent> trace_events;            //!< Trace events
+};
+
+/**
+ * @struct ProfilerRegistry
+ * @brief Sections and thread buffers of the process
+ */
+struct ProfilerRegistry {
+  std::mutex mutex;                           //!< Mutex of the registry. It is locked before the mutex of the thread buffers.
+  std::vector<std::string> section_names;     //!< Section names indexed by the section ID
+  std::map<std::string, size_t> section_ids;  //!< Section IDs for the names
+  std::vector<ThreadBuffer*> thread_buffers;  //!< Buffers of the running threads
+  ThreadBuffer finished_thread_buffer;        //!< Merged buffers of the finished threads
+  size_t number_of_threads = 0;               //!< Number of the threads which recorded the measurements
+  std::atomic<int64_t> origin_ns{0};          //!< Time when the profiler is enabled [ns]
+};
+
+ProfilerRegistry& GetRegistry() {
+  static ProfilerRegistry registry;
+  return registry;
+}
+
+/**
+ * @fn MergeBuffer
+ * @brief Merge the buffer to the destination buffer
+ */
+void MergeBuffer(const ThreadBuffer& source, ThreadBuffer& destination) {
+  if (destination.sections.size() < source.sections.size()) destination.sections.resize(source.sections.size());
+  for (size_t i = 0; i < source.sections.size(); i++) {
+    destination.sections[i].Merge(source.sections[i]);
+  }
+  const size_t number_of_events = std::min(source.trace_events.size(), StepProfiler::kMaxNumberOfTraceEvents);
+  destination.trace_events.insert(destination.trace_events.end(), source.trace_events.begin(), source.trace_events.begin() + number_of_events);
+}
+
+/**
+ * @class ThreadBufferHolder
+ * @brief Thread local owner of the buffer which registers the buffer to the registry
+ */
+class ThreadBufferHolder {
+ public:
+  ThreadBufferHolder() {
+    ProfilerRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    buffer_.thread_index = registry.number_of_threads++;
+    registry.thread_buffers.push_back(&buffer_);
+  }
+  ~ThreadBufferHolder() {
+    // Keep the measurements of the finished threads (e.g., spacecraft update threads) for the summary
+    ProfilerRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto& thread_buffers = registry.thread_buffers;
+    thread_buffers.erase(std::remove(thread_buffers.begin(), thread_buffers.end(), &buffer_), thread_buffers.end());
+    std::lock_guard<std::mutex> buffer_lock(buffer_.mutex);
+    MergeBuffer(buffer_, registry.finished_thread_buffer);
+  }
+  ThreadBuffer buffer_;  //!< Buffer of the thread
+};
+
+ThreadBuffer& GetThreadBuffer() {
+  thread_local ThreadBufferHolder holder;
+  return holder.buffer_;
+}
+
+#ifdef __linux__
+/**
+ * @class HardwareCounterGroup
+ * @brief Thread local perf_event group of the hardware counters of the calling thread
+ * @details The counters are opened as a group so that all counters are read with a read system call of the group leader.
+ */
+class HardwareCounterGroup {
+ public:
+  HardwareCounterGroup() {
+    const uint64_t configs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    for (size_t i = 0; i < kNumberOfCounters; i++) {
+      perf_event_attr attribute;
+      memset(&attribute, 0, sizeof(attribute));
+      attribute.type = PERF_TYPE_HARDWARE;
+      attribute.size = sizeof(attribute);
+      attribute.config = configs[i];
+      attribute.exclude_kernel = 1;
+      attribute.exclude_hv = 1;
+      attribute.read_format = PERF_FORMAT_GROUP;
+      // pid = 0 and cpu = -1: the calling thread on any CPU
+      const int group_fd = (i == 0) ? -1 : file_descriptors_[0];
+      const int file_descriptor = (int)syscall(__NR_perf_event_open, &attribute, 0, -1, group_fd, 0);
+      if (file_descriptor < 0) {
+        error_message_ = strerror(errno);
+        Close();
+        return;
+      }
+      file_descriptors_[i] = file_descriptor;
+    }
+  }
+  ~HardwareCounterGroup() { Close(); }
+
+  /**
+   * @fn Read
+   * @brief Read the counters of the group
+   * @return False when the counters are not opened
+   */
+  bool Read(HardwareCounterValues& values) const {
+    if (file_descriptors_[0] < 0) return false;
+    struct {
+      uint64_t number_of_counters;
+      uint64_t values[kNumberOfCounters];
+    } data;
+    if (read(file_descriptors_[0], &data, sizeof(data)) != (ssize_t)sizeof(data) || data.number_of_counters != kNumberOfCounters) return false;
+    for (size_t i = 0; i < kNumberOfCounters; i++) values[i] = data.values[i];
+    return true;
+  }
+  inline const std::string& GetErrorMessage() const { return error_message_; }
+
+ private:
+  static const size_t kNumberOfCounters = (size_t)HardwareCounter::kNumberOfCounters;  //!< Number of the counters
+  int file_descriptors_[kNumberOfCounters] = {-1, -1, -1, -1};                         //!< File descriptors. The first one is the group leader.
+  std::string error_message_;                                                          //!< Error message of perf_event_open
+
+  void Close() {
+    for (int& file_descriptor : file_descriptors_) {
+      if (file_descriptor >= 0) close(file_descriptor);
+      file_descriptor = -1;
+    }
+  }
+};
+
+const HardwareCounterGroup& GetHardwareCounterGroup() {
+  thread_local HardwareCounterGroup group;
+  return group;
+}
+#endif
+
+int64_t GetSteadyClock_ns(const std::chrono::steady_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+/**
+ * @fn EscapeJsonString
+ * @brief Escape the characters which are not allowed in the JSON string
+ */
+std::string EscapeJsonString(const std::string& input) {
+  std::string output;
+  for (const char c : input) {
+    if (c == '"' || c == '\\') output += '\\';
+    if ((unsigned char)c < 0x20) continue;
+    output += c;
+  }
+  return output;
+}
+}  // namespace
+
+void ProfileSectionStatistics::Add(const uint64_t time_ns) {
+  count++;
+  total_time_ns += time_ns;
+  min_time_ns = std::min(min_time_ns, time_ns);
+  max_time_ns = std::max(max_time_ns, time_ns);
+  size_t bin = 0;
+  while (bin + 1 < kNumberOfBins && (time_ns >> (bin + 1)) > 0) bin++;
+  histogram[bin]++;
+}
+
+void ProfileSectionStatistics::AddHardwareCounters(const HardwareCounterValues& counters) {
+  counted_calls++;
+  for (size_t i = 0; i < counters.size(); i++) counter_totals[i] += counters[i];
+}
+
+void ProfileSectionStatistics::Merge(const ProfileSectionStatistics& statistics) {
+  count += statistics.count;
+  total_time_ns += statistics.total_time_ns;
+  min_time_ns = std::min(min_time_ns, statistics.min_time_ns);
+  max_time_ns = std::max(max_time_ns, statistics.max_time_ns);
+  for (size_t i = 0; i < kNumberOfBins; i++) histogram[i] += statistics.histogram[i];
+  counted_calls += statistics.counted_calls;
+  for (size_t i = 0; i < counter_totals.size(); i++) counter_totals[i] += statistics.counter_totals[i];
+}
+
+uint64_t ProfileSectionStatistics::CalcPercentile_ns(const double percentile) const {
+  if (count == 0) return 0;
+  const uint64_t target_count = std::max((uint64_t)ceil(count * percentile / 100.0), (uint64_t)1);
+  uint64_t cumulative_count = 0;
+  for (size_t i = 0; i < kNumberOfBins; i++) {
+    cumulative_count += histogram[i];
+    if (cumulative_count >= target_count) return std::min(((uint64_t)1 << (i + 1)), max_time_ns);
+  }
+  return max_time_ns;
+}
+
+double ProfileSectionStatistics::CalcCountPerCall(const HardwareCounter counter) const {
+  if (counted_calls == 0) return 0.0;
+  return counter_totals[(size_t)counter] / (double)counted_calls;
+}
+
+double ProfileSectionStatistics::CalcInstructionsPerCycle() const {
+  const uint64_t cycles = counter_totals[(size_t)HardwareCounter::kCycles];
+  if (cycles == 0) return 0.0;
+  return counter_totals[(size_t)HardwareCounter::kInstructions] / (double)cycles;
+}
+
+void StepProfiler::Enable(const bool is_trace_enabled, const bool is_hardware_counter_enabled) {
+  Reset();
+  GetRegistry().origin_ns = GetSteadyClock_ns(std::chrono::steady_clock::now());
+  is_trace_enabled_ = is_trace_enabled;
+  is_hardware_counter_enabled_ = false;
+  if (is_hardware_counter_enabled) {
+#ifdef __linux__
+    // Check the availability in the calling thread. The other threads open their counters at the first measurement.
+    if (GetHardwareCounterGroup().GetErrorMessage().empty()) {
+      is_hardware_counter_enabled_ = true;
+    } else {
+      std::cout << "[Warning] Hardware performance counters cannot be opened: " << GetHardwareCounterGroup().GetErrorMessage()
+                << ". Check /proc/sys/kernel/perf_event_paranoid." << std::endl;
+    }
+#else
+    std::cout << "[Warning] Hardware performance counters are supported only on Linux." << std::endl;
+#endif
+  }
+  is_enabled_ = true;
+}
+
+void StepProfiler::Disable() { is_enabled_ = false; }
+
+void StepProfiler::Reset() {
+  ProfilerRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (ThreadBuffer* buffer : registry.thread_buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    buffer->sections.clear();
+    buffer->trace_events.clear();
+  }
+  registry.finished_thread_buffer.sections.clear();
+  registry.finished_thread_buffer.trace_events.clear();
+  registry.origin_ns = GetSteadyClock_ns(std::chrono::steady_clock::now());
+}
+
+size_t StepProfiler::RegisterSection(const std::string& name) {
+  ProfilerRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto itr = registry.section_ids.find(name);
+  if (itr != registry.section_ids.end()) return itr->second;
+  const size_t section_id = registry.section_names.size();
+  registry.section_names.push_back(name);
+  registry.section_ids[name] = section_id;
+  return section_id;
+}
+
+size_t StepProfiler::RegisterSection(const std::type_info& type, const std::string& function_name) {
+  return RegisterSection(GetTypeName(type) + "::" + function_name);
+}
+
+void StepProfiler::Record(const size_t section_id, const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end,
+                          const HardwareCounterValues* counters) {
+  if (section_id == kUnregisteredSection) return;
+  const int64_t start_ns = GetSteadyClock_ns(start);
+  const int64_t duration_ns = std::max(GetSteadyClock_ns(end) - start_ns, (int64_t)0);
+
+  ThreadBuffer& buffer = GetThreadBuffer();
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+  if (buffer.sections.size() <= section_id) buffer.sections.resize(section_id + 1);
+  buffer.sections[section_id].Add((uint64_t)duration_ns);
+  if (counters != nullptr) buffer.sections[section_id].AddHardwareCounters(*counters);
+  if (is_trace_enabled_.load(std::memory_order_relaxed) && buffer.trace_events.size() < kMaxNumberOfTraceEvents) {
+    const int64_t origin_ns = GetRegistry().origin_ns.load(std::memory_order_relaxed);
+    buffer.trace_events.push_back({section_id, buffer.thread_index, start_ns - origin_ns, duration_ns});
+  }
+}
+
+bool StepProfiler::ReadHardwareCounters(HardwareCounterValues& values) {
+#ifdef __linux__
+  return GetHardwareCounterGroup().Read(values);
+#else
+  (void)values;
+  return false;
+#endif
+}
+
+std::vector<ProfileSectionStatistics> StepProfiler::GetStatistics() {
+  ProfilerRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  ThreadBuffer merged_buffer;
+  MergeBuffer(registry.finished_thread_buffer, merged_buffer);
+  for (ThreadBuffer* buffer : registry.thread_buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    if (merged_buffer.sections.size() < buffer->sections.size()) merged_buffer.sections.resize(buffer->sections.size());
+    for (size_t i = 0; i < buffer->sections.size(); i++) merged_buffer.sections[i].Merge(buffer->sections[i]);
+  }
+
+  std::vector<ProfileSectionStatistics> statistics(registry.section_names.size());
+  for (size_t i = 0; i < statistics.size(); i++) {
+    if (i < merged_buffer.sections.size()) statistics[i] = merged_buffer.sections[i];
+    statistics[i].name = registry.section_names[i];
+  }
+  return statistics;
+}
+
+void StepProfiler::WriteSummary(std::ostream& stream) {
+  const double wall_clock_time_ns = (double)(GetSteadyClock_ns(std::chrono::steady_clock::now()) - GetRegistry().origin_ns);
+  const std::vector<ProfileSectionStatistics> statistics = GetStatistics();
+  const bool has_hardware_counters =
+      std::any_of(statistics.begin(), statistics.end(), [](const ProfileSectionStatistics& section) { return section.counted_calls > 0; });
+
+  // The ratio is relative to the wall clock time, and the nested or parallel sections can exceed 100% in total
+  stream << "Step profiler summary (wall clock time " << wall_clock_time_ns * 1e-9 << " s)" << std::endl;
+  stream << "section,calls,total[ms],ratio[%],average[us],min[us],p50[us],p99[us],max[us]";
+  if (has_hardware_counters) stream << ",cycles/call,IPC,cache_misses/call,branch_misses/call";
+  stream << std::endl;
+  const std::ios::fmtflags flags = stream.flags();
+  const std::streamsize precision = stream.precision();
+  stream << std::fixed << std::setprecision(3);
+  for (const auto& section : statistics) {
+    if (section.count == 0) continue;
+    stream << section.name << "," << section.count << "," << section.total_time_ns * 1e-6 << ","
+           << (wall_clock_time_ns > 0.0 ? section.total_time_ns / wall_clock_time_ns * 100.0 : 0.0) << ","
+           << section.total_time_ns * 1e-3 / (double)section.count << "," << section.min_time_ns * 1e-3 << ","
+           << section.CalcPercentile_ns(50.0) * 1e-3 << "," << section.CalcPercentile_ns(99.0) * 1e-3 << "," << section.max_time_ns * 1e-3;
+    if (has_hardware_counters) {
+      stream << "," << section.CalcCountPerCall(HardwareCounter::kCycles) << "," << section.CalcInstructionsPerCycle() << ","
+             << section.CalcCountPerCall(HardwareCounter::kCacheMisses) << "," << section.CalcCountPerCall(HardwareCounter::kBranchMisses);
+    }
+    stream << std::endl;
+  }
+  stream.flags(flags);
+  stream.precision(precision);
+}
+
+bool StepProfiler::WriteChromeTrace(const std::string& file_path) {
+  std::ofstream file(file_path, std::ios::trunc);
+  if (!file.is_open()) return false;
+
+  ProfilerRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::vector<std::string> names;
+  for (const auto& name : registry.section_names) names.push_back(EscapeJsonString(name));
+
+  // The timestamps are written in [us] as the trace event format
+  file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  bool is_first_event = true;
+  auto write_events = [&](const ThreadBuffer& buffer) {
+    for (const auto& event : buffer.trace_events) {
+      file << (is_first_event ? "\n" : ",\n") << "{\"name\":\"" << names[event.section_id] << "\",\"cat\":\"s2e\",\"ph\":\"X\",\"ts\":"
+           << event.start_ns * 1e-3 << ",\"dur\":" << event.duration_ns * 1e-3 << ",\"pid\":0,\"tid\":" << event.thread_index << "}";
+      is_first_event = false;
+    }
+  };
+  write_events(registry.finished_thread_buffer);
+  for (ThreadBuffer* buffer : registry.thread_buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    write_events(*buffer);
+  }
+  file << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+  return (bool)file;
+}
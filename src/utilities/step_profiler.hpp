@@ -0,0 +1,252 @@
+/**
+ * @file step_profiler.hpp
+ * @brief Low overhead profiler to measure the calculation time of each subsystem in the simulation step
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_STEP_PROFILER_HPP_
+#define S2E_LIBRARY_UTILITIES_STEP_PROFILER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+/**
+ * @enum HardwareCounter
+ * @brief Hardware performance counters measured with the step profiler
+ */
+enum class HardwareCounter {
+  kCycles,            //!< CPU cycles
+  kInstructions,      //!< Retired instructions
+  kCacheMisses,       //!< Last level cache misses
+  kBranchMisses,      //!< Mispredicted branches
+  kNumberOfCounters,  //!< Number of the counters. Do not remove. Place on the bottom.
+};
+
+using HardwareCounterValues = std::array<uint64_t, (size_t)HardwareCounter::kNumberOfCounters>;  //!< Values indexed by HardwareCounter
+
+/**
+ * @struct ProfileSectionStatistics
+ * @brief Statistics of the calculation time and the hardware counters of a profiled section
+ */
+struct ProfileSectionStatistics {
+  static const size_t kNumberOfBins = 40;  //!< Number of histogram bins. The bin i counts the time in [2^i, 2^(i+1)) ns.
+
+  std::string name;                                 //!< Name of the section
+  uint64_t count = 0;                               //!< Number of calls
+  uint64_t total_time_ns = 0;                       //!< Total time [ns]
+  uint64_t min_time_ns = UINT64_MAX;                //!< Minimum time [ns]
+  uint64_t max_time_ns = 0;                         //!< Maximum time [ns]
+  std::array<uint64_t, kNumberOfBins> histogram{};  //!< Histogram of the time in the logarithmic bins
+  uint64_t counted_calls = 0;                       //!< Number of calls measured with the hardware counters
+  HardwareCounterValues counter_totals{};           //!< Total of the hardware counters of the counted calls
+
+  /**
+   * @fn Add
+   * @brief Add a measured time
+   * @param [in] time_ns: Measured time [ns]
+   */
+  void Add(const uint64_t time_ns);
+  /**
+   * @fn AddHardwareCounters
+   * @brief Add the hardware counters measured in a call
+   * @param [in] counters: Increments of the hardware counters in the call
+   */
+  void AddHardwareCounters(const HardwareCounterValues& counters);
+  /**
+   * @fn Merge
+   * @brief Merge the statistics of the same section measured in another thread
+   * @param [in] statistics: Statistics to be merged
+   */
+  void Merge(const ProfileSectionStatistics& statistics);
+  /**
+   * @fn CalcPercentile_ns
+   * @brief Return the upper bound of the histogram bin which includes the percentile [ns]
+   * @param [in] percentile: Percentile [0, 100]
+   */
+  uint64_t CalcPercentile_ns(const double percentile) const;
+  /**
+   * @fn CalcCountPerCall
+   * @brief Return the average of the hardware counter per counted call
+   * @param [in] counter: Hardware counter
+   */
+  double CalcCountPerCall(const HardwareCounter counter) const;
+  /**
+   * @fn CalcInstructionsPerCycle
+   * @brief Return the instructions per cycle (IPC) of the counted calls
+   */
+  double CalcInstructionsPerCycle() const;
+};
+
+/**
+ * @class StepProfiler
+ * @brief Process wide profiler of the sections in the simulation step
+ * @details The time is measured with ScopedProfileTimer and stored in the thread local buffers, so the parallel spacecraft updates and
+ *          the parallel Monte-Carlo cases are measured without contention. The results of all threads are merged in the summary.
+ *          When the profiler is disabled, ScopedProfileTimer only checks a flag.
+ *          On Linux, the hardware performance counters (cycles, instructions, cache misses, and branch misses) of the calling thread can also be
+ *          read with perf_event around the same sections to find whether a section is bound by the computation or by the memory access.
+ * @note Reading the hardware counters is a system call (about 1 us), so it should be enabled only when the counters are analyzed.
+ *       The counters of the user space are counted, and they are not scaled when the kernel multiplexes them with other perf events.
+ */
+class StepProfiler {
+ public:
+  static const size_t kUnregisteredSection = SIZE_MAX;        //!< Section ID before the registration
+  static constexpr size_t kMaxNumberOfTraceEvents = 1000000;  //!< Maximum number of trace events stored in each thread
+
+  /**
+   * @fn Enable
+   * @brief Enable the profiler and reset the measured results
+   * @param [in] is_trace_enabled: Store each measurement as a trace event for WriteChromeTrace
+   * @param [in] is_hardware_counter_enabled: Measure the hardware performance counters. It is ignored with a warning when they are not available.
+   */
+  static void Enable(const bool is_trace_enabled = false, const bool is_hardware_counter_enabled = false);
+  /**
+   * @fn Disable
+   * @brief Disable the profiler. The measured results are kept.
+   */
+  static void Disable();
+  /**
+   * @fn IsEnabled
+   * @brief Return true when the profiler is enabled
+   */
+  static inline bool IsEnabled() { return is_enabled_.load(std::memory_order_relaxed); }
+  /**
+   * @fn IsHardwareCounterEnabled
+   * @brief Return true when the hardware performance counters are measured
+   */
+  static inline bool IsHardwareCounterEnabled() { return is_hardware_counter_enabled_.load(std::memory_order_relaxed); }
+  /**
+   * @fn Reset
+   * @brief Clear the measured results of all threads
+   */
+  static void Reset();
+
+  /**
+   * @fn RegisterSection
+   * @brief Register the section and return its ID. The same ID is returned for the same name.
+   * @param [in] name: Name of the section
+   */
+  static size_t RegisterSection(const std::string& name);
+  /**
+   * @fn RegisterSection
+   * @brief Register the section named with the class name and the function name (e.g., ReactionWheel::MainRoutine)
+   * @param [in] type: Type information of the object
+   * @param [in] function_name: Function name
+   */
+  static size_t RegisterSection(const std::type_info& type, const std::string& function_name);
+  /**
+   * @fn Record
+   * @brief Record the measured time of the section in the buffer of the current thread
+   * @param [in] section_id: Section ID
+   * @param [in] start: Start time
+   * @param [in] end: End time
+   * @param [in] counters: Increments of the hardware counters in the section. nullptr when they are not measured.
+   */
+  static void Record(const size_t section_id, const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end,
+                     const HardwareCounterValues* counters = nullptr);
+  /**
+   * @fn ReadHardwareCounters
+   * @brief Read the hardware counters of the current thread. The counters are opened at the first call in each thread.
+   * @param [out] values: Counter values
+   * @return False when the counters are not available
+   */
+  static bool ReadHardwareCounters(HardwareCounterValues& values);
+
+  /**
+   * @fn GetStatistics
+   * @brief Return the statistics of all sections merged over the threads in the order of the registration
+   */
+  static std::vector<ProfileSectionStatistics> GetStatistics();
+  /**
+   * @fn WriteSummary
+   * @brief Write the summary table of the sections measured at least once
+   * @note The columns of the hardware counters (cycles, IPC, cache misses, and branch misses per call) are added when they are measured.
+   * @param [out] stream: Output stream
+   */
+  static void WriteSummary(std::ostream& stream);
+  /**
+   * @fn WriteChromeTrace
+   * @brief Write the trace events in the Chrome trace event format (JSON). The file can be opened with chrome://tracing or Perfetto.
+   * @param [in] file_path: Output file path
+   * @return True when the file is written successfully
+   */
+  static bool WriteChromeTrace(const std::string& file_path);
+
+ private:
+  static std::atomic<bool> is_enabled_;                   //!< Flag to enable the profiler
+  static std::atomic<bool> is_trace_enabled_;             //!< Flag to store the trace events
+  static std::atomic<bool> is_hardware_counter_enabled_;  //!< Flag to measure the hardware counters
+};
+
+/**
+ * @class ScopedProfileTimer
+ * @brief Timer which measures the time (and the hardware counters when enabled) from the construction to the destruction and records it to
+ *        StepProfiler
+ */
+class ScopedProfileTimer {
+ public:
+  /**
+   * @fn ScopedProfileTimer
+   * @brief Constructor for the section registered beforehand (e.g., function local static ID)
+   * @param [in] section_id: Section ID returned by StepProfiler::RegisterSection
+   */
+  explicit ScopedProfileTimer(const size_t section_id) : section_id_(section_id), is_active_(StepProfiler::IsEnabled()) {
+    if (is_active_) Start();
+  }
+  /**
+   * @fn ScopedProfileTimer
+   * @brief Constructor for the section of each object type, registered only when the profiler is enabled
+   * @param [in/out] section_id: Section ID cached in the object. It is registered at the first measurement.
+   * @param [in] type: Type information of the object
+   * @param [in] function_name: Function name
+   */
+  ScopedProfileTimer(size_t& section_id, const std::type_info& type, const char* function_name) : is_active_(StepProfiler::IsEnabled()) {
+    if (!is_active_) return;
+    if (section_id == StepProfiler::kUnregisteredSection) section_id = StepProfiler::RegisterSection(type, function_name);
+    section_id_ = section_id;
+    Start();
+  }
+  /**
+   * @fn ~ScopedProfileTimer
+   * @brief Destructor to record the measured time
+   */
+  ~ScopedProfileTimer() {
+    if (!is_active_) return;
+    // The counters are read outside of the measured time
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    HardwareCounterValues end_counters;
+    if (is_counter_active_ && StepProfiler::ReadHardwareCounters(end_counters)) {
+      for (size_t i = 0; i < end_counters.size(); i++) end_counters[i] -= start_counters_[i];
+      StepProfiler::Record(section_id_, start_, end, &end_counters);
+    } else {
+      StepProfiler::Record(section_id_, start_, end);
+    }
+  }
+
+  ScopedProfileTimer(const ScopedProfileTimer&) = delete;
+  ScopedProfileTimer& operator=(const ScopedProfileTimer&) = delete;
+
+ private:
+  size_t section_id_ = StepProfiler::kUnregisteredSection;  //!< Section ID
+  bool is_active_;                                          //!< The profiler is enabled at the construction
+  bool is_counter_active_ = false;                          //!< The hardware counters are read at the construction
+  std::chrono::steady_clock::time_point start_;             //!< Start time
+  HardwareCounterValues start_counters_;                    //!< Hardware counters at the start
+
+  /**
+   * @fn Start
+   * @brief Read the hardware counters and the start time
+   */
+  inline void Start() {
+    is_counter_active_ = StepProfiler::IsHardwareCounterEnabled() && StepProfiler::ReadHardwareCounters(start_counters_);
+    start_ = std::chrono::steady_clock::now();
+  }
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_STEP_PROFILER_HPP_
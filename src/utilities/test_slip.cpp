@@ -0,0 +1,138 @@
+/**
+ * @file test_slip.cpp
+ * @brief Test codes for SLIP encoding and SlipDecoder class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "slip.hpp"
+
+namespace {
+const std::vector<uint8_t> kFrameWithSpecialBytes = {0x01, 0xc0, 0x02, 0xdb, 0xdc, 0xdd, 0xc0, 0xdb};  //!< Frame with FEND and FESC
+const std::vector<uint8_t> kEncodedFrame = {0x01, 0xdb, 0xdc, 0x02, 0xdb, 0xdd, 0xdc, 0xdd, 0xdb, 0xdc, 0xdb, 0xdd, 0xc0};  //!< Encoded frame
+}  // namespace
+
+/**
+ * @brief Test for the encoding and decoding of the frame with FEND and FESC
+ */
+TEST(Slip, RoundTrip) {
+  EXPECT_EQ(kEncodedFrame, encode_slip(kFrameWithSpecialBytes));
+  EXPECT_EQ(kFrameWithSpecialBytes, decode_slip(kEncodedFrame));
+
+  std::vector<uint8_t> encoded_with_header = encode_slip_with_header(kFrameWithSpecialBytes);
+  ASSERT_EQ(kEncodedFrame.size() + 1, encoded_with_header.size());
+  EXPECT_EQ(0xc0, encoded_with_header[0]);
+  EXPECT_EQ(kFrameWithSpecialBytes, decode_slip_with_header(encoded_with_header));
+  EXPECT_EQ(kEncodedFrame.size() + 1, CalcSlipEncodedLength(kFrameWithSpecialBytes.data(), kFrameWithSpecialBytes.size(), true));
+
+  // The output buffer shorter than the encoded frame
+  uint8_t output[16];
+  EXPECT_EQ(0u, EncodeSlipFrame(kFrameWithSpecialBytes.data(), kFrameWithSpecialBytes.size(), output, kEncodedFrame.size() - 1));
+  EXPECT_EQ(kEncodedFrame.size(), EncodeSlipFrame(kFrameWithSpecialBytes.data(), kFrameWithSpecialBytes.size(), output, sizeof(output)));
+  EXPECT_EQ(kEncodedFrame, std::vector<uint8_t>(output, output + kEncodedFrame.size()));
+}
+
+/**
+ * @brief Test for the decoder fed with the fragmented byte stream
+ */
+TEST(Slip, FragmentedFeed) {
+  // Two frames with the headers
+  std::vector<uint8_t> stream = encode_slip_with_header(kFrameWithSpecialBytes);
+  const std::vector<uint8_t> second_frame = {0x10, 0x20, 0xc0};
+  const std::vector<uint8_t> second_encoded = encode_slip_with_header(second_frame);
+  stream.insert(stream.end(), second_encoded.begin(), second_encoded.end());
+
+  // All fragment lengths including the split between FESC and the transposed byte
+  for (size_t fragment_length = 1; fragment_length <= stream.size(); fragment_length++) {
+    uint8_t frame_buffer[32];
+    SlipDecoder decoder(frame_buffer, sizeof(frame_buffer));
+    std::vector<std::vector<uint8_t>> frames;
+    size_t number_of_completed_frames = 0;
+    for (size_t position = 0; position < stream.size(); position += fragment_length) {
+      const size_t length = std::min(fragment_length, stream.size() - position);
+      number_of_completed_frames += decoder.Feed(stream.data() + position, length,
+                                                 [&](const uint8_t* frame, const size_t frame_length) {
+                                                   frames.emplace_back(frame, frame + frame_length);
+                                                 });
+    }
+    EXPECT_EQ(2u, number_of_completed_frames);
+    EXPECT_EQ(2u, decoder.GetNumberOfFrames());
+    ASSERT_EQ(2u, frames.size());
+    EXPECT_EQ(kFrameWithSpecialBytes, frames[0]);
+    EXPECT_EQ(second_frame, frames[1]);
+    EXPECT_EQ(0u, decoder.GetPartialFrameLength());
+    EXPECT_EQ(0u, decoder.GetNumberOfEscapeErrors());
+  }
+
+  // The frame in decoding is kept until the next FEND and discarded by Reset
+  uint8_t frame_buffer[32];
+  SlipDecoder decoder(frame_buffer, sizeof(frame_buffer));
+  EXPECT_EQ(0u, decoder.Feed(kEncodedFrame.data(), 4, nullptr));
+  EXPECT_EQ(3u, decoder.GetPartialFrameLength());
+  decoder.Reset();
+  EXPECT_EQ(0u, decoder.GetPartialFrameLength());
+}
+
+/**
+ * @brief Test for the oversize frames and the escape errors
+ */
+TEST(Slip, DecodeErrors) {
+  uint8_t frame_buffer[4];
+  SlipDecoder decoder(frame_buffer, sizeof(frame_buffer));
+  std::vector<std::vector<uint8_t>> frames;
+  auto handler = [&](const uint8_t* frame, const size_t frame_length) { frames.emplace_back(frame, frame + frame_length); };
+
+  // The frame longer than the frame buffer is dropped until the next FEND, and the following frame is decoded
+  const std::vector<uint8_t> stream = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xc0, 0x07, 0x08, 0xc0};
+  EXPECT_EQ(1u, decoder.Feed(stream.data(), stream.size(), handler));
+  EXPECT_EQ(1u, decoder.GetNumberOfOversizeFrames());
+  ASSERT_EQ(1u, frames.size());
+  EXPECT_EQ(std::vector<uint8_t>({0x07, 0x08}), frames[0]);
+
+  // The frame of the buffer size is not dropped
+  const std::vector<uint8_t> full_frame = {0x01, 0x02, 0x03, 0x04, 0xc0};
+  EXPECT_EQ(1u, decoder.Feed(full_frame.data(), full_frame.size(), handler));
+  EXPECT_EQ(1u, decoder.GetNumberOfOversizeFrames());
+
+  // FESC followed by an invalid byte stores the byte as it is
+  const std::vector<uint8_t> invalid_escape = {0xdb, 0x41, 0x42, 0xc0};
+  EXPECT_EQ(1u, decoder.Feed(invalid_escape.data(), invalid_escape.size(), handler));
+  EXPECT_EQ(1u, decoder.GetNumberOfEscapeErrors());
+  ASSERT_EQ(3u, frames.size());
+  EXPECT_EQ(std::vector<uint8_t>({0x41, 0x42}), frames[2]);
+
+  // The empty frames are ignored
+  const std::vector<uint8_t> empty_frames = {0xc0, 0xc0, 0xc0};
+  EXPECT_EQ(0u, decoder.Feed(empty_frames.data(), empty_frames.size(), handler));
+  EXPECT_EQ(3u, decoder.GetNumberOfFrames());
+}
+
+/**
+ * @brief Test for the encoding and decoding through the ring buffer wrapping around its end
+ */
+TEST(Slip, RingBufferWraparound) {
+  // The capacity is not the power of two, so the frames wrap around at the end of the storage
+  SpscRingBuffer buffer(20);
+  uint8_t frame_buffer[32];
+  SlipDecoder decoder(frame_buffer, sizeof(frame_buffer));
+  size_t number_of_frames = 0;
+  for (size_t i = 0; i < 20; i++) {
+    std::vector<uint8_t> frame = kFrameWithSpecialBytes;
+    frame[0] = (uint8_t)i;
+    ASSERT_TRUE(EncodeSlipFrame(frame.data(), frame.size(), buffer, true));
+    EXPECT_EQ(kEncodedFrame.size() + 1, buffer.GetSize());
+    // No space for the second frame
+    EXPECT_FALSE(EncodeSlipFrame(frame.data(), frame.size(), buffer, true));
+    EXPECT_EQ(kEncodedFrame.size() + 1, buffer.GetSize());
+
+    number_of_frames += decoder.Feed(buffer, [&](const uint8_t* decoded_frame, const size_t frame_length) {
+      EXPECT_EQ(frame, std::vector<uint8_t>(decoded_frame, decoded_frame + frame_length));
+    });
+    EXPECT_EQ(0u, buffer.GetSize());
+  }
+  EXPECT_EQ(20u, number_of_frames);
+  // The frames are not written partially
+  EXPECT_EQ(0u, buffer.GetOverflowBytes());
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_spsc_ring_buffer.cpp
+ * @brief Test codes for SpscRingBuffer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "spsc_ring_buffer.hpp"
+
+/**
+ * @brief Test for the write and read wrapping around the end of the storage
+ */
+TEST(SpscRingBuffer, Wraparound) {
+  // The storage size is 8 for the capacity 6
+  SpscRingBuffer buffer(6);
+  EXPECT_EQ(6u, buffer.GetCapacity());
+  unsigned char data[6];
+  unsigned char read_data[6];
+  unsigned char value = 0;
+  for (size_t i = 0; i < 20; i++) {
+    for (size_t j = 0; j < 5; j++) data[j] = value++;
+    ASSERT_EQ(5u, buffer.Write(data, 5));
+    EXPECT_EQ(5u, buffer.GetSize());
+    // Read in the two calls to move the read position
+    ASSERT_EQ(2u, buffer.Read(read_data, 2));
+    ASSERT_EQ(3u, buffer.Read(read_data + 2, 6));
+    for (size_t j = 0; j < 5; j++) {
+      EXPECT_EQ(data[j], read_data[j]);
+    }
+    EXPECT_EQ(0u, buffer.GetSize());
+  }
+
+  // The contiguous region ends at the end of the storage: the write index is 100 (position 4)
+  size_t region_length;
+  buffer.PeekWritableRegion(region_length);
+  EXPECT_EQ(4u, region_length);
+  buffer.CommitWrite(region_length);
+  buffer.PeekWritableRegion(region_length);
+  EXPECT_EQ(2u, region_length);
+  buffer.PeekReadableRegion(region_length);
+  EXPECT_EQ(4u, region_length);
+  buffer.Clear();
+  EXPECT_EQ(0u, buffer.GetSize());
+  EXPECT_EQ(0u, buffer.GetOverflowBytes());
+}
+
+/**
+ * @brief Test for the overflow count and the high-water mark
+ */
+TEST(SpscRingBuffer, Overflow) {
+  SpscRingBuffer buffer(10);
+  const unsigned char data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  EXPECT_EQ(8u, buffer.Write(data, 8));
+  EXPECT_EQ(8u, buffer.GetHighWaterMarkBytes());
+  // The bytes which do not fit are dropped without overwriting the unread data
+  EXPECT_EQ(2u, buffer.Write(data, 8));
+  EXPECT_EQ(6u, buffer.GetOverflowBytes());
+  EXPECT_EQ(10u, buffer.GetHighWaterMarkBytes());
+  EXPECT_EQ(0u, buffer.Write(data, 3));
+  EXPECT_EQ(9u, buffer.GetOverflowBytes());
+
+  unsigned char read_data[10];
+  ASSERT_EQ(10u, buffer.Read(read_data, 10));
+  for (size_t i = 0; i < 8; i++) {
+    EXPECT_EQ(data[i], read_data[i]);
+  }
+  EXPECT_EQ(1, read_data[8]);
+  EXPECT_EQ(2, read_data[9]);
+
+  // The high-water mark is kept after the read
+  EXPECT_EQ(4u, buffer.Write(data, 4));
+  EXPECT_EQ(10u, buffer.GetHighWaterMarkBytes());
+  EXPECT_EQ(9u, buffer.GetOverflowBytes());
+}
+
+/**
+ * @brief Test for the producer and the consumer in the different threads
+ */
+TEST(SpscRingBuffer, TwoThreads) {
+  SpscRingBuffer buffer(100);
+  const size_t number_of_bytes = 100000;
+  std::thread producer([&]() {
+    size_t written_bytes = 0;
+    unsigned char data[37];
+    while (written_bytes < number_of_bytes) {
+      size_t length = std::min(sizeof(data), number_of_bytes - written_bytes);
+      // Write only the free space to avoid the overflow
+      length = std::min(length, buffer.GetCapacity() - buffer.GetSize());
+      for (size_t i = 0; i < length; i++) data[i] = (unsigned char)((written_bytes + i) % 251);
+      const size_t written_length = buffer.Write(data, length);
+      // Give the time to the consumer when the buffer is full (e.g., on a single core)
+      if (written_length == 0) std::this_thread::yield();
+      written_bytes += written_length;
+    }
+  });
+
+  size_t read_bytes = 0;
+  size_t number_of_errors = 0;
+  unsigned char read_data[53];
+  while (read_bytes < number_of_bytes) {
+    const size_t length = buffer.Read(read_data, sizeof(read_data));
+    if (length == 0) std::this_thread::yield();
+    for (size_t i = 0; i < length; i++) {
+      if (read_data[i] != (unsigned char)((read_bytes + i) % 251)) number_of_errors++;
+    }
+    read_bytes += length;
+  }
+  producer.join();
+
+  EXPECT_EQ(0u, number_of_errors);
+  EXPECT_EQ(number_of_bytes, read_bytes);
+  EXPECT_EQ(0u, buffer.GetOverflowBytes());
+  EXPECT_LE(buffer.GetHighWaterMarkBytes(), 100u);
+}
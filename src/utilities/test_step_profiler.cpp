@@ -0,0 +1,140 @@
+/**
+ * @file test_step_profiler.cpp
+ * @brief Test codes for StepProfiler class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "step_profiler.hpp"
+
+namespace {
+/**
+ * @fn FindSection
+ * @brief Return the statistics of the section with the name
+ */
+ProfileSectionStatistics FindSection(const std::string& name) {
+  for (const auto& section : StepProfiler::GetStatistics()) {
+    if (section.name == name) return section;
+  }
+  return ProfileSectionStatistics();
+}
+}  // namespace
+
+/**
+ * @brief Test for the percentile calculated from the logarithmic histogram
+ */
+TEST(StepProfiler, CalcPercentile) {
+  ProfileSectionStatistics statistics;
+  EXPECT_EQ(0u, statistics.CalcPercentile_ns(50.0));
+
+  // A single call returns the measured time since it is smaller than the upper bound of the bin
+  statistics.Add(100);
+  EXPECT_EQ(100u, statistics.CalcPercentile_ns(0.0));
+  EXPECT_EQ(100u, statistics.CalcPercentile_ns(100.0));
+
+  // 90 calls in [64, 128) ns and 10 calls in [4096, 8192) ns
+  for (size_t i = 1; i < 90; i++) statistics.Add(64 + i % 64);
+  for (size_t i = 0; i < 10; i++) statistics.Add(4100 + i * 100);
+  EXPECT_EQ(100u, statistics.count);
+  EXPECT_EQ(64u, statistics.min_time_ns);
+  EXPECT_EQ(5000u, statistics.max_time_ns);
+  EXPECT_EQ(90u, statistics.histogram[6]);
+  EXPECT_EQ(10u, statistics.histogram[12]);
+  EXPECT_EQ(128u, statistics.CalcPercentile_ns(0.0));
+  EXPECT_EQ(128u, statistics.CalcPercentile_ns(50.0));
+  EXPECT_EQ(128u, statistics.CalcPercentile_ns(90.0));
+  EXPECT_EQ(5000u, statistics.CalcPercentile_ns(90.5));
+  EXPECT_EQ(5000u, statistics.CalcPercentile_ns(99.0));
+
+  // The zero time is counted in the first bin
+  ProfileSectionStatistics zero_statistics;
+  zero_statistics.Add(0);
+  EXPECT_EQ(1u, zero_statistics.histogram[0]);
+  EXPECT_EQ(0u, zero_statistics.CalcPercentile_ns(50.0));
+}
+
+/**
+ * @brief Test for the merge of the statistics against the statistics of all calls
+ */
+TEST(StepProfiler, Merge) {
+  ProfileSectionStatistics all_statistics, first_statistics, second_statistics;
+  for (uint64_t i = 0; i < 200; i++) {
+    const uint64_t time_ns = (i * 7919) % 100000;
+    all_statistics.Add(time_ns);
+    (i % 3 == 0 ? first_statistics : second_statistics).Add(time_ns);
+  }
+  first_statistics.Merge(second_statistics);
+
+  EXPECT_EQ(all_statistics.count, first_statistics.count);
+  EXPECT_EQ(all_statistics.total_time_ns, first_statistics.total_time_ns);
+  EXPECT_EQ(all_statistics.min_time_ns, first_statistics.min_time_ns);
+  EXPECT_EQ(all_statistics.max_time_ns, first_statistics.max_time_ns);
+  EXPECT_EQ(all_statistics.histogram, first_statistics.histogram);
+  for (const double percentile : {1.0, 50.0, 90.0, 99.0}) {
+    EXPECT_EQ(all_statistics.CalcPercentile_ns(percentile), first_statistics.CalcPercentile_ns(percentile));
+  }
+}
+
+/**
+ * @brief Test for the measurements recorded in several threads
+ */
+TEST(StepProfiler, Record) {
+  const size_t section_id = StepProfiler::RegisterSection("TestStepProfiler::Record");
+  EXPECT_EQ(section_id, StepProfiler::RegisterSection("TestStepProfiler::Record"));
+  StepProfiler::Enable(true);
+
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  auto record = [&](const size_t number_of_calls) {
+    for (size_t i = 0; i < number_of_calls; i++) StepProfiler::Record(section_id, start, start + std::chrono::nanoseconds(1000));
+  };
+  record(5);
+  // The measurements of the finished thread are kept
+  std::thread thread(record, 3);
+  thread.join();
+  StepProfiler::Record(StepProfiler::kUnregisteredSection, start, start + std::chrono::nanoseconds(1000));
+  {
+    ScopedProfileTimer timer(section_id);
+  }
+
+  ProfileSectionStatistics statistics = FindSection("TestStepProfiler::Record");
+  EXPECT_EQ(9u, statistics.count);
+  EXPECT_GE(statistics.total_time_ns, 8000u);
+  // The median is in the bin [512, 1024) ns
+  EXPECT_GE(statistics.CalcPercentile_ns(50.0), 1000u);
+  EXPECT_LE(statistics.CalcPercentile_ns(50.0), 1024u);
+
+  std::stringstream summary;
+  StepProfiler::WriteSummary(summary);
+  EXPECT_NE(std::string::npos, summary.str().find("TestStepProfiler::Record,9,"));
+
+  const std::string trace_file = "test_step_profiler_trace.json";
+  ASSERT_TRUE(StepProfiler::WriteChromeTrace(trace_file));
+  std::ifstream trace_stream(trace_file);
+  const std::string trace((std::istreambuf_iterator<char>(trace_stream)), std::istreambuf_iterator<char>());
+  trace_stream.close();
+  std::remove(trace_file.c_str());
+  size_t number_of_events = 0;
+  for (size_t position = trace.find("TestStepProfiler::Record"); position != std::string::npos;
+       position = trace.find("TestStepProfiler::Record", position + 1)) {
+    number_of_events++;
+  }
+  EXPECT_EQ(9u, number_of_events);
+
+  // The disabled profiler does not measure the scoped timer, and Enable resets the results
+  StepProfiler::Disable();
+  {
+    ScopedProfileTimer timer(section_id);
+  }
+  EXPECT_EQ(9u, FindSection("TestStepProfiler::Record").count);
+  StepProfiler::Enable();
+  StepProfiler::Disable();
+  EXPECT_EQ(0u, FindSection("TestStepProfiler::Record").count);
+}
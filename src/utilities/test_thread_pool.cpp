@@ -0,0 +1,165 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Test codes for ThreadPool and TaskGraph classes with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+/**
+ * @brief Test for ParallelFor calling the function once for each index
+ */
+TEST(ThreadPool, ParallelFor) {
+  for (const unsigned int number_of_threads : {1u, 2u, 4u}) {
+    ThreadPool thread_pool(number_of_threads);
+    EXPECT_EQ(number_of_threads, thread_pool.GetNumberOfThreads());
+    const size_t count = 1000;
+    std::vector<std::atomic<int>> number_of_calls(count);
+    for (auto& number : number_of_calls) number = 0;
+    thread_pool.ParallelFor(count, [&](const size_t index) { number_of_calls[index]++; });
+    for (size_t i = 0; i < count; i++) {
+      EXPECT_EQ(1, number_of_calls[i]);
+    }
+    // No call for the empty range
+    thread_pool.ParallelFor(0, [&](const size_t index) { number_of_calls[index]++; });
+  }
+}
+
+/**
+ * @brief Test for the exception in ParallelFor rethrown in the calling thread
+ */
+TEST(ThreadPool, ParallelForException) {
+  for (const unsigned int number_of_threads : {1u, 4u}) {
+    ThreadPool thread_pool(number_of_threads);
+    std::atomic<size_t> number_of_calls{0};
+    EXPECT_THROW(thread_pool.ParallelFor(10000,
+                                         [&](const size_t index) {
+                                           number_of_calls++;
+                                           if (index == 10) throw std::runtime_error("test");
+                                         }),
+                 std::runtime_error);
+    // New indices are not taken after the exception in the serial execution
+    if (number_of_threads == 1) {
+      EXPECT_EQ(11u, number_of_calls);
+    }
+
+    // The pool is still usable
+    std::atomic<size_t> sum{0};
+    thread_pool.ParallelFor(100, [&](const size_t index) { sum += index; });
+    EXPECT_EQ(4950u, sum);
+  }
+}
+
+/**
+ * @brief Test for ParallelFor and WaitUntil nested in the tasks of the same pool
+ */
+TEST(ThreadPool, NestedWait) {
+  ThreadPool thread_pool(4);
+  std::atomic<size_t> sum{0};
+  thread_pool.ParallelFor(8, [&](const size_t outer_index) {
+    thread_pool.ParallelFor(100, [&](const size_t inner_index) { sum += outer_index * 100 + inner_index; });
+
+    // The waiting task executes the submitted tasks by itself when the other threads are busy
+    std::atomic<size_t> number_of_finished_tasks{0};
+    for (size_t i = 0; i < 10; i++) {
+      thread_pool.Submit([&]() { number_of_finished_tasks++; });
+    }
+    thread_pool.WaitUntil([&]() { return number_of_finished_tasks == 10; });
+  });
+  EXPECT_EQ(799u * 800u / 2u, sum);
+}
+
+/**
+ * @brief Test for the submitted order of the tasks in the deterministic mode
+ */
+TEST(ThreadPool, DeterministicOrder) {
+  ThreadPool thread_pool(4, true);
+  EXPECT_TRUE(thread_pool.IsDeterministic());
+  EXPECT_EQ(1u, thread_pool.GetNumberOfThreads());
+
+  std::vector<size_t> order;
+  for (size_t i = 0; i < 5; i++) {
+    thread_pool.Submit([&, i]() {
+      order.push_back(i);
+      // The tasks submitted by a task are executed after the tasks submitted before
+      if (i == 1) thread_pool.Submit([&]() { order.push_back(10); });
+    });
+  }
+  thread_pool.WaitUntil([&]() { return order.size() == 6; });
+  const std::vector<size_t> expected_order = {0, 1, 2, 3, 4, 10};
+  EXPECT_EQ(expected_order, order);
+
+  order.clear();
+  thread_pool.ParallelFor(5, [&](const size_t index) { order.push_back(index); });
+  const std::vector<size_t> expected_indices = {0, 1, 2, 3, 4};
+  EXPECT_EQ(expected_indices, order);
+}
+
+/**
+ * @brief Test for the dependencies and the barriers of TaskGraph
+ */
+TEST(TaskGraph, Dependencies) {
+  ThreadPool thread_pool(4);
+  std::mutex mutex;
+  std::vector<size_t> finished_tasks;
+  auto make_task = [&](const size_t id) {
+    return [&, id]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished_tasks.push_back(id);
+    };
+  };
+
+  // Diamond 0 -> (1, 2) -> 3, independent tasks 4 and 5, barrier 6, and task 7 after the barrier
+  TaskGraph task_graph;
+  EXPECT_EQ(0u, task_graph.AddTask("a", make_task(0)));
+  EXPECT_EQ(1u, task_graph.AddTask("b", make_task(1), {0}));
+  EXPECT_EQ(2u, task_graph.AddTask("c", make_task(2), {0}));
+  EXPECT_EQ(3u, task_graph.AddTask("d", make_task(3), {1, 2}));
+  EXPECT_EQ(4u, task_graph.AddTask("e", make_task(4)));
+  EXPECT_EQ(5u, task_graph.AddTask("f", make_task(5)));
+  EXPECT_EQ(6u, task_graph.AddBarrier());
+  EXPECT_EQ(7u, task_graph.AddTask("g", make_task(7), {6}));
+  EXPECT_EQ(8u, task_graph.GetNumberOfTasks());
+  EXPECT_EQ("barrier", task_graph.GetTaskName(6));
+  EXPECT_THROW(task_graph.AddTask("h", make_task(8), {8}), std::invalid_argument);
+
+  // The graph can be executed repeatedly
+  for (size_t execution = 0; execution < 20; execution++) {
+    finished_tasks.clear();
+    task_graph.Execute(thread_pool);
+    ASSERT_EQ(7u, finished_tasks.size());
+    std::vector<size_t> position(8, 0);
+    for (size_t i = 0; i < finished_tasks.size(); i++) position[finished_tasks[i]] = i;
+    EXPECT_LT(position[0], position[1]);
+    EXPECT_LT(position[0], position[2]);
+    EXPECT_LT(position[1], position[3]);
+    EXPECT_LT(position[2], position[3]);
+    // All tasks before the barrier are finished before the task after the barrier
+    EXPECT_EQ(7u, finished_tasks.back());
+  }
+
+  std::stringstream timings;
+  task_graph.WriteTimings(timings);
+  EXPECT_EQ(std::string::npos, timings.str().find("barrier"));
+  EXPECT_NE(std::string::npos, timings.str().find("g: "));
+}
+
+/**
+ * @brief Test for the exception in TaskGraph rethrown in the calling thread
+ */
+TEST(TaskGraph, Exception) {
+  ThreadPool thread_pool(2);
+  std::atomic<bool> is_successor_called{false};
+  TaskGraph task_graph;
+  const size_t failing_task = task_graph.AddTask("failing", []() { throw std::runtime_error("test"); });
+  task_graph.AddTask("successor", [&]() { is_successor_called = true; }, {failing_task});
+  EXPECT_THROW(task_graph.Execute(thread_pool), std::runtime_error);
+  // The successors of the failed task are not started
+  EXPECT_FALSE(is_successor_called);
+}
@@ -0,0 +1,235 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Work-stealing thread pool and task graph shared by the parallel features of the simulation
+ */
+
+#include "thread_pool.hpp"
+
+#include <chrono>
+#include <stdexcept>
+
+namespace {
+thread_local const ThreadPool* current_thread_pool = nullptr;  //!< Thread pool of the current worker thread
+thread_local size_t current_queue_index = 0;                   //!< Queue index of the current worker thread
+}  // namespace
+
+ThreadPool::ThreadPool(const unsigned int number_of_threads, const bool is_deterministic) : is_deterministic_(is_deterministic) {
+  const unsigned int number_of_workers = (is_deterministic_ || number_of_threads <= 1) ? 0 : number_of_threads - 1;
+  for (unsigned int i = 0; i < number_of_workers + 1; i++) {
+    queues_.push_back(std::make_unique<TaskQueue>());
+  }
+  for (unsigned int i = 1; i < number_of_workers + 1; i++) {
+    workers_.emplace_back(&ThreadPool::RunWorker, this, (size_t)i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    is_stopped_ = true;
+  }
+  task_condition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+  size_t queue_index = GetCurrentQueueIndex();
+  if (queue_index == 0 && !workers_.empty()) {
+    // Distribute the tasks from the threads out of the pool to the worker queues in turn
+    queue_index = 1 + next_queue_index_++ % workers_.size();
+  }
+  {
+    std::lock_guard<std::mutex> lock(queues_[queue_index]->mutex);
+    queues_[queue_index]->tasks.push_back(std::move(task));
+  }
+  number_of_queued_tasks_++;
+  if (!workers_.empty()) {
+    // Lock to avoid the lost wake-up between the check of the queues and the wait of the workers
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    task_condition_.notify_one();
+  }
+}
+
+void ThreadPool::WaitUntil(const std::function<bool()>& is_finished) {
+  const size_t queue_index = GetCurrentQueueIndex();
+  while (!is_finished()) {
+    if (TryRunTask(queue_index)) continue;
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    completion_condition_.wait_for(lock, std::chrono::milliseconds(1), [&] { return number_of_queued_tasks_ > 0 || is_finished(); });
+  }
+}
+
+void ThreadPool::ParallelFor(const size_t count, const std::function<void(size_t)>& function) {
+  if (count == 0) return;
+  if (workers_.empty() || count == 1) {
+    for (size_t i = 0; i < count; i++) {
+      function(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next_index{0};
+  std::atomic<size_t> number_of_running_helpers{0};
+  std::mutex exception_mutex;
+  std::exception_ptr exception = nullptr;
+  auto run = [&]() {
+    while (true) {
+      const size_t index = next_index++;
+      if (index >= count) break;
+      try {
+        function(index);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (exception == nullptr) exception = std::current_exception();
+        next_index = count;  // Stop taking new indices
+        break;
+      }
+    }
+  };
+
+  const size_t number_of_helpers = std::min(count, (size_t)GetNumberOfThreads()) - 1;
+  number_of_running_helpers = number_of_helpers;
+  for (size_t i = 0; i < number_of_helpers; i++) {
+    Submit([&]() {
+      run();
+      number_of_running_helpers--;
+    });
+  }
+  run();
+  WaitUntil([&]() { return number_of_running_helpers == 0; });
+
+  if (exception != nullptr) std::rethrow_exception(exception);
+}
+
+void ThreadPool::RunWorker(const size_t queue_index) {
+  current_thread_pool = this;
+  current_queue_index = queue_index;
+  while (true) {
+    if (TryRunTask(queue_index)) continue;
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    task_condition_.wait(lock, [this] { return is_stopped_ || number_of_queued_tasks_ > 0; });
+    if (is_stopped_) return;
+  }
+}
+
+bool ThreadPool::TryRunTask(const size_t queue_index) {
+  if (number_of_queued_tasks_ == 0) return false;
+
+  std::function<void()> task;
+  // The own queue first. The newest task is taken by the workers for the cache locality, and the oldest task is taken by the threads out of
+  // the pool to keep the submitted order in the deterministic mode.
+  {
+    TaskQueue& queue = *queues_[queue_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      if (queue_index == 0) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      } else {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      }
+    }
+  }
+  // Steal the oldest task of the other queues
+  for (size_t i = 1; !task && i < queues_.size(); i++) {
+    TaskQueue& queue = *queues_[(queue_index + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+  }
+  if (!task) return false;
+
+  number_of_queued_tasks_--;
+  task();
+  {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    completion_condition_.notify_all();
+  }
+  return true;
+}
+
+size_t ThreadPool::GetCurrentQueueIndex() const { return current_thread_pool == this ? current_queue_index : 0; }
+
+size_t TaskGraph::AddTask(const std::string name, std::function<void()> function, const std::vector<size_t>& dependencies) {
+  const size_t task_id = tasks_.size();
+  for (const size_t dependency : dependencies) {
+    if (dependency >= task_id) throw std::invalid_argument("TaskGraph: The dependency of the task " + name + " is not added before the task.");
+  }
+  Task task;
+  task.name = name;
+  task.function = std::move(function);
+  task.number_of_dependencies = dependencies.size();
+  tasks_.push_back(std::move(task));
+  for (const size_t dependency : dependencies) {
+    tasks_[dependency].successors.push_back(task_id);
+  }
+  return task_id;
+}
+
+size_t TaskGraph::AddBarrier(const std::string name) {
+  std::vector<size_t> dependencies(tasks_.size());
+  for (size_t i = 0; i < dependencies.size(); i++) {
+    dependencies[i] = i;
+  }
+  return AddTask(name, nullptr, dependencies);
+}
+
+void TaskGraph::Execute(ThreadPool& thread_pool) {
+  number_of_finished_tasks_ = 0;
+  exception_ = nullptr;
+  std::vector<size_t> ready_tasks;
+  for (size_t i = 0; i < tasks_.size(); i++) {
+    tasks_[i].number_of_remaining_dependencies = tasks_[i].number_of_dependencies;
+    tasks_[i].time_s = 0.0;
+    if (tasks_[i].number_of_dependencies == 0) ready_tasks.push_back(i);
+  }
+  for (const size_t task_id : ready_tasks) {
+    thread_pool.Submit([this, &thread_pool, task_id]() { RunTask(thread_pool, task_id); });
+  }
+  thread_pool.WaitUntil([this]() { return number_of_finished_tasks_ == tasks_.size(); });
+
+  if (exception_ != nullptr) std::rethrow_exception(exception_);
+}
+
+void TaskGraph::WriteTimings(std::ostream& stream) const {
+  for (const auto& task : tasks_) {
+    if (!task.function) continue;
+    stream << task.name << ": " << task.time_s * 1e3 << " ms" << std::endl;
+  }
+}
+
+void TaskGraph::RunTask(ThreadPool& thread_pool, const size_t task_id) {
+  Task& task = tasks_[task_id];
+  bool is_cancelled;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_cancelled = exception_ != nullptr;
+  }
+  if (task.function && !is_cancelled) {
+    const auto start_time = std::chrono::steady_clock::now();
+    try {
+      task.function();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (exception_ == nullptr) exception_ = std::current_exception();
+    }
+    task.time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  }
+
+  std::vector<size_t> ready_tasks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const size_t successor : task.successors) {
+      if (--tasks_[successor].number_of_remaining_dependencies == 0) ready_tasks.push_back(successor);
+    }
+  }
+  for (const size_t successor : ready_tasks) {
+    thread_pool.Submit([this, &thread_pool, successor]() { RunTask(thread_pool, successor); });
+  }
+  number_of_finished_tasks_++;
+}
@@ -0,0 +1,206 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Work-stealing thread pool and task graph shared by the parallel features of the simulation
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
+#define S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Work-stealing thread pool
+ * @details Each worker has its own task queue. A worker takes the newest task of its own queue, and takes the oldest task of the other queues
+ *          when its queue is empty. The tasks submitted from the threads out of the pool are distributed to the queues in turn. The calling
+ *          thread also executes the tasks while it waits in WaitUntil, ParallelFor, and TaskGraph::Execute.
+ *          In the deterministic mode, no worker is created and all tasks are executed in the calling thread in the submitted order, so the
+ *          results are reproducible even when the tasks are not independent.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @fn ThreadPool
+   * @brief Constructor
+   * @param [in] number_of_threads: Number of threads including the calling thread. The tasks are executed serially when it is 1.
+   * @param [in] is_deterministic: Execute all tasks in the calling thread in the submitted order
+   */
+  explicit ThreadPool(const unsigned int number_of_threads, const bool is_deterministic = false);
+  /**
+   * @fn ~ThreadPool
+   * @brief Destructor. The queued tasks which are not started are discarded.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @fn Submit
+   * @brief Submit a task
+   * @note The task must not throw. Use ParallelFor or TaskGraph to propagate the exceptions to the calling thread.
+   * @param [in] task: Task to be executed
+   */
+  void Submit(std::function<void()> task);
+  /**
+   * @fn WaitUntil
+   * @brief Execute the queued tasks in the calling thread until the condition is satisfied
+   * @param [in] is_finished: Condition to finish the wait. It must become true by the completion of the submitted tasks.
+   */
+  void WaitUntil(const std::function<bool()>& is_finished);
+  /**
+   * @fn ParallelFor
+   * @brief Call the function for each index in [0, count) concurrently and wait for the completion
+   * @note The indices are taken from a shared counter, so the threads which finish earlier take more indices. An exception thrown by the
+   *       function stops taking new indices and is rethrown in the calling thread.
+   * @param [in] count: Number of indices
+   * @param [in] function: Function called with the index
+   */
+  void ParallelFor(const size_t count, const std::function<void(size_t)>& function);
+
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of threads including the calling thread
+   */
+  inline unsigned int GetNumberOfThreads() const { return (unsigned int)workers_.size() + 1; }
+  /**
+   * @fn IsDeterministic
+   * @brief Return true in the deterministic mode
+   */
+  inline bool IsDeterministic() const { return is_deterministic_; }
+
+ private:
+  /**
+   * @struct TaskQueue
+   * @brief Task queue of a thread
+   */
+  struct TaskQueue {
+    std::mutex mutex;                         //!< Mutex for the tasks
+    std::deque<std::function<void()>> tasks;  //!< Queued tasks
+  };
+
+  bool is_deterministic_;                           //!< Flag of the deterministic mode
+  std::vector<std::thread> workers_;                //!< Worker threads
+  std::vector<std::unique_ptr<TaskQueue>> queues_;  //!< Task queues. The queue 0 is used by the threads out of the pool.
+  std::atomic<size_t> number_of_queued_tasks_{0};   //!< Number of the queued tasks which are not started
+  std::atomic<size_t> next_queue_index_{0};         //!< Queue index for the tasks submitted from the threads out of the pool
+  std::mutex wait_mutex_;                           //!< Mutex for the following conditions
+  std::condition_variable task_condition_;          //!< Condition to notify a new task to the workers
+  std::condition_variable completion_condition_;    //!< Condition to notify a completed task to the waiting threads
+  bool is_stopped_ = false;                         //!< Flag to stop the workers
+
+  /**
+   * @fn RunWorker
+   * @brief Main loop of the worker threads
+   * @param [in] queue_index: Index of the queue of the worker
+   */
+  void RunWorker(const size_t queue_index);
+  /**
+   * @fn TryRunTask
+   * @brief Take a task from the own queue or the other queues and execute it
+   * @param [in] queue_index: Index of the own queue
+   * @return True when a task is executed
+   */
+  bool TryRunTask(const size_t queue_index);
+  /**
+   * @fn GetCurrentQueueIndex
+   * @brief Return the queue index of the current thread (0 for the threads out of the pool)
+   */
+  size_t GetCurrentQueueIndex() const;
+};
+
+/**
+ * @class TaskGraph
+ * @brief Graph of the tasks with the dependencies executed with ThreadPool
+ * @details A task starts after all its dependencies are finished. The dependencies must be added before the task, so the graph has no
+ *          cycle. The graph can be executed repeatedly (e.g., once per simulation step), and the calculation time of each task in the last
+ *          execution is kept.
+ */
+class TaskGraph {
+ public:
+  /**
+   * @fn AddTask
+   * @brief Add a task. Throws std::invalid_argument when a dependency is not added before.
+   * @param [in] name: Name of the task to show the timings
+   * @param [in] function: Function of the task
+   * @param [in] dependencies: IDs of the tasks which must be finished before the task
+   * @return ID of the task
+   */
+  size_t AddTask(const std::string name, std::function<void()> function, const std::vector<size_t>& dependencies = {});
+  /**
+   * @fn AddBarrier
+   * @brief Add a task without function which depends on all the tasks added before
+   * @param [in] name: Name of the barrier
+   * @return ID of the barrier
+   */
+  size_t AddBarrier(const std::string name = "barrier");
+  /**
+   * @fn Execute
+   * @brief Execute all tasks and wait for the completion
+   * @note An exception thrown by a task stops starting the functions of the remaining tasks and is rethrown in the calling thread.
+   * @param [in] thread_pool: Thread pool to execute the tasks
+   */
+  void Execute(ThreadPool& thread_pool);
+
+  /**
+   * @fn GetNumberOfTasks
+   * @brief Return number of the tasks
+   */
+  inline size_t GetNumberOfTasks() const { return tasks_.size(); }
+  /**
+   * @fn GetTaskName
+   * @brief Return name of the task
+   */
+  inline const std::string& GetTaskName(const size_t task_id) const { return tasks_[task_id].name; }
+  /**
+   * @fn GetTaskTime_s
+   * @brief Return calculation time of the task in the last execution [s]
+   */
+  inline double GetTaskTime_s(const size_t task_id) const { return tasks_[task_id].time_s; }
+  /**
+   * @fn WriteTimings
+   * @brief Write the calculation time of each task in the last execution
+   * @param [out] stream: Output stream
+   */
+  void WriteTimings(std::ostream& stream) const;
+
+ private:
+  /**
+   * @struct Task
+   * @brief Task in the graph
+   */
+  struct Task {
+    std::string name;                             //!< Name of the task
+    std::function<void()> function;               //!< Function of the task (empty for the barriers)
+    size_t number_of_dependencies;                //!< Number of the dependencies
+    std::vector<size_t> successors;               //!< IDs of the tasks which depend on this task
+    size_t number_of_remaining_dependencies = 0;  //!< Number of the dependencies which are not finished in the execution
+    double time_s = 0.0;                          //!< Calculation time in the last execution [s]
+  };
+
+  std::vector<Task> tasks_;                          //!< Tasks
+  std::mutex mutex_;                                 //!< Mutex for the states of the execution
+  std::atomic<size_t> number_of_finished_tasks_{0};  //!< Number of the finished tasks in the execution
+  std::exception_ptr exception_ = nullptr;           //!< First exception thrown in the execution
+
+  /**
+   * @fn RunTask
+   * @brief Execute a task and submit its successors which become ready
+   * @param [in] thread_pool: Thread pool to execute the tasks
+   * @param [in] task_id: ID of the task
+   */
+  void RunTask(ThreadPool& thread_pool, const size_t task_id);
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
@@ -0,0 +1,22 @@
+/**
+ * @file type_name.cpp
+ * @brief Function to get the readable name of a type
+ */
+
+#include "type_name.hpp"
+
+#include <cstdlib>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+std::string GetTypeName(const std::type_info& type) {
+  std::string type_name = type.name();
+#ifdef __GNUG__
+  int status = 0;
+  char* demangled_name = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+  if (status == 0 && demangled_name != nullptr) type_name = demangled_name;
+  std::free(demangled_name);
+#endif
+  return type_name;
+}
@@ -0,0 +1,19 @@
+/**
+ * @file type_name.hpp
+ * @brief Function to get the readable name of a type
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_TYPE_NAME_HPP_
+#define S2E_LIBRARY_UTILITIES_TYPE_NAME_HPP_
+
+#include <string>
+#include <typeinfo>
+
+/**
+ * @fn GetTypeName
+ * @brief Return the demangled name of the type (e.g., ReactionWheel). The compiler specific name is returned when it cannot be demangled.
+ * @param [in] type: Type information
+ */
+std::string GetTypeName(const std::type_info& type);
+
+#endif  // S2E_LIBRARY_UTILITIES_TYPE_NAME_HPP_